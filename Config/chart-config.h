@@ -0,0 +1,5 @@
+// Setup for strip charts
+
+/** Define this if the display driver provides glcd_scroll() (for example the
+    ST7565 library), so that charts can use CHART_SCROLL. */
+#define CHART_HARDWARE_SCROLL
@@ -0,0 +1,4 @@
+// Setup for the compositor
+
+/** The maximum number of layers above glcd_buffer */
+#define COMPOSITOR_LAYERS 3
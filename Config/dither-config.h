@@ -0,0 +1,5 @@
+// Setup for dithering
+
+/** The widest image that can be drawn with DITHER_DIFFUSION.  This uses
+    2 bytes of RAM for every pixel of width. */
+#define DITHER_MAX_WIDTH 128
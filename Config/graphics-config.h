@@ -0,0 +1,34 @@
+// Setup for the graphics library
+
+/** Screen width in pixels, this must match the display driver */
+#ifndef SCREEN_WIDTH
+#define SCREEN_WIDTH 128
+#endif
+/** Screen height in pixels, this must match the display driver */
+#ifndef SCREEN_HEIGHT
+#define SCREEN_HEIGHT 64
+#endif
+
+/** Define this to draw straight into the buffer of drivers that keep a
+    page-oriented copy of the screen in RAM (for example the ST7565 library, see
+    buffer in glcd_driver_t).  Text and shapes are then written a byte at a time
+    instead of through the driver hooks.  Undefine it to save code space if no
+    driver has a buffer. */
+#define GRAPHICS_DIRECT_BUFFER
+
+/** The number of clip rectangles that can be saved by graphics_clip_push() */
+#define GRAPHICS_CLIP_DEPTH 4
+
+/** The most vertices draw_filled_polygon() can fill, each needs two ints on
+    the stack while drawing */
+#define GRAPHICS_POLYGON_MAX 8
+
+/** Define this to decode the strings passed to draw_text(), draw_text_box(),
+    text_width() and text_height() as UTF-8, so that characters beyond ASCII
+    can be drawn from fonts that have them (see font_range_t).  Undefine it
+    to treat every byte as one character. */
+#define GRAPHICS_UTF8
+
+/* GRAPHICS_COUNT_WRITES can be defined on the command line to count every
+   byte written into the buffer in graphics_bytes_written.  It is only meant
+   for the benchmark in Support/Simulator, so it is not defined here. */
@@ -18,6 +18,15 @@
 /** Define this if your screen is incorrectly shifted by 4 pixels */
 #define ST7565_REVERSE
 
-/** By default we only write pages that have changed.  Undefine this
-    if you want less/faster code at the expense of more SPI operations. */
-#undef ST7565_DIRTY_PAGES 1
\ No newline at end of file
+/** By default we only write the columns of each page that have changed.  Undefine
+    this if you want less/faster code at the expense of more SPI operations. */
+#define ST7565_DIRTY_PAGES
+
+/** Define this to keep a second copy of what has been sent to the screen, so that
+    only bytes which have really changed are written.  This costs another
+    SCREEN_WIDTH * SCREEN_HEIGHT / 8 bytes of RAM. */
+#undef ST7565_SHADOW_BUFFER
+
+/** Define this to combine the layers of the compositor library with the buffer
+    as it is sent to the screen.  See compositor.h. */
+#undef ST7565_COMPOSITOR
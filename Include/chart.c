@@ -0,0 +1,105 @@
+#include "chart.h"
+#include "graphics.h"
+#include "main.h"
+#include "graphics-config.h"
+#include "chart-config.h"
+
+// Scrolling needs the screen to be rotated, which is only possible with
+// GRAPHICS_DIRECT_BUFFER.  Without it CHART_SCROLL is not available.
+#ifndef GRAPHICS_DIRECT_BUFFER
+#undef CHART_HARDWARE_SCROLL
+#endif
+
+#ifdef CHART_HARDWARE_SCROLL
+// Provided by the display driver, see chart-config.h
+extern void glcd_scroll(unsigned char line);
+// How the graphics library is rotated, see graphics_set_rotation()
+extern unsigned char graphics_rotation;
+#endif
+
+unsigned char chart_init(chart_t *chart, unsigned char *samples, unsigned char x, unsigned char y, unsigned char width, unsigned char height, unsigned char mode) {
+	if (mode == CHART_SCROLL) {
+#ifdef CHART_HARDWARE_SCROLL
+		// The display start line moves rows of the screen, which are only
+		// columns of the chart when the screen is on its side
+		if (graphics_rotation != GRAPHICS_ROTATE_90 && graphics_rotation != GRAPHICS_ROTATE_270) return 0;
+		if (x != 1 || width != SCREEN_HEIGHT) return 0;
+
+		glcd_scroll(0);
+#else
+		return 0;
+#endif
+	}
+
+	chart->samples = samples;
+	chart->x = x;
+	chart->y = y;
+	chart->width = width;
+	chart->height = height;
+	chart->mode = mode;
+	chart->cursor = 0;
+	chart->count = 0;
+
+	draw_filled_rectangle(x, y, x + width - 1, y + height - 1, 0);
+
+	return 1;
+}
+
+void chart_add(chart_t *chart, unsigned char value) {
+	unsigned char column = chart->cursor;
+
+	if (value >= chart->height) value = chart->height - 1;
+
+	chart->samples[column] = value;
+	chart->cursor = column + 1 < chart->width ? column + 1 : 0;
+
+	// A sweeping chart always has one blank column
+	if (chart->count < chart->width - (chart->mode == CHART_SWEEP)) chart->count++;
+
+	_chart_column(chart, column);
+
+	if (chart->mode == CHART_SWEEP) {
+		// Clear the oldest sample to show where the sweep is
+		if (chart->cursor != column) _chart_column(chart, chart->cursor);
+	}
+#ifdef CHART_HARDWARE_SCROLL
+	else {
+		// Move the start line so that the newest sample is on the right
+		if (graphics_rotation == GRAPHICS_ROTATE_90) {
+			glcd_scroll(chart->cursor);
+		} else {
+			glcd_scroll((SCREEN_HEIGHT - chart->cursor) % SCREEN_HEIGHT);
+		}
+	}
+#endif
+}
+
+void chart_redraw(chart_t *chart) {
+	unsigned char column;
+
+	for (column = 0; column < chart->width; column++) {
+		_chart_column(chart, column);
+	}
+}
+
+// Draw a single column of the chart.  Each sample is joined to the one
+// before it with a vertical line, so that steep changes are not broken up.
+void _chart_column(chart_t *chart, unsigned char column) {
+	unsigned char x = chart->x + column;
+	unsigned char bottom = chart->y + chart->height - 1;
+	unsigned char value = chart->samples[column];
+	unsigned char previous = value;
+	unsigned char age;
+
+	// How many samples ago this column was drawn, 0 for the newest
+	age = (chart->cursor + chart->width - 1 - column) % chart->width;
+
+	draw_vspan(x, chart->y, bottom, 0);
+	if (age >= chart->count) return;
+
+	if (age + 1 < chart->count) {
+		previous = chart->samples[column ? column - 1 : chart->width - 1];
+	}
+
+	draw_vspan(x, bottom - previous, bottom - value, 1);
+}
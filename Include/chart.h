@@ -0,0 +1,112 @@
+/**
+ * @file   chart.h
+ * @date   October, 2026
+ * @brief  Header for strip charts that add one column per sample.
+ * @details
+ *
+ * A strip chart shows the most recent samples of a value, one column for each sample.
+ * Redrawing and shifting the whole chart for every sample is slow and sends the entire
+ * chart to the screen each time.  Instead the chart is treated as a circular buffer of
+ * columns, so adding a sample only ever changes one or two columns of the screen.
+ *
+ * Two modes are available:
+ *
+ *  - CHART_SWEEP draws each sample one column to the right of the last, wrapping
+ *    around to the left edge when the chart is full.  A blank column just ahead of
+ *    the newest sample shows where the sweep is.  This works anywhere on the screen
+ *    and each sample changes two columns.
+ *  - CHART_SCROLL keeps the newest sample at the right edge and scrolls the rest of
+ *    the chart to the left, using the display start line of the screen rather than
+ *    moving any data.  Each sample changes a single column.
+ *
+ * The display start line scrolls the whole screen vertically, so CHART_SCROLL only
+ * works for a chart that fills a screen mounted in portrait (see
+ * graphics_set_rotation()).  Anything else on the screen scrolls with the chart.  It
+ * needs a driver that provides glcd_scroll(), see CHART_HARDWARE_SCROLL in
+ * chart-config.h, and GRAPHICS_DIRECT_BUFFER for the rotation.
+ *
+ * Samples are from 0 (the bottom of the chart) to height - 1 (the top), so should
+ * be scaled before they are added.  The caller supplies width bytes of RAM to hold
+ * the samples, which allows the chart to be redrawn.
+ *
+ * Example usage:
+ * @code
+ *    unsigned char samples[100];
+ *    chart_t chart;
+ *
+ *    // A 100x40 chart at (15,20)
+ *    chart_init(&chart, samples, 15, 20, 100, 40, CHART_SWEEP);
+ *    draw_rectangle(14, 19, 115, 60, 1);
+ *
+ *    for (;;) {
+ *        chart_add(&chart, read_temperature() / 2);
+ *        glcd_refresh();
+ *    }
+ * @endcode
+ */
+#ifndef _CHART_H_
+#define _CHART_H_
+
+/** Draw across the chart, wrapping around at the right edge */
+#define CHART_SWEEP		0
+/** Scroll the chart left with the display start line */
+#define CHART_SCROLL	1
+
+/**
+ * A strip chart.  Use chart_init() to set this up.
+ */
+typedef struct {
+	/** The sample drawn in each column, width bytes */
+	unsigned char *samples;
+	/** Left edge of the chart, from 1 - SCREEN_WIDTH */
+	unsigned char x;
+	/** Top edge of the chart, from 1 - SCREEN_HEIGHT */
+	unsigned char y;
+	/** Width of the chart in pixels, which is also the number of samples */
+	unsigned char width;
+	/** Height of the chart in pixels */
+	unsigned char height;
+	/** CHART_SWEEP or CHART_SCROLL */
+	unsigned char mode;
+	/** The column for the next sample, from 0 */
+	unsigned char cursor;
+	/** The number of samples shown */
+	unsigned char count;
+} chart_t;
+
+/**
+ * Set up a chart and clear its area of the screen.
+ *
+ * CHART_SCROLL needs the screen to be rotated by 90 or 270 degrees, and the
+ * chart must start at the left edge and be as wide as the rotated screen.
+ *
+ * @param chart		The chart
+ * @param samples	RAM for the samples, width bytes
+ * @param x			The x position, from 1 - SCREEN_WIDTH
+ * @param y			The y position, from 1 - SCREEN_HEIGHT
+ * @param width		Width of the chart in pixels
+ * @param height	Height of the chart in pixels
+ * @param mode		CHART_SWEEP or CHART_SCROLL
+ * @return			0 if the chart cannot use CHART_SCROLL, 1 otherwise
+ */
+unsigned char chart_init(chart_t *chart, unsigned char *samples, unsigned char x, unsigned char y, unsigned char width, unsigned char height, unsigned char mode);
+/**
+ * Add a sample to the chart, replacing the oldest sample once the chart is
+ * full.
+ *
+ * @param chart		The chart
+ * @param value		From 0 (bottom) to height - 1 (top), higher values are
+ *					drawn at the top
+ */
+void chart_add(chart_t *chart, unsigned char value);
+/**
+ * Draw the whole chart again, for example after the screen has been cleared.
+ *
+ * @param chart		The chart
+ */
+void chart_redraw(chart_t *chart);
+
+/* Internal functions (do not call) */
+void _chart_column(chart_t *chart, unsigned char column);
+
+#endif // _CHART_H_
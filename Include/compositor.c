@@ -0,0 +1,127 @@
+#include "compositor.h"
+#include "graphics.h"
+#include "main.h"
+#include "graphics-config.h"
+#include "compositor-config.h"
+
+#ifndef GRAPHICS_DIRECT_BUFFER
+#error The compositor needs GRAPHICS_DIRECT_BUFFER, see graphics-config.h
+#endif
+
+// Provided by the display driver
+extern unsigned char glcd_buffer[];
+extern void glcd_mark_dirty(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2);
+
+// Layers from the bottom to the top
+layer_t *compositor_layers[COMPOSITOR_LAYERS];
+unsigned char compositor_count = 0;
+
+// A page of the screen with the layers combined, sent by the driver
+unsigned char compositor_line[SCREEN_WIDTH];
+
+unsigned char compositor_add(layer_t *layer) {
+	if (compositor_count == COMPOSITOR_LAYERS) return 0;
+
+	compositor_layers[compositor_count++] = layer;
+
+	if (layer->visible) {
+		_compositor_mark_dirty(layer);
+	}
+
+	return 1;
+}
+
+void compositor_remove(layer_t *layer) {
+	unsigned char i;
+
+	for (i = 0; i < compositor_count; i++) {
+		if (compositor_layers[i] != layer) continue;
+
+		// Close the gap, keeping the order of the layers above
+		compositor_count--;
+		for (; i < compositor_count; i++) {
+			compositor_layers[i] = compositor_layers[i + 1];
+		}
+
+		if (layer->visible) {
+			_compositor_mark_dirty(layer);
+		}
+		return;
+	}
+}
+
+void compositor_show(layer_t *layer, unsigned char visible) {
+	visible = visible ? 1 : 0;
+	if (layer->visible == visible) return;
+
+	layer->visible = visible;
+	_compositor_mark_dirty(layer);
+}
+
+void compositor_draw(layer_t *layer) {
+	if (layer) {
+		graphics_set_target(layer->data, layer->width, layer->pages * 8, layer->x, layer->page * 8 + 1);
+	} else {
+		graphics_set_target(0, 0, 0, 0, 0);
+	}
+}
+
+void compositor_draw_mask(layer_t *layer) {
+	graphics_set_target(layer->mask, layer->width, layer->pages * 8, layer->x, layer->page * 8 + 1);
+}
+
+unsigned char *compositor_page(unsigned char page, unsigned char x1, unsigned char x2) {
+	unsigned char *line = &glcd_buffer[page * SCREEN_WIDTH];
+	const unsigned char *data;
+	const unsigned char *mask;
+	layer_t *layer;
+	unsigned char i, n, x, end;
+	unsigned short offset;
+
+	for (i = 0; i < compositor_count; i++) {
+		layer = compositor_layers[i];
+
+		// Skip layers that do not cover this part of the page
+		if (!layer->visible || page < layer->page || page >= layer->page + layer->pages) continue;
+		x = layer->x - 1;
+		end = x + layer->width - 1;
+		if (end < x1 || x > x2) continue;
+
+		offset = (page - layer->page) * layer->width;
+		if (x < x1) {
+			offset += x1 - x;
+			x = x1;
+		}
+		if (end > x2) end = x2;
+
+		// The first layer on this page starts from a copy of glcd_buffer,
+		// pages without any layers are sent straight from glcd_buffer
+		if (line != compositor_line) {
+			for (n = x1; n <= x2; n++) {
+				compositor_line[n] = line[n];
+			}
+			line = compositor_line;
+		}
+
+		data = &layer->data[offset];
+		if (layer->mask) {
+			mask = &layer->mask[offset];
+			for (; x <= end; x++) {
+				compositor_line[x] = (compositor_line[x] & ~*mask) | (*data++ & *mask);
+				mask++;
+			}
+		} else {
+			for (; x <= end; x++) {
+				compositor_line[x] = *data++;
+			}
+		}
+	}
+
+	return line;
+}
+
+// Tell the driver that the area under a layer needs to be sent again
+void _compositor_mark_dirty(layer_t *layer)
+{
+	glcd_mark_dirty(layer->x, layer->page * 8 + 1, layer->x + layer->width - 1, (layer->page + layer->pages) * 8);
+}
@@ -0,0 +1,120 @@
+/**
+ * @file   compositor.h
+ * @date   October, 2026
+ * @brief  Header for a layered black and white compositor.
+ * @details
+ *
+ * Overlays such as popups, cursors or blinking indicators can be kept in their own
+ * layers instead of being drawn into the screen buffer.  The layers are combined with
+ * glcd_buffer a page at a time as the screen is refreshed, so showing or hiding an
+ * overlay never needs the background underneath it to be redrawn.
+ *
+ * glcd_buffer is always the bottom layer.  Other layers are stacked above it in the
+ * order they were added.  Each layer covers a rectangle of whole pages and has its
+ * own page-oriented buffer, along with an optional mask of the same size.  Where a
+ * mask bit is set the layer replaces whatever is below it, elsewhere the layer is
+ * transparent.  A layer without a mask is opaque.
+ *
+ * This requires GRAPHICS_DIRECT_BUFFER in graphics-config.h and ST7565_COMPOSITOR in
+ * st7565-config.h.  The RAM for each layer is supplied by the caller.
+ *
+ * Example usage:
+ * @code
+ *    // A 32x16 popup at column 49, page 3 (rows 25 - 40)
+ *    unsigned char popup_data[32 * 2];
+ *    layer_t popup = { popup_data, 0, 49, 3, 32, 2, 0 };
+ *
+ *    compositor_add(&popup);
+ *
+ *    // Draw into the layer, coordinates are relative to the layer
+ *    compositor_draw(&popup);
+ *    draw_rectangle(1, 1, 32, 16, 1);
+ *    draw_text("ALARM", 4, 4, &Tahoma10, 1);
+ *    compositor_draw(0);
+ *
+ *    // Blink it, only the columns under the popup are sent
+ *    compositor_show(&popup, 1);
+ *    glcd_refresh();
+ *    compositor_show(&popup, 0);
+ *    glcd_refresh();
+ * @endcode
+ */
+#ifndef _COMPOSITOR_H_
+#define _COMPOSITOR_H_
+
+/**
+ * A layer, covering a rectangle of whole pages on the screen.
+ *
+ * The data and mask are stored like glcd_buffer, one byte for every 8 rows
+ * of each column, with width bytes for each page.  The layer must fit
+ * entirely on the screen.
+ */
+typedef struct {
+	/** Bitmap data, width * pages bytes */
+	unsigned char *data;
+	/** Mask data, width * pages bytes, or 0 for an opaque layer */
+	unsigned char *mask;
+	/** Left column of the layer, from 1 - SCREEN_WIDTH */
+	unsigned char x;
+	/** Top page of the layer, from 0 - (SCREEN_HEIGHT / 8 - 1) */
+	unsigned char page;
+	/** Width of the layer in pixels */
+	unsigned char width;
+	/** Height of the layer in pages (8 pixels each) */
+	unsigned char pages;
+	/** 0 = hidden, any other value = shown */
+	unsigned char visible;
+} layer_t;
+
+/**
+ * Add a layer on top of all of the others.  It will be shown on the next
+ * refresh if it is visible.
+ *
+ * @param layer		The layer to add
+ * @return			0 if COMPOSITOR_LAYERS has been reached, 1 otherwise
+ */
+unsigned char compositor_add(layer_t *layer);
+/**
+ * Remove a layer, revealing whatever was underneath it.
+ *
+ * @param layer		The layer to remove
+ */
+void compositor_remove(layer_t *layer);
+/**
+ * Show or hide a layer.  Only the area covered by the layer is marked as
+ * changed, so the next refresh sends just those columns.
+ *
+ * @param layer		The layer to show or hide
+ * @param visible	0 = hide, any other value = show
+ */
+void compositor_show(layer_t *layer, unsigned char visible);
+/**
+ * Direct the graphics library at a layer, so that everything drawn goes
+ * into the layer's data.  Coordinates are relative to the top left of the
+ * layer.
+ *
+ * @param layer		The layer to draw into, or 0 to draw into glcd_buffer again
+ */
+void compositor_draw(layer_t *layer);
+/**
+ * Direct the graphics library at a layer's mask, so that shapes drawn with
+ * colour 1 make that part of the layer opaque.
+ *
+ * @param layer		The layer whose mask should be drawn into
+ */
+void compositor_draw_mask(layer_t *layer);
+/**
+ * Combine the visible layers for part of a page.  Called by the display
+ * driver as it refreshes the screen.
+ *
+ * @param page		The page, from 0 - (SCREEN_HEIGHT / 8 - 1)
+ * @param x1		The first column, from 0 - (SCREEN_WIDTH - 1)
+ * @param x2		The last column, from 0 - (SCREEN_WIDTH - 1)
+ * @return			The whole page, indexed by column.  Only x1 to x2 are valid.
+ */
+unsigned char *compositor_page(unsigned char page, unsigned char x1, unsigned char x2);
+
+/* Internal functions (do not call) */
+void _compositor_mark_dirty(layer_t *layer);
+
+#endif // _COMPOSITOR_H_
@@ -0,0 +1,121 @@
+#include "graphics.h"
+#include "console.h"
+#include "main.h"
+#include "graphics-config.h"
+
+// Provided by the display driver, see glcd_scroll() in st7565.h
+extern void glcd_scroll(unsigned char line);
+
+#ifdef GRAPHICS_DIRECT_BUFFER
+// How the graphics library is rotated, see graphics_set_rotation()
+extern unsigned char graphics_rotation;
+#endif
+
+const font_t *console_font;
+unsigned char console_spacing;
+
+// Height of each line in pixels, and the number of lines on the screen
+unsigned char console_pitch;
+unsigned char console_lines;
+
+// Where the next letter goes.  Lines are counted from the top of the
+// screen, and a line of console_lines means that the screen must scroll
+// before anything else is printed.
+unsigned char console_x;
+unsigned char console_line;
+
+// The line of the buffer shown at the top of the screen
+unsigned char console_start;
+
+unsigned char console_init(const font_t *font, unsigned char spacing) {
+	unsigned char pitch = 8;
+
+	// The buffer rows are not where they appear on a rotated screen
+#ifdef GRAPHICS_DIRECT_BUFFER
+	if (graphics_rotation != GRAPHICS_ROTATE_0) return 0;
+#endif
+
+	// Lines must divide the screen exactly, so that one never wraps
+	// around the bottom of the buffer
+	while (pitch < font->height) pitch *= 2;
+	if (pitch > SCREEN_HEIGHT) return 0;
+
+	console_font = font;
+	console_spacing = spacing;
+	console_pitch = pitch;
+	console_lines = SCREEN_HEIGHT / pitch;
+
+	console_clear();
+
+	return 1;
+}
+
+void console_clear(void) {
+	console_x = 1;
+	console_line = 0;
+	console_start = 0;
+
+	glcd_scroll(0);
+	draw_filled_rectangle(1, 1, SCREEN_WIDTH, SCREEN_HEIGHT, 0);
+}
+
+void console_putc(char c) {
+	unsigned char index;
+	unsigned char width;
+
+	if (c == '\r') {
+		console_x = 1;
+		return;
+	}
+	if (c == '\n') {
+		_console_new_line();
+		return;
+	}
+
+	index = font_glyph(console_font, (unsigned char) c);
+	if (index == FONT_NO_GLYPH) return;
+	width = console_font->widths[index];
+
+	// Wrap long lines
+	if (console_x > 1 && console_x + width - 1 > SCREEN_WIDTH) {
+		_console_new_line();
+	}
+
+	// Scrolling waits until there is something to show on the new line,
+	// otherwise text ending in a new line would waste the bottom line
+	if (console_line == console_lines) {
+		_console_scroll();
+		console_line--;
+	}
+
+	draw_char((unsigned char) c, console_x, (console_start + console_line * console_pitch) % SCREEN_HEIGHT + 1, console_font);
+	console_x += width + console_spacing;
+}
+
+void console_puts(const char *string) {
+	while (*string) {
+		console_putc(*string++);
+	}
+}
+
+void _console_new_line(void) {
+	console_x = 1;
+
+	if (console_line < console_lines) {
+		console_line++;
+	} else {
+		// A blank line, which scrolls straight away
+		_console_scroll();
+	}
+}
+
+// Scroll up by one line.  The top line moves to the bottom of the screen,
+// where it is cleared ready for new text.
+void _console_scroll(void) {
+	unsigned char y = console_start + 1;
+
+	console_start = (console_start + console_pitch) % SCREEN_HEIGHT;
+	glcd_scroll(console_start);
+
+	draw_filled_rectangle(1, y, SCREEN_WIDTH, y + console_pitch - 1, 0);
+}
@@ -0,0 +1,66 @@
+/**
+ * @file   console.h
+ * @date   October, 2026
+ * @brief  Header for a scrolling text console.
+ * @details
+ *
+ * A terminal-style console for log messages and diagnostics, using the whole screen.
+ * Text is printed a character at a time and long lines wrap onto the next line.  A
+ * carriage return ('\\r') moves back to the start of the current line and a line feed
+ * ('\\n') moves to the start of the next line.
+ *
+ * When the bottom of the screen is reached the console scrolls up by one line using
+ * the display start line of the screen, so none of the lines above need to be drawn
+ * or sent again.  The line that has scrolled off the top is cleared and reused at the
+ * bottom.  Only the pages of that line are sent by the next glcd_refresh().
+ *
+ * Each line is a whole number of pages high (8, 16 or 32 pixels), so that lines never
+ * wrap around the bottom of the buffer.  The System5x7 font in fonts/font_system.h
+ * gives 8 lines of about 25 characters.
+ *
+ * This needs a driver that provides glcd_scroll(), such as the ST7565 library.  The
+ * screen must not be rotated with graphics_set_rotation().
+ *
+ * Example usage:
+ * @code
+ *    console_init(&System5x7, 1);
+ *
+ *    console_puts("Starting\n");
+ *    console_puts("Sensor OK\n");
+ *    glcd_refresh();
+ * @endcode
+ */
+#ifndef _CONSOLE_H_
+#define _CONSOLE_H_
+
+/**
+ * Start the console and clear the screen.
+ *
+ * @param font		The font used for all text
+ * @param spacing	The gap in pixels between letters
+ * @return			0 if the font is too tall or the screen is rotated, 1 otherwise
+ */
+unsigned char console_init(const font_t *font, unsigned char spacing);
+/**
+ * Clear the screen and move to the top left.
+ */
+void console_clear(void);
+/**
+ * Print a single character.  Characters that are not in the font are
+ * skipped.
+ *
+ * @param c			The character, or '\\r' or '\\n'
+ */
+void console_putc(char c);
+/**
+ * Print a string.
+ *
+ * @param string	The text to print
+ */
+void console_puts(const char *string);
+
+/* Internal functions (do not call) */
+void _console_new_line(void);
+void _console_scroll(void);
+
+#endif // _CONSOLE_H_
@@ -27,6 +27,9 @@
  *	MAKE SURE this code is compiled with full optimization!!!
 */
 
+#ifndef _DELAY_H_
+#define _DELAY_H_
+
 #define	MHZ	*1
 
 #ifndef	XTAL_FREQ
@@ -59,4 +62,4 @@
 
 extern void DelayMs(unsigned char);
 
-
+#endif // _DELAY_H_
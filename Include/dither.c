@@ -0,0 +1,111 @@
+#include "dither.h"
+#include "graphics.h"
+#include "main.h"
+#include "graphics-config.h"
+#include "dither-config.h"
+
+// Dithering writes rows straight into the buffer, so like rotation it is
+// only built with GRAPHICS_DIRECT_BUFFER
+#ifdef GRAPHICS_DIRECT_BUFFER
+
+// The buffer being drawn into by the graphics library
+extern unsigned char *graphics_buffer;
+extern unsigned char graphics_stride;
+extern bounding_box_t graphics_clip;
+extern unsigned char graphics_rotation;
+
+// 4x4 Bayer matrix, scaled to thresholds from 8 - 248
+const unsigned char dither_bayer[16] = {
+	  8, 136,  40, 168,
+	200,  72, 232, 104,
+	 56, 184,  24, 152,
+	248, 120, 216,  88
+};
+
+// The image being drawn
+unsigned char dither_x;
+unsigned char dither_y;
+unsigned char dither_width;
+unsigned char dither_method;
+
+// Errors carried into each column of the next row
+int dither_error[DITHER_MAX_WIDTH];
+
+unsigned char dither_start(unsigned char x, unsigned char y, unsigned char width, unsigned char method) {
+	unsigned char i;
+
+	// Rows are written straight into the buffer, which cannot be rotated
+	if (!graphics_buffer || graphics_rotation != GRAPHICS_ROTATE_0) return 0;
+
+	if (method == DITHER_DIFFUSION) {
+		if (width > DITHER_MAX_WIDTH) return 0;
+
+		for (i = 0; i < width; i++) {
+			dither_error[i] = 0;
+		}
+	}
+
+	dither_x = x;
+	dither_y = y;
+	dither_width = width;
+	dither_method = method;
+
+	return 1;
+}
+
+void dither_row(const unsigned char *row) {
+	unsigned char *p;
+	unsigned char bit;
+	unsigned char black;
+	unsigned char visible;
+	unsigned char x = dither_x;
+	unsigned char i;
+	const unsigned char *threshold;
+	int value, error;
+	int right = 0, below_left = 0, below = 0;
+
+	// Rows outside the clip area are still converted, so that the errors
+	// carried into the rows below are correct
+	visible = dither_y >= graphics_clip.y1 && dither_y <= graphics_clip.y2;
+
+	p = &graphics_buffer[((dither_y - 1) / 8) * graphics_stride + x - 1];
+	bit = 1 << ((dither_y - 1) % 8);
+	threshold = &dither_bayer[((dither_y - 1) % 4) * 4];
+
+	for (i = 0; i < dither_width; i++, x++, p++) {
+		if (dither_method == DITHER_DIFFUSION) {
+			value = row[i] + dither_error[i] + right;
+			black = value < 128;
+			error = black ? value : value - 255;
+
+			// Spread the error 7/16 right, then 3/16, 5/16 and 1/16 to the
+			// row below.  The error for the column to the left is now final.
+			right = error * 7 / 16;
+			if (i) dither_error[i - 1] = below_left + error * 3 / 16;
+			below_left = below + error * 5 / 16;
+			below = error / 16;
+		} else {
+			black = row[i] < threshold[(x - 1) % 4];
+		}
+
+		if (!visible || x < graphics_clip.x1 || x > graphics_clip.x2) continue;
+
+		if (black) {
+			*p |= bit;
+		} else {
+			*p &= ~bit;
+		}
+	}
+
+	if (dither_method == DITHER_DIFFUSION && dither_width) {
+		dither_error[dither_width - 1] = below_left;
+	}
+
+	if (visible) {
+		_mark_dirty(dither_x, dither_y, dither_x + dither_width - 1, dither_y);
+	}
+
+	dither_y++;
+}
+
+#endif
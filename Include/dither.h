@@ -0,0 +1,65 @@
+/**
+ * @file   dither.h
+ * @date   October, 2026
+ * @brief  Header for converting greyscale images to black and white.
+ * @details
+ *
+ * Greyscale images (for example from a camera or a sensor) are converted to black and
+ * white as they are drawn, one row at a time.  Only a single row of the image is needed
+ * in RAM, so images can be streamed from a serial port or external memory.
+ *
+ * Two methods are available:
+ *
+ *  - DITHER_ORDERED uses a 4x4 Bayer matrix.  It is fast, needs no extra RAM and the
+ *    pattern is stable, so it suits gradients and values that change often.
+ *  - DITHER_DIFFUSION uses Floyd-Steinberg error diffusion, which gives much better
+ *    results for photos.  It needs DITHER_MAX_WIDTH ints for the errors carried into
+ *    the next row.
+ *
+ * Each pixel is 0 (black) to 255 (white).  Black pixels are turned on.  Rows are
+ * written straight into the buffer used by the graphics library, so the current clip
+ * rectangle and graphics_set_target() are honoured.  Only available with GRAPHICS_DIRECT_BUFFER.
+ *
+ * Support/dither.py converts images on a PC using the same methods, producing a bitmap_t
+ * that can be drawn with draw_bitmap().
+ *
+ * Example usage:
+ * @code
+ *    unsigned char row[64];
+ *
+ *    // Draw a 64 pixel wide image at (33,1)
+ *    dither_start(33, 1, 64, DITHER_DIFFUSION);
+ *    for (y = 0; y < 64; y++) {
+ *        read_row_from_sensor(row);
+ *        dither_row(row);
+ *    }
+ * @endcode
+ */
+#ifndef _DITHER_H_
+#define _DITHER_H_
+
+/** Ordered dithering with a 4x4 Bayer matrix */
+#define DITHER_ORDERED		0
+/** Floyd-Steinberg error diffusion */
+#define DITHER_DIFFUSION	1
+
+/**
+ * Start drawing a new image.
+ *
+ * @param x			The x position, from 1 - SCREEN_WIDTH
+ * @param y			The y position of the first row, from 1 - SCREEN_HEIGHT
+ * @param width		The number of pixels in each row
+ * @param method	DITHER_ORDERED or DITHER_DIFFUSION
+ * @return			0 if the image is wider than DITHER_MAX_WIDTH and method is
+ *					DITHER_DIFFUSION, graphics_set_rotation() has been used
+ *					or the driver has no buffer.  1 otherwise.
+ */
+unsigned char dither_start(unsigned char x, unsigned char y, unsigned char width, unsigned char method);
+/**
+ * Convert and draw the next row of the image, below the previous one.
+ *
+ * @param row		width pixels, from 0 (black) to 255 (white)
+ */
+void dither_row(const unsigned char *row);
+
+#endif // _DITHER_H_
@@ -7,6 +7,8 @@
 // Project Name:  Arial Black
 //---------------------------------------------------------------
 
+#include "graphics.h"
+
 //---------------------------------------------------------------
 // Group Name: ArialBlack14
 // Designer: Imported System Font
@@ -20,398 +22,607 @@
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char ArialBlack14[] = 
+const unsigned char ArialBlack14_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x13,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xCA, // Index 1 (offset: 202)
-	0x0, 0xD7, // Index 2 (offset: 215)
-	0x0, 0xF3, // Index 3 (offset: 243)
-	0x1, 0x1B, // Index 4 (offset: 283)
-	0x1, 0x40, // Index 5 (offset: 320)
-	0x1, 0x74, // Index 6 (offset: 372)
-	0x1, 0xA2, // Index 7 (offset: 418)
-	0x1, 0xAF, // Index 8 (offset: 431)
-	0x1, 0xBF, // Index 9 (offset: 447)
-	0x1, 0xCF, // Index 10 (offset: 463)
-	0x1, 0xE8, // Index 11 (offset: 488)
-	0x2, 0xA, // Index 12 (offset: 522)
-	0x2, 0x17, // Index 13 (offset: 535)
-	0x2, 0x2A, // Index 14 (offset: 554)
-	0x2, 0x37, // Index 15 (offset: 567)
-	0x2, 0x47, // Index 16 (offset: 583)
-	0x2, 0x66, // Index 17 (offset: 614)
-	0x2, 0x7F, // Index 18 (offset: 639)
-	0x2, 0x9E, // Index 19 (offset: 670)
-	0x2, 0xBD, // Index 20 (offset: 701)
-	0x2, 0xE5, // Index 21 (offset: 741)
-	0x3, 0x4, // Index 22 (offset: 772)
-	0x3, 0x23, // Index 23 (offset: 803)
-	0x3, 0x42, // Index 24 (offset: 834)
-	0x3, 0x61, // Index 25 (offset: 865)
-	0x3, 0x80, // Index 26 (offset: 896)
-	0x3, 0x8D, // Index 27 (offset: 909)
-	0x3, 0x9A, // Index 28 (offset: 922)
-	0x3, 0xBC, // Index 29 (offset: 956)
-	0x3, 0xDB, // Index 30 (offset: 987)
-	0x3, 0xFD, // Index 31 (offset: 1021)
-	0x4, 0x1F, // Index 32 (offset: 1055)
-	0x4, 0x4A, // Index 33 (offset: 1098)
-	0x4, 0x78, // Index 34 (offset: 1144)
-	0x4, 0x9D, // Index 35 (offset: 1181)
-	0x4, 0xC2, // Index 36 (offset: 1218)
-	0x4, 0xE7, // Index 37 (offset: 1255)
-	0x5, 0x9, // Index 38 (offset: 1289)
-	0x5, 0x28, // Index 39 (offset: 1320)
-	0x5, 0x50, // Index 40 (offset: 1360)
-	0x5, 0x78, // Index 41 (offset: 1400)
-	0x5, 0x85, // Index 42 (offset: 1413)
-	0x5, 0xA7, // Index 43 (offset: 1447)
-	0x5, 0xD5, // Index 44 (offset: 1493)
-	0x5, 0xF4, // Index 45 (offset: 1524)
-	0x6, 0x22, // Index 46 (offset: 1570)
-	0x6, 0x4A, // Index 47 (offset: 1610)
-	0x6, 0x72, // Index 48 (offset: 1650)
-	0x6, 0x94, // Index 49 (offset: 1684)
-	0x6, 0xBF, // Index 50 (offset: 1727)
-	0x6, 0xE7, // Index 51 (offset: 1767)
-	0x7, 0x9, // Index 52 (offset: 1801)
-	0x7, 0x2E, // Index 53 (offset: 1838)
-	0x7, 0x56, // Index 54 (offset: 1878)
-	0x7, 0x84, // Index 55 (offset: 1924)
-	0x7, 0xBE, // Index 56 (offset: 1982)
-	0x7, 0xEC, // Index 57 (offset: 2028)
-	0x8, 0x17, // Index 58 (offset: 2071)
-	0x8, 0x39, // Index 59 (offset: 2105)
-	0x8, 0x4C, // Index 60 (offset: 2124)
-	0x8, 0x5C, // Index 61 (offset: 2140)
-	0x8, 0x6F, // Index 62 (offset: 2159)
-	0x8, 0x8E, // Index 63 (offset: 2190)
-	0x8, 0xAD, // Index 64 (offset: 2221)
-	0x8, 0xBD, // Index 65 (offset: 2237)
-	0x8, 0xDF, // Index 66 (offset: 2271)
-	0x9, 0x1, // Index 67 (offset: 2305)
-	0x9, 0x23, // Index 68 (offset: 2339)
-	0x9, 0x45, // Index 69 (offset: 2373)
-	0x9, 0x67, // Index 70 (offset: 2407)
-	0x9, 0x80, // Index 71 (offset: 2432)
-	0x9, 0xA2, // Index 72 (offset: 2466)
-	0x9, 0xC4, // Index 73 (offset: 2500)
-	0x9, 0xD1, // Index 74 (offset: 2513)
-	0x9, 0xE4, // Index 75 (offset: 2532)
-	0xA, 0x9, // Index 76 (offset: 2569)
-	0xA, 0x16, // Index 77 (offset: 2582)
-	0xA, 0x47, // Index 78 (offset: 2631)
-	0xA, 0x69, // Index 79 (offset: 2665)
-	0xA, 0x8B, // Index 80 (offset: 2699)
-	0xA, 0xAD, // Index 81 (offset: 2733)
-	0xA, 0xCF, // Index 82 (offset: 2767)
-	0xA, 0xE8, // Index 83 (offset: 2792)
-	0xB, 0x7, // Index 84 (offset: 2823)
-	0xB, 0x1D, // Index 85 (offset: 2845)
-	0xB, 0x3F, // Index 86 (offset: 2879)
-	0xB, 0x61, // Index 87 (offset: 2913)
-	0xB, 0x95, // Index 88 (offset: 2965)
-	0xB, 0xBD, // Index 89 (offset: 3005)
-	0xB, 0xDF, // Index 90 (offset: 3039)
-	0xB, 0xFB, // Index 91 (offset: 3067)
-	0xC, 0x11, // Index 92 (offset: 3089)
-	0xC, 0x18, // Index 93 (offset: 3096)
-	0xC, 0x2E, // Index 94 (offset: 3118)
-
 	/* Index 0, character 32 " " (width: 2 pixels) */
-	0x2, 0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 4 pixels) */
-	0x4, 0xFE,0x79,0x00,0xFE,0x7B,0x00,0xFE,0x7B,0x00,0xFE,0x78,0x00,
+	0xFE,0x79,0x00,0xFE,0x7B,0x00,0xFE,0x7B,0x00,0xFE,0x78,0x00,
 
 	/* Index 2, character 34 """ (width: 9 pixels) */
-	0x9, 0x1E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,
+	0x1E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 13 pixels) */
-	0xD, 0x70,0x0E,0x00,0x70,0x6E,0x00,0x70,0x7F,0x00,0xF8,0x7F,0x00,0xFE,0x1F,0x00,0xFE,0x0E,0x00,0x76,0x6E,0x00,0x70,0x7F,0x00,0xF8,0x7F,0x00,0xFE,0x1F,0x00,0xFE,0x0E,0x00,0x76,0x0E,0x00,0x70,0x0E,0x00,
+	0x70,0x0E,0x00,0x70,0x6E,0x00,0x70,0x7F,0x00,0xF8,0x7F,0x00,0xFE,0x1F,0x00,0xFE,0x0E,0x00,0x76,0x6E,0x00,0x70,0x7F,0x00,0xF8,0x7F,0x00,0xFE,0x1F,0x00,0xFE,0x0E,0x00,0x76,0x0E,0x00,0x70,0x0E,0x00,
 
 	/* Index 4, character 36 "$" (width: 12 pixels) */
-	0xC, 0x00,0x0C,0x00,0x78,0x1C,0x00,0xFC,0x3C,0x00,0xFE,0x78,0x00,0xFE,0x71,0x00,0xCE,0x71,0x00,0xFF,0xFF,0x01,0x8E,0x73,0x00,0x8E,0x7F,0x00,0x9E,0x3F,0x00,0x1C,0x3F,0x00,0x18,0x1E,0x00,
+	0x00,0x0C,0x00,0x78,0x1C,0x00,0xFC,0x3C,0x00,0xFE,0x78,0x00,0xFE,0x71,0x00,0xCE,0x71,0x00,0xFF,0xFF,0x01,0x8E,0x73,0x00,0x8E,0x7F,0x00,0x9E,0x3F,0x00,0x1C,0x3F,0x00,0x18,0x1E,0x00,
 
 	/* Index 5, character 37 "%" (width: 17 pixels) */
-	0x11, 0x38,0x00,0x00,0x7C,0x00,0x00,0xC6,0x00,0x00,0xC6,0x00,0x00,0xC6,0x40,0x00,0x7C,0x70,0x00,0x38,0x38,0x00,0x00,0x0E,0x00,0x80,0x07,0x00,0xE0,0x01,0x00,0x70,0x1C,0x00,0x1C,0x3E,0x00,0x0E,0x63,0x00,0x02,0x63,0x00,0x00,0x63,0x00,0x00,0x3E,0x00,0x00,0x1C,0x00,
+	0x38,0x00,0x00,0x7C,0x00,0x00,0xC6,0x00,0x00,0xC6,0x00,0x00,0xC6,0x40,0x00,0x7C,0x70,0x00,0x38,0x38,0x00,0x00,0x0E,0x00,0x80,0x07,0x00,0xE0,0x01,0x00,0x70,0x1C,0x00,0x1C,0x3E,0x00,0x0E,0x63,0x00,0x02,0x63,0x00,0x00,0x63,0x00,0x00,0x3E,0x00,0x00,0x1C,0x00,
 
 	/* Index 6, character 38 "&" (width: 15 pixels) */
-	0xF, 0x00,0x1E,0x00,0x00,0x3F,0x00,0x38,0x7F,0x00,0xFC,0x7F,0x00,0xFE,0x79,0x00,0xCE,0x71,0x00,0xCE,0x73,0x00,0xCE,0x77,0x00,0x7E,0x7F,0x00,0x7C,0x3F,0x00,0x3C,0x1E,0x00,0x00,0x3F,0x00,0x00,0x7F,0x00,0x00,0x3B,0x00,0x00,0x10,0x00,
+	0x00,0x1E,0x00,0x00,0x3F,0x00,0x38,0x7F,0x00,0xFC,0x7F,0x00,0xFE,0x79,0x00,0xCE,0x71,0x00,0xCE,0x73,0x00,0xCE,0x77,0x00,0x7E,0x7F,0x00,0x7C,0x3F,0x00,0x3C,0x1E,0x00,0x00,0x3F,0x00,0x00,0x7F,0x00,0x00,0x3B,0x00,0x00,0x10,0x00,
 
 	/* Index 7, character 39 "'" (width: 4 pixels) */
-	0x4, 0x1E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,
+	0x1E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 5 pixels) */
-	0x5, 0xC0,0x3F,0x00,0xF0,0xFF,0x00,0xFC,0xFF,0x03,0x1E,0x80,0x07,0x02,0x00,0x04,
+	0xC0,0x3F,0x00,0xF0,0xFF,0x00,0xFC,0xFF,0x03,0x1E,0x80,0x07,0x02,0x00,0x04,
 
 	/* Index 9, character 41 ")" (width: 5 pixels) */
-	0x5, 0x02,0x00,0x04,0x1E,0x80,0x07,0xFC,0xFF,0x03,0xF0,0xFF,0x00,0xC0,0x3F,0x00,
+	0x02,0x00,0x04,0x1E,0x80,0x07,0xFC,0xFF,0x03,0xF0,0xFF,0x00,0xC0,0x3F,0x00,
 
 	/* Index 10, character 42 "*" (width: 8 pixels) */
-	0x8, 0x08,0x00,0x00,0x2C,0x00,0x00,0x68,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x68,0x00,0x00,0x2C,0x00,0x00,0x08,0x00,0x00,
+	0x08,0x00,0x00,0x2C,0x00,0x00,0x68,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x68,0x00,0x00,0x2C,0x00,0x00,0x08,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 11 pixels) */
-	0xB, 0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,
+	0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,
 
 	/* Index 12, character 44 "," (width: 4 pixels) */
-	0x4, 0x00,0x78,0x02,0x00,0x78,0x07,0x00,0xF8,0x03,0x00,0xF8,0x01,
+	0x00,0x78,0x02,0x00,0x78,0x07,0x00,0xF8,0x03,0x00,0xF8,0x01,
 
 	/* Index 13, character 45 "-" (width: 6 pixels) */
-	0x6, 0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,
+	0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,
 
 	/* Index 14, character 46 "." (width: 4 pixels) */
-	0x4, 0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,
+	0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,
 
 	/* Index 15, character 47 "/" (width: 5 pixels) */
-	0x5, 0x00,0x60,0x00,0x00,0x7F,0x00,0xF8,0x1F,0x00,0xFE,0x00,0x00,0x06,0x00,0x00,
+	0x00,0x60,0x00,0x00,0x7F,0x00,0xF8,0x1F,0x00,0xFE,0x00,0x00,0x06,0x00,0x00,
 
 	/* Index 16, character 48 "0" (width: 10 pixels) */
-	0xA, 0xF0,0x0F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFE,0x7F,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0xFE,0x7F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xF0,0x0F,0x00,
+	0xF0,0x0F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFE,0x7F,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0xFE,0x7F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xF0,0x0F,0x00,
 
 	/* Index 17, character 49 "1" (width: 8 pixels) */
-	0x8, 0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
+	0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
 
 	/* Index 18, character 50 "2" (width: 10 pixels) */
-	0xA, 0x30,0x60,0x00,0x3C,0x78,0x00,0x3E,0x7C,0x00,0x3E,0x7E,0x00,0x0E,0x7F,0x00,0x8E,0x77,0x00,0xFE,0x73,0x00,0xFE,0x73,0x00,0xFC,0x71,0x00,0x78,0x70,0x00,
+	0x30,0x60,0x00,0x3C,0x78,0x00,0x3E,0x7C,0x00,0x3E,0x7E,0x00,0x0E,0x7F,0x00,0x8E,0x77,0x00,0xFE,0x73,0x00,0xFE,0x73,0x00,0xFC,0x71,0x00,0x78,0x70,0x00,
 
 	/* Index 19, character 51 "3" (width: 10 pixels) */
-	0xA, 0x18,0x18,0x00,0x1C,0x38,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x7C,0x3F,0x00,0x38,0x1E,0x00,
+	0x18,0x18,0x00,0x1C,0x38,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x7C,0x3F,0x00,0x38,0x1E,0x00,
 
 	/* Index 20, character 52 "4" (width: 13 pixels) */
-	0xD, 0x00,0x0F,0x00,0x80,0x0F,0x00,0xC0,0x0F,0x00,0xE0,0x0F,0x00,0xF0,0x0E,0x00,0x38,0x0E,0x00,0x1C,0x0E,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,
+	0x00,0x0F,0x00,0x80,0x0F,0x00,0xC0,0x0F,0x00,0xE0,0x0F,0x00,0xF0,0x0E,0x00,0x38,0x0E,0x00,0x1C,0x0E,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,
 
 	/* Index 21, character 53 "5" (width: 10 pixels) */
-	0xA, 0xE0,0x0C,0x00,0xFE,0x3D,0x00,0xFE,0x3D,0x00,0xFE,0x7C,0x00,0xEE,0x70,0x00,0xEE,0x70,0x00,0xEE,0x7F,0x00,0xEE,0x3F,0x00,0xCE,0x3F,0x00,0x80,0x0F,0x00,
+	0xE0,0x0C,0x00,0xFE,0x3D,0x00,0xFE,0x3D,0x00,0xFE,0x7C,0x00,0xEE,0x70,0x00,0xEE,0x70,0x00,0xEE,0x7F,0x00,0xEE,0x3F,0x00,0xCE,0x3F,0x00,0x80,0x0F,0x00,
 
 	/* Index 22, character 54 "6" (width: 10 pixels) */
-	0xA, 0xF0,0x0F,0x00,0xFC,0x1F,0x00,0xFC,0x3F,0x00,0xFE,0x7F,0x00,0x9E,0x71,0x00,0xCE,0x71,0x00,0xDE,0x7F,0x00,0xDE,0x7F,0x00,0x9C,0x3F,0x00,0x18,0x1F,0x00,
+	0xF0,0x0F,0x00,0xFC,0x1F,0x00,0xFC,0x3F,0x00,0xFE,0x7F,0x00,0x9E,0x71,0x00,0xCE,0x71,0x00,0xDE,0x7F,0x00,0xDE,0x7F,0x00,0x9C,0x3F,0x00,0x18,0x1F,0x00,
 
 	/* Index 23, character 55 "7" (width: 10 pixels) */
-	0xA, 0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x70,0x00,0x0E,0x7E,0x00,0x8E,0x7F,0x00,0xEE,0x7F,0x00,0xFE,0x07,0x00,0xFE,0x00,0x00,0x3E,0x00,0x00,0x0E,0x00,0x00,
+	0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x70,0x00,0x0E,0x7E,0x00,0x8E,0x7F,0x00,0xEE,0x7F,0x00,0xFE,0x07,0x00,0xFE,0x00,0x00,0x3E,0x00,0x00,0x0E,0x00,0x00,
 
 	/* Index 24, character 56 "8" (width: 10 pixels) */
-	0xA, 0x38,0x1E,0x00,0x7C,0x3F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x7C,0x3F,0x00,0x38,0x1E,0x00,
+	0x38,0x1E,0x00,0x7C,0x3F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x7C,0x3F,0x00,0x38,0x1E,0x00,
 
 	/* Index 25, character 57 "9" (width: 10 pixels) */
-	0xA, 0xF8,0x18,0x00,0xFC,0x39,0x00,0xFE,0x7B,0x00,0xFE,0x7B,0x00,0x8E,0x73,0x00,0x8E,0x79,0x00,0xFE,0x7F,0x00,0xFC,0x3F,0x00,0xFC,0x1F,0x00,0xF0,0x0F,0x00,
+	0xF8,0x18,0x00,0xFC,0x39,0x00,0xFE,0x7B,0x00,0xFE,0x7B,0x00,0x8E,0x73,0x00,0x8E,0x79,0x00,0xFE,0x7F,0x00,0xFC,0x3F,0x00,0xFC,0x1F,0x00,0xF0,0x0F,0x00,
 
 	/* Index 26, character 58 ":" (width: 4 pixels) */
-	0x4, 0xF0,0x78,0x00,0xF0,0x78,0x00,0xF0,0x78,0x00,0xF0,0x78,0x00,
+	0xF0,0x78,0x00,0xF0,0x78,0x00,0xF0,0x78,0x00,0xF0,0x78,0x00,
 
 	/* Index 27, character 59 ";" (width: 4 pixels) */
-	0x4, 0xF0,0x78,0x02,0xF0,0x78,0x07,0xF0,0xF8,0x03,0xF0,0xF8,0x01,
+	0xF0,0x78,0x02,0xF0,0x78,0x07,0xF0,0xF8,0x03,0xF0,0xF8,0x01,
 
 	/* Index 28, character 60 "<" (width: 11 pixels) */
-	0xB, 0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x07,0x00,0xC0,0x07,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x38,0x38,0x00,
+	0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x07,0x00,0xC0,0x07,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x38,0x38,0x00,
 
 	/* Index 29, character 61 "=" (width: 10 pixels) */
-	0xA, 0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,
+	0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,
 
 	/* Index 30, character 62 ">" (width: 11 pixels) */
-	0xB, 0x38,0x38,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xC0,0x07,0x00,0xC0,0x07,0x00,0x80,0x03,0x00,0x80,0x03,0x00,
+	0x38,0x38,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xC0,0x07,0x00,0xC0,0x07,0x00,0x80,0x03,0x00,0x80,0x03,0x00,
 
 	/* Index 31, character 63 "?" (width: 11 pixels) */
-	0xB, 0x30,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3E,0x76,0x00,0x1E,0x77,0x00,0x8E,0x77,0x00,0xCE,0x77,0x00,0xFE,0x01,0x00,0xFC,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,
+	0x30,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3E,0x76,0x00,0x1E,0x77,0x00,0x8E,0x77,0x00,0xCE,0x77,0x00,0xFE,0x01,0x00,0xFC,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 14 pixels) */
-	0xE, 0xE0,0x0F,0x00,0x10,0x30,0x00,0x08,0x40,0x00,0x84,0x8F,0x00,0xE4,0x3F,0x01,0x72,0x20,0x01,0x12,0x20,0x01,0x12,0x30,0x01,0xE2,0x3F,0x01,0xF2,0x3F,0x01,0xF4,0xA0,0x00,0x04,0x90,0x00,0x18,0x48,0x00,0xE0,0x47,0x00,
+	0xE0,0x0F,0x00,0x10,0x30,0x00,0x08,0x40,0x00,0x84,0x8F,0x00,0xE4,0x3F,0x01,0x72,0x20,0x01,0x12,0x20,0x01,0x12,0x30,0x01,0xE2,0x3F,0x01,0xF2,0x3F,0x01,0xF4,0xA0,0x00,0x04,0x90,0x00,0x18,0x48,0x00,0xE0,0x47,0x00,
 
 	/* Index 33, character 65 "A" (width: 15 pixels) */
-	0xF, 0x00,0x40,0x00,0x00,0x78,0x00,0x00,0x7F,0x00,0xE0,0x7F,0x00,0xFC,0x3F,0x00,0xFE,0x1F,0x00,0xFE,0x1D,0x00,0x3E,0x1C,0x00,0xFE,0x1D,0x00,0xFE,0x1F,0x00,0xFC,0x3F,0x00,0xE0,0x7F,0x00,0x00,0x7F,0x00,0x00,0x78,0x00,0x00,0x40,0x00,
+	0x00,0x40,0x00,0x00,0x78,0x00,0x00,0x7F,0x00,0xE0,0x7F,0x00,0xFC,0x3F,0x00,0xFE,0x1F,0x00,0xFE,0x1D,0x00,0x3E,0x1C,0x00,0xFE,0x1D,0x00,0xFE,0x1F,0x00,0xFC,0x3F,0x00,0xE0,0x7F,0x00,0x00,0x7F,0x00,0x00,0x78,0x00,0x00,0x40,0x00,
 
 	/* Index 34, character 66 "B" (width: 12 pixels) */
-	0xC, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xFE,0x71,0x00,0xFE,0x7F,0x00,0xFC,0x7F,0x00,0x38,0x3F,0x00,0x00,0x1E,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xFE,0x71,0x00,0xFE,0x7F,0x00,0xFC,0x7F,0x00,0x38,0x3F,0x00,0x00,0x1E,0x00,
 
 	/* Index 35, character 67 "C" (width: 12 pixels) */
-	0xC, 0xE0,0x07,0x00,0xF8,0x1F,0x00,0xFC,0x3F,0x00,0xFE,0x7F,0x00,0x1E,0x78,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x1E,0x78,0x00,0x3E,0x7E,0x00,0x3C,0x3E,0x00,0x1C,0x1C,0x00,0x10,0x0C,0x00,
+	0xE0,0x07,0x00,0xF8,0x1F,0x00,0xFC,0x3F,0x00,0xFE,0x7F,0x00,0x1E,0x78,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x1E,0x78,0x00,0x3E,0x7E,0x00,0x3C,0x3E,0x00,0x1C,0x1C,0x00,0x10,0x0C,0x00,
 
 	/* Index 36, character 68 "D" (width: 12 pixels) */
-	0xC, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x1E,0x78,0x00,0xFE,0x7F,0x00,0xFC,0x3F,0x00,0xF8,0x1F,0x00,0xE0,0x0F,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x1E,0x78,0x00,0xFE,0x7F,0x00,0xFC,0x3F,0x00,0xF8,0x1F,0x00,0xE0,0x0F,0x00,
 
 	/* Index 37, character 69 "E" (width: 11 pixels) */
-	0xB, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0x0E,0x70,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0x0E,0x70,0x00,
 
 	/* Index 38, character 70 "F" (width: 10 pixels) */
-	0xA, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xCE,0x01,0x00,0xCE,0x01,0x00,0xCE,0x01,0x00,0xCE,0x01,0x00,0xCE,0x01,0x00,0x0E,0x00,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xCE,0x01,0x00,0xCE,0x01,0x00,0xCE,0x01,0x00,0xCE,0x01,0x00,0xCE,0x01,0x00,0x0E,0x00,0x00,
 
 	/* Index 39, character 71 "G" (width: 13 pixels) */
-	0xD, 0xE0,0x07,0x00,0xF8,0x1F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0x1E,0x78,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x8E,0x73,0x00,0x9E,0x7B,0x00,0xBE,0x7F,0x00,0xBC,0x3F,0x00,0x9C,0x3F,0x00,0x90,0x1F,0x00,
+	0xE0,0x07,0x00,0xF8,0x1F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0x1E,0x78,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x8E,0x73,0x00,0x9E,0x7B,0x00,0xBE,0x7F,0x00,0xBC,0x3F,0x00,0x9C,0x3F,0x00,0x90,0x1F,0x00,
 
 	/* Index 40, character 72 "H" (width: 13 pixels) */
-	0xD, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
 
 	/* Index 41, character 73 "I" (width: 4 pixels) */
-	0x4, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
 
 	/* Index 42, character 74 "J" (width: 11 pixels) */
-	0xB, 0x00,0x1C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x7C,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0xFE,0x7F,0x00,0xFE,0x3F,0x00,0xFE,0x3F,0x00,0xFE,0x0F,0x00,
+	0x00,0x1C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x7C,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0xFE,0x7F,0x00,0xFE,0x3F,0x00,0xFE,0x3F,0x00,0xFE,0x0F,0x00,
 
 	/* Index 43, character 75 "K" (width: 15 pixels) */
-	0xF, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xC0,0x07,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xF8,0x03,0x00,0xFC,0x0F,0x00,0xFE,0x1F,0x00,0x1E,0x7F,0x00,0x0E,0x7C,0x00,0x06,0x78,0x00,0x02,0x60,0x00,0x00,0x40,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xC0,0x07,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xF8,0x03,0x00,0xFC,0x0F,0x00,0xFE,0x1F,0x00,0x1E,0x7F,0x00,0x0E,0x7C,0x00,0x06,0x78,0x00,0x02,0x60,0x00,0x00,0x40,0x00,
 
 	/* Index 44, character 76 "L" (width: 10 pixels) */
-	0xA, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,
 
 	/* Index 45, character 77 "M" (width: 15 pixels) */
-	0xF, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x3E,0x00,0x00,0xFE,0x01,0x00,0xF0,0x0F,0x00,0x80,0x7F,0x00,0x00,0x78,0x00,0x80,0x7F,0x00,0xF0,0x0F,0x00,0xFE,0x01,0x00,0x3E,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x3E,0x00,0x00,0xFE,0x01,0x00,0xF0,0x0F,0x00,0x80,0x7F,0x00,0x00,0x78,0x00,0x80,0x7F,0x00,0xF0,0x0F,0x00,0xFE,0x01,0x00,0x3E,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
 
 	/* Index 46, character 78 "N" (width: 13 pixels) */
-	0xD, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0x80,0x07,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0x80,0x07,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
 
 	/* Index 47, character 79 "O" (width: 13 pixels) */
-	0xD, 0xE0,0x07,0x00,0xF8,0x1F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0x1E,0x78,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x1E,0x78,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xF8,0x1F,0x00,0xE0,0x07,0x00,
+	0xE0,0x07,0x00,0xF8,0x1F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0x1E,0x78,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x1E,0x78,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xF8,0x1F,0x00,0xE0,0x07,0x00,
 
 	/* Index 48, character 80 "P" (width: 11 pixels) */
-	0xB, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0xFE,0x03,0x00,0xFE,0x03,0x00,0xFC,0x01,0x00,0xF8,0x00,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0xFE,0x03,0x00,0xFE,0x03,0x00,0xFC,0x01,0x00,0xF8,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 14 pixels) */
-	0xE, 0xE0,0x07,0x00,0xF8,0x1F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0x1E,0x78,0x00,0x0E,0x78,0x00,0x0E,0x76,0x00,0x0E,0x7C,0x00,0x1E,0x78,0x00,0xFC,0x3F,0x00,0xFC,0x7F,0x00,0xF8,0xFF,0x00,0xE0,0xE7,0x00,0x00,0x40,0x00,
+	0xE0,0x07,0x00,0xF8,0x1F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0x1E,0x78,0x00,0x0E,0x78,0x00,0x0E,0x76,0x00,0x0E,0x7C,0x00,0x1E,0x78,0x00,0xFC,0x3F,0x00,0xFC,0x7F,0x00,0xF8,0xFF,0x00,0xE0,0xE7,0x00,0x00,0x40,0x00,
 
 	/* Index 50, character 82 "R" (width: 13 pixels) */
-	0xD, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xCE,0x01,0x00,0xCE,0x01,0x00,0xCE,0x07,0x00,0xCE,0x1F,0x00,0xFE,0x3F,0x00,0xFE,0x7E,0x00,0xFC,0x7C,0x00,0x78,0x70,0x00,0x00,0x40,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xCE,0x01,0x00,0xCE,0x01,0x00,0xCE,0x07,0x00,0xCE,0x1F,0x00,0xFE,0x3F,0x00,0xFE,0x7E,0x00,0xFC,0x7C,0x00,0x78,0x70,0x00,0x00,0x40,0x00,
 
 	/* Index 51, character 83 "S" (width: 11 pixels) */
-	0xB, 0x78,0x18,0x00,0xFC,0x38,0x00,0xFE,0x78,0x00,0xFE,0x79,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xCE,0x73,0x00,0x9E,0x7F,0x00,0x9E,0x3F,0x00,0x9C,0x3F,0x00,0x18,0x1E,0x00,
+	0x78,0x18,0x00,0xFC,0x38,0x00,0xFE,0x78,0x00,0xFE,0x79,0x00,0xCE,0x71,0x00,0xCE,0x71,0x00,0xCE,0x73,0x00,0x9E,0x7F,0x00,0x9E,0x3F,0x00,0x9C,0x3F,0x00,0x18,0x1E,0x00,
 
 	/* Index 52, character 84 "T" (width: 12 pixels) */
-	0xC, 0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,
+	0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,
 
 	/* Index 53, character 85 "U" (width: 13 pixels) */
-	0xD, 0xFE,0x0F,0x00,0xFE,0x1F,0x00,0xFE,0x3F,0x00,0xFE,0x7F,0x00,0x00,0x78,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x78,0x00,0xFE,0x7F,0x00,0xFE,0x3F,0x00,0xFE,0x1F,0x00,0xFE,0x0F,0x00,
+	0xFE,0x0F,0x00,0xFE,0x1F,0x00,0xFE,0x3F,0x00,0xFE,0x7F,0x00,0x00,0x78,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x78,0x00,0xFE,0x7F,0x00,0xFE,0x3F,0x00,0xFE,0x1F,0x00,0xFE,0x0F,0x00,
 
 	/* Index 54, character 86 "V" (width: 15 pixels) */
-	0xF, 0x02,0x00,0x00,0x1E,0x00,0x00,0xFE,0x00,0x00,0xFE,0x03,0x00,0xFC,0x1F,0x00,0xE0,0x7F,0x00,0x00,0x7F,0x00,0x00,0x78,0x00,0x00,0x7F,0x00,0xE0,0x7F,0x00,0xFC,0x1F,0x00,0xFE,0x03,0x00,0xFE,0x00,0x00,0x1E,0x00,0x00,0x02,0x00,0x00,
+	0x02,0x00,0x00,0x1E,0x00,0x00,0xFE,0x00,0x00,0xFE,0x03,0x00,0xFC,0x1F,0x00,0xE0,0x7F,0x00,0x00,0x7F,0x00,0x00,0x78,0x00,0x00,0x7F,0x00,0xE0,0x7F,0x00,0xFC,0x1F,0x00,0xFE,0x03,0x00,0xFE,0x00,0x00,0x1E,0x00,0x00,0x02,0x00,0x00,
 
 	/* Index 55, character 87 "W" (width: 19 pixels) */
-	0x13, 0x06,0x00,0x00,0xFE,0x00,0x00,0xFE,0x1F,0x00,0xFE,0x7F,0x00,0xF8,0x7F,0x00,0x00,0x7E,0x00,0x80,0x7F,0x00,0xF8,0x1F,0x00,0xFE,0x03,0x00,0x7E,0x00,0x00,0xFE,0x03,0x00,0xF8,0x1F,0x00,0x80,0x7F,0x00,0x00,0x7E,0x00,0xF8,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x1F,0x00,0xFE,0x00,0x00,0x06,0x00,0x00,
+	0x06,0x00,0x00,0xFE,0x00,0x00,0xFE,0x1F,0x00,0xFE,0x7F,0x00,0xF8,0x7F,0x00,0x00,0x7E,0x00,0x80,0x7F,0x00,0xF8,0x1F,0x00,0xFE,0x03,0x00,0x7E,0x00,0x00,0xFE,0x03,0x00,0xF8,0x1F,0x00,0x80,0x7F,0x00,0x00,0x7E,0x00,0xF8,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x1F,0x00,0xFE,0x00,0x00,0x06,0x00,0x00,
 
 	/* Index 56, character 88 "X" (width: 15 pixels) */
-	0xF, 0x02,0x40,0x00,0x06,0x60,0x00,0x0E,0x78,0x00,0x3E,0x7C,0x00,0x7C,0x3E,0x00,0xF8,0x1F,0x00,0xF0,0x0F,0x00,0xE0,0x07,0x00,0xF0,0x0F,0x00,0xF8,0x1F,0x00,0x7C,0x3E,0x00,0x3E,0x7C,0x00,0x0E,0x78,0x00,0x06,0x60,0x00,0x02,0x40,0x00,
+	0x02,0x40,0x00,0x06,0x60,0x00,0x0E,0x78,0x00,0x3E,0x7C,0x00,0x7C,0x3E,0x00,0xF8,0x1F,0x00,0xF0,0x0F,0x00,0xE0,0x07,0x00,0xF0,0x0F,0x00,0xF8,0x1F,0x00,0x7C,0x3E,0x00,0x3E,0x7C,0x00,0x0E,0x78,0x00,0x06,0x60,0x00,0x02,0x40,0x00,
 
 	/* Index 57, character 89 "Y" (width: 14 pixels) */
-	0xE, 0x02,0x00,0x00,0x06,0x00,0x00,0x1E,0x00,0x00,0x7E,0x00,0x00,0xFE,0x00,0x00,0xF8,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF8,0x7F,0x00,0xFE,0x00,0x00,0x7E,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,
+	0x02,0x00,0x00,0x06,0x00,0x00,0x1E,0x00,0x00,0x7E,0x00,0x00,0xFE,0x00,0x00,0xF8,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF8,0x7F,0x00,0xFE,0x00,0x00,0x7E,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,
 
 	/* Index 58, character 90 "Z" (width: 11 pixels) */
-	0xB, 0x00,0x70,0x00,0x0E,0x7C,0x00,0x0E,0x7E,0x00,0x0E,0x7F,0x00,0x8E,0x77,0x00,0xCE,0x73,0x00,0xEE,0x71,0x00,0xFE,0x70,0x00,0x7E,0x70,0x00,0x1E,0x70,0x00,0x0E,0x70,0x00,
+	0x00,0x70,0x00,0x0E,0x7C,0x00,0x0E,0x7E,0x00,0x0E,0x7F,0x00,0x8E,0x77,0x00,0xCE,0x73,0x00,0xEE,0x71,0x00,0xFE,0x70,0x00,0x7E,0x70,0x00,0x1E,0x70,0x00,0x0E,0x70,0x00,
 
 	/* Index 59, character 91 "[" (width: 6 pixels) */
-	0x6, 0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0x0E,0x00,0x07,0x0E,0x00,0x07,
+	0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0x0E,0x00,0x07,0x0E,0x00,0x07,
 
 	/* Index 60, character 92 "\" (width: 5 pixels) */
-	0x5, 0x06,0x00,0x00,0xFE,0x00,0x00,0xF8,0x1F,0x00,0x00,0x7F,0x00,0x00,0x60,0x00,
+	0x06,0x00,0x00,0xFE,0x00,0x00,0xF8,0x1F,0x00,0x00,0x7F,0x00,0x00,0x60,0x00,
 
 	/* Index 61, character 93 "]" (width: 6 pixels) */
-	0x6, 0x0E,0x00,0x07,0x0E,0x00,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,
+	0x0E,0x00,0x07,0x0E,0x00,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,
 
 	/* Index 62, character 94 "^" (width: 10 pixels) */
-	0xA, 0x00,0x01,0x00,0xC0,0x01,0x00,0xF0,0x01,0x00,0xFE,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0xFC,0x00,0x00,0xF0,0x01,0x00,0xC0,0x01,0x00,0x00,0x01,0x00,
+	0x00,0x01,0x00,0xC0,0x01,0x00,0xF0,0x01,0x00,0xFE,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0xFC,0x00,0x00,0xF0,0x01,0x00,0xC0,0x01,0x00,0x00,0x01,0x00,
 
 	/* Index 63, character 95 "_" (width: 10 pixels) */
-	0xA, 0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,
+	0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,
 
 	/* Index 64, character 96 "`" (width: 5 pixels) */
-	0x5, 0x02,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x08,0x00,0x00,
+	0x02,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x08,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 11 pixels) */
-	0xB, 0xC0,0x18,0x00,0xE0,0x3C,0x00,0xF0,0x7E,0x00,0xF0,0x7E,0x00,0x70,0x76,0x00,0x70,0x72,0x00,0x70,0x33,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
+	0xC0,0x18,0x00,0xE0,0x3C,0x00,0xF0,0x7E,0x00,0xF0,0x7E,0x00,0x70,0x76,0x00,0x70,0x72,0x00,0x70,0x33,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
 
 	/* Index 66, character 98 "b" (width: 11 pixels) */
-	0xB, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x60,0x30,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x3F,0x00,0xC0,0x0F,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x60,0x30,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x3F,0x00,0xC0,0x0F,0x00,
 
 	/* Index 67, character 99 "c" (width: 11 pixels) */
-	0xB, 0x80,0x0F,0x00,0xE0,0x3F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0xF0,0x78,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0xF0,0x78,0x00,0xE0,0x38,0x00,0xE0,0x38,0x00,0x80,0x08,0x00,
+	0x80,0x0F,0x00,0xE0,0x3F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0xF0,0x78,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0xF0,0x78,0x00,0xE0,0x38,0x00,0xE0,0x38,0x00,0x80,0x08,0x00,
 
 	/* Index 68, character 100 "d" (width: 11 pixels) */
-	0xB, 0x80,0x0F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0x60,0x30,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
+	0x80,0x0F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0x60,0x30,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
 
 	/* Index 69, character 101 "e" (width: 11 pixels) */
-	0xB, 0x80,0x0F,0x00,0xE0,0x3F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0x70,0x7B,0x00,0x70,0x73,0x00,0x70,0x73,0x00,0xF0,0x7B,0x00,0xE0,0x3B,0x00,0xE0,0x3B,0x00,0x80,0x0B,0x00,
+	0x80,0x0F,0x00,0xE0,0x3F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0x70,0x7B,0x00,0x70,0x73,0x00,0x70,0x73,0x00,0xF0,0x7B,0x00,0xE0,0x3B,0x00,0xE0,0x3B,0x00,0x80,0x0B,0x00,
 
 	/* Index 70, character 102 "f" (width: 8 pixels) */
-	0x8, 0x70,0x00,0x00,0xFC,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x76,0x00,0x00,0x76,0x00,0x00,0x06,0x00,0x00,
+	0x70,0x00,0x00,0xFC,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x76,0x00,0x00,0x76,0x00,0x00,0x06,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 11 pixels) */
-	0xB, 0xC0,0x0F,0x03,0xE0,0x3F,0x03,0xF0,0x7F,0x07,0xF0,0x7F,0x07,0x70,0x70,0x07,0x70,0x70,0x07,0xE0,0x30,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x03,0xF0,0xFF,0x01,
+	0xC0,0x0F,0x03,0xE0,0x3F,0x03,0xF0,0x7F,0x07,0xF0,0x7F,0x07,0x70,0x70,0x07,0x70,0x70,0x07,0xE0,0x30,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x03,0xF0,0xFF,0x01,
 
 	/* Index 72, character 104 "h" (width: 11 pixels) */
-	0xB, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
 
 	/* Index 73, character 105 "i" (width: 4 pixels) */
-	0x4, 0xF6,0x7F,0x00,0xF6,0x7F,0x00,0xF6,0x7F,0x00,0xF6,0x7F,0x00,
+	0xF6,0x7F,0x00,0xF6,0x7F,0x00,0xF6,0x7F,0x00,0xF6,0x7F,0x00,
 
 	/* Index 74, character 106 "j" (width: 6 pixels) */
-	0x6, 0x00,0x00,0x07,0x00,0x00,0x07,0xF6,0xFF,0x07,0xF6,0xFF,0x07,0xF6,0xFF,0x07,0xF6,0xFF,0x03,
+	0x00,0x00,0x07,0x00,0x00,0x07,0xF6,0xFF,0x07,0xF6,0xFF,0x07,0xF6,0xFF,0x07,0xF6,0xFF,0x03,
 
 	/* Index 75, character 107 "k" (width: 12 pixels) */
-	0xC, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x80,0x0F,0x00,0xC0,0x07,0x00,0xE0,0x1F,0x00,0xF0,0x7F,0x00,0xF0,0x7E,0x00,0x70,0x7C,0x00,0x30,0x70,0x00,0x10,0x40,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x80,0x0F,0x00,0xC0,0x07,0x00,0xE0,0x1F,0x00,0xF0,0x7F,0x00,0xF0,0x7E,0x00,0x70,0x7C,0x00,0x30,0x70,0x00,0x10,0x40,0x00,
 
 	/* Index 76, character 108 "l" (width: 4 pixels) */
-	0x4, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
 
 	/* Index 77, character 109 "m" (width: 16 pixels) */
-	0x10, 0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0x60,0x00,0x00,0x70,0x00,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0x60,0x00,0x00,0x70,0x00,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
+	0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0x60,0x00,0x00,0x70,0x00,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0x60,0x00,0x00,0x70,0x00,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
 
 	/* Index 78, character 110 "n" (width: 11 pixels) */
-	0xB, 0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
+	0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
 
 	/* Index 79, character 111 "o" (width: 11 pixels) */
-	0xB, 0x80,0x0F,0x00,0xC0,0x1F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0xF0,0x78,0x00,0x70,0x70,0x00,0xF0,0x78,0x00,0xF0,0x7F,0x00,0xE0,0x3F,0x00,0xE0,0x1F,0x00,0x80,0x0F,0x00,
+	0x80,0x0F,0x00,0xC0,0x1F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0xF0,0x78,0x00,0x70,0x70,0x00,0xF0,0x78,0x00,0xF0,0x7F,0x00,0xE0,0x3F,0x00,0xE0,0x1F,0x00,0x80,0x0F,0x00,
 
 	/* Index 80, character 112 "p" (width: 11 pixels) */
-	0xB, 0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0x60,0x38,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x3F,0x00,0x80,0x1F,0x00,
+	0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0x60,0x38,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x3F,0x00,0x80,0x1F,0x00,
 
 	/* Index 81, character 113 "q" (width: 11 pixels) */
-	0xB, 0x80,0x1F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0x60,0x38,0x00,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,
+	0x80,0x1F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0x60,0x38,0x00,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,
 
 	/* Index 82, character 114 "r" (width: 8 pixels) */
-	0x8, 0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x30,0x00,0x00,
+	0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x30,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 10 pixels) */
-	0xA, 0xC0,0x11,0x00,0xE0,0x33,0x00,0xF0,0x73,0x00,0xF0,0x77,0x00,0x30,0x67,0x00,0x30,0x67,0x00,0x70,0x7F,0x00,0x70,0x7F,0x00,0x60,0x3E,0x00,0x40,0x1C,0x00,
+	0xC0,0x11,0x00,0xE0,0x33,0x00,0xF0,0x73,0x00,0xF0,0x77,0x00,0x30,0x67,0x00,0x30,0x67,0x00,0x70,0x7F,0x00,0x70,0x7F,0x00,0x60,0x3E,0x00,0x40,0x1C,0x00,
 
 	/* Index 84, character 116 "t" (width: 7 pixels) */
-	0x7, 0x70,0x00,0x00,0xFC,0x3F,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0xFE,0x7F,0x00,0x70,0x70,0x00,0x70,0x70,0x00,
+	0x70,0x00,0x00,0xFC,0x3F,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0xFE,0x7F,0x00,0x70,0x70,0x00,0x70,0x70,0x00,
 
 	/* Index 85, character 117 "u" (width: 11 pixels) */
-	0xB, 0xF0,0x1F,0x00,0xF0,0x3F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,
+	0xF0,0x1F,0x00,0xF0,0x3F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,
 
 	/* Index 86, character 118 "v" (width: 11 pixels) */
-	0xB, 0x10,0x00,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xF0,0x3F,0x00,0xC0,0x7F,0x00,0x00,0x78,0x00,0xC0,0x7F,0x00,0xF0,0x3F,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0x10,0x00,0x00,
+	0x10,0x00,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xF0,0x3F,0x00,0xC0,0x7F,0x00,0x00,0x78,0x00,0xC0,0x7F,0x00,0xF0,0x3F,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0x10,0x00,0x00,
 
 	/* Index 87, character 119 "w" (width: 17 pixels) */
-	0x11, 0x30,0x00,0x00,0xF0,0x01,0x00,0xF0,0x0F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0x00,0x7E,0x00,0xE0,0x3F,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xE0,0x3F,0x00,0x00,0x7E,0x00,0xE0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x0F,0x00,0xF0,0x01,0x00,0x30,0x00,0x00,
+	0x30,0x00,0x00,0xF0,0x01,0x00,0xF0,0x0F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0x00,0x7E,0x00,0xE0,0x3F,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xE0,0x3F,0x00,0x00,0x7E,0x00,0xE0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x0F,0x00,0xF0,0x01,0x00,0x30,0x00,0x00,
 
 	/* Index 88, character 120 "x" (width: 13 pixels) */
-	0xD, 0x10,0x40,0x00,0x30,0x60,0x00,0xF0,0x78,0x00,0xF0,0x7F,0x00,0xE0,0x3F,0x00,0xC0,0x1F,0x00,0x80,0x07,0x00,0xC0,0x1F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0xF0,0x78,0x00,0x30,0x60,0x00,0x10,0x40,0x00,
+	0x10,0x40,0x00,0x30,0x60,0x00,0xF0,0x78,0x00,0xF0,0x7F,0x00,0xE0,0x3F,0x00,0xC0,0x1F,0x00,0x80,0x07,0x00,0xC0,0x1F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0xF0,0x78,0x00,0x30,0x60,0x00,0x10,0x40,0x00,
 
 	/* Index 89, character 121 "y" (width: 11 pixels) */
-	0xB, 0x10,0x00,0x07,0xF0,0x00,0x07,0xF0,0x07,0x07,0xF0,0x3F,0x07,0xC0,0xFF,0x07,0x00,0xF8,0x03,0xC0,0xFF,0x01,0xF0,0x7F,0x00,0xF0,0x0F,0x00,0xF0,0x01,0x00,0x30,0x00,0x00,
+	0x10,0x00,0x07,0xF0,0x00,0x07,0xF0,0x07,0x07,0xF0,0x3F,0x07,0xC0,0xFF,0x07,0x00,0xF8,0x03,0xC0,0xFF,0x01,0xF0,0x7F,0x00,0xF0,0x0F,0x00,0xF0,0x01,0x00,0x30,0x00,0x00,
 
 	/* Index 90, character 122 "z" (width: 9 pixels) */
-	0x9, 0x70,0x70,0x00,0x70,0x78,0x00,0x70,0x7C,0x00,0x70,0x7F,0x00,0xF0,0x77,0x00,0xF0,0x73,0x00,0xF0,0x71,0x00,0xF0,0x70,0x00,0x70,0x70,0x00,
+	0x70,0x70,0x00,0x70,0x78,0x00,0x70,0x7C,0x00,0x70,0x7F,0x00,0xF0,0x77,0x00,0xF0,0x73,0x00,0xF0,0x71,0x00,0xF0,0x70,0x00,0x70,0x70,0x00,
 
 	/* Index 91, character 123 "{" (width: 7 pixels) */
-	0x7, 0x00,0x0E,0x00,0x00,0x0E,0x00,0xFC,0xFF,0x03,0xFE,0xFF,0x07,0xFE,0xFB,0x07,0x0E,0x00,0x07,0x0E,0x00,0x07,
+	0x00,0x0E,0x00,0x00,0x0E,0x00,0xFC,0xFF,0x03,0xFE,0xFF,0x07,0xFE,0xFB,0x07,0x0E,0x00,0x07,0x0E,0x00,0x07,
 
 	/* Index 92, character 124 "|" (width: 2 pixels) */
-	0x2, 0xFE,0xFF,0x07,0xFE,0xFF,0x07,
+	0xFE,0xFF,0x07,0xFE,0xFF,0x07,
 
 	/* Index 93, character 125 "}" (width: 7 pixels) */
-	0x7, 0x0E,0x00,0x07,0x0E,0x00,0x07,0xFE,0xFB,0x07,0xFE,0xFF,0x07,0xFC,0xFF,0x03,0x00,0x0F,0x00,0x00,0x0E,0x00,
+	0x0E,0x00,0x07,0x0E,0x00,0x07,0xFE,0xFB,0x07,0xFE,0xFF,0x07,0xFC,0xFF,0x03,0x00,0x0F,0x00,0x00,0x0E,0x00,
 
 	/* Index 94, character 126 "~" (width: 11 pixels) */
-	0xB, 0x80,0x03,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x01,0x00
+	0x80,0x03,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x01,0x00
+};
+
+// Offset of each bitmap in ArialBlack14_bitmaps
+const unsigned short ArialBlack14_offsets[] = 
+{
+	0x0,	// Index 0
+	0x6,	// Index 1
+	0x12,	// Index 2
+	0x2D,	// Index 3
+	0x54,	// Index 4
+	0x78,	// Index 5
+	0xAB,	// Index 6
+	0xD8,	// Index 7
+	0xE4,	// Index 8
+	0xF3,	// Index 9
+	0x102,	// Index 10
+	0x11A,	// Index 11
+	0x13B,	// Index 12
+	0x147,	// Index 13
+	0x159,	// Index 14
+	0x165,	// Index 15
+	0x174,	// Index 16
+	0x192,	// Index 17
+	0x1AA,	// Index 18
+	0x1C8,	// Index 19
+	0x1E6,	// Index 20
+	0x20D,	// Index 21
+	0x22B,	// Index 22
+	0x249,	// Index 23
+	0x267,	// Index 24
+	0x285,	// Index 25
+	0x2A3,	// Index 26
+	0x2AF,	// Index 27
+	0x2BB,	// Index 28
+	0x2DC,	// Index 29
+	0x2FA,	// Index 30
+	0x31B,	// Index 31
+	0x33C,	// Index 32
+	0x366,	// Index 33
+	0x393,	// Index 34
+	0x3B7,	// Index 35
+	0x3DB,	// Index 36
+	0x3FF,	// Index 37
+	0x420,	// Index 38
+	0x43E,	// Index 39
+	0x465,	// Index 40
+	0x48C,	// Index 41
+	0x498,	// Index 42
+	0x4B9,	// Index 43
+	0x4E6,	// Index 44
+	0x504,	// Index 45
+	0x531,	// Index 46
+	0x558,	// Index 47
+	0x57F,	// Index 48
+	0x5A0,	// Index 49
+	0x5CA,	// Index 50
+	0x5F1,	// Index 51
+	0x612,	// Index 52
+	0x636,	// Index 53
+	0x65D,	// Index 54
+	0x68A,	// Index 55
+	0x6C3,	// Index 56
+	0x6F0,	// Index 57
+	0x71A,	// Index 58
+	0x73B,	// Index 59
+	0x74D,	// Index 60
+	0x75C,	// Index 61
+	0x76E,	// Index 62
+	0x78C,	// Index 63
+	0x7AA,	// Index 64
+	0x7B9,	// Index 65
+	0x7DA,	// Index 66
+	0x7FB,	// Index 67
+	0x81C,	// Index 68
+	0x83D,	// Index 69
+	0x85E,	// Index 70
+	0x876,	// Index 71
+	0x897,	// Index 72
+	0x8B8,	// Index 73
+	0x8C4,	// Index 74
+	0x8D6,	// Index 75
+	0x8FA,	// Index 76
+	0x906,	// Index 77
+	0x936,	// Index 78
+	0x957,	// Index 79
+	0x978,	// Index 80
+	0x999,	// Index 81
+	0x9BA,	// Index 82
+	0x9D2,	// Index 83
+	0x9F0,	// Index 84
+	0xA05,	// Index 85
+	0xA26,	// Index 86
+	0xA47,	// Index 87
+	0xA7A,	// Index 88
+	0xAA1,	// Index 89
+	0xAC2,	// Index 90
+	0xADD,	// Index 91
+	0xAF2,	// Index 92
+	0xAF8,	// Index 93
+	0xB0D,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char ArialBlack14_widths[] = 
+{
+	0x2,	// Index 0
+	0x4,	// Index 1
+	0x9,	// Index 2
+	0xD,	// Index 3
+	0xC,	// Index 4
+	0x11,	// Index 5
+	0xF,	// Index 6
+	0x4,	// Index 7
+	0x5,	// Index 8
+	0x5,	// Index 9
+	0x8,	// Index 10
+	0xB,	// Index 11
+	0x4,	// Index 12
+	0x6,	// Index 13
+	0x4,	// Index 14
+	0x5,	// Index 15
+	0xA,	// Index 16
+	0x8,	// Index 17
+	0xA,	// Index 18
+	0xA,	// Index 19
+	0xD,	// Index 20
+	0xA,	// Index 21
+	0xA,	// Index 22
+	0xA,	// Index 23
+	0xA,	// Index 24
+	0xA,	// Index 25
+	0x4,	// Index 26
+	0x4,	// Index 27
+	0xB,	// Index 28
+	0xA,	// Index 29
+	0xB,	// Index 30
+	0xB,	// Index 31
+	0xE,	// Index 32
+	0xF,	// Index 33
+	0xC,	// Index 34
+	0xC,	// Index 35
+	0xC,	// Index 36
+	0xB,	// Index 37
+	0xA,	// Index 38
+	0xD,	// Index 39
+	0xD,	// Index 40
+	0x4,	// Index 41
+	0xB,	// Index 42
+	0xF,	// Index 43
+	0xA,	// Index 44
+	0xF,	// Index 45
+	0xD,	// Index 46
+	0xD,	// Index 47
+	0xB,	// Index 48
+	0xE,	// Index 49
+	0xD,	// Index 50
+	0xB,	// Index 51
+	0xC,	// Index 52
+	0xD,	// Index 53
+	0xF,	// Index 54
+	0x13,	// Index 55
+	0xF,	// Index 56
+	0xE,	// Index 57
+	0xB,	// Index 58
+	0x6,	// Index 59
+	0x5,	// Index 60
+	0x6,	// Index 61
+	0xA,	// Index 62
+	0xA,	// Index 63
+	0x5,	// Index 64
+	0xB,	// Index 65
+	0xB,	// Index 66
+	0xB,	// Index 67
+	0xB,	// Index 68
+	0xB,	// Index 69
+	0x8,	// Index 70
+	0xB,	// Index 71
+	0xB,	// Index 72
+	0x4,	// Index 73
+	0x6,	// Index 74
+	0xC,	// Index 75
+	0x4,	// Index 76
+	0x10,	// Index 77
+	0xB,	// Index 78
+	0xB,	// Index 79
+	0xB,	// Index 80
+	0xB,	// Index 81
+	0x8,	// Index 82
+	0xA,	// Index 83
+	0x7,	// Index 84
+	0xB,	// Index 85
+	0xB,	// Index 86
+	0x11,	// Index 87
+	0xD,	// Index 88
+	0xB,	// Index 89
+	0x9,	// Index 90
+	0x7,	// Index 91
+	0x2,	// Index 92
+	0x7,	// Index 93
+	0xB,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char ArialBlack14_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0xE, 0x0,	// Index 1
+	0xE, 0x0,	// Index 2
+	0xE, 0x0,	// Index 3
+	0xF, 0x2,	// Index 4
+	0xE, 0x0,	// Index 5
+	0xE, 0x0,	// Index 6
+	0xE, 0x0,	// Index 7
+	0xE, 0x4,	// Index 8
+	0xE, 0x4,	// Index 9
+	0xE, 0x0,	// Index 10
+	0xC, 0x0,	// Index 11
+	0x4, 0x4,	// Index 12
+	0x7, 0x0,	// Index 13
+	0x4, 0x0,	// Index 14
+	0xE, 0x0,	// Index 15
+	0xE, 0x0,	// Index 16
+	0xE, 0x0,	// Index 17
+	0xE, 0x0,	// Index 18
+	0xE, 0x0,	// Index 19
+	0xE, 0x0,	// Index 20
+	0xE, 0x0,	// Index 21
+	0xE, 0x0,	// Index 22
+	0xE, 0x0,	// Index 23
+	0xE, 0x0,	// Index 24
+	0xE, 0x0,	// Index 25
+	0xB, 0x0,	// Index 26
+	0xB, 0x4,	// Index 27
+	0xC, 0x0,	// Index 28
+	0xB, 0x0,	// Index 29
+	0xC, 0x0,	// Index 30
+	0xE, 0x0,	// Index 31
+	0xE, 0x2,	// Index 32
+	0xE, 0x0,	// Index 33
+	0xE, 0x0,	// Index 34
+	0xE, 0x0,	// Index 35
+	0xE, 0x0,	// Index 36
+	0xE, 0x0,	// Index 37
+	0xE, 0x0,	// Index 38
+	0xE, 0x0,	// Index 39
+	0xE, 0x0,	// Index 40
+	0xE, 0x0,	// Index 41
+	0xE, 0x0,	// Index 42
+	0xE, 0x0,	// Index 43
+	0xE, 0x0,	// Index 44
+	0xE, 0x0,	// Index 45
+	0xE, 0x0,	// Index 46
+	0xE, 0x0,	// Index 47
+	0xE, 0x0,	// Index 48
+	0xE, 0x1,	// Index 49
+	0xE, 0x0,	// Index 50
+	0xE, 0x0,	// Index 51
+	0xE, 0x0,	// Index 52
+	0xE, 0x0,	// Index 53
+	0xE, 0x0,	// Index 54
+	0xE, 0x0,	// Index 55
+	0xE, 0x0,	// Index 56
+	0xE, 0x0,	// Index 57
+	0xE, 0x0,	// Index 58
+	0xE, 0x4,	// Index 59
+	0xE, 0x0,	// Index 60
+	0xE, 0x4,	// Index 61
+	0xE, 0x0,	// Index 62
+	0x0, 0x2,	// Index 63
+	0xE, 0x0,	// Index 64
+	0xB, 0x0,	// Index 65
+	0xE, 0x0,	// Index 66
+	0xB, 0x0,	// Index 67
+	0xE, 0x0,	// Index 68
+	0xB, 0x0,	// Index 69
+	0xE, 0x0,	// Index 70
+	0xB, 0x4,	// Index 71
+	0xE, 0x0,	// Index 72
+	0xE, 0x0,	// Index 73
+	0xE, 0x4,	// Index 74
+	0xE, 0x0,	// Index 75
+	0xE, 0x0,	// Index 76
+	0xB, 0x0,	// Index 77
+	0xB, 0x0,	// Index 78
+	0xB, 0x0,	// Index 79
+	0xB, 0x4,	// Index 80
+	0xB, 0x4,	// Index 81
+	0xB, 0x0,	// Index 82
+	0xB, 0x0,	// Index 83
+	0xE, 0x0,	// Index 84
+	0xB, 0x0,	// Index 85
+	0xB, 0x0,	// Index 86
+	0xB, 0x0,	// Index 87
+	0xB, 0x0,	// Index 88
+	0xB, 0x4,	// Index 89
+	0xB, 0x0,	// Index 90
+	0xE, 0x4,	// Index 91
+	0xE, 0x4,	// Index 92
+	0xE, 0x4,	// Index 93
+	0x9, 0x0,	// Index 94
+};
+
+const font_t ArialBlack14 = 
+{
+	ArialBlack14_bitmaps,
+	ArialBlack14_offsets,
+	ArialBlack14_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x13,	// Height 
+	0,	// Flags 
+	ArialBlack14_extents,
+	0xF	// Ascent 
 };
+
 //---------------------------------------------------------------
 // Group Name: ArialBlack12
 // Designer: Imported System Font
@@ -425,404 +636,613 @@ const unsigned char ArialBlack14[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char ArialBlack12[] = 
+const unsigned char ArialBlack12_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x10,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xCA, // Index 1 (offset: 202)
-	0x0, 0xD1, // Index 2 (offset: 209)
-	0x0, 0xE0, // Index 3 (offset: 224)
-	0x0, 0xF7, // Index 4 (offset: 247)
-	0x1, 0xA, // Index 5 (offset: 266)
-	0x1, 0x27, // Index 6 (offset: 295)
-	0x1, 0x3E, // Index 7 (offset: 318)
-	0x1, 0x45, // Index 8 (offset: 325)
-	0x1, 0x50, // Index 9 (offset: 336)
-	0x1, 0x5B, // Index 10 (offset: 347)
-	0x1, 0x68, // Index 11 (offset: 360)
-	0x1, 0x7B, // Index 12 (offset: 379)
-	0x1, 0x82, // Index 13 (offset: 386)
-	0x1, 0x8D, // Index 14 (offset: 397)
-	0x1, 0x94, // Index 15 (offset: 404)
-	0x1, 0x9D, // Index 16 (offset: 413)
-	0x1, 0xAE, // Index 17 (offset: 430)
-	0x1, 0xBB, // Index 18 (offset: 443)
-	0x1, 0xCC, // Index 19 (offset: 460)
-	0x1, 0xDD, // Index 20 (offset: 477)
-	0x1, 0xF0, // Index 21 (offset: 496)
-	0x2, 0x1, // Index 22 (offset: 513)
-	0x2, 0x12, // Index 23 (offset: 530)
-	0x2, 0x23, // Index 24 (offset: 547)
-	0x2, 0x34, // Index 25 (offset: 564)
-	0x2, 0x45, // Index 26 (offset: 581)
-	0x2, 0x4C, // Index 27 (offset: 588)
-	0x2, 0x53, // Index 28 (offset: 595)
-	0x2, 0x66, // Index 29 (offset: 614)
-	0x2, 0x77, // Index 30 (offset: 631)
-	0x2, 0x8A, // Index 31 (offset: 650)
-	0x2, 0x9B, // Index 32 (offset: 667)
-	0x2, 0xB4, // Index 33 (offset: 692)
-	0x2, 0xCF, // Index 34 (offset: 719)
-	0x2, 0xE2, // Index 35 (offset: 738)
-	0x2, 0xF5, // Index 36 (offset: 757)
-	0x3, 0x8, // Index 37 (offset: 776)
-	0x3, 0x1B, // Index 38 (offset: 795)
-	0x3, 0x2C, // Index 39 (offset: 812)
-	0x3, 0x41, // Index 40 (offset: 833)
-	0x3, 0x56, // Index 41 (offset: 854)
-	0x3, 0x5D, // Index 42 (offset: 861)
-	0x3, 0x70, // Index 43 (offset: 880)
-	0x3, 0x89, // Index 44 (offset: 905)
-	0x3, 0x9A, // Index 45 (offset: 922)
-	0x3, 0xB3, // Index 46 (offset: 947)
-	0x3, 0xC8, // Index 47 (offset: 968)
-	0x3, 0xDD, // Index 48 (offset: 989)
-	0x3, 0xF0, // Index 49 (offset: 1008)
-	0x4, 0x5, // Index 50 (offset: 1029)
-	0x4, 0x1A, // Index 51 (offset: 1050)
-	0x4, 0x2D, // Index 52 (offset: 1069)
-	0x4, 0x44, // Index 53 (offset: 1092)
-	0x4, 0x59, // Index 54 (offset: 1113)
-	0x4, 0x74, // Index 55 (offset: 1140)
-	0x4, 0x97, // Index 56 (offset: 1175)
-	0x4, 0xB2, // Index 57 (offset: 1202)
-	0x4, 0xC9, // Index 58 (offset: 1225)
-	0x4, 0xDC, // Index 59 (offset: 1244)
-	0x4, 0xE7, // Index 60 (offset: 1255)
-	0x4, 0xF0, // Index 61 (offset: 1264)
-	0x4, 0xFB, // Index 62 (offset: 1275)
-	0x5, 0xC, // Index 63 (offset: 1292)
-	0x5, 0x1D, // Index 64 (offset: 1309)
-	0x5, 0x24, // Index 65 (offset: 1316)
-	0x5, 0x37, // Index 66 (offset: 1335)
-	0x5, 0x4A, // Index 67 (offset: 1354)
-	0x5, 0x5D, // Index 68 (offset: 1373)
-	0x5, 0x70, // Index 69 (offset: 1392)
-	0x5, 0x83, // Index 70 (offset: 1411)
-	0x5, 0x90, // Index 71 (offset: 1424)
-	0x5, 0xA3, // Index 72 (offset: 1443)
-	0x5, 0xB6, // Index 73 (offset: 1462)
-	0x5, 0xBD, // Index 74 (offset: 1469)
-	0x5, 0xC8, // Index 75 (offset: 1480)
-	0x5, 0xDD, // Index 76 (offset: 1501)
-	0x5, 0xE4, // Index 77 (offset: 1508)
-	0x5, 0xFF, // Index 78 (offset: 1535)
-	0x6, 0x12, // Index 79 (offset: 1554)
-	0x6, 0x25, // Index 80 (offset: 1573)
-	0x6, 0x38, // Index 81 (offset: 1592)
-	0x6, 0x4B, // Index 82 (offset: 1611)
-	0x6, 0x58, // Index 83 (offset: 1624)
-	0x6, 0x69, // Index 84 (offset: 1641)
-	0x6, 0x76, // Index 85 (offset: 1654)
-	0x6, 0x89, // Index 86 (offset: 1673)
-	0x6, 0x9C, // Index 87 (offset: 1692)
-	0x6, 0xBB, // Index 88 (offset: 1723)
-	0x6, 0xD2, // Index 89 (offset: 1746)
-	0x6, 0xE5, // Index 90 (offset: 1765)
-	0x6, 0xF4, // Index 91 (offset: 1780)
-	0x7, 0x1, // Index 92 (offset: 1793)
-	0x7, 0x6, // Index 93 (offset: 1798)
-	0x7, 0x13, // Index 94 (offset: 1811)
-
 	/* Index 0, character 32 " " (width: 3 pixels) */
-	0x3, 0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 3 pixels) */
-	0x3, 0xFE,0x1D,0xFE,0x1D,0xFE,0x1D,
+	0xFE,0x1D,0xFE,0x1D,0xFE,0x1D,
 
 	/* Index 2, character 34 """ (width: 7 pixels) */
-	0x7, 0x1E,0x00,0x1E,0x00,0x1E,0x00,0x00,0x00,0x1E,0x00,0x1E,0x00,0x1E,0x00,
+	0x1E,0x00,0x1E,0x00,0x1E,0x00,0x00,0x00,0x1E,0x00,0x1E,0x00,0x1E,0x00,
 
 	/* Index 3, character 35 "#" (width: 11 pixels) */
-	0xB, 0x30,0x06,0x30,0x1E,0xF0,0x1F,0xFE,0x07,0x3E,0x06,0x30,0x06,0x30,0x1E,0xF0,0x1F,0xFE,0x07,0x3E,0x06,0x30,0x06,
+	0x30,0x06,0x30,0x1E,0xF0,0x1F,0xFE,0x07,0x3E,0x06,0x30,0x06,0x30,0x1E,0xF0,0x1F,0xFE,0x07,0x3E,0x06,0x30,0x06,
 
 	/* Index 4, character 36 "$" (width: 9 pixels) */
-	0x9, 0x38,0x04,0x7C,0x0C,0xFE,0x1C,0xE6,0x18,0xFF,0x3F,0xC6,0x19,0xCE,0x1F,0x8C,0x0F,0x0C,0x07,
+	0x38,0x04,0x7C,0x0C,0xFE,0x1C,0xE6,0x18,0xFF,0x3F,0xC6,0x19,0xCE,0x1F,0x8C,0x0F,0x0C,0x07,
 
 	/* Index 5, character 37 "%" (width: 14 pixels) */
-	0xE, 0x3C,0x00,0x7E,0x00,0x42,0x00,0x42,0x10,0x7E,0x0C,0x3C,0x02,0x80,0x01,0x60,0x00,0x10,0x0F,0x8C,0x1F,0x82,0x10,0x80,0x10,0x80,0x1F,0x00,0x0F,
+	0x3C,0x00,0x7E,0x00,0x42,0x00,0x42,0x10,0x7E,0x0C,0x3C,0x02,0x80,0x01,0x60,0x00,0x10,0x0F,0x8C,0x1F,0x82,0x10,0x80,0x10,0x80,0x1F,0x00,0x0F,
 
 	/* Index 6, character 38 "&" (width: 11 pixels) */
-	0xB, 0x00,0x07,0x80,0x0F,0x9C,0x1F,0xFE,0x19,0xFE,0x18,0xE6,0x19,0xBE,0x1F,0x3E,0x0F,0x9C,0x0F,0x80,0x1F,0x80,0x1D,
+	0x00,0x07,0x80,0x0F,0x9C,0x1F,0xFE,0x19,0xFE,0x18,0xE6,0x19,0xBE,0x1F,0x3E,0x0F,0x9C,0x0F,0x80,0x1F,0x80,0x1D,
 
 	/* Index 7, character 39 "'" (width: 3 pixels) */
-	0x3, 0x1E,0x00,0x1E,0x00,0x1E,0x00,
+	0x1E,0x00,0x1E,0x00,0x1E,0x00,
 
 	/* Index 8, character 40 "(" (width: 5 pixels) */
-	0x5, 0xE0,0x0F,0xF8,0x3F,0xFC,0x7F,0x1E,0xF0,0x02,0x80,
+	0xE0,0x0F,0xF8,0x3F,0xFC,0x7F,0x1E,0xF0,0x02,0x80,
 
 	/* Index 9, character 41 ")" (width: 5 pixels) */
-	0x5, 0x02,0x80,0x1E,0xF0,0xFC,0x7F,0xF8,0x3F,0xE0,0x0F,
+	0x02,0x80,0x1E,0xF0,0xFC,0x7F,0xF8,0x3F,0xE0,0x0F,
 
 	/* Index 10, character 42 "*" (width: 6 pixels) */
-	0x6, 0x08,0x00,0x68,0x00,0x3E,0x00,0x3E,0x00,0x68,0x00,0x08,0x00,
+	0x08,0x00,0x68,0x00,0x3E,0x00,0x3E,0x00,0x68,0x00,0x08,0x00,
 
 	/* Index 11, character 43 "+" (width: 9 pixels) */
-	0x9, 0xC0,0x01,0xC0,0x01,0xC0,0x01,0xF8,0x0F,0xF8,0x0F,0xF8,0x0F,0xC0,0x01,0xC0,0x01,0xC0,0x01,
+	0xC0,0x01,0xC0,0x01,0xC0,0x01,0xF8,0x0F,0xF8,0x0F,0xF8,0x0F,0xC0,0x01,0xC0,0x01,0xC0,0x01,
 
 	/* Index 12, character 44 "," (width: 3 pixels) */
-	0x3, 0x00,0xDC,0x00,0x7C,0x00,0x3C,
+	0x00,0xDC,0x00,0x7C,0x00,0x3C,
 
 	/* Index 13, character 45 "-" (width: 5 pixels) */
-	0x5, 0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
+	0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,
 
 	/* Index 14, character 46 "." (width: 3 pixels) */
-	0x3, 0x00,0x1C,0x00,0x1C,0x00,0x1C,
+	0x00,0x1C,0x00,0x1C,0x00,0x1C,
 
 	/* Index 15, character 47 "/" (width: 4 pixels) */
-	0x4, 0x00,0x18,0x80,0x07,0x78,0x00,0x06,0x00,
+	0x00,0x18,0x80,0x07,0x78,0x00,0x06,0x00,
 
 	/* Index 16, character 48 "0" (width: 8 pixels) */
-	0x8, 0xF8,0x07,0xFC,0x0F,0xFE,0x1F,0x06,0x18,0x06,0x18,0xFE,0x1F,0xFC,0x0F,0xF8,0x07,
+	0xF8,0x07,0xFC,0x0F,0xFE,0x1F,0x06,0x18,0x06,0x18,0xFE,0x1F,0xFC,0x0F,0xF8,0x07,
 
 	/* Index 17, character 49 "1" (width: 6 pixels) */
-	0x6, 0x60,0x00,0x70,0x00,0x38,0x00,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,
+	0x60,0x00,0x70,0x00,0x38,0x00,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,
 
 	/* Index 18, character 50 "2" (width: 8 pixels) */
-	0x8, 0x18,0x18,0x1C,0x1C,0x1E,0x1E,0x06,0x1F,0x86,0x1B,0xFE,0x19,0xFC,0x18,0x78,0x18,
+	0x18,0x18,0x1C,0x1C,0x1E,0x1E,0x06,0x1F,0x86,0x1B,0xFE,0x19,0xFC,0x18,0x78,0x18,
 
 	/* Index 19, character 51 "3" (width: 8 pixels) */
-	0x8, 0x08,0x06,0x1C,0x0E,0x1E,0x1E,0xC6,0x18,0xC6,0x18,0xFE,0x1F,0xFC,0x0F,0x38,0x07,
+	0x08,0x06,0x1C,0x0E,0x1E,0x1E,0xC6,0x18,0xC6,0x18,0xFE,0x1F,0xFC,0x0F,0x38,0x07,
 
 	/* Index 20, character 52 "4" (width: 9 pixels) */
-	0x9, 0x80,0x03,0xC0,0x03,0xF0,0x03,0x38,0x03,0x1C,0x03,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x00,0x03,
+	0x80,0x03,0xC0,0x03,0xF0,0x03,0x38,0x03,0x1C,0x03,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x00,0x03,
 
 	/* Index 21, character 53 "5" (width: 8 pixels) */
-	0x8, 0xF0,0x06,0xFE,0x0E,0xFE,0x1E,0x66,0x18,0x66,0x18,0xE6,0x1F,0xC6,0x0F,0x86,0x07,
+	0xF0,0x06,0xFE,0x0E,0xFE,0x1E,0x66,0x18,0x66,0x18,0xE6,0x1F,0xC6,0x0F,0x86,0x07,
 
 	/* Index 22, character 54 "6" (width: 8 pixels) */
-	0x8, 0xF0,0x03,0xFC,0x0F,0xFE,0x1F,0x46,0x18,0x66,0x18,0xEE,0x1F,0xCE,0x0F,0x8C,0x07,
+	0xF0,0x03,0xFC,0x0F,0xFE,0x1F,0x46,0x18,0x66,0x18,0xEE,0x1F,0xCE,0x0F,0x8C,0x07,
 
 	/* Index 23, character 55 "7" (width: 8 pixels) */
-	0x8, 0x06,0x00,0x06,0x00,0x06,0x1C,0x86,0x1F,0xE6,0x1F,0xF6,0x01,0x1E,0x00,0x06,0x00,
+	0x06,0x00,0x06,0x00,0x06,0x1C,0x86,0x1F,0xE6,0x1F,0xF6,0x01,0x1E,0x00,0x06,0x00,
 
 	/* Index 24, character 56 "8" (width: 8 pixels) */
-	0x8, 0x38,0x07,0xFC,0x0F,0xFE,0x1F,0xC6,0x18,0xC6,0x18,0xFE,0x1F,0xFC,0x0F,0x38,0x07,
+	0x38,0x07,0xFC,0x0F,0xFE,0x1F,0xC6,0x18,0xC6,0x18,0xFE,0x1F,0xFC,0x0F,0x38,0x07,
 
 	/* Index 25, character 57 "9" (width: 8 pixels) */
-	0x8, 0x78,0x0C,0xFC,0x1C,0xFE,0x1D,0x86,0x19,0x86,0x18,0xFE,0x1F,0xFC,0x0F,0xF0,0x03,
+	0x78,0x0C,0xFC,0x1C,0xFE,0x1D,0x86,0x19,0x86,0x18,0xFE,0x1F,0xFC,0x0F,0xF0,0x03,
 
 	/* Index 26, character 58 ":" (width: 3 pixels) */
-	0x3, 0x70,0x1C,0x70,0x1C,0x70,0x1C,
+	0x70,0x1C,0x70,0x1C,0x70,0x1C,
 
 	/* Index 27, character 59 ";" (width: 3 pixels) */
-	0x3, 0x70,0xDC,0x70,0x7C,0x70,0x3C,
+	0x70,0xDC,0x70,0x7C,0x70,0x3C,
 
 	/* Index 28, character 60 "<" (width: 9 pixels) */
-	0x9, 0xE0,0x03,0xE0,0x03,0xE0,0x03,0xF0,0x07,0x70,0x07,0x70,0x07,0x70,0x07,0x38,0x0E,0x38,0x0E,
+	0xE0,0x03,0xE0,0x03,0xE0,0x03,0xF0,0x07,0x70,0x07,0x70,0x07,0x70,0x07,0x38,0x0E,0x38,0x0E,
 
 	/* Index 29, character 61 "=" (width: 8 pixels) */
-	0x8, 0x70,0x07,0x70,0x07,0x70,0x07,0x70,0x07,0x70,0x07,0x70,0x07,0x70,0x07,0x70,0x07,
+	0x70,0x07,0x70,0x07,0x70,0x07,0x70,0x07,0x70,0x07,0x70,0x07,0x70,0x07,0x70,0x07,
 
 	/* Index 30, character 62 ">" (width: 9 pixels) */
-	0x9, 0x38,0x0E,0x38,0x0E,0x70,0x07,0x70,0x07,0x70,0x07,0xF0,0x07,0xE0,0x03,0xE0,0x03,0xE0,0x03,
+	0x38,0x0E,0x38,0x0E,0x70,0x07,0x70,0x07,0x70,0x07,0xF0,0x07,0xE0,0x03,0xE0,0x03,0xE0,0x03,
 
 	/* Index 31, character 63 "?" (width: 8 pixels) */
-	0x8, 0x18,0x00,0x1C,0x00,0x9E,0x1D,0xC6,0x1D,0xE6,0x1D,0xFE,0x00,0x7C,0x00,0x38,0x00,
+	0x18,0x00,0x1C,0x00,0x9E,0x1D,0xC6,0x1D,0xE6,0x1D,0xFE,0x00,0x7C,0x00,0x38,0x00,
 
 	/* Index 32, character 64 "@" (width: 12 pixels) */
-	0xC, 0xE0,0x07,0x18,0x18,0xC4,0x27,0xF4,0x2F,0x3A,0x48,0x0A,0x48,0x0A,0x4C,0xF2,0x4F,0xFA,0x4F,0x7C,0x28,0x08,0x36,0xF0,0x11,
+	0xE0,0x07,0x18,0x18,0xC4,0x27,0xF4,0x2F,0x3A,0x48,0x0A,0x48,0x0A,0x4C,0xF2,0x4F,0xFA,0x4F,0x7C,0x28,0x08,0x36,0xF0,0x11,
 
 	/* Index 33, character 65 "A" (width: 13 pixels) */
-	0xD, 0x00,0x10,0x00,0x1C,0x80,0x1F,0xE0,0x0F,0xF8,0x07,0xFE,0x06,0x1E,0x06,0xFE,0x06,0xF8,0x07,0xE0,0x0F,0x80,0x1F,0x00,0x1C,0x00,0x10,
+	0x00,0x10,0x00,0x1C,0x80,0x1F,0xE0,0x0F,0xF8,0x07,0xFE,0x06,0x1E,0x06,0xFE,0x06,0xF8,0x07,0xE0,0x0F,0x80,0x1F,0x00,0x1C,0x00,0x10,
 
 	/* Index 34, character 66 "B" (width: 9 pixels) */
-	0x9, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC6,0x18,0xC6,0x18,0xFE,0x18,0xBC,0x1F,0x98,0x1F,0x00,0x07,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC6,0x18,0xC6,0x18,0xFE,0x18,0xBC,0x1F,0x98,0x1F,0x00,0x07,
 
 	/* Index 35, character 67 "C" (width: 9 pixels) */
-	0x9, 0xF0,0x03,0xFC,0x0F,0xFE,0x1F,0x0E,0x1C,0x06,0x18,0x0E,0x1C,0x1E,0x1F,0x1C,0x0E,0x08,0x06,
+	0xF0,0x03,0xFC,0x0F,0xFE,0x1F,0x0E,0x1C,0x06,0x18,0x0E,0x1C,0x1E,0x1F,0x1C,0x0E,0x08,0x06,
 
 	/* Index 36, character 68 "D" (width: 9 pixels) */
-	0x9, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x06,0x18,0x06,0x18,0x0E,0x1C,0xFE,0x1F,0xFC,0x0F,0xF0,0x03,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x06,0x18,0x06,0x18,0x0E,0x1C,0xFE,0x1F,0xFC,0x0F,0xF0,0x03,
 
 	/* Index 37, character 69 "E" (width: 9 pixels) */
-	0x9, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x18,0x06,0x18,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x18,0x06,0x18,
 
 	/* Index 38, character 70 "F" (width: 8 pixels) */
-	0x8, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC6,0x00,0xC6,0x00,0xC6,0x00,0xC6,0x00,0x06,0x00,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC6,0x00,0xC6,0x00,0xC6,0x00,0xC6,0x00,0x06,0x00,
 
 	/* Index 39, character 71 "G" (width: 10 pixels) */
-	0xA, 0xF0,0x03,0xFC,0x0F,0xFC,0x0F,0x0E,0x1C,0x06,0x18,0xC6,0x18,0xCE,0x1C,0xDE,0x1F,0xDC,0x0F,0xC8,0x0F,
+	0xF0,0x03,0xFC,0x0F,0xFC,0x0F,0x0E,0x1C,0x06,0x18,0xC6,0x18,0xCE,0x1C,0xDE,0x1F,0xDC,0x0F,0xC8,0x0F,
 
 	/* Index 40, character 72 "H" (width: 10 pixels) */
-	0xA, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,
 
 	/* Index 41, character 73 "I" (width: 3 pixels) */
-	0x3, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,
 
 	/* Index 42, character 74 "J" (width: 9 pixels) */
-	0x9, 0x00,0x06,0x00,0x0F,0x00,0x1F,0x00,0x1C,0x00,0x18,0x00,0x18,0xFE,0x1F,0xFE,0x0F,0xFE,0x07,
+	0x00,0x06,0x00,0x0F,0x00,0x1F,0x00,0x1C,0x00,0x18,0x00,0x18,0xFE,0x1F,0xFE,0x0F,0xFE,0x07,
 
 	/* Index 43, character 75 "K" (width: 12 pixels) */
-	0xC, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC0,0x00,0xE0,0x00,0xF0,0x00,0xF8,0x01,0xDC,0x07,0x0E,0x1F,0x06,0x1E,0x02,0x18,0x00,0x10,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC0,0x00,0xE0,0x00,0xF0,0x00,0xF8,0x01,0xDC,0x07,0x0E,0x1F,0x06,0x1E,0x02,0x18,0x00,0x10,
 
 	/* Index 44, character 76 "L" (width: 8 pixels) */
-	0x8, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,
 
 	/* Index 45, character 77 "M" (width: 12 pixels) */
-	0xC, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x3E,0x00,0xF8,0x03,0x80,0x1F,0x80,0x1F,0xF8,0x03,0x3E,0x00,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x3E,0x00,0xF8,0x03,0x80,0x1F,0x80,0x1F,0xF8,0x03,0x3E,0x00,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,
 
 	/* Index 46, character 78 "N" (width: 10 pixels) */
-	0xA, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x7C,0x00,0xF0,0x01,0xE0,0x03,0x80,0x0F,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x7C,0x00,0xF0,0x01,0xE0,0x03,0x80,0x0F,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,
 
 	/* Index 47, character 79 "O" (width: 10 pixels) */
-	0xA, 0xF0,0x03,0xFC,0x0F,0xFC,0x0F,0x0E,0x1C,0x06,0x18,0x06,0x18,0x0E,0x1C,0xFC,0x0F,0xFC,0x0F,0xF0,0x03,
+	0xF0,0x03,0xFC,0x0F,0xFC,0x0F,0x0E,0x1C,0x06,0x18,0x06,0x18,0x0E,0x1C,0xFC,0x0F,0xFC,0x0F,0xF0,0x03,
 
 	/* Index 48, character 80 "P" (width: 9 pixels) */
-	0x9, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC6,0x00,0xC6,0x00,0xC6,0x00,0xFE,0x00,0x7E,0x00,0x3C,0x00,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC6,0x00,0xC6,0x00,0xC6,0x00,0xFE,0x00,0x7E,0x00,0x3C,0x00,
 
 	/* Index 49, character 81 "Q" (width: 10 pixels) */
-	0xA, 0xF0,0x03,0xFC,0x0F,0xFC,0x0F,0x0E,0x1C,0x06,0x18,0x06,0x1E,0x0E,0x1C,0xFC,0x1F,0xFC,0x1F,0xF0,0x33,
+	0xF0,0x03,0xFC,0x0F,0xFC,0x0F,0x0E,0x1C,0x06,0x18,0x06,0x1E,0x0E,0x1C,0xFC,0x1F,0xFC,0x1F,0xF0,0x33,
 
 	/* Index 50, character 82 "R" (width: 10 pixels) */
-	0xA, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC6,0x00,0xC6,0x00,0xC6,0x03,0xFE,0x0F,0x7E,0x1F,0x3C,0x1C,0x00,0x10,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC6,0x00,0xC6,0x00,0xC6,0x03,0xFE,0x0F,0x7E,0x1F,0x3C,0x1C,0x00,0x10,
 
 	/* Index 51, character 83 "S" (width: 9 pixels) */
-	0x9, 0x38,0x06,0x7C,0x0E,0xFE,0x1E,0xE6,0x1C,0xE6,0x18,0xEE,0x19,0xDE,0x1F,0xDC,0x0F,0x98,0x07,
+	0x38,0x06,0x7C,0x0E,0xFE,0x1E,0xE6,0x1C,0xE6,0x18,0xEE,0x19,0xDE,0x1F,0xDC,0x0F,0x98,0x07,
 
 	/* Index 52, character 84 "T" (width: 11 pixels) */
-	0xB, 0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,
+	0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,
 
 	/* Index 53, character 85 "U" (width: 10 pixels) */
-	0xA, 0xFE,0x07,0xFE,0x0F,0xFE,0x1F,0x00,0x1C,0x00,0x18,0x00,0x18,0x00,0x1C,0xFE,0x1F,0xFE,0x0F,0xFE,0x07,
+	0xFE,0x07,0xFE,0x0F,0xFE,0x1F,0x00,0x1C,0x00,0x18,0x00,0x18,0x00,0x1C,0xFE,0x1F,0xFE,0x0F,0xFE,0x07,
 
 	/* Index 54, character 86 "V" (width: 13 pixels) */
-	0xD, 0x02,0x00,0x1E,0x00,0xFE,0x00,0xFC,0x03,0xF0,0x1F,0x80,0x1F,0x00,0x1C,0x80,0x1F,0xF0,0x1F,0xFC,0x03,0xFE,0x00,0x1E,0x00,0x02,0x00,
+	0x02,0x00,0x1E,0x00,0xFE,0x00,0xFC,0x03,0xF0,0x1F,0x80,0x1F,0x00,0x1C,0x80,0x1F,0xF0,0x1F,0xFC,0x03,0xFE,0x00,0x1E,0x00,0x02,0x00,
 
 	/* Index 55, character 87 "W" (width: 17 pixels) */
-	0x11, 0x06,0x00,0xFE,0x00,0xFE,0x0F,0xF8,0x1F,0x00,0x1F,0x80,0x1F,0xF8,0x07,0xFE,0x01,0x3E,0x00,0xFE,0x01,0xF8,0x07,0x80,0x1F,0x00,0x1F,0xF8,0x1F,0xFE,0x0F,0xFE,0x00,0x06,0x00,
+	0x06,0x00,0xFE,0x00,0xFE,0x0F,0xF8,0x1F,0x00,0x1F,0x80,0x1F,0xF8,0x07,0xFE,0x01,0x3E,0x00,0xFE,0x01,0xF8,0x07,0x80,0x1F,0x00,0x1F,0xF8,0x1F,0xFE,0x0F,0xFE,0x00,0x06,0x00,
 
 	/* Index 56, character 88 "X" (width: 13 pixels) */
-	0xD, 0x02,0x10,0x06,0x18,0x1E,0x1E,0x3C,0x0F,0xF8,0x07,0xF0,0x03,0xE0,0x01,0xF0,0x03,0xF8,0x07,0x3C,0x0F,0x1E,0x1E,0x06,0x18,0x02,0x10,
+	0x02,0x10,0x06,0x18,0x1E,0x1E,0x3C,0x0F,0xF8,0x07,0xF0,0x03,0xE0,0x01,0xF0,0x03,0xF8,0x07,0x3C,0x0F,0x1E,0x1E,0x06,0x18,0x02,0x10,
 
 	/* Index 57, character 89 "Y" (width: 11 pixels) */
-	0xB, 0x02,0x00,0x0E,0x00,0x1E,0x00,0x7E,0x00,0xF8,0x1F,0xE0,0x1F,0xF8,0x1F,0x7E,0x00,0x1E,0x00,0x0E,0x00,0x02,0x00,
+	0x02,0x00,0x0E,0x00,0x1E,0x00,0x7E,0x00,0xF8,0x1F,0xE0,0x1F,0xF8,0x1F,0x7E,0x00,0x1E,0x00,0x0E,0x00,0x02,0x00,
 
 	/* Index 58, character 90 "Z" (width: 9 pixels) */
-	0x9, 0x00,0x1C,0x06,0x1E,0x06,0x1F,0xC6,0x1B,0xE6,0x19,0xF6,0x18,0x3E,0x18,0x1E,0x18,0x0E,0x18,
+	0x00,0x1C,0x06,0x1E,0x06,0x1F,0xC6,0x1B,0xE6,0x19,0xF6,0x18,0x3E,0x18,0x1E,0x18,0x0E,0x18,
 
 	/* Index 59, character 91 "[" (width: 5 pixels) */
-	0x5, 0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0x06,0xC0,0x06,0xC0,
+	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0x06,0xC0,0x06,0xC0,
 
 	/* Index 60, character 92 "\" (width: 4 pixels) */
-	0x4, 0x06,0x00,0x78,0x00,0x80,0x07,0x00,0x18,
+	0x06,0x00,0x78,0x00,0x80,0x07,0x00,0x18,
 
 	/* Index 61, character 93 "]" (width: 5 pixels) */
-	0x5, 0x06,0xC0,0x06,0xC0,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
+	0x06,0xC0,0x06,0xC0,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
 
 	/* Index 62, character 94 "^" (width: 8 pixels) */
-	0x8, 0x40,0x00,0x70,0x00,0x7C,0x00,0x1E,0x00,0x1E,0x00,0x7C,0x00,0x70,0x00,0x40,0x00,
+	0x40,0x00,0x70,0x00,0x7C,0x00,0x1E,0x00,0x1E,0x00,0x7C,0x00,0x70,0x00,0x40,0x00,
 
 	/* Index 63, character 95 "_" (width: 8 pixels) */
-	0x8, 0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,
+	0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,
 
 	/* Index 64, character 96 "`" (width: 3 pixels) */
-	0x3, 0x02,0x00,0x06,0x00,0x04,0x00,
+	0x02,0x00,0x06,0x00,0x04,0x00,
 
 	/* Index 65, character 97 "a" (width: 9 pixels) */
-	0x9, 0x40,0x0E,0x60,0x1F,0x70,0x1F,0x30,0x1B,0xB0,0x19,0xB0,0x09,0xF0,0x1F,0xF0,0x1F,0xE0,0x1F,
+	0x40,0x0E,0x60,0x1F,0x70,0x1F,0x30,0x1B,0xB0,0x19,0xB0,0x09,0xF0,0x1F,0xF0,0x1F,0xE0,0x1F,
 
 	/* Index 66, character 98 "b" (width: 9 pixels) */
-	0x9, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x60,0x0C,0x30,0x18,0x30,0x18,0xF0,0x1F,0xE0,0x0F,0xC0,0x07,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x60,0x0C,0x30,0x18,0x30,0x18,0xF0,0x1F,0xE0,0x0F,0xC0,0x07,
 
 	/* Index 67, character 99 "c" (width: 9 pixels) */
-	0x9, 0xC0,0x07,0xE0,0x0F,0xF0,0x1F,0x70,0x1C,0x30,0x18,0x30,0x18,0x70,0x1C,0x60,0x0C,0x40,0x04,
+	0xC0,0x07,0xE0,0x0F,0xF0,0x1F,0x70,0x1C,0x30,0x18,0x30,0x18,0x70,0x1C,0x60,0x0C,0x40,0x04,
 
 	/* Index 68, character 100 "d" (width: 9 pixels) */
-	0x9, 0xC0,0x07,0xE0,0x0F,0xF0,0x1F,0x30,0x18,0x30,0x18,0x60,0x0C,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,
+	0xC0,0x07,0xE0,0x0F,0xF0,0x1F,0x30,0x18,0x30,0x18,0x60,0x0C,0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,
 
 	/* Index 69, character 101 "e" (width: 9 pixels) */
-	0x9, 0xC0,0x07,0xE0,0x0F,0xF0,0x1F,0xB0,0x1D,0xB0,0x19,0xB0,0x19,0xF0,0x1D,0xE0,0x0D,0xC0,0x05,
+	0xC0,0x07,0xE0,0x0F,0xF0,0x1F,0xB0,0x1D,0xB0,0x19,0xB0,0x19,0xF0,0x1D,0xE0,0x0D,0xC0,0x05,
 
 	/* Index 70, character 102 "f" (width: 6 pixels) */
-	0x6, 0x30,0x00,0xFC,0x1F,0xFE,0x1F,0xFE,0x1F,0x36,0x00,0x36,0x00,
+	0x30,0x00,0xFC,0x1F,0xFE,0x1F,0xFE,0x1F,0x36,0x00,0x36,0x00,
 
 	/* Index 71, character 103 "g" (width: 9 pixels) */
-	0x9, 0xC0,0x47,0xE0,0xCF,0xF0,0xDF,0x30,0xD8,0x30,0xD8,0x60,0xCC,0xF0,0xFF,0xF0,0x7F,0xF0,0x3F,
+	0xC0,0x47,0xE0,0xCF,0xF0,0xDF,0x30,0xD8,0x30,0xD8,0x60,0xCC,0xF0,0xFF,0xF0,0x7F,0xF0,0x3F,
 
 	/* Index 72, character 104 "h" (width: 9 pixels) */
-	0x9, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x20,0x00,0x30,0x00,0x30,0x00,0xF0,0x1F,0xF0,0x1F,0xE0,0x1F,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0x20,0x00,0x30,0x00,0x30,0x00,0xF0,0x1F,0xF0,0x1F,0xE0,0x1F,
 
 	/* Index 73, character 105 "i" (width: 3 pixels) */
-	0x3, 0xF6,0x1F,0xF6,0x1F,0xF6,0x1F,
+	0xF6,0x1F,0xF6,0x1F,0xF6,0x1F,
 
 	/* Index 74, character 106 "j" (width: 5 pixels) */
-	0x5, 0x00,0xC0,0x00,0xC0,0xF6,0xFF,0xF6,0xFF,0xF6,0x7F,
+	0x00,0xC0,0x00,0xC0,0xF6,0xFF,0xF6,0xFF,0xF6,0x7F,
 
 	/* Index 75, character 107 "k" (width: 10 pixels) */
-	0xA, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC0,0x03,0xE0,0x01,0xF0,0x07,0xF0,0x1F,0x30,0x1E,0x10,0x1C,0x00,0x10,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,0xC0,0x03,0xE0,0x01,0xF0,0x07,0xF0,0x1F,0x30,0x1E,0x10,0x1C,0x00,0x10,
 
 	/* Index 76, character 108 "l" (width: 3 pixels) */
-	0x3, 0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,
+	0xFE,0x1F,0xFE,0x1F,0xFE,0x1F,
 
 	/* Index 77, character 109 "m" (width: 13 pixels) */
-	0xD, 0xF0,0x1F,0xF0,0x1F,0xF0,0x1F,0x20,0x00,0x30,0x00,0xF0,0x1F,0xF0,0x1F,0xE0,0x1F,0x20,0x00,0x30,0x00,0xF0,0x1F,0xF0,0x1F,0xE0,0x1F,
+	0xF0,0x1F,0xF0,0x1F,0xF0,0x1F,0x20,0x00,0x30,0x00,0xF0,0x1F,0xF0,0x1F,0xE0,0x1F,0x20,0x00,0x30,0x00,0xF0,0x1F,0xF0,0x1F,0xE0,0x1F,
 
 	/* Index 78, character 110 "n" (width: 9 pixels) */
-	0x9, 0xF0,0x1F,0xF0,0x1F,0xF0,0x1F,0x20,0x00,0x30,0x00,0x30,0x00,0xF0,0x1F,0xF0,0x1F,0xE0,0x1F,
+	0xF0,0x1F,0xF0,0x1F,0xF0,0x1F,0x20,0x00,0x30,0x00,0x30,0x00,0xF0,0x1F,0xF0,0x1F,0xE0,0x1F,
 
 	/* Index 79, character 111 "o" (width: 9 pixels) */
-	0x9, 0xC0,0x07,0xE0,0x0F,0xF0,0x1F,0x70,0x1C,0x30,0x18,0x70,0x1C,0xF0,0x1F,0xE0,0x0F,0xC0,0x07,
+	0xC0,0x07,0xE0,0x0F,0xF0,0x1F,0x70,0x1C,0x30,0x18,0x70,0x1C,0xF0,0x1F,0xE0,0x0F,0xC0,0x07,
 
 	/* Index 80, character 112 "p" (width: 9 pixels) */
-	0x9, 0xF0,0xFF,0xF0,0xFF,0xF0,0xFF,0x60,0x0C,0x30,0x18,0x30,0x18,0xF0,0x1F,0xE0,0x0F,0xC0,0x07,
+	0xF0,0xFF,0xF0,0xFF,0xF0,0xFF,0x60,0x0C,0x30,0x18,0x30,0x18,0xF0,0x1F,0xE0,0x0F,0xC0,0x07,
 
 	/* Index 81, character 113 "q" (width: 9 pixels) */
-	0x9, 0xC0,0x07,0xE0,0x0F,0xF0,0x1F,0x30,0x18,0x30,0x18,0x20,0x0C,0xF0,0xFF,0xF0,0xFF,0xF0,0xFF,
+	0xC0,0x07,0xE0,0x0F,0xF0,0x1F,0x30,0x18,0x30,0x18,0x20,0x0C,0xF0,0xFF,0xF0,0xFF,0xF0,0xFF,
 
 	/* Index 82, character 114 "r" (width: 6 pixels) */
-	0x6, 0xF0,0x1F,0xF0,0x1F,0xF0,0x1F,0x20,0x00,0x30,0x00,0x10,0x00,
+	0xF0,0x1F,0xF0,0x1F,0xF0,0x1F,0x20,0x00,0x30,0x00,0x10,0x00,
 
 	/* Index 83, character 115 "s" (width: 8 pixels) */
-	0x8, 0xE0,0x08,0xF0,0x19,0xF0,0x1B,0x90,0x13,0x90,0x13,0xB0,0x1F,0x30,0x1F,0x20,0x0E,
+	0xE0,0x08,0xF0,0x19,0xF0,0x1B,0x90,0x13,0x90,0x13,0xB0,0x1F,0x30,0x1F,0x20,0x0E,
 
 	/* Index 84, character 116 "t" (width: 6 pixels) */
-	0x6, 0x30,0x00,0xFC,0x0F,0xFC,0x1F,0xFE,0x1F,0x30,0x18,0x30,0x18,
+	0x30,0x00,0xFC,0x0F,0xFC,0x1F,0xFE,0x1F,0x30,0x18,0x30,0x18,
 
 	/* Index 85, character 117 "u" (width: 9 pixels) */
-	0x9, 0xF0,0x0F,0xF0,0x1F,0xF0,0x1F,0x00,0x18,0x00,0x18,0x00,0x08,0xF0,0x1F,0xF0,0x1F,0xF0,0x1F,
+	0xF0,0x0F,0xF0,0x1F,0xF0,0x1F,0x00,0x18,0x00,0x18,0x00,0x08,0xF0,0x1F,0xF0,0x1F,0xF0,0x1F,
 
 	/* Index 86, character 118 "v" (width: 9 pixels) */
-	0x9, 0x10,0x00,0xF0,0x00,0xF0,0x07,0xC0,0x1F,0x00,0x1C,0xE0,0x1F,0xF0,0x07,0xF0,0x00,0x10,0x00,
+	0x10,0x00,0xF0,0x00,0xF0,0x07,0xC0,0x1F,0x00,0x1C,0xE0,0x1F,0xF0,0x07,0xF0,0x00,0x10,0x00,
 
 	/* Index 87, character 119 "w" (width: 15 pixels) */
-	0xF, 0x10,0x00,0xF0,0x00,0xF0,0x07,0xE0,0x1F,0x00,0x1E,0x00,0x0F,0xF0,0x03,0xF0,0x00,0xF0,0x03,0x00,0x0F,0x00,0x1E,0xE0,0x1F,0xF0,0x07,0xF0,0x00,0x10,0x00,
+	0x10,0x00,0xF0,0x00,0xF0,0x07,0xE0,0x1F,0x00,0x1E,0x00,0x0F,0xF0,0x03,0xF0,0x00,0xF0,0x03,0x00,0x0F,0x00,0x1E,0xE0,0x1F,0xF0,0x07,0xF0,0x00,0x10,0x00,
 
 	/* Index 88, character 120 "x" (width: 11 pixels) */
-	0xB, 0x10,0x10,0x30,0x18,0x70,0x1E,0xE0,0x0F,0xC0,0x07,0x80,0x03,0xC0,0x07,0xE0,0x0F,0x70,0x1E,0x30,0x18,0x10,0x10,
+	0x10,0x10,0x30,0x18,0x70,0x1E,0xE0,0x0F,0xC0,0x07,0x80,0x03,0xC0,0x07,0xE0,0x0F,0x70,0x1E,0x30,0x18,0x10,0x10,
 
 	/* Index 89, character 121 "y" (width: 9 pixels) */
-	0x9, 0x10,0xC0,0xF0,0xC0,0xF0,0xC7,0xC0,0xFF,0x00,0xFC,0xC0,0x3F,0xF0,0x0F,0xF0,0x01,0x30,0x00,
+	0x10,0xC0,0xF0,0xC0,0xF0,0xC7,0xC0,0xFF,0x00,0xFC,0xC0,0x3F,0xF0,0x0F,0xF0,0x01,0x30,0x00,
 
 	/* Index 90, character 122 "z" (width: 7 pixels) */
-	0x7, 0x30,0x1C,0x30,0x1E,0x30,0x1F,0xF0,0x1B,0xF0,0x19,0xF0,0x18,0x30,0x18,
+	0x30,0x1C,0x30,0x1E,0x30,0x1F,0xF0,0x1B,0xF0,0x19,0xF0,0x18,0x30,0x18,
 
 	/* Index 91, character 123 "{" (width: 6 pixels) */
-	0x6, 0x00,0x03,0x00,0x03,0xFC,0x7F,0xFE,0xFF,0xFE,0xFC,0x06,0xC0,
+	0x00,0x03,0x00,0x03,0xFC,0x7F,0xFE,0xFF,0xFE,0xFC,0x06,0xC0,
 
 	/* Index 92, character 124 "|" (width: 2 pixels) */
-	0x2, 0xFE,0xFF,0xFE,0xFF,
+	0xFE,0xFF,0xFE,0xFF,
 
 	/* Index 93, character 125 "}" (width: 6 pixels) */
-	0x6, 0x06,0xC0,0xFE,0xFC,0xFE,0xFF,0xFC,0x7F,0x00,0x03,0x00,0x03,
+	0x06,0xC0,0xFE,0xFC,0xFE,0xFF,0xFC,0x7F,0x00,0x03,0x00,0x03,
 
 	/* Index 94, character 126 "~" (width: 9 pixels) */
-	0x9, 0xC0,0x01,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xE0,0x00
+	0xC0,0x01,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xE0,0x00
+};
+
+// Offset of each bitmap in ArialBlack12_bitmaps
+const unsigned short ArialBlack12_offsets[] = 
+{
+	0x0,	// Index 0
+	0x6,	// Index 1
+	0xC,	// Index 2
+	0x1A,	// Index 3
+	0x30,	// Index 4
+	0x42,	// Index 5
+	0x5E,	// Index 6
+	0x74,	// Index 7
+	0x7A,	// Index 8
+	0x84,	// Index 9
+	0x8E,	// Index 10
+	0x9A,	// Index 11
+	0xAC,	// Index 12
+	0xB2,	// Index 13
+	0xBC,	// Index 14
+	0xC2,	// Index 15
+	0xCA,	// Index 16
+	0xDA,	// Index 17
+	0xE6,	// Index 18
+	0xF6,	// Index 19
+	0x106,	// Index 20
+	0x118,	// Index 21
+	0x128,	// Index 22
+	0x138,	// Index 23
+	0x148,	// Index 24
+	0x158,	// Index 25
+	0x168,	// Index 26
+	0x16E,	// Index 27
+	0x174,	// Index 28
+	0x186,	// Index 29
+	0x196,	// Index 30
+	0x1A8,	// Index 31
+	0x1B8,	// Index 32
+	0x1D0,	// Index 33
+	0x1EA,	// Index 34
+	0x1FC,	// Index 35
+	0x20E,	// Index 36
+	0x220,	// Index 37
+	0x232,	// Index 38
+	0x242,	// Index 39
+	0x256,	// Index 40
+	0x26A,	// Index 41
+	0x270,	// Index 42
+	0x282,	// Index 43
+	0x29A,	// Index 44
+	0x2AA,	// Index 45
+	0x2C2,	// Index 46
+	0x2D6,	// Index 47
+	0x2EA,	// Index 48
+	0x2FC,	// Index 49
+	0x310,	// Index 50
+	0x324,	// Index 51
+	0x336,	// Index 52
+	0x34C,	// Index 53
+	0x360,	// Index 54
+	0x37A,	// Index 55
+	0x39C,	// Index 56
+	0x3B6,	// Index 57
+	0x3CC,	// Index 58
+	0x3DE,	// Index 59
+	0x3E8,	// Index 60
+	0x3F0,	// Index 61
+	0x3FA,	// Index 62
+	0x40A,	// Index 63
+	0x41A,	// Index 64
+	0x420,	// Index 65
+	0x432,	// Index 66
+	0x444,	// Index 67
+	0x456,	// Index 68
+	0x468,	// Index 69
+	0x47A,	// Index 70
+	0x486,	// Index 71
+	0x498,	// Index 72
+	0x4AA,	// Index 73
+	0x4B0,	// Index 74
+	0x4BA,	// Index 75
+	0x4CE,	// Index 76
+	0x4D4,	// Index 77
+	0x4EE,	// Index 78
+	0x500,	// Index 79
+	0x512,	// Index 80
+	0x524,	// Index 81
+	0x536,	// Index 82
+	0x542,	// Index 83
+	0x552,	// Index 84
+	0x55E,	// Index 85
+	0x570,	// Index 86
+	0x582,	// Index 87
+	0x5A0,	// Index 88
+	0x5B6,	// Index 89
+	0x5C8,	// Index 90
+	0x5D6,	// Index 91
+	0x5E2,	// Index 92
+	0x5E6,	// Index 93
+	0x5F2,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char ArialBlack12_widths[] = 
+{
+	0x3,	// Index 0
+	0x3,	// Index 1
+	0x7,	// Index 2
+	0xB,	// Index 3
+	0x9,	// Index 4
+	0xE,	// Index 5
+	0xB,	// Index 6
+	0x3,	// Index 7
+	0x5,	// Index 8
+	0x5,	// Index 9
+	0x6,	// Index 10
+	0x9,	// Index 11
+	0x3,	// Index 12
+	0x5,	// Index 13
+	0x3,	// Index 14
+	0x4,	// Index 15
+	0x8,	// Index 16
+	0x6,	// Index 17
+	0x8,	// Index 18
+	0x8,	// Index 19
+	0x9,	// Index 20
+	0x8,	// Index 21
+	0x8,	// Index 22
+	0x8,	// Index 23
+	0x8,	// Index 24
+	0x8,	// Index 25
+	0x3,	// Index 26
+	0x3,	// Index 27
+	0x9,	// Index 28
+	0x8,	// Index 29
+	0x9,	// Index 30
+	0x8,	// Index 31
+	0xC,	// Index 32
+	0xD,	// Index 33
+	0x9,	// Index 34
+	0x9,	// Index 35
+	0x9,	// Index 36
+	0x9,	// Index 37
+	0x8,	// Index 38
+	0xA,	// Index 39
+	0xA,	// Index 40
+	0x3,	// Index 41
+	0x9,	// Index 42
+	0xC,	// Index 43
+	0x8,	// Index 44
+	0xC,	// Index 45
+	0xA,	// Index 46
+	0xA,	// Index 47
+	0x9,	// Index 48
+	0xA,	// Index 49
+	0xA,	// Index 50
+	0x9,	// Index 51
+	0xB,	// Index 52
+	0xA,	// Index 53
+	0xD,	// Index 54
+	0x11,	// Index 55
+	0xD,	// Index 56
+	0xB,	// Index 57
+	0x9,	// Index 58
+	0x5,	// Index 59
+	0x4,	// Index 60
+	0x5,	// Index 61
+	0x8,	// Index 62
+	0x8,	// Index 63
+	0x3,	// Index 64
+	0x9,	// Index 65
+	0x9,	// Index 66
+	0x9,	// Index 67
+	0x9,	// Index 68
+	0x9,	// Index 69
+	0x6,	// Index 70
+	0x9,	// Index 71
+	0x9,	// Index 72
+	0x3,	// Index 73
+	0x5,	// Index 74
+	0xA,	// Index 75
+	0x3,	// Index 76
+	0xD,	// Index 77
+	0x9,	// Index 78
+	0x9,	// Index 79
+	0x9,	// Index 80
+	0x9,	// Index 81
+	0x6,	// Index 82
+	0x8,	// Index 83
+	0x6,	// Index 84
+	0x9,	// Index 85
+	0x9,	// Index 86
+	0xF,	// Index 87
+	0xB,	// Index 88
+	0x9,	// Index 89
+	0x7,	// Index 90
+	0x6,	// Index 91
+	0x2,	// Index 92
+	0x6,	// Index 93
+	0x9,	// Index 94
 };
+
+// Rows of each bitmap above and below the baseline
+const unsigned char ArialBlack12_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0xC, 0x0,	// Index 1
+	0xC, 0x0,	// Index 2
+	0xC, 0x0,	// Index 3
+	0xD, 0x1,	// Index 4
+	0xC, 0x0,	// Index 5
+	0xC, 0x0,	// Index 6
+	0xC, 0x0,	// Index 7
+	0xC, 0x3,	// Index 8
+	0xC, 0x3,	// Index 9
+	0xC, 0x0,	// Index 10
+	0xA, 0x0,	// Index 11
+	0x3, 0x3,	// Index 12
+	0x6, 0x0,	// Index 13
+	0x3, 0x0,	// Index 14
+	0xC, 0x0,	// Index 15
+	0xC, 0x0,	// Index 16
+	0xC, 0x0,	// Index 17
+	0xC, 0x0,	// Index 18
+	0xC, 0x0,	// Index 19
+	0xC, 0x0,	// Index 20
+	0xC, 0x0,	// Index 21
+	0xC, 0x0,	// Index 22
+	0xC, 0x0,	// Index 23
+	0xC, 0x0,	// Index 24
+	0xC, 0x0,	// Index 25
+	0x9, 0x0,	// Index 26
+	0x9, 0x3,	// Index 27
+	0xA, 0x0,	// Index 28
+	0x9, 0x0,	// Index 29
+	0xA, 0x0,	// Index 30
+	0xC, 0x0,	// Index 31
+	0xC, 0x2,	// Index 32
+	0xC, 0x0,	// Index 33
+	0xC, 0x0,	// Index 34
+	0xC, 0x0,	// Index 35
+	0xC, 0x0,	// Index 36
+	0xC, 0x0,	// Index 37
+	0xC, 0x0,	// Index 38
+	0xC, 0x0,	// Index 39
+	0xC, 0x0,	// Index 40
+	0xC, 0x0,	// Index 41
+	0xC, 0x0,	// Index 42
+	0xC, 0x0,	// Index 43
+	0xC, 0x0,	// Index 44
+	0xC, 0x0,	// Index 45
+	0xC, 0x0,	// Index 46
+	0xC, 0x0,	// Index 47
+	0xC, 0x0,	// Index 48
+	0xC, 0x1,	// Index 49
+	0xC, 0x0,	// Index 50
+	0xC, 0x0,	// Index 51
+	0xC, 0x0,	// Index 52
+	0xC, 0x0,	// Index 53
+	0xC, 0x0,	// Index 54
+	0xC, 0x0,	// Index 55
+	0xC, 0x0,	// Index 56
+	0xC, 0x0,	// Index 57
+	0xC, 0x0,	// Index 58
+	0xC, 0x3,	// Index 59
+	0xC, 0x0,	// Index 60
+	0xC, 0x3,	// Index 61
+	0xC, 0x0,	// Index 62
+	0x0, 0x2,	// Index 63
+	0xC, 0x0,	// Index 64
+	0x9, 0x0,	// Index 65
+	0xC, 0x0,	// Index 66
+	0x9, 0x0,	// Index 67
+	0xC, 0x0,	// Index 68
+	0x9, 0x0,	// Index 69
+	0xC, 0x0,	// Index 70
+	0x9, 0x3,	// Index 71
+	0xC, 0x0,	// Index 72
+	0xC, 0x0,	// Index 73
+	0xC, 0x3,	// Index 74
+	0xC, 0x0,	// Index 75
+	0xC, 0x0,	// Index 76
+	0x9, 0x0,	// Index 77
+	0x9, 0x0,	// Index 78
+	0x9, 0x0,	// Index 79
+	0x9, 0x3,	// Index 80
+	0x9, 0x3,	// Index 81
+	0x9, 0x0,	// Index 82
+	0x9, 0x0,	// Index 83
+	0xC, 0x0,	// Index 84
+	0x9, 0x0,	// Index 85
+	0x9, 0x0,	// Index 86
+	0x9, 0x0,	// Index 87
+	0x9, 0x0,	// Index 88
+	0x9, 0x3,	// Index 89
+	0x9, 0x0,	// Index 90
+	0xC, 0x3,	// Index 91
+	0xC, 0x3,	// Index 92
+	0xC, 0x3,	// Index 93
+	0x8, 0x0,	// Index 94
+};
+
+const font_t ArialBlack12 = 
+{
+	ArialBlack12_bitmaps,
+	ArialBlack12_offsets,
+	ArialBlack12_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x10,	// Height 
+	0,	// Flags 
+	ArialBlack12_extents,
+	0xD	// Ascent 
+};
+
 //---------------------------------------------------------------
 // Group Name: ArialBlack10
 // Designer: Imported System Font
 // Date: 02 Jun 2012
 // Description: Imported System Font
-// Byte Orientation: horizontalRight
+// Byte Orientation: verticalCeiling
 // Font Height: 14 pixel(s)
 // Font Type: Proportional 
 // Font Width: Individual 
@@ -830,398 +1250,607 @@ const unsigned char ArialBlack12[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char ArialBlack10[] = 
+const unsigned char ArialBlack10_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x01,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0xE,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xD2, // Index 1 (offset: 210)
-	0x0, 0xE1, // Index 2 (offset: 225)
-	0x0, 0xF0, // Index 3 (offset: 240)
-	0x0, 0xFF, // Index 4 (offset: 255)
-	0x1, 0xE, // Index 5 (offset: 270)
-	0x1, 0x2B, // Index 6 (offset: 299)
-	0x1, 0x48, // Index 7 (offset: 328)
-	0x1, 0x57, // Index 8 (offset: 343)
-	0x1, 0x66, // Index 9 (offset: 358)
-	0x1, 0x75, // Index 10 (offset: 373)
-	0x1, 0x84, // Index 11 (offset: 388)
-	0x1, 0x93, // Index 12 (offset: 403)
-	0x1, 0xA2, // Index 13 (offset: 418)
-	0x1, 0xB1, // Index 14 (offset: 433)
-	0x1, 0xC0, // Index 15 (offset: 448)
-	0x1, 0xCF, // Index 16 (offset: 463)
-	0x1, 0xDE, // Index 17 (offset: 478)
-	0x1, 0xED, // Index 18 (offset: 493)
-	0x1, 0xFC, // Index 19 (offset: 508)
-	0x2, 0xB, // Index 20 (offset: 523)
-	0x2, 0x28, // Index 21 (offset: 552)
-	0x2, 0x37, // Index 22 (offset: 567)
-	0x2, 0x46, // Index 23 (offset: 582)
-	0x2, 0x55, // Index 24 (offset: 597)
-	0x2, 0x64, // Index 25 (offset: 612)
-	0x2, 0x73, // Index 26 (offset: 627)
-	0x2, 0x82, // Index 27 (offset: 642)
-	0x2, 0x91, // Index 28 (offset: 657)
-	0x2, 0xA0, // Index 29 (offset: 672)
-	0x2, 0xAF, // Index 30 (offset: 687)
-	0x2, 0xBE, // Index 31 (offset: 702)
-	0x2, 0xCD, // Index 32 (offset: 717)
-	0x2, 0xEA, // Index 33 (offset: 746)
-	0x3, 0x7, // Index 34 (offset: 775)
-	0x3, 0x16, // Index 35 (offset: 790)
-	0x3, 0x25, // Index 36 (offset: 805)
-	0x3, 0x34, // Index 37 (offset: 820)
-	0x3, 0x43, // Index 38 (offset: 835)
-	0x3, 0x52, // Index 39 (offset: 850)
-	0x3, 0x6F, // Index 40 (offset: 879)
-	0x3, 0x8C, // Index 41 (offset: 908)
-	0x3, 0x9B, // Index 42 (offset: 923)
-	0x3, 0xAA, // Index 43 (offset: 938)
-	0x3, 0xC7, // Index 44 (offset: 967)
-	0x3, 0xD6, // Index 45 (offset: 982)
-	0x3, 0xF3, // Index 46 (offset: 1011)
-	0x4, 0x10, // Index 47 (offset: 1040)
-	0x4, 0x2D, // Index 48 (offset: 1069)
-	0x4, 0x3C, // Index 49 (offset: 1084)
-	0x4, 0x59, // Index 50 (offset: 1113)
-	0x4, 0x76, // Index 51 (offset: 1142)
-	0x4, 0x85, // Index 52 (offset: 1157)
-	0x4, 0xA2, // Index 53 (offset: 1186)
-	0x4, 0xBF, // Index 54 (offset: 1215)
-	0x4, 0xDC, // Index 55 (offset: 1244)
-	0x4, 0xF9, // Index 56 (offset: 1273)
-	0x5, 0x16, // Index 57 (offset: 1302)
-	0x5, 0x33, // Index 58 (offset: 1331)
-	0x5, 0x42, // Index 59 (offset: 1346)
-	0x5, 0x51, // Index 60 (offset: 1361)
-	0x5, 0x60, // Index 61 (offset: 1376)
-	0x5, 0x6F, // Index 62 (offset: 1391)
-	0x5, 0x7E, // Index 63 (offset: 1406)
-	0x5, 0x8D, // Index 64 (offset: 1421)
-	0x5, 0x9C, // Index 65 (offset: 1436)
-	0x5, 0xAB, // Index 66 (offset: 1451)
-	0x5, 0xBA, // Index 67 (offset: 1466)
-	0x5, 0xC9, // Index 68 (offset: 1481)
-	0x5, 0xD8, // Index 69 (offset: 1496)
-	0x5, 0xE7, // Index 70 (offset: 1511)
-	0x5, 0xF6, // Index 71 (offset: 1526)
-	0x6, 0x5, // Index 72 (offset: 1541)
-	0x6, 0x14, // Index 73 (offset: 1556)
-	0x6, 0x23, // Index 74 (offset: 1571)
-	0x6, 0x32, // Index 75 (offset: 1586)
-	0x6, 0x4F, // Index 76 (offset: 1615)
-	0x6, 0x5E, // Index 77 (offset: 1630)
-	0x6, 0x7B, // Index 78 (offset: 1659)
-	0x6, 0x8A, // Index 79 (offset: 1674)
-	0x6, 0x99, // Index 80 (offset: 1689)
-	0x6, 0xA8, // Index 81 (offset: 1704)
-	0x6, 0xB7, // Index 82 (offset: 1719)
-	0x6, 0xC6, // Index 83 (offset: 1734)
-	0x6, 0xD5, // Index 84 (offset: 1749)
-	0x6, 0xE4, // Index 85 (offset: 1764)
-	0x6, 0xF3, // Index 86 (offset: 1779)
-	0x7, 0x10, // Index 87 (offset: 1808)
-	0x7, 0x2D, // Index 88 (offset: 1837)
-	0x7, 0x4A, // Index 89 (offset: 1866)
-	0x7, 0x67, // Index 90 (offset: 1895)
-	0x7, 0x76, // Index 91 (offset: 1910)
-	0x7, 0x85, // Index 92 (offset: 1925)
-	0x7, 0x94, // Index 93 (offset: 1940)
-	0x7, 0xA3, // Index 94 (offset: 1955)
-
 	/* Index 0, character 32 " " (width: 3 pixels) */
-	0x3, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 3 pixels) */
-	0x3, 0x00,0x07,0x07,0x07,0x07,0x07,0x07,0x00,0x07,0x07,0x07,0x00,0x00,0x00,
+	0x7E,0x07,0x7E,0x07,0x7E,0x07,
 
 	/* Index 2, character 34 """ (width: 7 pixels) */
-	0x7, 0x00,0x77,0x77,0x77,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x0E,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,
 
 	/* Index 3, character 35 "#" (width: 8 pixels) */
-	0x8, 0x00,0x1B,0x1B,0xFF,0xFF,0x36,0x36,0xFF,0xFF,0x6C,0x6C,0x00,0x00,0x00,
+	0x98,0x01,0x98,0x07,0xF8,0x07,0xFE,0x01,0x9E,0x07,0xF8,0x07,0xFE,0x01,0x9E,0x01,
 
 	/* Index 4, character 36 "$" (width: 7 pixels) */
-	0x7, 0x08,0x3E,0x7F,0x6B,0x68,0x3E,0x1F,0x0B,0x6B,0x7F,0x3E,0x08,0x00,0x00,
+	0x1C,0x03,0x3E,0x07,0x66,0x06,0xFF,0x0F,0x66,0x06,0xEE,0x07,0xCC,0x03,
 
 	/* Index 5, character 37 "%" (width: 11 pixels) */
-	0xB, 0x00,0x00,0x84,0x03,0xC8,0x06,0xD0,0x06,0xD0,0x06,0xA0,0x03,0x2E,0x00,0x5B,0x00,0x9B,0x00,0x9B,0x00,0x0E,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x1C,0x00,0x3E,0x00,0x22,0x04,0x3E,0x03,0x9C,0x00,0x60,0x00,0x98,0x03,0xC4,0x07,0x42,0x04,0xC0,0x07,0x80,0x03,
 
 	/* Index 6, character 38 "&" (width: 10 pixels) */
-	0xA, 0x00,0x00,0xF0,0x00,0xF8,0x01,0x98,0x01,0xF0,0x01,0xE0,0x00,0xFB,0x01,0xBF,0x03,0x9F,0x03,0xFF,0x03,0xF9,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x80,0x03,0xDC,0x07,0xFE,0x07,0x76,0x06,0xF6,0x06,0xDE,0x07,0xCC,0x07,0x80,0x03,0xC0,0x03,0xC0,0x07,
 
 	/* Index 7, character 39 "'" (width: 3 pixels) */
-	0x3, 0x00,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x0E,0x00,0x0E,0x00,0x0E,0x00,
 
 	/* Index 8, character 40 "(" (width: 4 pixels) */
-	0x4, 0x00,0x00,0x03,0x06,0x06,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x06,0x06,0x03,
+	0xE0,0x07,0xF8,0x1F,0x1C,0x38,0x04,0x20,
 
 	/* Index 9, character 41 ")" (width: 4 pixels) */
-	0x4, 0x00,0x00,0x0C,0x06,0x06,0x03,0x03,0x03,0x03,0x03,0x03,0x06,0x06,0x0C,
+	0x04,0x20,0x1C,0x38,0xF8,0x1F,0xE0,0x07,
 
 	/* Index 10, character 42 "*" (width: 5 pixels) */
-	0x5, 0x00,0x04,0x1F,0x04,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x04,0x00,0x14,0x00,0x0E,0x00,0x14,0x00,0x04,0x00,
 
 	/* Index 11, character 43 "+" (width: 6 pixels) */
-	0x6, 0x00,0x00,0x00,0x0C,0x0C,0x3F,0x3F,0x0C,0x0C,0x00,0x00,0x00,0x00,0x00,
+	0x60,0x00,0x60,0x00,0xF8,0x01,0xF8,0x01,0x60,0x00,0x60,0x00,
 
 	/* Index 12, character 44 "," (width: 3 pixels) */
-	0x3, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x03,0x06,0x04,
+	0x00,0x37,0x00,0x1F,0x00,0x0F,
 
 	/* Index 13, character 45 "-" (width: 4 pixels) */
-	0x4, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x0F,0x00,0x00,0x00,0x00,0x00,
+	0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,
 
 	/* Index 14, character 46 "." (width: 3 pixels) */
-	0x3, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x00,0x00,0x00,
+	0x00,0x07,0x00,0x07,0x00,0x07,
 
 	/* Index 15, character 47 "/" (width: 4 pixels) */
-	0x4, 0x00,0x01,0x01,0x02,0x02,0x02,0x04,0x04,0x04,0x08,0x08,0x00,0x00,0x00,
+	0x00,0x06,0xC0,0x01,0x38,0x00,0x06,0x00,
 
 	/* Index 16, character 48 "0" (width: 7 pixels) */
-	0x7, 0x00,0x1C,0x3E,0x77,0x77,0x77,0x77,0x77,0x77,0x3E,0x3E,0x00,0x00,0x00,
+	0xF8,0x01,0xFC,0x07,0xFE,0x07,0x06,0x06,0xFE,0x07,0xFC,0x07,0xF8,0x01,
 
 	/* Index 17, character 49 "1" (width: 6 pixels) */
-	0x6, 0x00,0x07,0x07,0x0F,0x3F,0x37,0x07,0x07,0x07,0x07,0x07,0x00,0x00,0x00,
+	0x30,0x00,0x30,0x00,0x18,0x00,0xFE,0x07,0xFE,0x07,0xFE,0x07,
 
 	/* Index 18, character 50 "2" (width: 7 pixels) */
-	0x7, 0x00,0x3C,0x7E,0x77,0x07,0x07,0x0E,0x1C,0x38,0x7F,0x7F,0x00,0x00,0x00,
+	0x0C,0x06,0x0E,0x07,0x8E,0x07,0xC6,0x07,0xFE,0x06,0x7C,0x06,0x38,0x06,
 
 	/* Index 19, character 51 "3" (width: 7 pixels) */
-	0x7, 0x00,0x3C,0x7E,0x77,0x07,0x0E,0x0E,0x07,0x77,0x7E,0x3C,0x00,0x00,0x00,
+	0x0C,0x03,0x0E,0x07,0x0E,0x07,0x66,0x06,0xFE,0x07,0xFC,0x03,0x98,0x01,
 
 	/* Index 20, character 52 "4" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x0E,0x00,0x1E,0x00,0x3E,0x00,0x6E,0x00,0xCE,0x00,0xCE,0x01,0xFF,0x01,0xFF,0x01,0x0E,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xC0,0x01,0xE0,0x01,0xF0,0x01,0x98,0x01,0x8C,0x01,0xFE,0x07,0xFE,0x07,0xFE,0x07,0x80,0x01,
 
 	/* Index 21, character 53 "5" (width: 7 pixels) */
-	0x7, 0x00,0x3F,0x3F,0x30,0x7E,0x7F,0x27,0x07,0x77,0x7E,0x3C,0x00,0x00,0x00,
+	0x30,0x03,0x7E,0x07,0x3E,0x07,0x36,0x06,0xF6,0x07,0xF6,0x03,0xE6,0x01,
 
 	/* Index 22, character 54 "6" (width: 7 pixels) */
-	0x7, 0x00,0x1E,0x3F,0x77,0x70,0x76,0x7F,0x77,0x77,0x3F,0x1E,0x00,0x00,0x00,
+	0xF8,0x01,0xFC,0x03,0xFE,0x07,0x46,0x06,0xEE,0x07,0xEE,0x07,0xCC,0x03,
 
 	/* Index 23, character 55 "7" (width: 7 pixels) */
-	0x7, 0x00,0x7F,0x7F,0x06,0x0E,0x0C,0x1C,0x1C,0x38,0x38,0x38,0x00,0x00,0x00,
+	0x06,0x00,0x06,0x07,0xC6,0x07,0xF6,0x07,0xFE,0x00,0x1E,0x00,0x06,0x00,
 
 	/* Index 24, character 56 "8" (width: 7 pixels) */
-	0x7, 0x00,0x3E,0x7F,0x77,0x77,0x3E,0x3E,0x77,0x77,0x7F,0x3E,0x00,0x00,0x00,
+	0x9C,0x03,0xFE,0x07,0xFE,0x07,0x66,0x06,0xFE,0x07,0xFE,0x07,0x9C,0x03,
 
 	/* Index 25, character 57 "9" (width: 7 pixels) */
-	0x7, 0x00,0x3C,0x7E,0x77,0x77,0x7F,0x37,0x07,0x77,0x7E,0x3C,0x00,0x00,0x00,
+	0x3C,0x03,0x7E,0x07,0x7E,0x07,0x26,0x06,0xFE,0x07,0xFC,0x03,0xF8,0x01,
 
 	/* Index 26, character 58 ":" (width: 3 pixels) */
-	0x3, 0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x00,0x07,0x07,0x07,0x00,0x00,0x00,
+	0x70,0x07,0x70,0x07,0x70,0x07,
 
 	/* Index 27, character 59 ";" (width: 3 pixels) */
-	0x3, 0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x00,0x07,0x07,0x07,0x03,0x06,0x04,
+	0x70,0x37,0x70,0x1F,0x70,0x0F,
 
 	/* Index 28, character 60 "<" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x01,0x0F,0x7E,0x70,0x7E,0x0F,0x01,0x00,0x00,0x00,0x00,
+	0xE0,0x00,0xE0,0x00,0xE0,0x00,0xB0,0x01,0xB0,0x01,0xB0,0x01,0x18,0x03,
 
 	/* Index 29, character 61 "=" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,
+	0xB0,0x01,0xB0,0x01,0xB0,0x01,0xB0,0x01,0xB0,0x01,0xB0,0x01,0xB0,0x01,
 
 	/* Index 30, character 62 ">" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x40,0x78,0x3F,0x07,0x3F,0x78,0x40,0x00,0x00,0x00,0x00,
+	0x18,0x03,0xB0,0x01,0xB0,0x01,0xB0,0x01,0xE0,0x00,0xE0,0x00,0xE0,0x00,
 
 	/* Index 31, character 63 "?" (width: 7 pixels) */
-	0x7, 0x00,0x3E,0x7F,0x67,0x07,0x0E,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x00,0x00,
+	0x0C,0x00,0x0E,0x00,0xC6,0x06,0xE6,0x06,0xFE,0x06,0x3E,0x00,0x1C,0x00,
 
 	/* Index 32, character 64 "@" (width: 10 pixels) */
-	0xA, 0x00,0x00,0x7C,0x00,0x82,0x00,0x2D,0x01,0x5D,0x02,0xDD,0x02,0xD9,0x02,0xD9,0x02,0xDA,0x02,0x7C,0x01,0x82,0x01,0x7C,0x00,0x00,0x00,0x00,0x00,
+	0xF0,0x01,0x08,0x06,0xE4,0x05,0xF2,0x0B,0x0A,0x0A,0xF2,0x0B,0xFA,0x0B,0x3A,0x0A,0x04,0x05,0xF8,0x00,
 
 	/* Index 33, character 65 "A" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x7C,0x00,0x7C,0x00,0xFE,0x00,0xEE,0x00,0xEE,0x00,0xEE,0x00,0xFE,0x00,0xFF,0x01,0xC7,0x01,0xC7,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x07,0xF8,0x07,0xFE,0x07,0xFE,0x01,0x8E,0x01,0xFE,0x01,0xFE,0x07,0xF8,0x07,0x00,0x07,
 
 	/* Index 34, character 66 "B" (width: 8 pixels) */
-	0x8, 0x00,0xFE,0xFF,0xE7,0xE7,0xFE,0xFE,0xE7,0xE7,0xFF,0xFE,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0xFE,0x07,0x66,0x06,0x66,0x06,0xFE,0x07,0xFE,0x07,0x9C,0x03,
 
 	/* Index 35, character 67 "C" (width: 8 pixels) */
-	0x8, 0x00,0x3C,0x7E,0xE7,0xE0,0xE0,0xE0,0xE6,0xE7,0x7E,0x3C,0x00,0x00,0x00,
+	0xF8,0x01,0xFC,0x03,0xFE,0x07,0x06,0x06,0x06,0x06,0x8E,0x07,0x8C,0x03,0x08,0x01,
 
 	/* Index 36, character 68 "D" (width: 8 pixels) */
-	0x8, 0x00,0xFC,0xFE,0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,0xFE,0xFC,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0xFE,0x07,0x06,0x06,0x06,0x06,0xFE,0x07,0xFC,0x03,0xF8,0x01,
 
 	/* Index 37, character 69 "E" (width: 7 pixels) */
-	0x7, 0x00,0x7F,0x7F,0x70,0x70,0x7F,0x7F,0x70,0x70,0x7F,0x7F,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0xFE,0x07,0x66,0x06,0x66,0x06,0x66,0x06,0x66,0x06,
 
 	/* Index 38, character 70 "F" (width: 7 pixels) */
-	0x7, 0x00,0x7F,0x7F,0x70,0x70,0x7E,0x7E,0x70,0x70,0x70,0x70,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0xFE,0x07,0x66,0x00,0x66,0x00,0x66,0x00,0x06,0x00,
 
 	/* Index 39, character 71 "G" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x7E,0x00,0xFF,0x00,0xE7,0x01,0xC0,0x01,0xCF,0x01,0xCF,0x01,0xC7,0x01,0xE7,0x01,0xFF,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xF8,0x01,0xFC,0x03,0xFE,0x07,0x0E,0x07,0x06,0x06,0x66,0x06,0xEE,0x07,0xEE,0x03,0xEC,0x03,
 
 	/* Index 40, character 72 "H" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xC7,0x01,0xC7,0x01,0xC7,0x01,0xC7,0x01,0xFF,0x01,0xFF,0x01,0xC7,0x01,0xC7,0x01,0xC7,0x01,0xC7,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0xFE,0x07,0x60,0x00,0x60,0x00,0x60,0x00,0xFE,0x07,0xFE,0x07,0xFE,0x07,
 
 	/* Index 41, character 73 "I" (width: 3 pixels) */
-	0x3, 0x00,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0xFE,0x07,
 
 	/* Index 42, character 74 "J" (width: 8 pixels) */
-	0x8, 0x00,0x07,0x07,0x07,0x07,0x07,0x07,0xE7,0xE7,0x7E,0x3C,0x00,0x00,0x00,
+	0x80,0x01,0x80,0x03,0x80,0x07,0x00,0x06,0x00,0x06,0xFE,0x07,0xFE,0x03,0xFE,0x01,
 
 	/* Index 43, character 75 "K" (width: 10 pixels) */
-	0xA, 0x00,0x00,0x8E,0x03,0x9C,0x03,0xB8,0x03,0xF0,0x03,0xF8,0x03,0xDC,0x03,0x9C,0x03,0x8E,0x03,0x8E,0x03,0x87,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0xFE,0x07,0x70,0x00,0x38,0x00,0xFC,0x00,0xEE,0x03,0xC6,0x07,0x02,0x07,0x00,0x04,
 
 	/* Index 44, character 76 "L" (width: 7 pixels) */
-	0x7, 0x00,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x7F,0x7F,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0xFE,0x07,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,
 
 	/* Index 45, character 77 "M" (width: 10 pixels) */
-	0xA, 0x00,0x00,0x87,0x03,0x87,0x03,0xCF,0x03,0xCF,0x03,0x4B,0x03,0x7B,0x03,0x7B,0x03,0x33,0x03,0x33,0x03,0x33,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0x1E,0x00,0xF8,0x00,0xC0,0x07,0xC0,0x07,0xF8,0x00,0x1E,0x00,0xFE,0x07,0xFE,0x07,
 
 	/* Index 46, character 78 "N" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x83,0x01,0xC3,0x01,0xE3,0x01,0xF3,0x01,0xBB,0x01,0xBB,0x01,0x9F,0x01,0x8F,0x01,0x87,0x01,0x83,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0x1C,0x00,0x78,0x00,0xF0,0x00,0xE0,0x01,0x80,0x03,0xFE,0x07,0xFE,0x07,
 
 	/* Index 47, character 79 "O" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x7C,0x00,0xFE,0x00,0xEF,0x01,0xC7,0x01,0xC7,0x01,0xC7,0x01,0xC7,0x01,0xEF,0x01,0xFE,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xF8,0x01,0xFC,0x03,0xFE,0x07,0x0E,0x07,0x06,0x06,0x0E,0x07,0xFE,0x07,0xFC,0x03,0xF8,0x01,
 
 	/* Index 48, character 80 "P" (width: 7 pixels) */
-	0x7, 0x00,0x7E,0x7F,0x77,0x77,0x7F,0x7E,0x70,0x70,0x70,0x70,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0xFE,0x07,0x66,0x00,0x7E,0x00,0x7E,0x00,0x3C,0x00,
 
 	/* Index 49, character 81 "Q" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x7C,0x00,0xFE,0x00,0xCF,0x01,0xC7,0x01,0xC7,0x01,0xC7,0x01,0xD7,0x01,0xDF,0x01,0xFE,0x00,0x7F,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+	0xF8,0x01,0xFC,0x03,0xFE,0x07,0x06,0x06,0x86,0x07,0x0E,0x07,0xFE,0x07,0xFC,0x07,0xF8,0x0D,
 
 	/* Index 50, character 82 "R" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFC,0x01,0xFE,0x01,0xCE,0x01,0xCE,0x01,0xFE,0x01,0xF8,0x01,0xDC,0x01,0xCE,0x01,0xCE,0x01,0xC7,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0xFE,0x07,0x66,0x00,0xE6,0x00,0xFE,0x03,0xBE,0x07,0x3C,0x07,0x00,0x04,
 
 	/* Index 51, character 83 "S" (width: 7 pixels) */
-	0x7, 0x00,0x3E,0x7F,0x73,0x70,0x3E,0x1F,0x07,0x67,0x7F,0x3E,0x00,0x00,0x00,
+	0x1C,0x03,0x3E,0x07,0x7E,0x06,0x66,0x06,0xE6,0x07,0xEE,0x07,0xCC,0x03,
 
 	/* Index 52, character 84 "T" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFF,0x01,0xFF,0x01,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x06,0x00,0x06,0x00,0x06,0x00,0xFE,0x07,0xFE,0x07,0xFE,0x07,0x06,0x00,0x06,0x00,0x06,0x00,
 
 	/* Index 53, character 85 "U" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xC7,0x01,0xC7,0x01,0xC7,0x01,0xC7,0x01,0xC7,0x01,0xC7,0x01,0xC7,0x01,0xC7,0x01,0xFE,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xFE,0x01,0xFE,0x03,0xFE,0x07,0x00,0x06,0x00,0x06,0x00,0x06,0xFE,0x07,0xFE,0x03,0xFE,0x01,
 
 	/* Index 54, character 86 "V" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xC7,0x01,0xC7,0x01,0xEE,0x00,0xEE,0x00,0xEE,0x00,0x6C,0x00,0x6C,0x00,0x7C,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x06,0x00,0x3E,0x00,0xFE,0x01,0xF8,0x07,0x00,0x07,0xF8,0x07,0xFE,0x01,0x3E,0x00,0x06,0x00,
 
 	/* Index 55, character 87 "W" (width: 13 pixels) */
-	0xD, 0x00,0x00,0xE7,0x1C,0xE7,0x1C,0xE6,0x0C,0xF6,0x0D,0xB6,0x0D,0xBE,0x0F,0xBE,0x0F,0xBC,0x07,0x1C,0x07,0x1C,0x07,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x06,0x00,0xFE,0x00,0xFE,0x07,0xC0,0x07,0xF0,0x07,0xFE,0x01,0x1E,0x00,0xFE,0x01,0xF0,0x07,0xC0,0x07,0xFE,0x07,0xFE,0x00,0x06,0x00,
 
 	/* Index 56, character 88 "X" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xC7,0x01,0xEE,0x00,0xEE,0x00,0x7C,0x00,0x38,0x00,0x7C,0x00,0x7C,0x00,0xEE,0x00,0xEE,0x00,0xC7,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x02,0x04,0x0E,0x07,0xDE,0x07,0xFC,0x03,0xF0,0x00,0xFC,0x03,0xDE,0x07,0x0E,0x07,0x02,0x04,
 
 	/* Index 57, character 89 "Y" (width: 11 pixels) */
-	0xB, 0x00,0x00,0x07,0x07,0x8E,0x03,0xDC,0x01,0xDC,0x01,0xF8,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x02,0x00,0x06,0x00,0x1E,0x00,0x3C,0x00,0xF8,0x07,0xE0,0x07,0xF8,0x07,0x3C,0x00,0x1E,0x00,0x06,0x00,0x02,0x00,
 
 	/* Index 58, character 90 "Z" (width: 7 pixels) */
-	0x7, 0x00,0x7F,0x7F,0x07,0x06,0x0C,0x18,0x30,0x70,0x7F,0x7F,0x00,0x00,0x00,
+	0x06,0x07,0x86,0x07,0xC6,0x07,0x66,0x06,0x3E,0x06,0x1E,0x06,0x0E,0x06,
 
 	/* Index 59, character 91 "[" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x1F,0x1F,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1F,0x1F,
+	0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0x0C,0x30,0x0C,0x30,
 
 	/* Index 60, character 92 "\" (width: 4 pixels) */
-	0x4, 0x00,0x08,0x08,0x04,0x04,0x04,0x02,0x02,0x02,0x01,0x01,0x00,0x00,0x00,
+	0x06,0x00,0x38,0x00,0xC0,0x01,0x00,0x06,
 
 	/* Index 61, character 93 "]" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x1F,0x1F,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x1F,0x1F,
+	0x0C,0x30,0x0C,0x30,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,
 
 	/* Index 62, character 94 "^" (width: 6 pixels) */
-	0x6, 0x00,0x0C,0x0C,0x1E,0x12,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x20,0x00,0x38,0x00,0x0E,0x00,0x0E,0x00,0x38,0x00,0x20,0x00,
 
 	/* Index 63, character 95 "_" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,
+	0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,
 
 	/* Index 64, character 96 "`" (width: 3 pixels) */
-	0x3, 0x00,0x06,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x02,0x00,0x06,0x00,0x04,0x00,
 
 	/* Index 65, character 97 "a" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x7E,0xFF,0xE7,0x1F,0xE7,0xFF,0x77,0x00,0x00,0x00,
+	0x60,0x03,0x70,0x07,0x70,0x07,0xB0,0x06,0xB0,0x02,0xF0,0x07,0xF0,0x07,0xE0,0x07,
 
 	/* Index 66, character 98 "b" (width: 8 pixels) */
-	0x8, 0x00,0xE0,0xE0,0xE0,0xEE,0xFF,0xE7,0xE7,0xE7,0xFF,0xEE,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0xFE,0x07,0x20,0x02,0x30,0x06,0xF0,0x07,0xF0,0x07,0xE0,0x03,
 
 	/* Index 67, character 99 "c" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x3C,0x7E,0xE7,0xE0,0xE7,0x7E,0x3C,0x00,0x00,0x00,
+	0xC0,0x01,0xE0,0x03,0xF0,0x07,0x30,0x06,0x30,0x06,0x70,0x07,0x60,0x03,0x40,0x01,
 
 	/* Index 68, character 100 "d" (width: 8 pixels) */
-	0x8, 0x00,0x07,0x07,0x07,0x77,0xFF,0xE7,0xE7,0xE7,0xFF,0x77,0x00,0x00,0x00,
+	0xE0,0x03,0xF0,0x07,0xF0,0x07,0x30,0x06,0x20,0x02,0xFE,0x07,0xFE,0x07,0xFE,0x07,
 
 	/* Index 69, character 101 "e" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x3C,0x7E,0xE7,0xFF,0xE0,0x7F,0x3E,0x00,0x00,0x00,
+	0xC0,0x01,0xE0,0x03,0xF0,0x07,0xB0,0x06,0xB0,0x06,0xF0,0x06,0xE0,0x06,0xC0,0x02,
 
 	/* Index 70, character 102 "f" (width: 6 pixels) */
-	0x6, 0x00,0x0F,0x1C,0x1C,0x3E,0x3E,0x1C,0x1C,0x1C,0x1C,0x1C,0x00,0x00,0x00,
+	0x30,0x00,0xFC,0x07,0xFE,0x07,0xFE,0x07,0x32,0x00,0x02,0x00,
 
 	/* Index 71, character 103 "g" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x77,0xFF,0xE7,0xE7,0xE7,0xFF,0x77,0x07,0xFF,0x7E,
+	0xE0,0x13,0xF0,0x37,0xF0,0x37,0x30,0x36,0x20,0x32,0xF0,0x3F,0xF0,0x3F,0xF0,0x1F,
 
 	/* Index 72, character 104 "h" (width: 8 pixels) */
-	0x8, 0x00,0xE0,0xE0,0xE0,0xEE,0xFF,0xE7,0xE7,0xE7,0xE7,0xE7,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0xFE,0x07,0x20,0x00,0x30,0x00,0xF0,0x07,0xF0,0x07,0xE0,0x07,
 
 	/* Index 73, character 105 "i" (width: 3 pixels) */
-	0x3, 0x00,0x07,0x07,0x00,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x00,0x00,0x00,
+	0xF6,0x07,0xF6,0x07,0xF6,0x07,
 
 	/* Index 74, character 106 "j" (width: 5 pixels) */
-	0x5, 0x00,0x07,0x07,0x00,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x1F,0x1E,
+	0x00,0x30,0x00,0x30,0xF6,0x3F,0xF6,0x3F,0xF6,0x1F,
 
 	/* Index 75, character 107 "k" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xCE,0x01,0xDC,0x01,0xF8,0x01,0xFC,0x01,0xFC,0x01,0xCE,0x01,0xC7,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0xFE,0x07,0xC0,0x01,0xE0,0x01,0xF0,0x03,0xB0,0x07,0x10,0x06,0x00,0x04,
 
 	/* Index 76, character 108 "l" (width: 3 pixels) */
-	0x3, 0x00,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x00,0x00,0x00,
+	0xFE,0x07,0xFE,0x07,0xFE,0x07,
 
 	/* Index 77, character 109 "m" (width: 11 pixels) */
-	0xB, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6E,0x07,0xFF,0x07,0x77,0x07,0x77,0x07,0x77,0x07,0x77,0x07,0x77,0x07,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xF0,0x07,0xF0,0x07,0xF0,0x07,0x20,0x00,0xF0,0x07,0xF0,0x07,0xE0,0x07,0x30,0x00,0xF0,0x07,0xF0,0x07,0xE0,0x07,
 
 	/* Index 78, character 110 "n" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0xEE,0xFF,0xE7,0xE7,0xE7,0xE7,0xE7,0x00,0x00,0x00,
+	0xF0,0x07,0xF0,0x07,0xF0,0x07,0x20,0x00,0x30,0x00,0xF0,0x07,0xF0,0x07,0xE0,0x07,
 
 	/* Index 79, character 111 "o" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x3C,0x7E,0xE7,0xE7,0xE7,0x7E,0x3C,0x00,0x00,0x00,
+	0xC0,0x01,0xE0,0x03,0xF0,0x07,0x30,0x06,0x30,0x06,0xF0,0x07,0xE0,0x03,0xC0,0x01,
 
 	/* Index 80, character 112 "p" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0xEE,0xFF,0xE7,0xE7,0xE7,0xFF,0xEE,0xE0,0xE0,0xE0,
+	0xF0,0x3F,0xF0,0x3F,0xF0,0x3F,0x20,0x02,0x30,0x06,0xF0,0x07,0xF0,0x07,0xE0,0x03,
 
 	/* Index 81, character 113 "q" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x77,0xFF,0xE7,0xE7,0xE7,0xFF,0x77,0x07,0x07,0x07,
+	0xE0,0x03,0xF0,0x07,0xF0,0x07,0x30,0x06,0x20,0x02,0xF0,0x3F,0xF0,0x3F,0xF0,0x3F,
 
 	/* Index 82, character 114 "r" (width: 6 pixels) */
-	0x6, 0x00,0x00,0x00,0x00,0x3B,0x3E,0x38,0x38,0x38,0x38,0x38,0x00,0x00,0x00,
+	0xF0,0x07,0xF0,0x07,0xF0,0x07,0x20,0x00,0x30,0x00,0x10,0x00,
 
 	/* Index 83, character 115 "s" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0x3E,0x73,0x78,0x3E,0x0F,0x67,0x3E,0x00,0x00,0x00,
+	0x60,0x02,0xF0,0x06,0xF0,0x04,0xD0,0x05,0x90,0x07,0xB0,0x07,0x20,0x03,
 
 	/* Index 84, character 116 "t" (width: 6 pixels) */
-	0x6, 0x00,0x04,0x1C,0x1C,0x3E,0x3E,0x1C,0x1C,0x1C,0x1F,0x0F,0x00,0x00,0x00,
+	0x30,0x00,0xFC,0x03,0xFC,0x07,0xFE,0x07,0x30,0x06,0x00,0x06,
 
 	/* Index 85, character 117 "u" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0xE7,0xE7,0xE7,0xE7,0xE7,0xFF,0x77,0x00,0x00,0x00,
+	0xF0,0x03,0xF0,0x07,0xF0,0x07,0x00,0x06,0x00,0x02,0xF0,0x07,0xF0,0x07,0xF0,0x07,
 
 	/* Index 86, character 118 "v" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x01,0xEE,0x00,0xEE,0x00,0x6C,0x00,0x7C,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x10,0x00,0x70,0x00,0xF0,0x01,0xE0,0x07,0x00,0x07,0xE0,0x07,0xF0,0x01,0x70,0x00,0x10,0x00,
 
 	/* Index 87, character 119 "w" (width: 13 pixels) */
-	0xD, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x1C,0xE6,0x0C,0xEE,0x0E,0xAE,0x0E,0xBC,0x07,0x1C,0x07,0x1C,0x07,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x10,0x00,0xF0,0x00,0xF0,0x07,0xC0,0x07,0x00,0x07,0xF0,0x01,0x70,0x00,0xF0,0x01,0x00,0x07,0xC0,0x07,0xF0,0x07,0xF0,0x00,0x10,0x00,
 
 	/* Index 88, character 120 "x" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x01,0xEE,0x00,0x7C,0x00,0x7C,0x00,0x7C,0x00,0xEE,0x00,0xC7,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x10,0x04,0x30,0x06,0xF0,0x07,0xE0,0x03,0xC0,0x01,0xE0,0x03,0xF0,0x07,0x30,0x06,0x10,0x04,
 
 	/* Index 89, character 121 "y" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x01,0xC6,0x00,0xEE,0x00,0xEE,0x00,0x6C,0x00,0x7C,0x00,0x38,0x00,0x38,0x00,0xF8,0x00,0xF0,0x00,
+	0x10,0x00,0xF0,0x30,0xF0,0x33,0xC0,0x3F,0x00,0x3E,0xC0,0x1F,0xF0,0x03,0xF0,0x00,0x10,0x00,
 
 	/* Index 90, character 122 "z" (width: 6 pixels) */
-	0x6, 0x00,0x00,0x00,0x00,0x3F,0x3F,0x06,0x0C,0x18,0x3F,0x3F,0x00,0x00,0x00,
+	0x30,0x06,0x30,0x07,0xB0,0x07,0xF0,0x06,0x70,0x06,0x30,0x06,
 
 	/* Index 91, character 123 "{" (width: 4 pixels) */
-	0x4, 0x00,0x00,0x03,0x07,0x06,0x06,0x06,0x0C,0x0C,0x06,0x06,0x06,0x07,0x03,
+	0x80,0x01,0xF8,0x1F,0x7C,0x3E,0x0C,0x30,
 
 	/* Index 92, character 124 "|" (width: 2 pixels) */
-	0x2, 0x00,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+	0xFE,0x3F,0xFE,0x3F,
 
 	/* Index 93, character 125 "}" (width: 4 pixels) */
-	0x4, 0x00,0x00,0x0C,0x0E,0x06,0x06,0x06,0x03,0x03,0x06,0x06,0x06,0x0E,0x0C,
+	0x0C,0x30,0x7C,0x3E,0xF8,0x1F,0x80,0x01,
 
 	/* Index 94, character 126 "~" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0x00,0x39,0x7F,0x4E,0x00,0x00,0x00,0x00,0x00,0x00
+	0xC0,0x00,0x60,0x00,0x60,0x00,0xE0,0x00,0xC0,0x00,0xC0,0x00,0x60,0x00
+};
+
+// Offset of each bitmap in ArialBlack10_bitmaps
+const unsigned short ArialBlack10_offsets[] = 
+{
+	0x0,	// Index 0
+	0x6,	// Index 1
+	0xC,	// Index 2
+	0x1A,	// Index 3
+	0x2A,	// Index 4
+	0x38,	// Index 5
+	0x4E,	// Index 6
+	0x62,	// Index 7
+	0x68,	// Index 8
+	0x70,	// Index 9
+	0x78,	// Index 10
+	0x82,	// Index 11
+	0x8E,	// Index 12
+	0x94,	// Index 13
+	0x9C,	// Index 14
+	0xA2,	// Index 15
+	0xAA,	// Index 16
+	0xB8,	// Index 17
+	0xC4,	// Index 18
+	0xD2,	// Index 19
+	0xE0,	// Index 20
+	0xF2,	// Index 21
+	0x100,	// Index 22
+	0x10E,	// Index 23
+	0x11C,	// Index 24
+	0x12A,	// Index 25
+	0x138,	// Index 26
+	0x13E,	// Index 27
+	0x144,	// Index 28
+	0x152,	// Index 29
+	0x160,	// Index 30
+	0x16E,	// Index 31
+	0x17C,	// Index 32
+	0x190,	// Index 33
+	0x1A2,	// Index 34
+	0x1B2,	// Index 35
+	0x1C2,	// Index 36
+	0x1D2,	// Index 37
+	0x1E0,	// Index 38
+	0x1EE,	// Index 39
+	0x200,	// Index 40
+	0x212,	// Index 41
+	0x218,	// Index 42
+	0x228,	// Index 43
+	0x23C,	// Index 44
+	0x24A,	// Index 45
+	0x25E,	// Index 46
+	0x270,	// Index 47
+	0x282,	// Index 48
+	0x290,	// Index 49
+	0x2A2,	// Index 50
+	0x2B4,	// Index 51
+	0x2C2,	// Index 52
+	0x2D4,	// Index 53
+	0x2E6,	// Index 54
+	0x2F8,	// Index 55
+	0x312,	// Index 56
+	0x324,	// Index 57
+	0x33A,	// Index 58
+	0x348,	// Index 59
+	0x352,	// Index 60
+	0x35A,	// Index 61
+	0x364,	// Index 62
+	0x370,	// Index 63
+	0x37E,	// Index 64
+	0x384,	// Index 65
+	0x394,	// Index 66
+	0x3A4,	// Index 67
+	0x3B4,	// Index 68
+	0x3C4,	// Index 69
+	0x3D4,	// Index 70
+	0x3E0,	// Index 71
+	0x3F0,	// Index 72
+	0x400,	// Index 73
+	0x406,	// Index 74
+	0x410,	// Index 75
+	0x422,	// Index 76
+	0x428,	// Index 77
+	0x43E,	// Index 78
+	0x44E,	// Index 79
+	0x45E,	// Index 80
+	0x46E,	// Index 81
+	0x47E,	// Index 82
+	0x48A,	// Index 83
+	0x498,	// Index 84
+	0x4A4,	// Index 85
+	0x4B4,	// Index 86
+	0x4C6,	// Index 87
+	0x4E0,	// Index 88
+	0x4F2,	// Index 89
+	0x504,	// Index 90
+	0x510,	// Index 91
+	0x518,	// Index 92
+	0x51C,	// Index 93
+	0x524,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char ArialBlack10_widths[] = 
+{
+	0x3,	// Index 0
+	0x3,	// Index 1
+	0x7,	// Index 2
+	0x8,	// Index 3
+	0x7,	// Index 4
+	0xB,	// Index 5
+	0xA,	// Index 6
+	0x3,	// Index 7
+	0x4,	// Index 8
+	0x4,	// Index 9
+	0x5,	// Index 10
+	0x6,	// Index 11
+	0x3,	// Index 12
+	0x4,	// Index 13
+	0x3,	// Index 14
+	0x4,	// Index 15
+	0x7,	// Index 16
+	0x6,	// Index 17
+	0x7,	// Index 18
+	0x7,	// Index 19
+	0x9,	// Index 20
+	0x7,	// Index 21
+	0x7,	// Index 22
+	0x7,	// Index 23
+	0x7,	// Index 24
+	0x7,	// Index 25
+	0x3,	// Index 26
+	0x3,	// Index 27
+	0x7,	// Index 28
+	0x7,	// Index 29
+	0x7,	// Index 30
+	0x7,	// Index 31
+	0xA,	// Index 32
+	0x9,	// Index 33
+	0x8,	// Index 34
+	0x8,	// Index 35
+	0x8,	// Index 36
+	0x7,	// Index 37
+	0x7,	// Index 38
+	0x9,	// Index 39
+	0x9,	// Index 40
+	0x3,	// Index 41
+	0x8,	// Index 42
+	0xA,	// Index 43
+	0x7,	// Index 44
+	0xA,	// Index 45
+	0x9,	// Index 46
+	0x9,	// Index 47
+	0x7,	// Index 48
+	0x9,	// Index 49
+	0x9,	// Index 50
+	0x7,	// Index 51
+	0x9,	// Index 52
+	0x9,	// Index 53
+	0x9,	// Index 54
+	0xD,	// Index 55
+	0x9,	// Index 56
+	0xB,	// Index 57
+	0x7,	// Index 58
+	0x5,	// Index 59
+	0x4,	// Index 60
+	0x5,	// Index 61
+	0x6,	// Index 62
+	0x7,	// Index 63
+	0x3,	// Index 64
+	0x8,	// Index 65
+	0x8,	// Index 66
+	0x8,	// Index 67
+	0x8,	// Index 68
+	0x8,	// Index 69
+	0x6,	// Index 70
+	0x8,	// Index 71
+	0x8,	// Index 72
+	0x3,	// Index 73
+	0x5,	// Index 74
+	0x9,	// Index 75
+	0x3,	// Index 76
+	0xB,	// Index 77
+	0x8,	// Index 78
+	0x8,	// Index 79
+	0x8,	// Index 80
+	0x8,	// Index 81
+	0x6,	// Index 82
+	0x7,	// Index 83
+	0x6,	// Index 84
+	0x8,	// Index 85
+	0x9,	// Index 86
+	0xD,	// Index 87
+	0x9,	// Index 88
+	0x9,	// Index 89
+	0x6,	// Index 90
+	0x4,	// Index 91
+	0x2,	// Index 92
+	0x4,	// Index 93
+	0x7,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char ArialBlack10_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0xA, 0x0,	// Index 1
+	0xA, 0x0,	// Index 2
+	0xA, 0x0,	// Index 3
+	0xB, 0x1,	// Index 4
+	0xA, 0x0,	// Index 5
+	0xA, 0x0,	// Index 6
+	0xA, 0x0,	// Index 7
+	0x9, 0x3,	// Index 8
+	0x9, 0x3,	// Index 9
+	0xA, 0x0,	// Index 10
+	0x8, 0x0,	// Index 11
+	0x3, 0x3,	// Index 12
+	0x4, 0x0,	// Index 13
+	0x3, 0x0,	// Index 14
+	0xA, 0x0,	// Index 15
+	0xA, 0x0,	// Index 16
+	0xA, 0x0,	// Index 17
+	0xA, 0x0,	// Index 18
+	0xA, 0x0,	// Index 19
+	0xA, 0x0,	// Index 20
+	0xA, 0x0,	// Index 21
+	0xA, 0x0,	// Index 22
+	0xA, 0x0,	// Index 23
+	0xA, 0x0,	// Index 24
+	0xA, 0x0,	// Index 25
+	0x7, 0x0,	// Index 26
+	0x7, 0x3,	// Index 27
+	0x8, 0x0,	// Index 28
+	0x7, 0x0,	// Index 29
+	0x8, 0x0,	// Index 30
+	0xA, 0x0,	// Index 31
+	0xA, 0x1,	// Index 32
+	0xA, 0x0,	// Index 33
+	0xA, 0x0,	// Index 34
+	0xA, 0x0,	// Index 35
+	0xA, 0x0,	// Index 36
+	0xA, 0x0,	// Index 37
+	0xA, 0x0,	// Index 38
+	0xA, 0x0,	// Index 39
+	0xA, 0x0,	// Index 40
+	0xA, 0x0,	// Index 41
+	0xA, 0x0,	// Index 42
+	0xA, 0x0,	// Index 43
+	0xA, 0x0,	// Index 44
+	0xA, 0x0,	// Index 45
+	0xA, 0x0,	// Index 46
+	0xA, 0x0,	// Index 47
+	0xA, 0x0,	// Index 48
+	0xA, 0x1,	// Index 49
+	0xA, 0x0,	// Index 50
+	0xA, 0x0,	// Index 51
+	0xA, 0x0,	// Index 52
+	0xA, 0x0,	// Index 53
+	0xA, 0x0,	// Index 54
+	0xA, 0x0,	// Index 55
+	0xA, 0x0,	// Index 56
+	0xA, 0x0,	// Index 57
+	0xA, 0x0,	// Index 58
+	0x9, 0x3,	// Index 59
+	0xA, 0x0,	// Index 60
+	0x9, 0x3,	// Index 61
+	0xA, 0x0,	// Index 62
+	0x0, 0x2,	// Index 63
+	0xA, 0x0,	// Index 64
+	0x7, 0x0,	// Index 65
+	0xA, 0x0,	// Index 66
+	0x7, 0x0,	// Index 67
+	0xA, 0x0,	// Index 68
+	0x7, 0x0,	// Index 69
+	0xA, 0x0,	// Index 70
+	0x7, 0x3,	// Index 71
+	0xA, 0x0,	// Index 72
+	0xA, 0x0,	// Index 73
+	0xA, 0x3,	// Index 74
+	0xA, 0x0,	// Index 75
+	0xA, 0x0,	// Index 76
+	0x7, 0x0,	// Index 77
+	0x7, 0x0,	// Index 78
+	0x7, 0x0,	// Index 79
+	0x7, 0x3,	// Index 80
+	0x7, 0x3,	// Index 81
+	0x7, 0x0,	// Index 82
+	0x7, 0x0,	// Index 83
+	0xA, 0x0,	// Index 84
+	0x7, 0x0,	// Index 85
+	0x7, 0x0,	// Index 86
+	0x7, 0x0,	// Index 87
+	0x7, 0x0,	// Index 88
+	0x7, 0x3,	// Index 89
+	0x7, 0x0,	// Index 90
+	0x9, 0x3,	// Index 91
+	0xA, 0x3,	// Index 92
+	0x9, 0x3,	// Index 93
+	0x6, 0x0,	// Index 94
+};
+
+const font_t ArialBlack10 = 
+{
+	ArialBlack10_bitmaps,
+	ArialBlack10_offsets,
+	ArialBlack10_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0xE,	// Height 
+	0,	// Flags 
+	ArialBlack10_extents,
+	0xB	// Ascent 
 };
+
 //---------------------------------------------------------------
 // Group Name: ArialBlack16
 // Designer: Imported System Font
@@ -1235,395 +1864,603 @@ const unsigned char ArialBlack10[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char ArialBlack16[] = 
+const unsigned char ArialBlack16_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x14,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xCD, // Index 1 (offset: 205)
-	0x0, 0xDD, // Index 2 (offset: 221)
-	0x0, 0xFF, // Index 3 (offset: 255)
-	0x1, 0x2A, // Index 4 (offset: 298)
-	0x1, 0x55, // Index 5 (offset: 341)
-	0x1, 0x8F, // Index 6 (offset: 399)
-	0x1, 0xC3, // Index 7 (offset: 451)
-	0x1, 0xD3, // Index 8 (offset: 467)
-	0x1, 0xE6, // Index 9 (offset: 486)
-	0x1, 0xF9, // Index 10 (offset: 505)
-	0x2, 0x12, // Index 11 (offset: 530)
-	0x2, 0x34, // Index 12 (offset: 564)
-	0x2, 0x44, // Index 13 (offset: 580)
-	0x2, 0x5A, // Index 14 (offset: 602)
-	0x2, 0x6A, // Index 15 (offset: 618)
-	0x2, 0x7D, // Index 16 (offset: 637)
-	0x2, 0xA2, // Index 17 (offset: 674)
-	0x2, 0xBE, // Index 18 (offset: 702)
-	0x2, 0xE3, // Index 19 (offset: 739)
-	0x3, 0x8, // Index 20 (offset: 776)
-	0x3, 0x33, // Index 21 (offset: 819)
-	0x3, 0x58, // Index 22 (offset: 856)
-	0x3, 0x7D, // Index 23 (offset: 893)
-	0x3, 0xA2, // Index 24 (offset: 930)
-	0x3, 0xC7, // Index 25 (offset: 967)
-	0x3, 0xEC, // Index 26 (offset: 1004)
-	0x3, 0xFC, // Index 27 (offset: 1020)
-	0x4, 0xC, // Index 28 (offset: 1036)
-	0x4, 0x31, // Index 29 (offset: 1073)
-	0x4, 0x53, // Index 30 (offset: 1107)
-	0x4, 0x78, // Index 31 (offset: 1144)
-	0x4, 0x9D, // Index 32 (offset: 1181)
-	0x4, 0xCE, // Index 33 (offset: 1230)
-	0x5, 0x2, // Index 34 (offset: 1282)
-	0x5, 0x2D, // Index 35 (offset: 1325)
-	0x5, 0x58, // Index 36 (offset: 1368)
-	0x5, 0x83, // Index 37 (offset: 1411)
-	0x5, 0xAB, // Index 38 (offset: 1451)
-	0x5, 0xD0, // Index 39 (offset: 1488)
-	0x6, 0x1, // Index 40 (offset: 1537)
-	0x6, 0x32, // Index 41 (offset: 1586)
-	0x6, 0x42, // Index 42 (offset: 1602)
-	0x6, 0x6A, // Index 43 (offset: 1642)
-	0x6, 0x9E, // Index 44 (offset: 1694)
-	0x6, 0xC3, // Index 45 (offset: 1731)
-	0x6, 0xFA, // Index 46 (offset: 1786)
-	0x7, 0x2B, // Index 47 (offset: 1835)
-	0x7, 0x5C, // Index 48 (offset: 1884)
-	0x7, 0x84, // Index 49 (offset: 1924)
-	0x7, 0xB8, // Index 50 (offset: 1976)
-	0x7, 0xE6, // Index 51 (offset: 2022)
-	0x8, 0xE, // Index 52 (offset: 2062)
-	0x8, 0x3C, // Index 53 (offset: 2108)
-	0x8, 0x6D, // Index 54 (offset: 2157)
-	0x8, 0xA1, // Index 55 (offset: 2209)
-	0x8, 0xE1, // Index 56 (offset: 2273)
-	0x9, 0x15, // Index 57 (offset: 2325)
-	0x9, 0x49, // Index 58 (offset: 2377)
-	0x9, 0x71, // Index 59 (offset: 2417)
-	0x9, 0x87, // Index 60 (offset: 2439)
-	0x9, 0x9A, // Index 61 (offset: 2458)
-	0x9, 0xB0, // Index 62 (offset: 2480)
-	0x9, 0xD5, // Index 63 (offset: 2517)
-	0x9, 0xF7, // Index 64 (offset: 2551)
-	0xA, 0x7, // Index 65 (offset: 2567)
-	0xA, 0x2C, // Index 66 (offset: 2604)
-	0xA, 0x51, // Index 67 (offset: 2641)
-	0xA, 0x76, // Index 68 (offset: 2678)
-	0xA, 0x9B, // Index 69 (offset: 2715)
-	0xA, 0xC0, // Index 70 (offset: 2752)
-	0xA, 0xDF, // Index 71 (offset: 2783)
-	0xB, 0x4, // Index 72 (offset: 2820)
-	0xB, 0x29, // Index 73 (offset: 2857)
-	0xB, 0x39, // Index 74 (offset: 2873)
-	0xB, 0x4F, // Index 75 (offset: 2895)
-	0xB, 0x77, // Index 76 (offset: 2935)
-	0xB, 0x87, // Index 77 (offset: 2951)
-	0xB, 0xC1, // Index 78 (offset: 3009)
-	0xB, 0xE6, // Index 79 (offset: 3046)
-	0xC, 0xB, // Index 80 (offset: 3083)
-	0xC, 0x30, // Index 81 (offset: 3120)
-	0xC, 0x55, // Index 82 (offset: 3157)
-	0xC, 0x6E, // Index 83 (offset: 3182)
-	0xC, 0x90, // Index 84 (offset: 3216)
-	0xC, 0xAC, // Index 85 (offset: 3244)
-	0xC, 0xD1, // Index 86 (offset: 3281)
-	0xC, 0xF9, // Index 87 (offset: 3321)
-	0xD, 0x33, // Index 88 (offset: 3379)
-	0xD, 0x5B, // Index 89 (offset: 3419)
-	0xD, 0x83, // Index 90 (offset: 3459)
-	0xD, 0xA2, // Index 91 (offset: 3490)
-	0xD, 0xBB, // Index 92 (offset: 3515)
-	0xD, 0xC5, // Index 93 (offset: 3525)
-	0xD, 0xDE, // Index 94 (offset: 3550)
-
 	/* Index 0, character 32 " " (width: 3 pixels) */
-	0x3, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 5 pixels) */
-	0x5, 0xFE,0xF8,0x00,0xFE,0xFB,0x00,0xFE,0xFB,0x00,0xFE,0xFB,0x00,0x7E,0xF8,0x00,
+	0xFE,0xF8,0x00,0xFE,0xFB,0x00,0xFE,0xFB,0x00,0xFE,0xFB,0x00,0x7E,0xF8,0x00,
 
 	/* Index 2, character 34 """ (width: 11 pixels) */
-	0xB, 0x3E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00,0x00,
+	0x3E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 14 pixels) */
-	0xE, 0x70,0x1C,0x00,0x70,0xFC,0x00,0x70,0xFF,0x00,0xF0,0xFF,0x00,0xFE,0x3F,0x00,0xFE,0x1D,0x00,0x7E,0x1C,0x00,0x70,0xFC,0x00,0x70,0xFF,0x00,0xF8,0xFF,0x00,0xFE,0x1F,0x00,0xFE,0x1D,0x00,0x7E,0x1C,0x00,0x70,0x1C,0x00,
+	0x70,0x1C,0x00,0x70,0xFC,0x00,0x70,0xFF,0x00,0xF0,0xFF,0x00,0xFE,0x3F,0x00,0xFE,0x1D,0x00,0x7E,0x1C,0x00,0x70,0xFC,0x00,0x70,0xFF,0x00,0xF8,0xFF,0x00,0xFE,0x1F,0x00,0xFE,0x1D,0x00,0x7E,0x1C,0x00,0x70,0x1C,0x00,
 
 	/* Index 4, character 36 "$" (width: 14 pixels) */
-	0xE, 0x00,0x18,0x00,0x78,0x38,0x00,0xFC,0x78,0x00,0xFC,0x79,0x00,0xFE,0xF1,0x00,0xEE,0xE1,0x00,0xCE,0xE3,0x00,0xFF,0xFF,0x03,0x8E,0xE7,0x00,0x8E,0xE7,0x00,0x9E,0xFF,0x00,0x1C,0x7F,0x00,0x1C,0x3F,0x00,0x18,0x1E,0x00,
+	0x00,0x18,0x00,0x78,0x38,0x00,0xFC,0x78,0x00,0xFC,0x79,0x00,0xFE,0xF1,0x00,0xEE,0xE1,0x00,0xCE,0xE3,0x00,0xFF,0xFF,0x03,0x8E,0xE7,0x00,0x8E,0xE7,0x00,0x9E,0xFF,0x00,0x1C,0x7F,0x00,0x1C,0x3F,0x00,0x18,0x1E,0x00,
 
 	/* Index 5, character 37 "%" (width: 19 pixels) */
-	0x13, 0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0x86,0x01,0x00,0x86,0x81,0x00,0xFE,0xE1,0x00,0xFC,0x70,0x00,0x78,0x3C,0x00,0x00,0x0F,0x00,0x80,0x03,0x00,0xE0,0x01,0x00,0x78,0x3C,0x00,0x1C,0x7E,0x00,0x0E,0xFF,0x00,0x02,0xC3,0x00,0x00,0xC3,0x00,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,
+	0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0x86,0x01,0x00,0x86,0x81,0x00,0xFE,0xE1,0x00,0xFC,0x70,0x00,0x78,0x3C,0x00,0x00,0x0F,0x00,0x80,0x03,0x00,0xE0,0x01,0x00,0x78,0x3C,0x00,0x1C,0x7E,0x00,0x0E,0xFF,0x00,0x02,0xC3,0x00,0x00,0xC3,0x00,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,
 
 	/* Index 6, character 38 "&" (width: 17 pixels) */
-	0x11, 0x00,0x3C,0x00,0x00,0x7E,0x00,0x78,0x7E,0x00,0xFC,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xF3,0x00,0xCE,0xE3,0x00,0x8E,0xE7,0x00,0xCE,0xEF,0x00,0xFE,0xFE,0x00,0xFE,0x7E,0x00,0x7C,0x3C,0x00,0x38,0x7E,0x00,0x00,0x7E,0x00,0x00,0xFE,0x00,0x00,0x74,0x00,0x00,0x20,0x00,
+	0x00,0x3C,0x00,0x00,0x7E,0x00,0x78,0x7E,0x00,0xFC,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xF3,0x00,0xCE,0xE3,0x00,0x8E,0xE7,0x00,0xCE,0xEF,0x00,0xFE,0xFE,0x00,0xFE,0x7E,0x00,0x7C,0x3C,0x00,0x38,0x7E,0x00,0x00,0x7E,0x00,0x00,0xFE,0x00,0x00,0x74,0x00,0x00,0x20,0x00,
 
 	/* Index 7, character 39 "'" (width: 5 pixels) */
-	0x5, 0x3E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00,0x00,
+	0x3E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 6 pixels) */
-	0x6, 0xC0,0x3F,0x00,0xF0,0xFF,0x01,0xFC,0xFF,0x07,0xFE,0xFF,0x0F,0x3E,0x80,0x0F,0x02,0x00,0x08,
+	0xC0,0x3F,0x00,0xF0,0xFF,0x01,0xFC,0xFF,0x07,0xFE,0xFF,0x0F,0x3E,0x80,0x0F,0x02,0x00,0x08,
 
 	/* Index 9, character 41 ")" (width: 6 pixels) */
-	0x6, 0x02,0x00,0x08,0x3E,0x80,0x0F,0xFE,0xFF,0x0F,0xFC,0xFF,0x07,0xF0,0xFF,0x01,0xC0,0x3F,0x00,
+	0x02,0x00,0x08,0x3E,0x80,0x0F,0xFE,0xFF,0x0F,0xFC,0xFF,0x07,0xF0,0xFF,0x01,0xC0,0x3F,0x00,
 
 	/* Index 10, character 42 "*" (width: 8 pixels) */
-	0x8, 0x10,0x00,0x00,0x98,0x00,0x00,0xD0,0x01,0x00,0xFE,0x00,0x00,0xFE,0x00,0x00,0xD0,0x01,0x00,0x98,0x00,0x00,0x10,0x00,0x00,
+	0x10,0x00,0x00,0x98,0x00,0x00,0xD0,0x01,0x00,0xFE,0x00,0x00,0xFE,0x00,0x00,0xD0,0x01,0x00,0x98,0x00,0x00,0x10,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 11 pixels) */
-	0xB, 0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,
+	0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,
 
 	/* Index 12, character 44 "," (width: 5 pixels) */
-	0x5, 0x00,0xF8,0x04,0x00,0xF8,0x0E,0x00,0xF8,0x07,0x00,0xF8,0x07,0x00,0xF8,0x01,
+	0x00,0xF8,0x04,0x00,0xF8,0x0E,0x00,0xF8,0x07,0x00,0xF8,0x07,0x00,0xF8,0x01,
 
 	/* Index 13, character 45 "-" (width: 7 pixels) */
-	0x7, 0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,
+	0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,
 
 	/* Index 14, character 46 "." (width: 5 pixels) */
-	0x5, 0x00,0xF8,0x00,0x00,0xF8,0x00,0x00,0xF8,0x00,0x00,0xF8,0x00,0x00,0xF8,0x00,
+	0x00,0xF8,0x00,0x00,0xF8,0x00,0x00,0xF8,0x00,0x00,0xF8,0x00,0x00,0xF8,0x00,
 
 	/* Index 15, character 47 "/" (width: 6 pixels) */
-	0x6, 0x00,0xC0,0x00,0x00,0xFC,0x00,0x80,0x3F,0x00,0xF8,0x03,0x00,0x7E,0x00,0x00,0x06,0x00,0x00,
+	0x00,0xC0,0x00,0x00,0xFC,0x00,0x80,0x3F,0x00,0xF8,0x03,0x00,0x7E,0x00,0x00,0x06,0x00,0x00,
 
 	/* Index 16, character 48 "0" (width: 12 pixels) */
-	0xC, 0xE0,0x0F,0x00,0xF8,0x3F,0x00,0xFC,0x7F,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFC,0x7F,0x00,0xF8,0x3F,0x00,0xE0,0x0F,0x00,
+	0xE0,0x0F,0x00,0xF8,0x3F,0x00,0xFC,0x7F,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFC,0x7F,0x00,0xF8,0x3F,0x00,0xE0,0x0F,0x00,
 
 	/* Index 17, character 49 "1" (width: 9 pixels) */
-	0x9, 0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0xFC,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,
+	0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0xFC,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,
 
 	/* Index 18, character 50 "2" (width: 12 pixels) */
-	0xC, 0x30,0xC0,0x00,0x3C,0xF0,0x00,0x3C,0xF8,0x00,0x3E,0xFC,0x00,0x3E,0xFC,0x00,0x0E,0xFE,0x00,0x0E,0xEF,0x00,0xFE,0xEF,0x00,0xFE,0xE7,0x00,0xFC,0xE3,0x00,0xFC,0xE1,0x00,0xF8,0xE0,0x00,
+	0x30,0xC0,0x00,0x3C,0xF0,0x00,0x3C,0xF8,0x00,0x3E,0xFC,0x00,0x3E,0xFC,0x00,0x0E,0xFE,0x00,0x0E,0xEF,0x00,0xFE,0xEF,0x00,0xFE,0xE7,0x00,0xFC,0xE3,0x00,0xFC,0xE1,0x00,0xF8,0xE0,0x00,
 
 	/* Index 19, character 51 "3" (width: 12 pixels) */
-	0xC, 0x10,0x18,0x00,0x38,0x38,0x00,0x3C,0x78,0x00,0x3E,0xF8,0x00,0x3E,0xF8,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFC,0x7F,0x00,0x7C,0x7E,0x00,0x38,0x1C,0x00,
+	0x10,0x18,0x00,0x38,0x38,0x00,0x3C,0x78,0x00,0x3E,0xF8,0x00,0x3E,0xF8,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFC,0x7F,0x00,0x7C,0x7E,0x00,0x38,0x1C,0x00,
 
 	/* Index 20, character 52 "4" (width: 14 pixels) */
-	0xE, 0x00,0x1E,0x00,0x00,0x1F,0x00,0x80,0x1F,0x00,0xE0,0x1D,0x00,0xF0,0x1C,0x00,0x78,0x1C,0x00,0x1C,0x1C,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,
+	0x00,0x1E,0x00,0x00,0x1F,0x00,0x80,0x1F,0x00,0xE0,0x1D,0x00,0xF0,0x1C,0x00,0x78,0x1C,0x00,0x1C,0x1C,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,
 
 	/* Index 21, character 53 "5" (width: 12 pixels) */
-	0xC, 0x00,0x18,0x00,0xE0,0x39,0x00,0xFE,0x7B,0x00,0xFE,0xFB,0x00,0xFE,0xFB,0x00,0x8E,0xE1,0x00,0xCE,0xE1,0x00,0xCE,0xFF,0x00,0xCE,0xFF,0x00,0xCE,0x7F,0x00,0x8E,0x3F,0x00,0x00,0x1F,0x00,
+	0x00,0x18,0x00,0xE0,0x39,0x00,0xFE,0x7B,0x00,0xFE,0xFB,0x00,0xFE,0xFB,0x00,0x8E,0xE1,0x00,0xCE,0xE1,0x00,0xCE,0xFF,0x00,0xCE,0xFF,0x00,0xCE,0x7F,0x00,0x8E,0x3F,0x00,0x00,0x1F,0x00,
 
 	/* Index 22, character 54 "6" (width: 12 pixels) */
-	0xC, 0xE0,0x0F,0x00,0xF8,0x3F,0x00,0xFC,0x7F,0x00,0xFC,0xFF,0x00,0xFE,0xFF,0x00,0x9E,0xE1,0x00,0xCE,0xE1,0x00,0xCE,0xFF,0x00,0xDE,0xFF,0x00,0xDC,0x7F,0x00,0x9C,0x7F,0x00,0x18,0x1F,0x00,
+	0xE0,0x0F,0x00,0xF8,0x3F,0x00,0xFC,0x7F,0x00,0xFC,0xFF,0x00,0xFE,0xFF,0x00,0x9E,0xE1,0x00,0xCE,0xE1,0x00,0xCE,0xFF,0x00,0xDE,0xFF,0x00,0xDC,0x7F,0x00,0x9C,0x7F,0x00,0x18,0x1F,0x00,
 
 	/* Index 23, character 55 "7" (width: 12 pixels) */
-	0xC, 0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0xE0,0x00,0x0E,0xFC,0x00,0x0E,0xFF,0x00,0x8E,0xFF,0x00,0xEE,0xFF,0x00,0xFE,0x0F,0x00,0xFE,0x00,0x00,0x3E,0x00,0x00,0x0E,0x00,0x00,
+	0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0xE0,0x00,0x0E,0xFC,0x00,0x0E,0xFF,0x00,0x8E,0xFF,0x00,0xEE,0xFF,0x00,0xFE,0x0F,0x00,0xFE,0x00,0x00,0x3E,0x00,0x00,0x0E,0x00,0x00,
 
 	/* Index 24, character 56 "8" (width: 12 pixels) */
-	0xC, 0x78,0x3C,0x00,0xFC,0x7E,0x00,0xFC,0x7E,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFC,0x7E,0x00,0xFC,0x7E,0x00,0x78,0x3C,0x00,
+	0x78,0x3C,0x00,0xFC,0x7E,0x00,0xFC,0x7E,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFC,0x7E,0x00,0xFC,0x7E,0x00,0x78,0x3C,0x00,
 
 	/* Index 25, character 57 "9" (width: 12 pixels) */
-	0xC, 0xF0,0x31,0x00,0xFC,0x73,0x00,0xFC,0x77,0x00,0xFE,0xF7,0x00,0xFE,0xE7,0x00,0x0E,0xE7,0x00,0x0E,0xF3,0x00,0xFE,0xFF,0x00,0xFE,0x7F,0x00,0xFC,0x7F,0x00,0xF8,0x3F,0x00,0xE0,0x0F,0x00,
+	0xF0,0x31,0x00,0xFC,0x73,0x00,0xFC,0x77,0x00,0xFE,0xF7,0x00,0xFE,0xE7,0x00,0x0E,0xE7,0x00,0x0E,0xF3,0x00,0xFE,0xFF,0x00,0xFE,0x7F,0x00,0xFC,0x7F,0x00,0xF8,0x3F,0x00,0xE0,0x0F,0x00,
 
 	/* Index 26, character 58 ":" (width: 5 pixels) */
-	0x5, 0xE0,0xFB,0x00,0xE0,0xFB,0x00,0xE0,0xFB,0x00,0xE0,0xFB,0x00,0xE0,0xFB,0x00,
+	0xE0,0xFB,0x00,0xE0,0xFB,0x00,0xE0,0xFB,0x00,0xE0,0xFB,0x00,0xE0,0xFB,0x00,
 
 	/* Index 27, character 59 ";" (width: 5 pixels) */
-	0x5, 0xE0,0xFB,0x04,0xE0,0xFB,0x0E,0xE0,0xFB,0x07,0xE0,0xFB,0x07,0xE0,0xFB,0x01,
+	0xE0,0xFB,0x04,0xE0,0xFB,0x0E,0xE0,0xFB,0x07,0xE0,0xFB,0x07,0xE0,0xFB,0x01,
 
 	/* Index 28, character 60 "<" (width: 12 pixels) */
-	0xC, 0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x07,0x00,0xC0,0x07,0x00,0xE0,0x0F,0x00,0xE0,0x0E,0x00,0xF0,0x1E,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x38,0x38,0x00,0x38,0x38,0x00,0x1C,0x70,0x00,
+	0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x07,0x00,0xC0,0x07,0x00,0xE0,0x0F,0x00,0xE0,0x0E,0x00,0xF0,0x1E,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x38,0x38,0x00,0x38,0x38,0x00,0x1C,0x70,0x00,
 
 	/* Index 29, character 61 "=" (width: 11 pixels) */
-	0xB, 0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,
+	0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x00,
 
 	/* Index 30, character 62 ">" (width: 12 pixels) */
-	0xC, 0x1C,0x70,0x00,0x38,0x38,0x00,0x38,0x38,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0xF0,0x1E,0x00,0xE0,0x0E,0x00,0xE0,0x0F,0x00,0xC0,0x07,0x00,0xC0,0x07,0x00,0x80,0x03,0x00,0x80,0x03,0x00,
+	0x1C,0x70,0x00,0x38,0x38,0x00,0x38,0x38,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0xF0,0x1E,0x00,0xE0,0x0E,0x00,0xE0,0x0F,0x00,0xC0,0x07,0x00,0xC0,0x07,0x00,0x80,0x03,0x00,0x80,0x03,0x00,
 
 	/* Index 31, character 63 "?" (width: 12 pixels) */
-	0xC, 0x30,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3E,0xF6,0x00,0x1E,0xF7,0x00,0x8E,0xF7,0x00,0xCE,0xF7,0x00,0xFE,0xF7,0x00,0xFE,0x01,0x00,0xFC,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,
+	0x30,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3E,0xF6,0x00,0x1E,0xF7,0x00,0x8E,0xF7,0x00,0xCE,0xF7,0x00,0xFE,0xF7,0x00,0xFE,0x01,0x00,0xFC,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 16 pixels) */
-	0x10, 0x80,0x1F,0x00,0xE0,0x7F,0x00,0x78,0xE0,0x01,0x18,0x9F,0x01,0x8C,0x3F,0x03,0xCE,0x7F,0x07,0xE6,0x60,0x06,0x66,0x60,0x06,0x66,0x30,0x06,0xC6,0x7F,0x06,0xE6,0x7F,0x06,0xEE,0x7F,0x03,0xEC,0x21,0x03,0x38,0xB8,0x01,0xF0,0x9F,0x01,0xE0,0x87,0x00,
+	0x80,0x1F,0x00,0xE0,0x7F,0x00,0x78,0xE0,0x01,0x18,0x9F,0x01,0x8C,0x3F,0x03,0xCE,0x7F,0x07,0xE6,0x60,0x06,0x66,0x60,0x06,0x66,0x30,0x06,0xC6,0x7F,0x06,0xE6,0x7F,0x06,0xEE,0x7F,0x03,0xEC,0x21,0x03,0x38,0xB8,0x01,0xF0,0x9F,0x01,0xE0,0x87,0x00,
 
 	/* Index 33, character 65 "A" (width: 17 pixels) */
-	0x11, 0x00,0x80,0x00,0x00,0xF0,0x00,0x00,0xFE,0x00,0xC0,0xFF,0x00,0xF8,0xFF,0x00,0xFE,0x7F,0x00,0xFE,0x3F,0x00,0xFE,0x3C,0x00,0x1E,0x3C,0x00,0xFE,0x3C,0x00,0xFE,0x3F,0x00,0xFE,0x7F,0x00,0xF8,0xFF,0x00,0xC0,0xFF,0x00,0x00,0xFE,0x00,0x00,0xF0,0x00,0x00,0x80,0x00,
+	0x00,0x80,0x00,0x00,0xF0,0x00,0x00,0xFE,0x00,0xC0,0xFF,0x00,0xF8,0xFF,0x00,0xFE,0x7F,0x00,0xFE,0x3F,0x00,0xFE,0x3C,0x00,0x1E,0x3C,0x00,0xFE,0x3C,0x00,0xFE,0x3F,0x00,0xFE,0x7F,0x00,0xF8,0xFF,0x00,0xC0,0xFF,0x00,0x00,0xFE,0x00,0x00,0xF0,0x00,0x00,0x80,0x00,
 
 	/* Index 34, character 66 "B" (width: 14 pixels) */
-	0xE, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0xFE,0xE3,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFC,0xFE,0x00,0x78,0x7E,0x00,0x00,0x3C,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0xFE,0xE3,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFC,0xFE,0x00,0x78,0x7E,0x00,0x00,0x3C,0x00,
 
 	/* Index 35, character 67 "C" (width: 14 pixels) */
-	0xE, 0xE0,0x0F,0x00,0xF8,0x3F,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0xFE,0xFF,0x00,0x1E,0xF0,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0x1E,0xF0,0x00,0x7E,0xFC,0x00,0x7C,0xFC,0x00,0x3C,0x78,0x00,0x38,0x38,0x00,0x30,0x18,0x00,
+	0xE0,0x0F,0x00,0xF8,0x3F,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0xFE,0xFF,0x00,0x1E,0xF0,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0x1E,0xF0,0x00,0x7E,0xFC,0x00,0x7C,0xFC,0x00,0x3C,0x78,0x00,0x38,0x38,0x00,0x30,0x18,0x00,
 
 	/* Index 36, character 68 "D" (width: 14 pixels) */
-	0xE, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0x1E,0xF0,0x00,0xFE,0xFF,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0xF8,0x3F,0x00,0xE0,0x0F,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0x1E,0xF0,0x00,0xFE,0xFF,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0xF8,0x3F,0x00,0xE0,0x0F,0x00,
 
 	/* Index 37, character 69 "E" (width: 13 pixels) */
-	0xD, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0x0E,0xE0,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0x8E,0xE3,0x00,0x0E,0xE0,0x00,
 
 	/* Index 38, character 70 "F" (width: 12 pixels) */
-	0xC, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x0E,0x00,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x0E,0x00,0x00,
 
 	/* Index 39, character 71 "G" (width: 16 pixels) */
-	0x10, 0xC0,0x07,0x00,0xF0,0x1F,0x00,0xF8,0x3F,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0x3E,0xF8,0x00,0x1E,0xE0,0x00,0x0E,0xE0,0x00,0x0E,0xE7,0x00,0x0E,0xE7,0x00,0x1E,0xF7,0x00,0x3E,0xFF,0x00,0x3E,0x7F,0x00,0x3C,0x7F,0x00,0x18,0x7F,0x00,0x10,0x3F,0x00,
+	0xC0,0x07,0x00,0xF0,0x1F,0x00,0xF8,0x3F,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0x3E,0xF8,0x00,0x1E,0xE0,0x00,0x0E,0xE0,0x00,0x0E,0xE7,0x00,0x0E,0xE7,0x00,0x1E,0xF7,0x00,0x3E,0xFF,0x00,0x3E,0x7F,0x00,0x3C,0x7F,0x00,0x18,0x7F,0x00,0x10,0x3F,0x00,
 
 	/* Index 40, character 72 "H" (width: 16 pixels) */
-	0x10, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,
 
 	/* Index 41, character 73 "I" (width: 5 pixels) */
-	0x5, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,
 
 	/* Index 42, character 74 "J" (width: 13 pixels) */
-	0xD, 0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x7C,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xF0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0x7F,0x00,0xFE,0x3F,0x00,0xFE,0x1F,0x00,
+	0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x7C,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xF0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0x7F,0x00,0xFE,0x3F,0x00,0xFE,0x1F,0x00,
 
 	/* Index 43, character 75 "K" (width: 17 pixels) */
-	0x11, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x80,0x1F,0x00,0xC0,0x0F,0x00,0xE0,0x07,0x00,0xF0,0x07,0x00,0xF8,0x0F,0x00,0xFC,0x3F,0x00,0xFE,0xFF,0x00,0x3E,0xFF,0x00,0x1E,0xFC,0x00,0x0E,0xF0,0x00,0x06,0xE0,0x00,0x02,0x80,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x80,0x1F,0x00,0xC0,0x0F,0x00,0xE0,0x07,0x00,0xF0,0x07,0x00,0xF8,0x0F,0x00,0xFC,0x3F,0x00,0xFE,0xFF,0x00,0x3E,0xFF,0x00,0x1E,0xFC,0x00,0x0E,0xF0,0x00,0x06,0xE0,0x00,0x02,0x80,0x00,
 
 	/* Index 44, character 76 "L" (width: 12 pixels) */
-	0xC, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,
 
 	/* Index 45, character 77 "M" (width: 18 pixels) */
-	0x12, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x3E,0x00,0x00,0xFE,0x01,0x00,0xF8,0x0F,0x00,0x80,0x3F,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x80,0x7F,0x00,0xF8,0x0F,0x00,0xFE,0x01,0x00,0x3E,0x00,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x3E,0x00,0x00,0xFE,0x01,0x00,0xF8,0x0F,0x00,0x80,0x3F,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x80,0x7F,0x00,0xF8,0x0F,0x00,0xFE,0x01,0x00,0x3E,0x00,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,
 
 	/* Index 46, character 78 "N" (width: 16 pixels) */
-	0x10, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x7C,0x00,0x00,0xF8,0x00,0x00,0xF0,0x01,0x00,0xE0,0x07,0x00,0xC0,0x0F,0x00,0x00,0x1F,0x00,0x00,0x3E,0x00,0x00,0x7C,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x7C,0x00,0x00,0xF8,0x00,0x00,0xF0,0x01,0x00,0xE0,0x07,0x00,0xC0,0x0F,0x00,0x00,0x1F,0x00,0x00,0x3E,0x00,0x00,0x7C,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,
 
 	/* Index 47, character 79 "O" (width: 16 pixels) */
-	0x10, 0xE0,0x0F,0x00,0xF0,0x1F,0x00,0xF8,0x3F,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0x3E,0xF8,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0x3E,0xF8,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0xF8,0x3F,0x00,0xF0,0x1F,0x00,0xE0,0x0F,0x00,
+	0xE0,0x0F,0x00,0xF0,0x1F,0x00,0xF8,0x3F,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0x3E,0xF8,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0x3E,0xF8,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0xF8,0x3F,0x00,0xF0,0x1F,0x00,0xE0,0x0F,0x00,
 
 	/* Index 48, character 80 "P" (width: 13 pixels) */
-	0xD, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0xFE,0x03,0x00,0xFE,0x03,0x00,0xFE,0x01,0x00,0xFC,0x01,0x00,0xF8,0x00,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0xFE,0x03,0x00,0xFE,0x03,0x00,0xFE,0x01,0x00,0xFC,0x01,0x00,0xF8,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 17 pixels) */
-	0x11, 0xE0,0x0F,0x00,0xF0,0x1F,0x00,0xF8,0x3F,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0x3E,0xF8,0x00,0x0E,0xE0,0x00,0x0E,0xE8,0x00,0x0E,0xEC,0x00,0x0E,0xF8,0x00,0x3E,0xF0,0x00,0xFC,0x7F,0x00,0xFC,0xFF,0x00,0xF8,0xFF,0x00,0xF0,0xFF,0x01,0xE0,0xCF,0x01,0x00,0x80,0x00,
+	0xE0,0x0F,0x00,0xF0,0x1F,0x00,0xF8,0x3F,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0x3E,0xF8,0x00,0x0E,0xE0,0x00,0x0E,0xE8,0x00,0x0E,0xEC,0x00,0x0E,0xF8,0x00,0x3E,0xF0,0x00,0xFC,0x7F,0x00,0xFC,0xFF,0x00,0xF8,0xFF,0x00,0xF0,0xFF,0x01,0xE0,0xCF,0x01,0x00,0x80,0x00,
 
 	/* Index 50, character 82 "R" (width: 15 pixels) */
-	0xF, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x8E,0x0F,0x00,0x8E,0x3F,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFD,0x00,0xFC,0xF8,0x00,0x78,0xE0,0x00,0x00,0x80,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x8E,0x03,0x00,0x8E,0x03,0x00,0x8E,0x0F,0x00,0x8E,0x3F,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFD,0x00,0xFC,0xF8,0x00,0x78,0xE0,0x00,0x00,0x80,0x00,
 
 	/* Index 51, character 83 "S" (width: 13 pixels) */
-	0xD, 0x78,0x18,0x00,0xFC,0x78,0x00,0xFC,0x79,0x00,0xFE,0xF9,0x00,0xFE,0xFB,0x00,0xCE,0xF3,0x00,0xCE,0xE3,0x00,0x8E,0xE7,0x00,0x9E,0xFF,0x00,0x9E,0xFF,0x00,0x1C,0x7F,0x00,0x1C,0x7F,0x00,0x18,0x1E,0x00,
+	0x78,0x18,0x00,0xFC,0x78,0x00,0xFC,0x79,0x00,0xFE,0xF9,0x00,0xFE,0xFB,0x00,0xCE,0xF3,0x00,0xCE,0xE3,0x00,0x8E,0xE7,0x00,0x9E,0xFF,0x00,0x9E,0xFF,0x00,0x1C,0x7F,0x00,0x1C,0x7F,0x00,0x18,0x1E,0x00,
 
 	/* Index 52, character 84 "T" (width: 15 pixels) */
-	0xF, 0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,
+	0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,
 
 	/* Index 53, character 85 "U" (width: 16 pixels) */
-	0x10, 0xFE,0x0F,0x00,0xFE,0x3F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0xFF,0x00,0x00,0xF0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xF0,0x00,0xFE,0xFF,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x3F,0x00,0xFE,0x0F,0x00,
+	0xFE,0x0F,0x00,0xFE,0x3F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0xFF,0x00,0x00,0xF0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xF0,0x00,0xFE,0xFF,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xFE,0x3F,0x00,0xFE,0x0F,0x00,
 
 	/* Index 54, character 86 "V" (width: 17 pixels) */
-	0x11, 0x02,0x00,0x00,0x1E,0x00,0x00,0x7E,0x00,0x00,0xFE,0x03,0x00,0xFE,0x1F,0x00,0xFC,0x7F,0x00,0xE0,0xFF,0x00,0x00,0xFF,0x00,0x00,0xF0,0x00,0x00,0xFF,0x00,0xE0,0xFF,0x00,0xFC,0x7F,0x00,0xFE,0x0F,0x00,0xFE,0x03,0x00,0x7E,0x00,0x00,0x1E,0x00,0x00,0x02,0x00,0x00,
+	0x02,0x00,0x00,0x1E,0x00,0x00,0x7E,0x00,0x00,0xFE,0x03,0x00,0xFE,0x1F,0x00,0xFC,0x7F,0x00,0xE0,0xFF,0x00,0x00,0xFF,0x00,0x00,0xF0,0x00,0x00,0xFF,0x00,0xE0,0xFF,0x00,0xFC,0x7F,0x00,0xFE,0x0F,0x00,0xFE,0x03,0x00,0x7E,0x00,0x00,0x1E,0x00,0x00,0x02,0x00,0x00,
 
 	/* Index 55, character 87 "W" (width: 21 pixels) */
-	0x15, 0x06,0x00,0x00,0xFE,0x00,0x00,0xFE,0x0F,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xF8,0xFF,0x00,0x00,0xFF,0x00,0xF8,0xFF,0x00,0xFE,0x3F,0x00,0xFE,0x03,0x00,0x7E,0x00,0x00,0xFE,0x03,0x00,0xFE,0x3F,0x00,0xF8,0xFF,0x00,0x00,0xFF,0x00,0xF8,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0x0F,0x00,0xFE,0x00,0x00,0x06,0x00,0x00,
+	0x06,0x00,0x00,0xFE,0x00,0x00,0xFE,0x0F,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xF8,0xFF,0x00,0x00,0xFF,0x00,0xF8,0xFF,0x00,0xFE,0x3F,0x00,0xFE,0x03,0x00,0x7E,0x00,0x00,0xFE,0x03,0x00,0xFE,0x3F,0x00,0xF8,0xFF,0x00,0x00,0xFF,0x00,0xF8,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0x0F,0x00,0xFE,0x00,0x00,0x06,0x00,0x00,
 
 	/* Index 56, character 88 "X" (width: 17 pixels) */
-	0x11, 0x02,0x80,0x00,0x06,0xC0,0x00,0x0E,0xF0,0x00,0x3E,0xF8,0x00,0x7E,0xFE,0x00,0xFC,0x7F,0x00,0xF8,0x3F,0x00,0xF0,0x1F,0x00,0xE0,0x07,0x00,0xF0,0x1F,0x00,0xF8,0x3F,0x00,0xFC,0x7F,0x00,0x7E,0xFE,0x00,0x3E,0xF8,0x00,0x1E,0xF0,0x00,0x06,0xC0,0x00,0x02,0x80,0x00,
+	0x02,0x80,0x00,0x06,0xC0,0x00,0x0E,0xF0,0x00,0x3E,0xF8,0x00,0x7E,0xFE,0x00,0xFC,0x7F,0x00,0xF8,0x3F,0x00,0xF0,0x1F,0x00,0xE0,0x07,0x00,0xF0,0x1F,0x00,0xF8,0x3F,0x00,0xFC,0x7F,0x00,0x7E,0xFE,0x00,0x3E,0xF8,0x00,0x1E,0xF0,0x00,0x06,0xC0,0x00,0x02,0x80,0x00,
 
 	/* Index 57, character 89 "Y" (width: 17 pixels) */
-	0x11, 0x02,0x00,0x00,0x06,0x00,0x00,0x1E,0x00,0x00,0x3E,0x00,0x00,0xFE,0x00,0x00,0xFE,0x01,0x00,0xFC,0xFF,0x00,0xF8,0xFF,0x00,0xE0,0xFF,0x00,0xF8,0xFF,0x00,0xFC,0xFF,0x00,0xFE,0x01,0x00,0xFE,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,
+	0x02,0x00,0x00,0x06,0x00,0x00,0x1E,0x00,0x00,0x3E,0x00,0x00,0xFE,0x00,0x00,0xFE,0x01,0x00,0xFC,0xFF,0x00,0xF8,0xFF,0x00,0xE0,0xFF,0x00,0xF8,0xFF,0x00,0xFC,0xFF,0x00,0xFE,0x01,0x00,0xFE,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,
 
 	/* Index 58, character 90 "Z" (width: 13 pixels) */
-	0xD, 0x00,0xE0,0x00,0x0E,0xF8,0x00,0x0E,0xFC,0x00,0x0E,0xFE,0x00,0x0E,0xFF,0x00,0x8E,0xEF,0x00,0xCE,0xE7,0x00,0xFE,0xE3,0x00,0xFE,0xE1,0x00,0xFE,0xE0,0x00,0x7E,0xE0,0x00,0x3E,0xE0,0x00,0x0E,0xE0,0x00,
+	0x00,0xE0,0x00,0x0E,0xF8,0x00,0x0E,0xFC,0x00,0x0E,0xFE,0x00,0x0E,0xFF,0x00,0x8E,0xEF,0x00,0xCE,0xE7,0x00,0xFE,0xE3,0x00,0xFE,0xE1,0x00,0xFE,0xE0,0x00,0x7E,0xE0,0x00,0x3E,0xE0,0x00,0x0E,0xE0,0x00,
 
 	/* Index 59, character 91 "[" (width: 7 pixels) */
-	0x7, 0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0x0E,0x00,0x0E,0x0E,0x00,0x0E,
+	0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0x0E,0x00,0x0E,0x0E,0x00,0x0E,
 
 	/* Index 60, character 92 "\" (width: 6 pixels) */
-	0x6, 0x06,0x00,0x00,0x7E,0x00,0x00,0xF8,0x03,0x00,0x80,0x3F,0x00,0x00,0xFC,0x00,0x00,0xC0,0x00,
+	0x06,0x00,0x00,0x7E,0x00,0x00,0xF8,0x03,0x00,0x80,0x3F,0x00,0x00,0xFC,0x00,0x00,0xC0,0x00,
 
 	/* Index 61, character 93 "]" (width: 7 pixels) */
-	0x7, 0x0E,0x00,0x0E,0x0E,0x00,0x0E,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,
+	0x0E,0x00,0x0E,0x0E,0x00,0x0E,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,
 
 	/* Index 62, character 94 "^" (width: 12 pixels) */
-	0xC, 0x00,0x01,0x00,0xC0,0x01,0x00,0xE0,0x01,0x00,0xF8,0x01,0x00,0xFE,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0xFE,0x00,0x00,0xF8,0x01,0x00,0xE0,0x01,0x00,0xC0,0x01,0x00,0x00,0x01,0x00,
+	0x00,0x01,0x00,0xC0,0x01,0x00,0xE0,0x01,0x00,0xF8,0x01,0x00,0xFE,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0xFE,0x00,0x00,0xF8,0x01,0x00,0xE0,0x01,0x00,0xC0,0x01,0x00,0x00,0x01,0x00,
 
 	/* Index 63, character 95 "_" (width: 11 pixels) */
-	0xB, 0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,
+	0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,
 
 	/* Index 64, character 96 "`" (width: 5 pixels) */
-	0x5, 0x02,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x08,0x00,0x00,
+	0x02,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x08,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 12 pixels) */
-	0xC, 0x80,0x31,0x00,0xC0,0x79,0x00,0xC0,0xFD,0x00,0xE0,0xFD,0x00,0xE0,0xFD,0x00,0xE0,0xEC,0x00,0xE0,0x66,0x00,0xE0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x00,0x80,0xFF,0x00,
+	0x80,0x31,0x00,0xC0,0x79,0x00,0xC0,0xFD,0x00,0xE0,0xFD,0x00,0xE0,0xFD,0x00,0xE0,0xEC,0x00,0xE0,0x66,0x00,0xE0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x00,0x80,0xFF,0x00,
 
 	/* Index 66, character 98 "b" (width: 12 pixels) */
-	0xC, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xC0,0x60,0x00,0xE0,0xE0,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0x7F,0x00,0x80,0x1F,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xC0,0x60,0x00,0xE0,0xE0,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0x7F,0x00,0x80,0x1F,0x00,
 
 	/* Index 67, character 99 "c" (width: 12 pixels) */
-	0xC, 0x00,0x1F,0x00,0x80,0x3F,0x00,0xC0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xE0,0x00,0xE0,0xE0,0x00,0xE0,0xF9,0x00,0xE0,0xF9,0x00,0xC0,0x79,0x00,0xC0,0x71,0x00,0x00,0x11,0x00,
+	0x00,0x1F,0x00,0x80,0x3F,0x00,0xC0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xE0,0x00,0xE0,0xE0,0x00,0xE0,0xF9,0x00,0xE0,0xF9,0x00,0xC0,0x79,0x00,0xC0,0x71,0x00,0x00,0x11,0x00,
 
 	/* Index 68, character 100 "d" (width: 12 pixels) */
-	0xC, 0x00,0x1F,0x00,0xC0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xE0,0x00,0xC0,0x60,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,
+	0x00,0x1F,0x00,0xC0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xE0,0x00,0xC0,0x60,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,
 
 	/* Index 69, character 101 "e" (width: 12 pixels) */
-	0xC, 0x00,0x1F,0x00,0x80,0x3F,0x00,0xC0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xE6,0x00,0xE0,0xE6,0x00,0xE0,0xF7,0x00,0xE0,0xF7,0x00,0xC0,0x77,0x00,0xC0,0x37,0x00,0x00,0x17,0x00,
+	0x00,0x1F,0x00,0x80,0x3F,0x00,0xC0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xE6,0x00,0xE0,0xE6,0x00,0xE0,0xF7,0x00,0xE0,0xF7,0x00,0xC0,0x77,0x00,0xC0,0x37,0x00,0x00,0x17,0x00,
 
 	/* Index 70, character 102 "f" (width: 10 pixels) */
-	0xA, 0xE0,0x00,0x00,0xE0,0x00,0x00,0xFC,0xFF,0x00,0xFC,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xEE,0x00,0x00,0xEE,0x00,0x00,0x0E,0x00,0x00,
+	0xE0,0x00,0x00,0xE0,0x00,0x00,0xFC,0xFF,0x00,0xFC,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xEE,0x00,0x00,0xEE,0x00,0x00,0x0E,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 12 pixels) */
-	0xC, 0x80,0x1F,0x06,0xC0,0x7F,0x06,0xE0,0xFF,0x0E,0xE0,0xFF,0x0E,0xE0,0xFF,0x0E,0xE0,0xE0,0x0E,0xC0,0x60,0x0E,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xE0,0xFF,0x07,0xE0,0xFF,0x07,0xE0,0xFF,0x03,
+	0x80,0x1F,0x06,0xC0,0x7F,0x06,0xE0,0xFF,0x0E,0xE0,0xFF,0x0E,0xE0,0xFF,0x0E,0xE0,0xE0,0x0E,0xC0,0x60,0x0E,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xE0,0xFF,0x07,0xE0,0xFF,0x07,0xE0,0xFF,0x03,
 
 	/* Index 72, character 104 "h" (width: 12 pixels) */
-	0xC, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xC0,0x00,0x00,0xE0,0x00,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x00,0x80,0xFF,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xC0,0x00,0x00,0xE0,0x00,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x00,0x80,0xFF,0x00,
 
 	/* Index 73, character 105 "i" (width: 5 pixels) */
-	0x5, 0xEE,0xFF,0x00,0xEE,0xFF,0x00,0xEE,0xFF,0x00,0xEE,0xFF,0x00,0xEE,0xFF,0x00,
+	0xEE,0xFF,0x00,0xEE,0xFF,0x00,0xEE,0xFF,0x00,0xEE,0xFF,0x00,0xEE,0xFF,0x00,
 
 	/* Index 74, character 106 "j" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x0E,0x00,0x00,0x0E,0xEE,0xFF,0x0F,0xEE,0xFF,0x0F,0xEE,0xFF,0x0F,0xEE,0xFF,0x0F,0xEE,0xFF,0x07,
+	0x00,0x00,0x0E,0x00,0x00,0x0E,0xEE,0xFF,0x0F,0xEE,0xFF,0x0F,0xEE,0xFF,0x0F,0xEE,0xFF,0x0F,0xEE,0xFF,0x07,
 
 	/* Index 75, character 107 "k" (width: 13 pixels) */
-	0xD, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x80,0x1F,0x00,0xC0,0x3F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFD,0x00,0xE0,0xF8,0x00,0x60,0xE0,0x00,0x20,0x80,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x80,0x1F,0x00,0xC0,0x3F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFD,0x00,0xE0,0xF8,0x00,0x60,0xE0,0x00,0x20,0x80,0x00,
 
 	/* Index 76, character 108 "l" (width: 5 pixels) */
-	0x5, 0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,
+	0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,
 
 	/* Index 77, character 109 "m" (width: 19 pixels) */
-	0x13, 0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0x00,0x00,0xE0,0x00,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0x80,0xFF,0x00,0xC0,0x00,0x00,0xE0,0x00,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x00,0x80,0xFF,0x00,
+	0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0x00,0x00,0xE0,0x00,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0x80,0xFF,0x00,0xC0,0x00,0x00,0xE0,0x00,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x00,0x80,0xFF,0x00,
 
 	/* Index 78, character 110 "n" (width: 12 pixels) */
-	0xC, 0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0x00,0x00,0xE0,0x00,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x00,0x80,0xFF,0x00,
+	0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0x00,0x00,0xE0,0x00,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x00,0x80,0xFF,0x00,
 
 	/* Index 79, character 111 "o" (width: 12 pixels) */
-	0xC, 0x00,0x1F,0x00,0x80,0x3F,0x00,0xC0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xE0,0x00,0xE0,0xE0,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0x7F,0x00,0x80,0x3F,0x00,0x00,0x1F,0x00,
+	0x00,0x1F,0x00,0x80,0x3F,0x00,0xC0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xE0,0x00,0xE0,0xE0,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0x7F,0x00,0x80,0x3F,0x00,0x00,0x1F,0x00,
 
 	/* Index 80, character 112 "p" (width: 12 pixels) */
-	0xC, 0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xC0,0x60,0x00,0xE0,0xE0,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0x7F,0x00,0x00,0x3F,0x00,
+	0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xC0,0x60,0x00,0xE0,0xE0,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0x7F,0x00,0x00,0x3F,0x00,
 
 	/* Index 81, character 113 "q" (width: 12 pixels) */
-	0xC, 0x00,0x3F,0x00,0xC0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xE0,0x00,0xC0,0x60,0x00,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,
+	0x00,0x3F,0x00,0xC0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xE0,0x00,0xC0,0x60,0x00,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,0xE0,0xFF,0x0F,
 
 	/* Index 82, character 114 "r" (width: 8 pixels) */
-	0x8, 0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x00,0xE0,0x01,0x00,0xE0,0x00,0x00,0x60,0x00,0x00,
+	0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x00,0xE0,0x01,0x00,0xE0,0x00,0x00,0x60,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 11 pixels) */
-	0xB, 0x80,0x23,0x00,0xC0,0x67,0x00,0xE0,0xE7,0x00,0xE0,0xEF,0x00,0xE0,0xCF,0x00,0x60,0xCE,0x00,0x60,0xFE,0x00,0xE0,0xFE,0x00,0xE0,0xFE,0x00,0xC0,0x7C,0x00,0x80,0x38,0x00,
+	0x80,0x23,0x00,0xC0,0x67,0x00,0xE0,0xE7,0x00,0xE0,0xEF,0x00,0xE0,0xCF,0x00,0x60,0xCE,0x00,0x60,0xFE,0x00,0xE0,0xFE,0x00,0xE0,0xFE,0x00,0xC0,0x7C,0x00,0x80,0x38,0x00,
 
 	/* Index 84, character 116 "t" (width: 9 pixels) */
-	0x9, 0xE0,0x00,0x00,0xE0,0x00,0x00,0xF8,0x7F,0x00,0xFC,0xFF,0x00,0xFC,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xE0,0xE0,0x00,0xE0,0xE0,0x00,
+	0xE0,0x00,0x00,0xE0,0x00,0x00,0xF8,0x7F,0x00,0xFC,0xFF,0x00,0xFC,0xFF,0x00,0xFE,0xFF,0x00,0xFE,0xFF,0x00,0xE0,0xE0,0x00,0xE0,0xE0,0x00,
 
 	/* Index 85, character 117 "u" (width: 12 pixels) */
-	0xC, 0xE0,0x3F,0x00,0xE0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0x00,0xE0,0x00,0x00,0x60,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,
+	0xE0,0x3F,0x00,0xE0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0x00,0xE0,0x00,0x00,0x60,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,
 
 	/* Index 86, character 118 "v" (width: 13 pixels) */
-	0xD, 0x20,0x00,0x00,0xE0,0x01,0x00,0xE0,0x07,0x00,0xE0,0x1F,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x00,0x00,0xF0,0x00,0xC0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0x1F,0x00,0xE0,0x07,0x00,0xE0,0x01,0x00,0x20,0x00,0x00,
+	0x20,0x00,0x00,0xE0,0x01,0x00,0xE0,0x07,0x00,0xE0,0x1F,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x00,0x00,0xF0,0x00,0xC0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0x1F,0x00,0xE0,0x07,0x00,0xE0,0x01,0x00,0x20,0x00,0x00,
 
 	/* Index 87, character 119 "w" (width: 19 pixels) */
-	0x13, 0x20,0x00,0x00,0xE0,0x01,0x00,0xE0,0x0F,0x00,0xE0,0x7F,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x00,0x00,0xFC,0x00,0xC0,0x3F,0x00,0xE0,0x0F,0x00,0xE0,0x01,0x00,0xE0,0x0F,0x00,0xC0,0x3F,0x00,0x00,0xFC,0x00,0xC0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0x7F,0x00,0xE0,0x0F,0x00,0xE0,0x01,0x00,0x20,0x00,0x00,
+	0x20,0x00,0x00,0xE0,0x01,0x00,0xE0,0x0F,0x00,0xE0,0x7F,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x00,0x00,0xFC,0x00,0xC0,0x3F,0x00,0xE0,0x0F,0x00,0xE0,0x01,0x00,0xE0,0x0F,0x00,0xC0,0x3F,0x00,0x00,0xFC,0x00,0xC0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0x7F,0x00,0xE0,0x0F,0x00,0xE0,0x01,0x00,0x20,0x00,0x00,
 
 	/* Index 88, character 120 "x" (width: 13 pixels) */
-	0xD, 0x20,0x80,0x00,0x60,0xC0,0x00,0xE0,0xF1,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0x7F,0x00,0x00,0x0F,0x00,0xC0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xF1,0x00,0x60,0xC0,0x00,0x20,0x80,0x00,
+	0x20,0x80,0x00,0x60,0xC0,0x00,0xE0,0xF1,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0x7F,0x00,0x00,0x0F,0x00,0xC0,0x7F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x00,0xE0,0xF1,0x00,0x60,0xC0,0x00,0x20,0x80,0x00,
 
 	/* Index 89, character 121 "y" (width: 13 pixels) */
-	0xD, 0x20,0x00,0x0E,0xE0,0x01,0x0E,0xE0,0x07,0x0E,0xE0,0x3F,0x0E,0xE0,0xFF,0x0F,0xC0,0xFF,0x0F,0x00,0xF0,0x07,0xC0,0xFF,0x07,0xE0,0xFF,0x01,0xE0,0x3F,0x00,0xE0,0x0F,0x00,0xE0,0x01,0x00,0x20,0x00,0x00,
+	0x20,0x00,0x0E,0xE0,0x01,0x0E,0xE0,0x07,0x0E,0xE0,0x3F,0x0E,0xE0,0xFF,0x0F,0xC0,0xFF,0x0F,0x00,0xF0,0x07,0xC0,0xFF,0x07,0xE0,0xFF,0x01,0xE0,0x3F,0x00,0xE0,0x0F,0x00,0xE0,0x01,0x00,0x20,0x00,0x00,
 
 	/* Index 90, character 122 "z" (width: 10 pixels) */
-	0xA, 0xE0,0xE0,0x00,0xE0,0xF0,0x00,0xE0,0xF8,0x00,0xE0,0xFC,0x00,0xE0,0xFE,0x00,0xE0,0xEF,0x00,0xE0,0xE7,0x00,0xE0,0xE3,0x00,0xE0,0xE1,0x00,0xE0,0xE0,0x00,
+	0xE0,0xE0,0x00,0xE0,0xF0,0x00,0xE0,0xF8,0x00,0xE0,0xFC,0x00,0xE0,0xFE,0x00,0xE0,0xEF,0x00,0xE0,0xE7,0x00,0xE0,0xE3,0x00,0xE0,0xE1,0x00,0xE0,0xE0,0x00,
 
 	/* Index 91, character 123 "{" (width: 8 pixels) */
-	0x8, 0x00,0x0E,0x00,0x00,0x0E,0x00,0xF8,0xFF,0x07,0xFC,0xFF,0x07,0xFE,0xFB,0x0F,0xFE,0xF1,0x0F,0x0E,0x00,0x0E,0x0E,0x00,0x0E,
+	0x00,0x0E,0x00,0x00,0x0E,0x00,0xF8,0xFF,0x07,0xFC,0xFF,0x07,0xFE,0xFB,0x0F,0xFE,0xF1,0x0F,0x0E,0x00,0x0E,0x0E,0x00,0x0E,
 
 	/* Index 92, character 124 "|" (width: 3 pixels) */
-	0x3, 0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,
+	0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,
 
 	/* Index 93, character 125 "}" (width: 8 pixels) */
-	0x8, 0x0E,0x00,0x0E,0x0E,0x00,0x0E,0xFE,0xF1,0x0F,0xFE,0xFB,0x0F,0xFC,0xFF,0x07,0xF8,0xFF,0x07,0x00,0x1F,0x00,0x00,0x0E,0x00,
+	0x0E,0x00,0x0E,0x0E,0x00,0x0E,0xFE,0xF1,0x0F,0xFE,0xFB,0x0F,0xFC,0xFF,0x07,0xF8,0xFF,0x07,0x00,0x1F,0x00,0x00,0x0E,0x00,
 
 	/* Index 94, character 126 "~" (width: 12 pixels) */
-	0xC, 0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x80,0x03,0x00,0x80,0x01,0x00
+	0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x80,0x03,0x00,0x80,0x01,0x00
+};
+
+// Offset of each bitmap in ArialBlack16_bitmaps
+const unsigned short ArialBlack16_offsets[] = 
+{
+	0x0,	// Index 0
+	0x9,	// Index 1
+	0x18,	// Index 2
+	0x39,	// Index 3
+	0x63,	// Index 4
+	0x8D,	// Index 5
+	0xC6,	// Index 6
+	0xF9,	// Index 7
+	0x108,	// Index 8
+	0x11A,	// Index 9
+	0x12C,	// Index 10
+	0x144,	// Index 11
+	0x165,	// Index 12
+	0x174,	// Index 13
+	0x189,	// Index 14
+	0x198,	// Index 15
+	0x1AA,	// Index 16
+	0x1CE,	// Index 17
+	0x1E9,	// Index 18
+	0x20D,	// Index 19
+	0x231,	// Index 20
+	0x25B,	// Index 21
+	0x27F,	// Index 22
+	0x2A3,	// Index 23
+	0x2C7,	// Index 24
+	0x2EB,	// Index 25
+	0x30F,	// Index 26
+	0x31E,	// Index 27
+	0x32D,	// Index 28
+	0x351,	// Index 29
+	0x372,	// Index 30
+	0x396,	// Index 31
+	0x3BA,	// Index 32
+	0x3EA,	// Index 33
+	0x41D,	// Index 34
+	0x447,	// Index 35
+	0x471,	// Index 36
+	0x49B,	// Index 37
+	0x4C2,	// Index 38
+	0x4E6,	// Index 39
+	0x516,	// Index 40
+	0x546,	// Index 41
+	0x555,	// Index 42
+	0x57C,	// Index 43
+	0x5AF,	// Index 44
+	0x5D3,	// Index 45
+	0x609,	// Index 46
+	0x639,	// Index 47
+	0x669,	// Index 48
+	0x690,	// Index 49
+	0x6C3,	// Index 50
+	0x6F0,	// Index 51
+	0x717,	// Index 52
+	0x744,	// Index 53
+	0x774,	// Index 54
+	0x7A7,	// Index 55
+	0x7E6,	// Index 56
+	0x819,	// Index 57
+	0x84C,	// Index 58
+	0x873,	// Index 59
+	0x888,	// Index 60
+	0x89A,	// Index 61
+	0x8AF,	// Index 62
+	0x8D3,	// Index 63
+	0x8F4,	// Index 64
+	0x903,	// Index 65
+	0x927,	// Index 66
+	0x94B,	// Index 67
+	0x96F,	// Index 68
+	0x993,	// Index 69
+	0x9B7,	// Index 70
+	0x9D5,	// Index 71
+	0x9F9,	// Index 72
+	0xA1D,	// Index 73
+	0xA2C,	// Index 74
+	0xA41,	// Index 75
+	0xA68,	// Index 76
+	0xA77,	// Index 77
+	0xAB0,	// Index 78
+	0xAD4,	// Index 79
+	0xAF8,	// Index 80
+	0xB1C,	// Index 81
+	0xB40,	// Index 82
+	0xB58,	// Index 83
+	0xB79,	// Index 84
+	0xB94,	// Index 85
+	0xBB8,	// Index 86
+	0xBDF,	// Index 87
+	0xC18,	// Index 88
+	0xC3F,	// Index 89
+	0xC66,	// Index 90
+	0xC84,	// Index 91
+	0xC9C,	// Index 92
+	0xCA5,	// Index 93
+	0xCBD,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char ArialBlack16_widths[] = 
+{
+	0x3,	// Index 0
+	0x5,	// Index 1
+	0xB,	// Index 2
+	0xE,	// Index 3
+	0xE,	// Index 4
+	0x13,	// Index 5
+	0x11,	// Index 6
+	0x5,	// Index 7
+	0x6,	// Index 8
+	0x6,	// Index 9
+	0x8,	// Index 10
+	0xB,	// Index 11
+	0x5,	// Index 12
+	0x7,	// Index 13
+	0x5,	// Index 14
+	0x6,	// Index 15
+	0xC,	// Index 16
+	0x9,	// Index 17
+	0xC,	// Index 18
+	0xC,	// Index 19
+	0xE,	// Index 20
+	0xC,	// Index 21
+	0xC,	// Index 22
+	0xC,	// Index 23
+	0xC,	// Index 24
+	0xC,	// Index 25
+	0x5,	// Index 26
+	0x5,	// Index 27
+	0xC,	// Index 28
+	0xB,	// Index 29
+	0xC,	// Index 30
+	0xC,	// Index 31
+	0x10,	// Index 32
+	0x11,	// Index 33
+	0xE,	// Index 34
+	0xE,	// Index 35
+	0xE,	// Index 36
+	0xD,	// Index 37
+	0xC,	// Index 38
+	0x10,	// Index 39
+	0x10,	// Index 40
+	0x5,	// Index 41
+	0xD,	// Index 42
+	0x11,	// Index 43
+	0xC,	// Index 44
+	0x12,	// Index 45
+	0x10,	// Index 46
+	0x10,	// Index 47
+	0xD,	// Index 48
+	0x11,	// Index 49
+	0xF,	// Index 50
+	0xD,	// Index 51
+	0xF,	// Index 52
+	0x10,	// Index 53
+	0x11,	// Index 54
+	0x15,	// Index 55
+	0x11,	// Index 56
+	0x11,	// Index 57
+	0xD,	// Index 58
+	0x7,	// Index 59
+	0x6,	// Index 60
+	0x7,	// Index 61
+	0xC,	// Index 62
+	0xB,	// Index 63
+	0x5,	// Index 64
+	0xC,	// Index 65
+	0xC,	// Index 66
+	0xC,	// Index 67
+	0xC,	// Index 68
+	0xC,	// Index 69
+	0xA,	// Index 70
+	0xC,	// Index 71
+	0xC,	// Index 72
+	0x5,	// Index 73
+	0x7,	// Index 74
+	0xD,	// Index 75
+	0x5,	// Index 76
+	0x13,	// Index 77
+	0xC,	// Index 78
+	0xC,	// Index 79
+	0xC,	// Index 80
+	0xC,	// Index 81
+	0x8,	// Index 82
+	0xB,	// Index 83
+	0x9,	// Index 84
+	0xC,	// Index 85
+	0xD,	// Index 86
+	0x13,	// Index 87
+	0xD,	// Index 88
+	0xD,	// Index 89
+	0xA,	// Index 90
+	0x8,	// Index 91
+	0x3,	// Index 92
+	0x8,	// Index 93
+	0xC,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char ArialBlack16_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0xF, 0x0,	// Index 1
+	0xF, 0x0,	// Index 2
+	0xF, 0x0,	// Index 3
+	0x10, 0x2,	// Index 4
+	0xF, 0x0,	// Index 5
+	0xF, 0x0,	// Index 6
+	0xF, 0x0,	// Index 7
+	0xF, 0x4,	// Index 8
+	0xF, 0x4,	// Index 9
+	0xF, 0x0,	// Index 10
+	0xD, 0x0,	// Index 11
+	0x5, 0x4,	// Index 12
+	0x7, 0x0,	// Index 13
+	0x5, 0x0,	// Index 14
+	0xF, 0x0,	// Index 15
+	0xF, 0x0,	// Index 16
+	0xF, 0x0,	// Index 17
+	0xF, 0x0,	// Index 18
+	0xF, 0x0,	// Index 19
+	0xF, 0x0,	// Index 20
+	0xF, 0x0,	// Index 21
+	0xF, 0x0,	// Index 22
+	0xF, 0x0,	// Index 23
+	0xF, 0x0,	// Index 24
+	0xF, 0x0,	// Index 25
+	0xB, 0x0,	// Index 26
+	0xB, 0x4,	// Index 27
+	0xE, 0x0,	// Index 28
+	0xC, 0x0,	// Index 29
+	0xE, 0x0,	// Index 30
+	0xF, 0x0,	// Index 31
+	0xF, 0x3,	// Index 32
+	0xF, 0x0,	// Index 33
+	0xF, 0x0,	// Index 34
+	0xF, 0x0,	// Index 35
+	0xF, 0x0,	// Index 36
+	0xF, 0x0,	// Index 37
+	0xF, 0x0,	// Index 38
+	0xF, 0x0,	// Index 39
+	0xF, 0x0,	// Index 40
+	0xF, 0x0,	// Index 41
+	0xF, 0x0,	// Index 42
+	0xF, 0x0,	// Index 43
+	0xF, 0x0,	// Index 44
+	0xF, 0x0,	// Index 45
+	0xF, 0x0,	// Index 46
+	0xF, 0x0,	// Index 47
+	0xF, 0x0,	// Index 48
+	0xF, 0x1,	// Index 49
+	0xF, 0x0,	// Index 50
+	0xF, 0x0,	// Index 51
+	0xF, 0x0,	// Index 52
+	0xF, 0x0,	// Index 53
+	0xF, 0x0,	// Index 54
+	0xF, 0x0,	// Index 55
+	0xF, 0x0,	// Index 56
+	0xF, 0x0,	// Index 57
+	0xF, 0x0,	// Index 58
+	0xF, 0x4,	// Index 59
+	0xF, 0x0,	// Index 60
+	0xF, 0x4,	// Index 61
+	0xF, 0x0,	// Index 62
+	0x0, 0x3,	// Index 63
+	0xF, 0x0,	// Index 64
+	0xB, 0x0,	// Index 65
+	0xF, 0x0,	// Index 66
+	0xB, 0x0,	// Index 67
+	0xF, 0x0,	// Index 68
+	0xB, 0x0,	// Index 69
+	0xF, 0x0,	// Index 70
+	0xB, 0x4,	// Index 71
+	0xF, 0x0,	// Index 72
+	0xF, 0x0,	// Index 73
+	0xF, 0x4,	// Index 74
+	0xF, 0x0,	// Index 75
+	0xF, 0x0,	// Index 76
+	0xB, 0x0,	// Index 77
+	0xB, 0x0,	// Index 78
+	0xB, 0x0,	// Index 79
+	0xB, 0x4,	// Index 80
+	0xB, 0x4,	// Index 81
+	0xB, 0x0,	// Index 82
+	0xB, 0x0,	// Index 83
+	0xF, 0x0,	// Index 84
+	0xB, 0x0,	// Index 85
+	0xB, 0x0,	// Index 86
+	0xB, 0x0,	// Index 87
+	0xB, 0x0,	// Index 88
+	0xB, 0x4,	// Index 89
+	0xB, 0x0,	// Index 90
+	0xF, 0x4,	// Index 91
+	0xF, 0x4,	// Index 92
+	0xF, 0x4,	// Index 93
+	0xA, 0x0,	// Index 94
+};
+
+const font_t ArialBlack16 = 
+{
+	ArialBlack16_bitmaps,
+	ArialBlack16_offsets,
+	ArialBlack16_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x14,	// Height 
+	0,	// Flags 
+	ArialBlack16_extents,
+	0x10	// Ascent 
 };
@@ -7,6 +7,8 @@
 // Project Name:  LucidaConsole
 //---------------------------------------------------------------
 
+#include "graphics.h"
+
 //---------------------------------------------------------------
 // Group Name: LucidaConsole10_Bold
 // Designer: Imported System Font
@@ -20,398 +22,607 @@
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char LucidaConsole10_Bold[] = 
+const unsigned char LucidaConsole10_Bold_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0xD,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xC8, // Index 1 (offset: 200)
-	0x0, 0xDB, // Index 2 (offset: 219)
-	0x0, 0xEE, // Index 3 (offset: 238)
-	0x1, 0x1, // Index 4 (offset: 257)
-	0x1, 0x14, // Index 5 (offset: 276)
-	0x1, 0x27, // Index 6 (offset: 295)
-	0x1, 0x3A, // Index 7 (offset: 314)
-	0x1, 0x4D, // Index 8 (offset: 333)
-	0x1, 0x60, // Index 9 (offset: 352)
-	0x1, 0x73, // Index 10 (offset: 371)
-	0x1, 0x86, // Index 11 (offset: 390)
-	0x1, 0x99, // Index 12 (offset: 409)
-	0x1, 0xAC, // Index 13 (offset: 428)
-	0x1, 0xBF, // Index 14 (offset: 447)
-	0x1, 0xD2, // Index 15 (offset: 466)
-	0x1, 0xE5, // Index 16 (offset: 485)
-	0x1, 0xF8, // Index 17 (offset: 504)
-	0x2, 0xB, // Index 18 (offset: 523)
-	0x2, 0x1E, // Index 19 (offset: 542)
-	0x2, 0x31, // Index 20 (offset: 561)
-	0x2, 0x44, // Index 21 (offset: 580)
-	0x2, 0x57, // Index 22 (offset: 599)
-	0x2, 0x6A, // Index 23 (offset: 618)
-	0x2, 0x7D, // Index 24 (offset: 637)
-	0x2, 0x90, // Index 25 (offset: 656)
-	0x2, 0xA3, // Index 26 (offset: 675)
-	0x2, 0xB6, // Index 27 (offset: 694)
-	0x2, 0xC9, // Index 28 (offset: 713)
-	0x2, 0xDC, // Index 29 (offset: 732)
-	0x2, 0xEF, // Index 30 (offset: 751)
-	0x3, 0x2, // Index 31 (offset: 770)
-	0x3, 0x15, // Index 32 (offset: 789)
-	0x3, 0x28, // Index 33 (offset: 808)
-	0x3, 0x3B, // Index 34 (offset: 827)
-	0x3, 0x4E, // Index 35 (offset: 846)
-	0x3, 0x61, // Index 36 (offset: 865)
-	0x3, 0x74, // Index 37 (offset: 884)
-	0x3, 0x87, // Index 38 (offset: 903)
-	0x3, 0x9A, // Index 39 (offset: 922)
-	0x3, 0xAD, // Index 40 (offset: 941)
-	0x3, 0xC0, // Index 41 (offset: 960)
-	0x3, 0xD3, // Index 42 (offset: 979)
-	0x3, 0xE6, // Index 43 (offset: 998)
-	0x3, 0xF9, // Index 44 (offset: 1017)
-	0x4, 0xC, // Index 45 (offset: 1036)
-	0x4, 0x1F, // Index 46 (offset: 1055)
-	0x4, 0x32, // Index 47 (offset: 1074)
-	0x4, 0x45, // Index 48 (offset: 1093)
-	0x4, 0x58, // Index 49 (offset: 1112)
-	0x4, 0x6B, // Index 50 (offset: 1131)
-	0x4, 0x7E, // Index 51 (offset: 1150)
-	0x4, 0x91, // Index 52 (offset: 1169)
-	0x4, 0xA4, // Index 53 (offset: 1188)
-	0x4, 0xB7, // Index 54 (offset: 1207)
-	0x4, 0xCA, // Index 55 (offset: 1226)
-	0x4, 0xDD, // Index 56 (offset: 1245)
-	0x4, 0xF0, // Index 57 (offset: 1264)
-	0x5, 0x3, // Index 58 (offset: 1283)
-	0x5, 0x16, // Index 59 (offset: 1302)
-	0x5, 0x29, // Index 60 (offset: 1321)
-	0x5, 0x3C, // Index 61 (offset: 1340)
-	0x5, 0x4F, // Index 62 (offset: 1359)
-	0x5, 0x62, // Index 63 (offset: 1378)
-	0x5, 0x75, // Index 64 (offset: 1397)
-	0x5, 0x88, // Index 65 (offset: 1416)
-	0x5, 0x9B, // Index 66 (offset: 1435)
-	0x5, 0xAE, // Index 67 (offset: 1454)
-	0x5, 0xC1, // Index 68 (offset: 1473)
-	0x5, 0xD4, // Index 69 (offset: 1492)
-	0x5, 0xE7, // Index 70 (offset: 1511)
-	0x5, 0xFA, // Index 71 (offset: 1530)
-	0x6, 0xD, // Index 72 (offset: 1549)
-	0x6, 0x20, // Index 73 (offset: 1568)
-	0x6, 0x33, // Index 74 (offset: 1587)
-	0x6, 0x46, // Index 75 (offset: 1606)
-	0x6, 0x59, // Index 76 (offset: 1625)
-	0x6, 0x6C, // Index 77 (offset: 1644)
-	0x6, 0x7F, // Index 78 (offset: 1663)
-	0x6, 0x92, // Index 79 (offset: 1682)
-	0x6, 0xA5, // Index 80 (offset: 1701)
-	0x6, 0xB8, // Index 81 (offset: 1720)
-	0x6, 0xCB, // Index 82 (offset: 1739)
-	0x6, 0xDE, // Index 83 (offset: 1758)
-	0x6, 0xF1, // Index 84 (offset: 1777)
-	0x7, 0x4, // Index 85 (offset: 1796)
-	0x7, 0x17, // Index 86 (offset: 1815)
-	0x7, 0x2A, // Index 87 (offset: 1834)
-	0x7, 0x3D, // Index 88 (offset: 1853)
-	0x7, 0x50, // Index 89 (offset: 1872)
-	0x7, 0x63, // Index 90 (offset: 1891)
-	0x7, 0x76, // Index 91 (offset: 1910)
-	0x7, 0x89, // Index 92 (offset: 1929)
-	0x7, 0x9C, // Index 93 (offset: 1948)
-	0x7, 0xAF, // Index 94 (offset: 1967)
-
 	/* Index 0, character 32 " " (width: 2 pixels) */
-	0x2, 0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x02,0x7E,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x02,0x7E,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 2, character 34 """ (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 9 pixels) */
-	0x9, 0x40,0x00,0xD0,0x03,0xF0,0x03,0xFE,0x03,0xFE,0x03,0x7E,0x00,0x5E,0x00,0x50,0x00,0x10,0x00,
+	0x40,0x00,0xD0,0x03,0xF0,0x03,0xFE,0x03,0xFE,0x03,0x7E,0x00,0x5E,0x00,0x50,0x00,0x10,0x00,
 
 	/* Index 4, character 36 "$" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x1C,0x02,0x3E,0x02,0xFF,0x07,0xFF,0x07,0xE2,0x03,0xC2,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x1C,0x02,0x3E,0x02,0xFF,0x07,0xFF,0x07,0xE2,0x03,0xC2,0x01,0x00,0x00,0x00,0x00,
 
 	/* Index 5, character 37 "%" (width: 9 pixels) */
-	0x9, 0x0C,0x02,0x1E,0x03,0x92,0x01,0xFE,0x00,0xFC,0x01,0xF8,0x03,0x4C,0x02,0xC6,0x03,0x82,0x01,
+	0x0C,0x02,0x1E,0x03,0x92,0x01,0xFE,0x00,0xFC,0x01,0xF8,0x03,0x4C,0x02,0xC6,0x03,0x82,0x01,
 
 	/* Index 6, character 38 "&" (width: 9 pixels) */
-	0x9, 0xC0,0x01,0xE0,0x03,0x3C,0x03,0x3E,0x02,0xF2,0x02,0xDE,0x03,0x8C,0x03,0xE0,0x03,0x60,0x00,
+	0xC0,0x01,0xE0,0x03,0x3C,0x03,0x3E,0x02,0xF2,0x02,0xDE,0x03,0x8C,0x03,0xE0,0x03,0x60,0x00,
 
 	/* Index 7, character 39 "'" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0xF8,0x01,0xFC,0x03,0x0E,0x07,0x03,0x0C,0x01,0x08,0x01,0x08,0x00,0x00,
+	0x00,0x00,0x00,0x00,0xF8,0x01,0xFC,0x03,0x0E,0x07,0x03,0x0C,0x01,0x08,0x01,0x08,0x00,0x00,
 
 	/* Index 9, character 41 ")" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x01,0x08,0x01,0x08,0x03,0x0C,0x06,0x06,0xFC,0x03,0xF8,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x01,0x08,0x01,0x08,0x03,0x0C,0x06,0x06,0xFC,0x03,0xF8,0x01,0x00,0x00,0x00,0x00,
 
 	/* Index 10, character 42 "*" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x04,0x00,0x3C,0x00,0x3E,0x00,0x16,0x00,0x38,0x00,0x3C,0x00,0x04,0x00,0x00,0x00,
+	0x00,0x00,0x04,0x00,0x3C,0x00,0x3E,0x00,0x16,0x00,0x38,0x00,0x3C,0x00,0x04,0x00,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 9 pixels) */
-	0x9, 0x40,0x00,0x40,0x00,0x40,0x00,0xF8,0x03,0xF8,0x03,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
+	0x40,0x00,0x40,0x00,0x40,0x00,0xF8,0x03,0xF8,0x03,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
 
 	/* Index 12, character 44 "," (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x00,0x0B,0x00,0x0F,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x0B,0x00,0x0F,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 13, character 45 "-" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
+	0x00,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
 
 	/* Index 14, character 46 "." (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 15, character 47 "/" (width: 9 pixels) */
-	0x9, 0x00,0x08,0x00,0x0E,0x00,0x07,0xC0,0x01,0xF0,0x00,0x38,0x00,0x0E,0x00,0x07,0x00,0x01,0x00,
+	0x00,0x08,0x00,0x0E,0x00,0x07,0xC0,0x01,0xF0,0x00,0x38,0x00,0x0E,0x00,0x07,0x00,0x01,0x00,
 
 	/* Index 16, character 48 "0" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xF8,0x00,0xFC,0x03,0x06,0x03,0x02,0x02,0x06,0x03,0xFC,0x03,0xF8,0x00,0x00,0x00,
+	0x00,0x00,0xF8,0x00,0xFC,0x03,0x06,0x03,0x02,0x02,0x06,0x03,0xFC,0x03,0xF8,0x00,0x00,0x00,
 
 	/* Index 17, character 49 "1" (width: 9 pixels) */
-	0x9, 0x04,0x02,0x04,0x02,0x06,0x02,0xFE,0x03,0xFE,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,
+	0x04,0x02,0x04,0x02,0x06,0x02,0xFE,0x03,0xFE,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,
 
 	/* Index 18, character 50 "2" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x02,0x03,0x82,0x03,0xC2,0x02,0x62,0x02,0x3E,0x02,0x1C,0x02,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x02,0x03,0x82,0x03,0xC2,0x02,0x62,0x02,0x3E,0x02,0x1C,0x02,0x00,0x00,0x00,0x00,
 
 	/* Index 19, character 51 "3" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x02,0x02,0x22,0x02,0x22,0x02,0x72,0x02,0xDE,0x03,0xCC,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x02,0x02,0x22,0x02,0x22,0x02,0x72,0x02,0xDE,0x03,0xCC,0x01,0x00,0x00,0x00,0x00,
 
 	/* Index 20, character 52 "4" (width: 9 pixels) */
-	0x9, 0xC0,0x00,0xE0,0x00,0xB8,0x00,0x9C,0x00,0xFE,0x03,0xFE,0x03,0x80,0x00,0x00,0x00,0x00,0x00,
+	0xC0,0x00,0xE0,0x00,0xB8,0x00,0x9C,0x00,0xFE,0x03,0xFE,0x03,0x80,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 21, character 53 "5" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x1E,0x02,0x1E,0x02,0x12,0x02,0xF2,0x03,0xE2,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x1E,0x02,0x1E,0x02,0x12,0x02,0xF2,0x03,0xE2,0x01,0x00,0x00,0x00,0x00,
 
 	/* Index 22, character 54 "6" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xF8,0x00,0xFC,0x01,0x36,0x03,0x12,0x02,0x12,0x02,0xF2,0x03,0xE0,0x01,0x00,0x00,
+	0x00,0x00,0xF8,0x00,0xFC,0x01,0x36,0x03,0x12,0x02,0x12,0x02,0xF2,0x03,0xE0,0x01,0x00,0x00,
 
 	/* Index 23, character 55 "7" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x02,0x00,0x02,0x03,0xC2,0x03,0xF2,0x00,0x3A,0x00,0x0E,0x00,0x06,0x00,0x00,0x00,
+	0x00,0x00,0x02,0x00,0x02,0x03,0xC2,0x03,0xF2,0x00,0x3A,0x00,0x0E,0x00,0x06,0x00,0x00,0x00,
 
 	/* Index 24, character 56 "8" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xCC,0x01,0xFE,0x03,0x32,0x02,0x22,0x02,0x72,0x02,0xFE,0x03,0xCC,0x01,0x00,0x00,
+	0x00,0x00,0xCC,0x01,0xFE,0x03,0x32,0x02,0x22,0x02,0x72,0x02,0xFE,0x03,0xCC,0x01,0x00,0x00,
 
 	/* Index 25, character 57 "9" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x3C,0x00,0x7E,0x02,0x42,0x02,0x42,0x02,0x66,0x03,0xFC,0x01,0xF8,0x00,0x00,0x00,
+	0x00,0x00,0x3C,0x00,0x7E,0x02,0x42,0x02,0x42,0x02,0x66,0x03,0xFC,0x01,0xF8,0x00,0x00,0x00,
 
 	/* Index 26, character 58 ":" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x03,0x18,0x03,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x03,0x18,0x03,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 27, character 59 ";" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x18,0x0B,0x18,0x0F,0x18,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x18,0x0B,0x18,0x0F,0x18,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 28, character 60 "<" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x40,0x00,0x40,0x00,0xE0,0x00,0xB0,0x01,0x10,0x01,0x18,0x03,0x08,0x02,0x00,0x00,
+	0x00,0x00,0x40,0x00,0x40,0x00,0xE0,0x00,0xB0,0x01,0x10,0x01,0x18,0x03,0x08,0x02,0x00,0x00,
 
 	/* Index 29, character 61 "=" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x00,0x00,
+	0x00,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x00,0x00,
 
 	/* Index 30, character 62 ">" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x08,0x02,0x18,0x03,0x10,0x01,0xB0,0x01,0xE0,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
+	0x00,0x00,0x08,0x02,0x18,0x03,0x10,0x01,0xB0,0x01,0xE0,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
 
 	/* Index 31, character 63 "?" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x06,0x00,0x06,0x00,0x42,0x02,0x62,0x02,0x32,0x00,0x1E,0x00,0x0C,0x00,0x00,0x00,
+	0x00,0x00,0x06,0x00,0x06,0x00,0x42,0x02,0x62,0x02,0x32,0x00,0x1E,0x00,0x0C,0x00,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 9 pixels) */
-	0x9, 0xF8,0x00,0xFC,0x01,0x7E,0x03,0xFE,0x02,0x9A,0x02,0xCA,0x03,0xFE,0x03,0xFC,0x00,0x80,0x00,
+	0xF8,0x00,0xFC,0x01,0x7E,0x03,0xFE,0x02,0x9A,0x02,0xCA,0x03,0xFE,0x03,0xFC,0x00,0x80,0x00,
 
 	/* Index 33, character 65 "A" (width: 9 pixels) */
-	0x9, 0x00,0x02,0x80,0x03,0xF0,0x01,0xFC,0x00,0x8C,0x00,0xFC,0x00,0xF0,0x01,0x80,0x03,0x00,0x02,
+	0x00,0x02,0x80,0x03,0xF0,0x01,0xFC,0x00,0x8C,0x00,0xFC,0x00,0xF0,0x01,0x80,0x03,0x00,0x02,
 
 	/* Index 34, character 66 "B" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFC,0x03,0xFC,0x03,0x24,0x02,0x24,0x02,0x24,0x02,0xFC,0x03,0xD8,0x01,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0xFC,0x03,0x24,0x02,0x24,0x02,0x24,0x02,0xFC,0x03,0xD8,0x01,0x00,0x00,
 
 	/* Index 35, character 67 "C" (width: 9 pixels) */
-	0x9, 0xF0,0x00,0xF8,0x01,0x0C,0x03,0x04,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0x00,0x00,
+	0xF0,0x00,0xF8,0x01,0x0C,0x03,0x04,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0x00,0x00,
 
 	/* Index 36, character 68 "D" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFC,0x03,0xFC,0x03,0x04,0x02,0x04,0x02,0x0C,0x03,0xF8,0x01,0xF0,0x00,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0xFC,0x03,0x04,0x02,0x04,0x02,0x0C,0x03,0xF8,0x01,0xF0,0x00,0x00,0x00,
 
 	/* Index 37, character 69 "E" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFC,0x03,0xFC,0x03,0x44,0x02,0x44,0x02,0x44,0x02,0x44,0x02,0x04,0x02,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0xFC,0x03,0x44,0x02,0x44,0x02,0x44,0x02,0x44,0x02,0x04,0x02,0x00,0x00,
 
 	/* Index 38, character 70 "F" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFC,0x03,0xFC,0x03,0x44,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x04,0x00,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0xFC,0x03,0x44,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x04,0x00,0x00,0x00,
 
 	/* Index 39, character 71 "G" (width: 9 pixels) */
-	0x9, 0xF0,0x00,0xF8,0x01,0x0C,0x03,0x04,0x02,0x44,0x02,0x44,0x02,0xC4,0x03,0xC4,0x03,0x00,0x00,
+	0xF0,0x00,0xF8,0x01,0x0C,0x03,0x04,0x02,0x44,0x02,0x44,0x02,0xC4,0x03,0xC4,0x03,0x00,0x00,
 
 	/* Index 40, character 72 "H" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFC,0x03,0xFC,0x03,0x20,0x00,0x20,0x00,0x20,0x00,0xFC,0x03,0xFC,0x03,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0xFC,0x03,0x20,0x00,0x20,0x00,0x20,0x00,0xFC,0x03,0xFC,0x03,0x00,0x00,
 
 	/* Index 41, character 73 "I" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x04,0x02,0x04,0x02,0xFC,0x03,0xFC,0x03,0x04,0x02,0x04,0x02,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x04,0x02,0x04,0x02,0xFC,0x03,0xFC,0x03,0x04,0x02,0x04,0x02,0x00,0x00,0x00,0x00,
 
 	/* Index 42, character 74 "J" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0xFC,0x03,0xFC,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0xFC,0x03,0xFC,0x01,0x00,0x00,0x00,0x00,
 
 	/* Index 43, character 75 "K" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFC,0x03,0xFC,0x03,0x60,0x00,0xF0,0x00,0x98,0x01,0x0C,0x03,0x04,0x02,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0xFC,0x03,0x60,0x00,0xF0,0x00,0x98,0x01,0x0C,0x03,0x04,0x02,0x00,0x00,
 
 	/* Index 44, character 76 "L" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFC,0x03,0xFC,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0xFC,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,
 
 	/* Index 45, character 77 "M" (width: 9 pixels) */
-	0x9, 0xFC,0x03,0xFC,0x03,0x7C,0x00,0xF0,0x00,0xF0,0x00,0x7C,0x00,0xFC,0x03,0xFC,0x03,0x00,0x00,
+	0xFC,0x03,0xFC,0x03,0x7C,0x00,0xF0,0x00,0xF0,0x00,0x7C,0x00,0xFC,0x03,0xFC,0x03,0x00,0x00,
 
 	/* Index 46, character 78 "N" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFC,0x03,0xFC,0x03,0x38,0x00,0xF0,0x00,0xC0,0x01,0xFC,0x03,0xFC,0x03,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0xFC,0x03,0x38,0x00,0xF0,0x00,0xC0,0x01,0xFC,0x03,0xFC,0x03,0x00,0x00,
 
 	/* Index 47, character 79 "O" (width: 9 pixels) */
-	0x9, 0xF0,0x00,0xF8,0x01,0x0C,0x03,0x04,0x02,0x04,0x02,0x0C,0x03,0xF8,0x01,0xF0,0x00,0x00,0x00,
+	0xF0,0x00,0xF8,0x01,0x0C,0x03,0x04,0x02,0x04,0x02,0x0C,0x03,0xF8,0x01,0xF0,0x00,0x00,0x00,
 
 	/* Index 48, character 80 "P" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFC,0x03,0xFC,0x03,0x44,0x00,0x44,0x00,0x44,0x00,0x7C,0x00,0x38,0x00,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0xFC,0x03,0x44,0x00,0x44,0x00,0x44,0x00,0x7C,0x00,0x38,0x00,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 9 pixels) */
-	0x9, 0xF0,0x00,0xF8,0x01,0x0C,0x03,0x04,0x02,0x04,0x02,0x0C,0x07,0xF8,0x0D,0xF0,0x0C,0x00,0x08,
+	0xF0,0x00,0xF8,0x01,0x0C,0x03,0x04,0x02,0x04,0x02,0x0C,0x07,0xF8,0x0D,0xF0,0x0C,0x00,0x08,
 
 	/* Index 50, character 82 "R" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFC,0x03,0xFC,0x03,0x44,0x00,0xC4,0x00,0xFC,0x01,0x38,0x03,0x00,0x02,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0xFC,0x03,0x44,0x00,0xC4,0x00,0xFC,0x01,0x38,0x03,0x00,0x02,0x00,0x00,
 
 	/* Index 51, character 83 "S" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x18,0x02,0x3C,0x02,0x24,0x02,0x24,0x02,0x64,0x02,0xC4,0x03,0x84,0x01,0x00,0x00,
+	0x00,0x00,0x18,0x02,0x3C,0x02,0x24,0x02,0x24,0x02,0x64,0x02,0xC4,0x03,0x84,0x01,0x00,0x00,
 
 	/* Index 52, character 84 "T" (width: 9 pixels) */
-	0x9, 0x04,0x00,0x04,0x00,0x04,0x00,0xFC,0x03,0xFC,0x03,0x04,0x00,0x04,0x00,0x04,0x00,0x00,0x00,
+	0x04,0x00,0x04,0x00,0x04,0x00,0xFC,0x03,0xFC,0x03,0x04,0x00,0x04,0x00,0x04,0x00,0x00,0x00,
 
 	/* Index 53, character 85 "U" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFC,0x01,0xFC,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0xFC,0x03,0xFC,0x01,0x00,0x00,
+	0x00,0x00,0xFC,0x01,0xFC,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0xFC,0x03,0xFC,0x01,0x00,0x00,
 
 	/* Index 54, character 86 "V" (width: 9 pixels) */
-	0x9, 0x04,0x00,0x3C,0x00,0xF8,0x01,0xC0,0x03,0x80,0x03,0xE0,0x01,0x78,0x00,0x1C,0x00,0x04,0x00,
+	0x04,0x00,0x3C,0x00,0xF8,0x01,0xC0,0x03,0x80,0x03,0xE0,0x01,0x78,0x00,0x1C,0x00,0x04,0x00,
 
 	/* Index 55, character 87 "W" (width: 9 pixels) */
-	0x9, 0x1C,0x00,0xFC,0x01,0xE0,0x03,0xF0,0x03,0xF0,0x00,0xE0,0x03,0xF0,0x03,0xFC,0x01,0x0C,0x00,
+	0x1C,0x00,0xFC,0x01,0xE0,0x03,0xF0,0x03,0xF0,0x00,0xE0,0x03,0xF0,0x03,0xFC,0x01,0x0C,0x00,
 
 	/* Index 56, character 88 "X" (width: 9 pixels) */
-	0x9, 0x04,0x02,0x0C,0x03,0x98,0x01,0xF0,0x00,0x60,0x00,0xF0,0x00,0x98,0x01,0x0C,0x03,0x04,0x02,
+	0x04,0x02,0x0C,0x03,0x98,0x01,0xF0,0x00,0x60,0x00,0xF0,0x00,0x98,0x01,0x0C,0x03,0x04,0x02,
 
 	/* Index 57, character 89 "Y" (width: 9 pixels) */
-	0x9, 0x04,0x00,0x0C,0x00,0x38,0x00,0xF0,0x03,0xF0,0x03,0x38,0x00,0x0C,0x00,0x04,0x00,0x00,0x00,
+	0x04,0x00,0x0C,0x00,0x38,0x00,0xF0,0x03,0xF0,0x03,0x38,0x00,0x0C,0x00,0x04,0x00,0x00,0x00,
 
 	/* Index 58, character 90 "Z" (width: 9 pixels) */
-	0x9, 0x04,0x02,0x04,0x03,0x84,0x03,0xC4,0x02,0x64,0x02,0x34,0x02,0x1C,0x02,0x0C,0x02,0x00,0x00,
+	0x04,0x02,0x04,0x03,0x84,0x03,0xC4,0x02,0x64,0x02,0x34,0x02,0x1C,0x02,0x0C,0x02,0x00,0x00,
 
 	/* Index 59, character 91 "[" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0xFF,0x0F,0x01,0x08,0x01,0x08,0x01,0x08,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0xFF,0x0F,0x01,0x08,0x01,0x08,0x01,0x08,0x00,0x00,
 
 	/* Index 60, character 92 "\" (width: 9 pixels) */
-	0x9, 0x01,0x00,0x07,0x00,0x0E,0x00,0x38,0x00,0xF0,0x00,0xC0,0x01,0x00,0x07,0x00,0x0E,0x00,0x08,
+	0x01,0x00,0x07,0x00,0x0E,0x00,0x38,0x00,0xF0,0x00,0xC0,0x01,0x00,0x07,0x00,0x0E,0x00,0x08,
 
 	/* Index 61, character 93 "]" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x01,0x08,0x01,0x08,0x01,0x08,0xFF,0x0F,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x01,0x08,0x01,0x08,0x01,0x08,0xFF,0x0F,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 62, character 94 "^" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x80,0x00,0xE0,0x00,0x78,0x00,0x1E,0x00,0x7E,0x00,0xF0,0x00,0x80,0x00,0x00,0x00,
+	0x00,0x00,0x80,0x00,0xE0,0x00,0x78,0x00,0x1E,0x00,0x7E,0x00,0xF0,0x00,0x80,0x00,0x00,0x00,
 
 	/* Index 63, character 95 "_" (width: 9 pixels) */
-	0x9, 0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
+	0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
 
 	/* Index 64, character 96 "`" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x80,0x01,0xC8,0x03,0x48,0x02,0x48,0x02,0xF8,0x03,0xF0,0x03,0x00,0x02,0x00,0x00,
+	0x00,0x00,0x80,0x01,0xC8,0x03,0x48,0x02,0x48,0x02,0xF8,0x03,0xF0,0x03,0x00,0x02,0x00,0x00,
 
 	/* Index 66, character 98 "b" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFF,0x03,0xFF,0x03,0x18,0x03,0x08,0x02,0x08,0x02,0xF8,0x03,0xF0,0x01,0x00,0x00,
+	0x00,0x00,0xFF,0x03,0xFF,0x03,0x18,0x03,0x08,0x02,0x08,0x02,0xF8,0x03,0xF0,0x01,0x00,0x00,
 
 	/* Index 67, character 99 "c" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xE0,0x00,0xF0,0x01,0x18,0x03,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x00,0x00,
+	0x00,0x00,0xE0,0x00,0xF0,0x01,0x18,0x03,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x00,0x00,
 
 	/* Index 68, character 100 "d" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xF0,0x01,0xF8,0x03,0x08,0x02,0x08,0x02,0x18,0x03,0xFF,0x03,0xFF,0x03,0x00,0x00,
+	0x00,0x00,0xF0,0x01,0xF8,0x03,0x08,0x02,0x08,0x02,0x18,0x03,0xFF,0x03,0xFF,0x03,0x00,0x00,
 
 	/* Index 69, character 101 "e" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xE0,0x01,0xF8,0x03,0x58,0x02,0x48,0x02,0x48,0x02,0x78,0x02,0x70,0x02,0x00,0x00,
+	0x00,0x00,0xE0,0x01,0xF8,0x03,0x58,0x02,0x48,0x02,0x48,0x02,0x78,0x02,0x70,0x02,0x00,0x00,
 
 	/* Index 70, character 102 "f" (width: 9 pixels) */
-	0x9, 0x08,0x00,0x08,0x00,0xFE,0x03,0xFF,0x03,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x00,0x00,
+	0x08,0x00,0x08,0x00,0xFE,0x03,0xFF,0x03,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xF0,0x01,0xF8,0x13,0x08,0x12,0x08,0x12,0x18,0x13,0xF8,0x1F,0xF8,0x0F,0x00,0x00,
+	0x00,0x00,0xF0,0x01,0xF8,0x13,0x08,0x12,0x08,0x12,0x18,0x13,0xF8,0x1F,0xF8,0x0F,0x00,0x00,
 
 	/* Index 72, character 104 "h" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFF,0x03,0xFF,0x03,0x18,0x00,0x08,0x00,0x08,0x00,0xF8,0x03,0xF0,0x03,0x00,0x00,
+	0x00,0x00,0xFF,0x03,0xFF,0x03,0x18,0x00,0x08,0x00,0x08,0x00,0xF8,0x03,0xF0,0x03,0x00,0x00,
 
 	/* Index 73, character 105 "i" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x08,0x00,0x08,0x00,0x0B,0x00,0xFB,0x03,0xFB,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x08,0x00,0x08,0x00,0x0B,0x00,0xFB,0x03,0xFB,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 74, character 106 "j" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x08,0x10,0x08,0x10,0x0B,0x10,0xFB,0x1F,0xFB,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x08,0x10,0x08,0x10,0x0B,0x10,0xFB,0x1F,0xFB,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 75, character 107 "k" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xFF,0x03,0xFF,0x03,0xE0,0x00,0xB0,0x01,0x18,0x03,0x08,0x02,0x00,0x00,0x00,0x00,
+	0x00,0x00,0xFF,0x03,0xFF,0x03,0xE0,0x00,0xB0,0x01,0x18,0x03,0x08,0x02,0x00,0x00,0x00,0x00,
 
 	/* Index 76, character 108 "l" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0xFF,0x03,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0xFF,0x03,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 77, character 109 "m" (width: 9 pixels) */
-	0x9, 0xF8,0x03,0xF8,0x03,0x18,0x00,0xF8,0x03,0xF8,0x03,0x18,0x00,0xF8,0x03,0xF8,0x03,0x00,0x00,
+	0xF8,0x03,0xF8,0x03,0x18,0x00,0xF8,0x03,0xF8,0x03,0x18,0x00,0xF8,0x03,0xF8,0x03,0x00,0x00,
 
 	/* Index 78, character 110 "n" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xF8,0x03,0xF8,0x03,0x18,0x00,0x08,0x00,0x08,0x00,0xF8,0x03,0xF0,0x03,0x00,0x00,
+	0x00,0x00,0xF8,0x03,0xF8,0x03,0x18,0x00,0x08,0x00,0x08,0x00,0xF8,0x03,0xF0,0x03,0x00,0x00,
 
 	/* Index 79, character 111 "o" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xF0,0x01,0xF8,0x03,0x08,0x02,0x08,0x02,0x08,0x02,0xF8,0x03,0xF0,0x01,0x00,0x00,
+	0x00,0x00,0xF0,0x01,0xF8,0x03,0x08,0x02,0x08,0x02,0x08,0x02,0xF8,0x03,0xF0,0x01,0x00,0x00,
 
 	/* Index 80, character 112 "p" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xF8,0x1F,0xF8,0x1F,0x18,0x03,0x08,0x02,0x08,0x02,0xF8,0x03,0xF0,0x01,0x00,0x00,
+	0x00,0x00,0xF8,0x1F,0xF8,0x1F,0x18,0x03,0x08,0x02,0x08,0x02,0xF8,0x03,0xF0,0x01,0x00,0x00,
 
 	/* Index 81, character 113 "q" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xF0,0x01,0xF8,0x03,0x08,0x02,0x08,0x02,0x18,0x03,0xF8,0x1F,0xF8,0x1F,0x00,0x00,
+	0x00,0x00,0xF0,0x01,0xF8,0x03,0x08,0x02,0x08,0x02,0x18,0x03,0xF8,0x1F,0xF8,0x1F,0x00,0x00,
 
 	/* Index 82, character 114 "r" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xF8,0x03,0xF8,0x03,0x18,0x00,0x08,0x00,0x18,0x00,0x18,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0xF8,0x03,0xF8,0x03,0x18,0x00,0x08,0x00,0x18,0x00,0x18,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x30,0x02,0x38,0x02,0x68,0x02,0x48,0x02,0xC8,0x03,0x88,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x30,0x02,0x38,0x02,0x68,0x02,0x48,0x02,0xC8,0x03,0x88,0x01,0x00,0x00,0x00,0x00,
 
 	/* Index 84, character 116 "t" (width: 9 pixels) */
-	0x9, 0x08,0x00,0x08,0x00,0xFC,0x01,0xFC,0x03,0x08,0x02,0x08,0x02,0x08,0x02,0x00,0x00,0x00,0x00,
+	0x08,0x00,0x08,0x00,0xFC,0x01,0xFC,0x03,0x08,0x02,0x08,0x02,0x08,0x02,0x00,0x00,0x00,0x00,
 
 	/* Index 85, character 117 "u" (width: 9 pixels) */
-	0x9, 0x00,0x00,0xF8,0x01,0xF8,0x03,0x00,0x02,0x00,0x02,0x00,0x03,0xF8,0x03,0xF8,0x03,0x00,0x00,
+	0x00,0x00,0xF8,0x01,0xF8,0x03,0x00,0x02,0x00,0x02,0x00,0x03,0xF8,0x03,0xF8,0x03,0x00,0x00,
 
 	/* Index 86, character 118 "v" (width: 9 pixels) */
-	0x9, 0x08,0x00,0x78,0x00,0xF0,0x01,0x80,0x03,0x80,0x03,0xF0,0x01,0x78,0x00,0x08,0x00,0x00,0x00,
+	0x08,0x00,0x78,0x00,0xF0,0x01,0x80,0x03,0x80,0x03,0xF0,0x01,0x78,0x00,0x08,0x00,0x00,0x00,
 
 	/* Index 87, character 119 "w" (width: 9 pixels) */
-	0x9, 0x18,0x00,0xF8,0x00,0xE0,0x03,0xF0,0x03,0xF0,0x00,0xE0,0x03,0xE0,0x03,0xF8,0x00,0x18,0x00,
+	0x18,0x00,0xF8,0x00,0xE0,0x03,0xF0,0x03,0xF0,0x00,0xE0,0x03,0xE0,0x03,0xF8,0x00,0x18,0x00,
 
 	/* Index 88, character 120 "x" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x08,0x02,0x18,0x03,0xF0,0x01,0xE0,0x00,0xF0,0x01,0x18,0x03,0x08,0x02,0x00,0x00,
+	0x00,0x00,0x08,0x02,0x18,0x03,0xF0,0x01,0xE0,0x00,0xF0,0x01,0x18,0x03,0x08,0x02,0x00,0x00,
 
 	/* Index 89, character 121 "y" (width: 9 pixels) */
-	0x9, 0x08,0x10,0x38,0x10,0xF0,0x18,0xC0,0x1F,0x00,0x0F,0xC0,0x03,0xF0,0x00,0x38,0x00,0x08,0x00,
+	0x08,0x10,0x38,0x10,0xF0,0x18,0xC0,0x1F,0x00,0x0F,0xC0,0x03,0xF0,0x00,0x38,0x00,0x08,0x00,
 
 	/* Index 90, character 122 "z" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x08,0x02,0x08,0x03,0x88,0x03,0xC8,0x02,0x68,0x02,0x38,0x02,0x18,0x02,0x00,0x00,
+	0x00,0x00,0x08,0x02,0x08,0x03,0x88,0x03,0xC8,0x02,0x68,0x02,0x38,0x02,0x18,0x02,0x00,0x00,
 
 	/* Index 91, character 123 "{" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x20,0x00,0x20,0x00,0xFF,0x07,0xDF,0x0F,0x01,0x08,0x01,0x08,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x20,0x00,0x20,0x00,0xFF,0x07,0xDF,0x0F,0x01,0x08,0x01,0x08,0x00,0x00,0x00,0x00,
 
 	/* Index 92, character 124 "|" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 93, character 125 "}" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x01,0x08,0x01,0x08,0xDF,0x0F,0xFE,0x07,0x20,0x00,0x20,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x01,0x08,0x01,0x08,0xDF,0x0F,0xFE,0x07,0x20,0x00,0x20,0x00,0x00,0x00,
 
 	/* Index 94, character 126 "~" (width: 9 pixels) */
-	0x9, 0x80,0x00,0xC0,0x00,0x40,0x00,0x40,0x00,0xC0,0x00,0x80,0x00,0x80,0x00,0xC0,0x00,0x40,0x00
+	0x80,0x00,0xC0,0x00,0x40,0x00,0x40,0x00,0xC0,0x00,0x80,0x00,0x80,0x00,0xC0,0x00,0x40,0x00
+};
+
+// Offset of each bitmap in LucidaConsole10_Bold_bitmaps
+const unsigned short LucidaConsole10_Bold_offsets[] = 
+{
+	0x0,	// Index 0
+	0x4,	// Index 1
+	0x16,	// Index 2
+	0x28,	// Index 3
+	0x3A,	// Index 4
+	0x4C,	// Index 5
+	0x5E,	// Index 6
+	0x70,	// Index 7
+	0x82,	// Index 8
+	0x94,	// Index 9
+	0xA6,	// Index 10
+	0xB8,	// Index 11
+	0xCA,	// Index 12
+	0xDC,	// Index 13
+	0xEE,	// Index 14
+	0x100,	// Index 15
+	0x112,	// Index 16
+	0x124,	// Index 17
+	0x136,	// Index 18
+	0x148,	// Index 19
+	0x15A,	// Index 20
+	0x16C,	// Index 21
+	0x17E,	// Index 22
+	0x190,	// Index 23
+	0x1A2,	// Index 24
+	0x1B4,	// Index 25
+	0x1C6,	// Index 26
+	0x1D8,	// Index 27
+	0x1EA,	// Index 28
+	0x1FC,	// Index 29
+	0x20E,	// Index 30
+	0x220,	// Index 31
+	0x232,	// Index 32
+	0x244,	// Index 33
+	0x256,	// Index 34
+	0x268,	// Index 35
+	0x27A,	// Index 36
+	0x28C,	// Index 37
+	0x29E,	// Index 38
+	0x2B0,	// Index 39
+	0x2C2,	// Index 40
+	0x2D4,	// Index 41
+	0x2E6,	// Index 42
+	0x2F8,	// Index 43
+	0x30A,	// Index 44
+	0x31C,	// Index 45
+	0x32E,	// Index 46
+	0x340,	// Index 47
+	0x352,	// Index 48
+	0x364,	// Index 49
+	0x376,	// Index 50
+	0x388,	// Index 51
+	0x39A,	// Index 52
+	0x3AC,	// Index 53
+	0x3BE,	// Index 54
+	0x3D0,	// Index 55
+	0x3E2,	// Index 56
+	0x3F4,	// Index 57
+	0x406,	// Index 58
+	0x418,	// Index 59
+	0x42A,	// Index 60
+	0x43C,	// Index 61
+	0x44E,	// Index 62
+	0x460,	// Index 63
+	0x472,	// Index 64
+	0x484,	// Index 65
+	0x496,	// Index 66
+	0x4A8,	// Index 67
+	0x4BA,	// Index 68
+	0x4CC,	// Index 69
+	0x4DE,	// Index 70
+	0x4F0,	// Index 71
+	0x502,	// Index 72
+	0x514,	// Index 73
+	0x526,	// Index 74
+	0x538,	// Index 75
+	0x54A,	// Index 76
+	0x55C,	// Index 77
+	0x56E,	// Index 78
+	0x580,	// Index 79
+	0x592,	// Index 80
+	0x5A4,	// Index 81
+	0x5B6,	// Index 82
+	0x5C8,	// Index 83
+	0x5DA,	// Index 84
+	0x5EC,	// Index 85
+	0x5FE,	// Index 86
+	0x610,	// Index 87
+	0x622,	// Index 88
+	0x634,	// Index 89
+	0x646,	// Index 90
+	0x658,	// Index 91
+	0x66A,	// Index 92
+	0x67C,	// Index 93
+	0x68E,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char LucidaConsole10_Bold_widths[] = 
+{
+	0x2,	// Index 0
+	0x9,	// Index 1
+	0x9,	// Index 2
+	0x9,	// Index 3
+	0x9,	// Index 4
+	0x9,	// Index 5
+	0x9,	// Index 6
+	0x9,	// Index 7
+	0x9,	// Index 8
+	0x9,	// Index 9
+	0x9,	// Index 10
+	0x9,	// Index 11
+	0x9,	// Index 12
+	0x9,	// Index 13
+	0x9,	// Index 14
+	0x9,	// Index 15
+	0x9,	// Index 16
+	0x9,	// Index 17
+	0x9,	// Index 18
+	0x9,	// Index 19
+	0x9,	// Index 20
+	0x9,	// Index 21
+	0x9,	// Index 22
+	0x9,	// Index 23
+	0x9,	// Index 24
+	0x9,	// Index 25
+	0x9,	// Index 26
+	0x9,	// Index 27
+	0x9,	// Index 28
+	0x9,	// Index 29
+	0x9,	// Index 30
+	0x9,	// Index 31
+	0x9,	// Index 32
+	0x9,	// Index 33
+	0x9,	// Index 34
+	0x9,	// Index 35
+	0x9,	// Index 36
+	0x9,	// Index 37
+	0x9,	// Index 38
+	0x9,	// Index 39
+	0x9,	// Index 40
+	0x9,	// Index 41
+	0x9,	// Index 42
+	0x9,	// Index 43
+	0x9,	// Index 44
+	0x9,	// Index 45
+	0x9,	// Index 46
+	0x9,	// Index 47
+	0x9,	// Index 48
+	0x9,	// Index 49
+	0x9,	// Index 50
+	0x9,	// Index 51
+	0x9,	// Index 52
+	0x9,	// Index 53
+	0x9,	// Index 54
+	0x9,	// Index 55
+	0x9,	// Index 56
+	0x9,	// Index 57
+	0x9,	// Index 58
+	0x9,	// Index 59
+	0x9,	// Index 60
+	0x9,	// Index 61
+	0x9,	// Index 62
+	0x9,	// Index 63
+	0x9,	// Index 64
+	0x9,	// Index 65
+	0x9,	// Index 66
+	0x9,	// Index 67
+	0x9,	// Index 68
+	0x9,	// Index 69
+	0x9,	// Index 70
+	0x9,	// Index 71
+	0x9,	// Index 72
+	0x9,	// Index 73
+	0x9,	// Index 74
+	0x9,	// Index 75
+	0x9,	// Index 76
+	0x9,	// Index 77
+	0x9,	// Index 78
+	0x9,	// Index 79
+	0x9,	// Index 80
+	0x9,	// Index 81
+	0x9,	// Index 82
+	0x9,	// Index 83
+	0x9,	// Index 84
+	0x9,	// Index 85
+	0x9,	// Index 86
+	0x9,	// Index 87
+	0x9,	// Index 88
+	0x9,	// Index 89
+	0x9,	// Index 90
+	0x9,	// Index 91
+	0x9,	// Index 92
+	0x9,	// Index 93
+	0x9,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char LucidaConsole10_Bold_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x9, 0x0,	// Index 1
+	0xA, 0x0,	// Index 2
+	0x9, 0x0,	// Index 3
+	0xA, 0x1,	// Index 4
+	0x9, 0x0,	// Index 5
+	0x9, 0x0,	// Index 6
+	0xA, 0x0,	// Index 7
+	0xA, 0x2,	// Index 8
+	0xA, 0x2,	// Index 9
+	0x9, 0x0,	// Index 10
+	0x7, 0x0,	// Index 11
+	0x2, 0x2,	// Index 12
+	0x4, 0x0,	// Index 13
+	0x2, 0x0,	// Index 14
+	0xA, 0x2,	// Index 15
+	0x9, 0x0,	// Index 16
+	0x9, 0x0,	// Index 17
+	0x9, 0x0,	// Index 18
+	0x9, 0x0,	// Index 19
+	0x9, 0x0,	// Index 20
+	0x9, 0x0,	// Index 21
+	0x9, 0x0,	// Index 22
+	0x9, 0x0,	// Index 23
+	0x9, 0x0,	// Index 24
+	0x9, 0x0,	// Index 25
+	0x7, 0x0,	// Index 26
+	0x7, 0x2,	// Index 27
+	0x7, 0x0,	// Index 28
+	0x5, 0x0,	// Index 29
+	0x7, 0x0,	// Index 30
+	0x9, 0x0,	// Index 31
+	0x9, 0x0,	// Index 32
+	0x8, 0x0,	// Index 33
+	0x8, 0x0,	// Index 34
+	0x8, 0x0,	// Index 35
+	0x8, 0x0,	// Index 36
+	0x8, 0x0,	// Index 37
+	0x8, 0x0,	// Index 38
+	0x8, 0x0,	// Index 39
+	0x8, 0x0,	// Index 40
+	0x8, 0x0,	// Index 41
+	0x8, 0x0,	// Index 42
+	0x8, 0x0,	// Index 43
+	0x8, 0x0,	// Index 44
+	0x8, 0x0,	// Index 45
+	0x8, 0x0,	// Index 46
+	0x8, 0x0,	// Index 47
+	0x8, 0x0,	// Index 48
+	0x8, 0x2,	// Index 49
+	0x8, 0x0,	// Index 50
+	0x8, 0x0,	// Index 51
+	0x8, 0x0,	// Index 52
+	0x8, 0x0,	// Index 53
+	0x8, 0x0,	// Index 54
+	0x8, 0x0,	// Index 55
+	0x8, 0x0,	// Index 56
+	0x8, 0x0,	// Index 57
+	0x8, 0x0,	// Index 58
+	0xA, 0x2,	// Index 59
+	0xA, 0x2,	// Index 60
+	0xA, 0x2,	// Index 61
+	0x9, 0x0,	// Index 62
+	0x0, 0x1,	// Index 63
+	0xA, 0x0,	// Index 64
+	0x7, 0x0,	// Index 65
+	0xA, 0x0,	// Index 66
+	0x7, 0x0,	// Index 67
+	0xA, 0x0,	// Index 68
+	0x7, 0x0,	// Index 69
+	0xA, 0x0,	// Index 70
+	0x7, 0x3,	// Index 71
+	0xA, 0x0,	// Index 72
+	0xA, 0x0,	// Index 73
+	0xA, 0x3,	// Index 74
+	0xA, 0x0,	// Index 75
+	0xA, 0x0,	// Index 76
+	0x7, 0x0,	// Index 77
+	0x7, 0x0,	// Index 78
+	0x7, 0x0,	// Index 79
+	0x7, 0x3,	// Index 80
+	0x7, 0x3,	// Index 81
+	0x7, 0x0,	// Index 82
+	0x7, 0x0,	// Index 83
+	0x8, 0x0,	// Index 84
+	0x7, 0x0,	// Index 85
+	0x7, 0x0,	// Index 86
+	0x7, 0x0,	// Index 87
+	0x7, 0x0,	// Index 88
+	0x7, 0x3,	// Index 89
+	0x7, 0x0,	// Index 90
+	0xA, 0x2,	// Index 91
+	0xA, 0x2,	// Index 92
+	0xA, 0x2,	// Index 93
+	0x4, 0x0,	// Index 94
+};
+
+const font_t LucidaConsole10_Bold = 
+{
+	LucidaConsole10_Bold_bitmaps,
+	LucidaConsole10_Bold_offsets,
+	LucidaConsole10_Bold_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0xD,	// Height 
+	0,	// Flags 
+	LucidaConsole10_Bold_extents,
+	0xA	// Ascent 
 };
+
 //---------------------------------------------------------------
 // Group Name: LucidaConsole10
 // Designer: Imported System Font
@@ -425,402 +636,613 @@ const unsigned char LucidaConsole10_Bold[] =
 // Start Character: 32 " "
 // Stop Character: 127 "."
 //---------------------------------------------------------------
-const unsigned char LucidaConsole10[] = 
+const unsigned char LucidaConsole10_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x60,	// Number of Bitmaps 
-	0xD,	// Height 
-
-	// Bitmap Index (number of index entries 96)
- 	0x0, 0xC5, // Index 0 (offset: 197)
-	0x0, 0xD6, // Index 1 (offset: 214)
-	0x0, 0xE7, // Index 2 (offset: 231)
-	0x0, 0xF8, // Index 3 (offset: 248)
-	0x1, 0x9, // Index 4 (offset: 265)
-	0x1, 0x1A, // Index 5 (offset: 282)
-	0x1, 0x2B, // Index 6 (offset: 299)
-	0x1, 0x3C, // Index 7 (offset: 316)
-	0x1, 0x4D, // Index 8 (offset: 333)
-	0x1, 0x5E, // Index 9 (offset: 350)
-	0x1, 0x6F, // Index 10 (offset: 367)
-	0x1, 0x80, // Index 11 (offset: 384)
-	0x1, 0x91, // Index 12 (offset: 401)
-	0x1, 0xA2, // Index 13 (offset: 418)
-	0x1, 0xB3, // Index 14 (offset: 435)
-	0x1, 0xC4, // Index 15 (offset: 452)
-	0x1, 0xD5, // Index 16 (offset: 469)
-	0x1, 0xE6, // Index 17 (offset: 486)
-	0x1, 0xF7, // Index 18 (offset: 503)
-	0x2, 0x8, // Index 19 (offset: 520)
-	0x2, 0x19, // Index 20 (offset: 537)
-	0x2, 0x2A, // Index 21 (offset: 554)
-	0x2, 0x3B, // Index 22 (offset: 571)
-	0x2, 0x4C, // Index 23 (offset: 588)
-	0x2, 0x5D, // Index 24 (offset: 605)
-	0x2, 0x6E, // Index 25 (offset: 622)
-	0x2, 0x7F, // Index 26 (offset: 639)
-	0x2, 0x90, // Index 27 (offset: 656)
-	0x2, 0xA1, // Index 28 (offset: 673)
-	0x2, 0xB2, // Index 29 (offset: 690)
-	0x2, 0xC3, // Index 30 (offset: 707)
-	0x2, 0xD4, // Index 31 (offset: 724)
-	0x2, 0xE5, // Index 32 (offset: 741)
-	0x2, 0xF6, // Index 33 (offset: 758)
-	0x3, 0x7, // Index 34 (offset: 775)
-	0x3, 0x18, // Index 35 (offset: 792)
-	0x3, 0x29, // Index 36 (offset: 809)
-	0x3, 0x3A, // Index 37 (offset: 826)
-	0x3, 0x4B, // Index 38 (offset: 843)
-	0x3, 0x5C, // Index 39 (offset: 860)
-	0x3, 0x6D, // Index 40 (offset: 877)
-	0x3, 0x7E, // Index 41 (offset: 894)
-	0x3, 0x8F, // Index 42 (offset: 911)
-	0x3, 0xA0, // Index 43 (offset: 928)
-	0x3, 0xB1, // Index 44 (offset: 945)
-	0x3, 0xC2, // Index 45 (offset: 962)
-	0x3, 0xD3, // Index 46 (offset: 979)
-	0x3, 0xE4, // Index 47 (offset: 996)
-	0x3, 0xF5, // Index 48 (offset: 1013)
-	0x4, 0x6, // Index 49 (offset: 1030)
-	0x4, 0x17, // Index 50 (offset: 1047)
-	0x4, 0x28, // Index 51 (offset: 1064)
-	0x4, 0x39, // Index 52 (offset: 1081)
-	0x4, 0x4A, // Index 53 (offset: 1098)
-	0x4, 0x5B, // Index 54 (offset: 1115)
-	0x4, 0x6C, // Index 55 (offset: 1132)
-	0x4, 0x7D, // Index 56 (offset: 1149)
-	0x4, 0x8E, // Index 57 (offset: 1166)
-	0x4, 0x9F, // Index 58 (offset: 1183)
-	0x4, 0xB0, // Index 59 (offset: 1200)
-	0x4, 0xC1, // Index 60 (offset: 1217)
-	0x4, 0xD2, // Index 61 (offset: 1234)
-	0x4, 0xE3, // Index 62 (offset: 1251)
-	0x4, 0xF4, // Index 63 (offset: 1268)
-	0x5, 0x5, // Index 64 (offset: 1285)
-	0x5, 0x16, // Index 65 (offset: 1302)
-	0x5, 0x27, // Index 66 (offset: 1319)
-	0x5, 0x38, // Index 67 (offset: 1336)
-	0x5, 0x49, // Index 68 (offset: 1353)
-	0x5, 0x5A, // Index 69 (offset: 1370)
-	0x5, 0x6B, // Index 70 (offset: 1387)
-	0x5, 0x7C, // Index 71 (offset: 1404)
-	0x5, 0x8D, // Index 72 (offset: 1421)
-	0x5, 0x9E, // Index 73 (offset: 1438)
-	0x5, 0xAF, // Index 74 (offset: 1455)
-	0x5, 0xC0, // Index 75 (offset: 1472)
-	0x5, 0xD1, // Index 76 (offset: 1489)
-	0x5, 0xE2, // Index 77 (offset: 1506)
-	0x5, 0xF3, // Index 78 (offset: 1523)
-	0x6, 0x4, // Index 79 (offset: 1540)
-	0x6, 0x15, // Index 80 (offset: 1557)
-	0x6, 0x26, // Index 81 (offset: 1574)
-	0x6, 0x37, // Index 82 (offset: 1591)
-	0x6, 0x48, // Index 83 (offset: 1608)
-	0x6, 0x59, // Index 84 (offset: 1625)
-	0x6, 0x6A, // Index 85 (offset: 1642)
-	0x6, 0x7B, // Index 86 (offset: 1659)
-	0x6, 0x8C, // Index 87 (offset: 1676)
-	0x6, 0x9D, // Index 88 (offset: 1693)
-	0x6, 0xAE, // Index 89 (offset: 1710)
-	0x6, 0xBF, // Index 90 (offset: 1727)
-	0x6, 0xD0, // Index 91 (offset: 1744)
-	0x6, 0xE1, // Index 92 (offset: 1761)
-	0x6, 0xF2, // Index 93 (offset: 1778)
-	0x7, 0x3, // Index 94 (offset: 1795)
-	0x7, 0x14, // Index 95 (offset: 1812)
-
 	/* Index 0, character 32 " " (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 2, character 34 """ (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 8 pixels) */
-	0x8, 0x40,0x00,0xD0,0x03,0x70,0x00,0xDE,0x03,0x70,0x00,0x5E,0x00,0x50,0x00,0x10,0x00,
+	0x40,0x00,0xD0,0x03,0x70,0x00,0xDE,0x03,0x70,0x00,0x5E,0x00,0x50,0x00,0x10,0x00,
 
 	/* Index 4, character 36 "$" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x1C,0x02,0x32,0x02,0xFF,0x07,0x62,0x02,0xC2,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x1C,0x02,0x32,0x02,0xFF,0x07,0x62,0x02,0xC2,0x01,0x00,0x00,0x00,0x00,
 
 	/* Index 5, character 37 "%" (width: 8 pixels) */
-	0x8, 0x0C,0x02,0x12,0x01,0x92,0x00,0x6C,0x00,0xB0,0x01,0x48,0x02,0x44,0x02,0x82,0x01,
+	0x0C,0x02,0x12,0x01,0x92,0x00,0x6C,0x00,0xB0,0x01,0x48,0x02,0x44,0x02,0x82,0x01,
 
 	/* Index 6, character 38 "&" (width: 8 pixels) */
-	0x8, 0xC0,0x01,0x20,0x03,0x3C,0x02,0x32,0x02,0xD2,0x02,0x8C,0x03,0x80,0x03,0x60,0x00,
+	0xC0,0x01,0x20,0x03,0x3C,0x02,0x32,0x02,0xD2,0x02,0x8C,0x03,0x80,0x03,0x60,0x00,
 
 	/* Index 7, character 39 "'" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0xF8,0x01,0x0C,0x03,0x02,0x04,0x01,0x08,0x01,0x08,0x00,0x00,
+	0x00,0x00,0x00,0x00,0xF8,0x01,0x0C,0x03,0x02,0x04,0x01,0x08,0x01,0x08,0x00,0x00,
 
 	/* Index 9, character 41 ")" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x01,0x08,0x01,0x08,0x02,0x04,0x04,0x02,0xF8,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x01,0x08,0x01,0x08,0x02,0x04,0x04,0x02,0xF8,0x01,0x00,0x00,0x00,0x00,
 
 	/* Index 10, character 42 "*" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x04,0x00,0x38,0x00,0x16,0x00,0x10,0x00,0x38,0x00,0x04,0x00,0x00,0x00,
+	0x00,0x00,0x04,0x00,0x38,0x00,0x16,0x00,0x10,0x00,0x38,0x00,0x04,0x00,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 8 pixels) */
-	0x8, 0x40,0x00,0x40,0x00,0x40,0x00,0xF8,0x03,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
+	0x40,0x00,0x40,0x00,0x40,0x00,0xF8,0x03,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
 
 	/* Index 12, character 44 "," (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x00,0x0B,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x0B,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 13, character 45 "-" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
+	0x00,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
 
 	/* Index 14, character 46 "." (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 15, character 47 "/" (width: 8 pixels) */
-	0x8, 0x00,0x08,0x00,0x06,0x00,0x01,0xC0,0x00,0x30,0x00,0x08,0x00,0x06,0x00,0x01,0x00,
+	0x00,0x08,0x00,0x06,0x00,0x01,0xC0,0x00,0x30,0x00,0x08,0x00,0x06,0x00,0x01,0x00,
 
 	/* Index 16, character 48 "0" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xF8,0x00,0x04,0x03,0x02,0x02,0x02,0x02,0x04,0x03,0xF8,0x00,0x00,0x00,
+	0x00,0x00,0xF8,0x00,0x04,0x03,0x02,0x02,0x02,0x02,0x04,0x03,0xF8,0x00,0x00,0x00,
 
 	/* Index 17, character 49 "1" (width: 8 pixels) */
-	0x8, 0x04,0x02,0x04,0x02,0x02,0x02,0xFE,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,
+	0x04,0x02,0x04,0x02,0x02,0x02,0xFE,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,
 
 	/* Index 18, character 50 "2" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x02,0x03,0x82,0x02,0x42,0x02,0x22,0x02,0x1C,0x02,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x02,0x03,0x82,0x02,0x42,0x02,0x22,0x02,0x1C,0x02,0x00,0x00,0x00,0x00,
 
 	/* Index 19, character 51 "3" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x02,0x02,0x22,0x02,0x22,0x02,0x52,0x02,0xCC,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x02,0x02,0x22,0x02,0x22,0x02,0x52,0x02,0xCC,0x01,0x00,0x00,0x00,0x00,
 
 	/* Index 20, character 52 "4" (width: 8 pixels) */
-	0x8, 0xC0,0x00,0xA0,0x00,0x98,0x00,0x84,0x00,0xFE,0x03,0x80,0x00,0x00,0x00,0x00,0x00,
+	0xC0,0x00,0xA0,0x00,0x98,0x00,0x84,0x00,0xFE,0x03,0x80,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 21, character 53 "5" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x1E,0x02,0x12,0x02,0x12,0x02,0xE2,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x1E,0x02,0x12,0x02,0x12,0x02,0xE2,0x01,0x00,0x00,0x00,0x00,
 
 	/* Index 22, character 54 "6" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xF8,0x00,0x24,0x01,0x12,0x02,0x12,0x02,0x12,0x02,0xE0,0x01,0x00,0x00,
+	0x00,0x00,0xF8,0x00,0x24,0x01,0x12,0x02,0x12,0x02,0x12,0x02,0xE0,0x01,0x00,0x00,
 
 	/* Index 23, character 55 "7" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x02,0x00,0x02,0x03,0xC2,0x00,0x32,0x00,0x0A,0x00,0x06,0x00,0x00,0x00,
+	0x00,0x00,0x02,0x00,0x02,0x03,0xC2,0x00,0x32,0x00,0x0A,0x00,0x06,0x00,0x00,0x00,
 
 	/* Index 24, character 56 "8" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xCC,0x01,0x32,0x02,0x22,0x02,0x22,0x02,0x72,0x02,0xCC,0x01,0x00,0x00,
+	0x00,0x00,0xCC,0x01,0x32,0x02,0x22,0x02,0x22,0x02,0x72,0x02,0xCC,0x01,0x00,0x00,
 
 	/* Index 25, character 57 "9" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x3C,0x00,0x42,0x02,0x42,0x02,0x42,0x02,0x24,0x01,0xF8,0x00,0x00,0x00,
+	0x00,0x00,0x3C,0x00,0x42,0x02,0x42,0x02,0x42,0x02,0x24,0x01,0xF8,0x00,0x00,0x00,
 
 	/* Index 26, character 58 ":" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x03,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x03,0x18,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 27, character 59 ";" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x18,0x0B,0x18,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x18,0x0B,0x18,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 28, character 60 "<" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x40,0x00,0x40,0x00,0xA0,0x00,0x10,0x01,0x10,0x01,0x08,0x02,0x00,0x00,
+	0x00,0x00,0x40,0x00,0x40,0x00,0xA0,0x00,0x10,0x01,0x10,0x01,0x08,0x02,0x00,0x00,
 
 	/* Index 29, character 61 "=" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x00,0x00,
+	0x00,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x00,0x00,
 
 	/* Index 30, character 62 ">" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x08,0x02,0x10,0x01,0x10,0x01,0xA0,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
+	0x00,0x00,0x08,0x02,0x10,0x01,0x10,0x01,0xA0,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
 
 	/* Index 31, character 63 "?" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x06,0x00,0x02,0x00,0x42,0x02,0x22,0x00,0x12,0x00,0x0C,0x00,0x00,0x00,
+	0x00,0x00,0x06,0x00,0x02,0x00,0x42,0x02,0x22,0x00,0x12,0x00,0x0C,0x00,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 8 pixels) */
-	0x8, 0xF8,0x00,0x0C,0x01,0x76,0x02,0x9A,0x02,0x8A,0x02,0x4A,0x03,0xFC,0x00,0x80,0x00,
+	0xF8,0x00,0x0C,0x01,0x76,0x02,0x9A,0x02,0x8A,0x02,0x4A,0x03,0xFC,0x00,0x80,0x00,
 
 	/* Index 33, character 65 "A" (width: 8 pixels) */
-	0x8, 0x00,0x02,0x80,0x01,0xF0,0x00,0x8C,0x00,0x8C,0x00,0xF0,0x00,0x80,0x01,0x00,0x02,
+	0x00,0x02,0x80,0x01,0xF0,0x00,0x8C,0x00,0x8C,0x00,0xF0,0x00,0x80,0x01,0x00,0x02,
 
 	/* Index 34, character 66 "B" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xFC,0x03,0x24,0x02,0x24,0x02,0x24,0x02,0x24,0x02,0xD8,0x01,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0x24,0x02,0x24,0x02,0x24,0x02,0x24,0x02,0xD8,0x01,0x00,0x00,
 
 	/* Index 35, character 67 "C" (width: 8 pixels) */
-	0x8, 0xF0,0x00,0x08,0x01,0x04,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0x00,0x00,
+	0xF0,0x00,0x08,0x01,0x04,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0x00,0x00,
 
 	/* Index 36, character 68 "D" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xFC,0x03,0x04,0x02,0x04,0x02,0x04,0x02,0x08,0x01,0xF0,0x00,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0x04,0x02,0x04,0x02,0x04,0x02,0x08,0x01,0xF0,0x00,0x00,0x00,
 
 	/* Index 37, character 69 "E" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xFC,0x03,0x44,0x02,0x44,0x02,0x44,0x02,0x44,0x02,0x04,0x02,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0x44,0x02,0x44,0x02,0x44,0x02,0x44,0x02,0x04,0x02,0x00,0x00,
 
 	/* Index 38, character 70 "F" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xFC,0x03,0x44,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x04,0x00,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0x44,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x04,0x00,0x00,0x00,
 
 	/* Index 39, character 71 "G" (width: 8 pixels) */
-	0x8, 0xF0,0x00,0x08,0x01,0x04,0x02,0x04,0x02,0x44,0x02,0x44,0x02,0xC4,0x03,0x00,0x00,
+	0xF0,0x00,0x08,0x01,0x04,0x02,0x04,0x02,0x44,0x02,0x44,0x02,0xC4,0x03,0x00,0x00,
 
 	/* Index 40, character 72 "H" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xFC,0x03,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xFC,0x03,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xFC,0x03,0x00,0x00,
 
 	/* Index 41, character 73 "I" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x04,0x02,0x04,0x02,0xFC,0x03,0x04,0x02,0x04,0x02,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x04,0x02,0x04,0x02,0xFC,0x03,0x04,0x02,0x04,0x02,0x00,0x00,0x00,0x00,
 
 	/* Index 42, character 74 "J" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0xFC,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0xFC,0x01,0x00,0x00,0x00,0x00,
 
 	/* Index 43, character 75 "K" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xFC,0x03,0x20,0x00,0x60,0x00,0x90,0x00,0x08,0x01,0x04,0x02,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0x20,0x00,0x60,0x00,0x90,0x00,0x08,0x01,0x04,0x02,0x00,0x00,
 
 	/* Index 44, character 76 "L" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xFC,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,
 
 	/* Index 45, character 77 "M" (width: 8 pixels) */
-	0x8, 0xFC,0x03,0x0C,0x00,0x70,0x00,0x80,0x00,0x70,0x00,0x0C,0x00,0xFC,0x03,0x00,0x00,
+	0xFC,0x03,0x0C,0x00,0x70,0x00,0x80,0x00,0x70,0x00,0x0C,0x00,0xFC,0x03,0x00,0x00,
 
 	/* Index 46, character 78 "N" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xFC,0x03,0x08,0x00,0x30,0x00,0xC0,0x00,0x00,0x01,0xFC,0x03,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0x08,0x00,0x30,0x00,0xC0,0x00,0x00,0x01,0xFC,0x03,0x00,0x00,
 
 	/* Index 47, character 79 "O" (width: 8 pixels) */
-	0x8, 0xF0,0x00,0x08,0x01,0x04,0x02,0x04,0x02,0x04,0x02,0x08,0x01,0xF0,0x00,0x00,0x00,
+	0xF0,0x00,0x08,0x01,0x04,0x02,0x04,0x02,0x04,0x02,0x08,0x01,0xF0,0x00,0x00,0x00,
 
 	/* Index 48, character 80 "P" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xFC,0x03,0x44,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x38,0x00,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0x44,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x38,0x00,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 8 pixels) */
-	0x8, 0xF0,0x00,0x08,0x01,0x04,0x02,0x04,0x02,0x04,0x02,0x08,0x05,0xF0,0x0C,0x00,0x08,
+	0xF0,0x00,0x08,0x01,0x04,0x02,0x04,0x02,0x04,0x02,0x08,0x05,0xF0,0x0C,0x00,0x08,
 
 	/* Index 50, character 82 "R" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xFC,0x03,0x44,0x00,0x44,0x00,0xC4,0x00,0x38,0x01,0x00,0x02,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0x44,0x00,0x44,0x00,0xC4,0x00,0x38,0x01,0x00,0x02,0x00,0x00,
 
 	/* Index 51, character 83 "S" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x18,0x02,0x24,0x02,0x24,0x02,0x24,0x02,0x44,0x02,0x84,0x01,0x00,0x00,
+	0x00,0x00,0x18,0x02,0x24,0x02,0x24,0x02,0x24,0x02,0x44,0x02,0x84,0x01,0x00,0x00,
 
 	/* Index 52, character 84 "T" (width: 8 pixels) */
-	0x8, 0x04,0x00,0x04,0x00,0x04,0x00,0xFC,0x03,0x04,0x00,0x04,0x00,0x04,0x00,0x00,0x00,
+	0x04,0x00,0x04,0x00,0x04,0x00,0xFC,0x03,0x04,0x00,0x04,0x00,0x04,0x00,0x00,0x00,
 
 	/* Index 53, character 85 "U" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xFC,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0xFC,0x01,0x00,0x00,
+	0x00,0x00,0xFC,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0xFC,0x01,0x00,0x00,
 
 	/* Index 54, character 86 "V" (width: 8 pixels) */
-	0x8, 0x04,0x00,0x38,0x00,0xC0,0x01,0x00,0x03,0x80,0x01,0x60,0x00,0x18,0x00,0x04,0x00,
+	0x04,0x00,0x38,0x00,0xC0,0x01,0x00,0x03,0x80,0x01,0x60,0x00,0x18,0x00,0x04,0x00,
 
 	/* Index 55, character 87 "W" (width: 8 pixels) */
-	0x8, 0x1C,0x00,0xE0,0x01,0x80,0x03,0x70,0x00,0xE0,0x00,0x00,0x03,0xF0,0x01,0x0C,0x00,
+	0x1C,0x00,0xE0,0x01,0x80,0x03,0x70,0x00,0xE0,0x00,0x00,0x03,0xF0,0x01,0x0C,0x00,
 
 	/* Index 56, character 88 "X" (width: 8 pixels) */
-	0x8, 0x04,0x02,0x08,0x01,0x90,0x00,0x60,0x00,0x60,0x00,0x90,0x00,0x08,0x01,0x04,0x02,
+	0x04,0x02,0x08,0x01,0x90,0x00,0x60,0x00,0x60,0x00,0x90,0x00,0x08,0x01,0x04,0x02,
 
 	/* Index 57, character 89 "Y" (width: 8 pixels) */
-	0x8, 0x04,0x00,0x08,0x00,0x30,0x00,0xC0,0x03,0x30,0x00,0x08,0x00,0x04,0x00,0x00,0x00,
+	0x04,0x00,0x08,0x00,0x30,0x00,0xC0,0x03,0x30,0x00,0x08,0x00,0x04,0x00,0x00,0x00,
 
 	/* Index 58, character 90 "Z" (width: 8 pixels) */
-	0x8, 0x04,0x02,0x04,0x03,0x84,0x02,0x44,0x02,0x24,0x02,0x14,0x02,0x0C,0x02,0x00,0x00,
+	0x04,0x02,0x04,0x03,0x84,0x02,0x44,0x02,0x24,0x02,0x14,0x02,0x0C,0x02,0x00,0x00,
 
 	/* Index 59, character 91 "[" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0x01,0x08,0x01,0x08,0x01,0x08,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0x01,0x08,0x01,0x08,0x01,0x08,0x00,0x00,
 
 	/* Index 60, character 92 "\" (width: 8 pixels) */
-	0x8, 0x01,0x00,0x06,0x00,0x08,0x00,0x30,0x00,0xC0,0x00,0x00,0x01,0x00,0x06,0x00,0x08,
+	0x01,0x00,0x06,0x00,0x08,0x00,0x30,0x00,0xC0,0x00,0x00,0x01,0x00,0x06,0x00,0x08,
 
 	/* Index 61, character 93 "]" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x01,0x08,0x01,0x08,0x01,0x08,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x01,0x08,0x01,0x08,0x01,0x08,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 62, character 94 "^" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x80,0x00,0x60,0x00,0x18,0x00,0x0E,0x00,0x70,0x00,0x80,0x00,0x00,0x00,
+	0x00,0x00,0x80,0x00,0x60,0x00,0x18,0x00,0x0E,0x00,0x70,0x00,0x80,0x00,0x00,0x00,
 
 	/* Index 63, character 95 "_" (width: 8 pixels) */
-	0x8, 0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
+	0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
 
 	/* Index 64, character 96 "`" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x80,0x01,0x48,0x02,0x48,0x02,0x48,0x02,0xF0,0x03,0x00,0x02,0x00,0x00,
+	0x00,0x00,0x80,0x01,0x48,0x02,0x48,0x02,0x48,0x02,0xF0,0x03,0x00,0x02,0x00,0x00,
 
 	/* Index 66, character 98 "b" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xFF,0x03,0x10,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0xF0,0x01,0x00,0x00,
+	0x00,0x00,0xFF,0x03,0x10,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0xF0,0x01,0x00,0x00,
 
 	/* Index 67, character 99 "c" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xE0,0x00,0x10,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x00,0x00,
+	0x00,0x00,0xE0,0x00,0x10,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x00,0x00,
 
 	/* Index 68, character 100 "d" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x10,0x01,0xFF,0x03,0x00,0x00,
+	0x00,0x00,0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x10,0x01,0xFF,0x03,0x00,0x00,
 
 	/* Index 69, character 101 "e" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xE0,0x01,0x58,0x02,0x48,0x02,0x48,0x02,0x48,0x02,0x70,0x02,0x00,0x00,
+	0x00,0x00,0xE0,0x01,0x58,0x02,0x48,0x02,0x48,0x02,0x48,0x02,0x70,0x02,0x00,0x00,
 
 	/* Index 70, character 102 "f" (width: 8 pixels) */
-	0x8, 0x08,0x00,0x08,0x00,0xFE,0x03,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x00,0x00,
+	0x08,0x00,0x08,0x00,0xFE,0x03,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xF0,0x01,0x08,0x12,0x08,0x12,0x08,0x12,0x10,0x11,0xF8,0x0F,0x00,0x00,
+	0x00,0x00,0xF0,0x01,0x08,0x12,0x08,0x12,0x08,0x12,0x10,0x11,0xF8,0x0F,0x00,0x00,
 
 	/* Index 72, character 104 "h" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xFF,0x03,0x10,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x03,0x00,0x00,
+	0x00,0x00,0xFF,0x03,0x10,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x03,0x00,0x00,
 
 	/* Index 73, character 105 "i" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x08,0x00,0x08,0x00,0x0B,0x00,0xFB,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x08,0x00,0x08,0x00,0x0B,0x00,0xFB,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 74, character 106 "j" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x08,0x10,0x08,0x10,0x0B,0x10,0xFB,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x08,0x10,0x08,0x10,0x0B,0x10,0xFB,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 75, character 107 "k" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xFF,0x03,0x40,0x00,0xA0,0x00,0x10,0x01,0x08,0x02,0x00,0x00,0x00,0x00,
+	0x00,0x00,0xFF,0x03,0x40,0x00,0xA0,0x00,0x10,0x01,0x08,0x02,0x00,0x00,0x00,0x00,
 
 	/* Index 76, character 108 "l" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 77, character 109 "m" (width: 8 pixels) */
-	0x8, 0xF8,0x03,0x10,0x00,0x08,0x00,0xF8,0x03,0x10,0x00,0x08,0x00,0xF8,0x03,0x00,0x00,
+	0xF8,0x03,0x10,0x00,0x08,0x00,0xF8,0x03,0x10,0x00,0x08,0x00,0xF8,0x03,0x00,0x00,
 
 	/* Index 78, character 110 "n" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xF8,0x03,0x10,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x03,0x00,0x00,
+	0x00,0x00,0xF8,0x03,0x10,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x03,0x00,0x00,
 
 	/* Index 79, character 111 "o" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0xF0,0x01,0x00,0x00,
+	0x00,0x00,0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0xF0,0x01,0x00,0x00,
 
 	/* Index 80, character 112 "p" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xF8,0x1F,0x10,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0xF0,0x01,0x00,0x00,
+	0x00,0x00,0xF8,0x1F,0x10,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0xF0,0x01,0x00,0x00,
 
 	/* Index 81, character 113 "q" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x10,0x01,0xF8,0x1F,0x00,0x00,
+	0x00,0x00,0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x10,0x01,0xF8,0x1F,0x00,0x00,
 
 	/* Index 82, character 114 "r" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xF8,0x03,0x10,0x00,0x08,0x00,0x08,0x00,0x18,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0xF8,0x03,0x10,0x00,0x08,0x00,0x08,0x00,0x18,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x30,0x02,0x28,0x02,0x48,0x02,0x48,0x02,0x88,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x30,0x02,0x28,0x02,0x48,0x02,0x48,0x02,0x88,0x01,0x00,0x00,0x00,0x00,
 
 	/* Index 84, character 116 "t" (width: 8 pixels) */
-	0x8, 0x08,0x00,0x08,0x00,0xFC,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x00,0x00,0x00,0x00,
+	0x08,0x00,0x08,0x00,0xFC,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x00,0x00,0x00,0x00,
 
 	/* Index 85, character 117 "u" (width: 8 pixels) */
-	0x8, 0x00,0x00,0xF8,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x01,0xF8,0x03,0x00,0x00,
+	0x00,0x00,0xF8,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x01,0xF8,0x03,0x00,0x00,
 
 	/* Index 86, character 118 "v" (width: 8 pixels) */
-	0x8, 0x08,0x00,0x70,0x00,0x80,0x01,0x00,0x02,0x80,0x01,0x70,0x00,0x08,0x00,0x00,0x00,
+	0x08,0x00,0x70,0x00,0x80,0x01,0x00,0x02,0x80,0x01,0x70,0x00,0x08,0x00,0x00,0x00,
 
 	/* Index 87, character 119 "w" (width: 8 pixels) */
-	0x8, 0x18,0x00,0xE0,0x00,0x80,0x03,0x70,0x00,0xE0,0x00,0x00,0x03,0xE0,0x00,0x18,0x00,
+	0x18,0x00,0xE0,0x00,0x80,0x03,0x70,0x00,0xE0,0x00,0x00,0x03,0xE0,0x00,0x18,0x00,
 
 	/* Index 88, character 120 "x" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x08,0x02,0x10,0x01,0xE0,0x00,0xE0,0x00,0x10,0x01,0x08,0x02,0x00,0x00,
+	0x00,0x00,0x08,0x02,0x10,0x01,0xE0,0x00,0xE0,0x00,0x10,0x01,0x08,0x02,0x00,0x00,
 
 	/* Index 89, character 121 "y" (width: 8 pixels) */
-	0x8, 0x08,0x10,0x30,0x10,0xC0,0x18,0x00,0x0F,0x00,0x03,0xC0,0x00,0x30,0x00,0x08,0x00,
+	0x08,0x10,0x30,0x10,0xC0,0x18,0x00,0x0F,0x00,0x03,0xC0,0x00,0x30,0x00,0x08,0x00,
 
 	/* Index 90, character 122 "z" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x08,0x02,0x08,0x03,0x88,0x02,0x48,0x02,0x28,0x02,0x18,0x02,0x00,0x00,
+	0x00,0x00,0x08,0x02,0x08,0x03,0x88,0x02,0x48,0x02,0x28,0x02,0x18,0x02,0x00,0x00,
 
 	/* Index 91, character 123 "{" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x20,0x00,0x20,0x00,0xDF,0x07,0x01,0x08,0x01,0x08,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x20,0x00,0x20,0x00,0xDF,0x07,0x01,0x08,0x01,0x08,0x00,0x00,0x00,0x00,
 
 	/* Index 92, character 124 "|" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 93, character 125 "}" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0x01,0x08,0x01,0x08,0xDE,0x07,0x20,0x00,0x20,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x01,0x08,0x01,0x08,0xDE,0x07,0x20,0x00,0x20,0x00,0x00,0x00,
 
 	/* Index 94, character 126 "~" (width: 8 pixels) */
-	0x8, 0x80,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x40,0x00,
+	0x80,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x40,0x00,
 
 	/* Index 95, character 127 "." (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x00,0xFC,0x03,0x04,0x02,0x04,0x02,0xFC,0x03,0x00,0x00,0x00,0x00
+	0x00,0x00,0x00,0x00,0xFC,0x03,0x04,0x02,0x04,0x02,0xFC,0x03,0x00,0x00,0x00,0x00
+};
+
+// Offset of each bitmap in LucidaConsole10_bitmaps
+const unsigned short LucidaConsole10_offsets[] = 
+{
+	0x0,	// Index 0
+	0x10,	// Index 1
+	0x20,	// Index 2
+	0x30,	// Index 3
+	0x40,	// Index 4
+	0x50,	// Index 5
+	0x60,	// Index 6
+	0x70,	// Index 7
+	0x80,	// Index 8
+	0x90,	// Index 9
+	0xA0,	// Index 10
+	0xB0,	// Index 11
+	0xC0,	// Index 12
+	0xD0,	// Index 13
+	0xE0,	// Index 14
+	0xF0,	// Index 15
+	0x100,	// Index 16
+	0x110,	// Index 17
+	0x120,	// Index 18
+	0x130,	// Index 19
+	0x140,	// Index 20
+	0x150,	// Index 21
+	0x160,	// Index 22
+	0x170,	// Index 23
+	0x180,	// Index 24
+	0x190,	// Index 25
+	0x1A0,	// Index 26
+	0x1B0,	// Index 27
+	0x1C0,	// Index 28
+	0x1D0,	// Index 29
+	0x1E0,	// Index 30
+	0x1F0,	// Index 31
+	0x200,	// Index 32
+	0x210,	// Index 33
+	0x220,	// Index 34
+	0x230,	// Index 35
+	0x240,	// Index 36
+	0x250,	// Index 37
+	0x260,	// Index 38
+	0x270,	// Index 39
+	0x280,	// Index 40
+	0x290,	// Index 41
+	0x2A0,	// Index 42
+	0x2B0,	// Index 43
+	0x2C0,	// Index 44
+	0x2D0,	// Index 45
+	0x2E0,	// Index 46
+	0x2F0,	// Index 47
+	0x300,	// Index 48
+	0x310,	// Index 49
+	0x320,	// Index 50
+	0x330,	// Index 51
+	0x340,	// Index 52
+	0x350,	// Index 53
+	0x360,	// Index 54
+	0x370,	// Index 55
+	0x380,	// Index 56
+	0x390,	// Index 57
+	0x3A0,	// Index 58
+	0x3B0,	// Index 59
+	0x3C0,	// Index 60
+	0x3D0,	// Index 61
+	0x3E0,	// Index 62
+	0x3F0,	// Index 63
+	0x400,	// Index 64
+	0x410,	// Index 65
+	0x420,	// Index 66
+	0x430,	// Index 67
+	0x440,	// Index 68
+	0x450,	// Index 69
+	0x460,	// Index 70
+	0x470,	// Index 71
+	0x480,	// Index 72
+	0x490,	// Index 73
+	0x4A0,	// Index 74
+	0x4B0,	// Index 75
+	0x4C0,	// Index 76
+	0x4D0,	// Index 77
+	0x4E0,	// Index 78
+	0x4F0,	// Index 79
+	0x500,	// Index 80
+	0x510,	// Index 81
+	0x520,	// Index 82
+	0x530,	// Index 83
+	0x540,	// Index 84
+	0x550,	// Index 85
+	0x560,	// Index 86
+	0x570,	// Index 87
+	0x580,	// Index 88
+	0x590,	// Index 89
+	0x5A0,	// Index 90
+	0x5B0,	// Index 91
+	0x5C0,	// Index 92
+	0x5D0,	// Index 93
+	0x5E0,	// Index 94
+	0x5F0,	// Index 95
+};
+
+// Width of each bitmap in pixels
+const unsigned char LucidaConsole10_widths[] = 
+{
+	0x8,	// Index 0
+	0x8,	// Index 1
+	0x8,	// Index 2
+	0x8,	// Index 3
+	0x8,	// Index 4
+	0x8,	// Index 5
+	0x8,	// Index 6
+	0x8,	// Index 7
+	0x8,	// Index 8
+	0x8,	// Index 9
+	0x8,	// Index 10
+	0x8,	// Index 11
+	0x8,	// Index 12
+	0x8,	// Index 13
+	0x8,	// Index 14
+	0x8,	// Index 15
+	0x8,	// Index 16
+	0x8,	// Index 17
+	0x8,	// Index 18
+	0x8,	// Index 19
+	0x8,	// Index 20
+	0x8,	// Index 21
+	0x8,	// Index 22
+	0x8,	// Index 23
+	0x8,	// Index 24
+	0x8,	// Index 25
+	0x8,	// Index 26
+	0x8,	// Index 27
+	0x8,	// Index 28
+	0x8,	// Index 29
+	0x8,	// Index 30
+	0x8,	// Index 31
+	0x8,	// Index 32
+	0x8,	// Index 33
+	0x8,	// Index 34
+	0x8,	// Index 35
+	0x8,	// Index 36
+	0x8,	// Index 37
+	0x8,	// Index 38
+	0x8,	// Index 39
+	0x8,	// Index 40
+	0x8,	// Index 41
+	0x8,	// Index 42
+	0x8,	// Index 43
+	0x8,	// Index 44
+	0x8,	// Index 45
+	0x8,	// Index 46
+	0x8,	// Index 47
+	0x8,	// Index 48
+	0x8,	// Index 49
+	0x8,	// Index 50
+	0x8,	// Index 51
+	0x8,	// Index 52
+	0x8,	// Index 53
+	0x8,	// Index 54
+	0x8,	// Index 55
+	0x8,	// Index 56
+	0x8,	// Index 57
+	0x8,	// Index 58
+	0x8,	// Index 59
+	0x8,	// Index 60
+	0x8,	// Index 61
+	0x8,	// Index 62
+	0x8,	// Index 63
+	0x8,	// Index 64
+	0x8,	// Index 65
+	0x8,	// Index 66
+	0x8,	// Index 67
+	0x8,	// Index 68
+	0x8,	// Index 69
+	0x8,	// Index 70
+	0x8,	// Index 71
+	0x8,	// Index 72
+	0x8,	// Index 73
+	0x8,	// Index 74
+	0x8,	// Index 75
+	0x8,	// Index 76
+	0x8,	// Index 77
+	0x8,	// Index 78
+	0x8,	// Index 79
+	0x8,	// Index 80
+	0x8,	// Index 81
+	0x8,	// Index 82
+	0x8,	// Index 83
+	0x8,	// Index 84
+	0x8,	// Index 85
+	0x8,	// Index 86
+	0x8,	// Index 87
+	0x8,	// Index 88
+	0x8,	// Index 89
+	0x8,	// Index 90
+	0x8,	// Index 91
+	0x8,	// Index 92
+	0x8,	// Index 93
+	0x8,	// Index 94
+	0x8,	// Index 95
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char LucidaConsole10_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x9, 0x0,	// Index 1
+	0xA, 0x0,	// Index 2
+	0x9, 0x0,	// Index 3
+	0xA, 0x1,	// Index 4
+	0x9, 0x0,	// Index 5
+	0x9, 0x0,	// Index 6
+	0xA, 0x0,	// Index 7
+	0xA, 0x2,	// Index 8
+	0xA, 0x2,	// Index 9
+	0x9, 0x0,	// Index 10
+	0x7, 0x0,	// Index 11
+	0x2, 0x2,	// Index 12
+	0x4, 0x0,	// Index 13
+	0x2, 0x0,	// Index 14
+	0xA, 0x2,	// Index 15
+	0x9, 0x0,	// Index 16
+	0x9, 0x0,	// Index 17
+	0x9, 0x0,	// Index 18
+	0x9, 0x0,	// Index 19
+	0x9, 0x0,	// Index 20
+	0x9, 0x0,	// Index 21
+	0x9, 0x0,	// Index 22
+	0x9, 0x0,	// Index 23
+	0x9, 0x0,	// Index 24
+	0x9, 0x0,	// Index 25
+	0x7, 0x0,	// Index 26
+	0x7, 0x2,	// Index 27
+	0x7, 0x0,	// Index 28
+	0x5, 0x0,	// Index 29
+	0x7, 0x0,	// Index 30
+	0x9, 0x0,	// Index 31
+	0x9, 0x0,	// Index 32
+	0x8, 0x0,	// Index 33
+	0x8, 0x0,	// Index 34
+	0x8, 0x0,	// Index 35
+	0x8, 0x0,	// Index 36
+	0x8, 0x0,	// Index 37
+	0x8, 0x0,	// Index 38
+	0x8, 0x0,	// Index 39
+	0x8, 0x0,	// Index 40
+	0x8, 0x0,	// Index 41
+	0x8, 0x0,	// Index 42
+	0x8, 0x0,	// Index 43
+	0x8, 0x0,	// Index 44
+	0x8, 0x0,	// Index 45
+	0x8, 0x0,	// Index 46
+	0x8, 0x0,	// Index 47
+	0x8, 0x0,	// Index 48
+	0x8, 0x2,	// Index 49
+	0x8, 0x0,	// Index 50
+	0x8, 0x0,	// Index 51
+	0x8, 0x0,	// Index 52
+	0x8, 0x0,	// Index 53
+	0x8, 0x0,	// Index 54
+	0x8, 0x0,	// Index 55
+	0x8, 0x0,	// Index 56
+	0x8, 0x0,	// Index 57
+	0x8, 0x0,	// Index 58
+	0xA, 0x2,	// Index 59
+	0xA, 0x2,	// Index 60
+	0xA, 0x2,	// Index 61
+	0x9, 0x0,	// Index 62
+	0x0, 0x1,	// Index 63
+	0xA, 0x0,	// Index 64
+	0x7, 0x0,	// Index 65
+	0xA, 0x0,	// Index 66
+	0x7, 0x0,	// Index 67
+	0xA, 0x0,	// Index 68
+	0x7, 0x0,	// Index 69
+	0xA, 0x0,	// Index 70
+	0x7, 0x3,	// Index 71
+	0xA, 0x0,	// Index 72
+	0xA, 0x0,	// Index 73
+	0xA, 0x3,	// Index 74
+	0xA, 0x0,	// Index 75
+	0xA, 0x0,	// Index 76
+	0x7, 0x0,	// Index 77
+	0x7, 0x0,	// Index 78
+	0x7, 0x0,	// Index 79
+	0x7, 0x3,	// Index 80
+	0x7, 0x3,	// Index 81
+	0x7, 0x0,	// Index 82
+	0x7, 0x0,	// Index 83
+	0x8, 0x0,	// Index 84
+	0x7, 0x0,	// Index 85
+	0x7, 0x0,	// Index 86
+	0x7, 0x0,	// Index 87
+	0x7, 0x0,	// Index 88
+	0x7, 0x3,	// Index 89
+	0x7, 0x0,	// Index 90
+	0xA, 0x2,	// Index 91
+	0xA, 0x2,	// Index 92
+	0xA, 0x2,	// Index 93
+	0x4, 0x0,	// Index 94
+	0x8, 0x0,	// Index 95
+};
+
+const font_t LucidaConsole10 = 
+{
+	LucidaConsole10_bitmaps,
+	LucidaConsole10_offsets,
+	LucidaConsole10_widths,
+	0x20,	// Start character 
+	0x60,	// Number of bitmaps 
+	0xD,	// Height 
+	0,	// Flags 
+	LucidaConsole10_extents,
+	0xA	// Ascent 
 };
+
 //---------------------------------------------------------------
 // Group Name: LucidaConsole8
 // Designer: Imported System Font
@@ -834,398 +1256,607 @@ const unsigned char LucidaConsole10[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char LucidaConsole8[] = 
+const unsigned char LucidaConsole8_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0xA,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xD2, // Index 1 (offset: 210)
-	0x0, 0xE1, // Index 2 (offset: 225)
-	0x0, 0xF0, // Index 3 (offset: 240)
-	0x0, 0xFF, // Index 4 (offset: 255)
-	0x1, 0xE, // Index 5 (offset: 270)
-	0x1, 0x1D, // Index 6 (offset: 285)
-	0x1, 0x2C, // Index 7 (offset: 300)
-	0x1, 0x3B, // Index 8 (offset: 315)
-	0x1, 0x4A, // Index 9 (offset: 330)
-	0x1, 0x59, // Index 10 (offset: 345)
-	0x1, 0x68, // Index 11 (offset: 360)
-	0x1, 0x77, // Index 12 (offset: 375)
-	0x1, 0x86, // Index 13 (offset: 390)
-	0x1, 0x95, // Index 14 (offset: 405)
-	0x1, 0xA4, // Index 15 (offset: 420)
-	0x1, 0xB3, // Index 16 (offset: 435)
-	0x1, 0xC2, // Index 17 (offset: 450)
-	0x1, 0xD1, // Index 18 (offset: 465)
-	0x1, 0xE0, // Index 19 (offset: 480)
-	0x1, 0xEF, // Index 20 (offset: 495)
-	0x1, 0xFE, // Index 21 (offset: 510)
-	0x2, 0xD, // Index 22 (offset: 525)
-	0x2, 0x1C, // Index 23 (offset: 540)
-	0x2, 0x2B, // Index 24 (offset: 555)
-	0x2, 0x3A, // Index 25 (offset: 570)
-	0x2, 0x49, // Index 26 (offset: 585)
-	0x2, 0x58, // Index 27 (offset: 600)
-	0x2, 0x67, // Index 28 (offset: 615)
-	0x2, 0x76, // Index 29 (offset: 630)
-	0x2, 0x85, // Index 30 (offset: 645)
-	0x2, 0x94, // Index 31 (offset: 660)
-	0x2, 0xA3, // Index 32 (offset: 675)
-	0x2, 0xB2, // Index 33 (offset: 690)
-	0x2, 0xC1, // Index 34 (offset: 705)
-	0x2, 0xD0, // Index 35 (offset: 720)
-	0x2, 0xDF, // Index 36 (offset: 735)
-	0x2, 0xEE, // Index 37 (offset: 750)
-	0x2, 0xFD, // Index 38 (offset: 765)
-	0x3, 0xC, // Index 39 (offset: 780)
-	0x3, 0x1B, // Index 40 (offset: 795)
-	0x3, 0x2A, // Index 41 (offset: 810)
-	0x3, 0x39, // Index 42 (offset: 825)
-	0x3, 0x48, // Index 43 (offset: 840)
-	0x3, 0x57, // Index 44 (offset: 855)
-	0x3, 0x66, // Index 45 (offset: 870)
-	0x3, 0x75, // Index 46 (offset: 885)
-	0x3, 0x84, // Index 47 (offset: 900)
-	0x3, 0x93, // Index 48 (offset: 915)
-	0x3, 0xA2, // Index 49 (offset: 930)
-	0x3, 0xB1, // Index 50 (offset: 945)
-	0x3, 0xC0, // Index 51 (offset: 960)
-	0x3, 0xCF, // Index 52 (offset: 975)
-	0x3, 0xDE, // Index 53 (offset: 990)
-	0x3, 0xED, // Index 54 (offset: 1005)
-	0x3, 0xFC, // Index 55 (offset: 1020)
-	0x4, 0xB, // Index 56 (offset: 1035)
-	0x4, 0x1A, // Index 57 (offset: 1050)
-	0x4, 0x29, // Index 58 (offset: 1065)
-	0x4, 0x38, // Index 59 (offset: 1080)
-	0x4, 0x47, // Index 60 (offset: 1095)
-	0x4, 0x56, // Index 61 (offset: 1110)
-	0x4, 0x65, // Index 62 (offset: 1125)
-	0x4, 0x74, // Index 63 (offset: 1140)
-	0x4, 0x83, // Index 64 (offset: 1155)
-	0x4, 0x92, // Index 65 (offset: 1170)
-	0x4, 0xA1, // Index 66 (offset: 1185)
-	0x4, 0xB0, // Index 67 (offset: 1200)
-	0x4, 0xBF, // Index 68 (offset: 1215)
-	0x4, 0xCE, // Index 69 (offset: 1230)
-	0x4, 0xDD, // Index 70 (offset: 1245)
-	0x4, 0xEC, // Index 71 (offset: 1260)
-	0x4, 0xFB, // Index 72 (offset: 1275)
-	0x5, 0xA, // Index 73 (offset: 1290)
-	0x5, 0x19, // Index 74 (offset: 1305)
-	0x5, 0x28, // Index 75 (offset: 1320)
-	0x5, 0x37, // Index 76 (offset: 1335)
-	0x5, 0x46, // Index 77 (offset: 1350)
-	0x5, 0x55, // Index 78 (offset: 1365)
-	0x5, 0x64, // Index 79 (offset: 1380)
-	0x5, 0x73, // Index 80 (offset: 1395)
-	0x5, 0x82, // Index 81 (offset: 1410)
-	0x5, 0x91, // Index 82 (offset: 1425)
-	0x5, 0xA0, // Index 83 (offset: 1440)
-	0x5, 0xAF, // Index 84 (offset: 1455)
-	0x5, 0xBE, // Index 85 (offset: 1470)
-	0x5, 0xCD, // Index 86 (offset: 1485)
-	0x5, 0xDC, // Index 87 (offset: 1500)
-	0x5, 0xEB, // Index 88 (offset: 1515)
-	0x5, 0xFA, // Index 89 (offset: 1530)
-	0x6, 0x9, // Index 90 (offset: 1545)
-	0x6, 0x18, // Index 91 (offset: 1560)
-	0x6, 0x27, // Index 92 (offset: 1575)
-	0x6, 0x36, // Index 93 (offset: 1590)
-	0x6, 0x45, // Index 94 (offset: 1605)
-
 	/* Index 0, character 32 " " (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 2, character 34 """ (width: 7 pixels) */
-	0x7, 0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 7 pixels) */
-	0x7, 0x20,0x00,0xE8,0x00,0x38,0x00,0xEE,0x00,0x38,0x00,0x2E,0x00,0x00,0x00,
+	0x20,0x00,0xE8,0x00,0x38,0x00,0xEE,0x00,0x38,0x00,0x2E,0x00,0x00,0x00,
 
 	/* Index 4, character 36 "$" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x8C,0x00,0x8A,0x00,0xFF,0x01,0x92,0x00,0x62,0x00,0x00,0x00,
+	0x00,0x00,0x8C,0x00,0x8A,0x00,0xFF,0x01,0x92,0x00,0x62,0x00,0x00,0x00,
 
 	/* Index 5, character 37 "%" (width: 7 pixels) */
-	0x7, 0x8C,0x00,0x52,0x00,0x2C,0x00,0x10,0x00,0x68,0x00,0x94,0x00,0x62,0x00,
+	0x8C,0x00,0x52,0x00,0x2C,0x00,0x10,0x00,0x68,0x00,0x94,0x00,0x62,0x00,
 
 	/* Index 6, character 38 "&" (width: 7 pixels) */
-	0x7, 0x60,0x00,0x9C,0x00,0x92,0x00,0xAC,0x00,0xC0,0x00,0xC0,0x00,0x30,0x00,
+	0x60,0x00,0x9C,0x00,0x92,0x00,0xAC,0x00,0xC0,0x00,0xC0,0x00,0x30,0x00,
 
 	/* Index 7, character 39 "'" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0xFC,0x00,0x02,0x01,0x01,0x02,0x01,0x02,0x00,0x00,
+	0x00,0x00,0x00,0x00,0xFC,0x00,0x02,0x01,0x01,0x02,0x01,0x02,0x00,0x00,
 
 	/* Index 9, character 41 ")" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x01,0x02,0x01,0x02,0x02,0x01,0xFC,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x01,0x02,0x01,0x02,0x02,0x01,0xFC,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 10, character 42 "*" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x04,0x00,0x1C,0x00,0x0A,0x00,0x14,0x00,0x04,0x00,0x00,0x00,
+	0x00,0x00,0x04,0x00,0x1C,0x00,0x0A,0x00,0x14,0x00,0x04,0x00,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x10,0x00,0x10,0x00,0xFC,0x00,0x10,0x00,0x10,0x00,0x00,0x00,
+	0x00,0x00,0x10,0x00,0x10,0x00,0xFC,0x00,0x10,0x00,0x10,0x00,0x00,0x00,
 
 	/* Index 12, character 44 "," (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0xC0,0x02,0xC0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0xC0,0x02,0xC0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 13, character 45 "-" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x00,0x00,
+	0x00,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x00,0x00,
 
 	/* Index 14, character 46 "." (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 15, character 47 "/" (width: 7 pixels) */
-	0x7, 0x00,0x02,0x80,0x01,0xC0,0x00,0x30,0x00,0x0C,0x00,0x06,0x00,0x01,0x00,
+	0x00,0x02,0x80,0x01,0xC0,0x00,0x30,0x00,0x0C,0x00,0x06,0x00,0x01,0x00,
 
 	/* Index 16, character 48 "0" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x7C,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x7C,0x00,0x00,0x00,
+	0x00,0x00,0x7C,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x7C,0x00,0x00,0x00,
 
 	/* Index 17, character 49 "1" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x84,0x00,0x82,0x00,0xFE,0x00,0x80,0x00,0x80,0x00,0x00,0x00,
+	0x00,0x00,0x84,0x00,0x82,0x00,0xFE,0x00,0x80,0x00,0x80,0x00,0x00,0x00,
 
 	/* Index 18, character 50 "2" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xC2,0x00,0xA2,0x00,0x92,0x00,0x8C,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0xC2,0x00,0xA2,0x00,0x92,0x00,0x8C,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 19, character 51 "3" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x82,0x00,0x92,0x00,0x92,0x00,0x6E,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x82,0x00,0x92,0x00,0x92,0x00,0x6E,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 20, character 52 "4" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x30,0x00,0x28,0x00,0x24,0x00,0xFE,0x00,0x20,0x00,0x00,0x00,
+	0x00,0x00,0x30,0x00,0x28,0x00,0x24,0x00,0xFE,0x00,0x20,0x00,0x00,0x00,
 
 	/* Index 21, character 53 "5" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x9E,0x00,0x92,0x00,0x92,0x00,0x62,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x9E,0x00,0x92,0x00,0x92,0x00,0x62,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 22, character 54 "6" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x78,0x00,0xA4,0x00,0x92,0x00,0x92,0x00,0x62,0x00,0x00,0x00,
+	0x00,0x00,0x78,0x00,0xA4,0x00,0x92,0x00,0x92,0x00,0x62,0x00,0x00,0x00,
 
 	/* Index 23, character 55 "7" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x82,0x00,0x62,0x00,0x12,0x00,0x0E,0x00,0x02,0x00,0x00,0x00,
+	0x00,0x00,0x82,0x00,0x62,0x00,0x12,0x00,0x0E,0x00,0x02,0x00,0x00,0x00,
 
 	/* Index 24, character 56 "8" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x6C,0x00,0x92,0x00,0x92,0x00,0x9A,0x00,0x64,0x00,0x00,0x00,
+	0x00,0x00,0x6C,0x00,0x92,0x00,0x92,0x00,0x9A,0x00,0x64,0x00,0x00,0x00,
 
 	/* Index 25, character 57 "9" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x8C,0x00,0x92,0x00,0x92,0x00,0x52,0x00,0x3C,0x00,0x00,0x00,
+	0x00,0x00,0x8C,0x00,0x92,0x00,0x92,0x00,0x52,0x00,0x3C,0x00,0x00,0x00,
 
 	/* Index 26, character 58 ":" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0xCC,0x00,0xCC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0xCC,0x00,0xCC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 27, character 59 ";" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0xCC,0x02,0xCC,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0xCC,0x02,0xCC,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 28, character 60 "<" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x30,0x00,0x30,0x00,0x48,0x00,0x48,0x00,0x84,0x00,0x00,0x00,
+	0x00,0x00,0x30,0x00,0x30,0x00,0x48,0x00,0x48,0x00,0x84,0x00,0x00,0x00,
 
 	/* Index 29, character 61 "=" (width: 7 pixels) */
-	0x7, 0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,
+	0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,
 
 	/* Index 30, character 62 ">" (width: 7 pixels) */
-	0x7, 0x84,0x00,0x48,0x00,0x48,0x00,0x30,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
+	0x84,0x00,0x48,0x00,0x48,0x00,0x30,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 31, character 63 "?" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x06,0x00,0x02,0x00,0xA2,0x00,0x12,0x00,0x0C,0x00,0x00,0x00,
+	0x00,0x00,0x06,0x00,0x02,0x00,0xA2,0x00,0x12,0x00,0x0C,0x00,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 7 pixels) */
-	0x7, 0x38,0x00,0x44,0x00,0xB2,0x00,0xAA,0x00,0xAA,0x00,0x3E,0x00,0x20,0x00,
+	0x38,0x00,0x44,0x00,0xB2,0x00,0xAA,0x00,0xAA,0x00,0x3E,0x00,0x20,0x00,
 
 	/* Index 33, character 65 "A" (width: 7 pixels) */
-	0x7, 0x80,0x00,0x70,0x00,0x2C,0x00,0x22,0x00,0x2C,0x00,0x70,0x00,0x80,0x00,
+	0x80,0x00,0x70,0x00,0x2C,0x00,0x22,0x00,0x2C,0x00,0x70,0x00,0x80,0x00,
 
 	/* Index 34, character 66 "B" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFE,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x6C,0x00,0x00,0x00,
+	0x00,0x00,0xFE,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x6C,0x00,0x00,0x00,
 
 	/* Index 35, character 67 "C" (width: 7 pixels) */
-	0x7, 0x38,0x00,0x44,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x00,0x00,
+	0x38,0x00,0x44,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x00,0x00,
 
 	/* Index 36, character 68 "D" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFE,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x7C,0x00,0x00,0x00,
+	0x00,0x00,0xFE,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x7C,0x00,0x00,0x00,
 
 	/* Index 37, character 69 "E" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFE,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x82,0x00,0x00,0x00,
+	0x00,0x00,0xFE,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x82,0x00,0x00,0x00,
 
 	/* Index 38, character 70 "F" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFE,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x02,0x00,0x00,0x00,
+	0x00,0x00,0xFE,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x02,0x00,0x00,0x00,
 
 	/* Index 39, character 71 "G" (width: 7 pixels) */
-	0x7, 0x38,0x00,0x44,0x00,0x82,0x00,0x82,0x00,0x92,0x00,0xF2,0x00,0x00,0x00,
+	0x38,0x00,0x44,0x00,0x82,0x00,0x82,0x00,0x92,0x00,0xF2,0x00,0x00,0x00,
 
 	/* Index 40, character 72 "H" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFE,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xFE,0x00,0x00,0x00,
+	0x00,0x00,0xFE,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xFE,0x00,0x00,0x00,
 
 	/* Index 41, character 73 "I" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x82,0x00,0x82,0x00,0xFE,0x00,0x82,0x00,0x82,0x00,0x00,0x00,
+	0x00,0x00,0x82,0x00,0x82,0x00,0xFE,0x00,0x82,0x00,0x82,0x00,0x00,0x00,
 
 	/* Index 42, character 74 "J" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x80,0x00,0x82,0x00,0x82,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x80,0x00,0x82,0x00,0x82,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 43, character 75 "K" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFE,0x00,0x10,0x00,0x28,0x00,0x44,0x00,0x82,0x00,0x00,0x00,
+	0x00,0x00,0xFE,0x00,0x10,0x00,0x28,0x00,0x44,0x00,0x82,0x00,0x00,0x00,
 
 	/* Index 44, character 76 "L" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFE,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,
+	0x00,0x00,0xFE,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,
 
 	/* Index 45, character 77 "M" (width: 7 pixels) */
-	0x7, 0xFE,0x00,0x0E,0x00,0x70,0x00,0x38,0x00,0x06,0x00,0xFE,0x00,0x00,0x00,
+	0xFE,0x00,0x0E,0x00,0x70,0x00,0x38,0x00,0x06,0x00,0xFE,0x00,0x00,0x00,
 
 	/* Index 46, character 78 "N" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFE,0x00,0x0C,0x00,0x18,0x00,0x60,0x00,0xFE,0x00,0x00,0x00,
+	0x00,0x00,0xFE,0x00,0x0C,0x00,0x18,0x00,0x60,0x00,0xFE,0x00,0x00,0x00,
 
 	/* Index 47, character 79 "O" (width: 7 pixels) */
-	0x7, 0x7C,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x7C,0x00,0x00,0x00,
+	0x7C,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x7C,0x00,0x00,0x00,
 
 	/* Index 48, character 80 "P" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFE,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x0C,0x00,0x00,0x00,
+	0x00,0x00,0xFE,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x0C,0x00,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 7 pixels) */
-	0x7, 0x7C,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x01,0x7C,0x03,0x00,0x02,
+	0x7C,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x01,0x7C,0x03,0x00,0x02,
 
 	/* Index 50, character 82 "R" (width: 7 pixels) */
-	0x7, 0xFE,0x00,0x12,0x00,0x12,0x00,0x32,0x00,0x4C,0x00,0x80,0x00,0x00,0x00,
+	0xFE,0x00,0x12,0x00,0x12,0x00,0x32,0x00,0x4C,0x00,0x80,0x00,0x00,0x00,
 
 	/* Index 51, character 83 "S" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x8C,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x62,0x00,0x00,0x00,
+	0x00,0x00,0x8C,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x62,0x00,0x00,0x00,
 
 	/* Index 52, character 84 "T" (width: 7 pixels) */
-	0x7, 0x02,0x00,0x02,0x00,0x02,0x00,0xFE,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
+	0x02,0x00,0x02,0x00,0x02,0x00,0xFE,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
 
 	/* Index 53, character 85 "U" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x7E,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x7E,0x00,0x00,0x00,
+	0x00,0x00,0x7E,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x7E,0x00,0x00,0x00,
 
 	/* Index 54, character 86 "V" (width: 7 pixels) */
-	0x7, 0x02,0x00,0x1C,0x00,0x60,0x00,0x80,0x00,0x60,0x00,0x1C,0x00,0x02,0x00,
+	0x02,0x00,0x1C,0x00,0x60,0x00,0x80,0x00,0x60,0x00,0x1C,0x00,0x02,0x00,
 
 	/* Index 55, character 87 "W" (width: 7 pixels) */
-	0x7, 0x0E,0x00,0xF0,0x00,0x30,0x00,0x0C,0x00,0x70,0x00,0xE0,0x00,0x1E,0x00,
+	0x0E,0x00,0xF0,0x00,0x30,0x00,0x0C,0x00,0x70,0x00,0xE0,0x00,0x1E,0x00,
 
 	/* Index 56, character 88 "X" (width: 7 pixels) */
-	0x7, 0x82,0x00,0x44,0x00,0x28,0x00,0x10,0x00,0x28,0x00,0x44,0x00,0x82,0x00,
+	0x82,0x00,0x44,0x00,0x28,0x00,0x10,0x00,0x28,0x00,0x44,0x00,0x82,0x00,
 
 	/* Index 57, character 89 "Y" (width: 7 pixels) */
-	0x7, 0x02,0x00,0x04,0x00,0x08,0x00,0xF0,0x00,0x08,0x00,0x04,0x00,0x02,0x00,
+	0x02,0x00,0x04,0x00,0x08,0x00,0xF0,0x00,0x08,0x00,0x04,0x00,0x02,0x00,
 
 	/* Index 58, character 90 "Z" (width: 7 pixels) */
-	0x7, 0x82,0x00,0xC2,0x00,0xA2,0x00,0x92,0x00,0x8A,0x00,0x86,0x00,0x00,0x00,
+	0x82,0x00,0xC2,0x00,0xA2,0x00,0x92,0x00,0x8A,0x00,0x86,0x00,0x00,0x00,
 
 	/* Index 59, character 91 "[" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0xFF,0x03,0x01,0x02,0x01,0x02,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0xFF,0x03,0x01,0x02,0x01,0x02,0x00,0x00,0x00,0x00,
 
 	/* Index 60, character 92 "\" (width: 7 pixels) */
-	0x7, 0x01,0x00,0x06,0x00,0x08,0x00,0x30,0x00,0xC0,0x00,0x00,0x01,0x00,0x02,
+	0x01,0x00,0x06,0x00,0x08,0x00,0x30,0x00,0xC0,0x00,0x00,0x01,0x00,0x02,
 
 	/* Index 61, character 93 "]" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x01,0x02,0x01,0x02,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x01,0x02,0x01,0x02,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 62, character 94 "^" (width: 7 pixels) */
-	0x7, 0x20,0x00,0x18,0x00,0x0C,0x00,0x03,0x00,0x0C,0x00,0x18,0x00,0x20,0x00,
+	0x20,0x00,0x18,0x00,0x0C,0x00,0x03,0x00,0x0C,0x00,0x18,0x00,0x20,0x00,
 
 	/* Index 63, character 95 "_" (width: 7 pixels) */
-	0x7, 0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+	0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
 
 	/* Index 64, character 96 "`" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x60,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0xF8,0x00,0x80,0x00,
+	0x00,0x00,0x60,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0xF8,0x00,0x80,0x00,
 
 	/* Index 66, character 98 "b" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFF,0x00,0x88,0x00,0x84,0x00,0x84,0x00,0x78,0x00,0x00,0x00,
+	0x00,0x00,0xFF,0x00,0x88,0x00,0x84,0x00,0x84,0x00,0x78,0x00,0x00,0x00,
 
 	/* Index 67, character 99 "c" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x78,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x00,0x00,
+	0x00,0x00,0x78,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x00,0x00,
 
 	/* Index 68, character 100 "d" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x78,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0xFF,0x00,0x00,0x00,
+	0x00,0x00,0x78,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0xFF,0x00,0x00,0x00,
 
 	/* Index 69, character 101 "e" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x78,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x98,0x00,0x00,0x00,
+	0x00,0x00,0x78,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x98,0x00,0x00,0x00,
 
 	/* Index 70, character 102 "f" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x04,0x00,0x04,0x00,0xFE,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+	0x00,0x00,0x04,0x00,0x04,0x00,0xFE,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
 
 	/* Index 71, character 103 "g" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x78,0x00,0x84,0x02,0x84,0x02,0x84,0x02,0xFC,0x01,0x00,0x00,
+	0x00,0x00,0x78,0x00,0x84,0x02,0x84,0x02,0x84,0x02,0xFC,0x01,0x00,0x00,
 
 	/* Index 72, character 104 "h" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFF,0x00,0x08,0x00,0x04,0x00,0x04,0x00,0xFC,0x00,0x00,0x00,
+	0x00,0x00,0xFF,0x00,0x08,0x00,0x04,0x00,0x04,0x00,0xFC,0x00,0x00,0x00,
 
 	/* Index 73, character 105 "i" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x04,0x00,0x04,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x04,0x00,0x04,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 74, character 106 "j" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x02,0x04,0x02,0x04,0x02,0xFD,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x02,0x04,0x02,0x04,0x02,0xFD,0x01,0x00,0x00,0x00,0x00,
 
 	/* Index 75, character 107 "k" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFF,0x00,0x10,0x00,0x30,0x00,0x48,0x00,0x84,0x00,0x00,0x00,
+	0x00,0x00,0xFF,0x00,0x10,0x00,0x30,0x00,0x48,0x00,0x84,0x00,0x00,0x00,
 
 	/* Index 76, character 108 "l" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x01,0x00,0x01,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x01,0x00,0x01,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 77, character 109 "m" (width: 7 pixels) */
-	0x7, 0xFC,0x00,0x08,0x00,0x04,0x00,0xFC,0x00,0x08,0x00,0x04,0x00,0xFC,0x00,
+	0xFC,0x00,0x08,0x00,0x04,0x00,0xFC,0x00,0x08,0x00,0x04,0x00,0xFC,0x00,
 
 	/* Index 78, character 110 "n" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFC,0x00,0x08,0x00,0x04,0x00,0x04,0x00,0xFC,0x00,0x00,0x00,
+	0x00,0x00,0xFC,0x00,0x08,0x00,0x04,0x00,0x04,0x00,0xFC,0x00,0x00,0x00,
 
 	/* Index 79, character 111 "o" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x78,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x78,0x00,0x00,0x00,
+	0x00,0x00,0x78,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x78,0x00,0x00,0x00,
 
 	/* Index 80, character 112 "p" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFC,0x03,0x88,0x00,0x84,0x00,0x84,0x00,0x78,0x00,0x00,0x00,
+	0x00,0x00,0xFC,0x03,0x88,0x00,0x84,0x00,0x84,0x00,0x78,0x00,0x00,0x00,
 
 	/* Index 81, character 113 "q" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x78,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0xFC,0x03,0x00,0x00,
+	0x00,0x00,0x78,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0xFC,0x03,0x00,0x00,
 
 	/* Index 82, character 114 "r" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFC,0x00,0x08,0x00,0x04,0x00,0x04,0x00,0x0C,0x00,0x00,0x00,
+	0x00,0x00,0xFC,0x00,0x08,0x00,0x04,0x00,0x04,0x00,0x0C,0x00,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x9C,0x00,0x94,0x00,0xA4,0x00,0x64,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x9C,0x00,0x94,0x00,0xA4,0x00,0x64,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 84, character 116 "t" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x04,0x00,0x7E,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x00,0x00,
+	0x00,0x00,0x04,0x00,0x7E,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x00,0x00,
 
 	/* Index 85, character 117 "u" (width: 7 pixels) */
-	0x7, 0x00,0x00,0xFC,0x00,0x80,0x00,0x80,0x00,0x40,0x00,0xFC,0x00,0x00,0x00,
+	0x00,0x00,0xFC,0x00,0x80,0x00,0x80,0x00,0x40,0x00,0xFC,0x00,0x00,0x00,
 
 	/* Index 86, character 118 "v" (width: 7 pixels) */
-	0x7, 0x04,0x00,0x18,0x00,0x60,0x00,0x80,0x00,0x60,0x00,0x18,0x00,0x04,0x00,
+	0x04,0x00,0x18,0x00,0x60,0x00,0x80,0x00,0x60,0x00,0x18,0x00,0x04,0x00,
 
 	/* Index 87, character 119 "w" (width: 7 pixels) */
-	0x7, 0x3C,0x00,0xC0,0x00,0x70,0x00,0x08,0x00,0x70,0x00,0xC0,0x00,0x3C,0x00,
+	0x3C,0x00,0xC0,0x00,0x70,0x00,0x08,0x00,0x70,0x00,0xC0,0x00,0x3C,0x00,
 
 	/* Index 88, character 120 "x" (width: 7 pixels) */
-	0x7, 0x84,0x00,0x48,0x00,0x30,0x00,0x30,0x00,0x48,0x00,0x84,0x00,0x00,0x00,
+	0x84,0x00,0x48,0x00,0x30,0x00,0x30,0x00,0x48,0x00,0x84,0x00,0x00,0x00,
 
 	/* Index 89, character 121 "y" (width: 7 pixels) */
-	0x7, 0x04,0x02,0x18,0x02,0x60,0x03,0x80,0x01,0x60,0x00,0x18,0x00,0x04,0x00,
+	0x04,0x02,0x18,0x02,0x60,0x03,0x80,0x01,0x60,0x00,0x18,0x00,0x04,0x00,
 
 	/* Index 90, character 122 "z" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x84,0x00,0xC4,0x00,0xA4,0x00,0x94,0x00,0x8C,0x00,0x00,0x00,
+	0x00,0x00,0x84,0x00,0xC4,0x00,0xA4,0x00,0x94,0x00,0x8C,0x00,0x00,0x00,
 
 	/* Index 91, character 123 "{" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0x10,0x00,0xFE,0x01,0x01,0x02,0x01,0x02,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x10,0x00,0xFE,0x01,0x01,0x02,0x01,0x02,0x00,0x00,
 
 	/* Index 92, character 124 "|" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 93, character 125 "}" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x01,0x02,0x01,0x02,0xFE,0x03,0x10,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x01,0x02,0x01,0x02,0xFE,0x03,0x10,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 94, character 126 "~" (width: 7 pixels) */
-	0x7, 0x20,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x20,0x00,0x20,0x00,0x10,0x00
+	0x20,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x20,0x00,0x20,0x00,0x10,0x00
+};
+
+// Offset of each bitmap in LucidaConsole8_bitmaps
+const unsigned short LucidaConsole8_offsets[] = 
+{
+	0x0,	// Index 0
+	0xE,	// Index 1
+	0x1C,	// Index 2
+	0x2A,	// Index 3
+	0x38,	// Index 4
+	0x46,	// Index 5
+	0x54,	// Index 6
+	0x62,	// Index 7
+	0x70,	// Index 8
+	0x7E,	// Index 9
+	0x8C,	// Index 10
+	0x9A,	// Index 11
+	0xA8,	// Index 12
+	0xB6,	// Index 13
+	0xC4,	// Index 14
+	0xD2,	// Index 15
+	0xE0,	// Index 16
+	0xEE,	// Index 17
+	0xFC,	// Index 18
+	0x10A,	// Index 19
+	0x118,	// Index 20
+	0x126,	// Index 21
+	0x134,	// Index 22
+	0x142,	// Index 23
+	0x150,	// Index 24
+	0x15E,	// Index 25
+	0x16C,	// Index 26
+	0x17A,	// Index 27
+	0x188,	// Index 28
+	0x196,	// Index 29
+	0x1A4,	// Index 30
+	0x1B2,	// Index 31
+	0x1C0,	// Index 32
+	0x1CE,	// Index 33
+	0x1DC,	// Index 34
+	0x1EA,	// Index 35
+	0x1F8,	// Index 36
+	0x206,	// Index 37
+	0x214,	// Index 38
+	0x222,	// Index 39
+	0x230,	// Index 40
+	0x23E,	// Index 41
+	0x24C,	// Index 42
+	0x25A,	// Index 43
+	0x268,	// Index 44
+	0x276,	// Index 45
+	0x284,	// Index 46
+	0x292,	// Index 47
+	0x2A0,	// Index 48
+	0x2AE,	// Index 49
+	0x2BC,	// Index 50
+	0x2CA,	// Index 51
+	0x2D8,	// Index 52
+	0x2E6,	// Index 53
+	0x2F4,	// Index 54
+	0x302,	// Index 55
+	0x310,	// Index 56
+	0x31E,	// Index 57
+	0x32C,	// Index 58
+	0x33A,	// Index 59
+	0x348,	// Index 60
+	0x356,	// Index 61
+	0x364,	// Index 62
+	0x372,	// Index 63
+	0x380,	// Index 64
+	0x38E,	// Index 65
+	0x39C,	// Index 66
+	0x3AA,	// Index 67
+	0x3B8,	// Index 68
+	0x3C6,	// Index 69
+	0x3D4,	// Index 70
+	0x3E2,	// Index 71
+	0x3F0,	// Index 72
+	0x3FE,	// Index 73
+	0x40C,	// Index 74
+	0x41A,	// Index 75
+	0x428,	// Index 76
+	0x436,	// Index 77
+	0x444,	// Index 78
+	0x452,	// Index 79
+	0x460,	// Index 80
+	0x46E,	// Index 81
+	0x47C,	// Index 82
+	0x48A,	// Index 83
+	0x498,	// Index 84
+	0x4A6,	// Index 85
+	0x4B4,	// Index 86
+	0x4C2,	// Index 87
+	0x4D0,	// Index 88
+	0x4DE,	// Index 89
+	0x4EC,	// Index 90
+	0x4FA,	// Index 91
+	0x508,	// Index 92
+	0x516,	// Index 93
+	0x524,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char LucidaConsole8_widths[] = 
+{
+	0x7,	// Index 0
+	0x7,	// Index 1
+	0x7,	// Index 2
+	0x7,	// Index 3
+	0x7,	// Index 4
+	0x7,	// Index 5
+	0x7,	// Index 6
+	0x7,	// Index 7
+	0x7,	// Index 8
+	0x7,	// Index 9
+	0x7,	// Index 10
+	0x7,	// Index 11
+	0x7,	// Index 12
+	0x7,	// Index 13
+	0x7,	// Index 14
+	0x7,	// Index 15
+	0x7,	// Index 16
+	0x7,	// Index 17
+	0x7,	// Index 18
+	0x7,	// Index 19
+	0x7,	// Index 20
+	0x7,	// Index 21
+	0x7,	// Index 22
+	0x7,	// Index 23
+	0x7,	// Index 24
+	0x7,	// Index 25
+	0x7,	// Index 26
+	0x7,	// Index 27
+	0x7,	// Index 28
+	0x7,	// Index 29
+	0x7,	// Index 30
+	0x7,	// Index 31
+	0x7,	// Index 32
+	0x7,	// Index 33
+	0x7,	// Index 34
+	0x7,	// Index 35
+	0x7,	// Index 36
+	0x7,	// Index 37
+	0x7,	// Index 38
+	0x7,	// Index 39
+	0x7,	// Index 40
+	0x7,	// Index 41
+	0x7,	// Index 42
+	0x7,	// Index 43
+	0x7,	// Index 44
+	0x7,	// Index 45
+	0x7,	// Index 46
+	0x7,	// Index 47
+	0x7,	// Index 48
+	0x7,	// Index 49
+	0x7,	// Index 50
+	0x7,	// Index 51
+	0x7,	// Index 52
+	0x7,	// Index 53
+	0x7,	// Index 54
+	0x7,	// Index 55
+	0x7,	// Index 56
+	0x7,	// Index 57
+	0x7,	// Index 58
+	0x7,	// Index 59
+	0x7,	// Index 60
+	0x7,	// Index 61
+	0x7,	// Index 62
+	0x7,	// Index 63
+	0x7,	// Index 64
+	0x7,	// Index 65
+	0x7,	// Index 66
+	0x7,	// Index 67
+	0x7,	// Index 68
+	0x7,	// Index 69
+	0x7,	// Index 70
+	0x7,	// Index 71
+	0x7,	// Index 72
+	0x7,	// Index 73
+	0x7,	// Index 74
+	0x7,	// Index 75
+	0x7,	// Index 76
+	0x7,	// Index 77
+	0x7,	// Index 78
+	0x7,	// Index 79
+	0x7,	// Index 80
+	0x7,	// Index 81
+	0x7,	// Index 82
+	0x7,	// Index 83
+	0x7,	// Index 84
+	0x7,	// Index 85
+	0x7,	// Index 86
+	0x7,	// Index 87
+	0x7,	// Index 88
+	0x7,	// Index 89
+	0x7,	// Index 90
+	0x7,	// Index 91
+	0x7,	// Index 92
+	0x7,	// Index 93
+	0x7,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char LucidaConsole8_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x7, 0x0,	// Index 1
+	0x8, 0x0,	// Index 2
+	0x7, 0x0,	// Index 3
+	0x8, 0x1,	// Index 4
+	0x7, 0x0,	// Index 5
+	0x7, 0x0,	// Index 6
+	0x8, 0x0,	// Index 7
+	0x8, 0x2,	// Index 8
+	0x8, 0x2,	// Index 9
+	0x7, 0x0,	// Index 10
+	0x6, 0x0,	// Index 11
+	0x2, 0x2,	// Index 12
+	0x4, 0x0,	// Index 13
+	0x2, 0x0,	// Index 14
+	0x8, 0x2,	// Index 15
+	0x7, 0x0,	// Index 16
+	0x7, 0x0,	// Index 17
+	0x7, 0x0,	// Index 18
+	0x7, 0x0,	// Index 19
+	0x7, 0x0,	// Index 20
+	0x7, 0x0,	// Index 21
+	0x7, 0x0,	// Index 22
+	0x7, 0x0,	// Index 23
+	0x7, 0x0,	// Index 24
+	0x7, 0x0,	// Index 25
+	0x6, 0x0,	// Index 26
+	0x6, 0x2,	// Index 27
+	0x6, 0x0,	// Index 28
+	0x5, 0x0,	// Index 29
+	0x6, 0x0,	// Index 30
+	0x7, 0x0,	// Index 31
+	0x7, 0x0,	// Index 32
+	0x7, 0x0,	// Index 33
+	0x7, 0x0,	// Index 34
+	0x7, 0x0,	// Index 35
+	0x7, 0x0,	// Index 36
+	0x7, 0x0,	// Index 37
+	0x7, 0x0,	// Index 38
+	0x7, 0x0,	// Index 39
+	0x7, 0x0,	// Index 40
+	0x7, 0x0,	// Index 41
+	0x7, 0x0,	// Index 42
+	0x7, 0x0,	// Index 43
+	0x7, 0x0,	// Index 44
+	0x7, 0x0,	// Index 45
+	0x7, 0x0,	// Index 46
+	0x7, 0x0,	// Index 47
+	0x7, 0x0,	// Index 48
+	0x7, 0x2,	// Index 49
+	0x7, 0x0,	// Index 50
+	0x7, 0x0,	// Index 51
+	0x7, 0x0,	// Index 52
+	0x7, 0x0,	// Index 53
+	0x7, 0x0,	// Index 54
+	0x7, 0x0,	// Index 55
+	0x7, 0x0,	// Index 56
+	0x7, 0x0,	// Index 57
+	0x7, 0x0,	// Index 58
+	0x8, 0x2,	// Index 59
+	0x8, 0x2,	// Index 60
+	0x8, 0x2,	// Index 61
+	0x8, 0x0,	// Index 62
+	0x0, 0x1,	// Index 63
+	0x8, 0x0,	// Index 64
+	0x6, 0x0,	// Index 65
+	0x8, 0x0,	// Index 66
+	0x6, 0x0,	// Index 67
+	0x8, 0x0,	// Index 68
+	0x6, 0x0,	// Index 69
+	0x8, 0x0,	// Index 70
+	0x6, 0x2,	// Index 71
+	0x8, 0x0,	// Index 72
+	0x8, 0x0,	// Index 73
+	0x8, 0x2,	// Index 74
+	0x8, 0x0,	// Index 75
+	0x8, 0x0,	// Index 76
+	0x6, 0x0,	// Index 77
+	0x6, 0x0,	// Index 78
+	0x6, 0x0,	// Index 79
+	0x6, 0x2,	// Index 80
+	0x6, 0x2,	// Index 81
+	0x6, 0x0,	// Index 82
+	0x6, 0x0,	// Index 83
+	0x7, 0x0,	// Index 84
+	0x6, 0x0,	// Index 85
+	0x6, 0x0,	// Index 86
+	0x6, 0x0,	// Index 87
+	0x6, 0x0,	// Index 88
+	0x6, 0x2,	// Index 89
+	0x6, 0x0,	// Index 90
+	0x8, 0x2,	// Index 91
+	0x8, 0x2,	// Index 92
+	0x8, 0x2,	// Index 93
+	0x4, 0x0,	// Index 94
+};
+
+const font_t LucidaConsole8 = 
+{
+	LucidaConsole8_bitmaps,
+	LucidaConsole8_offsets,
+	LucidaConsole8_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0xA,	// Height 
+	0,	// Flags 
+	LucidaConsole8_extents,
+	0x8	// Ascent 
 };
+
 //---------------------------------------------------------------
 // Group Name: LucidaConsole7
 // Designer: Imported System Font
@@ -1239,395 +1870,603 @@ const unsigned char LucidaConsole8[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char LucidaConsole7[] = 
+const unsigned char LucidaConsole7_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x9,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xCE, // Index 1 (offset: 206)
-	0x0, 0xD9, // Index 2 (offset: 217)
-	0x0, 0xE4, // Index 3 (offset: 228)
-	0x0, 0xEF, // Index 4 (offset: 239)
-	0x0, 0xFA, // Index 5 (offset: 250)
-	0x1, 0x5, // Index 6 (offset: 261)
-	0x1, 0x10, // Index 7 (offset: 272)
-	0x1, 0x1B, // Index 8 (offset: 283)
-	0x1, 0x26, // Index 9 (offset: 294)
-	0x1, 0x31, // Index 10 (offset: 305)
-	0x1, 0x3C, // Index 11 (offset: 316)
-	0x1, 0x47, // Index 12 (offset: 327)
-	0x1, 0x52, // Index 13 (offset: 338)
-	0x1, 0x5D, // Index 14 (offset: 349)
-	0x1, 0x68, // Index 15 (offset: 360)
-	0x1, 0x73, // Index 16 (offset: 371)
-	0x1, 0x7E, // Index 17 (offset: 382)
-	0x1, 0x89, // Index 18 (offset: 393)
-	0x1, 0x94, // Index 19 (offset: 404)
-	0x1, 0x9F, // Index 20 (offset: 415)
-	0x1, 0xAA, // Index 21 (offset: 426)
-	0x1, 0xB5, // Index 22 (offset: 437)
-	0x1, 0xC0, // Index 23 (offset: 448)
-	0x1, 0xCB, // Index 24 (offset: 459)
-	0x1, 0xD6, // Index 25 (offset: 470)
-	0x1, 0xE1, // Index 26 (offset: 481)
-	0x1, 0xEC, // Index 27 (offset: 492)
-	0x1, 0xF7, // Index 28 (offset: 503)
-	0x2, 0x2, // Index 29 (offset: 514)
-	0x2, 0xD, // Index 30 (offset: 525)
-	0x2, 0x18, // Index 31 (offset: 536)
-	0x2, 0x23, // Index 32 (offset: 547)
-	0x2, 0x2E, // Index 33 (offset: 558)
-	0x2, 0x39, // Index 34 (offset: 569)
-	0x2, 0x44, // Index 35 (offset: 580)
-	0x2, 0x4F, // Index 36 (offset: 591)
-	0x2, 0x5A, // Index 37 (offset: 602)
-	0x2, 0x65, // Index 38 (offset: 613)
-	0x2, 0x70, // Index 39 (offset: 624)
-	0x2, 0x7B, // Index 40 (offset: 635)
-	0x2, 0x86, // Index 41 (offset: 646)
-	0x2, 0x91, // Index 42 (offset: 657)
-	0x2, 0x9C, // Index 43 (offset: 668)
-	0x2, 0xA7, // Index 44 (offset: 679)
-	0x2, 0xB2, // Index 45 (offset: 690)
-	0x2, 0xBD, // Index 46 (offset: 701)
-	0x2, 0xC8, // Index 47 (offset: 712)
-	0x2, 0xD3, // Index 48 (offset: 723)
-	0x2, 0xDE, // Index 49 (offset: 734)
-	0x2, 0xE9, // Index 50 (offset: 745)
-	0x2, 0xF4, // Index 51 (offset: 756)
-	0x2, 0xFF, // Index 52 (offset: 767)
-	0x3, 0xA, // Index 53 (offset: 778)
-	0x3, 0x15, // Index 54 (offset: 789)
-	0x3, 0x20, // Index 55 (offset: 800)
-	0x3, 0x2B, // Index 56 (offset: 811)
-	0x3, 0x36, // Index 57 (offset: 822)
-	0x3, 0x41, // Index 58 (offset: 833)
-	0x3, 0x4C, // Index 59 (offset: 844)
-	0x3, 0x57, // Index 60 (offset: 855)
-	0x3, 0x62, // Index 61 (offset: 866)
-	0x3, 0x6D, // Index 62 (offset: 877)
-	0x3, 0x78, // Index 63 (offset: 888)
-	0x3, 0x83, // Index 64 (offset: 899)
-	0x3, 0x8E, // Index 65 (offset: 910)
-	0x3, 0x99, // Index 66 (offset: 921)
-	0x3, 0xA4, // Index 67 (offset: 932)
-	0x3, 0xAF, // Index 68 (offset: 943)
-	0x3, 0xBA, // Index 69 (offset: 954)
-	0x3, 0xC5, // Index 70 (offset: 965)
-	0x3, 0xD0, // Index 71 (offset: 976)
-	0x3, 0xDB, // Index 72 (offset: 987)
-	0x3, 0xE6, // Index 73 (offset: 998)
-	0x3, 0xF1, // Index 74 (offset: 1009)
-	0x3, 0xFC, // Index 75 (offset: 1020)
-	0x4, 0x7, // Index 76 (offset: 1031)
-	0x4, 0x12, // Index 77 (offset: 1042)
-	0x4, 0x1D, // Index 78 (offset: 1053)
-	0x4, 0x28, // Index 79 (offset: 1064)
-	0x4, 0x33, // Index 80 (offset: 1075)
-	0x4, 0x3E, // Index 81 (offset: 1086)
-	0x4, 0x49, // Index 82 (offset: 1097)
-	0x4, 0x54, // Index 83 (offset: 1108)
-	0x4, 0x5F, // Index 84 (offset: 1119)
-	0x4, 0x6A, // Index 85 (offset: 1130)
-	0x4, 0x75, // Index 86 (offset: 1141)
-	0x4, 0x80, // Index 87 (offset: 1152)
-	0x4, 0x8B, // Index 88 (offset: 1163)
-	0x4, 0x96, // Index 89 (offset: 1174)
-	0x4, 0xA1, // Index 90 (offset: 1185)
-	0x4, 0xAC, // Index 91 (offset: 1196)
-	0x4, 0xB7, // Index 92 (offset: 1207)
-	0x4, 0xC2, // Index 93 (offset: 1218)
-	0x4, 0xCD, // Index 94 (offset: 1229)
-
 	/* Index 0, character 32 " " (width: 5 pixels) */
-	0x5, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x00,0x00,0x5E,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x5E,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 2, character 34 """ (width: 5 pixels) */
-	0x5, 0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+	0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 5 pixels) */
-	0x5, 0x70,0x00,0x1C,0x00,0x76,0x00,0x1C,0x00,0x16,0x00,
+	0x70,0x00,0x1C,0x00,0x76,0x00,0x1C,0x00,0x16,0x00,
 
 	/* Index 4, character 36 "$" (width: 5 pixels) */
-	0x5, 0x44,0x00,0x4A,0x00,0xFF,0x00,0x52,0x00,0x32,0x00,
+	0x44,0x00,0x4A,0x00,0xFF,0x00,0x52,0x00,0x32,0x00,
 
 	/* Index 5, character 37 "%" (width: 5 pixels) */
-	0x5, 0x44,0x00,0x2A,0x00,0x3C,0x00,0x54,0x00,0x22,0x00,
+	0x44,0x00,0x2A,0x00,0x3C,0x00,0x54,0x00,0x22,0x00,
 
 	/* Index 6, character 38 "&" (width: 5 pixels) */
-	0x5, 0x30,0x00,0x4C,0x00,0x5A,0x00,0x66,0x00,0x70,0x00,
+	0x30,0x00,0x4C,0x00,0x5A,0x00,0x66,0x00,0x70,0x00,
 
 	/* Index 7, character 39 "'" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x00,0x00,0x3C,0x00,0x42,0x00,0x81,0x00,
+	0x00,0x00,0x00,0x00,0x3C,0x00,0x42,0x00,0x81,0x00,
 
 	/* Index 9, character 41 ")" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x81,0x00,0x42,0x00,0x3C,0x00,0x00,0x00,
+	0x00,0x00,0x81,0x00,0x42,0x00,0x3C,0x00,0x00,0x00,
 
 	/* Index 10, character 42 "*" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x0C,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x0C,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 5 pixels) */
-	0x5, 0x10,0x00,0x10,0x00,0x7C,0x00,0x10,0x00,0x10,0x00,
+	0x10,0x00,0x10,0x00,0x7C,0x00,0x10,0x00,0x10,0x00,
 
 	/* Index 12, character 44 "," (width: 5 pixels) */
-	0x5, 0x00,0x00,0x60,0x01,0xE0,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x60,0x01,0xE0,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 13, character 45 "-" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x00,0x00,
+	0x00,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x00,0x00,
 
 	/* Index 14, character 46 "." (width: 5 pixels) */
-	0x5, 0x00,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 15, character 47 "/" (width: 5 pixels) */
-	0x5, 0x80,0x00,0x60,0x00,0x18,0x00,0x06,0x00,0x01,0x00,
+	0x80,0x00,0x60,0x00,0x18,0x00,0x06,0x00,0x01,0x00,
 
 	/* Index 16, character 48 "0" (width: 5 pixels) */
-	0x5, 0x3C,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x3C,0x00,
+	0x3C,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x3C,0x00,
 
 	/* Index 17, character 49 "1" (width: 5 pixels) */
-	0x5, 0x40,0x00,0x42,0x00,0x7E,0x00,0x40,0x00,0x40,0x00,
+	0x40,0x00,0x42,0x00,0x7E,0x00,0x40,0x00,0x40,0x00,
 
 	/* Index 18, character 50 "2" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x62,0x00,0x52,0x00,0x52,0x00,0x4C,0x00,
+	0x00,0x00,0x62,0x00,0x52,0x00,0x52,0x00,0x4C,0x00,
 
 	/* Index 19, character 51 "3" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x42,0x00,0x4A,0x00,0x4A,0x00,0x36,0x00,
+	0x00,0x00,0x42,0x00,0x4A,0x00,0x4A,0x00,0x36,0x00,
 
 	/* Index 20, character 52 "4" (width: 5 pixels) */
-	0x5, 0x10,0x00,0x18,0x00,0x14,0x00,0x7E,0x00,0x10,0x00,
+	0x10,0x00,0x18,0x00,0x14,0x00,0x7E,0x00,0x10,0x00,
 
 	/* Index 21, character 53 "5" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x5E,0x00,0x52,0x00,0x72,0x00,0x00,0x00,
+	0x00,0x00,0x5E,0x00,0x52,0x00,0x72,0x00,0x00,0x00,
 
 	/* Index 22, character 54 "6" (width: 5 pixels) */
-	0x5, 0x3C,0x00,0x4A,0x00,0x4A,0x00,0x32,0x00,0x00,0x00,
+	0x3C,0x00,0x4A,0x00,0x4A,0x00,0x32,0x00,0x00,0x00,
 
 	/* Index 23, character 55 "7" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x42,0x00,0x32,0x00,0x0A,0x00,0x06,0x00,
+	0x00,0x00,0x42,0x00,0x32,0x00,0x0A,0x00,0x06,0x00,
 
 	/* Index 24, character 56 "8" (width: 5 pixels) */
-	0x5, 0x34,0x00,0x4A,0x00,0x4A,0x00,0x34,0x00,0x00,0x00,
+	0x34,0x00,0x4A,0x00,0x4A,0x00,0x34,0x00,0x00,0x00,
 
 	/* Index 25, character 57 "9" (width: 5 pixels) */
-	0x5, 0x4C,0x00,0x52,0x00,0x52,0x00,0x3C,0x00,0x00,0x00,
+	0x4C,0x00,0x52,0x00,0x52,0x00,0x3C,0x00,0x00,0x00,
 
 	/* Index 26, character 58 ":" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x6C,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x6C,0x00,0x6C,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 27, character 59 ";" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x6C,0x01,0xEC,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x6C,0x01,0xEC,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 28, character 60 "<" (width: 5 pixels) */
-	0x5, 0x10,0x00,0x10,0x00,0x28,0x00,0x44,0x00,0x00,0x00,
+	0x10,0x00,0x10,0x00,0x28,0x00,0x44,0x00,0x00,0x00,
 
 	/* Index 29, character 61 "=" (width: 5 pixels) */
-	0x5, 0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,
+	0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,
 
 	/* Index 30, character 62 ">" (width: 5 pixels) */
-	0x5, 0x44,0x00,0x28,0x00,0x10,0x00,0x10,0x00,0x00,0x00,
+	0x44,0x00,0x28,0x00,0x10,0x00,0x10,0x00,0x00,0x00,
 
 	/* Index 31, character 63 "?" (width: 5 pixels) */
-	0x5, 0x06,0x00,0x52,0x00,0x0A,0x00,0x06,0x00,0x00,0x00,
+	0x06,0x00,0x52,0x00,0x0A,0x00,0x06,0x00,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 5 pixels) */
-	0x5, 0x3C,0x00,0x42,0x00,0x5A,0x00,0x5A,0x00,0x1C,0x00,
+	0x3C,0x00,0x42,0x00,0x5A,0x00,0x5A,0x00,0x1C,0x00,
 
 	/* Index 33, character 65 "A" (width: 5 pixels) */
-	0x5, 0x60,0x00,0x1C,0x00,0x12,0x00,0x1C,0x00,0x60,0x00,
+	0x60,0x00,0x1C,0x00,0x12,0x00,0x1C,0x00,0x60,0x00,
 
 	/* Index 34, character 66 "B" (width: 5 pixels) */
-	0x5, 0x7E,0x00,0x4A,0x00,0x4A,0x00,0x76,0x00,0x00,0x00,
+	0x7E,0x00,0x4A,0x00,0x4A,0x00,0x76,0x00,0x00,0x00,
 
 	/* Index 35, character 67 "C" (width: 5 pixels) */
-	0x5, 0x3C,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x00,0x00,
+	0x3C,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x00,0x00,
 
 	/* Index 36, character 68 "D" (width: 5 pixels) */
-	0x5, 0x7E,0x00,0x42,0x00,0x42,0x00,0x3C,0x00,0x00,0x00,
+	0x7E,0x00,0x42,0x00,0x42,0x00,0x3C,0x00,0x00,0x00,
 
 	/* Index 37, character 69 "E" (width: 5 pixels) */
-	0x5, 0x7E,0x00,0x4A,0x00,0x4A,0x00,0x42,0x00,0x00,0x00,
+	0x7E,0x00,0x4A,0x00,0x4A,0x00,0x42,0x00,0x00,0x00,
 
 	/* Index 38, character 70 "F" (width: 5 pixels) */
-	0x5, 0x7E,0x00,0x0A,0x00,0x0A,0x00,0x02,0x00,0x00,0x00,
+	0x7E,0x00,0x0A,0x00,0x0A,0x00,0x02,0x00,0x00,0x00,
 
 	/* Index 39, character 71 "G" (width: 5 pixels) */
-	0x5, 0x3C,0x00,0x42,0x00,0x52,0x00,0x72,0x00,0x00,0x00,
+	0x3C,0x00,0x42,0x00,0x52,0x00,0x72,0x00,0x00,0x00,
 
 	/* Index 40, character 72 "H" (width: 5 pixels) */
-	0x5, 0x7E,0x00,0x08,0x00,0x08,0x00,0x7E,0x00,0x00,0x00,
+	0x7E,0x00,0x08,0x00,0x08,0x00,0x7E,0x00,0x00,0x00,
 
 	/* Index 41, character 73 "I" (width: 5 pixels) */
-	0x5, 0x42,0x00,0x42,0x00,0x7E,0x00,0x42,0x00,0x42,0x00,
+	0x42,0x00,0x42,0x00,0x7E,0x00,0x42,0x00,0x42,0x00,
 
 	/* Index 42, character 74 "J" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x42,0x00,0x42,0x00,0x3E,0x00,0x00,0x00,
+	0x00,0x00,0x42,0x00,0x42,0x00,0x3E,0x00,0x00,0x00,
 
 	/* Index 43, character 75 "K" (width: 5 pixels) */
-	0x5, 0x7E,0x00,0x18,0x00,0x24,0x00,0x42,0x00,0x00,0x00,
+	0x7E,0x00,0x18,0x00,0x24,0x00,0x42,0x00,0x00,0x00,
 
 	/* Index 44, character 76 "L" (width: 5 pixels) */
-	0x5, 0x7E,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
+	0x7E,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
 
 	/* Index 45, character 77 "M" (width: 5 pixels) */
-	0x5, 0x7E,0x00,0x0C,0x00,0x30,0x00,0x0C,0x00,0x7E,0x00,
+	0x7E,0x00,0x0C,0x00,0x30,0x00,0x0C,0x00,0x7E,0x00,
 
 	/* Index 46, character 78 "N" (width: 5 pixels) */
-	0x5, 0x7E,0x00,0x0C,0x00,0x30,0x00,0x7E,0x00,0x00,0x00,
+	0x7E,0x00,0x0C,0x00,0x30,0x00,0x7E,0x00,0x00,0x00,
 
 	/* Index 47, character 79 "O" (width: 5 pixels) */
-	0x5, 0x3C,0x00,0x42,0x00,0x42,0x00,0x3C,0x00,0x00,0x00,
+	0x3C,0x00,0x42,0x00,0x42,0x00,0x3C,0x00,0x00,0x00,
 
 	/* Index 48, character 80 "P" (width: 5 pixels) */
-	0x5, 0x7E,0x00,0x12,0x00,0x12,0x00,0x0C,0x00,0x00,0x00,
+	0x7E,0x00,0x12,0x00,0x12,0x00,0x0C,0x00,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 5 pixels) */
-	0x5, 0x3C,0x00,0x42,0x00,0x42,0x00,0xBC,0x00,0x80,0x00,
+	0x3C,0x00,0x42,0x00,0x42,0x00,0xBC,0x00,0x80,0x00,
 
 	/* Index 50, character 82 "R" (width: 5 pixels) */
-	0x5, 0x7E,0x00,0x12,0x00,0x32,0x00,0x4E,0x00,0x00,0x00,
+	0x7E,0x00,0x12,0x00,0x32,0x00,0x4E,0x00,0x00,0x00,
 
 	/* Index 51, character 83 "S" (width: 5 pixels) */
-	0x5, 0x4C,0x00,0x4A,0x00,0x52,0x00,0x32,0x00,0x00,0x00,
+	0x4C,0x00,0x4A,0x00,0x52,0x00,0x32,0x00,0x00,0x00,
 
 	/* Index 52, character 84 "T" (width: 5 pixels) */
-	0x5, 0x02,0x00,0x02,0x00,0x7E,0x00,0x02,0x00,0x02,0x00,
+	0x02,0x00,0x02,0x00,0x7E,0x00,0x02,0x00,0x02,0x00,
 
 	/* Index 53, character 85 "U" (width: 5 pixels) */
-	0x5, 0x3E,0x00,0x40,0x00,0x40,0x00,0x3E,0x00,0x00,0x00,
+	0x3E,0x00,0x40,0x00,0x40,0x00,0x3E,0x00,0x00,0x00,
 
 	/* Index 54, character 86 "V" (width: 5 pixels) */
-	0x5, 0x06,0x00,0x38,0x00,0x60,0x00,0x38,0x00,0x06,0x00,
+	0x06,0x00,0x38,0x00,0x60,0x00,0x38,0x00,0x06,0x00,
 
 	/* Index 55, character 87 "W" (width: 5 pixels) */
-	0x5, 0x1E,0x00,0x60,0x00,0x1C,0x00,0x70,0x00,0x0E,0x00,
+	0x1E,0x00,0x60,0x00,0x1C,0x00,0x70,0x00,0x0E,0x00,
 
 	/* Index 56, character 88 "X" (width: 5 pixels) */
-	0x5, 0x42,0x00,0x24,0x00,0x18,0x00,0x24,0x00,0x42,0x00,
+	0x42,0x00,0x24,0x00,0x18,0x00,0x24,0x00,0x42,0x00,
 
 	/* Index 57, character 89 "Y" (width: 5 pixels) */
-	0x5, 0x02,0x00,0x0C,0x00,0x70,0x00,0x0C,0x00,0x02,0x00,
+	0x02,0x00,0x0C,0x00,0x70,0x00,0x0C,0x00,0x02,0x00,
 
 	/* Index 58, character 90 "Z" (width: 5 pixels) */
-	0x5, 0x42,0x00,0x62,0x00,0x52,0x00,0x4A,0x00,0x46,0x00,
+	0x42,0x00,0x62,0x00,0x52,0x00,0x4A,0x00,0x46,0x00,
 
 	/* Index 59, character 91 "[" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x00,0x00,0xFF,0x00,0x81,0x00,0x81,0x00,
+	0x00,0x00,0x00,0x00,0xFF,0x00,0x81,0x00,0x81,0x00,
 
 	/* Index 60, character 92 "\" (width: 5 pixels) */
-	0x5, 0x01,0x00,0x06,0x00,0x18,0x00,0x60,0x00,0x80,0x00,
+	0x01,0x00,0x06,0x00,0x18,0x00,0x60,0x00,0x80,0x00,
 
 	/* Index 61, character 93 "]" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x81,0x00,0x81,0x00,0xFF,0x00,0x00,0x00,
+	0x00,0x00,0x81,0x00,0x81,0x00,0xFF,0x00,0x00,0x00,
 
 	/* Index 62, character 94 "^" (width: 5 pixels) */
-	0x5, 0x20,0x00,0x1C,0x00,0x03,0x00,0x1C,0x00,0x20,0x00,
+	0x20,0x00,0x1C,0x00,0x03,0x00,0x1C,0x00,0x20,0x00,
 
 	/* Index 63, character 95 "_" (width: 5 pixels) */
-	0x5, 0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
+	0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
 
 	/* Index 64, character 96 "`" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 5 pixels) */
-	0x5, 0x64,0x00,0x54,0x00,0x54,0x00,0x78,0x00,0x40,0x00,
+	0x64,0x00,0x54,0x00,0x54,0x00,0x78,0x00,0x40,0x00,
 
 	/* Index 66, character 98 "b" (width: 5 pixels) */
-	0x5, 0x7F,0x00,0x44,0x00,0x44,0x00,0x38,0x00,0x00,0x00,
+	0x7F,0x00,0x44,0x00,0x44,0x00,0x38,0x00,0x00,0x00,
 
 	/* Index 67, character 99 "c" (width: 5 pixels) */
-	0x5, 0x38,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x00,0x00,
+	0x38,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x00,0x00,
 
 	/* Index 68, character 100 "d" (width: 5 pixels) */
-	0x5, 0x38,0x00,0x44,0x00,0x44,0x00,0x7F,0x00,0x00,0x00,
+	0x38,0x00,0x44,0x00,0x44,0x00,0x7F,0x00,0x00,0x00,
 
 	/* Index 69, character 101 "e" (width: 5 pixels) */
-	0x5, 0x38,0x00,0x54,0x00,0x54,0x00,0x58,0x00,0x00,0x00,
+	0x38,0x00,0x54,0x00,0x54,0x00,0x58,0x00,0x00,0x00,
 
 	/* Index 70, character 102 "f" (width: 5 pixels) */
-	0x5, 0x04,0x00,0x7E,0x00,0x05,0x00,0x05,0x00,0x00,0x00,
+	0x04,0x00,0x7E,0x00,0x05,0x00,0x05,0x00,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 5 pixels) */
-	0x5, 0x38,0x00,0x44,0x01,0x44,0x01,0xFC,0x00,0x00,0x00,
+	0x38,0x00,0x44,0x01,0x44,0x01,0xFC,0x00,0x00,0x00,
 
 	/* Index 72, character 104 "h" (width: 5 pixels) */
-	0x5, 0x7F,0x00,0x08,0x00,0x04,0x00,0x7C,0x00,0x00,0x00,
+	0x7F,0x00,0x08,0x00,0x04,0x00,0x7C,0x00,0x00,0x00,
 
 	/* Index 73, character 105 "i" (width: 5 pixels) */
-	0x5, 0x04,0x00,0x04,0x00,0x7D,0x00,0x00,0x00,0x00,0x00,
+	0x04,0x00,0x04,0x00,0x7D,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 74, character 106 "j" (width: 5 pixels) */
-	0x5, 0x04,0x01,0x04,0x01,0xFD,0x00,0x00,0x00,0x00,0x00,
+	0x04,0x01,0x04,0x01,0xFD,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 75, character 107 "k" (width: 5 pixels) */
-	0x5, 0x7F,0x00,0x10,0x00,0x28,0x00,0x44,0x00,0x00,0x00,
+	0x7F,0x00,0x10,0x00,0x28,0x00,0x44,0x00,0x00,0x00,
 
 	/* Index 76, character 108 "l" (width: 5 pixels) */
-	0x5, 0x01,0x00,0x01,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,
+	0x01,0x00,0x01,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 77, character 109 "m" (width: 5 pixels) */
-	0x5, 0x7C,0x00,0x04,0x00,0x7C,0x00,0x04,0x00,0x7C,0x00,
+	0x7C,0x00,0x04,0x00,0x7C,0x00,0x04,0x00,0x7C,0x00,
 
 	/* Index 78, character 110 "n" (width: 5 pixels) */
-	0x5, 0x7C,0x00,0x08,0x00,0x04,0x00,0x7C,0x00,0x00,0x00,
+	0x7C,0x00,0x08,0x00,0x04,0x00,0x7C,0x00,0x00,0x00,
 
 	/* Index 79, character 111 "o" (width: 5 pixels) */
-	0x5, 0x38,0x00,0x44,0x00,0x44,0x00,0x38,0x00,0x00,0x00,
+	0x38,0x00,0x44,0x00,0x44,0x00,0x38,0x00,0x00,0x00,
 
 	/* Index 80, character 112 "p" (width: 5 pixels) */
-	0x5, 0xFC,0x01,0x44,0x00,0x44,0x00,0x38,0x00,0x00,0x00,
+	0xFC,0x01,0x44,0x00,0x44,0x00,0x38,0x00,0x00,0x00,
 
 	/* Index 81, character 113 "q" (width: 5 pixels) */
-	0x5, 0x38,0x00,0x44,0x00,0x44,0x00,0xFC,0x01,0x00,0x00,
+	0x38,0x00,0x44,0x00,0x44,0x00,0xFC,0x01,0x00,0x00,
 
 	/* Index 82, character 114 "r" (width: 5 pixels) */
-	0x5, 0x7C,0x00,0x08,0x00,0x04,0x00,0x04,0x00,0x00,0x00,
+	0x7C,0x00,0x08,0x00,0x04,0x00,0x04,0x00,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 5 pixels) */
-	0x5, 0x48,0x00,0x54,0x00,0x54,0x00,0x24,0x00,0x00,0x00,
+	0x48,0x00,0x54,0x00,0x54,0x00,0x24,0x00,0x00,0x00,
 
 	/* Index 84, character 116 "t" (width: 5 pixels) */
-	0x5, 0x04,0x00,0x3E,0x00,0x44,0x00,0x44,0x00,0x00,0x00,
+	0x04,0x00,0x3E,0x00,0x44,0x00,0x44,0x00,0x00,0x00,
 
 	/* Index 85, character 117 "u" (width: 5 pixels) */
-	0x5, 0x7C,0x00,0x40,0x00,0x20,0x00,0x7C,0x00,0x00,0x00,
+	0x7C,0x00,0x40,0x00,0x20,0x00,0x7C,0x00,0x00,0x00,
 
 	/* Index 86, character 118 "v" (width: 5 pixels) */
-	0x5, 0x04,0x00,0x38,0x00,0x40,0x00,0x38,0x00,0x04,0x00,
+	0x04,0x00,0x38,0x00,0x40,0x00,0x38,0x00,0x04,0x00,
 
 	/* Index 87, character 119 "w" (width: 5 pixels) */
-	0x5, 0x1C,0x00,0x60,0x00,0x1C,0x00,0x60,0x00,0x1C,0x00,
+	0x1C,0x00,0x60,0x00,0x1C,0x00,0x60,0x00,0x1C,0x00,
 
 	/* Index 88, character 120 "x" (width: 5 pixels) */
-	0x5, 0x44,0x00,0x28,0x00,0x10,0x00,0x28,0x00,0x44,0x00,
+	0x44,0x00,0x28,0x00,0x10,0x00,0x28,0x00,0x44,0x00,
 
 	/* Index 89, character 121 "y" (width: 5 pixels) */
-	0x5, 0x04,0x01,0x38,0x01,0xE0,0x00,0x18,0x00,0x04,0x00,
+	0x04,0x01,0x38,0x01,0xE0,0x00,0x18,0x00,0x04,0x00,
 
 	/* Index 90, character 122 "z" (width: 5 pixels) */
-	0x5, 0x44,0x00,0x64,0x00,0x54,0x00,0x4C,0x00,0x00,0x00,
+	0x44,0x00,0x64,0x00,0x54,0x00,0x4C,0x00,0x00,0x00,
 
 	/* Index 91, character 123 "{" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x08,0x00,0xF7,0x00,0x81,0x00,0x00,0x00,
+	0x00,0x00,0x08,0x00,0xF7,0x00,0x81,0x00,0x00,0x00,
 
 	/* Index 92, character 124 "|" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 93, character 125 "}" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x81,0x00,0xF7,0x00,0x08,0x00,0x00,0x00,
+	0x00,0x00,0x81,0x00,0xF7,0x00,0x08,0x00,0x00,0x00,
 
 	/* Index 94, character 126 "~" (width: 5 pixels) */
-	0x5, 0x18,0x00,0x08,0x00,0x18,0x00,0x10,0x00,0x18,0x00
+	0x18,0x00,0x08,0x00,0x18,0x00,0x10,0x00,0x18,0x00
+};
+
+// Offset of each bitmap in LucidaConsole7_bitmaps
+const unsigned short LucidaConsole7_offsets[] = 
+{
+	0x0,	// Index 0
+	0xA,	// Index 1
+	0x14,	// Index 2
+	0x1E,	// Index 3
+	0x28,	// Index 4
+	0x32,	// Index 5
+	0x3C,	// Index 6
+	0x46,	// Index 7
+	0x50,	// Index 8
+	0x5A,	// Index 9
+	0x64,	// Index 10
+	0x6E,	// Index 11
+	0x78,	// Index 12
+	0x82,	// Index 13
+	0x8C,	// Index 14
+	0x96,	// Index 15
+	0xA0,	// Index 16
+	0xAA,	// Index 17
+	0xB4,	// Index 18
+	0xBE,	// Index 19
+	0xC8,	// Index 20
+	0xD2,	// Index 21
+	0xDC,	// Index 22
+	0xE6,	// Index 23
+	0xF0,	// Index 24
+	0xFA,	// Index 25
+	0x104,	// Index 26
+	0x10E,	// Index 27
+	0x118,	// Index 28
+	0x122,	// Index 29
+	0x12C,	// Index 30
+	0x136,	// Index 31
+	0x140,	// Index 32
+	0x14A,	// Index 33
+	0x154,	// Index 34
+	0x15E,	// Index 35
+	0x168,	// Index 36
+	0x172,	// Index 37
+	0x17C,	// Index 38
+	0x186,	// Index 39
+	0x190,	// Index 40
+	0x19A,	// Index 41
+	0x1A4,	// Index 42
+	0x1AE,	// Index 43
+	0x1B8,	// Index 44
+	0x1C2,	// Index 45
+	0x1CC,	// Index 46
+	0x1D6,	// Index 47
+	0x1E0,	// Index 48
+	0x1EA,	// Index 49
+	0x1F4,	// Index 50
+	0x1FE,	// Index 51
+	0x208,	// Index 52
+	0x212,	// Index 53
+	0x21C,	// Index 54
+	0x226,	// Index 55
+	0x230,	// Index 56
+	0x23A,	// Index 57
+	0x244,	// Index 58
+	0x24E,	// Index 59
+	0x258,	// Index 60
+	0x262,	// Index 61
+	0x26C,	// Index 62
+	0x276,	// Index 63
+	0x280,	// Index 64
+	0x28A,	// Index 65
+	0x294,	// Index 66
+	0x29E,	// Index 67
+	0x2A8,	// Index 68
+	0x2B2,	// Index 69
+	0x2BC,	// Index 70
+	0x2C6,	// Index 71
+	0x2D0,	// Index 72
+	0x2DA,	// Index 73
+	0x2E4,	// Index 74
+	0x2EE,	// Index 75
+	0x2F8,	// Index 76
+	0x302,	// Index 77
+	0x30C,	// Index 78
+	0x316,	// Index 79
+	0x320,	// Index 80
+	0x32A,	// Index 81
+	0x334,	// Index 82
+	0x33E,	// Index 83
+	0x348,	// Index 84
+	0x352,	// Index 85
+	0x35C,	// Index 86
+	0x366,	// Index 87
+	0x370,	// Index 88
+	0x37A,	// Index 89
+	0x384,	// Index 90
+	0x38E,	// Index 91
+	0x398,	// Index 92
+	0x3A2,	// Index 93
+	0x3AC,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char LucidaConsole7_widths[] = 
+{
+	0x5,	// Index 0
+	0x5,	// Index 1
+	0x5,	// Index 2
+	0x5,	// Index 3
+	0x5,	// Index 4
+	0x5,	// Index 5
+	0x5,	// Index 6
+	0x5,	// Index 7
+	0x5,	// Index 8
+	0x5,	// Index 9
+	0x5,	// Index 10
+	0x5,	// Index 11
+	0x5,	// Index 12
+	0x5,	// Index 13
+	0x5,	// Index 14
+	0x5,	// Index 15
+	0x5,	// Index 16
+	0x5,	// Index 17
+	0x5,	// Index 18
+	0x5,	// Index 19
+	0x5,	// Index 20
+	0x5,	// Index 21
+	0x5,	// Index 22
+	0x5,	// Index 23
+	0x5,	// Index 24
+	0x5,	// Index 25
+	0x5,	// Index 26
+	0x5,	// Index 27
+	0x5,	// Index 28
+	0x5,	// Index 29
+	0x5,	// Index 30
+	0x5,	// Index 31
+	0x5,	// Index 32
+	0x5,	// Index 33
+	0x5,	// Index 34
+	0x5,	// Index 35
+	0x5,	// Index 36
+	0x5,	// Index 37
+	0x5,	// Index 38
+	0x5,	// Index 39
+	0x5,	// Index 40
+	0x5,	// Index 41
+	0x5,	// Index 42
+	0x5,	// Index 43
+	0x5,	// Index 44
+	0x5,	// Index 45
+	0x5,	// Index 46
+	0x5,	// Index 47
+	0x5,	// Index 48
+	0x5,	// Index 49
+	0x5,	// Index 50
+	0x5,	// Index 51
+	0x5,	// Index 52
+	0x5,	// Index 53
+	0x5,	// Index 54
+	0x5,	// Index 55
+	0x5,	// Index 56
+	0x5,	// Index 57
+	0x5,	// Index 58
+	0x5,	// Index 59
+	0x5,	// Index 60
+	0x5,	// Index 61
+	0x5,	// Index 62
+	0x5,	// Index 63
+	0x5,	// Index 64
+	0x5,	// Index 65
+	0x5,	// Index 66
+	0x5,	// Index 67
+	0x5,	// Index 68
+	0x5,	// Index 69
+	0x5,	// Index 70
+	0x5,	// Index 71
+	0x5,	// Index 72
+	0x5,	// Index 73
+	0x5,	// Index 74
+	0x5,	// Index 75
+	0x5,	// Index 76
+	0x5,	// Index 77
+	0x5,	// Index 78
+	0x5,	// Index 79
+	0x5,	// Index 80
+	0x5,	// Index 81
+	0x5,	// Index 82
+	0x5,	// Index 83
+	0x5,	// Index 84
+	0x5,	// Index 85
+	0x5,	// Index 86
+	0x5,	// Index 87
+	0x5,	// Index 88
+	0x5,	// Index 89
+	0x5,	// Index 90
+	0x5,	// Index 91
+	0x5,	// Index 92
+	0x5,	// Index 93
+	0x5,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char LucidaConsole7_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x6, 0x0,	// Index 1
+	0x7, 0x0,	// Index 2
+	0x6, 0x0,	// Index 3
+	0x7, 0x1,	// Index 4
+	0x6, 0x0,	// Index 5
+	0x6, 0x0,	// Index 6
+	0x7, 0x0,	// Index 7
+	0x7, 0x1,	// Index 8
+	0x7, 0x1,	// Index 9
+	0x6, 0x0,	// Index 10
+	0x5, 0x0,	// Index 11
+	0x2, 0x2,	// Index 12
+	0x3, 0x0,	// Index 13
+	0x2, 0x0,	// Index 14
+	0x7, 0x1,	// Index 15
+	0x6, 0x0,	// Index 16
+	0x6, 0x0,	// Index 17
+	0x6, 0x0,	// Index 18
+	0x6, 0x0,	// Index 19
+	0x6, 0x0,	// Index 20
+	0x6, 0x0,	// Index 21
+	0x6, 0x0,	// Index 22
+	0x6, 0x0,	// Index 23
+	0x6, 0x0,	// Index 24
+	0x6, 0x0,	// Index 25
+	0x5, 0x0,	// Index 26
+	0x5, 0x2,	// Index 27
+	0x5, 0x0,	// Index 28
+	0x4, 0x0,	// Index 29
+	0x5, 0x0,	// Index 30
+	0x6, 0x0,	// Index 31
+	0x6, 0x0,	// Index 32
+	0x6, 0x0,	// Index 33
+	0x6, 0x0,	// Index 34
+	0x6, 0x0,	// Index 35
+	0x6, 0x0,	// Index 36
+	0x6, 0x0,	// Index 37
+	0x6, 0x0,	// Index 38
+	0x6, 0x0,	// Index 39
+	0x6, 0x0,	// Index 40
+	0x6, 0x0,	// Index 41
+	0x6, 0x0,	// Index 42
+	0x6, 0x0,	// Index 43
+	0x6, 0x0,	// Index 44
+	0x6, 0x0,	// Index 45
+	0x6, 0x0,	// Index 46
+	0x6, 0x0,	// Index 47
+	0x6, 0x0,	// Index 48
+	0x6, 0x1,	// Index 49
+	0x6, 0x0,	// Index 50
+	0x6, 0x0,	// Index 51
+	0x6, 0x0,	// Index 52
+	0x6, 0x0,	// Index 53
+	0x6, 0x0,	// Index 54
+	0x6, 0x0,	// Index 55
+	0x6, 0x0,	// Index 56
+	0x6, 0x0,	// Index 57
+	0x6, 0x0,	// Index 58
+	0x7, 0x1,	// Index 59
+	0x7, 0x1,	// Index 60
+	0x7, 0x1,	// Index 61
+	0x7, 0x0,	// Index 62
+	0x0, 0x1,	// Index 63
+	0x7, 0x0,	// Index 64
+	0x5, 0x0,	// Index 65
+	0x7, 0x0,	// Index 66
+	0x5, 0x0,	// Index 67
+	0x7, 0x0,	// Index 68
+	0x5, 0x0,	// Index 69
+	0x7, 0x0,	// Index 70
+	0x5, 0x2,	// Index 71
+	0x7, 0x0,	// Index 72
+	0x7, 0x0,	// Index 73
+	0x7, 0x2,	// Index 74
+	0x7, 0x0,	// Index 75
+	0x7, 0x0,	// Index 76
+	0x5, 0x0,	// Index 77
+	0x5, 0x0,	// Index 78
+	0x5, 0x0,	// Index 79
+	0x5, 0x2,	// Index 80
+	0x5, 0x2,	// Index 81
+	0x5, 0x0,	// Index 82
+	0x5, 0x0,	// Index 83
+	0x6, 0x0,	// Index 84
+	0x5, 0x0,	// Index 85
+	0x5, 0x0,	// Index 86
+	0x5, 0x0,	// Index 87
+	0x5, 0x0,	// Index 88
+	0x5, 0x2,	// Index 89
+	0x5, 0x0,	// Index 90
+	0x7, 0x1,	// Index 91
+	0x7, 0x1,	// Index 92
+	0x7, 0x1,	// Index 93
+	0x4, 0x0,	// Index 94
+};
+
+const font_t LucidaConsole7 = 
+{
+	LucidaConsole7_bitmaps,
+	LucidaConsole7_offsets,
+	LucidaConsole7_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x9,	// Height 
+	0,	// Flags 
+	LucidaConsole7_extents,
+	0x7	// Ascent 
 };
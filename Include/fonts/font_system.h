@@ -0,0 +1,616 @@
+//---------------------------------------------------------------
+// Font created by fontpack.py from ks0108.h
+//---------------------------------------------------------------
+
+#include "graphics.h"
+
+//---------------------------------------------------------------
+// Group Name: System5x7
+// Source: ks0108.h
+// Byte Orientation: verticalCeiling
+// Font Height: 8 pixel(s)
+// Font Type: Proportional
+// Number of Bitmaps: 95
+// Start Character: 32 " "
+// Stop Character: 126 "~"
+//---------------------------------------------------------------
+const unsigned char System5x7_bitmaps[] = 
+{
+	/* Index 0, character 32 " " (width: 3 pixels) */
+	0x00,0x00,0x00,
+
+	/* Index 1, character 33 "!" (width: 3 pixels) */
+	0x00,0x5F,0x00,
+
+	/* Index 2, character 34 """ (width: 3 pixels) */
+	0x07,0x00,0x07,
+
+	/* Index 3, character 35 "#" (width: 5 pixels) */
+	0x14,0x7F,0x14,0x7F,0x14,
+
+	/* Index 4, character 36 "$" (width: 5 pixels) */
+	0x26,0x49,0x7F,0x49,0x32,
+
+	/* Index 5, character 37 "%" (width: 5 pixels) */
+	0x63,0x13,0x08,0x64,0x63,
+
+	/* Index 6, character 38 "&" (width: 5 pixels) */
+	0x36,0x49,0x00,0x22,0x50,
+
+	/* Index 7, character 39 "'" (width: 3 pixels) */
+	0x04,0x03,0x00,
+
+	/* Index 8, character 40 "(" (width: 3 pixels) */
+	0x1C,0x22,0x41,
+
+	/* Index 9, character 41 ")" (width: 3 pixels) */
+	0x41,0x22,0x1C,
+
+	/* Index 10, character 42 "*" (width: 5 pixels) */
+	0x14,0x2A,0x1C,0x2A,0x14,
+
+	/* Index 11, character 43 "+" (width: 5 pixels) */
+	0x08,0x08,0x3E,0x08,0x08,
+
+	/* Index 12, character 44 "," (width: 2 pixels) */
+	0x80,0x60,
+
+	/* Index 13, character 45 "-" (width: 5 pixels) */
+	0x08,0x08,0x08,0x08,0x08,
+
+	/* Index 14, character 46 "." (width: 1 pixels) */
+	0x40,
+
+	/* Index 15, character 47 "/" (width: 5 pixels) */
+	0x60,0x10,0x08,0x04,0x03,
+
+	/* Index 16, character 48 "0" (width: 5 pixels) */
+	0x3E,0x51,0x49,0x45,0x3E,
+
+	/* Index 17, character 49 "1" (width: 5 pixels) */
+	0x00,0x42,0x7F,0x40,0x00,
+
+	/* Index 18, character 50 "2" (width: 5 pixels) */
+	0x62,0x51,0x49,0x49,0x46,
+
+	/* Index 19, character 51 "3" (width: 5 pixels) */
+	0x22,0x41,0x49,0x49,0x36,
+
+	/* Index 20, character 52 "4" (width: 5 pixels) */
+	0x18,0x14,0x12,0x7F,0x10,
+
+	/* Index 21, character 53 "5" (width: 5 pixels) */
+	0x27,0x49,0x49,0x49,0x31,
+
+	/* Index 22, character 54 "6" (width: 5 pixels) */
+	0x3C,0x4A,0x49,0x49,0x30,
+
+	/* Index 23, character 55 "7" (width: 5 pixels) */
+	0x01,0x71,0x09,0x05,0x03,
+
+	/* Index 24, character 56 "8" (width: 5 pixels) */
+	0x36,0x49,0x49,0x49,0x36,
+
+	/* Index 25, character 57 "9" (width: 5 pixels) */
+	0x06,0x49,0x49,0x29,0x1E,
+
+	/* Index 26, character 58 ":" (width: 1 pixels) */
+	0x14,
+
+	/* Index 27, character 59 ";" (width: 2 pixels) */
+	0x80,0x68,
+
+	/* Index 28, character 60 "<" (width: 4 pixels) */
+	0x08,0x14,0x22,0x41,
+
+	/* Index 29, character 61 "=" (width: 4 pixels) */
+	0x14,0x14,0x14,0x14,
+
+	/* Index 30, character 62 ">" (width: 4 pixels) */
+	0x41,0x22,0x14,0x08,
+
+	/* Index 31, character 63 "?" (width: 5 pixels) */
+	0x02,0x01,0x51,0x09,0x06,
+
+	/* Index 32, character 64 "@" (width: 5 pixels) */
+	0x3E,0x41,0x5D,0x00,0x4E,
+
+	/* Index 33, character 65 "A" (width: 5 pixels) */
+	0x7C,0x12,0x11,0x12,0x7C,
+
+	/* Index 34, character 66 "B" (width: 5 pixels) */
+	0x7F,0x49,0x49,0x49,0x36,
+
+	/* Index 35, character 67 "C" (width: 5 pixels) */
+	0x3E,0x41,0x41,0x41,0x22,
+
+	/* Index 36, character 68 "D" (width: 5 pixels) */
+	0x7F,0x41,0x41,0x22,0x1C,
+
+	/* Index 37, character 69 "E" (width: 5 pixels) */
+	0x7F,0x49,0x49,0x49,0x41,
+
+	/* Index 38, character 70 "F" (width: 5 pixels) */
+	0x7F,0x09,0x09,0x09,0x01,
+
+	/* Index 39, character 71 "G" (width: 5 pixels) */
+	0x3E,0x41,0x49,0x29,0x72,
+
+	/* Index 40, character 72 "H" (width: 5 pixels) */
+	0x7F,0x08,0x08,0x08,0x7F,
+
+	/* Index 41, character 73 "I" (width: 3 pixels) */
+	0x41,0x7F,0x41,
+
+	/* Index 42, character 74 "J" (width: 5 pixels) */
+	0x20,0x40,0x41,0x3F,0x01,
+
+	/* Index 43, character 75 "K" (width: 5 pixels) */
+	0x7F,0x08,0x14,0x22,0x41,
+
+	/* Index 44, character 76 "L" (width: 4 pixels) */
+	0x7F,0x40,0x40,0x40,
+
+	/* Index 45, character 77 "M" (width: 5 pixels) */
+	0x7F,0x02,0x0C,0x02,0x7F,
+
+	/* Index 46, character 78 "N" (width: 5 pixels) */
+	0x7F,0x06,0x08,0x30,0x7F,
+
+	/* Index 47, character 79 "O" (width: 5 pixels) */
+	0x3E,0x41,0x41,0x41,0x3E,
+
+	/* Index 48, character 80 "P" (width: 5 pixels) */
+	0x7F,0x09,0x09,0x09,0x06,
+
+	/* Index 49, character 81 "Q" (width: 5 pixels) */
+	0x3E,0x41,0x51,0x21,0x5E,
+
+	/* Index 50, character 82 "R" (width: 5 pixels) */
+	0x7F,0x09,0x19,0x29,0x46,
+
+	/* Index 51, character 83 "S" (width: 5 pixels) */
+	0x26,0x49,0x49,0x49,0x32,
+
+	/* Index 52, character 84 "T" (width: 5 pixels) */
+	0x01,0x01,0x7F,0x01,0x01,
+
+	/* Index 53, character 85 "U" (width: 5 pixels) */
+	0x3F,0x40,0x40,0x40,0x3F,
+
+	/* Index 54, character 86 "V" (width: 5 pixels) */
+	0x0F,0x30,0x40,0x30,0x0F,
+
+	/* Index 55, character 87 "W" (width: 7 pixels) */
+	0x0F,0x30,0x40,0x38,0x40,0x30,0x0F,
+
+	/* Index 56, character 88 "X" (width: 5 pixels) */
+	0x63,0x14,0x08,0x14,0x63,
+
+	/* Index 57, character 89 "Y" (width: 5 pixels) */
+	0x07,0x08,0x70,0x08,0x07,
+
+	/* Index 58, character 90 "Z" (width: 5 pixels) */
+	0x61,0x51,0x49,0x45,0x43,
+
+	/* Index 59, character 91 "[" (width: 3 pixels) */
+	0x7F,0x41,0x41,
+
+	/* Index 60, character 92 "\" (width: 5 pixels) */
+	0x03,0x04,0x08,0x10,0x60,
+
+	/* Index 61, character 93 "]" (width: 3 pixels) */
+	0x41,0x41,0x7F,
+
+	/* Index 62, character 94 "^" (width: 5 pixels) */
+	0x08,0x04,0x02,0x04,0x08,
+
+	/* Index 63, character 95 "_" (width: 5 pixels) */
+	0x40,0x40,0x40,0x40,0x40,
+
+	/* Index 64, character 96 "`" (width: 3 pixels) */
+	0x03,0x04,0x00,
+
+	/* Index 65, character 97 "a" (width: 4 pixels) */
+	0x20,0x54,0x54,0x78,
+
+	/* Index 66, character 98 "b" (width: 5 pixels) */
+	0x7F,0x28,0x44,0x44,0x38,
+
+	/* Index 67, character 99 "c" (width: 4 pixels) */
+	0x38,0x44,0x44,0x28,
+
+	/* Index 68, character 100 "d" (width: 5 pixels) */
+	0x38,0x44,0x44,0x28,0x7F,
+
+	/* Index 69, character 101 "e" (width: 4 pixels) */
+	0x38,0x54,0x54,0x48,
+
+	/* Index 70, character 102 "f" (width: 4 pixels) */
+	0x08,0x7E,0x09,0x02,
+
+	/* Index 71, character 103 "g" (width: 4 pixels) */
+	0x98,0xA4,0xA4,0x58,
+
+	/* Index 72, character 104 "h" (width: 5 pixels) */
+	0x7F,0x08,0x04,0x04,0x78,
+
+	/* Index 73, character 105 "i" (width: 2 pixels) */
+	0x3D,0x40,
+
+	/* Index 74, character 106 "j" (width: 3 pixels) */
+	0x80,0x84,0x7D,
+
+	/* Index 75, character 107 "k" (width: 4 pixels) */
+	0x7F,0x10,0x28,0x44,
+
+	/* Index 76, character 108 "l" (width: 3 pixels) */
+	0x01,0x7F,0x00,
+
+	/* Index 77, character 109 "m" (width: 6 pixels) */
+	0x7C,0x08,0x04,0x78,0x04,0x78,
+
+	/* Index 78, character 110 "n" (width: 5 pixels) */
+	0x7C,0x08,0x04,0x04,0x78,
+
+	/* Index 79, character 111 "o" (width: 4 pixels) */
+	0x38,0x44,0x44,0x38,
+
+	/* Index 80, character 112 "p" (width: 5 pixels) */
+	0xFC,0x18,0x24,0x24,0x18,
+
+	/* Index 81, character 113 "q" (width: 5 pixels) */
+	0x18,0x24,0x24,0x18,0xFC,
+
+	/* Index 82, character 114 "r" (width: 5 pixels) */
+	0x7C,0x08,0x04,0x04,0x08,
+
+	/* Index 83, character 115 "s" (width: 4 pixels) */
+	0x48,0x54,0x54,0x24,
+
+	/* Index 84, character 116 "t" (width: 3 pixels) */
+	0x04,0x3E,0x44,
+
+	/* Index 85, character 117 "u" (width: 5 pixels) */
+	0x3C,0x40,0x40,0x20,0x7C,
+
+	/* Index 86, character 118 "v" (width: 5 pixels) */
+	0x1C,0x20,0x40,0x20,0x1C,
+
+	/* Index 87, character 119 "w" (width: 5 pixels) */
+	0x3C,0x40,0x30,0x40,0x3C,
+
+	/* Index 88, character 120 "x" (width: 5 pixels) */
+	0x44,0x28,0x10,0x28,0x44,
+
+	/* Index 89, character 121 "y" (width: 4 pixels) */
+	0x1C,0xA0,0xA0,0x7C,
+
+	/* Index 90, character 122 "z" (width: 4 pixels) */
+	0x64,0x54,0x54,0x4C,
+
+	/* Index 91, character 123 "{" (width: 3 pixels) */
+	0x08,0x36,0x41,
+
+	/* Index 92, character 124 "|" (width: 3 pixels) */
+	0x00,0x7F,0x00,
+
+	/* Index 93, character 125 "}" (width: 3 pixels) */
+	0x41,0x36,0x08,
+
+	/* Index 94, character 126 "~" (width: 2 pixels) */
+	0x00,0x00
+};
+
+// Offset of each bitmap in System5x7_bitmaps
+const unsigned short System5x7_offsets[] = 
+{
+	0x0,	// Index 0
+	0x3,	// Index 1
+	0x6,	// Index 2
+	0x9,	// Index 3
+	0xE,	// Index 4
+	0x13,	// Index 5
+	0x18,	// Index 6
+	0x1D,	// Index 7
+	0x20,	// Index 8
+	0x23,	// Index 9
+	0x26,	// Index 10
+	0x2B,	// Index 11
+	0x30,	// Index 12
+	0x32,	// Index 13
+	0x37,	// Index 14
+	0x38,	// Index 15
+	0x3D,	// Index 16
+	0x42,	// Index 17
+	0x47,	// Index 18
+	0x4C,	// Index 19
+	0x51,	// Index 20
+	0x56,	// Index 21
+	0x5B,	// Index 22
+	0x60,	// Index 23
+	0x65,	// Index 24
+	0x6A,	// Index 25
+	0x6F,	// Index 26
+	0x70,	// Index 27
+	0x72,	// Index 28
+	0x76,	// Index 29
+	0x7A,	// Index 30
+	0x7E,	// Index 31
+	0x83,	// Index 32
+	0x88,	// Index 33
+	0x8D,	// Index 34
+	0x92,	// Index 35
+	0x97,	// Index 36
+	0x9C,	// Index 37
+	0xA1,	// Index 38
+	0xA6,	// Index 39
+	0xAB,	// Index 40
+	0xB0,	// Index 41
+	0xB3,	// Index 42
+	0xB8,	// Index 43
+	0xBD,	// Index 44
+	0xC1,	// Index 45
+	0xC6,	// Index 46
+	0xCB,	// Index 47
+	0xD0,	// Index 48
+	0xD5,	// Index 49
+	0xDA,	// Index 50
+	0xDF,	// Index 51
+	0xE4,	// Index 52
+	0xE9,	// Index 53
+	0xEE,	// Index 54
+	0xF3,	// Index 55
+	0xFA,	// Index 56
+	0xFF,	// Index 57
+	0x104,	// Index 58
+	0x109,	// Index 59
+	0x10C,	// Index 60
+	0x111,	// Index 61
+	0x114,	// Index 62
+	0x119,	// Index 63
+	0x11E,	// Index 64
+	0x121,	// Index 65
+	0x125,	// Index 66
+	0x12A,	// Index 67
+	0x12E,	// Index 68
+	0x133,	// Index 69
+	0x137,	// Index 70
+	0x13B,	// Index 71
+	0x13F,	// Index 72
+	0x144,	// Index 73
+	0x146,	// Index 74
+	0x149,	// Index 75
+	0x14D,	// Index 76
+	0x150,	// Index 77
+	0x156,	// Index 78
+	0x15B,	// Index 79
+	0x15F,	// Index 80
+	0x164,	// Index 81
+	0x169,	// Index 82
+	0x16E,	// Index 83
+	0x172,	// Index 84
+	0x175,	// Index 85
+	0x17A,	// Index 86
+	0x17F,	// Index 87
+	0x184,	// Index 88
+	0x189,	// Index 89
+	0x18D,	// Index 90
+	0x191,	// Index 91
+	0x194,	// Index 92
+	0x197,	// Index 93
+	0x19A,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char System5x7_widths[] = 
+{
+	0x3,	// Index 0
+	0x3,	// Index 1
+	0x3,	// Index 2
+	0x5,	// Index 3
+	0x5,	// Index 4
+	0x5,	// Index 5
+	0x5,	// Index 6
+	0x3,	// Index 7
+	0x3,	// Index 8
+	0x3,	// Index 9
+	0x5,	// Index 10
+	0x5,	// Index 11
+	0x2,	// Index 12
+	0x5,	// Index 13
+	0x1,	// Index 14
+	0x5,	// Index 15
+	0x5,	// Index 16
+	0x5,	// Index 17
+	0x5,	// Index 18
+	0x5,	// Index 19
+	0x5,	// Index 20
+	0x5,	// Index 21
+	0x5,	// Index 22
+	0x5,	// Index 23
+	0x5,	// Index 24
+	0x5,	// Index 25
+	0x1,	// Index 26
+	0x2,	// Index 27
+	0x4,	// Index 28
+	0x4,	// Index 29
+	0x4,	// Index 30
+	0x5,	// Index 31
+	0x5,	// Index 32
+	0x5,	// Index 33
+	0x5,	// Index 34
+	0x5,	// Index 35
+	0x5,	// Index 36
+	0x5,	// Index 37
+	0x5,	// Index 38
+	0x5,	// Index 39
+	0x5,	// Index 40
+	0x3,	// Index 41
+	0x5,	// Index 42
+	0x5,	// Index 43
+	0x4,	// Index 44
+	0x5,	// Index 45
+	0x5,	// Index 46
+	0x5,	// Index 47
+	0x5,	// Index 48
+	0x5,	// Index 49
+	0x5,	// Index 50
+	0x5,	// Index 51
+	0x5,	// Index 52
+	0x5,	// Index 53
+	0x5,	// Index 54
+	0x7,	// Index 55
+	0x5,	// Index 56
+	0x5,	// Index 57
+	0x5,	// Index 58
+	0x3,	// Index 59
+	0x5,	// Index 60
+	0x3,	// Index 61
+	0x5,	// Index 62
+	0x5,	// Index 63
+	0x3,	// Index 64
+	0x4,	// Index 65
+	0x5,	// Index 66
+	0x4,	// Index 67
+	0x5,	// Index 68
+	0x4,	// Index 69
+	0x4,	// Index 70
+	0x4,	// Index 71
+	0x5,	// Index 72
+	0x2,	// Index 73
+	0x3,	// Index 74
+	0x4,	// Index 75
+	0x3,	// Index 76
+	0x6,	// Index 77
+	0x5,	// Index 78
+	0x4,	// Index 79
+	0x5,	// Index 80
+	0x5,	// Index 81
+	0x5,	// Index 82
+	0x4,	// Index 83
+	0x3,	// Index 84
+	0x5,	// Index 85
+	0x5,	// Index 86
+	0x5,	// Index 87
+	0x5,	// Index 88
+	0x4,	// Index 89
+	0x4,	// Index 90
+	0x3,	// Index 91
+	0x3,	// Index 92
+	0x3,	// Index 93
+	0x2,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char System5x7_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x7, 0x0,	// Index 1
+	0x7, 0x0,	// Index 2
+	0x7, 0x0,	// Index 3
+	0x7, 0x0,	// Index 4
+	0x7, 0x0,	// Index 5
+	0x7, 0x0,	// Index 6
+	0x7, 0x0,	// Index 7
+	0x7, 0x0,	// Index 8
+	0x7, 0x0,	// Index 9
+	0x6, 0x0,	// Index 10
+	0x6, 0x0,	// Index 11
+	0x2, 0x1,	// Index 12
+	0x4, 0x0,	// Index 13
+	0x1, 0x0,	// Index 14
+	0x7, 0x0,	// Index 15
+	0x7, 0x0,	// Index 16
+	0x7, 0x0,	// Index 17
+	0x7, 0x0,	// Index 18
+	0x7, 0x0,	// Index 19
+	0x7, 0x0,	// Index 20
+	0x7, 0x0,	// Index 21
+	0x7, 0x0,	// Index 22
+	0x7, 0x0,	// Index 23
+	0x7, 0x0,	// Index 24
+	0x7, 0x0,	// Index 25
+	0x5, 0x0,	// Index 26
+	0x4, 0x1,	// Index 27
+	0x7, 0x0,	// Index 28
+	0x5, 0x0,	// Index 29
+	0x7, 0x0,	// Index 30
+	0x7, 0x0,	// Index 31
+	0x7, 0x0,	// Index 32
+	0x7, 0x0,	// Index 33
+	0x7, 0x0,	// Index 34
+	0x7, 0x0,	// Index 35
+	0x7, 0x0,	// Index 36
+	0x7, 0x0,	// Index 37
+	0x7, 0x0,	// Index 38
+	0x7, 0x0,	// Index 39
+	0x7, 0x0,	// Index 40
+	0x7, 0x0,	// Index 41
+	0x7, 0x0,	// Index 42
+	0x7, 0x0,	// Index 43
+	0x7, 0x0,	// Index 44
+	0x7, 0x0,	// Index 45
+	0x7, 0x0,	// Index 46
+	0x7, 0x0,	// Index 47
+	0x7, 0x0,	// Index 48
+	0x7, 0x0,	// Index 49
+	0x7, 0x0,	// Index 50
+	0x7, 0x0,	// Index 51
+	0x7, 0x0,	// Index 52
+	0x7, 0x0,	// Index 53
+	0x7, 0x0,	// Index 54
+	0x7, 0x0,	// Index 55
+	0x7, 0x0,	// Index 56
+	0x7, 0x0,	// Index 57
+	0x7, 0x0,	// Index 58
+	0x7, 0x0,	// Index 59
+	0x7, 0x0,	// Index 60
+	0x7, 0x0,	// Index 61
+	0x6, 0x0,	// Index 62
+	0x1, 0x0,	// Index 63
+	0x7, 0x0,	// Index 64
+	0x5, 0x0,	// Index 65
+	0x7, 0x0,	// Index 66
+	0x5, 0x0,	// Index 67
+	0x7, 0x0,	// Index 68
+	0x5, 0x0,	// Index 69
+	0x7, 0x0,	// Index 70
+	0x5, 0x1,	// Index 71
+	0x7, 0x0,	// Index 72
+	0x7, 0x0,	// Index 73
+	0x7, 0x1,	// Index 74
+	0x7, 0x0,	// Index 75
+	0x7, 0x0,	// Index 76
+	0x5, 0x0,	// Index 77
+	0x5, 0x0,	// Index 78
+	0x5, 0x0,	// Index 79
+	0x5, 0x1,	// Index 80
+	0x5, 0x1,	// Index 81
+	0x5, 0x0,	// Index 82
+	0x5, 0x0,	// Index 83
+	0x6, 0x0,	// Index 84
+	0x5, 0x0,	// Index 85
+	0x5, 0x0,	// Index 86
+	0x5, 0x0,	// Index 87
+	0x5, 0x0,	// Index 88
+	0x5, 0x1,	// Index 89
+	0x5, 0x0,	// Index 90
+	0x7, 0x0,	// Index 91
+	0x7, 0x0,	// Index 92
+	0x7, 0x0,	// Index 93
+	0x0, 0x0,	// Index 94
+};
+
+const font_t System5x7 = 
+{
+	System5x7_bitmaps,
+	System5x7_offsets,
+	System5x7_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x8,	// Height 
+	0,	// Flags 
+	System5x7_extents,
+	0x7	// Ascent 
+};
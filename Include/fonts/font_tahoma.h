@@ -7,6 +7,8 @@
 // Project Name:  New Project
 //---------------------------------------------------------------
 
+#include "graphics.h"
+
 //---------------------------------------------------------------
 // Group Name: Tahoma10
 // Designer: Imported System Font
@@ -20,398 +22,607 @@
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Tahoma10[] = 
+const unsigned char Tahoma10_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0xB,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xC6, // Index 1 (offset: 198)
-	0x0, 0xC9, // Index 2 (offset: 201)
-	0x0, 0xD0, // Index 3 (offset: 208)
-	0x0, 0xDF, // Index 4 (offset: 223)
-	0x0, 0xEA, // Index 5 (offset: 234)
-	0x0, 0xFF, // Index 6 (offset: 255)
-	0x1, 0xE, // Index 7 (offset: 270)
-	0x1, 0x11, // Index 8 (offset: 273)
-	0x1, 0x18, // Index 9 (offset: 280)
-	0x1, 0x1F, // Index 10 (offset: 287)
-	0x1, 0x2A, // Index 11 (offset: 298)
-	0x1, 0x39, // Index 12 (offset: 313)
-	0x1, 0x3E, // Index 13 (offset: 318)
-	0x1, 0x45, // Index 14 (offset: 325)
-	0x1, 0x48, // Index 15 (offset: 328)
-	0x1, 0x4F, // Index 16 (offset: 335)
-	0x1, 0x5A, // Index 17 (offset: 346)
-	0x1, 0x61, // Index 18 (offset: 353)
-	0x1, 0x6C, // Index 19 (offset: 364)
-	0x1, 0x77, // Index 20 (offset: 375)
-	0x1, 0x82, // Index 21 (offset: 386)
-	0x1, 0x8D, // Index 22 (offset: 397)
-	0x1, 0x98, // Index 23 (offset: 408)
-	0x1, 0xA3, // Index 24 (offset: 419)
-	0x1, 0xAE, // Index 25 (offset: 430)
-	0x1, 0xB9, // Index 26 (offset: 441)
-	0x1, 0xBC, // Index 27 (offset: 444)
-	0x1, 0xC1, // Index 28 (offset: 449)
-	0x1, 0xCE, // Index 29 (offset: 462)
-	0x1, 0xDD, // Index 30 (offset: 477)
-	0x1, 0xEA, // Index 31 (offset: 490)
-	0x1, 0xF3, // Index 32 (offset: 499)
-	0x2, 0x6, // Index 33 (offset: 518)
-	0x2, 0x13, // Index 34 (offset: 531)
-	0x2, 0x1E, // Index 35 (offset: 542)
-	0x2, 0x2B, // Index 36 (offset: 555)
-	0x2, 0x38, // Index 37 (offset: 568)
-	0x2, 0x43, // Index 38 (offset: 579)
-	0x2, 0x4E, // Index 39 (offset: 590)
-	0x2, 0x5B, // Index 40 (offset: 603)
-	0x2, 0x68, // Index 41 (offset: 616)
-	0x2, 0x6F, // Index 42 (offset: 623)
-	0x2, 0x78, // Index 43 (offset: 632)
-	0x2, 0x83, // Index 44 (offset: 643)
-	0x2, 0x8C, // Index 45 (offset: 652)
-	0x2, 0x9B, // Index 46 (offset: 667)
-	0x2, 0xA8, // Index 47 (offset: 680)
-	0x2, 0xB7, // Index 48 (offset: 695)
-	0x2, 0xC2, // Index 49 (offset: 706)
-	0x2, 0xD1, // Index 50 (offset: 721)
-	0x2, 0xDE, // Index 51 (offset: 734)
-	0x2, 0xE9, // Index 52 (offset: 745)
-	0x2, 0xF4, // Index 53 (offset: 756)
-	0x3, 0x1, // Index 54 (offset: 769)
-	0x3, 0xC, // Index 55 (offset: 780)
-	0x3, 0x1F, // Index 56 (offset: 799)
-	0x3, 0x2A, // Index 57 (offset: 810)
-	0x3, 0x35, // Index 58 (offset: 821)
-	0x3, 0x40, // Index 59 (offset: 832)
-	0x3, 0x47, // Index 60 (offset: 839)
-	0x3, 0x4E, // Index 61 (offset: 846)
-	0x3, 0x55, // Index 62 (offset: 853)
-	0x3, 0x64, // Index 63 (offset: 868)
-	0x3, 0x71, // Index 64 (offset: 881)
-	0x3, 0x76, // Index 65 (offset: 886)
-	0x3, 0x81, // Index 66 (offset: 897)
-	0x3, 0x8C, // Index 67 (offset: 908)
-	0x3, 0x95, // Index 68 (offset: 917)
-	0x3, 0xA0, // Index 69 (offset: 928)
-	0x3, 0xAB, // Index 70 (offset: 939)
-	0x3, 0xB2, // Index 71 (offset: 946)
-	0x3, 0xBD, // Index 72 (offset: 957)
-	0x3, 0xC8, // Index 73 (offset: 968)
-	0x3, 0xCB, // Index 74 (offset: 971)
-	0x3, 0xD0, // Index 75 (offset: 976)
-	0x3, 0xDB, // Index 76 (offset: 987)
-	0x3, 0xDE, // Index 77 (offset: 990)
-	0x3, 0xED, // Index 78 (offset: 1005)
-	0x3, 0xF8, // Index 79 (offset: 1016)
-	0x4, 0x3, // Index 80 (offset: 1027)
-	0x4, 0xE, // Index 81 (offset: 1038)
-	0x4, 0x19, // Index 82 (offset: 1049)
-	0x4, 0x20, // Index 83 (offset: 1056)
-	0x4, 0x29, // Index 84 (offset: 1065)
-	0x4, 0x30, // Index 85 (offset: 1072)
-	0x4, 0x3B, // Index 86 (offset: 1083)
-	0x4, 0x46, // Index 87 (offset: 1094)
-	0x4, 0x55, // Index 88 (offset: 1109)
-	0x4, 0x60, // Index 89 (offset: 1120)
-	0x4, 0x6B, // Index 90 (offset: 1131)
-	0x4, 0x74, // Index 91 (offset: 1140)
-	0x4, 0x7D, // Index 92 (offset: 1149)
-	0x4, 0x80, // Index 93 (offset: 1152)
-	0x4, 0x89, // Index 94 (offset: 1161)
-
 	/* Index 0, character 32 " " (width: 1 pixels) */
-	0x1, 0x00,0x00,
+	0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 1 pixels) */
-	0x1, 0x7E,0x01,
+	0x7E,0x01,
 
 	/* Index 2, character 34 """ (width: 3 pixels) */
-	0x3, 0x07,0x00,0x00,0x00,0x07,0x00,
+	0x07,0x00,0x00,0x00,0x07,0x00,
 
 	/* Index 3, character 35 "#" (width: 7 pixels) */
-	0x7, 0x40,0x00,0xC8,0x01,0x78,0x00,0xCE,0x01,0x78,0x00,0x4E,0x00,0x08,0x00,
+	0x40,0x00,0xC8,0x01,0x78,0x00,0xCE,0x01,0x78,0x00,0x4E,0x00,0x08,0x00,
 
 	/* Index 4, character 36 "$" (width: 5 pixels) */
-	0x5, 0x18,0x01,0x24,0x01,0xFF,0x07,0x24,0x01,0xC4,0x00,
+	0x18,0x01,0x24,0x01,0xFF,0x07,0x24,0x01,0xC4,0x00,
 
 	/* Index 5, character 37 "%" (width: 10 pixels) */
-	0xA, 0x0C,0x00,0x12,0x00,0x12,0x00,0x8C,0x01,0x60,0x00,0x18,0x00,0xC6,0x00,0x20,0x01,0x20,0x01,0xC0,0x00,
+	0x0C,0x00,0x12,0x00,0x12,0x00,0x8C,0x01,0x60,0x00,0x18,0x00,0xC6,0x00,0x20,0x01,0x20,0x01,0xC0,0x00,
 
 	/* Index 6, character 38 "&" (width: 7 pixels) */
-	0x7, 0xEC,0x00,0x12,0x01,0x12,0x01,0x2C,0x01,0xC0,0x00,0xB0,0x00,0x00,0x01,
+	0xEC,0x00,0x12,0x01,0x12,0x01,0x2C,0x01,0xC0,0x00,0xB0,0x00,0x00,0x01,
 
 	/* Index 7, character 39 "'" (width: 1 pixels) */
-	0x1, 0x07,0x00,
+	0x07,0x00,
 
 	/* Index 8, character 40 "(" (width: 3 pixels) */
-	0x3, 0xF8,0x00,0x06,0x03,0x01,0x04,
+	0xF8,0x00,0x06,0x03,0x01,0x04,
 
 	/* Index 9, character 41 ")" (width: 3 pixels) */
-	0x3, 0x01,0x04,0x06,0x03,0xF8,0x00,
+	0x01,0x04,0x06,0x03,0xF8,0x00,
 
 	/* Index 10, character 42 "*" (width: 5 pixels) */
-	0x5, 0x0A,0x00,0x04,0x00,0x1F,0x00,0x04,0x00,0x0A,0x00,
+	0x0A,0x00,0x04,0x00,0x1F,0x00,0x04,0x00,0x0A,0x00,
 
 	/* Index 11, character 43 "+" (width: 7 pixels) */
-	0x7, 0x20,0x00,0x20,0x00,0x20,0x00,0xFC,0x01,0x20,0x00,0x20,0x00,0x20,0x00,
+	0x20,0x00,0x20,0x00,0x20,0x00,0xFC,0x01,0x20,0x00,0x20,0x00,0x20,0x00,
 
 	/* Index 12, character 44 "," (width: 2 pixels) */
-	0x2, 0x00,0x04,0x80,0x03,
+	0x00,0x04,0x80,0x03,
 
 	/* Index 13, character 45 "-" (width: 3 pixels) */
-	0x3, 0x20,0x00,0x20,0x00,0x20,0x00,
+	0x20,0x00,0x20,0x00,0x20,0x00,
 
 	/* Index 14, character 46 "." (width: 1 pixels) */
-	0x1, 0x80,0x01,
+	0x80,0x01,
 
 	/* Index 15, character 47 "/" (width: 3 pixels) */
-	0x3, 0x00,0x07,0xF8,0x00,0x07,0x00,
+	0x00,0x07,0xF8,0x00,0x07,0x00,
 
 	/* Index 16, character 48 "0" (width: 5 pixels) */
-	0x5, 0xFC,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0xFC,0x00,
+	0xFC,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0xFC,0x00,
 
 	/* Index 17, character 49 "1" (width: 3 pixels) */
-	0x3, 0x04,0x01,0xFE,0x01,0x00,0x01,
+	0x04,0x01,0xFE,0x01,0x00,0x01,
 
 	/* Index 18, character 50 "2" (width: 5 pixels) */
-	0x5, 0x84,0x01,0x42,0x01,0x22,0x01,0x12,0x01,0x0C,0x01,
+	0x84,0x01,0x42,0x01,0x22,0x01,0x12,0x01,0x0C,0x01,
 
 	/* Index 19, character 51 "3" (width: 5 pixels) */
-	0x5, 0x84,0x00,0x02,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
+	0x84,0x00,0x02,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
 
 	/* Index 20, character 52 "4" (width: 5 pixels) */
-	0x5, 0x30,0x00,0x28,0x00,0x24,0x00,0xFE,0x01,0x20,0x00,
+	0x30,0x00,0x28,0x00,0x24,0x00,0xFE,0x01,0x20,0x00,
 
 	/* Index 21, character 53 "5" (width: 5 pixels) */
-	0x5, 0x9E,0x00,0x12,0x01,0x12,0x01,0x12,0x01,0xE2,0x00,
+	0x9E,0x00,0x12,0x01,0x12,0x01,0x12,0x01,0xE2,0x00,
 
 	/* Index 22, character 54 "6" (width: 5 pixels) */
-	0x5, 0xF8,0x00,0x14,0x01,0x12,0x01,0x12,0x01,0xE0,0x00,
+	0xF8,0x00,0x14,0x01,0x12,0x01,0x12,0x01,0xE0,0x00,
 
 	/* Index 23, character 55 "7" (width: 5 pixels) */
-	0x5, 0x02,0x00,0x82,0x01,0x62,0x00,0x1A,0x00,0x06,0x00,
+	0x02,0x00,0x82,0x01,0x62,0x00,0x1A,0x00,0x06,0x00,
 
 	/* Index 24, character 56 "8" (width: 5 pixels) */
-	0x5, 0xEC,0x00,0x12,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
+	0xEC,0x00,0x12,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
 
 	/* Index 25, character 57 "9" (width: 5 pixels) */
-	0x5, 0x1C,0x00,0x22,0x01,0x22,0x01,0xA2,0x00,0x7C,0x00,
+	0x1C,0x00,0x22,0x01,0x22,0x01,0xA2,0x00,0x7C,0x00,
 
 	/* Index 26, character 58 ":" (width: 1 pixels) */
-	0x1, 0x98,0x01,
+	0x98,0x01,
 
 	/* Index 27, character 59 ";" (width: 2 pixels) */
-	0x2, 0x00,0x04,0x98,0x03,
+	0x00,0x04,0x98,0x03,
 
 	/* Index 28, character 60 "<" (width: 6 pixels) */
-	0x6, 0x20,0x00,0x50,0x00,0x50,0x00,0x88,0x00,0x88,0x00,0x04,0x01,
+	0x20,0x00,0x50,0x00,0x50,0x00,0x88,0x00,0x88,0x00,0x04,0x01,
 
 	/* Index 29, character 61 "=" (width: 7 pixels) */
-	0x7, 0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,
+	0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,
 
 	/* Index 30, character 62 ">" (width: 6 pixels) */
-	0x6, 0x04,0x01,0x88,0x00,0x88,0x00,0x50,0x00,0x50,0x00,0x20,0x00,
+	0x04,0x01,0x88,0x00,0x88,0x00,0x50,0x00,0x50,0x00,0x20,0x00,
 
 	/* Index 31, character 63 "?" (width: 4 pixels) */
-	0x4, 0x02,0x00,0x62,0x01,0x12,0x00,0x0C,0x00,
+	0x02,0x00,0x62,0x01,0x12,0x00,0x0C,0x00,
 
 	/* Index 32, character 64 "@" (width: 9 pixels) */
-	0x9, 0xF8,0x00,0x04,0x01,0x72,0x02,0x8A,0x02,0x8A,0x02,0xFA,0x02,0x82,0x00,0x84,0x00,0x78,0x00,
+	0xF8,0x00,0x04,0x01,0x72,0x02,0x8A,0x02,0x8A,0x02,0xFA,0x02,0x82,0x00,0x84,0x00,0x78,0x00,
 
 	/* Index 33, character 65 "A" (width: 6 pixels) */
-	0x6, 0xC0,0x01,0x78,0x00,0x46,0x00,0x46,0x00,0x78,0x00,0xC0,0x01,
+	0xC0,0x01,0x78,0x00,0x46,0x00,0x46,0x00,0x78,0x00,0xC0,0x01,
 
 	/* Index 34, character 66 "B" (width: 5 pixels) */
-	0x5, 0xFE,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
+	0xFE,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
 
 	/* Index 35, character 67 "C" (width: 6 pixels) */
-	0x6, 0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+	0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
 
 	/* Index 36, character 68 "D" (width: 6 pixels) */
-	0x6, 0xFE,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
+	0xFE,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
 
 	/* Index 37, character 69 "E" (width: 5 pixels) */
-	0x5, 0xFE,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x02,0x01,
+	0xFE,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x02,0x01,
 
 	/* Index 38, character 70 "F" (width: 5 pixels) */
-	0x5, 0xFE,0x01,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,
+	0xFE,0x01,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,
 
 	/* Index 39, character 71 "G" (width: 6 pixels) */
-	0x6, 0x78,0x00,0x84,0x00,0x02,0x01,0x22,0x01,0x22,0x01,0xE2,0x01,
+	0x78,0x00,0x84,0x00,0x02,0x01,0x22,0x01,0x22,0x01,0xE2,0x01,
 
 	/* Index 40, character 72 "H" (width: 6 pixels) */
-	0x6, 0xFE,0x01,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xFE,0x01,
+	0xFE,0x01,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xFE,0x01,
 
 	/* Index 41, character 73 "I" (width: 3 pixels) */
-	0x3, 0x02,0x01,0xFE,0x01,0x02,0x01,
+	0x02,0x01,0xFE,0x01,0x02,0x01,
 
 	/* Index 42, character 74 "J" (width: 4 pixels) */
-	0x4, 0x00,0x01,0x02,0x01,0x02,0x01,0xFE,0x00,
+	0x00,0x01,0x02,0x01,0x02,0x01,0xFE,0x00,
 
 	/* Index 43, character 75 "K" (width: 5 pixels) */
-	0x5, 0xFE,0x01,0x30,0x00,0x48,0x00,0x84,0x00,0x02,0x01,
+	0xFE,0x01,0x30,0x00,0x48,0x00,0x84,0x00,0x02,0x01,
 
 	/* Index 44, character 76 "L" (width: 4 pixels) */
-	0x4, 0xFE,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+	0xFE,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
 
 	/* Index 45, character 77 "M" (width: 7 pixels) */
-	0x7, 0xFE,0x01,0x06,0x00,0x18,0x00,0x60,0x00,0x18,0x00,0x06,0x00,0xFE,0x01,
+	0xFE,0x01,0x06,0x00,0x18,0x00,0x60,0x00,0x18,0x00,0x06,0x00,0xFE,0x01,
 
 	/* Index 46, character 78 "N" (width: 6 pixels) */
-	0x6, 0xFE,0x01,0x06,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0xFE,0x01,
+	0xFE,0x01,0x06,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0xFE,0x01,
 
 	/* Index 47, character 79 "O" (width: 7 pixels) */
-	0x7, 0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
+	0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
 
 	/* Index 48, character 80 "P" (width: 5 pixels) */
-	0x5, 0xFE,0x01,0x22,0x00,0x22,0x00,0x22,0x00,0x1C,0x00,
+	0xFE,0x01,0x22,0x00,0x22,0x00,0x22,0x00,0x1C,0x00,
 
 	/* Index 49, character 81 "Q" (width: 7 pixels) */
-	0x7, 0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x03,0x84,0x04,0x78,0x04,
+	0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x03,0x84,0x04,0x78,0x04,
 
 	/* Index 50, character 82 "R" (width: 6 pixels) */
-	0x6, 0xFE,0x01,0x22,0x00,0x22,0x00,0x62,0x00,0x9C,0x00,0x00,0x01,
+	0xFE,0x01,0x22,0x00,0x22,0x00,0x62,0x00,0x9C,0x00,0x00,0x01,
 
 	/* Index 51, character 83 "S" (width: 5 pixels) */
-	0x5, 0x0C,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0xE2,0x00,
+	0x0C,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0xE2,0x00,
 
 	/* Index 52, character 84 "T" (width: 5 pixels) */
-	0x5, 0x02,0x00,0x02,0x00,0xFE,0x01,0x02,0x00,0x02,0x00,
+	0x02,0x00,0x02,0x00,0xFE,0x01,0x02,0x00,0x02,0x00,
 
 	/* Index 53, character 85 "U" (width: 6 pixels) */
-	0x6, 0xFE,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0xFE,0x00,
+	0xFE,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0xFE,0x00,
 
 	/* Index 54, character 86 "V" (width: 5 pixels) */
-	0x5, 0x0E,0x00,0x70,0x00,0x80,0x01,0x70,0x00,0x0E,0x00,
+	0x0E,0x00,0x70,0x00,0x80,0x01,0x70,0x00,0x0E,0x00,
 
 	/* Index 55, character 87 "W" (width: 9 pixels) */
-	0x9, 0x0E,0x00,0x70,0x00,0x80,0x01,0x70,0x00,0x0E,0x00,0x70,0x00,0x80,0x01,0x70,0x00,0x0E,0x00,
+	0x0E,0x00,0x70,0x00,0x80,0x01,0x70,0x00,0x0E,0x00,0x70,0x00,0x80,0x01,0x70,0x00,0x0E,0x00,
 
 	/* Index 56, character 88 "X" (width: 5 pixels) */
-	0x5, 0x86,0x01,0x48,0x00,0x30,0x00,0x48,0x00,0x86,0x01,
+	0x86,0x01,0x48,0x00,0x30,0x00,0x48,0x00,0x86,0x01,
 
 	/* Index 57, character 89 "Y" (width: 5 pixels) */
-	0x5, 0x06,0x00,0x18,0x00,0xE0,0x01,0x18,0x00,0x06,0x00,
+	0x06,0x00,0x18,0x00,0xE0,0x01,0x18,0x00,0x06,0x00,
 
 	/* Index 58, character 90 "Z" (width: 5 pixels) */
-	0x5, 0x82,0x01,0x42,0x01,0x32,0x01,0x0A,0x01,0x06,0x01,
+	0x82,0x01,0x42,0x01,0x32,0x01,0x0A,0x01,0x06,0x01,
 
 	/* Index 59, character 91 "[" (width: 3 pixels) */
-	0x3, 0xFF,0x07,0x01,0x04,0x01,0x04,
+	0xFF,0x07,0x01,0x04,0x01,0x04,
 
 	/* Index 60, character 92 "\" (width: 3 pixels) */
-	0x3, 0x07,0x00,0xF8,0x00,0x00,0x07,
+	0x07,0x00,0xF8,0x00,0x00,0x07,
 
 	/* Index 61, character 93 "]" (width: 3 pixels) */
-	0x3, 0x01,0x04,0x01,0x04,0xFF,0x07,
+	0x01,0x04,0x01,0x04,0xFF,0x07,
 
 	/* Index 62, character 94 "^" (width: 7 pixels) */
-	0x7, 0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,
+	0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,
 
 	/* Index 63, character 95 "_" (width: 6 pixels) */
-	0x6, 0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
+	0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
 
 	/* Index 64, character 96 "`" (width: 2 pixels) */
-	0x2, 0x01,0x00,0x02,0x00,
+	0x01,0x00,0x02,0x00,
 
 	/* Index 65, character 97 "a" (width: 5 pixels) */
-	0x5, 0xC0,0x00,0x28,0x01,0x28,0x01,0x28,0x01,0xF0,0x01,
+	0xC0,0x00,0x28,0x01,0x28,0x01,0x28,0x01,0xF0,0x01,
 
 	/* Index 66, character 98 "b" (width: 5 pixels) */
-	0x5, 0xFF,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
+	0xFF,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
 
 	/* Index 67, character 99 "c" (width: 4 pixels) */
-	0x4, 0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,
+	0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,
 
 	/* Index 68, character 100 "d" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xFF,0x01,
+	0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xFF,0x01,
 
 	/* Index 69, character 101 "e" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x28,0x01,0x28,0x01,0x28,0x01,0xB0,0x00,
+	0xF0,0x00,0x28,0x01,0x28,0x01,0x28,0x01,0xB0,0x00,
 
 	/* Index 70, character 102 "f" (width: 3 pixels) */
-	0x3, 0xFE,0x01,0x09,0x00,0x09,0x00,
+	0xFE,0x01,0x09,0x00,0x09,0x00,
 
 	/* Index 71, character 103 "g" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x08,0x05,0x08,0x05,0x08,0x05,0xF8,0x03,
+	0xF0,0x00,0x08,0x05,0x08,0x05,0x08,0x05,0xF8,0x03,
 
 	/* Index 72, character 104 "h" (width: 5 pixels) */
-	0x5, 0xFF,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,
+	0xFF,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,
 
 	/* Index 73, character 105 "i" (width: 1 pixels) */
-	0x1, 0xFA,0x01,
+	0xFA,0x01,
 
 	/* Index 74, character 106 "j" (width: 2 pixels) */
-	0x2, 0x08,0x04,0xFA,0x03,
+	0x08,0x04,0xFA,0x03,
 
 	/* Index 75, character 107 "k" (width: 5 pixels) */
-	0x5, 0xFF,0x01,0x20,0x00,0x50,0x00,0x88,0x00,0x00,0x01,
+	0xFF,0x01,0x20,0x00,0x50,0x00,0x88,0x00,0x00,0x01,
 
 	/* Index 76, character 108 "l" (width: 1 pixels) */
-	0x1, 0xFF,0x01,
+	0xFF,0x01,
 
 	/* Index 77, character 109 "m" (width: 7 pixels) */
-	0x7, 0xF8,0x01,0x08,0x00,0x08,0x00,0xF0,0x01,0x08,0x00,0x08,0x00,0xF0,0x01,
+	0xF8,0x01,0x08,0x00,0x08,0x00,0xF0,0x01,0x08,0x00,0x08,0x00,0xF0,0x01,
 
 	/* Index 78, character 110 "n" (width: 5 pixels) */
-	0x5, 0xF8,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,
+	0xF8,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,
 
 	/* Index 79, character 111 "o" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
+	0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
 
 	/* Index 80, character 112 "p" (width: 5 pixels) */
-	0x5, 0xF8,0x07,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
+	0xF8,0x07,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
 
 	/* Index 81, character 113 "q" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xF8,0x07,
+	0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xF8,0x07,
 
 	/* Index 82, character 114 "r" (width: 3 pixels) */
-	0x3, 0xF8,0x01,0x10,0x00,0x08,0x00,
+	0xF8,0x01,0x10,0x00,0x08,0x00,
 
 	/* Index 83, character 115 "s" (width: 4 pixels) */
-	0x4, 0x30,0x01,0x28,0x01,0x48,0x01,0xC8,0x00,
+	0x30,0x01,0x28,0x01,0x48,0x01,0xC8,0x00,
 
 	/* Index 84, character 116 "t" (width: 3 pixels) */
-	0x3, 0xFE,0x00,0x08,0x01,0x08,0x01,
+	0xFE,0x00,0x08,0x01,0x08,0x01,
 
 	/* Index 85, character 117 "u" (width: 5 pixels) */
-	0x5, 0xF8,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0xF8,0x01,
+	0xF8,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0xF8,0x01,
 
 	/* Index 86, character 118 "v" (width: 5 pixels) */
-	0x5, 0x18,0x00,0x60,0x00,0x80,0x01,0x60,0x00,0x18,0x00,
+	0x18,0x00,0x60,0x00,0x80,0x01,0x60,0x00,0x18,0x00,
 
 	/* Index 87, character 119 "w" (width: 7 pixels) */
-	0x7, 0x78,0x00,0x80,0x01,0x60,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0x78,0x00,
+	0x78,0x00,0x80,0x01,0x60,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0x78,0x00,
 
 	/* Index 88, character 120 "x" (width: 5 pixels) */
-	0x5, 0x08,0x01,0x90,0x00,0x60,0x00,0x90,0x00,0x08,0x01,
+	0x08,0x01,0x90,0x00,0x60,0x00,0x90,0x00,0x08,0x01,
 
 	/* Index 89, character 121 "y" (width: 5 pixels) */
-	0x5, 0x18,0x00,0x60,0x06,0x80,0x01,0x60,0x00,0x18,0x00,
+	0x18,0x00,0x60,0x06,0x80,0x01,0x60,0x00,0x18,0x00,
 
 	/* Index 90, character 122 "z" (width: 4 pixels) */
-	0x4, 0x88,0x01,0x48,0x01,0x28,0x01,0x18,0x01,
+	0x88,0x01,0x48,0x01,0x28,0x01,0x18,0x01,
 
 	/* Index 91, character 123 "{" (width: 4 pixels) */
-	0x4, 0x20,0x00,0x20,0x00,0xDE,0x03,0x01,0x04,
+	0x20,0x00,0x20,0x00,0xDE,0x03,0x01,0x04,
 
 	/* Index 92, character 124 "|" (width: 1 pixels) */
-	0x1, 0xFF,0x07,
+	0xFF,0x07,
 
 	/* Index 93, character 125 "}" (width: 4 pixels) */
-	0x4, 0x01,0x04,0xDE,0x03,0x20,0x00,0x20,0x00,
+	0x01,0x04,0xDE,0x03,0x20,0x00,0x20,0x00,
 
 	/* Index 94, character 126 "~" (width: 7 pixels) */
-	0x7, 0x60,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x30,0x00
+	0x60,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x30,0x00
+};
+
+// Offset of each bitmap in Tahoma10_bitmaps
+const unsigned short Tahoma10_offsets[] = 
+{
+	0x0,	// Index 0
+	0x2,	// Index 1
+	0x4,	// Index 2
+	0xA,	// Index 3
+	0x18,	// Index 4
+	0x22,	// Index 5
+	0x36,	// Index 6
+	0x44,	// Index 7
+	0x46,	// Index 8
+	0x4C,	// Index 9
+	0x52,	// Index 10
+	0x5C,	// Index 11
+	0x6A,	// Index 12
+	0x6E,	// Index 13
+	0x74,	// Index 14
+	0x76,	// Index 15
+	0x7C,	// Index 16
+	0x86,	// Index 17
+	0x8C,	// Index 18
+	0x96,	// Index 19
+	0xA0,	// Index 20
+	0xAA,	// Index 21
+	0xB4,	// Index 22
+	0xBE,	// Index 23
+	0xC8,	// Index 24
+	0xD2,	// Index 25
+	0xDC,	// Index 26
+	0xDE,	// Index 27
+	0xE2,	// Index 28
+	0xEE,	// Index 29
+	0xFC,	// Index 30
+	0x108,	// Index 31
+	0x110,	// Index 32
+	0x122,	// Index 33
+	0x12E,	// Index 34
+	0x138,	// Index 35
+	0x144,	// Index 36
+	0x150,	// Index 37
+	0x15A,	// Index 38
+	0x164,	// Index 39
+	0x170,	// Index 40
+	0x17C,	// Index 41
+	0x182,	// Index 42
+	0x18A,	// Index 43
+	0x194,	// Index 44
+	0x19C,	// Index 45
+	0x1AA,	// Index 46
+	0x1B6,	// Index 47
+	0x1C4,	// Index 48
+	0x1CE,	// Index 49
+	0x1DC,	// Index 50
+	0x1E8,	// Index 51
+	0x1F2,	// Index 52
+	0x1FC,	// Index 53
+	0x208,	// Index 54
+	0x212,	// Index 55
+	0x224,	// Index 56
+	0x22E,	// Index 57
+	0x238,	// Index 58
+	0x242,	// Index 59
+	0x248,	// Index 60
+	0x24E,	// Index 61
+	0x254,	// Index 62
+	0x262,	// Index 63
+	0x26E,	// Index 64
+	0x272,	// Index 65
+	0x27C,	// Index 66
+	0x286,	// Index 67
+	0x28E,	// Index 68
+	0x298,	// Index 69
+	0x2A2,	// Index 70
+	0x2A8,	// Index 71
+	0x2B2,	// Index 72
+	0x2BC,	// Index 73
+	0x2BE,	// Index 74
+	0x2C2,	// Index 75
+	0x2CC,	// Index 76
+	0x2CE,	// Index 77
+	0x2DC,	// Index 78
+	0x2E6,	// Index 79
+	0x2F0,	// Index 80
+	0x2FA,	// Index 81
+	0x304,	// Index 82
+	0x30A,	// Index 83
+	0x312,	// Index 84
+	0x318,	// Index 85
+	0x322,	// Index 86
+	0x32C,	// Index 87
+	0x33A,	// Index 88
+	0x344,	// Index 89
+	0x34E,	// Index 90
+	0x356,	// Index 91
+	0x35E,	// Index 92
+	0x360,	// Index 93
+	0x368,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Tahoma10_widths[] = 
+{
+	0x1,	// Index 0
+	0x1,	// Index 1
+	0x3,	// Index 2
+	0x7,	// Index 3
+	0x5,	// Index 4
+	0xA,	// Index 5
+	0x7,	// Index 6
+	0x1,	// Index 7
+	0x3,	// Index 8
+	0x3,	// Index 9
+	0x5,	// Index 10
+	0x7,	// Index 11
+	0x2,	// Index 12
+	0x3,	// Index 13
+	0x1,	// Index 14
+	0x3,	// Index 15
+	0x5,	// Index 16
+	0x3,	// Index 17
+	0x5,	// Index 18
+	0x5,	// Index 19
+	0x5,	// Index 20
+	0x5,	// Index 21
+	0x5,	// Index 22
+	0x5,	// Index 23
+	0x5,	// Index 24
+	0x5,	// Index 25
+	0x1,	// Index 26
+	0x2,	// Index 27
+	0x6,	// Index 28
+	0x7,	// Index 29
+	0x6,	// Index 30
+	0x4,	// Index 31
+	0x9,	// Index 32
+	0x6,	// Index 33
+	0x5,	// Index 34
+	0x6,	// Index 35
+	0x6,	// Index 36
+	0x5,	// Index 37
+	0x5,	// Index 38
+	0x6,	// Index 39
+	0x6,	// Index 40
+	0x3,	// Index 41
+	0x4,	// Index 42
+	0x5,	// Index 43
+	0x4,	// Index 44
+	0x7,	// Index 45
+	0x6,	// Index 46
+	0x7,	// Index 47
+	0x5,	// Index 48
+	0x7,	// Index 49
+	0x6,	// Index 50
+	0x5,	// Index 51
+	0x5,	// Index 52
+	0x6,	// Index 53
+	0x5,	// Index 54
+	0x9,	// Index 55
+	0x5,	// Index 56
+	0x5,	// Index 57
+	0x5,	// Index 58
+	0x3,	// Index 59
+	0x3,	// Index 60
+	0x3,	// Index 61
+	0x7,	// Index 62
+	0x6,	// Index 63
+	0x2,	// Index 64
+	0x5,	// Index 65
+	0x5,	// Index 66
+	0x4,	// Index 67
+	0x5,	// Index 68
+	0x5,	// Index 69
+	0x3,	// Index 70
+	0x5,	// Index 71
+	0x5,	// Index 72
+	0x1,	// Index 73
+	0x2,	// Index 74
+	0x5,	// Index 75
+	0x1,	// Index 76
+	0x7,	// Index 77
+	0x5,	// Index 78
+	0x5,	// Index 79
+	0x5,	// Index 80
+	0x5,	// Index 81
+	0x3,	// Index 82
+	0x4,	// Index 83
+	0x3,	// Index 84
+	0x5,	// Index 85
+	0x5,	// Index 86
+	0x7,	// Index 87
+	0x5,	// Index 88
+	0x5,	// Index 89
+	0x4,	// Index 90
+	0x4,	// Index 91
+	0x1,	// Index 92
+	0x4,	// Index 93
+	0x7,	// Index 94
 };
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Tahoma10_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x8, 0x0,	// Index 1
+	0x9, 0x0,	// Index 2
+	0x8, 0x0,	// Index 3
+	0x9, 0x2,	// Index 4
+	0x8, 0x0,	// Index 5
+	0x8, 0x0,	// Index 6
+	0x9, 0x0,	// Index 7
+	0x9, 0x2,	// Index 8
+	0x9, 0x2,	// Index 9
+	0x9, 0x0,	// Index 10
+	0x7, 0x0,	// Index 11
+	0x2, 0x2,	// Index 12
+	0x4, 0x0,	// Index 13
+	0x2, 0x0,	// Index 14
+	0x9, 0x2,	// Index 15
+	0x8, 0x0,	// Index 16
+	0x8, 0x0,	// Index 17
+	0x8, 0x0,	// Index 18
+	0x8, 0x0,	// Index 19
+	0x8, 0x0,	// Index 20
+	0x8, 0x0,	// Index 21
+	0x8, 0x0,	// Index 22
+	0x8, 0x0,	// Index 23
+	0x8, 0x0,	// Index 24
+	0x8, 0x0,	// Index 25
+	0x6, 0x0,	// Index 26
+	0x6, 0x2,	// Index 27
+	0x7, 0x0,	// Index 28
+	0x5, 0x0,	// Index 29
+	0x7, 0x0,	// Index 30
+	0x8, 0x0,	// Index 31
+	0x8, 0x1,	// Index 32
+	0x8, 0x0,	// Index 33
+	0x8, 0x0,	// Index 34
+	0x8, 0x0,	// Index 35
+	0x8, 0x0,	// Index 36
+	0x8, 0x0,	// Index 37
+	0x8, 0x0,	// Index 38
+	0x8, 0x0,	// Index 39
+	0x8, 0x0,	// Index 40
+	0x8, 0x0,	// Index 41
+	0x8, 0x0,	// Index 42
+	0x8, 0x0,	// Index 43
+	0x8, 0x0,	// Index 44
+	0x8, 0x0,	// Index 45
+	0x8, 0x0,	// Index 46
+	0x8, 0x0,	// Index 47
+	0x8, 0x0,	// Index 48
+	0x8, 0x2,	// Index 49
+	0x8, 0x0,	// Index 50
+	0x8, 0x0,	// Index 51
+	0x8, 0x0,	// Index 52
+	0x8, 0x0,	// Index 53
+	0x8, 0x0,	// Index 54
+	0x8, 0x0,	// Index 55
+	0x8, 0x0,	// Index 56
+	0x8, 0x0,	// Index 57
+	0x8, 0x0,	// Index 58
+	0x9, 0x2,	// Index 59
+	0x9, 0x2,	// Index 60
+	0x9, 0x2,	// Index 61
+	0x8, 0x0,	// Index 62
+	0x0, 0x2,	// Index 63
+	0x9, 0x0,	// Index 64
+	0x6, 0x0,	// Index 65
+	0x9, 0x0,	// Index 66
+	0x6, 0x0,	// Index 67
+	0x9, 0x0,	// Index 68
+	0x6, 0x0,	// Index 69
+	0x9, 0x0,	// Index 70
+	0x6, 0x2,	// Index 71
+	0x9, 0x0,	// Index 72
+	0x8, 0x0,	// Index 73
+	0x8, 0x2,	// Index 74
+	0x9, 0x0,	// Index 75
+	0x9, 0x0,	// Index 76
+	0x6, 0x0,	// Index 77
+	0x6, 0x0,	// Index 78
+	0x6, 0x0,	// Index 79
+	0x6, 0x2,	// Index 80
+	0x6, 0x2,	// Index 81
+	0x6, 0x0,	// Index 82
+	0x6, 0x0,	// Index 83
+	0x8, 0x0,	// Index 84
+	0x6, 0x0,	// Index 85
+	0x6, 0x0,	// Index 86
+	0x6, 0x0,	// Index 87
+	0x6, 0x0,	// Index 88
+	0x6, 0x2,	// Index 89
+	0x6, 0x0,	// Index 90
+	0x9, 0x2,	// Index 91
+	0x9, 0x2,	// Index 92
+	0x9, 0x2,	// Index 93
+	0x5, 0x0,	// Index 94
+};
+
+const font_t Tahoma10 = 
+{
+	Tahoma10_bitmaps,
+	Tahoma10_offsets,
+	Tahoma10_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0xB,	// Height 
+	0,	// Flags 
+	Tahoma10_extents,
+	0x9	// Ascent 
+};
+
 //---------------------------------------------------------------
 // Group Name: Tahoma16
 // Designer: Imported System Font
@@ -425,398 +636,607 @@ const unsigned char Tahoma10[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Tahoma16[] = 
+const unsigned char Tahoma16_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x15,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xCD, // Index 1 (offset: 205)
-	0x0, 0xD4, // Index 2 (offset: 212)
-	0x0, 0xE7, // Index 3 (offset: 231)
-	0x1, 0xF, // Index 4 (offset: 271)
-	0x1, 0x2B, // Index 5 (offset: 299)
-	0x1, 0x62, // Index 6 (offset: 354)
-	0x1, 0x8D, // Index 7 (offset: 397)
-	0x1, 0x94, // Index 8 (offset: 404)
-	0x1, 0xA7, // Index 9 (offset: 423)
-	0x1, 0xBA, // Index 10 (offset: 442)
-	0x1, 0xD9, // Index 11 (offset: 473)
-	0x1, 0xFE, // Index 12 (offset: 510)
-	0x2, 0xB, // Index 13 (offset: 523)
-	0x2, 0x1E, // Index 14 (offset: 542)
-	0x2, 0x25, // Index 15 (offset: 549)
-	0x2, 0x3E, // Index 16 (offset: 574)
-	0x2, 0x5D, // Index 17 (offset: 605)
-	0x2, 0x76, // Index 18 (offset: 630)
-	0x2, 0x95, // Index 19 (offset: 661)
-	0x2, 0xB1, // Index 20 (offset: 689)
-	0x2, 0xD3, // Index 21 (offset: 723)
-	0x2, 0xEF, // Index 22 (offset: 751)
-	0x3, 0xE, // Index 23 (offset: 782)
-	0x3, 0x2D, // Index 24 (offset: 813)
-	0x3, 0x4C, // Index 25 (offset: 844)
-	0x3, 0x6B, // Index 26 (offset: 875)
-	0x3, 0x72, // Index 27 (offset: 882)
-	0x3, 0x7F, // Index 28 (offset: 895)
-	0x3, 0xA1, // Index 29 (offset: 929)
-	0x3, 0xC3, // Index 30 (offset: 963)
-	0x3, 0xE5, // Index 31 (offset: 997)
-	0x3, 0xFE, // Index 32 (offset: 1022)
-	0x4, 0x32, // Index 33 (offset: 1074)
-	0x4, 0x5A, // Index 34 (offset: 1114)
-	0x4, 0x79, // Index 35 (offset: 1145)
-	0x4, 0x9B, // Index 36 (offset: 1179)
-	0x4, 0xBD, // Index 37 (offset: 1213)
-	0x4, 0xD9, // Index 38 (offset: 1241)
-	0x4, 0xF5, // Index 39 (offset: 1269)
-	0x5, 0x1A, // Index 40 (offset: 1306)
-	0x5, 0x39, // Index 41 (offset: 1337)
-	0x5, 0x4C, // Index 42 (offset: 1356)
-	0x5, 0x65, // Index 43 (offset: 1381)
-	0x5, 0x84, // Index 44 (offset: 1412)
-	0x5, 0x9D, // Index 45 (offset: 1437)
-	0x5, 0xC2, // Index 46 (offset: 1474)
-	0x5, 0xE1, // Index 47 (offset: 1505)
-	0x6, 0x9, // Index 48 (offset: 1545)
-	0x6, 0x28, // Index 49 (offset: 1576)
-	0x6, 0x50, // Index 50 (offset: 1616)
-	0x6, 0x72, // Index 51 (offset: 1650)
-	0x6, 0x91, // Index 52 (offset: 1681)
-	0x6, 0xB6, // Index 53 (offset: 1718)
-	0x6, 0xDB, // Index 54 (offset: 1755)
-	0x7, 0x3, // Index 55 (offset: 1795)
-	0x7, 0x3D, // Index 56 (offset: 1853)
-	0x7, 0x62, // Index 57 (offset: 1890)
-	0x7, 0x87, // Index 58 (offset: 1927)
-	0x7, 0xA6, // Index 59 (offset: 1958)
-	0x7, 0xB6, // Index 60 (offset: 1974)
-	0x7, 0xCF, // Index 61 (offset: 1999)
-	0x7, 0xDF, // Index 62 (offset: 2015)
-	0x8, 0x7, // Index 63 (offset: 2055)
-	0x8, 0x29, // Index 64 (offset: 2089)
-	0x8, 0x36, // Index 65 (offset: 2102)
-	0x8, 0x52, // Index 66 (offset: 2130)
-	0x8, 0x71, // Index 67 (offset: 2161)
-	0x8, 0x8D, // Index 68 (offset: 2189)
-	0x8, 0xAC, // Index 69 (offset: 2220)
-	0x8, 0xCB, // Index 70 (offset: 2251)
-	0x8, 0xE1, // Index 71 (offset: 2273)
-	0x9, 0x0, // Index 72 (offset: 2304)
-	0x9, 0x1C, // Index 73 (offset: 2332)
-	0x9, 0x23, // Index 74 (offset: 2339)
-	0x9, 0x33, // Index 75 (offset: 2355)
-	0x9, 0x4F, // Index 76 (offset: 2383)
-	0x9, 0x56, // Index 77 (offset: 2390)
-	0x9, 0x87, // Index 78 (offset: 2439)
-	0x9, 0xA3, // Index 79 (offset: 2467)
-	0x9, 0xC2, // Index 80 (offset: 2498)
-	0x9, 0xE1, // Index 81 (offset: 2529)
-	0xA, 0x0, // Index 82 (offset: 2560)
-	0xA, 0x16, // Index 83 (offset: 2582)
-	0xA, 0x2F, // Index 84 (offset: 2607)
-	0xA, 0x42, // Index 85 (offset: 2626)
-	0xA, 0x5E, // Index 86 (offset: 2654)
-	0xA, 0x7A, // Index 87 (offset: 2682)
-	0xA, 0xA8, // Index 88 (offset: 2728)
-	0xA, 0xC4, // Index 89 (offset: 2756)
-	0xA, 0xE0, // Index 90 (offset: 2784)
-	0xA, 0xF6, // Index 91 (offset: 2806)
-	0xB, 0xF, // Index 92 (offset: 2831)
-	0xB, 0x16, // Index 93 (offset: 2838)
-	0xB, 0x2F, // Index 94 (offset: 2863)
-
 	/* Index 0, character 32 " " (width: 3 pixels) */
-	0x3, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 2 pixels) */
-	0x2, 0xFE,0x9F,0x01,0xFE,0x9F,0x01,
+	0xFE,0x9F,0x01,0xFE,0x9F,0x01,
 
 	/* Index 2, character 34 """ (width: 6 pixels) */
-	0x6, 0x3F,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,
+	0x3F,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 13 pixels) */
-	0xD, 0x00,0x18,0x00,0x00,0x18,0x00,0xC0,0xD8,0x01,0xC0,0xFE,0x01,0xF0,0x7F,0x00,0xFE,0x19,0x00,0xCE,0xD8,0x01,0xC0,0xFE,0x01,0xF8,0x3F,0x00,0xFE,0x19,0x00,0xCE,0x18,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,
+	0x00,0x18,0x00,0x00,0x18,0x00,0xC0,0xD8,0x01,0xC0,0xFE,0x01,0xF0,0x7F,0x00,0xFE,0x19,0x00,0xCE,0xD8,0x01,0xC0,0xFE,0x01,0xF8,0x3F,0x00,0xFE,0x19,0x00,0xCE,0x18,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,
 
 	/* Index 4, character 36 "$" (width: 9 pixels) */
-	0x9, 0xC0,0xC1,0x00,0xE0,0x83,0x01,0x30,0x86,0x01,0x30,0x86,0x01,0xFE,0xFF,0x1F,0x30,0x86,0x01,0x30,0xCC,0x01,0x30,0xFC,0x00,0x60,0x78,0x00,
+	0xC0,0xC1,0x00,0xE0,0x83,0x01,0x30,0x86,0x01,0x30,0x86,0x01,0xFE,0xFF,0x1F,0x30,0x86,0x01,0x30,0xCC,0x01,0x30,0xFC,0x00,0x60,0x78,0x00,
 
 	/* Index 5, character 37 "%" (width: 18 pixels) */
-	0x12, 0xF8,0x00,0x00,0xFC,0x01,0x00,0x06,0x03,0x00,0x06,0x03,0x00,0x06,0x03,0x01,0xFC,0xC1,0x01,0xF8,0xF0,0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0xC0,0x03,0x00,0xF0,0x00,0x00,0x3C,0x7C,0x00,0x0E,0xFE,0x00,0x02,0x83,0x01,0x00,0x83,0x01,0x00,0x83,0x01,0x00,0xFE,0x00,0x00,0x7C,0x00,
+	0xF8,0x00,0x00,0xFC,0x01,0x00,0x06,0x03,0x00,0x06,0x03,0x00,0x06,0x03,0x01,0xFC,0xC1,0x01,0xF8,0xF0,0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0xC0,0x03,0x00,0xF0,0x00,0x00,0x3C,0x7C,0x00,0x0E,0xFE,0x00,0x02,0x83,0x01,0x00,0x83,0x01,0x00,0x83,0x01,0x00,0xFE,0x00,0x00,0x7C,0x00,
 
 	/* Index 6, character 38 "&" (width: 14 pixels) */
-	0xE, 0x00,0x7C,0x00,0x78,0xFE,0x00,0xFC,0xC3,0x01,0xCE,0x81,0x01,0x86,0x83,0x01,0x86,0x87,0x01,0xCE,0x8E,0x01,0x7C,0x9C,0x00,0x38,0xF8,0x00,0x80,0x7F,0x00,0x80,0xFF,0x00,0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x00,0x01,
+	0x00,0x7C,0x00,0x78,0xFE,0x00,0xFC,0xC3,0x01,0xCE,0x81,0x01,0x86,0x83,0x01,0x86,0x87,0x01,0xCE,0x8E,0x01,0x7C,0x9C,0x00,0x38,0xF8,0x00,0x80,0x7F,0x00,0x80,0xFF,0x00,0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x00,0x01,
 
 	/* Index 7, character 39 "'" (width: 2 pixels) */
-	0x2, 0x3F,0x00,0x00,0x3F,0x00,0x00,
+	0x3F,0x00,0x00,0x3F,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 6 pixels) */
-	0x6, 0xC0,0x7F,0x00,0xF0,0xFF,0x01,0x7C,0xC0,0x07,0x0F,0x00,0x1E,0x03,0x00,0x18,0x01,0x00,0x10,
+	0xC0,0x7F,0x00,0xF0,0xFF,0x01,0x7C,0xC0,0x07,0x0F,0x00,0x1E,0x03,0x00,0x18,0x01,0x00,0x10,
 
 	/* Index 9, character 41 ")" (width: 6 pixels) */
-	0x6, 0x01,0x00,0x10,0x03,0x00,0x18,0x0F,0x00,0x1E,0x7C,0xC0,0x07,0xF0,0xFF,0x01,0xC0,0x7F,0x00,
+	0x01,0x00,0x10,0x03,0x00,0x18,0x0F,0x00,0x1E,0x7C,0xC0,0x07,0xF0,0xFF,0x01,0xC0,0x7F,0x00,
 
 	/* Index 10, character 42 "*" (width: 10 pixels) */
-	0xA, 0x46,0x00,0x00,0x64,0x00,0x00,0x2C,0x00,0x00,0x28,0x00,0x00,0xFF,0x01,0x00,0xFF,0x01,0x00,0x28,0x00,0x00,0x2C,0x00,0x00,0x64,0x00,0x00,0x46,0x00,0x00,
+	0x46,0x00,0x00,0x64,0x00,0x00,0x2C,0x00,0x00,0x28,0x00,0x00,0xFF,0x01,0x00,0xFF,0x01,0x00,0x28,0x00,0x00,0x2C,0x00,0x00,0x64,0x00,0x00,0x46,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 12 pixels) */
-	0xC, 0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,
+	0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,
 
 	/* Index 12, character 44 "," (width: 4 pixels) */
-	0x4, 0x00,0x00,0x18,0x00,0x80,0x1F,0x00,0xC0,0x03,0x00,0x40,0x00,
+	0x00,0x00,0x18,0x00,0x80,0x1F,0x00,0xC0,0x03,0x00,0x40,0x00,
 
 	/* Index 13, character 45 "-" (width: 6 pixels) */
-	0x6, 0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,
+	0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,
 
 	/* Index 14, character 46 "." (width: 2 pixels) */
-	0x2, 0x00,0xC0,0x01,0x00,0xC0,0x01,
+	0x00,0xC0,0x01,0x00,0xC0,0x01,
 
 	/* Index 15, character 47 "/" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x0C,0x00,0x80,0x0F,0x00,0xF0,0x03,0x00,0x7F,0x00,0xE0,0x0F,0x00,0xFC,0x00,0x00,0x1F,0x00,0x00,0x03,0x00,0x00,
+	0x00,0x00,0x0C,0x00,0x80,0x0F,0x00,0xF0,0x03,0x00,0x7F,0x00,0xE0,0x0F,0x00,0xFC,0x00,0x00,0x1F,0x00,0x00,0x03,0x00,0x00,
 
 	/* Index 16, character 48 "0" (width: 10 pixels) */
-	0xA, 0xE0,0x1F,0x00,0xF8,0x7F,0x00,0x1C,0xE0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x1C,0xE0,0x00,0xF8,0x7F,0x00,0xE0,0x1F,0x00,
+	0xE0,0x1F,0x00,0xF8,0x7F,0x00,0x1C,0xE0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x1C,0xE0,0x00,0xF8,0x7F,0x00,0xE0,0x1F,0x00,
 
 	/* Index 17, character 49 "1" (width: 8 pixels) */
-	0x8, 0x18,0x80,0x01,0x18,0x80,0x01,0x18,0x80,0x01,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,
+	0x18,0x80,0x01,0x18,0x80,0x01,0x18,0x80,0x01,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,
 
 	/* Index 18, character 50 "2" (width: 10 pixels) */
-	0xA, 0x0C,0xC0,0x01,0x06,0xE0,0x01,0x06,0xB0,0x01,0x06,0xB8,0x01,0x06,0x9C,0x01,0x06,0x8E,0x01,0x0E,0x87,0x01,0xFC,0x81,0x01,0xF8,0x80,0x01,0x00,0x80,0x01,
+	0x0C,0xC0,0x01,0x06,0xE0,0x01,0x06,0xB0,0x01,0x06,0xB8,0x01,0x06,0x9C,0x01,0x06,0x8E,0x01,0x0E,0x87,0x01,0xFC,0x81,0x01,0xF8,0x80,0x01,0x00,0x80,0x01,
 
 	/* Index 19, character 51 "3" (width: 9 pixels) */
-	0x9, 0x0C,0xC0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0xCE,0xC3,0x00,0x7C,0xFE,0x00,0x38,0x3C,0x00,
+	0x0C,0xC0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0xCE,0xC3,0x00,0x7C,0xFE,0x00,0x38,0x3C,0x00,
 
 	/* Index 20, character 52 "4" (width: 11 pixels) */
-	0xB, 0x00,0x07,0x00,0x80,0x07,0x00,0xC0,0x06,0x00,0x60,0x06,0x00,0x30,0x06,0x00,0x18,0x06,0x00,0x0C,0x06,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x00,0x06,0x00,0x00,0x06,0x00,
+	0x00,0x07,0x00,0x80,0x07,0x00,0xC0,0x06,0x00,0x60,0x06,0x00,0x30,0x06,0x00,0x18,0x06,0x00,0x0C,0x06,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x00,0x06,0x00,0x00,0x06,0x00,
 
 	/* Index 21, character 53 "5" (width: 9 pixels) */
-	0x9, 0x00,0xC0,0x00,0xFE,0x81,0x01,0xFE,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0xC3,0x00,0x06,0xFF,0x00,0x06,0x3E,0x00,
+	0x00,0xC0,0x00,0xFE,0x81,0x01,0xFE,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0xC3,0x00,0x06,0xFF,0x00,0x06,0x3E,0x00,
 
 	/* Index 22, character 54 "6" (width: 10 pixels) */
-	0xA, 0xC0,0x3F,0x00,0xF0,0x7F,0x00,0x38,0xE3,0x00,0x8C,0x81,0x01,0x8E,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0xC3,0x00,0x06,0xFF,0x00,0x00,0x3E,0x00,
+	0xC0,0x3F,0x00,0xF0,0x7F,0x00,0x38,0xE3,0x00,0x8C,0x81,0x01,0x8E,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0xC3,0x00,0x06,0xFF,0x00,0x00,0x3E,0x00,
 
 	/* Index 23, character 55 "7" (width: 10 pixels) */
-	0xA, 0x06,0x00,0x00,0x06,0x00,0x01,0x06,0xC0,0x01,0x06,0xF0,0x00,0x06,0x3C,0x00,0x06,0x0F,0x00,0xC6,0x03,0x00,0xF6,0x00,0x00,0x3E,0x00,0x00,0x0E,0x00,0x00,
+	0x06,0x00,0x00,0x06,0x00,0x01,0x06,0xC0,0x01,0x06,0xF0,0x00,0x06,0x3C,0x00,0x06,0x0F,0x00,0xC6,0x03,0x00,0xF6,0x00,0x00,0x3E,0x00,0x00,0x0E,0x00,0x00,
 
 	/* Index 24, character 56 "8" (width: 10 pixels) */
-	0xA, 0x78,0x7C,0x00,0xFC,0xFE,0x00,0xCE,0xC3,0x00,0x86,0x81,0x01,0x86,0x81,0x01,0x06,0x83,0x01,0x06,0x83,0x01,0x8E,0xC6,0x00,0xFC,0xFE,0x00,0x78,0x3C,0x00,
+	0x78,0x7C,0x00,0xFC,0xFE,0x00,0xCE,0xC3,0x00,0x86,0x81,0x01,0x86,0x81,0x01,0x06,0x83,0x01,0x06,0x83,0x01,0x8E,0xC6,0x00,0xFC,0xFE,0x00,0x78,0x3C,0x00,
 
 	/* Index 25, character 57 "9" (width: 10 pixels) */
-	0xA, 0xF0,0x01,0x00,0xFC,0x83,0x01,0x0C,0x87,0x01,0x06,0x86,0x01,0x06,0x86,0x01,0x06,0xC6,0x01,0x06,0xC6,0x00,0x1C,0x73,0x00,0xF8,0x3F,0x00,0xF0,0x0F,0x00,
+	0xF0,0x01,0x00,0xFC,0x83,0x01,0x0C,0x87,0x01,0x06,0x86,0x01,0x06,0x86,0x01,0x06,0xC6,0x01,0x06,0xC6,0x00,0x1C,0x73,0x00,0xF8,0x3F,0x00,0xF0,0x0F,0x00,
 
 	/* Index 26, character 58 ":" (width: 2 pixels) */
-	0x2, 0xC0,0xC1,0x01,0xC0,0xC1,0x01,
+	0xC0,0xC1,0x01,0xC0,0xC1,0x01,
 
 	/* Index 27, character 59 ";" (width: 4 pixels) */
-	0x4, 0x00,0x00,0x18,0xC0,0x81,0x1F,0xC0,0xC1,0x03,0x00,0x40,0x00,
+	0x00,0x00,0x18,0xC0,0x81,0x1F,0xC0,0xC1,0x03,0x00,0x40,0x00,
 
 	/* Index 28, character 60 "<" (width: 11 pixels) */
-	0xB, 0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x1B,0x00,0x00,0x1B,0x00,0x00,0x1B,0x00,0x80,0x31,0x00,0x80,0x31,0x00,0xC0,0x60,0x00,0xC0,0x60,0x00,0xC0,0x60,0x00,0x60,0xC0,0x00,
+	0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x1B,0x00,0x00,0x1B,0x00,0x00,0x1B,0x00,0x80,0x31,0x00,0x80,0x31,0x00,0xC0,0x60,0x00,0xC0,0x60,0x00,0xC0,0x60,0x00,0x60,0xC0,0x00,
 
 	/* Index 29, character 61 "=" (width: 11 pixels) */
-	0xB, 0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,
+	0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,
 
 	/* Index 30, character 62 ">" (width: 11 pixels) */
-	0xB, 0x60,0xC0,0x00,0xC0,0x60,0x00,0xC0,0x60,0x00,0xC0,0x60,0x00,0x80,0x31,0x00,0x80,0x31,0x00,0x00,0x1B,0x00,0x00,0x1B,0x00,0x00,0x1B,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,
+	0x60,0xC0,0x00,0xC0,0x60,0x00,0xC0,0x60,0x00,0xC0,0x60,0x00,0x80,0x31,0x00,0x80,0x31,0x00,0x00,0x1B,0x00,0x00,0x1B,0x00,0x00,0x1B,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,
 
 	/* Index 31, character 63 "?" (width: 8 pixels) */
-	0x8, 0x0C,0x00,0x00,0x06,0x00,0x00,0x06,0x9E,0x01,0x06,0x9E,0x01,0x06,0x03,0x00,0x8E,0x03,0x00,0xFC,0x01,0x00,0x78,0x00,0x00,
+	0x0C,0x00,0x00,0x06,0x00,0x00,0x06,0x9E,0x01,0x06,0x9E,0x01,0x06,0x03,0x00,0x8E,0x03,0x00,0xFC,0x01,0x00,0x78,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 17 pixels) */
-	0x11, 0x80,0x1F,0x00,0xE0,0x7F,0x00,0x70,0xE0,0x01,0x18,0x80,0x01,0x8C,0x1F,0x03,0xCC,0x3F,0x07,0xE6,0x70,0x06,0x66,0x60,0x06,0x66,0x60,0x06,0x66,0x30,0x06,0xE6,0x7F,0x06,0xE6,0x7F,0x06,0x0C,0x60,0x00,0x1C,0x60,0x00,0x78,0x60,0x00,0xF0,0x7F,0x00,0xC0,0x1F,0x00,
+	0x80,0x1F,0x00,0xE0,0x7F,0x00,0x70,0xE0,0x01,0x18,0x80,0x01,0x8C,0x1F,0x03,0xCC,0x3F,0x07,0xE6,0x70,0x06,0x66,0x60,0x06,0x66,0x60,0x06,0x66,0x30,0x06,0xE6,0x7F,0x06,0xE6,0x7F,0x06,0x0C,0x60,0x00,0x1C,0x60,0x00,0x78,0x60,0x00,0xF0,0x7F,0x00,0xC0,0x1F,0x00,
 
 	/* Index 33, character 65 "A" (width: 13 pixels) */
-	0xD, 0x00,0x80,0x01,0x00,0xF0,0x01,0x00,0xFE,0x00,0xC0,0x1F,0x00,0xF8,0x19,0x00,0x3E,0x18,0x00,0x06,0x18,0x00,0x3E,0x18,0x00,0xF8,0x19,0x00,0xC0,0x1F,0x00,0x00,0xFE,0x00,0x00,0xF0,0x01,0x00,0x80,0x01,
+	0x00,0x80,0x01,0x00,0xF0,0x01,0x00,0xFE,0x00,0xC0,0x1F,0x00,0xF8,0x19,0x00,0x3E,0x18,0x00,0x06,0x18,0x00,0x3E,0x18,0x00,0xF8,0x19,0x00,0xC0,0x1F,0x00,0x00,0xFE,0x00,0x00,0xF0,0x01,0x00,0x80,0x01,
 
 	/* Index 34, character 66 "B" (width: 10 pixels) */
-	0xA, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0xC6,0x81,0x01,0x7C,0xC3,0x00,0x3C,0xFF,0x00,0x00,0x3C,0x00,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0xC6,0x81,0x01,0x7C,0xC3,0x00,0x3C,0xFF,0x00,0x00,0x3C,0x00,
 
 	/* Index 35, character 67 "C" (width: 11 pixels) */
-	0xB, 0xC0,0x1F,0x00,0xF0,0x7F,0x00,0x3C,0xF0,0x00,0x0C,0xC0,0x00,0x0E,0xC0,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x0C,0xC0,0x00,0x1C,0xE0,0x00,
+	0xC0,0x1F,0x00,0xF0,0x7F,0x00,0x3C,0xF0,0x00,0x0C,0xC0,0x00,0x0E,0xC0,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x0C,0xC0,0x00,0x1C,0xE0,0x00,
 
 	/* Index 36, character 68 "D" (width: 11 pixels) */
-	0xB, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x0E,0xC0,0x01,0x0C,0xC0,0x00,0x38,0x70,0x00,0xF0,0x3F,0x00,0xC0,0x0F,0x00,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x0E,0xC0,0x01,0x0C,0xC0,0x00,0x38,0x70,0x00,0xF0,0x3F,0x00,0xC0,0x0F,0x00,
 
 	/* Index 37, character 69 "E" (width: 9 pixels) */
-	0x9, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x06,0x80,0x01,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x06,0x80,0x01,
 
 	/* Index 38, character 70 "F" (width: 9 pixels) */
-	0x9, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,
 
 	/* Index 39, character 71 "G" (width: 12 pixels) */
-	0xC, 0xC0,0x0F,0x00,0xF0,0x3F,0x00,0x38,0xF0,0x00,0x0C,0xC0,0x00,0x0E,0xC0,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x86,0x01,0x06,0x86,0x01,0x0E,0x86,0x01,0x0C,0xFE,0x00,0x1C,0xFE,0x00,
+	0xC0,0x0F,0x00,0xF0,0x3F,0x00,0x38,0xF0,0x00,0x0C,0xC0,0x00,0x0E,0xC0,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x86,0x01,0x06,0x86,0x01,0x0E,0x86,0x01,0x0C,0xFE,0x00,0x1C,0xFE,0x00,
 
 	/* Index 40, character 72 "H" (width: 10 pixels) */
-	0xA, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,
 
 	/* Index 41, character 73 "I" (width: 6 pixels) */
-	0x6, 0x06,0x80,0x01,0x06,0x80,0x01,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x80,0x01,0x06,0x80,0x01,
+	0x06,0x80,0x01,0x06,0x80,0x01,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x80,0x01,0x06,0x80,0x01,
 
 	/* Index 42, character 74 "J" (width: 8 pixels) */
-	0x8, 0x00,0x80,0x01,0x00,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0xC0,0x01,0xFE,0xFF,0x00,0xFE,0x7F,0x00,
+	0x00,0x80,0x01,0x00,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0xC0,0x01,0xFE,0xFF,0x00,0xFE,0x7F,0x00,
 
 	/* Index 43, character 75 "K" (width: 10 pixels) */
-	0xA, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x80,0x03,0x00,0xC0,0x07,0x00,0xE0,0x0E,0x00,0x78,0x3C,0x00,0x1C,0x70,0x00,0x0E,0xE0,0x01,0x06,0x80,0x01,0x02,0x00,0x01,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x80,0x03,0x00,0xC0,0x07,0x00,0xE0,0x0E,0x00,0x78,0x3C,0x00,0x1C,0x70,0x00,0x0E,0xE0,0x01,0x06,0x80,0x01,0x02,0x00,0x01,
 
 	/* Index 44, character 76 "L" (width: 8 pixels) */
-	0x8, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,
 
 	/* Index 45, character 77 "M" (width: 12 pixels) */
-	0xC, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x1E,0x00,0x00,0xF8,0x00,0x00,0xC0,0x03,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0xC0,0x03,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x1E,0x00,0x00,0xF8,0x00,0x00,0xC0,0x03,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0xC0,0x03,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,
 
 	/* Index 46, character 78 "N" (width: 10 pixels) */
-	0xA, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x0E,0x00,0x00,0x78,0x00,0x00,0xE0,0x01,0x00,0x00,0x0F,0x00,0x00,0x3C,0x00,0x00,0xF0,0x01,0xFE,0xFF,0x01,0xFE,0xFF,0x01,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x0E,0x00,0x00,0x78,0x00,0x00,0xE0,0x01,0x00,0x00,0x0F,0x00,0x00,0x3C,0x00,0x00,0xF0,0x01,0xFE,0xFF,0x01,0xFE,0xFF,0x01,
 
 	/* Index 47, character 79 "O" (width: 13 pixels) */
-	0xD, 0xE0,0x1F,0x00,0xF8,0x7F,0x00,0x3C,0xF0,0x00,0x0C,0xC0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x0C,0xC0,0x00,0x3C,0xF0,0x00,0xF8,0x7F,0x00,0xE0,0x1F,0x00,
+	0xE0,0x1F,0x00,0xF8,0x7F,0x00,0x3C,0xF0,0x00,0x0C,0xC0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x0C,0xC0,0x00,0x3C,0xF0,0x00,0xF8,0x7F,0x00,0xE0,0x1F,0x00,
 
 	/* Index 48, character 80 "P" (width: 10 pixels) */
-	0xA, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x0C,0x03,0x00,0xFC,0x01,0x00,0xF0,0x00,0x00,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x0C,0x03,0x00,0xFC,0x01,0x00,0xF0,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 13 pixels) */
-	0xD, 0xE0,0x1F,0x00,0xF8,0x7F,0x00,0x3C,0xF0,0x00,0x0C,0xC0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x07,0x06,0x80,0x0F,0x0C,0xC0,0x1C,0x3C,0xF0,0x18,0xF8,0x7F,0x18,0xE0,0x1F,0x18,
+	0xE0,0x1F,0x00,0xF8,0x7F,0x00,0x3C,0xF0,0x00,0x0C,0xC0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x07,0x06,0x80,0x0F,0x0C,0xC0,0x1C,0x3C,0xF0,0x18,0xF8,0x7F,0x18,0xE0,0x1F,0x18,
 
 	/* Index 50, character 82 "R" (width: 11 pixels) */
-	0xB, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x0E,0x00,0x06,0x1E,0x00,0x0E,0x3B,0x00,0xFC,0xF1,0x00,0xF8,0xC0,0x01,0x00,0x80,0x01,0x00,0x00,0x01,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x0E,0x00,0x06,0x1E,0x00,0x0E,0x3B,0x00,0xFC,0xF1,0x00,0xF8,0xC0,0x01,0x00,0x80,0x01,0x00,0x00,0x01,
 
 	/* Index 51, character 83 "S" (width: 10 pixels) */
-	0xA, 0xF8,0xE0,0x00,0xFC,0xC1,0x00,0x8E,0x81,0x01,0x86,0x83,0x01,0x06,0x83,0x01,0x06,0x83,0x01,0x06,0x83,0x01,0x06,0xC6,0x00,0x0C,0xFE,0x00,0x00,0x3C,0x00,
+	0xF8,0xE0,0x00,0xFC,0xC1,0x00,0x8E,0x81,0x01,0x86,0x83,0x01,0x06,0x83,0x01,0x06,0x83,0x01,0x06,0x83,0x01,0x06,0xC6,0x00,0x0C,0xFE,0x00,0x00,0x3C,0x00,
 
 	/* Index 52, character 84 "T" (width: 12 pixels) */
-	0xC, 0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,
+	0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,
 
 	/* Index 53, character 85 "U" (width: 12 pixels) */
-	0xC, 0xFE,0x3F,0x00,0xFE,0x7F,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0xC0,0x01,0x00,0xE0,0x00,0xFE,0x7F,0x00,0xFE,0x3F,0x00,
+	0xFE,0x3F,0x00,0xFE,0x7F,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0xC0,0x01,0x00,0xE0,0x00,0xFE,0x7F,0x00,0xFE,0x3F,0x00,
 
 	/* Index 54, character 86 "V" (width: 13 pixels) */
-	0xD, 0x02,0x00,0x00,0x1E,0x00,0x00,0xFC,0x00,0x00,0xE0,0x07,0x00,0x00,0x3F,0x00,0x00,0xF8,0x01,0x00,0xC0,0x01,0x00,0xF8,0x01,0x00,0x3F,0x00,0xE0,0x07,0x00,0xFC,0x00,0x00,0x1E,0x00,0x00,0x02,0x00,0x00,
+	0x02,0x00,0x00,0x1E,0x00,0x00,0xFC,0x00,0x00,0xE0,0x07,0x00,0x00,0x3F,0x00,0x00,0xF8,0x01,0x00,0xC0,0x01,0x00,0xF8,0x01,0x00,0x3F,0x00,0xE0,0x07,0x00,0xFC,0x00,0x00,0x1E,0x00,0x00,0x02,0x00,0x00,
 
 	/* Index 55, character 87 "W" (width: 19 pixels) */
-	0x13, 0x06,0x00,0x00,0x7E,0x00,0x00,0xF8,0x07,0x00,0x80,0x7F,0x00,0x00,0xF8,0x01,0x00,0xC0,0x01,0x00,0xFE,0x00,0xE0,0x0F,0x00,0xFE,0x00,0x00,0x0E,0x00,0x00,0xFE,0x00,0x00,0xE0,0x0F,0x00,0x00,0xFE,0x00,0x00,0xE0,0x01,0x00,0xF8,0x01,0x80,0x7F,0x00,0xF8,0x07,0x00,0x7E,0x00,0x00,0x06,0x00,0x00,
+	0x06,0x00,0x00,0x7E,0x00,0x00,0xF8,0x07,0x00,0x80,0x7F,0x00,0x00,0xF8,0x01,0x00,0xC0,0x01,0x00,0xFE,0x00,0xE0,0x0F,0x00,0xFE,0x00,0x00,0x0E,0x00,0x00,0xFE,0x00,0x00,0xE0,0x0F,0x00,0x00,0xFE,0x00,0x00,0xE0,0x01,0x00,0xF8,0x01,0x80,0x7F,0x00,0xF8,0x07,0x00,0x7E,0x00,0x00,0x06,0x00,0x00,
 
 	/* Index 56, character 88 "X" (width: 12 pixels) */
-	0xC, 0x02,0x00,0x01,0x06,0x80,0x01,0x1C,0xE0,0x00,0x78,0x78,0x00,0xE0,0x1C,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0xE0,0x1C,0x00,0x78,0x78,0x00,0x1C,0xE0,0x00,0x06,0x80,0x01,0x02,0x00,0x01,
+	0x02,0x00,0x01,0x06,0x80,0x01,0x1C,0xE0,0x00,0x78,0x78,0x00,0xE0,0x1C,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0xE0,0x1C,0x00,0x78,0x78,0x00,0x1C,0xE0,0x00,0x06,0x80,0x01,0x02,0x00,0x01,
 
 	/* Index 57, character 89 "Y" (width: 12 pixels) */
-	0xC, 0x02,0x00,0x00,0x0E,0x00,0x00,0x3E,0x00,0x00,0x78,0x00,0x00,0xE0,0x01,0x00,0x80,0xFF,0x01,0x80,0xFF,0x01,0xE0,0x01,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x02,0x00,0x00,
+	0x02,0x00,0x00,0x0E,0x00,0x00,0x3E,0x00,0x00,0x78,0x00,0x00,0xE0,0x01,0x00,0x80,0xFF,0x01,0x80,0xFF,0x01,0xE0,0x01,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x02,0x00,0x00,
 
 	/* Index 58, character 90 "Z" (width: 10 pixels) */
-	0xA, 0x06,0xC0,0x01,0x06,0xE0,0x01,0x06,0xB8,0x01,0x06,0x9C,0x01,0x06,0x87,0x01,0x86,0x83,0x01,0xE6,0x80,0x01,0x76,0x80,0x01,0x1E,0x80,0x01,0x0E,0x80,0x01,
+	0x06,0xC0,0x01,0x06,0xE0,0x01,0x06,0xB8,0x01,0x06,0x9C,0x01,0x06,0x87,0x01,0x86,0x83,0x01,0xE6,0x80,0x01,0x76,0x80,0x01,0x1E,0x80,0x01,0x0E,0x80,0x01,
 
 	/* Index 59, character 91 "[" (width: 5 pixels) */
-	0x5, 0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,
+	0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,
 
 	/* Index 60, character 92 "\" (width: 8 pixels) */
-	0x8, 0x03,0x00,0x00,0x1F,0x00,0x00,0xFC,0x00,0x00,0xE0,0x0F,0x00,0x00,0x7F,0x00,0x00,0xF0,0x03,0x00,0x80,0x0F,0x00,0x00,0x0C,
+	0x03,0x00,0x00,0x1F,0x00,0x00,0xFC,0x00,0x00,0xE0,0x0F,0x00,0x00,0x7F,0x00,0x00,0xF0,0x03,0x00,0x80,0x0F,0x00,0x00,0x0C,
 
 	/* Index 61, character 93 "]" (width: 5 pixels) */
-	0x5, 0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,
+	0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,
 
 	/* Index 62, character 94 "^" (width: 13 pixels) */
-	0xD, 0x00,0x01,0x00,0x80,0x01,0x00,0xC0,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0xC0,0x00,0x00,0x80,0x01,0x00,0x00,0x01,0x00,
+	0x00,0x01,0x00,0x80,0x01,0x00,0xC0,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0xC0,0x00,0x00,0x80,0x01,0x00,0x00,0x01,0x00,
 
 	/* Index 63, character 95 "_" (width: 11 pixels) */
-	0xB, 0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,
+	0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,
 
 	/* Index 64, character 96 "`" (width: 4 pixels) */
-	0x4, 0x01,0x00,0x00,0x03,0x00,0x00,0x0F,0x00,0x00,0x08,0x00,0x00,
+	0x01,0x00,0x00,0x03,0x00,0x00,0x0F,0x00,0x00,0x08,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 9 pixels) */
-	0x9, 0x00,0xF0,0x00,0xC0,0xF8,0x00,0xC0,0x98,0x01,0xC0,0x8C,0x01,0xC0,0x8C,0x01,0xC0,0x8C,0x01,0xC0,0xCC,0x00,0x80,0xFF,0x01,0x00,0xFF,0x01,
+	0x00,0xF0,0x00,0xC0,0xF8,0x00,0xC0,0x98,0x01,0xC0,0x8C,0x01,0xC0,0x8C,0x01,0xC0,0x8C,0x01,0xC0,0xCC,0x00,0x80,0xFF,0x01,0x00,0xFF,0x01,
 
 	/* Index 66, character 98 "b" (width: 10 pixels) */
-	0xA, 0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x80,0x81,0x00,0x80,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0xC1,0x00,0x80,0xFF,0x00,0x00,0x3E,0x00,
+	0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x80,0x81,0x00,0x80,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0xC1,0x00,0x80,0xFF,0x00,0x00,0x3E,0x00,
 
 	/* Index 67, character 99 "c" (width: 9 pixels) */
-	0x9, 0x00,0x3E,0x00,0x80,0xFF,0x00,0x80,0xC1,0x00,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0x80,0xC1,0x00,
+	0x00,0x3E,0x00,0x80,0xFF,0x00,0x80,0xC1,0x00,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0x80,0xC1,0x00,
 
 	/* Index 68, character 100 "d" (width: 10 pixels) */
-	0xA, 0x00,0x3E,0x00,0x80,0xFF,0x00,0x80,0xC1,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0x80,0xC0,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,
+	0x00,0x3E,0x00,0x80,0xFF,0x00,0x80,0xC1,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0x80,0xC0,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,
 
 	/* Index 69, character 101 "e" (width: 10 pixels) */
-	0xA, 0x00,0x3E,0x00,0x80,0xFF,0x00,0x80,0xCD,0x00,0xC0,0x8C,0x01,0xC0,0x8C,0x01,0xC0,0x8C,0x01,0xC0,0x8C,0x01,0xC0,0x8D,0x01,0x80,0x8F,0x01,0x00,0xCF,0x00,
+	0x00,0x3E,0x00,0x80,0xFF,0x00,0x80,0xCD,0x00,0xC0,0x8C,0x01,0xC0,0x8C,0x01,0xC0,0x8C,0x01,0xC0,0x8C,0x01,0xC0,0x8D,0x01,0x80,0x8F,0x01,0x00,0xCF,0x00,
 
 	/* Index 70, character 102 "f" (width: 7 pixels) */
-	0x7, 0xC0,0x00,0x00,0xFC,0xFF,0x01,0xFE,0xFF,0x01,0xC7,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0x03,0x00,0x00,
+	0xC0,0x00,0x00,0xFC,0xFF,0x01,0xFE,0xFF,0x01,0xC7,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0x03,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 10 pixels) */
-	0xA, 0x00,0x3E,0x00,0x00,0xFF,0x1C,0x80,0xC1,0x19,0xC0,0x80,0x19,0xC0,0x80,0x19,0xC0,0x80,0x19,0xC0,0x80,0x19,0x80,0xC0,0x0C,0xC0,0xFF,0x0F,0xC0,0xFF,0x03,
+	0x00,0x3E,0x00,0x00,0xFF,0x1C,0x80,0xC1,0x19,0xC0,0x80,0x19,0xC0,0x80,0x19,0xC0,0x80,0x19,0xC0,0x80,0x19,0x80,0xC0,0x0C,0xC0,0xFF,0x0F,0xC0,0xFF,0x03,
 
 	/* Index 72, character 104 "h" (width: 9 pixels) */
-	0x9, 0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x80,0x01,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x01,0x00,0x80,0xFF,0x01,0x00,0xFF,0x01,
+	0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x80,0x01,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x01,0x00,0x80,0xFF,0x01,0x00,0xFF,0x01,
 
 	/* Index 73, character 105 "i" (width: 2 pixels) */
-	0x2, 0xC6,0xFF,0x01,0xC6,0xFF,0x01,
+	0xC6,0xFF,0x01,0xC6,0xFF,0x01,
 
 	/* Index 74, character 106 "j" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x18,0xC0,0x00,0x18,0xC0,0x00,0x18,0xC6,0xFF,0x0F,0xC6,0xFF,0x07,
+	0x00,0x00,0x18,0xC0,0x00,0x18,0xC0,0x00,0x18,0xC6,0xFF,0x0F,0xC6,0xFF,0x07,
 
 	/* Index 75, character 107 "k" (width: 9 pixels) */
-	0x9, 0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x0C,0x00,0x00,0x1E,0x00,0x00,0x3B,0x00,0x80,0xE1,0x00,0xC0,0xC0,0x01,0x40,0x80,0x01,0x00,0x00,0x01,
+	0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x0C,0x00,0x00,0x1E,0x00,0x00,0x3B,0x00,0x80,0xE1,0x00,0xC0,0xC0,0x01,0x40,0x80,0x01,0x00,0x00,0x01,
 
 	/* Index 76, character 108 "l" (width: 2 pixels) */
-	0x2, 0xFF,0xFF,0x01,0xFF,0xFF,0x01,
+	0xFF,0xFF,0x01,0xFF,0xFF,0x01,
 
 	/* Index 77, character 109 "m" (width: 16 pixels) */
-	0x10, 0xC0,0xFF,0x01,0xC0,0xFF,0x01,0x80,0x01,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x01,0x00,0x80,0xFF,0x01,0x00,0xFF,0x01,0x80,0x01,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x01,0x00,0x80,0xFF,0x01,0x00,0xFF,0x01,
+	0xC0,0xFF,0x01,0xC0,0xFF,0x01,0x80,0x01,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x01,0x00,0x80,0xFF,0x01,0x00,0xFF,0x01,0x80,0x01,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x01,0x00,0x80,0xFF,0x01,0x00,0xFF,0x01,
 
 	/* Index 78, character 110 "n" (width: 9 pixels) */
-	0x9, 0xC0,0xFF,0x01,0xC0,0xFF,0x01,0x80,0x01,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x01,0x00,0x80,0xFF,0x01,0x00,0xFF,0x01,
+	0xC0,0xFF,0x01,0xC0,0xFF,0x01,0x80,0x01,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x01,0x00,0x80,0xFF,0x01,0x00,0xFF,0x01,
 
 	/* Index 79, character 111 "o" (width: 10 pixels) */
-	0xA, 0x00,0x3E,0x00,0x80,0xFF,0x00,0x80,0xC1,0x00,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0x80,0xC1,0x00,0x80,0xFF,0x00,0x00,0x3E,0x00,
+	0x00,0x3E,0x00,0x80,0xFF,0x00,0x80,0xC1,0x00,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0x80,0xC1,0x00,0x80,0xFF,0x00,0x00,0x3E,0x00,
 
 	/* Index 80, character 112 "p" (width: 10 pixels) */
-	0xA, 0xC0,0xFF,0x1F,0xC0,0xFF,0x1F,0x80,0x81,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0xC1,0x00,0x80,0xFF,0x00,0x00,0x3E,0x00,
+	0xC0,0xFF,0x1F,0xC0,0xFF,0x1F,0x80,0x81,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0xC1,0x00,0x80,0xFF,0x00,0x00,0x3E,0x00,
 
 	/* Index 81, character 113 "q" (width: 10 pixels) */
-	0xA, 0x00,0x3E,0x00,0x80,0xFF,0x00,0x80,0xC1,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0x80,0xC0,0x00,0xC0,0xFF,0x1F,0xC0,0xFF,0x1F,
+	0x00,0x3E,0x00,0x80,0xFF,0x00,0x80,0xC1,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0x80,0xC0,0x00,0xC0,0xFF,0x1F,0xC0,0xFF,0x1F,
 
 	/* Index 82, character 114 "r" (width: 7 pixels) */
-	0x7, 0xC0,0xFF,0x01,0xC0,0xFF,0x01,0x80,0x01,0x00,0x80,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,
+	0xC0,0xFF,0x01,0xC0,0xFF,0x01,0x80,0x01,0x00,0x80,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 8 pixels) */
-	0x8, 0x00,0xC7,0x00,0x80,0x8F,0x01,0xC0,0x8C,0x01,0xC0,0x9C,0x01,0xC0,0x98,0x01,0xC0,0x98,0x01,0xC0,0xF8,0x00,0x80,0x71,0x00,
+	0x00,0xC7,0x00,0x80,0x8F,0x01,0xC0,0x8C,0x01,0xC0,0x9C,0x01,0xC0,0x98,0x01,0xC0,0x98,0x01,0xC0,0xF8,0x00,0x80,0x71,0x00,
 
 	/* Index 84, character 116 "t" (width: 6 pixels) */
-	0x6, 0xC0,0x00,0x00,0xF8,0xFF,0x00,0xF8,0xFF,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,
+	0xC0,0x00,0x00,0xF8,0xFF,0x00,0xF8,0xFF,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,
 
 	/* Index 85, character 117 "u" (width: 9 pixels) */
-	0x9, 0xC0,0x7F,0x00,0xC0,0xFF,0x00,0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0xC0,0x00,0xC0,0xFF,0x01,0xC0,0xFF,0x01,
+	0xC0,0x7F,0x00,0xC0,0xFF,0x00,0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0xC0,0x00,0xC0,0xFF,0x01,0xC0,0xFF,0x01,
 
 	/* Index 86, character 118 "v" (width: 9 pixels) */
-	0x9, 0x40,0x00,0x00,0xC0,0x03,0x00,0x80,0x1F,0x00,0x00,0xFC,0x00,0x00,0xE0,0x01,0x00,0xFC,0x00,0x80,0x1F,0x00,0xC0,0x03,0x00,0x40,0x00,0x00,
+	0x40,0x00,0x00,0xC0,0x03,0x00,0x80,0x1F,0x00,0x00,0xFC,0x00,0x00,0xE0,0x01,0x00,0xFC,0x00,0x80,0x1F,0x00,0xC0,0x03,0x00,0x40,0x00,0x00,
 
 	/* Index 87, character 119 "w" (width: 15 pixels) */
-	0xF, 0xC0,0x00,0x00,0xC0,0x0F,0x00,0x00,0x7F,0x00,0x00,0xF0,0x01,0x00,0xE0,0x01,0x00,0x7C,0x00,0x80,0x0F,0x00,0xC0,0x01,0x00,0xC0,0x0F,0x00,0x00,0x7E,0x00,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0x7F,0x00,0xC0,0x0F,0x00,0xC0,0x00,0x00,
+	0xC0,0x00,0x00,0xC0,0x0F,0x00,0x00,0x7F,0x00,0x00,0xF0,0x01,0x00,0xE0,0x01,0x00,0x7C,0x00,0x80,0x0F,0x00,0xC0,0x01,0x00,0xC0,0x0F,0x00,0x00,0x7E,0x00,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0x7F,0x00,0xC0,0x0F,0x00,0xC0,0x00,0x00,
 
 	/* Index 88, character 120 "x" (width: 9 pixels) */
-	0x9, 0x40,0x00,0x01,0xC0,0x80,0x01,0x80,0xE3,0x00,0x00,0x7F,0x00,0x00,0x1C,0x00,0x00,0x7F,0x00,0x80,0xE3,0x00,0xC0,0x80,0x01,0x40,0x00,0x01,
+	0x40,0x00,0x01,0xC0,0x80,0x01,0x80,0xE3,0x00,0x00,0x7F,0x00,0x00,0x1C,0x00,0x00,0x7F,0x00,0x80,0xE3,0x00,0xC0,0x80,0x01,0x40,0x00,0x01,
 
 	/* Index 89, character 121 "y" (width: 9 pixels) */
-	0x9, 0x40,0x00,0x00,0xC0,0x03,0x00,0x80,0x1F,0x1C,0x00,0xFC,0x1F,0x00,0xE0,0x07,0x00,0xFC,0x00,0x80,0x1F,0x00,0xC0,0x03,0x00,0x40,0x00,0x00,
+	0x40,0x00,0x00,0xC0,0x03,0x00,0x80,0x1F,0x1C,0x00,0xFC,0x1F,0x00,0xE0,0x07,0x00,0xFC,0x00,0x80,0x1F,0x00,0xC0,0x03,0x00,0x40,0x00,0x00,
 
 	/* Index 90, character 122 "z" (width: 7 pixels) */
-	0x7, 0xC0,0xC0,0x01,0xC0,0xE0,0x01,0xC0,0xF8,0x01,0xC0,0x9C,0x01,0xC0,0x8F,0x01,0xC0,0x83,0x01,0xC0,0x80,0x01,
+	0xC0,0xC0,0x01,0xC0,0xE0,0x01,0xC0,0xF8,0x01,0xC0,0x9C,0x01,0xC0,0x8F,0x01,0xC0,0x83,0x01,0xC0,0x80,0x01,
 
 	/* Index 91, character 123 "{" (width: 8 pixels) */
-	0x8, 0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x1E,0x00,0xFC,0xF3,0x07,0xFE,0xE1,0x0F,0x07,0x00,0x1C,0x03,0x00,0x18,0x03,0x00,0x18,
+	0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x1E,0x00,0xFC,0xF3,0x07,0xFE,0xE1,0x0F,0x07,0x00,0x1C,0x03,0x00,0x18,0x03,0x00,0x18,
 
 	/* Index 92, character 124 "|" (width: 2 pixels) */
-	0x2, 0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,
+	0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,
 
 	/* Index 93, character 125 "}" (width: 8 pixels) */
-	0x8, 0x03,0x00,0x18,0x03,0x00,0x18,0x07,0x00,0x1C,0xFE,0xE1,0x0F,0xFC,0xF3,0x07,0x00,0x1E,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,
+	0x03,0x00,0x18,0x03,0x00,0x18,0x07,0x00,0x1C,0xFE,0xE1,0x0F,0xFC,0xF3,0x07,0x00,0x1E,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,
 
 	/* Index 94, character 126 "~" (width: 13 pixels) */
-	0xD, 0x00,0x1C,0x00,0x00,0x1E,0x00,0x00,0x07,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x0F,0x00,0x00,0x07,0x00
+	0x00,0x1C,0x00,0x00,0x1E,0x00,0x00,0x07,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x0F,0x00,0x00,0x07,0x00
+};
+
+// Offset of each bitmap in Tahoma16_bitmaps
+const unsigned short Tahoma16_offsets[] = 
+{
+	0x0,	// Index 0
+	0x9,	// Index 1
+	0xF,	// Index 2
+	0x21,	// Index 3
+	0x48,	// Index 4
+	0x63,	// Index 5
+	0x99,	// Index 6
+	0xC3,	// Index 7
+	0xC9,	// Index 8
+	0xDB,	// Index 9
+	0xED,	// Index 10
+	0x10B,	// Index 11
+	0x12F,	// Index 12
+	0x13B,	// Index 13
+	0x14D,	// Index 14
+	0x153,	// Index 15
+	0x16B,	// Index 16
+	0x189,	// Index 17
+	0x1A1,	// Index 18
+	0x1BF,	// Index 19
+	0x1DA,	// Index 20
+	0x1FB,	// Index 21
+	0x216,	// Index 22
+	0x234,	// Index 23
+	0x252,	// Index 24
+	0x270,	// Index 25
+	0x28E,	// Index 26
+	0x294,	// Index 27
+	0x2A0,	// Index 28
+	0x2C1,	// Index 29
+	0x2E2,	// Index 30
+	0x303,	// Index 31
+	0x31B,	// Index 32
+	0x34E,	// Index 33
+	0x375,	// Index 34
+	0x393,	// Index 35
+	0x3B4,	// Index 36
+	0x3D5,	// Index 37
+	0x3F0,	// Index 38
+	0x40B,	// Index 39
+	0x42F,	// Index 40
+	0x44D,	// Index 41
+	0x45F,	// Index 42
+	0x477,	// Index 43
+	0x495,	// Index 44
+	0x4AD,	// Index 45
+	0x4D1,	// Index 46
+	0x4EF,	// Index 47
+	0x516,	// Index 48
+	0x534,	// Index 49
+	0x55B,	// Index 50
+	0x57C,	// Index 51
+	0x59A,	// Index 52
+	0x5BE,	// Index 53
+	0x5E2,	// Index 54
+	0x609,	// Index 55
+	0x642,	// Index 56
+	0x666,	// Index 57
+	0x68A,	// Index 58
+	0x6A8,	// Index 59
+	0x6B7,	// Index 60
+	0x6CF,	// Index 61
+	0x6DE,	// Index 62
+	0x705,	// Index 63
+	0x726,	// Index 64
+	0x732,	// Index 65
+	0x74D,	// Index 66
+	0x76B,	// Index 67
+	0x786,	// Index 68
+	0x7A4,	// Index 69
+	0x7C2,	// Index 70
+	0x7D7,	// Index 71
+	0x7F5,	// Index 72
+	0x810,	// Index 73
+	0x816,	// Index 74
+	0x825,	// Index 75
+	0x840,	// Index 76
+	0x846,	// Index 77
+	0x876,	// Index 78
+	0x891,	// Index 79
+	0x8AF,	// Index 80
+	0x8CD,	// Index 81
+	0x8EB,	// Index 82
+	0x900,	// Index 83
+	0x918,	// Index 84
+	0x92A,	// Index 85
+	0x945,	// Index 86
+	0x960,	// Index 87
+	0x98D,	// Index 88
+	0x9A8,	// Index 89
+	0x9C3,	// Index 90
+	0x9D8,	// Index 91
+	0x9F0,	// Index 92
+	0x9F6,	// Index 93
+	0xA0E,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Tahoma16_widths[] = 
+{
+	0x3,	// Index 0
+	0x2,	// Index 1
+	0x6,	// Index 2
+	0xD,	// Index 3
+	0x9,	// Index 4
+	0x12,	// Index 5
+	0xE,	// Index 6
+	0x2,	// Index 7
+	0x6,	// Index 8
+	0x6,	// Index 9
+	0xA,	// Index 10
+	0xC,	// Index 11
+	0x4,	// Index 12
+	0x6,	// Index 13
+	0x2,	// Index 14
+	0x8,	// Index 15
+	0xA,	// Index 16
+	0x8,	// Index 17
+	0xA,	// Index 18
+	0x9,	// Index 19
+	0xB,	// Index 20
+	0x9,	// Index 21
+	0xA,	// Index 22
+	0xA,	// Index 23
+	0xA,	// Index 24
+	0xA,	// Index 25
+	0x2,	// Index 26
+	0x4,	// Index 27
+	0xB,	// Index 28
+	0xB,	// Index 29
+	0xB,	// Index 30
+	0x8,	// Index 31
+	0x11,	// Index 32
+	0xD,	// Index 33
+	0xA,	// Index 34
+	0xB,	// Index 35
+	0xB,	// Index 36
+	0x9,	// Index 37
+	0x9,	// Index 38
+	0xC,	// Index 39
+	0xA,	// Index 40
+	0x6,	// Index 41
+	0x8,	// Index 42
+	0xA,	// Index 43
+	0x8,	// Index 44
+	0xC,	// Index 45
+	0xA,	// Index 46
+	0xD,	// Index 47
+	0xA,	// Index 48
+	0xD,	// Index 49
+	0xB,	// Index 50
+	0xA,	// Index 51
+	0xC,	// Index 52
+	0xC,	// Index 53
+	0xD,	// Index 54
+	0x13,	// Index 55
+	0xC,	// Index 56
+	0xC,	// Index 57
+	0xA,	// Index 58
+	0x5,	// Index 59
+	0x8,	// Index 60
+	0x5,	// Index 61
+	0xD,	// Index 62
+	0xB,	// Index 63
+	0x4,	// Index 64
+	0x9,	// Index 65
+	0xA,	// Index 66
+	0x9,	// Index 67
+	0xA,	// Index 68
+	0xA,	// Index 69
+	0x7,	// Index 70
+	0xA,	// Index 71
+	0x9,	// Index 72
+	0x2,	// Index 73
+	0x5,	// Index 74
+	0x9,	// Index 75
+	0x2,	// Index 76
+	0x10,	// Index 77
+	0x9,	// Index 78
+	0xA,	// Index 79
+	0xA,	// Index 80
+	0xA,	// Index 81
+	0x7,	// Index 82
+	0x8,	// Index 83
+	0x6,	// Index 84
+	0x9,	// Index 85
+	0x9,	// Index 86
+	0xF,	// Index 87
+	0x9,	// Index 88
+	0x9,	// Index 89
+	0x7,	// Index 90
+	0x8,	// Index 91
+	0x2,	// Index 92
+	0x8,	// Index 93
+	0xD,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Tahoma16_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x10, 0x0,	// Index 1
+	0x11, 0x0,	// Index 2
+	0x10, 0x0,	// Index 3
+	0x10, 0x4,	// Index 4
+	0x10, 0x0,	// Index 5
+	0x10, 0x0,	// Index 6
+	0x11, 0x0,	// Index 7
+	0x11, 0x4,	// Index 8
+	0x11, 0x4,	// Index 9
+	0x11, 0x0,	// Index 10
+	0xD, 0x0,	// Index 11
+	0x3, 0x4,	// Index 12
+	0x8, 0x0,	// Index 13
+	0x3, 0x0,	// Index 14
+	0x11, 0x3,	// Index 15
+	0x10, 0x0,	// Index 16
+	0x10, 0x0,	// Index 17
+	0x10, 0x0,	// Index 18
+	0x10, 0x0,	// Index 19
+	0x10, 0x0,	// Index 20
+	0x10, 0x0,	// Index 21
+	0x10, 0x0,	// Index 22
+	0x10, 0x0,	// Index 23
+	0x10, 0x0,	// Index 24
+	0x10, 0x0,	// Index 25
+	0xB, 0x0,	// Index 26
+	0xB, 0x4,	// Index 27
+	0xC, 0x0,	// Index 28
+	0xA, 0x0,	// Index 29
+	0xC, 0x0,	// Index 30
+	0x10, 0x0,	// Index 31
+	0x10, 0x2,	// Index 32
+	0x10, 0x0,	// Index 33
+	0x10, 0x0,	// Index 34
+	0x10, 0x0,	// Index 35
+	0x10, 0x0,	// Index 36
+	0x10, 0x0,	// Index 37
+	0x10, 0x0,	// Index 38
+	0x10, 0x0,	// Index 39
+	0x10, 0x0,	// Index 40
+	0x10, 0x0,	// Index 41
+	0x10, 0x0,	// Index 42
+	0x10, 0x0,	// Index 43
+	0x10, 0x0,	// Index 44
+	0x10, 0x0,	// Index 45
+	0x10, 0x0,	// Index 46
+	0x10, 0x0,	// Index 47
+	0x10, 0x0,	// Index 48
+	0x10, 0x4,	// Index 49
+	0x10, 0x0,	// Index 50
+	0x10, 0x0,	// Index 51
+	0x10, 0x0,	// Index 52
+	0x10, 0x0,	// Index 53
+	0x10, 0x0,	// Index 54
+	0x10, 0x0,	// Index 55
+	0x10, 0x0,	// Index 56
+	0x10, 0x0,	// Index 57
+	0x10, 0x0,	// Index 58
+	0x11, 0x4,	// Index 59
+	0x11, 0x3,	// Index 60
+	0x11, 0x4,	// Index 61
+	0x10, 0x0,	// Index 62
+	0x0, 0x3,	// Index 63
+	0x11, 0x0,	// Index 64
+	0xB, 0x0,	// Index 65
+	0x11, 0x0,	// Index 66
+	0xB, 0x0,	// Index 67
+	0x11, 0x0,	// Index 68
+	0xB, 0x0,	// Index 69
+	0x11, 0x0,	// Index 70
+	0xB, 0x4,	// Index 71
+	0x11, 0x0,	// Index 72
+	0x10, 0x0,	// Index 73
+	0x10, 0x4,	// Index 74
+	0x11, 0x0,	// Index 75
+	0x11, 0x0,	// Index 76
+	0xB, 0x0,	// Index 77
+	0xB, 0x0,	// Index 78
+	0xB, 0x0,	// Index 79
+	0xB, 0x4,	// Index 80
+	0xB, 0x4,	// Index 81
+	0xB, 0x0,	// Index 82
+	0xB, 0x0,	// Index 83
+	0xE, 0x0,	// Index 84
+	0xB, 0x0,	// Index 85
+	0xB, 0x0,	// Index 86
+	0xB, 0x0,	// Index 87
+	0xB, 0x0,	// Index 88
+	0xB, 0x4,	// Index 89
+	0xB, 0x0,	// Index 90
+	0x11, 0x4,	// Index 91
+	0x11, 0x4,	// Index 92
+	0x11, 0x4,	// Index 93
+	0x9, 0x0,	// Index 94
 };
+
+const font_t Tahoma16 = 
+{
+	Tahoma16_bitmaps,
+	Tahoma16_offsets,
+	Tahoma16_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x15,	// Height 
+	0,	// Flags 
+	Tahoma16_extents,
+	0x11	// Ascent 
+};
+
 //---------------------------------------------------------------
 // Group Name: Tahoma14
 // Designer: Imported System Font
@@ -830,398 +1250,607 @@ const unsigned char Tahoma16[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Tahoma14[] = 
+const unsigned char Tahoma14_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x13,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xCA, // Index 1 (offset: 202)
-	0x0, 0xD1, // Index 2 (offset: 209)
-	0x0, 0xE1, // Index 3 (offset: 225)
-	0x1, 0x3, // Index 4 (offset: 259)
-	0x1, 0x1C, // Index 5 (offset: 284)
-	0x1, 0x50, // Index 6 (offset: 336)
-	0x1, 0x78, // Index 7 (offset: 376)
-	0x1, 0x7F, // Index 8 (offset: 383)
-	0x1, 0x92, // Index 9 (offset: 402)
-	0x1, 0xA5, // Index 10 (offset: 421)
-	0x1, 0xC1, // Index 11 (offset: 449)
-	0x1, 0xE6, // Index 12 (offset: 486)
-	0x1, 0xF3, // Index 13 (offset: 499)
-	0x2, 0x3, // Index 14 (offset: 515)
-	0x2, 0xA, // Index 15 (offset: 522)
-	0x2, 0x20, // Index 16 (offset: 544)
-	0x2, 0x3C, // Index 17 (offset: 572)
-	0x2, 0x55, // Index 18 (offset: 597)
-	0x2, 0x71, // Index 19 (offset: 625)
-	0x2, 0x8A, // Index 20 (offset: 650)
-	0x2, 0xA9, // Index 21 (offset: 681)
-	0x2, 0xC2, // Index 22 (offset: 706)
-	0x2, 0xDE, // Index 23 (offset: 734)
-	0x2, 0xFA, // Index 24 (offset: 762)
-	0x3, 0x16, // Index 25 (offset: 790)
-	0x3, 0x32, // Index 26 (offset: 818)
-	0x3, 0x39, // Index 27 (offset: 825)
-	0x3, 0x46, // Index 28 (offset: 838)
-	0x3, 0x65, // Index 29 (offset: 869)
-	0x3, 0x84, // Index 30 (offset: 900)
-	0x3, 0xA3, // Index 31 (offset: 931)
-	0x3, 0xB9, // Index 32 (offset: 953)
-	0x3, 0xE7, // Index 33 (offset: 999)
-	0x4, 0x9, // Index 34 (offset: 1033)
-	0x4, 0x25, // Index 35 (offset: 1061)
-	0x4, 0x44, // Index 36 (offset: 1092)
-	0x4, 0x66, // Index 37 (offset: 1126)
-	0x4, 0x82, // Index 38 (offset: 1154)
-	0x4, 0x9E, // Index 39 (offset: 1182)
-	0x4, 0xC3, // Index 40 (offset: 1219)
-	0x4, 0xE2, // Index 41 (offset: 1250)
-	0x4, 0xF5, // Index 42 (offset: 1269)
-	0x5, 0xB, // Index 43 (offset: 1291)
-	0x5, 0x2A, // Index 44 (offset: 1322)
-	0x5, 0x43, // Index 45 (offset: 1347)
-	0x5, 0x68, // Index 46 (offset: 1384)
-	0x5, 0x87, // Index 47 (offset: 1415)
-	0x5, 0xAC, // Index 48 (offset: 1452)
-	0x5, 0xC8, // Index 49 (offset: 1480)
-	0x5, 0xED, // Index 50 (offset: 1517)
-	0x6, 0xF, // Index 51 (offset: 1551)
-	0x6, 0x2E, // Index 52 (offset: 1582)
-	0x6, 0x53, // Index 53 (offset: 1619)
-	0x6, 0x72, // Index 54 (offset: 1650)
-	0x6, 0x91, // Index 55 (offset: 1681)
-	0x6, 0xC2, // Index 56 (offset: 1730)
-	0x6, 0xE1, // Index 57 (offset: 1761)
-	0x7, 0x6, // Index 58 (offset: 1798)
-	0x7, 0x22, // Index 59 (offset: 1826)
-	0x7, 0x32, // Index 60 (offset: 1842)
-	0x7, 0x48, // Index 61 (offset: 1864)
-	0x7, 0x58, // Index 62 (offset: 1880)
-	0x7, 0x7A, // Index 63 (offset: 1914)
-	0x7, 0x99, // Index 64 (offset: 1945)
-	0x7, 0xA6, // Index 65 (offset: 1958)
-	0x7, 0xBF, // Index 66 (offset: 1983)
-	0x7, 0xDB, // Index 67 (offset: 2011)
-	0x7, 0xF4, // Index 68 (offset: 2036)
-	0x8, 0x10, // Index 69 (offset: 2064)
-	0x8, 0x2C, // Index 70 (offset: 2092)
-	0x8, 0x3F, // Index 71 (offset: 2111)
-	0x8, 0x5B, // Index 72 (offset: 2139)
-	0x8, 0x74, // Index 73 (offset: 2164)
-	0x8, 0x7B, // Index 74 (offset: 2171)
-	0x8, 0x8B, // Index 75 (offset: 2187)
-	0x8, 0xA4, // Index 76 (offset: 2212)
-	0x8, 0xAB, // Index 77 (offset: 2219)
-	0x8, 0xD6, // Index 78 (offset: 2262)
-	0x8, 0xEF, // Index 79 (offset: 2287)
-	0x9, 0xB, // Index 80 (offset: 2315)
-	0x9, 0x27, // Index 81 (offset: 2343)
-	0x9, 0x43, // Index 82 (offset: 2371)
-	0x9, 0x56, // Index 83 (offset: 2390)
-	0x9, 0x6C, // Index 84 (offset: 2412)
-	0x9, 0x7F, // Index 85 (offset: 2431)
-	0x9, 0x98, // Index 86 (offset: 2456)
-	0x9, 0xB1, // Index 87 (offset: 2481)
-	0x9, 0xD9, // Index 88 (offset: 2521)
-	0x9, 0xF2, // Index 89 (offset: 2546)
-	0xA, 0xB, // Index 90 (offset: 2571)
-	0xA, 0x21, // Index 91 (offset: 2593)
-	0xA, 0x3A, // Index 92 (offset: 2618)
-	0xA, 0x41, // Index 93 (offset: 2625)
-	0xA, 0x5A, // Index 94 (offset: 2650)
-
 	/* Index 0, character 32 " " (width: 2 pixels) */
-	0x2, 0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 2 pixels) */
-	0x2, 0xFE,0x67,0x00,0xFE,0x67,0x00,
+	0xFE,0x67,0x00,0xFE,0x67,0x00,
 
 	/* Index 2, character 34 """ (width: 5 pixels) */
-	0x5, 0x1F,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x1F,0x00,0x00,
+	0x1F,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x1F,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 11 pixels) */
-	0xB, 0x00,0x04,0x00,0x20,0x64,0x00,0x20,0x1F,0x00,0xF8,0x04,0x00,0x26,0x04,0x00,0x20,0x04,0x00,0x20,0x64,0x00,0x20,0x1F,0x00,0xF8,0x04,0x00,0x26,0x04,0x00,0x20,0x00,0x00,
+	0x00,0x04,0x00,0x20,0x64,0x00,0x20,0x1F,0x00,0xF8,0x04,0x00,0x26,0x04,0x00,0x20,0x04,0x00,0x20,0x64,0x00,0x20,0x1F,0x00,0xF8,0x04,0x00,0x26,0x04,0x00,0x20,0x00,0x00,
 
 	/* Index 4, character 36 "$" (width: 8 pixels) */
-	0x8, 0xE0,0x30,0x00,0xF0,0x61,0x00,0x98,0x61,0x00,0x18,0x63,0x00,0xFF,0xFF,0x03,0x18,0x63,0x00,0x18,0x3F,0x00,0x30,0x1E,0x00,
+	0xE0,0x30,0x00,0xF0,0x61,0x00,0x98,0x61,0x00,0x18,0x63,0x00,0xFF,0xFF,0x03,0x18,0x63,0x00,0x18,0x3F,0x00,0x30,0x1E,0x00,
 
 	/* Index 5, character 37 "%" (width: 17 pixels) */
-	0x11, 0x78,0x00,0x00,0xFE,0x01,0x00,0x02,0x01,0x00,0x02,0x01,0x00,0x02,0x41,0x00,0xFE,0x71,0x00,0x78,0x3C,0x00,0x00,0x0F,0x00,0xC0,0x03,0x00,0xF0,0x00,0x00,0x3C,0x1E,0x00,0x8E,0x7F,0x00,0x82,0x40,0x00,0x80,0x40,0x00,0x80,0x40,0x00,0x80,0x7F,0x00,0x00,0x1E,0x00,
+	0x78,0x00,0x00,0xFE,0x01,0x00,0x02,0x01,0x00,0x02,0x01,0x00,0x02,0x41,0x00,0xFE,0x71,0x00,0x78,0x3C,0x00,0x00,0x0F,0x00,0xC0,0x03,0x00,0xF0,0x00,0x00,0x3C,0x1E,0x00,0x8E,0x7F,0x00,0x82,0x40,0x00,0x80,0x40,0x00,0x80,0x40,0x00,0x80,0x7F,0x00,0x00,0x1E,0x00,
 
 	/* Index 6, character 38 "&" (width: 13 pixels) */
-	0xD, 0x00,0x1E,0x00,0x38,0x3F,0x00,0xFC,0x71,0x00,0xC6,0x60,0x00,0xC6,0x61,0x00,0xC6,0x63,0x00,0x7E,0x67,0x00,0x3C,0x2E,0x00,0x00,0x1C,0x00,0x80,0x3F,0x00,0x80,0x73,0x00,0x00,0x60,0x00,0x00,0x40,0x00,
+	0x00,0x1E,0x00,0x38,0x3F,0x00,0xFC,0x71,0x00,0xC6,0x60,0x00,0xC6,0x61,0x00,0xC6,0x63,0x00,0x7E,0x67,0x00,0x3C,0x2E,0x00,0x00,0x1C,0x00,0x80,0x3F,0x00,0x80,0x73,0x00,0x00,0x60,0x00,0x00,0x40,0x00,
 
 	/* Index 7, character 39 "'" (width: 2 pixels) */
-	0x2, 0x1F,0x00,0x00,0x1F,0x00,0x00,
+	0x1F,0x00,0x00,0x1F,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 6 pixels) */
-	0x6, 0xC0,0x1F,0x00,0xF8,0xFF,0x00,0x3C,0xE0,0x01,0x07,0x00,0x07,0x03,0x00,0x06,0x01,0x00,0x04,
+	0xC0,0x1F,0x00,0xF8,0xFF,0x00,0x3C,0xE0,0x01,0x07,0x00,0x07,0x03,0x00,0x06,0x01,0x00,0x04,
 
 	/* Index 9, character 41 ")" (width: 6 pixels) */
-	0x6, 0x01,0x00,0x04,0x03,0x00,0x06,0x07,0x00,0x07,0x3C,0xE0,0x01,0xF8,0xFF,0x00,0xC0,0x1F,0x00,
+	0x01,0x00,0x04,0x03,0x00,0x06,0x07,0x00,0x07,0x3C,0xE0,0x01,0xF8,0xFF,0x00,0xC0,0x1F,0x00,
 
 	/* Index 10, character 42 "*" (width: 9 pixels) */
-	0x9, 0xC6,0x00,0x00,0x44,0x00,0x00,0x6C,0x00,0x00,0x28,0x00,0x00,0xFF,0x01,0x00,0x28,0x00,0x00,0x6C,0x00,0x00,0x44,0x00,0x00,0xC6,0x00,0x00,
+	0xC6,0x00,0x00,0x44,0x00,0x00,0x6C,0x00,0x00,0x28,0x00,0x00,0xFF,0x01,0x00,0x28,0x00,0x00,0x6C,0x00,0x00,0x44,0x00,0x00,0xC6,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 12 pixels) */
-	0xC, 0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
+	0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
 
 	/* Index 12, character 44 "," (width: 4 pixels) */
-	0x4, 0x00,0x00,0x03,0x00,0xE0,0x03,0x00,0x70,0x00,0x00,0x10,0x00,
+	0x00,0x00,0x03,0x00,0xE0,0x03,0x00,0x70,0x00,0x00,0x10,0x00,
 
 	/* Index 13, character 45 "-" (width: 5 pixels) */
-	0x5, 0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
+	0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
 
 	/* Index 14, character 46 "." (width: 2 pixels) */
-	0x2, 0x00,0x70,0x00,0x00,0x70,0x00,
+	0x00,0x70,0x00,0x00,0x70,0x00,
 
 	/* Index 15, character 47 "/" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x03,0x00,0xE0,0x03,0x00,0xFE,0x00,0xE0,0x1F,0x00,0xFC,0x01,0x00,0x1F,0x00,0x00,0x03,0x00,0x00,
+	0x00,0x00,0x03,0x00,0xE0,0x03,0x00,0xFE,0x00,0xE0,0x1F,0x00,0xFC,0x01,0x00,0x1F,0x00,0x00,0x03,0x00,0x00,
 
 	/* Index 16, character 48 "0" (width: 9 pixels) */
-	0x9, 0xF0,0x0F,0x00,0xFC,0x3F,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0E,0x70,0x00,0xFC,0x3F,0x00,0xF0,0x0F,0x00,
+	0xF0,0x0F,0x00,0xFC,0x3F,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0E,0x70,0x00,0xFC,0x3F,0x00,0xF0,0x0F,0x00,
 
 	/* Index 17, character 49 "1" (width: 8 pixels) */
-	0x8, 0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,
+	0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,
 
 	/* Index 18, character 50 "2" (width: 9 pixels) */
-	0x9, 0x0C,0x70,0x00,0x06,0x78,0x00,0x06,0x6C,0x00,0x06,0x66,0x00,0x06,0x63,0x00,0x8E,0x61,0x00,0xFC,0x60,0x00,0x78,0x60,0x00,0x00,0x60,0x00,
+	0x0C,0x70,0x00,0x06,0x78,0x00,0x06,0x6C,0x00,0x06,0x66,0x00,0x06,0x63,0x00,0x8E,0x61,0x00,0xFC,0x60,0x00,0x78,0x60,0x00,0x00,0x60,0x00,
 
 	/* Index 19, character 51 "3" (width: 8 pixels) */
-	0x8, 0x0C,0x30,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x4E,0x71,0x00,0x7C,0x3F,0x00,0x38,0x1E,0x00,
+	0x0C,0x30,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x4E,0x71,0x00,0x7C,0x3F,0x00,0x38,0x1E,0x00,
 
 	/* Index 20, character 52 "4" (width: 10 pixels) */
-	0xA, 0x80,0x03,0x00,0xC0,0x03,0x00,0x60,0x03,0x00,0x30,0x03,0x00,0x18,0x03,0x00,0x0C,0x03,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
+	0x80,0x03,0x00,0xC0,0x03,0x00,0x60,0x03,0x00,0x30,0x03,0x00,0x18,0x03,0x00,0x0C,0x03,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
 
 	/* Index 21, character 53 "5" (width: 8 pixels) */
-	0x8, 0x00,0x30,0x00,0xFE,0x60,0x00,0xFE,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x71,0x00,0x86,0x3F,0x00,0x06,0x1F,0x00,
+	0x00,0x30,0x00,0xFE,0x60,0x00,0xFE,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x71,0x00,0x86,0x3F,0x00,0x06,0x1F,0x00,
 
 	/* Index 22, character 54 "6" (width: 9 pixels) */
-	0x9, 0xE0,0x0F,0x00,0xF8,0x3F,0x00,0x9C,0x70,0x00,0xCC,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x71,0x00,0x86,0x3F,0x00,0x00,0x1F,0x00,
+	0xE0,0x0F,0x00,0xF8,0x3F,0x00,0x9C,0x70,0x00,0xCC,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x71,0x00,0x86,0x3F,0x00,0x00,0x1F,0x00,
 
 	/* Index 23, character 55 "7" (width: 9 pixels) */
-	0x9, 0x06,0x00,0x00,0x06,0x40,0x00,0x06,0x70,0x00,0x06,0x3C,0x00,0x06,0x0F,0x00,0xC6,0x03,0x00,0xF6,0x00,0x00,0x3E,0x00,0x00,0x0E,0x00,0x00,
+	0x06,0x00,0x00,0x06,0x40,0x00,0x06,0x70,0x00,0x06,0x3C,0x00,0x06,0x0F,0x00,0xC6,0x03,0x00,0xF6,0x00,0x00,0x3E,0x00,0x00,0x0E,0x00,0x00,
 
 	/* Index 24, character 56 "8" (width: 9 pixels) */
-	0x9, 0x38,0x1E,0x00,0x7C,0x3F,0x00,0xCE,0x71,0x00,0xC6,0x60,0x00,0x86,0x60,0x00,0x86,0x61,0x00,0xCE,0x73,0x00,0x7C,0x3F,0x00,0x38,0x1E,0x00,
+	0x38,0x1E,0x00,0x7C,0x3F,0x00,0xCE,0x71,0x00,0xC6,0x60,0x00,0x86,0x60,0x00,0x86,0x61,0x00,0xCE,0x73,0x00,0x7C,0x3F,0x00,0x38,0x1E,0x00,
 
 	/* Index 25, character 57 "9" (width: 9 pixels) */
-	0x9, 0xF8,0x00,0x00,0xFC,0x61,0x00,0x8E,0x63,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x06,0x33,0x00,0x0E,0x39,0x00,0xFC,0x1F,0x00,0xF0,0x07,0x00,
+	0xF8,0x00,0x00,0xFC,0x61,0x00,0x8E,0x63,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x06,0x33,0x00,0x0E,0x39,0x00,0xFC,0x1F,0x00,0xF0,0x07,0x00,
 
 	/* Index 26, character 58 ":" (width: 2 pixels) */
-	0x2, 0xE0,0x70,0x00,0xE0,0x70,0x00,
+	0xE0,0x70,0x00,0xE0,0x70,0x00,
 
 	/* Index 27, character 59 ";" (width: 4 pixels) */
-	0x4, 0x00,0x00,0x03,0xE0,0xE0,0x03,0xE0,0x70,0x00,0x00,0x10,0x00,
+	0x00,0x00,0x03,0xE0,0xE0,0x03,0xE0,0x70,0x00,0x00,0x10,0x00,
 
 	/* Index 28, character 60 "<" (width: 10 pixels) */
-	0xA, 0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x30,0x18,0x00,0x30,0x18,0x00,0x18,0x30,0x00,
+	0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x30,0x18,0x00,0x30,0x18,0x00,0x18,0x30,0x00,
 
 	/* Index 29, character 61 "=" (width: 10 pixels) */
-	0xA, 0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,
+	0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,
 
 	/* Index 30, character 62 ">" (width: 10 pixels) */
-	0xA, 0x18,0x30,0x00,0x30,0x18,0x00,0x30,0x18,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0x80,0x03,0x00,0x80,0x03,0x00,
+	0x18,0x30,0x00,0x30,0x18,0x00,0x30,0x18,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0x80,0x03,0x00,0x80,0x03,0x00,
 
 	/* Index 31, character 63 "?" (width: 7 pixels) */
-	0x7, 0x0C,0x00,0x00,0x06,0x00,0x00,0x06,0x67,0x00,0x86,0x67,0x00,0xCE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,
+	0x0C,0x00,0x00,0x06,0x00,0x00,0x06,0x67,0x00,0x86,0x67,0x00,0xCE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 15 pixels) */
-	0xF, 0xC0,0x0F,0x00,0x30,0x30,0x00,0x08,0x40,0x00,0x84,0x8F,0x00,0xC4,0x9F,0x00,0x62,0x30,0x01,0x22,0x20,0x01,0x22,0x20,0x01,0x22,0x10,0x01,0xE2,0x3F,0x01,0xE6,0x3F,0x01,0x04,0x20,0x00,0x08,0x20,0x00,0x30,0x30,0x00,0xC0,0x0F,0x00,
+	0xC0,0x0F,0x00,0x30,0x30,0x00,0x08,0x40,0x00,0x84,0x8F,0x00,0xC4,0x9F,0x00,0x62,0x30,0x01,0x22,0x20,0x01,0x22,0x20,0x01,0x22,0x10,0x01,0xE2,0x3F,0x01,0xE6,0x3F,0x01,0x04,0x20,0x00,0x08,0x20,0x00,0x30,0x30,0x00,0xC0,0x0F,0x00,
 
 	/* Index 33, character 65 "A" (width: 11 pixels) */
-	0xB, 0x00,0x60,0x00,0x00,0x7C,0x00,0x80,0x3F,0x00,0xF0,0x07,0x00,0x7E,0x06,0x00,0x0E,0x06,0x00,0x7E,0x06,0x00,0xF0,0x07,0x00,0x80,0x3F,0x00,0x00,0x7C,0x00,0x00,0x60,0x00,
+	0x00,0x60,0x00,0x00,0x7C,0x00,0x80,0x3F,0x00,0xF0,0x07,0x00,0x7E,0x06,0x00,0x0E,0x06,0x00,0x7E,0x06,0x00,0xF0,0x07,0x00,0x80,0x3F,0x00,0x00,0x7C,0x00,0x00,0x60,0x00,
 
 	/* Index 34, character 66 "B" (width: 9 pixels) */
-	0x9, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0xC6,0x61,0x00,0x7E,0x73,0x00,0x3C,0x3F,0x00,0x00,0x1E,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0xC6,0x61,0x00,0x7E,0x73,0x00,0x3C,0x3F,0x00,0x00,0x1E,0x00,
 
 	/* Index 35, character 67 "C" (width: 10 pixels) */
-	0xA, 0xE0,0x07,0x00,0xF8,0x1F,0x00,0x1C,0x38,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0C,0x30,0x00,
+	0xE0,0x07,0x00,0xF8,0x1F,0x00,0x1C,0x38,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0C,0x30,0x00,
 
 	/* Index 36, character 68 "D" (width: 11 pixels) */
-	0xB, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0E,0x70,0x00,0x0C,0x30,0x00,0x1C,0x38,0x00,0xF8,0x1F,0x00,0xE0,0x07,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0E,0x70,0x00,0x0C,0x30,0x00,0x1C,0x38,0x00,0xF8,0x1F,0x00,0xE0,0x07,0x00,
 
 	/* Index 37, character 69 "E" (width: 9 pixels) */
-	0x9, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,
 
 	/* Index 38, character 70 "F" (width: 9 pixels) */
-	0x9, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,
 
 	/* Index 39, character 71 "G" (width: 12 pixels) */
-	0xC, 0xE0,0x07,0x00,0xF8,0x1F,0x00,0x3C,0x3C,0x00,0x0C,0x30,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x0C,0x3F,0x00,0x0C,0x3F,0x00,
+	0xE0,0x07,0x00,0xF8,0x1F,0x00,0x3C,0x3C,0x00,0x0C,0x30,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x0C,0x3F,0x00,0x0C,0x3F,0x00,
 
 	/* Index 40, character 72 "H" (width: 10 pixels) */
-	0xA, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
 
 	/* Index 41, character 73 "I" (width: 6 pixels) */
-	0x6, 0x06,0x60,0x00,0x06,0x60,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x60,0x00,0x06,0x60,0x00,
+	0x06,0x60,0x00,0x06,0x60,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x60,0x00,0x06,0x60,0x00,
 
 	/* Index 42, character 74 "J" (width: 7 pixels) */
-	0x7, 0x00,0x60,0x00,0x00,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x70,0x00,0xFE,0x3F,0x00,0xFE,0x1F,0x00,
+	0x00,0x60,0x00,0x00,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x70,0x00,0xFE,0x3F,0x00,0xFE,0x1F,0x00,
 
 	/* Index 43, character 75 "K" (width: 10 pixels) */
-	0xA, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xC0,0x01,0x00,0xE0,0x03,0x00,0x70,0x07,0x00,0x38,0x0E,0x00,0x1C,0x3C,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x02,0x40,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xC0,0x01,0x00,0xE0,0x03,0x00,0x70,0x07,0x00,0x38,0x0E,0x00,0x1C,0x3C,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x02,0x40,0x00,
 
 	/* Index 44, character 76 "L" (width: 8 pixels) */
-	0x8, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,
 
 	/* Index 45, character 77 "M" (width: 12 pixels) */
-	0xC, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x0E,0x00,0x00,0x38,0x00,0x00,0xE0,0x01,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0xE0,0x01,0x00,0x38,0x00,0x00,0x0E,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x0E,0x00,0x00,0x38,0x00,0x00,0xE0,0x01,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0xE0,0x01,0x00,0x38,0x00,0x00,0x0E,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
 
 	/* Index 46, character 78 "N" (width: 10 pixels) */
-	0xA, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x0E,0x00,0x00,0x3C,0x00,0x00,0xE0,0x00,0x00,0x80,0x03,0x00,0x00,0x0E,0x00,0x00,0x78,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x0E,0x00,0x00,0x3C,0x00,0x00,0xE0,0x00,0x00,0x80,0x03,0x00,0x00,0x0E,0x00,0x00,0x78,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
 
 	/* Index 47, character 79 "O" (width: 12 pixels) */
-	0xC, 0xE0,0x07,0x00,0xF8,0x1F,0x00,0x1C,0x38,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0E,0x70,0x00,0x1C,0x38,0x00,0xF8,0x1F,0x00,0xE0,0x07,0x00,
+	0xE0,0x07,0x00,0xF8,0x1F,0x00,0x1C,0x38,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0E,0x70,0x00,0x1C,0x38,0x00,0xF8,0x1F,0x00,0xE0,0x07,0x00,
 
 	/* Index 48, character 80 "P" (width: 9 pixels) */
-	0x9, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x03,0x00,0x06,0x03,0x00,0x06,0x03,0x00,0x06,0x03,0x00,0x8E,0x01,0x00,0xFC,0x01,0x00,0x78,0x00,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x03,0x00,0x06,0x03,0x00,0x06,0x03,0x00,0x06,0x03,0x00,0x8E,0x01,0x00,0xFC,0x01,0x00,0x78,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 12 pixels) */
-	0xC, 0xE0,0x07,0x00,0xF8,0x1F,0x00,0x1C,0x38,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0xE0,0x01,0x06,0xE0,0x03,0x0E,0x30,0x07,0x1C,0x38,0x06,0xF8,0x1F,0x06,0xE0,0x07,0x06,
+	0xE0,0x07,0x00,0xF8,0x1F,0x00,0x1C,0x38,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0xE0,0x01,0x06,0xE0,0x03,0x0E,0x30,0x07,0x1C,0x38,0x06,0xF8,0x1F,0x06,0xE0,0x07,0x06,
 
 	/* Index 50, character 82 "R" (width: 11 pixels) */
-	0xB, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x03,0x00,0x86,0x07,0x00,0xCE,0x0E,0x00,0xFC,0x38,0x00,0x78,0x70,0x00,0x00,0x60,0x00,0x00,0x40,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x03,0x00,0x86,0x07,0x00,0xCE,0x0E,0x00,0xFC,0x38,0x00,0x78,0x70,0x00,0x00,0x60,0x00,0x00,0x40,0x00,
 
 	/* Index 51, character 83 "S" (width: 10 pixels) */
-	0xA, 0x78,0x30,0x00,0xFC,0x60,0x00,0xCE,0x60,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x06,0x33,0x00,0x0C,0x3F,0x00,0x00,0x1E,0x00,
+	0x78,0x30,0x00,0xFC,0x60,0x00,0xCE,0x60,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x06,0x33,0x00,0x0C,0x3F,0x00,0x00,0x1E,0x00,
 
 	/* Index 52, character 84 "T" (width: 12 pixels) */
-	0xC, 0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,
+	0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,
 
 	/* Index 53, character 85 "U" (width: 10 pixels) */
-	0xA, 0xFE,0x1F,0x00,0xFE,0x3F,0x00,0x00,0x70,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x70,0x00,0xFE,0x3F,0x00,0xFE,0x1F,0x00,
+	0xFE,0x1F,0x00,0xFE,0x3F,0x00,0x00,0x70,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x70,0x00,0xFE,0x3F,0x00,0xFE,0x1F,0x00,
 
 	/* Index 54, character 86 "V" (width: 10 pixels) */
-	0xA, 0x06,0x00,0x00,0x3E,0x00,0x00,0xFC,0x01,0x00,0xC0,0x1F,0x00,0x00,0x7E,0x00,0x00,0x7C,0x00,0xC0,0x1F,0x00,0xFC,0x01,0x00,0x3E,0x00,0x00,0x06,0x00,0x00,
+	0x06,0x00,0x00,0x3E,0x00,0x00,0xFC,0x01,0x00,0xC0,0x1F,0x00,0x00,0x7E,0x00,0x00,0x7C,0x00,0xC0,0x1F,0x00,0xFC,0x01,0x00,0x3E,0x00,0x00,0x06,0x00,0x00,
 
 	/* Index 55, character 87 "W" (width: 16 pixels) */
-	0x10, 0x06,0x00,0x00,0x7E,0x00,0x00,0xF8,0x07,0x00,0x80,0x7F,0x00,0x00,0x70,0x00,0x00,0x7F,0x00,0xF0,0x07,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0xF8,0x07,0x00,0x00,0x7F,0x00,0x00,0x70,0x00,0x80,0x7F,0x00,0xF8,0x0F,0x00,0x7E,0x00,0x00,0x06,0x00,0x00,
+	0x06,0x00,0x00,0x7E,0x00,0x00,0xF8,0x07,0x00,0x80,0x7F,0x00,0x00,0x70,0x00,0x00,0x7F,0x00,0xF0,0x07,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0xF8,0x07,0x00,0x00,0x7F,0x00,0x00,0x70,0x00,0x80,0x7F,0x00,0xF8,0x0F,0x00,0x7E,0x00,0x00,0x06,0x00,0x00,
 
 	/* Index 56, character 88 "X" (width: 10 pixels) */
-	0xA, 0x02,0x40,0x00,0x0E,0x70,0x00,0x1C,0x38,0x00,0x70,0x0E,0x00,0xE0,0x07,0x00,0xE0,0x07,0x00,0x70,0x0E,0x00,0x1C,0x38,0x00,0x0E,0x70,0x00,0x02,0x40,0x00,
+	0x02,0x40,0x00,0x0E,0x70,0x00,0x1C,0x38,0x00,0x70,0x0E,0x00,0xE0,0x07,0x00,0xE0,0x07,0x00,0x70,0x0E,0x00,0x1C,0x38,0x00,0x0E,0x70,0x00,0x02,0x40,0x00,
 
 	/* Index 57, character 89 "Y" (width: 12 pixels) */
-	0xC, 0x02,0x00,0x00,0x06,0x00,0x00,0x1E,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x00,0xC0,0x7F,0x00,0xC0,0x7F,0x00,0xF0,0x00,0x00,0x38,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,
+	0x02,0x00,0x00,0x06,0x00,0x00,0x1E,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x00,0xC0,0x7F,0x00,0xC0,0x7F,0x00,0xF0,0x00,0x00,0x38,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,
 
 	/* Index 58, character 90 "Z" (width: 9 pixels) */
-	0x9, 0x06,0x70,0x00,0x06,0x78,0x00,0x06,0x6E,0x00,0x06,0x67,0x00,0x86,0x61,0x00,0xE6,0x60,0x00,0x76,0x60,0x00,0x1E,0x60,0x00,0x0E,0x60,0x00,
+	0x06,0x70,0x00,0x06,0x78,0x00,0x06,0x6E,0x00,0x06,0x67,0x00,0x86,0x61,0x00,0xE6,0x60,0x00,0x76,0x60,0x00,0x1E,0x60,0x00,0x0E,0x60,0x00,
 
 	/* Index 59, character 91 "[" (width: 5 pixels) */
-	0x5, 0xFF,0xFF,0x07,0xFF,0xFF,0x07,0x01,0x00,0x04,0x01,0x00,0x04,0x01,0x00,0x04,
+	0xFF,0xFF,0x07,0xFF,0xFF,0x07,0x01,0x00,0x04,0x01,0x00,0x04,0x01,0x00,0x04,
 
 	/* Index 60, character 92 "\" (width: 7 pixels) */
-	0x7, 0x03,0x00,0x00,0x1F,0x00,0x00,0xFC,0x01,0x00,0xE0,0x1F,0x00,0x00,0xFE,0x00,0x00,0xE0,0x03,0x00,0x00,0x03,
+	0x03,0x00,0x00,0x1F,0x00,0x00,0xFC,0x01,0x00,0xE0,0x1F,0x00,0x00,0xFE,0x00,0x00,0xE0,0x03,0x00,0x00,0x03,
 
 	/* Index 61, character 93 "]" (width: 5 pixels) */
-	0x5, 0x01,0x00,0x04,0x01,0x00,0x04,0x01,0x00,0x04,0xFF,0xFF,0x07,0xFF,0xFF,0x07,
+	0x01,0x00,0x04,0x01,0x00,0x04,0x01,0x00,0x04,0xFF,0xFF,0x07,0xFF,0xFF,0x07,
 
 	/* Index 62, character 94 "^" (width: 11 pixels) */
-	0xB, 0x80,0x00,0x00,0xC0,0x00,0x00,0xF0,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x06,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0xF0,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,0x00,
+	0x80,0x00,0x00,0xC0,0x00,0x00,0xF0,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x06,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0xF0,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,0x00,
 
 	/* Index 63, character 95 "_" (width: 10 pixels) */
-	0xA, 0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,
+	0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,
 
 	/* Index 64, character 96 "`" (width: 4 pixels) */
-	0x4, 0x01,0x00,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x04,0x00,0x00,
+	0x01,0x00,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x04,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 8 pixels) */
-	0x8, 0x00,0x3C,0x00,0x60,0x7E,0x00,0x60,0x67,0x00,0x60,0x63,0x00,0x60,0x63,0x00,0x60,0x33,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
+	0x00,0x3C,0x00,0x60,0x7E,0x00,0x60,0x67,0x00,0x60,0x63,0x00,0x60,0x63,0x00,0x60,0x33,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
 
 	/* Index 66, character 98 "b" (width: 9 pixels) */
-	0x9, 0xFF,0x7F,0x00,0xFF,0x7F,0x00,0xC0,0x20,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0xE0,0x70,0x00,0xC0,0x3F,0x00,0x80,0x0F,0x00,
+	0xFF,0x7F,0x00,0xFF,0x7F,0x00,0xC0,0x20,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0xE0,0x70,0x00,0xC0,0x3F,0x00,0x80,0x0F,0x00,
 
 	/* Index 67, character 99 "c" (width: 8 pixels) */
-	0x8, 0x00,0x1F,0x00,0xC0,0x3F,0x00,0xC0,0x70,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0xC0,0x30,0x00,
+	0x00,0x1F,0x00,0xC0,0x3F,0x00,0xC0,0x70,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0xC0,0x30,0x00,
 
 	/* Index 68, character 100 "d" (width: 9 pixels) */
-	0x9, 0x00,0x1F,0x00,0xC0,0x3F,0x00,0xE0,0x70,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x30,0x00,0xFF,0x7F,0x00,0xFF,0x7F,0x00,
+	0x00,0x1F,0x00,0xC0,0x3F,0x00,0xE0,0x70,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x30,0x00,0xFF,0x7F,0x00,0xFF,0x7F,0x00,
 
 	/* Index 69, character 101 "e" (width: 9 pixels) */
-	0x9, 0x80,0x1F,0x00,0xC0,0x3F,0x00,0x60,0x33,0x00,0x60,0x63,0x00,0x60,0x63,0x00,0x60,0x63,0x00,0x60,0x63,0x00,0xC0,0x63,0x00,0x80,0x33,0x00,
+	0x80,0x1F,0x00,0xC0,0x3F,0x00,0x60,0x33,0x00,0x60,0x63,0x00,0x60,0x63,0x00,0x60,0x63,0x00,0x60,0x63,0x00,0xC0,0x63,0x00,0x80,0x33,0x00,
 
 	/* Index 70, character 102 "f" (width: 6 pixels) */
-	0x6, 0x60,0x00,0x00,0xFC,0x7F,0x00,0xFE,0x7F,0x00,0x63,0x00,0x00,0x63,0x00,0x00,0x03,0x00,0x00,
+	0x60,0x00,0x00,0xFC,0x7F,0x00,0xFE,0x7F,0x00,0x63,0x00,0x00,0x63,0x00,0x00,0x03,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 9 pixels) */
-	0x9, 0x00,0x1F,0x00,0xC0,0x3F,0x06,0xE0,0x70,0x06,0x60,0x60,0x06,0x60,0x60,0x06,0x60,0x60,0x06,0x60,0x20,0x07,0xE0,0xFF,0x03,0xE0,0xFF,0x01,
+	0x00,0x1F,0x00,0xC0,0x3F,0x06,0xE0,0x70,0x06,0x60,0x60,0x06,0x60,0x60,0x06,0x60,0x60,0x06,0x60,0x20,0x07,0xE0,0xFF,0x03,0xE0,0xFF,0x01,
 
 	/* Index 72, character 104 "h" (width: 8 pixels) */
-	0x8, 0xFF,0x7F,0x00,0xFF,0x7F,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
+	0xFF,0x7F,0x00,0xFF,0x7F,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
 
 	/* Index 73, character 105 "i" (width: 2 pixels) */
-	0x2, 0xE6,0x7F,0x00,0xE6,0x7F,0x00,
+	0xE6,0x7F,0x00,0xE6,0x7F,0x00,
 
 	/* Index 74, character 106 "j" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0xE6,0xFF,0x03,0xE6,0xFF,0x03,
+	0x00,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0xE6,0xFF,0x03,0xE6,0xFF,0x03,
 
 	/* Index 75, character 107 "k" (width: 8 pixels) */
-	0x8, 0xFF,0x7F,0x00,0xFF,0x7F,0x00,0x00,0x07,0x00,0x80,0x0F,0x00,0xC0,0x3C,0x00,0x60,0x70,0x00,0x20,0x60,0x00,0x00,0x40,0x00,
+	0xFF,0x7F,0x00,0xFF,0x7F,0x00,0x00,0x07,0x00,0x80,0x0F,0x00,0xC0,0x3C,0x00,0x60,0x70,0x00,0x20,0x60,0x00,0x00,0x40,0x00,
 
 	/* Index 76, character 108 "l" (width: 2 pixels) */
-	0x2, 0xFF,0x7F,0x00,0xFF,0x7F,0x00,
+	0xFF,0x7F,0x00,0xFF,0x7F,0x00,
 
 	/* Index 77, character 109 "m" (width: 14 pixels) */
-	0xE, 0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
+	0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
 
 	/* Index 78, character 110 "n" (width: 8 pixels) */
-	0x8, 0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
+	0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,
 
 	/* Index 79, character 111 "o" (width: 9 pixels) */
-	0x9, 0x80,0x1F,0x00,0xC0,0x3F,0x00,0xE0,0x70,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0xE0,0x70,0x00,0xC0,0x3F,0x00,0x80,0x1F,0x00,
+	0x80,0x1F,0x00,0xC0,0x3F,0x00,0xE0,0x70,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0xE0,0x70,0x00,0xC0,0x3F,0x00,0x80,0x1F,0x00,
 
 	/* Index 80, character 112 "p" (width: 9 pixels) */
-	0x9, 0xE0,0xFF,0x07,0xE0,0xFF,0x07,0xC0,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0xE0,0x70,0x00,0xC0,0x3F,0x00,0x80,0x0F,0x00,
+	0xE0,0xFF,0x07,0xE0,0xFF,0x07,0xC0,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0xE0,0x70,0x00,0xC0,0x3F,0x00,0x80,0x0F,0x00,
 
 	/* Index 81, character 113 "q" (width: 9 pixels) */
-	0x9, 0x00,0x1F,0x00,0xC0,0x3F,0x00,0xE0,0x70,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x30,0x00,0xE0,0xFF,0x07,0xE0,0xFF,0x07,
+	0x00,0x1F,0x00,0xC0,0x3F,0x00,0xE0,0x70,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x30,0x00,0xE0,0xFF,0x07,0xE0,0xFF,0x07,
 
 	/* Index 82, character 114 "r" (width: 6 pixels) */
-	0x6, 0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,
+	0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 7 pixels) */
-	0x7, 0xC0,0x33,0x00,0xC0,0x67,0x00,0x60,0x66,0x00,0x60,0x66,0x00,0x60,0x66,0x00,0x60,0x3C,0x00,0xC0,0x3C,0x00,
+	0xC0,0x33,0x00,0xC0,0x67,0x00,0x60,0x66,0x00,0x60,0x66,0x00,0x60,0x66,0x00,0x60,0x3C,0x00,0xC0,0x3C,0x00,
 
 	/* Index 84, character 116 "t" (width: 6 pixels) */
-	0x6, 0x60,0x00,0x00,0xFC,0x3F,0x00,0xFC,0x7F,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,
+	0x60,0x00,0x00,0xFC,0x3F,0x00,0xFC,0x7F,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,
 
 	/* Index 85, character 117 "u" (width: 8 pixels) */
-	0x8, 0xE0,0x3F,0x00,0xE0,0x7F,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x30,0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,
+	0xE0,0x3F,0x00,0xE0,0x7F,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x30,0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,
 
 	/* Index 86, character 118 "v" (width: 8 pixels) */
-	0x8, 0x60,0x00,0x00,0xE0,0x03,0x00,0xC0,0x1F,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0xC0,0x1F,0x00,0xE0,0x03,0x00,0x60,0x00,0x00,
+	0x60,0x00,0x00,0xE0,0x03,0x00,0xC0,0x1F,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0xC0,0x1F,0x00,0xE0,0x03,0x00,0x60,0x00,0x00,
 
 	/* Index 87, character 119 "w" (width: 13 pixels) */
-	0xD, 0x60,0x00,0x00,0xE0,0x07,0x00,0x80,0x7F,0x00,0x00,0x60,0x00,0x00,0x3E,0x00,0xC0,0x03,0x00,0x60,0x00,0x00,0xC0,0x03,0x00,0x00,0x3E,0x00,0x00,0x70,0x00,0x00,0x7F,0x00,0xE0,0x07,0x00,0x60,0x00,0x00,
+	0x60,0x00,0x00,0xE0,0x07,0x00,0x80,0x7F,0x00,0x00,0x60,0x00,0x00,0x3E,0x00,0xC0,0x03,0x00,0x60,0x00,0x00,0xC0,0x03,0x00,0x00,0x3E,0x00,0x00,0x70,0x00,0x00,0x7F,0x00,0xE0,0x07,0x00,0x60,0x00,0x00,
 
 	/* Index 88, character 120 "x" (width: 8 pixels) */
-	0x8, 0x20,0x40,0x00,0xE0,0x70,0x00,0xC0,0x39,0x00,0x80,0x1F,0x00,0x80,0x1F,0x00,0xC0,0x39,0x00,0xE0,0x70,0x00,0x20,0x40,0x00,
+	0x20,0x40,0x00,0xE0,0x70,0x00,0xC0,0x39,0x00,0x80,0x1F,0x00,0x80,0x1F,0x00,0xC0,0x39,0x00,0xE0,0x70,0x00,0x20,0x40,0x00,
 
 	/* Index 89, character 121 "y" (width: 8 pixels) */
-	0x8, 0x60,0x00,0x00,0xE0,0x03,0x04,0xC0,0x9F,0x07,0x00,0xFE,0x03,0x00,0x7C,0x00,0xC0,0x0F,0x00,0xE0,0x01,0x00,0x20,0x00,0x00,
+	0x60,0x00,0x00,0xE0,0x03,0x04,0xC0,0x9F,0x07,0x00,0xFE,0x03,0x00,0x7C,0x00,0xC0,0x0F,0x00,0xE0,0x01,0x00,0x20,0x00,0x00,
 
 	/* Index 90, character 122 "z" (width: 7 pixels) */
-	0x7, 0x60,0x60,0x00,0x60,0x78,0x00,0x60,0x7C,0x00,0x60,0x66,0x00,0xE0,0x63,0x00,0xE0,0x61,0x00,0x60,0x60,0x00,
+	0x60,0x60,0x00,0x60,0x78,0x00,0x60,0x7C,0x00,0x60,0x66,0x00,0xE0,0x63,0x00,0xE0,0x61,0x00,0x60,0x60,0x00,
 
 	/* Index 91, character 123 "{" (width: 8 pixels) */
-	0x8, 0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x05,0x00,0xFC,0xFD,0x01,0xFE,0xF8,0x03,0x03,0x00,0x06,0x01,0x00,0x04,0x01,0x00,0x04,
+	0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x05,0x00,0xFC,0xFD,0x01,0xFE,0xF8,0x03,0x03,0x00,0x06,0x01,0x00,0x04,0x01,0x00,0x04,
 
 	/* Index 92, character 124 "|" (width: 2 pixels) */
-	0x2, 0xFF,0xFF,0x07,0xFF,0xFF,0x07,
+	0xFF,0xFF,0x07,0xFF,0xFF,0x07,
 
 	/* Index 93, character 125 "}" (width: 8 pixels) */
-	0x8, 0x01,0x00,0x04,0x01,0x00,0x04,0x03,0x00,0x06,0xFE,0xF8,0x03,0xFC,0xFD,0x01,0x00,0x05,0x00,0x00,0x02,0x00,0x00,0x02,0x00,
+	0x01,0x00,0x04,0x01,0x00,0x04,0x03,0x00,0x06,0xFE,0xF8,0x03,0xFC,0xFD,0x01,0x00,0x05,0x00,0x00,0x02,0x00,0x00,0x02,0x00,
 
 	/* Index 94, character 126 "~" (width: 12 pixels) */
-	0xC, 0x00,0x07,0x00,0x80,0x07,0x00,0xC0,0x01,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x80,0x01,0x00,0x00,0x03,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x07,0x00,0xC0,0x03,0x00,0xC0,0x01,0x00
+	0x00,0x07,0x00,0x80,0x07,0x00,0xC0,0x01,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x80,0x01,0x00,0x00,0x03,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x07,0x00,0xC0,0x03,0x00,0xC0,0x01,0x00
 };
+
+// Offset of each bitmap in Tahoma14_bitmaps
+const unsigned short Tahoma14_offsets[] = 
+{
+	0x0,	// Index 0
+	0x6,	// Index 1
+	0xC,	// Index 2
+	0x1B,	// Index 3
+	0x3C,	// Index 4
+	0x54,	// Index 5
+	0x87,	// Index 6
+	0xAE,	// Index 7
+	0xB4,	// Index 8
+	0xC6,	// Index 9
+	0xD8,	// Index 10
+	0xF3,	// Index 11
+	0x117,	// Index 12
+	0x123,	// Index 13
+	0x132,	// Index 14
+	0x138,	// Index 15
+	0x14D,	// Index 16
+	0x168,	// Index 17
+	0x180,	// Index 18
+	0x19B,	// Index 19
+	0x1B3,	// Index 20
+	0x1D1,	// Index 21
+	0x1E9,	// Index 22
+	0x204,	// Index 23
+	0x21F,	// Index 24
+	0x23A,	// Index 25
+	0x255,	// Index 26
+	0x25B,	// Index 27
+	0x267,	// Index 28
+	0x285,	// Index 29
+	0x2A3,	// Index 30
+	0x2C1,	// Index 31
+	0x2D6,	// Index 32
+	0x303,	// Index 33
+	0x324,	// Index 34
+	0x33F,	// Index 35
+	0x35D,	// Index 36
+	0x37E,	// Index 37
+	0x399,	// Index 38
+	0x3B4,	// Index 39
+	0x3D8,	// Index 40
+	0x3F6,	// Index 41
+	0x408,	// Index 42
+	0x41D,	// Index 43
+	0x43B,	// Index 44
+	0x453,	// Index 45
+	0x477,	// Index 46
+	0x495,	// Index 47
+	0x4B9,	// Index 48
+	0x4D4,	// Index 49
+	0x4F8,	// Index 50
+	0x519,	// Index 51
+	0x537,	// Index 52
+	0x55B,	// Index 53
+	0x579,	// Index 54
+	0x597,	// Index 55
+	0x5C7,	// Index 56
+	0x5E5,	// Index 57
+	0x609,	// Index 58
+	0x624,	// Index 59
+	0x633,	// Index 60
+	0x648,	// Index 61
+	0x657,	// Index 62
+	0x678,	// Index 63
+	0x696,	// Index 64
+	0x6A2,	// Index 65
+	0x6BA,	// Index 66
+	0x6D5,	// Index 67
+	0x6ED,	// Index 68
+	0x708,	// Index 69
+	0x723,	// Index 70
+	0x735,	// Index 71
+	0x750,	// Index 72
+	0x768,	// Index 73
+	0x76E,	// Index 74
+	0x77D,	// Index 75
+	0x795,	// Index 76
+	0x79B,	// Index 77
+	0x7C5,	// Index 78
+	0x7DD,	// Index 79
+	0x7F8,	// Index 80
+	0x813,	// Index 81
+	0x82E,	// Index 82
+	0x840,	// Index 83
+	0x855,	// Index 84
+	0x867,	// Index 85
+	0x87F,	// Index 86
+	0x897,	// Index 87
+	0x8BE,	// Index 88
+	0x8D6,	// Index 89
+	0x8EE,	// Index 90
+	0x903,	// Index 91
+	0x91B,	// Index 92
+	0x921,	// Index 93
+	0x939,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Tahoma14_widths[] = 
+{
+	0x2,	// Index 0
+	0x2,	// Index 1
+	0x5,	// Index 2
+	0xB,	// Index 3
+	0x8,	// Index 4
+	0x11,	// Index 5
+	0xD,	// Index 6
+	0x2,	// Index 7
+	0x6,	// Index 8
+	0x6,	// Index 9
+	0x9,	// Index 10
+	0xC,	// Index 11
+	0x4,	// Index 12
+	0x5,	// Index 13
+	0x2,	// Index 14
+	0x7,	// Index 15
+	0x9,	// Index 16
+	0x8,	// Index 17
+	0x9,	// Index 18
+	0x8,	// Index 19
+	0xA,	// Index 20
+	0x8,	// Index 21
+	0x9,	// Index 22
+	0x9,	// Index 23
+	0x9,	// Index 24
+	0x9,	// Index 25
+	0x2,	// Index 26
+	0x4,	// Index 27
+	0xA,	// Index 28
+	0xA,	// Index 29
+	0xA,	// Index 30
+	0x7,	// Index 31
+	0xF,	// Index 32
+	0xB,	// Index 33
+	0x9,	// Index 34
+	0xA,	// Index 35
+	0xB,	// Index 36
+	0x9,	// Index 37
+	0x9,	// Index 38
+	0xC,	// Index 39
+	0xA,	// Index 40
+	0x6,	// Index 41
+	0x7,	// Index 42
+	0xA,	// Index 43
+	0x8,	// Index 44
+	0xC,	// Index 45
+	0xA,	// Index 46
+	0xC,	// Index 47
+	0x9,	// Index 48
+	0xC,	// Index 49
+	0xB,	// Index 50
+	0xA,	// Index 51
+	0xC,	// Index 52
+	0xA,	// Index 53
+	0xA,	// Index 54
+	0x10,	// Index 55
+	0xA,	// Index 56
+	0xC,	// Index 57
+	0x9,	// Index 58
+	0x5,	// Index 59
+	0x7,	// Index 60
+	0x5,	// Index 61
+	0xB,	// Index 62
+	0xA,	// Index 63
+	0x4,	// Index 64
+	0x8,	// Index 65
+	0x9,	// Index 66
+	0x8,	// Index 67
+	0x9,	// Index 68
+	0x9,	// Index 69
+	0x6,	// Index 70
+	0x9,	// Index 71
+	0x8,	// Index 72
+	0x2,	// Index 73
+	0x5,	// Index 74
+	0x8,	// Index 75
+	0x2,	// Index 76
+	0xE,	// Index 77
+	0x8,	// Index 78
+	0x9,	// Index 79
+	0x9,	// Index 80
+	0x9,	// Index 81
+	0x6,	// Index 82
+	0x7,	// Index 83
+	0x6,	// Index 84
+	0x8,	// Index 85
+	0x8,	// Index 86
+	0xD,	// Index 87
+	0x8,	// Index 88
+	0x8,	// Index 89
+	0x7,	// Index 90
+	0x8,	// Index 91
+	0x2,	// Index 92
+	0x8,	// Index 93
+	0xC,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Tahoma14_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0xE, 0x0,	// Index 1
+	0xF, 0x0,	// Index 2
+	0xE, 0x0,	// Index 3
+	0xF, 0x3,	// Index 4
+	0xE, 0x0,	// Index 5
+	0xE, 0x0,	// Index 6
+	0xF, 0x0,	// Index 7
+	0xF, 0x4,	// Index 8
+	0xF, 0x4,	// Index 9
+	0xF, 0x0,	// Index 10
+	0xC, 0x0,	// Index 11
+	0x3, 0x3,	// Index 12
+	0x7, 0x0,	// Index 13
+	0x3, 0x0,	// Index 14
+	0xF, 0x3,	// Index 15
+	0xE, 0x0,	// Index 16
+	0xE, 0x0,	// Index 17
+	0xE, 0x0,	// Index 18
+	0xE, 0x0,	// Index 19
+	0xE, 0x0,	// Index 20
+	0xE, 0x0,	// Index 21
+	0xE, 0x0,	// Index 22
+	0xE, 0x0,	// Index 23
+	0xE, 0x0,	// Index 24
+	0xE, 0x0,	// Index 25
+	0xA, 0x0,	// Index 26
+	0xA, 0x3,	// Index 27
+	0xC, 0x0,	// Index 28
+	0x9, 0x0,	// Index 29
+	0xC, 0x0,	// Index 30
+	0xE, 0x0,	// Index 31
+	0xE, 0x2,	// Index 32
+	0xE, 0x0,	// Index 33
+	0xE, 0x0,	// Index 34
+	0xE, 0x0,	// Index 35
+	0xE, 0x0,	// Index 36
+	0xE, 0x0,	// Index 37
+	0xE, 0x0,	// Index 38
+	0xE, 0x0,	// Index 39
+	0xE, 0x0,	// Index 40
+	0xE, 0x0,	// Index 41
+	0xE, 0x0,	// Index 42
+	0xE, 0x0,	// Index 43
+	0xE, 0x0,	// Index 44
+	0xE, 0x0,	// Index 45
+	0xE, 0x0,	// Index 46
+	0xE, 0x0,	// Index 47
+	0xE, 0x0,	// Index 48
+	0xE, 0x4,	// Index 49
+	0xE, 0x0,	// Index 50
+	0xE, 0x0,	// Index 51
+	0xE, 0x0,	// Index 52
+	0xE, 0x0,	// Index 53
+	0xE, 0x0,	// Index 54
+	0xE, 0x0,	// Index 55
+	0xE, 0x0,	// Index 56
+	0xE, 0x0,	// Index 57
+	0xE, 0x0,	// Index 58
+	0xF, 0x4,	// Index 59
+	0xF, 0x3,	// Index 60
+	0xF, 0x4,	// Index 61
+	0xE, 0x0,	// Index 62
+	0x0, 0x3,	// Index 63
+	0xF, 0x0,	// Index 64
+	0xA, 0x0,	// Index 65
+	0xF, 0x0,	// Index 66
+	0xA, 0x0,	// Index 67
+	0xF, 0x0,	// Index 68
+	0xA, 0x0,	// Index 69
+	0xF, 0x0,	// Index 70
+	0xA, 0x4,	// Index 71
+	0xF, 0x0,	// Index 72
+	0xE, 0x0,	// Index 73
+	0xE, 0x4,	// Index 74
+	0xF, 0x0,	// Index 75
+	0xF, 0x0,	// Index 76
+	0xA, 0x0,	// Index 77
+	0xA, 0x0,	// Index 78
+	0xA, 0x0,	// Index 79
+	0xA, 0x4,	// Index 80
+	0xA, 0x4,	// Index 81
+	0xA, 0x0,	// Index 82
+	0xA, 0x0,	// Index 83
+	0xD, 0x0,	// Index 84
+	0xA, 0x0,	// Index 85
+	0xA, 0x0,	// Index 86
+	0xA, 0x0,	// Index 87
+	0xA, 0x0,	// Index 88
+	0xA, 0x4,	// Index 89
+	0xA, 0x0,	// Index 90
+	0xF, 0x4,	// Index 91
+	0xF, 0x4,	// Index 92
+	0xF, 0x4,	// Index 93
+	0x9, 0x0,	// Index 94
+};
+
+const font_t Tahoma14 = 
+{
+	Tahoma14_bitmaps,
+	Tahoma14_offsets,
+	Tahoma14_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x13,	// Height 
+	0,	// Flags 
+	Tahoma14_extents,
+	0xF	// Ascent 
+};
+
 //---------------------------------------------------------------
 // Group Name: Tahoma12
 // Designer: Imported System Font
@@ -1235,398 +1864,607 @@ const unsigned char Tahoma14[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Tahoma12[] = 
+const unsigned char Tahoma12_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x10,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xC8, // Index 1 (offset: 200)
-	0x0, 0xCB, // Index 2 (offset: 203)
-	0x0, 0xD4, // Index 3 (offset: 212)
-	0x0, 0xEB, // Index 4 (offset: 235)
-	0x0, 0xFA, // Index 5 (offset: 250)
-	0x1, 0x17, // Index 6 (offset: 279)
-	0x1, 0x2C, // Index 7 (offset: 300)
-	0x1, 0x2F, // Index 8 (offset: 303)
-	0x1, 0x38, // Index 9 (offset: 312)
-	0x1, 0x41, // Index 10 (offset: 321)
-	0x1, 0x50, // Index 11 (offset: 336)
-	0x1, 0x63, // Index 12 (offset: 355)
-	0x1, 0x68, // Index 13 (offset: 360)
-	0x1, 0x73, // Index 14 (offset: 371)
-	0x1, 0x76, // Index 15 (offset: 374)
-	0x1, 0x83, // Index 16 (offset: 387)
-	0x1, 0x94, // Index 17 (offset: 404)
-	0x1, 0x9F, // Index 18 (offset: 415)
-	0x1, 0xAE, // Index 19 (offset: 430)
-	0x1, 0xBD, // Index 20 (offset: 445)
-	0x1, 0xCE, // Index 21 (offset: 462)
-	0x1, 0xDD, // Index 22 (offset: 477)
-	0x1, 0xEE, // Index 23 (offset: 494)
-	0x1, 0xFD, // Index 24 (offset: 509)
-	0x2, 0xE, // Index 25 (offset: 526)
-	0x2, 0x1F, // Index 26 (offset: 543)
-	0x2, 0x22, // Index 27 (offset: 546)
-	0x2, 0x27, // Index 28 (offset: 551)
-	0x2, 0x38, // Index 29 (offset: 568)
-	0x2, 0x4B, // Index 30 (offset: 587)
-	0x2, 0x5C, // Index 31 (offset: 604)
-	0x2, 0x69, // Index 32 (offset: 617)
-	0x2, 0x84, // Index 33 (offset: 644)
-	0x2, 0x99, // Index 34 (offset: 665)
-	0x2, 0xAA, // Index 35 (offset: 682)
-	0x2, 0xBD, // Index 36 (offset: 701)
-	0x2, 0xD2, // Index 37 (offset: 722)
-	0x2, 0xE3, // Index 38 (offset: 739)
-	0x2, 0xF2, // Index 39 (offset: 754)
-	0x3, 0x7, // Index 40 (offset: 775)
-	0x3, 0x1C, // Index 41 (offset: 796)
-	0x3, 0x23, // Index 42 (offset: 803)
-	0x3, 0x30, // Index 43 (offset: 816)
-	0x3, 0x41, // Index 44 (offset: 833)
-	0x3, 0x50, // Index 45 (offset: 848)
-	0x3, 0x67, // Index 46 (offset: 871)
-	0x3, 0x7C, // Index 47 (offset: 892)
-	0x3, 0x93, // Index 48 (offset: 915)
-	0x3, 0xA4, // Index 49 (offset: 932)
-	0x3, 0xBB, // Index 50 (offset: 955)
-	0x3, 0xCE, // Index 51 (offset: 974)
-	0x3, 0xDF, // Index 52 (offset: 991)
-	0x3, 0xF2, // Index 53 (offset: 1010)
-	0x4, 0x7, // Index 54 (offset: 1031)
-	0x4, 0x1A, // Index 55 (offset: 1050)
-	0x4, 0x35, // Index 56 (offset: 1077)
-	0x4, 0x46, // Index 57 (offset: 1094)
-	0x4, 0x59, // Index 58 (offset: 1113)
-	0x4, 0x6A, // Index 59 (offset: 1130)
-	0x4, 0x73, // Index 60 (offset: 1139)
-	0x4, 0x80, // Index 61 (offset: 1152)
-	0x4, 0x89, // Index 62 (offset: 1161)
-	0x4, 0x9E, // Index 63 (offset: 1182)
-	0x4, 0xB1, // Index 64 (offset: 1201)
-	0x4, 0xB6, // Index 65 (offset: 1206)
-	0x4, 0xC5, // Index 66 (offset: 1221)
-	0x4, 0xD6, // Index 67 (offset: 1238)
-	0x4, 0xE3, // Index 68 (offset: 1251)
-	0x4, 0xF4, // Index 69 (offset: 1268)
-	0x5, 0x3, // Index 70 (offset: 1283)
-	0x5, 0xE, // Index 71 (offset: 1294)
-	0x5, 0x1F, // Index 72 (offset: 1311)
-	0x5, 0x30, // Index 73 (offset: 1328)
-	0x5, 0x33, // Index 74 (offset: 1331)
-	0x5, 0x3C, // Index 75 (offset: 1340)
-	0x5, 0x4B, // Index 76 (offset: 1355)
-	0x5, 0x4E, // Index 77 (offset: 1358)
-	0x5, 0x65, // Index 78 (offset: 1381)
-	0x5, 0x76, // Index 79 (offset: 1398)
-	0x5, 0x87, // Index 80 (offset: 1415)
-	0x5, 0x98, // Index 81 (offset: 1432)
-	0x5, 0xA9, // Index 82 (offset: 1449)
-	0x5, 0xB4, // Index 83 (offset: 1460)
-	0x5, 0xC1, // Index 84 (offset: 1473)
-	0x5, 0xCC, // Index 85 (offset: 1484)
-	0x5, 0xDD, // Index 86 (offset: 1501)
-	0x5, 0xEC, // Index 87 (offset: 1516)
-	0x6, 0x3, // Index 88 (offset: 1539)
-	0x6, 0x12, // Index 89 (offset: 1554)
-	0x6, 0x21, // Index 90 (offset: 1569)
-	0x6, 0x2E, // Index 91 (offset: 1582)
-	0x6, 0x3D, // Index 92 (offset: 1597)
-	0x6, 0x40, // Index 93 (offset: 1600)
-	0x6, 0x4F, // Index 94 (offset: 1615)
-
 	/* Index 0, character 32 " " (width: 2 pixels) */
-	0x2, 0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 1 pixels) */
-	0x1, 0xFE,0x1B,
+	0xFE,0x1B,
 
 	/* Index 2, character 34 """ (width: 4 pixels) */
-	0x4, 0x1F,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,
+	0x1F,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,
 
 	/* Index 3, character 35 "#" (width: 11 pixels) */
-	0xB, 0x00,0x02,0x10,0x1A,0x90,0x07,0x78,0x02,0x16,0x02,0x10,0x02,0x10,0x1A,0x90,0x07,0x78,0x02,0x16,0x02,0x10,0x00,
+	0x00,0x02,0x10,0x1A,0x90,0x07,0x78,0x02,0x16,0x02,0x10,0x02,0x10,0x1A,0x90,0x07,0x78,0x02,0x16,0x02,0x10,0x00,
 
 	/* Index 4, character 36 "$" (width: 7 pixels) */
-	0x7, 0x70,0x08,0x88,0x10,0x88,0x10,0xFE,0xFF,0x08,0x11,0x08,0x11,0x10,0x0E,
+	0x70,0x08,0x88,0x10,0x88,0x10,0xFE,0xFF,0x08,0x11,0x08,0x11,0x10,0x0E,
 
 	/* Index 5, character 37 "%" (width: 14 pixels) */
-	0xE, 0x7C,0x00,0x82,0x00,0x82,0x00,0x82,0x10,0x82,0x0C,0x7C,0x02,0x80,0x01,0x60,0x00,0x90,0x0F,0x4C,0x10,0x42,0x10,0x40,0x10,0x40,0x10,0x80,0x0F,
+	0x7C,0x00,0x82,0x00,0x82,0x00,0x82,0x10,0x82,0x0C,0x7C,0x02,0x80,0x01,0x60,0x00,0x90,0x0F,0x4C,0x10,0x42,0x10,0x40,0x10,0x40,0x10,0x80,0x0F,
 
 	/* Index 6, character 38 "&" (width: 10 pixels) */
-	0xA, 0x00,0x07,0x9C,0x08,0x62,0x10,0x42,0x10,0xC2,0x10,0x22,0x11,0x1C,0x0A,0x00,0x06,0xC0,0x09,0x00,0x10,
+	0x00,0x07,0x9C,0x08,0x62,0x10,0x42,0x10,0xC2,0x10,0x22,0x11,0x1C,0x0A,0x00,0x06,0xC0,0x09,0x00,0x10,
 
 	/* Index 7, character 39 "'" (width: 1 pixels) */
-	0x1, 0x1F,0x00,
+	0x1F,0x00,
 
 	/* Index 8, character 40 "(" (width: 4 pixels) */
-	0x4, 0xF0,0x0F,0x0C,0x30,0x02,0x40,0x01,0x80,
+	0xF0,0x0F,0x0C,0x30,0x02,0x40,0x01,0x80,
 
 	/* Index 9, character 41 ")" (width: 4 pixels) */
-	0x4, 0x01,0x80,0x02,0x40,0x0C,0x30,0xF0,0x0F,
+	0x01,0x80,0x02,0x40,0x0C,0x30,0xF0,0x0F,
 
 	/* Index 10, character 42 "*" (width: 7 pixels) */
-	0x7, 0x22,0x00,0x14,0x00,0x08,0x00,0x7F,0x00,0x08,0x00,0x14,0x00,0x22,0x00,
+	0x22,0x00,0x14,0x00,0x08,0x00,0x7F,0x00,0x08,0x00,0x14,0x00,0x22,0x00,
 
 	/* Index 11, character 43 "+" (width: 9 pixels) */
-	0x9, 0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xF8,0x0F,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
+	0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xF8,0x0F,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
 
 	/* Index 12, character 44 "," (width: 2 pixels) */
-	0x2, 0x00,0xC0,0x00,0x38,
+	0x00,0xC0,0x00,0x38,
 
 	/* Index 13, character 45 "-" (width: 5 pixels) */
-	0x5, 0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
+	0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
 
 	/* Index 14, character 46 "." (width: 1 pixels) */
-	0x1, 0x00,0x18,
+	0x00,0x18,
 
 	/* Index 15, character 47 "/" (width: 6 pixels) */
-	0x6, 0x00,0xC0,0x00,0x38,0x00,0x07,0xE0,0x00,0x1C,0x00,0x03,0x00,
+	0x00,0xC0,0x00,0x38,0x00,0x07,0xE0,0x00,0x1C,0x00,0x03,0x00,
 
 	/* Index 16, character 48 "0" (width: 8 pixels) */
-	0x8, 0xF8,0x07,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,0xF8,0x07,
+	0xF8,0x07,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,0xF8,0x07,
 
 	/* Index 17, character 49 "1" (width: 5 pixels) */
-	0x5, 0x08,0x10,0x08,0x10,0xFE,0x1F,0x00,0x10,0x00,0x10,
+	0x08,0x10,0x08,0x10,0xFE,0x1F,0x00,0x10,0x00,0x10,
 
 	/* Index 18, character 50 "2" (width: 7 pixels) */
-	0x7, 0x04,0x18,0x02,0x14,0x02,0x12,0x02,0x11,0x82,0x10,0x44,0x10,0x38,0x10,
+	0x04,0x18,0x02,0x14,0x02,0x12,0x02,0x11,0x82,0x10,0x44,0x10,0x38,0x10,
 
 	/* Index 19, character 51 "3" (width: 7 pixels) */
-	0x7, 0x04,0x08,0x02,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0xA4,0x08,0x18,0x07,
+	0x04,0x08,0x02,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0xA4,0x08,0x18,0x07,
 
 	/* Index 20, character 52 "4" (width: 8 pixels) */
-	0x8, 0x80,0x01,0x40,0x01,0x20,0x01,0x10,0x01,0x08,0x01,0x04,0x01,0xFE,0x1F,0x00,0x01,
+	0x80,0x01,0x40,0x01,0x20,0x01,0x10,0x01,0x08,0x01,0x04,0x01,0xFE,0x1F,0x00,0x01,
 
 	/* Index 21, character 53 "5" (width: 7 pixels) */
-	0x7, 0x3E,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x42,0x08,0x82,0x07,
+	0x3E,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x42,0x08,0x82,0x07,
 
 	/* Index 22, character 54 "6" (width: 8 pixels) */
-	0x8, 0xF0,0x07,0x48,0x08,0x24,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x42,0x08,0x80,0x07,
+	0xF0,0x07,0x48,0x08,0x24,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x42,0x08,0x80,0x07,
 
 	/* Index 23, character 55 "7" (width: 7 pixels) */
-	0x7, 0x02,0x00,0x02,0x18,0x02,0x06,0x82,0x01,0x62,0x00,0x1A,0x00,0x06,0x00,
+	0x02,0x00,0x02,0x18,0x02,0x06,0x82,0x01,0x62,0x00,0x1A,0x00,0x06,0x00,
 
 	/* Index 24, character 56 "8" (width: 8 pixels) */
-	0x8, 0x18,0x07,0xA4,0x08,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0xA4,0x08,0x18,0x07,
+	0x18,0x07,0xA4,0x08,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0xA4,0x08,0x18,0x07,
 
 	/* Index 25, character 57 "9" (width: 8 pixels) */
-	0x8, 0x78,0x00,0x84,0x10,0x02,0x11,0x02,0x11,0x02,0x11,0x02,0x09,0x84,0x04,0xF8,0x03,
+	0x78,0x00,0x84,0x10,0x02,0x11,0x02,0x11,0x02,0x11,0x02,0x09,0x84,0x04,0xF8,0x03,
 
 	/* Index 26, character 58 ":" (width: 1 pixels) */
-	0x1, 0x30,0x18,
+	0x30,0x18,
 
 	/* Index 27, character 59 ";" (width: 2 pixels) */
-	0x2, 0x00,0xC0,0x30,0x38,
+	0x00,0xC0,0x30,0x38,
 
 	/* Index 28, character 60 "<" (width: 8 pixels) */
-	0x8, 0x80,0x00,0x40,0x01,0x40,0x01,0x20,0x02,0x20,0x02,0x10,0x04,0x10,0x04,0x08,0x08,
+	0x80,0x00,0x40,0x01,0x40,0x01,0x20,0x02,0x20,0x02,0x10,0x04,0x10,0x04,0x08,0x08,
 
 	/* Index 29, character 61 "=" (width: 9 pixels) */
-	0x9, 0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,
+	0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,
 
 	/* Index 30, character 62 ">" (width: 8 pixels) */
-	0x8, 0x08,0x08,0x10,0x04,0x10,0x04,0x20,0x02,0x20,0x02,0x40,0x01,0x40,0x01,0x80,0x00,
+	0x08,0x08,0x10,0x04,0x10,0x04,0x20,0x02,0x20,0x02,0x40,0x01,0x40,0x01,0x80,0x00,
 
 	/* Index 31, character 63 "?" (width: 6 pixels) */
-	0x6, 0x04,0x00,0x02,0x00,0x02,0x1B,0x82,0x00,0x44,0x00,0x38,0x00,
+	0x04,0x00,0x02,0x00,0x02,0x1B,0x82,0x00,0x44,0x00,0x38,0x00,
 
 	/* Index 32, character 64 "@" (width: 13 pixels) */
-	0xD, 0xE0,0x07,0x18,0x18,0x04,0x20,0xC4,0x23,0x22,0x44,0x12,0x48,0x12,0x48,0x12,0x48,0x12,0x44,0xF4,0x0F,0x04,0x08,0x18,0x08,0xE0,0x07,
+	0xE0,0x07,0x18,0x18,0x04,0x20,0xC4,0x23,0x22,0x44,0x12,0x48,0x12,0x48,0x12,0x48,0x12,0x44,0xF4,0x0F,0x04,0x08,0x18,0x08,0xE0,0x07,
 
 	/* Index 33, character 65 "A" (width: 10 pixels) */
-	0xA, 0x00,0x18,0x00,0x07,0xE0,0x01,0x1C,0x01,0x02,0x01,0x02,0x01,0x1C,0x01,0xE0,0x01,0x00,0x07,0x00,0x18,
+	0x00,0x18,0x00,0x07,0xE0,0x01,0x1C,0x01,0x02,0x01,0x02,0x01,0x1C,0x01,0xE0,0x01,0x00,0x07,0x00,0x18,
 
 	/* Index 34, character 66 "B" (width: 8 pixels) */
-	0x8, 0xFE,0x1F,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x62,0x10,0x9C,0x08,0x00,0x07,
+	0xFE,0x1F,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x62,0x10,0x9C,0x08,0x00,0x07,
 
 	/* Index 35, character 67 "C" (width: 9 pixels) */
-	0x9, 0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,
+	0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,
 
 	/* Index 36, character 68 "D" (width: 10 pixels) */
-	0xA, 0xFE,0x1F,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,0x04,0x08,0x18,0x06,0xE0,0x01,
+	0xFE,0x1F,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,0x04,0x08,0x18,0x06,0xE0,0x01,
 
 	/* Index 37, character 69 "E" (width: 8 pixels) */
-	0x8, 0xFE,0x1F,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,
+	0xFE,0x1F,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,
 
 	/* Index 38, character 70 "F" (width: 7 pixels) */
-	0x7, 0xFE,0x1F,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,
+	0xFE,0x1F,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,
 
 	/* Index 39, character 71 "G" (width: 10 pixels) */
-	0xA, 0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x84,0x0F,
+	0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x84,0x0F,
 
 	/* Index 40, character 72 "H" (width: 10 pixels) */
-	0xA, 0xFE,0x1F,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0xFE,0x1F,
+	0xFE,0x1F,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0xFE,0x1F,
 
 	/* Index 41, character 73 "I" (width: 3 pixels) */
-	0x3, 0x02,0x10,0xFE,0x1F,0x02,0x10,
+	0x02,0x10,0xFE,0x1F,0x02,0x10,
 
 	/* Index 42, character 74 "J" (width: 6 pixels) */
-	0x6, 0x00,0x10,0x00,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0xFE,0x0F,
+	0x00,0x10,0x00,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0xFE,0x0F,
 
 	/* Index 43, character 75 "K" (width: 8 pixels) */
-	0x8, 0xFE,0x1F,0x80,0x00,0xC0,0x00,0x20,0x01,0x10,0x02,0x08,0x04,0x04,0x08,0x02,0x10,
+	0xFE,0x1F,0x80,0x00,0xC0,0x00,0x20,0x01,0x10,0x02,0x08,0x04,0x04,0x08,0x02,0x10,
 
 	/* Index 44, character 76 "L" (width: 7 pixels) */
-	0x7, 0xFE,0x1F,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,
+	0xFE,0x1F,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,
 
 	/* Index 45, character 77 "M" (width: 11 pixels) */
-	0xB, 0xFE,0x1F,0x06,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0x00,0x02,0x80,0x01,0x60,0x00,0x18,0x00,0x06,0x00,0xFE,0x1F,
+	0xFE,0x1F,0x06,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0x00,0x02,0x80,0x01,0x60,0x00,0x18,0x00,0x06,0x00,0xFE,0x1F,
 
 	/* Index 46, character 78 "N" (width: 10 pixels) */
-	0xA, 0xFE,0x1F,0x04,0x00,0x08,0x00,0x30,0x00,0x40,0x00,0x80,0x00,0x00,0x03,0x00,0x04,0x00,0x08,0xFE,0x1F,
+	0xFE,0x1F,0x04,0x00,0x08,0x00,0x30,0x00,0x40,0x00,0x80,0x00,0x00,0x03,0x00,0x04,0x00,0x08,0xFE,0x1F,
 
 	/* Index 47, character 79 "O" (width: 11 pixels) */
-	0xB, 0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,0x0C,0x0C,0xF0,0x03,
+	0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,0x0C,0x0C,0xF0,0x03,
 
 	/* Index 48, character 80 "P" (width: 8 pixels) */
-	0x8, 0xFE,0x1F,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
+	0xFE,0x1F,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
 
 	/* Index 49, character 81 "Q" (width: 11 pixels) */
-	0xB, 0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x70,0x02,0x90,0x04,0x88,0x0C,0x8C,0xF0,0x83,
+	0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x70,0x02,0x90,0x04,0x88,0x0C,0x8C,0xF0,0x83,
 
 	/* Index 50, character 82 "R" (width: 9 pixels) */
-	0x9, 0xFE,0x1F,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x01,0x42,0x02,0x3C,0x04,0x00,0x08,0x00,0x10,
+	0xFE,0x1F,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x01,0x42,0x02,0x3C,0x04,0x00,0x08,0x00,0x10,
 
 	/* Index 51, character 83 "S" (width: 8 pixels) */
-	0x8, 0x38,0x08,0x44,0x10,0x42,0x10,0x42,0x10,0x82,0x10,0x82,0x10,0x82,0x08,0x04,0x07,
+	0x38,0x08,0x44,0x10,0x42,0x10,0x42,0x10,0x82,0x10,0x82,0x10,0x82,0x08,0x04,0x07,
 
 	/* Index 52, character 84 "T" (width: 9 pixels) */
-	0x9, 0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0xFE,0x1F,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
+	0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0xFE,0x1F,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
 
 	/* Index 53, character 85 "U" (width: 10 pixels) */
-	0xA, 0xFE,0x07,0x00,0x08,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x08,0xFE,0x07,
+	0xFE,0x07,0x00,0x08,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x08,0xFE,0x07,
 
 	/* Index 54, character 86 "V" (width: 9 pixels) */
-	0x9, 0x06,0x00,0x38,0x00,0xC0,0x01,0x00,0x0E,0x00,0x10,0x00,0x0E,0xC0,0x01,0x38,0x00,0x06,0x00,
+	0x06,0x00,0x38,0x00,0xC0,0x01,0x00,0x0E,0x00,0x10,0x00,0x0E,0xC0,0x01,0x38,0x00,0x06,0x00,
 
 	/* Index 55, character 87 "W" (width: 13 pixels) */
-	0xD, 0x06,0x00,0xF8,0x00,0x00,0x0F,0x00,0x18,0x80,0x07,0x7C,0x00,0x02,0x00,0x7C,0x00,0x80,0x07,0x00,0x18,0x00,0x0F,0xF8,0x00,0x06,0x00,
+	0x06,0x00,0xF8,0x00,0x00,0x0F,0x00,0x18,0x80,0x07,0x7C,0x00,0x02,0x00,0x7C,0x00,0x80,0x07,0x00,0x18,0x00,0x0F,0xF8,0x00,0x06,0x00,
 
 	/* Index 56, character 88 "X" (width: 8 pixels) */
-	0x8, 0x02,0x10,0x0C,0x0C,0x10,0x02,0xE0,0x01,0xE0,0x01,0x10,0x02,0x0C,0x0C,0x02,0x10,
+	0x02,0x10,0x0C,0x0C,0x10,0x02,0xE0,0x01,0xE0,0x01,0x10,0x02,0x0C,0x0C,0x02,0x10,
 
 	/* Index 57, character 89 "Y" (width: 9 pixels) */
-	0x9, 0x02,0x00,0x0C,0x00,0x10,0x00,0x60,0x00,0x80,0x1F,0x60,0x00,0x10,0x00,0x0C,0x00,0x02,0x00,
+	0x02,0x00,0x0C,0x00,0x10,0x00,0x60,0x00,0x80,0x1F,0x60,0x00,0x10,0x00,0x0C,0x00,0x02,0x00,
 
 	/* Index 58, character 90 "Z" (width: 8 pixels) */
-	0x8, 0x02,0x18,0x02,0x14,0x02,0x13,0x82,0x10,0x42,0x10,0x32,0x10,0x0A,0x10,0x06,0x10,
+	0x02,0x18,0x02,0x14,0x02,0x13,0x82,0x10,0x42,0x10,0x32,0x10,0x0A,0x10,0x06,0x10,
 
 	/* Index 59, character 91 "[" (width: 4 pixels) */
-	0x4, 0xFF,0xFF,0x01,0x80,0x01,0x80,0x01,0x80,
+	0xFF,0xFF,0x01,0x80,0x01,0x80,0x01,0x80,
 
 	/* Index 60, character 92 "\" (width: 6 pixels) */
-	0x6, 0x03,0x00,0x1C,0x00,0xE0,0x00,0x00,0x07,0x00,0x38,0x00,0xC0,
+	0x03,0x00,0x1C,0x00,0xE0,0x00,0x00,0x07,0x00,0x38,0x00,0xC0,
 
 	/* Index 61, character 93 "]" (width: 4 pixels) */
-	0x4, 0x01,0x80,0x01,0x80,0x01,0x80,0xFF,0xFF,
+	0x01,0x80,0x01,0x80,0x01,0x80,0xFF,0xFF,
 
 	/* Index 62, character 94 "^" (width: 10 pixels) */
-	0xA, 0x40,0x00,0x20,0x00,0x10,0x00,0x0C,0x00,0x02,0x00,0x02,0x00,0x0C,0x00,0x10,0x00,0x20,0x00,0x40,0x00,
+	0x40,0x00,0x20,0x00,0x10,0x00,0x0C,0x00,0x02,0x00,0x02,0x00,0x0C,0x00,0x10,0x00,0x20,0x00,0x40,0x00,
 
 	/* Index 63, character 95 "_" (width: 9 pixels) */
-	0x9, 0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,
+	0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,
 
 	/* Index 64, character 96 "`" (width: 2 pixels) */
-	0x2, 0x03,0x00,0x04,0x00,
+	0x03,0x00,0x04,0x00,
 
 	/* Index 65, character 97 "a" (width: 7 pixels) */
-	0x7, 0x00,0x0E,0x20,0x11,0x90,0x10,0x90,0x10,0x90,0x10,0x90,0x08,0xE0,0x1F,
+	0x00,0x0E,0x20,0x11,0x90,0x10,0x90,0x10,0x90,0x10,0x90,0x08,0xE0,0x1F,
 
 	/* Index 66, character 98 "b" (width: 8 pixels) */
-	0x8, 0xFF,0x1F,0x20,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xC0,0x07,
+	0xFF,0x1F,0x20,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xC0,0x07,
 
 	/* Index 67, character 99 "c" (width: 6 pixels) */
-	0x6, 0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,
+	0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,
 
 	/* Index 68, character 100 "d" (width: 8 pixels) */
-	0x8, 0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x08,0xFF,0x1F,
+	0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x08,0xFF,0x1F,
 
 	/* Index 69, character 101 "e" (width: 7 pixels) */
-	0x7, 0xC0,0x07,0x20,0x09,0x10,0x11,0x10,0x11,0x10,0x11,0x20,0x11,0xC0,0x09,
+	0xC0,0x07,0x20,0x09,0x10,0x11,0x10,0x11,0x10,0x11,0x20,0x11,0xC0,0x09,
 
 	/* Index 70, character 102 "f" (width: 5 pixels) */
-	0x5, 0x10,0x00,0xFE,0x1F,0x11,0x00,0x11,0x00,0x01,0x00,
+	0x10,0x00,0xFE,0x1F,0x11,0x00,0x11,0x00,0x01,0x00,
 
 	/* Index 71, character 103 "g" (width: 8 pixels) */
-	0x8, 0xC0,0x07,0x20,0x48,0x10,0x90,0x10,0x90,0x10,0x90,0x10,0x90,0x10,0x48,0xF0,0x3F,
+	0xC0,0x07,0x20,0x48,0x10,0x90,0x10,0x90,0x10,0x90,0x10,0x90,0x10,0x48,0xF0,0x3F,
 
 	/* Index 72, character 104 "h" (width: 8 pixels) */
-	0x8, 0xFF,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0xC0,0x1F,
+	0xFF,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0xC0,0x1F,
 
 	/* Index 73, character 105 "i" (width: 1 pixels) */
-	0x1, 0xF6,0x1F,
+	0xF6,0x1F,
 
 	/* Index 74, character 106 "j" (width: 4 pixels) */
-	0x4, 0x00,0x80,0x10,0x80,0x10,0x80,0xF6,0x7F,
+	0x00,0x80,0x10,0x80,0x10,0x80,0xF6,0x7F,
 
 	/* Index 75, character 107 "k" (width: 7 pixels) */
-	0x7, 0xFF,0x1F,0x00,0x01,0x80,0x01,0x40,0x02,0x20,0x04,0x10,0x08,0x00,0x10,
+	0xFF,0x1F,0x00,0x01,0x80,0x01,0x40,0x02,0x20,0x04,0x10,0x08,0x00,0x10,
 
 	/* Index 76, character 108 "l" (width: 1 pixels) */
-	0x1, 0xFF,0x1F,
+	0xFF,0x1F,
 
 	/* Index 77, character 109 "m" (width: 11 pixels) */
-	0xB, 0xF0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xE0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xE0,0x1F,
+	0xF0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xE0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xE0,0x1F,
 
 	/* Index 78, character 110 "n" (width: 8 pixels) */
-	0x8, 0xF0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0xC0,0x1F,
+	0xF0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0xC0,0x1F,
 
 	/* Index 79, character 111 "o" (width: 8 pixels) */
-	0x8, 0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xC0,0x07,
+	0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xC0,0x07,
 
 	/* Index 80, character 112 "p" (width: 8 pixels) */
-	0x8, 0xF0,0xFF,0x20,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xC0,0x07,
+	0xF0,0xFF,0x20,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xC0,0x07,
 
 	/* Index 81, character 113 "q" (width: 8 pixels) */
-	0x8, 0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x08,0xF0,0xFF,
+	0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x08,0xF0,0xFF,
 
 	/* Index 82, character 114 "r" (width: 5 pixels) */
-	0x5, 0xF0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,
+	0xF0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,
 
 	/* Index 83, character 115 "s" (width: 6 pixels) */
-	0x6, 0xE0,0x08,0x10,0x11,0x10,0x11,0x10,0x11,0x10,0x11,0x20,0x0E,
+	0xE0,0x08,0x10,0x11,0x10,0x11,0x10,0x11,0x10,0x11,0x20,0x0E,
 
 	/* Index 84, character 116 "t" (width: 5 pixels) */
-	0x5, 0x10,0x00,0xFE,0x0F,0x10,0x10,0x10,0x10,0x10,0x10,
+	0x10,0x00,0xFE,0x0F,0x10,0x10,0x10,0x10,0x10,0x10,
 
 	/* Index 85, character 117 "u" (width: 8 pixels) */
-	0x8, 0xF0,0x07,0x00,0x08,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x08,0xF0,0x1F,
+	0xF0,0x07,0x00,0x08,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x08,0xF0,0x1F,
 
 	/* Index 86, character 118 "v" (width: 7 pixels) */
-	0x7, 0x30,0x00,0xC0,0x01,0x00,0x06,0x00,0x18,0x00,0x06,0xC0,0x01,0x30,0x00,
+	0x30,0x00,0xC0,0x01,0x00,0x06,0x00,0x18,0x00,0x06,0xC0,0x01,0x30,0x00,
 
 	/* Index 87, character 119 "w" (width: 11 pixels) */
-	0xB, 0x30,0x00,0xC0,0x03,0x00,0x1C,0x00,0x06,0xC0,0x01,0x30,0x00,0xC0,0x01,0x00,0x06,0x00,0x1C,0xC0,0x03,0x30,0x00,
+	0x30,0x00,0xC0,0x03,0x00,0x1C,0x00,0x06,0xC0,0x01,0x30,0x00,0xC0,0x01,0x00,0x06,0x00,0x1C,0xC0,0x03,0x30,0x00,
 
 	/* Index 88, character 120 "x" (width: 7 pixels) */
-	0x7, 0x10,0x10,0x20,0x08,0xC0,0x06,0x00,0x01,0xC0,0x06,0x20,0x08,0x10,0x10,
+	0x10,0x10,0x20,0x08,0xC0,0x06,0x00,0x01,0xC0,0x06,0x20,0x08,0x10,0x10,
 
 	/* Index 89, character 121 "y" (width: 7 pixels) */
-	0x7, 0x30,0x00,0xC0,0x01,0x00,0xE6,0x00,0x18,0x00,0x06,0xC0,0x01,0x30,0x00,
+	0x30,0x00,0xC0,0x01,0x00,0xE6,0x00,0x18,0x00,0x06,0xC0,0x01,0x30,0x00,
 
 	/* Index 90, character 122 "z" (width: 6 pixels) */
-	0x6, 0x10,0x18,0x10,0x14,0x10,0x13,0x90,0x10,0x50,0x10,0x30,0x10,
+	0x10,0x18,0x10,0x14,0x10,0x13,0x90,0x10,0x50,0x10,0x30,0x10,
 
 	/* Index 91, character 123 "{" (width: 7 pixels) */
-	0x7, 0x80,0x00,0x80,0x00,0x40,0x01,0x3E,0x7E,0x01,0x80,0x01,0x80,0x01,0x80,
+	0x80,0x00,0x80,0x00,0x40,0x01,0x3E,0x7E,0x01,0x80,0x01,0x80,0x01,0x80,
 
 	/* Index 92, character 124 "|" (width: 1 pixels) */
-	0x1, 0xFF,0xFF,
+	0xFF,0xFF,
 
 	/* Index 93, character 125 "}" (width: 7 pixels) */
-	0x7, 0x01,0x80,0x01,0x80,0x01,0x80,0x3E,0x7E,0x40,0x01,0x80,0x00,0x80,0x00,
+	0x01,0x80,0x01,0x80,0x01,0x80,0x3E,0x7E,0x40,0x01,0x80,0x00,0x80,0x00,
 
 	/* Index 94, character 126 "~" (width: 10 pixels) */
-	0xA, 0x00,0x03,0x80,0x00,0x40,0x00,0x40,0x00,0x80,0x00,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x01,0xC0,0x00
+	0x00,0x03,0x80,0x00,0x40,0x00,0x40,0x00,0x80,0x00,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x01,0xC0,0x00
+};
+
+// Offset of each bitmap in Tahoma12_bitmaps
+const unsigned short Tahoma12_offsets[] = 
+{
+	0x0,	// Index 0
+	0x4,	// Index 1
+	0x6,	// Index 2
+	0xE,	// Index 3
+	0x24,	// Index 4
+	0x32,	// Index 5
+	0x4E,	// Index 6
+	0x62,	// Index 7
+	0x64,	// Index 8
+	0x6C,	// Index 9
+	0x74,	// Index 10
+	0x82,	// Index 11
+	0x94,	// Index 12
+	0x98,	// Index 13
+	0xA2,	// Index 14
+	0xA4,	// Index 15
+	0xB0,	// Index 16
+	0xC0,	// Index 17
+	0xCA,	// Index 18
+	0xD8,	// Index 19
+	0xE6,	// Index 20
+	0xF6,	// Index 21
+	0x104,	// Index 22
+	0x114,	// Index 23
+	0x122,	// Index 24
+	0x132,	// Index 25
+	0x142,	// Index 26
+	0x144,	// Index 27
+	0x148,	// Index 28
+	0x158,	// Index 29
+	0x16A,	// Index 30
+	0x17A,	// Index 31
+	0x186,	// Index 32
+	0x1A0,	// Index 33
+	0x1B4,	// Index 34
+	0x1C4,	// Index 35
+	0x1D6,	// Index 36
+	0x1EA,	// Index 37
+	0x1FA,	// Index 38
+	0x208,	// Index 39
+	0x21C,	// Index 40
+	0x230,	// Index 41
+	0x236,	// Index 42
+	0x242,	// Index 43
+	0x252,	// Index 44
+	0x260,	// Index 45
+	0x276,	// Index 46
+	0x28A,	// Index 47
+	0x2A0,	// Index 48
+	0x2B0,	// Index 49
+	0x2C6,	// Index 50
+	0x2D8,	// Index 51
+	0x2E8,	// Index 52
+	0x2FA,	// Index 53
+	0x30E,	// Index 54
+	0x320,	// Index 55
+	0x33A,	// Index 56
+	0x34A,	// Index 57
+	0x35C,	// Index 58
+	0x36C,	// Index 59
+	0x374,	// Index 60
+	0x380,	// Index 61
+	0x388,	// Index 62
+	0x39C,	// Index 63
+	0x3AE,	// Index 64
+	0x3B2,	// Index 65
+	0x3C0,	// Index 66
+	0x3D0,	// Index 67
+	0x3DC,	// Index 68
+	0x3EC,	// Index 69
+	0x3FA,	// Index 70
+	0x404,	// Index 71
+	0x414,	// Index 72
+	0x424,	// Index 73
+	0x426,	// Index 74
+	0x42E,	// Index 75
+	0x43C,	// Index 76
+	0x43E,	// Index 77
+	0x454,	// Index 78
+	0x464,	// Index 79
+	0x474,	// Index 80
+	0x484,	// Index 81
+	0x494,	// Index 82
+	0x49E,	// Index 83
+	0x4AA,	// Index 84
+	0x4B4,	// Index 85
+	0x4C4,	// Index 86
+	0x4D2,	// Index 87
+	0x4E8,	// Index 88
+	0x4F6,	// Index 89
+	0x504,	// Index 90
+	0x510,	// Index 91
+	0x51E,	// Index 92
+	0x520,	// Index 93
+	0x52E,	// Index 94
 };
+
+// Width of each bitmap in pixels
+const unsigned char Tahoma12_widths[] = 
+{
+	0x2,	// Index 0
+	0x1,	// Index 1
+	0x4,	// Index 2
+	0xB,	// Index 3
+	0x7,	// Index 4
+	0xE,	// Index 5
+	0xA,	// Index 6
+	0x1,	// Index 7
+	0x4,	// Index 8
+	0x4,	// Index 9
+	0x7,	// Index 10
+	0x9,	// Index 11
+	0x2,	// Index 12
+	0x5,	// Index 13
+	0x1,	// Index 14
+	0x6,	// Index 15
+	0x8,	// Index 16
+	0x5,	// Index 17
+	0x7,	// Index 18
+	0x7,	// Index 19
+	0x8,	// Index 20
+	0x7,	// Index 21
+	0x8,	// Index 22
+	0x7,	// Index 23
+	0x8,	// Index 24
+	0x8,	// Index 25
+	0x1,	// Index 26
+	0x2,	// Index 27
+	0x8,	// Index 28
+	0x9,	// Index 29
+	0x8,	// Index 30
+	0x6,	// Index 31
+	0xD,	// Index 32
+	0xA,	// Index 33
+	0x8,	// Index 34
+	0x9,	// Index 35
+	0xA,	// Index 36
+	0x8,	// Index 37
+	0x7,	// Index 38
+	0xA,	// Index 39
+	0xA,	// Index 40
+	0x3,	// Index 41
+	0x6,	// Index 42
+	0x8,	// Index 43
+	0x7,	// Index 44
+	0xB,	// Index 45
+	0xA,	// Index 46
+	0xB,	// Index 47
+	0x8,	// Index 48
+	0xB,	// Index 49
+	0x9,	// Index 50
+	0x8,	// Index 51
+	0x9,	// Index 52
+	0xA,	// Index 53
+	0x9,	// Index 54
+	0xD,	// Index 55
+	0x8,	// Index 56
+	0x9,	// Index 57
+	0x8,	// Index 58
+	0x4,	// Index 59
+	0x6,	// Index 60
+	0x4,	// Index 61
+	0xA,	// Index 62
+	0x9,	// Index 63
+	0x2,	// Index 64
+	0x7,	// Index 65
+	0x8,	// Index 66
+	0x6,	// Index 67
+	0x8,	// Index 68
+	0x7,	// Index 69
+	0x5,	// Index 70
+	0x8,	// Index 71
+	0x8,	// Index 72
+	0x1,	// Index 73
+	0x4,	// Index 74
+	0x7,	// Index 75
+	0x1,	// Index 76
+	0xB,	// Index 77
+	0x8,	// Index 78
+	0x8,	// Index 79
+	0x8,	// Index 80
+	0x8,	// Index 81
+	0x5,	// Index 82
+	0x6,	// Index 83
+	0x5,	// Index 84
+	0x8,	// Index 85
+	0x7,	// Index 86
+	0xB,	// Index 87
+	0x7,	// Index 88
+	0x7,	// Index 89
+	0x6,	// Index 90
+	0x7,	// Index 91
+	0x1,	// Index 92
+	0x7,	// Index 93
+	0xA,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Tahoma12_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0xC, 0x0,	// Index 1
+	0xD, 0x0,	// Index 2
+	0xC, 0x0,	// Index 3
+	0xC, 0x3,	// Index 4
+	0xC, 0x0,	// Index 5
+	0xC, 0x0,	// Index 6
+	0xD, 0x0,	// Index 7
+	0xD, 0x3,	// Index 8
+	0xD, 0x3,	// Index 9
+	0xD, 0x0,	// Index 10
+	0xA, 0x0,	// Index 11
+	0x2, 0x3,	// Index 12
+	0x6, 0x0,	// Index 13
+	0x2, 0x0,	// Index 14
+	0xD, 0x3,	// Index 15
+	0xC, 0x0,	// Index 16
+	0xC, 0x0,	// Index 17
+	0xC, 0x0,	// Index 18
+	0xC, 0x0,	// Index 19
+	0xC, 0x0,	// Index 20
+	0xC, 0x0,	// Index 21
+	0xC, 0x0,	// Index 22
+	0xC, 0x0,	// Index 23
+	0xC, 0x0,	// Index 24
+	0xC, 0x0,	// Index 25
+	0x9, 0x0,	// Index 26
+	0x9, 0x3,	// Index 27
+	0xA, 0x0,	// Index 28
+	0x7, 0x0,	// Index 29
+	0xA, 0x0,	// Index 30
+	0xC, 0x0,	// Index 31
+	0xC, 0x2,	// Index 32
+	0xC, 0x0,	// Index 33
+	0xC, 0x0,	// Index 34
+	0xC, 0x0,	// Index 35
+	0xC, 0x0,	// Index 36
+	0xC, 0x0,	// Index 37
+	0xC, 0x0,	// Index 38
+	0xC, 0x0,	// Index 39
+	0xC, 0x0,	// Index 40
+	0xC, 0x0,	// Index 41
+	0xC, 0x0,	// Index 42
+	0xC, 0x0,	// Index 43
+	0xC, 0x0,	// Index 44
+	0xC, 0x0,	// Index 45
+	0xC, 0x0,	// Index 46
+	0xC, 0x0,	// Index 47
+	0xC, 0x0,	// Index 48
+	0xC, 0x3,	// Index 49
+	0xC, 0x0,	// Index 50
+	0xC, 0x0,	// Index 51
+	0xC, 0x0,	// Index 52
+	0xC, 0x0,	// Index 53
+	0xC, 0x0,	// Index 54
+	0xC, 0x0,	// Index 55
+	0xC, 0x0,	// Index 56
+	0xC, 0x0,	// Index 57
+	0xC, 0x0,	// Index 58
+	0xD, 0x3,	// Index 59
+	0xD, 0x3,	// Index 60
+	0xD, 0x3,	// Index 61
+	0xC, 0x0,	// Index 62
+	0x0, 0x2,	// Index 63
+	0xD, 0x0,	// Index 64
+	0x9, 0x0,	// Index 65
+	0xD, 0x0,	// Index 66
+	0x9, 0x0,	// Index 67
+	0xD, 0x0,	// Index 68
+	0x9, 0x0,	// Index 69
+	0xD, 0x0,	// Index 70
+	0x9, 0x3,	// Index 71
+	0xD, 0x0,	// Index 72
+	0xC, 0x0,	// Index 73
+	0xC, 0x3,	// Index 74
+	0xD, 0x0,	// Index 75
+	0xD, 0x0,	// Index 76
+	0x9, 0x0,	// Index 77
+	0x9, 0x0,	// Index 78
+	0x9, 0x0,	// Index 79
+	0x9, 0x3,	// Index 80
+	0x9, 0x3,	// Index 81
+	0x9, 0x0,	// Index 82
+	0x9, 0x0,	// Index 83
+	0xC, 0x0,	// Index 84
+	0x9, 0x0,	// Index 85
+	0x9, 0x0,	// Index 86
+	0x9, 0x0,	// Index 87
+	0x9, 0x0,	// Index 88
+	0x9, 0x3,	// Index 89
+	0x9, 0x0,	// Index 90
+	0xD, 0x3,	// Index 91
+	0xD, 0x3,	// Index 92
+	0xD, 0x3,	// Index 93
+	0x7, 0x0,	// Index 94
+};
+
+const font_t Tahoma12 = 
+{
+	Tahoma12_bitmaps,
+	Tahoma12_offsets,
+	Tahoma12_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x10,	// Height 
+	0,	// Flags 
+	Tahoma12_extents,
+	0xD	// Ascent 
+};
+
 //---------------------------------------------------------------
 // Group Name: Tahoma8
 // Designer: Imported System Font
@@ -1640,398 +2478,607 @@ const unsigned char Tahoma12[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Tahoma8[] = 
+const unsigned char Tahoma8_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0xB,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xC8, // Index 1 (offset: 200)
-	0x0, 0xCB, // Index 2 (offset: 203)
-	0x0, 0xD2, // Index 3 (offset: 210)
-	0x0, 0xE1, // Index 4 (offset: 225)
-	0x0, 0xEC, // Index 5 (offset: 236)
-	0x1, 0x1, // Index 6 (offset: 257)
-	0x1, 0x10, // Index 7 (offset: 272)
-	0x1, 0x13, // Index 8 (offset: 275)
-	0x1, 0x1A, // Index 9 (offset: 282)
-	0x1, 0x21, // Index 10 (offset: 289)
-	0x1, 0x2C, // Index 11 (offset: 300)
-	0x1, 0x3B, // Index 12 (offset: 315)
-	0x1, 0x40, // Index 13 (offset: 320)
-	0x1, 0x47, // Index 14 (offset: 327)
-	0x1, 0x4A, // Index 15 (offset: 330)
-	0x1, 0x51, // Index 16 (offset: 337)
-	0x1, 0x5C, // Index 17 (offset: 348)
-	0x1, 0x63, // Index 18 (offset: 355)
-	0x1, 0x6E, // Index 19 (offset: 366)
-	0x1, 0x79, // Index 20 (offset: 377)
-	0x1, 0x84, // Index 21 (offset: 388)
-	0x1, 0x8F, // Index 22 (offset: 399)
-	0x1, 0x9A, // Index 23 (offset: 410)
-	0x1, 0xA5, // Index 24 (offset: 421)
-	0x1, 0xB0, // Index 25 (offset: 432)
-	0x1, 0xBB, // Index 26 (offset: 443)
-	0x1, 0xBE, // Index 27 (offset: 446)
-	0x1, 0xC3, // Index 28 (offset: 451)
-	0x1, 0xD0, // Index 29 (offset: 464)
-	0x1, 0xDF, // Index 30 (offset: 479)
-	0x1, 0xEC, // Index 31 (offset: 492)
-	0x1, 0xF5, // Index 32 (offset: 501)
-	0x2, 0x8, // Index 33 (offset: 520)
-	0x2, 0x15, // Index 34 (offset: 533)
-	0x2, 0x20, // Index 35 (offset: 544)
-	0x2, 0x2D, // Index 36 (offset: 557)
-	0x2, 0x3A, // Index 37 (offset: 570)
-	0x2, 0x45, // Index 38 (offset: 581)
-	0x2, 0x50, // Index 39 (offset: 592)
-	0x2, 0x5D, // Index 40 (offset: 605)
-	0x2, 0x6A, // Index 41 (offset: 618)
-	0x2, 0x71, // Index 42 (offset: 625)
-	0x2, 0x7A, // Index 43 (offset: 634)
-	0x2, 0x85, // Index 44 (offset: 645)
-	0x2, 0x8E, // Index 45 (offset: 654)
-	0x2, 0x9D, // Index 46 (offset: 669)
-	0x2, 0xAA, // Index 47 (offset: 682)
-	0x2, 0xB9, // Index 48 (offset: 697)
-	0x2, 0xC4, // Index 49 (offset: 708)
-	0x2, 0xD3, // Index 50 (offset: 723)
-	0x2, 0xE0, // Index 51 (offset: 736)
-	0x2, 0xEB, // Index 52 (offset: 747)
-	0x2, 0xF6, // Index 53 (offset: 758)
-	0x3, 0x3, // Index 54 (offset: 771)
-	0x3, 0xE, // Index 55 (offset: 782)
-	0x3, 0x21, // Index 56 (offset: 801)
-	0x3, 0x2C, // Index 57 (offset: 812)
-	0x3, 0x37, // Index 58 (offset: 823)
-	0x3, 0x42, // Index 59 (offset: 834)
-	0x3, 0x49, // Index 60 (offset: 841)
-	0x3, 0x50, // Index 61 (offset: 848)
-	0x3, 0x57, // Index 62 (offset: 855)
-	0x3, 0x66, // Index 63 (offset: 870)
-	0x3, 0x73, // Index 64 (offset: 883)
-	0x3, 0x78, // Index 65 (offset: 888)
-	0x3, 0x83, // Index 66 (offset: 899)
-	0x3, 0x8E, // Index 67 (offset: 910)
-	0x3, 0x97, // Index 68 (offset: 919)
-	0x3, 0xA2, // Index 69 (offset: 930)
-	0x3, 0xAD, // Index 70 (offset: 941)
-	0x3, 0xB4, // Index 71 (offset: 948)
-	0x3, 0xBF, // Index 72 (offset: 959)
-	0x3, 0xCA, // Index 73 (offset: 970)
-	0x3, 0xCD, // Index 74 (offset: 973)
-	0x3, 0xD2, // Index 75 (offset: 978)
-	0x3, 0xDD, // Index 76 (offset: 989)
-	0x3, 0xE0, // Index 77 (offset: 992)
-	0x3, 0xEF, // Index 78 (offset: 1007)
-	0x3, 0xFA, // Index 79 (offset: 1018)
-	0x4, 0x5, // Index 80 (offset: 1029)
-	0x4, 0x10, // Index 81 (offset: 1040)
-	0x4, 0x1B, // Index 82 (offset: 1051)
-	0x4, 0x22, // Index 83 (offset: 1058)
-	0x4, 0x2B, // Index 84 (offset: 1067)
-	0x4, 0x32, // Index 85 (offset: 1074)
-	0x4, 0x3D, // Index 86 (offset: 1085)
-	0x4, 0x48, // Index 87 (offset: 1096)
-	0x4, 0x57, // Index 88 (offset: 1111)
-	0x4, 0x62, // Index 89 (offset: 1122)
-	0x4, 0x6D, // Index 90 (offset: 1133)
-	0x4, 0x76, // Index 91 (offset: 1142)
-	0x4, 0x7F, // Index 92 (offset: 1151)
-	0x4, 0x82, // Index 93 (offset: 1154)
-	0x4, 0x8B, // Index 94 (offset: 1163)
-
 	/* Index 0, character 32 " " (width: 2 pixels) */
-	0x2, 0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 1 pixels) */
-	0x1, 0x7E,0x01,
+	0x7E,0x01,
 
 	/* Index 2, character 34 """ (width: 3 pixels) */
-	0x3, 0x07,0x00,0x00,0x00,0x07,0x00,
+	0x07,0x00,0x00,0x00,0x07,0x00,
 
 	/* Index 3, character 35 "#" (width: 7 pixels) */
-	0x7, 0x40,0x00,0xC8,0x01,0x78,0x00,0xCE,0x01,0x78,0x00,0x4E,0x00,0x08,0x00,
+	0x40,0x00,0xC8,0x01,0x78,0x00,0xCE,0x01,0x78,0x00,0x4E,0x00,0x08,0x00,
 
 	/* Index 4, character 36 "$" (width: 5 pixels) */
-	0x5, 0x18,0x01,0x24,0x01,0xFF,0x07,0x24,0x01,0xC4,0x00,
+	0x18,0x01,0x24,0x01,0xFF,0x07,0x24,0x01,0xC4,0x00,
 
 	/* Index 5, character 37 "%" (width: 10 pixels) */
-	0xA, 0x0C,0x00,0x12,0x00,0x12,0x00,0x8C,0x01,0x60,0x00,0x18,0x00,0xC6,0x00,0x20,0x01,0x20,0x01,0xC0,0x00,
+	0x0C,0x00,0x12,0x00,0x12,0x00,0x8C,0x01,0x60,0x00,0x18,0x00,0xC6,0x00,0x20,0x01,0x20,0x01,0xC0,0x00,
 
 	/* Index 6, character 38 "&" (width: 7 pixels) */
-	0x7, 0xEC,0x00,0x12,0x01,0x12,0x01,0x2C,0x01,0xC0,0x00,0xB0,0x00,0x00,0x01,
+	0xEC,0x00,0x12,0x01,0x12,0x01,0x2C,0x01,0xC0,0x00,0xB0,0x00,0x00,0x01,
 
 	/* Index 7, character 39 "'" (width: 1 pixels) */
-	0x1, 0x07,0x00,
+	0x07,0x00,
 
 	/* Index 8, character 40 "(" (width: 3 pixels) */
-	0x3, 0xF8,0x00,0x06,0x03,0x01,0x04,
+	0xF8,0x00,0x06,0x03,0x01,0x04,
 
 	/* Index 9, character 41 ")" (width: 3 pixels) */
-	0x3, 0x01,0x04,0x06,0x03,0xF8,0x00,
+	0x01,0x04,0x06,0x03,0xF8,0x00,
 
 	/* Index 10, character 42 "*" (width: 5 pixels) */
-	0x5, 0x0A,0x00,0x04,0x00,0x1F,0x00,0x04,0x00,0x0A,0x00,
+	0x0A,0x00,0x04,0x00,0x1F,0x00,0x04,0x00,0x0A,0x00,
 
 	/* Index 11, character 43 "+" (width: 7 pixels) */
-	0x7, 0x20,0x00,0x20,0x00,0x20,0x00,0xFC,0x01,0x20,0x00,0x20,0x00,0x20,0x00,
+	0x20,0x00,0x20,0x00,0x20,0x00,0xFC,0x01,0x20,0x00,0x20,0x00,0x20,0x00,
 
 	/* Index 12, character 44 "," (width: 2 pixels) */
-	0x2, 0x00,0x04,0x80,0x03,
+	0x00,0x04,0x80,0x03,
 
 	/* Index 13, character 45 "-" (width: 3 pixels) */
-	0x3, 0x20,0x00,0x20,0x00,0x20,0x00,
+	0x20,0x00,0x20,0x00,0x20,0x00,
 
 	/* Index 14, character 46 "." (width: 1 pixels) */
-	0x1, 0x80,0x01,
+	0x80,0x01,
 
 	/* Index 15, character 47 "/" (width: 3 pixels) */
-	0x3, 0x00,0x07,0xF8,0x00,0x07,0x00,
+	0x00,0x07,0xF8,0x00,0x07,0x00,
 
 	/* Index 16, character 48 "0" (width: 5 pixels) */
-	0x5, 0xFC,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0xFC,0x00,
+	0xFC,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0xFC,0x00,
 
 	/* Index 17, character 49 "1" (width: 3 pixels) */
-	0x3, 0x04,0x01,0xFE,0x01,0x00,0x01,
+	0x04,0x01,0xFE,0x01,0x00,0x01,
 
 	/* Index 18, character 50 "2" (width: 5 pixels) */
-	0x5, 0x84,0x01,0x42,0x01,0x22,0x01,0x12,0x01,0x0C,0x01,
+	0x84,0x01,0x42,0x01,0x22,0x01,0x12,0x01,0x0C,0x01,
 
 	/* Index 19, character 51 "3" (width: 5 pixels) */
-	0x5, 0x84,0x00,0x02,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
+	0x84,0x00,0x02,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
 
 	/* Index 20, character 52 "4" (width: 5 pixels) */
-	0x5, 0x30,0x00,0x28,0x00,0x24,0x00,0xFE,0x01,0x20,0x00,
+	0x30,0x00,0x28,0x00,0x24,0x00,0xFE,0x01,0x20,0x00,
 
 	/* Index 21, character 53 "5" (width: 5 pixels) */
-	0x5, 0x9E,0x00,0x12,0x01,0x12,0x01,0x12,0x01,0xE2,0x00,
+	0x9E,0x00,0x12,0x01,0x12,0x01,0x12,0x01,0xE2,0x00,
 
 	/* Index 22, character 54 "6" (width: 5 pixels) */
-	0x5, 0xF8,0x00,0x14,0x01,0x12,0x01,0x12,0x01,0xE0,0x00,
+	0xF8,0x00,0x14,0x01,0x12,0x01,0x12,0x01,0xE0,0x00,
 
 	/* Index 23, character 55 "7" (width: 5 pixels) */
-	0x5, 0x02,0x00,0x82,0x01,0x62,0x00,0x1A,0x00,0x06,0x00,
+	0x02,0x00,0x82,0x01,0x62,0x00,0x1A,0x00,0x06,0x00,
 
 	/* Index 24, character 56 "8" (width: 5 pixels) */
-	0x5, 0xEC,0x00,0x12,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
+	0xEC,0x00,0x12,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
 
 	/* Index 25, character 57 "9" (width: 5 pixels) */
-	0x5, 0x1C,0x00,0x22,0x01,0x22,0x01,0xA2,0x00,0x7C,0x00,
+	0x1C,0x00,0x22,0x01,0x22,0x01,0xA2,0x00,0x7C,0x00,
 
 	/* Index 26, character 58 ":" (width: 1 pixels) */
-	0x1, 0x98,0x01,
+	0x98,0x01,
 
 	/* Index 27, character 59 ";" (width: 2 pixels) */
-	0x2, 0x00,0x04,0x98,0x03,
+	0x00,0x04,0x98,0x03,
 
 	/* Index 28, character 60 "<" (width: 6 pixels) */
-	0x6, 0x20,0x00,0x50,0x00,0x50,0x00,0x88,0x00,0x88,0x00,0x04,0x01,
+	0x20,0x00,0x50,0x00,0x50,0x00,0x88,0x00,0x88,0x00,0x04,0x01,
 
 	/* Index 29, character 61 "=" (width: 7 pixels) */
-	0x7, 0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,
+	0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,
 
 	/* Index 30, character 62 ">" (width: 6 pixels) */
-	0x6, 0x04,0x01,0x88,0x00,0x88,0x00,0x50,0x00,0x50,0x00,0x20,0x00,
+	0x04,0x01,0x88,0x00,0x88,0x00,0x50,0x00,0x50,0x00,0x20,0x00,
 
 	/* Index 31, character 63 "?" (width: 4 pixels) */
-	0x4, 0x02,0x00,0x62,0x01,0x12,0x00,0x0C,0x00,
+	0x02,0x00,0x62,0x01,0x12,0x00,0x0C,0x00,
 
 	/* Index 32, character 64 "@" (width: 9 pixels) */
-	0x9, 0xF8,0x00,0x04,0x01,0x72,0x02,0x8A,0x02,0x8A,0x02,0xFA,0x02,0x82,0x00,0x84,0x00,0x78,0x00,
+	0xF8,0x00,0x04,0x01,0x72,0x02,0x8A,0x02,0x8A,0x02,0xFA,0x02,0x82,0x00,0x84,0x00,0x78,0x00,
 
 	/* Index 33, character 65 "A" (width: 6 pixels) */
-	0x6, 0xC0,0x01,0x78,0x00,0x46,0x00,0x46,0x00,0x78,0x00,0xC0,0x01,
+	0xC0,0x01,0x78,0x00,0x46,0x00,0x46,0x00,0x78,0x00,0xC0,0x01,
 
 	/* Index 34, character 66 "B" (width: 5 pixels) */
-	0x5, 0xFE,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
+	0xFE,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
 
 	/* Index 35, character 67 "C" (width: 6 pixels) */
-	0x6, 0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
+	0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,
 
 	/* Index 36, character 68 "D" (width: 6 pixels) */
-	0x6, 0xFE,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
+	0xFE,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
 
 	/* Index 37, character 69 "E" (width: 5 pixels) */
-	0x5, 0xFE,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x02,0x01,
+	0xFE,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x02,0x01,
 
 	/* Index 38, character 70 "F" (width: 5 pixels) */
-	0x5, 0xFE,0x01,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,
+	0xFE,0x01,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,
 
 	/* Index 39, character 71 "G" (width: 6 pixels) */
-	0x6, 0x78,0x00,0x84,0x00,0x02,0x01,0x22,0x01,0x22,0x01,0xE2,0x01,
+	0x78,0x00,0x84,0x00,0x02,0x01,0x22,0x01,0x22,0x01,0xE2,0x01,
 
 	/* Index 40, character 72 "H" (width: 6 pixels) */
-	0x6, 0xFE,0x01,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xFE,0x01,
+	0xFE,0x01,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xFE,0x01,
 
 	/* Index 41, character 73 "I" (width: 3 pixels) */
-	0x3, 0x02,0x01,0xFE,0x01,0x02,0x01,
+	0x02,0x01,0xFE,0x01,0x02,0x01,
 
 	/* Index 42, character 74 "J" (width: 4 pixels) */
-	0x4, 0x00,0x01,0x02,0x01,0x02,0x01,0xFE,0x00,
+	0x00,0x01,0x02,0x01,0x02,0x01,0xFE,0x00,
 
 	/* Index 43, character 75 "K" (width: 5 pixels) */
-	0x5, 0xFE,0x01,0x30,0x00,0x48,0x00,0x84,0x00,0x02,0x01,
+	0xFE,0x01,0x30,0x00,0x48,0x00,0x84,0x00,0x02,0x01,
 
 	/* Index 44, character 76 "L" (width: 4 pixels) */
-	0x4, 0xFE,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+	0xFE,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
 
 	/* Index 45, character 77 "M" (width: 7 pixels) */
-	0x7, 0xFE,0x01,0x06,0x00,0x18,0x00,0x60,0x00,0x18,0x00,0x06,0x00,0xFE,0x01,
+	0xFE,0x01,0x06,0x00,0x18,0x00,0x60,0x00,0x18,0x00,0x06,0x00,0xFE,0x01,
 
 	/* Index 46, character 78 "N" (width: 6 pixels) */
-	0x6, 0xFE,0x01,0x06,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0xFE,0x01,
+	0xFE,0x01,0x06,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0xFE,0x01,
 
 	/* Index 47, character 79 "O" (width: 7 pixels) */
-	0x7, 0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
+	0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
 
 	/* Index 48, character 80 "P" (width: 5 pixels) */
-	0x5, 0xFE,0x01,0x22,0x00,0x22,0x00,0x22,0x00,0x1C,0x00,
+	0xFE,0x01,0x22,0x00,0x22,0x00,0x22,0x00,0x1C,0x00,
 
 	/* Index 49, character 81 "Q" (width: 7 pixels) */
-	0x7, 0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x03,0x84,0x04,0x78,0x04,
+	0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x03,0x84,0x04,0x78,0x04,
 
 	/* Index 50, character 82 "R" (width: 6 pixels) */
-	0x6, 0xFE,0x01,0x22,0x00,0x22,0x00,0x62,0x00,0x9C,0x00,0x00,0x01,
+	0xFE,0x01,0x22,0x00,0x22,0x00,0x62,0x00,0x9C,0x00,0x00,0x01,
 
 	/* Index 51, character 83 "S" (width: 5 pixels) */
-	0x5, 0x0C,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0xE2,0x00,
+	0x0C,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0xE2,0x00,
 
 	/* Index 52, character 84 "T" (width: 5 pixels) */
-	0x5, 0x02,0x00,0x02,0x00,0xFE,0x01,0x02,0x00,0x02,0x00,
+	0x02,0x00,0x02,0x00,0xFE,0x01,0x02,0x00,0x02,0x00,
 
 	/* Index 53, character 85 "U" (width: 6 pixels) */
-	0x6, 0xFE,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0xFE,0x00,
+	0xFE,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0xFE,0x00,
 
 	/* Index 54, character 86 "V" (width: 5 pixels) */
-	0x5, 0x0E,0x00,0x70,0x00,0x80,0x01,0x70,0x00,0x0E,0x00,
+	0x0E,0x00,0x70,0x00,0x80,0x01,0x70,0x00,0x0E,0x00,
 
 	/* Index 55, character 87 "W" (width: 9 pixels) */
-	0x9, 0x0E,0x00,0x70,0x00,0x80,0x01,0x70,0x00,0x0E,0x00,0x70,0x00,0x80,0x01,0x70,0x00,0x0E,0x00,
+	0x0E,0x00,0x70,0x00,0x80,0x01,0x70,0x00,0x0E,0x00,0x70,0x00,0x80,0x01,0x70,0x00,0x0E,0x00,
 
 	/* Index 56, character 88 "X" (width: 5 pixels) */
-	0x5, 0x86,0x01,0x48,0x00,0x30,0x00,0x48,0x00,0x86,0x01,
+	0x86,0x01,0x48,0x00,0x30,0x00,0x48,0x00,0x86,0x01,
 
 	/* Index 57, character 89 "Y" (width: 5 pixels) */
-	0x5, 0x06,0x00,0x18,0x00,0xE0,0x01,0x18,0x00,0x06,0x00,
+	0x06,0x00,0x18,0x00,0xE0,0x01,0x18,0x00,0x06,0x00,
 
 	/* Index 58, character 90 "Z" (width: 5 pixels) */
-	0x5, 0x82,0x01,0x42,0x01,0x32,0x01,0x0A,0x01,0x06,0x01,
+	0x82,0x01,0x42,0x01,0x32,0x01,0x0A,0x01,0x06,0x01,
 
 	/* Index 59, character 91 "[" (width: 3 pixels) */
-	0x3, 0xFF,0x07,0x01,0x04,0x01,0x04,
+	0xFF,0x07,0x01,0x04,0x01,0x04,
 
 	/* Index 60, character 92 "\" (width: 3 pixels) */
-	0x3, 0x07,0x00,0xF8,0x00,0x00,0x07,
+	0x07,0x00,0xF8,0x00,0x00,0x07,
 
 	/* Index 61, character 93 "]" (width: 3 pixels) */
-	0x3, 0x01,0x04,0x01,0x04,0xFF,0x07,
+	0x01,0x04,0x01,0x04,0xFF,0x07,
 
 	/* Index 62, character 94 "^" (width: 7 pixels) */
-	0x7, 0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,
+	0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,
 
 	/* Index 63, character 95 "_" (width: 6 pixels) */
-	0x6, 0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
+	0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
 
 	/* Index 64, character 96 "`" (width: 2 pixels) */
-	0x2, 0x01,0x00,0x02,0x00,
+	0x01,0x00,0x02,0x00,
 
 	/* Index 65, character 97 "a" (width: 5 pixels) */
-	0x5, 0xC0,0x00,0x28,0x01,0x28,0x01,0x28,0x01,0xF0,0x01,
+	0xC0,0x00,0x28,0x01,0x28,0x01,0x28,0x01,0xF0,0x01,
 
 	/* Index 66, character 98 "b" (width: 5 pixels) */
-	0x5, 0xFF,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
+	0xFF,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
 
 	/* Index 67, character 99 "c" (width: 4 pixels) */
-	0x4, 0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,
+	0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,
 
 	/* Index 68, character 100 "d" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xFF,0x01,
+	0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xFF,0x01,
 
 	/* Index 69, character 101 "e" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x28,0x01,0x28,0x01,0x28,0x01,0xB0,0x00,
+	0xF0,0x00,0x28,0x01,0x28,0x01,0x28,0x01,0xB0,0x00,
 
 	/* Index 70, character 102 "f" (width: 3 pixels) */
-	0x3, 0xFE,0x01,0x09,0x00,0x09,0x00,
+	0xFE,0x01,0x09,0x00,0x09,0x00,
 
 	/* Index 71, character 103 "g" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x08,0x05,0x08,0x05,0x08,0x05,0xF8,0x03,
+	0xF0,0x00,0x08,0x05,0x08,0x05,0x08,0x05,0xF8,0x03,
 
 	/* Index 72, character 104 "h" (width: 5 pixels) */
-	0x5, 0xFF,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,
+	0xFF,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,
 
 	/* Index 73, character 105 "i" (width: 1 pixels) */
-	0x1, 0xFA,0x01,
+	0xFA,0x01,
 
 	/* Index 74, character 106 "j" (width: 2 pixels) */
-	0x2, 0x08,0x04,0xFA,0x03,
+	0x08,0x04,0xFA,0x03,
 
 	/* Index 75, character 107 "k" (width: 5 pixels) */
-	0x5, 0xFF,0x01,0x20,0x00,0x50,0x00,0x88,0x00,0x00,0x01,
+	0xFF,0x01,0x20,0x00,0x50,0x00,0x88,0x00,0x00,0x01,
 
 	/* Index 76, character 108 "l" (width: 1 pixels) */
-	0x1, 0xFF,0x01,
+	0xFF,0x01,
 
 	/* Index 77, character 109 "m" (width: 7 pixels) */
-	0x7, 0xF8,0x01,0x08,0x00,0x08,0x00,0xF0,0x01,0x08,0x00,0x08,0x00,0xF0,0x01,
+	0xF8,0x01,0x08,0x00,0x08,0x00,0xF0,0x01,0x08,0x00,0x08,0x00,0xF0,0x01,
 
 	/* Index 78, character 110 "n" (width: 5 pixels) */
-	0x5, 0xF8,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,
+	0xF8,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,
 
 	/* Index 79, character 111 "o" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
+	0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
 
 	/* Index 80, character 112 "p" (width: 5 pixels) */
-	0x5, 0xF8,0x07,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
+	0xF8,0x07,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
 
 	/* Index 81, character 113 "q" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xF8,0x07,
+	0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xF8,0x07,
 
 	/* Index 82, character 114 "r" (width: 3 pixels) */
-	0x3, 0xF8,0x01,0x10,0x00,0x08,0x00,
+	0xF8,0x01,0x10,0x00,0x08,0x00,
 
 	/* Index 83, character 115 "s" (width: 4 pixels) */
-	0x4, 0x30,0x01,0x28,0x01,0x48,0x01,0xC8,0x00,
+	0x30,0x01,0x28,0x01,0x48,0x01,0xC8,0x00,
 
 	/* Index 84, character 116 "t" (width: 3 pixels) */
-	0x3, 0xFE,0x00,0x08,0x01,0x08,0x01,
+	0xFE,0x00,0x08,0x01,0x08,0x01,
 
 	/* Index 85, character 117 "u" (width: 5 pixels) */
-	0x5, 0xF8,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0xF8,0x01,
+	0xF8,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0xF8,0x01,
 
 	/* Index 86, character 118 "v" (width: 5 pixels) */
-	0x5, 0x18,0x00,0x60,0x00,0x80,0x01,0x60,0x00,0x18,0x00,
+	0x18,0x00,0x60,0x00,0x80,0x01,0x60,0x00,0x18,0x00,
 
 	/* Index 87, character 119 "w" (width: 7 pixels) */
-	0x7, 0x78,0x00,0x80,0x01,0x60,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0x78,0x00,
+	0x78,0x00,0x80,0x01,0x60,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0x78,0x00,
 
 	/* Index 88, character 120 "x" (width: 5 pixels) */
-	0x5, 0x08,0x01,0x90,0x00,0x60,0x00,0x90,0x00,0x08,0x01,
+	0x08,0x01,0x90,0x00,0x60,0x00,0x90,0x00,0x08,0x01,
 
 	/* Index 89, character 121 "y" (width: 5 pixels) */
-	0x5, 0x18,0x00,0x60,0x06,0x80,0x01,0x60,0x00,0x18,0x00,
+	0x18,0x00,0x60,0x06,0x80,0x01,0x60,0x00,0x18,0x00,
 
 	/* Index 90, character 122 "z" (width: 4 pixels) */
-	0x4, 0x88,0x01,0x48,0x01,0x28,0x01,0x18,0x01,
+	0x88,0x01,0x48,0x01,0x28,0x01,0x18,0x01,
 
 	/* Index 91, character 123 "{" (width: 4 pixels) */
-	0x4, 0x20,0x00,0x20,0x00,0xDE,0x03,0x01,0x04,
+	0x20,0x00,0x20,0x00,0xDE,0x03,0x01,0x04,
 
 	/* Index 92, character 124 "|" (width: 1 pixels) */
-	0x1, 0xFF,0x07,
+	0xFF,0x07,
 
 	/* Index 93, character 125 "}" (width: 4 pixels) */
-	0x4, 0x01,0x04,0xDE,0x03,0x20,0x00,0x20,0x00,
+	0x01,0x04,0xDE,0x03,0x20,0x00,0x20,0x00,
 
 	/* Index 94, character 126 "~" (width: 7 pixels) */
-	0x7, 0x60,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x30,0x00
+	0x60,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x30,0x00
 };
+
+// Offset of each bitmap in Tahoma8_bitmaps
+const unsigned short Tahoma8_offsets[] = 
+{
+	0x0,	// Index 0
+	0x4,	// Index 1
+	0x6,	// Index 2
+	0xC,	// Index 3
+	0x1A,	// Index 4
+	0x24,	// Index 5
+	0x38,	// Index 6
+	0x46,	// Index 7
+	0x48,	// Index 8
+	0x4E,	// Index 9
+	0x54,	// Index 10
+	0x5E,	// Index 11
+	0x6C,	// Index 12
+	0x70,	// Index 13
+	0x76,	// Index 14
+	0x78,	// Index 15
+	0x7E,	// Index 16
+	0x88,	// Index 17
+	0x8E,	// Index 18
+	0x98,	// Index 19
+	0xA2,	// Index 20
+	0xAC,	// Index 21
+	0xB6,	// Index 22
+	0xC0,	// Index 23
+	0xCA,	// Index 24
+	0xD4,	// Index 25
+	0xDE,	// Index 26
+	0xE0,	// Index 27
+	0xE4,	// Index 28
+	0xF0,	// Index 29
+	0xFE,	// Index 30
+	0x10A,	// Index 31
+	0x112,	// Index 32
+	0x124,	// Index 33
+	0x130,	// Index 34
+	0x13A,	// Index 35
+	0x146,	// Index 36
+	0x152,	// Index 37
+	0x15C,	// Index 38
+	0x166,	// Index 39
+	0x172,	// Index 40
+	0x17E,	// Index 41
+	0x184,	// Index 42
+	0x18C,	// Index 43
+	0x196,	// Index 44
+	0x19E,	// Index 45
+	0x1AC,	// Index 46
+	0x1B8,	// Index 47
+	0x1C6,	// Index 48
+	0x1D0,	// Index 49
+	0x1DE,	// Index 50
+	0x1EA,	// Index 51
+	0x1F4,	// Index 52
+	0x1FE,	// Index 53
+	0x20A,	// Index 54
+	0x214,	// Index 55
+	0x226,	// Index 56
+	0x230,	// Index 57
+	0x23A,	// Index 58
+	0x244,	// Index 59
+	0x24A,	// Index 60
+	0x250,	// Index 61
+	0x256,	// Index 62
+	0x264,	// Index 63
+	0x270,	// Index 64
+	0x274,	// Index 65
+	0x27E,	// Index 66
+	0x288,	// Index 67
+	0x290,	// Index 68
+	0x29A,	// Index 69
+	0x2A4,	// Index 70
+	0x2AA,	// Index 71
+	0x2B4,	// Index 72
+	0x2BE,	// Index 73
+	0x2C0,	// Index 74
+	0x2C4,	// Index 75
+	0x2CE,	// Index 76
+	0x2D0,	// Index 77
+	0x2DE,	// Index 78
+	0x2E8,	// Index 79
+	0x2F2,	// Index 80
+	0x2FC,	// Index 81
+	0x306,	// Index 82
+	0x30C,	// Index 83
+	0x314,	// Index 84
+	0x31A,	// Index 85
+	0x324,	// Index 86
+	0x32E,	// Index 87
+	0x33C,	// Index 88
+	0x346,	// Index 89
+	0x350,	// Index 90
+	0x358,	// Index 91
+	0x360,	// Index 92
+	0x362,	// Index 93
+	0x36A,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Tahoma8_widths[] = 
+{
+	0x2,	// Index 0
+	0x1,	// Index 1
+	0x3,	// Index 2
+	0x7,	// Index 3
+	0x5,	// Index 4
+	0xA,	// Index 5
+	0x7,	// Index 6
+	0x1,	// Index 7
+	0x3,	// Index 8
+	0x3,	// Index 9
+	0x5,	// Index 10
+	0x7,	// Index 11
+	0x2,	// Index 12
+	0x3,	// Index 13
+	0x1,	// Index 14
+	0x3,	// Index 15
+	0x5,	// Index 16
+	0x3,	// Index 17
+	0x5,	// Index 18
+	0x5,	// Index 19
+	0x5,	// Index 20
+	0x5,	// Index 21
+	0x5,	// Index 22
+	0x5,	// Index 23
+	0x5,	// Index 24
+	0x5,	// Index 25
+	0x1,	// Index 26
+	0x2,	// Index 27
+	0x6,	// Index 28
+	0x7,	// Index 29
+	0x6,	// Index 30
+	0x4,	// Index 31
+	0x9,	// Index 32
+	0x6,	// Index 33
+	0x5,	// Index 34
+	0x6,	// Index 35
+	0x6,	// Index 36
+	0x5,	// Index 37
+	0x5,	// Index 38
+	0x6,	// Index 39
+	0x6,	// Index 40
+	0x3,	// Index 41
+	0x4,	// Index 42
+	0x5,	// Index 43
+	0x4,	// Index 44
+	0x7,	// Index 45
+	0x6,	// Index 46
+	0x7,	// Index 47
+	0x5,	// Index 48
+	0x7,	// Index 49
+	0x6,	// Index 50
+	0x5,	// Index 51
+	0x5,	// Index 52
+	0x6,	// Index 53
+	0x5,	// Index 54
+	0x9,	// Index 55
+	0x5,	// Index 56
+	0x5,	// Index 57
+	0x5,	// Index 58
+	0x3,	// Index 59
+	0x3,	// Index 60
+	0x3,	// Index 61
+	0x7,	// Index 62
+	0x6,	// Index 63
+	0x2,	// Index 64
+	0x5,	// Index 65
+	0x5,	// Index 66
+	0x4,	// Index 67
+	0x5,	// Index 68
+	0x5,	// Index 69
+	0x3,	// Index 70
+	0x5,	// Index 71
+	0x5,	// Index 72
+	0x1,	// Index 73
+	0x2,	// Index 74
+	0x5,	// Index 75
+	0x1,	// Index 76
+	0x7,	// Index 77
+	0x5,	// Index 78
+	0x5,	// Index 79
+	0x5,	// Index 80
+	0x5,	// Index 81
+	0x3,	// Index 82
+	0x4,	// Index 83
+	0x3,	// Index 84
+	0x5,	// Index 85
+	0x5,	// Index 86
+	0x7,	// Index 87
+	0x5,	// Index 88
+	0x5,	// Index 89
+	0x4,	// Index 90
+	0x4,	// Index 91
+	0x1,	// Index 92
+	0x4,	// Index 93
+	0x7,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Tahoma8_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x8, 0x0,	// Index 1
+	0x9, 0x0,	// Index 2
+	0x8, 0x0,	// Index 3
+	0x9, 0x2,	// Index 4
+	0x8, 0x0,	// Index 5
+	0x8, 0x0,	// Index 6
+	0x9, 0x0,	// Index 7
+	0x9, 0x2,	// Index 8
+	0x9, 0x2,	// Index 9
+	0x9, 0x0,	// Index 10
+	0x7, 0x0,	// Index 11
+	0x2, 0x2,	// Index 12
+	0x4, 0x0,	// Index 13
+	0x2, 0x0,	// Index 14
+	0x9, 0x2,	// Index 15
+	0x8, 0x0,	// Index 16
+	0x8, 0x0,	// Index 17
+	0x8, 0x0,	// Index 18
+	0x8, 0x0,	// Index 19
+	0x8, 0x0,	// Index 20
+	0x8, 0x0,	// Index 21
+	0x8, 0x0,	// Index 22
+	0x8, 0x0,	// Index 23
+	0x8, 0x0,	// Index 24
+	0x8, 0x0,	// Index 25
+	0x6, 0x0,	// Index 26
+	0x6, 0x2,	// Index 27
+	0x7, 0x0,	// Index 28
+	0x5, 0x0,	// Index 29
+	0x7, 0x0,	// Index 30
+	0x8, 0x0,	// Index 31
+	0x8, 0x1,	// Index 32
+	0x8, 0x0,	// Index 33
+	0x8, 0x0,	// Index 34
+	0x8, 0x0,	// Index 35
+	0x8, 0x0,	// Index 36
+	0x8, 0x0,	// Index 37
+	0x8, 0x0,	// Index 38
+	0x8, 0x0,	// Index 39
+	0x8, 0x0,	// Index 40
+	0x8, 0x0,	// Index 41
+	0x8, 0x0,	// Index 42
+	0x8, 0x0,	// Index 43
+	0x8, 0x0,	// Index 44
+	0x8, 0x0,	// Index 45
+	0x8, 0x0,	// Index 46
+	0x8, 0x0,	// Index 47
+	0x8, 0x0,	// Index 48
+	0x8, 0x2,	// Index 49
+	0x8, 0x0,	// Index 50
+	0x8, 0x0,	// Index 51
+	0x8, 0x0,	// Index 52
+	0x8, 0x0,	// Index 53
+	0x8, 0x0,	// Index 54
+	0x8, 0x0,	// Index 55
+	0x8, 0x0,	// Index 56
+	0x8, 0x0,	// Index 57
+	0x8, 0x0,	// Index 58
+	0x9, 0x2,	// Index 59
+	0x9, 0x2,	// Index 60
+	0x9, 0x2,	// Index 61
+	0x8, 0x0,	// Index 62
+	0x0, 0x2,	// Index 63
+	0x9, 0x0,	// Index 64
+	0x6, 0x0,	// Index 65
+	0x9, 0x0,	// Index 66
+	0x6, 0x0,	// Index 67
+	0x9, 0x0,	// Index 68
+	0x6, 0x0,	// Index 69
+	0x9, 0x0,	// Index 70
+	0x6, 0x2,	// Index 71
+	0x9, 0x0,	// Index 72
+	0x8, 0x0,	// Index 73
+	0x8, 0x2,	// Index 74
+	0x9, 0x0,	// Index 75
+	0x9, 0x0,	// Index 76
+	0x6, 0x0,	// Index 77
+	0x6, 0x0,	// Index 78
+	0x6, 0x0,	// Index 79
+	0x6, 0x2,	// Index 80
+	0x6, 0x2,	// Index 81
+	0x6, 0x0,	// Index 82
+	0x6, 0x0,	// Index 83
+	0x8, 0x0,	// Index 84
+	0x6, 0x0,	// Index 85
+	0x6, 0x0,	// Index 86
+	0x6, 0x0,	// Index 87
+	0x6, 0x0,	// Index 88
+	0x6, 0x2,	// Index 89
+	0x6, 0x0,	// Index 90
+	0x9, 0x2,	// Index 91
+	0x9, 0x2,	// Index 92
+	0x9, 0x2,	// Index 93
+	0x5, 0x0,	// Index 94
+};
+
+const font_t Tahoma8 = 
+{
+	Tahoma8_bitmaps,
+	Tahoma8_offsets,
+	Tahoma8_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0xB,	// Height 
+	0,	// Flags 
+	Tahoma8_extents,
+	0x9	// Ascent 
+};
+
 //---------------------------------------------------------------
 // Group Name: Tahoma7
 // Designer: Imported System Font
@@ -2045,398 +3092,607 @@ const unsigned char Tahoma8[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Tahoma7[] = 
+const unsigned char Tahoma7_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0xB,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xC6, // Index 1 (offset: 198)
-	0x0, 0xC9, // Index 2 (offset: 201)
-	0x0, 0xD0, // Index 3 (offset: 208)
-	0x0, 0xDF, // Index 4 (offset: 223)
-	0x0, 0xEA, // Index 5 (offset: 234)
-	0x0, 0xFD, // Index 6 (offset: 253)
-	0x1, 0xA, // Index 7 (offset: 266)
-	0x1, 0xD, // Index 8 (offset: 269)
-	0x1, 0x14, // Index 9 (offset: 276)
-	0x1, 0x1B, // Index 10 (offset: 283)
-	0x1, 0x26, // Index 11 (offset: 294)
-	0x1, 0x31, // Index 12 (offset: 305)
-	0x1, 0x36, // Index 13 (offset: 310)
-	0x1, 0x3B, // Index 14 (offset: 315)
-	0x1, 0x3E, // Index 15 (offset: 318)
-	0x1, 0x45, // Index 16 (offset: 325)
-	0x1, 0x4E, // Index 17 (offset: 334)
-	0x1, 0x55, // Index 18 (offset: 341)
-	0x1, 0x5E, // Index 19 (offset: 350)
-	0x1, 0x67, // Index 20 (offset: 359)
-	0x1, 0x72, // Index 21 (offset: 370)
-	0x1, 0x7B, // Index 22 (offset: 379)
-	0x1, 0x84, // Index 23 (offset: 388)
-	0x1, 0x8D, // Index 24 (offset: 397)
-	0x1, 0x96, // Index 25 (offset: 406)
-	0x1, 0x9F, // Index 26 (offset: 415)
-	0x1, 0xA2, // Index 27 (offset: 418)
-	0x1, 0xA7, // Index 28 (offset: 423)
-	0x1, 0xB2, // Index 29 (offset: 434)
-	0x1, 0xBF, // Index 30 (offset: 447)
-	0x1, 0xCA, // Index 31 (offset: 458)
-	0x1, 0xD3, // Index 32 (offset: 467)
-	0x1, 0xE2, // Index 33 (offset: 482)
-	0x1, 0xEF, // Index 34 (offset: 495)
-	0x1, 0xFA, // Index 35 (offset: 506)
-	0x2, 0x7, // Index 36 (offset: 519)
-	0x2, 0x14, // Index 37 (offset: 532)
-	0x2, 0x1F, // Index 38 (offset: 543)
-	0x2, 0x2A, // Index 39 (offset: 554)
-	0x2, 0x37, // Index 40 (offset: 567)
-	0x2, 0x44, // Index 41 (offset: 580)
-	0x2, 0x4B, // Index 42 (offset: 587)
-	0x2, 0x52, // Index 43 (offset: 594)
-	0x2, 0x5D, // Index 44 (offset: 605)
-	0x2, 0x66, // Index 45 (offset: 614)
-	0x2, 0x75, // Index 46 (offset: 629)
-	0x2, 0x82, // Index 47 (offset: 642)
-	0x2, 0x91, // Index 48 (offset: 657)
-	0x2, 0x9C, // Index 49 (offset: 668)
-	0x2, 0xAB, // Index 50 (offset: 683)
-	0x2, 0xB6, // Index 51 (offset: 694)
-	0x2, 0xC1, // Index 52 (offset: 705)
-	0x2, 0xCC, // Index 53 (offset: 716)
-	0x2, 0xD9, // Index 54 (offset: 729)
-	0x2, 0xE6, // Index 55 (offset: 742)
-	0x2, 0xF5, // Index 56 (offset: 757)
-	0x2, 0xFE, // Index 57 (offset: 766)
-	0x3, 0x9, // Index 58 (offset: 777)
-	0x3, 0x12, // Index 59 (offset: 786)
-	0x3, 0x17, // Index 60 (offset: 791)
-	0x3, 0x1E, // Index 61 (offset: 798)
-	0x3, 0x23, // Index 62 (offset: 803)
-	0x3, 0x2E, // Index 63 (offset: 814)
-	0x3, 0x39, // Index 64 (offset: 825)
-	0x3, 0x3E, // Index 65 (offset: 830)
-	0x3, 0x47, // Index 66 (offset: 839)
-	0x3, 0x50, // Index 67 (offset: 848)
-	0x3, 0x57, // Index 68 (offset: 855)
-	0x3, 0x60, // Index 69 (offset: 864)
-	0x3, 0x69, // Index 70 (offset: 873)
-	0x3, 0x70, // Index 71 (offset: 880)
-	0x3, 0x79, // Index 72 (offset: 889)
-	0x3, 0x82, // Index 73 (offset: 898)
-	0x3, 0x85, // Index 74 (offset: 901)
-	0x3, 0x8A, // Index 75 (offset: 906)
-	0x3, 0x93, // Index 76 (offset: 915)
-	0x3, 0x96, // Index 77 (offset: 918)
-	0x3, 0xA5, // Index 78 (offset: 933)
-	0x3, 0xAE, // Index 79 (offset: 942)
-	0x3, 0xB7, // Index 80 (offset: 951)
-	0x3, 0xC0, // Index 81 (offset: 960)
-	0x3, 0xC9, // Index 82 (offset: 969)
-	0x3, 0xD0, // Index 83 (offset: 976)
-	0x3, 0xD7, // Index 84 (offset: 983)
-	0x3, 0xDC, // Index 85 (offset: 988)
-	0x3, 0xE5, // Index 86 (offset: 997)
-	0x3, 0xF0, // Index 87 (offset: 1008)
-	0x3, 0xFF, // Index 88 (offset: 1023)
-	0x4, 0x6, // Index 89 (offset: 1030)
-	0x4, 0x11, // Index 90 (offset: 1041)
-	0x4, 0x18, // Index 91 (offset: 1048)
-	0x4, 0x1F, // Index 92 (offset: 1055)
-	0x4, 0x22, // Index 93 (offset: 1058)
-	0x4, 0x29, // Index 94 (offset: 1065)
-
 	/* Index 0, character 32 " " (width: 1 pixels) */
-	0x1, 0x00,0x00,
+	0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 1 pixels) */
-	0x1, 0x7C,0x01,
+	0x7C,0x01,
 
 	/* Index 2, character 34 """ (width: 3 pixels) */
-	0x3, 0x0E,0x00,0x00,0x00,0x0E,0x00,
+	0x0E,0x00,0x00,0x00,0x0E,0x00,
 
 	/* Index 3, character 35 "#" (width: 7 pixels) */
-	0x7, 0x40,0x00,0xD0,0x01,0x7C,0x00,0x50,0x00,0xF0,0x01,0x5C,0x00,0x10,0x00,
+	0x40,0x00,0xD0,0x01,0x7C,0x00,0x50,0x00,0xF0,0x01,0x5C,0x00,0x10,0x00,
 
 	/* Index 4, character 36 "$" (width: 5 pixels) */
-	0x5, 0x10,0x01,0x28,0x01,0xFC,0x07,0x48,0x01,0x88,0x00,
+	0x10,0x01,0x28,0x01,0xFC,0x07,0x48,0x01,0x88,0x00,
 
 	/* Index 5, character 37 "%" (width: 9 pixels) */
-	0x9, 0x18,0x00,0x24,0x00,0x24,0x01,0xD8,0x00,0x20,0x00,0xD8,0x00,0x24,0x01,0x20,0x01,0xC0,0x00,
+	0x18,0x00,0x24,0x00,0x24,0x01,0xD8,0x00,0x20,0x00,0xD8,0x00,0x24,0x01,0x20,0x01,0xC0,0x00,
 
 	/* Index 6, character 38 "&" (width: 6 pixels) */
-	0x6, 0xD8,0x00,0x24,0x01,0x24,0x01,0xD8,0x00,0xA0,0x00,0x00,0x01,
+	0xD8,0x00,0x24,0x01,0x24,0x01,0xD8,0x00,0xA0,0x00,0x00,0x01,
 
 	/* Index 7, character 39 "'" (width: 1 pixels) */
-	0x1, 0x0E,0x00,
+	0x0E,0x00,
 
 	/* Index 8, character 40 "(" (width: 3 pixels) */
-	0x3, 0xF8,0x01,0x04,0x02,0x02,0x04,
+	0xF8,0x01,0x04,0x02,0x02,0x04,
 
 	/* Index 9, character 41 ")" (width: 3 pixels) */
-	0x3, 0x02,0x04,0x04,0x02,0xF8,0x01,
+	0x02,0x04,0x04,0x02,0xF8,0x01,
 
 	/* Index 10, character 42 "*" (width: 5 pixels) */
-	0x5, 0x0A,0x00,0x04,0x00,0x1F,0x00,0x04,0x00,0x0A,0x00,
+	0x0A,0x00,0x04,0x00,0x1F,0x00,0x04,0x00,0x0A,0x00,
 
 	/* Index 11, character 43 "+" (width: 5 pixels) */
-	0x5, 0x20,0x00,0x20,0x00,0xF8,0x00,0x20,0x00,0x20,0x00,
+	0x20,0x00,0x20,0x00,0xF8,0x00,0x20,0x00,0x20,0x00,
 
 	/* Index 12, character 44 "," (width: 2 pixels) */
-	0x2, 0x00,0x02,0x80,0x01,
+	0x00,0x02,0x80,0x01,
 
 	/* Index 13, character 45 "-" (width: 2 pixels) */
-	0x2, 0x40,0x00,0x40,0x00,
+	0x40,0x00,0x40,0x00,
 
 	/* Index 14, character 46 "." (width: 1 pixels) */
-	0x1, 0x80,0x01,
+	0x80,0x01,
 
 	/* Index 15, character 47 "/" (width: 3 pixels) */
-	0x3, 0x00,0x03,0xF8,0x00,0x06,0x00,
+	0x00,0x03,0xF8,0x00,0x06,0x00,
 
 	/* Index 16, character 48 "0" (width: 4 pixels) */
-	0x4, 0xF8,0x00,0x04,0x01,0x04,0x01,0xF8,0x00,
+	0xF8,0x00,0x04,0x01,0x04,0x01,0xF8,0x00,
 
 	/* Index 17, character 49 "1" (width: 3 pixels) */
-	0x3, 0x08,0x01,0xFC,0x01,0x00,0x01,
+	0x08,0x01,0xFC,0x01,0x00,0x01,
 
 	/* Index 18, character 50 "2" (width: 4 pixels) */
-	0x4, 0x84,0x01,0x44,0x01,0x24,0x01,0x18,0x01,
+	0x84,0x01,0x44,0x01,0x24,0x01,0x18,0x01,
 
 	/* Index 19, character 51 "3" (width: 4 pixels) */
-	0x4, 0x04,0x01,0x24,0x01,0x24,0x01,0xD8,0x00,
+	0x04,0x01,0x24,0x01,0x24,0x01,0xD8,0x00,
 
 	/* Index 20, character 52 "4" (width: 5 pixels) */
-	0x5, 0x60,0x00,0x50,0x00,0x48,0x00,0xFC,0x01,0x40,0x00,
+	0x60,0x00,0x50,0x00,0x48,0x00,0xFC,0x01,0x40,0x00,
 
 	/* Index 21, character 53 "5" (width: 4 pixels) */
-	0x4, 0x3C,0x01,0x24,0x01,0x24,0x01,0xC4,0x00,
+	0x3C,0x01,0x24,0x01,0x24,0x01,0xC4,0x00,
 
 	/* Index 22, character 54 "6" (width: 4 pixels) */
-	0x4, 0xF8,0x00,0x24,0x01,0x24,0x01,0xC0,0x00,
+	0xF8,0x00,0x24,0x01,0x24,0x01,0xC0,0x00,
 
 	/* Index 23, character 55 "7" (width: 4 pixels) */
-	0x4, 0x04,0x01,0xC4,0x00,0x34,0x00,0x0C,0x00,
+	0x04,0x01,0xC4,0x00,0x34,0x00,0x0C,0x00,
 
 	/* Index 24, character 56 "8" (width: 4 pixels) */
-	0x4, 0xD8,0x00,0x24,0x01,0x24,0x01,0xD8,0x00,
+	0xD8,0x00,0x24,0x01,0x24,0x01,0xD8,0x00,
 
 	/* Index 25, character 57 "9" (width: 4 pixels) */
-	0x4, 0x18,0x00,0x24,0x01,0x24,0x01,0xF8,0x00,
+	0x18,0x00,0x24,0x01,0x24,0x01,0xF8,0x00,
 
 	/* Index 26, character 58 ":" (width: 1 pixels) */
-	0x1, 0xB0,0x01,
+	0xB0,0x01,
 
 	/* Index 27, character 59 ";" (width: 2 pixels) */
-	0x2, 0x00,0x02,0xB0,0x01,
+	0x00,0x02,0xB0,0x01,
 
 	/* Index 28, character 60 "<" (width: 5 pixels) */
-	0x5, 0x40,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x10,0x01,
+	0x40,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x10,0x01,
 
 	/* Index 29, character 61 "=" (width: 6 pixels) */
-	0x6, 0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,
+	0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,
 
 	/* Index 30, character 62 ">" (width: 5 pixels) */
-	0x5, 0x10,0x01,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x40,0x00,
+	0x10,0x01,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x40,0x00,
 
 	/* Index 31, character 63 "?" (width: 4 pixels) */
-	0x4, 0x04,0x00,0x44,0x01,0x24,0x00,0x18,0x00,
+	0x04,0x00,0x44,0x01,0x24,0x00,0x18,0x00,
 
 	/* Index 32, character 64 "@" (width: 7 pixels) */
-	0x7, 0xF0,0x00,0x08,0x01,0x64,0x02,0x94,0x02,0xF4,0x02,0x88,0x00,0x70,0x00,
+	0xF0,0x00,0x08,0x01,0x64,0x02,0x94,0x02,0xF4,0x02,0x88,0x00,0x70,0x00,
 
 	/* Index 33, character 65 "A" (width: 6 pixels) */
-	0x6, 0xC0,0x01,0x70,0x00,0x4C,0x00,0x4C,0x00,0x70,0x00,0xC0,0x01,
+	0xC0,0x01,0x70,0x00,0x4C,0x00,0x4C,0x00,0x70,0x00,0xC0,0x01,
 
 	/* Index 34, character 66 "B" (width: 5 pixels) */
-	0x5, 0xFC,0x01,0x24,0x01,0x24,0x01,0x38,0x01,0xC0,0x00,
+	0xFC,0x01,0x24,0x01,0x24,0x01,0x38,0x01,0xC0,0x00,
 
 	/* Index 35, character 67 "C" (width: 6 pixels) */
-	0x6, 0x70,0x00,0x88,0x00,0x04,0x01,0x04,0x01,0x04,0x01,0x88,0x00,
+	0x70,0x00,0x88,0x00,0x04,0x01,0x04,0x01,0x04,0x01,0x88,0x00,
 
 	/* Index 36, character 68 "D" (width: 6 pixels) */
-	0x6, 0xFC,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x88,0x00,0x70,0x00,
+	0xFC,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x88,0x00,0x70,0x00,
 
 	/* Index 37, character 69 "E" (width: 5 pixels) */
-	0x5, 0xFC,0x01,0x24,0x01,0x24,0x01,0x24,0x01,0x04,0x01,
+	0xFC,0x01,0x24,0x01,0x24,0x01,0x24,0x01,0x04,0x01,
 
 	/* Index 38, character 70 "F" (width: 5 pixels) */
-	0x5, 0xFC,0x01,0x24,0x00,0x24,0x00,0x24,0x00,0x04,0x00,
+	0xFC,0x01,0x24,0x00,0x24,0x00,0x24,0x00,0x04,0x00,
 
 	/* Index 39, character 71 "G" (width: 6 pixels) */
-	0x6, 0x70,0x00,0x88,0x00,0x04,0x01,0x24,0x01,0x24,0x01,0xE8,0x01,
+	0x70,0x00,0x88,0x00,0x04,0x01,0x24,0x01,0x24,0x01,0xE8,0x01,
 
 	/* Index 40, character 72 "H" (width: 6 pixels) */
-	0x6, 0xFC,0x01,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xFC,0x01,
+	0xFC,0x01,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xFC,0x01,
 
 	/* Index 41, character 73 "I" (width: 3 pixels) */
-	0x3, 0x04,0x01,0xFC,0x01,0x04,0x01,
+	0x04,0x01,0xFC,0x01,0x04,0x01,
 
 	/* Index 42, character 74 "J" (width: 3 pixels) */
-	0x3, 0x00,0x01,0x04,0x01,0xFC,0x00,
+	0x00,0x01,0x04,0x01,0xFC,0x00,
 
 	/* Index 43, character 75 "K" (width: 5 pixels) */
-	0x5, 0xFC,0x01,0x20,0x00,0x50,0x00,0x88,0x00,0x04,0x01,
+	0xFC,0x01,0x20,0x00,0x50,0x00,0x88,0x00,0x04,0x01,
 
 	/* Index 44, character 76 "L" (width: 4 pixels) */
-	0x4, 0xFC,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+	0xFC,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
 
 	/* Index 45, character 77 "M" (width: 7 pixels) */
-	0x7, 0xFC,0x01,0x0C,0x00,0x30,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0xFC,0x01,
+	0xFC,0x01,0x0C,0x00,0x30,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0xFC,0x01,
 
 	/* Index 46, character 78 "N" (width: 6 pixels) */
-	0x6, 0xFC,0x01,0x08,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0xFC,0x01,
+	0xFC,0x01,0x08,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0xFC,0x01,
 
 	/* Index 47, character 79 "O" (width: 7 pixels) */
-	0x7, 0x70,0x00,0x88,0x00,0x04,0x01,0x04,0x01,0x04,0x01,0x88,0x00,0x70,0x00,
+	0x70,0x00,0x88,0x00,0x04,0x01,0x04,0x01,0x04,0x01,0x88,0x00,0x70,0x00,
 
 	/* Index 48, character 80 "P" (width: 5 pixels) */
-	0x5, 0xFC,0x01,0x44,0x00,0x44,0x00,0x44,0x00,0x38,0x00,
+	0xFC,0x01,0x44,0x00,0x44,0x00,0x44,0x00,0x38,0x00,
 
 	/* Index 49, character 81 "Q" (width: 7 pixels) */
-	0x7, 0x70,0x00,0x88,0x00,0x04,0x01,0x04,0x01,0x04,0x03,0x88,0x04,0x70,0x04,
+	0x70,0x00,0x88,0x00,0x04,0x01,0x04,0x01,0x04,0x03,0x88,0x04,0x70,0x04,
 
 	/* Index 50, character 82 "R" (width: 5 pixels) */
-	0x5, 0xFC,0x01,0x24,0x00,0x64,0x00,0xA4,0x00,0x18,0x01,
+	0xFC,0x01,0x24,0x00,0x64,0x00,0xA4,0x00,0x18,0x01,
 
 	/* Index 51, character 83 "S" (width: 5 pixels) */
-	0x5, 0x18,0x01,0x24,0x01,0x24,0x01,0x24,0x01,0xC4,0x00,
+	0x18,0x01,0x24,0x01,0x24,0x01,0x24,0x01,0xC4,0x00,
 
 	/* Index 52, character 84 "T" (width: 5 pixels) */
-	0x5, 0x04,0x00,0x04,0x00,0xFC,0x01,0x04,0x00,0x04,0x00,
+	0x04,0x00,0x04,0x00,0xFC,0x01,0x04,0x00,0x04,0x00,
 
 	/* Index 53, character 85 "U" (width: 6 pixels) */
-	0x6, 0xFC,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0xFC,0x00,
+	0xFC,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0xFC,0x00,
 
 	/* Index 54, character 86 "V" (width: 6 pixels) */
-	0x6, 0x1C,0x00,0x60,0x00,0x80,0x01,0x80,0x01,0x60,0x00,0x1C,0x00,
+	0x1C,0x00,0x60,0x00,0x80,0x01,0x80,0x01,0x60,0x00,0x1C,0x00,
 
 	/* Index 55, character 87 "W" (width: 7 pixels) */
-	0x7, 0x7C,0x00,0x80,0x01,0x70,0x00,0x0C,0x00,0x70,0x00,0x80,0x01,0x7C,0x00,
+	0x7C,0x00,0x80,0x01,0x70,0x00,0x0C,0x00,0x70,0x00,0x80,0x01,0x7C,0x00,
 
 	/* Index 56, character 88 "X" (width: 4 pixels) */
-	0x4, 0x8C,0x01,0x70,0x00,0x70,0x00,0x8C,0x01,
+	0x8C,0x01,0x70,0x00,0x70,0x00,0x8C,0x01,
 
 	/* Index 57, character 89 "Y" (width: 5 pixels) */
-	0x5, 0x04,0x00,0x18,0x00,0xE0,0x01,0x18,0x00,0x04,0x00,
+	0x04,0x00,0x18,0x00,0xE0,0x01,0x18,0x00,0x04,0x00,
 
 	/* Index 58, character 90 "Z" (width: 4 pixels) */
-	0x4, 0x84,0x01,0x64,0x01,0x14,0x01,0x0C,0x01,
+	0x84,0x01,0x64,0x01,0x14,0x01,0x0C,0x01,
 
 	/* Index 59, character 91 "[" (width: 2 pixels) */
-	0x2, 0xFE,0x07,0x02,0x04,
+	0xFE,0x07,0x02,0x04,
 
 	/* Index 60, character 92 "\" (width: 3 pixels) */
-	0x3, 0x06,0x00,0xF8,0x00,0x00,0x03,
+	0x06,0x00,0xF8,0x00,0x00,0x03,
 
 	/* Index 61, character 93 "]" (width: 2 pixels) */
-	0x2, 0x02,0x04,0xFE,0x07,
+	0x02,0x04,0xFE,0x07,
 
 	/* Index 62, character 94 "^" (width: 5 pixels) */
-	0x5, 0x10,0x00,0x08,0x00,0x04,0x00,0x08,0x00,0x10,0x00,
+	0x10,0x00,0x08,0x00,0x04,0x00,0x08,0x00,0x10,0x00,
 
 	/* Index 63, character 95 "_" (width: 5 pixels) */
-	0x5, 0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
+	0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
 
 	/* Index 64, character 96 "`" (width: 2 pixels) */
-	0x2, 0x02,0x00,0x04,0x00,
+	0x02,0x00,0x04,0x00,
 
 	/* Index 65, character 97 "a" (width: 4 pixels) */
-	0x4, 0x80,0x00,0x50,0x01,0x50,0x01,0xE0,0x01,
+	0x80,0x00,0x50,0x01,0x50,0x01,0xE0,0x01,
 
 	/* Index 66, character 98 "b" (width: 4 pixels) */
-	0x4, 0xFE,0x01,0x10,0x01,0x10,0x01,0xE0,0x00,
+	0xFE,0x01,0x10,0x01,0x10,0x01,0xE0,0x00,
 
 	/* Index 67, character 99 "c" (width: 3 pixels) */
-	0x3, 0xE0,0x00,0x10,0x01,0x10,0x01,
+	0xE0,0x00,0x10,0x01,0x10,0x01,
 
 	/* Index 68, character 100 "d" (width: 4 pixels) */
-	0x4, 0xE0,0x00,0x10,0x01,0x10,0x01,0xFE,0x01,
+	0xE0,0x00,0x10,0x01,0x10,0x01,0xFE,0x01,
 
 	/* Index 69, character 101 "e" (width: 4 pixels) */
-	0x4, 0xE0,0x00,0x50,0x01,0x50,0x01,0x60,0x01,
+	0xE0,0x00,0x50,0x01,0x50,0x01,0x60,0x01,
 
 	/* Index 70, character 102 "f" (width: 3 pixels) */
-	0x3, 0xFC,0x01,0x12,0x00,0x12,0x00,
+	0xFC,0x01,0x12,0x00,0x12,0x00,
 
 	/* Index 71, character 103 "g" (width: 4 pixels) */
-	0x4, 0xE0,0x00,0x10,0x05,0x10,0x05,0xF0,0x03,
+	0xE0,0x00,0x10,0x05,0x10,0x05,0xF0,0x03,
 
 	/* Index 72, character 104 "h" (width: 4 pixels) */
-	0x4, 0xFE,0x01,0x10,0x00,0x10,0x00,0xE0,0x01,
+	0xFE,0x01,0x10,0x00,0x10,0x00,0xE0,0x01,
 
 	/* Index 73, character 105 "i" (width: 1 pixels) */
-	0x1, 0xF4,0x01,
+	0xF4,0x01,
 
 	/* Index 74, character 106 "j" (width: 2 pixels) */
-	0x2, 0x10,0x04,0xF4,0x03,
+	0x10,0x04,0xF4,0x03,
 
 	/* Index 75, character 107 "k" (width: 4 pixels) */
-	0x4, 0xFE,0x01,0x40,0x00,0xA0,0x00,0x10,0x01,
+	0xFE,0x01,0x40,0x00,0xA0,0x00,0x10,0x01,
 
 	/* Index 76, character 108 "l" (width: 1 pixels) */
-	0x1, 0xFE,0x01,
+	0xFE,0x01,
 
 	/* Index 77, character 109 "m" (width: 7 pixels) */
-	0x7, 0xF0,0x01,0x10,0x00,0x10,0x00,0xE0,0x01,0x10,0x00,0x10,0x00,0xE0,0x01,
+	0xF0,0x01,0x10,0x00,0x10,0x00,0xE0,0x01,0x10,0x00,0x10,0x00,0xE0,0x01,
 
 	/* Index 78, character 110 "n" (width: 4 pixels) */
-	0x4, 0xF0,0x01,0x10,0x00,0x10,0x00,0xE0,0x01,
+	0xF0,0x01,0x10,0x00,0x10,0x00,0xE0,0x01,
 
 	/* Index 79, character 111 "o" (width: 4 pixels) */
-	0x4, 0xE0,0x00,0x10,0x01,0x10,0x01,0xE0,0x00,
+	0xE0,0x00,0x10,0x01,0x10,0x01,0xE0,0x00,
 
 	/* Index 80, character 112 "p" (width: 4 pixels) */
-	0x4, 0xF0,0x07,0x10,0x01,0x10,0x01,0xE0,0x00,
+	0xF0,0x07,0x10,0x01,0x10,0x01,0xE0,0x00,
 
 	/* Index 81, character 113 "q" (width: 4 pixels) */
-	0x4, 0xE0,0x00,0x10,0x01,0x10,0x01,0xF0,0x07,
+	0xE0,0x00,0x10,0x01,0x10,0x01,0xF0,0x07,
 
 	/* Index 82, character 114 "r" (width: 3 pixels) */
-	0x3, 0xF0,0x01,0x20,0x00,0x10,0x00,
+	0xF0,0x01,0x20,0x00,0x10,0x00,
 
 	/* Index 83, character 115 "s" (width: 3 pixels) */
-	0x3, 0x30,0x01,0x50,0x01,0x90,0x01,
+	0x30,0x01,0x50,0x01,0x90,0x01,
 
 	/* Index 84, character 116 "t" (width: 2 pixels) */
-	0x2, 0xF8,0x00,0x10,0x01,
+	0xF8,0x00,0x10,0x01,
 
 	/* Index 85, character 117 "u" (width: 4 pixels) */
-	0x4, 0xF0,0x00,0x00,0x01,0x00,0x01,0xF0,0x01,
+	0xF0,0x00,0x00,0x01,0x00,0x01,0xF0,0x01,
 
 	/* Index 86, character 118 "v" (width: 5 pixels) */
-	0x5, 0x10,0x00,0xE0,0x00,0x00,0x01,0xE0,0x00,0x10,0x00,
+	0x10,0x00,0xE0,0x00,0x00,0x01,0xE0,0x00,0x10,0x00,
 
 	/* Index 87, character 119 "w" (width: 7 pixels) */
-	0x7, 0x70,0x00,0x80,0x01,0xC0,0x00,0x30,0x00,0xC0,0x00,0x80,0x01,0x70,0x00,
+	0x70,0x00,0x80,0x01,0xC0,0x00,0x30,0x00,0xC0,0x00,0x80,0x01,0x70,0x00,
 
 	/* Index 88, character 120 "x" (width: 3 pixels) */
-	0x3, 0x10,0x01,0xE0,0x00,0x10,0x01,
+	0x10,0x01,0xE0,0x00,0x10,0x01,
 
 	/* Index 89, character 121 "y" (width: 5 pixels) */
-	0x5, 0x10,0x00,0xE0,0x04,0x00,0x03,0xE0,0x00,0x10,0x00,
+	0x10,0x00,0xE0,0x04,0x00,0x03,0xE0,0x00,0x10,0x00,
 
 	/* Index 90, character 122 "z" (width: 3 pixels) */
-	0x3, 0x90,0x01,0x50,0x01,0x30,0x01,
+	0x90,0x01,0x50,0x01,0x30,0x01,
 
 	/* Index 91, character 123 "{" (width: 3 pixels) */
-	0x3, 0x40,0x00,0xBC,0x03,0x02,0x04,
+	0x40,0x00,0xBC,0x03,0x02,0x04,
 
 	/* Index 92, character 124 "|" (width: 1 pixels) */
-	0x1, 0xFE,0x07,
+	0xFE,0x07,
 
 	/* Index 93, character 125 "}" (width: 3 pixels) */
-	0x3, 0x02,0x04,0xBC,0x03,0x40,0x00,
+	0x02,0x04,0xBC,0x03,0x40,0x00,
 
 	/* Index 94, character 126 "~" (width: 6 pixels) */
-	0x6, 0x40,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x20,0x00
+	0x40,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x20,0x00
+};
+
+// Offset of each bitmap in Tahoma7_bitmaps
+const unsigned short Tahoma7_offsets[] = 
+{
+	0x0,	// Index 0
+	0x2,	// Index 1
+	0x4,	// Index 2
+	0xA,	// Index 3
+	0x18,	// Index 4
+	0x22,	// Index 5
+	0x34,	// Index 6
+	0x40,	// Index 7
+	0x42,	// Index 8
+	0x48,	// Index 9
+	0x4E,	// Index 10
+	0x58,	// Index 11
+	0x62,	// Index 12
+	0x66,	// Index 13
+	0x6A,	// Index 14
+	0x6C,	// Index 15
+	0x72,	// Index 16
+	0x7A,	// Index 17
+	0x80,	// Index 18
+	0x88,	// Index 19
+	0x90,	// Index 20
+	0x9A,	// Index 21
+	0xA2,	// Index 22
+	0xAA,	// Index 23
+	0xB2,	// Index 24
+	0xBA,	// Index 25
+	0xC2,	// Index 26
+	0xC4,	// Index 27
+	0xC8,	// Index 28
+	0xD2,	// Index 29
+	0xDE,	// Index 30
+	0xE8,	// Index 31
+	0xF0,	// Index 32
+	0xFE,	// Index 33
+	0x10A,	// Index 34
+	0x114,	// Index 35
+	0x120,	// Index 36
+	0x12C,	// Index 37
+	0x136,	// Index 38
+	0x140,	// Index 39
+	0x14C,	// Index 40
+	0x158,	// Index 41
+	0x15E,	// Index 42
+	0x164,	// Index 43
+	0x16E,	// Index 44
+	0x176,	// Index 45
+	0x184,	// Index 46
+	0x190,	// Index 47
+	0x19E,	// Index 48
+	0x1A8,	// Index 49
+	0x1B6,	// Index 50
+	0x1C0,	// Index 51
+	0x1CA,	// Index 52
+	0x1D4,	// Index 53
+	0x1E0,	// Index 54
+	0x1EC,	// Index 55
+	0x1FA,	// Index 56
+	0x202,	// Index 57
+	0x20C,	// Index 58
+	0x214,	// Index 59
+	0x218,	// Index 60
+	0x21E,	// Index 61
+	0x222,	// Index 62
+	0x22C,	// Index 63
+	0x236,	// Index 64
+	0x23A,	// Index 65
+	0x242,	// Index 66
+	0x24A,	// Index 67
+	0x250,	// Index 68
+	0x258,	// Index 69
+	0x260,	// Index 70
+	0x266,	// Index 71
+	0x26E,	// Index 72
+	0x276,	// Index 73
+	0x278,	// Index 74
+	0x27C,	// Index 75
+	0x284,	// Index 76
+	0x286,	// Index 77
+	0x294,	// Index 78
+	0x29C,	// Index 79
+	0x2A4,	// Index 80
+	0x2AC,	// Index 81
+	0x2B4,	// Index 82
+	0x2BA,	// Index 83
+	0x2C0,	// Index 84
+	0x2C4,	// Index 85
+	0x2CC,	// Index 86
+	0x2D6,	// Index 87
+	0x2E4,	// Index 88
+	0x2EA,	// Index 89
+	0x2F4,	// Index 90
+	0x2FA,	// Index 91
+	0x300,	// Index 92
+	0x302,	// Index 93
+	0x308,	// Index 94
 };
+
+// Width of each bitmap in pixels
+const unsigned char Tahoma7_widths[] = 
+{
+	0x1,	// Index 0
+	0x1,	// Index 1
+	0x3,	// Index 2
+	0x7,	// Index 3
+	0x5,	// Index 4
+	0x9,	// Index 5
+	0x6,	// Index 6
+	0x1,	// Index 7
+	0x3,	// Index 8
+	0x3,	// Index 9
+	0x5,	// Index 10
+	0x5,	// Index 11
+	0x2,	// Index 12
+	0x2,	// Index 13
+	0x1,	// Index 14
+	0x3,	// Index 15
+	0x4,	// Index 16
+	0x3,	// Index 17
+	0x4,	// Index 18
+	0x4,	// Index 19
+	0x5,	// Index 20
+	0x4,	// Index 21
+	0x4,	// Index 22
+	0x4,	// Index 23
+	0x4,	// Index 24
+	0x4,	// Index 25
+	0x1,	// Index 26
+	0x2,	// Index 27
+	0x5,	// Index 28
+	0x6,	// Index 29
+	0x5,	// Index 30
+	0x4,	// Index 31
+	0x7,	// Index 32
+	0x6,	// Index 33
+	0x5,	// Index 34
+	0x6,	// Index 35
+	0x6,	// Index 36
+	0x5,	// Index 37
+	0x5,	// Index 38
+	0x6,	// Index 39
+	0x6,	// Index 40
+	0x3,	// Index 41
+	0x3,	// Index 42
+	0x5,	// Index 43
+	0x4,	// Index 44
+	0x7,	// Index 45
+	0x6,	// Index 46
+	0x7,	// Index 47
+	0x5,	// Index 48
+	0x7,	// Index 49
+	0x5,	// Index 50
+	0x5,	// Index 51
+	0x5,	// Index 52
+	0x6,	// Index 53
+	0x6,	// Index 54
+	0x7,	// Index 55
+	0x4,	// Index 56
+	0x5,	// Index 57
+	0x4,	// Index 58
+	0x2,	// Index 59
+	0x3,	// Index 60
+	0x2,	// Index 61
+	0x5,	// Index 62
+	0x5,	// Index 63
+	0x2,	// Index 64
+	0x4,	// Index 65
+	0x4,	// Index 66
+	0x3,	// Index 67
+	0x4,	// Index 68
+	0x4,	// Index 69
+	0x3,	// Index 70
+	0x4,	// Index 71
+	0x4,	// Index 72
+	0x1,	// Index 73
+	0x2,	// Index 74
+	0x4,	// Index 75
+	0x1,	// Index 76
+	0x7,	// Index 77
+	0x4,	// Index 78
+	0x4,	// Index 79
+	0x4,	// Index 80
+	0x4,	// Index 81
+	0x3,	// Index 82
+	0x3,	// Index 83
+	0x2,	// Index 84
+	0x4,	// Index 85
+	0x5,	// Index 86
+	0x7,	// Index 87
+	0x3,	// Index 88
+	0x5,	// Index 89
+	0x3,	// Index 90
+	0x3,	// Index 91
+	0x1,	// Index 92
+	0x3,	// Index 93
+	0x6,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Tahoma7_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x7, 0x0,	// Index 1
+	0x8, 0x0,	// Index 2
+	0x7, 0x0,	// Index 3
+	0x7, 0x2,	// Index 4
+	0x7, 0x0,	// Index 5
+	0x7, 0x0,	// Index 6
+	0x8, 0x0,	// Index 7
+	0x8, 0x2,	// Index 8
+	0x8, 0x2,	// Index 9
+	0x9, 0x0,	// Index 10
+	0x6, 0x0,	// Index 11
+	0x2, 0x1,	// Index 12
+	0x3, 0x0,	// Index 13
+	0x2, 0x0,	// Index 14
+	0x8, 0x1,	// Index 15
+	0x7, 0x0,	// Index 16
+	0x7, 0x0,	// Index 17
+	0x7, 0x0,	// Index 18
+	0x7, 0x0,	// Index 19
+	0x7, 0x0,	// Index 20
+	0x7, 0x0,	// Index 21
+	0x7, 0x0,	// Index 22
+	0x7, 0x0,	// Index 23
+	0x7, 0x0,	// Index 24
+	0x7, 0x0,	// Index 25
+	0x5, 0x0,	// Index 26
+	0x5, 0x1,	// Index 27
+	0x5, 0x0,	// Index 28
+	0x4, 0x0,	// Index 29
+	0x5, 0x0,	// Index 30
+	0x7, 0x0,	// Index 31
+	0x7, 0x1,	// Index 32
+	0x7, 0x0,	// Index 33
+	0x7, 0x0,	// Index 34
+	0x7, 0x0,	// Index 35
+	0x7, 0x0,	// Index 36
+	0x7, 0x0,	// Index 37
+	0x7, 0x0,	// Index 38
+	0x7, 0x0,	// Index 39
+	0x7, 0x0,	// Index 40
+	0x7, 0x0,	// Index 41
+	0x7, 0x0,	// Index 42
+	0x7, 0x0,	// Index 43
+	0x7, 0x0,	// Index 44
+	0x7, 0x0,	// Index 45
+	0x7, 0x0,	// Index 46
+	0x7, 0x0,	// Index 47
+	0x7, 0x0,	// Index 48
+	0x7, 0x2,	// Index 49
+	0x7, 0x0,	// Index 50
+	0x7, 0x0,	// Index 51
+	0x7, 0x0,	// Index 52
+	0x7, 0x0,	// Index 53
+	0x7, 0x0,	// Index 54
+	0x7, 0x0,	// Index 55
+	0x7, 0x0,	// Index 56
+	0x7, 0x0,	// Index 57
+	0x7, 0x0,	// Index 58
+	0x8, 0x2,	// Index 59
+	0x8, 0x1,	// Index 60
+	0x8, 0x2,	// Index 61
+	0x7, 0x0,	// Index 62
+	0x0, 0x2,	// Index 63
+	0x8, 0x0,	// Index 64
+	0x5, 0x0,	// Index 65
+	0x8, 0x0,	// Index 66
+	0x5, 0x0,	// Index 67
+	0x8, 0x0,	// Index 68
+	0x5, 0x0,	// Index 69
+	0x8, 0x0,	// Index 70
+	0x5, 0x2,	// Index 71
+	0x8, 0x0,	// Index 72
+	0x7, 0x0,	// Index 73
+	0x7, 0x2,	// Index 74
+	0x8, 0x0,	// Index 75
+	0x8, 0x0,	// Index 76
+	0x5, 0x0,	// Index 77
+	0x5, 0x0,	// Index 78
+	0x5, 0x0,	// Index 79
+	0x5, 0x2,	// Index 80
+	0x5, 0x2,	// Index 81
+	0x5, 0x0,	// Index 82
+	0x5, 0x0,	// Index 83
+	0x6, 0x0,	// Index 84
+	0x5, 0x0,	// Index 85
+	0x5, 0x0,	// Index 86
+	0x5, 0x0,	// Index 87
+	0x5, 0x0,	// Index 88
+	0x5, 0x2,	// Index 89
+	0x5, 0x0,	// Index 90
+	0x8, 0x2,	// Index 91
+	0x8, 0x2,	// Index 92
+	0x8, 0x2,	// Index 93
+	0x4, 0x0,	// Index 94
+};
+
+const font_t Tahoma7 = 
+{
+	Tahoma7_bitmaps,
+	Tahoma7_offsets,
+	Tahoma7_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0xB,	// Height 
+	0,	// Flags 
+	Tahoma7_extents,
+	0x9	// Ascent 
+};
+
 //---------------------------------------------------------------
 // Group Name: Tahoma32
 // Designer: Imported System Font
@@ -2450,398 +3706,607 @@ const unsigned char Tahoma7[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Tahoma32[] = 
+const unsigned char Tahoma32_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x2C,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xDC, // Index 1 (offset: 220)
-	0x0, 0xF5, // Index 2 (offset: 245)
-	0x1, 0x44, // Index 3 (offset: 324)
-	0x1, 0xDB, // Index 4 (offset: 475)
-	0x2, 0x4E, // Index 5 (offset: 590)
-	0x3, 0x33, // Index 6 (offset: 819)
-	0x3, 0xE2, // Index 7 (offset: 994)
-	0x4, 0x1, // Index 8 (offset: 1025)
-	0x4, 0x50, // Index 9 (offset: 1104)
-	0x4, 0x9F, // Index 10 (offset: 1183)
-	0x5, 0x12, // Index 11 (offset: 1298)
-	0x5, 0xA9, // Index 12 (offset: 1449)
-	0x5, 0xE0, // Index 13 (offset: 1504)
-	0x6, 0x29, // Index 14 (offset: 1577)
-	0x6, 0x48, // Index 15 (offset: 1608)
-	0x6, 0xA9, // Index 16 (offset: 1705)
-	0x7, 0x22, // Index 17 (offset: 1826)
-	0x7, 0x83, // Index 18 (offset: 1923)
-	0x7, 0xF6, // Index 19 (offset: 2038)
-	0x8, 0x69, // Index 20 (offset: 2153)
-	0x8, 0xEE, // Index 21 (offset: 2286)
-	0x9, 0x61, // Index 22 (offset: 2401)
-	0x9, 0xDA, // Index 23 (offset: 2522)
-	0xA, 0x53, // Index 24 (offset: 2643)
-	0xA, 0xCC, // Index 25 (offset: 2764)
-	0xB, 0x45, // Index 26 (offset: 2885)
-	0xB, 0x64, // Index 27 (offset: 2916)
-	0xB, 0x9B, // Index 28 (offset: 2971)
-	0xC, 0x26, // Index 29 (offset: 3110)
-	0xC, 0xB1, // Index 30 (offset: 3249)
-	0xD, 0x3C, // Index 31 (offset: 3388)
-	0xD, 0xA3, // Index 32 (offset: 3491)
-	0xE, 0x6A, // Index 33 (offset: 3690)
-	0xF, 0x7, // Index 34 (offset: 3847)
-	0xF, 0x86, // Index 35 (offset: 3974)
-	0x10, 0x17, // Index 36 (offset: 4119)
-	0x10, 0xAE, // Index 37 (offset: 4270)
-	0x11, 0x27, // Index 38 (offset: 4391)
-	0x11, 0x94, // Index 39 (offset: 4500)
-	0x12, 0x31, // Index 40 (offset: 4657)
-	0x12, 0xBC, // Index 41 (offset: 4796)
-	0x13, 0x5, // Index 42 (offset: 4869)
-	0x13, 0x60, // Index 43 (offset: 4960)
-	0x13, 0xEB, // Index 44 (offset: 5099)
-	0x14, 0x58, // Index 45 (offset: 5208)
-	0x14, 0xFB, // Index 46 (offset: 5371)
-	0x15, 0x86, // Index 47 (offset: 5510)
-	0x16, 0x2F, // Index 48 (offset: 5679)
-	0x16, 0xA8, // Index 49 (offset: 5800)
-	0x17, 0x51, // Index 50 (offset: 5969)
-	0x17, 0xE8, // Index 51 (offset: 6120)
-	0x18, 0x67, // Index 52 (offset: 6247)
-	0x19, 0x4, // Index 53 (offset: 6404)
-	0x19, 0x89, // Index 54 (offset: 6537)
-	0x1A, 0x26, // Index 55 (offset: 6694)
-	0x1B, 0x5, // Index 56 (offset: 6917)
-	0x1B, 0x9C, // Index 57 (offset: 7068)
-	0x1C, 0x39, // Index 58 (offset: 7225)
-	0x1C, 0xBE, // Index 59 (offset: 7358)
-	0x1D, 0x1, // Index 60 (offset: 7425)
-	0x1D, 0x62, // Index 61 (offset: 7522)
-	0x1D, 0xA5, // Index 62 (offset: 7589)
-	0x1E, 0x42, // Index 63 (offset: 7746)
-	0x1E, 0xCD, // Index 64 (offset: 7885)
-	0x1F, 0x4, // Index 65 (offset: 7940)
-	0x1F, 0x77, // Index 66 (offset: 8055)
-	0x1F, 0xF0, // Index 67 (offset: 8176)
-	0x20, 0x5D, // Index 68 (offset: 8285)
-	0x20, 0xD6, // Index 69 (offset: 8406)
-	0x21, 0x55, // Index 70 (offset: 8533)
-	0x21, 0xB0, // Index 71 (offset: 8624)
-	0x22, 0x29, // Index 72 (offset: 8745)
-	0x22, 0x96, // Index 73 (offset: 8854)
-	0x22, 0xAF, // Index 74 (offset: 8879)
-	0x22, 0xF2, // Index 75 (offset: 8946)
-	0x23, 0x65, // Index 76 (offset: 9061)
-	0x23, 0x7E, // Index 77 (offset: 9086)
-	0x24, 0x33, // Index 78 (offset: 9267)
-	0x24, 0xA0, // Index 79 (offset: 9376)
-	0x25, 0x1F, // Index 80 (offset: 9503)
-	0x25, 0x98, // Index 81 (offset: 9624)
-	0x26, 0x11, // Index 82 (offset: 9745)
-	0x26, 0x60, // Index 83 (offset: 9824)
-	0x26, 0xC1, // Index 84 (offset: 9921)
-	0x27, 0x16, // Index 85 (offset: 10006)
-	0x27, 0x83, // Index 86 (offset: 10115)
-	0x28, 0x2, // Index 87 (offset: 10242)
-	0x28, 0xB7, // Index 88 (offset: 10423)
-	0x29, 0x36, // Index 89 (offset: 10550)
-	0x29, 0xB5, // Index 90 (offset: 10677)
-	0x2A, 0x1C, // Index 91 (offset: 10780)
-	0x2A, 0x83, // Index 92 (offset: 10883)
-	0x2A, 0x9C, // Index 93 (offset: 10908)
-	0x2B, 0x3, // Index 94 (offset: 11011)
-
 	/* Index 0, character 32 " " (width: 4 pixels) */
-	0x4, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 4 pixels) */
-	0x4, 0xF0,0xFF,0xFF,0x81,0x07,0x00,0xF0,0xFF,0xFF,0x83,0x07,0x00,0xF0,0xFF,0xFF,0x83,0x07,0x00,0xF0,0xFF,0xFF,0x83,0x07,0x00,
+	0xF0,0xFF,0xFF,0x81,0x07,0x00,0xF0,0xFF,0xFF,0x83,0x07,0x00,0xF0,0xFF,0xFF,0x83,0x07,0x00,0xF0,0xFF,0xFF,0x83,0x07,0x00,
 
 	/* Index 2, character 34 """ (width: 13 pixels) */
-	0xD, 0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,
+	0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 25 pixels) */
-	0x19, 0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x06,0x00,0x00,0xE0,0x80,0xE3,0x07,0x00,0x00,0xE0,0x80,0xFF,0x07,0x00,0x00,0xE0,0xE0,0xFF,0x01,0x00,0x00,0xE0,0xFC,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0xFC,0xBF,0x03,0x00,0x00,0xC0,0xFF,0x83,0x03,0x00,0x00,0xF0,0xFF,0x80,0x03,0x06,0x00,0xF0,0xE3,0x80,0xE3,0x07,0x00,0x30,0xE0,0x80,0xFF,0x07,0x00,0x00,0xE0,0xE0,0xFF,0x01,0x00,0x00,0xE0,0xFE,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0xFE,0x9F,0x03,0x00,0x00,0xC0,0xFF,0x83,0x03,0x00,0x00,0xF0,0xFF,0x80,0x03,0x00,0x00,0xF0,0xE3,0x80,0x03,0x00,0x00,0x30,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x06,0x00,0x00,0xE0,0x80,0xE3,0x07,0x00,0x00,0xE0,0x80,0xFF,0x07,0x00,0x00,0xE0,0xE0,0xFF,0x01,0x00,0x00,0xE0,0xFC,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0xFC,0xBF,0x03,0x00,0x00,0xC0,0xFF,0x83,0x03,0x00,0x00,0xF0,0xFF,0x80,0x03,0x06,0x00,0xF0,0xE3,0x80,0xE3,0x07,0x00,0x30,0xE0,0x80,0xFF,0x07,0x00,0x00,0xE0,0xE0,0xFF,0x01,0x00,0x00,0xE0,0xFE,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0xFE,0x9F,0x03,0x00,0x00,0xC0,0xFF,0x83,0x03,0x00,0x00,0xF0,0xFF,0x80,0x03,0x00,0x00,0xF0,0xE3,0x80,0x03,0x00,0x00,0x30,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,
 
 	/* Index 4, character 36 "$" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x03,0xE0,0x01,0x00,0x00,0xF8,0x0F,0xC0,0x03,0x00,0x00,0xFC,0x1F,0xC0,0x03,0x00,0x00,0xFE,0x1F,0xC0,0x03,0x00,0x00,0x3E,0x3C,0x80,0x07,0x00,0x00,0x1E,0x38,0x80,0x07,0x00,0x00,0x0F,0x38,0x80,0x07,0x00,0x00,0x0F,0x70,0x80,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0x00,0x0F,0x70,0x80,0x07,0x00,0x00,0x0F,0xF0,0x80,0x07,0x00,0x00,0x0F,0xE0,0xC0,0x03,0x00,0x00,0x1F,0xE0,0xC0,0x03,0x00,0x00,0x1E,0xE0,0xE1,0x03,0x00,0x00,0x1E,0xC0,0xFF,0x01,0x00,0x00,0x3E,0xC0,0xFF,0x00,0x00,0x00,0x3E,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,
+	0x00,0xE0,0x03,0xE0,0x01,0x00,0x00,0xF8,0x0F,0xC0,0x03,0x00,0x00,0xFC,0x1F,0xC0,0x03,0x00,0x00,0xFE,0x1F,0xC0,0x03,0x00,0x00,0x3E,0x3C,0x80,0x07,0x00,0x00,0x1E,0x38,0x80,0x07,0x00,0x00,0x0F,0x38,0x80,0x07,0x00,0x00,0x0F,0x70,0x80,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0x00,0x0F,0x70,0x80,0x07,0x00,0x00,0x0F,0xF0,0x80,0x07,0x00,0x00,0x0F,0xE0,0xC0,0x03,0x00,0x00,0x1F,0xE0,0xC0,0x03,0x00,0x00,0x1E,0xE0,0xE1,0x03,0x00,0x00,0x1E,0xC0,0xFF,0x01,0x00,0x00,0x3E,0xC0,0xFF,0x00,0x00,0x00,0x3E,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,
 
 	/* Index 5, character 37 "%" (width: 38 pixels) */
-	0x26, 0x00,0xFF,0x01,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xF0,0x01,0x1F,0x00,0x00,0x00,0x70,0x00,0x3C,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x04,0x00,0x78,0x00,0x3C,0x00,0x07,0x00,0xF0,0x01,0x1F,0xC0,0x07,0x00,0xE0,0xFF,0x0F,0xF0,0x07,0x00,0xC0,0xFF,0x07,0xF8,0x01,0x00,0x00,0xFF,0x01,0x7E,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x3F,0xC0,0x7F,0x00,0x00,0xC0,0x0F,0xF0,0xFF,0x01,0x00,0xF0,0x03,0xF8,0xFF,0x03,0x00,0xF0,0x01,0x7C,0xC0,0x07,0x00,0x70,0x00,0x1C,0x00,0x0F,0x00,0x10,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x1E,0x00,0x0F,0x00,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,
+	0x00,0xFF,0x01,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xF0,0x01,0x1F,0x00,0x00,0x00,0x70,0x00,0x3C,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x04,0x00,0x78,0x00,0x3C,0x00,0x07,0x00,0xF0,0x01,0x1F,0xC0,0x07,0x00,0xE0,0xFF,0x0F,0xF0,0x07,0x00,0xC0,0xFF,0x07,0xF8,0x01,0x00,0x00,0xFF,0x01,0x7E,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x3F,0xC0,0x7F,0x00,0x00,0xC0,0x0F,0xF0,0xFF,0x01,0x00,0xF0,0x03,0xF8,0xFF,0x03,0x00,0xF0,0x01,0x7C,0xC0,0x07,0x00,0x70,0x00,0x1C,0x00,0x0F,0x00,0x10,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x1E,0x00,0x0F,0x00,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,
 
 	/* Index 6, character 38 "&" (width: 29 pixels) */
-	0x1D, 0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x1F,0xF0,0xFF,0x01,0x00,0xC0,0x7F,0xF8,0xFF,0x03,0x00,0xE0,0xFF,0x7C,0xF0,0x07,0x00,0xF0,0xFF,0x1D,0xC0,0x07,0x00,0xF0,0xE1,0x0F,0x80,0x0F,0x00,0xF8,0xC0,0x07,0x80,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x0F,0x00,0x0F,0x00,0x78,0x00,0x1F,0x00,0x0F,0x00,0x78,0x80,0x3F,0x00,0x0F,0x00,0xF8,0xC0,0x7D,0x00,0x0F,0x00,0xF0,0xE1,0xF9,0x00,0x07,0x00,0xF0,0xFF,0xF0,0x81,0x07,0x00,0xE0,0x7F,0xE0,0x83,0x03,0x00,0xE0,0x3F,0xC0,0xC7,0x03,0x00,0x80,0x0F,0x80,0xEF,0x01,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xF1,0x03,0x00,0x00,0x00,0x3F,0xE0,0x07,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+	0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x1F,0xF0,0xFF,0x01,0x00,0xC0,0x7F,0xF8,0xFF,0x03,0x00,0xE0,0xFF,0x7C,0xF0,0x07,0x00,0xF0,0xFF,0x1D,0xC0,0x07,0x00,0xF0,0xE1,0x0F,0x80,0x0F,0x00,0xF8,0xC0,0x07,0x80,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x0F,0x00,0x0F,0x00,0x78,0x00,0x1F,0x00,0x0F,0x00,0x78,0x80,0x3F,0x00,0x0F,0x00,0xF8,0xC0,0x7D,0x00,0x0F,0x00,0xF0,0xE1,0xF9,0x00,0x07,0x00,0xF0,0xFF,0xF0,0x81,0x07,0x00,0xE0,0x7F,0xE0,0x83,0x03,0x00,0xE0,0x3F,0xC0,0xC7,0x03,0x00,0x80,0x0F,0x80,0xEF,0x01,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFF,0xF1,0x03,0x00,0x00,0x00,0x3F,0xE0,0x07,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
 
 	/* Index 7, character 39 "'" (width: 5 pixels) */
-	0x5, 0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,
+	0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 13 pixels) */
-	0xD, 0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0xF8,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x80,0xFF,0x03,0xF0,0x7F,0x00,0xE0,0x3F,0x00,0x00,0xFF,0x01,0xF0,0x07,0x00,0x00,0xF8,0x03,0xF8,0x01,0x00,0x00,0xE0,0x07,0xFC,0x00,0x00,0x00,0xC0,0x0F,0x3C,0x00,0x00,0x00,0x00,0x0F,0x1C,0x00,0x00,0x00,0x00,0x0E,0x0C,0x00,0x00,0x00,0x00,0x0C,0x04,0x00,0x00,0x00,0x00,0x08,
+	0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0xF8,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x80,0xFF,0x03,0xF0,0x7F,0x00,0xE0,0x3F,0x00,0x00,0xFF,0x01,0xF0,0x07,0x00,0x00,0xF8,0x03,0xF8,0x01,0x00,0x00,0xE0,0x07,0xFC,0x00,0x00,0x00,0xC0,0x0F,0x3C,0x00,0x00,0x00,0x00,0x0F,0x1C,0x00,0x00,0x00,0x00,0x0E,0x0C,0x00,0x00,0x00,0x00,0x0C,0x04,0x00,0x00,0x00,0x00,0x08,
 
 	/* Index 9, character 41 ")" (width: 13 pixels) */
-	0xD, 0x04,0x00,0x00,0x00,0x00,0x08,0x0C,0x00,0x00,0x00,0x00,0x0C,0x1C,0x00,0x00,0x00,0x00,0x0E,0x3C,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0xC0,0x0F,0xF8,0x01,0x00,0x00,0xE0,0x07,0xF0,0x07,0x00,0x00,0xF8,0x03,0xE0,0x3F,0x00,0x00,0xFF,0x01,0x80,0xFF,0x03,0xF0,0x7F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,
+	0x04,0x00,0x00,0x00,0x00,0x08,0x0C,0x00,0x00,0x00,0x00,0x0C,0x1C,0x00,0x00,0x00,0x00,0x0E,0x3C,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0xC0,0x0F,0xF8,0x01,0x00,0x00,0xE0,0x07,0xF0,0x07,0x00,0x00,0xF8,0x03,0xE0,0x3F,0x00,0x00,0xFF,0x01,0x80,0xFF,0x03,0xF0,0x7F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,
 
 	/* Index 10, character 42 "*" (width: 19 pixels) */
-	0x13, 0xC0,0x80,0x01,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xC0,0x80,0x01,0x00,0x00,0x00,
+	0xC0,0x80,0x01,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xC0,0x80,0x01,0x00,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 25 pixels) */
-	0x19, 0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,
+	0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,
 
 	/* Index 12, character 44 "," (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x20,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x20,0x00,0x00,
 
 	/* Index 13, character 45 "-" (width: 12 pixels) */
-	0xC, 0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,
+	0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,
 
 	/* Index 14, character 46 "." (width: 5 pixels) */
-	0x5, 0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,
+	0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,
 
 	/* Index 15, character 47 "/" (width: 16 pixels) */
-	0x10, 0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 16, character 48 "0" (width: 20 pixels) */
-	0x14, 0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x80,0xFF,0xFF,0xFF,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0x01,0x00,0xE0,0x0F,0x00,0xF8,0x03,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x03,0x00,0xE0,0x07,0x00,0xE0,0x1F,0x00,0xFC,0x03,0x00,0xC0,0xFF,0xFF,0xFF,0x01,0x00,0x80,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,
+	0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x80,0xFF,0xFF,0xFF,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0x01,0x00,0xE0,0x0F,0x00,0xF8,0x03,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x03,0x00,0xE0,0x07,0x00,0xE0,0x1F,0x00,0xFC,0x03,0x00,0xC0,0xFF,0xFF,0xFF,0x01,0x00,0x80,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,
 
 	/* Index 17, character 49 "1" (width: 16 pixels) */
-	0x10, 0x00,0x07,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,
+	0x00,0x07,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,
 
 	/* Index 18, character 50 "2" (width: 19 pixels) */
-	0x13, 0x00,0x00,0x00,0xC0,0x07,0x00,0xE0,0x01,0x00,0xE0,0x07,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xF8,0x07,0x00,0xF0,0x00,0x00,0xBC,0x07,0x00,0x78,0x00,0x00,0xBE,0x07,0x00,0x78,0x00,0x00,0x9F,0x07,0x00,0x78,0x00,0x80,0x8F,0x07,0x00,0x78,0x00,0xC0,0x87,0x07,0x00,0x78,0x00,0xE0,0x83,0x07,0x00,0x78,0x00,0xF0,0x81,0x07,0x00,0xF8,0x00,0xF8,0x80,0x07,0x00,0xF0,0x00,0x7E,0x80,0x07,0x00,0xF0,0x83,0x3F,0x80,0x07,0x00,0xF0,0xFF,0x0F,0x80,0x07,0x00,0xE0,0xFF,0x07,0x80,0x07,0x00,0xC0,0xFF,0x03,0x80,0x07,0x00,0x00,0x7F,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,
+	0x00,0x00,0x00,0xC0,0x07,0x00,0xE0,0x01,0x00,0xE0,0x07,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xF8,0x07,0x00,0xF0,0x00,0x00,0xBC,0x07,0x00,0x78,0x00,0x00,0xBE,0x07,0x00,0x78,0x00,0x00,0x9F,0x07,0x00,0x78,0x00,0x80,0x8F,0x07,0x00,0x78,0x00,0xC0,0x87,0x07,0x00,0x78,0x00,0xE0,0x83,0x07,0x00,0x78,0x00,0xF0,0x81,0x07,0x00,0xF8,0x00,0xF8,0x80,0x07,0x00,0xF0,0x00,0x7E,0x80,0x07,0x00,0xF0,0x83,0x3F,0x80,0x07,0x00,0xF0,0xFF,0x0F,0x80,0x07,0x00,0xE0,0xFF,0x07,0x80,0x07,0x00,0xC0,0xFF,0x03,0x80,0x07,0x00,0x00,0x7F,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,
 
 	/* Index 19, character 51 "3" (width: 19 pixels) */
-	0x13, 0x00,0x00,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x80,0x0F,0x80,0x0F,0x00,0xF8,0xC0,0x1F,0x80,0x07,0x00,0xF0,0xE1,0x1D,0xC0,0x07,0x00,0xF0,0xFF,0x7D,0xF0,0x03,0x00,0xE0,0xFF,0xF8,0xFF,0x03,0x00,0xC0,0x7F,0xF0,0xFF,0x01,0x00,0x00,0x1F,0xE0,0x7F,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,
+	0x00,0x00,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x80,0x0F,0x80,0x0F,0x00,0xF8,0xC0,0x1F,0x80,0x07,0x00,0xF0,0xE1,0x1D,0xC0,0x07,0x00,0xF0,0xFF,0x7D,0xF0,0x03,0x00,0xE0,0xFF,0xF8,0xFF,0x03,0x00,0xC0,0x7F,0xF0,0xFF,0x01,0x00,0x00,0x1F,0xE0,0x7F,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,
 
 	/* Index 20, character 52 "4" (width: 22 pixels) */
-	0x16, 0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x80,0xF7,0x00,0x00,0x00,0x00,0xC0,0xF3,0x00,0x00,0x00,0x00,0xE0,0xF1,0x00,0x00,0x00,0x00,0xF0,0xF0,0x00,0x00,0x00,0x00,0x78,0xF0,0x00,0x00,0x00,0x00,0x3C,0xF0,0x00,0x00,0x00,0x00,0x1E,0xF0,0x00,0x00,0x00,0x00,0x0F,0xF0,0x00,0x00,0x00,0x80,0x07,0xF0,0x00,0x00,0x00,0xC0,0x03,0xF0,0x00,0x00,0x00,0xE0,0x01,0xF0,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,
+	0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x80,0xF7,0x00,0x00,0x00,0x00,0xC0,0xF3,0x00,0x00,0x00,0x00,0xE0,0xF1,0x00,0x00,0x00,0x00,0xF0,0xF0,0x00,0x00,0x00,0x00,0x78,0xF0,0x00,0x00,0x00,0x00,0x3C,0xF0,0x00,0x00,0x00,0x00,0x1E,0xF0,0x00,0x00,0x00,0x00,0x0F,0xF0,0x00,0x00,0x00,0x80,0x07,0xF0,0x00,0x00,0x00,0xC0,0x03,0xF0,0x00,0x00,0x00,0xE0,0x01,0xF0,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,
 
 	/* Index 21, character 53 "5" (width: 19 pixels) */
-	0x13, 0x00,0x00,0x00,0xC0,0x07,0x00,0xF0,0xFF,0x1F,0x80,0x07,0x00,0xF0,0xFF,0x1F,0x80,0x07,0x00,0xF0,0xFF,0x0F,0x80,0x07,0x00,0xF0,0xFF,0x0F,0x80,0x0F,0x00,0xF0,0x00,0x0F,0x00,0x0F,0x00,0xF0,0x00,0x0F,0x00,0x0F,0x00,0xF0,0x00,0x0F,0x00,0x0F,0x00,0xF0,0x00,0x0F,0x00,0x0F,0x00,0xF0,0x00,0x0F,0x00,0x0F,0x00,0xF0,0x00,0x0F,0x00,0x0F,0x00,0xF0,0x00,0x1F,0x80,0x0F,0x00,0xF0,0x00,0x1F,0x80,0x07,0x00,0xF0,0x00,0x3E,0xC0,0x07,0x00,0xF0,0x00,0x7E,0xF0,0x03,0x00,0xF0,0x00,0xFC,0xFF,0x03,0x00,0xF0,0x00,0xF8,0xFF,0x01,0x00,0xF0,0x00,0xF0,0x7F,0x00,0x00,0xF0,0x00,0xC0,0x1F,0x00,0x00,
+	0x00,0x00,0x00,0xC0,0x07,0x00,0xF0,0xFF,0x1F,0x80,0x07,0x00,0xF0,0xFF,0x1F,0x80,0x07,0x00,0xF0,0xFF,0x0F,0x80,0x07,0x00,0xF0,0xFF,0x0F,0x80,0x0F,0x00,0xF0,0x00,0x0F,0x00,0x0F,0x00,0xF0,0x00,0x0F,0x00,0x0F,0x00,0xF0,0x00,0x0F,0x00,0x0F,0x00,0xF0,0x00,0x0F,0x00,0x0F,0x00,0xF0,0x00,0x0F,0x00,0x0F,0x00,0xF0,0x00,0x0F,0x00,0x0F,0x00,0xF0,0x00,0x1F,0x80,0x0F,0x00,0xF0,0x00,0x1F,0x80,0x07,0x00,0xF0,0x00,0x3E,0xC0,0x07,0x00,0xF0,0x00,0x7E,0xF0,0x03,0x00,0xF0,0x00,0xFC,0xFF,0x03,0x00,0xF0,0x00,0xF8,0xFF,0x01,0x00,0xF0,0x00,0xF0,0x7F,0x00,0x00,0xF0,0x00,0xC0,0x1F,0x00,0x00,
 
 	/* Index 22, character 54 "6" (width: 20 pixels) */
-	0x14, 0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0xF0,0xFF,0x3F,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x01,0x00,0x80,0x3F,0x0E,0xF8,0x03,0x00,0xC0,0x0F,0x0F,0xE0,0x07,0x00,0xE0,0x03,0x0F,0x80,0x07,0x00,0xF0,0x81,0x07,0x80,0x0F,0x00,0xF0,0x80,0x07,0x00,0x0F,0x00,0xF0,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x0F,0x80,0x07,0x00,0x78,0x00,0x1F,0xC0,0x07,0x00,0x78,0x00,0x3F,0xF0,0x03,0x00,0xF8,0x00,0xFE,0xFF,0x03,0x00,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,
+	0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0xF0,0xFF,0x3F,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x01,0x00,0x80,0x3F,0x0E,0xF8,0x03,0x00,0xC0,0x0F,0x0F,0xE0,0x07,0x00,0xE0,0x03,0x0F,0x80,0x07,0x00,0xF0,0x81,0x07,0x80,0x0F,0x00,0xF0,0x80,0x07,0x00,0x0F,0x00,0xF0,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x0F,0x80,0x07,0x00,0x78,0x00,0x1F,0xC0,0x07,0x00,0x78,0x00,0x3F,0xF0,0x03,0x00,0xF8,0x00,0xFE,0xFF,0x03,0x00,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,
 
 	/* Index 23, character 55 "7" (width: 20 pixels) */
-	0x14, 0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x04,0x00,0xF0,0x00,0x00,0x00,0x07,0x00,0xF0,0x00,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xFC,0x07,0x00,0xF0,0x00,0x00,0xFE,0x01,0x00,0xF0,0x00,0x80,0x7F,0x00,0x00,0xF0,0x00,0xE0,0x1F,0x00,0x00,0xF0,0x00,0xF8,0x07,0x00,0x00,0xF0,0x00,0xFE,0x01,0x00,0x00,0xF0,0x80,0x7F,0x00,0x00,0x00,0xF0,0xE0,0x1F,0x00,0x00,0x00,0xF0,0xF8,0x07,0x00,0x00,0x00,0xF0,0xFE,0x03,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,
+	0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x04,0x00,0xF0,0x00,0x00,0x00,0x07,0x00,0xF0,0x00,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xFC,0x07,0x00,0xF0,0x00,0x00,0xFE,0x01,0x00,0xF0,0x00,0x80,0x7F,0x00,0x00,0xF0,0x00,0xE0,0x1F,0x00,0x00,0xF0,0x00,0xF8,0x07,0x00,0x00,0xF0,0x00,0xFE,0x01,0x00,0x00,0xF0,0x80,0x7F,0x00,0x00,0x00,0xF0,0xE0,0x1F,0x00,0x00,0x00,0xF0,0xF8,0x07,0x00,0x00,0x00,0xF0,0xFE,0x03,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,
 
 	/* Index 24, character 56 "8" (width: 20 pixels) */
-	0x14, 0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0xC0,0xFF,0x00,0x00,0x80,0xFF,0xF0,0xFF,0x01,0x00,0xE0,0xFF,0xF1,0xFF,0x03,0x00,0xE0,0xFF,0x7B,0xF0,0x07,0x00,0xF0,0xE1,0x1F,0xC0,0x07,0x00,0xF0,0xC0,0x0F,0x80,0x0F,0x00,0x78,0x80,0x0F,0x80,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x3E,0x00,0x0F,0x00,0xF0,0x00,0x3F,0x80,0x07,0x00,0xF0,0x81,0x7F,0xC0,0x07,0x00,0xF0,0xFF,0xFB,0xE0,0x07,0x00,0xE0,0xFF,0xF1,0xFF,0x03,0x00,0xC0,0xFF,0xF0,0xFF,0x01,0x00,0x00,0x3F,0xC0,0xFF,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,
+	0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0xC0,0xFF,0x00,0x00,0x80,0xFF,0xF0,0xFF,0x01,0x00,0xE0,0xFF,0xF1,0xFF,0x03,0x00,0xE0,0xFF,0x7B,0xF0,0x07,0x00,0xF0,0xE1,0x1F,0xC0,0x07,0x00,0xF0,0xC0,0x0F,0x80,0x0F,0x00,0x78,0x80,0x0F,0x80,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x3E,0x00,0x0F,0x00,0xF0,0x00,0x3F,0x80,0x07,0x00,0xF0,0x81,0x7F,0xC0,0x07,0x00,0xF0,0xFF,0xFB,0xE0,0x07,0x00,0xE0,0xFF,0xF1,0xFF,0x03,0x00,0xC0,0xFF,0xF0,0xFF,0x01,0x00,0x00,0x3F,0xC0,0xFF,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,
 
 	/* Index 25, character 57 "9" (width: 20 pixels) */
-	0x14, 0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x3F,0x80,0x0F,0x00,0xE0,0x07,0x7E,0x00,0x0F,0x00,0xF0,0x01,0x7C,0x00,0x0F,0x00,0xF0,0x00,0xF8,0x00,0x0F,0x00,0x78,0x00,0xF0,0x00,0x0F,0x00,0x78,0x00,0xF0,0x00,0x0F,0x00,0x78,0x00,0xF0,0x00,0x0F,0x00,0x78,0x00,0xF0,0x80,0x07,0x00,0x78,0x00,0xF0,0x80,0x07,0x00,0xF8,0x00,0xF0,0xC0,0x07,0x00,0xF0,0x00,0x78,0xE0,0x03,0x00,0xF0,0x03,0x78,0xF0,0x01,0x00,0xE0,0x0F,0x38,0xFE,0x00,0x00,0xC0,0xFF,0xFF,0x7F,0x00,0x00,0x80,0xFF,0xFF,0x3F,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,
+	0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x3F,0x80,0x0F,0x00,0xE0,0x07,0x7E,0x00,0x0F,0x00,0xF0,0x01,0x7C,0x00,0x0F,0x00,0xF0,0x00,0xF8,0x00,0x0F,0x00,0x78,0x00,0xF0,0x00,0x0F,0x00,0x78,0x00,0xF0,0x00,0x0F,0x00,0x78,0x00,0xF0,0x00,0x0F,0x00,0x78,0x00,0xF0,0x80,0x07,0x00,0x78,0x00,0xF0,0x80,0x07,0x00,0xF8,0x00,0xF0,0xC0,0x07,0x00,0xF0,0x00,0x78,0xE0,0x03,0x00,0xF0,0x03,0x78,0xF0,0x01,0x00,0xE0,0x0F,0x38,0xFE,0x00,0x00,0xC0,0xFF,0xFF,0x7F,0x00,0x00,0x80,0xFF,0xFF,0x3F,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,
 
 	/* Index 26, character 58 ":" (width: 5 pixels) */
-	0x5, 0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,
+	0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,
 
 	/* Index 27, character 59 ";" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0xF0,0x03,0xC0,0xFF,0x03,0x00,0xF0,0x03,0xE0,0xFF,0x00,0x00,0xF0,0x03,0xE0,0x1F,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x01,0x00,0x00,0x00,0x00,0x20,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0xF0,0x03,0xC0,0xFF,0x03,0x00,0xF0,0x03,0xE0,0xFF,0x00,0x00,0xF0,0x03,0xE0,0x1F,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x01,0x00,0x00,0x00,0x00,0x20,0x00,0x00,
 
 	/* Index 28, character 60 "<" (width: 23 pixels) */
-	0x17, 0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xEE,0x00,0x00,0x00,0x00,0x00,0xEF,0x01,0x00,0x00,0x00,0x00,0xC7,0x01,0x00,0x00,0x00,0x80,0xC7,0x03,0x00,0x00,0x00,0x80,0x83,0x03,0x00,0x00,0x00,0xC0,0x83,0x07,0x00,0x00,0x00,0xC0,0x01,0x07,0x00,0x00,0x00,0xE0,0x01,0x0F,0x00,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0x00,0xF0,0x00,0x1E,0x00,0x00,0x00,0x70,0x00,0x1C,0x00,0x00,0x00,0x78,0x00,0x3C,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x3C,0x00,0x78,0x00,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x00,0x1E,0x00,0xF0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0F,0x00,0xE0,0x01,0x00,
+	0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xEE,0x00,0x00,0x00,0x00,0x00,0xEF,0x01,0x00,0x00,0x00,0x00,0xC7,0x01,0x00,0x00,0x00,0x80,0xC7,0x03,0x00,0x00,0x00,0x80,0x83,0x03,0x00,0x00,0x00,0xC0,0x83,0x07,0x00,0x00,0x00,0xC0,0x01,0x07,0x00,0x00,0x00,0xE0,0x01,0x0F,0x00,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0x00,0xF0,0x00,0x1E,0x00,0x00,0x00,0x70,0x00,0x1C,0x00,0x00,0x00,0x78,0x00,0x3C,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x3C,0x00,0x78,0x00,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x00,0x1E,0x00,0xF0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0F,0x00,0xE0,0x01,0x00,
 
 	/* Index 29, character 61 "=" (width: 23 pixels) */
-	0x17, 0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,
+	0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,
 
 	/* Index 30, character 62 ">" (width: 23 pixels) */
-	0x17, 0x00,0x0F,0x00,0xE0,0x01,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xF0,0x00,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x00,0x3C,0x00,0x78,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x78,0x00,0x3C,0x00,0x00,0x00,0x70,0x00,0x1C,0x00,0x00,0x00,0xF0,0x00,0x1E,0x00,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0x00,0xE0,0x01,0x0F,0x00,0x00,0x00,0xC0,0x01,0x07,0x00,0x00,0x00,0xC0,0x83,0x07,0x00,0x00,0x00,0x80,0x83,0x03,0x00,0x00,0x00,0x80,0xC7,0x03,0x00,0x00,0x00,0x00,0xC7,0x01,0x00,0x00,0x00,0x00,0xEF,0x01,0x00,0x00,0x00,0x00,0xEE,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,
+	0x00,0x0F,0x00,0xE0,0x01,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xF0,0x00,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x00,0x3C,0x00,0x78,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x78,0x00,0x3C,0x00,0x00,0x00,0x70,0x00,0x1C,0x00,0x00,0x00,0xF0,0x00,0x1E,0x00,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0x00,0xE0,0x01,0x0F,0x00,0x00,0x00,0xC0,0x01,0x07,0x00,0x00,0x00,0xC0,0x83,0x07,0x00,0x00,0x00,0x80,0x83,0x03,0x00,0x00,0x00,0x80,0xC7,0x03,0x00,0x00,0x00,0x00,0xC7,0x01,0x00,0x00,0x00,0x00,0xEF,0x01,0x00,0x00,0x00,0x00,0xEE,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,
 
 	/* Index 31, character 63 "?" (width: 17 pixels) */
-	0x11, 0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0xF0,0x87,0x07,0x00,0x78,0x00,0xF0,0x87,0x07,0x00,0x78,0x00,0xF8,0x87,0x07,0x00,0x78,0x00,0x3C,0x00,0x00,0x00,0x78,0x00,0x1C,0x00,0x00,0x00,0xF8,0x00,0x1E,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0xC1,0x07,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,
+	0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0xF0,0x87,0x07,0x00,0x78,0x00,0xF0,0x87,0x07,0x00,0x78,0x00,0xF8,0x87,0x07,0x00,0x78,0x00,0x3C,0x00,0x00,0x00,0x78,0x00,0x1C,0x00,0x00,0x00,0xF8,0x00,0x1E,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0xC1,0x07,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 33 pixels) */
-	0x21, 0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x00,0x00,0x00,0xFC,0x01,0xFC,0x01,0x00,0x00,0x3E,0x00,0xE0,0x03,0x00,0x00,0x0F,0x00,0x80,0x0F,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0xC0,0x03,0x00,0x00,0x1E,0x00,0xE0,0x01,0xFC,0x03,0x3C,0x00,0xE0,0x80,0xFF,0x1F,0x38,0x00,0xF0,0xC0,0xFF,0x3F,0x70,0x00,0x70,0xE0,0x03,0x7C,0x70,0x00,0x70,0xF0,0x00,0x70,0x70,0x00,0x38,0x70,0x00,0xF0,0xE0,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0x70,0xE0,0x00,0x38,0x78,0x00,0x70,0xE0,0x00,0x38,0x70,0x00,0x38,0xE0,0x00,0x70,0xF8,0xFF,0xFF,0xE0,0x00,0x70,0xF8,0xFF,0xFF,0xF0,0x00,0xF0,0xF8,0xFF,0xFF,0x70,0x00,0xE0,0x00,0x00,0xC0,0x00,0x00,0xE0,0x01,0x00,0xC0,0x00,0x00,0xC0,0x03,0x00,0xC0,0x00,0x00,0x80,0x0F,0x00,0xC0,0x00,0x00,0x00,0x1F,0x00,0xC0,0x00,0x00,0x00,0xFE,0x01,0xF8,0x00,0x00,0x00,0xF8,0xFF,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,
+	0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x00,0x00,0x00,0xFC,0x01,0xFC,0x01,0x00,0x00,0x3E,0x00,0xE0,0x03,0x00,0x00,0x0F,0x00,0x80,0x0F,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0xC0,0x03,0x00,0x00,0x1E,0x00,0xE0,0x01,0xFC,0x03,0x3C,0x00,0xE0,0x80,0xFF,0x1F,0x38,0x00,0xF0,0xC0,0xFF,0x3F,0x70,0x00,0x70,0xE0,0x03,0x7C,0x70,0x00,0x70,0xF0,0x00,0x70,0x70,0x00,0x38,0x70,0x00,0xF0,0xE0,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0x70,0xE0,0x00,0x38,0x78,0x00,0x70,0xE0,0x00,0x38,0x70,0x00,0x38,0xE0,0x00,0x70,0xF8,0xFF,0xFF,0xE0,0x00,0x70,0xF8,0xFF,0xFF,0xF0,0x00,0xF0,0xF8,0xFF,0xFF,0x70,0x00,0xE0,0x00,0x00,0xC0,0x00,0x00,0xE0,0x01,0x00,0xC0,0x00,0x00,0xC0,0x03,0x00,0xC0,0x00,0x00,0x80,0x0F,0x00,0xC0,0x00,0x00,0x00,0x1F,0x00,0xC0,0x00,0x00,0x00,0xFE,0x01,0xF8,0x00,0x00,0x00,0xF8,0xFF,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,
 
 	/* Index 33, character 65 "A" (width: 26 pixels) */
-	0x1A, 0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x07,0x00,0x00,0x00,0xFC,0xBF,0x07,0x00,0x00,0x80,0xFF,0x87,0x07,0x00,0x00,0xF0,0xFF,0x80,0x07,0x00,0x00,0xF0,0x1F,0x80,0x07,0x00,0x00,0xF0,0x03,0x80,0x07,0x00,0x00,0xF0,0x03,0x80,0x07,0x00,0x00,0xF0,0x1F,0x80,0x07,0x00,0x00,0xF0,0xFF,0x80,0x07,0x00,0x00,0x80,0xFF,0x87,0x07,0x00,0x00,0x00,0xFC,0xBF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+	0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x07,0x00,0x00,0x00,0xFC,0xBF,0x07,0x00,0x00,0x80,0xFF,0x87,0x07,0x00,0x00,0xF0,0xFF,0x80,0x07,0x00,0x00,0xF0,0x1F,0x80,0x07,0x00,0x00,0xF0,0x03,0x80,0x07,0x00,0x00,0xF0,0x03,0x80,0x07,0x00,0x00,0xF0,0x1F,0x80,0x07,0x00,0x00,0xF0,0xFF,0x80,0x07,0x00,0x00,0x80,0xFF,0x87,0x07,0x00,0x00,0x00,0xFC,0xBF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
 
 	/* Index 34, character 66 "B" (width: 21 pixels) */
-	0x15, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1F,0xC0,0x07,0x00,0xF0,0x01,0x3F,0xC0,0x03,0x00,0xE0,0x83,0x3F,0xE0,0x03,0x00,0xE0,0xFF,0x7B,0xF0,0x01,0x00,0xC0,0xFF,0xF9,0xFF,0x01,0x00,0x80,0xFF,0xF0,0xFF,0x00,0x00,0x00,0x3F,0xE0,0x7F,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1E,0x80,0x07,0x00,0xF0,0x00,0x1F,0xC0,0x07,0x00,0xF0,0x01,0x3F,0xC0,0x03,0x00,0xE0,0x83,0x3F,0xE0,0x03,0x00,0xE0,0xFF,0x7B,0xF0,0x01,0x00,0xC0,0xFF,0xF9,0xFF,0x01,0x00,0x80,0xFF,0xF0,0xFF,0x00,0x00,0x00,0x3F,0xE0,0x7F,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,
 
 	/* Index 35, character 67 "C" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0xE0,0x07,0x00,0xF0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x07,0x00,0xF0,0x01,0x00,
+	0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0xE0,0x07,0x00,0xF0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x07,0x00,0xF0,0x01,0x00,
 
 	/* Index 36, character 68 "D" (width: 25 pixels) */
-	0x19, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0xE0,0x03,0x00,0xC0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0x80,0x1F,0x00,0xFC,0x00,0x00,0x00,0xFF,0x00,0x7F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x07,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0xE0,0x03,0x00,0xC0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0x80,0x1F,0x00,0xFC,0x00,0x00,0x00,0xFF,0x00,0x7F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x07,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,
 
 	/* Index 37, character 69 "E" (width: 20 pixels) */
-	0x14, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,
 
 	/* Index 38, character 70 "F" (width: 18 pixels) */
-	0x12, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 39, character 71 "G" (width: 26 pixels) */
-	0x1A, 0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF0,0xFF,0x0F,0x00,0x00,0x00,0xFC,0xFF,0x3F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x0F,0x00,0xFC,0x01,0x00,0xE0,0x07,0x00,0xF0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0xF8,0x00,0x78,0x00,0x0F,0x00,0xF0,0x00,0x78,0x80,0x07,0x00,0xF0,0x00,0x78,0x80,0x07,0x00,0xF0,0x01,0xF8,0xFF,0x07,0x00,0xE0,0x01,0xF8,0xFF,0x03,0x00,0xE0,0x03,0xF8,0xFF,0x03,0x00,0xC0,0x07,0xF8,0xFF,0x01,0x00,
+	0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF0,0xFF,0x0F,0x00,0x00,0x00,0xFC,0xFF,0x3F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x0F,0x00,0xFC,0x01,0x00,0xE0,0x07,0x00,0xF0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0xF8,0x00,0x78,0x00,0x0F,0x00,0xF0,0x00,0x78,0x80,0x07,0x00,0xF0,0x00,0x78,0x80,0x07,0x00,0xF0,0x01,0xF8,0xFF,0x07,0x00,0xE0,0x01,0xF8,0xFF,0x03,0x00,0xE0,0x03,0xF8,0xFF,0x03,0x00,0xC0,0x07,0xF8,0xFF,0x01,0x00,
 
 	/* Index 40, character 72 "H" (width: 23 pixels) */
-	0x17, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,
 
 	/* Index 41, character 73 "I" (width: 12 pixels) */
-	0xC, 0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,
+	0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,
 
 	/* Index 42, character 74 "J" (width: 15 pixels) */
-	0xF, 0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x80,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0xC0,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0x7F,0x00,0x00,
+	0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x80,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0xC0,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0x7F,0x00,0x00,
 
 	/* Index 43, character 75 "K" (width: 23 pixels) */
-	0x17, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0xF0,0xFD,0x01,0x00,0x00,0x00,0xF8,0xF0,0x03,0x00,0x00,0x00,0x7E,0xE0,0x07,0x00,0x00,0x00,0x3F,0xC0,0x0F,0x00,0x00,0x80,0x1F,0x80,0x3F,0x00,0x00,0xC0,0x0F,0x00,0x7E,0x00,0x00,0xE0,0x07,0x00,0xFC,0x00,0x00,0xF0,0x03,0x00,0xF8,0x01,0x00,0xF0,0x01,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xE0,0x07,0x00,0x70,0x00,0x00,0x80,0x07,0x00,0x30,0x00,0x00,0x00,0x07,0x00,0x10,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0xF0,0xFD,0x01,0x00,0x00,0x00,0xF8,0xF0,0x03,0x00,0x00,0x00,0x7E,0xE0,0x07,0x00,0x00,0x00,0x3F,0xC0,0x0F,0x00,0x00,0x80,0x1F,0x80,0x3F,0x00,0x00,0xC0,0x0F,0x00,0x7E,0x00,0x00,0xE0,0x07,0x00,0xFC,0x00,0x00,0xF0,0x03,0x00,0xF8,0x01,0x00,0xF0,0x01,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xE0,0x07,0x00,0x70,0x00,0x00,0x80,0x07,0x00,0x30,0x00,0x00,0x00,0x07,0x00,0x10,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
 
 	/* Index 44, character 76 "L" (width: 18 pixels) */
-	0x12, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,
 
 	/* Index 45, character 77 "M" (width: 27 pixels) */
-	0x1B, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,
 
 	/* Index 46, character 78 "N" (width: 23 pixels) */
-	0x17, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,
 
 	/* Index 47, character 79 "O" (width: 28 pixels) */
-	0x1C, 0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,
+	0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,
 
 	/* Index 48, character 80 "P" (width: 20 pixels) */
-	0x14, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x01,0x3C,0x00,0x00,0x00,0xE0,0x01,0x3C,0x00,0x00,0x00,0xE0,0x03,0x3E,0x00,0x00,0x00,0xE0,0x07,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x0F,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x01,0x3C,0x00,0x00,0x00,0xE0,0x01,0x3C,0x00,0x00,0x00,0xE0,0x03,0x3E,0x00,0x00,0x00,0xE0,0x07,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x0F,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 28 pixels) */
-	0x1C, 0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0xE0,0x03,0x00,0xF0,0x03,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x3F,0x00,0x78,0x00,0x00,0x00,0xFF,0x00,0xF8,0x00,0x00,0x80,0xFF,0x01,0xF0,0x00,0x00,0x80,0xFF,0x03,0xF0,0x01,0x00,0xC0,0xE7,0x03,0xF0,0x01,0x00,0xC0,0xC3,0x07,0xE0,0x03,0x00,0xE0,0x83,0x07,0xC0,0x0F,0x00,0xF8,0x81,0x07,0x80,0x7F,0x00,0xFF,0x80,0x07,0x00,0xFF,0xFF,0x7F,0x80,0x07,0x00,0xFE,0xFF,0x3F,0x80,0x07,0x00,0xF8,0xFF,0x0F,0xC0,0x07,0x00,0xC0,0xFF,0x01,0xC0,0x03,
+	0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0xE0,0x03,0x00,0xF0,0x03,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x3F,0x00,0x78,0x00,0x00,0x00,0xFF,0x00,0xF8,0x00,0x00,0x80,0xFF,0x01,0xF0,0x00,0x00,0x80,0xFF,0x03,0xF0,0x01,0x00,0xC0,0xE7,0x03,0xF0,0x01,0x00,0xC0,0xC3,0x07,0xE0,0x03,0x00,0xE0,0x83,0x07,0xC0,0x0F,0x00,0xF8,0x81,0x07,0x80,0x7F,0x00,0xFF,0x80,0x07,0x00,0xFF,0xFF,0x7F,0x80,0x07,0x00,0xFE,0xFF,0x3F,0x80,0x07,0x00,0xF8,0xFF,0x0F,0xC0,0x07,0x00,0xC0,0xFF,0x01,0xC0,0x03,
 
 	/* Index 50, character 82 "R" (width: 25 pixels) */
-	0x19, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0xF8,0x00,0x00,0x00,0xF0,0x00,0xF8,0x01,0x00,0x00,0xF0,0x00,0xFC,0x07,0x00,0x00,0xF0,0x01,0xFC,0x0F,0x00,0x00,0xE0,0x01,0x9E,0x1F,0x00,0x00,0xE0,0x07,0x1F,0x3F,0x00,0x00,0xC0,0xFF,0x0F,0x7E,0x00,0x00,0x80,0xFF,0x07,0xFC,0x00,0x00,0x00,0xFF,0x03,0xF0,0x03,0x00,0x00,0xFE,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0xF8,0x00,0x00,0x00,0xF0,0x00,0xF8,0x01,0x00,0x00,0xF0,0x00,0xFC,0x07,0x00,0x00,0xF0,0x01,0xFC,0x0F,0x00,0x00,0xE0,0x01,0x9E,0x1F,0x00,0x00,0xE0,0x07,0x1F,0x3F,0x00,0x00,0xC0,0xFF,0x0F,0x7E,0x00,0x00,0x80,0xFF,0x07,0xFC,0x00,0x00,0x00,0xFF,0x03,0xF0,0x03,0x00,0x00,0xFE,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
 
 	/* Index 51, character 83 "S" (width: 21 pixels) */
-	0x15, 0x00,0x7E,0x00,0xF0,0x03,0x00,0x80,0xFF,0x01,0xE0,0x03,0x00,0xC0,0xFF,0x03,0xC0,0x07,0x00,0xE0,0xFF,0x07,0xC0,0x07,0x00,0xE0,0xC3,0x0F,0x80,0x07,0x00,0xF0,0x81,0x0F,0x80,0x0F,0x00,0xF0,0x00,0x0F,0x80,0x0F,0x00,0x78,0x00,0x1F,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x3E,0x00,0x0F,0x00,0x78,0x00,0x3E,0x00,0x0F,0x00,0x78,0x00,0x3C,0x00,0x0F,0x00,0x78,0x00,0x3C,0x00,0x0F,0x00,0x78,0x00,0x7C,0x80,0x07,0x00,0xF8,0x00,0x78,0xC0,0x07,0x00,0xF0,0x00,0xF8,0xE1,0x03,0x00,0xF0,0x01,0xF0,0xFF,0x03,0x00,0xF0,0x01,0xF0,0xFF,0x01,0x00,0xE0,0x03,0xE0,0xFF,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,
+	0x00,0x7E,0x00,0xF0,0x03,0x00,0x80,0xFF,0x01,0xE0,0x03,0x00,0xC0,0xFF,0x03,0xC0,0x07,0x00,0xE0,0xFF,0x07,0xC0,0x07,0x00,0xE0,0xC3,0x0F,0x80,0x07,0x00,0xF0,0x81,0x0F,0x80,0x0F,0x00,0xF0,0x00,0x0F,0x80,0x0F,0x00,0x78,0x00,0x1F,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x3E,0x00,0x0F,0x00,0x78,0x00,0x3E,0x00,0x0F,0x00,0x78,0x00,0x3C,0x00,0x0F,0x00,0x78,0x00,0x3C,0x00,0x0F,0x00,0x78,0x00,0x7C,0x80,0x07,0x00,0xF8,0x00,0x78,0xC0,0x07,0x00,0xF0,0x00,0xF8,0xE1,0x03,0x00,0xF0,0x01,0xF0,0xFF,0x03,0x00,0xF0,0x01,0xF0,0xFF,0x01,0x00,0xE0,0x03,0xE0,0xFF,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,
 
 	/* Index 52, character 84 "T" (width: 26 pixels) */
-	0x1A, 0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,
+	0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 53, character 85 "U" (width: 22 pixels) */
-	0x16, 0xF0,0xFF,0xFF,0x1F,0x00,0x00,0xF0,0xFF,0xFF,0x7F,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0x7F,0x00,0x00,0xF0,0xFF,0xFF,0x1F,0x00,0x00,
+	0xF0,0xFF,0xFF,0x1F,0x00,0x00,0xF0,0xFF,0xFF,0x7F,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0x7F,0x00,0x00,0xF0,0xFF,0xFF,0x1F,0x00,0x00,
 
 	/* Index 54, character 86 "V" (width: 26 pixels) */
-	0x1A, 0x10,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+	0x10,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 55, character 87 "W" (width: 37 pixels) */
-	0x25, 0x30,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
+	0x30,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 56, character 88 "X" (width: 25 pixels) */
-	0x19, 0x10,0x00,0x00,0x00,0x04,0x00,0x30,0x00,0x00,0x00,0x06,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x07,0x00,0xF0,0x07,0x00,0xE0,0x0F,0x00,0xF8,0x03,0x00,0x80,0x3F,0x00,0xFE,0x00,0x00,0x00,0x7F,0x00,0x7F,0x00,0x00,0x00,0xFC,0xC1,0x1F,0x00,0x00,0x00,0xF8,0xE3,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0xF8,0xE3,0x0F,0x00,0x00,0x00,0xFC,0xC1,0x1F,0x00,0x00,0x00,0x7F,0x00,0x7F,0x00,0x00,0x80,0x3F,0x00,0xFE,0x00,0x00,0xE0,0x0F,0x00,0xF8,0x03,0x00,0xF0,0x07,0x00,0xF0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0x30,0x00,0x00,0x00,0x06,0x00,0x10,0x00,0x00,0x00,0x04,0x00,
+	0x10,0x00,0x00,0x00,0x04,0x00,0x30,0x00,0x00,0x00,0x06,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x07,0x00,0xF0,0x07,0x00,0xE0,0x0F,0x00,0xF8,0x03,0x00,0x80,0x3F,0x00,0xFE,0x00,0x00,0x00,0x7F,0x00,0x7F,0x00,0x00,0x00,0xFC,0xC1,0x1F,0x00,0x00,0x00,0xF8,0xE3,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0xF8,0xE3,0x0F,0x00,0x00,0x00,0xFC,0xC1,0x1F,0x00,0x00,0x00,0x7F,0x00,0x7F,0x00,0x00,0x80,0x3F,0x00,0xFE,0x00,0x00,0xE0,0x0F,0x00,0xF8,0x03,0x00,0xF0,0x07,0x00,0xF0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0x30,0x00,0x00,0x00,0x06,0x00,0x10,0x00,0x00,0x00,0x04,0x00,
 
 	/* Index 57, character 89 "Y" (width: 26 pixels) */
-	0x1A, 0x10,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFF,0x07,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+	0x10,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFF,0x07,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 58, character 90 "Z" (width: 22 pixels) */
-	0x16, 0x00,0x00,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0xE0,0x07,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xFC,0x07,0x00,0xF0,0x00,0x00,0xFE,0x07,0x00,0xF0,0x00,0x00,0xBF,0x07,0x00,0xF0,0x00,0xC0,0x9F,0x07,0x00,0xF0,0x00,0xE0,0x87,0x07,0x00,0xF0,0x00,0xF0,0x83,0x07,0x00,0xF0,0x00,0xFC,0x81,0x07,0x00,0xF0,0x00,0x7E,0x80,0x07,0x00,0xF0,0x00,0x3F,0x80,0x07,0x00,0xF0,0xC0,0x1F,0x80,0x07,0x00,0xF0,0xE0,0x07,0x80,0x07,0x00,0xF0,0xF0,0x03,0x80,0x07,0x00,0xF0,0xFC,0x01,0x80,0x07,0x00,0xF0,0x7E,0x00,0x80,0x07,0x00,0xF0,0x3F,0x00,0x80,0x07,0x00,0xF0,0x1F,0x00,0x80,0x07,0x00,0xF0,0x07,0x00,0x80,0x07,0x00,0xF0,0x03,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0x80,0x07,0x00,
+	0x00,0x00,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0xE0,0x07,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xFC,0x07,0x00,0xF0,0x00,0x00,0xFE,0x07,0x00,0xF0,0x00,0x00,0xBF,0x07,0x00,0xF0,0x00,0xC0,0x9F,0x07,0x00,0xF0,0x00,0xE0,0x87,0x07,0x00,0xF0,0x00,0xF0,0x83,0x07,0x00,0xF0,0x00,0xFC,0x81,0x07,0x00,0xF0,0x00,0x7E,0x80,0x07,0x00,0xF0,0x00,0x3F,0x80,0x07,0x00,0xF0,0xC0,0x1F,0x80,0x07,0x00,0xF0,0xE0,0x07,0x80,0x07,0x00,0xF0,0xF0,0x03,0x80,0x07,0x00,0xF0,0xFC,0x01,0x80,0x07,0x00,0xF0,0x7E,0x00,0x80,0x07,0x00,0xF0,0x3F,0x00,0x80,0x07,0x00,0xF0,0x1F,0x00,0x80,0x07,0x00,0xF0,0x07,0x00,0x80,0x07,0x00,0xF0,0x03,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0x80,0x07,0x00,
 
 	/* Index 59, character 91 "[" (width: 11 pixels) */
-	0xB, 0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,
+	0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,
 
 	/* Index 60, character 92 "\" (width: 16 pixels) */
-	0x10, 0x0C,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0x00,0x03,
+	0x0C,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0x00,0x03,
 
 	/* Index 61, character 93 "]" (width: 11 pixels) */
-	0xB, 0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,
+	0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,
 
 	/* Index 62, character 94 "^" (width: 26 pixels) */
-	0x1A, 0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+	0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
 
 	/* Index 63, character 95 "_" (width: 23 pixels) */
-	0x17, 0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,
+	0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,
 
 	/* Index 64, character 96 "`" (width: 9 pixels) */
-	0x9, 0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,
+	0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 19 pixels) */
-	0x13, 0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0xF0,0x80,0xFF,0x03,0x00,0x00,0xF0,0xC0,0xFF,0x07,0x00,0x00,0x78,0xC0,0xC7,0x07,0x00,0x00,0x78,0xE0,0x83,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x07,0x00,0x00,0x78,0xF0,0x80,0x07,0x00,0x00,0xF8,0xF0,0x80,0x03,0x00,0x00,0xF0,0xF1,0xC0,0x01,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
+	0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0xF0,0x80,0xFF,0x03,0x00,0x00,0xF0,0xC0,0xFF,0x07,0x00,0x00,0x78,0xC0,0xC7,0x07,0x00,0x00,0x78,0xE0,0x83,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x07,0x00,0x00,0x78,0xF0,0x80,0x07,0x00,0x00,0xF8,0xF0,0x80,0x03,0x00,0x00,0xF0,0xF1,0xC0,0x01,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
 
 	/* Index 66, character 98 "b" (width: 20 pixels) */
-	0x14, 0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x80,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xF0,0x00,0x00,0x07,0x00,0x00,0xF0,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x80,0x0F,0x00,0x00,0xF8,0x00,0x80,0x07,0x00,0x00,0xF0,0x01,0xC0,0x07,0x00,0x00,0xF0,0x07,0xF8,0x03,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,
+	0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x80,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xF0,0x00,0x00,0x07,0x00,0x00,0xF0,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x80,0x0F,0x00,0x00,0xF8,0x00,0x80,0x07,0x00,0x00,0xF0,0x01,0xC0,0x07,0x00,0x00,0xF0,0x07,0xF8,0x03,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,
 
 	/* Index 67, character 99 "c" (width: 18 pixels) */
-	0x12, 0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0xE0,0x0F,0xF8,0x03,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x01,0xC0,0x07,0x00,0x00,0xF0,0x00,0x80,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0xF8,0x00,0x80,0x0F,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xE0,0x01,0xC0,0x03,0x00,
+	0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0xE0,0x0F,0xF8,0x03,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x01,0xC0,0x07,0x00,0x00,0xF0,0x00,0x80,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0xF8,0x00,0x80,0x0F,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xE0,0x01,0xC0,0x03,0x00,
 
 	/* Index 68, character 100 "d" (width: 20 pixels) */
-	0x14, 0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x03,0x00,0x00,0xE0,0x0F,0xF0,0x07,0x00,0x00,0xF0,0x03,0xC0,0x07,0x00,0x00,0xF0,0x00,0x80,0x0F,0x00,0x00,0xF8,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x07,0x00,0x00,0x78,0x00,0x80,0x07,0x00,0x00,0x70,0x00,0x80,0x03,0x00,0x00,0xF0,0x00,0xC0,0x01,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,
+	0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x03,0x00,0x00,0xE0,0x0F,0xF0,0x07,0x00,0x00,0xF0,0x03,0xC0,0x07,0x00,0x00,0xF0,0x00,0x80,0x0F,0x00,0x00,0xF8,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x07,0x00,0x00,0x78,0x00,0x80,0x07,0x00,0x00,0x70,0x00,0x80,0x03,0x00,0x00,0xF0,0x00,0xC0,0x01,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,
 
 	/* Index 69, character 101 "e" (width: 21 pixels) */
-	0x15, 0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0xE0,0xF3,0xF8,0x03,0x00,0x00,0xF0,0xF1,0xE0,0x03,0x00,0x00,0xF0,0xF0,0xC0,0x07,0x00,0x00,0xF0,0xF0,0x80,0x07,0x00,0x00,0x78,0xF0,0x80,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0xF8,0xF0,0x00,0x0F,0x00,0x00,0xF0,0xF0,0x00,0x0F,0x00,0x00,0xF0,0xF3,0x00,0x0F,0x00,0x00,0xE0,0xFF,0x80,0x07,0x00,0x00,0xC0,0xFF,0x80,0x07,0x00,0x00,0x80,0xFF,0x80,0x07,0x00,0x00,0x00,0xFC,0xC0,0x03,0x00,
+	0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0xE0,0xF3,0xF8,0x03,0x00,0x00,0xF0,0xF1,0xE0,0x03,0x00,0x00,0xF0,0xF0,0xC0,0x07,0x00,0x00,0xF0,0xF0,0x80,0x07,0x00,0x00,0x78,0xF0,0x80,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0xF8,0xF0,0x00,0x0F,0x00,0x00,0xF0,0xF0,0x00,0x0F,0x00,0x00,0xF0,0xF3,0x00,0x0F,0x00,0x00,0xE0,0xFF,0x80,0x07,0x00,0x00,0xC0,0xFF,0x80,0x07,0x00,0x00,0x80,0xFF,0x80,0x07,0x00,0x00,0x00,0xFC,0xC0,0x03,0x00,
 
 	/* Index 70, character 102 "f" (width: 15 pixels) */
-	0xF, 0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0x07,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF8,0xFF,0xFF,0xFF,0x07,0x00,0xF8,0x70,0x00,0x00,0x00,0x00,0x7C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0x07,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF8,0xFF,0xFF,0xFF,0x07,0x00,0xF8,0x70,0x00,0x00,0x00,0x00,0x7C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 20 pixels) */
-	0x14, 0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x80,0x07,0x00,0xC0,0xFF,0xFF,0x81,0x07,0x00,0xE0,0x0F,0xF8,0x83,0x0F,0x00,0xF0,0x03,0xE0,0x03,0x0F,0x00,0xF0,0x00,0xC0,0x07,0x0F,0x00,0xF8,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x03,0x0F,0x00,0x70,0x00,0xC0,0x83,0x07,0x00,0x70,0x00,0xC0,0x81,0x07,0x00,0xF0,0x00,0xE0,0xE1,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0xFF,0x00,0x00,0xF0,0xFF,0xFF,0x1F,0x00,
+	0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x80,0x07,0x00,0xC0,0xFF,0xFF,0x81,0x07,0x00,0xE0,0x0F,0xF8,0x83,0x0F,0x00,0xF0,0x03,0xE0,0x03,0x0F,0x00,0xF0,0x00,0xC0,0x07,0x0F,0x00,0xF8,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x03,0x0F,0x00,0x70,0x00,0xC0,0x83,0x07,0x00,0x70,0x00,0xC0,0x81,0x07,0x00,0xF0,0x00,0xE0,0xE1,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0xFF,0x00,0x00,0xF0,0xFF,0xFF,0x1F,0x00,
 
 	/* Index 72, character 104 "h" (width: 18 pixels) */
-	0x12, 0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
+	0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
 
 	/* Index 73, character 105 "i" (width: 4 pixels) */
-	0x4, 0xF0,0xF0,0xFF,0xFF,0x07,0x00,0xF0,0xF0,0xFF,0xFF,0x07,0x00,0xF0,0xF0,0xFF,0xFF,0x07,0x00,0xF0,0xF0,0xFF,0xFF,0x07,0x00,
+	0xF0,0xF0,0xFF,0xFF,0x07,0x00,0xF0,0xF0,0xFF,0xFF,0x07,0x00,0xF0,0xF0,0xFF,0xFF,0x07,0x00,0xF0,0xF0,0xFF,0xFF,0x07,0x00,
 
 	/* Index 74, character 106 "j" (width: 11 pixels) */
-	0xB, 0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x80,0x0F,0x00,0x70,0x00,0x00,0xC0,0x07,0xF0,0xF0,0xFF,0xFF,0xFF,0x07,0xF0,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xF0,0xFF,0xFF,0xFF,0x01,0xF0,0xF0,0xFF,0xFF,0x7F,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x80,0x0F,0x00,0x70,0x00,0x00,0xC0,0x07,0xF0,0xF0,0xFF,0xFF,0xFF,0x07,0xF0,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xF0,0xFF,0xFF,0xFF,0x01,0xF0,0xF0,0xFF,0xFF,0x7F,0x00,
 
 	/* Index 75, character 107 "k" (width: 19 pixels) */
-	0x13, 0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x80,0x9F,0x1F,0x00,0x00,0x00,0xC0,0x0F,0x3F,0x00,0x00,0x00,0xE0,0x07,0xFE,0x00,0x00,0x00,0xF0,0x03,0xF8,0x01,0x00,0x00,0xF0,0x01,0xF0,0x03,0x00,0x00,0xF0,0x00,0xE0,0x07,0x00,0x00,0x70,0x00,0x80,0x07,0x00,0x00,0x30,0x00,0x00,0x07,0x00,0x00,0x10,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+	0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x80,0x9F,0x1F,0x00,0x00,0x00,0xC0,0x0F,0x3F,0x00,0x00,0x00,0xE0,0x07,0xFE,0x00,0x00,0x00,0xF0,0x03,0xF8,0x01,0x00,0x00,0xF0,0x01,0xF0,0x03,0x00,0x00,0xF0,0x00,0xE0,0x07,0x00,0x00,0x70,0x00,0x80,0x07,0x00,0x00,0x30,0x00,0x00,0x07,0x00,0x00,0x10,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
 
 	/* Index 76, character 108 "l" (width: 4 pixels) */
-	0x4, 0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,
+	0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,
 
 	/* Index 77, character 109 "m" (width: 30 pixels) */
-	0x1E, 0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
+	0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
 
 	/* Index 78, character 110 "n" (width: 18 pixels) */
-	0x12, 0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
+	0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
 
 	/* Index 79, character 111 "o" (width: 21 pixels) */
-	0x15, 0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0xE0,0x07,0xF8,0x03,0x00,0x00,0xF0,0x01,0xC0,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF8,0x00,0x80,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0xF8,0x00,0x80,0x0F,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF0,0x01,0xC0,0x07,0x00,0x00,0xE0,0x07,0xF0,0x03,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,
+	0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0xE0,0x07,0xF8,0x03,0x00,0x00,0xF0,0x01,0xC0,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF8,0x00,0x80,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0xF8,0x00,0x80,0x0F,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF0,0x01,0xC0,0x07,0x00,0x00,0xE0,0x07,0xF0,0x03,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,
 
 	/* Index 80, character 112 "p" (width: 20 pixels) */
-	0x14, 0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xC0,0x01,0x80,0x07,0x00,0x00,0xE0,0x01,0x80,0x07,0x00,0x00,0xF0,0x00,0x00,0x07,0x00,0x00,0xF0,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x80,0x0F,0x00,0x00,0xF8,0x00,0x80,0x07,0x00,0x00,0xF0,0x01,0xE0,0x07,0x00,0x00,0xF0,0x07,0xF8,0x03,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,
+	0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xC0,0x01,0x80,0x07,0x00,0x00,0xE0,0x01,0x80,0x07,0x00,0x00,0xF0,0x00,0x00,0x07,0x00,0x00,0xF0,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x80,0x0F,0x00,0x00,0xF8,0x00,0x80,0x07,0x00,0x00,0xF0,0x01,0xE0,0x07,0x00,0x00,0xF0,0x07,0xF8,0x03,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,
 
 	/* Index 81, character 113 "q" (width: 20 pixels) */
-	0x14, 0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x03,0x00,0x00,0xE0,0x0F,0xF0,0x07,0x00,0x00,0xF0,0x03,0xC0,0x07,0x00,0x00,0xF0,0x00,0x80,0x0F,0x00,0x00,0xF8,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x07,0x00,0x00,0x70,0x00,0x80,0x07,0x00,0x00,0xF0,0x00,0x80,0x03,0x00,0x00,0xF0,0x00,0xC0,0x01,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,
+	0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x03,0x00,0x00,0xE0,0x0F,0xF0,0x07,0x00,0x00,0xF0,0x03,0xC0,0x07,0x00,0x00,0xF0,0x00,0x80,0x0F,0x00,0x00,0xF8,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x07,0x00,0x00,0x70,0x00,0x80,0x07,0x00,0x00,0xF0,0x00,0x80,0x03,0x00,0x00,0xF0,0x00,0xC0,0x01,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,
 
 	/* Index 82, character 114 "r" (width: 13 pixels) */
-	0xD, 0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,
+	0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 16 pixels) */
-	0x10, 0x00,0x00,0x1F,0xC0,0x03,0x00,0x00,0xC0,0x7F,0x80,0x07,0x00,0x00,0xE0,0xFF,0x00,0x07,0x00,0x00,0xF0,0xFF,0x00,0x07,0x00,0x00,0xF0,0xF0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0E,0x00,0x00,0x38,0xE0,0x01,0x0E,0x00,0x00,0x38,0xE0,0x01,0x0E,0x00,0x00,0x38,0xC0,0x03,0x0E,0x00,0x00,0x38,0xC0,0x03,0x0E,0x00,0x00,0x38,0xC0,0x03,0x0F,0x00,0x00,0x78,0xC0,0x87,0x07,0x00,0x00,0x70,0x80,0xFF,0x07,0x00,0x00,0xF0,0x80,0xFF,0x03,0x00,0x00,0xF0,0x01,0xFF,0x01,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,
+	0x00,0x00,0x1F,0xC0,0x03,0x00,0x00,0xC0,0x7F,0x80,0x07,0x00,0x00,0xE0,0xFF,0x00,0x07,0x00,0x00,0xF0,0xFF,0x00,0x07,0x00,0x00,0xF0,0xF0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0E,0x00,0x00,0x38,0xE0,0x01,0x0E,0x00,0x00,0x38,0xE0,0x01,0x0E,0x00,0x00,0x38,0xC0,0x03,0x0E,0x00,0x00,0x38,0xC0,0x03,0x0E,0x00,0x00,0x38,0xC0,0x03,0x0F,0x00,0x00,0x78,0xC0,0x87,0x07,0x00,0x00,0x70,0x80,0xFF,0x07,0x00,0x00,0xF0,0x80,0xFF,0x03,0x00,0x00,0xF0,0x01,0xFF,0x01,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,
 
 	/* Index 84, character 116 "t" (width: 14 pixels) */
-	0xE, 0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0x03,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x70,0x00,0xC0,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x80,0x07,0x00,
+	0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0x03,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x70,0x00,0xC0,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x80,0x07,0x00,
 
 	/* Index 85, character 117 "u" (width: 18 pixels) */
-	0x12, 0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x01,0x00,0x00,0xF0,0xFF,0xFF,0x03,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,
+	0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x01,0x00,0x00,0xF0,0xFF,0xFF,0x03,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,
 
 	/* Index 86, character 118 "v" (width: 21 pixels) */
-	0x15, 0x00,0x10,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,
+	0x00,0x10,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,
 
 	/* Index 87, character 119 "w" (width: 30 pixels) */
-	0x1E, 0x00,0x30,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,
+	0x00,0x30,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,
 
 	/* Index 88, character 120 "x" (width: 21 pixels) */
-	0x15, 0x00,0x10,0x00,0x00,0x04,0x00,0x00,0x30,0x00,0x00,0x06,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF0,0x01,0xC0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xE0,0x0F,0xF8,0x03,0x00,0x00,0x80,0x1F,0xFC,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x80,0x1F,0xFC,0x00,0x00,0x00,0xE0,0x0F,0xF8,0x03,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x01,0xC0,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0x30,0x00,0x00,0x06,0x00,0x00,0x10,0x00,0x00,0x04,0x00,
+	0x00,0x10,0x00,0x00,0x04,0x00,0x00,0x30,0x00,0x00,0x06,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF0,0x01,0xC0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xE0,0x0F,0xF8,0x03,0x00,0x00,0x80,0x1F,0xFC,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x80,0x1F,0xFC,0x00,0x00,0x00,0xE0,0x0F,0xF8,0x03,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x01,0xC0,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0x30,0x00,0x00,0x06,0x00,0x00,0x10,0x00,0x00,0x04,0x00,
 
 	/* Index 89, character 121 "y" (width: 21 pixels) */
-	0x15, 0x00,0x10,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x08,0x00,0x80,0xFF,0x03,0x00,0x0E,0x00,0x00,0xFC,0x1F,0xC0,0x0F,0x00,0x00,0xE0,0xFF,0xF0,0x0F,0x00,0x00,0x80,0xFF,0xFF,0x0F,0x00,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,
+	0x00,0x10,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x08,0x00,0x80,0xFF,0x03,0x00,0x0E,0x00,0x00,0xFC,0x1F,0xC0,0x0F,0x00,0x00,0xE0,0xFF,0xF0,0x0F,0x00,0x00,0x80,0xFF,0xFF,0x0F,0x00,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,
 
 	/* Index 90, character 122 "z" (width: 17 pixels) */
-	0x11, 0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x70,0x00,0xC0,0x07,0x00,0x00,0x70,0x00,0xE0,0x07,0x00,0x00,0x70,0x00,0xF8,0x07,0x00,0x00,0x70,0x00,0xFC,0x07,0x00,0x00,0x70,0x00,0x7F,0x07,0x00,0x00,0x70,0x80,0x3F,0x07,0x00,0x00,0x70,0xC0,0x0F,0x07,0x00,0x00,0x70,0xF0,0x07,0x07,0x00,0x00,0x70,0xF8,0x01,0x07,0x00,0x00,0x70,0xFE,0x00,0x07,0x00,0x00,0x70,0x7F,0x00,0x07,0x00,0x00,0xF0,0x1F,0x00,0x07,0x00,0x00,0xF0,0x0F,0x00,0x07,0x00,0x00,0xF0,0x03,0x00,0x07,0x00,0x00,0xF0,0x01,0x00,0x07,0x00,0x00,0x70,0x00,0x00,0x07,0x00,
+	0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x70,0x00,0xC0,0x07,0x00,0x00,0x70,0x00,0xE0,0x07,0x00,0x00,0x70,0x00,0xF8,0x07,0x00,0x00,0x70,0x00,0xFC,0x07,0x00,0x00,0x70,0x00,0x7F,0x07,0x00,0x00,0x70,0x80,0x3F,0x07,0x00,0x00,0x70,0xC0,0x0F,0x07,0x00,0x00,0x70,0xF0,0x07,0x07,0x00,0x00,0x70,0xF8,0x01,0x07,0x00,0x00,0x70,0xFE,0x00,0x07,0x00,0x00,0x70,0x7F,0x00,0x07,0x00,0x00,0xF0,0x1F,0x00,0x07,0x00,0x00,0xF0,0x0F,0x00,0x07,0x00,0x00,0xF0,0x03,0x00,0x07,0x00,0x00,0xF0,0x01,0x00,0x07,0x00,0x00,0x70,0x00,0x00,0x07,0x00,
 
 	/* Index 91, character 123 "{" (width: 17 pixels) */
-	0x11, 0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xB8,0x03,0x00,0x00,0x00,0x00,0xBE,0x0F,0x00,0x00,0x80,0xFF,0x1F,0xFF,0x3F,0x00,0xE0,0xFF,0x0F,0xFE,0xFF,0x00,0xF0,0xFF,0x07,0xFC,0xFF,0x01,0xF8,0xFF,0x01,0xF0,0xFF,0x03,0x78,0x00,0x00,0x00,0xC0,0x03,0x3C,0x00,0x00,0x00,0x80,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,
+	0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xB8,0x03,0x00,0x00,0x00,0x00,0xBE,0x0F,0x00,0x00,0x80,0xFF,0x1F,0xFF,0x3F,0x00,0xE0,0xFF,0x0F,0xFE,0xFF,0x00,0xF0,0xFF,0x07,0xFC,0xFF,0x01,0xF8,0xFF,0x01,0xF0,0xFF,0x03,0x78,0x00,0x00,0x00,0xC0,0x03,0x3C,0x00,0x00,0x00,0x80,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,
 
 	/* Index 92, character 124 "|" (width: 4 pixels) */
-	0x4, 0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,
+	0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,
 
 	/* Index 93, character 125 "}" (width: 17 pixels) */
-	0x11, 0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x3C,0x00,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0xC0,0x03,0xF8,0xFF,0x01,0xF0,0xFF,0x03,0xF0,0xFF,0x07,0xFC,0xFF,0x01,0xE0,0xFF,0x0F,0xFE,0xFF,0x00,0x80,0xFF,0x1F,0xFF,0x3F,0x00,0x00,0x00,0xBE,0x0F,0x00,0x00,0x00,0x00,0xB8,0x03,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,
+	0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x3C,0x00,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0xC0,0x03,0xF8,0xFF,0x01,0xF0,0xFF,0x03,0xF0,0xFF,0x07,0xFC,0xFF,0x01,0xE0,0xFF,0x0F,0xFE,0xFF,0x00,0x80,0xFF,0x1F,0xFF,0x3F,0x00,0x00,0x00,0xBE,0x0F,0x00,0x00,0x00,0x00,0xB8,0x03,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,
 
 	/* Index 94, character 126 "~" (width: 25 pixels) */
-	0x19, 0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00
+	0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00
 };
+
+// Offset of each bitmap in Tahoma32_bitmaps
+const unsigned short Tahoma32_offsets[] = 
+{
+	0x0,	// Index 0
+	0x18,	// Index 1
+	0x30,	// Index 2
+	0x7E,	// Index 3
+	0x114,	// Index 4
+	0x186,	// Index 5
+	0x26A,	// Index 6
+	0x318,	// Index 7
+	0x336,	// Index 8
+	0x384,	// Index 9
+	0x3D2,	// Index 10
+	0x444,	// Index 11
+	0x4DA,	// Index 12
+	0x510,	// Index 13
+	0x558,	// Index 14
+	0x576,	// Index 15
+	0x5D6,	// Index 16
+	0x64E,	// Index 17
+	0x6AE,	// Index 18
+	0x720,	// Index 19
+	0x792,	// Index 20
+	0x816,	// Index 21
+	0x888,	// Index 22
+	0x900,	// Index 23
+	0x978,	// Index 24
+	0x9F0,	// Index 25
+	0xA68,	// Index 26
+	0xA86,	// Index 27
+	0xABC,	// Index 28
+	0xB46,	// Index 29
+	0xBD0,	// Index 30
+	0xC5A,	// Index 31
+	0xCC0,	// Index 32
+	0xD86,	// Index 33
+	0xE22,	// Index 34
+	0xEA0,	// Index 35
+	0xF30,	// Index 36
+	0xFC6,	// Index 37
+	0x103E,	// Index 38
+	0x10AA,	// Index 39
+	0x1146,	// Index 40
+	0x11D0,	// Index 41
+	0x1218,	// Index 42
+	0x1272,	// Index 43
+	0x12FC,	// Index 44
+	0x1368,	// Index 45
+	0x140A,	// Index 46
+	0x1494,	// Index 47
+	0x153C,	// Index 48
+	0x15B4,	// Index 49
+	0x165C,	// Index 50
+	0x16F2,	// Index 51
+	0x1770,	// Index 52
+	0x180C,	// Index 53
+	0x1890,	// Index 54
+	0x192C,	// Index 55
+	0x1A0A,	// Index 56
+	0x1AA0,	// Index 57
+	0x1B3C,	// Index 58
+	0x1BC0,	// Index 59
+	0x1C02,	// Index 60
+	0x1C62,	// Index 61
+	0x1CA4,	// Index 62
+	0x1D40,	// Index 63
+	0x1DCA,	// Index 64
+	0x1E00,	// Index 65
+	0x1E72,	// Index 66
+	0x1EEA,	// Index 67
+	0x1F56,	// Index 68
+	0x1FCE,	// Index 69
+	0x204C,	// Index 70
+	0x20A6,	// Index 71
+	0x211E,	// Index 72
+	0x218A,	// Index 73
+	0x21A2,	// Index 74
+	0x21E4,	// Index 75
+	0x2256,	// Index 76
+	0x226E,	// Index 77
+	0x2322,	// Index 78
+	0x238E,	// Index 79
+	0x240C,	// Index 80
+	0x2484,	// Index 81
+	0x24FC,	// Index 82
+	0x254A,	// Index 83
+	0x25AA,	// Index 84
+	0x25FE,	// Index 85
+	0x266A,	// Index 86
+	0x26E8,	// Index 87
+	0x279C,	// Index 88
+	0x281A,	// Index 89
+	0x2898,	// Index 90
+	0x28FE,	// Index 91
+	0x2964,	// Index 92
+	0x297C,	// Index 93
+	0x29E2,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Tahoma32_widths[] = 
+{
+	0x4,	// Index 0
+	0x4,	// Index 1
+	0xD,	// Index 2
+	0x19,	// Index 3
+	0x13,	// Index 4
+	0x26,	// Index 5
+	0x1D,	// Index 6
+	0x5,	// Index 7
+	0xD,	// Index 8
+	0xD,	// Index 9
+	0x13,	// Index 10
+	0x19,	// Index 11
+	0x9,	// Index 12
+	0xC,	// Index 13
+	0x5,	// Index 14
+	0x10,	// Index 15
+	0x14,	// Index 16
+	0x10,	// Index 17
+	0x13,	// Index 18
+	0x13,	// Index 19
+	0x16,	// Index 20
+	0x13,	// Index 21
+	0x14,	// Index 22
+	0x14,	// Index 23
+	0x14,	// Index 24
+	0x14,	// Index 25
+	0x5,	// Index 26
+	0x9,	// Index 27
+	0x17,	// Index 28
+	0x17,	// Index 29
+	0x17,	// Index 30
+	0x11,	// Index 31
+	0x21,	// Index 32
+	0x1A,	// Index 33
+	0x15,	// Index 34
+	0x18,	// Index 35
+	0x19,	// Index 36
+	0x14,	// Index 37
+	0x12,	// Index 38
+	0x1A,	// Index 39
+	0x17,	// Index 40
+	0xC,	// Index 41
+	0xF,	// Index 42
+	0x17,	// Index 43
+	0x12,	// Index 44
+	0x1B,	// Index 45
+	0x17,	// Index 46
+	0x1C,	// Index 47
+	0x14,	// Index 48
+	0x1C,	// Index 49
+	0x19,	// Index 50
+	0x15,	// Index 51
+	0x1A,	// Index 52
+	0x16,	// Index 53
+	0x1A,	// Index 54
+	0x25,	// Index 55
+	0x19,	// Index 56
+	0x1A,	// Index 57
+	0x16,	// Index 58
+	0xB,	// Index 59
+	0x10,	// Index 60
+	0xB,	// Index 61
+	0x1A,	// Index 62
+	0x17,	// Index 63
+	0x9,	// Index 64
+	0x13,	// Index 65
+	0x14,	// Index 66
+	0x12,	// Index 67
+	0x14,	// Index 68
+	0x15,	// Index 69
+	0xF,	// Index 70
+	0x14,	// Index 71
+	0x12,	// Index 72
+	0x4,	// Index 73
+	0xB,	// Index 74
+	0x13,	// Index 75
+	0x4,	// Index 76
+	0x1E,	// Index 77
+	0x12,	// Index 78
+	0x15,	// Index 79
+	0x14,	// Index 80
+	0x14,	// Index 81
+	0xD,	// Index 82
+	0x10,	// Index 83
+	0xE,	// Index 84
+	0x12,	// Index 85
+	0x15,	// Index 86
+	0x1E,	// Index 87
+	0x15,	// Index 88
+	0x15,	// Index 89
+	0x11,	// Index 90
+	0x11,	// Index 91
+	0x4,	// Index 92
+	0x11,	// Index 93
+	0x19,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Tahoma32_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x1F, 0x0,	// Index 1
+	0x21, 0x0,	// Index 2
+	0x1F, 0x0,	// Index 3
+	0x21, 0x8,	// Index 4
+	0x20, 0x1,	// Index 5
+	0x20, 0x1,	// Index 6
+	0x21, 0x0,	// Index 7
+	0x21, 0x9,	// Index 8
+	0x21, 0x9,	// Index 9
+	0x21, 0x0,	// Index 10
+	0x1A, 0x0,	// Index 11
+	0x6, 0x8,	// Index 12
+	0x10, 0x0,	// Index 13
+	0x6, 0x0,	// Index 14
+	0x21, 0x7,	// Index 15
+	0x20, 0x1,	// Index 16
+	0x1F, 0x0,	// Index 17
+	0x20, 0x0,	// Index 18
+	0x20, 0x1,	// Index 19
+	0x1F, 0x0,	// Index 20
+	0x1F, 0x1,	// Index 21
+	0x20, 0x1,	// Index 22
+	0x1F, 0x0,	// Index 23
+	0x20, 0x1,	// Index 24
+	0x20, 0x1,	// Index 25
+	0x17, 0x0,	// Index 26
+	0x17, 0x8,	// Index 27
+	0x1B, 0x0,	// Index 28
+	0x14, 0x0,	// Index 29
+	0x1B, 0x0,	// Index 30
+	0x20, 0x0,	// Index 31
+	0x20, 0x5,	// Index 32
+	0x1F, 0x0,	// Index 33
+	0x1F, 0x0,	// Index 34
+	0x20, 0x1,	// Index 35
+	0x1F, 0x0,	// Index 36
+	0x1F, 0x0,	// Index 37
+	0x1F, 0x0,	// Index 38
+	0x20, 0x1,	// Index 39
+	0x1F, 0x0,	// Index 40
+	0x1F, 0x0,	// Index 41
+	0x1F, 0x1,	// Index 42
+	0x1F, 0x0,	// Index 43
+	0x1F, 0x0,	// Index 44
+	0x1F, 0x0,	// Index 45
+	0x1F, 0x0,	// Index 46
+	0x20, 0x1,	// Index 47
+	0x1F, 0x0,	// Index 48
+	0x20, 0x8,	// Index 49
+	0x1F, 0x0,	// Index 50
+	0x20, 0x1,	// Index 51
+	0x1F, 0x0,	// Index 52
+	0x1F, 0x1,	// Index 53
+	0x1F, 0x0,	// Index 54
+	0x1F, 0x0,	// Index 55
+	0x1F, 0x0,	// Index 56
+	0x1F, 0x0,	// Index 57
+	0x1F, 0x0,	// Index 58
+	0x21, 0x8,	// Index 59
+	0x21, 0x7,	// Index 60
+	0x21, 0x8,	// Index 61
+	0x1F, 0x0,	// Index 62
+	0x0, 0x7,	// Index 63
+	0x23, 0x0,	// Index 64
+	0x18, 0x1,	// Index 65
+	0x21, 0x1,	// Index 66
+	0x18, 0x1,	// Index 67
+	0x21, 0x1,	// Index 68
+	0x18, 0x1,	// Index 69
+	0x21, 0x0,	// Index 70
+	0x18, 0x9,	// Index 71
+	0x21, 0x0,	// Index 72
+	0x1F, 0x0,	// Index 73
+	0x1F, 0x9,	// Index 74
+	0x21, 0x0,	// Index 75
+	0x21, 0x0,	// Index 76
+	0x18, 0x0,	// Index 77
+	0x18, 0x0,	// Index 78
+	0x18, 0x1,	// Index 79
+	0x18, 0x9,	// Index 80
+	0x18, 0x9,	// Index 81
+	0x17, 0x0,	// Index 82
+	0x18, 0x1,	// Index 83
+	0x1E, 0x1,	// Index 84
+	0x17, 0x1,	// Index 85
+	0x17, 0x0,	// Index 86
+	0x17, 0x0,	// Index 87
+	0x17, 0x0,	// Index 88
+	0x17, 0x9,	// Index 89
+	0x17, 0x0,	// Index 90
+	0x21, 0x8,	// Index 91
+	0x21, 0x8,	// Index 92
+	0x21, 0x8,	// Index 93
+	0x13, 0x0,	// Index 94
+};
+
+const font_t Tahoma32 = 
+{
+	Tahoma32_bitmaps,
+	Tahoma32_offsets,
+	Tahoma32_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x2C,	// Height 
+	0,	// Flags 
+	Tahoma32_extents,
+	0x23	// Ascent 
+};
+
 //---------------------------------------------------------------
 // Group Name: Tahoma26
 // Designer: Imported System Font
@@ -2855,398 +4320,607 @@ const unsigned char Tahoma32[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Tahoma26[] = 
+const unsigned char Tahoma26_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x23,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xD8, // Index 1 (offset: 216)
-	0x0, 0xE8, // Index 2 (offset: 232)
-	0x1, 0x16, // Index 3 (offset: 278)
-	0x1, 0x80, // Index 4 (offset: 384)
-	0x1, 0xCC, // Index 5 (offset: 460)
-	0x2, 0x68, // Index 6 (offset: 616)
-	0x2, 0xDC, // Index 7 (offset: 732)
-	0x2, 0xEC, // Index 8 (offset: 748)
-	0x3, 0x1F, // Index 9 (offset: 799)
-	0x3, 0x52, // Index 10 (offset: 850)
-	0x3, 0xA3, // Index 11 (offset: 931)
-	0x4, 0xD, // Index 12 (offset: 1037)
-	0x4, 0x31, // Index 13 (offset: 1073)
-	0x4, 0x64, // Index 14 (offset: 1124)
-	0x4, 0x79, // Index 15 (offset: 1145)
-	0x4, 0xBB, // Index 16 (offset: 1211)
-	0x5, 0xC, // Index 17 (offset: 1292)
-	0x5, 0x4E, // Index 18 (offset: 1358)
-	0x5, 0x9F, // Index 19 (offset: 1439)
-	0x5, 0xEB, // Index 20 (offset: 1515)
-	0x6, 0x46, // Index 21 (offset: 1606)
-	0x6, 0x92, // Index 22 (offset: 1682)
-	0x6, 0xE8, // Index 23 (offset: 1768)
-	0x7, 0x39, // Index 24 (offset: 1849)
-	0x7, 0x8F, // Index 25 (offset: 1935)
-	0x7, 0xE5, // Index 26 (offset: 2021)
-	0x7, 0xFA, // Index 27 (offset: 2042)
-	0x8, 0x1E, // Index 28 (offset: 2078)
-	0x8, 0x79, // Index 29 (offset: 2169)
-	0x8, 0xD9, // Index 30 (offset: 2265)
-	0x9, 0x34, // Index 31 (offset: 2356)
-	0x9, 0x7B, // Index 32 (offset: 2427)
-	0xA, 0x8, // Index 33 (offset: 2568)
-	0xA, 0x72, // Index 34 (offset: 2674)
-	0xA, 0xC8, // Index 35 (offset: 2760)
-	0xB, 0x28, // Index 36 (offset: 2856)
-	0xB, 0x8D, // Index 37 (offset: 2957)
-	0xB, 0xDE, // Index 38 (offset: 3038)
-	0xC, 0x2A, // Index 39 (offset: 3114)
-	0xC, 0x8F, // Index 40 (offset: 3215)
-	0xC, 0xEA, // Index 41 (offset: 3306)
-	0xD, 0x18, // Index 42 (offset: 3352)
-	0xD, 0x5A, // Index 43 (offset: 3418)
-	0xD, 0xBA, // Index 44 (offset: 3514)
-	0xE, 0x1, // Index 45 (offset: 3585)
-	0xE, 0x6B, // Index 46 (offset: 3691)
-	0xE, 0xC1, // Index 47 (offset: 3777)
-	0xF, 0x35, // Index 48 (offset: 3893)
-	0xF, 0x81, // Index 49 (offset: 3969)
-	0xF, 0xF5, // Index 50 (offset: 4085)
-	0x10, 0x5A, // Index 51 (offset: 4186)
-	0x10, 0xB0, // Index 52 (offset: 4272)
-	0x11, 0x1A, // Index 53 (offset: 4378)
-	0x11, 0x7A, // Index 54 (offset: 4474)
-	0x11, 0xE4, // Index 55 (offset: 4580)
-	0x12, 0x85, // Index 56 (offset: 4741)
-	0x12, 0xEA, // Index 57 (offset: 4842)
-	0x13, 0x54, // Index 58 (offset: 4948)
-	0x13, 0xAF, // Index 59 (offset: 5039)
-	0x13, 0xDD, // Index 60 (offset: 5085)
-	0x14, 0x1F, // Index 61 (offset: 5151)
-	0x14, 0x4D, // Index 62 (offset: 5197)
-	0x14, 0xB7, // Index 63 (offset: 5303)
-	0x15, 0x17, // Index 64 (offset: 5399)
-	0x15, 0x3B, // Index 65 (offset: 5435)
-	0x15, 0x87, // Index 66 (offset: 5511)
-	0x15, 0xD8, // Index 67 (offset: 5592)
-	0x16, 0x1F, // Index 68 (offset: 5663)
-	0x16, 0x70, // Index 69 (offset: 5744)
-	0x16, 0xC1, // Index 70 (offset: 5825)
-	0x16, 0xFE, // Index 71 (offset: 5886)
-	0x17, 0x4F, // Index 72 (offset: 5967)
-	0x17, 0xA0, // Index 73 (offset: 6048)
-	0x17, 0xB0, // Index 74 (offset: 6064)
-	0x17, 0xDE, // Index 75 (offset: 6110)
-	0x18, 0x2F, // Index 76 (offset: 6191)
-	0x18, 0x3F, // Index 77 (offset: 6207)
-	0x18, 0xBD, // Index 78 (offset: 6333)
-	0x19, 0xE, // Index 79 (offset: 6414)
-	0x19, 0x64, // Index 80 (offset: 6500)
-	0x19, 0xB5, // Index 81 (offset: 6581)
-	0x1A, 0x6, // Index 82 (offset: 6662)
-	0x1A, 0x3E, // Index 83 (offset: 6718)
-	0x1A, 0x85, // Index 84 (offset: 6789)
-	0x1A, 0xBD, // Index 85 (offset: 6845)
-	0x1B, 0xE, // Index 86 (offset: 6926)
-	0x1B, 0x64, // Index 87 (offset: 7012)
-	0x1B, 0xDD, // Index 88 (offset: 7133)
-	0x1C, 0x33, // Index 89 (offset: 7219)
-	0x1C, 0x89, // Index 90 (offset: 7305)
-	0x1C, 0xD0, // Index 91 (offset: 7376)
-	0x1D, 0x1C, // Index 92 (offset: 7452)
-	0x1D, 0x2C, // Index 93 (offset: 7468)
-	0x1D, 0x78, // Index 94 (offset: 7544)
-
 	/* Index 0, character 32 " " (width: 4 pixels) */
-	0x4, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 3 pixels) */
-	0x3, 0xF8,0xFF,0x1F,0x0F,0x00,0xF8,0xFF,0x1F,0x0F,0x00,0xF8,0xFF,0x1F,0x0F,0x00,
+	0xF8,0xFF,0x1F,0x0F,0x00,0xF8,0xFF,0x1F,0x0F,0x00,0xF8,0xFF,0x1F,0x0F,0x00,
 
 	/* Index 2, character 34 """ (width: 9 pixels) */
-	0x9, 0xFE,0x01,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,
+	0xFE,0x01,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 21 pixels) */
-	0x15, 0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x0C,0x18,0x00,0x00,0x00,0x0C,0x18,0x0C,0x00,0x00,0x0C,0xD8,0x0F,0x00,0x00,0x0C,0xFC,0x03,0x00,0x00,0xEC,0x3F,0x00,0x00,0x00,0xFE,0x1B,0x00,0x00,0xE0,0x3F,0x18,0x00,0x00,0xF8,0x0D,0x18,0x00,0x00,0x18,0x0C,0x18,0x0C,0x00,0x00,0x0C,0xF8,0x0F,0x00,0x00,0x0C,0xFC,0x03,0x00,0x00,0xEC,0x3F,0x00,0x00,0x00,0xFE,0x1B,0x00,0x00,0xE0,0x1F,0x18,0x00,0x00,0xF8,0x0D,0x18,0x00,0x00,0x18,0x0C,0x18,0x00,0x00,0x00,0x0C,0x18,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,
+	0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x0C,0x18,0x00,0x00,0x00,0x0C,0x18,0x0C,0x00,0x00,0x0C,0xD8,0x0F,0x00,0x00,0x0C,0xFC,0x03,0x00,0x00,0xEC,0x3F,0x00,0x00,0x00,0xFE,0x1B,0x00,0x00,0xE0,0x3F,0x18,0x00,0x00,0xF8,0x0D,0x18,0x00,0x00,0x18,0x0C,0x18,0x0C,0x00,0x00,0x0C,0xF8,0x0F,0x00,0x00,0x0C,0xFC,0x03,0x00,0x00,0xEC,0x3F,0x00,0x00,0x00,0xFE,0x1B,0x00,0x00,0xE0,0x1F,0x18,0x00,0x00,0xF8,0x0D,0x18,0x00,0x00,0x18,0x0C,0x18,0x00,0x00,0x00,0x0C,0x18,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,
 
 	/* Index 4, character 36 "$" (width: 15 pixels) */
-	0xF, 0x00,0x7C,0x80,0x07,0x00,0x00,0xFF,0x00,0x07,0x00,0x00,0xFF,0x01,0x07,0x00,0x80,0xC3,0x01,0x0F,0x00,0x80,0xC3,0x03,0x0E,0x00,0xC0,0x81,0x03,0x0E,0x00,0xC0,0x81,0x03,0x0E,0x00,0xFE,0xFF,0xFF,0xFF,0x03,0xFE,0xFF,0xFF,0xFF,0x03,0xC0,0x01,0x07,0x0E,0x00,0xC0,0x01,0x07,0x0E,0x00,0xC0,0x03,0x0F,0x07,0x00,0x80,0x03,0xFE,0x03,0x00,0x80,0x07,0xFE,0x03,0x00,0x00,0x00,0xF8,0x00,0x00,
+	0x00,0x7C,0x80,0x07,0x00,0x00,0xFF,0x00,0x07,0x00,0x00,0xFF,0x01,0x07,0x00,0x80,0xC3,0x01,0x0F,0x00,0x80,0xC3,0x03,0x0E,0x00,0xC0,0x81,0x03,0x0E,0x00,0xC0,0x81,0x03,0x0E,0x00,0xFE,0xFF,0xFF,0xFF,0x03,0xFE,0xFF,0xFF,0xFF,0x03,0xC0,0x01,0x07,0x0E,0x00,0xC0,0x01,0x07,0x0E,0x00,0xC0,0x03,0x0F,0x07,0x00,0x80,0x03,0xFE,0x03,0x00,0x80,0x07,0xFE,0x03,0x00,0x00,0x00,0xF8,0x00,0x00,
 
 	/* Index 5, character 37 "%" (width: 31 pixels) */
-	0x1F, 0xC0,0x1F,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x3C,0xE0,0x01,0x00,0x00,0x0C,0x80,0x01,0x00,0x00,0x0C,0x80,0x01,0x00,0x00,0x0C,0x80,0x01,0x00,0x00,0x0C,0x80,0x01,0x08,0x00,0x3C,0xE0,0x01,0x0E,0x00,0xF8,0xFF,0x00,0x0F,0x00,0xF0,0x7F,0xC0,0x07,0x00,0xC0,0x1F,0xF0,0x01,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xC0,0x07,0xFE,0x00,0x00,0xF0,0x81,0xFF,0x03,0x00,0x78,0xC0,0xFF,0x07,0x00,0x38,0xE0,0x01,0x0F,0x00,0x08,0x60,0x00,0x0C,0x00,0x00,0x60,0x00,0x0C,0x00,0x00,0x60,0x00,0x0C,0x00,0x00,0x60,0x00,0x0C,0x00,0x00,0xE0,0x01,0x0F,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xFE,0x00,0x00,
+	0xC0,0x1F,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x3C,0xE0,0x01,0x00,0x00,0x0C,0x80,0x01,0x00,0x00,0x0C,0x80,0x01,0x00,0x00,0x0C,0x80,0x01,0x00,0x00,0x0C,0x80,0x01,0x08,0x00,0x3C,0xE0,0x01,0x0E,0x00,0xF8,0xFF,0x00,0x0F,0x00,0xF0,0x7F,0xC0,0x07,0x00,0xC0,0x1F,0xF0,0x01,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xC0,0x07,0xFE,0x00,0x00,0xF0,0x81,0xFF,0x03,0x00,0x78,0xC0,0xFF,0x07,0x00,0x38,0xE0,0x01,0x0F,0x00,0x08,0x60,0x00,0x0C,0x00,0x00,0x60,0x00,0x0C,0x00,0x00,0x60,0x00,0x0C,0x00,0x00,0x60,0x00,0x0C,0x00,0x00,0xE0,0x01,0x0F,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xFE,0x00,0x00,
 
 	/* Index 6, character 38 "&" (width: 23 pixels) */
-	0x17, 0x00,0x00,0xFC,0x00,0x00,0xC0,0x03,0xFF,0x01,0x00,0xF0,0x8F,0xFF,0x03,0x00,0xF8,0xDF,0x83,0x07,0x00,0x78,0xFC,0x00,0x07,0x00,0x3C,0x78,0x00,0x0F,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0xF0,0x00,0x0E,0x00,0x1C,0xF0,0x01,0x0E,0x00,0x1C,0xF0,0x03,0x0E,0x00,0x3C,0x98,0x07,0x0E,0x00,0x38,0x1C,0x0F,0x06,0x00,0xF8,0x0F,0x1E,0x07,0x00,0xF0,0x07,0x3C,0x03,0x00,0xE0,0x03,0xF8,0x03,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF0,0x8F,0x07,0x00,0x00,0xF0,0x01,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
+	0x00,0x00,0xFC,0x00,0x00,0xC0,0x03,0xFF,0x01,0x00,0xF0,0x8F,0xFF,0x03,0x00,0xF8,0xDF,0x83,0x07,0x00,0x78,0xFC,0x00,0x07,0x00,0x3C,0x78,0x00,0x0F,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0xF0,0x00,0x0E,0x00,0x1C,0xF0,0x01,0x0E,0x00,0x1C,0xF0,0x03,0x0E,0x00,0x3C,0x98,0x07,0x0E,0x00,0x38,0x1C,0x0F,0x06,0x00,0xF8,0x0F,0x1E,0x07,0x00,0xF0,0x07,0x3C,0x03,0x00,0xE0,0x03,0xF8,0x03,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF0,0x8F,0x07,0x00,0x00,0xF0,0x01,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
 
 	/* Index 7, character 39 "'" (width: 3 pixels) */
-	0x3, 0xFE,0x03,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,
+	0xFE,0x03,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 10 pixels) */
-	0xA, 0x00,0xE0,0xFF,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x80,0xFF,0xFF,0x1F,0x00,0xE0,0x1F,0x80,0x7F,0x00,0xF8,0x03,0x00,0xFC,0x01,0x7C,0x00,0x00,0xE0,0x03,0x3E,0x00,0x00,0xC0,0x07,0x0E,0x00,0x00,0x00,0x07,0x06,0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x00,0x04,
+	0x00,0xE0,0xFF,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x80,0xFF,0xFF,0x1F,0x00,0xE0,0x1F,0x80,0x7F,0x00,0xF8,0x03,0x00,0xFC,0x01,0x7C,0x00,0x00,0xE0,0x03,0x3E,0x00,0x00,0xC0,0x07,0x0E,0x00,0x00,0x00,0x07,0x06,0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x00,0x04,
 
 	/* Index 9, character 41 ")" (width: 10 pixels) */
-	0xA, 0x02,0x00,0x00,0x00,0x04,0x06,0x00,0x00,0x00,0x06,0x0E,0x00,0x00,0x00,0x07,0x3E,0x00,0x00,0xC0,0x07,0x7C,0x00,0x00,0xE0,0x03,0xF8,0x03,0x00,0xFC,0x01,0xE0,0x1F,0x80,0x7F,0x00,0x80,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0xF0,0xFF,0x00,0x00,
+	0x02,0x00,0x00,0x00,0x04,0x06,0x00,0x00,0x00,0x06,0x0E,0x00,0x00,0x00,0x07,0x3E,0x00,0x00,0xC0,0x07,0x7C,0x00,0x00,0xE0,0x03,0xF8,0x03,0x00,0xFC,0x01,0xE0,0x1F,0x80,0x7F,0x00,0x80,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0xF0,0xFF,0x00,0x00,
 
 	/* Index 10, character 42 "*" (width: 16 pixels) */
-	0x10, 0x10,0x10,0x00,0x00,0x00,0x38,0x30,0x00,0x00,0x00,0x70,0x18,0x00,0x00,0x00,0x60,0x1C,0x00,0x00,0x00,0xE0,0x0C,0x00,0x00,0x00,0xC0,0x0E,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xFE,0xFF,0x01,0x00,0x00,0xFE,0xFF,0x01,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xC0,0x0E,0x00,0x00,0x00,0xE0,0x0C,0x00,0x00,0x00,0x60,0x1C,0x00,0x00,0x00,0x70,0x18,0x00,0x00,0x00,0x38,0x38,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,
+	0x10,0x10,0x00,0x00,0x00,0x38,0x30,0x00,0x00,0x00,0x70,0x18,0x00,0x00,0x00,0x60,0x1C,0x00,0x00,0x00,0xE0,0x0C,0x00,0x00,0x00,0xC0,0x0E,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xFE,0xFF,0x01,0x00,0x00,0xFE,0xFF,0x01,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xC0,0x0E,0x00,0x00,0x00,0xE0,0x0C,0x00,0x00,0x00,0x60,0x1C,0x00,0x00,0x00,0x70,0x18,0x00,0x00,0x00,0x38,0x38,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 21 pixels) */
-	0x15, 0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0xC0,0xFF,0xFF,0x07,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,
+	0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0xC0,0xFF,0xFF,0x07,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,
 
 	/* Index 12, character 44 "," (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x80,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x80,0x00,0x00,
 
 	/* Index 13, character 45 "-" (width: 10 pixels) */
-	0xA, 0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,
+	0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,
 
 	/* Index 14, character 46 "." (width: 4 pixels) */
-	0x4, 0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,
+	0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,
 
 	/* Index 15, character 47 "/" (width: 13 pixels) */
-	0xD, 0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,
 
 	/* Index 16, character 48 "0" (width: 16 pixels) */
-	0x10, 0x00,0xFE,0x1F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xF0,0xFF,0xFF,0x03,0x00,0xF8,0x01,0xE0,0x07,0x00,0x78,0x00,0x80,0x07,0x00,0x3C,0x00,0x00,0x0F,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x0F,0x00,0x78,0x00,0x80,0x07,0x00,0xF8,0x01,0xE0,0x07,0x00,0xF0,0xFF,0xFF,0x03,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,
+	0x00,0xFE,0x1F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xF0,0xFF,0xFF,0x03,0x00,0xF8,0x01,0xE0,0x07,0x00,0x78,0x00,0x80,0x07,0x00,0x3C,0x00,0x00,0x0F,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x0F,0x00,0x78,0x00,0x80,0x07,0x00,0xF8,0x01,0xE0,0x07,0x00,0xF0,0xFF,0xFF,0x03,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,
 
 	/* Index 17, character 49 "1" (width: 13 pixels) */
-	0xD, 0x80,0x03,0x00,0x0E,0x00,0x80,0x03,0x00,0x0E,0x00,0x80,0x03,0x00,0x0E,0x00,0xC0,0x03,0x00,0x0E,0x00,0xC0,0x03,0x00,0x0E,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,
+	0x80,0x03,0x00,0x0E,0x00,0x80,0x03,0x00,0x0E,0x00,0x80,0x03,0x00,0x0E,0x00,0xC0,0x03,0x00,0x0E,0x00,0xC0,0x03,0x00,0x0E,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,
 
 	/* Index 18, character 50 "2" (width: 16 pixels) */
-	0x10, 0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x80,0x0F,0x00,0x38,0x00,0xC0,0x0F,0x00,0x38,0x00,0xE0,0x0F,0x00,0x1C,0x00,0xF0,0x0E,0x00,0x1C,0x00,0x78,0x0E,0x00,0x1C,0x00,0x3C,0x0E,0x00,0x1C,0x00,0x1E,0x0E,0x00,0x1C,0x00,0x0F,0x0E,0x00,0x1C,0x80,0x07,0x0E,0x00,0x3C,0xC0,0x03,0x0E,0x00,0x78,0xF0,0x01,0x0E,0x00,0xF8,0xFF,0x00,0x0E,0x00,0xF0,0x3F,0x00,0x0E,0x00,0xC0,0x0F,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,
+	0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x80,0x0F,0x00,0x38,0x00,0xC0,0x0F,0x00,0x38,0x00,0xE0,0x0F,0x00,0x1C,0x00,0xF0,0x0E,0x00,0x1C,0x00,0x78,0x0E,0x00,0x1C,0x00,0x3C,0x0E,0x00,0x1C,0x00,0x1E,0x0E,0x00,0x1C,0x00,0x0F,0x0E,0x00,0x1C,0x80,0x07,0x0E,0x00,0x3C,0xC0,0x03,0x0E,0x00,0x78,0xF0,0x01,0x0E,0x00,0xF8,0xFF,0x00,0x0E,0x00,0xF0,0x3F,0x00,0x0E,0x00,0xC0,0x0F,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,
 
 	/* Index 19, character 51 "3" (width: 15 pixels) */
-	0xF, 0x00,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x0F,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xF0,0x00,0x0F,0x00,0x3C,0xF0,0x01,0x07,0x00,0x78,0x98,0xC3,0x07,0x00,0xF8,0x9F,0xFF,0x03,0x00,0xF0,0x0F,0xFF,0x01,0x00,0xC0,0x07,0x7C,0x00,0x00,
+	0x00,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x0F,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xF0,0x00,0x0F,0x00,0x3C,0xF0,0x01,0x07,0x00,0x78,0x98,0xC3,0x07,0x00,0xF8,0x9F,0xFF,0x03,0x00,0xF0,0x0F,0xFF,0x01,0x00,0xC0,0x07,0x7C,0x00,0x00,
 
 	/* Index 20, character 52 "4" (width: 18 pixels) */
-	0x12, 0x00,0x80,0x07,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x70,0x07,0x00,0x00,0x00,0x38,0x07,0x00,0x00,0x00,0x1C,0x07,0x00,0x00,0x00,0x0E,0x07,0x00,0x00,0x00,0x07,0x07,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0xC0,0x01,0x07,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x70,0x00,0x07,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,
+	0x00,0x80,0x07,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x70,0x07,0x00,0x00,0x00,0x38,0x07,0x00,0x00,0x00,0x1C,0x07,0x00,0x00,0x00,0x0E,0x07,0x00,0x00,0x00,0x07,0x07,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0xC0,0x01,0x07,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x70,0x00,0x07,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,
 
 	/* Index 21, character 53 "5" (width: 15 pixels) */
-	0xF, 0x00,0x00,0x80,0x07,0x00,0xF8,0xFF,0x00,0x07,0x00,0xF8,0xFF,0x00,0x07,0x00,0xF8,0x7F,0x00,0x0F,0x00,0x38,0x70,0x00,0x0E,0x00,0x38,0x70,0x00,0x0E,0x00,0x38,0x70,0x00,0x0E,0x00,0x38,0x70,0x00,0x0E,0x00,0x38,0x70,0x00,0x0E,0x00,0x38,0xF0,0x00,0x0F,0x00,0x38,0xE0,0x00,0x07,0x00,0x38,0xE0,0xC1,0x07,0x00,0x38,0xC0,0xFF,0x03,0x00,0x38,0x80,0xFF,0x01,0x00,0x38,0x00,0x7F,0x00,0x00,
+	0x00,0x00,0x80,0x07,0x00,0xF8,0xFF,0x00,0x07,0x00,0xF8,0xFF,0x00,0x07,0x00,0xF8,0x7F,0x00,0x0F,0x00,0x38,0x70,0x00,0x0E,0x00,0x38,0x70,0x00,0x0E,0x00,0x38,0x70,0x00,0x0E,0x00,0x38,0x70,0x00,0x0E,0x00,0x38,0x70,0x00,0x0E,0x00,0x38,0xF0,0x00,0x0F,0x00,0x38,0xE0,0x00,0x07,0x00,0x38,0xE0,0xC1,0x07,0x00,0x38,0xC0,0xFF,0x03,0x00,0x38,0x80,0xFF,0x01,0x00,0x38,0x00,0x7F,0x00,0x00,
 
 	/* Index 22, character 54 "6" (width: 17 pixels) */
-	0x11, 0x00,0xF8,0x1F,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0xE0,0x67,0xE0,0x03,0x00,0xF0,0x70,0x80,0x07,0x00,0x70,0x30,0x00,0x07,0x00,0x38,0x38,0x00,0x0E,0x00,0x38,0x38,0x00,0x0E,0x00,0x1C,0x38,0x00,0x0E,0x00,0x1C,0x38,0x00,0x0E,0x00,0x1C,0x38,0x00,0x0E,0x00,0x1C,0x78,0x00,0x0F,0x00,0x1C,0x70,0x00,0x07,0x00,0x1C,0xF0,0xC1,0x03,0x00,0x3C,0xE0,0xFF,0x03,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,
+	0x00,0xF8,0x1F,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0xE0,0x67,0xE0,0x03,0x00,0xF0,0x70,0x80,0x07,0x00,0x70,0x30,0x00,0x07,0x00,0x38,0x38,0x00,0x0E,0x00,0x38,0x38,0x00,0x0E,0x00,0x1C,0x38,0x00,0x0E,0x00,0x1C,0x38,0x00,0x0E,0x00,0x1C,0x38,0x00,0x0E,0x00,0x1C,0x78,0x00,0x0F,0x00,0x1C,0x70,0x00,0x07,0x00,0x1C,0xF0,0xC1,0x03,0x00,0x3C,0xE0,0xFF,0x03,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,
 
 	/* Index 23, character 55 "7" (width: 16 pixels) */
-	0x10, 0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x08,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0F,0x00,0x38,0x00,0xC0,0x07,0x00,0x38,0x00,0xF0,0x01,0x00,0x38,0x00,0xFC,0x00,0x00,0x38,0x00,0x3E,0x00,0x00,0x38,0x80,0x0F,0x00,0x00,0x38,0xE0,0x03,0x00,0x00,0x38,0xF8,0x01,0x00,0x00,0x38,0x7E,0x00,0x00,0x00,0x38,0x1F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,
+	0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x08,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0F,0x00,0x38,0x00,0xC0,0x07,0x00,0x38,0x00,0xF0,0x01,0x00,0x38,0x00,0xFC,0x00,0x00,0x38,0x00,0x3E,0x00,0x00,0x38,0x80,0x0F,0x00,0x00,0x38,0xE0,0x03,0x00,0x00,0x38,0xF8,0x01,0x00,0x00,0x38,0x7E,0x00,0x00,0x00,0x38,0x1F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,
 
 	/* Index 24, character 56 "8" (width: 17 pixels) */
-	0x11, 0x00,0x00,0x7C,0x00,0x00,0xC0,0x07,0xFE,0x01,0x00,0xF0,0x0F,0xFF,0x03,0x00,0xF0,0x9F,0xC3,0x07,0x00,0x78,0xFC,0x01,0x07,0x00,0x3C,0xF8,0x00,0x0F,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x3C,0xF0,0x01,0x0F,0x00,0x78,0xF8,0x01,0x07,0x00,0xF8,0x9F,0x83,0x07,0x00,0xF0,0x0F,0xFF,0x03,0x00,0xC0,0x07,0xFF,0x01,0x00,0x00,0x00,0x7C,0x00,0x00,
+	0x00,0x00,0x7C,0x00,0x00,0xC0,0x07,0xFE,0x01,0x00,0xF0,0x0F,0xFF,0x03,0x00,0xF0,0x9F,0xC3,0x07,0x00,0x78,0xFC,0x01,0x07,0x00,0x3C,0xF8,0x00,0x0F,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x3C,0xF0,0x01,0x0F,0x00,0x78,0xF8,0x01,0x07,0x00,0xF8,0x9F,0x83,0x07,0x00,0xF0,0x0F,0xFF,0x03,0x00,0xC0,0x07,0xFF,0x01,0x00,0x00,0x00,0x7C,0x00,0x00,
 
 	/* Index 25, character 57 "9" (width: 17 pixels) */
-	0x11, 0x80,0x1F,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x0F,0x00,0xF8,0xE0,0x01,0x0E,0x00,0x38,0xC0,0x01,0x0E,0x00,0x3C,0xC0,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x07,0x00,0x1C,0x80,0x03,0x07,0x00,0x38,0x80,0x81,0x03,0x00,0x78,0xC0,0xE1,0x03,0x00,0xF0,0xC1,0xF9,0x01,0x00,0xE0,0xFF,0x7F,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,
+	0x80,0x1F,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x0F,0x00,0xF8,0xE0,0x01,0x0E,0x00,0x38,0xC0,0x01,0x0E,0x00,0x3C,0xC0,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x07,0x00,0x1C,0x80,0x03,0x07,0x00,0x38,0x80,0x81,0x03,0x00,0x78,0xC0,0xE1,0x03,0x00,0xF0,0xC1,0xF9,0x01,0x00,0xE0,0xFF,0x7F,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,
 
 	/* Index 26, character 58 ":" (width: 4 pixels) */
-	0x4, 0x00,0x3E,0x80,0x0F,0x00,0x00,0x3E,0x80,0x0F,0x00,0x00,0x3E,0x80,0x0F,0x00,0x00,0x3E,0x80,0x0F,0x00,
+	0x00,0x3E,0x80,0x0F,0x00,0x00,0x3E,0x80,0x0F,0x00,0x00,0x3E,0x80,0x0F,0x00,0x00,0x3E,0x80,0x0F,0x00,
 
 	/* Index 27, character 59 ";" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xF0,0x03,0x00,0x3E,0x00,0xFF,0x03,0x00,0x3E,0x80,0x7F,0x00,0x00,0x3E,0x80,0x1F,0x00,0x00,0x3E,0x80,0x07,0x00,0x00,0x00,0x80,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xF0,0x03,0x00,0x3E,0x00,0xFF,0x03,0x00,0x3E,0x80,0x7F,0x00,0x00,0x3E,0x80,0x1F,0x00,0x00,0x3E,0x80,0x07,0x00,0x00,0x00,0x80,0x00,0x00,
 
 	/* Index 28, character 60 "<" (width: 18 pixels) */
-	0x12, 0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xC0,0x1D,0x00,0x00,0x00,0xC0,0x1D,0x00,0x00,0x00,0xE0,0x38,0x00,0x00,0x00,0xE0,0x38,0x00,0x00,0x00,0x70,0x70,0x00,0x00,0x00,0x70,0x70,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x1C,0xC0,0x01,0x00,0x00,0x1C,0xC0,0x01,0x00,0x00,0x0E,0x80,0x03,0x00,0x00,0x0E,0x80,0x03,0x00,0x00,0x07,0x00,0x07,0x00,
+	0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xC0,0x1D,0x00,0x00,0x00,0xC0,0x1D,0x00,0x00,0x00,0xE0,0x38,0x00,0x00,0x00,0xE0,0x38,0x00,0x00,0x00,0x70,0x70,0x00,0x00,0x00,0x70,0x70,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x1C,0xC0,0x01,0x00,0x00,0x1C,0xC0,0x01,0x00,0x00,0x0E,0x80,0x03,0x00,0x00,0x0E,0x80,0x03,0x00,0x00,0x07,0x00,0x07,0x00,
 
 	/* Index 29, character 61 "=" (width: 19 pixels) */
-	0x13, 0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,
+	0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,
 
 	/* Index 30, character 62 ">" (width: 18 pixels) */
-	0x12, 0x00,0x07,0x00,0x07,0x00,0x00,0x0E,0x80,0x03,0x00,0x00,0x0E,0x80,0x03,0x00,0x00,0x1C,0xC0,0x01,0x00,0x00,0x1C,0xC0,0x01,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x70,0x70,0x00,0x00,0x00,0x70,0x70,0x00,0x00,0x00,0xE0,0x38,0x00,0x00,0x00,0xE0,0x38,0x00,0x00,0x00,0xC0,0x1D,0x00,0x00,0x00,0xC0,0x1D,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,
+	0x00,0x07,0x00,0x07,0x00,0x00,0x0E,0x80,0x03,0x00,0x00,0x0E,0x80,0x03,0x00,0x00,0x1C,0xC0,0x01,0x00,0x00,0x1C,0xC0,0x01,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x70,0x70,0x00,0x00,0x00,0x70,0x70,0x00,0x00,0x00,0xE0,0x38,0x00,0x00,0x00,0xE0,0x38,0x00,0x00,0x00,0xC0,0x1D,0x00,0x00,0x00,0xC0,0x1D,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,
 
 	/* Index 31, character 63 "?" (width: 14 pixels) */
-	0xE, 0x78,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x1F,0x0F,0x00,0x1C,0x80,0x1F,0x0F,0x00,0x1C,0xC0,0x1F,0x0F,0x00,0x1C,0xC0,0x01,0x00,0x00,0x1C,0xE0,0x00,0x00,0x00,0x3C,0xF0,0x00,0x00,0x00,0x78,0x78,0x00,0x00,0x00,0xF8,0x3F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,
+	0x78,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x1F,0x0F,0x00,0x1C,0x80,0x1F,0x0F,0x00,0x1C,0xC0,0x1F,0x0F,0x00,0x1C,0xC0,0x01,0x00,0x00,0x1C,0xE0,0x00,0x00,0x00,0x3C,0xF0,0x00,0x00,0x00,0x78,0x78,0x00,0x00,0x00,0xF8,0x3F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 28 pixels) */
-	0x1C, 0x00,0xE0,0x1F,0x00,0x00,0x00,0xFC,0xFF,0x00,0x00,0x00,0x1F,0xE0,0x03,0x00,0x80,0x07,0x00,0x07,0x00,0xC0,0x01,0x00,0x0E,0x00,0xE0,0x00,0x00,0x18,0x00,0x70,0xC0,0x1F,0x30,0x00,0x30,0xF0,0xFF,0x30,0x00,0x18,0xF8,0xFF,0x61,0x00,0x18,0x3C,0xE0,0x61,0x00,0x1C,0x0C,0xC0,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0xC0,0xC1,0x00,0x0C,0x0C,0xC0,0xC0,0x00,0x0C,0xFE,0xFF,0xC3,0x00,0x18,0xFE,0xFF,0xE3,0x00,0x18,0xFE,0xFF,0xE3,0x00,0x18,0x00,0x00,0x03,0x00,0x30,0x00,0x00,0x03,0x00,0x70,0x00,0x00,0x03,0x00,0xE0,0x00,0x00,0x03,0x00,0xC0,0x03,0x00,0x03,0x00,0x00,0x1F,0xC0,0x03,0x00,0x00,0xFE,0xFF,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,
+	0x00,0xE0,0x1F,0x00,0x00,0x00,0xFC,0xFF,0x00,0x00,0x00,0x1F,0xE0,0x03,0x00,0x80,0x07,0x00,0x07,0x00,0xC0,0x01,0x00,0x0E,0x00,0xE0,0x00,0x00,0x18,0x00,0x70,0xC0,0x1F,0x30,0x00,0x30,0xF0,0xFF,0x30,0x00,0x18,0xF8,0xFF,0x61,0x00,0x18,0x3C,0xE0,0x61,0x00,0x1C,0x0C,0xC0,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0xC0,0xC1,0x00,0x0C,0x0C,0xC0,0xC0,0x00,0x0C,0xFE,0xFF,0xC3,0x00,0x18,0xFE,0xFF,0xE3,0x00,0x18,0xFE,0xFF,0xE3,0x00,0x18,0x00,0x00,0x03,0x00,0x30,0x00,0x00,0x03,0x00,0x70,0x00,0x00,0x03,0x00,0xE0,0x00,0x00,0x03,0x00,0xC0,0x03,0x00,0x03,0x00,0x00,0x1F,0xC0,0x03,0x00,0x00,0xFE,0xFF,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,
 
 	/* Index 33, character 65 "A" (width: 21 pixels) */
-	0x15, 0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0xC0,0x7F,0x1C,0x00,0x00,0xF8,0x0F,0x1C,0x00,0x00,0xF8,0x01,0x1C,0x00,0x00,0x38,0x00,0x1C,0x00,0x00,0xF8,0x01,0x1C,0x00,0x00,0xF8,0x0F,0x1C,0x00,0x00,0xC0,0x7F,0x1C,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x08,0x00,
+	0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0xC0,0x7F,0x1C,0x00,0x00,0xF8,0x0F,0x1C,0x00,0x00,0xF8,0x01,0x1C,0x00,0x00,0x38,0x00,0x1C,0x00,0x00,0xF8,0x01,0x1C,0x00,0x00,0xF8,0x0F,0x1C,0x00,0x00,0xC0,0x7F,0x1C,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x08,0x00,
 
 	/* Index 34, character 66 "B" (width: 17 pixels) */
-	0x11, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x78,0xF0,0x01,0x07,0x00,0x70,0xF8,0x01,0x07,0x00,0xF0,0xDF,0x83,0x07,0x00,0xE0,0x8F,0xFF,0x03,0x00,0xC0,0x07,0xFF,0x01,0x00,0x00,0x00,0x7C,0x00,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x78,0xF0,0x01,0x07,0x00,0x70,0xF8,0x01,0x07,0x00,0xF0,0xDF,0x83,0x07,0x00,0xE0,0x8F,0xFF,0x03,0x00,0xC0,0x07,0xFF,0x01,0x00,0x00,0x00,0x7C,0x00,0x00,
 
 	/* Index 35, character 67 "C" (width: 19 pixels) */
-	0x13, 0x00,0xF8,0x0F,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x0F,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x78,0x00,0x80,0x07,0x00,0xF0,0x00,0xC0,0x03,0x00,
+	0x00,0xF8,0x0F,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x0F,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x78,0x00,0x80,0x07,0x00,0xF0,0x00,0xC0,0x03,0x00,
 
 	/* Index 36, character 68 "D" (width: 20 pixels) */
-	0x14, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x78,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x07,0x00,0x70,0x00,0x00,0x07,0x00,0xF0,0x00,0x80,0x07,0x00,0xE0,0x01,0xC0,0x03,0x00,0xE0,0x03,0xE0,0x03,0x00,0xC0,0x0F,0xF8,0x01,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x78,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x07,0x00,0x70,0x00,0x00,0x07,0x00,0xF0,0x00,0x80,0x07,0x00,0xE0,0x01,0xC0,0x03,0x00,0xE0,0x03,0xE0,0x03,0x00,0xC0,0x0F,0xF8,0x01,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,
 
 	/* Index 37, character 69 "E" (width: 16 pixels) */
-	0x10, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,
 
 	/* Index 38, character 70 "F" (width: 15 pixels) */
-	0xF, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,
 
 	/* Index 39, character 71 "G" (width: 20 pixels) */
-	0x14, 0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0x70,0x00,0x80,0x07,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x1C,0x00,0x00,0x0F,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x3C,0x80,0x03,0x0E,0x00,0x38,0x80,0x03,0x07,0x00,0x78,0x80,0xFF,0x07,0x00,0x78,0x80,0xFF,0x07,0x00,0xF0,0x80,0xFF,0x03,0x00,
+	0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0x70,0x00,0x80,0x07,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x1C,0x00,0x00,0x0F,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x3C,0x80,0x03,0x0E,0x00,0x38,0x80,0x03,0x07,0x00,0x78,0x80,0xFF,0x07,0x00,0x78,0x80,0xFF,0x07,0x00,0xF0,0x80,0xFF,0x03,0x00,
 
 	/* Index 40, character 72 "H" (width: 18 pixels) */
-	0x12, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,
 
 	/* Index 41, character 73 "I" (width: 9 pixels) */
-	0x9, 0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,
+	0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,
 
 	/* Index 42, character 74 "J" (width: 13 pixels) */
-	0xD, 0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x80,0x07,0x00,0xF8,0xFF,0xFF,0x03,0x00,0xF8,0xFF,0xFF,0x03,0x00,0xF8,0xFF,0xFF,0x00,0x00,
+	0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x80,0x07,0x00,0xF8,0xFF,0xFF,0x03,0x00,0xF8,0xFF,0xFF,0x03,0x00,0xF8,0xFF,0xFF,0x00,0x00,
 
 	/* Index 43, character 75 "K" (width: 19 pixels) */
-	0x13, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xBC,0x07,0x00,0x00,0x00,0x1E,0x0F,0x00,0x00,0x00,0x0F,0x3E,0x00,0x00,0xC0,0x07,0x7C,0x00,0x00,0xE0,0x03,0xF8,0x00,0x00,0xF0,0x01,0xF0,0x01,0x00,0xF8,0x00,0xC0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x0F,0x00,0x18,0x00,0x00,0x0E,0x00,0x08,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xBC,0x07,0x00,0x00,0x00,0x1E,0x0F,0x00,0x00,0x00,0x0F,0x3E,0x00,0x00,0xC0,0x07,0x7C,0x00,0x00,0xE0,0x03,0xF8,0x00,0x00,0xF0,0x01,0xF0,0x01,0x00,0xF8,0x00,0xC0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x0F,0x00,0x18,0x00,0x00,0x0E,0x00,0x08,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
 
 	/* Index 44, character 76 "L" (width: 14 pixels) */
-	0xE, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,
 
 	/* Index 45, character 77 "M" (width: 21 pixels) */
-	0x15, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,
 
 	/* Index 46, character 78 "N" (width: 17 pixels) */
-	0x11, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xC0,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xC0,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,
 
 	/* Index 47, character 79 "O" (width: 23 pixels) */
-	0x17, 0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x78,0x00,0x80,0x07,0x00,0xF0,0x01,0xE0,0x03,0x00,0xE0,0x07,0xF8,0x01,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,
+	0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x78,0x00,0x80,0x07,0x00,0xF0,0x01,0xE0,0x03,0x00,0xE0,0x07,0xF8,0x01,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,
 
 	/* Index 48, character 80 "P" (width: 15 pixels) */
-	0xF, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x78,0x80,0x03,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0xF0,0xE0,0x03,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x78,0x80,0x03,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0xF0,0xE0,0x03,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 23 pixels) */
-	0x17, 0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x7E,0x00,0x1C,0x00,0x00,0xFE,0x01,0x1C,0x00,0x00,0xFE,0x03,0x38,0x00,0x00,0xC7,0x03,0x38,0x00,0x00,0x87,0x07,0x78,0x00,0x80,0x03,0x07,0xF0,0x01,0xE0,0x03,0x07,0xE0,0x07,0xF8,0x01,0x07,0xC0,0xFF,0xFF,0x00,0x07,0x00,0xFF,0x3F,0x80,0x07,0x00,0xF8,0x07,0x80,0x07,
+	0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x7E,0x00,0x1C,0x00,0x00,0xFE,0x01,0x1C,0x00,0x00,0xFE,0x03,0x38,0x00,0x00,0xC7,0x03,0x38,0x00,0x00,0x87,0x07,0x78,0x00,0x80,0x03,0x07,0xF0,0x01,0xE0,0x03,0x07,0xE0,0x07,0xF8,0x01,0x07,0xC0,0xFF,0xFF,0x00,0x07,0x00,0xFF,0x3F,0x80,0x07,0x00,0xF8,0x07,0x80,0x07,
 
 	/* Index 50, character 82 "R" (width: 20 pixels) */
-	0x14, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x07,0x00,0x00,0x38,0x80,0x0F,0x00,0x00,0x38,0xC0,0x1F,0x00,0x00,0x70,0xC0,0x3D,0x00,0x00,0xF0,0xF0,0xF8,0x00,0x00,0xE0,0x7F,0xF0,0x01,0x00,0xE0,0x3F,0xE0,0x03,0x00,0x80,0x1F,0x80,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x07,0x00,0x00,0x38,0x80,0x0F,0x00,0x00,0x38,0xC0,0x1F,0x00,0x00,0x70,0xC0,0x3D,0x00,0x00,0xF0,0xF0,0xF8,0x00,0x00,0xE0,0x7F,0xF0,0x01,0x00,0xE0,0x3F,0xE0,0x03,0x00,0x80,0x1F,0x80,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
 
 	/* Index 51, character 83 "S" (width: 17 pixels) */
-	0x11, 0x80,0x0F,0xC0,0x03,0x00,0xE0,0x3F,0x80,0x07,0x00,0xF0,0x3F,0x00,0x07,0x00,0x78,0x78,0x00,0x07,0x00,0x38,0xF0,0x00,0x0F,0x00,0x3C,0xF0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x01,0x0E,0x00,0x1C,0xE0,0x01,0x0E,0x00,0x1C,0xC0,0x01,0x0E,0x00,0x1C,0xC0,0x01,0x0F,0x00,0x3C,0xC0,0x03,0x07,0x00,0x38,0x80,0x87,0x07,0x00,0x78,0x80,0xFF,0x03,0x00,0xF8,0x00,0xFF,0x01,0x00,0x00,0x00,0x7C,0x00,0x00,
+	0x80,0x0F,0xC0,0x03,0x00,0xE0,0x3F,0x80,0x07,0x00,0xF0,0x3F,0x00,0x07,0x00,0x78,0x78,0x00,0x07,0x00,0x38,0xF0,0x00,0x0F,0x00,0x3C,0xF0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x01,0x0E,0x00,0x1C,0xE0,0x01,0x0E,0x00,0x1C,0xC0,0x01,0x0E,0x00,0x1C,0xC0,0x01,0x0F,0x00,0x3C,0xC0,0x03,0x07,0x00,0x38,0x80,0x87,0x07,0x00,0x78,0x80,0xFF,0x03,0x00,0xF8,0x00,0xFF,0x01,0x00,0x00,0x00,0x7C,0x00,0x00,
 
 	/* Index 52, character 84 "T" (width: 21 pixels) */
-	0x15, 0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,
+	0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,
 
 	/* Index 53, character 85 "U" (width: 19 pixels) */
-	0x13, 0xF8,0xFF,0x3F,0x00,0x00,0xF8,0xFF,0xFF,0x01,0x00,0xF8,0xFF,0xFF,0x03,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xC0,0x07,0x00,0xF8,0xFF,0xFF,0x03,0x00,0xF8,0xFF,0xFF,0x01,0x00,0xF8,0xFF,0x3F,0x00,0x00,
+	0xF8,0xFF,0x3F,0x00,0x00,0xF8,0xFF,0xFF,0x01,0x00,0xF8,0xFF,0xFF,0x03,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xC0,0x07,0x00,0xF8,0xFF,0xFF,0x03,0x00,0xF8,0xFF,0xFF,0x01,0x00,0xF8,0xFF,0x3F,0x00,0x00,
 
 	/* Index 54, character 86 "V" (width: 21 pixels) */
-	0x15, 0x08,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,
+	0x08,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,
 
 	/* Index 55, character 87 "W" (width: 32 pixels) */
-	0x20, 0x18,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,
+	0x18,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,
 
 	/* Index 56, character 88 "X" (width: 20 pixels) */
-	0x14, 0x08,0x00,0x00,0x08,0x00,0x18,0x00,0x00,0x0C,0x00,0x78,0x00,0x00,0x0F,0x00,0xF0,0x00,0x80,0x07,0x00,0xE0,0x03,0xE0,0x03,0x00,0x80,0x07,0xF0,0x00,0x00,0x00,0x1F,0x7C,0x00,0x00,0x00,0x3C,0x1E,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x3C,0x1E,0x00,0x00,0x00,0x1F,0x7C,0x00,0x00,0x80,0x07,0xF0,0x00,0x00,0xE0,0x03,0xE0,0x03,0x00,0xF0,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x0F,0x00,0x18,0x00,0x00,0x0C,0x00,0x08,0x00,0x00,0x08,0x00,
+	0x08,0x00,0x00,0x08,0x00,0x18,0x00,0x00,0x0C,0x00,0x78,0x00,0x00,0x0F,0x00,0xF0,0x00,0x80,0x07,0x00,0xE0,0x03,0xE0,0x03,0x00,0x80,0x07,0xF0,0x00,0x00,0x00,0x1F,0x7C,0x00,0x00,0x00,0x3C,0x1E,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x3C,0x1E,0x00,0x00,0x00,0x1F,0x7C,0x00,0x00,0x80,0x07,0xF0,0x00,0x00,0xE0,0x03,0xE0,0x03,0x00,0xF0,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x0F,0x00,0x18,0x00,0x00,0x0C,0x00,0x08,0x00,0x00,0x08,0x00,
 
 	/* Index 57, character 89 "Y" (width: 21 pixels) */
-	0x15, 0x08,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0xC0,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,
+	0x08,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0xC0,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,
 
 	/* Index 58, character 90 "Z" (width: 18 pixels) */
-	0x12, 0x00,0x00,0x00,0x0F,0x00,0x38,0x00,0x80,0x0F,0x00,0x38,0x00,0xC0,0x0F,0x00,0x38,0x00,0xF0,0x0E,0x00,0x38,0x00,0x78,0x0E,0x00,0x38,0x00,0x3C,0x0E,0x00,0x38,0x00,0x1E,0x0E,0x00,0x38,0x80,0x07,0x0E,0x00,0x38,0xC0,0x03,0x0E,0x00,0x38,0xE0,0x01,0x0E,0x00,0x38,0x70,0x00,0x0E,0x00,0x38,0x3C,0x00,0x0E,0x00,0x38,0x1E,0x00,0x0E,0x00,0x38,0x0F,0x00,0x0E,0x00,0xB8,0x03,0x00,0x0E,0x00,0xF8,0x01,0x00,0x0E,0x00,0xF8,0x00,0x00,0x0E,0x00,0x78,0x00,0x00,0x0E,0x00,
+	0x00,0x00,0x00,0x0F,0x00,0x38,0x00,0x80,0x0F,0x00,0x38,0x00,0xC0,0x0F,0x00,0x38,0x00,0xF0,0x0E,0x00,0x38,0x00,0x78,0x0E,0x00,0x38,0x00,0x3C,0x0E,0x00,0x38,0x00,0x1E,0x0E,0x00,0x38,0x80,0x07,0x0E,0x00,0x38,0xC0,0x03,0x0E,0x00,0x38,0xE0,0x01,0x0E,0x00,0x38,0x70,0x00,0x0E,0x00,0x38,0x3C,0x00,0x0E,0x00,0x38,0x1E,0x00,0x0E,0x00,0x38,0x0F,0x00,0x0E,0x00,0xB8,0x03,0x00,0x0E,0x00,0xF8,0x01,0x00,0x0E,0x00,0xF8,0x00,0x00,0x0E,0x00,0x78,0x00,0x00,0x0E,0x00,
 
 	/* Index 59, character 91 "[" (width: 9 pixels) */
-	0x9, 0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,
+	0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,
 
 	/* Index 60, character 92 "\" (width: 13 pixels) */
-	0xD, 0x06,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0x03,
+	0x06,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0x03,
 
 	/* Index 61, character 93 "]" (width: 9 pixels) */
-	0x9, 0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,
+	0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,
 
 	/* Index 62, character 94 "^" (width: 21 pixels) */
-	0x15, 0x00,0x00,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x01,0x00,0x00,
+	0x00,0x00,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x01,0x00,0x00,
 
 	/* Index 63, character 95 "_" (width: 19 pixels) */
-	0x13, 0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,
+	0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,
 
 	/* Index 64, character 96 "`" (width: 7 pixels) */
-	0x7, 0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,
+	0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 15 pixels) */
-	0xF, 0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x0E,0xFE,0x07,0x00,0x00,0x0F,0x0F,0x0F,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x87,0x03,0x07,0x00,0x00,0x87,0x03,0x07,0x00,0x00,0x8E,0x83,0x03,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF8,0xFF,0x0F,0x00,
+	0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x0E,0xFE,0x07,0x00,0x00,0x0F,0x0F,0x0F,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x87,0x03,0x07,0x00,0x00,0x87,0x03,0x07,0x00,0x00,0x8E,0x83,0x03,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF8,0xFF,0x0F,0x00,
 
 	/* Index 66, character 98 "b" (width: 16 pixels) */
-	0x10, 0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x07,0x00,0x00,0x0E,0x00,0x06,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0F,0x00,0x00,0x0F,0x80,0x07,0x00,0x00,0x3E,0xC0,0x03,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,
+	0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x07,0x00,0x00,0x0E,0x00,0x06,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0F,0x00,0x00,0x0F,0x80,0x07,0x00,0x00,0x3E,0xC0,0x03,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,
 
 	/* Index 67, character 99 "c" (width: 14 pixels) */
-	0xE, 0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x7C,0xE0,0x07,0x00,0x00,0x1E,0x80,0x07,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x0F,0x00,0x0F,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x1E,0x80,0x07,0x00,
+	0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x7C,0xE0,0x07,0x00,0x00,0x1E,0x80,0x07,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x0F,0x00,0x0F,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x1E,0x80,0x07,0x00,
 
 	/* Index 68, character 100 "d" (width: 16 pixels) */
-	0x10, 0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0x1E,0x00,0x07,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x06,0x00,0x07,0x00,0x00,0x0E,0x80,0x03,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,
+	0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0x1E,0x00,0x07,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x06,0x00,0x07,0x00,0x00,0x0E,0x80,0x03,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,
 
 	/* Index 69, character 101 "e" (width: 16 pixels) */
-	0x10, 0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xF8,0xFF,0x01,0x00,0x00,0x9C,0xE3,0x03,0x00,0x00,0x8E,0x83,0x07,0x00,0x00,0x8E,0x03,0x07,0x00,0x00,0x87,0x03,0x0F,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x8F,0x03,0x0E,0x00,0x00,0x9E,0x03,0x0E,0x00,0x00,0xFC,0x03,0x07,0x00,0x00,0xF8,0x03,0x07,0x00,0x00,0xE0,0x83,0x07,0x00,
+	0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xF8,0xFF,0x01,0x00,0x00,0x9C,0xE3,0x03,0x00,0x00,0x8E,0x83,0x07,0x00,0x00,0x8E,0x03,0x07,0x00,0x00,0x87,0x03,0x0F,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x8F,0x03,0x0E,0x00,0x00,0x9E,0x03,0x0E,0x00,0x00,0xFC,0x03,0x07,0x00,0x00,0xF8,0x03,0x07,0x00,0x00,0xE0,0x83,0x07,0x00,
 
 	/* Index 70, character 102 "f" (width: 12 pixels) */
-	0xC, 0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xFC,0xFF,0xFF,0x0F,0x00,0x3C,0x0E,0x00,0x00,0x00,0x1E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,
+	0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xFC,0xFF,0xFF,0x0F,0x00,0x3C,0x0E,0x00,0x00,0x00,0x1E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 16 pixels) */
-	0x10, 0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x83,0x03,0x00,0x7C,0xC0,0x87,0x07,0x00,0x1E,0x00,0x07,0x07,0x00,0x0E,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x06,0x07,0x00,0x06,0x00,0x87,0x03,0x00,0x0E,0x00,0xC3,0x03,0x00,0xFE,0xFF,0xFF,0x01,0x00,0xFE,0xFF,0xFF,0x00,0x00,0xFE,0xFF,0x3F,0x00,
+	0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x83,0x03,0x00,0x7C,0xC0,0x87,0x07,0x00,0x1E,0x00,0x07,0x07,0x00,0x0E,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x06,0x07,0x00,0x06,0x00,0x87,0x03,0x00,0x0E,0x00,0xC3,0x03,0x00,0xFE,0xFF,0xFF,0x01,0x00,0xFE,0xFF,0xFF,0x00,0x00,0xFE,0xFF,0x3F,0x00,
 
 	/* Index 72, character 104 "h" (width: 16 pixels) */
-	0x10, 0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,
+	0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,
 
 	/* Index 73, character 105 "i" (width: 3 pixels) */
-	0x3, 0x38,0xFE,0xFF,0x0F,0x00,0x38,0xFE,0xFF,0x0F,0x00,0x38,0xFE,0xFF,0x0F,0x00,
+	0x38,0xFE,0xFF,0x0F,0x00,0x38,0xFE,0xFF,0x0F,0x00,0x38,0xFE,0xFF,0x0F,0x00,
 
 	/* Index 74, character 106 "j" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0xC0,0x03,0x38,0xFE,0xFF,0xFF,0x03,0x38,0xFE,0xFF,0xFF,0x01,0x38,0xFE,0xFF,0x7F,0x00,
+	0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0xC0,0x03,0x38,0xFE,0xFF,0xFF,0x03,0x38,0xFE,0xFF,0xFF,0x01,0x38,0xFE,0xFF,0x7F,0x00,
 
 	/* Index 75, character 107 "k" (width: 16 pixels) */
-	0x10, 0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0xE0,0x3C,0x00,0x00,0x00,0x70,0x78,0x00,0x00,0x00,0x38,0xF0,0x01,0x00,0x00,0x1C,0xE0,0x03,0x00,0x00,0x0E,0x80,0x07,0x00,0x00,0x06,0x00,0x0F,0x00,0x00,0x02,0x00,0x0E,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
+	0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0xE0,0x3C,0x00,0x00,0x00,0x70,0x78,0x00,0x00,0x00,0x38,0xF0,0x01,0x00,0x00,0x1C,0xE0,0x03,0x00,0x00,0x0E,0x80,0x07,0x00,0x00,0x06,0x00,0x0F,0x00,0x00,0x02,0x00,0x0E,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
 
 	/* Index 76, character 108 "l" (width: 3 pixels) */
-	0x3, 0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,
+	0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,
 
 	/* Index 77, character 109 "m" (width: 25 pixels) */
-	0x19, 0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,
+	0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,
 
 	/* Index 78, character 110 "n" (width: 16 pixels) */
-	0x10, 0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,
+	0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,
 
 	/* Index 79, character 111 "o" (width: 17 pixels) */
-	0x11, 0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x3C,0xE0,0x03,0x00,0x00,0x1E,0x80,0x07,0x00,0x00,0x0F,0x00,0x0F,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x0F,0x00,0x0F,0x00,0x00,0x1E,0x80,0x07,0x00,0x00,0x3C,0xC0,0x03,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,
+	0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x3C,0xE0,0x03,0x00,0x00,0x1E,0x80,0x07,0x00,0x00,0x0F,0x00,0x0F,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x0F,0x00,0x0F,0x00,0x00,0x1E,0x80,0x07,0x00,0x00,0x3C,0xC0,0x03,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,
 
 	/* Index 80, character 112 "p" (width: 16 pixels) */
-	0x10, 0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,0x00,0x1C,0x00,0x07,0x00,0x00,0x0E,0x00,0x06,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0F,0x00,0x00,0x0F,0x80,0x07,0x00,0x00,0x3E,0xE0,0x03,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,
+	0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,0x00,0x1C,0x00,0x07,0x00,0x00,0x0E,0x00,0x06,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0F,0x00,0x00,0x0F,0x80,0x07,0x00,0x00,0x3E,0xE0,0x03,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,
 
 	/* Index 81, character 113 "q" (width: 16 pixels) */
-	0x10, 0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0x1E,0x00,0x07,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x06,0x00,0x07,0x00,0x00,0x0E,0x80,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,
+	0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0x1E,0x00,0x07,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x06,0x00,0x07,0x00,0x00,0x0E,0x80,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,
 
 	/* Index 82, character 114 "r" (width: 11 pixels) */
-	0xB, 0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,
+	0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 14 pixels) */
-	0xE, 0x00,0xF8,0x80,0x07,0x00,0x00,0xFC,0x01,0x07,0x00,0x00,0xFE,0x03,0x07,0x00,0x00,0x8E,0x03,0x0F,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x0E,0x0E,0x00,0x00,0x07,0x0E,0x0E,0x00,0x00,0x0F,0x1E,0x07,0x00,0x00,0x0E,0xFC,0x07,0x00,0x00,0x1E,0xFC,0x03,0x00,0x00,0x00,0xF0,0x00,0x00,
+	0x00,0xF8,0x80,0x07,0x00,0x00,0xFC,0x01,0x07,0x00,0x00,0xFE,0x03,0x07,0x00,0x00,0x8E,0x03,0x0F,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x0E,0x0E,0x00,0x00,0x07,0x0E,0x0E,0x00,0x00,0x0F,0x1E,0x07,0x00,0x00,0x0E,0xFC,0x07,0x00,0x00,0x1E,0xFC,0x03,0x00,0x00,0x00,0xF0,0x00,0x00,
 
 	/* Index 84, character 116 "t" (width: 11 pixels) */
-	0xB, 0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0F,0x00,
+	0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0F,0x00,
 
 	/* Index 85, character 117 "u" (width: 16 pixels) */
-	0x10, 0x00,0xFE,0xFF,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,
+	0x00,0xFE,0xFF,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,
 
 	/* Index 86, character 118 "v" (width: 17 pixels) */
-	0x11, 0x00,0x02,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+	0x00,0x02,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
 
 	/* Index 87, character 119 "w" (width: 24 pixels) */
-	0x18, 0x00,0x06,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+	0x00,0x06,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
 
 	/* Index 88, character 120 "x" (width: 17 pixels) */
-	0x11, 0x00,0x02,0x00,0x08,0x00,0x00,0x06,0x00,0x0C,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x3C,0x80,0x07,0x00,0x00,0x78,0xC0,0x03,0x00,0x00,0xF0,0xE0,0x01,0x00,0x00,0xC0,0x7B,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xC0,0x7B,0x00,0x00,0x00,0xF0,0xE0,0x01,0x00,0x00,0x78,0xC0,0x03,0x00,0x00,0x3C,0x80,0x07,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x06,0x00,0x0C,0x00,0x00,0x02,0x00,0x08,0x00,
+	0x00,0x02,0x00,0x08,0x00,0x00,0x06,0x00,0x0C,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x3C,0x80,0x07,0x00,0x00,0x78,0xC0,0x03,0x00,0x00,0xF0,0xE0,0x01,0x00,0x00,0xC0,0x7B,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xC0,0x7B,0x00,0x00,0x00,0xF0,0xE0,0x01,0x00,0x00,0x78,0xC0,0x03,0x00,0x00,0x3C,0x80,0x07,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x06,0x00,0x0C,0x00,0x00,0x02,0x00,0x08,0x00,
 
 	/* Index 89, character 121 "y" (width: 17 pixels) */
-	0x11, 0x00,0x02,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xE0,0x1F,0x00,0x06,0x00,0x80,0xFF,0xC0,0x07,0x00,0x00,0xFC,0xF3,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+	0x00,0x02,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xE0,0x1F,0x00,0x06,0x00,0x80,0xFF,0xC0,0x07,0x00,0x00,0xFC,0xF3,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
 
 	/* Index 90, character 122 "z" (width: 14 pixels) */
-	0xE, 0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x80,0x0F,0x00,0x00,0x0E,0xC0,0x0F,0x00,0x00,0x0E,0xE0,0x0F,0x00,0x00,0x0E,0x70,0x0E,0x00,0x00,0x0E,0x3C,0x0E,0x00,0x00,0x0E,0x1E,0x0E,0x00,0x00,0x0E,0x0F,0x0E,0x00,0x00,0x8E,0x03,0x0E,0x00,0x00,0xEE,0x01,0x0E,0x00,0x00,0xFE,0x00,0x0E,0x00,0x00,0x7E,0x00,0x0E,0x00,0x00,0x1E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,
+	0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x80,0x0F,0x00,0x00,0x0E,0xC0,0x0F,0x00,0x00,0x0E,0xE0,0x0F,0x00,0x00,0x0E,0x70,0x0E,0x00,0x00,0x0E,0x3C,0x0E,0x00,0x00,0x0E,0x1E,0x0E,0x00,0x00,0x0E,0x0F,0x0E,0x00,0x00,0x8E,0x03,0x0E,0x00,0x00,0xEE,0x01,0x0E,0x00,0x00,0xFE,0x00,0x0E,0x00,0x00,0x7E,0x00,0x0E,0x00,0x00,0x1E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,
 
 	/* Index 91, character 123 "{" (width: 15 pixels) */
-	0xF, 0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x1B,0x00,0x00,0x00,0xC0,0x7B,0x00,0x00,0xE0,0xFF,0xF1,0x7F,0x00,0xF8,0xFF,0xE0,0xFF,0x01,0xFC,0x3F,0x80,0xFF,0x03,0x1C,0x00,0x00,0x80,0x03,0x0E,0x00,0x00,0x00,0x07,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,
+	0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x1B,0x00,0x00,0x00,0xC0,0x7B,0x00,0x00,0xE0,0xFF,0xF1,0x7F,0x00,0xF8,0xFF,0xE0,0xFF,0x01,0xFC,0x3F,0x80,0xFF,0x03,0x1C,0x00,0x00,0x80,0x03,0x0E,0x00,0x00,0x00,0x07,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,
 
 	/* Index 92, character 124 "|" (width: 3 pixels) */
-	0x3, 0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,
+	0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,
 
 	/* Index 93, character 125 "}" (width: 15 pixels) */
-	0xF, 0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x0E,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x80,0x03,0xFC,0x3F,0x80,0xFF,0x03,0xF8,0xFF,0xE0,0xFF,0x01,0xE0,0xFF,0xF1,0x7F,0x00,0x00,0xC0,0x7B,0x00,0x00,0x00,0x00,0x1B,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,
+	0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x0E,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x80,0x03,0xFC,0x3F,0x80,0xFF,0x03,0xF8,0xFF,0xE0,0xFF,0x01,0xE0,0xFF,0xF1,0x7F,0x00,0x00,0xC0,0x7B,0x00,0x00,0x00,0x00,0x1B,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,
 
 	/* Index 94, character 126 "~" (width: 21 pixels) */
-	0x15, 0x00,0x00,0x1E,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xF0,0x00,0x00,0x00
+	0x00,0x00,0x1E,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xF0,0x00,0x00,0x00
+};
+
+// Offset of each bitmap in Tahoma26_bitmaps
+const unsigned short Tahoma26_offsets[] = 
+{
+	0x0,	// Index 0
+	0x14,	// Index 1
+	0x23,	// Index 2
+	0x50,	// Index 3
+	0xB9,	// Index 4
+	0x104,	// Index 5
+	0x19F,	// Index 6
+	0x212,	// Index 7
+	0x221,	// Index 8
+	0x253,	// Index 9
+	0x285,	// Index 10
+	0x2D5,	// Index 11
+	0x33E,	// Index 12
+	0x361,	// Index 13
+	0x393,	// Index 14
+	0x3A7,	// Index 15
+	0x3E8,	// Index 16
+	0x438,	// Index 17
+	0x479,	// Index 18
+	0x4C9,	// Index 19
+	0x514,	// Index 20
+	0x56E,	// Index 21
+	0x5B9,	// Index 22
+	0x60E,	// Index 23
+	0x65E,	// Index 24
+	0x6B3,	// Index 25
+	0x708,	// Index 26
+	0x71C,	// Index 27
+	0x73F,	// Index 28
+	0x799,	// Index 29
+	0x7F8,	// Index 30
+	0x852,	// Index 31
+	0x898,	// Index 32
+	0x924,	// Index 33
+	0x98D,	// Index 34
+	0x9E2,	// Index 35
+	0xA41,	// Index 36
+	0xAA5,	// Index 37
+	0xAF5,	// Index 38
+	0xB40,	// Index 39
+	0xBA4,	// Index 40
+	0xBFE,	// Index 41
+	0xC2B,	// Index 42
+	0xC6C,	// Index 43
+	0xCCB,	// Index 44
+	0xD11,	// Index 45
+	0xD7A,	// Index 46
+	0xDCF,	// Index 47
+	0xE42,	// Index 48
+	0xE8D,	// Index 49
+	0xF00,	// Index 50
+	0xF64,	// Index 51
+	0xFB9,	// Index 52
+	0x1022,	// Index 53
+	0x1081,	// Index 54
+	0x10EA,	// Index 55
+	0x118A,	// Index 56
+	0x11EE,	// Index 57
+	0x1257,	// Index 58
+	0x12B1,	// Index 59
+	0x12DE,	// Index 60
+	0x131F,	// Index 61
+	0x134C,	// Index 62
+	0x13B5,	// Index 63
+	0x1414,	// Index 64
+	0x1437,	// Index 65
+	0x1482,	// Index 66
+	0x14D2,	// Index 67
+	0x1518,	// Index 68
+	0x1568,	// Index 69
+	0x15B8,	// Index 70
+	0x15F4,	// Index 71
+	0x1644,	// Index 72
+	0x1694,	// Index 73
+	0x16A3,	// Index 74
+	0x16D0,	// Index 75
+	0x1720,	// Index 76
+	0x172F,	// Index 77
+	0x17AC,	// Index 78
+	0x17FC,	// Index 79
+	0x1851,	// Index 80
+	0x18A1,	// Index 81
+	0x18F1,	// Index 82
+	0x1928,	// Index 83
+	0x196E,	// Index 84
+	0x19A5,	// Index 85
+	0x19F5,	// Index 86
+	0x1A4A,	// Index 87
+	0x1AC2,	// Index 88
+	0x1B17,	// Index 89
+	0x1B6C,	// Index 90
+	0x1BB2,	// Index 91
+	0x1BFD,	// Index 92
+	0x1C0C,	// Index 93
+	0x1C57,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Tahoma26_widths[] = 
+{
+	0x4,	// Index 0
+	0x3,	// Index 1
+	0x9,	// Index 2
+	0x15,	// Index 3
+	0xF,	// Index 4
+	0x1F,	// Index 5
+	0x17,	// Index 6
+	0x3,	// Index 7
+	0xA,	// Index 8
+	0xA,	// Index 9
+	0x10,	// Index 10
+	0x15,	// Index 11
+	0x7,	// Index 12
+	0xA,	// Index 13
+	0x4,	// Index 14
+	0xD,	// Index 15
+	0x10,	// Index 16
+	0xD,	// Index 17
+	0x10,	// Index 18
+	0xF,	// Index 19
+	0x12,	// Index 20
+	0xF,	// Index 21
+	0x11,	// Index 22
+	0x10,	// Index 23
+	0x11,	// Index 24
+	0x11,	// Index 25
+	0x4,	// Index 26
+	0x7,	// Index 27
+	0x12,	// Index 28
+	0x13,	// Index 29
+	0x12,	// Index 30
+	0xE,	// Index 31
+	0x1C,	// Index 32
+	0x15,	// Index 33
+	0x11,	// Index 34
+	0x13,	// Index 35
+	0x14,	// Index 36
+	0x10,	// Index 37
+	0xF,	// Index 38
+	0x14,	// Index 39
+	0x12,	// Index 40
+	0x9,	// Index 41
+	0xD,	// Index 42
+	0x13,	// Index 43
+	0xE,	// Index 44
+	0x15,	// Index 45
+	0x11,	// Index 46
+	0x17,	// Index 47
+	0xF,	// Index 48
+	0x17,	// Index 49
+	0x14,	// Index 50
+	0x11,	// Index 51
+	0x15,	// Index 52
+	0x13,	// Index 53
+	0x15,	// Index 54
+	0x20,	// Index 55
+	0x14,	// Index 56
+	0x15,	// Index 57
+	0x12,	// Index 58
+	0x9,	// Index 59
+	0xD,	// Index 60
+	0x9,	// Index 61
+	0x15,	// Index 62
+	0x13,	// Index 63
+	0x7,	// Index 64
+	0xF,	// Index 65
+	0x10,	// Index 66
+	0xE,	// Index 67
+	0x10,	// Index 68
+	0x10,	// Index 69
+	0xC,	// Index 70
+	0x10,	// Index 71
+	0x10,	// Index 72
+	0x3,	// Index 73
+	0x9,	// Index 74
+	0x10,	// Index 75
+	0x3,	// Index 76
+	0x19,	// Index 77
+	0x10,	// Index 78
+	0x11,	// Index 79
+	0x10,	// Index 80
+	0x10,	// Index 81
+	0xB,	// Index 82
+	0xE,	// Index 83
+	0xB,	// Index 84
+	0x10,	// Index 85
+	0x11,	// Index 86
+	0x18,	// Index 87
+	0x11,	// Index 88
+	0x11,	// Index 89
+	0xE,	// Index 90
+	0xF,	// Index 91
+	0x3,	// Index 92
+	0xF,	// Index 93
+	0x15,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Tahoma26_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x19, 0x0,	// Index 1
+	0x1B, 0x0,	// Index 2
+	0x19, 0x0,	// Index 3
+	0x1B, 0x6,	// Index 4
+	0x1A, 0x0,	// Index 5
+	0x1A, 0x0,	// Index 6
+	0x1B, 0x0,	// Index 7
+	0x1B, 0x7,	// Index 8
+	0x1B, 0x7,	// Index 9
+	0x1B, 0x0,	// Index 10
+	0x16, 0x0,	// Index 11
+	0x5, 0x6,	// Index 12
+	0xD, 0x0,	// Index 13
+	0x5, 0x0,	// Index 14
+	0x1B, 0x6,	// Index 15
+	0x1A, 0x0,	// Index 16
+	0x19, 0x0,	// Index 17
+	0x1A, 0x0,	// Index 18
+	0x1A, 0x0,	// Index 19
+	0x19, 0x0,	// Index 20
+	0x19, 0x0,	// Index 21
+	0x1A, 0x0,	// Index 22
+	0x19, 0x0,	// Index 23
+	0x1A, 0x0,	// Index 24
+	0x1A, 0x0,	// Index 25
+	0x13, 0x0,	// Index 26
+	0x13, 0x6,	// Index 27
+	0x14, 0x0,	// Index 28
+	0x10, 0x0,	// Index 29
+	0x14, 0x0,	// Index 30
+	0x1A, 0x0,	// Index 31
+	0x1A, 0x4,	// Index 32
+	0x19, 0x0,	// Index 33
+	0x19, 0x0,	// Index 34
+	0x1A, 0x0,	// Index 35
+	0x19, 0x0,	// Index 36
+	0x19, 0x0,	// Index 37
+	0x19, 0x0,	// Index 38
+	0x1A, 0x0,	// Index 39
+	0x19, 0x0,	// Index 40
+	0x19, 0x0,	// Index 41
+	0x19, 0x0,	// Index 42
+	0x19, 0x0,	// Index 43
+	0x19, 0x0,	// Index 44
+	0x19, 0x0,	// Index 45
+	0x19, 0x0,	// Index 46
+	0x1A, 0x0,	// Index 47
+	0x19, 0x0,	// Index 48
+	0x1A, 0x7,	// Index 49
+	0x19, 0x0,	// Index 50
+	0x1A, 0x0,	// Index 51
+	0x19, 0x0,	// Index 52
+	0x19, 0x0,	// Index 53
+	0x19, 0x0,	// Index 54
+	0x19, 0x0,	// Index 55
+	0x19, 0x0,	// Index 56
+	0x19, 0x0,	// Index 57
+	0x19, 0x0,	// Index 58
+	0x1B, 0x7,	// Index 59
+	0x1B, 0x6,	// Index 60
+	0x1B, 0x7,	// Index 61
+	0x19, 0x0,	// Index 62
+	0x0, 0x5,	// Index 63
+	0x1C, 0x0,	// Index 64
+	0x14, 0x0,	// Index 65
+	0x1B, 0x0,	// Index 66
+	0x14, 0x0,	// Index 67
+	0x1B, 0x0,	// Index 68
+	0x14, 0x0,	// Index 69
+	0x1B, 0x0,	// Index 70
+	0x14, 0x7,	// Index 71
+	0x1B, 0x0,	// Index 72
+	0x19, 0x0,	// Index 73
+	0x19, 0x7,	// Index 74
+	0x1B, 0x0,	// Index 75
+	0x1B, 0x0,	// Index 76
+	0x14, 0x0,	// Index 77
+	0x14, 0x0,	// Index 78
+	0x14, 0x0,	// Index 79
+	0x14, 0x7,	// Index 80
+	0x14, 0x7,	// Index 81
+	0x13, 0x0,	// Index 82
+	0x14, 0x0,	// Index 83
+	0x18, 0x0,	// Index 84
+	0x13, 0x0,	// Index 85
+	0x13, 0x0,	// Index 86
+	0x13, 0x0,	// Index 87
+	0x13, 0x0,	// Index 88
+	0x13, 0x7,	// Index 89
+	0x13, 0x0,	// Index 90
+	0x1B, 0x7,	// Index 91
+	0x1B, 0x7,	// Index 92
+	0x1B, 0x7,	// Index 93
+	0x10, 0x0,	// Index 94
+};
+
+const font_t Tahoma26 = 
+{
+	Tahoma26_bitmaps,
+	Tahoma26_offsets,
+	Tahoma26_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x23,	// Height 
+	0,	// Flags 
+	Tahoma26_extents,
+	0x1C	// Ascent 
 };
+
 //---------------------------------------------------------------
 // Group Name: Tahoma22
 // Designer: Imported System Font
@@ -3260,395 +4934,603 @@ const unsigned char Tahoma26[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Tahoma22[] = 
+const unsigned char Tahoma22_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x1D,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xD4, // Index 1 (offset: 212)
-	0x0, 0xE1, // Index 2 (offset: 225)
-	0x1, 0x2, // Index 3 (offset: 258)
-	0x1, 0x47, // Index 4 (offset: 327)
-	0x1, 0x7C, // Index 5 (offset: 380)
-	0x1, 0xE1, // Index 6 (offset: 481)
-	0x2, 0x2E, // Index 7 (offset: 558)
-	0x2, 0x3B, // Index 8 (offset: 571)
-	0x2, 0x60, // Index 9 (offset: 608)
-	0x2, 0x85, // Index 10 (offset: 645)
-	0x2, 0xB6, // Index 11 (offset: 694)
-	0x2, 0xF7, // Index 12 (offset: 759)
-	0x3, 0x10, // Index 13 (offset: 784)
-	0x3, 0x31, // Index 14 (offset: 817)
-	0x3, 0x3E, // Index 15 (offset: 830)
-	0x3, 0x6B, // Index 16 (offset: 875)
-	0x3, 0xA0, // Index 17 (offset: 928)
-	0x3, 0xCD, // Index 18 (offset: 973)
-	0x4, 0x2, // Index 19 (offset: 1026)
-	0x4, 0x37, // Index 20 (offset: 1079)
-	0x4, 0x74, // Index 21 (offset: 1140)
-	0x4, 0xA9, // Index 22 (offset: 1193)
-	0x4, 0xE2, // Index 23 (offset: 1250)
-	0x5, 0x17, // Index 24 (offset: 1303)
-	0x5, 0x50, // Index 25 (offset: 1360)
-	0x5, 0x89, // Index 26 (offset: 1417)
-	0x5, 0x96, // Index 27 (offset: 1430)
-	0x5, 0xAF, // Index 28 (offset: 1455)
-	0x5, 0xEC, // Index 29 (offset: 1516)
-	0x6, 0x2D, // Index 30 (offset: 1581)
-	0x6, 0x6A, // Index 31 (offset: 1642)
-	0x6, 0x97, // Index 32 (offset: 1687)
-	0x6, 0xF0, // Index 33 (offset: 1776)
-	0x7, 0x35, // Index 34 (offset: 1845)
-	0x7, 0x6E, // Index 35 (offset: 1902)
-	0x7, 0xAB, // Index 36 (offset: 1963)
-	0x7, 0xF0, // Index 37 (offset: 2032)
-	0x8, 0x25, // Index 38 (offset: 2085)
-	0x8, 0x5A, // Index 39 (offset: 2138)
-	0x8, 0x9F, // Index 40 (offset: 2207)
-	0x8, 0xE0, // Index 41 (offset: 2272)
-	0x9, 0x5, // Index 42 (offset: 2309)
-	0x9, 0x2E, // Index 43 (offset: 2350)
-	0x9, 0x6B, // Index 44 (offset: 2411)
-	0x9, 0x9C, // Index 45 (offset: 2460)
-	0x9, 0xE5, // Index 46 (offset: 2533)
-	0xA, 0x22, // Index 47 (offset: 2594)
-	0xA, 0x6F, // Index 48 (offset: 2671)
-	0xA, 0xA4, // Index 49 (offset: 2724)
-	0xA, 0xF1, // Index 50 (offset: 2801)
-	0xB, 0x32, // Index 51 (offset: 2866)
-	0xB, 0x6B, // Index 52 (offset: 2923)
-	0xB, 0xB8, // Index 53 (offset: 3000)
-	0xB, 0xF5, // Index 54 (offset: 3061)
-	0xC, 0x3A, // Index 55 (offset: 3130)
-	0xC, 0xA3, // Index 56 (offset: 3235)
-	0xC, 0xE8, // Index 57 (offset: 3304)
-	0xD, 0x2D, // Index 58 (offset: 3373)
-	0xD, 0x66, // Index 59 (offset: 3430)
-	0xD, 0x83, // Index 60 (offset: 3459)
-	0xD, 0xB0, // Index 61 (offset: 3504)
-	0xD, 0xCD, // Index 62 (offset: 3533)
-	0xE, 0x12, // Index 63 (offset: 3602)
-	0xE, 0x53, // Index 64 (offset: 3667)
-	0xE, 0x6C, // Index 65 (offset: 3692)
-	0xE, 0x9D, // Index 66 (offset: 3741)
-	0xE, 0xD2, // Index 67 (offset: 3794)
-	0xE, 0xFF, // Index 68 (offset: 3839)
-	0xF, 0x34, // Index 69 (offset: 3892)
-	0xF, 0x69, // Index 70 (offset: 3945)
-	0xF, 0x92, // Index 71 (offset: 3986)
-	0xF, 0xC7, // Index 72 (offset: 4039)
-	0xF, 0xF8, // Index 73 (offset: 4088)
-	0x10, 0x5, // Index 74 (offset: 4101)
-	0x10, 0x26, // Index 75 (offset: 4134)
-	0x10, 0x5B, // Index 76 (offset: 4187)
-	0x10, 0x68, // Index 77 (offset: 4200)
-	0x10, 0xBD, // Index 78 (offset: 4285)
-	0x10, 0xEE, // Index 79 (offset: 4334)
-	0x11, 0x27, // Index 80 (offset: 4391)
-	0x11, 0x5C, // Index 81 (offset: 4444)
-	0x11, 0x91, // Index 82 (offset: 4497)
-	0x11, 0xB2, // Index 83 (offset: 4530)
-	0x11, 0xDF, // Index 84 (offset: 4575)
-	0x12, 0x8, // Index 85 (offset: 4616)
-	0x12, 0x39, // Index 86 (offset: 4665)
-	0x12, 0x72, // Index 87 (offset: 4722)
-	0x12, 0xCB, // Index 88 (offset: 4811)
-	0x13, 0x4, // Index 89 (offset: 4868)
-	0x13, 0x3D, // Index 90 (offset: 4925)
-	0x13, 0x6A, // Index 91 (offset: 4970)
-	0x13, 0x9B, // Index 92 (offset: 5019)
-	0x13, 0xA8, // Index 93 (offset: 5032)
-	0x13, 0xD9, // Index 94 (offset: 5081)
-
 	/* Index 0, character 32 " " (width: 4 pixels) */
-	0x4, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 3 pixels) */
-	0x3, 0xFC,0xFF,0x71,0x00,0xFC,0xFF,0x71,0x00,0xFC,0xFF,0x71,0x00,
+	0xFC,0xFF,0x71,0x00,0xFC,0xFF,0x71,0x00,0xFC,0xFF,0x71,0x00,
 
 	/* Index 2, character 34 """ (width: 8 pixels) */
-	0x8, 0xFE,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFE,0x00,0x00,0x00,
+	0xFE,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFE,0x00,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 17 pixels) */
-	0x11, 0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x83,0x61,0x00,0x00,0x83,0x7F,0x00,0x00,0xF3,0x1F,0x00,0x00,0xFF,0x01,0x00,0xF0,0x9F,0x01,0x00,0xFC,0x83,0x01,0x00,0x0C,0x83,0x61,0x00,0x00,0x83,0x7F,0x00,0x00,0xF3,0x1F,0x00,0x00,0xFF,0x01,0x00,0xF0,0x8F,0x01,0x00,0xFC,0x83,0x01,0x00,0x0C,0x83,0x01,0x00,0x00,0x83,0x01,0x00,0x00,0x03,0x00,0x00,
+	0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x83,0x61,0x00,0x00,0x83,0x7F,0x00,0x00,0xF3,0x1F,0x00,0x00,0xFF,0x01,0x00,0xF0,0x9F,0x01,0x00,0xFC,0x83,0x01,0x00,0x0C,0x83,0x61,0x00,0x00,0x83,0x7F,0x00,0x00,0xF3,0x1F,0x00,0x00,0xFF,0x01,0x00,0xF0,0x8F,0x01,0x00,0xFC,0x83,0x01,0x00,0x0C,0x83,0x01,0x00,0x00,0x83,0x01,0x00,0x00,0x03,0x00,0x00,
 
 	/* Index 4, character 36 "$" (width: 13 pixels) */
-	0xD, 0x80,0x0F,0x38,0x00,0xC0,0x1F,0x38,0x00,0xE0,0x3F,0x70,0x00,0xE0,0x38,0x70,0x00,0x70,0x30,0x70,0x00,0x70,0x30,0x70,0x00,0xFF,0xFF,0xFF,0x0F,0xFF,0xFF,0xFF,0x0F,0x70,0x60,0x70,0x00,0x70,0xE0,0x78,0x00,0x70,0xC0,0x3F,0x00,0xE0,0xC0,0x1F,0x00,0x00,0x80,0x0F,0x00,
+	0x80,0x0F,0x38,0x00,0xC0,0x1F,0x38,0x00,0xE0,0x3F,0x70,0x00,0xE0,0x38,0x70,0x00,0x70,0x30,0x70,0x00,0x70,0x30,0x70,0x00,0xFF,0xFF,0xFF,0x0F,0xFF,0xFF,0xFF,0x0F,0x70,0x60,0x70,0x00,0x70,0xE0,0x78,0x00,0x70,0xC0,0x3F,0x00,0xE0,0xC0,0x1F,0x00,0x00,0x80,0x0F,0x00,
 
 	/* Index 5, character 37 "%" (width: 25 pixels) */
-	0x19, 0xE0,0x07,0x00,0x00,0xF8,0x1F,0x00,0x00,0x18,0x18,0x00,0x00,0x0C,0x30,0x00,0x00,0x0C,0x30,0x00,0x00,0x0C,0x30,0x00,0x00,0x0C,0x30,0x40,0x00,0x18,0x18,0x70,0x00,0xF8,0x1F,0x3C,0x00,0xE0,0x07,0x0F,0x00,0x00,0xC0,0x03,0x00,0x00,0xF0,0x01,0x00,0x00,0x7C,0x00,0x00,0x00,0x1F,0x00,0x00,0x80,0x07,0x00,0x00,0xE0,0xE1,0x0F,0x00,0x78,0xF8,0x3F,0x00,0x1C,0x18,0x30,0x00,0x04,0x0C,0x60,0x00,0x00,0x0C,0x60,0x00,0x00,0x0C,0x60,0x00,0x00,0x0C,0x60,0x00,0x00,0x18,0x30,0x00,0x00,0xF8,0x3F,0x00,0x00,0xE0,0x0F,0x00,
+	0xE0,0x07,0x00,0x00,0xF8,0x1F,0x00,0x00,0x18,0x18,0x00,0x00,0x0C,0x30,0x00,0x00,0x0C,0x30,0x00,0x00,0x0C,0x30,0x00,0x00,0x0C,0x30,0x40,0x00,0x18,0x18,0x70,0x00,0xF8,0x1F,0x3C,0x00,0xE0,0x07,0x0F,0x00,0x00,0xC0,0x03,0x00,0x00,0xF0,0x01,0x00,0x00,0x7C,0x00,0x00,0x00,0x1F,0x00,0x00,0x80,0x07,0x00,0x00,0xE0,0xE1,0x0F,0x00,0x78,0xF8,0x3F,0x00,0x1C,0x18,0x30,0x00,0x04,0x0C,0x60,0x00,0x00,0x0C,0x60,0x00,0x00,0x0C,0x60,0x00,0x00,0x0C,0x60,0x00,0x00,0x18,0x30,0x00,0x00,0xF8,0x3F,0x00,0x00,0xE0,0x0F,0x00,
 
 	/* Index 6, character 38 "&" (width: 19 pixels) */
-	0x13, 0x00,0x80,0x0F,0x00,0xE0,0xE1,0x1F,0x00,0xF8,0xF3,0x3F,0x00,0xF8,0x37,0x38,0x00,0x3C,0x1E,0x78,0x00,0x1C,0x0C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x3C,0x70,0x00,0x3C,0x76,0x70,0x00,0xF8,0xE7,0x70,0x00,0xF8,0xC3,0x31,0x00,0xF0,0x81,0x3B,0x00,0x00,0x00,0x1F,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFC,0x38,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x40,0x00,
+	0x00,0x80,0x0F,0x00,0xE0,0xE1,0x1F,0x00,0xF8,0xF3,0x3F,0x00,0xF8,0x37,0x38,0x00,0x3C,0x1E,0x78,0x00,0x1C,0x0C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x3C,0x70,0x00,0x3C,0x76,0x70,0x00,0xF8,0xE7,0x70,0x00,0xF8,0xC3,0x31,0x00,0xF0,0x81,0x3B,0x00,0x00,0x00,0x1F,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFC,0x38,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x40,0x00,
 
 	/* Index 7, character 39 "'" (width: 3 pixels) */
-	0x3, 0xFE,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFE,0x00,0x00,0x00,
+	0xFE,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFE,0x00,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 9 pixels) */
-	0x9, 0x00,0xFC,0x0F,0x00,0x80,0xFF,0x7F,0x00,0xE0,0xFF,0xFF,0x01,0xF0,0x07,0xF8,0x03,0xFC,0x00,0xC0,0x0F,0x3E,0x00,0x00,0x1F,0x0E,0x00,0x00,0x1C,0x06,0x00,0x00,0x18,0x02,0x00,0x00,0x10,
+	0x00,0xFC,0x0F,0x00,0x80,0xFF,0x7F,0x00,0xE0,0xFF,0xFF,0x01,0xF0,0x07,0xF8,0x03,0xFC,0x00,0xC0,0x0F,0x3E,0x00,0x00,0x1F,0x0E,0x00,0x00,0x1C,0x06,0x00,0x00,0x18,0x02,0x00,0x00,0x10,
 
 	/* Index 9, character 41 ")" (width: 9 pixels) */
-	0x9, 0x02,0x00,0x00,0x10,0x06,0x00,0x00,0x18,0x0E,0x00,0x00,0x1C,0x3E,0x00,0x00,0x1F,0xFC,0x00,0xC0,0x0F,0xF0,0x07,0xF8,0x03,0xE0,0xFF,0xFF,0x01,0x80,0xFF,0x7F,0x00,0x00,0xFC,0x0F,0x00,
+	0x02,0x00,0x00,0x10,0x06,0x00,0x00,0x18,0x0E,0x00,0x00,0x1C,0x3E,0x00,0x00,0x1F,0xFC,0x00,0xC0,0x0F,0xF0,0x07,0xF8,0x03,0xE0,0xFF,0xFF,0x01,0x80,0xFF,0x7F,0x00,0x00,0xFC,0x0F,0x00,
 
 	/* Index 10, character 42 "*" (width: 12 pixels) */
-	0xC, 0x10,0x04,0x00,0x00,0x38,0x0E,0x00,0x00,0x30,0x06,0x00,0x00,0x60,0x03,0x00,0x00,0x40,0x01,0x00,0x00,0xFE,0x3F,0x00,0x00,0xFE,0x3F,0x00,0x00,0x40,0x01,0x00,0x00,0x60,0x03,0x00,0x00,0x30,0x06,0x00,0x00,0x38,0x0E,0x00,0x00,0x10,0x04,0x00,0x00,
+	0x10,0x04,0x00,0x00,0x38,0x0E,0x00,0x00,0x30,0x06,0x00,0x00,0x60,0x03,0x00,0x00,0x40,0x01,0x00,0x00,0xFE,0x3F,0x00,0x00,0xFE,0x3F,0x00,0x00,0x40,0x01,0x00,0x00,0x60,0x03,0x00,0x00,0x30,0x06,0x00,0x00,0x38,0x0E,0x00,0x00,0x10,0x04,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 16 pixels) */
-	0x10, 0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0xC0,0xFF,0x3F,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,
+	0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0xC0,0xFF,0x3F,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,
 
 	/* Index 12, character 44 "," (width: 6 pixels) */
-	0x6, 0x00,0x00,0x00,0x0C,0x00,0x00,0x80,0x0F,0x00,0x00,0xF8,0x07,0x00,0x00,0xF8,0x01,0x00,0x00,0x38,0x00,0x00,0x00,0x08,0x00,
+	0x00,0x00,0x00,0x0C,0x00,0x00,0x80,0x0F,0x00,0x00,0xF8,0x07,0x00,0x00,0xF8,0x01,0x00,0x00,0x38,0x00,0x00,0x00,0x08,0x00,
 
 	/* Index 13, character 45 "-" (width: 8 pixels) */
-	0x8, 0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,
+	0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,
 
 	/* Index 14, character 46 "." (width: 3 pixels) */
-	0x3, 0x00,0x00,0x78,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x78,0x00,
+	0x00,0x00,0x78,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x78,0x00,
 
 	/* Index 15, character 47 "/" (width: 11 pixels) */
-	0xB, 0x00,0x00,0x00,0x0C,0x00,0x00,0x80,0x0F,0x00,0x00,0xF0,0x07,0x00,0x00,0xFE,0x00,0x00,0xC0,0x1F,0x00,0x00,0xF8,0x03,0x00,0x00,0x7F,0x00,0x00,0xE0,0x0F,0x00,0x00,0xFC,0x01,0x00,0x00,0x3E,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x0C,0x00,0x00,0x80,0x0F,0x00,0x00,0xF0,0x07,0x00,0x00,0xFE,0x00,0x00,0xC0,0x1F,0x00,0x00,0xF8,0x03,0x00,0x00,0x7F,0x00,0x00,0xE0,0x0F,0x00,0x00,0xFC,0x01,0x00,0x00,0x3E,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
 
 	/* Index 16, character 48 "0" (width: 13 pixels) */
-	0xD, 0x80,0xFF,0x03,0x00,0xE0,0xFF,0x0F,0x00,0xF8,0xFF,0x3F,0x00,0x78,0x00,0x3C,0x00,0x3C,0x00,0x78,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x3C,0x00,0x78,0x00,0x78,0x00,0x3C,0x00,0xF8,0xFF,0x3F,0x00,0xE0,0xFF,0x0F,0x00,0x80,0xFF,0x03,0x00,
+	0x80,0xFF,0x03,0x00,0xE0,0xFF,0x0F,0x00,0xF8,0xFF,0x3F,0x00,0x78,0x00,0x3C,0x00,0x3C,0x00,0x78,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x3C,0x00,0x78,0x00,0x78,0x00,0x3C,0x00,0xF8,0xFF,0x3F,0x00,0xE0,0xFF,0x0F,0x00,0x80,0xFF,0x03,0x00,
 
 	/* Index 17, character 49 "1" (width: 11 pixels) */
-	0xB, 0xE0,0x00,0x70,0x00,0xE0,0x00,0x70,0x00,0xE0,0x00,0x70,0x00,0xF0,0x00,0x70,0x00,0xF8,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,
+	0xE0,0x00,0x70,0x00,0xE0,0x00,0x70,0x00,0xE0,0x00,0x70,0x00,0xF0,0x00,0x70,0x00,0xF8,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,
 
 	/* Index 18, character 50 "2" (width: 13 pixels) */
-	0xD, 0x38,0x00,0x78,0x00,0x38,0x00,0x7C,0x00,0x1C,0x00,0x7E,0x00,0x1C,0x00,0x77,0x00,0x1C,0x80,0x73,0x00,0x1C,0xC0,0x71,0x00,0x1C,0xE0,0x70,0x00,0x1C,0x70,0x70,0x00,0x3C,0x3C,0x70,0x00,0xF8,0x1F,0x70,0x00,0xF0,0x0F,0x70,0x00,0xE0,0x03,0x70,0x00,0x00,0x00,0x70,0x00,
+	0x38,0x00,0x78,0x00,0x38,0x00,0x7C,0x00,0x1C,0x00,0x7E,0x00,0x1C,0x00,0x77,0x00,0x1C,0x80,0x73,0x00,0x1C,0xC0,0x71,0x00,0x1C,0xE0,0x70,0x00,0x1C,0x70,0x70,0x00,0x3C,0x3C,0x70,0x00,0xF8,0x1F,0x70,0x00,0xF0,0x0F,0x70,0x00,0xE0,0x03,0x70,0x00,0x00,0x00,0x70,0x00,
 
 	/* Index 19, character 51 "3" (width: 13 pixels) */
-	0xD, 0x00,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x3C,0x78,0x00,0x3C,0x76,0x3C,0x00,0xF8,0xF7,0x3F,0x00,0xF8,0xE3,0x1F,0x00,0xE0,0xC1,0x07,0x00,
+	0x00,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x3C,0x78,0x00,0x3C,0x76,0x3C,0x00,0xF8,0xF7,0x3F,0x00,0xF8,0xE3,0x1F,0x00,0xE0,0xC1,0x07,0x00,
 
 	/* Index 20, character 52 "4" (width: 15 pixels) */
-	0xF, 0x00,0xF0,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xEE,0x00,0x00,0x00,0xE7,0x00,0x00,0x80,0xE3,0x00,0x00,0xC0,0xE1,0x00,0x00,0xE0,0xE0,0x00,0x00,0x70,0xE0,0x00,0x00,0x18,0xE0,0x00,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0x00,
+	0x00,0xF0,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xEE,0x00,0x00,0x00,0xE7,0x00,0x00,0x80,0xE3,0x00,0x00,0xC0,0xE1,0x00,0x00,0xE0,0xE0,0x00,0x00,0x70,0xE0,0x00,0x00,0x18,0xE0,0x00,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0x00,
 
 	/* Index 21, character 53 "5" (width: 13 pixels) */
-	0xD, 0x00,0x00,0x38,0x00,0xFC,0x3F,0x38,0x00,0xFC,0x1F,0x70,0x00,0xFC,0x1F,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x3C,0x78,0x00,0x1C,0x38,0x3C,0x00,0x1C,0xF8,0x3F,0x00,0x1C,0xF0,0x1F,0x00,0x1C,0xE0,0x07,0x00,
+	0x00,0x00,0x38,0x00,0xFC,0x3F,0x38,0x00,0xFC,0x1F,0x70,0x00,0xFC,0x1F,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x3C,0x78,0x00,0x1C,0x38,0x3C,0x00,0x1C,0xF8,0x3F,0x00,0x1C,0xF0,0x1F,0x00,0x1C,0xE0,0x07,0x00,
 
 	/* Index 22, character 54 "6" (width: 14 pixels) */
-	0xE, 0x00,0xFE,0x03,0x00,0x80,0xFF,0x0F,0x00,0xE0,0xFF,0x1F,0x00,0xF0,0x39,0x3C,0x00,0x78,0x18,0x78,0x00,0x38,0x1C,0x70,0x00,0x3C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x3C,0x78,0x00,0x1C,0x38,0x3C,0x00,0x3C,0xF8,0x3F,0x00,0x00,0xF0,0x1F,0x00,0x00,0xE0,0x07,0x00,
+	0x00,0xFE,0x03,0x00,0x80,0xFF,0x0F,0x00,0xE0,0xFF,0x1F,0x00,0xF0,0x39,0x3C,0x00,0x78,0x18,0x78,0x00,0x38,0x1C,0x70,0x00,0x3C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x3C,0x78,0x00,0x1C,0x38,0x3C,0x00,0x3C,0xF8,0x3F,0x00,0x00,0xF0,0x1F,0x00,0x00,0xE0,0x07,0x00,
 
 	/* Index 23, character 55 "7" (width: 13 pixels) */
-	0xD, 0x1C,0x00,0x00,0x00,0x1C,0x00,0x40,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x7C,0x00,0x1C,0x00,0x3F,0x00,0x1C,0xC0,0x0F,0x00,0x1C,0xF0,0x03,0x00,0x1C,0xFC,0x00,0x00,0x1C,0x3E,0x00,0x00,0x9C,0x0F,0x00,0x00,0xFC,0x03,0x00,0x00,0xFC,0x01,0x00,0x00,0x7C,0x00,0x00,0x00,
+	0x1C,0x00,0x00,0x00,0x1C,0x00,0x40,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x7C,0x00,0x1C,0x00,0x3F,0x00,0x1C,0xC0,0x0F,0x00,0x1C,0xF0,0x03,0x00,0x1C,0xFC,0x00,0x00,0x1C,0x3E,0x00,0x00,0x9C,0x0F,0x00,0x00,0xFC,0x03,0x00,0x00,0xFC,0x01,0x00,0x00,0x7C,0x00,0x00,0x00,
 
 	/* Index 24, character 56 "8" (width: 14 pixels) */
-	0xE, 0x00,0x80,0x07,0x00,0xE0,0xE1,0x1F,0x00,0xF0,0xE7,0x3F,0x00,0xF8,0x37,0x3C,0x00,0x3C,0x1E,0x78,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x18,0x70,0x00,0x1C,0x38,0x70,0x00,0x3C,0x3C,0x78,0x00,0xF8,0x7F,0x38,0x00,0xF0,0xE7,0x3F,0x00,0xE0,0xE1,0x1F,0x00,0x00,0x80,0x07,0x00,
+	0x00,0x80,0x07,0x00,0xE0,0xE1,0x1F,0x00,0xF0,0xE7,0x3F,0x00,0xF8,0x37,0x3C,0x00,0x3C,0x1E,0x78,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x18,0x70,0x00,0x1C,0x38,0x70,0x00,0x3C,0x3C,0x78,0x00,0xF8,0x7F,0x38,0x00,0xF0,0xE7,0x3F,0x00,0xE0,0xE1,0x1F,0x00,0x00,0x80,0x07,0x00,
 
 	/* Index 25, character 57 "9" (width: 14 pixels) */
-	0xE, 0xC0,0x0F,0x00,0x00,0xF0,0x1F,0x00,0x00,0xF8,0x3F,0x78,0x00,0x78,0x38,0x70,0x00,0x3C,0x78,0x70,0x00,0x1C,0x70,0x70,0x00,0x1C,0x70,0x70,0x00,0x1C,0x70,0x78,0x00,0x1C,0x70,0x38,0x00,0x3C,0x30,0x3C,0x00,0x78,0x38,0x1F,0x00,0xF0,0xFF,0x0F,0x00,0xE0,0xFF,0x03,0x00,0x80,0xFF,0x00,0x00,
+	0xC0,0x0F,0x00,0x00,0xF0,0x1F,0x00,0x00,0xF8,0x3F,0x78,0x00,0x78,0x38,0x70,0x00,0x3C,0x78,0x70,0x00,0x1C,0x70,0x70,0x00,0x1C,0x70,0x70,0x00,0x1C,0x70,0x78,0x00,0x1C,0x70,0x38,0x00,0x3C,0x30,0x3C,0x00,0x78,0x38,0x1F,0x00,0xF0,0xFF,0x0F,0x00,0xE0,0xFF,0x03,0x00,0x80,0xFF,0x00,0x00,
 
 	/* Index 26, character 58 ":" (width: 3 pixels) */
-	0x3, 0x80,0x07,0x78,0x00,0x80,0x07,0x78,0x00,0x80,0x07,0x78,0x00,
+	0x80,0x07,0x78,0x00,0x80,0x07,0x78,0x00,0x80,0x07,0x78,0x00,
 
 	/* Index 27, character 59 ";" (width: 6 pixels) */
-	0x6, 0x00,0x00,0x00,0x0C,0x00,0x00,0x80,0x0F,0x80,0x07,0xF8,0x07,0x80,0x07,0xF8,0x01,0x80,0x07,0x38,0x00,0x00,0x00,0x08,0x00,
+	0x00,0x00,0x00,0x0C,0x00,0x00,0x80,0x0F,0x80,0x07,0xF8,0x07,0x80,0x07,0xF8,0x01,0x80,0x07,0x38,0x00,0x00,0x00,0x08,0x00,
 
 	/* Index 28, character 60 "<" (width: 15 pixels) */
-	0xF, 0x00,0x20,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xD8,0x00,0x00,0x00,0xDC,0x01,0x00,0x00,0x8C,0x01,0x00,0x00,0x8E,0x03,0x00,0x00,0x06,0x03,0x00,0x00,0x07,0x07,0x00,0x00,0x03,0x06,0x00,0x80,0x03,0x0E,0x00,0x80,0x01,0x0C,0x00,0xC0,0x01,0x1C,0x00,0xC0,0x00,0x18,0x00,0xE0,0x00,0x38,0x00,
+	0x00,0x20,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xD8,0x00,0x00,0x00,0xDC,0x01,0x00,0x00,0x8C,0x01,0x00,0x00,0x8E,0x03,0x00,0x00,0x06,0x03,0x00,0x00,0x07,0x07,0x00,0x00,0x03,0x06,0x00,0x80,0x03,0x0E,0x00,0x80,0x01,0x0C,0x00,0xC0,0x01,0x1C,0x00,0xC0,0x00,0x18,0x00,0xE0,0x00,0x38,0x00,
 
 	/* Index 29, character 61 "=" (width: 16 pixels) */
-	0x10, 0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,
+	0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,
 
 	/* Index 30, character 62 ">" (width: 15 pixels) */
-	0xF, 0xE0,0x00,0x38,0x00,0xC0,0x00,0x18,0x00,0xC0,0x01,0x1C,0x00,0x80,0x01,0x0C,0x00,0x80,0x03,0x0E,0x00,0x00,0x03,0x06,0x00,0x00,0x07,0x07,0x00,0x00,0x06,0x03,0x00,0x00,0x8E,0x03,0x00,0x00,0x8C,0x01,0x00,0x00,0xDC,0x01,0x00,0x00,0xD8,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x00,
+	0xE0,0x00,0x38,0x00,0xC0,0x00,0x18,0x00,0xC0,0x01,0x1C,0x00,0x80,0x01,0x0C,0x00,0x80,0x03,0x0E,0x00,0x00,0x03,0x06,0x00,0x00,0x07,0x07,0x00,0x00,0x06,0x03,0x00,0x00,0x8E,0x03,0x00,0x00,0x8C,0x01,0x00,0x00,0xDC,0x01,0x00,0x00,0xD8,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x00,
 
 	/* Index 31, character 63 "?" (width: 11 pixels) */
-	0xB, 0x38,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0xE0,0x71,0x00,0x1C,0xF0,0x71,0x00,0x1C,0x38,0x00,0x00,0x1C,0x18,0x00,0x00,0x3C,0x1C,0x00,0x00,0xF8,0x0F,0x00,0x00,0xF8,0x07,0x00,0x00,0xE0,0x01,0x00,0x00,
+	0x38,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0xE0,0x71,0x00,0x1C,0xF0,0x71,0x00,0x1C,0x38,0x00,0x00,0x1C,0x18,0x00,0x00,0x3C,0x1C,0x00,0x00,0xF8,0x0F,0x00,0x00,0xF8,0x07,0x00,0x00,0xE0,0x01,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 22 pixels) */
-	0x16, 0x00,0xFC,0x03,0x00,0x00,0xFF,0x0F,0x00,0xC0,0x07,0x3C,0x00,0xE0,0x00,0x70,0x00,0x70,0x00,0xE0,0x00,0x30,0xF8,0xC3,0x00,0x18,0xFE,0x87,0x01,0x18,0x07,0x8E,0x01,0x0C,0x03,0x1C,0x03,0x8C,0x01,0x18,0x03,0x8C,0x01,0x18,0x03,0x8C,0x01,0x18,0x03,0x8C,0x01,0x0C,0x03,0x8C,0x03,0x0C,0x03,0x8C,0xFF,0x1F,0x03,0x98,0xFF,0x9F,0x03,0x38,0x00,0x18,0x00,0x30,0x00,0x18,0x00,0xE0,0x00,0x18,0x00,0xC0,0x03,0x1C,0x00,0x80,0xFF,0x0F,0x00,0x00,0xFC,0x03,0x00,
+	0x00,0xFC,0x03,0x00,0x00,0xFF,0x0F,0x00,0xC0,0x07,0x3C,0x00,0xE0,0x00,0x70,0x00,0x70,0x00,0xE0,0x00,0x30,0xF8,0xC3,0x00,0x18,0xFE,0x87,0x01,0x18,0x07,0x8E,0x01,0x0C,0x03,0x1C,0x03,0x8C,0x01,0x18,0x03,0x8C,0x01,0x18,0x03,0x8C,0x01,0x18,0x03,0x8C,0x01,0x0C,0x03,0x8C,0x03,0x0C,0x03,0x8C,0xFF,0x1F,0x03,0x98,0xFF,0x9F,0x03,0x38,0x00,0x18,0x00,0x30,0x00,0x18,0x00,0xE0,0x00,0x18,0x00,0xC0,0x03,0x1C,0x00,0x80,0xFF,0x0F,0x00,0x00,0xFC,0x03,0x00,
 
 	/* Index 33, character 65 "A" (width: 17 pixels) */
-	0x11, 0x00,0x00,0x60,0x00,0x00,0x00,0x7C,0x00,0x00,0x80,0x7F,0x00,0x00,0xF0,0x3F,0x00,0x00,0xFE,0x07,0x00,0xC0,0xFF,0x03,0x00,0xF8,0x8F,0x03,0x00,0xFC,0x81,0x03,0x00,0x3C,0x80,0x03,0x00,0xFC,0x81,0x03,0x00,0xF8,0x8F,0x03,0x00,0xC0,0xFF,0x03,0x00,0x00,0xFE,0x07,0x00,0x00,0xF0,0x3F,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x60,0x00,
+	0x00,0x00,0x60,0x00,0x00,0x00,0x7C,0x00,0x00,0x80,0x7F,0x00,0x00,0xF0,0x3F,0x00,0x00,0xFE,0x07,0x00,0xC0,0xFF,0x03,0x00,0xF8,0x8F,0x03,0x00,0xFC,0x81,0x03,0x00,0x3C,0x80,0x03,0x00,0xFC,0x81,0x03,0x00,0xF8,0x8F,0x03,0x00,0xC0,0xFF,0x03,0x00,0x00,0xFE,0x07,0x00,0x00,0xF0,0x3F,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x60,0x00,
 
 	/* Index 34, character 66 "B" (width: 14 pixels) */
-	0xE, 0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x3C,0x3C,0x78,0x00,0xF8,0x7F,0x38,0x00,0xF8,0xF7,0x3F,0x00,0xE0,0xE1,0x1F,0x00,0x00,0x80,0x07,0x00,
+	0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x3C,0x3C,0x78,0x00,0xF8,0x7F,0x38,0x00,0xF8,0xF7,0x3F,0x00,0xE0,0xE1,0x1F,0x00,0x00,0x80,0x07,0x00,
 
 	/* Index 35, character 67 "C" (width: 15 pixels) */
-	0xF, 0x00,0xFE,0x01,0x00,0xC0,0xFF,0x07,0x00,0xE0,0xFF,0x0F,0x00,0xF0,0x01,0x1F,0x00,0x78,0x00,0x3C,0x00,0x38,0x00,0x38,0x00,0x3C,0x00,0x78,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x78,0x00,0x1C,0x00,
+	0x00,0xFE,0x01,0x00,0xC0,0xFF,0x07,0x00,0xE0,0xFF,0x0F,0x00,0xF0,0x01,0x1F,0x00,0x78,0x00,0x3C,0x00,0x38,0x00,0x38,0x00,0x3C,0x00,0x78,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x78,0x00,0x1C,0x00,
 
 	/* Index 36, character 68 "D" (width: 17 pixels) */
-	0x11, 0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x3C,0x00,0x78,0x00,0x38,0x00,0x38,0x00,0x78,0x00,0x3C,0x00,0xF0,0x00,0x1E,0x00,0xF0,0x01,0x1F,0x00,0xE0,0xFF,0x0F,0x00,0x80,0xFF,0x03,0x00,0x00,0xFE,0x00,0x00,
+	0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x3C,0x00,0x78,0x00,0x38,0x00,0x38,0x00,0x78,0x00,0x3C,0x00,0xF0,0x00,0x1E,0x00,0xF0,0x01,0x1F,0x00,0xE0,0xFF,0x0F,0x00,0x80,0xFF,0x03,0x00,0x00,0xFE,0x00,0x00,
 
 	/* Index 37, character 69 "E" (width: 13 pixels) */
-	0xD, 0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x00,0x70,0x00,
+	0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x1C,0x70,0x00,0x1C,0x00,0x70,0x00,
 
 	/* Index 38, character 70 "F" (width: 13 pixels) */
-	0xD, 0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,
+	0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x1C,0x00,0x00,
 
 	/* Index 39, character 71 "G" (width: 17 pixels) */
-	0x11, 0x00,0xFE,0x00,0x00,0xC0,0xFF,0x07,0x00,0xE0,0xFF,0x0F,0x00,0xF0,0x01,0x1F,0x00,0x78,0x00,0x3C,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x78,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x70,0x70,0x00,0x1C,0x70,0x70,0x00,0x1C,0x70,0x70,0x00,0x1C,0x70,0x70,0x00,0x3C,0x70,0x30,0x00,0x38,0xF0,0x3F,0x00,0x38,0xF0,0x3F,0x00,0x70,0xF0,0x1F,0x00,
+	0x00,0xFE,0x00,0x00,0xC0,0xFF,0x07,0x00,0xE0,0xFF,0x0F,0x00,0xF0,0x01,0x1F,0x00,0x78,0x00,0x3C,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x78,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x70,0x70,0x00,0x1C,0x70,0x70,0x00,0x1C,0x70,0x70,0x00,0x1C,0x70,0x70,0x00,0x3C,0x70,0x30,0x00,0x38,0xF0,0x3F,0x00,0x38,0xF0,0x3F,0x00,0x70,0xF0,0x1F,0x00,
 
 	/* Index 40, character 72 "H" (width: 16 pixels) */
-	0x10, 0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,
+	0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,
 
 	/* Index 41, character 73 "I" (width: 9 pixels) */
-	0x9, 0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,
+	0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,
 
 	/* Index 42, character 74 "J" (width: 10 pixels) */
-	0xA, 0x00,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x78,0x00,0xFC,0xFF,0x3F,0x00,0xFC,0xFF,0x1F,0x00,0xFC,0xFF,0x0F,0x00,
+	0x00,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x78,0x00,0xFC,0xFF,0x3F,0x00,0xFC,0xFF,0x1F,0x00,0xFC,0xFF,0x0F,0x00,
 
 	/* Index 43, character 75 "K" (width: 15 pixels) */
-	0xF, 0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x00,0x3C,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x7F,0x00,0x00,0x80,0xF7,0x01,0x00,0xC0,0xE3,0x03,0x00,0xE0,0xC1,0x07,0x00,0xF0,0x00,0x1F,0x00,0x78,0x00,0x3E,0x00,0x3C,0x00,0x7C,0x00,0x1C,0x00,0x70,0x00,0x0C,0x00,0x60,0x00,0x04,0x00,0x40,0x00,
+	0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x00,0x3C,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x7F,0x00,0x00,0x80,0xF7,0x01,0x00,0xC0,0xE3,0x03,0x00,0xE0,0xC1,0x07,0x00,0xF0,0x00,0x1F,0x00,0x78,0x00,0x3E,0x00,0x3C,0x00,0x7C,0x00,0x1C,0x00,0x70,0x00,0x0C,0x00,0x60,0x00,0x04,0x00,0x40,0x00,
 
 	/* Index 44, character 76 "L" (width: 12 pixels) */
-	0xC, 0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,
+	0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,
 
 	/* Index 45, character 77 "M" (width: 18 pixels) */
-	0x12, 0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x3C,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0xE0,0x01,0x00,0x00,0x7C,0x00,0x00,0x00,0x1F,0x00,0x00,0xC0,0x07,0x00,0x00,0xF8,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,
+	0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x3C,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0xE0,0x01,0x00,0x00,0x7C,0x00,0x00,0x00,0x1F,0x00,0x00,0xC0,0x07,0x00,0x00,0xF8,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,
 
 	/* Index 46, character 78 "N" (width: 15 pixels) */
-	0xF, 0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x3C,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xE0,0x07,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x7C,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,
+	0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x3C,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xE0,0x07,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x7C,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,
 
 	/* Index 47, character 79 "O" (width: 19 pixels) */
-	0x13, 0x00,0xFE,0x00,0x00,0xC0,0xFF,0x07,0x00,0xE0,0xFF,0x0F,0x00,0xF0,0x01,0x1F,0x00,0x78,0x00,0x3C,0x00,0x38,0x00,0x38,0x00,0x3C,0x00,0x78,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x3C,0x00,0x78,0x00,0x38,0x00,0x38,0x00,0x78,0x00,0x3C,0x00,0xF0,0x01,0x1F,0x00,0xE0,0xFF,0x0F,0x00,0xC0,0xFF,0x07,0x00,0x00,0xFE,0x00,0x00,
+	0x00,0xFE,0x00,0x00,0xC0,0xFF,0x07,0x00,0xE0,0xFF,0x0F,0x00,0xF0,0x01,0x1F,0x00,0x78,0x00,0x3C,0x00,0x38,0x00,0x38,0x00,0x3C,0x00,0x78,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x3C,0x00,0x78,0x00,0x38,0x00,0x38,0x00,0x78,0x00,0x3C,0x00,0xF0,0x01,0x1F,0x00,0xE0,0xFF,0x0F,0x00,0xC0,0xFF,0x07,0x00,0x00,0xFE,0x00,0x00,
 
 	/* Index 48, character 80 "P" (width: 13 pixels) */
-	0xD, 0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x70,0x00,0x00,0x1C,0x70,0x00,0x00,0x1C,0x70,0x00,0x00,0x1C,0x70,0x00,0x00,0x1C,0x70,0x00,0x00,0x3C,0x78,0x00,0x00,0x78,0x3C,0x00,0x00,0xF8,0x3F,0x00,0x00,0xF0,0x1F,0x00,0x00,0xC0,0x07,0x00,0x00,
+	0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x70,0x00,0x00,0x1C,0x70,0x00,0x00,0x1C,0x70,0x00,0x00,0x1C,0x70,0x00,0x00,0x1C,0x70,0x00,0x00,0x3C,0x78,0x00,0x00,0x78,0x3C,0x00,0x00,0xF8,0x3F,0x00,0x00,0xF0,0x1F,0x00,0x00,0xC0,0x07,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 19 pixels) */
-	0x13, 0x00,0xFE,0x00,0x00,0xC0,0xFF,0x07,0x00,0xE0,0xFF,0x0F,0x00,0xF0,0x01,0x1F,0x00,0x78,0x00,0x3C,0x00,0x38,0x00,0x38,0x00,0x3C,0x00,0x78,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0xF0,0x03,0x1C,0x00,0xF0,0x07,0x3C,0x00,0xF8,0x0F,0x38,0x00,0x38,0x1E,0x78,0x00,0x3C,0x1C,0xF0,0x01,0x1F,0x1C,0xE0,0xFF,0x0F,0x1C,0xC0,0xFF,0x07,0x1C,0x00,0xFE,0x00,0x1C,
+	0x00,0xFE,0x00,0x00,0xC0,0xFF,0x07,0x00,0xE0,0xFF,0x0F,0x00,0xF0,0x01,0x1F,0x00,0x78,0x00,0x3C,0x00,0x38,0x00,0x38,0x00,0x3C,0x00,0x78,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0xF0,0x03,0x1C,0x00,0xF0,0x07,0x3C,0x00,0xF8,0x0F,0x38,0x00,0x38,0x1E,0x78,0x00,0x3C,0x1C,0xF0,0x01,0x1F,0x1C,0xE0,0xFF,0x0F,0x1C,0xC0,0xFF,0x07,0x1C,0x00,0xFE,0x00,0x1C,
 
 	/* Index 50, character 82 "R" (width: 16 pixels) */
-	0x10, 0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x70,0x00,0x00,0x1C,0x70,0x00,0x00,0x1C,0x70,0x00,0x00,0x1C,0xF0,0x00,0x00,0x1C,0xF0,0x01,0x00,0x1C,0xF8,0x07,0x00,0x38,0xBC,0x0F,0x00,0xF8,0x1F,0x1F,0x00,0xF0,0x0F,0x3C,0x00,0xE0,0x07,0x78,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x40,0x00,
+	0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x70,0x00,0x00,0x1C,0x70,0x00,0x00,0x1C,0x70,0x00,0x00,0x1C,0xF0,0x00,0x00,0x1C,0xF0,0x01,0x00,0x1C,0xF8,0x07,0x00,0x38,0xBC,0x0F,0x00,0xF8,0x1F,0x1F,0x00,0xF0,0x0F,0x3C,0x00,0xE0,0x07,0x78,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x40,0x00,
 
 	/* Index 51, character 83 "S" (width: 14 pixels) */
-	0xE, 0xC0,0x03,0x3C,0x00,0xF0,0x0F,0x38,0x00,0xF8,0x0F,0x38,0x00,0x38,0x1E,0x70,0x00,0x3C,0x1C,0x70,0x00,0x1C,0x18,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x70,0x78,0x00,0x3C,0x70,0x38,0x00,0x38,0xF0,0x3F,0x00,0x78,0xE0,0x1F,0x00,0x00,0xC0,0x07,0x00,
+	0xC0,0x03,0x3C,0x00,0xF0,0x0F,0x38,0x00,0xF8,0x0F,0x38,0x00,0x38,0x1E,0x70,0x00,0x3C,0x1C,0x70,0x00,0x1C,0x18,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x38,0x70,0x00,0x1C,0x70,0x78,0x00,0x3C,0x70,0x38,0x00,0x38,0xF0,0x3F,0x00,0x78,0xE0,0x1F,0x00,0x00,0xC0,0x07,0x00,
 
 	/* Index 52, character 84 "T" (width: 19 pixels) */
-	0x13, 0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,
+	0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,
 
 	/* Index 53, character 85 "U" (width: 15 pixels) */
-	0xF, 0xFC,0xFF,0x07,0x00,0xFC,0xFF,0x1F,0x00,0xFC,0xFF,0x3F,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x3C,0x00,0xFC,0xFF,0x3F,0x00,0xFC,0xFF,0x1F,0x00,0xFC,0xFF,0x07,0x00,
+	0xFC,0xFF,0x07,0x00,0xFC,0xFF,0x1F,0x00,0xFC,0xFF,0x3F,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x3C,0x00,0xFC,0xFF,0x3F,0x00,0xFC,0xFF,0x1F,0x00,0xFC,0xFF,0x07,0x00,
 
 	/* Index 54, character 86 "V" (width: 17 pixels) */
-	0x11, 0x04,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0xF8,0x0F,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0xF0,0x1F,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x7C,0x00,0x00,0x80,0x7F,0x00,0x00,0xF0,0x1F,0x00,0x00,0xFE,0x03,0x00,0xC0,0x7F,0x00,0x00,0xF8,0x0F,0x00,0x00,0xFC,0x01,0x00,0x00,0x3C,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+	0x04,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0xF8,0x0F,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0xF0,0x1F,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x7C,0x00,0x00,0x80,0x7F,0x00,0x00,0xF0,0x1F,0x00,0x00,0xFE,0x03,0x00,0xC0,0x7F,0x00,0x00,0xF8,0x0F,0x00,0x00,0xFC,0x01,0x00,0x00,0x3C,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
 
 	/* Index 55, character 87 "W" (width: 26 pixels) */
-	0x1A, 0x0C,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x78,0x00,0x00,0x80,0x7F,0x00,0x00,0xF8,0x0F,0x00,0x80,0xFF,0x00,0x00,0xF8,0x0F,0x00,0x00,0xFC,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x7F,0x00,0x00,0xF0,0x7F,0x00,0x00,0xFF,0x07,0x00,0xF0,0xFF,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFC,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,
+	0x0C,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x78,0x00,0x00,0x80,0x7F,0x00,0x00,0xF8,0x0F,0x00,0x80,0xFF,0x00,0x00,0xF8,0x0F,0x00,0x00,0xFC,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x7F,0x00,0x00,0xF0,0x7F,0x00,0x00,0xFF,0x07,0x00,0xF0,0xFF,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFC,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,
 
 	/* Index 56, character 88 "X" (width: 17 pixels) */
-	0x11, 0x04,0x00,0x40,0x00,0x0C,0x00,0x60,0x00,0x3C,0x00,0x78,0x00,0x78,0x00,0x3C,0x00,0xF0,0x01,0x1F,0x00,0xC0,0x83,0x07,0x00,0x80,0xEF,0x03,0x00,0x00,0xFE,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0xFE,0x00,0x00,0x80,0xEF,0x03,0x00,0xC0,0x83,0x07,0x00,0xF0,0x01,0x1F,0x00,0x78,0x00,0x3C,0x00,0x3C,0x00,0x78,0x00,0x0C,0x00,0x60,0x00,0x04,0x00,0x40,0x00,
+	0x04,0x00,0x40,0x00,0x0C,0x00,0x60,0x00,0x3C,0x00,0x78,0x00,0x78,0x00,0x3C,0x00,0xF0,0x01,0x1F,0x00,0xC0,0x83,0x07,0x00,0x80,0xEF,0x03,0x00,0x00,0xFE,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0xFE,0x00,0x00,0x80,0xEF,0x03,0x00,0xC0,0x83,0x07,0x00,0xF0,0x01,0x1F,0x00,0x78,0x00,0x3C,0x00,0x3C,0x00,0x78,0x00,0x0C,0x00,0x60,0x00,0x04,0x00,0x40,0x00,
 
 	/* Index 57, character 89 "Y" (width: 17 pixels) */
-	0x11, 0x04,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0xC0,0x07,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0xF8,0x7F,0x00,0x00,0xFE,0x7F,0x00,0x80,0x1F,0x00,0x00,0xE0,0x07,0x00,0x00,0xF0,0x03,0x00,0x00,0xFC,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+	0x04,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0xC0,0x07,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0xF8,0x7F,0x00,0x00,0xFE,0x7F,0x00,0x80,0x1F,0x00,0x00,0xE0,0x07,0x00,0x00,0xF0,0x03,0x00,0x00,0xFC,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
 
 	/* Index 58, character 90 "Z" (width: 14 pixels) */
-	0xE, 0x00,0x00,0x78,0x00,0x1C,0x00,0x7C,0x00,0x1C,0x00,0x7F,0x00,0x1C,0x80,0x77,0x00,0x1C,0xC0,0x73,0x00,0x1C,0xF0,0x71,0x00,0x1C,0x78,0x70,0x00,0x1C,0x3C,0x70,0x00,0x1C,0x0F,0x70,0x00,0x9C,0x07,0x70,0x00,0xDC,0x03,0x70,0x00,0xFC,0x00,0x70,0x00,0x7C,0x00,0x70,0x00,0x3C,0x00,0x70,0x00,
+	0x00,0x00,0x78,0x00,0x1C,0x00,0x7C,0x00,0x1C,0x00,0x7F,0x00,0x1C,0x80,0x77,0x00,0x1C,0xC0,0x73,0x00,0x1C,0xF0,0x71,0x00,0x1C,0x78,0x70,0x00,0x1C,0x3C,0x70,0x00,0x1C,0x0F,0x70,0x00,0x9C,0x07,0x70,0x00,0xDC,0x03,0x70,0x00,0xFC,0x00,0x70,0x00,0x7C,0x00,0x70,0x00,0x3C,0x00,0x70,0x00,
 
 	/* Index 59, character 91 "[" (width: 7 pixels) */
-	0x7, 0xFE,0xFF,0xFF,0x1F,0xFE,0xFF,0xFF,0x1F,0xFE,0xFF,0xFF,0x1F,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,
+	0xFE,0xFF,0xFF,0x1F,0xFE,0xFF,0xFF,0x1F,0xFE,0xFF,0xFF,0x1F,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,
 
 	/* Index 60, character 92 "\" (width: 11 pixels) */
-	0xB, 0x06,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x0C,
+	0x06,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x0C,
 
 	/* Index 61, character 93 "]" (width: 7 pixels) */
-	0x7, 0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0xFE,0xFF,0xFF,0x1F,0xFE,0xFF,0xFF,0x1F,0xFE,0xFF,0xFF,0x1F,
+	0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0xFE,0xFF,0xFF,0x1F,0xFE,0xFF,0xFF,0x1F,0xFE,0xFF,0xFF,0x1F,
 
 	/* Index 62, character 94 "^" (width: 17 pixels) */
-	0x11, 0x00,0x10,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0xE0,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x10,0x00,0x00,
+	0x00,0x10,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0xE0,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x10,0x00,0x00,
 
 	/* Index 63, character 95 "_" (width: 16 pixels) */
-	0x10, 0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,
+	0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,
 
 	/* Index 64, character 96 "`" (width: 6 pixels) */
-	0x6, 0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+	0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 12 pixels) */
-	0xC, 0x00,0x00,0x1F,0x00,0x00,0x83,0x3F,0x00,0x80,0xC3,0x7F,0x00,0x80,0xC3,0x79,0x00,0x80,0xE3,0x71,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x30,0x00,0x80,0xE7,0x18,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
+	0x00,0x00,0x1F,0x00,0x00,0x83,0x3F,0x00,0x80,0xC3,0x7F,0x00,0x80,0xC3,0x79,0x00,0x80,0xE3,0x71,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x30,0x00,0x80,0xE7,0x18,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
 
 	/* Index 66, character 98 "b" (width: 13 pixels) */
-	0xD, 0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x06,0x30,0x00,0x00,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x78,0x00,0x80,0x0F,0x3C,0x00,0x00,0xFF,0x3F,0x00,0x00,0xFE,0x0F,0x00,0x00,0xF8,0x03,0x00,
+	0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x06,0x30,0x00,0x00,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x78,0x00,0x80,0x0F,0x3C,0x00,0x00,0xFF,0x3F,0x00,0x00,0xFE,0x0F,0x00,0x00,0xF8,0x03,0x00,
 
 	/* Index 67, character 99 "c" (width: 11 pixels) */
-	0xB, 0x00,0xF0,0x07,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFF,0x3F,0x00,0x00,0x0F,0x3C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x00,0x03,0x30,0x00,0x00,0x07,0x38,0x00,
+	0x00,0xF0,0x07,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFF,0x3F,0x00,0x00,0x0F,0x3C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x00,0x03,0x30,0x00,0x00,0x07,0x38,0x00,
 
 	/* Index 68, character 100 "d" (width: 13 pixels) */
-	0xD, 0x00,0xF0,0x07,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFF,0x3F,0x00,0x00,0x0F,0x7C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x30,0x00,0x00,0x03,0x18,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,
+	0x00,0xF0,0x07,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFF,0x3F,0x00,0x00,0x0F,0x7C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x30,0x00,0x00,0x03,0x18,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,
 
 	/* Index 69, character 101 "e" (width: 13 pixels) */
-	0xD, 0x00,0xF0,0x03,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFE,0x1F,0x00,0x00,0x77,0x3C,0x00,0x80,0x73,0x38,0x00,0x80,0x73,0x70,0x00,0x80,0x73,0x70,0x00,0x80,0x73,0x70,0x00,0x80,0x73,0x70,0x00,0x80,0x77,0x70,0x00,0x00,0x7F,0x70,0x00,0x00,0x7E,0x38,0x00,0x00,0x7C,0x38,0x00,
+	0x00,0xF0,0x03,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFE,0x1F,0x00,0x00,0x77,0x3C,0x00,0x80,0x73,0x38,0x00,0x80,0x73,0x70,0x00,0x80,0x73,0x70,0x00,0x80,0x73,0x70,0x00,0x80,0x73,0x70,0x00,0x80,0x77,0x70,0x00,0x00,0x7F,0x70,0x00,0x00,0x7E,0x38,0x00,0x00,0x7C,0x38,0x00,
 
 	/* Index 70, character 102 "f" (width: 10 pixels) */
-	0xA, 0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0xF0,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x9E,0x03,0x00,0x00,0x8E,0x03,0x00,0x00,0x8E,0x03,0x00,0x00,0x8E,0x03,0x00,0x00,0x0E,0x00,0x00,0x00,
+	0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0xF0,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x7F,0x00,0x9E,0x03,0x00,0x00,0x8E,0x03,0x00,0x00,0x8E,0x03,0x00,0x00,0x8E,0x03,0x00,0x00,0x0E,0x00,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 13 pixels) */
-	0xD, 0x00,0xF0,0x07,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFE,0x3F,0x1C,0x00,0x0F,0x7C,0x1C,0x80,0x07,0x70,0x1C,0x80,0x03,0x70,0x1C,0x80,0x03,0x70,0x1C,0x80,0x03,0x70,0x1C,0x80,0x03,0x30,0x1C,0x00,0x03,0x38,0x0E,0x80,0xFF,0xFF,0x0F,0x80,0xFF,0xFF,0x07,0x80,0xFF,0xFF,0x01,
+	0x00,0xF0,0x07,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFE,0x3F,0x1C,0x00,0x0F,0x7C,0x1C,0x80,0x07,0x70,0x1C,0x80,0x03,0x70,0x1C,0x80,0x03,0x70,0x1C,0x80,0x03,0x70,0x1C,0x80,0x03,0x30,0x1C,0x00,0x03,0x38,0x0E,0x80,0xFF,0xFF,0x0F,0x80,0xFF,0xFF,0x07,0x80,0xFF,0xFF,0x01,
 
 	/* Index 72, character 104 "h" (width: 12 pixels) */
-	0xC, 0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
+	0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
 
 	/* Index 73, character 105 "i" (width: 3 pixels) */
-	0x3, 0x9C,0xFF,0x7F,0x00,0x9C,0xFF,0x7F,0x00,0x9C,0xFF,0x7F,0x00,
+	0x9C,0xFF,0x7F,0x00,0x9C,0xFF,0x7F,0x00,0x9C,0xFF,0x7F,0x00,
 
 	/* Index 74, character 106 "j" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x80,0x03,0x00,0x1C,0x80,0x03,0x00,0x1C,0x80,0x03,0x00,0x1E,0x9C,0xFF,0xFF,0x0F,0x9C,0xFF,0xFF,0x0F,0x9C,0xFF,0xFF,0x03,
+	0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x80,0x03,0x00,0x1C,0x80,0x03,0x00,0x1C,0x80,0x03,0x00,0x1E,0x9C,0xFF,0xFF,0x0F,0x9C,0xFF,0xFF,0x0F,0x9C,0xFF,0xFF,0x03,
 
 	/* Index 75, character 107 "k" (width: 13 pixels) */
-	0xD, 0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0xE0,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0xF8,0x03,0x00,0x00,0xDE,0x07,0x00,0x00,0x0F,0x1F,0x00,0x80,0x07,0x3E,0x00,0x80,0x03,0x7C,0x00,0x80,0x01,0x70,0x00,0x80,0x00,0x60,0x00,0x00,0x00,0x40,0x00,
+	0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0xE0,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0xF8,0x03,0x00,0x00,0xDE,0x07,0x00,0x00,0x0F,0x1F,0x00,0x80,0x07,0x3E,0x00,0x80,0x03,0x7C,0x00,0x80,0x01,0x70,0x00,0x80,0x00,0x60,0x00,0x00,0x00,0x40,0x00,
 
 	/* Index 76, character 108 "l" (width: 3 pixels) */
-	0x3, 0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,
+	0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,
 
 	/* Index 77, character 109 "m" (width: 21 pixels) */
-	0x15, 0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
+	0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
 
 	/* Index 78, character 110 "n" (width: 12 pixels) */
-	0xC, 0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
+	0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
 
 	/* Index 79, character 111 "o" (width: 14 pixels) */
-	0xE, 0x00,0xF0,0x03,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFE,0x1F,0x00,0x00,0x0F,0x3C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x07,0x78,0x00,0x00,0x0F,0x3C,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFC,0x0F,0x00,0x00,0xF0,0x03,0x00,
+	0x00,0xF0,0x03,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFE,0x1F,0x00,0x00,0x0F,0x3C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x07,0x78,0x00,0x00,0x0F,0x3C,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFC,0x0F,0x00,0x00,0xF0,0x03,0x00,
 
 	/* Index 80, character 112 "p" (width: 13 pixels) */
-	0xD, 0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,0x00,0x06,0x38,0x00,0x00,0x07,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x78,0x00,0x80,0x0F,0x3C,0x00,0x00,0xFF,0x3F,0x00,0x00,0xFE,0x0F,0x00,0x00,0xF8,0x03,0x00,
+	0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,0x00,0x06,0x38,0x00,0x00,0x07,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x78,0x00,0x80,0x0F,0x3C,0x00,0x00,0xFF,0x3F,0x00,0x00,0xFE,0x0F,0x00,0x00,0xF8,0x03,0x00,
 
 	/* Index 81, character 113 "q" (width: 13 pixels) */
-	0xD, 0x00,0xF0,0x07,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFF,0x3F,0x00,0x00,0x0F,0x7C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x38,0x00,0x00,0x07,0x38,0x00,0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,
+	0x00,0xF0,0x07,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFF,0x3F,0x00,0x00,0x0F,0x7C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x38,0x00,0x00,0x07,0x38,0x00,0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,
 
 	/* Index 82, character 114 "r" (width: 8 pixels) */
-	0x8, 0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,
+	0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 11 pixels) */
-	0xB, 0x00,0x3C,0x38,0x00,0x00,0x7F,0x38,0x00,0x00,0xFF,0x70,0x00,0x80,0xE7,0x70,0x00,0x80,0xE3,0x70,0x00,0x80,0xC3,0x71,0x00,0x80,0xC3,0x71,0x00,0x80,0xC3,0x79,0x00,0x80,0xC3,0x3F,0x00,0x00,0x87,0x3F,0x00,0x00,0x00,0x0F,0x00,
+	0x00,0x3C,0x38,0x00,0x00,0x7F,0x38,0x00,0x00,0xFF,0x70,0x00,0x80,0xE7,0x70,0x00,0x80,0xE3,0x70,0x00,0x80,0xC3,0x71,0x00,0x80,0xC3,0x71,0x00,0x80,0xC3,0x79,0x00,0x80,0xC3,0x3F,0x00,0x00,0x87,0x3F,0x00,0x00,0x00,0x0F,0x00,
 
 	/* Index 84, character 116 "t" (width: 10 pixels) */
-	0xA, 0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0xFC,0xFF,0x1F,0x00,0xFC,0xFF,0x3F,0x00,0xFC,0xFF,0x7F,0x00,0x80,0x03,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x78,0x00,
+	0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0xFC,0xFF,0x1F,0x00,0xFC,0xFF,0x3F,0x00,0xFC,0xFF,0x7F,0x00,0x80,0x03,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x78,0x00,
 
 	/* Index 85, character 117 "u" (width: 12 pixels) */
-	0xC, 0x80,0xFF,0x0F,0x00,0x80,0xFF,0x3F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x18,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,
+	0x80,0xFF,0x0F,0x00,0x80,0xFF,0x3F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x18,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,
 
 	/* Index 86, character 118 "v" (width: 14 pixels) */
-	0xE, 0x80,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0xF8,0x07,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x7E,0x00,0x00,0xC0,0x3F,0x00,0x00,0xF8,0x07,0x00,0x00,0xFF,0x01,0x00,0x80,0x3F,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x00,0x00,0x00,
+	0x80,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0xF8,0x07,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x7E,0x00,0x00,0xC0,0x3F,0x00,0x00,0xF8,0x07,0x00,0x00,0xFF,0x01,0x00,0x80,0x3F,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x00,0x00,0x00,
 
 	/* Index 87, character 119 "w" (width: 22 pixels) */
-	0x16, 0x80,0x01,0x00,0x00,0x80,0x1F,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x7C,0x00,0x00,0x80,0x1F,0x00,0x00,0xF8,0x03,0x00,0x00,0x7F,0x00,0x00,0x80,0x0F,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x78,0x00,0x00,0xC0,0x7F,0x00,0x00,0xFE,0x0F,0x00,0x80,0xFF,0x00,0x00,0x80,0x1F,0x00,0x00,0x80,0x01,0x00,0x00,
+	0x80,0x01,0x00,0x00,0x80,0x1F,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x7C,0x00,0x00,0x80,0x1F,0x00,0x00,0xF8,0x03,0x00,0x00,0x7F,0x00,0x00,0x80,0x0F,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x78,0x00,0x00,0xC0,0x7F,0x00,0x00,0xFE,0x0F,0x00,0x80,0xFF,0x00,0x00,0x80,0x1F,0x00,0x00,0x80,0x01,0x00,0x00,
 
 	/* Index 88, character 120 "x" (width: 14 pixels) */
-	0xE, 0x80,0x00,0x40,0x00,0x80,0x01,0x60,0x00,0x80,0x07,0x78,0x00,0x00,0x0F,0x3C,0x00,0x00,0x3E,0x1F,0x00,0x00,0xF8,0x07,0x00,0x00,0xF0,0x03,0x00,0x00,0xF0,0x03,0x00,0x00,0xF8,0x07,0x00,0x00,0x3E,0x1F,0x00,0x00,0x0F,0x3C,0x00,0x80,0x07,0x78,0x00,0x80,0x01,0x60,0x00,0x80,0x00,0x40,0x00,
+	0x80,0x00,0x40,0x00,0x80,0x01,0x60,0x00,0x80,0x07,0x78,0x00,0x00,0x0F,0x3C,0x00,0x00,0x3E,0x1F,0x00,0x00,0xF8,0x07,0x00,0x00,0xF0,0x03,0x00,0x00,0xF0,0x03,0x00,0x00,0xF8,0x07,0x00,0x00,0x3E,0x1F,0x00,0x00,0x0F,0x3C,0x00,0x80,0x07,0x78,0x00,0x80,0x01,0x60,0x00,0x80,0x00,0x40,0x00,
 
 	/* Index 89, character 121 "y" (width: 14 pixels) */
-	0xE, 0x80,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xFF,0x00,0x1C,0x00,0xF8,0x07,0x1F,0x00,0xE0,0xFF,0x1F,0x00,0x00,0xFF,0x07,0x00,0x00,0xFF,0x00,0x00,0xC0,0x3F,0x00,0x00,0xF8,0x07,0x00,0x00,0xFF,0x00,0x00,0x80,0x3F,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x00,0x00,0x00,
+	0x80,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xFF,0x00,0x1C,0x00,0xF8,0x07,0x1F,0x00,0xE0,0xFF,0x1F,0x00,0x00,0xFF,0x07,0x00,0x00,0xFF,0x00,0x00,0xC0,0x3F,0x00,0x00,0xF8,0x07,0x00,0x00,0xFF,0x00,0x00,0x80,0x3F,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x00,0x00,0x00,
 
 	/* Index 90, character 122 "z" (width: 11 pixels) */
-	0xB, 0x80,0x03,0x70,0x00,0x80,0x03,0x7C,0x00,0x80,0x03,0x7E,0x00,0x80,0x03,0x7F,0x00,0x80,0xC3,0x73,0x00,0x80,0xE3,0x71,0x00,0x80,0xF3,0x70,0x00,0x80,0x3F,0x70,0x00,0x80,0x1F,0x70,0x00,0x80,0x0F,0x70,0x00,0x80,0x03,0x70,0x00,
+	0x80,0x03,0x70,0x00,0x80,0x03,0x7C,0x00,0x80,0x03,0x7E,0x00,0x80,0x03,0x7F,0x00,0x80,0xC3,0x73,0x00,0x80,0xE3,0x71,0x00,0x80,0xF3,0x70,0x00,0x80,0x3F,0x70,0x00,0x80,0x1F,0x70,0x00,0x80,0x0F,0x70,0x00,0x80,0x03,0x70,0x00,
 
 	/* Index 91, character 123 "{" (width: 12 pixels) */
-	0xC, 0x00,0xC0,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x30,0x03,0x00,0xF0,0x3F,0xFF,0x03,0xFC,0x1F,0xFE,0x0F,0xFC,0x0F,0xFC,0x0F,0x0E,0x00,0x00,0x1C,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,
+	0x00,0xC0,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x30,0x03,0x00,0xF0,0x3F,0xFF,0x03,0xFC,0x1F,0xFE,0x0F,0xFC,0x0F,0xFC,0x0F,0x0E,0x00,0x00,0x1C,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,
 
 	/* Index 92, character 124 "|" (width: 3 pixels) */
-	0x3, 0xFE,0xFF,0xFF,0x1F,0xFE,0xFF,0xFF,0x1F,0xFE,0xFF,0xFF,0x1F,
+	0xFE,0xFF,0xFF,0x1F,0xFE,0xFF,0xFF,0x1F,0xFE,0xFF,0xFF,0x1F,
 
 	/* Index 93, character 125 "}" (width: 12 pixels) */
-	0xC, 0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0x0E,0x00,0x00,0x1C,0xFC,0x0F,0xFC,0x0F,0xFC,0x1F,0xFE,0x0F,0xF0,0x3F,0xFF,0x03,0x00,0x30,0x03,0x00,0x00,0xE0,0x01,0x00,0x00,0xC0,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0xC0,0x00,0x00,
+	0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0x06,0x00,0x00,0x18,0x0E,0x00,0x00,0x1C,0xFC,0x0F,0xFC,0x0F,0xFC,0x1F,0xFE,0x0F,0xF0,0x3F,0xFF,0x03,0x00,0x30,0x03,0x00,0x00,0xE0,0x01,0x00,0x00,0xC0,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0xC0,0x00,0x00,
 
 	/* Index 94, character 126 "~" (width: 17 pixels) */
-	0x11, 0x00,0xE0,0x01,0x00,0x00,0xF8,0x01,0x00,0x00,0x1C,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0xE0,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x1E,0x00,0x00
+	0x00,0xE0,0x01,0x00,0x00,0xF8,0x01,0x00,0x00,0x1C,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0xE0,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x1E,0x00,0x00
+};
+
+// Offset of each bitmap in Tahoma22_bitmaps
+const unsigned short Tahoma22_offsets[] = 
+{
+	0x0,	// Index 0
+	0x10,	// Index 1
+	0x1C,	// Index 2
+	0x3C,	// Index 3
+	0x80,	// Index 4
+	0xB4,	// Index 5
+	0x118,	// Index 6
+	0x164,	// Index 7
+	0x170,	// Index 8
+	0x194,	// Index 9
+	0x1B8,	// Index 10
+	0x1E8,	// Index 11
+	0x228,	// Index 12
+	0x240,	// Index 13
+	0x260,	// Index 14
+	0x26C,	// Index 15
+	0x298,	// Index 16
+	0x2CC,	// Index 17
+	0x2F8,	// Index 18
+	0x32C,	// Index 19
+	0x360,	// Index 20
+	0x39C,	// Index 21
+	0x3D0,	// Index 22
+	0x408,	// Index 23
+	0x43C,	// Index 24
+	0x474,	// Index 25
+	0x4AC,	// Index 26
+	0x4B8,	// Index 27
+	0x4D0,	// Index 28
+	0x50C,	// Index 29
+	0x54C,	// Index 30
+	0x588,	// Index 31
+	0x5B4,	// Index 32
+	0x60C,	// Index 33
+	0x650,	// Index 34
+	0x688,	// Index 35
+	0x6C4,	// Index 36
+	0x708,	// Index 37
+	0x73C,	// Index 38
+	0x770,	// Index 39
+	0x7B4,	// Index 40
+	0x7F4,	// Index 41
+	0x818,	// Index 42
+	0x840,	// Index 43
+	0x87C,	// Index 44
+	0x8AC,	// Index 45
+	0x8F4,	// Index 46
+	0x930,	// Index 47
+	0x97C,	// Index 48
+	0x9B0,	// Index 49
+	0x9FC,	// Index 50
+	0xA3C,	// Index 51
+	0xA74,	// Index 52
+	0xAC0,	// Index 53
+	0xAFC,	// Index 54
+	0xB40,	// Index 55
+	0xBA8,	// Index 56
+	0xBEC,	// Index 57
+	0xC30,	// Index 58
+	0xC68,	// Index 59
+	0xC84,	// Index 60
+	0xCB0,	// Index 61
+	0xCCC,	// Index 62
+	0xD10,	// Index 63
+	0xD50,	// Index 64
+	0xD68,	// Index 65
+	0xD98,	// Index 66
+	0xDCC,	// Index 67
+	0xDF8,	// Index 68
+	0xE2C,	// Index 69
+	0xE60,	// Index 70
+	0xE88,	// Index 71
+	0xEBC,	// Index 72
+	0xEEC,	// Index 73
+	0xEF8,	// Index 74
+	0xF18,	// Index 75
+	0xF4C,	// Index 76
+	0xF58,	// Index 77
+	0xFAC,	// Index 78
+	0xFDC,	// Index 79
+	0x1014,	// Index 80
+	0x1048,	// Index 81
+	0x107C,	// Index 82
+	0x109C,	// Index 83
+	0x10C8,	// Index 84
+	0x10F0,	// Index 85
+	0x1120,	// Index 86
+	0x1158,	// Index 87
+	0x11B0,	// Index 88
+	0x11E8,	// Index 89
+	0x1220,	// Index 90
+	0x124C,	// Index 91
+	0x127C,	// Index 92
+	0x1288,	// Index 93
+	0x12B8,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Tahoma22_widths[] = 
+{
+	0x4,	// Index 0
+	0x3,	// Index 1
+	0x8,	// Index 2
+	0x11,	// Index 3
+	0xD,	// Index 4
+	0x19,	// Index 5
+	0x13,	// Index 6
+	0x3,	// Index 7
+	0x9,	// Index 8
+	0x9,	// Index 9
+	0xC,	// Index 10
+	0x10,	// Index 11
+	0x6,	// Index 12
+	0x8,	// Index 13
+	0x3,	// Index 14
+	0xB,	// Index 15
+	0xD,	// Index 16
+	0xB,	// Index 17
+	0xD,	// Index 18
+	0xD,	// Index 19
+	0xF,	// Index 20
+	0xD,	// Index 21
+	0xE,	// Index 22
+	0xD,	// Index 23
+	0xE,	// Index 24
+	0xE,	// Index 25
+	0x3,	// Index 26
+	0x6,	// Index 27
+	0xF,	// Index 28
+	0x10,	// Index 29
+	0xF,	// Index 30
+	0xB,	// Index 31
+	0x16,	// Index 32
+	0x11,	// Index 33
+	0xE,	// Index 34
+	0xF,	// Index 35
+	0x11,	// Index 36
+	0xD,	// Index 37
+	0xD,	// Index 38
+	0x11,	// Index 39
+	0x10,	// Index 40
+	0x9,	// Index 41
+	0xA,	// Index 42
+	0xF,	// Index 43
+	0xC,	// Index 44
+	0x12,	// Index 45
+	0xF,	// Index 46
+	0x13,	// Index 47
+	0xD,	// Index 48
+	0x13,	// Index 49
+	0x10,	// Index 50
+	0xE,	// Index 51
+	0x13,	// Index 52
+	0xF,	// Index 53
+	0x11,	// Index 54
+	0x1A,	// Index 55
+	0x11,	// Index 56
+	0x11,	// Index 57
+	0xE,	// Index 58
+	0x7,	// Index 59
+	0xB,	// Index 60
+	0x7,	// Index 61
+	0x11,	// Index 62
+	0x10,	// Index 63
+	0x6,	// Index 64
+	0xC,	// Index 65
+	0xD,	// Index 66
+	0xB,	// Index 67
+	0xD,	// Index 68
+	0xD,	// Index 69
+	0xA,	// Index 70
+	0xD,	// Index 71
+	0xC,	// Index 72
+	0x3,	// Index 73
+	0x8,	// Index 74
+	0xD,	// Index 75
+	0x3,	// Index 76
+	0x15,	// Index 77
+	0xC,	// Index 78
+	0xE,	// Index 79
+	0xD,	// Index 80
+	0xD,	// Index 81
+	0x8,	// Index 82
+	0xB,	// Index 83
+	0xA,	// Index 84
+	0xC,	// Index 85
+	0xE,	// Index 86
+	0x16,	// Index 87
+	0xE,	// Index 88
+	0xE,	// Index 89
+	0xB,	// Index 90
+	0xC,	// Index 91
+	0x3,	// Index 92
+	0xC,	// Index 93
+	0x11,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Tahoma22_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x15, 0x0,	// Index 1
+	0x16, 0x0,	// Index 2
+	0x15, 0x0,	// Index 3
+	0x17, 0x5,	// Index 4
+	0x15, 0x0,	// Index 5
+	0x15, 0x0,	// Index 6
+	0x16, 0x0,	// Index 7
+	0x16, 0x6,	// Index 8
+	0x16, 0x6,	// Index 9
+	0x16, 0x0,	// Index 10
+	0x11, 0x0,	// Index 11
+	0x4, 0x5,	// Index 12
+	0xB, 0x0,	// Index 13
+	0x4, 0x0,	// Index 14
+	0x16, 0x5,	// Index 15
+	0x15, 0x0,	// Index 16
+	0x15, 0x0,	// Index 17
+	0x15, 0x0,	// Index 18
+	0x15, 0x0,	// Index 19
+	0x15, 0x0,	// Index 20
+	0x15, 0x0,	// Index 21
+	0x15, 0x0,	// Index 22
+	0x15, 0x0,	// Index 23
+	0x15, 0x0,	// Index 24
+	0x15, 0x0,	// Index 25
+	0x10, 0x0,	// Index 26
+	0x10, 0x5,	// Index 27
+	0x12, 0x0,	// Index 28
+	0xD, 0x0,	// Index 29
+	0x12, 0x0,	// Index 30
+	0x15, 0x0,	// Index 31
+	0x15, 0x3,	// Index 32
+	0x15, 0x0,	// Index 33
+	0x15, 0x0,	// Index 34
+	0x15, 0x0,	// Index 35
+	0x15, 0x0,	// Index 36
+	0x15, 0x0,	// Index 37
+	0x15, 0x0,	// Index 38
+	0x15, 0x0,	// Index 39
+	0x15, 0x0,	// Index 40
+	0x15, 0x0,	// Index 41
+	0x15, 0x0,	// Index 42
+	0x15, 0x0,	// Index 43
+	0x15, 0x0,	// Index 44
+	0x15, 0x0,	// Index 45
+	0x15, 0x0,	// Index 46
+	0x15, 0x0,	// Index 47
+	0x15, 0x0,	// Index 48
+	0x15, 0x6,	// Index 49
+	0x15, 0x0,	// Index 50
+	0x15, 0x0,	// Index 51
+	0x15, 0x0,	// Index 52
+	0x15, 0x0,	// Index 53
+	0x15, 0x0,	// Index 54
+	0x15, 0x0,	// Index 55
+	0x15, 0x0,	// Index 56
+	0x15, 0x0,	// Index 57
+	0x15, 0x0,	// Index 58
+	0x16, 0x6,	// Index 59
+	0x16, 0x5,	// Index 60
+	0x16, 0x6,	// Index 61
+	0x15, 0x0,	// Index 62
+	0x0, 0x4,	// Index 63
+	0x17, 0x0,	// Index 64
+	0x10, 0x0,	// Index 65
+	0x16, 0x0,	// Index 66
+	0x10, 0x0,	// Index 67
+	0x16, 0x0,	// Index 68
+	0x10, 0x0,	// Index 69
+	0x16, 0x0,	// Index 70
+	0x10, 0x6,	// Index 71
+	0x16, 0x0,	// Index 72
+	0x15, 0x0,	// Index 73
+	0x15, 0x6,	// Index 74
+	0x16, 0x0,	// Index 75
+	0x16, 0x0,	// Index 76
+	0x10, 0x0,	// Index 77
+	0x10, 0x0,	// Index 78
+	0x10, 0x0,	// Index 79
+	0x10, 0x6,	// Index 80
+	0x10, 0x6,	// Index 81
+	0x10, 0x0,	// Index 82
+	0x10, 0x0,	// Index 83
+	0x15, 0x0,	// Index 84
+	0x10, 0x0,	// Index 85
+	0x10, 0x0,	// Index 86
+	0x10, 0x0,	// Index 87
+	0x10, 0x0,	// Index 88
+	0x10, 0x6,	// Index 89
+	0x10, 0x0,	// Index 90
+	0x16, 0x6,	// Index 91
+	0x16, 0x6,	// Index 92
+	0x16, 0x6,	// Index 93
+	0xE, 0x0,	// Index 94
+};
+
+const font_t Tahoma22 = 
+{
+	Tahoma22_bitmaps,
+	Tahoma22_offsets,
+	Tahoma22_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x1D,	// Height 
+	0,	// Flags 
+	Tahoma22_extents,
+	0x17	// Ascent 
 };
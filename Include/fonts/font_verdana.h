@@ -7,6 +7,8 @@
 // Project Name:  Verdana
 //---------------------------------------------------------------
 
+#include "graphics.h"
+
 //---------------------------------------------------------------
 // Group Name: Verdana8
 // Designer: Imported System Font
@@ -20,398 +22,607 @@
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Verdana8[] = 
+const unsigned char Verdana8_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0xB,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xC6, // Index 1 (offset: 198)
-	0x0, 0xC9, // Index 2 (offset: 201)
-	0x0, 0xD0, // Index 3 (offset: 208)
-	0x0, 0xDF, // Index 4 (offset: 223)
-	0x0, 0xEA, // Index 5 (offset: 234)
-	0x0, 0xFF, // Index 6 (offset: 255)
-	0x1, 0xE, // Index 7 (offset: 270)
-	0x1, 0x11, // Index 8 (offset: 273)
-	0x1, 0x18, // Index 9 (offset: 280)
-	0x1, 0x1F, // Index 10 (offset: 287)
-	0x1, 0x2A, // Index 11 (offset: 298)
-	0x1, 0x39, // Index 12 (offset: 313)
-	0x1, 0x3E, // Index 13 (offset: 318)
-	0x1, 0x45, // Index 14 (offset: 325)
-	0x1, 0x48, // Index 15 (offset: 328)
-	0x1, 0x53, // Index 16 (offset: 339)
-	0x1, 0x5E, // Index 17 (offset: 350)
-	0x1, 0x69, // Index 18 (offset: 361)
-	0x1, 0x74, // Index 19 (offset: 372)
-	0x1, 0x7F, // Index 20 (offset: 383)
-	0x1, 0x8C, // Index 21 (offset: 396)
-	0x1, 0x97, // Index 22 (offset: 407)
-	0x1, 0xA2, // Index 23 (offset: 418)
-	0x1, 0xAD, // Index 24 (offset: 429)
-	0x1, 0xB8, // Index 25 (offset: 440)
-	0x1, 0xC3, // Index 26 (offset: 451)
-	0x1, 0xC6, // Index 27 (offset: 454)
-	0x1, 0xCB, // Index 28 (offset: 459)
-	0x1, 0xD8, // Index 29 (offset: 472)
-	0x1, 0xE7, // Index 30 (offset: 487)
-	0x1, 0xF4, // Index 31 (offset: 500)
-	0x1, 0xFD, // Index 32 (offset: 509)
-	0x2, 0xE, // Index 33 (offset: 526)
-	0x2, 0x1B, // Index 34 (offset: 539)
-	0x2, 0x28, // Index 35 (offset: 552)
-	0x2, 0x37, // Index 36 (offset: 567)
-	0x2, 0x46, // Index 37 (offset: 582)
-	0x2, 0x51, // Index 38 (offset: 593)
-	0x2, 0x5C, // Index 39 (offset: 604)
-	0x2, 0x6B, // Index 40 (offset: 619)
-	0x2, 0x78, // Index 41 (offset: 632)
-	0x2, 0x7F, // Index 42 (offset: 639)
-	0x2, 0x88, // Index 43 (offset: 648)
-	0x2, 0x95, // Index 44 (offset: 661)
-	0x2, 0xA0, // Index 45 (offset: 672)
-	0x2, 0xAF, // Index 46 (offset: 687)
-	0x2, 0xBC, // Index 47 (offset: 700)
-	0x2, 0xCB, // Index 48 (offset: 715)
-	0x2, 0xD6, // Index 49 (offset: 726)
-	0x2, 0xE5, // Index 50 (offset: 741)
-	0x2, 0xF2, // Index 51 (offset: 754)
-	0x2, 0xFF, // Index 52 (offset: 767)
-	0x3, 0xE, // Index 53 (offset: 782)
-	0x3, 0x1B, // Index 54 (offset: 795)
-	0x3, 0x28, // Index 55 (offset: 808)
-	0x3, 0x3B, // Index 56 (offset: 827)
-	0x3, 0x48, // Index 57 (offset: 840)
-	0x3, 0x57, // Index 58 (offset: 855)
-	0x3, 0x64, // Index 59 (offset: 868)
-	0x3, 0x6B, // Index 60 (offset: 875)
-	0x3, 0x76, // Index 61 (offset: 886)
-	0x3, 0x7D, // Index 62 (offset: 893)
-	0x3, 0x8C, // Index 63 (offset: 908)
-	0x3, 0x9B, // Index 64 (offset: 923)
-	0x3, 0xA0, // Index 65 (offset: 928)
-	0x3, 0xAB, // Index 66 (offset: 939)
-	0x3, 0xB6, // Index 67 (offset: 950)
-	0x3, 0xC1, // Index 68 (offset: 961)
-	0x3, 0xCC, // Index 69 (offset: 972)
-	0x3, 0xD7, // Index 70 (offset: 983)
-	0x3, 0xE0, // Index 71 (offset: 992)
-	0x3, 0xEB, // Index 72 (offset: 1003)
-	0x3, 0xF6, // Index 73 (offset: 1014)
-	0x3, 0xF9, // Index 74 (offset: 1017)
-	0x4, 0x0, // Index 75 (offset: 1024)
-	0x4, 0xB, // Index 76 (offset: 1035)
-	0x4, 0xE, // Index 77 (offset: 1038)
-	0x4, 0x21, // Index 78 (offset: 1057)
-	0x4, 0x2C, // Index 79 (offset: 1068)
-	0x4, 0x37, // Index 80 (offset: 1079)
-	0x4, 0x42, // Index 81 (offset: 1090)
-	0x4, 0x4D, // Index 82 (offset: 1101)
-	0x4, 0x56, // Index 83 (offset: 1110)
-	0x4, 0x5F, // Index 84 (offset: 1119)
-	0x4, 0x68, // Index 85 (offset: 1128)
-	0x4, 0x73, // Index 86 (offset: 1139)
-	0x4, 0x7E, // Index 87 (offset: 1150)
-	0x4, 0x8D, // Index 88 (offset: 1165)
-	0x4, 0x98, // Index 89 (offset: 1176)
-	0x4, 0xA3, // Index 90 (offset: 1187)
-	0x4, 0xAC, // Index 91 (offset: 1196)
-	0x4, 0xB7, // Index 92 (offset: 1207)
-	0x4, 0xBA, // Index 93 (offset: 1210)
-	0x4, 0xC5, // Index 94 (offset: 1221)
-
 	/* Index 0, character 32 " " (width: 1 pixels) */
-	0x1, 0x00,0x00,
+	0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 1 pixels) */
-	0x1, 0x7E,0x01,
+	0x7E,0x01,
 
 	/* Index 2, character 34 """ (width: 3 pixels) */
-	0x3, 0x07,0x00,0x00,0x00,0x07,0x00,
+	0x07,0x00,0x00,0x00,0x07,0x00,
 
 	/* Index 3, character 35 "#" (width: 7 pixels) */
-	0x7, 0x40,0x00,0xC8,0x01,0x78,0x00,0xCE,0x01,0x78,0x00,0x4E,0x00,0x08,0x00,
+	0x40,0x00,0xC8,0x01,0x78,0x00,0xCE,0x01,0x78,0x00,0x4E,0x00,0x08,0x00,
 
 	/* Index 4, character 36 "$" (width: 5 pixels) */
-	0x5, 0x18,0x01,0x24,0x01,0xFF,0x07,0x24,0x01,0xC4,0x00,
+	0x18,0x01,0x24,0x01,0xFF,0x07,0x24,0x01,0xC4,0x00,
 
 	/* Index 5, character 37 "%" (width: 10 pixels) */
-	0xA, 0x0C,0x00,0x12,0x00,0x12,0x00,0x8C,0x01,0x60,0x00,0x18,0x00,0xC6,0x00,0x20,0x01,0x20,0x01,0xC0,0x00,
+	0x0C,0x00,0x12,0x00,0x12,0x00,0x8C,0x01,0x60,0x00,0x18,0x00,0xC6,0x00,0x20,0x01,0x20,0x01,0xC0,0x00,
 
 	/* Index 6, character 38 "&" (width: 7 pixels) */
-	0x7, 0xEC,0x00,0x12,0x01,0x12,0x01,0x2C,0x01,0xC0,0x00,0xB0,0x00,0x00,0x01,
+	0xEC,0x00,0x12,0x01,0x12,0x01,0x2C,0x01,0xC0,0x00,0xB0,0x00,0x00,0x01,
 
 	/* Index 7, character 39 "'" (width: 1 pixels) */
-	0x1, 0x07,0x00,
+	0x07,0x00,
 
 	/* Index 8, character 40 "(" (width: 3 pixels) */
-	0x3, 0xF8,0x00,0x06,0x03,0x01,0x04,
+	0xF8,0x00,0x06,0x03,0x01,0x04,
 
 	/* Index 9, character 41 ")" (width: 3 pixels) */
-	0x3, 0x01,0x04,0x06,0x03,0xF8,0x00,
+	0x01,0x04,0x06,0x03,0xF8,0x00,
 
 	/* Index 10, character 42 "*" (width: 5 pixels) */
-	0x5, 0x0A,0x00,0x04,0x00,0x1F,0x00,0x04,0x00,0x0A,0x00,
+	0x0A,0x00,0x04,0x00,0x1F,0x00,0x04,0x00,0x0A,0x00,
 
 	/* Index 11, character 43 "+" (width: 7 pixels) */
-	0x7, 0x20,0x00,0x20,0x00,0x20,0x00,0xFC,0x01,0x20,0x00,0x20,0x00,0x20,0x00,
+	0x20,0x00,0x20,0x00,0x20,0x00,0xFC,0x01,0x20,0x00,0x20,0x00,0x20,0x00,
 
 	/* Index 12, character 44 "," (width: 2 pixels) */
-	0x2, 0x00,0x04,0x80,0x03,
+	0x00,0x04,0x80,0x03,
 
 	/* Index 13, character 45 "-" (width: 3 pixels) */
-	0x3, 0x20,0x00,0x20,0x00,0x20,0x00,
+	0x20,0x00,0x20,0x00,0x20,0x00,
 
 	/* Index 14, character 46 "." (width: 1 pixels) */
-	0x1, 0x80,0x01,
+	0x80,0x01,
 
 	/* Index 15, character 47 "/" (width: 5 pixels) */
-	0x5, 0x00,0x03,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,
+	0x00,0x03,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,
 
 	/* Index 16, character 48 "0" (width: 5 pixels) */
-	0x5, 0xFC,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0xFC,0x00,
+	0xFC,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0xFC,0x00,
 
 	/* Index 17, character 49 "1" (width: 5 pixels) */
-	0x5, 0x04,0x01,0x04,0x01,0xFE,0x01,0x00,0x01,0x00,0x01,
+	0x04,0x01,0x04,0x01,0xFE,0x01,0x00,0x01,0x00,0x01,
 
 	/* Index 18, character 50 "2" (width: 5 pixels) */
-	0x5, 0x84,0x01,0x42,0x01,0x22,0x01,0x12,0x01,0x0C,0x01,
+	0x84,0x01,0x42,0x01,0x22,0x01,0x12,0x01,0x0C,0x01,
 
 	/* Index 19, character 51 "3" (width: 5 pixels) */
-	0x5, 0x84,0x00,0x02,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
+	0x84,0x00,0x02,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
 
 	/* Index 20, character 52 "4" (width: 6 pixels) */
-	0x6, 0x60,0x00,0x50,0x00,0x48,0x00,0x44,0x00,0xFE,0x01,0x40,0x00,
+	0x60,0x00,0x50,0x00,0x48,0x00,0x44,0x00,0xFE,0x01,0x40,0x00,
 
 	/* Index 21, character 53 "5" (width: 5 pixels) */
-	0x5, 0x9E,0x00,0x12,0x01,0x12,0x01,0x12,0x01,0xE2,0x00,
+	0x9E,0x00,0x12,0x01,0x12,0x01,0x12,0x01,0xE2,0x00,
 
 	/* Index 22, character 54 "6" (width: 5 pixels) */
-	0x5, 0xF8,0x00,0x14,0x01,0x12,0x01,0x12,0x01,0xE0,0x00,
+	0xF8,0x00,0x14,0x01,0x12,0x01,0x12,0x01,0xE0,0x00,
 
 	/* Index 23, character 55 "7" (width: 5 pixels) */
-	0x5, 0x02,0x00,0x82,0x01,0x62,0x00,0x1A,0x00,0x06,0x00,
+	0x02,0x00,0x82,0x01,0x62,0x00,0x1A,0x00,0x06,0x00,
 
 	/* Index 24, character 56 "8" (width: 5 pixels) */
-	0x5, 0xEC,0x00,0x12,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
+	0xEC,0x00,0x12,0x01,0x12,0x01,0x12,0x01,0xEC,0x00,
 
 	/* Index 25, character 57 "9" (width: 5 pixels) */
-	0x5, 0x1C,0x00,0x22,0x01,0x22,0x01,0xA2,0x00,0x7C,0x00,
+	0x1C,0x00,0x22,0x01,0x22,0x01,0xA2,0x00,0x7C,0x00,
 
 	/* Index 26, character 58 ":" (width: 1 pixels) */
-	0x1, 0x98,0x01,
+	0x98,0x01,
 
 	/* Index 27, character 59 ";" (width: 2 pixels) */
-	0x2, 0x00,0x04,0x98,0x03,
+	0x00,0x04,0x98,0x03,
 
 	/* Index 28, character 60 "<" (width: 6 pixels) */
-	0x6, 0x20,0x00,0x20,0x00,0x50,0x00,0x50,0x00,0x88,0x00,0x88,0x00,
+	0x20,0x00,0x20,0x00,0x50,0x00,0x50,0x00,0x88,0x00,0x88,0x00,
 
 	/* Index 29, character 61 "=" (width: 7 pixels) */
-	0x7, 0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,
+	0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,
 
 	/* Index 30, character 62 ">" (width: 6 pixels) */
-	0x6, 0x88,0x00,0x88,0x00,0x50,0x00,0x50,0x00,0x20,0x00,0x20,0x00,
+	0x88,0x00,0x88,0x00,0x50,0x00,0x50,0x00,0x20,0x00,0x20,0x00,
 
 	/* Index 31, character 63 "?" (width: 4 pixels) */
-	0x4, 0x02,0x00,0x62,0x01,0x12,0x00,0x0C,0x00,
+	0x02,0x00,0x62,0x01,0x12,0x00,0x0C,0x00,
 
 	/* Index 32, character 64 "@" (width: 8 pixels) */
-	0x8, 0xF8,0x00,0x04,0x01,0x72,0x02,0x8A,0x02,0x8A,0x02,0x7A,0x02,0x82,0x00,0x7C,0x00,
+	0xF8,0x00,0x04,0x01,0x72,0x02,0x8A,0x02,0x8A,0x02,0x7A,0x02,0x82,0x00,0x7C,0x00,
 
 	/* Index 33, character 65 "A" (width: 6 pixels) */
-	0x6, 0xC0,0x01,0x78,0x00,0x46,0x00,0x46,0x00,0x78,0x00,0xC0,0x01,
+	0xC0,0x01,0x78,0x00,0x46,0x00,0x46,0x00,0x78,0x00,0xC0,0x01,
 
 	/* Index 34, character 66 "B" (width: 6 pixels) */
-	0x6, 0xFE,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x1C,0x01,0xE0,0x00,
+	0xFE,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x1C,0x01,0xE0,0x00,
 
 	/* Index 35, character 67 "C" (width: 7 pixels) */
-	0x7, 0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,
+	0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,
 
 	/* Index 36, character 68 "D" (width: 7 pixels) */
-	0x7, 0xFE,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
+	0xFE,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
 
 	/* Index 37, character 69 "E" (width: 5 pixels) */
-	0x5, 0xFE,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x12,0x01,
+	0xFE,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x12,0x01,
 
 	/* Index 38, character 70 "F" (width: 5 pixels) */
-	0x5, 0xFE,0x01,0x12,0x00,0x12,0x00,0x12,0x00,0x02,0x00,
+	0xFE,0x01,0x12,0x00,0x12,0x00,0x12,0x00,0x02,0x00,
 
 	/* Index 39, character 71 "G" (width: 7 pixels) */
-	0x7, 0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x22,0x01,0x22,0x01,0xE4,0x00,
+	0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x22,0x01,0x22,0x01,0xE4,0x00,
 
 	/* Index 40, character 72 "H" (width: 6 pixels) */
-	0x6, 0xFE,0x01,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xFE,0x01,
+	0xFE,0x01,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xFE,0x01,
 
 	/* Index 41, character 73 "I" (width: 3 pixels) */
-	0x3, 0x02,0x01,0xFE,0x01,0x02,0x01,
+	0x02,0x01,0xFE,0x01,0x02,0x01,
 
 	/* Index 42, character 74 "J" (width: 4 pixels) */
-	0x4, 0x00,0x01,0x02,0x01,0x02,0x01,0xFE,0x00,
+	0x00,0x01,0x02,0x01,0x02,0x01,0xFE,0x00,
 
 	/* Index 43, character 75 "K" (width: 6 pixels) */
-	0x6, 0xFE,0x01,0x20,0x00,0x30,0x00,0x48,0x00,0x84,0x00,0x02,0x01,
+	0xFE,0x01,0x20,0x00,0x30,0x00,0x48,0x00,0x84,0x00,0x02,0x01,
 
 	/* Index 44, character 76 "L" (width: 5 pixels) */
-	0x5, 0xFE,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+	0xFE,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
 
 	/* Index 45, character 77 "M" (width: 7 pixels) */
-	0x7, 0xFE,0x01,0x06,0x00,0x18,0x00,0x60,0x00,0x18,0x00,0x06,0x00,0xFE,0x01,
+	0xFE,0x01,0x06,0x00,0x18,0x00,0x60,0x00,0x18,0x00,0x06,0x00,0xFE,0x01,
 
 	/* Index 46, character 78 "N" (width: 6 pixels) */
-	0x6, 0xFE,0x01,0x06,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0xFE,0x01,
+	0xFE,0x01,0x06,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0xFE,0x01,
 
 	/* Index 47, character 79 "O" (width: 7 pixels) */
-	0x7, 0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
+	0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
 
 	/* Index 48, character 80 "P" (width: 5 pixels) */
-	0x5, 0xFE,0x01,0x22,0x00,0x22,0x00,0x22,0x00,0x1C,0x00,
+	0xFE,0x01,0x22,0x00,0x22,0x00,0x22,0x00,0x1C,0x00,
 
 	/* Index 49, character 81 "Q" (width: 7 pixels) */
-	0x7, 0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x03,0x84,0x04,0x78,0x04,
+	0x78,0x00,0x84,0x00,0x02,0x01,0x02,0x01,0x02,0x03,0x84,0x04,0x78,0x04,
 
 	/* Index 50, character 82 "R" (width: 6 pixels) */
-	0x6, 0xFE,0x01,0x22,0x00,0x22,0x00,0x62,0x00,0x9C,0x00,0x00,0x01,
+	0xFE,0x01,0x22,0x00,0x22,0x00,0x62,0x00,0x9C,0x00,0x00,0x01,
 
 	/* Index 51, character 83 "S" (width: 6 pixels) */
-	0x6, 0x8C,0x00,0x12,0x01,0x12,0x01,0x22,0x01,0x22,0x01,0xC4,0x00,
+	0x8C,0x00,0x12,0x01,0x12,0x01,0x22,0x01,0x22,0x01,0xC4,0x00,
 
 	/* Index 52, character 84 "T" (width: 7 pixels) */
-	0x7, 0x02,0x00,0x02,0x00,0x02,0x00,0xFE,0x01,0x02,0x00,0x02,0x00,0x02,0x00,
+	0x02,0x00,0x02,0x00,0x02,0x00,0xFE,0x01,0x02,0x00,0x02,0x00,0x02,0x00,
 
 	/* Index 53, character 85 "U" (width: 6 pixels) */
-	0x6, 0xFE,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0xFE,0x00,
+	0xFE,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0xFE,0x00,
 
 	/* Index 54, character 86 "V" (width: 6 pixels) */
-	0x6, 0x0E,0x00,0x70,0x00,0x80,0x01,0x80,0x01,0x70,0x00,0x0E,0x00,
+	0x0E,0x00,0x70,0x00,0x80,0x01,0x80,0x01,0x70,0x00,0x0E,0x00,
 
 	/* Index 55, character 87 "W" (width: 9 pixels) */
-	0x9, 0x06,0x00,0x78,0x00,0x80,0x01,0x78,0x00,0x06,0x00,0x78,0x00,0x80,0x01,0x78,0x00,0x06,0x00,
+	0x06,0x00,0x78,0x00,0x80,0x01,0x78,0x00,0x06,0x00,0x78,0x00,0x80,0x01,0x78,0x00,0x06,0x00,
 
 	/* Index 56, character 88 "X" (width: 6 pixels) */
-	0x6, 0x86,0x01,0x48,0x00,0x30,0x00,0x30,0x00,0x48,0x00,0x86,0x01,
+	0x86,0x01,0x48,0x00,0x30,0x00,0x30,0x00,0x48,0x00,0x86,0x01,
 
 	/* Index 57, character 89 "Y" (width: 7 pixels) */
-	0x7, 0x02,0x00,0x04,0x00,0x08,0x00,0xF0,0x01,0x08,0x00,0x04,0x00,0x02,0x00,
+	0x02,0x00,0x04,0x00,0x08,0x00,0xF0,0x01,0x08,0x00,0x04,0x00,0x02,0x00,
 
 	/* Index 58, character 90 "Z" (width: 6 pixels) */
-	0x6, 0x82,0x01,0x42,0x01,0x22,0x01,0x12,0x01,0x0A,0x01,0x06,0x01,
+	0x82,0x01,0x42,0x01,0x22,0x01,0x12,0x01,0x0A,0x01,0x06,0x01,
 
 	/* Index 59, character 91 "[" (width: 3 pixels) */
-	0x3, 0xFF,0x07,0x01,0x04,0x01,0x04,
+	0xFF,0x07,0x01,0x04,0x01,0x04,
 
 	/* Index 60, character 92 "\" (width: 5 pixels) */
-	0x5, 0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x00,0x00,0x03,
+	0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x00,0x00,0x03,
 
 	/* Index 61, character 93 "]" (width: 3 pixels) */
-	0x3, 0x01,0x04,0x01,0x04,0xFF,0x07,
+	0x01,0x04,0x01,0x04,0xFF,0x07,
 
 	/* Index 62, character 94 "^" (width: 7 pixels) */
-	0x7, 0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,
+	0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,
 
 	/* Index 63, character 95 "_" (width: 7 pixels) */
-	0x7, 0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
+	0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
 
 	/* Index 64, character 96 "`" (width: 2 pixels) */
-	0x2, 0x01,0x00,0x02,0x00,
+	0x01,0x00,0x02,0x00,
 
 	/* Index 65, character 97 "a" (width: 5 pixels) */
-	0x5, 0xC0,0x00,0x28,0x01,0x28,0x01,0x28,0x01,0xF0,0x01,
+	0xC0,0x00,0x28,0x01,0x28,0x01,0x28,0x01,0xF0,0x01,
 
 	/* Index 66, character 98 "b" (width: 5 pixels) */
-	0x5, 0xFF,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
+	0xFF,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
 
 	/* Index 67, character 99 "c" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0x90,0x00,
+	0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0x90,0x00,
 
 	/* Index 68, character 100 "d" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xFF,0x01,
+	0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xFF,0x01,
 
 	/* Index 69, character 101 "e" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x28,0x01,0x28,0x01,0x28,0x01,0xB0,0x00,
+	0xF0,0x00,0x28,0x01,0x28,0x01,0x28,0x01,0xB0,0x00,
 
 	/* Index 70, character 102 "f" (width: 4 pixels) */
-	0x4, 0x08,0x00,0xFE,0x01,0x09,0x00,0x09,0x00,
+	0x08,0x00,0xFE,0x01,0x09,0x00,0x09,0x00,
 
 	/* Index 71, character 103 "g" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x08,0x05,0x08,0x05,0x08,0x05,0xF8,0x03,
+	0xF0,0x00,0x08,0x05,0x08,0x05,0x08,0x05,0xF8,0x03,
 
 	/* Index 72, character 104 "h" (width: 5 pixels) */
-	0x5, 0xFF,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,
+	0xFF,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,
 
 	/* Index 73, character 105 "i" (width: 1 pixels) */
-	0x1, 0xF9,0x01,
+	0xF9,0x01,
 
 	/* Index 74, character 106 "j" (width: 3 pixels) */
-	0x3, 0x00,0x04,0x08,0x04,0xF9,0x03,
+	0x00,0x04,0x08,0x04,0xF9,0x03,
 
 	/* Index 75, character 107 "k" (width: 5 pixels) */
-	0x5, 0xFF,0x01,0x40,0x00,0x60,0x00,0x90,0x00,0x08,0x01,
+	0xFF,0x01,0x40,0x00,0x60,0x00,0x90,0x00,0x08,0x01,
 
 	/* Index 76, character 108 "l" (width: 1 pixels) */
-	0x1, 0xFF,0x01,
+	0xFF,0x01,
 
 	/* Index 77, character 109 "m" (width: 9 pixels) */
-	0x9, 0xF8,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,
+	0xF8,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,
 
 	/* Index 78, character 110 "n" (width: 5 pixels) */
-	0x5, 0xF8,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,
+	0xF8,0x01,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x01,
 
 	/* Index 79, character 111 "o" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
+	0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
 
 	/* Index 80, character 112 "p" (width: 5 pixels) */
-	0x5, 0xF8,0x07,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
+	0xF8,0x07,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,
 
 	/* Index 81, character 113 "q" (width: 5 pixels) */
-	0x5, 0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xF8,0x07,
+	0xF0,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xF8,0x07,
 
 	/* Index 82, character 114 "r" (width: 4 pixels) */
-	0x4, 0xF8,0x01,0x10,0x00,0x08,0x00,0x08,0x00,
+	0xF8,0x01,0x10,0x00,0x08,0x00,0x08,0x00,
 
 	/* Index 83, character 115 "s" (width: 4 pixels) */
-	0x4, 0x30,0x01,0x28,0x01,0x48,0x01,0xC8,0x00,
+	0x30,0x01,0x28,0x01,0x48,0x01,0xC8,0x00,
 
 	/* Index 84, character 116 "t" (width: 4 pixels) */
-	0x4, 0x08,0x00,0xFE,0x00,0x08,0x01,0x08,0x01,
+	0x08,0x00,0xFE,0x00,0x08,0x01,0x08,0x01,
 
 	/* Index 85, character 117 "u" (width: 5 pixels) */
-	0x5, 0xF8,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0xF8,0x01,
+	0xF8,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0xF8,0x01,
 
 	/* Index 86, character 118 "v" (width: 5 pixels) */
-	0x5, 0x18,0x00,0x60,0x00,0x80,0x01,0x60,0x00,0x18,0x00,
+	0x18,0x00,0x60,0x00,0x80,0x01,0x60,0x00,0x18,0x00,
 
 	/* Index 87, character 119 "w" (width: 7 pixels) */
-	0x7, 0x78,0x00,0x80,0x01,0x60,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0x78,0x00,
+	0x78,0x00,0x80,0x01,0x60,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0x78,0x00,
 
 	/* Index 88, character 120 "x" (width: 5 pixels) */
-	0x5, 0x08,0x01,0x90,0x00,0x60,0x00,0x90,0x00,0x08,0x01,
+	0x08,0x01,0x90,0x00,0x60,0x00,0x90,0x00,0x08,0x01,
 
 	/* Index 89, character 121 "y" (width: 5 pixels) */
-	0x5, 0x08,0x00,0x70,0x04,0x80,0x03,0x70,0x00,0x08,0x00,
+	0x08,0x00,0x70,0x04,0x80,0x03,0x70,0x00,0x08,0x00,
 
 	/* Index 90, character 122 "z" (width: 4 pixels) */
-	0x4, 0x88,0x01,0x48,0x01,0x28,0x01,0x18,0x01,
+	0x88,0x01,0x48,0x01,0x28,0x01,0x18,0x01,
 
 	/* Index 91, character 123 "{" (width: 5 pixels) */
-	0x5, 0x20,0x00,0x20,0x00,0xDE,0x03,0x01,0x04,0x01,0x04,
+	0x20,0x00,0x20,0x00,0xDE,0x03,0x01,0x04,0x01,0x04,
 
 	/* Index 92, character 124 "|" (width: 1 pixels) */
-	0x1, 0xFF,0x07,
+	0xFF,0x07,
 
 	/* Index 93, character 125 "}" (width: 5 pixels) */
-	0x5, 0x01,0x04,0x01,0x04,0xDE,0x03,0x20,0x00,0x20,0x00,
+	0x01,0x04,0x01,0x04,0xDE,0x03,0x20,0x00,0x20,0x00,
 
 	/* Index 94, character 126 "~" (width: 7 pixels) */
-	0x7, 0x60,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x30,0x00
+	0x60,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x30,0x00
+};
+
+// Offset of each bitmap in Verdana8_bitmaps
+const unsigned short Verdana8_offsets[] = 
+{
+	0x0,	// Index 0
+	0x2,	// Index 1
+	0x4,	// Index 2
+	0xA,	// Index 3
+	0x18,	// Index 4
+	0x22,	// Index 5
+	0x36,	// Index 6
+	0x44,	// Index 7
+	0x46,	// Index 8
+	0x4C,	// Index 9
+	0x52,	// Index 10
+	0x5C,	// Index 11
+	0x6A,	// Index 12
+	0x6E,	// Index 13
+	0x74,	// Index 14
+	0x76,	// Index 15
+	0x80,	// Index 16
+	0x8A,	// Index 17
+	0x94,	// Index 18
+	0x9E,	// Index 19
+	0xA8,	// Index 20
+	0xB4,	// Index 21
+	0xBE,	// Index 22
+	0xC8,	// Index 23
+	0xD2,	// Index 24
+	0xDC,	// Index 25
+	0xE6,	// Index 26
+	0xE8,	// Index 27
+	0xEC,	// Index 28
+	0xF8,	// Index 29
+	0x106,	// Index 30
+	0x112,	// Index 31
+	0x11A,	// Index 32
+	0x12A,	// Index 33
+	0x136,	// Index 34
+	0x142,	// Index 35
+	0x150,	// Index 36
+	0x15E,	// Index 37
+	0x168,	// Index 38
+	0x172,	// Index 39
+	0x180,	// Index 40
+	0x18C,	// Index 41
+	0x192,	// Index 42
+	0x19A,	// Index 43
+	0x1A6,	// Index 44
+	0x1B0,	// Index 45
+	0x1BE,	// Index 46
+	0x1CA,	// Index 47
+	0x1D8,	// Index 48
+	0x1E2,	// Index 49
+	0x1F0,	// Index 50
+	0x1FC,	// Index 51
+	0x208,	// Index 52
+	0x216,	// Index 53
+	0x222,	// Index 54
+	0x22E,	// Index 55
+	0x240,	// Index 56
+	0x24C,	// Index 57
+	0x25A,	// Index 58
+	0x266,	// Index 59
+	0x26C,	// Index 60
+	0x276,	// Index 61
+	0x27C,	// Index 62
+	0x28A,	// Index 63
+	0x298,	// Index 64
+	0x29C,	// Index 65
+	0x2A6,	// Index 66
+	0x2B0,	// Index 67
+	0x2BA,	// Index 68
+	0x2C4,	// Index 69
+	0x2CE,	// Index 70
+	0x2D6,	// Index 71
+	0x2E0,	// Index 72
+	0x2EA,	// Index 73
+	0x2EC,	// Index 74
+	0x2F2,	// Index 75
+	0x2FC,	// Index 76
+	0x2FE,	// Index 77
+	0x310,	// Index 78
+	0x31A,	// Index 79
+	0x324,	// Index 80
+	0x32E,	// Index 81
+	0x338,	// Index 82
+	0x340,	// Index 83
+	0x348,	// Index 84
+	0x350,	// Index 85
+	0x35A,	// Index 86
+	0x364,	// Index 87
+	0x372,	// Index 88
+	0x37C,	// Index 89
+	0x386,	// Index 90
+	0x38E,	// Index 91
+	0x398,	// Index 92
+	0x39A,	// Index 93
+	0x3A4,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Verdana8_widths[] = 
+{
+	0x1,	// Index 0
+	0x1,	// Index 1
+	0x3,	// Index 2
+	0x7,	// Index 3
+	0x5,	// Index 4
+	0xA,	// Index 5
+	0x7,	// Index 6
+	0x1,	// Index 7
+	0x3,	// Index 8
+	0x3,	// Index 9
+	0x5,	// Index 10
+	0x7,	// Index 11
+	0x2,	// Index 12
+	0x3,	// Index 13
+	0x1,	// Index 14
+	0x5,	// Index 15
+	0x5,	// Index 16
+	0x5,	// Index 17
+	0x5,	// Index 18
+	0x5,	// Index 19
+	0x6,	// Index 20
+	0x5,	// Index 21
+	0x5,	// Index 22
+	0x5,	// Index 23
+	0x5,	// Index 24
+	0x5,	// Index 25
+	0x1,	// Index 26
+	0x2,	// Index 27
+	0x6,	// Index 28
+	0x7,	// Index 29
+	0x6,	// Index 30
+	0x4,	// Index 31
+	0x8,	// Index 32
+	0x6,	// Index 33
+	0x6,	// Index 34
+	0x7,	// Index 35
+	0x7,	// Index 36
+	0x5,	// Index 37
+	0x5,	// Index 38
+	0x7,	// Index 39
+	0x6,	// Index 40
+	0x3,	// Index 41
+	0x4,	// Index 42
+	0x6,	// Index 43
+	0x5,	// Index 44
+	0x7,	// Index 45
+	0x6,	// Index 46
+	0x7,	// Index 47
+	0x5,	// Index 48
+	0x7,	// Index 49
+	0x6,	// Index 50
+	0x6,	// Index 51
+	0x7,	// Index 52
+	0x6,	// Index 53
+	0x6,	// Index 54
+	0x9,	// Index 55
+	0x6,	// Index 56
+	0x7,	// Index 57
+	0x6,	// Index 58
+	0x3,	// Index 59
+	0x5,	// Index 60
+	0x3,	// Index 61
+	0x7,	// Index 62
+	0x7,	// Index 63
+	0x2,	// Index 64
+	0x5,	// Index 65
+	0x5,	// Index 66
+	0x5,	// Index 67
+	0x5,	// Index 68
+	0x5,	// Index 69
+	0x4,	// Index 70
+	0x5,	// Index 71
+	0x5,	// Index 72
+	0x1,	// Index 73
+	0x3,	// Index 74
+	0x5,	// Index 75
+	0x1,	// Index 76
+	0x9,	// Index 77
+	0x5,	// Index 78
+	0x5,	// Index 79
+	0x5,	// Index 80
+	0x5,	// Index 81
+	0x4,	// Index 82
+	0x4,	// Index 83
+	0x4,	// Index 84
+	0x5,	// Index 85
+	0x5,	// Index 86
+	0x7,	// Index 87
+	0x5,	// Index 88
+	0x5,	// Index 89
+	0x4,	// Index 90
+	0x5,	// Index 91
+	0x1,	// Index 92
+	0x5,	// Index 93
+	0x7,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Verdana8_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x8, 0x0,	// Index 1
+	0x9, 0x0,	// Index 2
+	0x8, 0x0,	// Index 3
+	0x9, 0x2,	// Index 4
+	0x8, 0x0,	// Index 5
+	0x8, 0x0,	// Index 6
+	0x9, 0x0,	// Index 7
+	0x9, 0x2,	// Index 8
+	0x9, 0x2,	// Index 9
+	0x9, 0x0,	// Index 10
+	0x7, 0x0,	// Index 11
+	0x2, 0x2,	// Index 12
+	0x4, 0x0,	// Index 13
+	0x2, 0x0,	// Index 14
+	0x9, 0x1,	// Index 15
+	0x8, 0x0,	// Index 16
+	0x8, 0x0,	// Index 17
+	0x8, 0x0,	// Index 18
+	0x8, 0x0,	// Index 19
+	0x8, 0x0,	// Index 20
+	0x8, 0x0,	// Index 21
+	0x8, 0x0,	// Index 22
+	0x8, 0x0,	// Index 23
+	0x8, 0x0,	// Index 24
+	0x8, 0x0,	// Index 25
+	0x6, 0x0,	// Index 26
+	0x6, 0x2,	// Index 27
+	0x6, 0x0,	// Index 28
+	0x5, 0x0,	// Index 29
+	0x6, 0x0,	// Index 30
+	0x8, 0x0,	// Index 31
+	0x8, 0x1,	// Index 32
+	0x8, 0x0,	// Index 33
+	0x8, 0x0,	// Index 34
+	0x8, 0x0,	// Index 35
+	0x8, 0x0,	// Index 36
+	0x8, 0x0,	// Index 37
+	0x8, 0x0,	// Index 38
+	0x8, 0x0,	// Index 39
+	0x8, 0x0,	// Index 40
+	0x8, 0x0,	// Index 41
+	0x8, 0x0,	// Index 42
+	0x8, 0x0,	// Index 43
+	0x8, 0x0,	// Index 44
+	0x8, 0x0,	// Index 45
+	0x8, 0x0,	// Index 46
+	0x8, 0x0,	// Index 47
+	0x8, 0x0,	// Index 48
+	0x8, 0x2,	// Index 49
+	0x8, 0x0,	// Index 50
+	0x8, 0x0,	// Index 51
+	0x8, 0x0,	// Index 52
+	0x8, 0x0,	// Index 53
+	0x8, 0x0,	// Index 54
+	0x8, 0x0,	// Index 55
+	0x8, 0x0,	// Index 56
+	0x8, 0x0,	// Index 57
+	0x8, 0x0,	// Index 58
+	0x9, 0x2,	// Index 59
+	0x9, 0x1,	// Index 60
+	0x9, 0x2,	// Index 61
+	0x8, 0x0,	// Index 62
+	0x0, 0x2,	// Index 63
+	0x9, 0x0,	// Index 64
+	0x6, 0x0,	// Index 65
+	0x9, 0x0,	// Index 66
+	0x6, 0x0,	// Index 67
+	0x9, 0x0,	// Index 68
+	0x6, 0x0,	// Index 69
+	0x9, 0x0,	// Index 70
+	0x6, 0x2,	// Index 71
+	0x9, 0x0,	// Index 72
+	0x9, 0x0,	// Index 73
+	0x9, 0x2,	// Index 74
+	0x9, 0x0,	// Index 75
+	0x9, 0x0,	// Index 76
+	0x6, 0x0,	// Index 77
+	0x6, 0x0,	// Index 78
+	0x6, 0x0,	// Index 79
+	0x6, 0x2,	// Index 80
+	0x6, 0x2,	// Index 81
+	0x6, 0x0,	// Index 82
+	0x6, 0x0,	// Index 83
+	0x8, 0x0,	// Index 84
+	0x6, 0x0,	// Index 85
+	0x6, 0x0,	// Index 86
+	0x6, 0x0,	// Index 87
+	0x6, 0x0,	// Index 88
+	0x6, 0x2,	// Index 89
+	0x6, 0x0,	// Index 90
+	0x9, 0x2,	// Index 91
+	0x9, 0x2,	// Index 92
+	0x9, 0x2,	// Index 93
+	0x5, 0x0,	// Index 94
+};
+
+const font_t Verdana8 = 
+{
+	Verdana8_bitmaps,
+	Verdana8_offsets,
+	Verdana8_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0xB,	// Height 
+	0,	// Flags 
+	Verdana8_extents,
+	0x9	// Ascent 
 };
+
 //---------------------------------------------------------------
 // Group Name: Verdana10
 // Designer: Imported System Font
@@ -425,398 +636,607 @@ const unsigned char Verdana8[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Verdana10[] = 
+const unsigned char Verdana10_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0xD,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xC8, // Index 1 (offset: 200)
-	0x0, 0xCB, // Index 2 (offset: 203)
-	0x0, 0xD2, // Index 3 (offset: 210)
-	0x0, 0xE3, // Index 4 (offset: 227)
-	0x0, 0xF0, // Index 5 (offset: 240)
-	0x1, 0x7, // Index 6 (offset: 263)
-	0x1, 0x18, // Index 7 (offset: 280)
-	0x1, 0x1B, // Index 8 (offset: 283)
-	0x1, 0x24, // Index 9 (offset: 292)
-	0x1, 0x2D, // Index 10 (offset: 301)
-	0x1, 0x38, // Index 11 (offset: 312)
-	0x1, 0x47, // Index 12 (offset: 327)
-	0x1, 0x4C, // Index 13 (offset: 332)
-	0x1, 0x57, // Index 14 (offset: 343)
-	0x1, 0x5A, // Index 15 (offset: 346)
-	0x1, 0x67, // Index 16 (offset: 359)
-	0x1, 0x74, // Index 17 (offset: 372)
-	0x1, 0x7F, // Index 18 (offset: 383)
-	0x1, 0x8C, // Index 19 (offset: 396)
-	0x1, 0x99, // Index 20 (offset: 409)
-	0x1, 0xA8, // Index 21 (offset: 424)
-	0x1, 0xB5, // Index 22 (offset: 437)
-	0x1, 0xC2, // Index 23 (offset: 450)
-	0x1, 0xCF, // Index 24 (offset: 463)
-	0x1, 0xDC, // Index 25 (offset: 476)
-	0x1, 0xE9, // Index 26 (offset: 489)
-	0x1, 0xEC, // Index 27 (offset: 492)
-	0x1, 0xF1, // Index 28 (offset: 497)
-	0x2, 0x0, // Index 29 (offset: 512)
-	0x2, 0xF, // Index 30 (offset: 527)
-	0x2, 0x1E, // Index 31 (offset: 542)
-	0x2, 0x29, // Index 32 (offset: 553)
-	0x2, 0x40, // Index 33 (offset: 576)
-	0x2, 0x4F, // Index 34 (offset: 591)
-	0x2, 0x5C, // Index 35 (offset: 604)
-	0x2, 0x6B, // Index 36 (offset: 619)
-	0x2, 0x7A, // Index 37 (offset: 634)
-	0x2, 0x87, // Index 38 (offset: 647)
-	0x2, 0x94, // Index 39 (offset: 660)
-	0x2, 0xA3, // Index 40 (offset: 675)
-	0x2, 0xB2, // Index 41 (offset: 690)
-	0x2, 0xB9, // Index 42 (offset: 697)
-	0x2, 0xC4, // Index 43 (offset: 708)
-	0x2, 0xD1, // Index 44 (offset: 721)
-	0x2, 0xDE, // Index 45 (offset: 734)
-	0x2, 0xF1, // Index 46 (offset: 753)
-	0x3, 0x0, // Index 47 (offset: 768)
-	0x3, 0x11, // Index 48 (offset: 785)
-	0x3, 0x1E, // Index 49 (offset: 798)
-	0x3, 0x2F, // Index 50 (offset: 815)
-	0x3, 0x3E, // Index 51 (offset: 830)
-	0x3, 0x4D, // Index 52 (offset: 845)
-	0x3, 0x5C, // Index 53 (offset: 860)
-	0x3, 0x6B, // Index 54 (offset: 875)
-	0x3, 0x7A, // Index 55 (offset: 890)
-	0x3, 0x91, // Index 56 (offset: 913)
-	0x3, 0xA0, // Index 57 (offset: 928)
-	0x3, 0xAF, // Index 58 (offset: 943)
-	0x3, 0xBE, // Index 59 (offset: 958)
-	0x3, 0xC5, // Index 60 (offset: 965)
-	0x3, 0xD2, // Index 61 (offset: 978)
-	0x3, 0xD9, // Index 62 (offset: 985)
-	0x3, 0xEC, // Index 63 (offset: 1004)
-	0x3, 0xFD, // Index 64 (offset: 1021)
-	0x4, 0x2, // Index 65 (offset: 1026)
-	0x4, 0xF, // Index 66 (offset: 1039)
-	0x4, 0x1C, // Index 67 (offset: 1052)
-	0x4, 0x29, // Index 68 (offset: 1065)
-	0x4, 0x36, // Index 69 (offset: 1078)
-	0x4, 0x43, // Index 70 (offset: 1091)
-	0x4, 0x4E, // Index 71 (offset: 1102)
-	0x4, 0x5B, // Index 72 (offset: 1115)
-	0x4, 0x68, // Index 73 (offset: 1128)
-	0x4, 0x6B, // Index 74 (offset: 1131)
-	0x4, 0x74, // Index 75 (offset: 1140)
-	0x4, 0x7F, // Index 76 (offset: 1151)
-	0x4, 0x82, // Index 77 (offset: 1154)
-	0x4, 0x95, // Index 78 (offset: 1173)
-	0x4, 0xA2, // Index 79 (offset: 1186)
-	0x4, 0xAF, // Index 80 (offset: 1199)
-	0x4, 0xBC, // Index 81 (offset: 1212)
-	0x4, 0xC9, // Index 82 (offset: 1225)
-	0x4, 0xD2, // Index 83 (offset: 1234)
-	0x4, 0xDD, // Index 84 (offset: 1245)
-	0x4, 0xE6, // Index 85 (offset: 1254)
-	0x4, 0xF3, // Index 86 (offset: 1267)
-	0x5, 0x0, // Index 87 (offset: 1280)
-	0x5, 0x13, // Index 88 (offset: 1299)
-	0x5, 0x1E, // Index 89 (offset: 1310)
-	0x5, 0x2B, // Index 90 (offset: 1323)
-	0x5, 0x36, // Index 91 (offset: 1334)
-	0x5, 0x41, // Index 92 (offset: 1345)
-	0x5, 0x44, // Index 93 (offset: 1348)
-	0x5, 0x4F, // Index 94 (offset: 1359)
-
 	/* Index 0, character 32 " " (width: 2 pixels) */
-	0x2, 0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 1 pixels) */
-	0x1, 0x7E,0x03,
+	0x7E,0x03,
 
 	/* Index 2, character 34 """ (width: 3 pixels) */
-	0x3, 0x0F,0x00,0x00,0x00,0x0F,0x00,
+	0x0F,0x00,0x00,0x00,0x0F,0x00,
 
 	/* Index 3, character 35 "#" (width: 8 pixels) */
-	0x8, 0x40,0x00,0xC8,0x01,0x78,0x00,0x4E,0x00,0xC8,0x01,0x78,0x00,0x4E,0x00,0x08,0x00,
+	0x40,0x00,0xC8,0x01,0x78,0x00,0x4E,0x00,0xC8,0x01,0x78,0x00,0x4E,0x00,0x08,0x00,
 
 	/* Index 4, character 36 "$" (width: 6 pixels) */
-	0x6, 0x18,0x02,0x24,0x02,0xFF,0x0F,0x44,0x02,0x44,0x02,0x84,0x01,
+	0x18,0x02,0x24,0x02,0xFF,0x0F,0x44,0x02,0x44,0x02,0x84,0x01,
 
 	/* Index 5, character 37 "%" (width: 11 pixels) */
-	0xB, 0x1C,0x00,0x22,0x00,0x22,0x02,0x22,0x01,0xDC,0x00,0x20,0x00,0xD8,0x01,0x24,0x02,0x22,0x02,0x20,0x02,0xC0,0x01,
+	0x1C,0x00,0x22,0x00,0x22,0x02,0x22,0x01,0xDC,0x00,0x20,0x00,0xD8,0x01,0x24,0x02,0x22,0x02,0x20,0x02,0xC0,0x01,
 
 	/* Index 6, character 38 "&" (width: 8 pixels) */
-	0x8, 0xDC,0x01,0x22,0x02,0x22,0x02,0x22,0x02,0x5C,0x01,0x80,0x01,0x40,0x02,0x20,0x02,
+	0xDC,0x01,0x22,0x02,0x22,0x02,0x22,0x02,0x5C,0x01,0x80,0x01,0x40,0x02,0x20,0x02,
 
 	/* Index 7, character 39 "'" (width: 1 pixels) */
-	0x1, 0x0F,0x00,
+	0x0F,0x00,
 
 	/* Index 8, character 40 "(" (width: 4 pixels) */
-	0x4, 0xF0,0x01,0x0C,0x06,0x02,0x08,0x01,0x10,
+	0xF0,0x01,0x0C,0x06,0x02,0x08,0x01,0x10,
 
 	/* Index 9, character 41 ")" (width: 4 pixels) */
-	0x4, 0x01,0x10,0x02,0x08,0x0C,0x06,0xF0,0x01,
+	0x01,0x10,0x02,0x08,0x0C,0x06,0xF0,0x01,
 
 	/* Index 10, character 42 "*" (width: 5 pixels) */
-	0x5, 0x0A,0x00,0x04,0x00,0x1F,0x00,0x04,0x00,0x0A,0x00,
+	0x0A,0x00,0x04,0x00,0x1F,0x00,0x04,0x00,0x0A,0x00,
 
 	/* Index 11, character 43 "+" (width: 7 pixels) */
-	0x7, 0x20,0x00,0x20,0x00,0x20,0x00,0xFC,0x01,0x20,0x00,0x20,0x00,0x20,0x00,
+	0x20,0x00,0x20,0x00,0x20,0x00,0xFC,0x01,0x20,0x00,0x20,0x00,0x20,0x00,
 
 	/* Index 12, character 44 "," (width: 2 pixels) */
-	0x2, 0x00,0x08,0x00,0x07,
+	0x00,0x08,0x00,0x07,
 
 	/* Index 13, character 45 "-" (width: 5 pixels) */
-	0x5, 0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
+	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
 
 	/* Index 14, character 46 "." (width: 1 pixels) */
-	0x1, 0x00,0x03,
+	0x00,0x03,
 
 	/* Index 15, character 47 "/" (width: 6 pixels) */
-	0x6, 0x00,0x0C,0x00,0x03,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,
+	0x00,0x0C,0x00,0x03,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,
 
 	/* Index 16, character 48 "0" (width: 6 pixels) */
-	0x6, 0xFC,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0xFC,0x01,
+	0xFC,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0xFC,0x01,
 
 	/* Index 17, character 49 "1" (width: 5 pixels) */
-	0x5, 0x04,0x02,0x04,0x02,0xFE,0x03,0x00,0x02,0x00,0x02,
+	0x04,0x02,0x04,0x02,0xFE,0x03,0x00,0x02,0x00,0x02,
 
 	/* Index 18, character 50 "2" (width: 6 pixels) */
-	0x6, 0x0C,0x03,0x82,0x02,0x42,0x02,0x42,0x02,0x22,0x02,0x1C,0x02,
+	0x0C,0x03,0x82,0x02,0x42,0x02,0x42,0x02,0x22,0x02,0x1C,0x02,
 
 	/* Index 19, character 51 "3" (width: 6 pixels) */
-	0x6, 0x04,0x01,0x02,0x02,0x22,0x02,0x22,0x02,0x22,0x02,0xDC,0x01,
+	0x04,0x01,0x02,0x02,0x22,0x02,0x22,0x02,0x22,0x02,0xDC,0x01,
 
 	/* Index 20, character 52 "4" (width: 7 pixels) */
-	0x7, 0x60,0x00,0x50,0x00,0x48,0x00,0x44,0x00,0xFE,0x03,0x40,0x00,0x40,0x00,
+	0x60,0x00,0x50,0x00,0x48,0x00,0x44,0x00,0xFE,0x03,0x40,0x00,0x40,0x00,
 
 	/* Index 21, character 53 "5" (width: 6 pixels) */
-	0x6, 0x00,0x01,0x3E,0x02,0x22,0x02,0x22,0x02,0x22,0x02,0xC2,0x01,
+	0x00,0x01,0x3E,0x02,0x22,0x02,0x22,0x02,0x22,0x02,0xC2,0x01,
 
 	/* Index 22, character 54 "6" (width: 6 pixels) */
-	0x6, 0xF8,0x01,0x14,0x02,0x12,0x02,0x12,0x02,0x12,0x02,0xE0,0x01,
+	0xF8,0x01,0x14,0x02,0x12,0x02,0x12,0x02,0x12,0x02,0xE0,0x01,
 
 	/* Index 23, character 55 "7" (width: 6 pixels) */
-	0x6, 0x02,0x00,0x02,0x00,0x82,0x03,0x62,0x00,0x1A,0x00,0x06,0x00,
+	0x02,0x00,0x02,0x00,0x82,0x03,0x62,0x00,0x1A,0x00,0x06,0x00,
 
 	/* Index 24, character 56 "8" (width: 6 pixels) */
-	0x6, 0xDC,0x01,0x22,0x02,0x22,0x02,0x22,0x02,0x22,0x02,0xDC,0x01,
+	0xDC,0x01,0x22,0x02,0x22,0x02,0x22,0x02,0x22,0x02,0xDC,0x01,
 
 	/* Index 25, character 57 "9" (width: 6 pixels) */
-	0x6, 0x3C,0x00,0x42,0x02,0x42,0x02,0x42,0x02,0x42,0x01,0xFC,0x00,
+	0x3C,0x00,0x42,0x02,0x42,0x02,0x42,0x02,0x42,0x01,0xFC,0x00,
 
 	/* Index 26, character 58 ":" (width: 1 pixels) */
-	0x1, 0x18,0x03,
+	0x18,0x03,
 
 	/* Index 27, character 59 ";" (width: 2 pixels) */
-	0x2, 0x00,0x08,0x18,0x07,
+	0x00,0x08,0x18,0x07,
 
 	/* Index 28, character 60 "<" (width: 7 pixels) */
-	0x7, 0x40,0x00,0xA0,0x00,0xA0,0x00,0x10,0x01,0x10,0x01,0x08,0x02,0x08,0x02,
+	0x40,0x00,0xA0,0x00,0xA0,0x00,0x10,0x01,0x10,0x01,0x08,0x02,0x08,0x02,
 
 	/* Index 29, character 61 "=" (width: 7 pixels) */
-	0x7, 0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,
+	0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,
 
 	/* Index 30, character 62 ">" (width: 7 pixels) */
-	0x7, 0x08,0x02,0x08,0x02,0x10,0x01,0x10,0x01,0xA0,0x00,0xA0,0x00,0x40,0x00,
+	0x08,0x02,0x08,0x02,0x10,0x01,0x10,0x01,0xA0,0x00,0xA0,0x00,0x40,0x00,
 
 	/* Index 31, character 63 "?" (width: 5 pixels) */
-	0x5, 0x04,0x00,0x02,0x00,0x62,0x03,0x12,0x00,0x0C,0x00,
+	0x04,0x00,0x02,0x00,0x62,0x03,0x12,0x00,0x0C,0x00,
 
 	/* Index 32, character 64 "@" (width: 11 pixels) */
-	0xB, 0xF0,0x01,0x08,0x02,0x04,0x04,0xF2,0x09,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0xFA,0x0B,0x04,0x02,0x08,0x02,0xF0,0x01,
+	0xF0,0x01,0x08,0x02,0x04,0x04,0xF2,0x09,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0xFA,0x0B,0x04,0x02,0x08,0x02,0xF0,0x01,
 
 	/* Index 33, character 65 "A" (width: 7 pixels) */
-	0x7, 0x00,0x03,0xE0,0x00,0x98,0x00,0x86,0x00,0x98,0x00,0xE0,0x00,0x00,0x03,
+	0x00,0x03,0xE0,0x00,0x98,0x00,0x86,0x00,0x98,0x00,0xE0,0x00,0x00,0x03,
 
 	/* Index 34, character 66 "B" (width: 6 pixels) */
-	0x6, 0xFE,0x03,0x22,0x02,0x22,0x02,0x22,0x02,0x3C,0x02,0xC0,0x01,
+	0xFE,0x03,0x22,0x02,0x22,0x02,0x22,0x02,0x3C,0x02,0xC0,0x01,
 
 	/* Index 35, character 67 "C" (width: 7 pixels) */
-	0x7, 0xF8,0x00,0x04,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x04,0x01,
+	0xF8,0x00,0x04,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x04,0x01,
 
 	/* Index 36, character 68 "D" (width: 7 pixels) */
-	0x7, 0xFE,0x03,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x04,0x01,0xF8,0x00,
+	0xFE,0x03,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x04,0x01,0xF8,0x00,
 
 	/* Index 37, character 69 "E" (width: 6 pixels) */
-	0x6, 0xFE,0x03,0x22,0x02,0x22,0x02,0x22,0x02,0x22,0x02,0x22,0x02,
+	0xFE,0x03,0x22,0x02,0x22,0x02,0x22,0x02,0x22,0x02,0x22,0x02,
 
 	/* Index 38, character 70 "F" (width: 6 pixels) */
-	0x6, 0xFE,0x03,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x02,0x00,
+	0xFE,0x03,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x02,0x00,
 
 	/* Index 39, character 71 "G" (width: 7 pixels) */
-	0x7, 0xF8,0x00,0x04,0x01,0x02,0x02,0x02,0x02,0x42,0x02,0x42,0x02,0xC4,0x03,
+	0xF8,0x00,0x04,0x01,0x02,0x02,0x02,0x02,0x42,0x02,0x42,0x02,0xC4,0x03,
 
 	/* Index 40, character 72 "H" (width: 7 pixels) */
-	0x7, 0xFE,0x03,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xFE,0x03,
+	0xFE,0x03,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xFE,0x03,
 
 	/* Index 41, character 73 "I" (width: 3 pixels) */
-	0x3, 0x02,0x02,0xFE,0x03,0x02,0x02,
+	0x02,0x02,0xFE,0x03,0x02,0x02,
 
 	/* Index 42, character 74 "J" (width: 5 pixels) */
-	0x5, 0x00,0x02,0x00,0x02,0x02,0x02,0x02,0x02,0xFE,0x01,
+	0x00,0x02,0x00,0x02,0x02,0x02,0x02,0x02,0xFE,0x01,
 
 	/* Index 43, character 75 "K" (width: 6 pixels) */
-	0x6, 0xFE,0x03,0x20,0x00,0x50,0x00,0x88,0x00,0x04,0x01,0x02,0x02,
+	0xFE,0x03,0x20,0x00,0x50,0x00,0x88,0x00,0x04,0x01,0x02,0x02,
 
 	/* Index 44, character 76 "L" (width: 6 pixels) */
-	0x6, 0xFE,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,
+	0xFE,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,
 
 	/* Index 45, character 77 "M" (width: 9 pixels) */
-	0x9, 0xFE,0x03,0x06,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0x60,0x00,0x18,0x00,0x06,0x00,0xFE,0x03,
+	0xFE,0x03,0x06,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0x60,0x00,0x18,0x00,0x06,0x00,0xFE,0x03,
 
 	/* Index 46, character 78 "N" (width: 7 pixels) */
-	0x7, 0xFE,0x03,0x06,0x00,0x18,0x00,0x20,0x00,0xC0,0x00,0x00,0x03,0xFE,0x03,
+	0xFE,0x03,0x06,0x00,0x18,0x00,0x20,0x00,0xC0,0x00,0x00,0x03,0xFE,0x03,
 
 	/* Index 47, character 79 "O" (width: 8 pixels) */
-	0x8, 0xF8,0x00,0x04,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x04,0x01,0xF8,0x00,
+	0xF8,0x00,0x04,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x04,0x01,0xF8,0x00,
 
 	/* Index 48, character 80 "P" (width: 6 pixels) */
-	0x6, 0xFE,0x03,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x3C,0x00,
+	0xFE,0x03,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x3C,0x00,
 
 	/* Index 49, character 81 "Q" (width: 8 pixels) */
-	0x8, 0xF8,0x00,0x04,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x06,0x04,0x09,0xF8,0x08,
+	0xF8,0x00,0x04,0x01,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x06,0x04,0x09,0xF8,0x08,
 
 	/* Index 50, character 82 "R" (width: 7 pixels) */
-	0x7, 0xFE,0x03,0x42,0x00,0x42,0x00,0x42,0x00,0xA2,0x00,0x1C,0x01,0x00,0x02,
+	0xFE,0x03,0x42,0x00,0x42,0x00,0x42,0x00,0xA2,0x00,0x1C,0x01,0x00,0x02,
 
 	/* Index 51, character 83 "S" (width: 7 pixels) */
-	0x7, 0x1C,0x01,0x22,0x02,0x22,0x02,0x22,0x02,0x22,0x02,0x22,0x02,0xC4,0x01,
+	0x1C,0x01,0x22,0x02,0x22,0x02,0x22,0x02,0x22,0x02,0x22,0x02,0xC4,0x01,
 
 	/* Index 52, character 84 "T" (width: 7 pixels) */
-	0x7, 0x02,0x00,0x02,0x00,0x02,0x00,0xFE,0x03,0x02,0x00,0x02,0x00,0x02,0x00,
+	0x02,0x00,0x02,0x00,0x02,0x00,0xFE,0x03,0x02,0x00,0x02,0x00,0x02,0x00,
 
 	/* Index 53, character 85 "U" (width: 7 pixels) */
-	0x7, 0xFE,0x00,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x01,0xFE,0x00,
+	0xFE,0x00,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x01,0xFE,0x00,
 
 	/* Index 54, character 86 "V" (width: 7 pixels) */
-	0x7, 0x0E,0x00,0x30,0x00,0xC0,0x00,0x00,0x03,0xC0,0x00,0x30,0x00,0x0E,0x00,
+	0x0E,0x00,0x30,0x00,0xC0,0x00,0x00,0x03,0xC0,0x00,0x30,0x00,0x0E,0x00,
 
 	/* Index 55, character 87 "W" (width: 11 pixels) */
-	0xB, 0x1E,0x00,0xE0,0x00,0x00,0x03,0xC0,0x00,0x38,0x00,0x06,0x00,0x38,0x00,0xC0,0x00,0x00,0x03,0xE0,0x00,0x1E,0x00,
+	0x1E,0x00,0xE0,0x00,0x00,0x03,0xC0,0x00,0x38,0x00,0x06,0x00,0x38,0x00,0xC0,0x00,0x00,0x03,0xE0,0x00,0x1E,0x00,
 
 	/* Index 56, character 88 "X" (width: 7 pixels) */
-	0x7, 0x06,0x03,0x88,0x00,0x50,0x00,0x20,0x00,0x50,0x00,0x88,0x00,0x06,0x03,
+	0x06,0x03,0x88,0x00,0x50,0x00,0x20,0x00,0x50,0x00,0x88,0x00,0x06,0x03,
 
 	/* Index 57, character 89 "Y" (width: 7 pixels) */
-	0x7, 0x02,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x30,0x00,0x0C,0x00,0x02,0x00,
+	0x02,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x30,0x00,0x0C,0x00,0x02,0x00,
 
 	/* Index 58, character 90 "Z" (width: 7 pixels) */
-	0x7, 0x02,0x03,0x82,0x02,0x42,0x02,0x22,0x02,0x12,0x02,0x0A,0x02,0x06,0x02,
+	0x02,0x03,0x82,0x02,0x42,0x02,0x22,0x02,0x12,0x02,0x0A,0x02,0x06,0x02,
 
 	/* Index 59, character 91 "[" (width: 3 pixels) */
-	0x3, 0xFF,0x0F,0x01,0x08,0x01,0x08,
+	0xFF,0x0F,0x01,0x08,0x01,0x08,
 
 	/* Index 60, character 92 "\" (width: 6 pixels) */
-	0x6, 0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x00,0x00,0x03,0x00,0x0C,
+	0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x00,0x00,0x03,0x00,0x0C,
 
 	/* Index 61, character 93 "]" (width: 3 pixels) */
-	0x3, 0x01,0x08,0x01,0x08,0xFF,0x0F,
+	0x01,0x08,0x01,0x08,0xFF,0x0F,
 
 	/* Index 62, character 94 "^" (width: 9 pixels) */
-	0x9, 0x20,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x20,0x00,
+	0x20,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x20,0x00,
 
 	/* Index 63, character 95 "_" (width: 8 pixels) */
-	0x8, 0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,
+	0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,
 
 	/* Index 64, character 96 "`" (width: 2 pixels) */
-	0x2, 0x01,0x00,0x02,0x00,
+	0x01,0x00,0x02,0x00,
 
 	/* Index 65, character 97 "a" (width: 6 pixels) */
-	0x6, 0x80,0x01,0x48,0x02,0x48,0x02,0x48,0x02,0x48,0x02,0xF0,0x03,
+	0x80,0x01,0x48,0x02,0x48,0x02,0x48,0x02,0x48,0x02,0xF0,0x03,
 
 	/* Index 66, character 98 "b" (width: 6 pixels) */
-	0x6, 0xFF,0x03,0x10,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0xF0,0x01,
+	0xFF,0x03,0x10,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0xF0,0x01,
 
 	/* Index 67, character 99 "c" (width: 6 pixels) */
-	0x6, 0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x10,0x01,
+	0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x10,0x01,
 
 	/* Index 68, character 100 "d" (width: 6 pixels) */
-	0x6, 0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x01,0xFF,0x03,
+	0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x01,0xFF,0x03,
 
 	/* Index 69, character 101 "e" (width: 6 pixels) */
-	0x6, 0xF0,0x01,0x48,0x02,0x48,0x02,0x48,0x02,0x48,0x02,0x70,0x01,
+	0xF0,0x01,0x48,0x02,0x48,0x02,0x48,0x02,0x48,0x02,0x70,0x01,
 
 	/* Index 70, character 102 "f" (width: 5 pixels) */
-	0x5, 0x08,0x00,0xFE,0x03,0x09,0x00,0x09,0x00,0x01,0x00,
+	0x08,0x00,0xFE,0x03,0x09,0x00,0x09,0x00,0x01,0x00,
 
 	/* Index 71, character 103 "g" (width: 6 pixels) */
-	0x6, 0xF0,0x01,0x08,0x12,0x08,0x12,0x08,0x12,0x08,0x11,0xF8,0x0F,
+	0xF0,0x01,0x08,0x12,0x08,0x12,0x08,0x12,0x08,0x11,0xF8,0x0F,
 
 	/* Index 72, character 104 "h" (width: 6 pixels) */
-	0x6, 0xFF,0x03,0x10,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x03,
+	0xFF,0x03,0x10,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x03,
 
 	/* Index 73, character 105 "i" (width: 1 pixels) */
-	0x1, 0xF9,0x03,
+	0xF9,0x03,
 
 	/* Index 74, character 106 "j" (width: 4 pixels) */
-	0x4, 0x00,0x10,0x00,0x10,0x08,0x10,0xF9,0x0F,
+	0x00,0x10,0x00,0x10,0x08,0x10,0xF9,0x0F,
 
 	/* Index 75, character 107 "k" (width: 5 pixels) */
-	0x5, 0xFF,0x03,0x40,0x00,0xA0,0x00,0x10,0x01,0x08,0x02,
+	0xFF,0x03,0x40,0x00,0xA0,0x00,0x10,0x01,0x08,0x02,
 
 	/* Index 76, character 108 "l" (width: 1 pixels) */
-	0x1, 0xFF,0x03,
+	0xFF,0x03,
 
 	/* Index 77, character 109 "m" (width: 9 pixels) */
-	0x9, 0xF8,0x03,0x10,0x00,0x08,0x00,0x08,0x00,0xF0,0x03,0x10,0x00,0x08,0x00,0x08,0x00,0xF0,0x03,
+	0xF8,0x03,0x10,0x00,0x08,0x00,0x08,0x00,0xF0,0x03,0x10,0x00,0x08,0x00,0x08,0x00,0xF0,0x03,
 
 	/* Index 78, character 110 "n" (width: 6 pixels) */
-	0x6, 0xF8,0x03,0x10,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x03,
+	0xF8,0x03,0x10,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0xF0,0x03,
 
 	/* Index 79, character 111 "o" (width: 6 pixels) */
-	0x6, 0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0xF0,0x01,
+	0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0xF0,0x01,
 
 	/* Index 80, character 112 "p" (width: 6 pixels) */
-	0x6, 0xF8,0x1F,0x10,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0xF0,0x01,
+	0xF8,0x1F,0x10,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0xF0,0x01,
 
 	/* Index 81, character 113 "q" (width: 6 pixels) */
-	0x6, 0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x01,0xF8,0x1F,
+	0xF0,0x01,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x01,0xF8,0x1F,
 
 	/* Index 82, character 114 "r" (width: 4 pixels) */
-	0x4, 0xF8,0x03,0x10,0x00,0x08,0x00,0x08,0x00,
+	0xF8,0x03,0x10,0x00,0x08,0x00,0x08,0x00,
 
 	/* Index 83, character 115 "s" (width: 5 pixels) */
-	0x5, 0x30,0x02,0x48,0x02,0x48,0x02,0x48,0x02,0x88,0x01,
+	0x30,0x02,0x48,0x02,0x48,0x02,0x48,0x02,0x88,0x01,
 
 	/* Index 84, character 116 "t" (width: 4 pixels) */
-	0x4, 0x08,0x00,0xFE,0x01,0x08,0x02,0x08,0x02,
+	0x08,0x00,0xFE,0x01,0x08,0x02,0x08,0x02,
 
 	/* Index 85, character 117 "u" (width: 6 pixels) */
-	0x6, 0xF8,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x01,0xF8,0x03,
+	0xF8,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x01,0xF8,0x03,
 
 	/* Index 86, character 118 "v" (width: 6 pixels) */
-	0x6, 0x18,0x00,0xE0,0x00,0x00,0x03,0x00,0x03,0xE0,0x00,0x18,0x00,
+	0x18,0x00,0xE0,0x00,0x00,0x03,0x00,0x03,0xE0,0x00,0x18,0x00,
 
 	/* Index 87, character 119 "w" (width: 9 pixels) */
-	0x9, 0x18,0x00,0xE0,0x00,0x00,0x03,0xE0,0x00,0x18,0x00,0xE0,0x00,0x00,0x03,0xE0,0x00,0x18,0x00,
+	0x18,0x00,0xE0,0x00,0x00,0x03,0xE0,0x00,0x18,0x00,0xE0,0x00,0x00,0x03,0xE0,0x00,0x18,0x00,
 
 	/* Index 88, character 120 "x" (width: 5 pixels) */
-	0x5, 0x18,0x03,0xA0,0x00,0x40,0x00,0xA0,0x00,0x18,0x03,
+	0x18,0x03,0xA0,0x00,0x40,0x00,0xA0,0x00,0x18,0x03,
 
 	/* Index 89, character 121 "y" (width: 6 pixels) */
-	0x6, 0x18,0x00,0xE0,0x10,0x00,0x0F,0x00,0x03,0xE0,0x00,0x18,0x00,
+	0x18,0x00,0xE0,0x10,0x00,0x0F,0x00,0x03,0xE0,0x00,0x18,0x00,
 
 	/* Index 90, character 122 "z" (width: 5 pixels) */
-	0x5, 0x08,0x03,0x88,0x02,0x48,0x02,0x28,0x02,0x18,0x02,
+	0x08,0x03,0x88,0x02,0x48,0x02,0x28,0x02,0x18,0x02,
 
 	/* Index 91, character 123 "{" (width: 5 pixels) */
-	0x5, 0x20,0x00,0x20,0x00,0xDE,0x07,0x01,0x08,0x01,0x08,
+	0x20,0x00,0x20,0x00,0xDE,0x07,0x01,0x08,0x01,0x08,
 
 	/* Index 92, character 124 "|" (width: 1 pixels) */
-	0x1, 0xFF,0x0F,
+	0xFF,0x0F,
 
 	/* Index 93, character 125 "}" (width: 5 pixels) */
-	0x5, 0x01,0x08,0x01,0x08,0xDE,0x07,0x20,0x00,0x20,0x00,
+	0x01,0x08,0x01,0x08,0xDE,0x07,0x20,0x00,0x20,0x00,
 
 	/* Index 94, character 126 "~" (width: 8 pixels) */
-	0x8, 0x60,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x30,0x00
+	0x60,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x30,0x00
+};
+
+// Offset of each bitmap in Verdana10_bitmaps
+const unsigned short Verdana10_offsets[] = 
+{
+	0x0,	// Index 0
+	0x4,	// Index 1
+	0x6,	// Index 2
+	0xC,	// Index 3
+	0x1C,	// Index 4
+	0x28,	// Index 5
+	0x3E,	// Index 6
+	0x4E,	// Index 7
+	0x50,	// Index 8
+	0x58,	// Index 9
+	0x60,	// Index 10
+	0x6A,	// Index 11
+	0x78,	// Index 12
+	0x7C,	// Index 13
+	0x86,	// Index 14
+	0x88,	// Index 15
+	0x94,	// Index 16
+	0xA0,	// Index 17
+	0xAA,	// Index 18
+	0xB6,	// Index 19
+	0xC2,	// Index 20
+	0xD0,	// Index 21
+	0xDC,	// Index 22
+	0xE8,	// Index 23
+	0xF4,	// Index 24
+	0x100,	// Index 25
+	0x10C,	// Index 26
+	0x10E,	// Index 27
+	0x112,	// Index 28
+	0x120,	// Index 29
+	0x12E,	// Index 30
+	0x13C,	// Index 31
+	0x146,	// Index 32
+	0x15C,	// Index 33
+	0x16A,	// Index 34
+	0x176,	// Index 35
+	0x184,	// Index 36
+	0x192,	// Index 37
+	0x19E,	// Index 38
+	0x1AA,	// Index 39
+	0x1B8,	// Index 40
+	0x1C6,	// Index 41
+	0x1CC,	// Index 42
+	0x1D6,	// Index 43
+	0x1E2,	// Index 44
+	0x1EE,	// Index 45
+	0x200,	// Index 46
+	0x20E,	// Index 47
+	0x21E,	// Index 48
+	0x22A,	// Index 49
+	0x23A,	// Index 50
+	0x248,	// Index 51
+	0x256,	// Index 52
+	0x264,	// Index 53
+	0x272,	// Index 54
+	0x280,	// Index 55
+	0x296,	// Index 56
+	0x2A4,	// Index 57
+	0x2B2,	// Index 58
+	0x2C0,	// Index 59
+	0x2C6,	// Index 60
+	0x2D2,	// Index 61
+	0x2D8,	// Index 62
+	0x2EA,	// Index 63
+	0x2FA,	// Index 64
+	0x2FE,	// Index 65
+	0x30A,	// Index 66
+	0x316,	// Index 67
+	0x322,	// Index 68
+	0x32E,	// Index 69
+	0x33A,	// Index 70
+	0x344,	// Index 71
+	0x350,	// Index 72
+	0x35C,	// Index 73
+	0x35E,	// Index 74
+	0x366,	// Index 75
+	0x370,	// Index 76
+	0x372,	// Index 77
+	0x384,	// Index 78
+	0x390,	// Index 79
+	0x39C,	// Index 80
+	0x3A8,	// Index 81
+	0x3B4,	// Index 82
+	0x3BC,	// Index 83
+	0x3C6,	// Index 84
+	0x3CE,	// Index 85
+	0x3DA,	// Index 86
+	0x3E6,	// Index 87
+	0x3F8,	// Index 88
+	0x402,	// Index 89
+	0x40E,	// Index 90
+	0x418,	// Index 91
+	0x422,	// Index 92
+	0x424,	// Index 93
+	0x42E,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Verdana10_widths[] = 
+{
+	0x2,	// Index 0
+	0x1,	// Index 1
+	0x3,	// Index 2
+	0x8,	// Index 3
+	0x6,	// Index 4
+	0xB,	// Index 5
+	0x8,	// Index 6
+	0x1,	// Index 7
+	0x4,	// Index 8
+	0x4,	// Index 9
+	0x5,	// Index 10
+	0x7,	// Index 11
+	0x2,	// Index 12
+	0x5,	// Index 13
+	0x1,	// Index 14
+	0x6,	// Index 15
+	0x6,	// Index 16
+	0x5,	// Index 17
+	0x6,	// Index 18
+	0x6,	// Index 19
+	0x7,	// Index 20
+	0x6,	// Index 21
+	0x6,	// Index 22
+	0x6,	// Index 23
+	0x6,	// Index 24
+	0x6,	// Index 25
+	0x1,	// Index 26
+	0x2,	// Index 27
+	0x7,	// Index 28
+	0x7,	// Index 29
+	0x7,	// Index 30
+	0x5,	// Index 31
+	0xB,	// Index 32
+	0x7,	// Index 33
+	0x6,	// Index 34
+	0x7,	// Index 35
+	0x7,	// Index 36
+	0x6,	// Index 37
+	0x6,	// Index 38
+	0x7,	// Index 39
+	0x7,	// Index 40
+	0x3,	// Index 41
+	0x5,	// Index 42
+	0x6,	// Index 43
+	0x6,	// Index 44
+	0x9,	// Index 45
+	0x7,	// Index 46
+	0x8,	// Index 47
+	0x6,	// Index 48
+	0x8,	// Index 49
+	0x7,	// Index 50
+	0x7,	// Index 51
+	0x7,	// Index 52
+	0x7,	// Index 53
+	0x7,	// Index 54
+	0xB,	// Index 55
+	0x7,	// Index 56
+	0x7,	// Index 57
+	0x7,	// Index 58
+	0x3,	// Index 59
+	0x6,	// Index 60
+	0x3,	// Index 61
+	0x9,	// Index 62
+	0x8,	// Index 63
+	0x2,	// Index 64
+	0x6,	// Index 65
+	0x6,	// Index 66
+	0x6,	// Index 67
+	0x6,	// Index 68
+	0x6,	// Index 69
+	0x5,	// Index 70
+	0x6,	// Index 71
+	0x6,	// Index 72
+	0x1,	// Index 73
+	0x4,	// Index 74
+	0x5,	// Index 75
+	0x1,	// Index 76
+	0x9,	// Index 77
+	0x6,	// Index 78
+	0x6,	// Index 79
+	0x6,	// Index 80
+	0x6,	// Index 81
+	0x4,	// Index 82
+	0x5,	// Index 83
+	0x4,	// Index 84
+	0x6,	// Index 85
+	0x6,	// Index 86
+	0x9,	// Index 87
+	0x5,	// Index 88
+	0x6,	// Index 89
+	0x5,	// Index 90
+	0x5,	// Index 91
+	0x1,	// Index 92
+	0x5,	// Index 93
+	0x8,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Verdana10_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x9, 0x0,	// Index 1
+	0xA, 0x0,	// Index 2
+	0x9, 0x0,	// Index 3
+	0xA, 0x2,	// Index 4
+	0x9, 0x0,	// Index 5
+	0x9, 0x0,	// Index 6
+	0xA, 0x0,	// Index 7
+	0xA, 0x3,	// Index 8
+	0xA, 0x3,	// Index 9
+	0xA, 0x0,	// Index 10
+	0x8, 0x0,	// Index 11
+	0x2, 0x2,	// Index 12
+	0x5, 0x0,	// Index 13
+	0x2, 0x0,	// Index 14
+	0xA, 0x2,	// Index 15
+	0x9, 0x0,	// Index 16
+	0x9, 0x0,	// Index 17
+	0x9, 0x0,	// Index 18
+	0x9, 0x0,	// Index 19
+	0x9, 0x0,	// Index 20
+	0x9, 0x0,	// Index 21
+	0x9, 0x0,	// Index 22
+	0x9, 0x0,	// Index 23
+	0x9, 0x0,	// Index 24
+	0x9, 0x0,	// Index 25
+	0x7, 0x0,	// Index 26
+	0x7, 0x2,	// Index 27
+	0x7, 0x0,	// Index 28
+	0x6, 0x0,	// Index 29
+	0x7, 0x0,	// Index 30
+	0x9, 0x0,	// Index 31
+	0x9, 0x2,	// Index 32
+	0x9, 0x0,	// Index 33
+	0x9, 0x0,	// Index 34
+	0x9, 0x0,	// Index 35
+	0x9, 0x0,	// Index 36
+	0x9, 0x0,	// Index 37
+	0x9, 0x0,	// Index 38
+	0x9, 0x0,	// Index 39
+	0x9, 0x0,	// Index 40
+	0x9, 0x0,	// Index 41
+	0x9, 0x0,	// Index 42
+	0x9, 0x0,	// Index 43
+	0x9, 0x0,	// Index 44
+	0x9, 0x0,	// Index 45
+	0x9, 0x0,	// Index 46
+	0x9, 0x0,	// Index 47
+	0x9, 0x0,	// Index 48
+	0x9, 0x2,	// Index 49
+	0x9, 0x0,	// Index 50
+	0x9, 0x0,	// Index 51
+	0x9, 0x0,	// Index 52
+	0x9, 0x0,	// Index 53
+	0x9, 0x0,	// Index 54
+	0x9, 0x0,	// Index 55
+	0x9, 0x0,	// Index 56
+	0x9, 0x0,	// Index 57
+	0x9, 0x0,	// Index 58
+	0xA, 0x2,	// Index 59
+	0xA, 0x2,	// Index 60
+	0xA, 0x2,	// Index 61
+	0x9, 0x0,	// Index 62
+	0x0, 0x2,	// Index 63
+	0xA, 0x0,	// Index 64
+	0x7, 0x0,	// Index 65
+	0xA, 0x0,	// Index 66
+	0x7, 0x0,	// Index 67
+	0xA, 0x0,	// Index 68
+	0x7, 0x0,	// Index 69
+	0xA, 0x0,	// Index 70
+	0x7, 0x3,	// Index 71
+	0xA, 0x0,	// Index 72
+	0xA, 0x0,	// Index 73
+	0xA, 0x3,	// Index 74
+	0xA, 0x0,	// Index 75
+	0xA, 0x0,	// Index 76
+	0x7, 0x0,	// Index 77
+	0x7, 0x0,	// Index 78
+	0x7, 0x0,	// Index 79
+	0x7, 0x3,	// Index 80
+	0x7, 0x3,	// Index 81
+	0x7, 0x0,	// Index 82
+	0x7, 0x0,	// Index 83
+	0x9, 0x0,	// Index 84
+	0x7, 0x0,	// Index 85
+	0x7, 0x0,	// Index 86
+	0x7, 0x0,	// Index 87
+	0x7, 0x0,	// Index 88
+	0x7, 0x3,	// Index 89
+	0x7, 0x0,	// Index 90
+	0xA, 0x2,	// Index 91
+	0xA, 0x2,	// Index 92
+	0xA, 0x2,	// Index 93
+	0x6, 0x0,	// Index 94
+};
+
+const font_t Verdana10 = 
+{
+	Verdana10_bitmaps,
+	Verdana10_offsets,
+	Verdana10_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0xD,	// Height 
+	0,	// Flags 
+	Verdana10_extents,
+	0xA	// Ascent 
 };
+
 //---------------------------------------------------------------
 // Group Name: Verdana12
 // Designer: Imported System Font
@@ -830,398 +1250,607 @@ const unsigned char Verdana10[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Verdana12[] = 
+const unsigned char Verdana12_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x10,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xC8, // Index 1 (offset: 200)
-	0x0, 0xCB, // Index 2 (offset: 203)
-	0x0, 0xD6, // Index 3 (offset: 214)
-	0x0, 0xEB, // Index 4 (offset: 235)
-	0x0, 0xFC, // Index 5 (offset: 252)
-	0x1, 0x1B, // Index 6 (offset: 283)
-	0x1, 0x30, // Index 7 (offset: 304)
-	0x1, 0x33, // Index 8 (offset: 307)
-	0x1, 0x3E, // Index 9 (offset: 318)
-	0x1, 0x49, // Index 10 (offset: 329)
-	0x1, 0x58, // Index 11 (offset: 344)
-	0x1, 0x6B, // Index 12 (offset: 363)
-	0x1, 0x70, // Index 13 (offset: 368)
-	0x1, 0x7B, // Index 14 (offset: 379)
-	0x1, 0x7E, // Index 15 (offset: 382)
-	0x1, 0x8D, // Index 16 (offset: 397)
-	0x1, 0x9E, // Index 17 (offset: 414)
-	0x1, 0xA9, // Index 18 (offset: 425)
-	0x1, 0xBA, // Index 19 (offset: 442)
-	0x1, 0xCB, // Index 20 (offset: 459)
-	0x1, 0xDE, // Index 21 (offset: 478)
-	0x1, 0xEF, // Index 22 (offset: 495)
-	0x2, 0x0, // Index 23 (offset: 512)
-	0x2, 0x11, // Index 24 (offset: 529)
-	0x2, 0x22, // Index 25 (offset: 546)
-	0x2, 0x33, // Index 26 (offset: 563)
-	0x2, 0x36, // Index 27 (offset: 566)
-	0x2, 0x3B, // Index 28 (offset: 571)
-	0x2, 0x4E, // Index 29 (offset: 590)
-	0x2, 0x61, // Index 30 (offset: 609)
-	0x2, 0x74, // Index 31 (offset: 628)
-	0x2, 0x83, // Index 32 (offset: 643)
-	0x2, 0xA0, // Index 33 (offset: 672)
-	0x2, 0xB3, // Index 34 (offset: 691)
-	0x2, 0xC6, // Index 35 (offset: 710)
-	0x2, 0xD9, // Index 36 (offset: 729)
-	0x2, 0xEE, // Index 37 (offset: 750)
-	0x2, 0xFF, // Index 38 (offset: 767)
-	0x3, 0x10, // Index 39 (offset: 784)
-	0x3, 0x25, // Index 40 (offset: 805)
-	0x3, 0x3A, // Index 41 (offset: 826)
-	0x3, 0x45, // Index 42 (offset: 837)
-	0x3, 0x52, // Index 43 (offset: 850)
-	0x3, 0x65, // Index 44 (offset: 869)
-	0x3, 0x76, // Index 45 (offset: 886)
-	0x3, 0x8D, // Index 46 (offset: 909)
-	0x3, 0xA2, // Index 47 (offset: 930)
-	0x3, 0xB9, // Index 48 (offset: 953)
-	0x3, 0xCA, // Index 49 (offset: 970)
-	0x3, 0xE1, // Index 50 (offset: 993)
-	0x3, 0xF6, // Index 51 (offset: 1014)
-	0x4, 0x7, // Index 52 (offset: 1031)
-	0x4, 0x1A, // Index 53 (offset: 1050)
-	0x4, 0x2F, // Index 54 (offset: 1071)
-	0x4, 0x42, // Index 55 (offset: 1090)
-	0x4, 0x61, // Index 56 (offset: 1121)
-	0x4, 0x74, // Index 57 (offset: 1140)
-	0x4, 0x87, // Index 58 (offset: 1159)
-	0x4, 0x9A, // Index 59 (offset: 1178)
-	0x4, 0xA3, // Index 60 (offset: 1187)
-	0x4, 0xB2, // Index 61 (offset: 1202)
-	0x4, 0xBB, // Index 62 (offset: 1211)
-	0x4, 0xD0, // Index 63 (offset: 1232)
-	0x4, 0xE5, // Index 64 (offset: 1253)
-	0x4, 0xEA, // Index 65 (offset: 1258)
-	0x4, 0xFB, // Index 66 (offset: 1275)
-	0x5, 0xC, // Index 67 (offset: 1292)
-	0x5, 0x1B, // Index 68 (offset: 1307)
-	0x5, 0x2C, // Index 69 (offset: 1324)
-	0x5, 0x3D, // Index 70 (offset: 1341)
-	0x5, 0x4A, // Index 71 (offset: 1354)
-	0x5, 0x5B, // Index 72 (offset: 1371)
-	0x5, 0x6C, // Index 73 (offset: 1388)
-	0x5, 0x6F, // Index 74 (offset: 1391)
-	0x5, 0x78, // Index 75 (offset: 1400)
-	0x5, 0x87, // Index 76 (offset: 1415)
-	0x5, 0x8A, // Index 77 (offset: 1418)
-	0x5, 0xA5, // Index 78 (offset: 1445)
-	0x5, 0xB6, // Index 79 (offset: 1462)
-	0x5, 0xC7, // Index 80 (offset: 1479)
-	0x5, 0xD8, // Index 81 (offset: 1496)
-	0x5, 0xE9, // Index 82 (offset: 1513)
-	0x5, 0xF4, // Index 83 (offset: 1524)
-	0x6, 0x3, // Index 84 (offset: 1539)
-	0x6, 0xE, // Index 85 (offset: 1550)
-	0x6, 0x1F, // Index 86 (offset: 1567)
-	0x6, 0x2E, // Index 87 (offset: 1582)
-	0x6, 0x45, // Index 88 (offset: 1605)
-	0x6, 0x54, // Index 89 (offset: 1620)
-	0x6, 0x63, // Index 90 (offset: 1635)
-	0x6, 0x72, // Index 91 (offset: 1650)
-	0x6, 0x81, // Index 92 (offset: 1665)
-	0x6, 0x84, // Index 93 (offset: 1668)
-	0x6, 0x93, // Index 94 (offset: 1683)
-
 	/* Index 0, character 32 " " (width: 2 pixels) */
-	0x2, 0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 1 pixels) */
-	0x1, 0xFE,0x1B,
+	0xFE,0x1B,
 
 	/* Index 2, character 34 """ (width: 5 pixels) */
-	0x5, 0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,
+	0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,
 
 	/* Index 3, character 35 "#" (width: 10 pixels) */
-	0xA, 0x00,0x02,0x10,0x1E,0x90,0x03,0x70,0x02,0x1E,0x02,0x10,0x1E,0x90,0x03,0x70,0x02,0x1E,0x02,0x10,0x00,
+	0x00,0x02,0x10,0x1E,0x90,0x03,0x70,0x02,0x1E,0x02,0x10,0x1E,0x90,0x03,0x70,0x02,0x1E,0x02,0x10,0x00,
 
 	/* Index 4, character 36 "$" (width: 8 pixels) */
-	0x8, 0x30,0x08,0x48,0x10,0x84,0x10,0xFF,0xFF,0x84,0x10,0x84,0x10,0x04,0x09,0x08,0x06,
+	0x30,0x08,0x48,0x10,0x84,0x10,0xFF,0xFF,0x84,0x10,0x84,0x10,0x04,0x09,0x08,0x06,
 
 	/* Index 5, character 37 "%" (width: 15 pixels) */
-	0xF, 0x7C,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x10,0x7C,0x0C,0x00,0x03,0xC0,0x00,0x30,0x00,0x8C,0x0F,0x42,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x80,0x0F,
+	0x7C,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x10,0x7C,0x0C,0x00,0x03,0xC0,0x00,0x30,0x00,0x8C,0x0F,0x42,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x80,0x0F,
 
 	/* Index 6, character 38 "&" (width: 10 pixels) */
-	0xA, 0x00,0x07,0x9C,0x08,0x62,0x10,0x42,0x10,0xC2,0x10,0x22,0x11,0x1C,0x0A,0x00,0x04,0xC0,0x0B,0x00,0x10,
+	0x00,0x07,0x9C,0x08,0x62,0x10,0x42,0x10,0xC2,0x10,0x22,0x11,0x1C,0x0A,0x00,0x04,0xC0,0x0B,0x00,0x10,
 
 	/* Index 7, character 39 "'" (width: 1 pixels) */
-	0x1, 0x1F,0x00,
+	0x1F,0x00,
 
 	/* Index 8, character 40 "(" (width: 5 pixels) */
-	0x5, 0xE0,0x07,0x18,0x18,0x04,0x20,0x02,0x40,0x01,0x80,
+	0xE0,0x07,0x18,0x18,0x04,0x20,0x02,0x40,0x01,0x80,
 
 	/* Index 9, character 41 ")" (width: 5 pixels) */
-	0x5, 0x01,0x80,0x02,0x40,0x04,0x20,0x18,0x18,0xE0,0x07,
+	0x01,0x80,0x02,0x40,0x04,0x20,0x18,0x18,0xE0,0x07,
 
 	/* Index 10, character 42 "*" (width: 7 pixels) */
-	0x7, 0x22,0x00,0x14,0x00,0x08,0x00,0x7F,0x00,0x08,0x00,0x14,0x00,0x22,0x00,
+	0x22,0x00,0x14,0x00,0x08,0x00,0x7F,0x00,0x08,0x00,0x14,0x00,0x22,0x00,
 
 	/* Index 11, character 43 "+" (width: 9 pixels) */
-	0x9, 0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xF8,0x0F,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
+	0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xF8,0x0F,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
 
 	/* Index 12, character 44 "," (width: 2 pixels) */
-	0x2, 0x00,0xC0,0x00,0x38,
+	0x00,0xC0,0x00,0x38,
 
 	/* Index 13, character 45 "-" (width: 5 pixels) */
-	0x5, 0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
+	0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
 
 	/* Index 14, character 46 "." (width: 1 pixels) */
-	0x1, 0x00,0x18,
+	0x00,0x18,
 
 	/* Index 15, character 47 "/" (width: 7 pixels) */
-	0x7, 0x00,0x40,0x00,0x38,0x00,0x06,0xC0,0x01,0x30,0x00,0x0E,0x00,0x01,0x00,
+	0x00,0x40,0x00,0x38,0x00,0x06,0xC0,0x01,0x30,0x00,0x0E,0x00,0x01,0x00,
 
 	/* Index 16, character 48 "0" (width: 8 pixels) */
-	0x8, 0xF8,0x07,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,0xF8,0x07,
+	0xF8,0x07,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,0xF8,0x07,
 
 	/* Index 17, character 49 "1" (width: 5 pixels) */
-	0x5, 0x08,0x10,0x08,0x10,0xFE,0x1F,0x00,0x10,0x00,0x10,
+	0x08,0x10,0x08,0x10,0xFE,0x1F,0x00,0x10,0x00,0x10,
 
 	/* Index 18, character 50 "2" (width: 8 pixels) */
-	0x8, 0x04,0x10,0x02,0x18,0x02,0x14,0x02,0x12,0x02,0x11,0x82,0x10,0x44,0x10,0x38,0x10,
+	0x04,0x10,0x02,0x18,0x02,0x14,0x02,0x12,0x02,0x11,0x82,0x10,0x44,0x10,0x38,0x10,
 
 	/* Index 19, character 51 "3" (width: 8 pixels) */
-	0x8, 0x04,0x08,0x02,0x10,0x02,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0xA4,0x08,0x18,0x07,
+	0x04,0x08,0x02,0x10,0x02,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0xA4,0x08,0x18,0x07,
 
 	/* Index 20, character 52 "4" (width: 9 pixels) */
-	0x9, 0x80,0x03,0x40,0x02,0x20,0x02,0x10,0x02,0x08,0x02,0x04,0x02,0xFE,0x1F,0x00,0x02,0x00,0x02,
+	0x80,0x03,0x40,0x02,0x20,0x02,0x10,0x02,0x08,0x02,0x04,0x02,0xFE,0x1F,0x00,0x02,0x00,0x02,
 
 	/* Index 21, character 53 "5" (width: 8 pixels) */
-	0x8, 0x00,0x08,0x3E,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x42,0x08,0x82,0x07,
+	0x00,0x08,0x3E,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x42,0x08,0x82,0x07,
 
 	/* Index 22, character 54 "6" (width: 8 pixels) */
-	0x8, 0xF0,0x07,0x48,0x08,0x24,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x42,0x08,0x80,0x07,
+	0xF0,0x07,0x48,0x08,0x24,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x42,0x08,0x80,0x07,
 
 	/* Index 23, character 55 "7" (width: 8 pixels) */
-	0x8, 0x02,0x00,0x02,0x00,0x02,0x18,0x02,0x06,0x82,0x01,0x62,0x00,0x1A,0x00,0x06,0x00,
+	0x02,0x00,0x02,0x00,0x02,0x18,0x02,0x06,0x82,0x01,0x62,0x00,0x1A,0x00,0x06,0x00,
 
 	/* Index 24, character 56 "8" (width: 8 pixels) */
-	0x8, 0x18,0x07,0xA4,0x08,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0xA4,0x08,0x18,0x07,
+	0x18,0x07,0xA4,0x08,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0xA4,0x08,0x18,0x07,
 
 	/* Index 25, character 57 "9" (width: 8 pixels) */
-	0x8, 0x78,0x00,0x84,0x10,0x02,0x11,0x02,0x11,0x02,0x11,0x02,0x09,0x84,0x04,0xF8,0x03,
+	0x78,0x00,0x84,0x10,0x02,0x11,0x02,0x11,0x02,0x11,0x02,0x09,0x84,0x04,0xF8,0x03,
 
 	/* Index 26, character 58 ":" (width: 1 pixels) */
-	0x1, 0x30,0x18,
+	0x30,0x18,
 
 	/* Index 27, character 59 ";" (width: 2 pixels) */
-	0x2, 0x00,0xC0,0x30,0x38,
+	0x00,0xC0,0x30,0x38,
 
 	/* Index 28, character 60 "<" (width: 9 pixels) */
-	0x9, 0x80,0x00,0x40,0x01,0x40,0x01,0x20,0x02,0x20,0x02,0x10,0x04,0x10,0x04,0x08,0x08,0x08,0x08,
+	0x80,0x00,0x40,0x01,0x40,0x01,0x20,0x02,0x20,0x02,0x10,0x04,0x10,0x04,0x08,0x08,0x08,0x08,
 
 	/* Index 29, character 61 "=" (width: 9 pixels) */
-	0x9, 0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,
+	0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,
 
 	/* Index 30, character 62 ">" (width: 9 pixels) */
-	0x9, 0x08,0x08,0x08,0x08,0x10,0x04,0x10,0x04,0x20,0x02,0x20,0x02,0x40,0x01,0x40,0x01,0x80,0x00,
+	0x08,0x08,0x08,0x08,0x10,0x04,0x10,0x04,0x20,0x02,0x20,0x02,0x40,0x01,0x40,0x01,0x80,0x00,
 
 	/* Index 31, character 63 "?" (width: 7 pixels) */
-	0x7, 0x04,0x00,0x02,0x00,0x02,0x00,0x02,0x1B,0x82,0x00,0x44,0x00,0x38,0x00,
+	0x04,0x00,0x02,0x00,0x02,0x00,0x02,0x1B,0x82,0x00,0x44,0x00,0x38,0x00,
 
 	/* Index 32, character 64 "@" (width: 14 pixels) */
-	0xE, 0xC0,0x07,0x30,0x18,0x08,0x20,0xC4,0x23,0x24,0x44,0x12,0x48,0x12,0x48,0x12,0x48,0x12,0x44,0xF2,0x4F,0x04,0x08,0x04,0x08,0x18,0x08,0xE0,0x07,
+	0xC0,0x07,0x30,0x18,0x08,0x20,0xC4,0x23,0x24,0x44,0x12,0x48,0x12,0x48,0x12,0x48,0x12,0x44,0xF2,0x4F,0x04,0x08,0x04,0x08,0x18,0x08,0xE0,0x07,
 
 	/* Index 33, character 65 "A" (width: 9 pixels) */
-	0x9, 0x00,0x1C,0x00,0x03,0xE0,0x02,0x18,0x02,0x06,0x02,0x18,0x02,0xE0,0x02,0x00,0x03,0x00,0x1C,
+	0x00,0x1C,0x00,0x03,0xE0,0x02,0x18,0x02,0x06,0x02,0x18,0x02,0xE0,0x02,0x00,0x03,0x00,0x1C,
 
 	/* Index 34, character 66 "B" (width: 9 pixels) */
-	0x9, 0xFE,0x1F,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x62,0x10,0x9C,0x08,0x00,0x07,
+	0xFE,0x1F,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x62,0x10,0x9C,0x08,0x00,0x07,
 
 	/* Index 35, character 67 "C" (width: 9 pixels) */
-	0x9, 0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,0x0C,0x0C,
+	0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,0x0C,0x0C,
 
 	/* Index 36, character 68 "D" (width: 10 pixels) */
-	0xA, 0xFE,0x1F,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,0x04,0x08,0x18,0x06,0xE0,0x01,
+	0xFE,0x1F,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,0x04,0x08,0x18,0x06,0xE0,0x01,
 
 	/* Index 37, character 69 "E" (width: 8 pixels) */
-	0x8, 0xFE,0x1F,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,
+	0xFE,0x1F,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x42,0x10,
 
 	/* Index 38, character 70 "F" (width: 8 pixels) */
-	0x8, 0xFE,0x1F,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x02,0x00,
+	0xFE,0x1F,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x02,0x00,
 
 	/* Index 39, character 71 "G" (width: 10 pixels) */
-	0xA, 0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x82,0x10,0x82,0x10,0x84,0x10,0x8C,0x0F,
+	0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x82,0x10,0x82,0x10,0x84,0x10,0x8C,0x0F,
 
 	/* Index 40, character 72 "H" (width: 10 pixels) */
-	0xA, 0xFE,0x1F,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0xFE,0x1F,
+	0xFE,0x1F,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0xFE,0x1F,
 
 	/* Index 41, character 73 "I" (width: 5 pixels) */
-	0x5, 0x02,0x10,0x02,0x10,0xFE,0x1F,0x02,0x10,0x02,0x10,
+	0x02,0x10,0x02,0x10,0xFE,0x1F,0x02,0x10,0x02,0x10,
 
 	/* Index 42, character 74 "J" (width: 6 pixels) */
-	0x6, 0x00,0x10,0x00,0x10,0x02,0x10,0x02,0x10,0x02,0x08,0xFE,0x07,
+	0x00,0x10,0x00,0x10,0x02,0x10,0x02,0x10,0x02,0x08,0xFE,0x07,
 
 	/* Index 43, character 75 "K" (width: 9 pixels) */
-	0x9, 0xFE,0x1F,0x00,0x01,0x80,0x00,0xC0,0x00,0x20,0x01,0x10,0x02,0x08,0x04,0x04,0x08,0x02,0x10,
+	0xFE,0x1F,0x00,0x01,0x80,0x00,0xC0,0x00,0x20,0x01,0x10,0x02,0x08,0x04,0x04,0x08,0x02,0x10,
 
 	/* Index 44, character 76 "L" (width: 8 pixels) */
-	0x8, 0xFE,0x1F,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,
+	0xFE,0x1F,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,
 
 	/* Index 45, character 77 "M" (width: 11 pixels) */
-	0xB, 0xFE,0x1F,0x06,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0x00,0x06,0x80,0x01,0x60,0x00,0x18,0x00,0x06,0x00,0xFE,0x1F,
+	0xFE,0x1F,0x06,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0x00,0x06,0x80,0x01,0x60,0x00,0x18,0x00,0x06,0x00,0xFE,0x1F,
 
 	/* Index 46, character 78 "N" (width: 10 pixels) */
-	0xA, 0xFE,0x1F,0x04,0x00,0x08,0x00,0x30,0x00,0x40,0x00,0x80,0x00,0x00,0x01,0x00,0x06,0x00,0x08,0xFE,0x1F,
+	0xFE,0x1F,0x04,0x00,0x08,0x00,0x30,0x00,0x40,0x00,0x80,0x00,0x00,0x01,0x00,0x06,0x00,0x08,0xFE,0x1F,
 
 	/* Index 47, character 79 "O" (width: 11 pixels) */
-	0xB, 0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,0x0C,0x0C,0xF0,0x03,
+	0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x04,0x08,0x0C,0x0C,0xF0,0x03,
 
 	/* Index 48, character 80 "P" (width: 8 pixels) */
-	0x8, 0xFE,0x1F,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
+	0xFE,0x1F,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x84,0x00,0x78,0x00,
 
 	/* Index 49, character 81 "Q" (width: 11 pixels) */
-	0xB, 0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x70,0x02,0x90,0x04,0x88,0x0C,0x8C,0xF0,0x83,
+	0xF0,0x03,0x0C,0x0C,0x04,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x70,0x02,0x90,0x04,0x88,0x0C,0x8C,0xF0,0x83,
 
 	/* Index 50, character 82 "R" (width: 10 pixels) */
-	0xA, 0xFE,0x1F,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x01,0x44,0x02,0x38,0x04,0x00,0x08,0x00,0x10,
+	0xFE,0x1F,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x01,0x44,0x02,0x38,0x04,0x00,0x08,0x00,0x10,
 
 	/* Index 51, character 83 "S" (width: 8 pixels) */
-	0x8, 0x38,0x04,0x44,0x08,0x42,0x10,0x42,0x10,0x82,0x10,0x82,0x10,0x84,0x08,0x08,0x07,
+	0x38,0x04,0x44,0x08,0x42,0x10,0x42,0x10,0x82,0x10,0x82,0x10,0x84,0x08,0x08,0x07,
 
 	/* Index 52, character 84 "T" (width: 9 pixels) */
-	0x9, 0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0xFE,0x1F,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
+	0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0xFE,0x1F,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
 
 	/* Index 53, character 85 "U" (width: 10 pixels) */
-	0xA, 0xFE,0x07,0x00,0x08,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x08,0xFE,0x07,
+	0xFE,0x07,0x00,0x08,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x08,0xFE,0x07,
 
 	/* Index 54, character 86 "V" (width: 9 pixels) */
-	0x9, 0x0E,0x00,0x30,0x00,0xC0,0x01,0x00,0x06,0x00,0x18,0x00,0x06,0xC0,0x01,0x30,0x00,0x0E,0x00,
+	0x0E,0x00,0x30,0x00,0xC0,0x01,0x00,0x06,0x00,0x18,0x00,0x06,0xC0,0x01,0x30,0x00,0x0E,0x00,
 
 	/* Index 55, character 87 "W" (width: 15 pixels) */
-	0xF, 0x0E,0x00,0xF0,0x00,0x00,0x07,0x00,0x18,0x00,0x07,0xC0,0x00,0x38,0x00,0x06,0x00,0x38,0x00,0xC0,0x00,0x00,0x07,0x00,0x18,0x00,0x07,0xF0,0x00,0x0E,0x00,
+	0x0E,0x00,0xF0,0x00,0x00,0x07,0x00,0x18,0x00,0x07,0xC0,0x00,0x38,0x00,0x06,0x00,0x38,0x00,0xC0,0x00,0x00,0x07,0x00,0x18,0x00,0x07,0xF0,0x00,0x0E,0x00,
 
 	/* Index 56, character 88 "X" (width: 9 pixels) */
-	0x9, 0x02,0x10,0x04,0x08,0x18,0x06,0x20,0x01,0xC0,0x00,0x20,0x01,0x18,0x06,0x04,0x08,0x02,0x10,
+	0x02,0x10,0x04,0x08,0x18,0x06,0x20,0x01,0xC0,0x00,0x20,0x01,0x18,0x06,0x04,0x08,0x02,0x10,
 
 	/* Index 57, character 89 "Y" (width: 9 pixels) */
-	0x9, 0x02,0x00,0x0C,0x00,0x10,0x00,0x60,0x00,0x80,0x1F,0x60,0x00,0x10,0x00,0x0C,0x00,0x02,0x00,
+	0x02,0x00,0x0C,0x00,0x10,0x00,0x60,0x00,0x80,0x1F,0x60,0x00,0x10,0x00,0x0C,0x00,0x02,0x00,
 
 	/* Index 58, character 90 "Z" (width: 9 pixels) */
-	0x9, 0x02,0x18,0x02,0x14,0x02,0x12,0x02,0x11,0xC2,0x10,0x22,0x10,0x12,0x10,0x0A,0x10,0x06,0x10,
+	0x02,0x18,0x02,0x14,0x02,0x12,0x02,0x11,0xC2,0x10,0x22,0x10,0x12,0x10,0x0A,0x10,0x06,0x10,
 
 	/* Index 59, character 91 "[" (width: 4 pixels) */
-	0x4, 0xFF,0xFF,0x01,0x80,0x01,0x80,0x01,0x80,
+	0xFF,0xFF,0x01,0x80,0x01,0x80,0x01,0x80,
 
 	/* Index 60, character 92 "\" (width: 7 pixels) */
-	0x7, 0x01,0x00,0x0E,0x00,0x30,0x00,0xC0,0x01,0x00,0x06,0x00,0x38,0x00,0x40,
+	0x01,0x00,0x0E,0x00,0x30,0x00,0xC0,0x01,0x00,0x06,0x00,0x38,0x00,0x40,
 
 	/* Index 61, character 93 "]" (width: 4 pixels) */
-	0x4, 0x01,0x80,0x01,0x80,0x01,0x80,0xFF,0xFF,
+	0x01,0x80,0x01,0x80,0x01,0x80,0xFF,0xFF,
 
 	/* Index 62, character 94 "^" (width: 10 pixels) */
-	0xA, 0x40,0x00,0x20,0x00,0x10,0x00,0x0C,0x00,0x02,0x00,0x02,0x00,0x0C,0x00,0x10,0x00,0x20,0x00,0x40,0x00,
+	0x40,0x00,0x20,0x00,0x10,0x00,0x0C,0x00,0x02,0x00,0x02,0x00,0x0C,0x00,0x10,0x00,0x20,0x00,0x40,0x00,
 
 	/* Index 63, character 95 "_" (width: 10 pixels) */
-	0xA, 0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,
+	0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,
 
 	/* Index 64, character 96 "`" (width: 2 pixels) */
-	0x2, 0x02,0x00,0x04,0x00,
+	0x02,0x00,0x04,0x00,
 
 	/* Index 65, character 97 "a" (width: 8 pixels) */
-	0x8, 0x00,0x06,0x20,0x09,0x90,0x10,0x90,0x10,0x90,0x10,0x90,0x10,0x90,0x08,0xE0,0x1F,
+	0x00,0x06,0x20,0x09,0x90,0x10,0x90,0x10,0x90,0x10,0x90,0x10,0x90,0x08,0xE0,0x1F,
 
 	/* Index 66, character 98 "b" (width: 8 pixels) */
-	0x8, 0xFF,0x1F,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xC0,0x07,
+	0xFF,0x1F,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xC0,0x07,
 
 	/* Index 67, character 99 "c" (width: 7 pixels) */
-	0x7, 0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,
+	0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,
 
 	/* Index 68, character 100 "d" (width: 8 pixels) */
-	0x8, 0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xFF,0x1F,
+	0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xFF,0x1F,
 
 	/* Index 69, character 101 "e" (width: 8 pixels) */
-	0x8, 0xC0,0x07,0x20,0x09,0x10,0x11,0x10,0x11,0x10,0x11,0x10,0x11,0x20,0x11,0xC0,0x09,
+	0xC0,0x07,0x20,0x09,0x10,0x11,0x10,0x11,0x10,0x11,0x10,0x11,0x20,0x11,0xC0,0x09,
 
 	/* Index 70, character 102 "f" (width: 6 pixels) */
-	0x6, 0x10,0x00,0xFE,0x1F,0x11,0x00,0x11,0x00,0x11,0x00,0x01,0x00,
+	0x10,0x00,0xFE,0x1F,0x11,0x00,0x11,0x00,0x11,0x00,0x01,0x00,
 
 	/* Index 71, character 103 "g" (width: 8 pixels) */
-	0x8, 0xC0,0x07,0x20,0x48,0x10,0x90,0x10,0x90,0x10,0x90,0x10,0x90,0x20,0x48,0xF0,0x3F,
+	0xC0,0x07,0x20,0x48,0x10,0x90,0x10,0x90,0x10,0x90,0x10,0x90,0x20,0x48,0xF0,0x3F,
 
 	/* Index 72, character 104 "h" (width: 8 pixels) */
-	0x8, 0xFF,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0xC0,0x1F,
+	0xFF,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0xC0,0x1F,
 
 	/* Index 73, character 105 "i" (width: 1 pixels) */
-	0x1, 0xF6,0x1F,
+	0xF6,0x1F,
 
 	/* Index 74, character 106 "j" (width: 4 pixels) */
-	0x4, 0x00,0x80,0x10,0x80,0x10,0x80,0xF6,0x7F,
+	0x00,0x80,0x10,0x80,0x10,0x80,0xF6,0x7F,
 
 	/* Index 75, character 107 "k" (width: 7 pixels) */
-	0x7, 0xFF,0x1F,0x00,0x02,0x00,0x01,0x80,0x02,0x40,0x04,0x20,0x08,0x10,0x10,
+	0xFF,0x1F,0x00,0x02,0x00,0x01,0x80,0x02,0x40,0x04,0x20,0x08,0x10,0x10,
 
 	/* Index 76, character 108 "l" (width: 1 pixels) */
-	0x1, 0xFF,0x1F,
+	0xFF,0x1F,
 
 	/* Index 77, character 109 "m" (width: 13 pixels) */
-	0xD, 0xF0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xE0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xE0,0x1F,
+	0xF0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xE0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xE0,0x1F,
 
 	/* Index 78, character 110 "n" (width: 8 pixels) */
-	0x8, 0xF0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0xC0,0x1F,
+	0xF0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0xC0,0x1F,
 
 	/* Index 79, character 111 "o" (width: 8 pixels) */
-	0x8, 0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xC0,0x07,
+	0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xC0,0x07,
 
 	/* Index 80, character 112 "p" (width: 8 pixels) */
-	0x8, 0xF0,0xFF,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xC0,0x07,
+	0xF0,0xFF,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xC0,0x07,
 
 	/* Index 81, character 113 "q" (width: 8 pixels) */
-	0x8, 0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xF0,0xFF,
+	0xC0,0x07,0x20,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x08,0xF0,0xFF,
 
 	/* Index 82, character 114 "r" (width: 5 pixels) */
-	0x5, 0xF0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,
+	0xF0,0x1F,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,
 
 	/* Index 83, character 115 "s" (width: 7 pixels) */
-	0x7, 0xE0,0x08,0x10,0x11,0x10,0x11,0x10,0x11,0x10,0x11,0x10,0x11,0x20,0x0E,
+	0xE0,0x08,0x10,0x11,0x10,0x11,0x10,0x11,0x10,0x11,0x10,0x11,0x20,0x0E,
 
 	/* Index 84, character 116 "t" (width: 5 pixels) */
-	0x5, 0x10,0x00,0xFE,0x0F,0x10,0x10,0x10,0x10,0x10,0x10,
+	0x10,0x00,0xFE,0x0F,0x10,0x10,0x10,0x10,0x10,0x10,
 
 	/* Index 85, character 117 "u" (width: 8 pixels) */
-	0x8, 0xF0,0x07,0x00,0x08,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x08,0xF0,0x1F,
+	0xF0,0x07,0x00,0x08,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x08,0xF0,0x1F,
 
 	/* Index 86, character 118 "v" (width: 7 pixels) */
-	0x7, 0x30,0x00,0xC0,0x01,0x00,0x06,0x00,0x18,0x00,0x06,0xC0,0x01,0x30,0x00,
+	0x30,0x00,0xC0,0x01,0x00,0x06,0x00,0x18,0x00,0x06,0xC0,0x01,0x30,0x00,
 
 	/* Index 87, character 119 "w" (width: 11 pixels) */
-	0xB, 0x30,0x00,0xC0,0x07,0x00,0x18,0x00,0x06,0xC0,0x01,0x30,0x00,0xC0,0x01,0x00,0x06,0x00,0x18,0xC0,0x07,0x30,0x00,
+	0x30,0x00,0xC0,0x07,0x00,0x18,0x00,0x06,0xC0,0x01,0x30,0x00,0xC0,0x01,0x00,0x06,0x00,0x18,0xC0,0x07,0x30,0x00,
 
 	/* Index 88, character 120 "x" (width: 7 pixels) */
-	0x7, 0x10,0x10,0x60,0x0C,0x80,0x02,0x00,0x01,0x80,0x02,0x60,0x0C,0x10,0x10,
+	0x10,0x10,0x60,0x0C,0x80,0x02,0x00,0x01,0x80,0x02,0x60,0x0C,0x10,0x10,
 
 	/* Index 89, character 121 "y" (width: 7 pixels) */
-	0x7, 0x30,0x00,0xC0,0x01,0x00,0xC6,0x00,0x38,0x00,0x06,0xC0,0x01,0x30,0x00,
+	0x30,0x00,0xC0,0x01,0x00,0xC6,0x00,0x38,0x00,0x06,0xC0,0x01,0x30,0x00,
 
 	/* Index 90, character 122 "z" (width: 7 pixels) */
-	0x7, 0x10,0x18,0x10,0x14,0x10,0x12,0x10,0x11,0x90,0x10,0x50,0x10,0x30,0x10,
+	0x10,0x18,0x10,0x14,0x10,0x12,0x10,0x11,0x90,0x10,0x50,0x10,0x30,0x10,
 
 	/* Index 91, character 123 "{" (width: 7 pixels) */
-	0x7, 0x80,0x00,0x80,0x00,0x40,0x01,0x3E,0x7E,0x01,0x80,0x01,0x80,0x01,0x80,
+	0x80,0x00,0x80,0x00,0x40,0x01,0x3E,0x7E,0x01,0x80,0x01,0x80,0x01,0x80,
 
 	/* Index 92, character 124 "|" (width: 1 pixels) */
-	0x1, 0xFF,0xFF,
+	0xFF,0xFF,
 
 	/* Index 93, character 125 "}" (width: 7 pixels) */
-	0x7, 0x01,0x80,0x01,0x80,0x01,0x80,0x3E,0x7E,0x40,0x01,0x80,0x00,0x80,0x00,
+	0x01,0x80,0x01,0x80,0x01,0x80,0x3E,0x7E,0x40,0x01,0x80,0x00,0x80,0x00,
 
 	/* Index 94, character 126 "~" (width: 10 pixels) */
-	0xA, 0x00,0x03,0x80,0x00,0x40,0x00,0x40,0x00,0x80,0x00,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x01,0xC0,0x00
+	0x00,0x03,0x80,0x00,0x40,0x00,0x40,0x00,0x80,0x00,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x01,0xC0,0x00
+};
+
+// Offset of each bitmap in Verdana12_bitmaps
+const unsigned short Verdana12_offsets[] = 
+{
+	0x0,	// Index 0
+	0x4,	// Index 1
+	0x6,	// Index 2
+	0x10,	// Index 3
+	0x24,	// Index 4
+	0x34,	// Index 5
+	0x52,	// Index 6
+	0x66,	// Index 7
+	0x68,	// Index 8
+	0x72,	// Index 9
+	0x7C,	// Index 10
+	0x8A,	// Index 11
+	0x9C,	// Index 12
+	0xA0,	// Index 13
+	0xAA,	// Index 14
+	0xAC,	// Index 15
+	0xBA,	// Index 16
+	0xCA,	// Index 17
+	0xD4,	// Index 18
+	0xE4,	// Index 19
+	0xF4,	// Index 20
+	0x106,	// Index 21
+	0x116,	// Index 22
+	0x126,	// Index 23
+	0x136,	// Index 24
+	0x146,	// Index 25
+	0x156,	// Index 26
+	0x158,	// Index 27
+	0x15C,	// Index 28
+	0x16E,	// Index 29
+	0x180,	// Index 30
+	0x192,	// Index 31
+	0x1A0,	// Index 32
+	0x1BC,	// Index 33
+	0x1CE,	// Index 34
+	0x1E0,	// Index 35
+	0x1F2,	// Index 36
+	0x206,	// Index 37
+	0x216,	// Index 38
+	0x226,	// Index 39
+	0x23A,	// Index 40
+	0x24E,	// Index 41
+	0x258,	// Index 42
+	0x264,	// Index 43
+	0x276,	// Index 44
+	0x286,	// Index 45
+	0x29C,	// Index 46
+	0x2B0,	// Index 47
+	0x2C6,	// Index 48
+	0x2D6,	// Index 49
+	0x2EC,	// Index 50
+	0x300,	// Index 51
+	0x310,	// Index 52
+	0x322,	// Index 53
+	0x336,	// Index 54
+	0x348,	// Index 55
+	0x366,	// Index 56
+	0x378,	// Index 57
+	0x38A,	// Index 58
+	0x39C,	// Index 59
+	0x3A4,	// Index 60
+	0x3B2,	// Index 61
+	0x3BA,	// Index 62
+	0x3CE,	// Index 63
+	0x3E2,	// Index 64
+	0x3E6,	// Index 65
+	0x3F6,	// Index 66
+	0x406,	// Index 67
+	0x414,	// Index 68
+	0x424,	// Index 69
+	0x434,	// Index 70
+	0x440,	// Index 71
+	0x450,	// Index 72
+	0x460,	// Index 73
+	0x462,	// Index 74
+	0x46A,	// Index 75
+	0x478,	// Index 76
+	0x47A,	// Index 77
+	0x494,	// Index 78
+	0x4A4,	// Index 79
+	0x4B4,	// Index 80
+	0x4C4,	// Index 81
+	0x4D4,	// Index 82
+	0x4DE,	// Index 83
+	0x4EC,	// Index 84
+	0x4F6,	// Index 85
+	0x506,	// Index 86
+	0x514,	// Index 87
+	0x52A,	// Index 88
+	0x538,	// Index 89
+	0x546,	// Index 90
+	0x554,	// Index 91
+	0x562,	// Index 92
+	0x564,	// Index 93
+	0x572,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Verdana12_widths[] = 
+{
+	0x2,	// Index 0
+	0x1,	// Index 1
+	0x5,	// Index 2
+	0xA,	// Index 3
+	0x8,	// Index 4
+	0xF,	// Index 5
+	0xA,	// Index 6
+	0x1,	// Index 7
+	0x5,	// Index 8
+	0x5,	// Index 9
+	0x7,	// Index 10
+	0x9,	// Index 11
+	0x2,	// Index 12
+	0x5,	// Index 13
+	0x1,	// Index 14
+	0x7,	// Index 15
+	0x8,	// Index 16
+	0x5,	// Index 17
+	0x8,	// Index 18
+	0x8,	// Index 19
+	0x9,	// Index 20
+	0x8,	// Index 21
+	0x8,	// Index 22
+	0x8,	// Index 23
+	0x8,	// Index 24
+	0x8,	// Index 25
+	0x1,	// Index 26
+	0x2,	// Index 27
+	0x9,	// Index 28
+	0x9,	// Index 29
+	0x9,	// Index 30
+	0x7,	// Index 31
+	0xE,	// Index 32
+	0x9,	// Index 33
+	0x9,	// Index 34
+	0x9,	// Index 35
+	0xA,	// Index 36
+	0x8,	// Index 37
+	0x8,	// Index 38
+	0xA,	// Index 39
+	0xA,	// Index 40
+	0x5,	// Index 41
+	0x6,	// Index 42
+	0x9,	// Index 43
+	0x8,	// Index 44
+	0xB,	// Index 45
+	0xA,	// Index 46
+	0xB,	// Index 47
+	0x8,	// Index 48
+	0xB,	// Index 49
+	0xA,	// Index 50
+	0x8,	// Index 51
+	0x9,	// Index 52
+	0xA,	// Index 53
+	0x9,	// Index 54
+	0xF,	// Index 55
+	0x9,	// Index 56
+	0x9,	// Index 57
+	0x9,	// Index 58
+	0x4,	// Index 59
+	0x7,	// Index 60
+	0x4,	// Index 61
+	0xA,	// Index 62
+	0xA,	// Index 63
+	0x2,	// Index 64
+	0x8,	// Index 65
+	0x8,	// Index 66
+	0x7,	// Index 67
+	0x8,	// Index 68
+	0x8,	// Index 69
+	0x6,	// Index 70
+	0x8,	// Index 71
+	0x8,	// Index 72
+	0x1,	// Index 73
+	0x4,	// Index 74
+	0x7,	// Index 75
+	0x1,	// Index 76
+	0xD,	// Index 77
+	0x8,	// Index 78
+	0x8,	// Index 79
+	0x8,	// Index 80
+	0x8,	// Index 81
+	0x5,	// Index 82
+	0x7,	// Index 83
+	0x5,	// Index 84
+	0x8,	// Index 85
+	0x7,	// Index 86
+	0xB,	// Index 87
+	0x7,	// Index 88
+	0x7,	// Index 89
+	0x7,	// Index 90
+	0x7,	// Index 91
+	0x1,	// Index 92
+	0x7,	// Index 93
+	0xA,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Verdana12_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0xC, 0x0,	// Index 1
+	0xD, 0x0,	// Index 2
+	0xC, 0x0,	// Index 3
+	0xD, 0x3,	// Index 4
+	0xC, 0x0,	// Index 5
+	0xC, 0x0,	// Index 6
+	0xD, 0x0,	// Index 7
+	0xD, 0x3,	// Index 8
+	0xD, 0x3,	// Index 9
+	0xD, 0x0,	// Index 10
+	0xA, 0x0,	// Index 11
+	0x2, 0x3,	// Index 12
+	0x6, 0x0,	// Index 13
+	0x2, 0x0,	// Index 14
+	0xD, 0x2,	// Index 15
+	0xC, 0x0,	// Index 16
+	0xC, 0x0,	// Index 17
+	0xC, 0x0,	// Index 18
+	0xC, 0x0,	// Index 19
+	0xC, 0x0,	// Index 20
+	0xC, 0x0,	// Index 21
+	0xC, 0x0,	// Index 22
+	0xC, 0x0,	// Index 23
+	0xC, 0x0,	// Index 24
+	0xC, 0x0,	// Index 25
+	0x9, 0x0,	// Index 26
+	0x9, 0x3,	// Index 27
+	0xA, 0x0,	// Index 28
+	0x7, 0x0,	// Index 29
+	0xA, 0x0,	// Index 30
+	0xC, 0x0,	// Index 31
+	0xC, 0x2,	// Index 32
+	0xC, 0x0,	// Index 33
+	0xC, 0x0,	// Index 34
+	0xC, 0x0,	// Index 35
+	0xC, 0x0,	// Index 36
+	0xC, 0x0,	// Index 37
+	0xC, 0x0,	// Index 38
+	0xC, 0x0,	// Index 39
+	0xC, 0x0,	// Index 40
+	0xC, 0x0,	// Index 41
+	0xC, 0x0,	// Index 42
+	0xC, 0x0,	// Index 43
+	0xC, 0x0,	// Index 44
+	0xC, 0x0,	// Index 45
+	0xC, 0x0,	// Index 46
+	0xC, 0x0,	// Index 47
+	0xC, 0x0,	// Index 48
+	0xC, 0x3,	// Index 49
+	0xC, 0x0,	// Index 50
+	0xC, 0x0,	// Index 51
+	0xC, 0x0,	// Index 52
+	0xC, 0x0,	// Index 53
+	0xC, 0x0,	// Index 54
+	0xC, 0x0,	// Index 55
+	0xC, 0x0,	// Index 56
+	0xC, 0x0,	// Index 57
+	0xC, 0x0,	// Index 58
+	0xD, 0x3,	// Index 59
+	0xD, 0x2,	// Index 60
+	0xD, 0x3,	// Index 61
+	0xC, 0x0,	// Index 62
+	0x0, 0x2,	// Index 63
+	0xC, 0x0,	// Index 64
+	0x9, 0x0,	// Index 65
+	0xD, 0x0,	// Index 66
+	0x9, 0x0,	// Index 67
+	0xD, 0x0,	// Index 68
+	0x9, 0x0,	// Index 69
+	0xD, 0x0,	// Index 70
+	0x9, 0x3,	// Index 71
+	0xD, 0x0,	// Index 72
+	0xC, 0x0,	// Index 73
+	0xC, 0x3,	// Index 74
+	0xD, 0x0,	// Index 75
+	0xD, 0x0,	// Index 76
+	0x9, 0x0,	// Index 77
+	0x9, 0x0,	// Index 78
+	0x9, 0x0,	// Index 79
+	0x9, 0x3,	// Index 80
+	0x9, 0x3,	// Index 81
+	0x9, 0x0,	// Index 82
+	0x9, 0x0,	// Index 83
+	0xC, 0x0,	// Index 84
+	0x9, 0x0,	// Index 85
+	0x9, 0x0,	// Index 86
+	0x9, 0x0,	// Index 87
+	0x9, 0x0,	// Index 88
+	0x9, 0x3,	// Index 89
+	0x9, 0x0,	// Index 90
+	0xD, 0x3,	// Index 91
+	0xD, 0x3,	// Index 92
+	0xD, 0x3,	// Index 93
+	0x7, 0x0,	// Index 94
+};
+
+const font_t Verdana12 = 
+{
+	Verdana12_bitmaps,
+	Verdana12_offsets,
+	Verdana12_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x10,	// Height 
+	0,	// Flags 
+	Verdana12_extents,
+	0xD	// Ascent 
 };
+
 //---------------------------------------------------------------
 // Group Name: Verdana14
 // Designer: Imported System Font
@@ -1235,398 +1864,607 @@ const unsigned char Verdana12[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Verdana14[] = 
+const unsigned char Verdana14_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x13,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xCD, // Index 1 (offset: 205)
-	0x0, 0xD4, // Index 2 (offset: 212)
-	0x0, 0xE7, // Index 3 (offset: 231)
-	0x1, 0xC, // Index 4 (offset: 268)
-	0x1, 0x28, // Index 5 (offset: 296)
-	0x1, 0x5F, // Index 6 (offset: 351)
-	0x1, 0x87, // Index 7 (offset: 391)
-	0x1, 0x8E, // Index 8 (offset: 398)
-	0x1, 0xA1, // Index 9 (offset: 417)
-	0x1, 0xB4, // Index 10 (offset: 436)
-	0x1, 0xD0, // Index 11 (offset: 464)
-	0x1, 0xF5, // Index 12 (offset: 501)
-	0x2, 0x2, // Index 13 (offset: 514)
-	0x2, 0x15, // Index 14 (offset: 533)
-	0x2, 0x1C, // Index 15 (offset: 540)
-	0x2, 0x35, // Index 16 (offset: 565)
-	0x2, 0x54, // Index 17 (offset: 596)
-	0x2, 0x6D, // Index 18 (offset: 621)
-	0x2, 0x89, // Index 19 (offset: 649)
-	0x2, 0xA5, // Index 20 (offset: 677)
-	0x2, 0xC4, // Index 21 (offset: 708)
-	0x2, 0xE0, // Index 22 (offset: 736)
-	0x2, 0xFF, // Index 23 (offset: 767)
-	0x3, 0x1B, // Index 24 (offset: 795)
-	0x3, 0x3A, // Index 25 (offset: 826)
-	0x3, 0x59, // Index 26 (offset: 857)
-	0x3, 0x60, // Index 27 (offset: 864)
-	0x3, 0x6D, // Index 28 (offset: 877)
-	0x3, 0x8F, // Index 29 (offset: 911)
-	0x3, 0xB1, // Index 30 (offset: 945)
-	0x3, 0xD3, // Index 31 (offset: 979)
-	0x3, 0xEC, // Index 32 (offset: 1004)
-	0x4, 0x1D, // Index 33 (offset: 1053)
-	0x4, 0x45, // Index 34 (offset: 1093)
-	0x4, 0x64, // Index 35 (offset: 1124)
-	0x4, 0x86, // Index 36 (offset: 1158)
-	0x4, 0xAB, // Index 37 (offset: 1195)
-	0x4, 0xC7, // Index 38 (offset: 1223)
-	0x4, 0xE3, // Index 39 (offset: 1251)
-	0x5, 0xB, // Index 40 (offset: 1291)
-	0x5, 0x2A, // Index 41 (offset: 1322)
-	0x5, 0x3D, // Index 42 (offset: 1341)
-	0x5, 0x53, // Index 43 (offset: 1363)
-	0x5, 0x75, // Index 44 (offset: 1397)
-	0x5, 0x91, // Index 45 (offset: 1425)
-	0x5, 0xB6, // Index 46 (offset: 1462)
-	0x5, 0xD5, // Index 47 (offset: 1493)
-	0x5, 0xFD, // Index 48 (offset: 1533)
-	0x6, 0x16, // Index 49 (offset: 1558)
-	0x6, 0x3E, // Index 50 (offset: 1598)
-	0x6, 0x60, // Index 51 (offset: 1632)
-	0x6, 0x82, // Index 52 (offset: 1666)
-	0x6, 0xA7, // Index 53 (offset: 1703)
-	0x6, 0xC6, // Index 54 (offset: 1734)
-	0x6, 0xEE, // Index 55 (offset: 1774)
-	0x7, 0x22, // Index 56 (offset: 1826)
-	0x7, 0x44, // Index 57 (offset: 1860)
-	0x7, 0x69, // Index 58 (offset: 1897)
-	0x7, 0x8B, // Index 59 (offset: 1931)
-	0x7, 0x9B, // Index 60 (offset: 1947)
-	0x7, 0xB4, // Index 61 (offset: 1972)
-	0x7, 0xC4, // Index 62 (offset: 1988)
-	0x7, 0xE9, // Index 63 (offset: 2025)
-	0x8, 0xE, // Index 64 (offset: 2062)
-	0x8, 0x1B, // Index 65 (offset: 2075)
-	0x8, 0x34, // Index 66 (offset: 2100)
-	0x8, 0x50, // Index 67 (offset: 2128)
-	0x8, 0x69, // Index 68 (offset: 2153)
-	0x8, 0x85, // Index 69 (offset: 2181)
-	0x8, 0xA1, // Index 70 (offset: 2209)
-	0x8, 0xB4, // Index 71 (offset: 2228)
-	0x8, 0xD0, // Index 72 (offset: 2256)
-	0x8, 0xE9, // Index 73 (offset: 2281)
-	0x8, 0xF0, // Index 74 (offset: 2288)
-	0x9, 0x0, // Index 75 (offset: 2304)
-	0x9, 0x1C, // Index 76 (offset: 2332)
-	0x9, 0x23, // Index 77 (offset: 2339)
-	0x9, 0x4E, // Index 78 (offset: 2382)
-	0x9, 0x67, // Index 79 (offset: 2407)
-	0x9, 0x86, // Index 80 (offset: 2438)
-	0x9, 0xA2, // Index 81 (offset: 2466)
-	0x9, 0xBE, // Index 82 (offset: 2494)
-	0x9, 0xD1, // Index 83 (offset: 2513)
-	0x9, 0xEA, // Index 84 (offset: 2538)
-	0x9, 0xFD, // Index 85 (offset: 2557)
-	0xA, 0x16, // Index 86 (offset: 2582)
-	0xA, 0x32, // Index 87 (offset: 2610)
-	0xA, 0x5D, // Index 88 (offset: 2653)
-	0xA, 0x79, // Index 89 (offset: 2681)
-	0xA, 0x95, // Index 90 (offset: 2709)
-	0xA, 0xAE, // Index 91 (offset: 2734)
-	0xA, 0xCA, // Index 92 (offset: 2762)
-	0xA, 0xD1, // Index 93 (offset: 2769)
-	0xA, 0xED, // Index 94 (offset: 2797)
-
 	/* Index 0, character 32 " " (width: 3 pixels) */
-	0x3, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 2 pixels) */
-	0x2, 0xFE,0x67,0x00,0xFE,0x67,0x00,
+	0xFE,0x67,0x00,0xFE,0x67,0x00,
 
 	/* Index 2, character 34 """ (width: 6 pixels) */
-	0x6, 0x1F,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x1F,0x00,0x00,
+	0x1F,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x1F,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 12 pixels) */
-	0xC, 0x00,0x04,0x00,0x20,0x04,0x00,0x20,0x64,0x00,0x20,0x1F,0x00,0xF8,0x04,0x00,0x26,0x04,0x00,0x20,0x64,0x00,0x20,0x1F,0x00,0xF8,0x04,0x00,0x26,0x04,0x00,0x20,0x04,0x00,0x20,0x00,0x00,
+	0x00,0x04,0x00,0x20,0x04,0x00,0x20,0x64,0x00,0x20,0x1F,0x00,0xF8,0x04,0x00,0x26,0x04,0x00,0x20,0x64,0x00,0x20,0x1F,0x00,0xF8,0x04,0x00,0x26,0x04,0x00,0x20,0x04,0x00,0x20,0x00,0x00,
 
 	/* Index 4, character 36 "$" (width: 9 pixels) */
-	0x9, 0xE0,0x30,0x00,0xF0,0x61,0x00,0x98,0x61,0x00,0x18,0x63,0x00,0xFF,0xFF,0x03,0x18,0x63,0x00,0x18,0x62,0x00,0x18,0x3E,0x00,0x18,0x1C,0x00,
+	0xE0,0x30,0x00,0xF0,0x61,0x00,0x98,0x61,0x00,0x18,0x63,0x00,0xFF,0xFF,0x03,0x18,0x63,0x00,0x18,0x62,0x00,0x18,0x3E,0x00,0x18,0x1C,0x00,
 
 	/* Index 5, character 37 "%" (width: 18 pixels) */
-	0x12, 0x78,0x00,0x00,0xFE,0x01,0x00,0x02,0x01,0x00,0x02,0x01,0x00,0x02,0x01,0x00,0xFE,0x41,0x00,0x78,0x70,0x00,0x00,0x1C,0x00,0x00,0x07,0x00,0xE0,0x00,0x00,0x38,0x00,0x00,0x0E,0x1E,0x00,0x82,0x7F,0x00,0x80,0x40,0x00,0x80,0x40,0x00,0x80,0x40,0x00,0x80,0x7F,0x00,0x00,0x1E,0x00,
+	0x78,0x00,0x00,0xFE,0x01,0x00,0x02,0x01,0x00,0x02,0x01,0x00,0x02,0x01,0x00,0xFE,0x41,0x00,0x78,0x70,0x00,0x00,0x1C,0x00,0x00,0x07,0x00,0xE0,0x00,0x00,0x38,0x00,0x00,0x0E,0x1E,0x00,0x82,0x7F,0x00,0x80,0x40,0x00,0x80,0x40,0x00,0x80,0x40,0x00,0x80,0x7F,0x00,0x00,0x1E,0x00,
 
 	/* Index 6, character 38 "&" (width: 13 pixels) */
-	0xD, 0x00,0x1E,0x00,0x3C,0x3F,0x00,0xFC,0x71,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x61,0x00,0x7E,0x63,0x00,0x3C,0x36,0x00,0x00,0x1C,0x00,0x80,0x1F,0x00,0x80,0x37,0x00,0x00,0x60,0x00,0x00,0x40,0x00,
+	0x00,0x1E,0x00,0x3C,0x3F,0x00,0xFC,0x71,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x61,0x00,0x7E,0x63,0x00,0x3C,0x36,0x00,0x00,0x1C,0x00,0x80,0x1F,0x00,0x80,0x37,0x00,0x00,0x60,0x00,0x00,0x40,0x00,
 
 	/* Index 7, character 39 "'" (width: 2 pixels) */
-	0x2, 0x1F,0x00,0x00,0x1F,0x00,0x00,
+	0x1F,0x00,0x00,0x1F,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 6 pixels) */
-	0x6, 0xC0,0x1F,0x00,0xF8,0xFF,0x00,0x3C,0xE0,0x01,0x07,0x00,0x07,0x03,0x00,0x06,0x01,0x00,0x04,
+	0xC0,0x1F,0x00,0xF8,0xFF,0x00,0x3C,0xE0,0x01,0x07,0x00,0x07,0x03,0x00,0x06,0x01,0x00,0x04,
 
 	/* Index 9, character 41 ")" (width: 6 pixels) */
-	0x6, 0x01,0x00,0x04,0x03,0x00,0x06,0x07,0x00,0x07,0x3C,0xE0,0x01,0xF8,0xFF,0x00,0xC0,0x1F,0x00,
+	0x01,0x00,0x04,0x03,0x00,0x06,0x07,0x00,0x07,0x3C,0xE0,0x01,0xF8,0xFF,0x00,0xC0,0x1F,0x00,
 
 	/* Index 10, character 42 "*" (width: 9 pixels) */
-	0x9, 0xC6,0x00,0x00,0x44,0x00,0x00,0x6C,0x00,0x00,0x28,0x00,0x00,0xFF,0x01,0x00,0x28,0x00,0x00,0x6C,0x00,0x00,0x44,0x00,0x00,0xC6,0x00,0x00,
+	0xC6,0x00,0x00,0x44,0x00,0x00,0x6C,0x00,0x00,0x28,0x00,0x00,0xFF,0x01,0x00,0x28,0x00,0x00,0x6C,0x00,0x00,0x44,0x00,0x00,0xC6,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 12 pixels) */
-	0xC, 0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
+	0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
 
 	/* Index 12, character 44 "," (width: 4 pixels) */
-	0x4, 0x00,0x00,0x03,0x00,0xF0,0x03,0x00,0x70,0x00,0x00,0x10,0x00,
+	0x00,0x00,0x03,0x00,0xF0,0x03,0x00,0x70,0x00,0x00,0x10,0x00,
 
 	/* Index 13, character 45 "-" (width: 6 pixels) */
-	0x6, 0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
+	0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
 
 	/* Index 14, character 46 "." (width: 2 pixels) */
-	0x2, 0x00,0x70,0x00,0x00,0x70,0x00,
+	0x00,0x70,0x00,0x00,0x70,0x00,
 
 	/* Index 15, character 47 "/" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x03,0x00,0xE0,0x03,0x00,0xFC,0x01,0x80,0x3F,0x00,0xF0,0x07,0x00,0xFE,0x00,0x00,0x1F,0x00,0x00,0x03,0x00,0x00,
+	0x00,0x00,0x03,0x00,0xE0,0x03,0x00,0xFC,0x01,0x80,0x3F,0x00,0xF0,0x07,0x00,0xFE,0x00,0x00,0x1F,0x00,0x00,0x03,0x00,0x00,
 
 	/* Index 16, character 48 "0" (width: 10 pixels) */
-	0xA, 0xF0,0x0F,0x00,0xFC,0x3F,0x00,0x0C,0x30,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0C,0x30,0x00,0xFC,0x3F,0x00,0xF0,0x0F,0x00,
+	0xF0,0x0F,0x00,0xFC,0x3F,0x00,0x0C,0x30,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0C,0x30,0x00,0xFC,0x3F,0x00,0xF0,0x0F,0x00,
 
 	/* Index 17, character 49 "1" (width: 8 pixels) */
-	0x8, 0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,
+	0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,
 
 	/* Index 18, character 50 "2" (width: 9 pixels) */
-	0x9, 0x0C,0x70,0x00,0x06,0x78,0x00,0x06,0x6C,0x00,0x06,0x66,0x00,0x06,0x63,0x00,0x8E,0x61,0x00,0xFC,0x60,0x00,0x78,0x60,0x00,0x00,0x60,0x00,
+	0x0C,0x70,0x00,0x06,0x78,0x00,0x06,0x6C,0x00,0x06,0x66,0x00,0x06,0x63,0x00,0x8E,0x61,0x00,0xFC,0x60,0x00,0x78,0x60,0x00,0x00,0x60,0x00,
 
 	/* Index 19, character 51 "3" (width: 9 pixels) */
-	0x9, 0x0C,0x30,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0xCE,0x73,0x00,0x7C,0x3F,0x00,0x38,0x1E,0x00,
+	0x0C,0x30,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0xCE,0x73,0x00,0x7C,0x3F,0x00,0x38,0x1E,0x00,
 
 	/* Index 20, character 52 "4" (width: 10 pixels) */
-	0xA, 0x00,0x07,0x00,0x80,0x07,0x00,0xC0,0x07,0x00,0xF0,0x06,0x00,0x38,0x06,0x00,0x1C,0x06,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x06,0x00,0x00,0x06,0x00,
+	0x00,0x07,0x00,0x80,0x07,0x00,0xC0,0x07,0x00,0xF0,0x06,0x00,0x38,0x06,0x00,0x1C,0x06,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x06,0x00,0x00,0x06,0x00,
 
 	/* Index 21, character 53 "5" (width: 9 pixels) */
-	0x9, 0x00,0x30,0x00,0xFE,0x60,0x00,0xFE,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x31,0x00,0x86,0x3F,0x00,0x06,0x0F,0x00,
+	0x00,0x30,0x00,0xFE,0x60,0x00,0xFE,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x31,0x00,0x86,0x3F,0x00,0x06,0x0F,0x00,
 
 	/* Index 22, character 54 "6" (width: 10 pixels) */
-	0xA, 0xE0,0x0F,0x00,0xF0,0x3F,0x00,0x9C,0x30,0x00,0xCC,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x31,0x00,0x86,0x3F,0x00,0x00,0x0F,0x00,
+	0xE0,0x0F,0x00,0xF0,0x3F,0x00,0x9C,0x30,0x00,0xCC,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x31,0x00,0x86,0x3F,0x00,0x00,0x0F,0x00,
 
 	/* Index 23, character 55 "7" (width: 9 pixels) */
-	0x9, 0x06,0x00,0x00,0x06,0x40,0x00,0x06,0x70,0x00,0x06,0x7C,0x00,0x06,0x0F,0x00,0xC6,0x03,0x00,0xF6,0x00,0x00,0x3E,0x00,0x00,0x0E,0x00,0x00,
+	0x06,0x00,0x00,0x06,0x40,0x00,0x06,0x70,0x00,0x06,0x7C,0x00,0x06,0x0F,0x00,0xC6,0x03,0x00,0xF6,0x00,0x00,0x3E,0x00,0x00,0x0E,0x00,0x00,
 
 	/* Index 24, character 56 "8" (width: 10 pixels) */
-	0xA, 0x38,0x1E,0x00,0x7C,0x3F,0x00,0xCE,0x71,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x4E,0x73,0x00,0x7C,0x3F,0x00,0x38,0x1E,0x00,
+	0x38,0x1E,0x00,0x7C,0x3F,0x00,0xCE,0x71,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x4E,0x73,0x00,0x7C,0x3F,0x00,0x38,0x1E,0x00,
 
 	/* Index 25, character 57 "9" (width: 10 pixels) */
-	0xA, 0xF0,0x00,0x00,0xFC,0x61,0x00,0x8C,0x63,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x06,0x33,0x00,0x0C,0x39,0x00,0xFC,0x1F,0x00,0xF0,0x07,0x00,
+	0xF0,0x00,0x00,0xFC,0x61,0x00,0x8C,0x63,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x06,0x33,0x00,0x0C,0x39,0x00,0xFC,0x1F,0x00,0xF0,0x07,0x00,
 
 	/* Index 26, character 58 ":" (width: 2 pixels) */
-	0x2, 0x70,0x70,0x00,0x70,0x70,0x00,
+	0x70,0x70,0x00,0x70,0x70,0x00,
 
 	/* Index 27, character 59 ";" (width: 4 pixels) */
-	0x4, 0x00,0x00,0x03,0x70,0xF0,0x03,0x70,0x70,0x00,0x00,0x10,0x00,
+	0x00,0x00,0x03,0x70,0xF0,0x03,0x70,0x70,0x00,0x00,0x10,0x00,
 
 	/* Index 28, character 60 "<" (width: 11 pixels) */
-	0xB, 0x00,0x01,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x30,0x18,0x00,0x30,0x18,0x00,0x18,0x30,0x00,0x18,0x30,0x00,
+	0x00,0x01,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x30,0x18,0x00,0x30,0x18,0x00,0x18,0x30,0x00,0x18,0x30,0x00,
 
 	/* Index 29, character 61 "=" (width: 11 pixels) */
-	0xB, 0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,
+	0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,
 
 	/* Index 30, character 62 ">" (width: 11 pixels) */
-	0xB, 0x18,0x30,0x00,0x18,0x30,0x00,0x30,0x18,0x00,0x30,0x18,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x00,0x01,0x00,
+	0x18,0x30,0x00,0x18,0x30,0x00,0x30,0x18,0x00,0x30,0x18,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x00,0x01,0x00,
 
 	/* Index 31, character 63 "?" (width: 8 pixels) */
-	0x8, 0x0C,0x00,0x00,0x06,0x00,0x00,0x06,0x67,0x00,0x06,0x67,0x00,0x86,0x01,0x00,0xCE,0x00,0x00,0xFC,0x00,0x00,0x38,0x00,0x00,
+	0x0C,0x00,0x00,0x06,0x00,0x00,0x06,0x67,0x00,0x06,0x67,0x00,0x86,0x01,0x00,0xCE,0x00,0x00,0xFC,0x00,0x00,0x38,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 16 pixels) */
-	0x10, 0xC0,0x0F,0x00,0xF0,0x3F,0x00,0x38,0x70,0x00,0x0C,0xC0,0x00,0x84,0x8F,0x00,0xC6,0x9F,0x01,0x62,0x30,0x01,0x22,0x20,0x01,0x22,0x20,0x01,0x22,0x10,0x01,0xE2,0x3F,0x01,0xE4,0xBF,0x01,0x0C,0x20,0x00,0x38,0x20,0x00,0xF0,0x3F,0x00,0xC0,0x0F,0x00,
+	0xC0,0x0F,0x00,0xF0,0x3F,0x00,0x38,0x70,0x00,0x0C,0xC0,0x00,0x84,0x8F,0x00,0xC6,0x9F,0x01,0x62,0x30,0x01,0x22,0x20,0x01,0x22,0x20,0x01,0x22,0x10,0x01,0xE2,0x3F,0x01,0xE4,0xBF,0x01,0x0C,0x20,0x00,0x38,0x20,0x00,0xF0,0x3F,0x00,0xC0,0x0F,0x00,
 
 	/* Index 33, character 65 "A" (width: 13 pixels) */
-	0xD, 0x00,0x40,0x00,0x00,0x78,0x00,0x00,0x3F,0x00,0xC0,0x07,0x00,0xF8,0x06,0x00,0x3E,0x06,0x00,0x06,0x06,0x00,0x3E,0x06,0x00,0xF8,0x06,0x00,0xC0,0x07,0x00,0x00,0x3F,0x00,0x00,0x78,0x00,0x00,0x40,0x00,
+	0x00,0x40,0x00,0x00,0x78,0x00,0x00,0x3F,0x00,0xC0,0x07,0x00,0xF8,0x06,0x00,0x3E,0x06,0x00,0x06,0x06,0x00,0x3E,0x06,0x00,0xF8,0x06,0x00,0xC0,0x07,0x00,0x00,0x3F,0x00,0x00,0x78,0x00,0x00,0x40,0x00,
 
 	/* Index 34, character 66 "B" (width: 10 pixels) */
-	0xA, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0xC6,0x61,0x00,0x7C,0x73,0x00,0x3C,0x3F,0x00,0x00,0x1E,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0xC6,0x61,0x00,0x7C,0x73,0x00,0x3C,0x3F,0x00,0x00,0x1E,0x00,
 
 	/* Index 35, character 67 "C" (width: 11 pixels) */
-	0xB, 0xE0,0x07,0x00,0xF8,0x1F,0x00,0x1C,0x38,0x00,0x0C,0x30,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x20,0x00,0x0C,0x30,0x00,
+	0xE0,0x07,0x00,0xF8,0x1F,0x00,0x1C,0x38,0x00,0x0C,0x30,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x20,0x00,0x0C,0x30,0x00,
 
 	/* Index 36, character 68 "D" (width: 12 pixels) */
-	0xC, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0E,0x70,0x00,0x0C,0x30,0x00,0x38,0x1C,0x00,0xF8,0x0F,0x00,0xE0,0x07,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0E,0x70,0x00,0x0C,0x30,0x00,0x38,0x1C,0x00,0xF8,0x0F,0x00,0xE0,0x07,0x00,
 
 	/* Index 37, character 69 "E" (width: 9 pixels) */
-	0x9, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,0xC6,0x60,0x00,
 
 	/* Index 38, character 70 "F" (width: 9 pixels) */
-	0x9, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x06,0x00,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x06,0x00,0x00,
 
 	/* Index 39, character 71 "G" (width: 13 pixels) */
-	0xD, 0xE0,0x07,0x00,0xF8,0x1F,0x00,0x3C,0x3C,0x00,0x0C,0x30,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x0C,0x3F,0x00,0x0C,0x3F,0x00,
+	0xE0,0x07,0x00,0xF8,0x1F,0x00,0x3C,0x3C,0x00,0x0C,0x30,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x06,0x63,0x00,0x0C,0x3F,0x00,0x0C,0x3F,0x00,
 
 	/* Index 40, character 72 "H" (width: 10 pixels) */
-	0xA, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
 
 	/* Index 41, character 73 "I" (width: 6 pixels) */
-	0x6, 0x06,0x60,0x00,0x06,0x60,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x60,0x00,0x06,0x60,0x00,
+	0x06,0x60,0x00,0x06,0x60,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x60,0x00,0x06,0x60,0x00,
 
 	/* Index 42, character 74 "J" (width: 7 pixels) */
-	0x7, 0x00,0x60,0x00,0x00,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x70,0x00,0xFE,0x3F,0x00,0xFE,0x1F,0x00,
+	0x00,0x60,0x00,0x00,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x70,0x00,0xFE,0x3F,0x00,0xFE,0x1F,0x00,
 
 	/* Index 43, character 75 "K" (width: 11 pixels) */
-	0xB, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x80,0x03,0x00,0xC0,0x01,0x00,0xE0,0x03,0x00,0x70,0x07,0x00,0x38,0x1C,0x00,0x1C,0x38,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x02,0x40,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x80,0x03,0x00,0xC0,0x01,0x00,0xE0,0x03,0x00,0x70,0x07,0x00,0x38,0x1C,0x00,0x1C,0x38,0x00,0x0E,0x70,0x00,0x06,0x60,0x00,0x02,0x40,0x00,
 
 	/* Index 44, character 76 "L" (width: 9 pixels) */
-	0x9, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,
 
 	/* Index 45, character 77 "M" (width: 12 pixels) */
-	0xC, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x0E,0x00,0x00,0x38,0x00,0x00,0xE0,0x01,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0xE0,0x01,0x00,0x38,0x00,0x00,0x0E,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x0E,0x00,0x00,0x38,0x00,0x00,0xE0,0x01,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0xE0,0x01,0x00,0x38,0x00,0x00,0x0E,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
 
 	/* Index 46, character 78 "N" (width: 10 pixels) */
-	0xA, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x0E,0x00,0x00,0x3C,0x00,0x00,0xE0,0x00,0x00,0x80,0x03,0x00,0x00,0x1E,0x00,0x00,0x78,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x0E,0x00,0x00,0x3C,0x00,0x00,0xE0,0x00,0x00,0x80,0x03,0x00,0x00,0x1E,0x00,0x00,0x78,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,
 
 	/* Index 47, character 79 "O" (width: 13 pixels) */
-	0xD, 0xE0,0x07,0x00,0xF8,0x1F,0x00,0x1C,0x38,0x00,0x0C,0x30,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0C,0x30,0x00,0x1C,0x38,0x00,0xF8,0x1F,0x00,0xE0,0x07,0x00,
+	0xE0,0x07,0x00,0xF8,0x1F,0x00,0x1C,0x38,0x00,0x0C,0x30,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0C,0x30,0x00,0x1C,0x38,0x00,0xF8,0x1F,0x00,0xE0,0x07,0x00,
 
 	/* Index 48, character 80 "P" (width: 8 pixels) */
-	0x8, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x03,0x00,0x06,0x03,0x00,0x06,0x03,0x00,0x8E,0x03,0x00,0xFC,0x01,0x00,0xF8,0x00,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x03,0x00,0x06,0x03,0x00,0x06,0x03,0x00,0x8E,0x03,0x00,0xFC,0x01,0x00,0xF8,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 13 pixels) */
-	0xD, 0xE0,0x07,0x00,0xF8,0x1F,0x00,0x1C,0x38,0x00,0x0C,0x30,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0xE0,0x01,0x06,0xE0,0x03,0x0C,0x30,0x07,0x1C,0x38,0x06,0xF8,0x1F,0x06,0xE0,0x07,0x06,
+	0xE0,0x07,0x00,0xF8,0x1F,0x00,0x1C,0x38,0x00,0x0C,0x30,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0xE0,0x01,0x06,0xE0,0x03,0x0C,0x30,0x07,0x1C,0x38,0x06,0xF8,0x1F,0x06,0xE0,0x07,0x06,
 
 	/* Index 50, character 82 "R" (width: 11 pixels) */
-	0xB, 0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x07,0x00,0xCE,0x0E,0x00,0xFC,0x1C,0x00,0x78,0x70,0x00,0x00,0x60,0x00,0x00,0x40,0x00,
+	0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x07,0x00,0xCE,0x0E,0x00,0xFC,0x1C,0x00,0x78,0x70,0x00,0x00,0x60,0x00,0x00,0x40,0x00,
 
 	/* Index 51, character 83 "S" (width: 11 pixels) */
-	0xB, 0x78,0x30,0x00,0xFC,0x70,0x00,0xCE,0x60,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x06,0x33,0x00,0x0C,0x3F,0x00,0x00,0x1E,0x00,
+	0x78,0x30,0x00,0xFC,0x70,0x00,0xCE,0x60,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x86,0x61,0x00,0x06,0x33,0x00,0x0C,0x3F,0x00,0x00,0x1E,0x00,
 
 	/* Index 52, character 84 "T" (width: 12 pixels) */
-	0xC, 0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,
+	0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,
 
 	/* Index 53, character 85 "U" (width: 10 pixels) */
-	0xA, 0xFE,0x0F,0x00,0xFE,0x3F,0x00,0x00,0x70,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x70,0x00,0xFE,0x3F,0x00,0xFE,0x0F,0x00,
+	0xFE,0x0F,0x00,0xFE,0x3F,0x00,0x00,0x70,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x70,0x00,0xFE,0x3F,0x00,0xFE,0x0F,0x00,
 
 	/* Index 54, character 86 "V" (width: 13 pixels) */
-	0xD, 0x02,0x00,0x00,0x1E,0x00,0x00,0xFC,0x00,0x00,0xE0,0x03,0x00,0x80,0x1F,0x00,0x00,0x7C,0x00,0x00,0x60,0x00,0x00,0x7C,0x00,0x80,0x1F,0x00,0xE0,0x03,0x00,0xFC,0x00,0x00,0x1E,0x00,0x00,0x02,0x00,0x00,
+	0x02,0x00,0x00,0x1E,0x00,0x00,0xFC,0x00,0x00,0xE0,0x03,0x00,0x80,0x1F,0x00,0x00,0x7C,0x00,0x00,0x60,0x00,0x00,0x7C,0x00,0x80,0x1F,0x00,0xE0,0x03,0x00,0xFC,0x00,0x00,0x1E,0x00,0x00,0x02,0x00,0x00,
 
 	/* Index 55, character 87 "W" (width: 17 pixels) */
-	0x11, 0x06,0x00,0x00,0x7E,0x00,0x00,0xF8,0x07,0x00,0x80,0x3F,0x00,0x00,0x78,0x00,0x00,0x7C,0x00,0xC0,0x0F,0x00,0x7E,0x00,0x00,0x06,0x00,0x00,0x7E,0x00,0x00,0xE0,0x07,0x00,0x00,0x7E,0x00,0x00,0x70,0x00,0x80,0x7F,0x00,0xF8,0x07,0x00,0x7E,0x00,0x00,0x06,0x00,0x00,
+	0x06,0x00,0x00,0x7E,0x00,0x00,0xF8,0x07,0x00,0x80,0x3F,0x00,0x00,0x78,0x00,0x00,0x7C,0x00,0xC0,0x0F,0x00,0x7E,0x00,0x00,0x06,0x00,0x00,0x7E,0x00,0x00,0xE0,0x07,0x00,0x00,0x7E,0x00,0x00,0x70,0x00,0x80,0x7F,0x00,0xF8,0x07,0x00,0x7E,0x00,0x00,0x06,0x00,0x00,
 
 	/* Index 56, character 88 "X" (width: 11 pixels) */
-	0xB, 0x02,0x40,0x00,0x06,0x60,0x00,0x1E,0x78,0x00,0x38,0x1C,0x00,0xE0,0x07,0x00,0x80,0x01,0x00,0xE0,0x07,0x00,0x38,0x1E,0x00,0x1E,0x78,0x00,0x06,0x60,0x00,0x02,0x40,0x00,
+	0x02,0x40,0x00,0x06,0x60,0x00,0x1E,0x78,0x00,0x38,0x1C,0x00,0xE0,0x07,0x00,0x80,0x01,0x00,0xE0,0x07,0x00,0x38,0x1E,0x00,0x1E,0x78,0x00,0x06,0x60,0x00,0x02,0x40,0x00,
 
 	/* Index 57, character 89 "Y" (width: 12 pixels) */
-	0xC, 0x02,0x00,0x00,0x06,0x00,0x00,0x1E,0x00,0x00,0x78,0x00,0x00,0xE0,0x00,0x00,0xC0,0x7F,0x00,0xC0,0x7F,0x00,0xE0,0x00,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,
+	0x02,0x00,0x00,0x06,0x00,0x00,0x1E,0x00,0x00,0x78,0x00,0x00,0xE0,0x00,0x00,0xC0,0x7F,0x00,0xC0,0x7F,0x00,0xE0,0x00,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,
 
 	/* Index 58, character 90 "Z" (width: 11 pixels) */
-	0xB, 0x06,0x70,0x00,0x06,0x78,0x00,0x06,0x7C,0x00,0x06,0x6E,0x00,0x06,0x67,0x00,0xC6,0x63,0x00,0xE6,0x60,0x00,0x76,0x60,0x00,0x3E,0x60,0x00,0x1E,0x60,0x00,0x0E,0x60,0x00,
+	0x06,0x70,0x00,0x06,0x78,0x00,0x06,0x7C,0x00,0x06,0x6E,0x00,0x06,0x67,0x00,0xC6,0x63,0x00,0xE6,0x60,0x00,0x76,0x60,0x00,0x3E,0x60,0x00,0x1E,0x60,0x00,0x0E,0x60,0x00,
 
 	/* Index 59, character 91 "[" (width: 5 pixels) */
-	0x5, 0xFF,0xFF,0x07,0xFF,0xFF,0x07,0x01,0x00,0x04,0x01,0x00,0x04,0x01,0x00,0x04,
+	0xFF,0xFF,0x07,0xFF,0xFF,0x07,0x01,0x00,0x04,0x01,0x00,0x04,0x01,0x00,0x04,
 
 	/* Index 60, character 92 "\" (width: 8 pixels) */
-	0x8, 0x03,0x00,0x00,0x1F,0x00,0x00,0xFE,0x00,0x00,0xF0,0x07,0x00,0x80,0x3F,0x00,0x00,0xFC,0x01,0x00,0xE0,0x03,0x00,0x00,0x03,
+	0x03,0x00,0x00,0x1F,0x00,0x00,0xFE,0x00,0x00,0xF0,0x07,0x00,0x80,0x3F,0x00,0x00,0xFC,0x01,0x00,0xE0,0x03,0x00,0x00,0x03,
 
 	/* Index 61, character 93 "]" (width: 5 pixels) */
-	0x5, 0x01,0x00,0x04,0x01,0x00,0x04,0x01,0x00,0x04,0xFF,0xFF,0x07,0xFF,0xFF,0x07,
+	0x01,0x00,0x04,0x01,0x00,0x04,0x01,0x00,0x04,0xFF,0xFF,0x07,0xFF,0xFF,0x07,
 
 	/* Index 62, character 94 "^" (width: 12 pixels) */
-	0xC, 0x80,0x00,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x38,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x60,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,0x00,
+	0x80,0x00,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x38,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x60,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,0x00,
 
 	/* Index 63, character 95 "_" (width: 12 pixels) */
-	0xC, 0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,
+	0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,
 
 	/* Index 64, character 96 "`" (width: 4 pixels) */
-	0x4, 0x01,0x00,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x04,0x00,0x00,
+	0x01,0x00,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x04,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 8 pixels) */
-	0x8, 0x00,0x3C,0x00,0x30,0x7E,0x00,0x30,0x67,0x00,0x30,0x63,0x00,0x30,0x63,0x00,0x30,0x33,0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,
+	0x00,0x3C,0x00,0x30,0x7E,0x00,0x30,0x67,0x00,0x30,0x63,0x00,0x30,0x63,0x00,0x30,0x33,0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,
 
 	/* Index 66, character 98 "b" (width: 9 pixels) */
-	0x9, 0xFF,0x7F,0x00,0xFF,0x7F,0x00,0x60,0x20,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x70,0x70,0x00,0xE0,0x3F,0x00,0xC0,0x0F,0x00,
+	0xFF,0x7F,0x00,0xFF,0x7F,0x00,0x60,0x20,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x70,0x70,0x00,0xE0,0x3F,0x00,0xC0,0x0F,0x00,
 
 	/* Index 67, character 99 "c" (width: 8 pixels) */
-	0x8, 0x80,0x0F,0x00,0xE0,0x3F,0x00,0x60,0x30,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x60,0x30,0x00,
+	0x80,0x0F,0x00,0xE0,0x3F,0x00,0x60,0x30,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x60,0x30,0x00,
 
 	/* Index 68, character 100 "d" (width: 9 pixels) */
-	0x9, 0x80,0x1F,0x00,0xE0,0x3F,0x00,0x70,0x70,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x30,0x00,0xFF,0x7F,0x00,0xFF,0x7F,0x00,
+	0x80,0x1F,0x00,0xE0,0x3F,0x00,0x70,0x70,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x30,0x00,0xFF,0x7F,0x00,0xFF,0x7F,0x00,
 
 	/* Index 69, character 101 "e" (width: 9 pixels) */
-	0x9, 0x80,0x0F,0x00,0xE0,0x3F,0x00,0x60,0x33,0x00,0x30,0x63,0x00,0x30,0x63,0x00,0x30,0x63,0x00,0x70,0x63,0x00,0xE0,0x63,0x00,0xC0,0x33,0x00,
+	0x80,0x0F,0x00,0xE0,0x3F,0x00,0x60,0x33,0x00,0x30,0x63,0x00,0x30,0x63,0x00,0x30,0x63,0x00,0x70,0x63,0x00,0xE0,0x63,0x00,0xC0,0x33,0x00,
 
 	/* Index 70, character 102 "f" (width: 6 pixels) */
-	0x6, 0x30,0x00,0x00,0xFE,0x7F,0x00,0xFF,0x7F,0x00,0x33,0x00,0x00,0x33,0x00,0x00,0x03,0x00,0x00,
+	0x30,0x00,0x00,0xFE,0x7F,0x00,0xFF,0x7F,0x00,0x33,0x00,0x00,0x33,0x00,0x00,0x03,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 9 pixels) */
-	0x9, 0x80,0x1F,0x00,0xE0,0x3F,0x06,0x70,0x70,0x06,0x30,0x60,0x06,0x30,0x60,0x06,0x30,0x60,0x06,0x30,0x30,0x07,0xF0,0xFF,0x03,0xF0,0xFF,0x01,
+	0x80,0x1F,0x00,0xE0,0x3F,0x06,0x70,0x70,0x06,0x30,0x60,0x06,0x30,0x60,0x06,0x30,0x60,0x06,0x30,0x30,0x07,0xF0,0xFF,0x03,0xF0,0xFF,0x01,
 
 	/* Index 72, character 104 "h" (width: 8 pixels) */
-	0x8, 0xFF,0x7F,0x00,0xFF,0x7F,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,
+	0xFF,0x7F,0x00,0xFF,0x7F,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,
 
 	/* Index 73, character 105 "i" (width: 2 pixels) */
-	0x2, 0xF6,0x7F,0x00,0xF6,0x7F,0x00,
+	0xF6,0x7F,0x00,0xF6,0x7F,0x00,
 
 	/* Index 74, character 106 "j" (width: 5 pixels) */
-	0x5, 0x00,0x00,0x06,0x30,0x00,0x06,0x30,0x00,0x06,0xF6,0xFF,0x07,0xF6,0xFF,0x03,
+	0x00,0x00,0x06,0x30,0x00,0x06,0x30,0x00,0x06,0xF6,0xFF,0x07,0xF6,0xFF,0x03,
 
 	/* Index 75, character 107 "k" (width: 9 pixels) */
-	0x9, 0xFF,0x7F,0x00,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x07,0x00,0x80,0x0F,0x00,0xC0,0x38,0x00,0x70,0x70,0x00,0x30,0x60,0x00,0x10,0x40,0x00,
+	0xFF,0x7F,0x00,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x07,0x00,0x80,0x0F,0x00,0xC0,0x38,0x00,0x70,0x70,0x00,0x30,0x60,0x00,0x10,0x40,0x00,
 
 	/* Index 76, character 108 "l" (width: 2 pixels) */
-	0x2, 0xFF,0x7F,0x00,0xFF,0x7F,0x00,
+	0xFF,0x7F,0x00,0xFF,0x7F,0x00,
 
 	/* Index 77, character 109 "m" (width: 14 pixels) */
-	0xE, 0xF0,0x7F,0x00,0xF0,0x7F,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,
+	0xF0,0x7F,0x00,0xF0,0x7F,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,
 
 	/* Index 78, character 110 "n" (width: 8 pixels) */
-	0x8, 0xF0,0x7F,0x00,0xF0,0x7F,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,
+	0xF0,0x7F,0x00,0xF0,0x7F,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,
 
 	/* Index 79, character 111 "o" (width: 10 pixels) */
-	0xA, 0x80,0x0F,0x00,0xE0,0x3F,0x00,0x60,0x30,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x60,0x30,0x00,0xE0,0x3F,0x00,0x80,0x0F,0x00,
+	0x80,0x0F,0x00,0xE0,0x3F,0x00,0x60,0x30,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x60,0x30,0x00,0xE0,0x3F,0x00,0x80,0x0F,0x00,
 
 	/* Index 80, character 112 "p" (width: 9 pixels) */
-	0x9, 0xF0,0xFF,0x07,0xF0,0xFF,0x07,0x60,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x70,0x70,0x00,0xE0,0x3F,0x00,0xC0,0x0F,0x00,
+	0xF0,0xFF,0x07,0xF0,0xFF,0x07,0x60,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x70,0x70,0x00,0xE0,0x3F,0x00,0xC0,0x0F,0x00,
 
 	/* Index 81, character 113 "q" (width: 9 pixels) */
-	0x9, 0x80,0x1F,0x00,0xE0,0x3F,0x00,0x70,0x70,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x30,0x00,0xF0,0xFF,0x07,0xF0,0xFF,0x07,
+	0x80,0x1F,0x00,0xE0,0x3F,0x00,0x70,0x70,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x30,0x00,0xF0,0xFF,0x07,0xF0,0xFF,0x07,
 
 	/* Index 82, character 114 "r" (width: 6 pixels) */
-	0x6, 0xF0,0x7F,0x00,0xF0,0x7F,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,
+	0xF0,0x7F,0x00,0xF0,0x7F,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 8 pixels) */
-	0x8, 0xC0,0x31,0x00,0xE0,0x63,0x00,0x30,0x63,0x00,0x30,0x63,0x00,0x30,0x66,0x00,0x30,0x66,0x00,0x30,0x3E,0x00,0x60,0x1C,0x00,
+	0xC0,0x31,0x00,0xE0,0x63,0x00,0x30,0x63,0x00,0x30,0x63,0x00,0x30,0x66,0x00,0x30,0x66,0x00,0x30,0x3E,0x00,0x60,0x1C,0x00,
 
 	/* Index 84, character 116 "t" (width: 6 pixels) */
-	0x6, 0x30,0x00,0x00,0xFE,0x3F,0x00,0xFE,0x7F,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,
+	0x30,0x00,0x00,0xFE,0x3F,0x00,0xFE,0x7F,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,
 
 	/* Index 85, character 117 "u" (width: 8 pixels) */
-	0x8, 0xF0,0x1F,0x00,0xF0,0x7F,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x30,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,
+	0xF0,0x1F,0x00,0xF0,0x7F,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x30,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,
 
 	/* Index 86, character 118 "v" (width: 9 pixels) */
-	0x9, 0x10,0x00,0x00,0xF0,0x00,0x00,0xE0,0x07,0x00,0x00,0x3E,0x00,0x00,0x60,0x00,0x00,0x3E,0x00,0xE0,0x07,0x00,0xF0,0x00,0x00,0x10,0x00,0x00,
+	0x10,0x00,0x00,0xF0,0x00,0x00,0xE0,0x07,0x00,0x00,0x3E,0x00,0x00,0x60,0x00,0x00,0x3E,0x00,0xE0,0x07,0x00,0xF0,0x00,0x00,0x10,0x00,0x00,
 
 	/* Index 87, character 119 "w" (width: 14 pixels) */
-	0xE, 0x30,0x00,0x00,0xF0,0x03,0x00,0xC0,0x3F,0x00,0x00,0x78,0x00,0x00,0x7C,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xC0,0x07,0x00,0x00,0x3C,0x00,0x00,0x70,0x00,0xC0,0x3F,0x00,0xF0,0x03,0x00,0x30,0x00,0x00,
+	0x30,0x00,0x00,0xF0,0x03,0x00,0xC0,0x3F,0x00,0x00,0x78,0x00,0x00,0x7C,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xC0,0x07,0x00,0x00,0x3C,0x00,0x00,0x70,0x00,0xC0,0x3F,0x00,0xF0,0x03,0x00,0x30,0x00,0x00,
 
 	/* Index 88, character 120 "x" (width: 9 pixels) */
-	0x9, 0x10,0x40,0x00,0x30,0x60,0x00,0xF0,0x78,0x00,0xC0,0x1D,0x00,0x00,0x07,0x00,0xC0,0x1D,0x00,0xF0,0x78,0x00,0x30,0x60,0x00,0x10,0x40,0x00,
+	0x10,0x40,0x00,0x30,0x60,0x00,0xF0,0x78,0x00,0xC0,0x1D,0x00,0x00,0x07,0x00,0xC0,0x1D,0x00,0xF0,0x78,0x00,0x30,0x60,0x00,0x10,0x40,0x00,
 
 	/* Index 89, character 121 "y" (width: 9 pixels) */
-	0x9, 0x10,0x00,0x00,0xF0,0x00,0x00,0xE0,0x07,0x06,0x00,0xBF,0x07,0x00,0xF0,0x01,0x00,0x3F,0x00,0xE0,0x07,0x00,0xF0,0x00,0x00,0x10,0x00,0x00,
+	0x10,0x00,0x00,0xF0,0x00,0x00,0xE0,0x07,0x06,0x00,0xBF,0x07,0x00,0xF0,0x01,0x00,0x3F,0x00,0xE0,0x07,0x00,0xF0,0x00,0x00,0x10,0x00,0x00,
 
 	/* Index 90, character 122 "z" (width: 8 pixels) */
-	0x8, 0x30,0x70,0x00,0x30,0x78,0x00,0x30,0x7C,0x00,0x30,0x66,0x00,0x30,0x63,0x00,0xF0,0x61,0x00,0xF0,0x60,0x00,0x70,0x60,0x00,
+	0x30,0x70,0x00,0x30,0x78,0x00,0x30,0x7C,0x00,0x30,0x66,0x00,0x30,0x63,0x00,0xF0,0x61,0x00,0xF0,0x60,0x00,0x70,0x60,0x00,
 
 	/* Index 91, character 123 "{" (width: 9 pixels) */
-	0x9, 0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x05,0x00,0xFC,0xFD,0x01,0xFE,0xF8,0x03,0x03,0x00,0x06,0x01,0x00,0x04,0x01,0x00,0x04,
+	0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x05,0x00,0xFC,0xFD,0x01,0xFE,0xF8,0x03,0x03,0x00,0x06,0x01,0x00,0x04,0x01,0x00,0x04,
 
 	/* Index 92, character 124 "|" (width: 2 pixels) */
-	0x2, 0xFF,0xFF,0x07,0xFF,0xFF,0x07,
+	0xFF,0xFF,0x07,0xFF,0xFF,0x07,
 
 	/* Index 93, character 125 "}" (width: 9 pixels) */
-	0x9, 0x01,0x00,0x04,0x01,0x00,0x04,0x03,0x00,0x06,0xFE,0xF8,0x03,0xFC,0xFD,0x01,0x00,0x05,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,
+	0x01,0x00,0x04,0x01,0x00,0x04,0x03,0x00,0x06,0xFE,0xF8,0x03,0xFC,0xFD,0x01,0x00,0x05,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,
 
 	/* Index 94, character 126 "~" (width: 12 pixels) */
-	0xC, 0x00,0x07,0x00,0x80,0x07,0x00,0xC0,0x01,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x80,0x01,0x00,0x00,0x03,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x07,0x00,0xC0,0x03,0x00,0xC0,0x01,0x00
+	0x00,0x07,0x00,0x80,0x07,0x00,0xC0,0x01,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x80,0x01,0x00,0x00,0x03,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x07,0x00,0xC0,0x03,0x00,0xC0,0x01,0x00
+};
+
+// Offset of each bitmap in Verdana14_bitmaps
+const unsigned short Verdana14_offsets[] = 
+{
+	0x0,	// Index 0
+	0x9,	// Index 1
+	0xF,	// Index 2
+	0x21,	// Index 3
+	0x45,	// Index 4
+	0x60,	// Index 5
+	0x96,	// Index 6
+	0xBD,	// Index 7
+	0xC3,	// Index 8
+	0xD5,	// Index 9
+	0xE7,	// Index 10
+	0x102,	// Index 11
+	0x126,	// Index 12
+	0x132,	// Index 13
+	0x144,	// Index 14
+	0x14A,	// Index 15
+	0x162,	// Index 16
+	0x180,	// Index 17
+	0x198,	// Index 18
+	0x1B3,	// Index 19
+	0x1CE,	// Index 20
+	0x1EC,	// Index 21
+	0x207,	// Index 22
+	0x225,	// Index 23
+	0x240,	// Index 24
+	0x25E,	// Index 25
+	0x27C,	// Index 26
+	0x282,	// Index 27
+	0x28E,	// Index 28
+	0x2AF,	// Index 29
+	0x2D0,	// Index 30
+	0x2F1,	// Index 31
+	0x309,	// Index 32
+	0x339,	// Index 33
+	0x360,	// Index 34
+	0x37E,	// Index 35
+	0x39F,	// Index 36
+	0x3C3,	// Index 37
+	0x3DE,	// Index 38
+	0x3F9,	// Index 39
+	0x420,	// Index 40
+	0x43E,	// Index 41
+	0x450,	// Index 42
+	0x465,	// Index 43
+	0x486,	// Index 44
+	0x4A1,	// Index 45
+	0x4C5,	// Index 46
+	0x4E3,	// Index 47
+	0x50A,	// Index 48
+	0x522,	// Index 49
+	0x549,	// Index 50
+	0x56A,	// Index 51
+	0x58B,	// Index 52
+	0x5AF,	// Index 53
+	0x5CD,	// Index 54
+	0x5F4,	// Index 55
+	0x627,	// Index 56
+	0x648,	// Index 57
+	0x66C,	// Index 58
+	0x68D,	// Index 59
+	0x69C,	// Index 60
+	0x6B4,	// Index 61
+	0x6C3,	// Index 62
+	0x6E7,	// Index 63
+	0x70B,	// Index 64
+	0x717,	// Index 65
+	0x72F,	// Index 66
+	0x74A,	// Index 67
+	0x762,	// Index 68
+	0x77D,	// Index 69
+	0x798,	// Index 70
+	0x7AA,	// Index 71
+	0x7C5,	// Index 72
+	0x7DD,	// Index 73
+	0x7E3,	// Index 74
+	0x7F2,	// Index 75
+	0x80D,	// Index 76
+	0x813,	// Index 77
+	0x83D,	// Index 78
+	0x855,	// Index 79
+	0x873,	// Index 80
+	0x88E,	// Index 81
+	0x8A9,	// Index 82
+	0x8BB,	// Index 83
+	0x8D3,	// Index 84
+	0x8E5,	// Index 85
+	0x8FD,	// Index 86
+	0x918,	// Index 87
+	0x942,	// Index 88
+	0x95D,	// Index 89
+	0x978,	// Index 90
+	0x990,	// Index 91
+	0x9AB,	// Index 92
+	0x9B1,	// Index 93
+	0x9CC,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Verdana14_widths[] = 
+{
+	0x3,	// Index 0
+	0x2,	// Index 1
+	0x6,	// Index 2
+	0xC,	// Index 3
+	0x9,	// Index 4
+	0x12,	// Index 5
+	0xD,	// Index 6
+	0x2,	// Index 7
+	0x6,	// Index 8
+	0x6,	// Index 9
+	0x9,	// Index 10
+	0xC,	// Index 11
+	0x4,	// Index 12
+	0x6,	// Index 13
+	0x2,	// Index 14
+	0x8,	// Index 15
+	0xA,	// Index 16
+	0x8,	// Index 17
+	0x9,	// Index 18
+	0x9,	// Index 19
+	0xA,	// Index 20
+	0x9,	// Index 21
+	0xA,	// Index 22
+	0x9,	// Index 23
+	0xA,	// Index 24
+	0xA,	// Index 25
+	0x2,	// Index 26
+	0x4,	// Index 27
+	0xB,	// Index 28
+	0xB,	// Index 29
+	0xB,	// Index 30
+	0x8,	// Index 31
+	0x10,	// Index 32
+	0xD,	// Index 33
+	0xA,	// Index 34
+	0xB,	// Index 35
+	0xC,	// Index 36
+	0x9,	// Index 37
+	0x9,	// Index 38
+	0xD,	// Index 39
+	0xA,	// Index 40
+	0x6,	// Index 41
+	0x7,	// Index 42
+	0xB,	// Index 43
+	0x9,	// Index 44
+	0xC,	// Index 45
+	0xA,	// Index 46
+	0xD,	// Index 47
+	0x8,	// Index 48
+	0xD,	// Index 49
+	0xB,	// Index 50
+	0xB,	// Index 51
+	0xC,	// Index 52
+	0xA,	// Index 53
+	0xD,	// Index 54
+	0x11,	// Index 55
+	0xB,	// Index 56
+	0xC,	// Index 57
+	0xB,	// Index 58
+	0x5,	// Index 59
+	0x8,	// Index 60
+	0x5,	// Index 61
+	0xC,	// Index 62
+	0xC,	// Index 63
+	0x4,	// Index 64
+	0x8,	// Index 65
+	0x9,	// Index 66
+	0x8,	// Index 67
+	0x9,	// Index 68
+	0x9,	// Index 69
+	0x6,	// Index 70
+	0x9,	// Index 71
+	0x8,	// Index 72
+	0x2,	// Index 73
+	0x5,	// Index 74
+	0x9,	// Index 75
+	0x2,	// Index 76
+	0xE,	// Index 77
+	0x8,	// Index 78
+	0xA,	// Index 79
+	0x9,	// Index 80
+	0x9,	// Index 81
+	0x6,	// Index 82
+	0x8,	// Index 83
+	0x6,	// Index 84
+	0x8,	// Index 85
+	0x9,	// Index 86
+	0xE,	// Index 87
+	0x9,	// Index 88
+	0x9,	// Index 89
+	0x8,	// Index 90
+	0x9,	// Index 91
+	0x2,	// Index 92
+	0x9,	// Index 93
+	0xC,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Verdana14_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0xE, 0x0,	// Index 1
+	0xF, 0x0,	// Index 2
+	0xE, 0x0,	// Index 3
+	0xF, 0x3,	// Index 4
+	0xE, 0x0,	// Index 5
+	0xE, 0x0,	// Index 6
+	0xF, 0x0,	// Index 7
+	0xF, 0x4,	// Index 8
+	0xF, 0x4,	// Index 9
+	0xF, 0x0,	// Index 10
+	0xC, 0x0,	// Index 11
+	0x3, 0x3,	// Index 12
+	0x7, 0x0,	// Index 13
+	0x3, 0x0,	// Index 14
+	0xF, 0x3,	// Index 15
+	0xE, 0x0,	// Index 16
+	0xE, 0x0,	// Index 17
+	0xE, 0x0,	// Index 18
+	0xE, 0x0,	// Index 19
+	0xE, 0x0,	// Index 20
+	0xE, 0x0,	// Index 21
+	0xE, 0x0,	// Index 22
+	0xE, 0x0,	// Index 23
+	0xE, 0x0,	// Index 24
+	0xE, 0x0,	// Index 25
+	0xB, 0x0,	// Index 26
+	0xB, 0x3,	// Index 27
+	0xC, 0x0,	// Index 28
+	0x9, 0x0,	// Index 29
+	0xC, 0x0,	// Index 30
+	0xE, 0x0,	// Index 31
+	0xE, 0x2,	// Index 32
+	0xE, 0x0,	// Index 33
+	0xE, 0x0,	// Index 34
+	0xE, 0x0,	// Index 35
+	0xE, 0x0,	// Index 36
+	0xE, 0x0,	// Index 37
+	0xE, 0x0,	// Index 38
+	0xE, 0x0,	// Index 39
+	0xE, 0x0,	// Index 40
+	0xE, 0x0,	// Index 41
+	0xE, 0x0,	// Index 42
+	0xE, 0x0,	// Index 43
+	0xE, 0x0,	// Index 44
+	0xE, 0x0,	// Index 45
+	0xE, 0x0,	// Index 46
+	0xE, 0x0,	// Index 47
+	0xE, 0x0,	// Index 48
+	0xE, 0x4,	// Index 49
+	0xE, 0x0,	// Index 50
+	0xE, 0x0,	// Index 51
+	0xE, 0x0,	// Index 52
+	0xE, 0x0,	// Index 53
+	0xE, 0x0,	// Index 54
+	0xE, 0x0,	// Index 55
+	0xE, 0x0,	// Index 56
+	0xE, 0x0,	// Index 57
+	0xE, 0x0,	// Index 58
+	0xF, 0x4,	// Index 59
+	0xF, 0x3,	// Index 60
+	0xF, 0x4,	// Index 61
+	0xE, 0x0,	// Index 62
+	0x0, 0x3,	// Index 63
+	0xF, 0x0,	// Index 64
+	0xB, 0x0,	// Index 65
+	0xF, 0x0,	// Index 66
+	0xB, 0x0,	// Index 67
+	0xF, 0x0,	// Index 68
+	0xB, 0x0,	// Index 69
+	0xF, 0x0,	// Index 70
+	0xB, 0x4,	// Index 71
+	0xF, 0x0,	// Index 72
+	0xE, 0x0,	// Index 73
+	0xE, 0x4,	// Index 74
+	0xF, 0x0,	// Index 75
+	0xF, 0x0,	// Index 76
+	0xB, 0x0,	// Index 77
+	0xB, 0x0,	// Index 78
+	0xB, 0x0,	// Index 79
+	0xB, 0x4,	// Index 80
+	0xB, 0x4,	// Index 81
+	0xB, 0x0,	// Index 82
+	0xB, 0x0,	// Index 83
+	0xE, 0x0,	// Index 84
+	0xB, 0x0,	// Index 85
+	0xB, 0x0,	// Index 86
+	0xB, 0x0,	// Index 87
+	0xB, 0x0,	// Index 88
+	0xB, 0x4,	// Index 89
+	0xB, 0x0,	// Index 90
+	0xF, 0x4,	// Index 91
+	0xF, 0x4,	// Index 92
+	0xF, 0x4,	// Index 93
+	0x9, 0x0,	// Index 94
+};
+
+const font_t Verdana14 = 
+{
+	Verdana14_bitmaps,
+	Verdana14_offsets,
+	Verdana14_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x13,	// Height 
+	0,	// Flags 
+	Verdana14_extents,
+	0xF	// Ascent 
 };
+
 //---------------------------------------------------------------
 // Group Name: Verdana16
 // Designer: Imported System Font
@@ -1640,398 +2478,607 @@ const unsigned char Verdana14[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Verdana16[] = 
+const unsigned char Verdana16_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x15,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xCD, // Index 1 (offset: 205)
-	0x0, 0xD4, // Index 2 (offset: 212)
-	0x0, 0xE7, // Index 3 (offset: 231)
-	0x1, 0xF, // Index 4 (offset: 271)
-	0x1, 0x2E, // Index 5 (offset: 302)
-	0x1, 0x6B, // Index 6 (offset: 363)
-	0x1, 0x99, // Index 7 (offset: 409)
-	0x1, 0xA0, // Index 8 (offset: 416)
-	0x1, 0xB3, // Index 9 (offset: 435)
-	0x1, 0xC6, // Index 10 (offset: 454)
-	0x1, 0xE2, // Index 11 (offset: 482)
-	0x2, 0xD, // Index 12 (offset: 525)
-	0x2, 0x1A, // Index 13 (offset: 538)
-	0x2, 0x2D, // Index 14 (offset: 557)
-	0x2, 0x34, // Index 15 (offset: 564)
-	0x2, 0x50, // Index 16 (offset: 592)
-	0x2, 0x72, // Index 17 (offset: 626)
-	0x2, 0x8B, // Index 18 (offset: 651)
-	0x2, 0xAA, // Index 19 (offset: 682)
-	0x2, 0xC6, // Index 20 (offset: 710)
-	0x2, 0xE8, // Index 21 (offset: 744)
-	0x3, 0x7, // Index 22 (offset: 775)
-	0x3, 0x29, // Index 23 (offset: 809)
-	0x3, 0x48, // Index 24 (offset: 840)
-	0x3, 0x6A, // Index 25 (offset: 874)
-	0x3, 0x8C, // Index 26 (offset: 908)
-	0x3, 0x93, // Index 27 (offset: 915)
-	0x3, 0xA0, // Index 28 (offset: 928)
-	0x3, 0xC5, // Index 29 (offset: 965)
-	0x3, 0xEA, // Index 30 (offset: 1002)
-	0x4, 0xF, // Index 31 (offset: 1039)
-	0x4, 0x2B, // Index 32 (offset: 1067)
-	0x4, 0x5F, // Index 33 (offset: 1119)
-	0x4, 0x8A, // Index 34 (offset: 1162)
-	0x4, 0xAC, // Index 35 (offset: 1196)
-	0x4, 0xD4, // Index 36 (offset: 1236)
-	0x4, 0xFC, // Index 37 (offset: 1276)
-	0x5, 0x1B, // Index 38 (offset: 1307)
-	0x5, 0x3A, // Index 39 (offset: 1338)
-	0x5, 0x62, // Index 40 (offset: 1378)
-	0x5, 0x87, // Index 41 (offset: 1415)
-	0x5, 0x9A, // Index 42 (offset: 1434)
-	0x5, 0xB3, // Index 43 (offset: 1459)
-	0x5, 0xDB, // Index 44 (offset: 1499)
-	0x5, 0xFA, // Index 45 (offset: 1530)
-	0x6, 0x25, // Index 46 (offset: 1573)
-	0x6, 0x4A, // Index 47 (offset: 1610)
-	0x6, 0x78, // Index 48 (offset: 1656)
-	0x6, 0x97, // Index 49 (offset: 1687)
-	0x6, 0xC5, // Index 50 (offset: 1733)
-	0x6, 0xED, // Index 51 (offset: 1773)
-	0x7, 0x12, // Index 52 (offset: 1810)
-	0x7, 0x37, // Index 53 (offset: 1847)
-	0x7, 0x59, // Index 54 (offset: 1881)
-	0x7, 0x84, // Index 55 (offset: 1924)
-	0x7, 0xBE, // Index 56 (offset: 1982)
-	0x7, 0xE3, // Index 57 (offset: 2019)
-	0x8, 0x8, // Index 58 (offset: 2056)
-	0x8, 0x2D, // Index 59 (offset: 2093)
-	0x8, 0x3D, // Index 60 (offset: 2109)
-	0x8, 0x59, // Index 61 (offset: 2137)
-	0x8, 0x69, // Index 62 (offset: 2153)
-	0x8, 0x91, // Index 63 (offset: 2193)
-	0x8, 0xB9, // Index 64 (offset: 2233)
-	0x8, 0xC6, // Index 65 (offset: 2246)
-	0x8, 0xE5, // Index 66 (offset: 2277)
-	0x9, 0x4, // Index 67 (offset: 2308)
-	0x9, 0x20, // Index 68 (offset: 2336)
-	0x9, 0x3F, // Index 69 (offset: 2367)
-	0x9, 0x61, // Index 70 (offset: 2401)
-	0x9, 0x77, // Index 71 (offset: 2423)
-	0x9, 0x96, // Index 72 (offset: 2454)
-	0x9, 0xB2, // Index 73 (offset: 2482)
-	0x9, 0xB9, // Index 74 (offset: 2489)
-	0x9, 0xCC, // Index 75 (offset: 2508)
-	0x9, 0xEB, // Index 76 (offset: 2539)
-	0x9, 0xF2, // Index 77 (offset: 2546)
-	0xA, 0x23, // Index 78 (offset: 2595)
-	0xA, 0x3F, // Index 79 (offset: 2623)
-	0xA, 0x61, // Index 80 (offset: 2657)
-	0xA, 0x80, // Index 81 (offset: 2688)
-	0xA, 0x9F, // Index 82 (offset: 2719)
-	0xA, 0xB5, // Index 83 (offset: 2741)
-	0xA, 0xD1, // Index 84 (offset: 2769)
-	0xA, 0xE7, // Index 85 (offset: 2791)
-	0xB, 0x3, // Index 86 (offset: 2819)
-	0xB, 0x22, // Index 87 (offset: 2850)
-	0xB, 0x50, // Index 88 (offset: 2896)
-	0xB, 0x6F, // Index 89 (offset: 2927)
-	0xB, 0x8E, // Index 90 (offset: 2958)
-	0xB, 0xAA, // Index 91 (offset: 2986)
-	0xB, 0xC9, // Index 92 (offset: 3017)
-	0xB, 0xD0, // Index 93 (offset: 3024)
-	0xB, 0xEF, // Index 94 (offset: 3055)
-
 	/* Index 0, character 32 " " (width: 3 pixels) */
-	0x3, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 2 pixels) */
-	0x2, 0xFE,0x9F,0x01,0xFE,0x9F,0x01,
+	0xFE,0x9F,0x01,0xFE,0x9F,0x01,
 
 	/* Index 2, character 34 """ (width: 6 pixels) */
-	0x6, 0x3F,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,
+	0x3F,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 13 pixels) */
-	0xD, 0x00,0x08,0x00,0x40,0x08,0x00,0x40,0x88,0x01,0x40,0x78,0x00,0xC0,0x0F,0x00,0x78,0x08,0x00,0x46,0x88,0x01,0x40,0x78,0x00,0xC0,0x0F,0x00,0x78,0x08,0x00,0x46,0x08,0x00,0x40,0x08,0x00,0x40,0x00,0x00,
+	0x00,0x08,0x00,0x40,0x08,0x00,0x40,0x88,0x01,0x40,0x78,0x00,0xC0,0x0F,0x00,0x78,0x08,0x00,0x46,0x88,0x01,0x40,0x78,0x00,0xC0,0x0F,0x00,0x78,0x08,0x00,0x46,0x08,0x00,0x40,0x08,0x00,0x40,0x00,0x00,
 
 	/* Index 4, character 36 "$" (width: 10 pixels) */
-	0xA, 0xC0,0xC1,0x00,0xE0,0xC3,0x01,0x60,0x86,0x01,0x30,0x86,0x01,0x30,0x86,0x01,0xFE,0xFF,0x1F,0x30,0x8C,0x01,0x30,0x8C,0x01,0x30,0xFC,0x00,0x60,0x78,0x00,
+	0xC0,0xC1,0x00,0xE0,0xC3,0x01,0x60,0x86,0x01,0x30,0x86,0x01,0x30,0x86,0x01,0xFE,0xFF,0x1F,0x30,0x8C,0x01,0x30,0x8C,0x01,0x30,0xFC,0x00,0x60,0x78,0x00,
 
 	/* Index 5, character 37 "%" (width: 20 pixels) */
-	0x14, 0xF8,0x00,0x00,0xFC,0x01,0x00,0x8E,0x03,0x00,0x06,0x03,0x00,0x06,0x03,0x00,0x8E,0x03,0x01,0xFC,0xC1,0x01,0xF8,0xF0,0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0xC0,0x03,0x00,0xF0,0x00,0x00,0x3C,0x7C,0x00,0x0E,0xFE,0x00,0x02,0xC7,0x01,0x00,0x83,0x01,0x00,0x83,0x01,0x00,0xC7,0x01,0x00,0xFE,0x00,0x00,0x7C,0x00,
+	0xF8,0x00,0x00,0xFC,0x01,0x00,0x8E,0x03,0x00,0x06,0x03,0x00,0x06,0x03,0x00,0x8E,0x03,0x01,0xFC,0xC1,0x01,0xF8,0xF0,0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0xC0,0x03,0x00,0xF0,0x00,0x00,0x3C,0x7C,0x00,0x0E,0xFE,0x00,0x02,0xC7,0x01,0x00,0x83,0x01,0x00,0x83,0x01,0x00,0xC7,0x01,0x00,0xFE,0x00,0x00,0x7C,0x00,
 
 	/* Index 6, character 38 "&" (width: 15 pixels) */
-	0xF, 0x00,0x7C,0x00,0x38,0xFE,0x00,0xFC,0xC3,0x00,0xCE,0x81,0x01,0x86,0x81,0x01,0x86,0x83,0x01,0xCE,0x87,0x01,0x7C,0xCE,0x00,0x38,0xDC,0x00,0x00,0x78,0x00,0x80,0x7F,0x00,0x80,0xE7,0x00,0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x00,0x01,
+	0x00,0x7C,0x00,0x38,0xFE,0x00,0xFC,0xC3,0x00,0xCE,0x81,0x01,0x86,0x81,0x01,0x86,0x83,0x01,0xCE,0x87,0x01,0x7C,0xCE,0x00,0x38,0xDC,0x00,0x00,0x78,0x00,0x80,0x7F,0x00,0x80,0xE7,0x00,0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x00,0x01,
 
 	/* Index 7, character 39 "'" (width: 2 pixels) */
-	0x2, 0x3F,0x00,0x00,0x3F,0x00,0x00,
+	0x3F,0x00,0x00,0x3F,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 6 pixels) */
-	0x6, 0xC0,0x7F,0x00,0xF0,0xFF,0x01,0x7C,0xC0,0x07,0x0F,0x00,0x1E,0x03,0x00,0x18,0x01,0x00,0x10,
+	0xC0,0x7F,0x00,0xF0,0xFF,0x01,0x7C,0xC0,0x07,0x0F,0x00,0x1E,0x03,0x00,0x18,0x01,0x00,0x10,
 
 	/* Index 9, character 41 ")" (width: 6 pixels) */
-	0x6, 0x01,0x00,0x10,0x03,0x00,0x18,0x0F,0x00,0x1E,0x7C,0xC0,0x07,0xF8,0xFF,0x03,0xC0,0x7F,0x00,
+	0x01,0x00,0x10,0x03,0x00,0x18,0x0F,0x00,0x1E,0x7C,0xC0,0x07,0xF8,0xFF,0x03,0xC0,0x7F,0x00,
 
 	/* Index 10, character 42 "*" (width: 9 pixels) */
-	0x9, 0x46,0x00,0x00,0x64,0x00,0x00,0x2C,0x00,0x00,0x28,0x00,0x00,0xFF,0x01,0x00,0x28,0x00,0x00,0x2C,0x00,0x00,0x64,0x00,0x00,0x46,0x00,0x00,
+	0x46,0x00,0x00,0x64,0x00,0x00,0x2C,0x00,0x00,0x28,0x00,0x00,0xFF,0x01,0x00,0x28,0x00,0x00,0x2C,0x00,0x00,0x64,0x00,0x00,0x46,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 14 pixels) */
-	0xE, 0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0xF8,0xFF,0x01,0xF8,0xFF,0x01,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,
+	0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0xF8,0xFF,0x01,0xF8,0xFF,0x01,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,
 
 	/* Index 12, character 44 "," (width: 4 pixels) */
-	0x4, 0x00,0x00,0x1C,0x00,0xC0,0x1F,0x00,0xC0,0x03,0x00,0x40,0x00,
+	0x00,0x00,0x1C,0x00,0xC0,0x1F,0x00,0xC0,0x03,0x00,0x40,0x00,
 
 	/* Index 13, character 45 "-" (width: 6 pixels) */
-	0x6, 0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,
+	0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,
 
 	/* Index 14, character 46 "." (width: 2 pixels) */
-	0x2, 0x00,0xC0,0x01,0x00,0xC0,0x01,
+	0x00,0xC0,0x01,0x00,0xC0,0x01,
 
 	/* Index 15, character 47 "/" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x08,0x00,0x00,0x0F,0x00,0xE0,0x07,0x00,0xFC,0x00,0x80,0x1F,0x00,0xF0,0x03,0x00,0x7E,0x00,0x00,0x0F,0x00,0x00,0x01,0x00,0x00,
+	0x00,0x00,0x08,0x00,0x00,0x0F,0x00,0xE0,0x07,0x00,0xFC,0x00,0x80,0x1F,0x00,0xF0,0x03,0x00,0x7E,0x00,0x00,0x0F,0x00,0x00,0x01,0x00,0x00,
 
 	/* Index 16, character 48 "0" (width: 11 pixels) */
-	0xB, 0xE0,0x1F,0x00,0xF8,0x7F,0x00,0x1C,0xE0,0x00,0x0E,0xC0,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x0E,0xC0,0x01,0x1C,0xE0,0x00,0xF8,0x7F,0x00,0xE0,0x1F,0x00,
+	0xE0,0x1F,0x00,0xF8,0x7F,0x00,0x1C,0xE0,0x00,0x0E,0xC0,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x0E,0xC0,0x01,0x1C,0xE0,0x00,0xF8,0x7F,0x00,0xE0,0x1F,0x00,
 
 	/* Index 17, character 49 "1" (width: 8 pixels) */
-	0x8, 0x18,0x80,0x01,0x18,0x80,0x01,0x18,0x80,0x01,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,
+	0x18,0x80,0x01,0x18,0x80,0x01,0x18,0x80,0x01,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,
 
 	/* Index 18, character 50 "2" (width: 10 pixels) */
-	0xA, 0x0C,0xC0,0x01,0x06,0xE0,0x01,0x06,0xF0,0x01,0x06,0xB8,0x01,0x06,0x9C,0x01,0x06,0x8E,0x01,0x0E,0x87,0x01,0xFC,0x81,0x01,0xF8,0x80,0x01,0x00,0x80,0x01,
+	0x0C,0xC0,0x01,0x06,0xE0,0x01,0x06,0xF0,0x01,0x06,0xB8,0x01,0x06,0x9C,0x01,0x06,0x8E,0x01,0x0E,0x87,0x01,0xFC,0x81,0x01,0xF8,0x80,0x01,0x00,0x80,0x01,
 
 	/* Index 19, character 51 "3" (width: 9 pixels) */
-	0x9, 0x0C,0xC0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0xCE,0xC3,0x00,0x7C,0xFE,0x00,0x38,0x3C,0x00,
+	0x0C,0xC0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0xCE,0xC3,0x00,0x7C,0xFE,0x00,0x38,0x3C,0x00,
 
 	/* Index 20, character 52 "4" (width: 11 pixels) */
-	0xB, 0x00,0x0E,0x00,0x00,0x0F,0x00,0x80,0x0F,0x00,0xE0,0x0D,0x00,0x70,0x0C,0x00,0x38,0x0C,0x00,0x1C,0x0C,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x00,0x0C,0x00,0x00,0x0C,0x00,
+	0x00,0x0E,0x00,0x00,0x0F,0x00,0x80,0x0F,0x00,0xE0,0x0D,0x00,0x70,0x0C,0x00,0x38,0x0C,0x00,0x1C,0x0C,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x00,0x0C,0x00,0x00,0x0C,0x00,
 
 	/* Index 21, character 53 "5" (width: 10 pixels) */
-	0xA, 0x00,0xC0,0x00,0xFE,0x81,0x01,0xFE,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0xC3,0x00,0x06,0xFF,0x00,0x06,0x3E,0x00,
+	0x00,0xC0,0x00,0xFE,0x81,0x01,0xFE,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0xC3,0x00,0x06,0xFF,0x00,0x06,0x3E,0x00,
 
 	/* Index 22, character 54 "6" (width: 11 pixels) */
-	0xB, 0xC0,0x1F,0x00,0xF0,0x7F,0x00,0x38,0xE3,0x00,0x8C,0xC1,0x01,0x8E,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x06,0xC3,0x00,0x00,0x7F,0x00,0x00,0x3E,0x00,
+	0xC0,0x1F,0x00,0xF0,0x7F,0x00,0x38,0xE3,0x00,0x8C,0xC1,0x01,0x8E,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x06,0xC3,0x00,0x00,0x7F,0x00,0x00,0x3E,0x00,
 
 	/* Index 23, character 55 "7" (width: 10 pixels) */
-	0xA, 0x06,0x00,0x00,0x06,0x00,0x01,0x06,0xC0,0x01,0x06,0xF0,0x01,0x06,0x7C,0x00,0x06,0x1E,0x00,0x86,0x07,0x00,0xE6,0x01,0x00,0x7E,0x00,0x00,0x1E,0x00,0x00,
+	0x06,0x00,0x00,0x06,0x00,0x01,0x06,0xC0,0x01,0x06,0xF0,0x01,0x06,0x7C,0x00,0x06,0x1E,0x00,0x86,0x07,0x00,0xE6,0x01,0x00,0x7E,0x00,0x00,0x1E,0x00,0x00,
 
 	/* Index 24, character 56 "8" (width: 11 pixels) */
-	0xB, 0x78,0x7C,0x00,0xFC,0xFE,0x00,0xCC,0xC2,0x00,0x86,0x81,0x01,0x86,0x81,0x01,0x06,0x81,0x01,0x06,0x83,0x01,0x86,0x83,0x01,0x8C,0xC6,0x00,0xFC,0xFE,0x00,0x78,0x3C,0x00,
+	0x78,0x7C,0x00,0xFC,0xFE,0x00,0xCC,0xC2,0x00,0x86,0x81,0x01,0x86,0x81,0x01,0x06,0x81,0x01,0x06,0x83,0x01,0x86,0x83,0x01,0x8C,0xC6,0x00,0xFC,0xFE,0x00,0x78,0x3C,0x00,
 
 	/* Index 25, character 57 "9" (width: 11 pixels) */
-	0xB, 0xF0,0x01,0x00,0xF8,0x03,0x00,0x0C,0x83,0x01,0x06,0x86,0x01,0x06,0x86,0x01,0x06,0x86,0x01,0x06,0xC6,0x01,0x0E,0xC6,0x00,0x1C,0x73,0x00,0xF8,0x3F,0x00,0xE0,0x0F,0x00,
+	0xF0,0x01,0x00,0xF8,0x03,0x00,0x0C,0x83,0x01,0x06,0x86,0x01,0x06,0x86,0x01,0x06,0x86,0x01,0x06,0xC6,0x01,0x0E,0xC6,0x00,0x1C,0x73,0x00,0xF8,0x3F,0x00,0xE0,0x0F,0x00,
 
 	/* Index 26, character 58 ":" (width: 2 pixels) */
-	0x2, 0xE0,0xC0,0x01,0xE0,0xC0,0x01,
+	0xE0,0xC0,0x01,0xE0,0xC0,0x01,
 
 	/* Index 27, character 59 ";" (width: 4 pixels) */
-	0x4, 0x00,0x00,0x1C,0xE0,0xC0,0x1F,0xE0,0xC0,0x03,0x00,0x40,0x00,
+	0x00,0x00,0x1C,0xE0,0xC0,0x1F,0xE0,0xC0,0x03,0x00,0x40,0x00,
 
 	/* Index 28, character 60 "<" (width: 12 pixels) */
-	0xC, 0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0xC0,0x30,0x00,0xC0,0x30,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,
+	0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0xC0,0x30,0x00,0xC0,0x30,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,
 
 	/* Index 29, character 61 "=" (width: 12 pixels) */
-	0xC, 0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,
+	0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x80,0x19,0x00,
 
 	/* Index 30, character 62 ">" (width: 12 pixels) */
-	0xC, 0x30,0xC0,0x00,0x30,0xC0,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0xC0,0x30,0x00,0xC0,0x30,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x06,0x00,0x00,0x06,0x00,
+	0x30,0xC0,0x00,0x30,0xC0,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0xC0,0x30,0x00,0xC0,0x30,0x00,0x80,0x19,0x00,0x80,0x19,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x06,0x00,0x00,0x06,0x00,
 
 	/* Index 31, character 63 "?" (width: 9 pixels) */
-	0x9, 0x0C,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x9E,0x01,0x06,0x9E,0x01,0x06,0x03,0x00,0x8E,0x01,0x00,0xFC,0x01,0x00,0x78,0x00,0x00,
+	0x0C,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x9E,0x01,0x06,0x9E,0x01,0x06,0x03,0x00,0x8E,0x01,0x00,0xFC,0x01,0x00,0x78,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 17 pixels) */
-	0x11, 0x80,0x1F,0x00,0xE0,0x7F,0x00,0x70,0xE0,0x01,0x18,0x80,0x01,0x8C,0x1F,0x03,0xCC,0x3F,0x03,0xE6,0x70,0x06,0x66,0x60,0x06,0x66,0x60,0x06,0x66,0x30,0x06,0xE6,0x7F,0x06,0xEE,0x7F,0x06,0x0C,0x60,0x00,0x1C,0x60,0x00,0x78,0x70,0x00,0xF0,0x7F,0x00,0xC0,0x1F,0x00,
+	0x80,0x1F,0x00,0xE0,0x7F,0x00,0x70,0xE0,0x01,0x18,0x80,0x01,0x8C,0x1F,0x03,0xCC,0x3F,0x03,0xE6,0x70,0x06,0x66,0x60,0x06,0x66,0x60,0x06,0x66,0x30,0x06,0xE6,0x7F,0x06,0xEE,0x7F,0x06,0x0C,0x60,0x00,0x1C,0x60,0x00,0x78,0x70,0x00,0xF0,0x7F,0x00,0xC0,0x1F,0x00,
 
 	/* Index 33, character 65 "A" (width: 14 pixels) */
-	0xE, 0x00,0x00,0x01,0x00,0xE0,0x01,0x00,0xFC,0x00,0x80,0x1F,0x00,0xF0,0x1B,0x00,0x7E,0x18,0x00,0x0E,0x18,0x00,0x0E,0x18,0x00,0x7E,0x18,0x00,0xF0,0x1B,0x00,0x80,0x1F,0x00,0x00,0xFC,0x00,0x00,0xE0,0x01,0x00,0x00,0x01,
+	0x00,0x00,0x01,0x00,0xE0,0x01,0x00,0xFC,0x00,0x80,0x1F,0x00,0xF0,0x1B,0x00,0x7E,0x18,0x00,0x0E,0x18,0x00,0x0E,0x18,0x00,0x7E,0x18,0x00,0xF0,0x1B,0x00,0x80,0x1F,0x00,0x00,0xFC,0x00,0x00,0xE0,0x01,0x00,0x00,0x01,
 
 	/* Index 34, character 66 "B" (width: 11 pixels) */
-	0xB, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0xCE,0x81,0x01,0x7C,0xC3,0x00,0x38,0xFF,0x00,0x00,0x3E,0x00,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0xCE,0x81,0x01,0x7C,0xC3,0x00,0x38,0xFF,0x00,0x00,0x3E,0x00,
 
 	/* Index 35, character 67 "C" (width: 13 pixels) */
-	0xD, 0xC0,0x0F,0x00,0xF0,0x3F,0x00,0x38,0x70,0x00,0x1C,0xE0,0x00,0x0C,0xC0,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x0E,0xC0,0x01,0x0C,0xC0,0x00,0x1C,0xE0,0x00,
+	0xC0,0x0F,0x00,0xF0,0x3F,0x00,0x38,0x70,0x00,0x1C,0xE0,0x00,0x0C,0xC0,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x0E,0xC0,0x01,0x0C,0xC0,0x00,0x1C,0xE0,0x00,
 
 	/* Index 36, character 68 "D" (width: 13 pixels) */
-	0xD, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x0C,0xC0,0x00,0x1C,0xE0,0x00,0x38,0x70,0x00,0xF0,0x3F,0x00,0xC0,0x0F,0x00,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x0C,0xC0,0x00,0x1C,0xE0,0x00,0x38,0x70,0x00,0xF0,0x3F,0x00,0xC0,0x0F,0x00,
 
 	/* Index 37, character 69 "E" (width: 10 pixels) */
-	0xA, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,0x86,0x81,0x01,
 
 	/* Index 38, character 70 "F" (width: 10 pixels) */
-	0xA, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x06,0x00,0x00,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x86,0x01,0x00,0x06,0x00,0x00,
 
 	/* Index 39, character 71 "G" (width: 13 pixels) */
-	0xD, 0xC0,0x0F,0x00,0xF0,0x3F,0x00,0x38,0x70,0x00,0x1C,0xE0,0x00,0x0C,0xC0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x86,0x01,0x06,0x86,0x01,0x06,0x86,0x01,0x0E,0x86,0x01,0x0C,0xFE,0x00,0x1C,0xFE,0x00,
+	0xC0,0x0F,0x00,0xF0,0x3F,0x00,0x38,0x70,0x00,0x1C,0xE0,0x00,0x0C,0xC0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x86,0x01,0x06,0x86,0x01,0x06,0x86,0x01,0x0E,0x86,0x01,0x0C,0xFE,0x00,0x1C,0xFE,0x00,
 
 	/* Index 40, character 72 "H" (width: 12 pixels) */
-	0xC, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,
 
 	/* Index 41, character 73 "I" (width: 6 pixels) */
-	0x6, 0x06,0x80,0x01,0x06,0x80,0x01,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x80,0x01,0x06,0x80,0x01,
+	0x06,0x80,0x01,0x06,0x80,0x01,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x80,0x01,0x06,0x80,0x01,
 
 	/* Index 42, character 74 "J" (width: 8 pixels) */
-	0x8, 0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0xC0,0x01,0xFE,0xFF,0x00,0xFE,0x7F,0x00,
+	0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0xC0,0x01,0xFE,0xFF,0x00,0xFE,0x7F,0x00,
 
 	/* Index 43, character 75 "K" (width: 13 pixels) */
-	0xD, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x00,0x06,0x00,0x00,0x03,0x00,0x80,0x07,0x00,0xC0,0x0E,0x00,0x60,0x1C,0x00,0x30,0x38,0x00,0x18,0x70,0x00,0x0C,0xE0,0x00,0x06,0xC0,0x01,0x02,0x80,0x01,0x00,0x00,0x01,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x00,0x06,0x00,0x00,0x03,0x00,0x80,0x07,0x00,0xC0,0x0E,0x00,0x60,0x1C,0x00,0x30,0x38,0x00,0x18,0x70,0x00,0x0C,0xE0,0x00,0x06,0xC0,0x01,0x02,0x80,0x01,0x00,0x00,0x01,
 
 	/* Index 44, character 76 "L" (width: 10 pixels) */
-	0xA, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,
 
 	/* Index 45, character 77 "M" (width: 14 pixels) */
-	0xE, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x0E,0x00,0x00,0x7C,0x00,0x00,0xF0,0x01,0x00,0x80,0x07,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x80,0x07,0x00,0xE0,0x01,0x00,0x78,0x00,0x00,0x0E,0x00,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x0E,0x00,0x00,0x7C,0x00,0x00,0xF0,0x01,0x00,0x80,0x07,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x80,0x07,0x00,0xE0,0x01,0x00,0x78,0x00,0x00,0x0E,0x00,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,
 
 	/* Index 46, character 78 "N" (width: 12 pixels) */
-	0xC, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x0E,0x00,0x00,0x3E,0x00,0x00,0xF8,0x00,0x00,0xE0,0x01,0x00,0x80,0x07,0x00,0x00,0x1E,0x00,0x00,0x78,0x00,0x00,0xE0,0x01,0xFE,0xFF,0x01,0xFE,0xFF,0x01,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x0E,0x00,0x00,0x3E,0x00,0x00,0xF8,0x00,0x00,0xE0,0x01,0x00,0x80,0x07,0x00,0x00,0x1E,0x00,0x00,0x78,0x00,0x00,0xE0,0x01,0xFE,0xFF,0x01,0xFE,0xFF,0x01,
 
 	/* Index 47, character 79 "O" (width: 15 pixels) */
-	0xF, 0xC0,0x0F,0x00,0xF0,0x3F,0x00,0x38,0x70,0x00,0x1C,0xE0,0x00,0x0C,0xC0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x0E,0xC0,0x01,0x1C,0xE0,0x00,0x38,0x70,0x00,0xF0,0x3F,0x00,0xC0,0x0F,0x00,
+	0xC0,0x0F,0x00,0xF0,0x3F,0x00,0x38,0x70,0x00,0x1C,0xE0,0x00,0x0C,0xC0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x0E,0xC0,0x01,0x1C,0xE0,0x00,0x38,0x70,0x00,0xF0,0x3F,0x00,0xC0,0x0F,0x00,
 
 	/* Index 48, character 80 "P" (width: 10 pixels) */
-	0xA, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x0C,0x03,0x00,0xFC,0x01,0x00,0xF8,0x00,0x00,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x0C,0x03,0x00,0xFC,0x01,0x00,0xF8,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 15 pixels) */
-	0xF, 0xC0,0x0F,0x00,0xF0,0x3F,0x00,0x38,0x70,0x00,0x1C,0xE0,0x00,0x0C,0xC0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x07,0x06,0x80,0x0F,0x0E,0xC0,0x1C,0x1C,0xE0,0x18,0x38,0x70,0x18,0xF0,0x3F,0x18,0xC0,0x0F,0x18,
+	0xC0,0x0F,0x00,0xF0,0x3F,0x00,0x38,0x70,0x00,0x1C,0xE0,0x00,0x0C,0xC0,0x00,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x01,0x06,0x80,0x07,0x06,0x80,0x0F,0x0E,0xC0,0x1C,0x1C,0xE0,0x18,0x38,0x70,0x18,0xF0,0x3F,0x18,0xC0,0x0F,0x18,
 
 	/* Index 50, character 82 "R" (width: 13 pixels) */
-	0xD, 0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x0E,0x00,0x0E,0x3B,0x00,0xFC,0x71,0x00,0xF8,0xE0,0x00,0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x00,0x01,
+	0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x0E,0x00,0x0E,0x3B,0x00,0xFC,0x71,0x00,0xF8,0xE0,0x00,0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x00,0x01,
 
 	/* Index 51, character 83 "S" (width: 12 pixels) */
-	0xC, 0x78,0xE0,0x00,0xFC,0xC1,0x00,0x8C,0xC1,0x01,0x86,0x81,0x01,0x06,0x83,0x01,0x06,0x83,0x01,0x06,0x83,0x01,0x06,0x83,0x01,0x06,0x87,0x01,0x06,0xC6,0x00,0x0C,0xFE,0x00,0x00,0x3C,0x00,
+	0x78,0xE0,0x00,0xFC,0xC1,0x00,0x8C,0xC1,0x01,0x86,0x81,0x01,0x06,0x83,0x01,0x06,0x83,0x01,0x06,0x83,0x01,0x06,0x83,0x01,0x06,0x87,0x01,0x06,0xC6,0x00,0x0C,0xFE,0x00,0x00,0x3C,0x00,
 
 	/* Index 52, character 84 "T" (width: 12 pixels) */
-	0xC, 0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,
+	0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x01,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,
 
 	/* Index 53, character 85 "U" (width: 11 pixels) */
-	0xB, 0xFE,0x3F,0x00,0xFE,0xFF,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0xC0,0x01,0x00,0xE0,0x00,0xFE,0xFF,0x00,0xFE,0x3F,0x00,
+	0xFE,0x3F,0x00,0xFE,0xFF,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0xC0,0x01,0x00,0xE0,0x00,0xFE,0xFF,0x00,0xFE,0x3F,0x00,
 
 	/* Index 54, character 86 "V" (width: 14 pixels) */
-	0xE, 0x02,0x00,0x00,0x1E,0x00,0x00,0xFC,0x00,0x00,0xE0,0x07,0x00,0x00,0x3F,0x00,0x00,0xF8,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xF8,0x01,0x00,0x3F,0x00,0xE0,0x07,0x00,0xFC,0x00,0x00,0x1E,0x00,0x00,0x02,0x00,0x00,
+	0x02,0x00,0x00,0x1E,0x00,0x00,0xFC,0x00,0x00,0xE0,0x07,0x00,0x00,0x3F,0x00,0x00,0xF8,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xF8,0x01,0x00,0x3F,0x00,0xE0,0x07,0x00,0xFC,0x00,0x00,0x1E,0x00,0x00,0x02,0x00,0x00,
 
 	/* Index 55, character 87 "W" (width: 19 pixels) */
-	0x13, 0x06,0x00,0x00,0x7E,0x00,0x00,0xF8,0x07,0x00,0x80,0x7F,0x00,0x00,0xF8,0x01,0x00,0xC0,0x01,0x00,0xFE,0x00,0xE0,0x0F,0x00,0xFE,0x00,0x00,0x0E,0x00,0x00,0xFE,0x00,0x00,0xE0,0x0F,0x00,0x00,0xFE,0x00,0x00,0xE0,0x01,0x00,0xF8,0x01,0x80,0x7F,0x00,0xF8,0x07,0x00,0x7E,0x00,0x00,0x06,0x00,0x00,
+	0x06,0x00,0x00,0x7E,0x00,0x00,0xF8,0x07,0x00,0x80,0x7F,0x00,0x00,0xF8,0x01,0x00,0xC0,0x01,0x00,0xFE,0x00,0xE0,0x0F,0x00,0xFE,0x00,0x00,0x0E,0x00,0x00,0xFE,0x00,0x00,0xE0,0x0F,0x00,0x00,0xFE,0x00,0x00,0xE0,0x01,0x00,0xF8,0x01,0x80,0x7F,0x00,0xF8,0x07,0x00,0x7E,0x00,0x00,0x06,0x00,0x00,
 
 	/* Index 56, character 88 "X" (width: 12 pixels) */
-	0xC, 0x02,0x00,0x01,0x06,0x80,0x01,0x1E,0xE0,0x01,0x78,0x78,0x00,0xE0,0x1C,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0xE0,0x1C,0x00,0x78,0x78,0x00,0x1E,0xE0,0x01,0x06,0x80,0x01,0x02,0x00,0x01,
+	0x02,0x00,0x01,0x06,0x80,0x01,0x1E,0xE0,0x01,0x78,0x78,0x00,0xE0,0x1C,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0xE0,0x1C,0x00,0x78,0x78,0x00,0x1E,0xE0,0x01,0x06,0x80,0x01,0x02,0x00,0x01,
 
 	/* Index 57, character 89 "Y" (width: 12 pixels) */
-	0xC, 0x02,0x00,0x00,0x0E,0x00,0x00,0x3E,0x00,0x00,0x78,0x00,0x00,0xE0,0x01,0x00,0x80,0xFF,0x01,0x80,0xFF,0x01,0xE0,0x01,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x02,0x00,0x00,
+	0x02,0x00,0x00,0x0E,0x00,0x00,0x3E,0x00,0x00,0x78,0x00,0x00,0xE0,0x01,0x00,0x80,0xFF,0x01,0x80,0xFF,0x01,0xE0,0x01,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x02,0x00,0x00,
 
 	/* Index 58, character 90 "Z" (width: 12 pixels) */
-	0xC, 0x06,0xC0,0x01,0x06,0xE0,0x01,0x06,0xF0,0x01,0x06,0xB8,0x01,0x06,0x8E,0x01,0x06,0x87,0x01,0x86,0x83,0x01,0xC6,0x81,0x01,0x76,0x80,0x01,0x3E,0x80,0x01,0x1E,0x80,0x01,0x0E,0x80,0x01,
+	0x06,0xC0,0x01,0x06,0xE0,0x01,0x06,0xF0,0x01,0x06,0xB8,0x01,0x06,0x8E,0x01,0x06,0x87,0x01,0x86,0x83,0x01,0xC6,0x81,0x01,0x76,0x80,0x01,0x3E,0x80,0x01,0x1E,0x80,0x01,0x0E,0x80,0x01,
 
 	/* Index 59, character 91 "[" (width: 5 pixels) */
-	0x5, 0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,
+	0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,
 
 	/* Index 60, character 92 "\" (width: 9 pixels) */
-	0x9, 0x01,0x00,0x00,0x0F,0x00,0x00,0x7E,0x00,0x00,0xF0,0x03,0x00,0x80,0x1F,0x00,0x00,0xFC,0x00,0x00,0xE0,0x07,0x00,0x00,0x0F,0x00,0x00,0x08,
+	0x01,0x00,0x00,0x0F,0x00,0x00,0x7E,0x00,0x00,0xF0,0x03,0x00,0x80,0x1F,0x00,0x00,0xFC,0x00,0x00,0xE0,0x07,0x00,0x00,0x0F,0x00,0x00,0x08,
 
 	/* Index 61, character 93 "]" (width: 5 pixels) */
-	0x5, 0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,
+	0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,
 
 	/* Index 62, character 94 "^" (width: 13 pixels) */
-	0xD, 0x00,0x01,0x00,0x80,0x01,0x00,0xC0,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x0C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0xC0,0x00,0x00,0x80,0x01,0x00,0x00,0x01,0x00,
+	0x00,0x01,0x00,0x80,0x01,0x00,0xC0,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x0C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0xC0,0x00,0x00,0x80,0x01,0x00,0x00,0x01,0x00,
 
 	/* Index 63, character 95 "_" (width: 13 pixels) */
-	0xD, 0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,
+	0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,
 
 	/* Index 64, character 96 "`" (width: 4 pixels) */
-	0x4, 0x01,0x00,0x00,0x03,0x00,0x00,0x0F,0x00,0x00,0x08,0x00,0x00,
+	0x01,0x00,0x00,0x03,0x00,0x00,0x0F,0x00,0x00,0x08,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 10 pixels) */
-	0xA, 0x00,0x78,0x00,0x60,0xFC,0x00,0x60,0xCC,0x01,0x60,0x8E,0x01,0x60,0x86,0x01,0x60,0x86,0x01,0x60,0x86,0x00,0xE0,0xC6,0x00,0xC0,0xFF,0x01,0x80,0xFF,0x01,
+	0x00,0x78,0x00,0x60,0xFC,0x00,0x60,0xCC,0x01,0x60,0x8E,0x01,0x60,0x86,0x01,0x60,0x86,0x01,0x60,0x86,0x00,0xE0,0xC6,0x00,0xC0,0xFF,0x01,0x80,0xFF,0x01,
 
 	/* Index 66, character 98 "b" (width: 10 pixels) */
-	0xA, 0xFF,0xFF,0x01,0xFF,0xFF,0x01,0xC0,0x80,0x00,0x40,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0xE0,0xE0,0x00,0xC0,0x7F,0x00,0x00,0x3F,0x00,
+	0xFF,0xFF,0x01,0xFF,0xFF,0x01,0xC0,0x80,0x00,0x40,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0xE0,0xE0,0x00,0xC0,0x7F,0x00,0x00,0x3F,0x00,
 
 	/* Index 67, character 99 "c" (width: 9 pixels) */
-	0x9, 0x00,0x3F,0x00,0x80,0xFF,0x00,0xC0,0xE1,0x00,0xE0,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0xC0,0xC0,0x00,
+	0x00,0x3F,0x00,0x80,0xFF,0x00,0xC0,0xE1,0x00,0xE0,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0xC0,0xC0,0x00,
 
 	/* Index 68, character 100 "d" (width: 10 pixels) */
-	0xA, 0x00,0x3F,0x00,0x80,0xFF,0x00,0xC0,0xC1,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x40,0xC0,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,
+	0x00,0x3F,0x00,0x80,0xFF,0x00,0xC0,0xC1,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x40,0xC0,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,
 
 	/* Index 69, character 101 "e" (width: 11 pixels) */
-	0xB, 0x00,0x3F,0x00,0x80,0x7F,0x00,0xC0,0xCD,0x00,0xE0,0xCC,0x01,0x60,0x8C,0x01,0x60,0x8C,0x01,0x60,0x8C,0x01,0x60,0x8C,0x01,0xC0,0x8C,0x01,0xC0,0x8F,0x01,0x00,0xCF,0x00,
+	0x00,0x3F,0x00,0x80,0x7F,0x00,0xC0,0xCD,0x00,0xE0,0xCC,0x01,0x60,0x8C,0x01,0x60,0x8C,0x01,0x60,0x8C,0x01,0x60,0x8C,0x01,0xC0,0x8C,0x01,0xC0,0x8F,0x01,0x00,0xCF,0x00,
 
 	/* Index 70, character 102 "f" (width: 7 pixels) */
-	0x7, 0x60,0x00,0x00,0xFC,0xFF,0x01,0xFE,0xFF,0x01,0x67,0x00,0x00,0x63,0x00,0x00,0x63,0x00,0x00,0x03,0x00,0x00,
+	0x60,0x00,0x00,0xFC,0xFF,0x01,0xFE,0xFF,0x01,0x67,0x00,0x00,0x63,0x00,0x00,0x63,0x00,0x00,0x03,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 10 pixels) */
-	0xA, 0x00,0x3F,0x00,0x80,0xFF,0x18,0xC0,0xC1,0x19,0xE0,0x80,0x19,0x60,0x80,0x19,0x60,0x80,0x19,0x60,0x80,0x19,0x40,0xC0,0x0C,0xE0,0xFF,0x0F,0xE0,0xFF,0x03,
+	0x00,0x3F,0x00,0x80,0xFF,0x18,0xC0,0xC1,0x19,0xE0,0x80,0x19,0x60,0x80,0x19,0x60,0x80,0x19,0x60,0x80,0x19,0x40,0xC0,0x0C,0xE0,0xFF,0x0F,0xE0,0xFF,0x03,
 
 	/* Index 72, character 104 "h" (width: 9 pixels) */
-	0x9, 0xFF,0xFF,0x01,0xFF,0xFF,0x01,0xC0,0x00,0x00,0x40,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x00,0x00,0xC0,0xFF,0x01,0x80,0xFF,0x01,
+	0xFF,0xFF,0x01,0xFF,0xFF,0x01,0xC0,0x00,0x00,0x40,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x00,0x00,0xC0,0xFF,0x01,0x80,0xFF,0x01,
 
 	/* Index 73, character 105 "i" (width: 2 pixels) */
-	0x2, 0xE6,0xFF,0x01,0xE6,0xFF,0x01,
+	0xE6,0xFF,0x01,0xE6,0xFF,0x01,
 
 	/* Index 74, character 106 "j" (width: 6 pixels) */
-	0x6, 0x00,0x00,0x18,0x00,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x1C,0xE6,0xFF,0x0F,0xE6,0xFF,0x07,
+	0x00,0x00,0x18,0x00,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x1C,0xE6,0xFF,0x0F,0xE6,0xFF,0x07,
 
 	/* Index 75, character 107 "k" (width: 10 pixels) */
-	0xA, 0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x18,0x00,0x00,0x0C,0x00,0x00,0x1E,0x00,0x00,0x73,0x00,0xC0,0xE1,0x00,0xE0,0xC0,0x01,0x60,0x80,0x01,0x20,0x00,0x01,
+	0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x18,0x00,0x00,0x0C,0x00,0x00,0x1E,0x00,0x00,0x73,0x00,0xC0,0xE1,0x00,0xE0,0xC0,0x01,0x60,0x80,0x01,0x20,0x00,0x01,
 
 	/* Index 76, character 108 "l" (width: 2 pixels) */
-	0x2, 0xFF,0xFF,0x01,0xFF,0xFF,0x01,
+	0xFF,0xFF,0x01,0xFF,0xFF,0x01,
 
 	/* Index 77, character 109 "m" (width: 16 pixels) */
-	0x10, 0xE0,0xFF,0x01,0xE0,0xFF,0x01,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x00,0x00,0xE0,0xFF,0x01,0x80,0xFF,0x01,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x00,0x00,0xC0,0xFF,0x01,0x80,0xFF,0x01,
+	0xE0,0xFF,0x01,0xE0,0xFF,0x01,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x00,0x00,0xE0,0xFF,0x01,0x80,0xFF,0x01,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x00,0x00,0xC0,0xFF,0x01,0x80,0xFF,0x01,
 
 	/* Index 78, character 110 "n" (width: 9 pixels) */
-	0x9, 0xE0,0xFF,0x01,0xE0,0xFF,0x01,0xC0,0x00,0x00,0x40,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x00,0x00,0xC0,0xFF,0x01,0x80,0xFF,0x01,
+	0xE0,0xFF,0x01,0xE0,0xFF,0x01,0xC0,0x00,0x00,0x40,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x00,0x00,0xC0,0xFF,0x01,0x80,0xFF,0x01,
 
 	/* Index 79, character 111 "o" (width: 11 pixels) */
-	0xB, 0x00,0x3F,0x00,0x80,0x7F,0x00,0xC0,0xE1,0x00,0xE0,0xC0,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0xE0,0xC0,0x01,0xC0,0xE1,0x00,0x80,0x7F,0x00,0x00,0x3F,0x00,
+	0x00,0x3F,0x00,0x80,0x7F,0x00,0xC0,0xE1,0x00,0xE0,0xC0,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0xE0,0xC0,0x01,0xC0,0xE1,0x00,0x80,0x7F,0x00,0x00,0x3F,0x00,
 
 	/* Index 80, character 112 "p" (width: 10 pixels) */
-	0xA, 0xE0,0xFF,0x1F,0xE0,0xFF,0x1F,0xC0,0x80,0x00,0x40,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0xE0,0xE0,0x00,0xC0,0x7F,0x00,0x00,0x3F,0x00,
+	0xE0,0xFF,0x1F,0xE0,0xFF,0x1F,0xC0,0x80,0x00,0x40,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0xE0,0xE0,0x00,0xC0,0x7F,0x00,0x00,0x3F,0x00,
 
 	/* Index 81, character 113 "q" (width: 10 pixels) */
-	0xA, 0x00,0x3F,0x00,0x80,0xFF,0x00,0xC0,0xC1,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x40,0xC0,0x00,0xE0,0xFF,0x1F,0xE0,0xFF,0x1F,
+	0x00,0x3F,0x00,0x80,0xFF,0x00,0xC0,0xC1,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x40,0xC0,0x00,0xE0,0xFF,0x1F,0xE0,0xFF,0x1F,
 
 	/* Index 82, character 114 "r" (width: 7 pixels) */
-	0x7, 0xE0,0xFF,0x01,0xE0,0xFF,0x01,0xC0,0x00,0x00,0x40,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,
+	0xE0,0xFF,0x01,0xE0,0xFF,0x01,0xC0,0x00,0x00,0x40,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 9 pixels) */
-	0x9, 0x80,0xC3,0x00,0xC0,0x87,0x01,0x60,0x86,0x01,0x60,0x8C,0x01,0x60,0x8C,0x01,0x60,0x8C,0x01,0x60,0x9C,0x01,0x60,0xF8,0x00,0xC0,0x70,0x00,
+	0x80,0xC3,0x00,0xC0,0x87,0x01,0x60,0x86,0x01,0x60,0x8C,0x01,0x60,0x8C,0x01,0x60,0x8C,0x01,0x60,0x9C,0x01,0x60,0xF8,0x00,0xC0,0x70,0x00,
 
 	/* Index 84, character 116 "t" (width: 7 pixels) */
-	0x7, 0x60,0x00,0x00,0xFC,0x7F,0x00,0xFC,0xFF,0x01,0x60,0xC0,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,
+	0x60,0x00,0x00,0xFC,0x7F,0x00,0xFC,0xFF,0x01,0x60,0xC0,0x01,0x60,0x80,0x01,0x60,0x80,0x01,0x60,0x80,0x01,
 
 	/* Index 85, character 117 "u" (width: 9 pixels) */
-	0x9, 0xE0,0x7F,0x00,0xE0,0xFF,0x00,0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x00,0x00,0xC0,0x00,0xE0,0xFF,0x01,0xE0,0xFF,0x01,
+	0xE0,0x7F,0x00,0xE0,0xFF,0x00,0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x00,0x00,0xC0,0x00,0xE0,0xFF,0x01,0xE0,0xFF,0x01,
 
 	/* Index 86, character 118 "v" (width: 10 pixels) */
-	0xA, 0x20,0x00,0x00,0xE0,0x01,0x00,0xC0,0x0F,0x00,0x00,0x7E,0x00,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0x7C,0x00,0xC0,0x0F,0x00,0xE0,0x01,0x00,0x20,0x00,0x00,
+	0x20,0x00,0x00,0xE0,0x01,0x00,0xC0,0x0F,0x00,0x00,0x7E,0x00,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0x7C,0x00,0xC0,0x0F,0x00,0xE0,0x01,0x00,0x20,0x00,0x00,
 
 	/* Index 87, character 119 "w" (width: 15 pixels) */
-	0xF, 0x60,0x00,0x00,0xE0,0x07,0x00,0x80,0x7F,0x00,0x00,0xF0,0x01,0x00,0xE0,0x01,0x00,0x3E,0x00,0xC0,0x07,0x00,0xE0,0x00,0x00,0xC0,0x07,0x00,0x00,0x3E,0x00,0x00,0xF0,0x01,0x00,0xE0,0x01,0x80,0x7F,0x00,0xE0,0x07,0x00,0x60,0x00,0x00,
+	0x60,0x00,0x00,0xE0,0x07,0x00,0x80,0x7F,0x00,0x00,0xF0,0x01,0x00,0xE0,0x01,0x00,0x3E,0x00,0xC0,0x07,0x00,0xE0,0x00,0x00,0xC0,0x07,0x00,0x00,0x3E,0x00,0x00,0xF0,0x01,0x00,0xE0,0x01,0x80,0x7F,0x00,0xE0,0x07,0x00,0x60,0x00,0x00,
 
 	/* Index 88, character 120 "x" (width: 10 pixels) */
-	0xA, 0x20,0x00,0x01,0x60,0x80,0x01,0xE0,0xE1,0x01,0x80,0x73,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x80,0x73,0x00,0xE0,0xE1,0x01,0x60,0x80,0x01,0x20,0x00,0x01,
+	0x20,0x00,0x01,0x60,0x80,0x01,0xE0,0xE1,0x01,0x80,0x73,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x80,0x73,0x00,0xE0,0xE1,0x01,0x60,0x80,0x01,0x20,0x00,0x01,
 
 	/* Index 89, character 121 "y" (width: 10 pixels) */
-	0xA, 0x20,0x00,0x00,0xE0,0x01,0x00,0xC0,0x0F,0x10,0x00,0x7E,0x1E,0x00,0xF0,0x0F,0x00,0xF0,0x01,0x00,0x3E,0x00,0xC0,0x0F,0x00,0xE0,0x01,0x00,0x20,0x00,0x00,
+	0x20,0x00,0x00,0xE0,0x01,0x00,0xC0,0x0F,0x10,0x00,0x7E,0x1E,0x00,0xF0,0x0F,0x00,0xF0,0x01,0x00,0x3E,0x00,0xC0,0x0F,0x00,0xE0,0x01,0x00,0x20,0x00,0x00,
 
 	/* Index 90, character 122 "z" (width: 9 pixels) */
-	0x9, 0x60,0xC0,0x01,0x60,0xE0,0x01,0x60,0xF0,0x01,0x60,0xB8,0x01,0x60,0x8C,0x01,0x60,0x87,0x01,0xE0,0x83,0x01,0xE0,0x81,0x01,0xE0,0x80,0x01,
+	0x60,0xC0,0x01,0x60,0xE0,0x01,0x60,0xF0,0x01,0x60,0xB8,0x01,0x60,0x8C,0x01,0x60,0x87,0x01,0xE0,0x83,0x01,0xE0,0x81,0x01,0xE0,0x80,0x01,
 
 	/* Index 91, character 123 "{" (width: 10 pixels) */
-	0xA, 0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x1F,0x00,0xFC,0xF3,0x07,0xFE,0xE1,0x0F,0x07,0x00,0x1C,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,
+	0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x1F,0x00,0xFC,0xF3,0x07,0xFE,0xE1,0x0F,0x07,0x00,0x1C,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,
 
 	/* Index 92, character 124 "|" (width: 2 pixels) */
-	0x2, 0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,
+	0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,
 
 	/* Index 93, character 125 "}" (width: 10 pixels) */
-	0xA, 0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0x07,0x00,0x1C,0xFE,0xE1,0x0F,0xFC,0xF3,0x07,0x00,0x1F,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,
+	0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0x07,0x00,0x1C,0xFE,0xE1,0x0F,0xFC,0xF3,0x07,0x00,0x1F,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,
 
 	/* Index 94, character 126 "~" (width: 13 pixels) */
-	0xD, 0x00,0x0E,0x00,0x00,0x0F,0x00,0x80,0x03,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x06,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0E,0x00,0x80,0x07,0x00,0x80,0x03,0x00
+	0x00,0x0E,0x00,0x00,0x0F,0x00,0x80,0x03,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x06,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0E,0x00,0x80,0x07,0x00,0x80,0x03,0x00
+};
+
+// Offset of each bitmap in Verdana16_bitmaps
+const unsigned short Verdana16_offsets[] = 
+{
+	0x0,	// Index 0
+	0x9,	// Index 1
+	0xF,	// Index 2
+	0x21,	// Index 3
+	0x48,	// Index 4
+	0x66,	// Index 5
+	0xA2,	// Index 6
+	0xCF,	// Index 7
+	0xD5,	// Index 8
+	0xE7,	// Index 9
+	0xF9,	// Index 10
+	0x114,	// Index 11
+	0x13E,	// Index 12
+	0x14A,	// Index 13
+	0x15C,	// Index 14
+	0x162,	// Index 15
+	0x17D,	// Index 16
+	0x19E,	// Index 17
+	0x1B6,	// Index 18
+	0x1D4,	// Index 19
+	0x1EF,	// Index 20
+	0x210,	// Index 21
+	0x22E,	// Index 22
+	0x24F,	// Index 23
+	0x26D,	// Index 24
+	0x28E,	// Index 25
+	0x2AF,	// Index 26
+	0x2B5,	// Index 27
+	0x2C1,	// Index 28
+	0x2E5,	// Index 29
+	0x309,	// Index 30
+	0x32D,	// Index 31
+	0x348,	// Index 32
+	0x37B,	// Index 33
+	0x3A5,	// Index 34
+	0x3C6,	// Index 35
+	0x3ED,	// Index 36
+	0x414,	// Index 37
+	0x432,	// Index 38
+	0x450,	// Index 39
+	0x477,	// Index 40
+	0x49B,	// Index 41
+	0x4AD,	// Index 42
+	0x4C5,	// Index 43
+	0x4EC,	// Index 44
+	0x50A,	// Index 45
+	0x534,	// Index 46
+	0x558,	// Index 47
+	0x585,	// Index 48
+	0x5A3,	// Index 49
+	0x5D0,	// Index 50
+	0x5F7,	// Index 51
+	0x61B,	// Index 52
+	0x63F,	// Index 53
+	0x660,	// Index 54
+	0x68A,	// Index 55
+	0x6C3,	// Index 56
+	0x6E7,	// Index 57
+	0x70B,	// Index 58
+	0x72F,	// Index 59
+	0x73E,	// Index 60
+	0x759,	// Index 61
+	0x768,	// Index 62
+	0x78F,	// Index 63
+	0x7B6,	// Index 64
+	0x7C2,	// Index 65
+	0x7E0,	// Index 66
+	0x7FE,	// Index 67
+	0x819,	// Index 68
+	0x837,	// Index 69
+	0x858,	// Index 70
+	0x86D,	// Index 71
+	0x88B,	// Index 72
+	0x8A6,	// Index 73
+	0x8AC,	// Index 74
+	0x8BE,	// Index 75
+	0x8DC,	// Index 76
+	0x8E2,	// Index 77
+	0x912,	// Index 78
+	0x92D,	// Index 79
+	0x94E,	// Index 80
+	0x96C,	// Index 81
+	0x98A,	// Index 82
+	0x99F,	// Index 83
+	0x9BA,	// Index 84
+	0x9CF,	// Index 85
+	0x9EA,	// Index 86
+	0xA08,	// Index 87
+	0xA35,	// Index 88
+	0xA53,	// Index 89
+	0xA71,	// Index 90
+	0xA8C,	// Index 91
+	0xAAA,	// Index 92
+	0xAB0,	// Index 93
+	0xACE,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Verdana16_widths[] = 
+{
+	0x3,	// Index 0
+	0x2,	// Index 1
+	0x6,	// Index 2
+	0xD,	// Index 3
+	0xA,	// Index 4
+	0x14,	// Index 5
+	0xF,	// Index 6
+	0x2,	// Index 7
+	0x6,	// Index 8
+	0x6,	// Index 9
+	0x9,	// Index 10
+	0xE,	// Index 11
+	0x4,	// Index 12
+	0x6,	// Index 13
+	0x2,	// Index 14
+	0x9,	// Index 15
+	0xB,	// Index 16
+	0x8,	// Index 17
+	0xA,	// Index 18
+	0x9,	// Index 19
+	0xB,	// Index 20
+	0xA,	// Index 21
+	0xB,	// Index 22
+	0xA,	// Index 23
+	0xB,	// Index 24
+	0xB,	// Index 25
+	0x2,	// Index 26
+	0x4,	// Index 27
+	0xC,	// Index 28
+	0xC,	// Index 29
+	0xC,	// Index 30
+	0x9,	// Index 31
+	0x11,	// Index 32
+	0xE,	// Index 33
+	0xB,	// Index 34
+	0xD,	// Index 35
+	0xD,	// Index 36
+	0xA,	// Index 37
+	0xA,	// Index 38
+	0xD,	// Index 39
+	0xC,	// Index 40
+	0x6,	// Index 41
+	0x8,	// Index 42
+	0xD,	// Index 43
+	0xA,	// Index 44
+	0xE,	// Index 45
+	0xC,	// Index 46
+	0xF,	// Index 47
+	0xA,	// Index 48
+	0xF,	// Index 49
+	0xD,	// Index 50
+	0xC,	// Index 51
+	0xC,	// Index 52
+	0xB,	// Index 53
+	0xE,	// Index 54
+	0x13,	// Index 55
+	0xC,	// Index 56
+	0xC,	// Index 57
+	0xC,	// Index 58
+	0x5,	// Index 59
+	0x9,	// Index 60
+	0x5,	// Index 61
+	0xD,	// Index 62
+	0xD,	// Index 63
+	0x4,	// Index 64
+	0xA,	// Index 65
+	0xA,	// Index 66
+	0x9,	// Index 67
+	0xA,	// Index 68
+	0xB,	// Index 69
+	0x7,	// Index 70
+	0xA,	// Index 71
+	0x9,	// Index 72
+	0x2,	// Index 73
+	0x6,	// Index 74
+	0xA,	// Index 75
+	0x2,	// Index 76
+	0x10,	// Index 77
+	0x9,	// Index 78
+	0xB,	// Index 79
+	0xA,	// Index 80
+	0xA,	// Index 81
+	0x7,	// Index 82
+	0x9,	// Index 83
+	0x7,	// Index 84
+	0x9,	// Index 85
+	0xA,	// Index 86
+	0xF,	// Index 87
+	0xA,	// Index 88
+	0xA,	// Index 89
+	0x9,	// Index 90
+	0xA,	// Index 91
+	0x2,	// Index 92
+	0xA,	// Index 93
+	0xD,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Verdana16_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x10, 0x0,	// Index 1
+	0x11, 0x0,	// Index 2
+	0x10, 0x0,	// Index 3
+	0x10, 0x4,	// Index 4
+	0x10, 0x0,	// Index 5
+	0x10, 0x0,	// Index 6
+	0x11, 0x0,	// Index 7
+	0x11, 0x4,	// Index 8
+	0x11, 0x4,	// Index 9
+	0x11, 0x0,	// Index 10
+	0xE, 0x0,	// Index 11
+	0x3, 0x4,	// Index 12
+	0x8, 0x0,	// Index 13
+	0x3, 0x0,	// Index 14
+	0x11, 0x3,	// Index 15
+	0x10, 0x0,	// Index 16
+	0x10, 0x0,	// Index 17
+	0x10, 0x0,	// Index 18
+	0x10, 0x0,	// Index 19
+	0x10, 0x0,	// Index 20
+	0x10, 0x0,	// Index 21
+	0x10, 0x0,	// Index 22
+	0x10, 0x0,	// Index 23
+	0x10, 0x0,	// Index 24
+	0x10, 0x0,	// Index 25
+	0xC, 0x0,	// Index 26
+	0xC, 0x4,	// Index 27
+	0xD, 0x0,	// Index 28
+	0xA, 0x0,	// Index 29
+	0xD, 0x0,	// Index 30
+	0x10, 0x0,	// Index 31
+	0x10, 0x2,	// Index 32
+	0x10, 0x0,	// Index 33
+	0x10, 0x0,	// Index 34
+	0x10, 0x0,	// Index 35
+	0x10, 0x0,	// Index 36
+	0x10, 0x0,	// Index 37
+	0x10, 0x0,	// Index 38
+	0x10, 0x0,	// Index 39
+	0x10, 0x0,	// Index 40
+	0x10, 0x0,	// Index 41
+	0x10, 0x0,	// Index 42
+	0x10, 0x0,	// Index 43
+	0x10, 0x0,	// Index 44
+	0x10, 0x0,	// Index 45
+	0x10, 0x0,	// Index 46
+	0x10, 0x0,	// Index 47
+	0x10, 0x0,	// Index 48
+	0x10, 0x4,	// Index 49
+	0x10, 0x0,	// Index 50
+	0x10, 0x0,	// Index 51
+	0x10, 0x0,	// Index 52
+	0x10, 0x0,	// Index 53
+	0x10, 0x0,	// Index 54
+	0x10, 0x0,	// Index 55
+	0x10, 0x0,	// Index 56
+	0x10, 0x0,	// Index 57
+	0x10, 0x0,	// Index 58
+	0x11, 0x4,	// Index 59
+	0x11, 0x3,	// Index 60
+	0x11, 0x4,	// Index 61
+	0x10, 0x0,	// Index 62
+	0x0, 0x3,	// Index 63
+	0x11, 0x0,	// Index 64
+	0xC, 0x0,	// Index 65
+	0x11, 0x0,	// Index 66
+	0xC, 0x0,	// Index 67
+	0x11, 0x0,	// Index 68
+	0xC, 0x0,	// Index 69
+	0x11, 0x0,	// Index 70
+	0xC, 0x4,	// Index 71
+	0x11, 0x0,	// Index 72
+	0x10, 0x0,	// Index 73
+	0x10, 0x4,	// Index 74
+	0x11, 0x0,	// Index 75
+	0x11, 0x0,	// Index 76
+	0xC, 0x0,	// Index 77
+	0xC, 0x0,	// Index 78
+	0xC, 0x0,	// Index 79
+	0xC, 0x4,	// Index 80
+	0xC, 0x4,	// Index 81
+	0xC, 0x0,	// Index 82
+	0xC, 0x0,	// Index 83
+	0xF, 0x0,	// Index 84
+	0xC, 0x0,	// Index 85
+	0xC, 0x0,	// Index 86
+	0xC, 0x0,	// Index 87
+	0xC, 0x0,	// Index 88
+	0xC, 0x4,	// Index 89
+	0xC, 0x0,	// Index 90
+	0x11, 0x4,	// Index 91
+	0x11, 0x4,	// Index 92
+	0x11, 0x4,	// Index 93
+	0xA, 0x0,	// Index 94
+};
+
+const font_t Verdana16 = 
+{
+	Verdana16_bitmaps,
+	Verdana16_offsets,
+	Verdana16_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x15,	// Height 
+	0,	// Flags 
+	Verdana16_extents,
+	0x11	// Ascent 
 };
+
 //---------------------------------------------------------------
 // Group Name: Verdana22
 // Designer: Imported System Font
@@ -2045,398 +3092,607 @@ const unsigned char Verdana16[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Verdana22[] = 
+const unsigned char Verdana22_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x1D,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xD4, // Index 1 (offset: 212)
-	0x0, 0xE1, // Index 2 (offset: 225)
-	0x1, 0x6, // Index 3 (offset: 262)
-	0x1, 0x4F, // Index 4 (offset: 335)
-	0x1, 0x88, // Index 5 (offset: 392)
-	0x1, 0xF5, // Index 6 (offset: 501)
-	0x2, 0x46, // Index 7 (offset: 582)
-	0x2, 0x53, // Index 8 (offset: 595)
-	0x2, 0x78, // Index 9 (offset: 632)
-	0x2, 0x9D, // Index 10 (offset: 669)
-	0x2, 0xD6, // Index 11 (offset: 726)
-	0x3, 0x1F, // Index 12 (offset: 799)
-	0x3, 0x38, // Index 13 (offset: 824)
-	0x3, 0x5D, // Index 14 (offset: 861)
-	0x3, 0x6A, // Index 15 (offset: 874)
-	0x3, 0x9F, // Index 16 (offset: 927)
-	0x3, 0xD8, // Index 17 (offset: 984)
-	0x4, 0x5, // Index 18 (offset: 1029)
-	0x4, 0x3E, // Index 19 (offset: 1086)
-	0x4, 0x77, // Index 20 (offset: 1143)
-	0x4, 0xB8, // Index 21 (offset: 1208)
-	0x4, 0xED, // Index 22 (offset: 1261)
-	0x5, 0x26, // Index 23 (offset: 1318)
-	0x5, 0x5F, // Index 24 (offset: 1375)
-	0x5, 0x98, // Index 25 (offset: 1432)
-	0x5, 0xD1, // Index 26 (offset: 1489)
-	0x5, 0xDE, // Index 27 (offset: 1502)
-	0x5, 0xF7, // Index 28 (offset: 1527)
-	0x6, 0x38, // Index 29 (offset: 1592)
-	0x6, 0x7D, // Index 30 (offset: 1661)
-	0x6, 0xBE, // Index 31 (offset: 1726)
-	0x6, 0xEF, // Index 32 (offset: 1775)
-	0x7, 0x50, // Index 33 (offset: 1872)
-	0x7, 0xA1, // Index 34 (offset: 1953)
-	0x7, 0xE2, // Index 35 (offset: 2018)
-	0x8, 0x27, // Index 36 (offset: 2087)
-	0x8, 0x6C, // Index 37 (offset: 2156)
-	0x8, 0xA1, // Index 38 (offset: 2209)
-	0x8, 0xDA, // Index 39 (offset: 2266)
-	0x9, 0x23, // Index 40 (offset: 2339)
-	0x9, 0x64, // Index 41 (offset: 2404)
-	0x9, 0x89, // Index 42 (offset: 2441)
-	0x9, 0xAE, // Index 43 (offset: 2478)
-	0x9, 0xF3, // Index 44 (offset: 2547)
-	0xA, 0x28, // Index 45 (offset: 2600)
-	0xA, 0x71, // Index 46 (offset: 2673)
-	0xA, 0xB2, // Index 47 (offset: 2738)
-	0xA, 0xFF, // Index 48 (offset: 2815)
-	0xB, 0x34, // Index 49 (offset: 2868)
-	0xB, 0x81, // Index 50 (offset: 2945)
-	0xB, 0xC6, // Index 51 (offset: 3014)
-	0xC, 0x7, // Index 52 (offset: 3079)
-	0xC, 0x54, // Index 53 (offset: 3156)
-	0xC, 0x91, // Index 54 (offset: 3217)
-	0xC, 0xE2, // Index 55 (offset: 3298)
-	0xD, 0x4F, // Index 56 (offset: 3407)
-	0xD, 0x98, // Index 57 (offset: 3480)
-	0xD, 0xE5, // Index 58 (offset: 3557)
-	0xE, 0x26, // Index 59 (offset: 3622)
-	0xE, 0x43, // Index 60 (offset: 3651)
-	0xE, 0x78, // Index 61 (offset: 3704)
-	0xE, 0x95, // Index 62 (offset: 3733)
-	0xE, 0xDE, // Index 63 (offset: 3806)
-	0xF, 0x27, // Index 64 (offset: 3879)
-	0xF, 0x40, // Index 65 (offset: 3904)
-	0xF, 0x71, // Index 66 (offset: 3953)
-	0xF, 0xA6, // Index 67 (offset: 4006)
-	0xF, 0xD7, // Index 68 (offset: 4055)
-	0x10, 0xC, // Index 69 (offset: 4108)
-	0x10, 0x45, // Index 70 (offset: 4165)
-	0x10, 0x6E, // Index 71 (offset: 4206)
-	0x10, 0xA3, // Index 72 (offset: 4259)
-	0x10, 0xD4, // Index 73 (offset: 4308)
-	0x10, 0xE1, // Index 74 (offset: 4321)
-	0x11, 0x2, // Index 75 (offset: 4354)
-	0x11, 0x3B, // Index 76 (offset: 4411)
-	0x11, 0x48, // Index 77 (offset: 4424)
-	0x11, 0xA5, // Index 78 (offset: 4517)
-	0x11, 0xD6, // Index 79 (offset: 4566)
-	0x12, 0xF, // Index 80 (offset: 4623)
-	0x12, 0x44, // Index 81 (offset: 4676)
-	0x12, 0x79, // Index 82 (offset: 4729)
-	0x12, 0x9E, // Index 83 (offset: 4766)
-	0x12, 0xCF, // Index 84 (offset: 4815)
-	0x12, 0xF4, // Index 85 (offset: 4852)
-	0x13, 0x25, // Index 86 (offset: 4901)
-	0x13, 0x62, // Index 87 (offset: 4962)
-	0x13, 0xBB, // Index 88 (offset: 5051)
-	0x13, 0xF8, // Index 89 (offset: 5112)
-	0x14, 0x35, // Index 90 (offset: 5173)
-	0x14, 0x6A, // Index 91 (offset: 5226)
-	0x14, 0x9F, // Index 92 (offset: 5279)
-	0x14, 0xAC, // Index 93 (offset: 5292)
-	0x14, 0xE1, // Index 94 (offset: 5345)
-
 	/* Index 0, character 32 " " (width: 4 pixels) */
-	0x4, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 3 pixels) */
-	0x3, 0xFE,0xFF,0x71,0x00,0xFE,0xFF,0x71,0x00,0xFE,0xFF,0x71,0x00,
+	0xFE,0xFF,0x71,0x00,0xFE,0xFF,0x71,0x00,0xFE,0xFF,0x71,0x00,
 
 	/* Index 2, character 34 """ (width: 9 pixels) */
-	0x9, 0x7F,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,
+	0x7F,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 18 pixels) */
-	0x12, 0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x80,0x81,0x01,0x00,0x80,0x81,0x61,0x00,0x80,0x81,0x7F,0x00,0x80,0xF1,0x1F,0x00,0x80,0xFF,0x01,0x00,0xF8,0x8F,0x01,0x00,0xFE,0x81,0x71,0x00,0x86,0x81,0x7F,0x00,0x80,0xF1,0x1F,0x00,0x80,0xFF,0x01,0x00,0xF8,0x8F,0x01,0x00,0xFE,0x81,0x01,0x00,0x86,0x81,0x01,0x00,0x80,0x81,0x01,0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,
+	0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x80,0x81,0x01,0x00,0x80,0x81,0x61,0x00,0x80,0x81,0x7F,0x00,0x80,0xF1,0x1F,0x00,0x80,0xFF,0x01,0x00,0xF8,0x8F,0x01,0x00,0xFE,0x81,0x71,0x00,0x86,0x81,0x7F,0x00,0x80,0xF1,0x1F,0x00,0x80,0xFF,0x01,0x00,0xF8,0x8F,0x01,0x00,0xFE,0x81,0x01,0x00,0x86,0x81,0x01,0x00,0x80,0x81,0x01,0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,
 
 	/* Index 4, character 36 "$" (width: 14 pixels) */
-	0xE, 0x80,0x0F,0x38,0x00,0xC0,0x1F,0x38,0x00,0xE0,0x3F,0x70,0x00,0xE0,0x38,0x70,0x00,0x70,0x30,0x70,0x00,0x70,0x30,0x70,0x00,0xFF,0xFF,0xFF,0x0F,0xFF,0xFF,0xFF,0x0F,0x70,0x70,0x70,0x00,0x70,0x60,0x70,0x00,0x70,0xE0,0x38,0x00,0xE0,0xE0,0x3F,0x00,0xE0,0xC0,0x1F,0x00,0x00,0x80,0x0F,0x00,
+	0x80,0x0F,0x38,0x00,0xC0,0x1F,0x38,0x00,0xE0,0x3F,0x70,0x00,0xE0,0x38,0x70,0x00,0x70,0x30,0x70,0x00,0x70,0x30,0x70,0x00,0xFF,0xFF,0xFF,0x0F,0xFF,0xFF,0xFF,0x0F,0x70,0x70,0x70,0x00,0x70,0x60,0x70,0x00,0x70,0xE0,0x38,0x00,0xE0,0xE0,0x3F,0x00,0xE0,0xC0,0x1F,0x00,0x00,0x80,0x0F,0x00,
 
 	/* Index 5, character 37 "%" (width: 27 pixels) */
-	0x1B, 0xF0,0x03,0x00,0x00,0xFC,0x0F,0x00,0x00,0x0C,0x0C,0x00,0x00,0x06,0x18,0x00,0x00,0x06,0x18,0x00,0x00,0x06,0x18,0x00,0x00,0x06,0x18,0x00,0x00,0x0C,0x0C,0x40,0x00,0xFC,0x0F,0x70,0x00,0xF0,0x03,0x7C,0x00,0x00,0x00,0x0F,0x00,0x00,0xC0,0x03,0x00,0x00,0xF0,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x0F,0x00,0x00,0xC0,0x03,0x00,0x00,0xF0,0x00,0x00,0x00,0x3E,0xE0,0x0F,0x00,0x0E,0xF8,0x3F,0x00,0x02,0x18,0x30,0x00,0x00,0x0C,0x60,0x00,0x00,0x0C,0x60,0x00,0x00,0x0C,0x60,0x00,0x00,0x0C,0x60,0x00,0x00,0x18,0x30,0x00,0x00,0xF8,0x3F,0x00,0x00,0xE0,0x0F,0x00,
+	0xF0,0x03,0x00,0x00,0xFC,0x0F,0x00,0x00,0x0C,0x0C,0x00,0x00,0x06,0x18,0x00,0x00,0x06,0x18,0x00,0x00,0x06,0x18,0x00,0x00,0x06,0x18,0x00,0x00,0x0C,0x0C,0x40,0x00,0xFC,0x0F,0x70,0x00,0xF0,0x03,0x7C,0x00,0x00,0x00,0x0F,0x00,0x00,0xC0,0x03,0x00,0x00,0xF0,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x0F,0x00,0x00,0xC0,0x03,0x00,0x00,0xF0,0x00,0x00,0x00,0x3E,0xE0,0x0F,0x00,0x0E,0xF8,0x3F,0x00,0x02,0x18,0x30,0x00,0x00,0x0C,0x60,0x00,0x00,0x0C,0x60,0x00,0x00,0x0C,0x60,0x00,0x00,0x0C,0x60,0x00,0x00,0x18,0x30,0x00,0x00,0xF8,0x3F,0x00,0x00,0xE0,0x0F,0x00,
 
 	/* Index 6, character 38 "&" (width: 20 pixels) */
-	0x14, 0x00,0xC0,0x07,0x00,0xF0,0xE0,0x1F,0x00,0xF8,0xF1,0x3F,0x00,0xFC,0x3B,0x3C,0x00,0x0E,0x0F,0x78,0x00,0x06,0x0E,0x70,0x00,0x06,0x0E,0x70,0x00,0x06,0x1E,0x70,0x00,0x06,0x3E,0x70,0x00,0x0E,0x73,0x70,0x00,0xFC,0xE3,0x38,0x00,0xFC,0xC1,0x39,0x00,0xF8,0xC0,0x1F,0x00,0x00,0x80,0x0F,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFC,0x1D,0x00,0x00,0x7C,0x38,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x40,0x00,
+	0x00,0xC0,0x07,0x00,0xF0,0xE0,0x1F,0x00,0xF8,0xF1,0x3F,0x00,0xFC,0x3B,0x3C,0x00,0x0E,0x0F,0x78,0x00,0x06,0x0E,0x70,0x00,0x06,0x0E,0x70,0x00,0x06,0x1E,0x70,0x00,0x06,0x3E,0x70,0x00,0x0E,0x73,0x70,0x00,0xFC,0xE3,0x38,0x00,0xFC,0xC1,0x39,0x00,0xF8,0xC0,0x1F,0x00,0x00,0x80,0x0F,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFC,0x1D,0x00,0x00,0x7C,0x38,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x40,0x00,
 
 	/* Index 7, character 39 "'" (width: 3 pixels) */
-	0x3, 0x7F,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,
+	0x7F,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 9 pixels) */
-	0x9, 0x00,0xFC,0x07,0x00,0xC0,0xFF,0x7F,0x00,0xF0,0xFF,0xFF,0x01,0xF8,0x03,0xF8,0x03,0x7E,0x00,0xC0,0x0F,0x1F,0x00,0x00,0x1F,0x07,0x00,0x00,0x1C,0x03,0x00,0x00,0x18,0x01,0x00,0x00,0x10,
+	0x00,0xFC,0x07,0x00,0xC0,0xFF,0x7F,0x00,0xF0,0xFF,0xFF,0x01,0xF8,0x03,0xF8,0x03,0x7E,0x00,0xC0,0x0F,0x1F,0x00,0x00,0x1F,0x07,0x00,0x00,0x1C,0x03,0x00,0x00,0x18,0x01,0x00,0x00,0x10,
 
 	/* Index 9, character 41 ")" (width: 9 pixels) */
-	0x9, 0x01,0x00,0x00,0x10,0x03,0x00,0x00,0x18,0x07,0x00,0x00,0x1C,0x1F,0x00,0x00,0x1F,0x7E,0x00,0xC0,0x0F,0xF8,0x03,0xF8,0x03,0xF0,0xFF,0xFF,0x01,0xC0,0xFF,0x7F,0x00,0x00,0xFC,0x07,0x00,
+	0x01,0x00,0x00,0x10,0x03,0x00,0x00,0x18,0x07,0x00,0x00,0x1C,0x1F,0x00,0x00,0x1F,0x7E,0x00,0xC0,0x0F,0xF8,0x03,0xF8,0x03,0xF0,0xFF,0xFF,0x01,0xC0,0xFF,0x7F,0x00,0x00,0xFC,0x07,0x00,
 
 	/* Index 10, character 42 "*" (width: 14 pixels) */
-	0xE, 0x08,0x02,0x00,0x00,0x0C,0x06,0x00,0x00,0x18,0x03,0x00,0x00,0x10,0x01,0x00,0x00,0xB0,0x01,0x00,0x00,0xE0,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0xFF,0x1F,0x00,0x00,0xE0,0x00,0x00,0x00,0xB0,0x01,0x00,0x00,0x10,0x01,0x00,0x00,0x18,0x03,0x00,0x00,0x0C,0x06,0x00,0x00,0x08,0x02,0x00,0x00,
+	0x08,0x02,0x00,0x00,0x0C,0x06,0x00,0x00,0x18,0x03,0x00,0x00,0x10,0x01,0x00,0x00,0xB0,0x01,0x00,0x00,0xE0,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0xFF,0x1F,0x00,0x00,0xE0,0x00,0x00,0x00,0xB0,0x01,0x00,0x00,0x10,0x01,0x00,0x00,0x18,0x03,0x00,0x00,0x0C,0x06,0x00,0x00,0x08,0x02,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 18 pixels) */
-	0x12, 0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0xE0,0xFF,0x7F,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,
+	0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0xE0,0xFF,0x7F,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,
 
 	/* Index 12, character 44 "," (width: 6 pixels) */
-	0x6, 0x00,0x00,0x00,0x0C,0x00,0x00,0xC0,0x0F,0x00,0x00,0xF8,0x07,0x00,0x00,0xF8,0x01,0x00,0x00,0x38,0x00,0x00,0x00,0x08,0x00,
+	0x00,0x00,0x00,0x0C,0x00,0x00,0xC0,0x0F,0x00,0x00,0xF8,0x07,0x00,0x00,0xF8,0x01,0x00,0x00,0x38,0x00,0x00,0x00,0x08,0x00,
 
 	/* Index 13, character 45 "-" (width: 9 pixels) */
-	0x9, 0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,
+	0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,
 
 	/* Index 14, character 46 "." (width: 3 pixels) */
-	0x3, 0x00,0x00,0x78,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x78,0x00,
+	0x00,0x00,0x78,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x78,0x00,
 
 	/* Index 15, character 47 "/" (width: 13 pixels) */
-	0xD, 0x00,0x00,0x00,0x04,0x00,0x00,0x80,0x07,0x00,0x00,0xE0,0x03,0x00,0x00,0xFC,0x00,0x00,0x00,0x1F,0x00,0x00,0xE0,0x07,0x00,0x00,0xF8,0x00,0x00,0x00,0x3F,0x00,0x00,0xC0,0x07,0x00,0x00,0xF8,0x01,0x00,0x00,0x3E,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x04,0x00,0x00,0x80,0x07,0x00,0x00,0xE0,0x03,0x00,0x00,0xFC,0x00,0x00,0x00,0x1F,0x00,0x00,0xE0,0x07,0x00,0x00,0xF8,0x00,0x00,0x00,0x3F,0x00,0x00,0xC0,0x07,0x00,0x00,0xF8,0x01,0x00,0x00,0x3E,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
 
 	/* Index 16, character 48 "0" (width: 14 pixels) */
-	0xE, 0x80,0xFF,0x01,0x00,0xF0,0xFF,0x0F,0x00,0xF8,0xFF,0x1F,0x00,0x7C,0x00,0x3E,0x00,0x1E,0x00,0x78,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x1E,0x00,0x78,0x00,0x7C,0x00,0x3E,0x00,0xF8,0xFF,0x1F,0x00,0xF0,0xFF,0x0F,0x00,0x80,0xFF,0x01,0x00,
+	0x80,0xFF,0x01,0x00,0xF0,0xFF,0x0F,0x00,0xF8,0xFF,0x1F,0x00,0x7C,0x00,0x3E,0x00,0x1E,0x00,0x78,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x1E,0x00,0x78,0x00,0x7C,0x00,0x3E,0x00,0xF8,0xFF,0x1F,0x00,0xF0,0xFF,0x0F,0x00,0x80,0xFF,0x01,0x00,
 
 	/* Index 17, character 49 "1" (width: 11 pixels) */
-	0xB, 0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x78,0x00,0x70,0x00,0xFC,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,
+	0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x78,0x00,0x70,0x00,0xFC,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,
 
 	/* Index 18, character 50 "2" (width: 14 pixels) */
-	0xE, 0x00,0x00,0x78,0x00,0x1C,0x00,0x7C,0x00,0x1C,0x00,0x7E,0x00,0x0E,0x00,0x77,0x00,0x0E,0x00,0x77,0x00,0x0E,0x80,0x73,0x00,0x0E,0xC0,0x71,0x00,0x0E,0xE0,0x70,0x00,0x1E,0x78,0x70,0x00,0x1E,0x3C,0x70,0x00,0xFC,0x1F,0x70,0x00,0xF8,0x07,0x70,0x00,0xF0,0x03,0x70,0x00,0x00,0x00,0x70,0x00,
+	0x00,0x00,0x78,0x00,0x1C,0x00,0x7C,0x00,0x1C,0x00,0x7E,0x00,0x0E,0x00,0x77,0x00,0x0E,0x00,0x77,0x00,0x0E,0x80,0x73,0x00,0x0E,0xC0,0x71,0x00,0x0E,0xE0,0x70,0x00,0x1E,0x78,0x70,0x00,0x1E,0x3C,0x70,0x00,0xFC,0x1F,0x70,0x00,0xF8,0x07,0x70,0x00,0xF0,0x03,0x70,0x00,0x00,0x00,0x70,0x00,
 
 	/* Index 19, character 51 "3" (width: 14 pixels) */
-	0xE, 0x00,0x00,0x38,0x00,0x1C,0x00,0x38,0x00,0x1C,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x3E,0x78,0x00,0x1C,0x37,0x3C,0x00,0xFC,0xF3,0x3F,0x00,0xF8,0xE3,0x1F,0x00,0xF0,0xC0,0x07,0x00,
+	0x00,0x00,0x38,0x00,0x1C,0x00,0x38,0x00,0x1C,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x3E,0x78,0x00,0x1C,0x37,0x3C,0x00,0xFC,0xF3,0x3F,0x00,0xF8,0xE3,0x1F,0x00,0xF0,0xC0,0x07,0x00,
 
 	/* Index 20, character 52 "4" (width: 16 pixels) */
-	0x10, 0x00,0xE0,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0xFC,0x01,0x00,0x00,0xFE,0x01,0x00,0x00,0xDF,0x01,0x00,0x80,0xCF,0x01,0x00,0xE0,0xC3,0x01,0x00,0xF0,0xC1,0x01,0x00,0xF8,0xC0,0x01,0x00,0x7C,0xC0,0x01,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0xC0,0x01,0x00,0x00,0xC0,0x01,0x00,0x00,0xC0,0x01,0x00,
+	0x00,0xE0,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0xFC,0x01,0x00,0x00,0xFE,0x01,0x00,0x00,0xDF,0x01,0x00,0x80,0xCF,0x01,0x00,0xE0,0xC3,0x01,0x00,0xF0,0xC1,0x01,0x00,0xF8,0xC0,0x01,0x00,0x7C,0xC0,0x01,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0xC0,0x01,0x00,0x00,0xC0,0x01,0x00,0x00,0xC0,0x01,0x00,
 
 	/* Index 21, character 53 "5" (width: 13 pixels) */
-	0xD, 0x00,0x00,0x38,0x00,0xFE,0x1F,0x38,0x00,0xFE,0x0F,0x70,0x00,0xFE,0x0F,0x70,0x00,0x0E,0x0E,0x70,0x00,0x0E,0x0E,0x70,0x00,0x0E,0x0E,0x70,0x00,0x0E,0x0E,0x70,0x00,0x0E,0x1E,0x78,0x00,0x0E,0x3C,0x3C,0x00,0x0E,0xFC,0x1F,0x00,0x0E,0xF8,0x0F,0x00,0x0E,0xE0,0x07,0x00,
+	0x00,0x00,0x38,0x00,0xFE,0x1F,0x38,0x00,0xFE,0x0F,0x70,0x00,0xFE,0x0F,0x70,0x00,0x0E,0x0E,0x70,0x00,0x0E,0x0E,0x70,0x00,0x0E,0x0E,0x70,0x00,0x0E,0x0E,0x70,0x00,0x0E,0x1E,0x78,0x00,0x0E,0x3C,0x3C,0x00,0x0E,0xFC,0x1F,0x00,0x0E,0xF8,0x0F,0x00,0x0E,0xE0,0x07,0x00,
 
 	/* Index 22, character 54 "6" (width: 14 pixels) */
-	0xE, 0x00,0xFE,0x03,0x00,0xC0,0xFF,0x0F,0x00,0xF0,0xFF,0x1F,0x00,0xF8,0x1C,0x3E,0x00,0x3C,0x0C,0x78,0x00,0x1C,0x0E,0x70,0x00,0x1E,0x0E,0x70,0x00,0x0E,0x0E,0x70,0x00,0x0E,0x0E,0x70,0x00,0x0E,0x1E,0x78,0x00,0x0E,0x3C,0x3C,0x00,0x1E,0xFC,0x1F,0x00,0x00,0xF8,0x0F,0x00,0x00,0xE0,0x07,0x00,
+	0x00,0xFE,0x03,0x00,0xC0,0xFF,0x0F,0x00,0xF0,0xFF,0x1F,0x00,0xF8,0x1C,0x3E,0x00,0x3C,0x0C,0x78,0x00,0x1C,0x0E,0x70,0x00,0x1E,0x0E,0x70,0x00,0x0E,0x0E,0x70,0x00,0x0E,0x0E,0x70,0x00,0x0E,0x1E,0x78,0x00,0x0E,0x3C,0x3C,0x00,0x1E,0xFC,0x1F,0x00,0x00,0xF8,0x0F,0x00,0x00,0xE0,0x07,0x00,
 
 	/* Index 23, character 55 "7" (width: 14 pixels) */
-	0xE, 0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x40,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x7C,0x00,0x0E,0x00,0x7F,0x00,0x0E,0xC0,0x1F,0x00,0x0E,0xF0,0x07,0x00,0x0E,0xFC,0x00,0x00,0x0E,0x3F,0x00,0x00,0xCE,0x0F,0x00,0x00,0xFE,0x03,0x00,0x00,0xFE,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,
+	0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x40,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x7C,0x00,0x0E,0x00,0x7F,0x00,0x0E,0xC0,0x1F,0x00,0x0E,0xF0,0x07,0x00,0x0E,0xFC,0x00,0x00,0x0E,0x3F,0x00,0x00,0xCE,0x0F,0x00,0x00,0xFE,0x03,0x00,0x00,0xFE,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,
 
 	/* Index 24, character 56 "8" (width: 14 pixels) */
-	0xE, 0x00,0xC0,0x07,0x00,0xF0,0xE1,0x1F,0x00,0xF8,0xF3,0x3F,0x00,0xFC,0x3F,0x3C,0x00,0x1E,0x1F,0x78,0x00,0x0E,0x0E,0x70,0x00,0x0E,0x0C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x18,0x70,0x00,0x1E,0x3C,0x78,0x00,0xFC,0x7F,0x3C,0x00,0xF8,0xF3,0x3F,0x00,0xF0,0xE1,0x1F,0x00,0x00,0xC0,0x07,0x00,
+	0x00,0xC0,0x07,0x00,0xF0,0xE1,0x1F,0x00,0xF8,0xF3,0x3F,0x00,0xFC,0x3F,0x3C,0x00,0x1E,0x1F,0x78,0x00,0x0E,0x0E,0x70,0x00,0x0E,0x0C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x18,0x70,0x00,0x1E,0x3C,0x78,0x00,0xFC,0x7F,0x3C,0x00,0xF8,0xF3,0x3F,0x00,0xF0,0xE1,0x1F,0x00,0x00,0xC0,0x07,0x00,
 
 	/* Index 25, character 57 "9" (width: 14 pixels) */
-	0xE, 0xE0,0x07,0x00,0x00,0xF0,0x1F,0x00,0x00,0xF8,0x3F,0x78,0x00,0x3C,0x3C,0x70,0x00,0x1E,0x78,0x70,0x00,0x0E,0x70,0x70,0x00,0x0E,0x70,0x70,0x00,0x0E,0x70,0x78,0x00,0x0E,0x70,0x38,0x00,0x1E,0x30,0x3C,0x00,0x7C,0x38,0x1F,0x00,0xF8,0xFF,0x0F,0x00,0xF0,0xFF,0x03,0x00,0xC0,0x7F,0x00,0x00,
+	0xE0,0x07,0x00,0x00,0xF0,0x1F,0x00,0x00,0xF8,0x3F,0x78,0x00,0x3C,0x3C,0x70,0x00,0x1E,0x78,0x70,0x00,0x0E,0x70,0x70,0x00,0x0E,0x70,0x70,0x00,0x0E,0x70,0x78,0x00,0x0E,0x70,0x38,0x00,0x1E,0x30,0x3C,0x00,0x7C,0x38,0x1F,0x00,0xF8,0xFF,0x0F,0x00,0xF0,0xFF,0x03,0x00,0xC0,0x7F,0x00,0x00,
 
 	/* Index 26, character 58 ":" (width: 3 pixels) */
-	0x3, 0x80,0x07,0x78,0x00,0x80,0x07,0x78,0x00,0x80,0x07,0x78,0x00,
+	0x80,0x07,0x78,0x00,0x80,0x07,0x78,0x00,0x80,0x07,0x78,0x00,
 
 	/* Index 27, character 59 ";" (width: 6 pixels) */
-	0x6, 0x00,0x00,0x00,0x0C,0x00,0x00,0xC0,0x0F,0x80,0x07,0xF8,0x07,0x80,0x07,0xF8,0x01,0x80,0x07,0x38,0x00,0x00,0x00,0x08,0x00,
+	0x00,0x00,0x00,0x0C,0x00,0x00,0xC0,0x0F,0x80,0x07,0xF8,0x07,0x80,0x07,0xF8,0x01,0x80,0x07,0x38,0x00,0x00,0x00,0x08,0x00,
 
 	/* Index 28, character 60 "<" (width: 16 pixels) */
-	0x10, 0x00,0x60,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x98,0x01,0x00,0x00,0x98,0x01,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x06,0x06,0x00,0x00,0x06,0x06,0x00,0x00,0x07,0x0E,0x00,0x00,0x03,0x0C,0x00,0x00,0x03,0x0C,0x00,0x80,0x01,0x18,0x00,0x80,0x01,0x18,0x00,0xC0,0x00,0x30,0x00,
+	0x00,0x60,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x98,0x01,0x00,0x00,0x98,0x01,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x06,0x06,0x00,0x00,0x06,0x06,0x00,0x00,0x07,0x0E,0x00,0x00,0x03,0x0C,0x00,0x00,0x03,0x0C,0x00,0x80,0x01,0x18,0x00,0x80,0x01,0x18,0x00,0xC0,0x00,0x30,0x00,
 
 	/* Index 29, character 61 "=" (width: 17 pixels) */
-	0x11, 0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,
+	0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,
 
 	/* Index 30, character 62 ">" (width: 16 pixels) */
-	0x10, 0xC0,0x00,0x30,0x00,0x80,0x01,0x18,0x00,0x80,0x01,0x18,0x00,0x00,0x03,0x0C,0x00,0x00,0x03,0x0C,0x00,0x00,0x07,0x0E,0x00,0x00,0x06,0x06,0x00,0x00,0x06,0x06,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x98,0x01,0x00,0x00,0x98,0x01,0x00,0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x60,0x00,0x00,
+	0xC0,0x00,0x30,0x00,0x80,0x01,0x18,0x00,0x80,0x01,0x18,0x00,0x00,0x03,0x0C,0x00,0x00,0x03,0x0C,0x00,0x00,0x07,0x0E,0x00,0x00,0x06,0x06,0x00,0x00,0x06,0x06,0x00,0x00,0x0C,0x03,0x00,0x00,0x0C,0x03,0x00,0x00,0x98,0x01,0x00,0x00,0x98,0x01,0x00,0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x60,0x00,0x00,
 
 	/* Index 31, character 63 "?" (width: 12 pixels) */
-	0xC, 0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0xF0,0x71,0x00,0x0E,0xF0,0x71,0x00,0x0E,0xF8,0x71,0x00,0x0E,0x3C,0x00,0x00,0x1C,0x1E,0x00,0x00,0xFC,0x0F,0x00,0x00,0xF8,0x07,0x00,0x00,0xF0,0x01,0x00,0x00,
+	0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0xF0,0x71,0x00,0x0E,0xF0,0x71,0x00,0x0E,0xF8,0x71,0x00,0x0E,0x3C,0x00,0x00,0x1C,0x1E,0x00,0x00,0xFC,0x0F,0x00,0x00,0xF8,0x07,0x00,0x00,0xF0,0x01,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 24 pixels) */
-	0x18, 0x00,0xFC,0x01,0x00,0x80,0xFF,0x0F,0x00,0xC0,0x03,0x1E,0x00,0xE0,0x00,0x78,0x00,0x30,0x00,0xE0,0x00,0x18,0x00,0xC0,0x00,0x1C,0xF8,0x83,0x01,0x0C,0xFE,0x87,0x01,0x0C,0x07,0x8E,0x03,0x86,0x03,0x1C,0x03,0x86,0x01,0x18,0x03,0x86,0x01,0x18,0x03,0x86,0x01,0x18,0x03,0x86,0x01,0x0C,0x03,0x06,0x03,0x0C,0x03,0x86,0xFF,0x1F,0x03,0x8C,0xFF,0x9F,0x03,0x0C,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x38,0x00,0x18,0x00,0x70,0x00,0x18,0x00,0xE0,0x03,0x1E,0x00,0x80,0xFF,0x0F,0x00,0x00,0xFE,0x01,0x00,
+	0x00,0xFC,0x01,0x00,0x80,0xFF,0x0F,0x00,0xC0,0x03,0x1E,0x00,0xE0,0x00,0x78,0x00,0x30,0x00,0xE0,0x00,0x18,0x00,0xC0,0x00,0x1C,0xF8,0x83,0x01,0x0C,0xFE,0x87,0x01,0x0C,0x07,0x8E,0x03,0x86,0x03,0x1C,0x03,0x86,0x01,0x18,0x03,0x86,0x01,0x18,0x03,0x86,0x01,0x18,0x03,0x86,0x01,0x0C,0x03,0x06,0x03,0x0C,0x03,0x86,0xFF,0x1F,0x03,0x8C,0xFF,0x9F,0x03,0x0C,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x38,0x00,0x18,0x00,0x70,0x00,0x18,0x00,0xE0,0x03,0x1E,0x00,0x80,0xFF,0x0F,0x00,0x00,0xFE,0x01,0x00,
 
 	/* Index 33, character 65 "A" (width: 20 pixels) */
-	0x14, 0x00,0x00,0x40,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x7F,0x00,0x00,0xE0,0x3F,0x00,0x00,0xF8,0x07,0x00,0x00,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xFC,0xC7,0x01,0x00,0xFE,0xC0,0x01,0x00,0x1E,0xC0,0x01,0x00,0x1E,0xC0,0x01,0x00,0xFE,0xC0,0x01,0x00,0xFC,0xC7,0x01,0x00,0xE0,0xFF,0x01,0x00,0x00,0xFF,0x01,0x00,0x00,0xF8,0x07,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x40,0x00,
+	0x00,0x00,0x40,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x7F,0x00,0x00,0xE0,0x3F,0x00,0x00,0xF8,0x07,0x00,0x00,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xFC,0xC7,0x01,0x00,0xFE,0xC0,0x01,0x00,0x1E,0xC0,0x01,0x00,0x1E,0xC0,0x01,0x00,0xFE,0xC0,0x01,0x00,0xFC,0xC7,0x01,0x00,0xE0,0xFF,0x01,0x00,0x00,0xFF,0x01,0x00,0x00,0xF8,0x07,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x40,0x00,
 
 	/* Index 34, character 66 "B" (width: 16 pixels) */
-	0x10, 0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x1E,0x1E,0x70,0x00,0xFC,0x3B,0x38,0x00,0xFC,0x3B,0x3C,0x00,0xF0,0xF0,0x1F,0x00,0x00,0xF0,0x1F,0x00,0x00,0xC0,0x07,0x00,
+	0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x1E,0x1E,0x70,0x00,0xFC,0x3B,0x38,0x00,0xFC,0x3B,0x3C,0x00,0xF0,0xF0,0x1F,0x00,0x00,0xF0,0x1F,0x00,0x00,0xC0,0x07,0x00,
 
 	/* Index 35, character 67 "C" (width: 17 pixels) */
-	0x11, 0x00,0xFF,0x00,0x00,0xC0,0xFF,0x07,0x00,0xF0,0xFF,0x0F,0x00,0xF8,0x81,0x1F,0x00,0x7C,0x00,0x3E,0x00,0x3C,0x00,0x3C,0x00,0x1C,0x00,0x78,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x1C,0x00,0x38,0x00,0x1C,0x00,0x38,0x00,0x38,0x00,0x1C,0x00,
+	0x00,0xFF,0x00,0x00,0xC0,0xFF,0x07,0x00,0xF0,0xFF,0x0F,0x00,0xF8,0x81,0x1F,0x00,0x7C,0x00,0x3E,0x00,0x3C,0x00,0x3C,0x00,0x1C,0x00,0x78,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x1C,0x00,0x38,0x00,0x1C,0x00,0x38,0x00,0x38,0x00,0x1C,0x00,
 
 	/* Index 36, character 68 "D" (width: 17 pixels) */
-	0x11, 0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x1E,0x00,0x78,0x00,0x1C,0x00,0x38,0x00,0x3C,0x00,0x3C,0x00,0x78,0x00,0x1E,0x00,0xF8,0x81,0x1F,0x00,0xF0,0xFF,0x0F,0x00,0xC0,0xFF,0x03,0x00,0x00,0xFF,0x00,0x00,
+	0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x1E,0x00,0x78,0x00,0x1C,0x00,0x38,0x00,0x3C,0x00,0x3C,0x00,0x78,0x00,0x1E,0x00,0xF8,0x81,0x1F,0x00,0xF0,0xFF,0x0F,0x00,0xC0,0xFF,0x03,0x00,0x00,0xFF,0x00,0x00,
 
 	/* Index 37, character 69 "E" (width: 13 pixels) */
-	0xD, 0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,
+	0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,
 
 	/* Index 38, character 70 "F" (width: 14 pixels) */
-	0xE, 0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x00,0x00,0x00,
+	0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x1C,0x00,0x00,0x0E,0x00,0x00,0x00,
 
 	/* Index 39, character 71 "G" (width: 18 pixels) */
-	0x12, 0x00,0xFF,0x00,0x00,0xC0,0xFF,0x03,0x00,0xF0,0xFF,0x0F,0x00,0xF8,0x81,0x1F,0x00,0x78,0x00,0x1E,0x00,0x3C,0x00,0x3C,0x00,0x1C,0x00,0x38,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x70,0x70,0x00,0x0E,0x70,0x70,0x00,0x0E,0x70,0x70,0x00,0x0E,0x70,0x70,0x00,0x1E,0x70,0x38,0x00,0x1C,0xF0,0x3F,0x00,0x1C,0xF0,0x3F,0x00,0x38,0xF0,0x1F,0x00,
+	0x00,0xFF,0x00,0x00,0xC0,0xFF,0x03,0x00,0xF0,0xFF,0x0F,0x00,0xF8,0x81,0x1F,0x00,0x78,0x00,0x1E,0x00,0x3C,0x00,0x3C,0x00,0x1C,0x00,0x38,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x70,0x70,0x00,0x0E,0x70,0x70,0x00,0x0E,0x70,0x70,0x00,0x0E,0x70,0x70,0x00,0x1E,0x70,0x38,0x00,0x1C,0xF0,0x3F,0x00,0x1C,0xF0,0x3F,0x00,0x38,0xF0,0x1F,0x00,
 
 	/* Index 40, character 72 "H" (width: 16 pixels) */
-	0x10, 0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,
+	0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x1C,0x00,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,
 
 	/* Index 41, character 73 "I" (width: 9 pixels) */
-	0x9, 0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,
+	0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,
 
 	/* Index 42, character 74 "J" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x78,0x00,0xFE,0xFF,0x3F,0x00,0xFE,0xFF,0x1F,0x00,0xFE,0xFF,0x0F,0x00,
+	0x00,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x78,0x00,0xFE,0xFF,0x3F,0x00,0xFE,0xFF,0x1F,0x00,0xFE,0xFF,0x0F,0x00,
 
 	/* Index 43, character 75 "K" (width: 17 pixels) */
-	0x11, 0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x78,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x7F,0x00,0x00,0x80,0xF7,0x00,0x00,0xC0,0xE3,0x01,0x00,0xE0,0xC1,0x07,0x00,0xF0,0x80,0x0F,0x00,0x78,0x00,0x1F,0x00,0x3C,0x00,0x3C,0x00,0x1E,0x00,0x78,0x00,0x0E,0x00,0x70,0x00,0x06,0x00,0x60,0x00,0x02,0x00,0x40,0x00,
+	0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x78,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x7F,0x00,0x00,0x80,0xF7,0x00,0x00,0xC0,0xE3,0x01,0x00,0xE0,0xC1,0x07,0x00,0xF0,0x80,0x0F,0x00,0x78,0x00,0x1F,0x00,0x3C,0x00,0x3C,0x00,0x1E,0x00,0x78,0x00,0x0E,0x00,0x70,0x00,0x06,0x00,0x60,0x00,0x02,0x00,0x40,0x00,
 
 	/* Index 44, character 76 "L" (width: 13 pixels) */
-	0xD, 0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,
+	0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,
 
 	/* Index 45, character 77 "M" (width: 18 pixels) */
-	0x12, 0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x1E,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0x7C,0x00,0x00,0x80,0x1F,0x00,0x00,0xE0,0x03,0x00,0x00,0xFC,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,
+	0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x1E,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0x7C,0x00,0x00,0x80,0x1F,0x00,0x00,0xE0,0x03,0x00,0x00,0xFC,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,
 
 	/* Index 46, character 78 "N" (width: 16 pixels) */
-	0x10, 0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xE0,0x07,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x7C,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,
+	0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xE0,0x07,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x7C,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,
 
 	/* Index 47, character 79 "O" (width: 19 pixels) */
-	0x13, 0x00,0xFF,0x00,0x00,0xE0,0xFF,0x07,0x00,0xF0,0xFF,0x0F,0x00,0xF8,0x00,0x1F,0x00,0x3C,0x00,0x3C,0x00,0x1C,0x00,0x38,0x00,0x1E,0x00,0x78,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x1E,0x00,0x78,0x00,0x1C,0x00,0x38,0x00,0x3C,0x00,0x3C,0x00,0xF8,0x00,0x1F,0x00,0xF0,0xFF,0x0F,0x00,0xE0,0xFF,0x07,0x00,0x00,0xFF,0x00,0x00,
+	0x00,0xFF,0x00,0x00,0xE0,0xFF,0x07,0x00,0xF0,0xFF,0x0F,0x00,0xF8,0x00,0x1F,0x00,0x3C,0x00,0x3C,0x00,0x1C,0x00,0x38,0x00,0x1E,0x00,0x78,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x1E,0x00,0x78,0x00,0x1C,0x00,0x38,0x00,0x3C,0x00,0x3C,0x00,0xF8,0x00,0x1F,0x00,0xF0,0xFF,0x0F,0x00,0xE0,0xFF,0x07,0x00,0x00,0xFF,0x00,0x00,
 
 	/* Index 48, character 80 "P" (width: 13 pixels) */
-	0xD, 0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x70,0x00,0x00,0x0E,0x70,0x00,0x00,0x0E,0x70,0x00,0x00,0x0E,0x70,0x00,0x00,0x0E,0x70,0x00,0x00,0x1E,0x78,0x00,0x00,0x3C,0x3C,0x00,0x00,0xFC,0x1F,0x00,0x00,0xF8,0x0F,0x00,0x00,0xE0,0x07,0x00,0x00,
+	0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x70,0x00,0x00,0x0E,0x70,0x00,0x00,0x0E,0x70,0x00,0x00,0x0E,0x70,0x00,0x00,0x0E,0x70,0x00,0x00,0x1E,0x78,0x00,0x00,0x3C,0x3C,0x00,0x00,0xFC,0x1F,0x00,0x00,0xF8,0x0F,0x00,0x00,0xE0,0x07,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 19 pixels) */
-	0x13, 0x00,0xFF,0x00,0x00,0xE0,0xFF,0x07,0x00,0xF0,0xFF,0x0F,0x00,0xF8,0x00,0x1F,0x00,0x3C,0x00,0x3C,0x00,0x1C,0x00,0x38,0x00,0x1E,0x00,0x78,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0xF0,0x03,0x1E,0x00,0xF8,0x07,0x1C,0x00,0xF8,0x0F,0x3C,0x00,0x3C,0x1E,0xF8,0x00,0x1F,0x1C,0xF0,0xFF,0x0F,0x1C,0xE0,0xFF,0x03,0x1C,0x00,0xFF,0x00,0x1C,
+	0x00,0xFF,0x00,0x00,0xE0,0xFF,0x07,0x00,0xF0,0xFF,0x0F,0x00,0xF8,0x00,0x1F,0x00,0x3C,0x00,0x3C,0x00,0x1C,0x00,0x38,0x00,0x1E,0x00,0x78,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0xF0,0x03,0x1E,0x00,0xF8,0x07,0x1C,0x00,0xF8,0x0F,0x3C,0x00,0x3C,0x1E,0xF8,0x00,0x1F,0x1C,0xF0,0xFF,0x0F,0x1C,0xE0,0xFF,0x03,0x1C,0x00,0xFF,0x00,0x1C,
 
 	/* Index 50, character 82 "R" (width: 17 pixels) */
-	0x11, 0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x38,0x00,0x00,0x0E,0x38,0x00,0x00,0x0E,0x38,0x00,0x00,0x0E,0x38,0x00,0x00,0x0E,0x78,0x00,0x00,0x0E,0xF8,0x01,0x00,0x1E,0xFC,0x03,0x00,0x1C,0x9E,0x07,0x00,0xFC,0x0F,0x1F,0x00,0xF8,0x07,0x3E,0x00,0xF0,0x03,0x7C,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x40,0x00,
+	0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x38,0x00,0x00,0x0E,0x38,0x00,0x00,0x0E,0x38,0x00,0x00,0x0E,0x38,0x00,0x00,0x0E,0x78,0x00,0x00,0x0E,0xF8,0x01,0x00,0x1E,0xFC,0x03,0x00,0x1C,0x9E,0x07,0x00,0xFC,0x0F,0x1F,0x00,0xF8,0x07,0x3E,0x00,0xF0,0x03,0x7C,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x40,0x00,
 
 	/* Index 51, character 83 "S" (width: 16 pixels) */
-	0x10, 0xE0,0x03,0x3C,0x00,0xF8,0x07,0x38,0x00,0xFC,0x0F,0x38,0x00,0x1C,0x0E,0x78,0x00,0x1E,0x1E,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x18,0x70,0x00,0x0E,0x38,0x70,0x00,0x0E,0x38,0x70,0x00,0x0E,0x38,0x38,0x00,0x1C,0x78,0x3C,0x00,0x1C,0xF0,0x1F,0x00,0x3C,0xE0,0x0F,0x00,0x00,0xC0,0x07,0x00,
+	0xE0,0x03,0x3C,0x00,0xF8,0x07,0x38,0x00,0xFC,0x0F,0x38,0x00,0x1C,0x0E,0x78,0x00,0x1E,0x1E,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x1C,0x70,0x00,0x0E,0x18,0x70,0x00,0x0E,0x38,0x70,0x00,0x0E,0x38,0x70,0x00,0x0E,0x38,0x38,0x00,0x1C,0x78,0x3C,0x00,0x1C,0xF0,0x1F,0x00,0x3C,0xE0,0x0F,0x00,0x00,0xC0,0x07,0x00,
 
 	/* Index 52, character 84 "T" (width: 19 pixels) */
-	0x13, 0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,
+	0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,
 
 	/* Index 53, character 85 "U" (width: 15 pixels) */
-	0xF, 0xFE,0xFF,0x03,0x00,0xFE,0xFF,0x0F,0x00,0xFE,0xFF,0x1F,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x3E,0x00,0xFE,0xFF,0x1F,0x00,0xFE,0xFF,0x0F,0x00,0xFE,0xFF,0x03,0x00,
+	0xFE,0xFF,0x03,0x00,0xFE,0xFF,0x0F,0x00,0xFE,0xFF,0x1F,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x3E,0x00,0xFE,0xFF,0x1F,0x00,0xFE,0xFF,0x0F,0x00,0xFE,0xFF,0x03,0x00,
 
 	/* Index 54, character 86 "V" (width: 20 pixels) */
-	0x14, 0x02,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0xE0,0x1F,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x7F,0x00,0x00,0xE0,0x3F,0x00,0x00,0xFC,0x07,0x00,0x80,0xFF,0x00,0x00,0xE0,0x1F,0x00,0x00,0xFC,0x07,0x00,0x00,0xFE,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+	0x02,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0xE0,0x1F,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x7F,0x00,0x00,0xE0,0x3F,0x00,0x00,0xFC,0x07,0x00,0x80,0xFF,0x00,0x00,0xE0,0x1F,0x00,0x00,0xFC,0x07,0x00,0x00,0xFE,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
 
 	/* Index 55, character 87 "W" (width: 27 pixels) */
-	0x1B, 0x06,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0xF8,0x3F,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0xF8,0x3F,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x78,0x00,0x00,0x80,0x7F,0x00,0x00,0xF8,0x1F,0x00,0x80,0xFF,0x01,0x00,0xF8,0x1F,0x00,0x00,0xFE,0x01,0x00,0x00,0x1E,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xF8,0x1F,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0xF8,0x1F,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x7F,0x00,0x00,0xF8,0x3F,0x00,0x80,0xFF,0x03,0x00,0xF8,0x7F,0x00,0x00,0xFE,0x07,0x00,0x00,0x7E,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+	0x06,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0xF8,0x3F,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0xF8,0x3F,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x78,0x00,0x00,0x80,0x7F,0x00,0x00,0xF8,0x1F,0x00,0x80,0xFF,0x01,0x00,0xF8,0x1F,0x00,0x00,0xFE,0x01,0x00,0x00,0x1E,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xF8,0x1F,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0xF8,0x1F,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x7F,0x00,0x00,0xF8,0x3F,0x00,0x80,0xFF,0x03,0x00,0xF8,0x7F,0x00,0x00,0xFE,0x07,0x00,0x00,0x7E,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
 
 	/* Index 56, character 88 "X" (width: 18 pixels) */
-	0x12, 0x02,0x00,0x40,0x00,0x06,0x00,0x60,0x00,0x1E,0x00,0x78,0x00,0x3E,0x00,0x7C,0x00,0xFC,0x00,0x1F,0x00,0xF0,0x81,0x0F,0x00,0xC0,0xE7,0x03,0x00,0x80,0xFF,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xFF,0x00,0x00,0xC0,0xE7,0x03,0x00,0xF0,0x81,0x0F,0x00,0xF8,0x00,0x1F,0x00,0x3E,0x00,0x7C,0x00,0x1E,0x00,0x78,0x00,0x06,0x00,0x60,0x00,0x02,0x00,0x40,0x00,
+	0x02,0x00,0x40,0x00,0x06,0x00,0x60,0x00,0x1E,0x00,0x78,0x00,0x3E,0x00,0x7C,0x00,0xFC,0x00,0x1F,0x00,0xF0,0x81,0x0F,0x00,0xC0,0xE7,0x03,0x00,0x80,0xFF,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xFF,0x00,0x00,0xC0,0xE7,0x03,0x00,0xF0,0x81,0x0F,0x00,0xF8,0x00,0x1F,0x00,0x3E,0x00,0x7C,0x00,0x1E,0x00,0x78,0x00,0x06,0x00,0x60,0x00,0x02,0x00,0x40,0x00,
 
 	/* Index 57, character 89 "Y" (width: 19 pixels) */
-	0x13, 0x02,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0xF8,0x7F,0x00,0x00,0xFE,0x7F,0x00,0x00,0x1F,0x00,0x00,0xC0,0x07,0x00,0x00,0xF0,0x01,0x00,0x00,0xF8,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+	0x02,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0xF8,0x7F,0x00,0x00,0xFE,0x7F,0x00,0x00,0x1F,0x00,0x00,0xC0,0x07,0x00,0x00,0xF0,0x01,0x00,0x00,0xF8,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
 
 	/* Index 58, character 90 "Z" (width: 16 pixels) */
-	0x10, 0x0E,0x00,0x78,0x00,0x0E,0x00,0x7C,0x00,0x0E,0x00,0x7E,0x00,0x0E,0x80,0x7F,0x00,0x0E,0xC0,0x77,0x00,0x0E,0xE0,0x73,0x00,0x0E,0xF8,0x70,0x00,0x0E,0x7C,0x70,0x00,0x0E,0x3E,0x70,0x00,0x0E,0x0F,0x70,0x00,0xCE,0x07,0x70,0x00,0xEE,0x03,0x70,0x00,0xFE,0x01,0x70,0x00,0x7E,0x00,0x70,0x00,0x3E,0x00,0x70,0x00,0x1E,0x00,0x70,0x00,
+	0x0E,0x00,0x78,0x00,0x0E,0x00,0x7C,0x00,0x0E,0x00,0x7E,0x00,0x0E,0x80,0x7F,0x00,0x0E,0xC0,0x77,0x00,0x0E,0xE0,0x73,0x00,0x0E,0xF8,0x70,0x00,0x0E,0x7C,0x70,0x00,0x0E,0x3E,0x70,0x00,0x0E,0x0F,0x70,0x00,0xCE,0x07,0x70,0x00,0xEE,0x03,0x70,0x00,0xFE,0x01,0x70,0x00,0x7E,0x00,0x70,0x00,0x3E,0x00,0x70,0x00,0x1E,0x00,0x70,0x00,
 
 	/* Index 59, character 91 "[" (width: 7 pixels) */
-	0x7, 0xFF,0xFF,0xFF,0x1F,0xFF,0xFF,0xFF,0x1F,0xFF,0xFF,0xFF,0x1F,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,
+	0xFF,0xFF,0xFF,0x1F,0xFF,0xFF,0xFF,0x1F,0xFF,0xFF,0xFF,0x1F,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,
 
 	/* Index 60, character 92 "\" (width: 13 pixels) */
-	0xD, 0x01,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x04,
+	0x01,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x04,
 
 	/* Index 61, character 93 "]" (width: 7 pixels) */
-	0x7, 0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0xFF,0xFF,0xFF,0x1F,0xFF,0xFF,0xFF,0x1F,0xFF,0xFF,0xFF,0x1F,
+	0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0xFF,0xFF,0xFF,0x1F,0xFF,0xFF,0xFF,0x1F,0xFF,0xFF,0xFF,0x1F,
 
 	/* Index 62, character 94 "^" (width: 18 pixels) */
-	0x12, 0x00,0x08,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0E,0x00,0x00,0x80,0x07,0x00,0x00,0xC0,0x03,0x00,0x00,0xE0,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x08,0x00,0x00,
+	0x00,0x08,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0E,0x00,0x00,0x80,0x07,0x00,0x00,0xC0,0x03,0x00,0x00,0xE0,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x08,0x00,0x00,
 
 	/* Index 63, character 95 "_" (width: 18 pixels) */
-	0x12, 0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,
+	0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,
 
 	/* Index 64, character 96 "`" (width: 6 pixels) */
-	0x6, 0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+	0x01,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 12 pixels) */
-	0xC, 0x00,0x00,0x1F,0x00,0x00,0x83,0x3F,0x00,0x80,0xC3,0x7F,0x00,0x80,0xC3,0x79,0x00,0x80,0xE3,0x71,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x30,0x00,0x80,0xE7,0x18,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
+	0x00,0x00,0x1F,0x00,0x00,0x83,0x3F,0x00,0x80,0xC3,0x7F,0x00,0x80,0xC3,0x79,0x00,0x80,0xE3,0x71,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x30,0x00,0x80,0xE7,0x18,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
 
 	/* Index 66, character 98 "b" (width: 13 pixels) */
-	0xD, 0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x06,0x38,0x00,0x00,0x07,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x78,0x00,0x80,0x0F,0x3C,0x00,0x00,0xFF,0x3F,0x00,0x00,0xFE,0x0F,0x00,0x00,0xF8,0x03,0x00,
+	0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x06,0x38,0x00,0x00,0x07,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x78,0x00,0x80,0x0F,0x3C,0x00,0x00,0xFF,0x3F,0x00,0x00,0xFE,0x0F,0x00,0x00,0xF8,0x03,0x00,
 
 	/* Index 67, character 99 "c" (width: 12 pixels) */
-	0xC, 0x00,0xF0,0x03,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFE,0x1F,0x00,0x00,0x0F,0x3C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x00,0x03,0x30,0x00,0x00,0x07,0x38,0x00,
+	0x00,0xF0,0x03,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFE,0x1F,0x00,0x00,0x0F,0x3C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x00,0x03,0x30,0x00,0x00,0x07,0x38,0x00,
 
 	/* Index 68, character 100 "d" (width: 13 pixels) */
-	0xD, 0x00,0xF0,0x07,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFF,0x3F,0x00,0x00,0x0F,0x7C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x38,0x00,0x00,0x07,0x18,0x00,0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,
+	0x00,0xF0,0x07,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFF,0x3F,0x00,0x00,0x0F,0x7C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x38,0x00,0x00,0x07,0x18,0x00,0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,
 
 	/* Index 69, character 101 "e" (width: 14 pixels) */
-	0xE, 0x00,0xF0,0x03,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xEF,0x3C,0x00,0x00,0xE7,0x38,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x70,0x00,0x00,0xE7,0x70,0x00,0x00,0xFF,0x70,0x00,0x00,0xFE,0x38,0x00,0x00,0xF8,0x38,0x00,
+	0x00,0xF0,0x03,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xEF,0x3C,0x00,0x00,0xE7,0x38,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x70,0x00,0x80,0xE3,0x70,0x00,0x00,0xE7,0x70,0x00,0x00,0xFF,0x70,0x00,0x00,0xFE,0x38,0x00,0x00,0xF8,0x38,0x00,
 
 	/* Index 70, character 102 "f" (width: 10 pixels) */
-	0xA, 0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0xF8,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x8F,0x03,0x00,0x00,0x87,0x03,0x00,0x00,0x87,0x03,0x00,0x00,0x87,0x03,0x00,0x00,0x07,0x00,0x00,0x00,
+	0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0xF8,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0xFE,0xFF,0x7F,0x00,0x8F,0x03,0x00,0x00,0x87,0x03,0x00,0x00,0x87,0x03,0x00,0x00,0x87,0x03,0x00,0x00,0x07,0x00,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 13 pixels) */
-	0xD, 0x00,0xF0,0x07,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFF,0x3F,0x1C,0x00,0x0F,0x7C,0x1C,0x80,0x07,0x70,0x1C,0x80,0x03,0x70,0x1C,0x80,0x03,0x70,0x1C,0x80,0x03,0x70,0x1C,0x80,0x03,0x38,0x1C,0x00,0x07,0x38,0x0E,0x80,0xFF,0xFF,0x0F,0x80,0xFF,0xFF,0x07,0x80,0xFF,0xFF,0x01,
+	0x00,0xF0,0x07,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFF,0x3F,0x1C,0x00,0x0F,0x7C,0x1C,0x80,0x07,0x70,0x1C,0x80,0x03,0x70,0x1C,0x80,0x03,0x70,0x1C,0x80,0x03,0x70,0x1C,0x80,0x03,0x38,0x1C,0x00,0x07,0x38,0x0E,0x80,0xFF,0xFF,0x0F,0x80,0xFF,0xFF,0x07,0x80,0xFF,0xFF,0x01,
 
 	/* Index 72, character 104 "h" (width: 12 pixels) */
-	0xC, 0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
+	0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
 
 	/* Index 73, character 105 "i" (width: 3 pixels) */
-	0x3, 0x8E,0xFF,0x7F,0x00,0x8E,0xFF,0x7F,0x00,0x8E,0xFF,0x7F,0x00,
+	0x8E,0xFF,0x7F,0x00,0x8E,0xFF,0x7F,0x00,0x8E,0xFF,0x7F,0x00,
 
 	/* Index 74, character 106 "j" (width: 8 pixels) */
-	0x8, 0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x1C,0x80,0x03,0x00,0x1C,0x80,0x03,0x00,0x1C,0x80,0x03,0x00,0x1E,0x8E,0xFF,0xFF,0x0F,0x8E,0xFF,0xFF,0x0F,0x8E,0xFF,0xFF,0x03,
+	0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x1C,0x80,0x03,0x00,0x1C,0x80,0x03,0x00,0x1C,0x80,0x03,0x00,0x1E,0x8E,0xFF,0xFF,0x0F,0x8E,0xFF,0xFF,0x0F,0x8E,0xFF,0xFF,0x03,
 
 	/* Index 75, character 107 "k" (width: 14 pixels) */
-	0xE, 0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0x00,0xC0,0x01,0x00,0x00,0xE0,0x01,0x00,0x00,0xF0,0x03,0x00,0x00,0xB8,0x07,0x00,0x00,0x1E,0x0F,0x00,0x00,0x0F,0x1E,0x00,0x80,0x07,0x3C,0x00,0x80,0x03,0x78,0x00,0x80,0x01,0x70,0x00,0x80,0x00,0x60,0x00,0x00,0x00,0x40,0x00,
+	0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0x00,0xC0,0x01,0x00,0x00,0xE0,0x01,0x00,0x00,0xF0,0x03,0x00,0x00,0xB8,0x07,0x00,0x00,0x1E,0x0F,0x00,0x00,0x0F,0x1E,0x00,0x80,0x07,0x3C,0x00,0x80,0x03,0x78,0x00,0x80,0x01,0x70,0x00,0x80,0x00,0x60,0x00,0x00,0x00,0x40,0x00,
 
 	/* Index 76, character 108 "l" (width: 3 pixels) */
-	0x3, 0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,
+	0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,0xFF,0xFF,0x7F,0x00,
 
 	/* Index 77, character 109 "m" (width: 23 pixels) */
-	0x17, 0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFE,0x7F,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
+	0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFE,0x7F,0x00,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
 
 	/* Index 78, character 110 "n" (width: 12 pixels) */
-	0xC, 0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
+	0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0xFF,0x7F,0x00,0x00,0xFC,0x7F,0x00,
 
 	/* Index 79, character 111 "o" (width: 14 pixels) */
-	0xE, 0x00,0xF0,0x03,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFE,0x1F,0x00,0x00,0x0F,0x3C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x07,0x78,0x00,0x00,0x0F,0x3C,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFC,0x0F,0x00,0x00,0xF0,0x03,0x00,
+	0x00,0xF0,0x03,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFE,0x1F,0x00,0x00,0x0F,0x3C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x07,0x78,0x00,0x00,0x0F,0x3C,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFC,0x0F,0x00,0x00,0xF0,0x03,0x00,
 
 	/* Index 80, character 112 "p" (width: 13 pixels) */
-	0xD, 0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,0x00,0x06,0x38,0x00,0x00,0x07,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x78,0x00,0x80,0x0F,0x3C,0x00,0x00,0xFF,0x3F,0x00,0x00,0xFE,0x0F,0x00,0x00,0xF8,0x03,0x00,
+	0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,0x00,0x06,0x38,0x00,0x00,0x07,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x78,0x00,0x80,0x0F,0x3C,0x00,0x00,0xFF,0x3F,0x00,0x00,0xFE,0x0F,0x00,0x00,0xF8,0x03,0x00,
 
 	/* Index 81, character 113 "q" (width: 13 pixels) */
-	0xD, 0x00,0xF0,0x07,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFF,0x3F,0x00,0x00,0x0F,0x7C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x38,0x00,0x00,0x07,0x38,0x00,0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,
+	0x00,0xF0,0x07,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFF,0x3F,0x00,0x00,0x0F,0x7C,0x00,0x80,0x07,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x38,0x00,0x00,0x07,0x38,0x00,0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,0x80,0xFF,0xFF,0x1F,
 
 	/* Index 82, character 114 "r" (width: 9 pixels) */
-	0x9, 0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,
+	0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 12 pixels) */
-	0xC, 0x00,0x3C,0x38,0x00,0x00,0x7F,0x38,0x00,0x00,0x7F,0x70,0x00,0x80,0xE7,0x70,0x00,0x80,0xE3,0x70,0x00,0x80,0xC3,0x70,0x00,0x80,0xC3,0x70,0x00,0x80,0xC3,0x71,0x00,0x80,0xC3,0x79,0x00,0x00,0x83,0x3F,0x00,0x00,0x87,0x1F,0x00,0x00,0x00,0x0F,0x00,
+	0x00,0x3C,0x38,0x00,0x00,0x7F,0x38,0x00,0x00,0x7F,0x70,0x00,0x80,0xE7,0x70,0x00,0x80,0xE3,0x70,0x00,0x80,0xC3,0x70,0x00,0x80,0xC3,0x70,0x00,0x80,0xC3,0x71,0x00,0x80,0xC3,0x79,0x00,0x00,0x83,0x3F,0x00,0x00,0x87,0x1F,0x00,0x00,0x00,0x0F,0x00,
 
 	/* Index 84, character 116 "t" (width: 9 pixels) */
-	0x9, 0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0xFC,0xFF,0x1F,0x00,0xFC,0xFF,0x3F,0x00,0xFC,0xFF,0x7F,0x00,0x80,0x03,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x78,0x00,
+	0x80,0x03,0x00,0x00,0x80,0x03,0x00,0x00,0xFC,0xFF,0x1F,0x00,0xFC,0xFF,0x3F,0x00,0xFC,0xFF,0x7F,0x00,0x80,0x03,0x78,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x70,0x00,0x80,0x03,0x78,0x00,
 
 	/* Index 85, character 117 "u" (width: 12 pixels) */
-	0xC, 0x80,0xFF,0x0F,0x00,0x80,0xFF,0x3F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x18,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,
+	0x80,0xFF,0x0F,0x00,0x80,0xFF,0x3F,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x18,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x7F,0x00,
 
 	/* Index 86, character 118 "v" (width: 15 pixels) */
-	0xF, 0x80,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x7E,0x00,0x00,0xC0,0x1F,0x00,0x00,0xF8,0x07,0x00,0x00,0xFF,0x00,0x00,0x80,0x1F,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x00,0x00,0x00,
+	0x80,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x7E,0x00,0x00,0xC0,0x1F,0x00,0x00,0xF8,0x07,0x00,0x00,0xFF,0x00,0x00,0x80,0x1F,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x00,0x00,0x00,
 
 	/* Index 87, character 119 "w" (width: 22 pixels) */
-	0x16, 0x80,0x01,0x00,0x00,0x80,0x1F,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x7E,0x00,0x00,0xC0,0x1F,0x00,0x00,0xF8,0x03,0x00,0x00,0x7F,0x00,0x00,0x80,0x0F,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x78,0x00,0x00,0xC0,0x7F,0x00,0x00,0xFE,0x0F,0x00,0x80,0xFF,0x00,0x00,0x80,0x1F,0x00,0x00,0x80,0x01,0x00,0x00,
+	0x80,0x01,0x00,0x00,0x80,0x1F,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x7E,0x00,0x00,0xC0,0x1F,0x00,0x00,0xF8,0x03,0x00,0x00,0x7F,0x00,0x00,0x80,0x0F,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x78,0x00,0x00,0xC0,0x7F,0x00,0x00,0xFE,0x0F,0x00,0x80,0xFF,0x00,0x00,0x80,0x1F,0x00,0x00,0x80,0x01,0x00,0x00,
 
 	/* Index 88, character 120 "x" (width: 15 pixels) */
-	0xF, 0x80,0x00,0x40,0x00,0x80,0x01,0x60,0x00,0x80,0x03,0x70,0x00,0x80,0x0F,0x7C,0x00,0x00,0x1F,0x3E,0x00,0x00,0x3C,0x0F,0x00,0x00,0xF8,0x03,0x00,0x00,0xE0,0x01,0x00,0x00,0xF0,0x07,0x00,0x00,0x3C,0x0F,0x00,0x00,0x1F,0x3E,0x00,0x80,0x0F,0x7C,0x00,0x80,0x03,0x70,0x00,0x80,0x01,0x60,0x00,0x80,0x00,0x40,0x00,
+	0x80,0x00,0x40,0x00,0x80,0x01,0x60,0x00,0x80,0x03,0x70,0x00,0x80,0x0F,0x7C,0x00,0x00,0x1F,0x3E,0x00,0x00,0x3C,0x0F,0x00,0x00,0xF8,0x03,0x00,0x00,0xE0,0x01,0x00,0x00,0xF0,0x07,0x00,0x00,0x3C,0x0F,0x00,0x00,0x1F,0x3E,0x00,0x80,0x0F,0x7C,0x00,0x80,0x03,0x70,0x00,0x80,0x01,0x60,0x00,0x80,0x00,0x40,0x00,
 
 	/* Index 89, character 121 "y" (width: 15 pixels) */
-	0xF, 0x80,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xFF,0x00,0x10,0x00,0xFC,0x03,0x1C,0x00,0xE0,0x1F,0x1F,0x00,0x00,0xFF,0x0F,0x00,0x00,0xF8,0x01,0x00,0x00,0x7F,0x00,0x00,0xE0,0x0F,0x00,0x00,0xF8,0x03,0x00,0x00,0xFF,0x00,0x00,0x80,0x1F,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x00,0x00,0x00,
+	0x80,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xFF,0x00,0x10,0x00,0xFC,0x03,0x1C,0x00,0xE0,0x1F,0x1F,0x00,0x00,0xFF,0x0F,0x00,0x00,0xF8,0x01,0x00,0x00,0x7F,0x00,0x00,0xE0,0x0F,0x00,0x00,0xF8,0x03,0x00,0x00,0xFF,0x00,0x00,0x80,0x1F,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x00,0x00,0x00,
 
 	/* Index 90, character 122 "z" (width: 13 pixels) */
-	0xD, 0x80,0x03,0x78,0x00,0x80,0x03,0x7C,0x00,0x80,0x03,0x7E,0x00,0x80,0x03,0x7F,0x00,0x80,0x83,0x77,0x00,0x80,0xC3,0x73,0x00,0x80,0xE3,0x71,0x00,0x80,0xF3,0x70,0x00,0x80,0x7B,0x70,0x00,0x80,0x3F,0x70,0x00,0x80,0x1F,0x70,0x00,0x80,0x0F,0x70,0x00,0x80,0x07,0x70,0x00,
+	0x80,0x03,0x78,0x00,0x80,0x03,0x7C,0x00,0x80,0x03,0x7E,0x00,0x80,0x03,0x7F,0x00,0x80,0x83,0x77,0x00,0x80,0xC3,0x73,0x00,0x80,0xE3,0x71,0x00,0x80,0xF3,0x70,0x00,0x80,0x7B,0x70,0x00,0x80,0x3F,0x70,0x00,0x80,0x1F,0x70,0x00,0x80,0x0F,0x70,0x00,0x80,0x07,0x70,0x00,
 
 	/* Index 91, character 123 "{" (width: 13 pixels) */
-	0xD, 0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xF8,0x03,0x00,0xF8,0x9F,0xFF,0x03,0xFC,0x0F,0xFF,0x07,0xFE,0x07,0xFC,0x0F,0x07,0x00,0x00,0x1C,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,
+	0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xF8,0x03,0x00,0xF8,0x9F,0xFF,0x03,0xFC,0x0F,0xFF,0x07,0xFE,0x07,0xFC,0x0F,0x07,0x00,0x00,0x1C,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,
 
 	/* Index 92, character 124 "|" (width: 3 pixels) */
-	0x3, 0xFF,0xFF,0xFF,0x1F,0xFF,0xFF,0xFF,0x1F,0xFF,0xFF,0xFF,0x1F,
+	0xFF,0xFF,0xFF,0x1F,0xFF,0xFF,0xFF,0x1F,0xFF,0xFF,0xFF,0x1F,
 
 	/* Index 93, character 125 "}" (width: 13 pixels) */
-	0xD, 0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x07,0x00,0x00,0x1C,0xFE,0x07,0xFC,0x0F,0xFC,0x0F,0xFF,0x07,0xF8,0x9F,0xFF,0x03,0x00,0xF8,0x03,0x00,0x00,0xF0,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,
+	0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x03,0x00,0x00,0x18,0x07,0x00,0x00,0x1C,0xFE,0x07,0xFC,0x0F,0xFC,0x0F,0xFF,0x07,0xF8,0x9F,0xFF,0x03,0x00,0xF8,0x03,0x00,0x00,0xF0,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,
 
 	/* Index 94, character 126 "~" (width: 18 pixels) */
-	0x12, 0x00,0xC0,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0x38,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0xE0,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x1C,0x00,0x00
+	0x00,0xC0,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0x38,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0xE0,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x1C,0x00,0x00
+};
+
+// Offset of each bitmap in Verdana22_bitmaps
+const unsigned short Verdana22_offsets[] = 
+{
+	0x0,	// Index 0
+	0x10,	// Index 1
+	0x1C,	// Index 2
+	0x40,	// Index 3
+	0x88,	// Index 4
+	0xC0,	// Index 5
+	0x12C,	// Index 6
+	0x17C,	// Index 7
+	0x188,	// Index 8
+	0x1AC,	// Index 9
+	0x1D0,	// Index 10
+	0x208,	// Index 11
+	0x250,	// Index 12
+	0x268,	// Index 13
+	0x28C,	// Index 14
+	0x298,	// Index 15
+	0x2CC,	// Index 16
+	0x304,	// Index 17
+	0x330,	// Index 18
+	0x368,	// Index 19
+	0x3A0,	// Index 20
+	0x3E0,	// Index 21
+	0x414,	// Index 22
+	0x44C,	// Index 23
+	0x484,	// Index 24
+	0x4BC,	// Index 25
+	0x4F4,	// Index 26
+	0x500,	// Index 27
+	0x518,	// Index 28
+	0x558,	// Index 29
+	0x59C,	// Index 30
+	0x5DC,	// Index 31
+	0x60C,	// Index 32
+	0x66C,	// Index 33
+	0x6BC,	// Index 34
+	0x6FC,	// Index 35
+	0x740,	// Index 36
+	0x784,	// Index 37
+	0x7B8,	// Index 38
+	0x7F0,	// Index 39
+	0x838,	// Index 40
+	0x878,	// Index 41
+	0x89C,	// Index 42
+	0x8C0,	// Index 43
+	0x904,	// Index 44
+	0x938,	// Index 45
+	0x980,	// Index 46
+	0x9C0,	// Index 47
+	0xA0C,	// Index 48
+	0xA40,	// Index 49
+	0xA8C,	// Index 50
+	0xAD0,	// Index 51
+	0xB10,	// Index 52
+	0xB5C,	// Index 53
+	0xB98,	// Index 54
+	0xBE8,	// Index 55
+	0xC54,	// Index 56
+	0xC9C,	// Index 57
+	0xCE8,	// Index 58
+	0xD28,	// Index 59
+	0xD44,	// Index 60
+	0xD78,	// Index 61
+	0xD94,	// Index 62
+	0xDDC,	// Index 63
+	0xE24,	// Index 64
+	0xE3C,	// Index 65
+	0xE6C,	// Index 66
+	0xEA0,	// Index 67
+	0xED0,	// Index 68
+	0xF04,	// Index 69
+	0xF3C,	// Index 70
+	0xF64,	// Index 71
+	0xF98,	// Index 72
+	0xFC8,	// Index 73
+	0xFD4,	// Index 74
+	0xFF4,	// Index 75
+	0x102C,	// Index 76
+	0x1038,	// Index 77
+	0x1094,	// Index 78
+	0x10C4,	// Index 79
+	0x10FC,	// Index 80
+	0x1130,	// Index 81
+	0x1164,	// Index 82
+	0x1188,	// Index 83
+	0x11B8,	// Index 84
+	0x11DC,	// Index 85
+	0x120C,	// Index 86
+	0x1248,	// Index 87
+	0x12A0,	// Index 88
+	0x12DC,	// Index 89
+	0x1318,	// Index 90
+	0x134C,	// Index 91
+	0x1380,	// Index 92
+	0x138C,	// Index 93
+	0x13C0,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Verdana22_widths[] = 
+{
+	0x4,	// Index 0
+	0x3,	// Index 1
+	0x9,	// Index 2
+	0x12,	// Index 3
+	0xE,	// Index 4
+	0x1B,	// Index 5
+	0x14,	// Index 6
+	0x3,	// Index 7
+	0x9,	// Index 8
+	0x9,	// Index 9
+	0xE,	// Index 10
+	0x12,	// Index 11
+	0x6,	// Index 12
+	0x9,	// Index 13
+	0x3,	// Index 14
+	0xD,	// Index 15
+	0xE,	// Index 16
+	0xB,	// Index 17
+	0xE,	// Index 18
+	0xE,	// Index 19
+	0x10,	// Index 20
+	0xD,	// Index 21
+	0xE,	// Index 22
+	0xE,	// Index 23
+	0xE,	// Index 24
+	0xE,	// Index 25
+	0x3,	// Index 26
+	0x6,	// Index 27
+	0x10,	// Index 28
+	0x11,	// Index 29
+	0x10,	// Index 30
+	0xC,	// Index 31
+	0x18,	// Index 32
+	0x14,	// Index 33
+	0x10,	// Index 34
+	0x11,	// Index 35
+	0x11,	// Index 36
+	0xD,	// Index 37
+	0xE,	// Index 38
+	0x12,	// Index 39
+	0x10,	// Index 40
+	0x9,	// Index 41
+	0x9,	// Index 42
+	0x11,	// Index 43
+	0xD,	// Index 44
+	0x12,	// Index 45
+	0x10,	// Index 46
+	0x13,	// Index 47
+	0xD,	// Index 48
+	0x13,	// Index 49
+	0x11,	// Index 50
+	0x10,	// Index 51
+	0x13,	// Index 52
+	0xF,	// Index 53
+	0x14,	// Index 54
+	0x1B,	// Index 55
+	0x12,	// Index 56
+	0x13,	// Index 57
+	0x10,	// Index 58
+	0x7,	// Index 59
+	0xD,	// Index 60
+	0x7,	// Index 61
+	0x12,	// Index 62
+	0x12,	// Index 63
+	0x6,	// Index 64
+	0xC,	// Index 65
+	0xD,	// Index 66
+	0xC,	// Index 67
+	0xD,	// Index 68
+	0xE,	// Index 69
+	0xA,	// Index 70
+	0xD,	// Index 71
+	0xC,	// Index 72
+	0x3,	// Index 73
+	0x8,	// Index 74
+	0xE,	// Index 75
+	0x3,	// Index 76
+	0x17,	// Index 77
+	0xC,	// Index 78
+	0xE,	// Index 79
+	0xD,	// Index 80
+	0xD,	// Index 81
+	0x9,	// Index 82
+	0xC,	// Index 83
+	0x9,	// Index 84
+	0xC,	// Index 85
+	0xF,	// Index 86
+	0x16,	// Index 87
+	0xF,	// Index 88
+	0xF,	// Index 89
+	0xD,	// Index 90
+	0xD,	// Index 91
+	0x3,	// Index 92
+	0xD,	// Index 93
+	0x12,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Verdana22_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x16, 0x0,	// Index 1
+	0x17, 0x0,	// Index 2
+	0x16, 0x0,	// Index 3
+	0x17, 0x5,	// Index 4
+	0x16, 0x0,	// Index 5
+	0x16, 0x0,	// Index 6
+	0x17, 0x0,	// Index 7
+	0x17, 0x6,	// Index 8
+	0x17, 0x6,	// Index 9
+	0x17, 0x0,	// Index 10
+	0x12, 0x0,	// Index 11
+	0x4, 0x5,	// Index 12
+	0xB, 0x0,	// Index 13
+	0x4, 0x0,	// Index 14
+	0x17, 0x4,	// Index 15
+	0x16, 0x0,	// Index 16
+	0x16, 0x0,	// Index 17
+	0x16, 0x0,	// Index 18
+	0x16, 0x0,	// Index 19
+	0x16, 0x0,	// Index 20
+	0x16, 0x0,	// Index 21
+	0x16, 0x0,	// Index 22
+	0x16, 0x0,	// Index 23
+	0x16, 0x0,	// Index 24
+	0x16, 0x0,	// Index 25
+	0x10, 0x0,	// Index 26
+	0x10, 0x5,	// Index 27
+	0x11, 0x0,	// Index 28
+	0xD, 0x0,	// Index 29
+	0x11, 0x0,	// Index 30
+	0x16, 0x0,	// Index 31
+	0x16, 0x3,	// Index 32
+	0x16, 0x0,	// Index 33
+	0x16, 0x0,	// Index 34
+	0x16, 0x0,	// Index 35
+	0x16, 0x0,	// Index 36
+	0x16, 0x0,	// Index 37
+	0x16, 0x0,	// Index 38
+	0x16, 0x0,	// Index 39
+	0x16, 0x0,	// Index 40
+	0x16, 0x0,	// Index 41
+	0x16, 0x0,	// Index 42
+	0x16, 0x0,	// Index 43
+	0x16, 0x0,	// Index 44
+	0x16, 0x0,	// Index 45
+	0x16, 0x0,	// Index 46
+	0x16, 0x0,	// Index 47
+	0x16, 0x0,	// Index 48
+	0x16, 0x6,	// Index 49
+	0x16, 0x0,	// Index 50
+	0x16, 0x0,	// Index 51
+	0x16, 0x0,	// Index 52
+	0x16, 0x0,	// Index 53
+	0x16, 0x0,	// Index 54
+	0x16, 0x0,	// Index 55
+	0x16, 0x0,	// Index 56
+	0x16, 0x0,	// Index 57
+	0x16, 0x0,	// Index 58
+	0x17, 0x6,	// Index 59
+	0x17, 0x4,	// Index 60
+	0x17, 0x6,	// Index 61
+	0x16, 0x0,	// Index 62
+	0x0, 0x5,	// Index 63
+	0x17, 0x0,	// Index 64
+	0x10, 0x0,	// Index 65
+	0x17, 0x0,	// Index 66
+	0x10, 0x0,	// Index 67
+	0x17, 0x0,	// Index 68
+	0x10, 0x0,	// Index 69
+	0x17, 0x0,	// Index 70
+	0x10, 0x6,	// Index 71
+	0x17, 0x0,	// Index 72
+	0x16, 0x0,	// Index 73
+	0x16, 0x6,	// Index 74
+	0x17, 0x0,	// Index 75
+	0x17, 0x0,	// Index 76
+	0x10, 0x0,	// Index 77
+	0x10, 0x0,	// Index 78
+	0x10, 0x0,	// Index 79
+	0x10, 0x6,	// Index 80
+	0x10, 0x6,	// Index 81
+	0x10, 0x0,	// Index 82
+	0x10, 0x0,	// Index 83
+	0x15, 0x0,	// Index 84
+	0x10, 0x0,	// Index 85
+	0x10, 0x0,	// Index 86
+	0x10, 0x0,	// Index 87
+	0x10, 0x0,	// Index 88
+	0x10, 0x6,	// Index 89
+	0x10, 0x0,	// Index 90
+	0x17, 0x6,	// Index 91
+	0x17, 0x6,	// Index 92
+	0x17, 0x6,	// Index 93
+	0xD, 0x0,	// Index 94
+};
+
+const font_t Verdana22 = 
+{
+	Verdana22_bitmaps,
+	Verdana22_offsets,
+	Verdana22_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x1D,	// Height 
+	0,	// Flags 
+	Verdana22_extents,
+	0x17	// Ascent 
 };
+
 //---------------------------------------------------------------
 // Group Name: Verdana26
 // Designer: Imported System Font
@@ -2450,398 +3706,607 @@ const unsigned char Verdana22[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Verdana26[] = 
+const unsigned char Verdana26_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x23,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xD8, // Index 1 (offset: 216)
-	0x0, 0xE8, // Index 2 (offset: 232)
-	0x1, 0x1B, // Index 3 (offset: 283)
-	0x1, 0x8A, // Index 4 (offset: 394)
-	0x1, 0xE0, // Index 5 (offset: 480)
-	0x2, 0x86, // Index 6 (offset: 646)
-	0x2, 0xFF, // Index 7 (offset: 767)
-	0x3, 0xF, // Index 8 (offset: 783)
-	0x3, 0x42, // Index 9 (offset: 834)
-	0x3, 0x75, // Index 10 (offset: 885)
-	0x3, 0xC6, // Index 11 (offset: 966)
-	0x4, 0x30, // Index 12 (offset: 1072)
-	0x4, 0x54, // Index 13 (offset: 1108)
-	0x4, 0x8C, // Index 14 (offset: 1164)
-	0x4, 0xA1, // Index 15 (offset: 1185)
-	0x4, 0xED, // Index 16 (offset: 1261)
-	0x5, 0x48, // Index 17 (offset: 1352)
-	0x5, 0x8A, // Index 18 (offset: 1418)
-	0x5, 0xE0, // Index 19 (offset: 1504)
-	0x6, 0x31, // Index 20 (offset: 1585)
-	0x6, 0x91, // Index 21 (offset: 1681)
-	0x6, 0xE7, // Index 22 (offset: 1767)
-	0x7, 0x42, // Index 23 (offset: 1858)
-	0x7, 0x98, // Index 24 (offset: 1944)
-	0x7, 0xF3, // Index 25 (offset: 2035)
-	0x8, 0x4E, // Index 26 (offset: 2126)
-	0x8, 0x63, // Index 27 (offset: 2147)
-	0x8, 0x87, // Index 28 (offset: 2183)
-	0x8, 0xEC, // Index 29 (offset: 2284)
-	0x9, 0x51, // Index 30 (offset: 2385)
-	0x9, 0xB6, // Index 31 (offset: 2486)
-	0x9, 0xFD, // Index 32 (offset: 2557)
-	0xA, 0x8F, // Index 33 (offset: 2703)
-	0xB, 0x8, // Index 34 (offset: 2824)
-	0xB, 0x6D, // Index 35 (offset: 2925)
-	0xB, 0xD7, // Index 36 (offset: 3031)
-	0xC, 0x46, // Index 37 (offset: 3142)
-	0xC, 0x9C, // Index 38 (offset: 3228)
-	0xC, 0xF2, // Index 39 (offset: 3314)
-	0xD, 0x61, // Index 40 (offset: 3425)
-	0xD, 0xC6, // Index 41 (offset: 3526)
-	0xD, 0xF4, // Index 42 (offset: 3572)
-	0xE, 0x31, // Index 43 (offset: 3633)
-	0xE, 0x9B, // Index 44 (offset: 3739)
-	0xE, 0xEC, // Index 45 (offset: 3820)
-	0xF, 0x65, // Index 46 (offset: 3941)
-	0xF, 0xCA, // Index 47 (offset: 4042)
-	0x10, 0x43, // Index 48 (offset: 4163)
-	0x10, 0x99, // Index 49 (offset: 4249)
-	0x11, 0x17, // Index 50 (offset: 4375)
-	0x11, 0x81, // Index 51 (offset: 4481)
-	0x11, 0xE6, // Index 52 (offset: 4582)
-	0x12, 0x50, // Index 53 (offset: 4688)
-	0x12, 0xB5, // Index 54 (offset: 4789)
-	0x13, 0x2E, // Index 55 (offset: 4910)
-	0x13, 0xCA, // Index 56 (offset: 5066)
-	0x14, 0x39, // Index 57 (offset: 5177)
-	0x14, 0xA3, // Index 58 (offset: 5283)
-	0x15, 0x8, // Index 59 (offset: 5384)
-	0x15, 0x36, // Index 60 (offset: 5430)
-	0x15, 0x82, // Index 61 (offset: 5506)
-	0x15, 0xB0, // Index 62 (offset: 5552)
-	0x16, 0x1F, // Index 63 (offset: 5663)
-	0x16, 0x8E, // Index 64 (offset: 5774)
-	0x16, 0xB2, // Index 65 (offset: 5810)
-	0x17, 0x3, // Index 66 (offset: 5891)
-	0x17, 0x59, // Index 67 (offset: 5977)
-	0x17, 0xA5, // Index 68 (offset: 6053)
-	0x17, 0xFB, // Index 69 (offset: 6139)
-	0x18, 0x51, // Index 70 (offset: 6225)
-	0x18, 0x8E, // Index 71 (offset: 6286)
-	0x18, 0xE4, // Index 72 (offset: 6372)
-	0x19, 0x35, // Index 73 (offset: 6453)
-	0x19, 0x45, // Index 74 (offset: 6469)
-	0x19, 0x78, // Index 75 (offset: 6520)
-	0x19, 0xCE, // Index 76 (offset: 6606)
-	0x19, 0xDE, // Index 77 (offset: 6622)
-	0x1A, 0x66, // Index 78 (offset: 6758)
-	0x1A, 0xB7, // Index 79 (offset: 6839)
-	0x1B, 0xD, // Index 80 (offset: 6925)
-	0x1B, 0x63, // Index 81 (offset: 7011)
-	0x1B, 0xB9, // Index 82 (offset: 7097)
-	0x1B, 0xF6, // Index 83 (offset: 7158)
-	0x1C, 0x42, // Index 84 (offset: 7234)
-	0x1C, 0x7F, // Index 85 (offset: 7295)
-	0x1C, 0xD0, // Index 86 (offset: 7376)
-	0x1D, 0x30, // Index 87 (offset: 7472)
-	0x1D, 0xB8, // Index 88 (offset: 7608)
-	0x1E, 0x18, // Index 89 (offset: 7704)
-	0x1E, 0x78, // Index 90 (offset: 7800)
-	0x1E, 0xC4, // Index 91 (offset: 7876)
-	0x1F, 0x15, // Index 92 (offset: 7957)
-	0x1F, 0x25, // Index 93 (offset: 7973)
-	0x1F, 0x76, // Index 94 (offset: 8054)
-
 	/* Index 0, character 32 " " (width: 4 pixels) */
-	0x4, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 3 pixels) */
-	0x3, 0xF8,0xFF,0x1F,0x0F,0x00,0xF8,0xFF,0x1F,0x0F,0x00,0xF8,0xFF,0x1F,0x0F,0x00,
+	0xF8,0xFF,0x1F,0x0F,0x00,0xF8,0xFF,0x1F,0x0F,0x00,0xF8,0xFF,0x1F,0x0F,0x00,
 
 	/* Index 2, character 34 """ (width: 10 pixels) */
-	0xA, 0xFE,0x01,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,
+	0xFE,0x01,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 22 pixels) */
-	0x16, 0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x0C,0x18,0x00,0x00,0x00,0x0C,0x18,0x0C,0x00,0x00,0x0C,0xD8,0x0F,0x00,0x00,0x0C,0xFC,0x03,0x00,0x00,0xEC,0x3F,0x00,0x00,0x00,0xFE,0x1B,0x00,0x00,0xE0,0x1F,0x18,0x00,0x00,0xF8,0x0D,0x18,0x00,0x00,0x18,0x0C,0x18,0x00,0x00,0x00,0x0C,0x18,0x0C,0x00,0x00,0x0C,0xF8,0x0F,0x00,0x00,0x0C,0xFC,0x03,0x00,0x00,0xEC,0x3F,0x00,0x00,0x00,0xFE,0x1B,0x00,0x00,0xE0,0x1F,0x18,0x00,0x00,0xF8,0x0D,0x18,0x00,0x00,0x18,0x0C,0x18,0x00,0x00,0x00,0x0C,0x18,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,
+	0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x0C,0x18,0x00,0x00,0x00,0x0C,0x18,0x0C,0x00,0x00,0x0C,0xD8,0x0F,0x00,0x00,0x0C,0xFC,0x03,0x00,0x00,0xEC,0x3F,0x00,0x00,0x00,0xFE,0x1B,0x00,0x00,0xE0,0x1F,0x18,0x00,0x00,0xF8,0x0D,0x18,0x00,0x00,0x18,0x0C,0x18,0x00,0x00,0x00,0x0C,0x18,0x0C,0x00,0x00,0x0C,0xF8,0x0F,0x00,0x00,0x0C,0xFC,0x03,0x00,0x00,0xEC,0x3F,0x00,0x00,0x00,0xFE,0x1B,0x00,0x00,0xE0,0x1F,0x18,0x00,0x00,0xF8,0x0D,0x18,0x00,0x00,0x18,0x0C,0x18,0x00,0x00,0x00,0x0C,0x18,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,
 
 	/* Index 4, character 36 "$" (width: 17 pixels) */
-	0x11, 0x00,0x7C,0x80,0x07,0x00,0x00,0xFE,0x00,0x07,0x00,0x00,0xFF,0x01,0x07,0x00,0x80,0xC7,0x01,0x0F,0x00,0x80,0xC3,0x01,0x0E,0x00,0xC0,0x81,0x03,0x0E,0x00,0xC0,0x81,0x03,0x0E,0x00,0xC0,0x81,0x03,0x0E,0x00,0xFE,0xFF,0xFF,0xFF,0x03,0xFE,0xFF,0xFF,0xFF,0x03,0xC0,0x01,0x07,0x0E,0x00,0xC0,0x01,0x07,0x0E,0x00,0xC0,0x01,0x07,0x07,0x00,0x80,0x03,0x0E,0x07,0x00,0x80,0x03,0xFE,0x03,0x00,0x80,0x07,0xFC,0x01,0x00,0x00,0x00,0xF8,0x00,0x00,
+	0x00,0x7C,0x80,0x07,0x00,0x00,0xFE,0x00,0x07,0x00,0x00,0xFF,0x01,0x07,0x00,0x80,0xC7,0x01,0x0F,0x00,0x80,0xC3,0x01,0x0E,0x00,0xC0,0x81,0x03,0x0E,0x00,0xC0,0x81,0x03,0x0E,0x00,0xC0,0x81,0x03,0x0E,0x00,0xFE,0xFF,0xFF,0xFF,0x03,0xFE,0xFF,0xFF,0xFF,0x03,0xC0,0x01,0x07,0x0E,0x00,0xC0,0x01,0x07,0x0E,0x00,0xC0,0x01,0x07,0x07,0x00,0x80,0x03,0x0E,0x07,0x00,0x80,0x03,0xFE,0x03,0x00,0x80,0x07,0xFC,0x01,0x00,0x00,0x00,0xF8,0x00,0x00,
 
 	/* Index 5, character 37 "%" (width: 33 pixels) */
-	0x21, 0xC0,0x1F,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x1C,0xC0,0x01,0x00,0x00,0x0C,0x80,0x01,0x00,0x00,0x0C,0x80,0x01,0x00,0x00,0x0C,0x80,0x01,0x00,0x00,0x1C,0xC0,0x01,0x08,0x00,0x38,0xE0,0x00,0x0E,0x00,0xF8,0xFF,0x00,0x0F,0x00,0xF0,0x7F,0xC0,0x07,0x00,0xC0,0x1F,0xF0,0x01,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xC0,0x07,0xFE,0x00,0x00,0xF0,0x81,0xFF,0x03,0x00,0x78,0xC0,0xFF,0x07,0x00,0x38,0xC0,0x01,0x07,0x00,0x08,0xE0,0x00,0x0E,0x00,0x00,0x60,0x00,0x0C,0x00,0x00,0x60,0x00,0x0C,0x00,0x00,0x60,0x00,0x0C,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xC0,0x01,0x07,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xFE,0x00,0x00,
+	0xC0,0x1F,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x1C,0xC0,0x01,0x00,0x00,0x0C,0x80,0x01,0x00,0x00,0x0C,0x80,0x01,0x00,0x00,0x0C,0x80,0x01,0x00,0x00,0x1C,0xC0,0x01,0x08,0x00,0x38,0xE0,0x00,0x0E,0x00,0xF8,0xFF,0x00,0x0F,0x00,0xF0,0x7F,0xC0,0x07,0x00,0xC0,0x1F,0xF0,0x01,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xC0,0x07,0xFE,0x00,0x00,0xF0,0x81,0xFF,0x03,0x00,0x78,0xC0,0xFF,0x07,0x00,0x38,0xC0,0x01,0x07,0x00,0x08,0xE0,0x00,0x0E,0x00,0x00,0x60,0x00,0x0C,0x00,0x00,0x60,0x00,0x0C,0x00,0x00,0x60,0x00,0x0C,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xC0,0x01,0x07,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xFE,0x00,0x00,
 
 	/* Index 6, character 38 "&" (width: 24 pixels) */
-	0x18, 0x00,0x00,0x7C,0x00,0x00,0xC0,0x03,0xFF,0x01,0x00,0xF0,0x8F,0xFF,0x03,0x00,0xF8,0xDF,0xC1,0x07,0x00,0x38,0xFE,0x80,0x07,0x00,0x1C,0x78,0x00,0x0F,0x00,0x0C,0x38,0x00,0x0E,0x00,0x0C,0x70,0x00,0x0E,0x00,0x0C,0xF0,0x00,0x0E,0x00,0x0C,0xF0,0x01,0x0E,0x00,0x1C,0xD8,0x03,0x0E,0x00,0x38,0x9C,0x07,0x06,0x00,0xF8,0x0F,0x0F,0x07,0x00,0xF0,0x07,0x1E,0x03,0x00,0xE0,0x03,0x9E,0x03,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0xF0,0xCF,0x03,0x00,0x00,0xF0,0x83,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
+	0x00,0x00,0x7C,0x00,0x00,0xC0,0x03,0xFF,0x01,0x00,0xF0,0x8F,0xFF,0x03,0x00,0xF8,0xDF,0xC1,0x07,0x00,0x38,0xFE,0x80,0x07,0x00,0x1C,0x78,0x00,0x0F,0x00,0x0C,0x38,0x00,0x0E,0x00,0x0C,0x70,0x00,0x0E,0x00,0x0C,0xF0,0x00,0x0E,0x00,0x0C,0xF0,0x01,0x0E,0x00,0x1C,0xD8,0x03,0x0E,0x00,0x38,0x9C,0x07,0x06,0x00,0xF8,0x0F,0x0F,0x07,0x00,0xF0,0x07,0x1E,0x03,0x00,0xE0,0x03,0x9E,0x03,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0xF0,0xCF,0x03,0x00,0x00,0xF0,0x83,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
 
 	/* Index 7, character 39 "'" (width: 3 pixels) */
-	0x3, 0xFE,0x03,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,
+	0xFE,0x03,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 10 pixels) */
-	0xA, 0x00,0xE0,0x7F,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x80,0xFF,0xFF,0x1F,0x00,0xE0,0x1F,0x80,0x7F,0x00,0xF8,0x03,0x00,0xFC,0x01,0x7C,0x00,0x00,0xE0,0x03,0x3E,0x00,0x00,0xC0,0x07,0x0E,0x00,0x00,0x00,0x07,0x06,0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x00,0x04,
+	0x00,0xE0,0x7F,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x80,0xFF,0xFF,0x1F,0x00,0xE0,0x1F,0x80,0x7F,0x00,0xF8,0x03,0x00,0xFC,0x01,0x7C,0x00,0x00,0xE0,0x03,0x3E,0x00,0x00,0xC0,0x07,0x0E,0x00,0x00,0x00,0x07,0x06,0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x00,0x04,
 
 	/* Index 9, character 41 ")" (width: 10 pixels) */
-	0xA, 0x02,0x00,0x00,0x00,0x04,0x06,0x00,0x00,0x00,0x06,0x0E,0x00,0x00,0x00,0x07,0x3E,0x00,0x00,0x80,0x07,0x7C,0x00,0x00,0xE0,0x03,0xF8,0x03,0x00,0xFC,0x01,0xE0,0x1F,0x80,0x7F,0x00,0x80,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0xE0,0x7F,0x00,0x00,
+	0x02,0x00,0x00,0x00,0x04,0x06,0x00,0x00,0x00,0x06,0x0E,0x00,0x00,0x00,0x07,0x3E,0x00,0x00,0x80,0x07,0x7C,0x00,0x00,0xE0,0x03,0xF8,0x03,0x00,0xFC,0x01,0xE0,0x1F,0x80,0x7F,0x00,0x80,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0xE0,0x7F,0x00,0x00,
 
 	/* Index 10, character 42 "*" (width: 16 pixels) */
-	0x10, 0x10,0x10,0x00,0x00,0x00,0x38,0x38,0x00,0x00,0x00,0x70,0x18,0x00,0x00,0x00,0x60,0x1C,0x00,0x00,0x00,0xE0,0x0C,0x00,0x00,0x00,0xC0,0x0E,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xFE,0xFF,0x01,0x00,0x00,0xFE,0xFF,0x01,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xC0,0x0E,0x00,0x00,0x00,0xE0,0x0C,0x00,0x00,0x00,0x60,0x1C,0x00,0x00,0x00,0x70,0x18,0x00,0x00,0x00,0x38,0x38,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,
+	0x10,0x10,0x00,0x00,0x00,0x38,0x38,0x00,0x00,0x00,0x70,0x18,0x00,0x00,0x00,0x60,0x1C,0x00,0x00,0x00,0xE0,0x0C,0x00,0x00,0x00,0xC0,0x0E,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xFE,0xFF,0x01,0x00,0x00,0xFE,0xFF,0x01,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xC0,0x0E,0x00,0x00,0x00,0xE0,0x0C,0x00,0x00,0x00,0x60,0x1C,0x00,0x00,0x00,0x70,0x18,0x00,0x00,0x00,0x38,0x38,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 21 pixels) */
-	0x15, 0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0xC0,0xFF,0xFF,0x07,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,
+	0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0xC0,0xFF,0xFF,0x07,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,
 
 	/* Index 12, character 44 "," (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x80,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x80,0x00,0x00,
 
 	/* Index 13, character 45 "-" (width: 11 pixels) */
-	0xB, 0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,
+	0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,
 
 	/* Index 14, character 46 "." (width: 4 pixels) */
-	0x4, 0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,
+	0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,
 
 	/* Index 15, character 47 "/" (width: 15 pixels) */
-	0xF, 0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,
 
 	/* Index 16, character 48 "0" (width: 18 pixels) */
-	0x12, 0x00,0xFE,0x1F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x07,0x00,0x78,0x00,0x80,0x07,0x00,0xF0,0x01,0xE0,0x03,0x00,0xE0,0xFF,0xFF,0x01,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,
+	0x00,0xFE,0x1F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x07,0x00,0x78,0x00,0x80,0x07,0x00,0xF0,0x01,0xE0,0x03,0x00,0xE0,0xFF,0xFF,0x01,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,
 
 	/* Index 17, character 49 "1" (width: 13 pixels) */
-	0xD, 0x80,0x03,0x00,0x0E,0x00,0x80,0x03,0x00,0x0E,0x00,0x80,0x03,0x00,0x0E,0x00,0xC0,0x03,0x00,0x0E,0x00,0xC0,0x03,0x00,0x0E,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,
+	0x80,0x03,0x00,0x0E,0x00,0x80,0x03,0x00,0x0E,0x00,0x80,0x03,0x00,0x0E,0x00,0xC0,0x03,0x00,0x0E,0x00,0xC0,0x03,0x00,0x0E,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,
 
 	/* Index 18, character 50 "2" (width: 17 pixels) */
-	0x11, 0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x80,0x0F,0x00,0x38,0x00,0xC0,0x0F,0x00,0x38,0x00,0xE0,0x0F,0x00,0x3C,0x00,0xE0,0x0E,0x00,0x1C,0x00,0x70,0x0E,0x00,0x1C,0x00,0x38,0x0E,0x00,0x1C,0x00,0x3C,0x0E,0x00,0x1C,0x00,0x1E,0x0E,0x00,0x1C,0x00,0x0F,0x0E,0x00,0x1C,0x80,0x07,0x0E,0x00,0x38,0xC0,0x03,0x0E,0x00,0x78,0xF0,0x01,0x0E,0x00,0xF0,0xFF,0x00,0x0E,0x00,0xE0,0x3F,0x00,0x0E,0x00,0xC0,0x0F,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,
+	0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x80,0x0F,0x00,0x38,0x00,0xC0,0x0F,0x00,0x38,0x00,0xE0,0x0F,0x00,0x3C,0x00,0xE0,0x0E,0x00,0x1C,0x00,0x70,0x0E,0x00,0x1C,0x00,0x38,0x0E,0x00,0x1C,0x00,0x3C,0x0E,0x00,0x1C,0x00,0x1E,0x0E,0x00,0x1C,0x00,0x0F,0x0E,0x00,0x1C,0x80,0x07,0x0E,0x00,0x38,0xC0,0x03,0x0E,0x00,0x78,0xF0,0x01,0x0E,0x00,0xF0,0xFF,0x00,0x0E,0x00,0xE0,0x3F,0x00,0x0E,0x00,0xC0,0x0F,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,
 
 	/* Index 19, character 51 "3" (width: 16 pixels) */
-	0x10, 0x00,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x0F,0x00,0x3C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xF0,0x00,0x0F,0x00,0x3C,0xB0,0x01,0x07,0x00,0x78,0xB8,0xC3,0x07,0x00,0xF8,0x9F,0xFF,0x03,0x00,0xF0,0x0F,0xFF,0x01,0x00,0xC0,0x07,0x7C,0x00,0x00,
+	0x00,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x0F,0x00,0x3C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xF0,0x00,0x0F,0x00,0x3C,0xB0,0x01,0x07,0x00,0x78,0xB8,0xC3,0x07,0x00,0xF8,0x9F,0xFF,0x03,0x00,0xF0,0x0F,0xFF,0x01,0x00,0xC0,0x07,0x7C,0x00,0x00,
 
 	/* Index 20, character 52 "4" (width: 19 pixels) */
-	0x13, 0x00,0x00,0x1E,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xF0,0x1D,0x00,0x00,0x00,0x78,0x1C,0x00,0x00,0x00,0x3C,0x1C,0x00,0x00,0x00,0x1F,0x1C,0x00,0x00,0x80,0x0F,0x1C,0x00,0x00,0xC0,0x07,0x1C,0x00,0x00,0xE0,0x03,0x1C,0x00,0x00,0xF0,0x00,0x1C,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,
+	0x00,0x00,0x1E,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xF0,0x1D,0x00,0x00,0x00,0x78,0x1C,0x00,0x00,0x00,0x3C,0x1C,0x00,0x00,0x00,0x1F,0x1C,0x00,0x00,0x80,0x0F,0x1C,0x00,0x00,0xC0,0x07,0x1C,0x00,0x00,0xE0,0x03,0x1C,0x00,0x00,0xF0,0x00,0x1C,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,
 
 	/* Index 21, character 53 "5" (width: 17 pixels) */
-	0x11, 0x00,0x00,0x80,0x07,0x00,0xFC,0xFF,0x00,0x07,0x00,0xFC,0xFF,0x00,0x07,0x00,0xFC,0x7F,0x00,0x0F,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0xF0,0x00,0x07,0x00,0x1C,0xE0,0x80,0x07,0x00,0x1C,0xE0,0xC1,0x03,0x00,0x1C,0xC0,0xFF,0x03,0x00,0x1C,0x80,0xFF,0x00,0x00,0x1C,0x00,0x3E,0x00,0x00,
+	0x00,0x00,0x80,0x07,0x00,0xFC,0xFF,0x00,0x07,0x00,0xFC,0xFF,0x00,0x07,0x00,0xFC,0x7F,0x00,0x0F,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0xF0,0x00,0x07,0x00,0x1C,0xE0,0x80,0x07,0x00,0x1C,0xE0,0xC1,0x03,0x00,0x1C,0xC0,0xFF,0x03,0x00,0x1C,0x80,0xFF,0x00,0x00,0x1C,0x00,0x3E,0x00,0x00,
 
 	/* Index 22, character 54 "6" (width: 18 pixels) */
-	0x12, 0x00,0xF0,0x1F,0x00,0x00,0x00,0xFE,0xFF,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0xC0,0x67,0xE0,0x03,0x00,0xE0,0x71,0x80,0x07,0x00,0x70,0x30,0x00,0x07,0x00,0x78,0x38,0x00,0x0F,0x00,0x38,0x38,0x00,0x0E,0x00,0x38,0x38,0x00,0x0E,0x00,0x1C,0x38,0x00,0x0E,0x00,0x1C,0x38,0x00,0x0E,0x00,0x1C,0x38,0x00,0x0E,0x00,0x1C,0x78,0x00,0x07,0x00,0x1C,0x70,0x80,0x07,0x00,0x1C,0xF0,0xC1,0x03,0x00,0x3C,0xE0,0xFF,0x01,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,
+	0x00,0xF0,0x1F,0x00,0x00,0x00,0xFE,0xFF,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0xC0,0x67,0xE0,0x03,0x00,0xE0,0x71,0x80,0x07,0x00,0x70,0x30,0x00,0x07,0x00,0x78,0x38,0x00,0x0F,0x00,0x38,0x38,0x00,0x0E,0x00,0x38,0x38,0x00,0x0E,0x00,0x1C,0x38,0x00,0x0E,0x00,0x1C,0x38,0x00,0x0E,0x00,0x1C,0x38,0x00,0x0E,0x00,0x1C,0x78,0x00,0x07,0x00,0x1C,0x70,0x80,0x07,0x00,0x1C,0xF0,0xC1,0x03,0x00,0x3C,0xE0,0xFF,0x01,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,
 
 	/* Index 23, character 55 "7" (width: 17 pixels) */
-	0x11, 0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x08,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0F,0x00,0x38,0x00,0xC0,0x0F,0x00,0x38,0x00,0xF0,0x03,0x00,0x38,0x00,0xFC,0x00,0x00,0x38,0x00,0x3E,0x00,0x00,0x38,0x80,0x1F,0x00,0x00,0x38,0xE0,0x07,0x00,0x00,0x38,0xF8,0x01,0x00,0x00,0x38,0x7E,0x00,0x00,0x00,0x38,0x1F,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,
+	0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x08,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0F,0x00,0x38,0x00,0xC0,0x0F,0x00,0x38,0x00,0xF0,0x03,0x00,0x38,0x00,0xFC,0x00,0x00,0x38,0x00,0x3E,0x00,0x00,0x38,0x80,0x1F,0x00,0x00,0x38,0xE0,0x07,0x00,0x00,0x38,0xF8,0x01,0x00,0x00,0x38,0x7E,0x00,0x00,0x00,0x38,0x1F,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,
 
 	/* Index 24, character 56 "8" (width: 18 pixels) */
-	0x12, 0x00,0x00,0x7C,0x00,0x00,0xC0,0x07,0xFE,0x01,0x00,0xE0,0x0F,0xFF,0x03,0x00,0xF0,0x9F,0xC3,0x07,0x00,0x78,0xFC,0x81,0x07,0x00,0x38,0xF8,0x00,0x0F,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x60,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x38,0xF0,0x01,0x07,0x00,0x78,0xF8,0x01,0x07,0x00,0xF0,0x9F,0x83,0x07,0x00,0xF0,0x0F,0xFF,0x03,0x00,0xC0,0x07,0xFE,0x01,0x00,0x00,0x00,0x7C,0x00,0x00,
+	0x00,0x00,0x7C,0x00,0x00,0xC0,0x07,0xFE,0x01,0x00,0xE0,0x0F,0xFF,0x03,0x00,0xF0,0x9F,0xC3,0x07,0x00,0x78,0xFC,0x81,0x07,0x00,0x38,0xF8,0x00,0x0F,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x70,0x00,0x0E,0x00,0x1C,0x60,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x38,0xF0,0x01,0x07,0x00,0x78,0xF8,0x01,0x07,0x00,0xF0,0x9F,0x83,0x07,0x00,0xF0,0x0F,0xFF,0x03,0x00,0xC0,0x07,0xFE,0x01,0x00,0x00,0x00,0x7C,0x00,0x00,
 
 	/* Index 25, character 57 "9" (width: 18 pixels) */
-	0x12, 0x80,0x1F,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x0F,0x00,0xF0,0xE0,0x01,0x0E,0x00,0x38,0xC0,0x01,0x0E,0x00,0x38,0xC0,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x07,0x00,0x1C,0x80,0x03,0x07,0x00,0x3C,0x80,0x83,0x07,0x00,0x38,0x80,0xC1,0x03,0x00,0x78,0xC0,0xE1,0x01,0x00,0xF0,0xC1,0xF9,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,
+	0x80,0x1F,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x0F,0x00,0xF0,0xE0,0x01,0x0E,0x00,0x38,0xC0,0x01,0x0E,0x00,0x38,0xC0,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x07,0x00,0x1C,0x80,0x03,0x07,0x00,0x3C,0x80,0x83,0x07,0x00,0x38,0x80,0xC1,0x03,0x00,0x78,0xC0,0xE1,0x01,0x00,0xF0,0xC1,0xF9,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,
 
 	/* Index 26, character 58 ":" (width: 4 pixels) */
-	0x4, 0x00,0x3E,0x80,0x0F,0x00,0x00,0x3E,0x80,0x0F,0x00,0x00,0x3E,0x80,0x0F,0x00,0x00,0x3E,0x80,0x0F,0x00,
+	0x00,0x3E,0x80,0x0F,0x00,0x00,0x3E,0x80,0x0F,0x00,0x00,0x3E,0x80,0x0F,0x00,0x00,0x3E,0x80,0x0F,0x00,
 
 	/* Index 27, character 59 ";" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xF0,0x03,0x00,0x3E,0x00,0xFF,0x03,0x00,0x3E,0x80,0x7F,0x00,0x00,0x3E,0x80,0x1F,0x00,0x00,0x3E,0x80,0x07,0x00,0x00,0x00,0x80,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xF0,0x03,0x00,0x3E,0x00,0xFF,0x03,0x00,0x3E,0x80,0x7F,0x00,0x00,0x3E,0x80,0x1F,0x00,0x00,0x3E,0x80,0x07,0x00,0x00,0x00,0x80,0x00,0x00,
 
 	/* Index 28, character 60 "<" (width: 20 pixels) */
-	0x14, 0x00,0x00,0x03,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xE0,0x1C,0x00,0x00,0x00,0xE0,0x1C,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x38,0x70,0x00,0x00,0x00,0x38,0x70,0x00,0x00,0x00,0x3C,0xF0,0x00,0x00,0x00,0x1C,0xE0,0x00,0x00,0x00,0x1E,0xE0,0x01,0x00,0x00,0x0E,0xC0,0x01,0x00,0x00,0x0E,0xC0,0x01,0x00,0x00,0x07,0x80,0x03,0x00,0x00,0x07,0x80,0x03,0x00,0x80,0x03,0x00,0x07,0x00,
+	0x00,0x00,0x03,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xE0,0x1C,0x00,0x00,0x00,0xE0,0x1C,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x38,0x70,0x00,0x00,0x00,0x38,0x70,0x00,0x00,0x00,0x3C,0xF0,0x00,0x00,0x00,0x1C,0xE0,0x00,0x00,0x00,0x1E,0xE0,0x01,0x00,0x00,0x0E,0xC0,0x01,0x00,0x00,0x0E,0xC0,0x01,0x00,0x00,0x07,0x80,0x03,0x00,0x00,0x07,0x80,0x03,0x00,0x80,0x03,0x00,0x07,0x00,
 
 	/* Index 29, character 61 "=" (width: 20 pixels) */
-	0x14, 0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,
+	0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,
 
 	/* Index 30, character 62 ">" (width: 20 pixels) */
-	0x14, 0x80,0x03,0x00,0x07,0x00,0x00,0x07,0x80,0x03,0x00,0x00,0x07,0x80,0x03,0x00,0x00,0x0E,0xC0,0x01,0x00,0x00,0x0E,0xC0,0x01,0x00,0x00,0x1E,0xE0,0x01,0x00,0x00,0x1C,0xE0,0x00,0x00,0x00,0x3C,0xF0,0x00,0x00,0x00,0x38,0x70,0x00,0x00,0x00,0x38,0x70,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0xE0,0x1C,0x00,0x00,0x00,0xE0,0x1C,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x03,0x00,0x00,
+	0x80,0x03,0x00,0x07,0x00,0x00,0x07,0x80,0x03,0x00,0x00,0x07,0x80,0x03,0x00,0x00,0x0E,0xC0,0x01,0x00,0x00,0x0E,0xC0,0x01,0x00,0x00,0x1E,0xE0,0x01,0x00,0x00,0x1C,0xE0,0x00,0x00,0x00,0x3C,0xF0,0x00,0x00,0x00,0x38,0x70,0x00,0x00,0x00,0x38,0x70,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0x70,0x38,0x00,0x00,0x00,0xE0,0x1C,0x00,0x00,0x00,0xE0,0x1C,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x03,0x00,0x00,
 
 	/* Index 31, character 63 "?" (width: 14 pixels) */
-	0xE, 0x78,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x1F,0x0F,0x00,0x1C,0x80,0x1F,0x0F,0x00,0x1C,0x80,0x1F,0x0F,0x00,0x1C,0xC0,0x01,0x00,0x00,0x1C,0xE0,0x00,0x00,0x00,0x3C,0xF0,0x00,0x00,0x00,0x78,0x78,0x00,0x00,0x00,0xF8,0x3F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,
+	0x78,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x1F,0x0F,0x00,0x1C,0x80,0x1F,0x0F,0x00,0x1C,0x80,0x1F,0x0F,0x00,0x1C,0xC0,0x01,0x00,0x00,0x1C,0xE0,0x00,0x00,0x00,0x3C,0xF0,0x00,0x00,0x00,0x78,0x78,0x00,0x00,0x00,0xF8,0x3F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 29 pixels) */
-	0x1D, 0x00,0xE0,0x1F,0x00,0x00,0x00,0xFC,0xFF,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x80,0x1F,0xE0,0x07,0x00,0xC0,0x03,0x00,0x0F,0x00,0xE0,0x01,0x00,0x1E,0x00,0xF0,0x00,0x00,0x38,0x00,0x70,0xC0,0x1F,0x38,0x00,0x38,0xF0,0xFF,0x70,0x00,0x18,0xF8,0xFF,0x61,0x00,0x18,0x3C,0xE0,0x61,0x00,0x0C,0x0E,0xC0,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0xC0,0xC1,0x00,0x0C,0x0C,0xC0,0xC0,0x00,0x1C,0xFE,0xFF,0xC3,0x00,0x18,0xFE,0xFF,0xE3,0x00,0x18,0xFE,0xFF,0x63,0x00,0x38,0x00,0x00,0x03,0x00,0x70,0x00,0x00,0x03,0x00,0xE0,0x00,0x00,0x03,0x00,0xE0,0x03,0x00,0x03,0x00,0xC0,0x1F,0xC0,0x03,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0xFC,0xFF,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,
+	0x00,0xE0,0x1F,0x00,0x00,0x00,0xFC,0xFF,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x80,0x1F,0xE0,0x07,0x00,0xC0,0x03,0x00,0x0F,0x00,0xE0,0x01,0x00,0x1E,0x00,0xF0,0x00,0x00,0x38,0x00,0x70,0xC0,0x1F,0x38,0x00,0x38,0xF0,0xFF,0x70,0x00,0x18,0xF8,0xFF,0x61,0x00,0x18,0x3C,0xE0,0x61,0x00,0x0C,0x0E,0xC0,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0x80,0xC3,0x00,0x0C,0x06,0xC0,0xC1,0x00,0x0C,0x0C,0xC0,0xC0,0x00,0x1C,0xFE,0xFF,0xC3,0x00,0x18,0xFE,0xFF,0xE3,0x00,0x18,0xFE,0xFF,0x63,0x00,0x38,0x00,0x00,0x03,0x00,0x70,0x00,0x00,0x03,0x00,0xE0,0x00,0x00,0x03,0x00,0xE0,0x03,0x00,0x03,0x00,0xC0,0x1F,0xC0,0x03,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0xFC,0xFF,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,
 
 	/* Index 33, character 65 "A" (width: 24 pixels) */
-	0x18, 0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xFE,0x1D,0x00,0x00,0xC0,0x3F,0x1C,0x00,0x00,0xF8,0x07,0x1C,0x00,0x00,0xF8,0x01,0x1C,0x00,0x00,0x38,0x00,0x1C,0x00,0x00,0x38,0x00,0x1C,0x00,0x00,0xF8,0x01,0x1C,0x00,0x00,0xF8,0x07,0x1C,0x00,0x00,0xC0,0x3F,0x1C,0x00,0x00,0x00,0xFE,0x1D,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x08,0x00,
+	0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xFE,0x1D,0x00,0x00,0xC0,0x3F,0x1C,0x00,0x00,0xF8,0x07,0x1C,0x00,0x00,0xF8,0x01,0x1C,0x00,0x00,0x38,0x00,0x1C,0x00,0x00,0x38,0x00,0x1C,0x00,0x00,0xF8,0x01,0x1C,0x00,0x00,0xF8,0x07,0x1C,0x00,0x00,0xC0,0x3F,0x1C,0x00,0x00,0x00,0xFE,0x1D,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x08,0x00,
 
 	/* Index 34, character 66 "B" (width: 20 pixels) */
-	0x14, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x78,0xF0,0x00,0x0E,0x00,0x70,0xF8,0x01,0x07,0x00,0xF0,0xDF,0x01,0x07,0x00,0xE0,0xCF,0x83,0x03,0x00,0xC0,0x87,0xFF,0x03,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x7C,0x00,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x78,0xF0,0x00,0x0E,0x00,0x70,0xF8,0x01,0x07,0x00,0xF0,0xDF,0x01,0x07,0x00,0xE0,0xCF,0x83,0x03,0x00,0xC0,0x87,0xFF,0x03,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x7C,0x00,0x00,
 
 	/* Index 35, character 67 "C" (width: 21 pixels) */
-	0x15, 0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0xF0,0x00,0xC0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x3C,0x00,0x00,0x0F,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x78,0x00,0x80,0x07,0x00,0x78,0x00,0x80,0x03,0x00,0xF0,0x00,0xC0,0x03,0x00,
+	0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0xF0,0x00,0xC0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x3C,0x00,0x00,0x0F,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x78,0x00,0x80,0x07,0x00,0x78,0x00,0x80,0x03,0x00,0xF0,0x00,0xC0,0x03,0x00,
 
 	/* Index 36, character 68 "D" (width: 22 pixels) */
-	0x16, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x07,0x00,0xF0,0x00,0x00,0x07,0x00,0xE0,0x00,0x80,0x03,0x00,0xE0,0x01,0xC0,0x03,0x00,0xC0,0x03,0xE0,0x01,0x00,0x80,0x0F,0xF8,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x07,0x00,0xF0,0x00,0x00,0x07,0x00,0xE0,0x00,0x80,0x03,0x00,0xE0,0x01,0xC0,0x03,0x00,0xC0,0x03,0xE0,0x01,0x00,0x80,0x0F,0xF8,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,
 
 	/* Index 37, character 69 "E" (width: 17 pixels) */
-	0x11, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,0x38,0xE0,0x00,0x0E,0x00,
 
 	/* Index 38, character 70 "F" (width: 17 pixels) */
-	0x11, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,
 
 	/* Index 39, character 71 "G" (width: 22 pixels) */
-	0x16, 0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xE0,0x01,0xE0,0x03,0x00,0xF0,0x00,0xC0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x3C,0x80,0x03,0x0E,0x00,0x38,0x80,0x03,0x07,0x00,0x38,0x80,0x03,0x07,0x00,0x78,0x80,0xFF,0x07,0x00,0x70,0x80,0xFF,0x03,0x00,0xF0,0x80,0xFF,0x03,0x00,
+	0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xE0,0x01,0xE0,0x03,0x00,0xF0,0x00,0xC0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x1C,0x80,0x03,0x0E,0x00,0x3C,0x80,0x03,0x0E,0x00,0x38,0x80,0x03,0x07,0x00,0x38,0x80,0x03,0x07,0x00,0x78,0x80,0xFF,0x07,0x00,0x70,0x80,0xFF,0x03,0x00,0xF0,0x80,0xFF,0x03,0x00,
 
 	/* Index 40, character 72 "H" (width: 20 pixels) */
-	0x14, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,
 
 	/* Index 41, character 73 "I" (width: 9 pixels) */
-	0x9, 0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,
+	0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,
 
 	/* Index 42, character 74 "J" (width: 12 pixels) */
-	0xC, 0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0F,0x00,0x38,0x00,0x80,0x07,0x00,0xF8,0xFF,0xFF,0x07,0x00,0xF8,0xFF,0xFF,0x03,0x00,0xF8,0xFF,0xFF,0x00,0x00,
+	0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0F,0x00,0x38,0x00,0x80,0x07,0x00,0xF8,0xFF,0xFF,0x07,0x00,0xF8,0xFF,0xFF,0x03,0x00,0xF8,0xFF,0xFF,0x00,0x00,
 
 	/* Index 43, character 75 "K" (width: 21 pixels) */
-	0x15, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x3E,0x0F,0x00,0x00,0x00,0x1F,0x1E,0x00,0x00,0x80,0x0F,0x3C,0x00,0x00,0xC0,0x07,0x78,0x00,0x00,0xE0,0x03,0xF0,0x00,0x00,0xF0,0x01,0xE0,0x01,0x00,0xF8,0x00,0xC0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x0F,0x00,0x18,0x00,0x00,0x0E,0x00,0x08,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x3E,0x0F,0x00,0x00,0x00,0x1F,0x1E,0x00,0x00,0x80,0x0F,0x3C,0x00,0x00,0xC0,0x07,0x78,0x00,0x00,0xE0,0x03,0xF0,0x00,0x00,0xF0,0x01,0xE0,0x01,0x00,0xF8,0x00,0xC0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x0F,0x00,0x18,0x00,0x00,0x0E,0x00,0x08,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
 
 	/* Index 44, character 76 "L" (width: 16 pixels) */
-	0x10, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,
 
 	/* Index 45, character 77 "M" (width: 24 pixels) */
-	0x18, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,
 
 	/* Index 46, character 78 "N" (width: 20 pixels) */
-	0x14, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x80,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x80,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,
 
 	/* Index 47, character 79 "O" (width: 24 pixels) */
-	0x18, 0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0x70,0x00,0xC0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x3C,0x00,0x00,0x0F,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x0F,0x00,0x38,0x00,0x00,0x07,0x00,0x78,0x00,0x80,0x07,0x00,0x70,0x00,0xC0,0x03,0x00,0xF0,0x01,0xE0,0x03,0x00,0xE0,0x07,0xF8,0x01,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,
+	0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0x70,0x00,0xC0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x3C,0x00,0x00,0x0F,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x0F,0x00,0x38,0x00,0x00,0x07,0x00,0x78,0x00,0x80,0x07,0x00,0x70,0x00,0xC0,0x03,0x00,0xF0,0x01,0xE0,0x03,0x00,0xE0,0x07,0xF8,0x01,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,
 
 	/* Index 48, character 80 "P" (width: 17 pixels) */
-	0x11, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x80,0x07,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x70,0xC0,0x03,0x00,0x00,0xF0,0xE1,0x01,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x38,0x80,0x07,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x70,0xC0,0x03,0x00,0x00,0xF0,0xE1,0x01,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 25 pixels) */
-	0x19, 0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0x70,0x00,0xC0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x3C,0x00,0x00,0x0F,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x7E,0x00,0x3C,0x00,0x00,0xFF,0x01,0x38,0x00,0x00,0xFF,0x03,0x78,0x00,0x80,0xC7,0x03,0x70,0x00,0xC0,0x83,0x07,0xF0,0x01,0xE0,0x03,0x07,0xE0,0x07,0xF8,0x01,0x07,0xC0,0xFF,0xFF,0x00,0x07,0x00,0xFF,0x3F,0x00,0x07,0x00,0xF8,0x07,0x80,0x07,0x00,0x00,0x00,0x80,0x07,
+	0x00,0xF8,0x07,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0xE0,0x07,0xF8,0x01,0x00,0xF0,0x01,0xE0,0x03,0x00,0x70,0x00,0xC0,0x03,0x00,0x78,0x00,0x80,0x07,0x00,0x38,0x00,0x00,0x07,0x00,0x3C,0x00,0x00,0x0F,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x7E,0x00,0x3C,0x00,0x00,0xFF,0x01,0x38,0x00,0x00,0xFF,0x03,0x78,0x00,0x80,0xC7,0x03,0x70,0x00,0xC0,0x83,0x07,0xF0,0x01,0xE0,0x03,0x07,0xE0,0x07,0xF8,0x01,0x07,0xC0,0xFF,0xFF,0x00,0x07,0x00,0xFF,0x3F,0x00,0x07,0x00,0xF8,0x07,0x80,0x07,0x00,0x00,0x00,0x80,0x07,
 
 	/* Index 50, character 82 "R" (width: 21 pixels) */
-	0x15, 0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x07,0x00,0x00,0x38,0x80,0x0F,0x00,0x00,0x78,0xC0,0x3F,0x00,0x00,0x70,0xC0,0x7D,0x00,0x00,0xF0,0xF0,0xF0,0x00,0x00,0xE0,0x7F,0xE0,0x01,0x00,0xC0,0x3F,0xC0,0x03,0x00,0x80,0x1F,0x80,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
+	0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x07,0x00,0x00,0x38,0x80,0x0F,0x00,0x00,0x78,0xC0,0x3F,0x00,0x00,0x70,0xC0,0x7D,0x00,0x00,0xF0,0xF0,0xF0,0x00,0x00,0xE0,0x7F,0xE0,0x01,0x00,0xC0,0x3F,0xC0,0x03,0x00,0x80,0x1F,0x80,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
 
 	/* Index 51, character 83 "S" (width: 20 pixels) */
-	0x14, 0x80,0x0F,0xC0,0x03,0x00,0xE0,0x1F,0x80,0x07,0x00,0xF0,0x3F,0x80,0x07,0x00,0x70,0x78,0x00,0x07,0x00,0x38,0x70,0x00,0x07,0x00,0x38,0xF0,0x00,0x0F,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x01,0x0E,0x00,0x1C,0xE0,0x01,0x0E,0x00,0x1C,0xC0,0x01,0x0E,0x00,0x3C,0xC0,0x01,0x0E,0x00,0x3C,0xC0,0x01,0x07,0x00,0x38,0xC0,0x03,0x07,0x00,0x78,0x80,0x87,0x03,0x00,0x78,0x80,0xFF,0x03,0x00,0xF0,0x00,0xFF,0x01,0x00,0x00,0x00,0x7C,0x00,0x00,
+	0x80,0x0F,0xC0,0x03,0x00,0xE0,0x1F,0x80,0x07,0x00,0xF0,0x3F,0x80,0x07,0x00,0x70,0x78,0x00,0x07,0x00,0x38,0x70,0x00,0x07,0x00,0x38,0xF0,0x00,0x0F,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x00,0x0E,0x00,0x1C,0xE0,0x01,0x0E,0x00,0x1C,0xE0,0x01,0x0E,0x00,0x1C,0xC0,0x01,0x0E,0x00,0x3C,0xC0,0x01,0x0E,0x00,0x3C,0xC0,0x01,0x07,0x00,0x38,0xC0,0x03,0x07,0x00,0x78,0x80,0x87,0x03,0x00,0x78,0x80,0xFF,0x03,0x00,0xF0,0x00,0xFF,0x01,0x00,0x00,0x00,0x7C,0x00,0x00,
 
 	/* Index 52, character 84 "T" (width: 21 pixels) */
-	0x15, 0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,
+	0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,
 
 	/* Index 53, character 85 "U" (width: 20 pixels) */
-	0x14, 0xF8,0xFF,0x3F,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0xF8,0xFF,0xFF,0x01,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xE0,0x03,0x00,0xF8,0xFF,0xFF,0x01,0x00,0xF8,0xFF,0xFF,0x00,0x00,0xF8,0xFF,0x3F,0x00,0x00,
+	0xF8,0xFF,0x3F,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0xF8,0xFF,0xFF,0x01,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xE0,0x03,0x00,0xF8,0xFF,0xFF,0x01,0x00,0xF8,0xFF,0xFF,0x00,0x00,0xF8,0xFF,0x3F,0x00,0x00,
 
 	/* Index 54, character 86 "V" (width: 24 pixels) */
-	0x18, 0x08,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,
+	0x08,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,
 
 	/* Index 55, character 87 "W" (width: 31 pixels) */
-	0x1F, 0x18,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,
+	0x18,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,
 
 	/* Index 56, character 88 "X" (width: 22 pixels) */
-	0x16, 0x08,0x00,0x00,0x08,0x00,0x18,0x00,0x00,0x0C,0x00,0x38,0x00,0x00,0x0E,0x00,0xF8,0x00,0x80,0x0F,0x00,0xF0,0x01,0xC0,0x07,0x00,0xE0,0x07,0xF0,0x01,0x00,0x80,0x0F,0xF8,0x00,0x00,0x00,0x1F,0x7C,0x00,0x00,0x00,0x7C,0x1F,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x7C,0x1F,0x00,0x00,0x00,0x1F,0x7E,0x00,0x00,0x80,0x0F,0xF8,0x00,0x00,0xC0,0x07,0xF0,0x01,0x00,0xF0,0x01,0xC0,0x07,0x00,0xF8,0x00,0x80,0x0F,0x00,0x38,0x00,0x00,0x0F,0x00,0x18,0x00,0x00,0x0C,0x00,0x08,0x00,0x00,0x08,0x00,
+	0x08,0x00,0x00,0x08,0x00,0x18,0x00,0x00,0x0C,0x00,0x38,0x00,0x00,0x0E,0x00,0xF8,0x00,0x80,0x0F,0x00,0xF0,0x01,0xC0,0x07,0x00,0xE0,0x07,0xF0,0x01,0x00,0x80,0x0F,0xF8,0x00,0x00,0x00,0x1F,0x7C,0x00,0x00,0x00,0x7C,0x1F,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x7C,0x1F,0x00,0x00,0x00,0x1F,0x7E,0x00,0x00,0x80,0x0F,0xF8,0x00,0x00,0xC0,0x07,0xF0,0x01,0x00,0xF0,0x01,0xC0,0x07,0x00,0xF8,0x00,0x80,0x0F,0x00,0x38,0x00,0x00,0x0F,0x00,0x18,0x00,0x00,0x0C,0x00,0x08,0x00,0x00,0x08,0x00,
 
 	/* Index 57, character 89 "Y" (width: 21 pixels) */
-	0x15, 0x08,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0xC0,0xFF,0x0F,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,
+	0x08,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0xC0,0xFF,0x0F,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,
 
 	/* Index 58, character 90 "Z" (width: 20 pixels) */
-	0x14, 0x00,0x00,0x00,0x0F,0x00,0x38,0x00,0x80,0x0F,0x00,0x38,0x00,0xC0,0x0F,0x00,0x38,0x00,0xE0,0x0F,0x00,0x38,0x00,0xF0,0x0E,0x00,0x38,0x00,0x78,0x0E,0x00,0x38,0x00,0x3E,0x0E,0x00,0x38,0x00,0x1F,0x0E,0x00,0x38,0x80,0x07,0x0E,0x00,0x38,0xC0,0x03,0x0E,0x00,0x38,0xE0,0x01,0x0E,0x00,0x38,0xF8,0x00,0x0E,0x00,0x38,0x7C,0x00,0x0E,0x00,0x38,0x3E,0x00,0x0E,0x00,0x38,0x0F,0x00,0x0E,0x00,0xB8,0x07,0x00,0x0E,0x00,0xF8,0x03,0x00,0x0E,0x00,0xF8,0x01,0x00,0x0E,0x00,0xF8,0x00,0x00,0x0E,0x00,0x78,0x00,0x00,0x0E,0x00,
+	0x00,0x00,0x00,0x0F,0x00,0x38,0x00,0x80,0x0F,0x00,0x38,0x00,0xC0,0x0F,0x00,0x38,0x00,0xE0,0x0F,0x00,0x38,0x00,0xF0,0x0E,0x00,0x38,0x00,0x78,0x0E,0x00,0x38,0x00,0x3E,0x0E,0x00,0x38,0x00,0x1F,0x0E,0x00,0x38,0x80,0x07,0x0E,0x00,0x38,0xC0,0x03,0x0E,0x00,0x38,0xE0,0x01,0x0E,0x00,0x38,0xF8,0x00,0x0E,0x00,0x38,0x7C,0x00,0x0E,0x00,0x38,0x3E,0x00,0x0E,0x00,0x38,0x0F,0x00,0x0E,0x00,0xB8,0x07,0x00,0x0E,0x00,0xF8,0x03,0x00,0x0E,0x00,0xF8,0x01,0x00,0x0E,0x00,0xF8,0x00,0x00,0x0E,0x00,0x78,0x00,0x00,0x0E,0x00,
 
 	/* Index 59, character 91 "[" (width: 9 pixels) */
-	0x9, 0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,
+	0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,
 
 	/* Index 60, character 92 "\" (width: 15 pixels) */
-	0xF, 0x02,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x01,
+	0x02,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x01,
 
 	/* Index 61, character 93 "]" (width: 9 pixels) */
-	0x9, 0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,
+	0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,
 
 	/* Index 62, character 94 "^" (width: 22 pixels) */
-	0x16, 0x00,0x00,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x01,0x00,0x00,
+	0x00,0x00,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x01,0x00,0x00,
 
 	/* Index 63, character 95 "_" (width: 22 pixels) */
-	0x16, 0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,
+	0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x80,0x01,
 
 	/* Index 64, character 96 "`" (width: 7 pixels) */
-	0x7, 0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,
+	0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 16 pixels) */
-	0x10, 0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x0E,0xFE,0x07,0x00,0x00,0x0E,0x0F,0x07,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x87,0x03,0x06,0x00,0x00,0x87,0x03,0x07,0x00,0x00,0x8F,0x03,0x07,0x00,0x00,0x9E,0x83,0x03,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,
+	0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x0E,0xFE,0x07,0x00,0x00,0x0E,0x0F,0x07,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x87,0x03,0x0E,0x00,0x00,0x87,0x03,0x06,0x00,0x00,0x87,0x03,0x07,0x00,0x00,0x8F,0x03,0x07,0x00,0x00,0x9E,0x83,0x03,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,
 
 	/* Index 66, character 98 "b" (width: 17 pixels) */
-	0x11, 0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x07,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x0F,0x00,0x07,0x00,0x00,0x0E,0x80,0x07,0x00,0x00,0x3E,0xE0,0x03,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,
+	0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x07,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x0F,0x00,0x07,0x00,0x00,0x0E,0x80,0x07,0x00,0x00,0x3E,0xE0,0x03,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,
 
 	/* Index 67, character 99 "c" (width: 15 pixels) */
-	0xF, 0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0x7C,0xE0,0x03,0x00,0x00,0x1E,0x80,0x07,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x1E,0x80,0x07,0x00,
+	0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0x7C,0xE0,0x03,0x00,0x00,0x1E,0x80,0x07,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x1E,0x80,0x07,0x00,
 
 	/* Index 68, character 100 "d" (width: 17 pixels) */
-	0x11, 0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0x1E,0x00,0x07,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x06,0x00,0x07,0x00,0x00,0x0E,0x80,0x03,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,
+	0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0x1E,0x00,0x07,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x06,0x00,0x07,0x00,0x00,0x0E,0x80,0x03,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,
 
 	/* Index 69, character 101 "e" (width: 17 pixels) */
-	0x11, 0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xF8,0xFF,0x01,0x00,0x00,0x3C,0xC7,0x03,0x00,0x00,0x1E,0x87,0x07,0x00,0x00,0x0E,0x07,0x07,0x00,0x00,0x07,0x07,0x0F,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x0E,0x07,0x0E,0x00,0x00,0x1E,0x07,0x0F,0x00,0x00,0xFC,0x07,0x07,0x00,0x00,0xF8,0x07,0x07,0x00,0x00,0xE0,0x87,0x07,0x00,
+	0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xF8,0xFF,0x01,0x00,0x00,0x3C,0xC7,0x03,0x00,0x00,0x1E,0x87,0x07,0x00,0x00,0x0E,0x07,0x07,0x00,0x00,0x07,0x07,0x0F,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x0E,0x07,0x0E,0x00,0x00,0x1E,0x07,0x0F,0x00,0x00,0xFC,0x07,0x07,0x00,0x00,0xF8,0x07,0x07,0x00,0x00,0xE0,0x87,0x07,0x00,
 
 	/* Index 70, character 102 "f" (width: 12 pixels) */
-	0xC, 0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xFC,0xFF,0xFF,0x0F,0x00,0x1C,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,
+	0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x0F,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0xFC,0xFF,0xFF,0x0F,0x00,0x1C,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 17 pixels) */
-	0x11, 0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x83,0x03,0x00,0x7C,0xC0,0x87,0x07,0x00,0x1E,0x00,0x07,0x07,0x00,0x0E,0x00,0x0F,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x07,0x07,0x00,0x0E,0x00,0x87,0x03,0x00,0x0E,0x80,0xC3,0x03,0x00,0xFE,0xFF,0xFF,0x01,0x00,0xFE,0xFF,0xFF,0x00,0x00,0xFE,0xFF,0x3F,0x00,
+	0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x83,0x03,0x00,0x7C,0xC0,0x87,0x07,0x00,0x1E,0x00,0x07,0x07,0x00,0x0E,0x00,0x0F,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x0E,0x07,0x00,0x07,0x00,0x07,0x07,0x00,0x0E,0x00,0x87,0x03,0x00,0x0E,0x80,0xC3,0x03,0x00,0xFE,0xFF,0xFF,0x01,0x00,0xFE,0xFF,0xFF,0x00,0x00,0xFE,0xFF,0x3F,0x00,
 
 	/* Index 72, character 104 "h" (width: 16 pixels) */
-	0x10, 0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,
+	0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,
 
 	/* Index 73, character 105 "i" (width: 3 pixels) */
-	0x3, 0x38,0xFE,0xFF,0x0F,0x00,0x38,0xFE,0xFF,0x0F,0x00,0x38,0xFE,0xFF,0x0F,0x00,
+	0x38,0xFE,0xFF,0x0F,0x00,0x38,0xFE,0xFF,0x0F,0x00,0x38,0xFE,0xFF,0x0F,0x00,
 
 	/* Index 74, character 106 "j" (width: 10 pixels) */
-	0xA, 0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0xC0,0x03,0x38,0xFE,0xFF,0xFF,0x03,0x38,0xFE,0xFF,0xFF,0x01,0x38,0xFE,0xFF,0x7F,0x00,
+	0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0xC0,0x03,0x38,0xFE,0xFF,0xFF,0x03,0x38,0xFE,0xFF,0xFF,0x01,0x38,0xFE,0xFF,0x7F,0x00,
 
 	/* Index 75, character 107 "k" (width: 17 pixels) */
-	0x11, 0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xC0,0x79,0x00,0x00,0x00,0xE0,0xF0,0x00,0x00,0x00,0x70,0xE0,0x01,0x00,0x00,0x38,0xC0,0x03,0x00,0x00,0x1C,0x80,0x07,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x06,0x00,0x0E,0x00,0x00,0x02,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
+	0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xC0,0x79,0x00,0x00,0x00,0xE0,0xF0,0x00,0x00,0x00,0x70,0xE0,0x01,0x00,0x00,0x38,0xC0,0x03,0x00,0x00,0x1C,0x80,0x07,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x06,0x00,0x0E,0x00,0x00,0x02,0x00,0x0C,0x00,0x00,0x00,0x00,0x08,0x00,
 
 	/* Index 76, character 108 "l" (width: 3 pixels) */
-	0x3, 0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,
+	0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0x0F,0x00,
 
 	/* Index 77, character 109 "m" (width: 27 pixels) */
-	0x1B, 0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,
+	0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,
 
 	/* Index 78, character 110 "n" (width: 16 pixels) */
-	0x10, 0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,
+	0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x0F,0x00,
 
 	/* Index 79, character 111 "o" (width: 17 pixels) */
-	0x11, 0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x3C,0xE0,0x03,0x00,0x00,0x1E,0x80,0x07,0x00,0x00,0x0F,0x00,0x0F,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x0F,0x00,0x0F,0x00,0x00,0x1E,0x80,0x07,0x00,0x00,0x3C,0xE0,0x03,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,
+	0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x3C,0xE0,0x03,0x00,0x00,0x1E,0x80,0x07,0x00,0x00,0x0F,0x00,0x0F,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x0F,0x00,0x0F,0x00,0x00,0x1E,0x80,0x07,0x00,0x00,0x3C,0xE0,0x03,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,
 
 	/* Index 80, character 112 "p" (width: 17 pixels) */
-	0x11, 0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,0x00,0x1C,0x00,0x07,0x00,0x00,0x0E,0x00,0x06,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x06,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x0F,0x00,0x07,0x00,0x00,0x0E,0x80,0x07,0x00,0x00,0x3E,0xE0,0x03,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,
+	0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,0x00,0x1C,0x00,0x07,0x00,0x00,0x0E,0x00,0x06,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x06,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x0F,0x00,0x07,0x00,0x00,0x0E,0x80,0x07,0x00,0x00,0x3E,0xE0,0x03,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,
 
 	/* Index 81, character 113 "q" (width: 17 pixels) */
-	0x11, 0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0x1E,0x00,0x07,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x0E,0x80,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,
+	0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0x1E,0x00,0x07,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x0E,0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x0E,0x80,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0x07,
 
 	/* Index 82, character 114 "r" (width: 12 pixels) */
-	0xC, 0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,
+	0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 15 pixels) */
-	0xF, 0x00,0xF0,0x80,0x07,0x00,0x00,0xFC,0x01,0x07,0x00,0x00,0xFE,0x03,0x07,0x00,0x00,0x8E,0x07,0x0F,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x0F,0x0E,0x00,0x00,0x07,0x0E,0x0E,0x00,0x00,0x07,0x0E,0x0E,0x00,0x00,0x07,0x0E,0x0F,0x00,0x00,0x0E,0x1E,0x07,0x00,0x00,0x0E,0xFC,0x07,0x00,0x00,0x1E,0xFC,0x03,0x00,0x00,0x00,0xF0,0x00,0x00,
+	0x00,0xF0,0x80,0x07,0x00,0x00,0xFC,0x01,0x07,0x00,0x00,0xFE,0x03,0x07,0x00,0x00,0x8E,0x07,0x0F,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x07,0x0E,0x00,0x00,0x07,0x0F,0x0E,0x00,0x00,0x07,0x0E,0x0E,0x00,0x00,0x07,0x0E,0x0E,0x00,0x00,0x07,0x0E,0x0F,0x00,0x00,0x0E,0x1E,0x07,0x00,0x00,0x0E,0xFC,0x07,0x00,0x00,0x1E,0xFC,0x03,0x00,0x00,0x00,0xF0,0x00,0x00,
 
 	/* Index 84, character 116 "t" (width: 12 pixels) */
-	0xC, 0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0F,0x00,
+	0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0F,0x00,
 
 	/* Index 85, character 117 "u" (width: 16 pixels) */
-	0x10, 0x00,0xFE,0xFF,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,
+	0x00,0xFE,0xFF,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x0F,0x00,
 
 	/* Index 86, character 118 "v" (width: 19 pixels) */
-	0x13, 0x00,0x02,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+	0x00,0x02,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
 
 	/* Index 87, character 119 "w" (width: 27 pixels) */
-	0x1B, 0x00,0x06,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0xF8,0x3F,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+	0x00,0x06,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0xF8,0x3F,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
 
 	/* Index 88, character 120 "x" (width: 19 pixels) */
-	0x13, 0x00,0x02,0x00,0x08,0x00,0x00,0x06,0x00,0x0C,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x1E,0x00,0x0F,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0xF8,0xE0,0x03,0x00,0x00,0xF0,0xF1,0x00,0x00,0x00,0xE0,0x7B,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xC0,0x7B,0x00,0x00,0x00,0xF0,0xF1,0x01,0x00,0x00,0xF8,0xE0,0x03,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0x1E,0x00,0x0F,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x06,0x00,0x0C,0x00,0x00,0x02,0x00,0x08,0x00,
+	0x00,0x02,0x00,0x08,0x00,0x00,0x06,0x00,0x0C,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x1E,0x00,0x0F,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0xF8,0xE0,0x03,0x00,0x00,0xF0,0xF1,0x00,0x00,0x00,0xE0,0x7B,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xC0,0x7B,0x00,0x00,0x00,0xF0,0xF1,0x01,0x00,0x00,0xF8,0xE0,0x03,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0x1E,0x00,0x0F,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x06,0x00,0x0C,0x00,0x00,0x02,0x00,0x08,0x00,
 
 	/* Index 89, character 121 "y" (width: 19 pixels) */
-	0x13, 0x00,0x02,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0xC0,0x3F,0x00,0x07,0x00,0x00,0xFF,0xC0,0x07,0x00,0x00,0xF8,0xF3,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+	0x00,0x02,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0xC0,0x3F,0x00,0x07,0x00,0x00,0xFF,0xC0,0x07,0x00,0x00,0xF8,0xF3,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
 
 	/* Index 90, character 122 "z" (width: 15 pixels) */
-	0xF, 0x00,0x0E,0x00,0x0F,0x00,0x00,0x0E,0x80,0x0F,0x00,0x00,0x0E,0xC0,0x0F,0x00,0x00,0x0E,0xE0,0x0F,0x00,0x00,0x0E,0xF0,0x0E,0x00,0x00,0x0E,0x78,0x0E,0x00,0x00,0x0E,0x3E,0x0E,0x00,0x00,0x0E,0x1F,0x0E,0x00,0x00,0x8E,0x0F,0x0E,0x00,0x00,0xCE,0x03,0x0E,0x00,0x00,0xEE,0x01,0x0E,0x00,0x00,0xFE,0x00,0x0E,0x00,0x00,0x7E,0x00,0x0E,0x00,0x00,0x3E,0x00,0x0E,0x00,0x00,0x1E,0x00,0x0E,0x00,
+	0x00,0x0E,0x00,0x0F,0x00,0x00,0x0E,0x80,0x0F,0x00,0x00,0x0E,0xC0,0x0F,0x00,0x00,0x0E,0xE0,0x0F,0x00,0x00,0x0E,0xF0,0x0E,0x00,0x00,0x0E,0x78,0x0E,0x00,0x00,0x0E,0x3E,0x0E,0x00,0x00,0x0E,0x1F,0x0E,0x00,0x00,0x8E,0x0F,0x0E,0x00,0x00,0xCE,0x03,0x0E,0x00,0x00,0xEE,0x01,0x0E,0x00,0x00,0xFE,0x00,0x0E,0x00,0x00,0x7E,0x00,0x0E,0x00,0x00,0x3E,0x00,0x0E,0x00,0x00,0x1E,0x00,0x0E,0x00,
 
 	/* Index 91, character 123 "{" (width: 16 pixels) */
-	0x10, 0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x80,0x3B,0x00,0x00,0x00,0xC0,0x79,0x00,0x00,0xE0,0xFF,0xF1,0x7F,0x00,0xF8,0xFF,0xE0,0xFF,0x01,0xFC,0x3F,0x80,0xFF,0x03,0x1C,0x00,0x00,0x80,0x03,0x0E,0x00,0x00,0x00,0x07,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,
+	0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x80,0x3B,0x00,0x00,0x00,0xC0,0x79,0x00,0x00,0xE0,0xFF,0xF1,0x7F,0x00,0xF8,0xFF,0xE0,0xFF,0x01,0xFC,0x3F,0x80,0xFF,0x03,0x1C,0x00,0x00,0x80,0x03,0x0E,0x00,0x00,0x00,0x07,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,
 
 	/* Index 92, character 124 "|" (width: 3 pixels) */
-	0x3, 0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,
+	0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x07,
 
 	/* Index 93, character 125 "}" (width: 16 pixels) */
-	0x10, 0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x0E,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x80,0x03,0xFC,0x3F,0x80,0xFF,0x03,0xF8,0xFF,0xE0,0xFF,0x01,0xE0,0xFF,0xF1,0x7F,0x00,0x00,0xC0,0x79,0x00,0x00,0x00,0x80,0x3B,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,
+	0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x0E,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x80,0x03,0xFC,0x3F,0x80,0xFF,0x03,0xF8,0xFF,0xE0,0xFF,0x01,0xE0,0xFF,0xF1,0x7F,0x00,0x00,0xC0,0x79,0x00,0x00,0x00,0x80,0x3B,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,
 
 	/* Index 94, character 126 "~" (width: 22 pixels) */
-	0x16, 0x00,0x00,0x1E,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xF0,0x00,0x00,0x00
+	0x00,0x00,0x1E,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xF0,0x00,0x00,0x00
+};
+
+// Offset of each bitmap in Verdana26_bitmaps
+const unsigned short Verdana26_offsets[] = 
+{
+	0x0,	// Index 0
+	0x14,	// Index 1
+	0x23,	// Index 2
+	0x55,	// Index 3
+	0xC3,	// Index 4
+	0x118,	// Index 5
+	0x1BD,	// Index 6
+	0x235,	// Index 7
+	0x244,	// Index 8
+	0x276,	// Index 9
+	0x2A8,	// Index 10
+	0x2F8,	// Index 11
+	0x361,	// Index 12
+	0x384,	// Index 13
+	0x3BB,	// Index 14
+	0x3CF,	// Index 15
+	0x41A,	// Index 16
+	0x474,	// Index 17
+	0x4B5,	// Index 18
+	0x50A,	// Index 19
+	0x55A,	// Index 20
+	0x5B9,	// Index 21
+	0x60E,	// Index 22
+	0x668,	// Index 23
+	0x6BD,	// Index 24
+	0x717,	// Index 25
+	0x771,	// Index 26
+	0x785,	// Index 27
+	0x7A8,	// Index 28
+	0x80C,	// Index 29
+	0x870,	// Index 30
+	0x8D4,	// Index 31
+	0x91A,	// Index 32
+	0x9AB,	// Index 33
+	0xA23,	// Index 34
+	0xA87,	// Index 35
+	0xAF0,	// Index 36
+	0xB5E,	// Index 37
+	0xBB3,	// Index 38
+	0xC08,	// Index 39
+	0xC76,	// Index 40
+	0xCDA,	// Index 41
+	0xD07,	// Index 42
+	0xD43,	// Index 43
+	0xDAC,	// Index 44
+	0xDFC,	// Index 45
+	0xE74,	// Index 46
+	0xED8,	// Index 47
+	0xF50,	// Index 48
+	0xFA5,	// Index 49
+	0x1022,	// Index 50
+	0x108B,	// Index 51
+	0x10EF,	// Index 52
+	0x1158,	// Index 53
+	0x11BC,	// Index 54
+	0x1234,	// Index 55
+	0x12CF,	// Index 56
+	0x133D,	// Index 57
+	0x13A6,	// Index 58
+	0x140A,	// Index 59
+	0x1437,	// Index 60
+	0x1482,	// Index 61
+	0x14AF,	// Index 62
+	0x151D,	// Index 63
+	0x158B,	// Index 64
+	0x15AE,	// Index 65
+	0x15FE,	// Index 66
+	0x1653,	// Index 67
+	0x169E,	// Index 68
+	0x16F3,	// Index 69
+	0x1748,	// Index 70
+	0x1784,	// Index 71
+	0x17D9,	// Index 72
+	0x1829,	// Index 73
+	0x1838,	// Index 74
+	0x186A,	// Index 75
+	0x18BF,	// Index 76
+	0x18CE,	// Index 77
+	0x1955,	// Index 78
+	0x19A5,	// Index 79
+	0x19FA,	// Index 80
+	0x1A4F,	// Index 81
+	0x1AA4,	// Index 82
+	0x1AE0,	// Index 83
+	0x1B2B,	// Index 84
+	0x1B67,	// Index 85
+	0x1BB7,	// Index 86
+	0x1C16,	// Index 87
+	0x1C9D,	// Index 88
+	0x1CFC,	// Index 89
+	0x1D5B,	// Index 90
+	0x1DA6,	// Index 91
+	0x1DF6,	// Index 92
+	0x1E05,	// Index 93
+	0x1E55,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Verdana26_widths[] = 
+{
+	0x4,	// Index 0
+	0x3,	// Index 1
+	0xA,	// Index 2
+	0x16,	// Index 3
+	0x11,	// Index 4
+	0x21,	// Index 5
+	0x18,	// Index 6
+	0x3,	// Index 7
+	0xA,	// Index 8
+	0xA,	// Index 9
+	0x10,	// Index 10
+	0x15,	// Index 11
+	0x7,	// Index 12
+	0xB,	// Index 13
+	0x4,	// Index 14
+	0xF,	// Index 15
+	0x12,	// Index 16
+	0xD,	// Index 17
+	0x11,	// Index 18
+	0x10,	// Index 19
+	0x13,	// Index 20
+	0x11,	// Index 21
+	0x12,	// Index 22
+	0x11,	// Index 23
+	0x12,	// Index 24
+	0x12,	// Index 25
+	0x4,	// Index 26
+	0x7,	// Index 27
+	0x14,	// Index 28
+	0x14,	// Index 29
+	0x14,	// Index 30
+	0xE,	// Index 31
+	0x1D,	// Index 32
+	0x18,	// Index 33
+	0x14,	// Index 34
+	0x15,	// Index 35
+	0x16,	// Index 36
+	0x11,	// Index 37
+	0x11,	// Index 38
+	0x16,	// Index 39
+	0x14,	// Index 40
+	0x9,	// Index 41
+	0xC,	// Index 42
+	0x15,	// Index 43
+	0x10,	// Index 44
+	0x18,	// Index 45
+	0x14,	// Index 46
+	0x18,	// Index 47
+	0x11,	// Index 48
+	0x19,	// Index 49
+	0x15,	// Index 50
+	0x14,	// Index 51
+	0x15,	// Index 52
+	0x14,	// Index 53
+	0x18,	// Index 54
+	0x1F,	// Index 55
+	0x16,	// Index 56
+	0x15,	// Index 57
+	0x14,	// Index 58
+	0x9,	// Index 59
+	0xF,	// Index 60
+	0x9,	// Index 61
+	0x16,	// Index 62
+	0x16,	// Index 63
+	0x7,	// Index 64
+	0x10,	// Index 65
+	0x11,	// Index 66
+	0xF,	// Index 67
+	0x11,	// Index 68
+	0x11,	// Index 69
+	0xC,	// Index 70
+	0x11,	// Index 71
+	0x10,	// Index 72
+	0x3,	// Index 73
+	0xA,	// Index 74
+	0x11,	// Index 75
+	0x3,	// Index 76
+	0x1B,	// Index 77
+	0x10,	// Index 78
+	0x11,	// Index 79
+	0x11,	// Index 80
+	0x11,	// Index 81
+	0xC,	// Index 82
+	0xF,	// Index 83
+	0xC,	// Index 84
+	0x10,	// Index 85
+	0x13,	// Index 86
+	0x1B,	// Index 87
+	0x13,	// Index 88
+	0x13,	// Index 89
+	0xF,	// Index 90
+	0x10,	// Index 91
+	0x3,	// Index 92
+	0x10,	// Index 93
+	0x16,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Verdana26_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x19, 0x0,	// Index 1
+	0x1B, 0x0,	// Index 2
+	0x19, 0x0,	// Index 3
+	0x1B, 0x6,	// Index 4
+	0x1A, 0x0,	// Index 5
+	0x1A, 0x0,	// Index 6
+	0x1B, 0x0,	// Index 7
+	0x1B, 0x7,	// Index 8
+	0x1B, 0x7,	// Index 9
+	0x1B, 0x0,	// Index 10
+	0x16, 0x0,	// Index 11
+	0x5, 0x6,	// Index 12
+	0xD, 0x0,	// Index 13
+	0x5, 0x0,	// Index 14
+	0x1B, 0x5,	// Index 15
+	0x1A, 0x0,	// Index 16
+	0x19, 0x0,	// Index 17
+	0x1A, 0x0,	// Index 18
+	0x1A, 0x0,	// Index 19
+	0x19, 0x0,	// Index 20
+	0x1A, 0x0,	// Index 21
+	0x1A, 0x0,	// Index 22
+	0x19, 0x0,	// Index 23
+	0x1A, 0x0,	// Index 24
+	0x1A, 0x0,	// Index 25
+	0x13, 0x0,	// Index 26
+	0x13, 0x6,	// Index 27
+	0x15, 0x0,	// Index 28
+	0x10, 0x0,	// Index 29
+	0x15, 0x0,	// Index 30
+	0x1A, 0x0,	// Index 31
+	0x1A, 0x4,	// Index 32
+	0x19, 0x0,	// Index 33
+	0x19, 0x0,	// Index 34
+	0x1A, 0x0,	// Index 35
+	0x19, 0x0,	// Index 36
+	0x19, 0x0,	// Index 37
+	0x19, 0x0,	// Index 38
+	0x1A, 0x0,	// Index 39
+	0x19, 0x0,	// Index 40
+	0x19, 0x0,	// Index 41
+	0x19, 0x0,	// Index 42
+	0x19, 0x0,	// Index 43
+	0x19, 0x0,	// Index 44
+	0x19, 0x0,	// Index 45
+	0x19, 0x0,	// Index 46
+	0x1A, 0x0,	// Index 47
+	0x19, 0x0,	// Index 48
+	0x1A, 0x7,	// Index 49
+	0x19, 0x0,	// Index 50
+	0x1A, 0x0,	// Index 51
+	0x19, 0x0,	// Index 52
+	0x19, 0x0,	// Index 53
+	0x19, 0x0,	// Index 54
+	0x19, 0x0,	// Index 55
+	0x19, 0x0,	// Index 56
+	0x19, 0x0,	// Index 57
+	0x19, 0x0,	// Index 58
+	0x1B, 0x7,	// Index 59
+	0x1B, 0x5,	// Index 60
+	0x1B, 0x7,	// Index 61
+	0x19, 0x0,	// Index 62
+	0x0, 0x5,	// Index 63
+	0x1C, 0x0,	// Index 64
+	0x14, 0x0,	// Index 65
+	0x1B, 0x0,	// Index 66
+	0x14, 0x0,	// Index 67
+	0x1B, 0x0,	// Index 68
+	0x14, 0x0,	// Index 69
+	0x1B, 0x0,	// Index 70
+	0x14, 0x7,	// Index 71
+	0x1B, 0x0,	// Index 72
+	0x19, 0x0,	// Index 73
+	0x19, 0x7,	// Index 74
+	0x1B, 0x0,	// Index 75
+	0x1B, 0x0,	// Index 76
+	0x14, 0x0,	// Index 77
+	0x14, 0x0,	// Index 78
+	0x14, 0x0,	// Index 79
+	0x14, 0x7,	// Index 80
+	0x14, 0x7,	// Index 81
+	0x13, 0x0,	// Index 82
+	0x14, 0x0,	// Index 83
+	0x18, 0x0,	// Index 84
+	0x13, 0x0,	// Index 85
+	0x13, 0x0,	// Index 86
+	0x13, 0x0,	// Index 87
+	0x13, 0x0,	// Index 88
+	0x13, 0x7,	// Index 89
+	0x13, 0x0,	// Index 90
+	0x1B, 0x7,	// Index 91
+	0x1B, 0x7,	// Index 92
+	0x1B, 0x7,	// Index 93
+	0x10, 0x0,	// Index 94
+};
+
+const font_t Verdana26 = 
+{
+	Verdana26_bitmaps,
+	Verdana26_offsets,
+	Verdana26_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x23,	// Height 
+	0,	// Flags 
+	Verdana26_extents,
+	0x1C	// Ascent 
 };
+
 //---------------------------------------------------------------
 // Group Name: Verdana32
 // Designer: Imported System Font
@@ -2855,395 +4320,603 @@ const unsigned char Verdana26[] =
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Verdana32[] = 
+const unsigned char Verdana32_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x2C,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xDC, // Index 1 (offset: 220)
-	0x0, 0xF5, // Index 2 (offset: 245)
-	0x1, 0x44, // Index 3 (offset: 324)
-	0x1, 0xE7, // Index 4 (offset: 487)
-	0x2, 0x60, // Index 5 (offset: 608)
-	0x3, 0x51, // Index 6 (offset: 849)
-	0x4, 0x6, // Index 7 (offset: 1030)
-	0x4, 0x25, // Index 8 (offset: 1061)
-	0x4, 0x74, // Index 9 (offset: 1140)
-	0x4, 0xC3, // Index 10 (offset: 1219)
-	0x5, 0x42, // Index 11 (offset: 1346)
-	0x5, 0xD9, // Index 12 (offset: 1497)
-	0x6, 0x10, // Index 13 (offset: 1552)
-	0x6, 0x5F, // Index 14 (offset: 1631)
-	0x6, 0x7E, // Index 15 (offset: 1662)
-	0x6, 0xF1, // Index 16 (offset: 1777)
-	0x7, 0x70, // Index 17 (offset: 1904)
-	0x7, 0xD1, // Index 18 (offset: 2001)
-	0x8, 0x50, // Index 19 (offset: 2128)
-	0x8, 0xC9, // Index 20 (offset: 2249)
-	0x9, 0x5A, // Index 21 (offset: 2394)
-	0x9, 0xD3, // Index 22 (offset: 2515)
-	0xA, 0x58, // Index 23 (offset: 2648)
-	0xA, 0xD7, // Index 24 (offset: 2775)
-	0xB, 0x56, // Index 25 (offset: 2902)
-	0xB, 0xDB, // Index 26 (offset: 3035)
-	0xB, 0xFA, // Index 27 (offset: 3066)
-	0xC, 0x31, // Index 28 (offset: 3121)
-	0xC, 0xC2, // Index 29 (offset: 3266)
-	0xD, 0x59, // Index 30 (offset: 3417)
-	0xD, 0xEA, // Index 31 (offset: 3562)
-	0xE, 0x57, // Index 32 (offset: 3671)
-	0xF, 0x30, // Index 33 (offset: 3888)
-	0xF, 0xD3, // Index 34 (offset: 4051)
-	0x10, 0x5E, // Index 35 (offset: 4190)
-	0x10, 0xFB, // Index 36 (offset: 4347)
-	0x11, 0x98, // Index 37 (offset: 4504)
-	0x12, 0x17, // Index 38 (offset: 4631)
-	0x12, 0x90, // Index 39 (offset: 4752)
-	0x13, 0x39, // Index 40 (offset: 4921)
-	0x13, 0xCA, // Index 41 (offset: 5066)
-	0x14, 0x13, // Index 42 (offset: 5139)
-	0x14, 0x6E, // Index 43 (offset: 5230)
-	0x15, 0x5, // Index 44 (offset: 5381)
-	0x15, 0x7E, // Index 45 (offset: 5502)
-	0x16, 0x27, // Index 46 (offset: 5671)
-	0x16, 0xB8, // Index 47 (offset: 5816)
-	0x17, 0x6D, // Index 48 (offset: 5997)
-	0x17, 0xEC, // Index 49 (offset: 6124)
-	0x18, 0xA7, // Index 50 (offset: 6311)
-	0x19, 0x44, // Index 51 (offset: 6468)
-	0x19, 0xCF, // Index 52 (offset: 6607)
-	0x1A, 0x6C, // Index 53 (offset: 6764)
-	0x1A, 0xF7, // Index 54 (offset: 6903)
-	0x1B, 0x9A, // Index 55 (offset: 7066)
-	0x1C, 0x85, // Index 56 (offset: 7301)
-	0x1D, 0x28, // Index 57 (offset: 7464)
-	0x1D, 0xC5, // Index 58 (offset: 7621)
-	0x1E, 0x56, // Index 59 (offset: 7766)
-	0x1E, 0x99, // Index 60 (offset: 7833)
-	0x1F, 0xC, // Index 61 (offset: 7948)
-	0x1F, 0x4F, // Index 62 (offset: 8015)
-	0x1F, 0xF2, // Index 63 (offset: 8178)
-	0x20, 0x95, // Index 64 (offset: 8341)
-	0x20, 0xCC, // Index 65 (offset: 8396)
-	0x21, 0x45, // Index 66 (offset: 8517)
-	0x21, 0xC4, // Index 67 (offset: 8644)
-	0x22, 0x37, // Index 68 (offset: 8759)
-	0x22, 0xB6, // Index 69 (offset: 8886)
-	0x23, 0x3B, // Index 70 (offset: 9019)
-	0x23, 0x96, // Index 71 (offset: 9110)
-	0x24, 0x15, // Index 72 (offset: 9237)
-	0x24, 0x88, // Index 73 (offset: 9352)
-	0x24, 0xA1, // Index 74 (offset: 9377)
-	0x24, 0xEA, // Index 75 (offset: 9450)
-	0x25, 0x69, // Index 76 (offset: 9577)
-	0x25, 0x82, // Index 77 (offset: 9602)
-	0x26, 0x4F, // Index 78 (offset: 9807)
-	0x26, 0xC2, // Index 79 (offset: 9922)
-	0x27, 0x47, // Index 80 (offset: 10055)
-	0x27, 0xC6, // Index 81 (offset: 10182)
-	0x28, 0x45, // Index 82 (offset: 10309)
-	0x28, 0x9A, // Index 83 (offset: 10394)
-	0x29, 0x7, // Index 84 (offset: 10503)
-	0x29, 0x62, // Index 85 (offset: 10594)
-	0x29, 0xD5, // Index 86 (offset: 10709)
-	0x2A, 0x60, // Index 87 (offset: 10848)
-	0x2B, 0x1B, // Index 88 (offset: 11035)
-	0x2B, 0xA6, // Index 89 (offset: 11174)
-	0x2C, 0x31, // Index 90 (offset: 11313)
-	0x2C, 0xA4, // Index 91 (offset: 11428)
-	0x2D, 0x1D, // Index 92 (offset: 11549)
-	0x2D, 0x36, // Index 93 (offset: 11574)
-	0x2D, 0xAF, // Index 94 (offset: 11695)
-
 	/* Index 0, character 32 " " (width: 4 pixels) */
-	0x4, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 4 pixels) */
-	0x4, 0xF0,0xFF,0xFF,0x83,0x07,0x00,0xF0,0xFF,0xFF,0x83,0x07,0x00,0xF0,0xFF,0xFF,0x83,0x07,0x00,0xF0,0xFF,0xFF,0x83,0x07,0x00,
+	0xF0,0xFF,0xFF,0x83,0x07,0x00,0xF0,0xFF,0xFF,0x83,0x07,0x00,0xF0,0xFF,0xFF,0x83,0x07,0x00,0xF0,0xFF,0xFF,0x83,0x07,0x00,
 
 	/* Index 2, character 34 """ (width: 13 pixels) */
-	0xD, 0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,
+	0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 27 pixels) */
-	0x1B, 0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x06,0x00,0x00,0xE0,0x80,0xE3,0x07,0x00,0x00,0xE0,0x80,0xFF,0x01,0x00,0x00,0xE0,0xE0,0x1F,0x00,0x00,0x00,0xE0,0xFC,0x03,0x00,0x00,0x00,0xE0,0x9F,0x03,0x00,0x00,0x00,0xFC,0x83,0x03,0x00,0x00,0xC0,0xFF,0x80,0x03,0x00,0x00,0xF0,0xE3,0x80,0x03,0x00,0x00,0x30,0xE0,0x80,0x03,0x06,0x00,0x00,0xE0,0x80,0xE3,0x07,0x00,0x00,0xE0,0x80,0xFF,0x01,0x00,0x00,0xE0,0xE0,0x1F,0x00,0x00,0x00,0xE0,0xFE,0x03,0x00,0x00,0x00,0xE0,0x9F,0x03,0x00,0x00,0x00,0xFC,0x83,0x03,0x00,0x00,0xC0,0xFF,0x80,0x03,0x00,0x00,0xF0,0xE3,0x80,0x03,0x00,0x00,0x30,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x06,0x00,0x00,0xE0,0x80,0xE3,0x07,0x00,0x00,0xE0,0x80,0xFF,0x01,0x00,0x00,0xE0,0xE0,0x1F,0x00,0x00,0x00,0xE0,0xFC,0x03,0x00,0x00,0x00,0xE0,0x9F,0x03,0x00,0x00,0x00,0xFC,0x83,0x03,0x00,0x00,0xC0,0xFF,0x80,0x03,0x00,0x00,0xF0,0xE3,0x80,0x03,0x00,0x00,0x30,0xE0,0x80,0x03,0x06,0x00,0x00,0xE0,0x80,0xE3,0x07,0x00,0x00,0xE0,0x80,0xFF,0x01,0x00,0x00,0xE0,0xE0,0x1F,0x00,0x00,0x00,0xE0,0xFE,0x03,0x00,0x00,0x00,0xE0,0x9F,0x03,0x00,0x00,0x00,0xFC,0x83,0x03,0x00,0x00,0xC0,0xFF,0x80,0x03,0x00,0x00,0xF0,0xE3,0x80,0x03,0x00,0x00,0x30,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,
 
 	/* Index 4, character 36 "$" (width: 20 pixels) */
-	0x14, 0x00,0xE0,0x03,0xE0,0x01,0x00,0x00,0xF8,0x0F,0xC0,0x03,0x00,0x00,0xFC,0x1F,0xC0,0x03,0x00,0x00,0xFC,0x1F,0xC0,0x03,0x00,0x00,0x3E,0x3E,0xC0,0x07,0x00,0x00,0x1E,0x3C,0x80,0x07,0x00,0x00,0x0F,0x38,0x80,0x07,0x00,0x00,0x0F,0x78,0x80,0x07,0x00,0x00,0x0F,0x78,0x80,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0x00,0x0F,0x70,0x80,0x07,0x00,0x00,0x0F,0xF0,0x80,0x07,0x00,0x00,0x0F,0xF0,0x80,0x03,0x00,0x00,0x0F,0xE0,0xC1,0x03,0x00,0x00,0x1E,0xE0,0xE3,0x03,0x00,0x00,0x1E,0xE0,0xFF,0x01,0x00,0x00,0x1E,0xC0,0xFF,0x00,0x00,0x00,0x3E,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,
+	0x00,0xE0,0x03,0xE0,0x01,0x00,0x00,0xF8,0x0F,0xC0,0x03,0x00,0x00,0xFC,0x1F,0xC0,0x03,0x00,0x00,0xFC,0x1F,0xC0,0x03,0x00,0x00,0x3E,0x3E,0xC0,0x07,0x00,0x00,0x1E,0x3C,0x80,0x07,0x00,0x00,0x0F,0x38,0x80,0x07,0x00,0x00,0x0F,0x78,0x80,0x07,0x00,0x00,0x0F,0x78,0x80,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0x00,0x0F,0x70,0x80,0x07,0x00,0x00,0x0F,0xF0,0x80,0x07,0x00,0x00,0x0F,0xF0,0x80,0x03,0x00,0x00,0x0F,0xE0,0xC1,0x03,0x00,0x00,0x1E,0xE0,0xE3,0x03,0x00,0x00,0x1E,0xE0,0xFF,0x01,0x00,0x00,0x1E,0xC0,0xFF,0x00,0x00,0x00,0x3E,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,
 
 	/* Index 5, character 37 "%" (width: 40 pixels) */
-	0x28, 0x00,0xFF,0x01,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xF0,0x01,0x1F,0x00,0x00,0x00,0x70,0x00,0x3C,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x78,0x00,0x3C,0x00,0x04,0x00,0xF0,0x01,0x1F,0x00,0x07,0x00,0xE0,0xFF,0x0F,0xC0,0x07,0x00,0xC0,0xFF,0x07,0xF0,0x07,0x00,0x00,0xFF,0x01,0xF8,0x01,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0xC0,0x0F,0xC0,0x7F,0x00,0x00,0xF0,0x07,0xF0,0xFF,0x01,0x00,0xF0,0x01,0xF8,0xFF,0x03,0x00,0x70,0x00,0x7C,0xC0,0x07,0x00,0x10,0x00,0x1E,0x00,0x0F,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x1E,0x00,0x07,0x00,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,
+	0x00,0xFF,0x01,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xF0,0x01,0x1F,0x00,0x00,0x00,0x70,0x00,0x3C,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x78,0x00,0x3C,0x00,0x04,0x00,0xF0,0x01,0x1F,0x00,0x07,0x00,0xE0,0xFF,0x0F,0xC0,0x07,0x00,0xC0,0xFF,0x07,0xF0,0x07,0x00,0x00,0xFF,0x01,0xF8,0x01,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0xC0,0x0F,0xC0,0x7F,0x00,0x00,0xF0,0x07,0xF0,0xFF,0x01,0x00,0xF0,0x01,0xF8,0xFF,0x03,0x00,0x70,0x00,0x7C,0xC0,0x07,0x00,0x10,0x00,0x1E,0x00,0x0F,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x1E,0x00,0x07,0x00,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,
 
 	/* Index 6, character 38 "&" (width: 30 pixels) */
-	0x1E, 0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x1F,0xF0,0xFF,0x01,0x00,0xC0,0x7F,0xF8,0xFF,0x03,0x00,0xE0,0xFF,0x78,0xF0,0x07,0x00,0xF0,0xFF,0x1D,0xC0,0x07,0x00,0xF0,0xF0,0x0F,0x80,0x07,0x00,0x78,0xC0,0x07,0x80,0x0F,0x00,0x38,0x80,0x07,0x00,0x0F,0x00,0x38,0x80,0x07,0x00,0x0F,0x00,0x38,0x00,0x0F,0x00,0x0F,0x00,0x38,0x00,0x1F,0x00,0x0F,0x00,0x38,0x80,0x3F,0x00,0x0F,0x00,0x78,0xC0,0x7D,0x00,0x0F,0x00,0xF0,0xE0,0xF9,0x80,0x07,0x00,0xF0,0xFF,0xF0,0x81,0x07,0x00,0xE0,0x7F,0xE0,0xC3,0x03,0x00,0xC0,0x3F,0xC0,0xC7,0x03,0x00,0x80,0x1F,0x80,0xFF,0x01,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xF3,0x01,0x00,0x00,0x00,0x3F,0xE0,0x03,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+	0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x1F,0xF0,0xFF,0x01,0x00,0xC0,0x7F,0xF8,0xFF,0x03,0x00,0xE0,0xFF,0x78,0xF0,0x07,0x00,0xF0,0xFF,0x1D,0xC0,0x07,0x00,0xF0,0xF0,0x0F,0x80,0x07,0x00,0x78,0xC0,0x07,0x80,0x0F,0x00,0x38,0x80,0x07,0x00,0x0F,0x00,0x38,0x80,0x07,0x00,0x0F,0x00,0x38,0x00,0x0F,0x00,0x0F,0x00,0x38,0x00,0x1F,0x00,0x0F,0x00,0x38,0x80,0x3F,0x00,0x0F,0x00,0x78,0xC0,0x7D,0x00,0x0F,0x00,0xF0,0xE0,0xF9,0x80,0x07,0x00,0xF0,0xFF,0xF0,0x81,0x07,0x00,0xE0,0x7F,0xE0,0xC3,0x03,0x00,0xC0,0x3F,0xC0,0xC7,0x03,0x00,0x80,0x1F,0x80,0xFF,0x01,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xF3,0x01,0x00,0x00,0x00,0x3F,0xE0,0x03,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
 
 	/* Index 7, character 39 "'" (width: 5 pixels) */
-	0x5, 0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,
+	0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 8, character 40 "(" (width: 13 pixels) */
-	0xD, 0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0xF8,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x80,0xFF,0x03,0xF0,0x7F,0x00,0xE0,0x3F,0x00,0x00,0xFF,0x01,0xF0,0x07,0x00,0x00,0xF8,0x03,0xF8,0x01,0x00,0x00,0xE0,0x07,0xFC,0x00,0x00,0x00,0xC0,0x0F,0x3C,0x00,0x00,0x00,0x00,0x0F,0x1C,0x00,0x00,0x00,0x00,0x0E,0x0C,0x00,0x00,0x00,0x00,0x0C,0x04,0x00,0x00,0x00,0x00,0x08,
+	0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0xF8,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x80,0xFF,0x03,0xF0,0x7F,0x00,0xE0,0x3F,0x00,0x00,0xFF,0x01,0xF0,0x07,0x00,0x00,0xF8,0x03,0xF8,0x01,0x00,0x00,0xE0,0x07,0xFC,0x00,0x00,0x00,0xC0,0x0F,0x3C,0x00,0x00,0x00,0x00,0x0F,0x1C,0x00,0x00,0x00,0x00,0x0E,0x0C,0x00,0x00,0x00,0x00,0x0C,0x04,0x00,0x00,0x00,0x00,0x08,
 
 	/* Index 9, character 41 ")" (width: 13 pixels) */
-	0xD, 0x04,0x00,0x00,0x00,0x00,0x08,0x0C,0x00,0x00,0x00,0x00,0x0C,0x1C,0x00,0x00,0x00,0x00,0x0E,0x3C,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0xC0,0x0F,0xF8,0x01,0x00,0x00,0xE0,0x07,0xF0,0x07,0x00,0x00,0xF8,0x03,0xE0,0x3F,0x00,0x00,0xFF,0x01,0x80,0xFF,0x03,0xF0,0x7F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,
+	0x04,0x00,0x00,0x00,0x00,0x08,0x0C,0x00,0x00,0x00,0x00,0x0C,0x1C,0x00,0x00,0x00,0x00,0x0E,0x3C,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0xC0,0x0F,0xF8,0x01,0x00,0x00,0xE0,0x07,0xF0,0x07,0x00,0x00,0xF8,0x03,0xE0,0x3F,0x00,0x00,0xFF,0x01,0x80,0xFF,0x03,0xF0,0x7F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,
 
 	/* Index 10, character 42 "*" (width: 21 pixels) */
-	0x15, 0xC0,0x80,0x01,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xC0,0x80,0x01,0x00,0x00,0x00,
+	0xC0,0x80,0x01,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x00,0xC0,0x80,0x01,0x00,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 25 pixels) */
-	0x19, 0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,
+	0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,
 
 	/* Index 12, character 44 "," (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x20,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x20,0x00,0x00,
 
 	/* Index 13, character 45 "-" (width: 13 pixels) */
-	0xD, 0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,
+	0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,
 
 	/* Index 14, character 46 "." (width: 5 pixels) */
-	0x5, 0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,
+	0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,
 
 	/* Index 15, character 47 "/" (width: 19 pixels) */
-	0x13, 0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 16, character 48 "0" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x80,0xFF,0xFF,0xFF,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0x01,0x00,0xE0,0x1F,0x00,0xF8,0x03,0x00,0xF0,0x03,0x00,0xE0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x03,0x00,0xE0,0x07,0x00,0xE0,0x1F,0x00,0xFC,0x03,0x00,0xC0,0xFF,0xFF,0xFF,0x01,0x00,0x80,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,
+	0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x80,0xFF,0xFF,0xFF,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0x01,0x00,0xE0,0x1F,0x00,0xF8,0x03,0x00,0xF0,0x03,0x00,0xE0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x03,0x00,0xE0,0x07,0x00,0xE0,0x1F,0x00,0xFC,0x03,0x00,0xC0,0xFF,0xFF,0xFF,0x01,0x00,0x80,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,
 
 	/* Index 17, character 49 "1" (width: 16 pixels) */
-	0x10, 0x00,0x0F,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0x80,0x0F,0x00,0x80,0x07,0x00,0x80,0x0F,0x00,0x80,0x07,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,
+	0x00,0x0F,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0x80,0x0F,0x00,0x80,0x07,0x00,0x80,0x0F,0x00,0x80,0x07,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,
 
 	/* Index 18, character 50 "2" (width: 21 pixels) */
-	0x15, 0x00,0x00,0x00,0xC0,0x07,0x00,0xE0,0x01,0x00,0xE0,0x07,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xF8,0x07,0x00,0xF0,0x00,0x00,0xF8,0x07,0x00,0xF8,0x00,0x00,0xBC,0x07,0x00,0x78,0x00,0x00,0x9E,0x07,0x00,0x78,0x00,0x00,0x8F,0x07,0x00,0x78,0x00,0x80,0x8F,0x07,0x00,0x78,0x00,0xC0,0x87,0x07,0x00,0x78,0x00,0xE0,0x83,0x07,0x00,0x78,0x00,0xF0,0x81,0x07,0x00,0x78,0x00,0xF8,0x80,0x07,0x00,0xF8,0x00,0x7C,0x80,0x07,0x00,0xF0,0x00,0x3E,0x80,0x07,0x00,0xF0,0x83,0x1F,0x80,0x07,0x00,0xE0,0xFF,0x0F,0x80,0x07,0x00,0xE0,0xFF,0x07,0x80,0x07,0x00,0x80,0xFF,0x01,0x80,0x07,0x00,0x00,0x7F,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,
+	0x00,0x00,0x00,0xC0,0x07,0x00,0xE0,0x01,0x00,0xE0,0x07,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xF8,0x07,0x00,0xF0,0x00,0x00,0xF8,0x07,0x00,0xF8,0x00,0x00,0xBC,0x07,0x00,0x78,0x00,0x00,0x9E,0x07,0x00,0x78,0x00,0x00,0x8F,0x07,0x00,0x78,0x00,0x80,0x8F,0x07,0x00,0x78,0x00,0xC0,0x87,0x07,0x00,0x78,0x00,0xE0,0x83,0x07,0x00,0x78,0x00,0xF0,0x81,0x07,0x00,0x78,0x00,0xF8,0x80,0x07,0x00,0xF8,0x00,0x7C,0x80,0x07,0x00,0xF0,0x00,0x3E,0x80,0x07,0x00,0xF0,0x83,0x1F,0x80,0x07,0x00,0xE0,0xFF,0x0F,0x80,0x07,0x00,0xE0,0xFF,0x07,0x80,0x07,0x00,0x80,0xFF,0x01,0x80,0x07,0x00,0x00,0x7F,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,
 
 	/* Index 19, character 51 "3" (width: 20 pixels) */
-	0x14, 0x00,0x00,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0xF8,0x80,0x0F,0x80,0x0F,0x00,0xF0,0x80,0x1D,0x80,0x07,0x00,0xF0,0xE1,0x3D,0xC0,0x07,0x00,0xF0,0xFF,0x79,0xF0,0x03,0x00,0xE0,0xFF,0xF8,0xFF,0x03,0x00,0xC0,0x7F,0xF0,0xFF,0x01,0x00,0x00,0x1F,0xE0,0x7F,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,
+	0x00,0x00,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0xF8,0x80,0x0F,0x80,0x0F,0x00,0xF0,0x80,0x1D,0x80,0x07,0x00,0xF0,0xE1,0x3D,0xC0,0x07,0x00,0xF0,0xFF,0x79,0xF0,0x03,0x00,0xE0,0xFF,0xF8,0xFF,0x03,0x00,0xC0,0x7F,0xF0,0xFF,0x01,0x00,0x00,0x1F,0xE0,0x7F,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,
 
 	/* Index 20, character 52 "4" (width: 24 pixels) */
-	0x18, 0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x80,0xDF,0x03,0x00,0x00,0x00,0xC0,0xCF,0x03,0x00,0x00,0x00,0xE0,0xC7,0x03,0x00,0x00,0x00,0xF0,0xC3,0x03,0x00,0x00,0x00,0xFC,0xC1,0x03,0x00,0x00,0x00,0x7E,0xC0,0x03,0x00,0x00,0x00,0x3F,0xC0,0x03,0x00,0x00,0x80,0x1F,0xC0,0x03,0x00,0x00,0xC0,0x0F,0xC0,0x03,0x00,0x00,0xE0,0x07,0xC0,0x03,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,
+	0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x80,0xDF,0x03,0x00,0x00,0x00,0xC0,0xCF,0x03,0x00,0x00,0x00,0xE0,0xC7,0x03,0x00,0x00,0x00,0xF0,0xC3,0x03,0x00,0x00,0x00,0xFC,0xC1,0x03,0x00,0x00,0x00,0x7E,0xC0,0x03,0x00,0x00,0x00,0x3F,0xC0,0x03,0x00,0x00,0x80,0x1F,0xC0,0x03,0x00,0x00,0xC0,0x0F,0xC0,0x03,0x00,0x00,0xE0,0x07,0xC0,0x03,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,
 
 	/* Index 21, character 53 "5" (width: 20 pixels) */
-	0x14, 0x00,0x00,0x00,0xC0,0x03,0x00,0xF8,0xFF,0x0F,0x80,0x07,0x00,0xF8,0xFF,0x0F,0x80,0x07,0x00,0xF8,0xFF,0x07,0x80,0x07,0x00,0xF8,0xFF,0x07,0x80,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x0F,0x80,0x0F,0x00,0x78,0x00,0x0F,0x80,0x07,0x00,0x78,0x00,0x1F,0xC0,0x07,0x00,0x78,0x00,0x3F,0xF0,0x03,0x00,0x78,0x00,0xFE,0xFF,0x01,0x00,0x78,0x00,0xFC,0xFF,0x00,0x00,0x78,0x00,0xF8,0x7F,0x00,0x00,0x78,0x00,0xE0,0x0F,0x00,0x00,
+	0x00,0x00,0x00,0xC0,0x03,0x00,0xF8,0xFF,0x0F,0x80,0x07,0x00,0xF8,0xFF,0x0F,0x80,0x07,0x00,0xF8,0xFF,0x07,0x80,0x07,0x00,0xF8,0xFF,0x07,0x80,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x0F,0x80,0x0F,0x00,0x78,0x00,0x0F,0x80,0x07,0x00,0x78,0x00,0x1F,0xC0,0x07,0x00,0x78,0x00,0x3F,0xF0,0x03,0x00,0x78,0x00,0xFE,0xFF,0x01,0x00,0x78,0x00,0xFC,0xFF,0x00,0x00,0x78,0x00,0xF8,0x7F,0x00,0x00,0x78,0x00,0xE0,0x0F,0x00,0x00,
 
 	/* Index 22, character 54 "6" (width: 22 pixels) */
-	0x16, 0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xF0,0xFF,0x3F,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x01,0x00,0x80,0x7F,0x0E,0xF8,0x03,0x00,0xC0,0x0F,0x0F,0xE0,0x07,0x00,0xE0,0x07,0x0F,0xC0,0x07,0x00,0xE0,0x03,0x07,0x80,0x07,0x00,0xF0,0x81,0x07,0x80,0x0F,0x00,0xF0,0x80,0x07,0x00,0x0F,0x00,0xF0,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x0F,0x80,0x0F,0x00,0x78,0x80,0x0F,0x80,0x07,0x00,0x78,0x00,0x1F,0xC0,0x07,0x00,0x78,0x00,0x3F,0xF0,0x03,0x00,0xF8,0x00,0xFE,0xFF,0x01,0x00,0x00,0x00,0xFC,0xFF,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,
+	0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xF0,0xFF,0x3F,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x01,0x00,0x80,0x7F,0x0E,0xF8,0x03,0x00,0xC0,0x0F,0x0F,0xE0,0x07,0x00,0xE0,0x07,0x0F,0xC0,0x07,0x00,0xE0,0x03,0x07,0x80,0x07,0x00,0xF0,0x81,0x07,0x80,0x0F,0x00,0xF0,0x80,0x07,0x00,0x0F,0x00,0xF0,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x07,0x00,0x0F,0x00,0x78,0x80,0x0F,0x80,0x0F,0x00,0x78,0x80,0x0F,0x80,0x07,0x00,0x78,0x00,0x1F,0xC0,0x07,0x00,0x78,0x00,0x3F,0xF0,0x03,0x00,0xF8,0x00,0xFE,0xFF,0x01,0x00,0x00,0x00,0xFC,0xFF,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,
 
 	/* Index 23, character 55 "7" (width: 21 pixels) */
-	0x15, 0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x04,0x00,0xF0,0x00,0x00,0x00,0x07,0x00,0xF0,0x00,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xF8,0x07,0x00,0xF0,0x00,0x00,0xFE,0x01,0x00,0xF0,0x00,0x80,0x7F,0x00,0x00,0xF0,0x00,0xE0,0x1F,0x00,0x00,0xF0,0x00,0xF8,0x07,0x00,0x00,0xF0,0x00,0xFE,0x01,0x00,0x00,0xF0,0x80,0x7F,0x00,0x00,0x00,0xF0,0xE0,0x3F,0x00,0x00,0x00,0xF0,0xF0,0x0F,0x00,0x00,0x00,0xF0,0xFC,0x03,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,
+	0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x04,0x00,0xF0,0x00,0x00,0x00,0x07,0x00,0xF0,0x00,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xF8,0x07,0x00,0xF0,0x00,0x00,0xFE,0x01,0x00,0xF0,0x00,0x80,0x7F,0x00,0x00,0xF0,0x00,0xE0,0x1F,0x00,0x00,0xF0,0x00,0xF8,0x07,0x00,0x00,0xF0,0x00,0xFE,0x01,0x00,0x00,0xF0,0x80,0x7F,0x00,0x00,0x00,0xF0,0xE0,0x3F,0x00,0x00,0x00,0xF0,0xF0,0x0F,0x00,0x00,0x00,0xF0,0xFC,0x03,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,
 
 	/* Index 24, character 56 "8" (width: 21 pixels) */
-	0x15, 0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0xC0,0xFF,0x00,0x00,0x80,0xFF,0xE0,0xFF,0x01,0x00,0xC0,0xFF,0xF1,0xFF,0x03,0x00,0xE0,0xFF,0x7B,0xF0,0x07,0x00,0xF0,0xE1,0x3F,0xC0,0x07,0x00,0xF0,0x80,0x0F,0x80,0x07,0x00,0xF8,0x80,0x0F,0x80,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0E,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0xF8,0x00,0x1E,0x00,0x0F,0x00,0xF0,0x00,0x3F,0x80,0x07,0x00,0xF0,0xC1,0x7B,0xC0,0x07,0x00,0xE0,0xFF,0xFB,0xE0,0x03,0x00,0xE0,0xFF,0xF1,0xFF,0x03,0x00,0xC0,0xFF,0xE0,0xFF,0x01,0x00,0x00,0x3F,0xC0,0xFF,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,
+	0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0xC0,0xFF,0x00,0x00,0x80,0xFF,0xE0,0xFF,0x01,0x00,0xC0,0xFF,0xF1,0xFF,0x03,0x00,0xE0,0xFF,0x7B,0xF0,0x07,0x00,0xF0,0xE1,0x3F,0xC0,0x07,0x00,0xF0,0x80,0x0F,0x80,0x07,0x00,0xF8,0x80,0x0F,0x80,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0F,0x00,0x0F,0x00,0x78,0x00,0x0E,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0xF8,0x00,0x1E,0x00,0x0F,0x00,0xF0,0x00,0x3F,0x80,0x07,0x00,0xF0,0xC1,0x7B,0xC0,0x07,0x00,0xE0,0xFF,0xFB,0xE0,0x03,0x00,0xE0,0xFF,0xF1,0xFF,0x03,0x00,0xC0,0xFF,0xE0,0xFF,0x01,0x00,0x00,0x3F,0xC0,0xFF,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,
 
 	/* Index 25, character 57 "9" (width: 22 pixels) */
-	0x16, 0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x80,0x0F,0x00,0xE0,0x07,0x7E,0x00,0x0F,0x00,0xF0,0x01,0x7C,0x00,0x0F,0x00,0xF0,0x00,0xF8,0x00,0x0F,0x00,0xF8,0x00,0xF8,0x00,0x0F,0x00,0x78,0x00,0xF0,0x00,0x0F,0x00,0x78,0x00,0xF0,0x00,0x0F,0x00,0x78,0x00,0xF0,0x00,0x0F,0x00,0x78,0x00,0xF0,0x80,0x07,0x00,0x78,0x00,0xF0,0x80,0x07,0x00,0x78,0x00,0xF0,0xC0,0x07,0x00,0xF0,0x00,0x70,0xC0,0x03,0x00,0xF0,0x01,0x78,0xF0,0x03,0x00,0xF0,0x03,0x78,0xF8,0x01,0x00,0xE0,0x0F,0x38,0xFF,0x00,0x00,0xC0,0xFF,0xFF,0x7F,0x00,0x00,0x80,0xFF,0xFF,0x1F,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,
+	0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x80,0x0F,0x00,0xE0,0x07,0x7E,0x00,0x0F,0x00,0xF0,0x01,0x7C,0x00,0x0F,0x00,0xF0,0x00,0xF8,0x00,0x0F,0x00,0xF8,0x00,0xF8,0x00,0x0F,0x00,0x78,0x00,0xF0,0x00,0x0F,0x00,0x78,0x00,0xF0,0x00,0x0F,0x00,0x78,0x00,0xF0,0x00,0x0F,0x00,0x78,0x00,0xF0,0x80,0x07,0x00,0x78,0x00,0xF0,0x80,0x07,0x00,0x78,0x00,0xF0,0xC0,0x07,0x00,0xF0,0x00,0x70,0xC0,0x03,0x00,0xF0,0x01,0x78,0xF0,0x03,0x00,0xF0,0x03,0x78,0xF8,0x01,0x00,0xE0,0x0F,0x38,0xFF,0x00,0x00,0xC0,0xFF,0xFF,0x7F,0x00,0x00,0x80,0xFF,0xFF,0x1F,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,
 
 	/* Index 26, character 58 ":" (width: 5 pixels) */
-	0x5, 0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,
+	0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,
 
 	/* Index 27, character 59 ";" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0xF0,0x03,0x00,0xFE,0x07,0x00,0xF0,0x03,0xC0,0xFF,0x03,0x00,0xF0,0x03,0xE0,0xFF,0x00,0x00,0xF0,0x03,0xE0,0x1F,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x20,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0xF0,0x03,0x00,0xFE,0x07,0x00,0xF0,0x03,0xC0,0xFF,0x03,0x00,0xF0,0x03,0xE0,0xFF,0x00,0x00,0xF0,0x03,0xE0,0x1F,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x20,0x00,0x00,
 
 	/* Index 28, character 60 "<" (width: 24 pixels) */
-	0x18, 0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xCE,0x01,0x00,0x00,0x00,0x00,0xCE,0x01,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x80,0x87,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0xC0,0x01,0x0E,0x00,0x00,0x00,0xC0,0x01,0x0E,0x00,0x00,0x00,0xE0,0x00,0x1C,0x00,0x00,0x00,0xE0,0x00,0x1C,0x00,0x00,0x00,0xF0,0x00,0x3C,0x00,0x00,0x00,0x70,0x00,0x38,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x00,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xC0,0x01,0x00,
+	0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xCE,0x01,0x00,0x00,0x00,0x00,0xCE,0x01,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x80,0x87,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0xC0,0x01,0x0E,0x00,0x00,0x00,0xC0,0x01,0x0E,0x00,0x00,0x00,0xE0,0x00,0x1C,0x00,0x00,0x00,0xE0,0x00,0x1C,0x00,0x00,0x00,0xF0,0x00,0x3C,0x00,0x00,0x00,0x70,0x00,0x38,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x00,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xC0,0x01,0x00,
 
 	/* Index 29, character 61 "=" (width: 25 pixels) */
-	0x19, 0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,
+	0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,
 
 	/* Index 30, character 62 ">" (width: 24 pixels) */
-	0x18, 0x00,0x0E,0x00,0xC0,0x01,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x38,0x00,0x00,0x00,0xF0,0x00,0x3C,0x00,0x00,0x00,0xE0,0x00,0x1C,0x00,0x00,0x00,0xE0,0x00,0x1C,0x00,0x00,0x00,0xC0,0x01,0x0E,0x00,0x00,0x00,0xC0,0x01,0x0E,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x87,0x07,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0xCE,0x01,0x00,0x00,0x00,0x00,0xCE,0x01,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,
+	0x00,0x0E,0x00,0xC0,0x01,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x00,0x00,0x70,0x00,0x38,0x00,0x00,0x00,0xF0,0x00,0x3C,0x00,0x00,0x00,0xE0,0x00,0x1C,0x00,0x00,0x00,0xE0,0x00,0x1C,0x00,0x00,0x00,0xC0,0x01,0x0E,0x00,0x00,0x00,0xC0,0x01,0x0E,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x03,0x07,0x00,0x00,0x00,0x80,0x87,0x07,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0xCE,0x01,0x00,0x00,0x00,0x00,0xCE,0x01,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,
 
 	/* Index 31, character 63 "?" (width: 18 pixels) */
-	0x12, 0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0xF0,0x87,0x07,0x00,0x78,0x00,0xF8,0x87,0x07,0x00,0x78,0x00,0xF8,0x87,0x07,0x00,0x78,0x00,0xFC,0x87,0x07,0x00,0x78,0x00,0x3C,0x00,0x00,0x00,0x78,0x00,0x1E,0x00,0x00,0x00,0xF8,0x00,0x0F,0x00,0x00,0x00,0xF0,0x80,0x0F,0x00,0x00,0x00,0xF0,0xC1,0x07,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,
+	0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0xF0,0x87,0x07,0x00,0x78,0x00,0xF8,0x87,0x07,0x00,0x78,0x00,0xF8,0x87,0x07,0x00,0x78,0x00,0xFC,0x87,0x07,0x00,0x78,0x00,0x3C,0x00,0x00,0x00,0x78,0x00,0x1E,0x00,0x00,0x00,0xF8,0x00,0x0F,0x00,0x00,0x00,0xF0,0x80,0x0F,0x00,0x00,0x00,0xF0,0xC1,0x07,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 36 pixels) */
-	0x24, 0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xFC,0x01,0xFC,0x01,0x00,0x00,0x7E,0x00,0xE0,0x03,0x00,0x00,0x1F,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0xC0,0x03,0x00,0x00,0x1E,0x00,0xC0,0x01,0x00,0x00,0x1C,0x00,0xE0,0x01,0xFC,0x03,0x38,0x00,0xE0,0x80,0xFF,0x1F,0x38,0x00,0xF0,0xC0,0xFF,0x3F,0x70,0x00,0x70,0xE0,0xFF,0x7F,0x70,0x00,0x70,0xF0,0x03,0x7C,0x70,0x00,0x38,0xF0,0x00,0xF0,0xE0,0x00,0x38,0x78,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0x70,0xE0,0x00,0x38,0x30,0x00,0x70,0xE0,0x00,0x38,0x70,0x00,0x38,0xE0,0x00,0x38,0xF8,0xFF,0x7F,0xE0,0x00,0x70,0xF8,0xFF,0xFF,0xE0,0x00,0x70,0xF8,0xFF,0xFF,0x70,0x00,0xF0,0xF8,0xFF,0xFF,0x70,0x00,0xE0,0x00,0x00,0xC0,0x00,0x00,0xE0,0x01,0x00,0xC0,0x00,0x00,0xC0,0x03,0x00,0xC0,0x00,0x00,0xC0,0x07,0x00,0xC0,0x00,0x00,0x80,0x0F,0x00,0xC0,0x00,0x00,0x00,0x3F,0x00,0xE0,0x00,0x00,0x00,0xFE,0x01,0xFC,0x00,0x00,0x00,0xF8,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,
+	0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xFC,0x01,0xFC,0x01,0x00,0x00,0x7E,0x00,0xE0,0x03,0x00,0x00,0x1F,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0xC0,0x03,0x00,0x00,0x1E,0x00,0xC0,0x01,0x00,0x00,0x1C,0x00,0xE0,0x01,0xFC,0x03,0x38,0x00,0xE0,0x80,0xFF,0x1F,0x38,0x00,0xF0,0xC0,0xFF,0x3F,0x70,0x00,0x70,0xE0,0xFF,0x7F,0x70,0x00,0x70,0xF0,0x03,0x7C,0x70,0x00,0x38,0xF0,0x00,0xF0,0xE0,0x00,0x38,0x78,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x38,0x38,0x00,0x70,0xE0,0x00,0x38,0x30,0x00,0x70,0xE0,0x00,0x38,0x70,0x00,0x38,0xE0,0x00,0x38,0xF8,0xFF,0x7F,0xE0,0x00,0x70,0xF8,0xFF,0xFF,0xE0,0x00,0x70,0xF8,0xFF,0xFF,0x70,0x00,0xF0,0xF8,0xFF,0xFF,0x70,0x00,0xE0,0x00,0x00,0xC0,0x00,0x00,0xE0,0x01,0x00,0xC0,0x00,0x00,0xC0,0x03,0x00,0xC0,0x00,0x00,0xC0,0x07,0x00,0xC0,0x00,0x00,0x80,0x0F,0x00,0xC0,0x00,0x00,0x00,0x3F,0x00,0xE0,0x00,0x00,0x00,0xFE,0x01,0xFC,0x00,0x00,0x00,0xF8,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,
 
 	/* Index 33, character 65 "A" (width: 27 pixels) */
-	0x1B, 0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0xF8,0xBF,0x07,0x00,0x00,0x00,0xFF,0x8F,0x07,0x00,0x00,0xE0,0xFF,0x81,0x07,0x00,0x00,0xF0,0x3F,0x80,0x07,0x00,0x00,0xF0,0x07,0x80,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF0,0x07,0x80,0x07,0x00,0x00,0xF0,0x3F,0x80,0x07,0x00,0x00,0xE0,0xFF,0x81,0x07,0x00,0x00,0x00,0xFF,0x8F,0x07,0x00,0x00,0x00,0xF8,0xBF,0x07,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+	0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0xF8,0xBF,0x07,0x00,0x00,0x00,0xFF,0x8F,0x07,0x00,0x00,0xE0,0xFF,0x81,0x07,0x00,0x00,0xF0,0x3F,0x80,0x07,0x00,0x00,0xF0,0x07,0x80,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF0,0x07,0x80,0x07,0x00,0x00,0xF0,0x3F,0x80,0x07,0x00,0x00,0xE0,0xFF,0x81,0x07,0x00,0x00,0x00,0xFF,0x8F,0x07,0x00,0x00,0x00,0xF8,0xBF,0x07,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
 
 	/* Index 34, character 66 "B" (width: 23 pixels) */
-	0x17, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x80,0x0F,0x80,0x07,0x00,0xF0,0x81,0x0F,0x80,0x07,0x00,0xE0,0xC3,0x0F,0xC0,0x07,0x00,0xE0,0xFF,0x1F,0xC0,0x03,0x00,0xC0,0xFF,0x1E,0xE0,0x03,0x00,0xC0,0x7F,0x7C,0xF0,0x01,0x00,0x00,0x1F,0xFC,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x80,0x0F,0x80,0x07,0x00,0xF0,0x81,0x0F,0x80,0x07,0x00,0xE0,0xC3,0x0F,0xC0,0x07,0x00,0xE0,0xFF,0x1F,0xC0,0x03,0x00,0xC0,0xFF,0x1E,0xE0,0x03,0x00,0xC0,0x7F,0x7C,0xF0,0x01,0x00,0x00,0x1F,0xFC,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,
 
 	/* Index 35, character 67 "C" (width: 26 pixels) */
-	0x1A, 0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xFC,0xFF,0x3F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x0F,0x00,0xFC,0x01,0x00,0xE0,0x07,0x00,0xF0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,
+	0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xFC,0xFF,0x3F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x0F,0x00,0xFC,0x01,0x00,0xE0,0x07,0x00,0xF0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0xF8,0x00,0x00,0x80,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,
 
 	/* Index 36, character 68 "D" (width: 26 pixels) */
-	0x1A, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0x80,0x07,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,0x80,0x0F,0x00,0xF8,0x00,0x00,0x80,0x1F,0x00,0xFC,0x00,0x00,0x00,0xFF,0x00,0x7F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x07,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0x80,0x07,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,0x80,0x0F,0x00,0xF8,0x00,0x00,0x80,0x1F,0x00,0xFC,0x00,0x00,0x00,0xFF,0x00,0x7F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x07,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,
 
 	/* Index 37, character 69 "E" (width: 21 pixels) */
-	0x15, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x07,0x00,
 
 	/* Index 38, character 70 "F" (width: 20 pixels) */
-	0x14, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 39, character 71 "G" (width: 28 pixels) */
-	0x1C, 0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xF0,0xFF,0x07,0x00,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x1F,0x00,0xFC,0x01,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0xF0,0x00,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0xF8,0x00,0x78,0x00,0x0F,0x00,0xF0,0x00,0x78,0x80,0x07,0x00,0xF0,0x00,0x78,0x80,0x07,0x00,0xF0,0x01,0x78,0x80,0x07,0x00,0xF0,0x01,0xF8,0xFF,0x03,0x00,0xE0,0x03,0xF8,0xFF,0x03,0x00,0xE0,0x03,0xF8,0xFF,0x03,0x00,0xC0,0x07,0xF8,0xFF,0x01,0x00,
+	0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xF0,0xFF,0x07,0x00,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x1F,0x00,0xFC,0x01,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0xF0,0x00,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0x78,0x00,0x78,0x00,0x0F,0x00,0xF8,0x00,0x78,0x00,0x0F,0x00,0xF0,0x00,0x78,0x80,0x07,0x00,0xF0,0x00,0x78,0x80,0x07,0x00,0xF0,0x01,0x78,0x80,0x07,0x00,0xF0,0x01,0xF8,0xFF,0x03,0x00,0xE0,0x03,0xF8,0xFF,0x03,0x00,0xE0,0x03,0xF8,0xFF,0x03,0x00,0xC0,0x07,0xF8,0xFF,0x01,0x00,
 
 	/* Index 40, character 72 "H" (width: 24 pixels) */
-	0x18, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,
 
 	/* Index 41, character 73 "I" (width: 12 pixels) */
-	0xC, 0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,
+	0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,
 
 	/* Index 42, character 74 "J" (width: 15 pixels) */
-	0xF, 0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x80,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0xC0,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0x7F,0x00,0x00,
+	0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x80,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0xC0,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0x7F,0x00,0x00,
 
 	/* Index 43, character 75 "K" (width: 25 pixels) */
-	0x19, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0x00,0xE0,0xFB,0x01,0x00,0x00,0x00,0xF0,0xF1,0x03,0x00,0x00,0x00,0xF8,0xE0,0x07,0x00,0x00,0x00,0x7C,0xC0,0x0F,0x00,0x00,0x00,0x3E,0x80,0x1F,0x00,0x00,0x00,0x1F,0x00,0x3F,0x00,0x00,0xC0,0x0F,0x00,0x7C,0x00,0x00,0xE0,0x07,0x00,0xF8,0x00,0x00,0xF0,0x03,0x00,0xF0,0x01,0x00,0xF0,0x01,0x00,0xE0,0x03,0x00,0xF0,0x00,0x00,0xC0,0x07,0x00,0x70,0x00,0x00,0x80,0x07,0x00,0x30,0x00,0x00,0x00,0x07,0x00,0x10,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0x00,0xE0,0xFB,0x01,0x00,0x00,0x00,0xF0,0xF1,0x03,0x00,0x00,0x00,0xF8,0xE0,0x07,0x00,0x00,0x00,0x7C,0xC0,0x0F,0x00,0x00,0x00,0x3E,0x80,0x1F,0x00,0x00,0x00,0x1F,0x00,0x3F,0x00,0x00,0xC0,0x0F,0x00,0x7C,0x00,0x00,0xE0,0x07,0x00,0xF8,0x00,0x00,0xF0,0x03,0x00,0xF0,0x01,0x00,0xF0,0x01,0x00,0xE0,0x03,0x00,0xF0,0x00,0x00,0xC0,0x07,0x00,0x70,0x00,0x00,0x80,0x07,0x00,0x30,0x00,0x00,0x00,0x07,0x00,0x10,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
 
 	/* Index 44, character 76 "L" (width: 20 pixels) */
-	0x14, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,
 
 	/* Index 45, character 77 "M" (width: 28 pixels) */
-	0x1C, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,
 
 	/* Index 46, character 78 "N" (width: 24 pixels) */
-	0x18, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,
 
 	/* Index 47, character 79 "O" (width: 30 pixels) */
-	0x1E, 0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0xE0,0x07,0x00,0xF0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x07,0x00,0xF0,0x03,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,
+	0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0xE0,0x07,0x00,0xF0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x07,0x00,0xF0,0x03,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,
 
 	/* Index 48, character 80 "P" (width: 21 pixels) */
-	0x15, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x01,0x3C,0x00,0x00,0x00,0xE0,0x01,0x3C,0x00,0x00,0x00,0xE0,0x03,0x3E,0x00,0x00,0x00,0xC0,0x07,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x0F,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x01,0x3C,0x00,0x00,0x00,0xE0,0x01,0x3C,0x00,0x00,0x00,0xE0,0x03,0x3E,0x00,0x00,0x00,0xC0,0x07,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x0F,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,
 
 	/* Index 49, character 81 "Q" (width: 31 pixels) */
-	0x1F, 0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0xE0,0x07,0x00,0xF0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x3F,0x00,0x78,0x00,0x00,0x00,0xFF,0x00,0xF0,0x00,0x00,0x80,0xFF,0x01,0xF0,0x00,0x00,0x80,0xFF,0x03,0xF0,0x01,0x00,0xC0,0xE7,0x03,0xE0,0x03,0x00,0xE0,0xC3,0x07,0xE0,0x07,0x00,0xF0,0x83,0x07,0xC0,0x0F,0x00,0xF8,0x81,0x07,0x80,0x7F,0x00,0xFF,0x80,0x07,0x00,0xFF,0xFF,0x7F,0x80,0x07,0x00,0xFE,0xFF,0x1F,0x80,0x07,0x00,0xF8,0xFF,0x0F,0x80,0x07,0x00,0xC0,0xFF,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xC0,0x03,
+	0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0x80,0x7F,0x00,0xFF,0x00,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0xE0,0x07,0x00,0xF0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x0F,0x00,0x78,0x00,0x00,0x00,0x3F,0x00,0x78,0x00,0x00,0x00,0xFF,0x00,0xF0,0x00,0x00,0x80,0xFF,0x01,0xF0,0x00,0x00,0x80,0xFF,0x03,0xF0,0x01,0x00,0xC0,0xE7,0x03,0xE0,0x03,0x00,0xE0,0xC3,0x07,0xE0,0x07,0x00,0xF0,0x83,0x07,0xC0,0x0F,0x00,0xF8,0x81,0x07,0x80,0x7F,0x00,0xFF,0x80,0x07,0x00,0xFF,0xFF,0x7F,0x80,0x07,0x00,0xFE,0xFF,0x1F,0x80,0x07,0x00,0xF8,0xFF,0x0F,0x80,0x07,0x00,0xC0,0xFF,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xC0,0x03,
 
 	/* Index 50, character 82 "R" (width: 26 pixels) */
-	0x1A, 0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0xF8,0x00,0x00,0x00,0xF0,0x00,0xF8,0x01,0x00,0x00,0xF0,0x00,0xFC,0x07,0x00,0x00,0xE0,0x01,0xFC,0x0F,0x00,0x00,0xE0,0x01,0x9E,0x1F,0x00,0x00,0xE0,0x07,0x1F,0x3F,0x00,0x00,0xC0,0xFF,0x0F,0x7C,0x00,0x00,0x80,0xFF,0x07,0xF8,0x00,0x00,0x00,0xFF,0x03,0xF0,0x01,0x00,0x00,0xFE,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+	0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0xF8,0x00,0x00,0x00,0xF0,0x00,0xF8,0x01,0x00,0x00,0xF0,0x00,0xFC,0x07,0x00,0x00,0xE0,0x01,0xFC,0x0F,0x00,0x00,0xE0,0x01,0x9E,0x1F,0x00,0x00,0xE0,0x07,0x1F,0x3F,0x00,0x00,0xC0,0xFF,0x0F,0x7C,0x00,0x00,0x80,0xFF,0x07,0xF8,0x00,0x00,0x00,0xFF,0x03,0xF0,0x01,0x00,0x00,0xFE,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
 
 	/* Index 51, character 83 "S" (width: 23 pixels) */
-	0x17, 0x00,0x7E,0x00,0xF0,0x03,0x00,0x80,0xFF,0x01,0xE0,0x03,0x00,0xC0,0xFF,0x03,0xC0,0x03,0x00,0xE0,0xFF,0x07,0xC0,0x07,0x00,0xE0,0xC3,0x0F,0x80,0x07,0x00,0xF0,0x81,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x0F,0x00,0xF8,0x00,0x1F,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x3E,0x00,0x0F,0x00,0x78,0x00,0x3E,0x00,0x0F,0x00,0x78,0x00,0x3C,0x00,0x0F,0x00,0x78,0x00,0x3C,0x00,0x0F,0x00,0x78,0x00,0x3C,0x80,0x07,0x00,0xF8,0x00,0x7C,0x80,0x07,0x00,0xF0,0x00,0x78,0xC0,0x07,0x00,0xF0,0x00,0xF8,0xE0,0x03,0x00,0xF0,0x01,0xF0,0xFF,0x01,0x00,0xE0,0x01,0xF0,0xFF,0x01,0x00,0xE0,0x03,0xE0,0x7F,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,
+	0x00,0x7E,0x00,0xF0,0x03,0x00,0x80,0xFF,0x01,0xE0,0x03,0x00,0xC0,0xFF,0x03,0xC0,0x03,0x00,0xE0,0xFF,0x07,0xC0,0x07,0x00,0xE0,0xC3,0x0F,0x80,0x07,0x00,0xF0,0x81,0x0F,0x80,0x07,0x00,0xF0,0x00,0x0F,0x80,0x0F,0x00,0xF8,0x00,0x1F,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x1E,0x00,0x0F,0x00,0x78,0x00,0x3E,0x00,0x0F,0x00,0x78,0x00,0x3E,0x00,0x0F,0x00,0x78,0x00,0x3C,0x00,0x0F,0x00,0x78,0x00,0x3C,0x00,0x0F,0x00,0x78,0x00,0x3C,0x80,0x07,0x00,0xF8,0x00,0x7C,0x80,0x07,0x00,0xF0,0x00,0x78,0xC0,0x07,0x00,0xF0,0x00,0xF8,0xE0,0x03,0x00,0xF0,0x01,0xF0,0xFF,0x01,0x00,0xE0,0x01,0xF0,0xFF,0x01,0x00,0xE0,0x03,0xE0,0x7F,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,
 
 	/* Index 52, character 84 "T" (width: 26 pixels) */
-	0x1A, 0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,
+	0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 53, character 85 "U" (width: 23 pixels) */
-	0x17, 0xF0,0xFF,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0xFF,0x7F,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0xFF,0x00,0x00,0xF0,0xFF,0xFF,0x7F,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x00,
+	0xF0,0xFF,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0xFF,0x7F,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0xFF,0x00,0x00,0xF0,0xFF,0xFF,0x7F,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x00,
 
 	/* Index 54, character 86 "V" (width: 27 pixels) */
-	0x1B, 0x10,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+	0x10,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 55, character 87 "W" (width: 39 pixels) */
-	0x27, 0x30,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFE,0xFF,0x00,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFE,0xFF,0x00,0x00,0x00,0x00,0xE0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0x00,0xF8,0xFF,0x01,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0x00,0xF8,0xFF,0x01,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xE0,0xFF,0x07,0x00,0x00,0x00,0xFE,0xFF,0x00,0x00,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x00,0xFE,0xFF,0x01,0x00,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
+	0x30,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFE,0xFF,0x00,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFE,0xFF,0x00,0x00,0x00,0x00,0xE0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0x00,0xF8,0xFF,0x01,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0x00,0xF8,0xFF,0x01,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xE0,0xFF,0x07,0x00,0x00,0x00,0xFE,0xFF,0x00,0x00,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x00,0xFE,0xFF,0x01,0x00,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 56, character 88 "X" (width: 27 pixels) */
-	0x1B, 0x10,0x00,0x00,0x00,0x04,0x00,0x30,0x00,0x00,0x00,0x06,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x03,0x00,0xE0,0x07,0x00,0xE0,0x0F,0x00,0xF8,0x03,0x00,0xC0,0x1F,0x00,0xFC,0x01,0x00,0x00,0x7F,0x00,0x7F,0x00,0x00,0x00,0xFE,0x80,0x3F,0x00,0x00,0x00,0xF8,0xC1,0x0F,0x00,0x00,0x00,0xF0,0xF7,0x07,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xF0,0xF7,0x07,0x00,0x00,0x00,0xF8,0xE1,0x0F,0x00,0x00,0x00,0xFE,0x80,0x3F,0x00,0x00,0x00,0x7F,0x00,0x7F,0x00,0x00,0xC0,0x1F,0x00,0xFC,0x01,0x00,0xE0,0x0F,0x00,0xF8,0x03,0x00,0xF0,0x03,0x00,0xE0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0x30,0x00,0x00,0x00,0x06,0x00,0x10,0x00,0x00,0x00,0x04,0x00,
+	0x10,0x00,0x00,0x00,0x04,0x00,0x30,0x00,0x00,0x00,0x06,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x03,0x00,0xE0,0x07,0x00,0xE0,0x0F,0x00,0xF8,0x03,0x00,0xC0,0x1F,0x00,0xFC,0x01,0x00,0x00,0x7F,0x00,0x7F,0x00,0x00,0x00,0xFE,0x80,0x3F,0x00,0x00,0x00,0xF8,0xC1,0x0F,0x00,0x00,0x00,0xF0,0xF7,0x07,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xF0,0xF7,0x07,0x00,0x00,0x00,0xF8,0xE1,0x0F,0x00,0x00,0x00,0xFE,0x80,0x3F,0x00,0x00,0x00,0x7F,0x00,0x7F,0x00,0x00,0xC0,0x1F,0x00,0xFC,0x01,0x00,0xE0,0x0F,0x00,0xF8,0x03,0x00,0xF0,0x03,0x00,0xE0,0x07,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0x80,0x07,0x00,0x30,0x00,0x00,0x00,0x06,0x00,0x10,0x00,0x00,0x00,0x04,0x00,
 
 	/* Index 57, character 89 "Y" (width: 26 pixels) */
-	0x1A, 0x10,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+	0x10,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 58, character 90 "Z" (width: 24 pixels) */
-	0x18, 0x00,0x00,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0xE0,0x07,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xF8,0x07,0x00,0xF0,0x00,0x00,0xFC,0x07,0x00,0xF0,0x00,0x00,0xBF,0x07,0x00,0xF0,0x00,0x80,0x9F,0x07,0x00,0xF0,0x00,0xC0,0x8F,0x07,0x00,0xF0,0x00,0xE0,0x87,0x07,0x00,0xF0,0x00,0xF0,0x81,0x07,0x00,0xF0,0x00,0xFC,0x80,0x07,0x00,0xF0,0x00,0x7E,0x80,0x07,0x00,0xF0,0x00,0x3F,0x80,0x07,0x00,0xF0,0x80,0x1F,0x80,0x07,0x00,0xF0,0xE0,0x07,0x80,0x07,0x00,0xF0,0xF0,0x03,0x80,0x07,0x00,0xF0,0xF8,0x01,0x80,0x07,0x00,0xF0,0xFC,0x00,0x80,0x07,0x00,0xF0,0x7E,0x00,0x80,0x07,0x00,0xF0,0x1F,0x00,0x80,0x07,0x00,0xF0,0x0F,0x00,0x80,0x07,0x00,0xF0,0x07,0x00,0x80,0x07,0x00,0xF0,0x03,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0x80,0x07,0x00,
+	0x00,0x00,0x00,0xC0,0x07,0x00,0xF0,0x00,0x00,0xE0,0x07,0x00,0xF0,0x00,0x00,0xF0,0x07,0x00,0xF0,0x00,0x00,0xF8,0x07,0x00,0xF0,0x00,0x00,0xFC,0x07,0x00,0xF0,0x00,0x00,0xBF,0x07,0x00,0xF0,0x00,0x80,0x9F,0x07,0x00,0xF0,0x00,0xC0,0x8F,0x07,0x00,0xF0,0x00,0xE0,0x87,0x07,0x00,0xF0,0x00,0xF0,0x81,0x07,0x00,0xF0,0x00,0xFC,0x80,0x07,0x00,0xF0,0x00,0x7E,0x80,0x07,0x00,0xF0,0x00,0x3F,0x80,0x07,0x00,0xF0,0x80,0x1F,0x80,0x07,0x00,0xF0,0xE0,0x07,0x80,0x07,0x00,0xF0,0xF0,0x03,0x80,0x07,0x00,0xF0,0xF8,0x01,0x80,0x07,0x00,0xF0,0xFC,0x00,0x80,0x07,0x00,0xF0,0x7E,0x00,0x80,0x07,0x00,0xF0,0x1F,0x00,0x80,0x07,0x00,0xF0,0x0F,0x00,0x80,0x07,0x00,0xF0,0x07,0x00,0x80,0x07,0x00,0xF0,0x03,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0x80,0x07,0x00,
 
 	/* Index 59, character 91 "[" (width: 11 pixels) */
-	0xB, 0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,
+	0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,
 
 	/* Index 60, character 92 "\" (width: 19 pixels) */
-	0x13, 0x04,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x01,
+	0x04,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x01,
 
 	/* Index 61, character 93 "]" (width: 11 pixels) */
-	0xB, 0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,
+	0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,
 
 	/* Index 62, character 94 "^" (width: 27 pixels) */
-	0x1B, 0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+	0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
 
 	/* Index 63, character 95 "_" (width: 27 pixels) */
-	0x1B, 0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,
+	0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x01,
 
 	/* Index 64, character 96 "`" (width: 9 pixels) */
-	0x9, 0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,
+	0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 20 pixels) */
-	0x14, 0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0xF0,0x80,0xFF,0x03,0x00,0x00,0xF0,0xC0,0xFF,0x07,0x00,0x00,0xF0,0xC0,0xC7,0x07,0x00,0x00,0x78,0xE0,0x83,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x07,0x00,0x00,0x78,0xF0,0x80,0x07,0x00,0x00,0xF8,0xF0,0x80,0x07,0x00,0x00,0xF0,0xF0,0x80,0x03,0x00,0x00,0xF0,0xF1,0xC0,0x01,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
+	0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0xF0,0x80,0xFF,0x03,0x00,0x00,0xF0,0xC0,0xFF,0x07,0x00,0x00,0xF0,0xC0,0xC7,0x07,0x00,0x00,0x78,0xE0,0x83,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x0F,0x00,0x00,0x78,0xF0,0x00,0x07,0x00,0x00,0x78,0xF0,0x80,0x07,0x00,0x00,0xF8,0xF0,0x80,0x07,0x00,0x00,0xF0,0xF0,0x80,0x03,0x00,0x00,0xF0,0xF1,0xC0,0x01,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
 
 	/* Index 66, character 98 "b" (width: 21 pixels) */
-	0x15, 0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x80,0x07,0x00,0x00,0xE0,0x01,0x80,0x07,0x00,0x00,0xF0,0x00,0x00,0x07,0x00,0x00,0xF0,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x80,0x0F,0x00,0x00,0xF8,0x00,0xC0,0x07,0x00,0x00,0xF0,0x01,0xE0,0x07,0x00,0x00,0xF0,0x07,0xF8,0x03,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,
+	0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x80,0x07,0x00,0x00,0xE0,0x01,0x80,0x07,0x00,0x00,0xF0,0x00,0x00,0x07,0x00,0x00,0xF0,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x80,0x0F,0x00,0x00,0xF8,0x00,0xC0,0x07,0x00,0x00,0xF0,0x01,0xE0,0x07,0x00,0x00,0xF0,0x07,0xF8,0x03,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,
 
 	/* Index 67, character 99 "c" (width: 19 pixels) */
-	0x13, 0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0xE0,0x0F,0xF8,0x03,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x01,0xC0,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xE0,0x01,0xC0,0x03,0x00,
+	0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0xE0,0x0F,0xF8,0x03,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x01,0xC0,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xE0,0x01,0xC0,0x03,0x00,
 
 	/* Index 68, character 100 "d" (width: 21 pixels) */
-	0x15, 0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x03,0x00,0x00,0xE0,0x0F,0xF0,0x07,0x00,0x00,0xF0,0x03,0xC0,0x07,0x00,0x00,0xF0,0x01,0x80,0x0F,0x00,0x00,0xF8,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x80,0x07,0x00,0x00,0x70,0x00,0x80,0x07,0x00,0x00,0xF0,0x00,0xC0,0x03,0x00,0x00,0xF0,0x00,0xC0,0x01,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,
+	0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x03,0x00,0x00,0xE0,0x0F,0xF0,0x07,0x00,0x00,0xF0,0x03,0xC0,0x07,0x00,0x00,0xF0,0x01,0x80,0x0F,0x00,0x00,0xF8,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x80,0x07,0x00,0x00,0x70,0x00,0x80,0x07,0x00,0x00,0xF0,0x00,0xC0,0x03,0x00,0x00,0xF0,0x00,0xC0,0x01,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,
 
 	/* Index 69, character 101 "e" (width: 22 pixels) */
-	0x16, 0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0xE0,0xE7,0xF1,0x03,0x00,0x00,0xE0,0xE1,0xE1,0x03,0x00,0x00,0xF0,0xE0,0xC1,0x07,0x00,0x00,0xF0,0xE0,0x81,0x07,0x00,0x00,0x78,0xE0,0x81,0x07,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0xF0,0xE0,0x01,0x0F,0x00,0x00,0xF0,0xE1,0x01,0x0F,0x00,0x00,0xF0,0xE3,0x81,0x0F,0x00,0x00,0xE0,0xFF,0x81,0x07,0x00,0x00,0xC0,0xFF,0x81,0x07,0x00,0x00,0x00,0xFF,0x81,0x07,0x00,0x00,0x00,0xFC,0xC1,0x03,0x00,
+	0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0xE0,0xE7,0xF1,0x03,0x00,0x00,0xE0,0xE1,0xE1,0x03,0x00,0x00,0xF0,0xE0,0xC1,0x07,0x00,0x00,0xF0,0xE0,0x81,0x07,0x00,0x00,0x78,0xE0,0x81,0x07,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0x78,0xE0,0x01,0x0F,0x00,0x00,0xF0,0xE0,0x01,0x0F,0x00,0x00,0xF0,0xE1,0x01,0x0F,0x00,0x00,0xF0,0xE3,0x81,0x0F,0x00,0x00,0xE0,0xFF,0x81,0x07,0x00,0x00,0xC0,0xFF,0x81,0x07,0x00,0x00,0x00,0xFF,0x81,0x07,0x00,0x00,0x00,0xFC,0xC1,0x03,0x00,
 
 	/* Index 70, character 102 "f" (width: 15 pixels) */
-	0xF, 0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0x07,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF8,0xFF,0xFF,0xFF,0x07,0x00,0xF8,0x70,0x00,0x00,0x00,0x00,0x7C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0x07,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x07,0x00,0xF8,0xFF,0xFF,0xFF,0x07,0x00,0xF8,0x70,0x00,0x00,0x00,0x00,0x7C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x3C,0x70,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 21 pixels) */
-	0x15, 0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x81,0x07,0x00,0xE0,0x0F,0xF8,0x83,0x07,0x00,0xF0,0x03,0xE0,0x83,0x0F,0x00,0xF0,0x01,0xC0,0x07,0x0F,0x00,0xF8,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0xC0,0x03,0x0F,0x00,0x70,0x00,0xC0,0x83,0x07,0x00,0xF0,0x00,0xC0,0xC1,0x07,0x00,0xF0,0x00,0xE0,0xE1,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0xFF,0x00,0x00,0xF0,0xFF,0xFF,0x1F,0x00,
+	0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x81,0x07,0x00,0xE0,0x0F,0xF8,0x83,0x07,0x00,0xF0,0x03,0xE0,0x83,0x0F,0x00,0xF0,0x01,0xC0,0x07,0x0F,0x00,0xF8,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0x80,0x07,0x0F,0x00,0x78,0x00,0xC0,0x03,0x0F,0x00,0x70,0x00,0xC0,0x83,0x07,0x00,0xF0,0x00,0xC0,0xC1,0x07,0x00,0xF0,0x00,0xE0,0xE1,0x07,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x01,0x00,0xF0,0xFF,0xFF,0xFF,0x00,0x00,0xF0,0xFF,0xFF,0x1F,0x00,
 
 	/* Index 72, character 104 "h" (width: 19 pixels) */
-	0x13, 0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
+	0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
 
 	/* Index 73, character 105 "i" (width: 4 pixels) */
-	0x4, 0xF0,0xF0,0xFF,0xFF,0x07,0x00,0xF0,0xF0,0xFF,0xFF,0x07,0x00,0xF0,0xF0,0xFF,0xFF,0x07,0x00,0xF0,0xF0,0xFF,0xFF,0x07,0x00,
+	0xF0,0xF0,0xFF,0xFF,0x07,0x00,0xF0,0xF0,0xFF,0xFF,0x07,0x00,0xF0,0xF0,0xFF,0xFF,0x07,0x00,0xF0,0xF0,0xFF,0xFF,0x07,0x00,
 
 	/* Index 74, character 106 "j" (width: 12 pixels) */
-	0xC, 0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x80,0x0F,0x00,0x70,0x00,0x00,0xC0,0x07,0xF0,0xF0,0xFF,0xFF,0xFF,0x07,0xF0,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xF0,0xFF,0xFF,0xFF,0x01,0xF0,0xF0,0xFF,0xFF,0x7F,0x00,
+	0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x00,0x0F,0x00,0x70,0x00,0x00,0x80,0x0F,0x00,0x70,0x00,0x00,0xC0,0x07,0xF0,0xF0,0xFF,0xFF,0xFF,0x07,0xF0,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xF0,0xFF,0xFF,0xFF,0x01,0xF0,0xF0,0xFF,0xFF,0x7F,0x00,
 
 	/* Index 75, character 107 "k" (width: 21 pixels) */
-	0x15, 0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xBE,0x1F,0x00,0x00,0x00,0x00,0x1F,0x3F,0x00,0x00,0x00,0x80,0x0F,0x7E,0x00,0x00,0x00,0xC0,0x07,0xFC,0x00,0x00,0x00,0xE0,0x03,0xF8,0x01,0x00,0x00,0xF0,0x01,0xF0,0x03,0x00,0x00,0xF0,0x00,0xE0,0x07,0x00,0x00,0x70,0x00,0xC0,0x07,0x00,0x00,0x30,0x00,0x80,0x07,0x00,0x00,0x10,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+	0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xBE,0x1F,0x00,0x00,0x00,0x00,0x1F,0x3F,0x00,0x00,0x00,0x80,0x0F,0x7E,0x00,0x00,0x00,0xC0,0x07,0xFC,0x00,0x00,0x00,0xE0,0x03,0xF8,0x01,0x00,0x00,0xF0,0x01,0xF0,0x03,0x00,0x00,0xF0,0x00,0xE0,0x07,0x00,0x00,0x70,0x00,0xC0,0x07,0x00,0x00,0x30,0x00,0x80,0x07,0x00,0x00,0x10,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
 
 	/* Index 76, character 108 "l" (width: 4 pixels) */
-	0x4, 0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,
+	0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x00,
 
 	/* Index 77, character 109 "m" (width: 34 pixels) */
-	0x22, 0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
+	0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
 
 	/* Index 78, character 110 "n" (width: 19 pixels) */
-	0x13, 0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
+	0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,
 
 	/* Index 79, character 111 "o" (width: 22 pixels) */
-	0x16, 0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0xE0,0x0F,0xF8,0x03,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x00,0xC0,0x07,0x00,0x00,0xF8,0x00,0x80,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0xF8,0x00,0x80,0x0F,0x00,0x00,0xF0,0x00,0xC0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xE0,0x0F,0xF8,0x03,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,
+	0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0xE0,0x0F,0xF8,0x03,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x00,0xC0,0x07,0x00,0x00,0xF8,0x00,0x80,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0xF8,0x00,0x80,0x0F,0x00,0x00,0xF0,0x00,0xC0,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xE0,0x0F,0xF8,0x03,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,
 
 	/* Index 80, character 112 "p" (width: 21 pixels) */
-	0x15, 0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xC0,0x01,0x80,0x07,0x00,0x00,0xE0,0x01,0x80,0x07,0x00,0x00,0xF0,0x00,0x00,0x07,0x00,0x00,0xF0,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x80,0x0F,0x00,0x00,0xF8,0x00,0xC0,0x07,0x00,0x00,0xF0,0x01,0xE0,0x07,0x00,0x00,0xF0,0x07,0xF8,0x03,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,
+	0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xC0,0x01,0x80,0x07,0x00,0x00,0xE0,0x01,0x80,0x07,0x00,0x00,0xF0,0x00,0x00,0x07,0x00,0x00,0xF0,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x80,0x0F,0x00,0x00,0xF8,0x00,0xC0,0x07,0x00,0x00,0xF0,0x01,0xE0,0x07,0x00,0x00,0xF0,0x07,0xF8,0x03,0x00,0x00,0xE0,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,
 
 	/* Index 81, character 113 "q" (width: 21 pixels) */
-	0x15, 0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x03,0x00,0x00,0xE0,0x0F,0xF0,0x07,0x00,0x00,0xF0,0x03,0xC0,0x07,0x00,0x00,0xF0,0x01,0x80,0x0F,0x00,0x00,0xF8,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x07,0x00,0x00,0x78,0x00,0x80,0x07,0x00,0x00,0x70,0x00,0x80,0x03,0x00,0x00,0xF0,0x00,0xC0,0x03,0x00,0x00,0xF0,0x00,0xC0,0x01,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,
+	0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x03,0x00,0x00,0xE0,0x0F,0xF0,0x07,0x00,0x00,0xF0,0x03,0xC0,0x07,0x00,0x00,0xF0,0x01,0x80,0x0F,0x00,0x00,0xF8,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x07,0x00,0x00,0x78,0x00,0x80,0x07,0x00,0x00,0x70,0x00,0x80,0x03,0x00,0x00,0xF0,0x00,0xC0,0x03,0x00,0x00,0xF0,0x00,0xC0,0x01,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,0x00,0xF0,0xFF,0xFF,0xFF,0x0F,
 
 	/* Index 82, character 114 "r" (width: 14 pixels) */
-	0xE, 0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,
+	0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,
 
 	/* Index 83, character 115 "s" (width: 18 pixels) */
-	0x12, 0x00,0x00,0x1F,0xC0,0x03,0x00,0x00,0xC0,0x3F,0x80,0x07,0x00,0x00,0xE0,0x7F,0x80,0x07,0x00,0x00,0xF0,0xFF,0x00,0x07,0x00,0x00,0xF0,0xF0,0x00,0x0F,0x00,0x00,0x70,0xF0,0x01,0x0E,0x00,0x00,0x38,0xE0,0x01,0x0E,0x00,0x00,0x38,0xE0,0x01,0x0E,0x00,0x00,0x38,0xE0,0x01,0x0E,0x00,0x00,0x38,0xC0,0x03,0x0E,0x00,0x00,0x38,0xC0,0x03,0x0E,0x00,0x00,0x38,0xC0,0x03,0x0E,0x00,0x00,0x78,0xC0,0x03,0x07,0x00,0x00,0x70,0x80,0x87,0x07,0x00,0x00,0x70,0x80,0xFF,0x07,0x00,0x00,0xF0,0x80,0xFF,0x03,0x00,0x00,0xE0,0x01,0xFF,0x01,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,
+	0x00,0x00,0x1F,0xC0,0x03,0x00,0x00,0xC0,0x3F,0x80,0x07,0x00,0x00,0xE0,0x7F,0x80,0x07,0x00,0x00,0xF0,0xFF,0x00,0x07,0x00,0x00,0xF0,0xF0,0x00,0x0F,0x00,0x00,0x70,0xF0,0x01,0x0E,0x00,0x00,0x38,0xE0,0x01,0x0E,0x00,0x00,0x38,0xE0,0x01,0x0E,0x00,0x00,0x38,0xE0,0x01,0x0E,0x00,0x00,0x38,0xC0,0x03,0x0E,0x00,0x00,0x38,0xC0,0x03,0x0E,0x00,0x00,0x38,0xC0,0x03,0x0E,0x00,0x00,0x78,0xC0,0x03,0x07,0x00,0x00,0x70,0x80,0x87,0x07,0x00,0x00,0x70,0x80,0xFF,0x07,0x00,0x00,0xF0,0x80,0xFF,0x03,0x00,0x00,0xE0,0x01,0xFF,0x01,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,
 
 	/* Index 84, character 116 "t" (width: 15 pixels) */
-	0xF, 0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0x03,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x70,0x00,0xC0,0x0F,0x00,0x00,0x70,0x00,0x80,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x80,0x07,0x00,
+	0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0x03,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0x00,0x70,0x00,0xC0,0x0F,0x00,0x00,0x70,0x00,0x80,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x80,0x07,0x00,
 
 	/* Index 85, character 117 "u" (width: 19 pixels) */
-	0x13, 0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x01,0x00,0x00,0xF0,0xFF,0xFF,0x03,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,
+	0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x01,0x00,0x00,0xF0,0xFF,0xFF,0x03,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,
 
 	/* Index 86, character 118 "v" (width: 23 pixels) */
-	0x17, 0x00,0x10,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,
+	0x00,0x10,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,
 
 	/* Index 87, character 119 "w" (width: 31 pixels) */
-	0x1F, 0x00,0x30,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,
+	0x00,0x30,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,
 
 	/* Index 88, character 120 "x" (width: 23 pixels) */
-	0x17, 0x00,0x10,0x00,0x00,0x04,0x00,0x00,0x30,0x00,0x00,0x06,0x00,0x00,0x70,0x00,0x00,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xE0,0x07,0xF0,0x03,0x00,0x00,0xC0,0x0F,0xF8,0x01,0x00,0x00,0x80,0x1F,0xFC,0x00,0x00,0x00,0x00,0x7F,0x3F,0x00,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0x00,0x3E,0x3F,0x00,0x00,0x00,0x80,0x1F,0xFC,0x00,0x00,0x00,0xC0,0x0F,0xF8,0x01,0x00,0x00,0xF0,0x07,0xF0,0x03,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0x70,0x00,0x00,0x07,0x00,0x00,0x30,0x00,0x00,0x06,0x00,0x00,0x10,0x00,0x00,0x04,0x00,
+	0x00,0x10,0x00,0x00,0x04,0x00,0x00,0x30,0x00,0x00,0x06,0x00,0x00,0x70,0x00,0x00,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xE0,0x07,0xF0,0x03,0x00,0x00,0xC0,0x0F,0xF8,0x01,0x00,0x00,0x80,0x1F,0xFC,0x00,0x00,0x00,0x00,0x7F,0x3F,0x00,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0x00,0x3E,0x3F,0x00,0x00,0x00,0x80,0x1F,0xFC,0x00,0x00,0x00,0xC0,0x0F,0xF8,0x01,0x00,0x00,0xF0,0x07,0xF0,0x03,0x00,0x00,0xF0,0x03,0xE0,0x07,0x00,0x00,0xF0,0x00,0x80,0x07,0x00,0x00,0x70,0x00,0x00,0x07,0x00,0x00,0x30,0x00,0x00,0x06,0x00,0x00,0x10,0x00,0x00,0x04,0x00,
 
 	/* Index 89, character 121 "y" (width: 23 pixels) */
-	0x17, 0x00,0x10,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x08,0x00,0x00,0xFE,0x07,0x00,0x0F,0x00,0x00,0xF0,0x3F,0xC0,0x0F,0x00,0x00,0xC0,0xFF,0xF0,0x0F,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,0x00,0x00,0xF8,0xFF,0x01,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,
+	0x00,0x10,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x08,0x00,0x00,0xFE,0x07,0x00,0x0F,0x00,0x00,0xF0,0x3F,0xC0,0x0F,0x00,0x00,0xC0,0xFF,0xF0,0x0F,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,0x00,0x00,0xF8,0xFF,0x01,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,
 
 	/* Index 90, character 122 "z" (width: 19 pixels) */
-	0x13, 0x00,0x70,0x00,0x80,0x07,0x00,0x00,0x70,0x00,0xC0,0x07,0x00,0x00,0x70,0x00,0xE0,0x07,0x00,0x00,0x70,0x00,0xF0,0x07,0x00,0x00,0x70,0x00,0xF8,0x07,0x00,0x00,0x70,0x00,0x7E,0x07,0x00,0x00,0x70,0x00,0x3F,0x07,0x00,0x00,0x70,0x80,0x1F,0x07,0x00,0x00,0x70,0xC0,0x0F,0x07,0x00,0x00,0x70,0xF0,0x03,0x07,0x00,0x00,0x70,0xF8,0x01,0x07,0x00,0x00,0x70,0xFC,0x00,0x07,0x00,0x00,0x70,0x7E,0x00,0x07,0x00,0x00,0x70,0x3F,0x00,0x07,0x00,0x00,0xF0,0x0F,0x00,0x07,0x00,0x00,0xF0,0x07,0x00,0x07,0x00,0x00,0xF0,0x03,0x00,0x07,0x00,0x00,0xF0,0x01,0x00,0x07,0x00,0x00,0xF0,0x00,0x00,0x07,0x00,
+	0x00,0x70,0x00,0x80,0x07,0x00,0x00,0x70,0x00,0xC0,0x07,0x00,0x00,0x70,0x00,0xE0,0x07,0x00,0x00,0x70,0x00,0xF0,0x07,0x00,0x00,0x70,0x00,0xF8,0x07,0x00,0x00,0x70,0x00,0x7E,0x07,0x00,0x00,0x70,0x00,0x3F,0x07,0x00,0x00,0x70,0x80,0x1F,0x07,0x00,0x00,0x70,0xC0,0x0F,0x07,0x00,0x00,0x70,0xF0,0x03,0x07,0x00,0x00,0x70,0xF8,0x01,0x07,0x00,0x00,0x70,0xFC,0x00,0x07,0x00,0x00,0x70,0x7E,0x00,0x07,0x00,0x00,0x70,0x3F,0x00,0x07,0x00,0x00,0xF0,0x0F,0x00,0x07,0x00,0x00,0xF0,0x07,0x00,0x07,0x00,0x00,0xF0,0x03,0x00,0x07,0x00,0x00,0xF0,0x01,0x00,0x07,0x00,0x00,0xF0,0x00,0x00,0x07,0x00,
 
 	/* Index 91, character 123 "{" (width: 20 pixels) */
-	0x14, 0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xB8,0x03,0x00,0x00,0x00,0x00,0x9E,0x0F,0x00,0x00,0x80,0xFF,0x1F,0xFF,0x3F,0x00,0xE0,0xFF,0x0F,0xFE,0xFF,0x00,0xF0,0xFF,0x07,0xFC,0xFF,0x01,0xF8,0xFF,0x01,0xF0,0xFF,0x03,0xF8,0x00,0x00,0x00,0xE0,0x03,0x3C,0x00,0x00,0x00,0x80,0x07,0x3C,0x00,0x00,0x00,0x80,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,
+	0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xB8,0x03,0x00,0x00,0x00,0x00,0x9E,0x0F,0x00,0x00,0x80,0xFF,0x1F,0xFF,0x3F,0x00,0xE0,0xFF,0x0F,0xFE,0xFF,0x00,0xF0,0xFF,0x07,0xFC,0xFF,0x01,0xF8,0xFF,0x01,0xF0,0xFF,0x03,0xF8,0x00,0x00,0x00,0xE0,0x03,0x3C,0x00,0x00,0x00,0x80,0x07,0x3C,0x00,0x00,0x00,0x80,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,
 
 	/* Index 92, character 124 "|" (width: 4 pixels) */
-	0x4, 0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,
+	0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,0xFC,0xFF,0xFF,0xFF,0xFF,0x07,
 
 	/* Index 93, character 125 "}" (width: 20 pixels) */
-	0x14, 0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x3C,0x00,0x00,0x00,0x80,0x07,0x3C,0x00,0x00,0x00,0x80,0x07,0xF8,0x00,0x00,0x00,0xE0,0x03,0xF8,0xFF,0x01,0xF0,0xFF,0x03,0xF0,0xFF,0x07,0xFC,0xFF,0x01,0xE0,0xFF,0x0F,0xFE,0xFF,0x00,0x80,0xFF,0x1F,0xFF,0x3F,0x00,0x00,0x00,0xBE,0x0F,0x00,0x00,0x00,0x00,0xB8,0x03,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,
+	0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x07,0x3C,0x00,0x00,0x00,0x80,0x07,0x3C,0x00,0x00,0x00,0x80,0x07,0xF8,0x00,0x00,0x00,0xE0,0x03,0xF8,0xFF,0x01,0xF0,0xFF,0x03,0xF0,0xFF,0x07,0xFC,0xFF,0x01,0xE0,0xFF,0x0F,0xFE,0xFF,0x00,0x80,0xFF,0x1F,0xFF,0x3F,0x00,0x00,0x00,0xBE,0x0F,0x00,0x00,0x00,0x00,0xB8,0x03,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,
 
 	/* Index 94, character 126 "~" (width: 27 pixels) */
-	0x1B, 0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00
+	0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00
+};
+
+// Offset of each bitmap in Verdana32_bitmaps
+const unsigned short Verdana32_offsets[] = 
+{
+	0x0,	// Index 0
+	0x18,	// Index 1
+	0x30,	// Index 2
+	0x7E,	// Index 3
+	0x120,	// Index 4
+	0x198,	// Index 5
+	0x288,	// Index 6
+	0x33C,	// Index 7
+	0x35A,	// Index 8
+	0x3A8,	// Index 9
+	0x3F6,	// Index 10
+	0x474,	// Index 11
+	0x50A,	// Index 12
+	0x540,	// Index 13
+	0x58E,	// Index 14
+	0x5AC,	// Index 15
+	0x61E,	// Index 16
+	0x69C,	// Index 17
+	0x6FC,	// Index 18
+	0x77A,	// Index 19
+	0x7F2,	// Index 20
+	0x882,	// Index 21
+	0x8FA,	// Index 22
+	0x97E,	// Index 23
+	0x9FC,	// Index 24
+	0xA7A,	// Index 25
+	0xAFE,	// Index 26
+	0xB1C,	// Index 27
+	0xB52,	// Index 28
+	0xBE2,	// Index 29
+	0xC78,	// Index 30
+	0xD08,	// Index 31
+	0xD74,	// Index 32
+	0xE4C,	// Index 33
+	0xEEE,	// Index 34
+	0xF78,	// Index 35
+	0x1014,	// Index 36
+	0x10B0,	// Index 37
+	0x112E,	// Index 38
+	0x11A6,	// Index 39
+	0x124E,	// Index 40
+	0x12DE,	// Index 41
+	0x1326,	// Index 42
+	0x1380,	// Index 43
+	0x1416,	// Index 44
+	0x148E,	// Index 45
+	0x1536,	// Index 46
+	0x15C6,	// Index 47
+	0x167A,	// Index 48
+	0x16F8,	// Index 49
+	0x17B2,	// Index 50
+	0x184E,	// Index 51
+	0x18D8,	// Index 52
+	0x1974,	// Index 53
+	0x19FE,	// Index 54
+	0x1AA0,	// Index 55
+	0x1B8A,	// Index 56
+	0x1C2C,	// Index 57
+	0x1CC8,	// Index 58
+	0x1D58,	// Index 59
+	0x1D9A,	// Index 60
+	0x1E0C,	// Index 61
+	0x1E4E,	// Index 62
+	0x1EF0,	// Index 63
+	0x1F92,	// Index 64
+	0x1FC8,	// Index 65
+	0x2040,	// Index 66
+	0x20BE,	// Index 67
+	0x2130,	// Index 68
+	0x21AE,	// Index 69
+	0x2232,	// Index 70
+	0x228C,	// Index 71
+	0x230A,	// Index 72
+	0x237C,	// Index 73
+	0x2394,	// Index 74
+	0x23DC,	// Index 75
+	0x245A,	// Index 76
+	0x2472,	// Index 77
+	0x253E,	// Index 78
+	0x25B0,	// Index 79
+	0x2634,	// Index 80
+	0x26B2,	// Index 81
+	0x2730,	// Index 82
+	0x2784,	// Index 83
+	0x27F0,	// Index 84
+	0x284A,	// Index 85
+	0x28BC,	// Index 86
+	0x2946,	// Index 87
+	0x2A00,	// Index 88
+	0x2A8A,	// Index 89
+	0x2B14,	// Index 90
+	0x2B86,	// Index 91
+	0x2BFE,	// Index 92
+	0x2C16,	// Index 93
+	0x2C8E,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Verdana32_widths[] = 
+{
+	0x4,	// Index 0
+	0x4,	// Index 1
+	0xD,	// Index 2
+	0x1B,	// Index 3
+	0x14,	// Index 4
+	0x28,	// Index 5
+	0x1E,	// Index 6
+	0x5,	// Index 7
+	0xD,	// Index 8
+	0xD,	// Index 9
+	0x15,	// Index 10
+	0x19,	// Index 11
+	0x9,	// Index 12
+	0xD,	// Index 13
+	0x5,	// Index 14
+	0x13,	// Index 15
+	0x15,	// Index 16
+	0x10,	// Index 17
+	0x15,	// Index 18
+	0x14,	// Index 19
+	0x18,	// Index 20
+	0x14,	// Index 21
+	0x16,	// Index 22
+	0x15,	// Index 23
+	0x15,	// Index 24
+	0x16,	// Index 25
+	0x5,	// Index 26
+	0x9,	// Index 27
+	0x18,	// Index 28
+	0x19,	// Index 29
+	0x18,	// Index 30
+	0x12,	// Index 31
+	0x24,	// Index 32
+	0x1B,	// Index 33
+	0x17,	// Index 34
+	0x1A,	// Index 35
+	0x1A,	// Index 36
+	0x15,	// Index 37
+	0x14,	// Index 38
+	0x1C,	// Index 39
+	0x18,	// Index 40
+	0xC,	// Index 41
+	0xF,	// Index 42
+	0x19,	// Index 43
+	0x14,	// Index 44
+	0x1C,	// Index 45
+	0x18,	// Index 46
+	0x1E,	// Index 47
+	0x15,	// Index 48
+	0x1F,	// Index 49
+	0x1A,	// Index 50
+	0x17,	// Index 51
+	0x1A,	// Index 52
+	0x17,	// Index 53
+	0x1B,	// Index 54
+	0x27,	// Index 55
+	0x1B,	// Index 56
+	0x1A,	// Index 57
+	0x18,	// Index 58
+	0xB,	// Index 59
+	0x13,	// Index 60
+	0xB,	// Index 61
+	0x1B,	// Index 62
+	0x1B,	// Index 63
+	0x9,	// Index 64
+	0x14,	// Index 65
+	0x15,	// Index 66
+	0x13,	// Index 67
+	0x15,	// Index 68
+	0x16,	// Index 69
+	0xF,	// Index 70
+	0x15,	// Index 71
+	0x13,	// Index 72
+	0x4,	// Index 73
+	0xC,	// Index 74
+	0x15,	// Index 75
+	0x4,	// Index 76
+	0x22,	// Index 77
+	0x13,	// Index 78
+	0x16,	// Index 79
+	0x15,	// Index 80
+	0x15,	// Index 81
+	0xE,	// Index 82
+	0x12,	// Index 83
+	0xF,	// Index 84
+	0x13,	// Index 85
+	0x17,	// Index 86
+	0x1F,	// Index 87
+	0x17,	// Index 88
+	0x17,	// Index 89
+	0x13,	// Index 90
+	0x14,	// Index 91
+	0x4,	// Index 92
+	0x14,	// Index 93
+	0x1B,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Verdana32_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x1F, 0x0,	// Index 1
+	0x21, 0x0,	// Index 2
+	0x1F, 0x0,	// Index 3
+	0x21, 0x8,	// Index 4
+	0x20, 0x1,	// Index 5
+	0x20, 0x1,	// Index 6
+	0x21, 0x0,	// Index 7
+	0x21, 0x9,	// Index 8
+	0x21, 0x9,	// Index 9
+	0x21, 0x0,	// Index 10
+	0x1A, 0x0,	// Index 11
+	0x6, 0x8,	// Index 12
+	0x10, 0x0,	// Index 13
+	0x6, 0x0,	// Index 14
+	0x21, 0x6,	// Index 15
+	0x20, 0x1,	// Index 16
+	0x1F, 0x0,	// Index 17
+	0x20, 0x0,	// Index 18
+	0x20, 0x1,	// Index 19
+	0x1F, 0x0,	// Index 20
+	0x20, 0x1,	// Index 21
+	0x20, 0x1,	// Index 22
+	0x1F, 0x0,	// Index 23
+	0x20, 0x1,	// Index 24
+	0x20, 0x1,	// Index 25
+	0x17, 0x0,	// Index 26
+	0x17, 0x8,	// Index 27
+	0x1A, 0x0,	// Index 28
+	0x14, 0x0,	// Index 29
+	0x1A, 0x0,	// Index 30
+	0x20, 0x0,	// Index 31
+	0x20, 0x5,	// Index 32
+	0x1F, 0x0,	// Index 33
+	0x1F, 0x0,	// Index 34
+	0x20, 0x1,	// Index 35
+	0x1F, 0x0,	// Index 36
+	0x1F, 0x0,	// Index 37
+	0x1F, 0x0,	// Index 38
+	0x20, 0x1,	// Index 39
+	0x1F, 0x0,	// Index 40
+	0x1F, 0x0,	// Index 41
+	0x1F, 0x1,	// Index 42
+	0x1F, 0x0,	// Index 43
+	0x1F, 0x0,	// Index 44
+	0x1F, 0x0,	// Index 45
+	0x1F, 0x0,	// Index 46
+	0x20, 0x1,	// Index 47
+	0x1F, 0x0,	// Index 48
+	0x20, 0x8,	// Index 49
+	0x1F, 0x0,	// Index 50
+	0x20, 0x1,	// Index 51
+	0x1F, 0x0,	// Index 52
+	0x1F, 0x1,	// Index 53
+	0x1F, 0x0,	// Index 54
+	0x1F, 0x0,	// Index 55
+	0x1F, 0x0,	// Index 56
+	0x1F, 0x0,	// Index 57
+	0x1F, 0x0,	// Index 58
+	0x21, 0x8,	// Index 59
+	0x21, 0x6,	// Index 60
+	0x21, 0x8,	// Index 61
+	0x1F, 0x0,	// Index 62
+	0x0, 0x6,	// Index 63
+	0x23, 0x0,	// Index 64
+	0x18, 0x1,	// Index 65
+	0x21, 0x1,	// Index 66
+	0x18, 0x1,	// Index 67
+	0x21, 0x1,	// Index 68
+	0x18, 0x1,	// Index 69
+	0x21, 0x0,	// Index 70
+	0x18, 0x9,	// Index 71
+	0x21, 0x0,	// Index 72
+	0x1F, 0x0,	// Index 73
+	0x1F, 0x9,	// Index 74
+	0x21, 0x0,	// Index 75
+	0x21, 0x0,	// Index 76
+	0x18, 0x0,	// Index 77
+	0x18, 0x0,	// Index 78
+	0x18, 0x1,	// Index 79
+	0x18, 0x9,	// Index 80
+	0x18, 0x9,	// Index 81
+	0x17, 0x0,	// Index 82
+	0x18, 0x1,	// Index 83
+	0x1E, 0x1,	// Index 84
+	0x17, 0x1,	// Index 85
+	0x17, 0x0,	// Index 86
+	0x17, 0x0,	// Index 87
+	0x17, 0x0,	// Index 88
+	0x17, 0x9,	// Index 89
+	0x17, 0x0,	// Index 90
+	0x21, 0x8,	// Index 91
+	0x21, 0x8,	// Index 92
+	0x21, 0x8,	// Index 93
+	0x13, 0x0,	// Index 94
+};
+
+const font_t Verdana32 = 
+{
+	Verdana32_bitmaps,
+	Verdana32_offsets,
+	Verdana32_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x2C,	// Height 
+	0,	// Flags 
+	Verdana32_extents,
+	0x23	// Ascent 
 };
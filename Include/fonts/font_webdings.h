@@ -7,6 +7,8 @@
 // Project Name:  Webdings
 //---------------------------------------------------------------
 
+#include "graphics.h"
+
 //---------------------------------------------------------------
 // Group Name: Webdings14
 // Designer: Imported System Font
@@ -20,402 +22,613 @@
 // Start Character: 32 " "
 // Stop Character: 127 "."
 //---------------------------------------------------------------
-const unsigned char Webdings14[] = 
+const unsigned char Webdings14_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x60,	// Number of Bitmaps 
-	0x15,	// Height 
-
-	// Bitmap Index (number of index entries 96)
- 	0x0, 0xC5, // Index 0 (offset: 197)
-	0x0, 0xCC, // Index 1 (offset: 204)
-	0x0, 0xF4, // Index 2 (offset: 244)
-	0x1, 0x2E, // Index 3 (offset: 302)
-	0x1, 0x5C, // Index 4 (offset: 348)
-	0x1, 0x84, // Index 5 (offset: 388)
-	0x1, 0xB5, // Index 6 (offset: 437)
-	0x1, 0xCE, // Index 7 (offset: 462)
-	0x1, 0xE7, // Index 8 (offset: 487)
-	0x2, 0x1E, // Index 9 (offset: 542)
-	0x2, 0x55, // Index 10 (offset: 597)
-	0x2, 0x8F, // Index 11 (offset: 655)
-	0x2, 0xC9, // Index 12 (offset: 713)
-	0x2, 0xF7, // Index 13 (offset: 759)
-	0x3, 0x13, // Index 14 (offset: 787)
-	0x3, 0x4D, // Index 15 (offset: 845)
-	0x3, 0x84, // Index 16 (offset: 900)
-	0x3, 0xA0, // Index 17 (offset: 928)
-	0x3, 0xCE, // Index 18 (offset: 974)
-	0x3, 0xFC, // Index 19 (offset: 1020)
-	0x4, 0xF, // Index 20 (offset: 1039)
-	0x4, 0x22, // Index 21 (offset: 1058)
-	0x4, 0x47, // Index 22 (offset: 1095)
-	0x4, 0x6C, // Index 23 (offset: 1132)
-	0x4, 0x91, // Index 24 (offset: 1169)
-	0x4, 0xB6, // Index 25 (offset: 1206)
-	0x4, 0xE1, // Index 26 (offset: 1249)
-	0x5, 0xC, // Index 27 (offset: 1292)
-	0x5, 0x1F, // Index 28 (offset: 1311)
-	0x5, 0x41, // Index 29 (offset: 1345)
-	0x5, 0x63, // Index 30 (offset: 1379)
-	0x5, 0x91, // Index 31 (offset: 1425)
-	0x5, 0xBF, // Index 32 (offset: 1471)
-	0x5, 0xF3, // Index 33 (offset: 1523)
-	0x6, 0x2D, // Index 34 (offset: 1581)
-	0x6, 0x6A, // Index 35 (offset: 1642)
-	0x6, 0xA4, // Index 36 (offset: 1700)
-	0x6, 0xDE, // Index 37 (offset: 1758)
-	0x7, 0x18, // Index 38 (offset: 1816)
-	0x7, 0x52, // Index 39 (offset: 1874)
-	0x7, 0x8C, // Index 40 (offset: 1932)
-	0x7, 0xC6, // Index 41 (offset: 1990)
-	0x8, 0x0, // Index 42 (offset: 2048)
-	0x8, 0x3A, // Index 43 (offset: 2106)
-	0x8, 0x77, // Index 44 (offset: 2167)
-	0x8, 0x93, // Index 45 (offset: 2195)
-	0x8, 0xCD, // Index 46 (offset: 2253)
-	0x8, 0xFB, // Index 47 (offset: 2299)
-	0x9, 0x20, // Index 48 (offset: 2336)
-	0x9, 0x5A, // Index 49 (offset: 2394)
-	0x9, 0x94, // Index 50 (offset: 2452)
-	0x9, 0xCE, // Index 51 (offset: 2510)
-	0xA, 0x8, // Index 52 (offset: 2568)
-	0xA, 0x42, // Index 53 (offset: 2626)
-	0xA, 0x7C, // Index 54 (offset: 2684)
-	0xA, 0xA4, // Index 55 (offset: 2724)
-	0xA, 0xBA, // Index 56 (offset: 2746)
-	0xA, 0xD0, // Index 57 (offset: 2768)
-	0xA, 0xFB, // Index 58 (offset: 2811)
-	0xB, 0x20, // Index 59 (offset: 2848)
-	0xB, 0x57, // Index 60 (offset: 2903)
-	0xB, 0x8E, // Index 61 (offset: 2958)
-	0xB, 0xC2, // Index 62 (offset: 3010)
-	0xB, 0xFC, // Index 63 (offset: 3068)
-	0xC, 0x36, // Index 64 (offset: 3126)
-	0xC, 0x64, // Index 65 (offset: 3172)
-	0xC, 0x7D, // Index 66 (offset: 3197)
-	0xC, 0xA8, // Index 67 (offset: 3240)
-	0xC, 0xE2, // Index 68 (offset: 3298)
-	0xD, 0xA, // Index 69 (offset: 3338)
-	0xD, 0x35, // Index 70 (offset: 3381)
-	0xD, 0x5D, // Index 71 (offset: 3421)
-	0xD, 0x97, // Index 72 (offset: 3479)
-	0xD, 0xC5, // Index 73 (offset: 3525)
-	0xD, 0xF3, // Index 74 (offset: 3571)
-	0xE, 0x24, // Index 75 (offset: 3620)
-	0xE, 0x52, // Index 76 (offset: 3666)
-	0xE, 0x7D, // Index 77 (offset: 3709)
-	0xE, 0x8D, // Index 78 (offset: 3725)
-	0xE, 0xC7, // Index 79 (offset: 3783)
-	0xE, 0xFB, // Index 80 (offset: 3835)
-	0xF, 0x32, // Index 81 (offset: 3890)
-	0xF, 0x57, // Index 82 (offset: 3927)
-	0xF, 0x7F, // Index 83 (offset: 3967)
-	0xF, 0xA1, // Index 84 (offset: 4001)
-	0xF, 0xDB, // Index 85 (offset: 4059)
-	0x10, 0x15, // Index 86 (offset: 4117)
-	0x10, 0x37, // Index 87 (offset: 4151)
-	0x10, 0x47, // Index 88 (offset: 4167)
-	0x10, 0x75, // Index 89 (offset: 4213)
-	0x10, 0xA3, // Index 90 (offset: 4259)
-	0x10, 0xD1, // Index 91 (offset: 4305)
-	0x11, 0xB, // Index 92 (offset: 4363)
-	0x11, 0xF, // Index 93 (offset: 4367)
-	0x11, 0x49, // Index 94 (offset: 4425)
-	0x11, 0x77, // Index 95 (offset: 4471)
-
 	/* Index 0, character 32 " " (width: 2 pixels) */
-	0x2, 0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 13 pixels) */
-	0xD, 0x00,0xE0,0x00,0x80,0x2F,0x0F,0x00,0xE8,0x01,0x80,0x1F,0x02,0x60,0xF8,0x01,0x00,0xFF,0x03,0x00,0xFF,0x07,0x00,0xFF,0x07,0x60,0xF8,0x01,0x80,0x1F,0x03,0x00,0xE8,0x0C,0x80,0x2F,0x03,0x00,0xE0,0x00,
+	0x00,0xE0,0x00,0x80,0x2F,0x0F,0x00,0xE8,0x01,0x80,0x1F,0x02,0x60,0xF8,0x01,0x00,0xFF,0x03,0x00,0xFF,0x07,0x00,0xFF,0x07,0x60,0xF8,0x01,0x80,0x1F,0x03,0x00,0xE8,0x0C,0x80,0x2F,0x03,0x00,0xE0,0x00,
 
 	/* Index 2, character 34 """ (width: 19 pixels) */
-	0x13, 0x00,0x04,0x00,0x00,0x1C,0x00,0x00,0x6C,0x00,0x00,0x8A,0x07,0x00,0x79,0x18,0x80,0x94,0x1D,0x40,0x32,0x16,0x20,0xD9,0x15,0x20,0x65,0x15,0xF8,0x7F,0x15,0x20,0xA5,0x15,0x40,0xFA,0x15,0x80,0x12,0x17,0x00,0xF5,0x1C,0x00,0x19,0x1E,0x00,0xCA,0x01,0x00,0x3C,0x00,0x00,0x0C,0x00,0x00,0x04,0x00,
+	0x00,0x04,0x00,0x00,0x1C,0x00,0x00,0x6C,0x00,0x00,0x8A,0x07,0x00,0x79,0x18,0x80,0x94,0x1D,0x40,0x32,0x16,0x20,0xD9,0x15,0x20,0x65,0x15,0xF8,0x7F,0x15,0x20,0xA5,0x15,0x40,0xFA,0x15,0x80,0x12,0x17,0x00,0xF5,0x1C,0x00,0x19,0x1E,0x00,0xCA,0x01,0x00,0x3C,0x00,0x00,0x0C,0x00,0x00,0x04,0x00,
 
 	/* Index 3, character 35 "#" (width: 15 pixels) */
-	0xF, 0x00,0x7C,0x00,0x00,0x83,0x01,0x80,0x01,0x02,0x40,0x03,0x04,0x40,0x1C,0x04,0xA0,0xFF,0x09,0xA0,0xDA,0x0B,0xA0,0x7A,0x0B,0xA0,0x4E,0x0B,0x20,0xCF,0x0B,0x40,0xFE,0x05,0x40,0x00,0x07,0x80,0x00,0x02,0x00,0x83,0x01,0x00,0x7C,0x00,
+	0x00,0x7C,0x00,0x00,0x83,0x01,0x80,0x01,0x02,0x40,0x03,0x04,0x40,0x1C,0x04,0xA0,0xFF,0x09,0xA0,0xDA,0x0B,0xA0,0x7A,0x0B,0xA0,0x4E,0x0B,0x20,0xCF,0x0B,0x40,0xFE,0x05,0x40,0x00,0x07,0x80,0x00,0x02,0x00,0x83,0x01,0x00,0x7C,0x00,
 
 	/* Index 4, character 36 "$" (width: 13 pixels) */
-	0xD, 0x00,0x06,0x00,0x00,0x1E,0x00,0x00,0x3A,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x02,0x00,0x00,0x1E,0x00,0x00,0x3A,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,
+	0x00,0x06,0x00,0x00,0x1E,0x00,0x00,0x3A,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x02,0x00,0x00,0x1E,0x00,0x00,0x3A,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,
 
 	/* Index 5, character 37 "%" (width: 16 pixels) */
-	0x10, 0xE0,0x00,0x00,0xA0,0x01,0x00,0x10,0x01,0x00,0x70,0x09,0x00,0xB0,0x1F,0x00,0x30,0x30,0x02,0xF0,0xAF,0x03,0xF0,0xFF,0x03,0xF0,0xFF,0x03,0xF0,0xBF,0x03,0xF0,0x1F,0x02,0x70,0x0A,0x00,0x20,0x09,0x00,0x10,0x01,0x00,0xE0,0x01,0x00,0xE0,0x00,0x00,
+	0xE0,0x00,0x00,0xA0,0x01,0x00,0x10,0x01,0x00,0x70,0x09,0x00,0xB0,0x1F,0x00,0x30,0x30,0x02,0xF0,0xAF,0x03,0xF0,0xFF,0x03,0xF0,0xFF,0x03,0xF0,0xBF,0x03,0xF0,0x1F,0x02,0x70,0x0A,0x00,0x20,0x09,0x00,0x10,0x01,0x00,0xE0,0x01,0x00,0xE0,0x00,0x00,
 
 	/* Index 6, character 38 "&" (width: 8 pixels) */
-	0x8, 0xF0,0xC3,0x07,0xF0,0x67,0x04,0xF0,0x1F,0x08,0x10,0x14,0x08,0x10,0x14,0x08,0xF0,0x3F,0x0C,0xF0,0x67,0x04,0xF0,0xC3,0x03,
+	0xF0,0xC3,0x07,0xF0,0x67,0x04,0xF0,0x1F,0x08,0x10,0x14,0x08,0x10,0x14,0x08,0xF0,0x3F,0x0C,0xF0,0x67,0x04,0xF0,0xC3,0x03,
 
 	/* Index 7, character 39 "'" (width: 8 pixels) */
-	0x8, 0x00,0x07,0x06,0x00,0x1B,0x09,0x80,0xAA,0x08,0x40,0xC6,0x0C,0x40,0xCC,0x06,0x20,0xB2,0x02,0x20,0xE1,0x01,0xC0,0xC0,0x00,
+	0x00,0x07,0x06,0x00,0x1B,0x09,0x80,0xAA,0x08,0x40,0xC6,0x0C,0x40,0xCC,0x06,0x20,0xB2,0x02,0x20,0xE1,0x01,0xC0,0xC0,0x00,
 
 	/* Index 8, character 40 "(" (width: 18 pixels) */
-	0x12, 0x00,0x1C,0x00,0x00,0x3E,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x00,0xFF,0x01,0x00,0xFF,0x03,0x00,0xFF,0x03,0x00,0x3E,0x02,0x00,0x1C,0x02,
+	0x00,0x1C,0x00,0x00,0x3E,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x00,0xFF,0x01,0x00,0xFF,0x03,0x00,0xFF,0x03,0x00,0x3E,0x02,0x00,0x1C,0x02,
 
 	/* Index 9, character 41 ")" (width: 18 pixels) */
-	0x12, 0x00,0x1C,0x02,0x00,0x3E,0x02,0x00,0xFF,0x03,0x00,0xFF,0x03,0x00,0xFF,0x01,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,0x3E,0x00,0x00,0x1C,0x00,
+	0x00,0x1C,0x02,0x00,0x3E,0x02,0x00,0xFF,0x03,0x00,0xFF,0x03,0x00,0xFF,0x01,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,0x7F,0x00,0x00,0x3E,0x00,0x00,0x1C,0x00,
 
 	/* Index 10, character 42 "*" (width: 19 pixels) */
-	0x13, 0x00,0x08,0x00,0x00,0x49,0x00,0x40,0x7F,0x01,0xC0,0xFF,0x01,0x80,0xFF,0x00,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0x80,0xFF,0x00,0xC0,0xFF,0x01,0x40,0x7F,0x01,0x00,0x49,0x00,0x00,0x08,0x00,
+	0x00,0x08,0x00,0x00,0x49,0x00,0x40,0x7F,0x01,0xC0,0xFF,0x01,0x80,0xFF,0x00,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0x80,0xFF,0x00,0xC0,0xFF,0x01,0x40,0x7F,0x01,0x00,0x49,0x00,0x00,0x08,0x00,
 
 	/* Index 11, character 43 "+" (width: 19 pixels) */
-	0x13, 0x00,0x08,0x00,0x00,0x49,0x00,0x40,0x7F,0x01,0xC0,0xFF,0x01,0x80,0xBF,0x00,0xC0,0xDF,0x01,0xE0,0xE7,0x03,0xC0,0xF3,0x01,0xC0,0xF1,0x01,0x60,0xF8,0x03,0xC0,0xE1,0x01,0xC0,0xF8,0x01,0x40,0xFC,0x03,0x20,0xFF,0x01,0xD0,0xFF,0x00,0xF0,0xFF,0x01,0x68,0x7F,0x01,0x00,0x4D,0x00,0x00,0x08,0x00,
+	0x00,0x08,0x00,0x00,0x49,0x00,0x40,0x7F,0x01,0xC0,0xFF,0x01,0x80,0xBF,0x00,0xC0,0xDF,0x01,0xE0,0xE7,0x03,0xC0,0xF3,0x01,0xC0,0xF1,0x01,0x60,0xF8,0x03,0xC0,0xE1,0x01,0xC0,0xF8,0x01,0x40,0xFC,0x03,0x20,0xFF,0x01,0xD0,0xFF,0x00,0xF0,0xFF,0x01,0x68,0x7F,0x01,0x00,0x4D,0x00,0x00,0x08,0x00,
 
 	/* Index 12, character 44 "," (width: 15 pixels) */
-	0xF, 0x00,0x00,0x02,0x00,0x00,0x03,0x00,0xC0,0x03,0x00,0xA0,0x01,0x00,0xD0,0x01,0x00,0xE8,0x01,0x00,0xF4,0x00,0x00,0xFE,0x00,0x00,0xFE,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,
+	0x00,0x00,0x02,0x00,0x00,0x03,0x00,0xC0,0x03,0x00,0xA0,0x01,0x00,0xD0,0x01,0x00,0xE8,0x01,0x00,0xF4,0x00,0x00,0xFE,0x00,0x00,0xFE,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,
 
 	/* Index 13, character 45 "-" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x07,0xC0,0x81,0x07,0xE0,0xE7,0x01,0x30,0xFF,0x00,0x10,0x3E,0x00,0x10,0xFF,0x00,0xF0,0xE7,0x03,0xE0,0x81,0x07,0x00,0x00,0x06,
+	0x00,0x00,0x07,0xC0,0x81,0x07,0xE0,0xE7,0x01,0x30,0xFF,0x00,0x10,0x3E,0x00,0x10,0xFF,0x00,0xF0,0xE7,0x03,0xE0,0x81,0x07,0x00,0x00,0x06,
 
 	/* Index 14, character 46 "." (width: 19 pixels) */
-	0x13, 0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,
+	0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,
 
 	/* Index 15, character 47 "/" (width: 18 pixels) */
-	0x12, 0x00,0x00,0x18,0x00,0x00,0x1E,0x00,0x80,0x1F,0x00,0xF0,0x1F,0x00,0xFC,0x1F,0x00,0xFF,0x1F,0xC0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x07,0xF8,0xFF,0x01,0xF8,0x7F,0x00,0xF8,0x1F,0x00,0xF8,0x03,0x00,0xF8,0x00,0x00,0x38,0x00,0x00,0x08,0x00,0x00,
+	0x00,0x00,0x18,0x00,0x00,0x1E,0x00,0x80,0x1F,0x00,0xF0,0x1F,0x00,0xFC,0x1F,0x00,0xFF,0x1F,0xC0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x07,0xF8,0xFF,0x01,0xF8,0x7F,0x00,0xF8,0x1F,0x00,0xF8,0x03,0x00,0xF8,0x00,0x00,0x38,0x00,0x00,0x08,0x00,0x00,
 
 	/* Index 16, character 48 "0" (width: 9 pixels) */
-	0x9, 0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,
+	0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,
 
 	/* Index 17, character 49 "1" (width: 15 pixels) */
-	0xF, 0x80,0xFF,0x0F,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0xFF,0x0F,
+	0x80,0xFF,0x0F,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0xFF,0x0F,
 
 	/* Index 18, character 50 "2" (width: 15 pixels) */
-	0xF, 0x00,0xF0,0x0F,0x00,0x30,0x08,0x00,0x30,0x08,0x00,0x30,0x08,0x80,0x3F,0x08,0x80,0x31,0x08,0x80,0x31,0x08,0x80,0x31,0x08,0x80,0x31,0x08,0x80,0x31,0x08,0x80,0xF1,0x0F,0x80,0x41,0x00,0x80,0x41,0x00,0x80,0x41,0x00,0x80,0x7F,0x00,
+	0x00,0xF0,0x0F,0x00,0x30,0x08,0x00,0x30,0x08,0x00,0x30,0x08,0x80,0x3F,0x08,0x80,0x31,0x08,0x80,0x31,0x08,0x80,0x31,0x08,0x80,0x31,0x08,0x80,0x31,0x08,0x80,0xF1,0x0F,0x80,0x41,0x00,0x80,0x41,0x00,0x80,0x41,0x00,0x80,0x7F,0x00,
 
 	/* Index 19, character 51 "3" (width: 6 pixels) */
-	0x6, 0x00,0x18,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xFF,0x01,0xC0,0xFF,0x03,
+	0x00,0x18,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xFF,0x01,0xC0,0xFF,0x03,
 
 	/* Index 20, character 52 "4" (width: 6 pixels) */
-	0x6, 0xC0,0xFF,0x03,0x80,0xFF,0x01,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x18,0x00,
+	0xC0,0xFF,0x03,0x80,0xFF,0x01,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x18,0x00,
 
 	/* Index 21, character 53 "5" (width: 12 pixels) */
-	0xC, 0x00,0x40,0x00,0x00,0x60,0x00,0x00,0x70,0x00,0x00,0x78,0x00,0x00,0x7C,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7C,0x00,0x00,0x78,0x00,0x00,0x70,0x00,0x00,0x60,0x00,0x00,0x40,0x00,
+	0x00,0x40,0x00,0x00,0x60,0x00,0x00,0x70,0x00,0x00,0x78,0x00,0x00,0x7C,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7C,0x00,0x00,0x78,0x00,0x00,0x70,0x00,0x00,0x60,0x00,0x00,0x40,0x00,
 
 	/* Index 22, character 54 "6" (width: 12 pixels) */
-	0xC, 0x00,0x04,0x00,0x00,0x0C,0x00,0x00,0x1C,0x00,0x00,0x3C,0x00,0x00,0x7C,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x0C,0x00,0x00,0x04,0x00,
+	0x00,0x04,0x00,0x00,0x0C,0x00,0x00,0x1C,0x00,0x00,0x3C,0x00,0x00,0x7C,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x0C,0x00,0x00,0x04,0x00,
 
 	/* Index 23, character 55 "7" (width: 12 pixels) */
-	0xC, 0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,
+	0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,
 
 	/* Index 24, character 56 "8" (width: 12 pixels) */
-	0xC, 0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,
+	0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,
 
 	/* Index 25, character 57 "9" (width: 14 pixels) */
-	0xE, 0x80,0xFF,0x07,0x80,0xFF,0x07,0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,
+	0x80,0xFF,0x07,0x80,0xFF,0x07,0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,
 
 	/* Index 26, character 58 ":" (width: 14 pixels) */
-	0xE, 0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,0x80,0xFF,0x07,0x80,0xFF,0x07,
+	0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,0x80,0xFF,0x07,0x80,0xFF,0x07,
 
 	/* Index 27, character 59 ";" (width: 6 pixels) */
-	0x6, 0x80,0xFF,0x07,0x80,0xFF,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0x07,0x80,0xFF,0x07,
+	0x80,0xFF,0x07,0x80,0xFF,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0x07,0x80,0xFF,0x07,
 
 	/* Index 28, character 60 "<" (width: 11 pixels) */
-	0xB, 0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,
+	0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,
 
 	/* Index 29, character 61 "=" (width: 11 pixels) */
-	0xB, 0x00,0x7C,0x00,0x00,0xFE,0x00,0x00,0xFF,0x01,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x00,0xFF,0x01,0x00,0xFE,0x00,0x00,0x7C,0x00,
+	0x00,0x7C,0x00,0x00,0xFE,0x00,0x00,0xFF,0x01,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x00,0xFF,0x01,0x00,0xFE,0x00,0x00,0x7C,0x00,
 
 	/* Index 30, character 62 ">" (width: 15 pixels) */
-	0xF, 0x00,0x00,0x02,0x00,0xC0,0x01,0x00,0xF0,0x00,0x00,0x98,0x00,0x00,0xF8,0x01,0x00,0xE0,0x02,0x00,0xC0,0x03,0x00,0xF0,0x00,0x00,0x7E,0x00,0x00,0x47,0x00,0x00,0x47,0x00,0x00,0x7E,0x00,0x00,0xF0,0x00,0x00,0xC0,0x03,0x00,0x00,0x02,
+	0x00,0x00,0x02,0x00,0xC0,0x01,0x00,0xF0,0x00,0x00,0x98,0x00,0x00,0xF8,0x01,0x00,0xE0,0x02,0x00,0xC0,0x03,0x00,0xF0,0x00,0x00,0x7E,0x00,0x00,0x47,0x00,0x00,0x47,0x00,0x00,0x7E,0x00,0x00,0xF0,0x00,0x00,0xC0,0x03,0x00,0x00,0x02,
 
 	/* Index 31, character 63 "?" (width: 15 pixels) */
-	0xF, 0x00,0xE0,0x03,0x00,0xE0,0x07,0x00,0xE0,0x07,0x00,0xF0,0x07,0x00,0xF2,0x0F,0x00,0xF5,0x0F,0x80,0xFC,0x1F,0x80,0xF6,0x1F,0x40,0xC2,0x1F,0xE0,0xFF,0x0F,0x40,0xE2,0x0F,0x80,0xF2,0x07,0x00,0xEB,0x07,0x00,0xEA,0x07,0x00,0xE6,0x03,
+	0x00,0xE0,0x03,0x00,0xE0,0x07,0x00,0xE0,0x07,0x00,0xF0,0x07,0x00,0xF2,0x0F,0x00,0xF5,0x0F,0x80,0xFC,0x1F,0x80,0xF6,0x1F,0x40,0xC2,0x1F,0xE0,0xFF,0x0F,0x40,0xE2,0x0F,0x80,0xF2,0x07,0x00,0xEB,0x07,0x00,0xEA,0x07,0x00,0xE6,0x03,
 
 	/* Index 32, character 64 "@" (width: 17 pixels) */
-	0x11, 0x00,0x02,0x00,0x00,0x07,0x00,0x00,0x0F,0x03,0xC0,0x83,0x01,0xC0,0x83,0x09,0xE0,0x87,0x0B,0x60,0xCE,0x07,0x60,0xFC,0x01,0x40,0xFC,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x80,0xCF,0x03,0xC0,0x87,0x07,0x40,0x06,0x0F,0x00,0x06,0x06,0x00,0x03,0x00,
+	0x00,0x02,0x00,0x00,0x07,0x00,0x00,0x0F,0x03,0xC0,0x83,0x01,0xC0,0x83,0x09,0xE0,0x87,0x0B,0x60,0xCE,0x07,0x60,0xFC,0x01,0x40,0xFC,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x80,0xCF,0x03,0xC0,0x87,0x07,0x40,0x06,0x0F,0x00,0x06,0x06,0x00,0x03,0x00,
 
 	/* Index 33, character 65 "A" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x38,0xE0,0x1F,0x28,0x00,0x10,0xB8,0xFF,0x17,0xB8,0x24,0x15,0xB8,0xFF,0x17,0x38,0x00,0x10,0x38,0xE0,0x1F,0x28,0xEF,0x1F,0xF8,0xE9,0x1F,0x38,0xE4,0x1F,0x38,0xE0,0x1F,0x38,0x8A,0x1F,0x28,0xBF,0x1F,0x38,0xCA,0x1F,0x00,0x8A,0x1F,0x00,0xBF,0x1F,0x00,0x8A,0x1F,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x38,0xE0,0x1F,0x28,0x00,0x10,0xB8,0xFF,0x17,0xB8,0x24,0x15,0xB8,0xFF,0x17,0x38,0x00,0x10,0x38,0xE0,0x1F,0x28,0xEF,0x1F,0xF8,0xE9,0x1F,0x38,0xE4,0x1F,0x38,0xE0,0x1F,0x38,0x8A,0x1F,0x28,0xBF,0x1F,0x38,0xCA,0x1F,0x00,0x8A,0x1F,0x00,0xBF,0x1F,0x00,0x8A,0x1F,0x00,0xE0,0x1F,
 
 	/* Index 34, character 66 "B" (width: 20 pixels) */
-	0x14, 0x00,0xE0,0x1F,0x00,0xFA,0x1F,0x00,0x07,0x1F,0x80,0xF3,0x1F,0xC0,0xF1,0x17,0xA0,0x34,0x13,0xA0,0xFF,0x13,0xE0,0x01,0x12,0xE0,0xE1,0x07,0x00,0xE1,0x0F,0x80,0x00,0x0E,0x80,0xE0,0x0E,0xC0,0xE1,0x0E,0xC0,0xE0,0x0E,0xA0,0x0B,0x0E,0x40,0xF4,0x1F,0x60,0xD8,0x1F,0xE0,0xC0,0x1F,0x00,0xFF,0x1F,0x00,0x02,0x00,
+	0x00,0xE0,0x1F,0x00,0xFA,0x1F,0x00,0x07,0x1F,0x80,0xF3,0x1F,0xC0,0xF1,0x17,0xA0,0x34,0x13,0xA0,0xFF,0x13,0xE0,0x01,0x12,0xE0,0xE1,0x07,0x00,0xE1,0x0F,0x80,0x00,0x0E,0x80,0xE0,0x0E,0xC0,0xE1,0x0E,0xC0,0xE0,0x0E,0xA0,0x0B,0x0E,0x40,0xF4,0x1F,0x60,0xD8,0x1F,0xE0,0xC0,0x1F,0x00,0xFF,0x1F,0x00,0x02,0x00,
 
 	/* Index 35, character 67 "C" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x00,0xFC,0x1F,0x00,0xFC,0x1F,0x00,0x54,0x1F,0x80,0xFF,0x1F,0x80,0xDB,0x1F,0xF0,0xFD,0x1F,0x70,0xAF,0x1F,0xD0,0xFF,0x1F,0xF0,0xEF,0x1F,0x00,0xFC,0x1F,0x80,0xFF,0x1D,0xC0,0xFD,0x1F,0x40,0xFF,0x1F,0xC0,0xFF,0x1D,0x00,0x5C,0x1F,0x00,0xF4,0x1F,0x00,0xFC,0x1F,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x00,0xFC,0x1F,0x00,0xFC,0x1F,0x00,0x54,0x1F,0x80,0xFF,0x1F,0x80,0xDB,0x1F,0xF0,0xFD,0x1F,0x70,0xAF,0x1F,0xD0,0xFF,0x1F,0xF0,0xEF,0x1F,0x00,0xFC,0x1F,0x80,0xFF,0x1D,0xC0,0xFD,0x1F,0x40,0xFF,0x1F,0xC0,0xFF,0x1D,0x00,0x5C,0x1F,0x00,0xF4,0x1F,0x00,0xFC,0x1F,0x00,0xE0,0x1F,
 
 	/* Index 36, character 68 "D" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x00,0xE4,0x1F,0x00,0xEA,0x1D,0x00,0xF9,0x18,0x00,0x41,0x19,0x80,0xA2,0x1A,0x40,0xF5,0x13,0x60,0xF6,0x13,0x20,0xFC,0x17,0x10,0x1C,0x17,0x20,0x2C,0x07,0x20,0x3E,0x07,0x70,0x76,0x07,0x10,0xF5,0x07,0xF0,0x42,0x0F,0x00,0xF9,0x0F,0x00,0xEA,0x1F,0x00,0xE4,0x1F,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x00,0xE4,0x1F,0x00,0xEA,0x1D,0x00,0xF9,0x18,0x00,0x41,0x19,0x80,0xA2,0x1A,0x40,0xF5,0x13,0x60,0xF6,0x13,0x20,0xFC,0x17,0x10,0x1C,0x17,0x20,0x2C,0x07,0x20,0x3E,0x07,0x70,0x76,0x07,0x10,0xF5,0x07,0xF0,0x42,0x0F,0x00,0xF9,0x0F,0x00,0xEA,0x1F,0x00,0xE4,0x1F,0x00,0xE0,0x1F,
 
 	/* Index 37, character 69 "E" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x00,0xE0,0x1F,0xC0,0xE3,0x1F,0xE0,0xF7,0x1F,0xE0,0x97,0x1F,0xE0,0xF7,0x1F,0xE0,0xE7,0x1F,0xC0,0xE3,0x1F,0x00,0xE0,0x1F,0x00,0xB0,0x1F,0x00,0x90,0x1F,0xC0,0xF3,0x1F,0x00,0xF4,0x1F,0x00,0xE4,0x1F,0xF0,0xFF,0x1F,0x00,0xE8,0x1F,0x00,0xEF,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x00,0xE0,0x1F,0xC0,0xE3,0x1F,0xE0,0xF7,0x1F,0xE0,0x97,0x1F,0xE0,0xF7,0x1F,0xE0,0xE7,0x1F,0xC0,0xE3,0x1F,0x00,0xE0,0x1F,0x00,0xB0,0x1F,0x00,0x90,0x1F,0xC0,0xF3,0x1F,0x00,0xF4,0x1F,0x00,0xE4,0x1F,0xF0,0xFF,0x1F,0x00,0xE8,0x1F,0x00,0xEF,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
 
 	/* Index 38, character 70 "F" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x00,0xE0,0x1F,0x80,0xFF,0x1F,0x00,0x01,0x1F,0x00,0x39,0x1F,0x00,0x3A,0x1F,0x80,0x3B,0x1F,0x00,0x01,0x1F,0x00,0x3A,0x1F,0x80,0x3B,0x1F,0x00,0x39,0x1F,0x00,0x02,0x1F,0x80,0x3B,0x1F,0x60,0x38,0x1F,0x20,0x38,0x1F,0x20,0x00,0x1F,0xE0,0xFF,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x00,0xE0,0x1F,0x80,0xFF,0x1F,0x00,0x01,0x1F,0x00,0x39,0x1F,0x00,0x3A,0x1F,0x80,0x3B,0x1F,0x00,0x01,0x1F,0x00,0x3A,0x1F,0x80,0x3B,0x1F,0x00,0x39,0x1F,0x00,0x02,0x1F,0x80,0x3B,0x1F,0x60,0x38,0x1F,0x20,0x38,0x1F,0x20,0x00,0x1F,0xE0,0xFF,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
 
 	/* Index 39, character 71 "G" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x00,0xE0,0x17,0x00,0xE0,0x13,0x80,0xE1,0x11,0x40,0xFF,0x11,0x40,0x03,0x11,0x40,0xFF,0x11,0x40,0x03,0x11,0x60,0xFF,0x11,0x60,0xFF,0x11,0x60,0xFF,0x11,0x40,0x03,0x11,0x40,0xFF,0x11,0x40,0x03,0x11,0x40,0xFF,0x11,0x80,0xE1,0x11,0x00,0xE0,0x13,0x00,0xE0,0x17,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x00,0xE0,0x17,0x00,0xE0,0x13,0x80,0xE1,0x11,0x40,0xFF,0x11,0x40,0x03,0x11,0x40,0xFF,0x11,0x40,0x03,0x11,0x60,0xFF,0x11,0x60,0xFF,0x11,0x60,0xFF,0x11,0x40,0x03,0x11,0x40,0xFF,0x11,0x40,0x03,0x11,0x40,0xFF,0x11,0x80,0xE1,0x11,0x00,0xE0,0x13,0x00,0xE0,0x17,0x00,0xE0,0x1F,
 
 	/* Index 40, character 72 "H" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x00,0xE4,0x1F,0x00,0xEA,0x19,0x00,0xF9,0x19,0x00,0x01,0x19,0x80,0x00,0x13,0x40,0xF8,0x12,0x40,0xF8,0x16,0x20,0xF8,0x16,0x10,0x00,0x07,0x10,0x00,0x07,0x20,0x38,0x07,0x70,0x38,0x07,0x10,0x38,0x0F,0xF0,0x00,0x0F,0x00,0xF9,0x0F,0x00,0xEA,0x1F,0x00,0xE4,0x1F,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x00,0xE4,0x1F,0x00,0xEA,0x19,0x00,0xF9,0x19,0x00,0x01,0x19,0x80,0x00,0x13,0x40,0xF8,0x12,0x40,0xF8,0x16,0x20,0xF8,0x16,0x10,0x00,0x07,0x10,0x00,0x07,0x20,0x38,0x07,0x70,0x38,0x07,0x10,0x38,0x0F,0xF0,0x00,0x0F,0x00,0xF9,0x0F,0x00,0xEA,0x1F,0x00,0xE4,0x1F,0x00,0xE0,0x1F,
 
 	/* Index 41, character 73 "I" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x00,0xE0,0x1B,0x00,0xF0,0x11,0x00,0xF0,0x05,0x00,0xF0,0x0D,0x20,0xF0,0x15,0xE0,0x70,0x15,0xE0,0x7C,0x06,0xE0,0xF3,0x05,0xE0,0xF1,0x05,0xE0,0xF3,0x05,0xC0,0xF3,0x1E,0x80,0xF3,0x0E,0x00,0xF2,0x06,0x00,0xF0,0x16,0x00,0xF0,0x1E,0x00,0xF0,0x1A,0x00,0xE0,0x1D,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x00,0xE0,0x1B,0x00,0xF0,0x11,0x00,0xF0,0x05,0x00,0xF0,0x0D,0x20,0xF0,0x15,0xE0,0x70,0x15,0xE0,0x7C,0x06,0xE0,0xF3,0x05,0xE0,0xF1,0x05,0xE0,0xF3,0x05,0xC0,0xF3,0x1E,0x80,0xF3,0x0E,0x00,0xF2,0x06,0x00,0xF0,0x16,0x00,0xF0,0x1E,0x00,0xF0,0x1A,0x00,0xE0,0x1D,0x00,0xE0,0x1F,
 
 	/* Index 42, character 74 "J" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x00,0xE0,0x1F,0x00,0x20,0x1F,0x00,0x20,0x1F,0x00,0x20,0x1F,0x00,0x10,0x1E,0x00,0x10,0x1E,0xA0,0x11,0x1E,0xE0,0x10,0x1E,0x78,0x10,0x1E,0xE8,0x35,0x1E,0x70,0x3A,0x1E,0xD0,0x30,0x1E,0x90,0x31,0x1E,0x20,0x20,0x1E,0x00,0x20,0x1F,0x00,0x60,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x00,0xE0,0x1F,0x00,0x20,0x1F,0x00,0x20,0x1F,0x00,0x20,0x1F,0x00,0x10,0x1E,0x00,0x10,0x1E,0xA0,0x11,0x1E,0xE0,0x10,0x1E,0x78,0x10,0x1E,0xE8,0x35,0x1E,0x70,0x3A,0x1E,0xD0,0x30,0x1E,0x90,0x31,0x1E,0x20,0x20,0x1E,0x00,0x20,0x1F,0x00,0x60,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
 
 	/* Index 43, character 75 "K" (width: 20 pixels) */
-	0x14, 0x00,0xE0,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x0F,0x00,0xE0,0x07,0x00,0xE0,0x03,0x00,0xE0,0x01,0x00,0xE0,0x00,0x00,0xE0,0x00,0x80,0x6F,0x08,0x80,0xE8,0x0D,0x80,0x8B,0x0D,0xC0,0xBB,0x08,0x80,0x8B,0x00,0x80,0xEB,0x01,0x80,0xEB,0x03,0x80,0x8B,0x07,0xC0,0xBB,0x0F,0x80,0x8B,0x1F,0x80,0xE8,0x1F,0x80,0x0F,0x00,
+	0x00,0xE0,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x0F,0x00,0xE0,0x07,0x00,0xE0,0x03,0x00,0xE0,0x01,0x00,0xE0,0x00,0x00,0xE0,0x00,0x80,0x6F,0x08,0x80,0xE8,0x0D,0x80,0x8B,0x0D,0xC0,0xBB,0x08,0x80,0x8B,0x00,0x80,0xEB,0x01,0x80,0xEB,0x03,0x80,0x8B,0x07,0xC0,0xBB,0x0F,0x80,0x8B,0x1F,0x80,0xE8,0x1F,0x80,0x0F,0x00,
 
 	/* Index 44, character 76 "L" (width: 9 pixels) */
-	0x9, 0x80,0x0F,0x00,0xC0,0x1F,0x00,0x60,0x3C,0x00,0xA0,0x72,0x00,0xA0,0xF1,0x0F,0xA0,0x14,0x0E,0x60,0x13,0x00,0xC0,0x08,0x00,0x80,0x07,0x00,
+	0x80,0x0F,0x00,0xC0,0x1F,0x00,0x60,0x3C,0x00,0xA0,0x72,0x00,0xA0,0xF1,0x0F,0xA0,0x14,0x0E,0x60,0x13,0x00,0xC0,0x08,0x00,0x80,0x07,0x00,
 
 	/* Index 45, character 77 "M" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x00,0xF0,0x1F,0x00,0xF8,0x1F,0x00,0xE8,0x1F,0x00,0xF8,0x1F,0x00,0xFC,0x1F,0x00,0xFE,0x1F,0x00,0xFB,0x1F,0x80,0xF0,0x1F,0x40,0xE1,0x1F,0x80,0xF9,0x1F,0x80,0xF9,0x1F,0x80,0xFB,0x1F,0x80,0xF1,0x1F,0x00,0xFB,0x1F,0x00,0xE6,0x1F,0x00,0xF8,0x1F,0x00,0xF0,0x1F,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x00,0xF0,0x1F,0x00,0xF8,0x1F,0x00,0xE8,0x1F,0x00,0xF8,0x1F,0x00,0xFC,0x1F,0x00,0xFE,0x1F,0x00,0xFB,0x1F,0x80,0xF0,0x1F,0x40,0xE1,0x1F,0x80,0xF9,0x1F,0x80,0xF9,0x1F,0x80,0xFB,0x1F,0x80,0xF1,0x1F,0x00,0xFB,0x1F,0x00,0xE6,0x1F,0x00,0xF8,0x1F,0x00,0xF0,0x1F,0x00,0xE0,0x1F,
 
 	/* Index 46, character 78 "N" (width: 15 pixels) */
-	0xF, 0x00,0x0C,0x00,0x00,0x12,0x00,0x00,0x21,0x00,0x80,0x40,0x00,0x80,0x5C,0x00,0x40,0xA0,0x00,0xC0,0xCC,0x00,0xC0,0xDA,0x00,0xC0,0xCE,0x00,0xC0,0xE1,0x00,0x80,0x5E,0x00,0x80,0x40,0x00,0x00,0x21,0x00,0x00,0x12,0x00,0x00,0x0C,0x00,
+	0x00,0x0C,0x00,0x00,0x12,0x00,0x00,0x21,0x00,0x80,0x40,0x00,0x80,0x5C,0x00,0x40,0xA0,0x00,0xC0,0xCC,0x00,0xC0,0xDA,0x00,0xC0,0xCE,0x00,0xC0,0xE1,0x00,0x80,0x5E,0x00,0x80,0x40,0x00,0x00,0x21,0x00,0x00,0x12,0x00,0x00,0x0C,0x00,
 
 	/* Index 47, character 79 "O" (width: 12 pixels) */
-	0xC, 0x00,0x80,0x07,0x00,0x00,0x0C,0x80,0xC7,0x09,0xC0,0x30,0x09,0x60,0xB7,0x08,0xA0,0x44,0x04,0xA0,0x38,0x03,0xA0,0x80,0x00,0xA0,0x49,0x00,0x60,0x27,0x00,0xC0,0x10,0x00,0x80,0x0F,0x00,
+	0x00,0x80,0x07,0x00,0x00,0x0C,0x80,0xC7,0x09,0xC0,0x30,0x09,0x60,0xB7,0x08,0xA0,0x44,0x04,0xA0,0x38,0x03,0xA0,0x80,0x00,0xA0,0x49,0x00,0x60,0x27,0x00,0xC0,0x10,0x00,0x80,0x0F,0x00,
 
 	/* Index 48, character 80 "P" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x00,0xA0,0x1F,0x00,0x20,0x1F,0x00,0x00,0x1F,0x00,0x40,0x1F,0x00,0x60,0x1F,0x00,0x60,0x1F,0x00,0x60,0x0F,0x00,0x68,0x0F,0x00,0x6D,0x07,0xA0,0x6F,0x06,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xA0,0xEF,0x00,0x00,0xED,0x00,0x00,0xE8,0x00,0x00,0xE0,0x19,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x00,0xA0,0x1F,0x00,0x20,0x1F,0x00,0x00,0x1F,0x00,0x40,0x1F,0x00,0x60,0x1F,0x00,0x60,0x1F,0x00,0x60,0x0F,0x00,0x68,0x0F,0x00,0x6D,0x07,0xA0,0x6F,0x06,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xA0,0xEF,0x00,0x00,0xED,0x00,0x00,0xE8,0x00,0x00,0xE0,0x19,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
 
 	/* Index 49, character 81 "Q" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x00,0xE0,0x1D,0x00,0x60,0x1C,0x00,0x18,0x1C,0x00,0xC6,0x1F,0x00,0xC3,0x1F,0x00,0xCC,0x1F,0x00,0x10,0x1C,0x00,0x68,0x1C,0x00,0xED,0x1D,0xA0,0xEF,0x1F,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xA0,0xEF,0x1F,0x00,0xED,0x1F,0x00,0xE8,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x00,0xE0,0x1D,0x00,0x60,0x1C,0x00,0x18,0x1C,0x00,0xC6,0x1F,0x00,0xC3,0x1F,0x00,0xCC,0x1F,0x00,0x10,0x1C,0x00,0x68,0x1C,0x00,0xED,0x1D,0xA0,0xEF,0x1F,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xA0,0xEF,0x1F,0x00,0xED,0x1F,0x00,0xE8,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
 
 	/* Index 50, character 82 "R" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x00,0xE0,0x1F,0x00,0xF0,0x0F,0x00,0xF8,0x07,0x00,0xF8,0x0F,0x00,0xF8,0x1D,0x00,0xF8,0x0C,0x00,0xF0,0x0F,0x00,0xE0,0x0D,0x00,0xA0,0x0D,0x00,0xE0,0x0D,0x00,0x60,0x0F,0x00,0xF0,0x0D,0x00,0xF0,0x15,0x00,0xF0,0x0B,0x00,0xF0,0x0F,0x00,0xE0,0x0F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x00,0xE0,0x1F,0x00,0xF0,0x0F,0x00,0xF8,0x07,0x00,0xF8,0x0F,0x00,0xF8,0x1D,0x00,0xF8,0x0C,0x00,0xF0,0x0F,0x00,0xE0,0x0D,0x00,0xA0,0x0D,0x00,0xE0,0x0D,0x00,0x60,0x0F,0x00,0xF0,0x0D,0x00,0xF0,0x15,0x00,0xF0,0x0B,0x00,0xF0,0x0F,0x00,0xE0,0x0F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
 
 	/* Index 51, character 83 "S" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0xF0,0xC0,0x1F,0x60,0x7F,0x1F,0x20,0xAA,0x1F,0xF8,0xFE,0x1F,0x18,0xB7,0x0E,0x50,0xE5,0x1B,0xF0,0x15,0x1E,0x18,0x15,0x1E,0x14,0xB5,0x1F,0xD0,0xB5,0x1F,0x30,0xB5,0x1D,0x10,0x15,0x1A,0x90,0xB6,0x07,0x68,0xFE,0x1F,0x20,0xAA,0x1F,0x60,0xFF,0x1F,0xD0,0xC0,0x1F,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0xF0,0xC0,0x1F,0x60,0x7F,0x1F,0x20,0xAA,0x1F,0xF8,0xFE,0x1F,0x18,0xB7,0x0E,0x50,0xE5,0x1B,0xF0,0x15,0x1E,0x18,0x15,0x1E,0x14,0xB5,0x1F,0xD0,0xB5,0x1F,0x30,0xB5,0x1D,0x10,0x15,0x1A,0x90,0xB6,0x07,0x68,0xFE,0x1F,0x20,0xAA,0x1F,0x60,0xFF,0x1F,0xD0,0xC0,0x1F,0x00,0xE0,0x1F,
 
 	/* Index 52, character 84 "T" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x00,0xE0,0x1E,0x00,0xE0,0x1E,0x80,0x63,0x1F,0x80,0x66,0x1F,0x80,0xC1,0x1E,0xC0,0x7F,0x1E,0x60,0x7F,0x1F,0xE0,0x7F,0x1E,0xA0,0x7E,0x1C,0xF0,0x7F,0x1D,0xB8,0x7F,0x1D,0xA0,0x7F,0x1D,0xD0,0x7F,0x1D,0xE0,0xBF,0x1F,0x00,0xB8,0x1F,0x00,0xF0,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x00,0xE0,0x1E,0x00,0xE0,0x1E,0x80,0x63,0x1F,0x80,0x66,0x1F,0x80,0xC1,0x1E,0xC0,0x7F,0x1E,0x60,0x7F,0x1F,0xE0,0x7F,0x1E,0xA0,0x7E,0x1C,0xF0,0x7F,0x1D,0xB8,0x7F,0x1D,0xA0,0x7F,0x1D,0xD0,0x7F,0x1D,0xE0,0xBF,0x1F,0x00,0xB8,0x1F,0x00,0xF0,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
 
 	/* Index 53, character 85 "U" (width: 19 pixels) */
-	0x13, 0x00,0x60,0x00,0x00,0x80,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF8,0x03,0x00,0xE4,0x0F,0x00,0x44,0x0C,0x00,0x42,0x00,0x00,0x41,0x00,0x00,0x41,0x00,0xC0,0xDF,0x00,0xC0,0xA7,0x00,0x80,0xFF,0x01,0x00,0xFD,0x01,0x40,0x1E,0x00,0xA0,0x61,0x00,0x40,0x1E,0x00,0x80,0xC0,0x00,0x00,0x3F,0x00,
+	0x00,0x60,0x00,0x00,0x80,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF8,0x03,0x00,0xE4,0x0F,0x00,0x44,0x0C,0x00,0x42,0x00,0x00,0x41,0x00,0x00,0x41,0x00,0xC0,0xDF,0x00,0xC0,0xA7,0x00,0x80,0xFF,0x01,0x00,0xFD,0x01,0x40,0x1E,0x00,0xA0,0x61,0x00,0x40,0x1E,0x00,0x80,0xC0,0x00,0x00,0x3F,0x00,
 
 	/* Index 54, character 86 "V" (width: 13 pixels) */
-	0xD, 0x00,0xC0,0x00,0x00,0x00,0x01,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF8,0x03,0x00,0xC4,0x0F,0x00,0x84,0x0C,0x00,0x82,0x00,0x00,0x81,0x00,0x80,0x9F,0x00,0xC0,0x67,0x01,0x80,0xFF,0x01,0x00,0xFC,0x01,
+	0x00,0xC0,0x00,0x00,0x00,0x01,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF8,0x03,0x00,0xC4,0x0F,0x00,0x84,0x0C,0x00,0x82,0x00,0x00,0x81,0x00,0x80,0x9F,0x00,0xC0,0x67,0x01,0x80,0xFF,0x01,0x00,0xFC,0x01,
 
 	/* Index 55, character 87 "W" (width: 7 pixels) */
-	0x7, 0xC0,0xFF,0x07,0x80,0xFF,0x03,0x00,0xFF,0x01,0x00,0xFE,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,
+	0xC0,0xFF,0x07,0x80,0xFF,0x03,0x00,0xFF,0x01,0x00,0xFE,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,
 
 	/* Index 56, character 88 "X" (width: 7 pixels) */
-	0x7, 0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0xFE,0x00,0x00,0xFF,0x01,0x80,0xFF,0x03,0xC0,0xFF,0x07,
+	0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0xFE,0x00,0x00,0xFF,0x01,0x80,0xFF,0x03,0xC0,0xFF,0x07,
 
 	/* Index 57, character 89 "Y" (width: 14 pixels) */
-	0xE, 0x00,0x0F,0x00,0x80,0x3F,0x00,0xC0,0x7F,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x0F,0xC0,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x03,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x00,0xC0,0x7F,0x00,0x80,0x3F,0x00,0x00,0x0F,0x00,
+	0x00,0x0F,0x00,0x80,0x3F,0x00,0xC0,0x7F,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x0F,0xC0,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x03,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x00,0xC0,0x7F,0x00,0x80,0x3F,0x00,0x00,0x0F,0x00,
 
 	/* Index 58, character 90 "Z" (width: 12 pixels) */
-	0xC, 0x00,0x00,0x0A,0x40,0x00,0x06,0xC0,0x00,0x0F,0x40,0x81,0x03,0x50,0xC1,0x01,0xE8,0xFA,0x00,0xB8,0x35,0x00,0x80,0x1D,0x00,0xE0,0x1A,0x00,0xD0,0x1F,0x00,0x70,0x36,0x00,0x10,0x00,0x00,
+	0x00,0x00,0x0A,0x40,0x00,0x06,0xC0,0x00,0x0F,0x40,0x81,0x03,0x50,0xC1,0x01,0xE8,0xFA,0x00,0xB8,0x35,0x00,0x80,0x1D,0x00,0xE0,0x1A,0x00,0xD0,0x1F,0x00,0x70,0x36,0x00,0x10,0x00,0x00,
 
 	/* Index 59, character 91 "[" (width: 18 pixels) */
-	0x12, 0x00,0x0C,0x00,0x00,0x1F,0x00,0x80,0x7F,0x00,0x80,0x7F,0x00,0x80,0x7F,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x01,0x00,0xFF,0x01,0x00,0xFF,0x06,0x00,0x1E,0x06,0x00,0x00,0x06,
+	0x00,0x0C,0x00,0x00,0x1F,0x00,0x80,0x7F,0x00,0x80,0x7F,0x00,0x80,0x7F,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x01,0x00,0xFF,0x01,0x00,0xFF,0x06,0x00,0x1E,0x06,0x00,0x00,0x06,
 
 	/* Index 60, character 92 "\" (width: 18 pixels) */
-	0x12, 0x08,0x00,0x00,0x38,0x00,0x00,0xF8,0x00,0x00,0xF8,0x03,0x00,0xF8,0x1F,0x00,0xF8,0x7F,0x00,0xF8,0xFF,0x01,0xF8,0xFF,0x07,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF0,0xFF,0x1F,0xC0,0xFF,0x1F,0x00,0xFF,0x1F,0x00,0xFC,0x1F,0x00,0xF0,0x1F,0x00,0x80,0x1F,0x00,0x00,0x1E,0x00,0x00,0x18,
+	0x08,0x00,0x00,0x38,0x00,0x00,0xF8,0x00,0x00,0xF8,0x03,0x00,0xF8,0x1F,0x00,0xF8,0x7F,0x00,0xF8,0xFF,0x01,0xF8,0xFF,0x07,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF0,0xFF,0x1F,0xC0,0xFF,0x1F,0x00,0xFF,0x1F,0x00,0xFC,0x1F,0x00,0xF0,0x1F,0x00,0x80,0x1F,0x00,0x00,0x1E,0x00,0x00,0x18,
 
 	/* Index 61, character 93 "]" (width: 17 pixels) */
-	0x11, 0x00,0x1E,0x06,0x00,0xFF,0x06,0x00,0xFF,0x07,0x80,0xFF,0x01,0x80,0xFF,0x00,0xC0,0xFF,0x00,0x80,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0x80,0x7F,0x00,0x80,0x7F,0x00,0x80,0x7F,0x00,0x00,0x1F,0x00,0x00,0x0C,0x00,
+	0x00,0x1E,0x06,0x00,0xFF,0x06,0x00,0xFF,0x07,0x80,0xFF,0x01,0x80,0xFF,0x00,0xC0,0xFF,0x00,0x80,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x00,0x80,0x7F,0x00,0x80,0x7F,0x00,0x80,0x7F,0x00,0x00,0x1F,0x00,0x00,0x0C,0x00,
 
 	/* Index 62, character 94 "^" (width: 19 pixels) */
-	0x13, 0x00,0x3C,0x02,0x00,0x7E,0x03,0x00,0xFE,0x03,0x00,0xFF,0x01,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x00,0xE0,0x7E,0x00,0xE0,0x7F,0x00,0xF0,0x3F,0x00,0xF0,0x0F,0x00,0xF0,0x0F,0x00,0xF0,0x0F,0x00,0xF0,0x1F,0x00,0xE0,0x3F,0x00,0xE0,0x27,0x00,0xC0,0x03,0x00,
+	0x00,0x3C,0x02,0x00,0x7E,0x03,0x00,0xFE,0x03,0x00,0xFF,0x01,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x00,0xE0,0x7E,0x00,0xE0,0x7F,0x00,0xF0,0x3F,0x00,0xF0,0x0F,0x00,0xF0,0x0F,0x00,0xF0,0x0F,0x00,0xF0,0x1F,0x00,0xE0,0x3F,0x00,0xE0,0x27,0x00,0xC0,0x03,0x00,
 
 	/* Index 63, character 95 "_" (width: 19 pixels) */
-	0x13, 0x00,0x78,0x02,0x00,0xFC,0x03,0x00,0xFC,0x03,0x00,0xFE,0x01,0x00,0xFE,0x01,0x00,0xFE,0x05,0x00,0xFE,0x05,0x00,0xFE,0x0D,0xC0,0xFF,0x0D,0xE0,0xFD,0x0E,0xE0,0xFD,0x1E,0xF0,0x7B,0x1F,0xF0,0x83,0x0F,0xF0,0xEF,0x0F,0xF0,0xEF,0x07,0xF0,0xCF,0x07,0xE0,0x9F,0x03,0xE0,0x27,0x00,0xC0,0x03,0x00,
+	0x00,0x78,0x02,0x00,0xFC,0x03,0x00,0xFC,0x03,0x00,0xFE,0x01,0x00,0xFE,0x01,0x00,0xFE,0x05,0x00,0xFE,0x05,0x00,0xFE,0x0D,0xC0,0xFF,0x0D,0xE0,0xFD,0x0E,0xE0,0xFD,0x1E,0xF0,0x7B,0x1F,0xF0,0x83,0x0F,0xF0,0xEF,0x0F,0xF0,0xEF,0x07,0xF0,0xCF,0x07,0xE0,0x9F,0x03,0xE0,0x27,0x00,0xC0,0x03,0x00,
 
 	/* Index 64, character 96 "`" (width: 15 pixels) */
-	0xF, 0x00,0x04,0x00,0xC0,0xEF,0x01,0x40,0x04,0x01,0x40,0x00,0x01,0x40,0x00,0x01,0x40,0x80,0x03,0x00,0x00,0x01,0x40,0x00,0x00,0xE0,0x00,0x01,0x40,0x00,0x01,0x40,0x00,0x01,0x40,0x00,0x01,0x40,0x08,0x01,0xC0,0xFD,0x01,0x00,0x08,0x00,
+	0x00,0x04,0x00,0xC0,0xEF,0x01,0x40,0x04,0x01,0x40,0x00,0x01,0x40,0x00,0x01,0x40,0x80,0x03,0x00,0x00,0x01,0x40,0x00,0x00,0xE0,0x00,0x01,0x40,0x00,0x01,0x40,0x00,0x01,0x40,0x00,0x01,0x40,0x08,0x01,0xC0,0xFD,0x01,0x00,0x08,0x00,
 
 	/* Index 65, character 97 "a" (width: 8 pixels) */
-	0x8, 0x00,0x7C,0x00,0x00,0xF8,0x00,0x00,0xF0,0x01,0x00,0xF0,0x01,0x00,0xF8,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x1F,0x00,
+	0x00,0x7C,0x00,0x00,0xF8,0x00,0x00,0xF0,0x01,0x00,0xF0,0x01,0x00,0xF8,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x1F,0x00,
 
 	/* Index 66, character 98 "b" (width: 14 pixels) */
-	0xE, 0x00,0xE0,0x01,0x00,0x30,0x03,0x00,0x10,0x02,0x00,0x70,0x02,0x00,0x5A,0x03,0x00,0xE6,0x01,0x00,0x5A,0x00,0x00,0x68,0x00,0x00,0xC8,0x01,0x00,0x6E,0x02,0x00,0x72,0x02,0x00,0x12,0x02,0x00,0x30,0x03,0x00,0xE0,0x01,
+	0x00,0xE0,0x01,0x00,0x30,0x03,0x00,0x10,0x02,0x00,0x70,0x02,0x00,0x5A,0x03,0x00,0xE6,0x01,0x00,0x5A,0x00,0x00,0x68,0x00,0x00,0xC8,0x01,0x00,0x6E,0x02,0x00,0x72,0x02,0x00,0x12,0x02,0x00,0x30,0x03,0x00,0xE0,0x01,
 
 	/* Index 67, character 99 "c" (width: 19 pixels) */
-	0x13, 0xF8,0xFF,0x1F,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0xF8,0xFF,0x1F,
+	0xF8,0xFF,0x1F,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0xF8,0xFF,0x1F,
 
 	/* Index 68, character 100 "d" (width: 13 pixels) */
-	0xD, 0x00,0x1F,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x01,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x07,0xC0,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x03,0x80,0xFF,0x03,0xC0,0xFF,0x01,0xC0,0xFF,0x00,0x00,0x1F,0x00,
+	0x00,0x1F,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x01,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x07,0xC0,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x03,0x80,0xFF,0x03,0xC0,0xFF,0x01,0xC0,0xFF,0x00,0x00,0x1F,0x00,
 
 	/* Index 69, character 101 "e" (width: 14 pixels) */
-	0xE, 0x80,0xFF,0x03,0xC0,0xFF,0x03,0xF0,0xFF,0x03,0xE0,0xFF,0x03,0xF8,0xFF,0x03,0xC8,0xFF,0x03,0xB0,0xFF,0x03,0x90,0x00,0x00,0xC8,0xFF,0x03,0xB8,0xFF,0x03,0xE0,0xFF,0x03,0xD0,0xFF,0x03,0xC0,0xFF,0x03,0x80,0xFF,0x03,
+	0x80,0xFF,0x03,0xC0,0xFF,0x03,0xF0,0xFF,0x03,0xE0,0xFF,0x03,0xF8,0xFF,0x03,0xC8,0xFF,0x03,0xB0,0xFF,0x03,0x90,0x00,0x00,0xC8,0xFF,0x03,0xB8,0xFF,0x03,0xE0,0xFF,0x03,0xD0,0xFF,0x03,0xC0,0xFF,0x03,0x80,0xFF,0x03,
 
 	/* Index 70, character 102 "f" (width: 13 pixels) */
-	0xD, 0x00,0x07,0x00,0x60,0x80,0x00,0xC8,0x7F,0x01,0x90,0xB8,0x03,0xC0,0x78,0x03,0xF0,0x58,0x03,0xC0,0x5F,0x01,0xC0,0x58,0x03,0xF0,0x78,0x03,0xC0,0xB8,0x03,0x90,0x7F,0x01,0x68,0x80,0x00,0x40,0x07,0x00,
+	0x00,0x07,0x00,0x60,0x80,0x00,0xC8,0x7F,0x01,0x90,0xB8,0x03,0xC0,0x78,0x03,0xF0,0x58,0x03,0xC0,0x5F,0x01,0xC0,0x58,0x03,0xF0,0x78,0x03,0xC0,0xB8,0x03,0x90,0x7F,0x01,0x68,0x80,0x00,0x40,0x07,0x00,
 
 	/* Index 71, character 103 "g" (width: 19 pixels) */
-	0x13, 0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,
+	0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,
 
 	/* Index 72, character 104 "h" (width: 15 pixels) */
-	0xF, 0x00,0xF8,0x01,0x00,0xF6,0x01,0x00,0xF2,0x03,0x00,0xF2,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0xC0,0xFF,0x01,0x80,0xF3,0x01,0x80,0xF3,0x01,0x80,0xC0,0x01,0x80,0xC0,0x01,0x80,0xF3,0x01,0x80,0xF3,0x03,0x80,0xFF,0x01,0x80,0xFF,0x01,
+	0x00,0xF8,0x01,0x00,0xF6,0x01,0x00,0xF2,0x03,0x00,0xF2,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0xC0,0xFF,0x01,0x80,0xF3,0x01,0x80,0xF3,0x01,0x80,0xC0,0x01,0x80,0xC0,0x01,0x80,0xF3,0x01,0x80,0xF3,0x03,0x80,0xFF,0x01,0x80,0xFF,0x01,
 
 	/* Index 73, character 105 "i" (width: 15 pixels) */
-	0xF, 0x00,0x7C,0x00,0x00,0x83,0x01,0x80,0x00,0x02,0x40,0x00,0x04,0x40,0x00,0x04,0x20,0x00,0x08,0xA0,0xFB,0x0B,0xA0,0xFB,0x0B,0xA0,0xFB,0x0B,0x20,0x00,0x08,0x40,0x00,0x04,0x40,0x00,0x04,0x80,0x00,0x02,0x00,0x83,0x01,0x00,0x7C,0x00,
+	0x00,0x7C,0x00,0x00,0x83,0x01,0x80,0x00,0x02,0x40,0x00,0x04,0x40,0x00,0x04,0x20,0x00,0x08,0xA0,0xFB,0x0B,0xA0,0xFB,0x0B,0xA0,0xFB,0x0B,0x20,0x00,0x08,0x40,0x00,0x04,0x40,0x00,0x04,0x80,0x00,0x02,0x00,0x83,0x01,0x00,0x7C,0x00,
 
 	/* Index 74, character 106 "j" (width: 16 pixels) */
-	0x10, 0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x30,0x00,0x00,0x58,0x00,0x00,0x34,0x00,0x00,0x34,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x2E,0x00,0x00,0x27,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x20,0x00,0x00,0x20,0x00,
+	0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x30,0x00,0x00,0x58,0x00,0x00,0x34,0x00,0x00,0x34,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x2E,0x00,0x00,0x27,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x20,0x00,0x00,0x20,0x00,
 
 	/* Index 75, character 107 "k" (width: 15 pixels) */
-	0xF, 0x00,0x10,0x00,0x00,0x08,0x01,0x00,0x84,0x01,0x00,0xC0,0x01,0x80,0xC8,0x00,0x00,0x6D,0x00,0x00,0xF6,0x00,0x00,0xF6,0x00,0xC0,0xFA,0x03,0x40,0xFC,0x03,0x40,0xAC,0x01,0x00,0x8C,0x01,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x02,0x00,
+	0x00,0x10,0x00,0x00,0x08,0x01,0x00,0x84,0x01,0x00,0xC0,0x01,0x80,0xC8,0x00,0x00,0x6D,0x00,0x00,0xF6,0x00,0x00,0xF6,0x00,0xC0,0xFA,0x03,0x40,0xFC,0x03,0x40,0xAC,0x01,0x00,0x8C,0x01,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x02,0x00,
 
 	/* Index 76, character 108 "l" (width: 14 pixels) */
-	0xE, 0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x14,0x00,0x00,0x34,0x00,0x00,0xFF,0x01,0xE0,0x3F,0x06,0xE0,0xF8,0x07,0x00,0xFF,0x00,0x00,0x2C,0x00,0x00,0x28,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x10,0x00,
+	0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x14,0x00,0x00,0x34,0x00,0x00,0xFF,0x01,0xE0,0x3F,0x06,0xE0,0xF8,0x07,0x00,0xFF,0x00,0x00,0x2C,0x00,0x00,0x28,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x10,0x00,
 
 	/* Index 77, character 109 "m" (width: 5 pixels) */
-	0x5, 0x80,0x0F,0x08,0x80,0xFF,0x09,0xAC,0xFF,0x08,0x80,0xFF,0x09,0x80,0x0F,0x08,
+	0x80,0x0F,0x08,0x80,0xFF,0x09,0xAC,0xFF,0x08,0x80,0xFF,0x09,0x80,0x0F,0x08,
 
 	/* Index 78, character 110 "n" (width: 19 pixels) */
-	0x13, 0x00,0xFE,0x00,0x80,0xFF,0x03,0xC0,0xFF,0x07,0xE0,0xFF,0x0F,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xE0,0xFF,0x0F,0xC0,0xFF,0x07,0x80,0xFF,0x03,0x00,0xFE,0x00,
+	0x00,0xFE,0x00,0x80,0xFF,0x03,0xC0,0xFF,0x07,0xE0,0xFF,0x0F,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xE0,0xFF,0x0F,0xC0,0xFF,0x07,0x80,0xFF,0x03,0x00,0xFE,0x00,
 
 	/* Index 79, character 111 "o" (width: 17 pixels) */
-	0x11, 0x00,0x00,0x02,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x80,0x03,0x00,0xE0,0x03,0x00,0xE8,0x03,0x00,0xB0,0x03,0x00,0xA0,0x03,0x00,0xC0,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x01,0x00,0x80,0x00,
+	0x00,0x00,0x02,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x80,0x03,0x00,0xE0,0x03,0x00,0xE8,0x03,0x00,0xB0,0x03,0x00,0xA0,0x03,0x00,0xC0,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x01,0x00,0x80,0x00,
 
 	/* Index 80, character 112 "p" (width: 18 pixels) */
-	0x12, 0x22,0x00,0x00,0x24,0x00,0x00,0x00,0x88,0x00,0x20,0x7E,0x01,0x54,0xB1,0x03,0x50,0xB1,0x03,0x70,0xF1,0x00,0x73,0x71,0x01,0x70,0x71,0x01,0x70,0x71,0x01,0x73,0x71,0x01,0x70,0xF1,0x00,0x50,0xB1,0x03,0x74,0xB3,0x03,0x00,0xFC,0x00,0x04,0x08,0x00,0x24,0x00,0x00,0x22,0x00,0x00,
+	0x22,0x00,0x00,0x24,0x00,0x00,0x00,0x88,0x00,0x20,0x7E,0x01,0x54,0xB1,0x03,0x50,0xB1,0x03,0x70,0xF1,0x00,0x73,0x71,0x01,0x70,0x71,0x01,0x70,0x71,0x01,0x73,0x71,0x01,0x70,0xF1,0x00,0x50,0xB1,0x03,0x74,0xB3,0x03,0x00,0xFC,0x00,0x04,0x08,0x00,0x24,0x00,0x00,0x22,0x00,0x00,
 
 	/* Index 81, character 113 "q" (width: 12 pixels) */
-	0xC, 0x00,0x3C,0x00,0x00,0xFF,0x00,0xC0,0xC1,0x01,0xE0,0x80,0x03,0xE0,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xC0,0x03,0xE0,0x80,0x03,0xC0,0xC1,0x01,0x80,0x7F,0x00,0x00,0x1E,0x00,
+	0x00,0x3C,0x00,0x00,0xFF,0x00,0xC0,0xC1,0x01,0xE0,0x80,0x03,0xE0,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xC0,0x03,0xE0,0x80,0x03,0xC0,0xC1,0x01,0x80,0x7F,0x00,0x00,0x1E,0x00,
 
 	/* Index 82, character 114 "r" (width: 13 pixels) */
-	0xD, 0xC0,0x01,0x07,0xC0,0x83,0x07,0x80,0xC7,0x03,0x00,0xEF,0x01,0x00,0xFE,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0xFE,0x00,0x00,0xEF,0x01,0x80,0xC7,0x03,0xC0,0x83,0x07,0xC0,0x01,0x07,0xC0,0x00,0x06,
+	0xC0,0x01,0x07,0xC0,0x83,0x07,0x80,0xC7,0x03,0x00,0xEF,0x01,0x00,0xFE,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0xFE,0x00,0x00,0xEF,0x01,0x80,0xC7,0x03,0xC0,0x83,0x07,0xC0,0x01,0x07,0xC0,0x00,0x06,
 
 	/* Index 83, character 115 "s" (width: 11 pixels) */
-	0xB, 0xC0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xF0,0x79,0x0C,0x30,0x7C,0x1E,0x30,0x7C,0x1E,0x30,0x7E,0x0C,0xF0,0x0F,0x00,0xE0,0x07,0x00,0xE0,0x03,0x00,0xC0,0x01,0x00,
+	0xC0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xF0,0x79,0x0C,0x30,0x7C,0x1E,0x30,0x7C,0x1E,0x30,0x7E,0x0C,0xF0,0x0F,0x00,0xE0,0x07,0x00,0xE0,0x03,0x00,0xC0,0x01,0x00,
 
 	/* Index 84, character 116 "t" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x15,0x00,0xFE,0x1F,0x00,0x43,0x1B,0x80,0xBF,0x1F,0x80,0xBF,0x1D,0x80,0x41,0x1F,0x80,0x41,0x1F,0x80,0xFF,0x1F,0x00,0xBB,0x1F,0x00,0xDB,0x1F,0x00,0xDF,0x1F,0x00,0xDE,0x1F,0x00,0xFC,0x1F,0x00,0xD8,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x15,0x00,0xFE,0x1F,0x00,0x43,0x1B,0x80,0xBF,0x1F,0x80,0xBF,0x1D,0x80,0x41,0x1F,0x80,0x41,0x1F,0x80,0xFF,0x1F,0x00,0xBB,0x1F,0x00,0xDB,0x1F,0x00,0xDF,0x1F,0x00,0xDE,0x1F,0x00,0xFC,0x1F,0x00,0xD8,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xE0,0x1F,
 
 	/* Index 85, character 117 "u" (width: 19 pixels) */
-	0x13, 0x00,0xE0,0x1F,0x00,0xE0,0x1F,0x00,0xFC,0x1F,0x00,0x83,0x1F,0x80,0x80,0x1E,0x40,0x80,0x1D,0x40,0xBF,0x1D,0xA0,0xE9,0x1B,0xA0,0xB9,0x1B,0xA0,0xBF,0x1B,0xA0,0xB9,0x1B,0xA0,0xE9,0x1B,0x40,0xBF,0x1D,0x40,0x80,0x1D,0x80,0x80,0x1E,0x00,0x83,0x1F,0x00,0xFC,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
+	0x00,0xE0,0x1F,0x00,0xE0,0x1F,0x00,0xFC,0x1F,0x00,0x83,0x1F,0x80,0x80,0x1E,0x40,0x80,0x1D,0x40,0xBF,0x1D,0xA0,0xE9,0x1B,0xA0,0xB9,0x1B,0xA0,0xBF,0x1B,0xA0,0xB9,0x1B,0xA0,0xE9,0x1B,0x40,0xBF,0x1D,0x40,0x80,0x1D,0x80,0x80,0x1E,0x00,0x83,0x1F,0x00,0xFC,0x1F,0x00,0xE0,0x1F,0x00,0xE0,0x1F,
 
 	/* Index 86, character 118 "v" (width: 11 pixels) */
-	0xB, 0x80,0xFF,0x00,0xC0,0xB8,0x03,0xC0,0xF8,0x03,0xC0,0xA8,0x00,0xC0,0xA8,0x00,0xC0,0xAF,0x00,0xC0,0xA8,0x00,0xC0,0xA8,0x00,0xC0,0xF8,0x03,0xC0,0xB8,0x03,0x80,0xFF,0x00,
+	0x80,0xFF,0x00,0xC0,0xB8,0x03,0xC0,0xF8,0x03,0xC0,0xA8,0x00,0xC0,0xA8,0x00,0xC0,0xAF,0x00,0xC0,0xA8,0x00,0xC0,0xA8,0x00,0xC0,0xF8,0x03,0xC0,0xB8,0x03,0x80,0xFF,0x00,
 
 	/* Index 87, character 119 "w" (width: 5 pixels) */
-	0x5, 0xC0,0x3F,0x06,0x40,0xC1,0x07,0xC0,0x00,0x06,0x40,0x00,0x06,0x00,0x00,0x04,
+	0xC0,0x3F,0x06,0x40,0xC1,0x07,0xC0,0x00,0x06,0x40,0x00,0x06,0x00,0x00,0x04,
 
 	/* Index 88, character 120 "x" (width: 15 pixels) */
-	0xF, 0x00,0x7C,0x00,0x00,0x83,0x01,0x80,0x01,0x02,0xC0,0x02,0x04,0x40,0x04,0x04,0x20,0x08,0x08,0x20,0x10,0x08,0x20,0x20,0x08,0x20,0x40,0x08,0x20,0x80,0x08,0x40,0x00,0x05,0x40,0x00,0x06,0x80,0x00,0x03,0x00,0x83,0x01,0x00,0x7C,0x00,
+	0x00,0x7C,0x00,0x00,0x83,0x01,0x80,0x01,0x02,0xC0,0x02,0x04,0x40,0x04,0x04,0x20,0x08,0x08,0x20,0x10,0x08,0x20,0x20,0x08,0x20,0x40,0x08,0x20,0x80,0x08,0x40,0x00,0x05,0x40,0x00,0x06,0x80,0x00,0x03,0x00,0x83,0x01,0x00,0x7C,0x00,
 
 	/* Index 89, character 121 "y" (width: 15 pixels) */
-	0xF, 0x00,0x7C,0x00,0x00,0x93,0x01,0x80,0x10,0x02,0x40,0x10,0x04,0x40,0x10,0x04,0x20,0x10,0x08,0x20,0x10,0x08,0x20,0x10,0x08,0x20,0x10,0x08,0x20,0x10,0x08,0x40,0x10,0x04,0x40,0x10,0x04,0x80,0x10,0x02,0x00,0x93,0x01,0x00,0x7C,0x00,
+	0x00,0x7C,0x00,0x00,0x93,0x01,0x80,0x10,0x02,0x40,0x10,0x04,0x40,0x10,0x04,0x20,0x10,0x08,0x20,0x10,0x08,0x20,0x10,0x08,0x20,0x10,0x08,0x20,0x10,0x08,0x40,0x10,0x04,0x40,0x10,0x04,0x80,0x10,0x02,0x00,0x93,0x01,0x00,0x7C,0x00,
 
 	/* Index 90, character 122 "z" (width: 15 pixels) */
-	0xF, 0x00,0x7C,0x00,0x00,0x83,0x01,0x80,0x72,0x02,0x40,0x56,0x04,0x40,0x4C,0x04,0x20,0x48,0x08,0x20,0x58,0x08,0x20,0x69,0x08,0x20,0x47,0x08,0x20,0xC0,0x08,0x40,0xC0,0x05,0xC0,0x40,0x07,0x80,0x01,0x02,0x00,0x83,0x01,0x00,0x7C,0x00,
+	0x00,0x7C,0x00,0x00,0x83,0x01,0x80,0x72,0x02,0x40,0x56,0x04,0x40,0x4C,0x04,0x20,0x48,0x08,0x20,0x58,0x08,0x20,0x69,0x08,0x20,0x47,0x08,0x20,0xC0,0x08,0x40,0xC0,0x05,0xC0,0x40,0x07,0x80,0x01,0x02,0x00,0x83,0x01,0x00,0x7C,0x00,
 
 	/* Index 91, character 123 "{" (width: 19 pixels) */
-	0x13, 0x00,0x48,0x00,0x00,0x79,0x00,0x00,0xFF,0x01,0x00,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x01,0x80,0xFF,0x01,0xC0,0xFF,0x00,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0x80,0xFF,0x00,0xE0,0xFF,0x01,0xC0,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0xC0,0xFF,0x03,0x40,0x7E,0x03,0x00,0x7F,0x02,0x00,0x48,0x04,
+	0x00,0x48,0x00,0x00,0x79,0x00,0x00,0xFF,0x01,0x00,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0xFF,0x01,0x80,0xFF,0x01,0xC0,0xFF,0x00,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0x80,0xFF,0x00,0xE0,0xFF,0x01,0xC0,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0xC0,0xFF,0x03,0x40,0x7E,0x03,0x00,0x7F,0x02,0x00,0x48,0x04,
 
 	/* Index 92, character 124 "|" (width: 1 pixels) */
-	0x1, 0xF8,0xFF,0x1F,
+	0xF8,0xFF,0x1F,
 
 	/* Index 93, character 125 "}" (width: 19 pixels) */
-	0x13, 0x00,0x48,0x04,0x00,0x7F,0x02,0x40,0x7E,0x03,0xC0,0xFF,0x03,0x80,0xFF,0x01,0x80,0xFF,0x01,0xC0,0xFF,0x01,0xE0,0xFF,0x01,0x80,0xFF,0x01,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x03,0xE0,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x01,0x00,0x79,0x00,0x00,0x48,0x00,
+	0x00,0x48,0x04,0x00,0x7F,0x02,0x40,0x7E,0x03,0xC0,0xFF,0x03,0x80,0xFF,0x01,0x80,0xFF,0x01,0xC0,0xFF,0x01,0xE0,0xFF,0x01,0x80,0xFF,0x01,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x03,0xE0,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x01,0x00,0x79,0x00,0x00,0x48,0x00,
 
 	/* Index 94, character 126 "~" (width: 15 pixels) */
-	0xF, 0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x80,0x01,0x00,0xE0,0x00,0x00,0x78,0x00,0x00,0x3E,0x00,0x80,0x1F,0x00,0x00,0x7F,0x00,0x00,0xFC,0x01,0x00,0x7E,0x00,0x00,0x1F,0x00,0x80,0x07,0x00,0xC0,0x01,0x00,0x60,0x00,0x00,0x10,0x00,0x00,
+	0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x80,0x01,0x00,0xE0,0x00,0x00,0x78,0x00,0x00,0x3E,0x00,0x80,0x1F,0x00,0x00,0x7F,0x00,0x00,0xFC,0x01,0x00,0x7E,0x00,0x00,0x1F,0x00,0x80,0x07,0x00,0xC0,0x01,0x00,0x60,0x00,0x00,0x10,0x00,0x00,
 
 	/* Index 95, character 127 "." (width: 8 pixels) */
-	0x8, 0x80,0xFF,0x03,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0xFF,0x03
+	0x80,0xFF,0x03,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0xFF,0x03
+};
+
+// Offset of each bitmap in Webdings14_bitmaps
+const unsigned short Webdings14_offsets[] = 
+{
+	0x0,	// Index 0
+	0x6,	// Index 1
+	0x2D,	// Index 2
+	0x66,	// Index 3
+	0x93,	// Index 4
+	0xBA,	// Index 5
+	0xEA,	// Index 6
+	0x102,	// Index 7
+	0x11A,	// Index 8
+	0x150,	// Index 9
+	0x186,	// Index 10
+	0x1BF,	// Index 11
+	0x1F8,	// Index 12
+	0x225,	// Index 13
+	0x240,	// Index 14
+	0x279,	// Index 15
+	0x2AF,	// Index 16
+	0x2CA,	// Index 17
+	0x2F7,	// Index 18
+	0x324,	// Index 19
+	0x336,	// Index 20
+	0x348,	// Index 21
+	0x36C,	// Index 22
+	0x390,	// Index 23
+	0x3B4,	// Index 24
+	0x3D8,	// Index 25
+	0x402,	// Index 26
+	0x42C,	// Index 27
+	0x43E,	// Index 28
+	0x45F,	// Index 29
+	0x480,	// Index 30
+	0x4AD,	// Index 31
+	0x4DA,	// Index 32
+	0x50D,	// Index 33
+	0x546,	// Index 34
+	0x582,	// Index 35
+	0x5BB,	// Index 36
+	0x5F4,	// Index 37
+	0x62D,	// Index 38
+	0x666,	// Index 39
+	0x69F,	// Index 40
+	0x6D8,	// Index 41
+	0x711,	// Index 42
+	0x74A,	// Index 43
+	0x786,	// Index 44
+	0x7A1,	// Index 45
+	0x7DA,	// Index 46
+	0x807,	// Index 47
+	0x82B,	// Index 48
+	0x864,	// Index 49
+	0x89D,	// Index 50
+	0x8D6,	// Index 51
+	0x90F,	// Index 52
+	0x948,	// Index 53
+	0x981,	// Index 54
+	0x9A8,	// Index 55
+	0x9BD,	// Index 56
+	0x9D2,	// Index 57
+	0x9FC,	// Index 58
+	0xA20,	// Index 59
+	0xA56,	// Index 60
+	0xA8C,	// Index 61
+	0xABF,	// Index 62
+	0xAF8,	// Index 63
+	0xB31,	// Index 64
+	0xB5E,	// Index 65
+	0xB76,	// Index 66
+	0xBA0,	// Index 67
+	0xBD9,	// Index 68
+	0xC00,	// Index 69
+	0xC2A,	// Index 70
+	0xC51,	// Index 71
+	0xC8A,	// Index 72
+	0xCB7,	// Index 73
+	0xCE4,	// Index 74
+	0xD14,	// Index 75
+	0xD41,	// Index 76
+	0xD6B,	// Index 77
+	0xD7A,	// Index 78
+	0xDB3,	// Index 79
+	0xDE6,	// Index 80
+	0xE1C,	// Index 81
+	0xE40,	// Index 82
+	0xE67,	// Index 83
+	0xE88,	// Index 84
+	0xEC1,	// Index 85
+	0xEFA,	// Index 86
+	0xF1B,	// Index 87
+	0xF2A,	// Index 88
+	0xF57,	// Index 89
+	0xF84,	// Index 90
+	0xFB1,	// Index 91
+	0xFEA,	// Index 92
+	0xFED,	// Index 93
+	0x1026,	// Index 94
+	0x1053,	// Index 95
 };
+
+// Width of each bitmap in pixels
+const unsigned char Webdings14_widths[] = 
+{
+	0x2,	// Index 0
+	0xD,	// Index 1
+	0x13,	// Index 2
+	0xF,	// Index 3
+	0xD,	// Index 4
+	0x10,	// Index 5
+	0x8,	// Index 6
+	0x8,	// Index 7
+	0x12,	// Index 8
+	0x12,	// Index 9
+	0x13,	// Index 10
+	0x13,	// Index 11
+	0xF,	// Index 12
+	0x9,	// Index 13
+	0x13,	// Index 14
+	0x12,	// Index 15
+	0x9,	// Index 16
+	0xF,	// Index 17
+	0xF,	// Index 18
+	0x6,	// Index 19
+	0x6,	// Index 20
+	0xC,	// Index 21
+	0xC,	// Index 22
+	0xC,	// Index 23
+	0xC,	// Index 24
+	0xE,	// Index 25
+	0xE,	// Index 26
+	0x6,	// Index 27
+	0xB,	// Index 28
+	0xB,	// Index 29
+	0xF,	// Index 30
+	0xF,	// Index 31
+	0x11,	// Index 32
+	0x13,	// Index 33
+	0x14,	// Index 34
+	0x13,	// Index 35
+	0x13,	// Index 36
+	0x13,	// Index 37
+	0x13,	// Index 38
+	0x13,	// Index 39
+	0x13,	// Index 40
+	0x13,	// Index 41
+	0x13,	// Index 42
+	0x14,	// Index 43
+	0x9,	// Index 44
+	0x13,	// Index 45
+	0xF,	// Index 46
+	0xC,	// Index 47
+	0x13,	// Index 48
+	0x13,	// Index 49
+	0x13,	// Index 50
+	0x13,	// Index 51
+	0x13,	// Index 52
+	0x13,	// Index 53
+	0xD,	// Index 54
+	0x7,	// Index 55
+	0x7,	// Index 56
+	0xE,	// Index 57
+	0xC,	// Index 58
+	0x12,	// Index 59
+	0x12,	// Index 60
+	0x11,	// Index 61
+	0x13,	// Index 62
+	0x13,	// Index 63
+	0xF,	// Index 64
+	0x8,	// Index 65
+	0xE,	// Index 66
+	0x13,	// Index 67
+	0xD,	// Index 68
+	0xE,	// Index 69
+	0xD,	// Index 70
+	0x13,	// Index 71
+	0xF,	// Index 72
+	0xF,	// Index 73
+	0x10,	// Index 74
+	0xF,	// Index 75
+	0xE,	// Index 76
+	0x5,	// Index 77
+	0x13,	// Index 78
+	0x11,	// Index 79
+	0x12,	// Index 80
+	0xC,	// Index 81
+	0xD,	// Index 82
+	0xB,	// Index 83
+	0x13,	// Index 84
+	0x13,	// Index 85
+	0xB,	// Index 86
+	0x5,	// Index 87
+	0xF,	// Index 88
+	0xF,	// Index 89
+	0xF,	// Index 90
+	0x13,	// Index 91
+	0x1,	// Index 92
+	0x13,	// Index 93
+	0xF,	// Index 94
+	0x8,	// Index 95
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Webdings14_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x10, 0x0,	// Index 1
+	0x12, 0x0,	// Index 2
+	0x10, 0x0,	// Index 3
+	0xC, 0x0,	// Index 4
+	0x11, 0x0,	// Index 5
+	0x11, 0x0,	// Index 6
+	0x10, 0x0,	// Index 7
+	0xE, 0x0,	// Index 8
+	0xE, 0x0,	// Index 9
+	0x10, 0x0,	// Index 10
+	0x12, 0x0,	// Index 11
+	0xC, 0x0,	// Index 12
+	0x11, 0x0,	// Index 13
+	0x12, 0x0,	// Index 14
+	0x12, 0x0,	// Index 15
+	0x3, 0x0,	// Index 16
+	0xE, 0x0,	// Index 17
+	0xE, 0x0,	// Index 18
+	0xF, 0x0,	// Index 19
+	0xF, 0x0,	// Index 20
+	0xC, 0x0,	// Index 21
+	0xB, 0x0,	// Index 22
+	0xE, 0x0,	// Index 23
+	0xE, 0x0,	// Index 24
+	0xE, 0x0,	// Index 25
+	0xE, 0x0,	// Index 26
+	0xE, 0x0,	// Index 27
+	0xE, 0x0,	// Index 28
+	0xE, 0x0,	// Index 29
+	0xD, 0x0,	// Index 30
+	0x10, 0x0,	// Index 31
+	0x10, 0x0,	// Index 32
+	0x12, 0x0,	// Index 33
+	0x10, 0x0,	// Index 34
+	0x11, 0x0,	// Index 35
+	0x11, 0x0,	// Index 36
+	0x11, 0x0,	// Index 37
+	0x10, 0x0,	// Index 38
+	0x10, 0x0,	// Index 39
+	0x11, 0x0,	// Index 40
+	0x10, 0x0,	// Index 41
+	0x12, 0x0,	// Index 42
+	0xF, 0x0,	// Index 43
+	0x10, 0x0,	// Index 44
+	0xF, 0x0,	// Index 45
+	0xF, 0x0,	// Index 46
+	0x10, 0x0,	// Index 47
+	0x11, 0x0,	// Index 48
+	0x11, 0x0,	// Index 49
+	0xA, 0x0,	// Index 50
+	0x13, 0x0,	// Index 51
+	0x12, 0x0,	// Index 52
+	0x10, 0x0,	// Index 53
+	0xF, 0x0,	// Index 54
+	0xF, 0x0,	// Index 55
+	0xF, 0x0,	// Index 56
+	0xF, 0x0,	// Index 57
+	0x12, 0x0,	// Index 58
+	0xF, 0x0,	// Index 59
+	0x12, 0x0,	// Index 60
+	0xF, 0x0,	// Index 61
+	0x11, 0x0,	// Index 62
+	0x11, 0x0,	// Index 63
+	0x10, 0x0,	// Index 64
+	0xD, 0x0,	// Index 65
+	0xC, 0x0,	// Index 66
+	0x12, 0x0,	// Index 67
+	0xF, 0x0,	// Index 68
+	0x12, 0x0,	// Index 69
+	0x12, 0x0,	// Index 70
+	0x12, 0x0,	// Index 71
+	0xF, 0x0,	// Index 72
+	0x10, 0x0,	// Index 73
+	0xD, 0x0,	// Index 74
+	0xF, 0x0,	// Index 75
+	0x10, 0x0,	// Index 76
+	0x13, 0x0,	// Index 77
+	0x12, 0x0,	// Index 78
+	0xA, 0x0,	// Index 79
+	0x15, 0x0,	// Index 80
+	0x10, 0x0,	// Index 81
+	0xF, 0x0,	// Index 82
+	0x11, 0x0,	// Index 83
+	0xE, 0x0,	// Index 84
+	0x10, 0x0,	// Index 85
+	0xF, 0x0,	// Index 86
+	0xF, 0x0,	// Index 87
+	0x10, 0x0,	// Index 88
+	0x10, 0x0,	// Index 89
+	0x10, 0x0,	// Index 90
+	0x10, 0x0,	// Index 91
+	0x12, 0x0,	// Index 92
+	0x10, 0x0,	// Index 93
+	0x11, 0x0,	// Index 94
+	0xE, 0x0,	// Index 95
+};
+
+const font_t Webdings14 = 
+{
+	Webdings14_bitmaps,
+	Webdings14_offsets,
+	Webdings14_widths,
+	0x20,	// Start character 
+	0x60,	// Number of bitmaps 
+	0x15,	// Height 
+	0,	// Flags 
+	Webdings14_extents,
+	0x15	// Ascent 
+};
+
 //---------------------------------------------------------------
 // Group Name: Webdings16
 // Designer: Imported System Font
@@ -429,402 +642,613 @@ const unsigned char Webdings14[] =
 // Start Character: 32 " "
 // Stop Character: 127 "."
 //---------------------------------------------------------------
-const unsigned char Webdings16[] = 
+const unsigned char Webdings16_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x60,	// Number of Bitmaps 
-	0x17,	// Height 
-
-	// Bitmap Index (number of index entries 96)
- 	0x0, 0xC5, // Index 0 (offset: 197)
-	0x0, 0xCC, // Index 1 (offset: 204)
-	0x0, 0xF4, // Index 2 (offset: 244)
-	0x1, 0x34, // Index 3 (offset: 308)
-	0x1, 0x65, // Index 4 (offset: 357)
-	0x1, 0x8D, // Index 5 (offset: 397)
-	0x1, 0xC4, // Index 6 (offset: 452)
-	0x1, 0xE0, // Index 7 (offset: 480)
-	0x1, 0xFC, // Index 8 (offset: 508)
-	0x2, 0x36, // Index 9 (offset: 566)
-	0x2, 0x70, // Index 10 (offset: 624)
-	0x2, 0xAA, // Index 11 (offset: 682)
-	0x2, 0xE7, // Index 12 (offset: 743)
-	0x3, 0x1B, // Index 13 (offset: 795)
-	0x3, 0x3D, // Index 14 (offset: 829)
-	0x3, 0x7D, // Index 15 (offset: 893)
-	0x3, 0xBD, // Index 16 (offset: 957)
-	0x3, 0xDF, // Index 17 (offset: 991)
-	0x4, 0xD, // Index 18 (offset: 1037)
-	0x4, 0x3B, // Index 19 (offset: 1083)
-	0x4, 0x51, // Index 20 (offset: 1105)
-	0x4, 0x67, // Index 21 (offset: 1127)
-	0x4, 0x92, // Index 22 (offset: 1170)
-	0x4, 0xBD, // Index 23 (offset: 1213)
-	0x4, 0xEB, // Index 24 (offset: 1259)
-	0x5, 0x19, // Index 25 (offset: 1305)
-	0x5, 0x4D, // Index 26 (offset: 1357)
-	0x5, 0x81, // Index 27 (offset: 1409)
-	0x5, 0x9D, // Index 28 (offset: 1437)
-	0x5, 0xC2, // Index 29 (offset: 1474)
-	0x5, 0xE7, // Index 30 (offset: 1511)
-	0x6, 0x18, // Index 31 (offset: 1560)
-	0x6, 0x4C, // Index 32 (offset: 1612)
-	0x6, 0x80, // Index 33 (offset: 1664)
-	0x6, 0xC0, // Index 34 (offset: 1728)
-	0x7, 0x0, // Index 35 (offset: 1792)
-	0x7, 0x40, // Index 36 (offset: 1856)
-	0x7, 0x80, // Index 37 (offset: 1920)
-	0x7, 0xC0, // Index 38 (offset: 1984)
-	0x8, 0x0, // Index 39 (offset: 2048)
-	0x8, 0x40, // Index 40 (offset: 2112)
-	0x8, 0x80, // Index 41 (offset: 2176)
-	0x8, 0xC0, // Index 42 (offset: 2240)
-	0x9, 0x0, // Index 43 (offset: 2304)
-	0x9, 0x40, // Index 44 (offset: 2368)
-	0x9, 0x5C, // Index 45 (offset: 2396)
-	0x9, 0x9C, // Index 46 (offset: 2460)
-	0x9, 0xD0, // Index 47 (offset: 2512)
-	0x9, 0xF5, // Index 48 (offset: 2549)
-	0xA, 0x35, // Index 49 (offset: 2613)
-	0xA, 0x75, // Index 50 (offset: 2677)
-	0xA, 0xB5, // Index 51 (offset: 2741)
-	0xA, 0xF5, // Index 52 (offset: 2805)
-	0xB, 0x35, // Index 53 (offset: 2869)
-	0xB, 0x72, // Index 54 (offset: 2930)
-	0xB, 0xA0, // Index 55 (offset: 2976)
-	0xB, 0xB9, // Index 56 (offset: 3001)
-	0xB, 0xD2, // Index 57 (offset: 3026)
-	0xC, 0x3, // Index 58 (offset: 3075)
-	0xC, 0x2E, // Index 59 (offset: 3118)
-	0xC, 0x68, // Index 60 (offset: 3176)
-	0xC, 0xA8, // Index 61 (offset: 3240)
-	0xC, 0xE2, // Index 62 (offset: 3298)
-	0xD, 0x1F, // Index 63 (offset: 3359)
-	0xD, 0x5C, // Index 64 (offset: 3420)
-	0xD, 0x90, // Index 65 (offset: 3472)
-	0xD, 0xAC, // Index 66 (offset: 3500)
-	0xD, 0xDD, // Index 67 (offset: 3549)
-	0xE, 0x1D, // Index 68 (offset: 3613)
-	0xE, 0x4B, // Index 69 (offset: 3659)
-	0xE, 0x79, // Index 70 (offset: 3705)
-	0xE, 0xA4, // Index 71 (offset: 3748)
-	0xE, 0xE4, // Index 72 (offset: 3812)
-	0xF, 0x18, // Index 73 (offset: 3864)
-	0xF, 0x49, // Index 74 (offset: 3913)
-	0xF, 0x83, // Index 75 (offset: 3971)
-	0xF, 0xB7, // Index 76 (offset: 4023)
-	0xF, 0xE8, // Index 77 (offset: 4072)
-	0xF, 0xFB, // Index 78 (offset: 4091)
-	0x10, 0x3B, // Index 79 (offset: 4155)
-	0x10, 0x6F, // Index 80 (offset: 4207)
-	0x10, 0xA6, // Index 81 (offset: 4262)
-	0x10, 0xCE, // Index 82 (offset: 4302)
-	0x10, 0xF6, // Index 83 (offset: 4342)
-	0x11, 0x1B, // Index 84 (offset: 4379)
-	0x11, 0x5B, // Index 85 (offset: 4443)
-	0x11, 0x9B, // Index 86 (offset: 4507)
-	0x11, 0xC3, // Index 87 (offset: 4547)
-	0x11, 0xD9, // Index 88 (offset: 4569)
-	0x12, 0xA, // Index 89 (offset: 4618)
-	0x12, 0x3B, // Index 90 (offset: 4667)
-	0x12, 0x6C, // Index 91 (offset: 4716)
-	0x12, 0xAC, // Index 92 (offset: 4780)
-	0x12, 0xB0, // Index 93 (offset: 4784)
-	0x12, 0xF0, // Index 94 (offset: 4848)
-	0x13, 0x24, // Index 95 (offset: 4900)
-
 	/* Index 0, character 32 " " (width: 2 pixels) */
-	0x2, 0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 13 pixels) */
-	0xD, 0x00,0xC0,0x03,0xE0,0x6F,0x1C,0x00,0xE8,0x27,0xC0,0x1F,0x08,0x30,0xF8,0x03,0x00,0xFF,0x07,0x80,0xFF,0x0F,0x00,0xFF,0x07,0x30,0xF8,0x03,0xC0,0x1F,0x0C,0x00,0xE8,0x33,0xC0,0x6F,0x0E,0x00,0xC0,0x01,
+	0x00,0xC0,0x03,0xE0,0x6F,0x1C,0x00,0xE8,0x27,0xC0,0x1F,0x08,0x30,0xF8,0x03,0x00,0xFF,0x07,0x80,0xFF,0x0F,0x00,0xFF,0x07,0x30,0xF8,0x03,0xC0,0x1F,0x0C,0x00,0xE8,0x33,0xC0,0x6F,0x0E,0x00,0xC0,0x01,
 
 	/* Index 2, character 34 """ (width: 21 pixels) */
-	0x15, 0x00,0x04,0x00,0x00,0x0C,0x00,0x00,0x7C,0x00,0x00,0x8A,0x03,0x00,0x3A,0x5C,0x00,0xD9,0x21,0x80,0x24,0x3E,0x40,0xF2,0x2C,0x20,0x2A,0x2B,0x20,0xC9,0x2A,0xF8,0xBF,0x2A,0x20,0x49,0x2B,0x40,0xEA,0x2B,0x80,0x32,0x2C,0x80,0xA4,0x3F,0x00,0x79,0x20,0x00,0x1A,0x5E,0x00,0xCA,0x01,0x00,0x3C,0x00,0x00,0x0C,0x00,0x00,0x04,0x00,
+	0x00,0x04,0x00,0x00,0x0C,0x00,0x00,0x7C,0x00,0x00,0x8A,0x03,0x00,0x3A,0x5C,0x00,0xD9,0x21,0x80,0x24,0x3E,0x40,0xF2,0x2C,0x20,0x2A,0x2B,0x20,0xC9,0x2A,0xF8,0xBF,0x2A,0x20,0x49,0x2B,0x40,0xEA,0x2B,0x80,0x32,0x2C,0x80,0xA4,0x3F,0x00,0x79,0x20,0x00,0x1A,0x5E,0x00,0xCA,0x01,0x00,0x3C,0x00,0x00,0x0C,0x00,0x00,0x04,0x00,
 
 	/* Index 3, character 35 "#" (width: 16 pixels) */
-	0x10, 0x00,0xFC,0x00,0x00,0x03,0x03,0x80,0x01,0x06,0xC0,0x03,0x0C,0x40,0x3A,0x08,0x20,0xFF,0x11,0x20,0xB5,0x13,0x20,0xF5,0x16,0x20,0x85,0x16,0x20,0x9E,0x16,0x20,0x9E,0x17,0x40,0xFC,0x0B,0xC0,0x00,0x0E,0x80,0x01,0x06,0x00,0x03,0x03,0x00,0xFC,0x00,
+	0x00,0xFC,0x00,0x00,0x03,0x03,0x80,0x01,0x06,0xC0,0x03,0x0C,0x40,0x3A,0x08,0x20,0xFF,0x11,0x20,0xB5,0x13,0x20,0xF5,0x16,0x20,0x85,0x16,0x20,0x9E,0x16,0x20,0x9E,0x17,0x40,0xFC,0x0B,0xC0,0x00,0x0E,0x80,0x01,0x06,0x00,0x03,0x03,0x00,0xFC,0x00,
 
 	/* Index 4, character 36 "$" (width: 13 pixels) */
-	0xD, 0x00,0x06,0x00,0x00,0x1E,0x00,0x00,0x3A,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x02,0x00,0x00,0x1E,0x00,0x00,0x3A,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,
+	0x00,0x06,0x00,0x00,0x1E,0x00,0x00,0x3A,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x02,0x00,0x00,0x1E,0x00,0x00,0x3A,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,
 
 	/* Index 5, character 37 "%" (width: 18 pixels) */
-	0x12, 0xE0,0x00,0x00,0xA0,0x01,0x00,0x10,0x01,0x00,0x20,0x09,0x00,0xF0,0x1F,0x00,0x30,0x20,0x00,0xF0,0x5F,0x04,0xF0,0xBF,0x06,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x06,0xF0,0x3F,0x04,0xF0,0x1F,0x00,0x30,0x0A,0x00,0x20,0x09,0x00,0x10,0x01,0x00,0xE0,0x01,0x00,0xE0,0x00,0x00,
+	0xE0,0x00,0x00,0xA0,0x01,0x00,0x10,0x01,0x00,0x20,0x09,0x00,0xF0,0x1F,0x00,0x30,0x20,0x00,0xF0,0x5F,0x04,0xF0,0xBF,0x06,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x06,0xF0,0x3F,0x04,0xF0,0x1F,0x00,0x30,0x0A,0x00,0x20,0x09,0x00,0x10,0x01,0x00,0xE0,0x01,0x00,0xE0,0x00,0x00,
 
 	/* Index 6, character 38 "&" (width: 9 pixels) */
-	0x9, 0xF8,0xC1,0x07,0xF8,0x63,0x0C,0xF8,0x3F,0x18,0x08,0x14,0x10,0x08,0x14,0x10,0xF8,0x1F,0x10,0xF8,0x37,0x18,0xF8,0x63,0x0C,0xF8,0xC1,0x07,
+	0xF8,0xC1,0x07,0xF8,0x63,0x0C,0xF8,0x3F,0x18,0x08,0x14,0x10,0x08,0x14,0x10,0xF8,0x1F,0x10,0xF8,0x37,0x18,0xF8,0x63,0x0C,0xF8,0xC1,0x07,
 
 	/* Index 7, character 39 "'" (width: 9 pixels) */
-	0x9, 0x00,0x07,0x0C,0x80,0x1E,0x12,0xC0,0x2A,0x11,0x40,0xCA,0x11,0x20,0x84,0x09,0x30,0x5A,0x05,0x10,0x61,0x07,0x90,0xC0,0x02,0x60,0x80,0x01,
+	0x00,0x07,0x0C,0x80,0x1E,0x12,0xC0,0x2A,0x11,0x40,0xCA,0x11,0x20,0x84,0x09,0x30,0x5A,0x05,0x10,0x61,0x07,0x90,0xC0,0x02,0x60,0x80,0x01,
 
 	/* Index 8, character 40 "(" (width: 19 pixels) */
-	0x13, 0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x03,0x00,0xFF,0x03,0x00,0xFF,0x07,0x00,0x7E,0x07,0x00,0x7E,0x04,0x00,0x3C,0x04,
+	0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x03,0x00,0xFF,0x03,0x00,0xFF,0x07,0x00,0x7E,0x07,0x00,0x7E,0x04,0x00,0x3C,0x04,
 
 	/* Index 9, character 41 ")" (width: 19 pixels) */
-	0x13, 0x00,0x3C,0x04,0x00,0x7E,0x04,0x00,0x7E,0x07,0x00,0xFF,0x07,0x00,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,
+	0x00,0x3C,0x04,0x00,0x7E,0x04,0x00,0x7E,0x07,0x00,0xFF,0x07,0x00,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x01,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,
 
 	/* Index 10, character 42 "*" (width: 19 pixels) */
-	0x13, 0x00,0x99,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0x80,0xFF,0x01,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0x80,0xFF,0x01,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x00,0x99,0x00,
+	0x00,0x99,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0x80,0xFF,0x01,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0x80,0xFF,0x01,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x00,0x99,0x00,
 
 	/* Index 11, character 43 "+" (width: 20 pixels) */
-	0x14, 0x00,0x99,0x00,0x00,0xFB,0x00,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0x80,0x7F,0x01,0xC0,0xBF,0x03,0xC0,0xCF,0x03,0xC0,0xE7,0x03,0xC0,0xE1,0x03,0xE0,0xF0,0x07,0xC0,0xE0,0x03,0xC0,0xE1,0x03,0xC0,0xF0,0x03,0x60,0xFC,0x03,0x40,0xFE,0x01,0xA0,0xFF,0x03,0xF0,0xFF,0x03,0x48,0xFF,0x00,0x00,0x99,0x00,0x00,0x08,0x00,
+	0x00,0x99,0x00,0x00,0xFB,0x00,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0x80,0x7F,0x01,0xC0,0xBF,0x03,0xC0,0xCF,0x03,0xC0,0xE7,0x03,0xC0,0xE1,0x03,0xE0,0xF0,0x07,0xC0,0xE0,0x03,0xC0,0xE1,0x03,0xC0,0xF0,0x03,0x60,0xFC,0x03,0x40,0xFE,0x01,0xA0,0xFF,0x03,0xF0,0xFF,0x03,0x48,0xFF,0x00,0x00,0x99,0x00,0x00,0x08,0x00,
 
 	/* Index 12, character 44 "," (width: 17 pixels) */
-	0x11, 0x00,0x00,0x04,0x00,0x00,0x06,0x00,0x00,0x07,0x00,0x80,0x03,0x00,0x40,0x03,0x00,0xA0,0x03,0x00,0xD0,0x01,0x00,0xEC,0x01,0x00,0xF6,0x01,0x00,0xF6,0x01,0x00,0xFE,0x00,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,
+	0x00,0x00,0x04,0x00,0x00,0x06,0x00,0x00,0x07,0x00,0x80,0x03,0x00,0x40,0x03,0x00,0xA0,0x03,0x00,0xD0,0x01,0x00,0xEC,0x01,0x00,0xF6,0x01,0x00,0xF6,0x01,0x00,0xFE,0x00,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,
 
 	/* Index 13, character 45 "-" (width: 11 pixels) */
-	0xB, 0x00,0x00,0x1C,0x00,0x00,0x1F,0xC0,0x83,0x07,0xE0,0xFF,0x03,0x30,0xFE,0x00,0x10,0xFE,0x00,0x10,0xFF,0x03,0xF0,0xC7,0x07,0xE0,0x81,0x0F,0x00,0x00,0x1E,0x00,0x00,0x1C,
+	0x00,0x00,0x1C,0x00,0x00,0x1F,0xC0,0x83,0x07,0xE0,0xFF,0x03,0x30,0xFE,0x00,0x10,0xFE,0x00,0x10,0xFF,0x03,0xF0,0xC7,0x07,0xE0,0x81,0x0F,0x00,0x00,0x1E,0x00,0x00,0x1C,
 
 	/* Index 14, character 46 "." (width: 21 pixels) */
-	0x15, 0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,
+	0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,
 
 	/* Index 15, character 47 "/" (width: 21 pixels) */
-	0x15, 0x00,0x00,0x40,0x00,0x00,0x70,0x00,0x00,0x7C,0x00,0x00,0x7F,0x00,0xC0,0x7F,0x00,0xF8,0x7F,0x00,0xFE,0x7F,0x80,0xFF,0x7F,0xE0,0xFF,0x7F,0xF8,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x3F,0xFC,0xFF,0x0F,0xFC,0xFF,0x03,0xFC,0xFF,0x00,0xFC,0x3F,0x00,0xFC,0x07,0x00,0xFC,0x01,0x00,0x7C,0x00,0x00,0x1C,0x00,0x00,0x04,0x00,0x00,
+	0x00,0x00,0x40,0x00,0x00,0x70,0x00,0x00,0x7C,0x00,0x00,0x7F,0x00,0xC0,0x7F,0x00,0xF8,0x7F,0x00,0xFE,0x7F,0x80,0xFF,0x7F,0xE0,0xFF,0x7F,0xF8,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x3F,0xFC,0xFF,0x0F,0xFC,0xFF,0x03,0xFC,0xFF,0x00,0xFC,0x3F,0x00,0xFC,0x07,0x00,0xFC,0x01,0x00,0x7C,0x00,0x00,0x1C,0x00,0x00,0x04,0x00,0x00,
 
 	/* Index 16, character 48 "0" (width: 11 pixels) */
-	0xB, 0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,
+	0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,
 
 	/* Index 17, character 49 "1" (width: 15 pixels) */
-	0xF, 0x80,0xFF,0x1F,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0xFF,0x1F,
+	0x80,0xFF,0x1F,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0x03,0x10,0x80,0xFF,0x1F,
 
 	/* Index 18, character 50 "2" (width: 15 pixels) */
-	0xF, 0x00,0xF0,0x1F,0x00,0x70,0x10,0x00,0x70,0x10,0x00,0x70,0x10,0x80,0x7F,0x10,0x80,0x73,0x10,0x80,0x73,0x10,0x80,0x73,0x10,0x80,0x73,0x10,0x80,0x73,0x10,0x80,0xF3,0x1F,0x80,0x83,0x00,0x80,0x83,0x00,0x80,0x83,0x00,0x80,0xFF,0x00,
+	0x00,0xF0,0x1F,0x00,0x70,0x10,0x00,0x70,0x10,0x00,0x70,0x10,0x80,0x7F,0x10,0x80,0x73,0x10,0x80,0x73,0x10,0x80,0x73,0x10,0x80,0x73,0x10,0x80,0x73,0x10,0x80,0xF3,0x1F,0x80,0x83,0x00,0x80,0x83,0x00,0x80,0x83,0x00,0x80,0xFF,0x00,
 
 	/* Index 19, character 51 "3" (width: 7 pixels) */
-	0x7, 0x00,0x18,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xFF,0x01,0xC0,0xFF,0x03,0xE0,0xFF,0x07,
+	0x00,0x18,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xFF,0x01,0xC0,0xFF,0x03,0xE0,0xFF,0x07,
 
 	/* Index 20, character 52 "4" (width: 7 pixels) */
-	0x7, 0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x80,0xFF,0x01,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x18,0x00,
+	0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x80,0xFF,0x01,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x18,0x00,
 
 	/* Index 21, character 53 "5" (width: 14 pixels) */
-	0xE, 0x00,0x80,0x00,0x00,0xC0,0x00,0x00,0xE0,0x00,0x00,0xF0,0x00,0x00,0xF8,0x00,0x00,0xFC,0x00,0x00,0xFE,0x00,0x00,0xFE,0x00,0x00,0xFC,0x00,0x00,0xF8,0x00,0x00,0xF0,0x00,0x00,0xE0,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,
+	0x00,0x80,0x00,0x00,0xC0,0x00,0x00,0xE0,0x00,0x00,0xF0,0x00,0x00,0xF8,0x00,0x00,0xFC,0x00,0x00,0xFE,0x00,0x00,0xFE,0x00,0x00,0xFC,0x00,0x00,0xF8,0x00,0x00,0xF0,0x00,0x00,0xE0,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,
 
 	/* Index 22, character 54 "6" (width: 14 pixels) */
-	0xE, 0x00,0x04,0x00,0x00,0x0C,0x00,0x00,0x1C,0x00,0x00,0x3C,0x00,0x00,0x7C,0x00,0x00,0xFC,0x00,0x00,0xFC,0x01,0x00,0xFC,0x01,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x0C,0x00,0x00,0x04,0x00,
+	0x00,0x04,0x00,0x00,0x0C,0x00,0x00,0x1C,0x00,0x00,0x3C,0x00,0x00,0x7C,0x00,0x00,0xFC,0x00,0x00,0xFC,0x01,0x00,0xFC,0x01,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x0C,0x00,0x00,0x04,0x00,
 
 	/* Index 23, character 55 "7" (width: 15 pixels) */
-	0xF, 0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,0xC0,0xFF,0x0F,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,0xC0,0xFF,0x0F,
+	0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,0xC0,0xFF,0x0F,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,0xC0,0xFF,0x0F,
 
 	/* Index 24, character 56 "8" (width: 15 pixels) */
-	0xF, 0xC0,0xFF,0x0F,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0xC0,0xFF,0x0F,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,
+	0xC0,0xFF,0x0F,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0xC0,0xFF,0x0F,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,
 
 	/* Index 25, character 57 "9" (width: 17 pixels) */
-	0x11, 0xC0,0xFF,0x0F,0xC0,0xFF,0x0F,0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,0xC0,0xFF,0x0F,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,0xC0,0xFF,0x0F,
+	0xC0,0xFF,0x0F,0xC0,0xFF,0x0F,0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,0xC0,0xFF,0x0F,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x80,0xFF,0x07,0xC0,0xFF,0x0F,
 
 	/* Index 26, character 58 ":" (width: 17 pixels) */
-	0x11, 0xC0,0xFF,0x0F,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0xC0,0xFF,0x0F,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,0xC0,0xFF,0x0F,0xC0,0xFF,0x0F,
+	0xC0,0xFF,0x0F,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0xC0,0xFF,0x0F,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,0xC0,0xFF,0x0F,0xC0,0xFF,0x0F,
 
 	/* Index 27, character 59 ";" (width: 9 pixels) */
-	0x9, 0x80,0xFF,0x0F,0x80,0xFF,0x0F,0x80,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0x0F,0x80,0xFF,0x0F,0x80,0xFF,0x0F,
+	0x80,0xFF,0x0F,0x80,0xFF,0x0F,0x80,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0x0F,0x80,0xFF,0x0F,0x80,0xFF,0x0F,
 
 	/* Index 28, character 60 "<" (width: 12 pixels) */
-	0xC, 0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,
+	0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,
 
 	/* Index 29, character 61 "=" (width: 12 pixels) */
-	0xC, 0x00,0x78,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x00,0xFF,0x03,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0x78,0x00,
+	0x00,0x78,0x00,0x00,0xFE,0x01,0x00,0xFF,0x03,0x00,0xFF,0x03,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFF,0x03,0x00,0xFE,0x01,0x00,0x78,0x00,
 
 	/* Index 30, character 62 ">" (width: 16 pixels) */
-	0x10, 0x00,0x00,0x04,0x00,0x80,0x07,0x00,0xF0,0x03,0x00,0x38,0x01,0x00,0x38,0x01,0x00,0xF0,0x03,0x00,0x80,0x05,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xFE,0x00,0x00,0xC7,0x00,0x00,0xC7,0x00,0x00,0xFE,0x00,0x00,0xF0,0x01,0x00,0x80,0x07,0x00,0x00,0x04,
+	0x00,0x00,0x04,0x00,0x80,0x07,0x00,0xF0,0x03,0x00,0x38,0x01,0x00,0x38,0x01,0x00,0xF0,0x03,0x00,0x80,0x05,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0xFE,0x00,0x00,0xC7,0x00,0x00,0xC7,0x00,0x00,0xFE,0x00,0x00,0xF0,0x01,0x00,0x80,0x07,0x00,0x00,0x04,
 
 	/* Index 31, character 63 "?" (width: 17 pixels) */
-	0x11, 0x00,0xF0,0x03,0x00,0xF0,0x07,0x00,0xF0,0x07,0x00,0xF0,0x07,0x00,0xF8,0x0F,0x80,0xF8,0x0F,0x40,0xF9,0x0F,0x20,0xFF,0x1F,0x10,0xF9,0x1F,0x90,0xE0,0x1F,0xC8,0xEF,0x0F,0xB8,0xF0,0x0F,0x90,0xF8,0x0F,0xA0,0xFC,0x07,0xC0,0xF2,0x07,0x80,0xF2,0x07,0x80,0xF1,0x03,
+	0x00,0xF0,0x03,0x00,0xF0,0x07,0x00,0xF0,0x07,0x00,0xF0,0x07,0x00,0xF8,0x0F,0x80,0xF8,0x0F,0x40,0xF9,0x0F,0x20,0xFF,0x1F,0x10,0xF9,0x1F,0x90,0xE0,0x1F,0xC8,0xEF,0x0F,0xB8,0xF0,0x0F,0x90,0xF8,0x0F,0xA0,0xFC,0x07,0xC0,0xF2,0x07,0x80,0xF2,0x07,0x80,0xF1,0x03,
 
 	/* Index 32, character 64 "@" (width: 17 pixels) */
-	0x11, 0x00,0x02,0x00,0x00,0x07,0x00,0x00,0x0F,0x02,0xC0,0x07,0x01,0xC0,0x01,0x11,0xE0,0x82,0x1B,0xF0,0xC7,0x0F,0x30,0xCF,0x01,0x30,0xFE,0x00,0x00,0x7C,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0xC0,0xCF,0x03,0xE0,0x87,0x07,0x20,0x03,0x1F,0x00,0x03,0x0E,0x80,0x01,0x04,
+	0x00,0x02,0x00,0x00,0x07,0x00,0x00,0x0F,0x02,0xC0,0x07,0x01,0xC0,0x01,0x11,0xE0,0x82,0x1B,0xF0,0xC7,0x0F,0x30,0xCF,0x01,0x30,0xFE,0x00,0x00,0x7C,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0xC0,0xCF,0x03,0xE0,0x87,0x07,0x20,0x03,0x1F,0x00,0x03,0x0E,0x80,0x01,0x04,
 
 	/* Index 33, character 65 "A" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x3C,0xE0,0x7F,0x24,0x00,0x70,0xBC,0xFF,0x77,0xBC,0x24,0x75,0xBC,0xFF,0x77,0x3C,0x00,0x70,0x24,0xC0,0x7F,0x3C,0xC0,0x7F,0x24,0xCF,0x7F,0xFC,0xC9,0x7F,0x3C,0xC4,0x7F,0x3C,0xC0,0x7F,0x3C,0x14,0x7F,0x24,0x7E,0x7F,0x3C,0x14,0x7F,0x00,0xD4,0x7F,0x00,0x14,0x7F,0x00,0x7E,0x7F,0x00,0x14,0x7F,0x00,0xC0,0x7F,
+	0x00,0xE0,0x7F,0x3C,0xE0,0x7F,0x24,0x00,0x70,0xBC,0xFF,0x77,0xBC,0x24,0x75,0xBC,0xFF,0x77,0x3C,0x00,0x70,0x24,0xC0,0x7F,0x3C,0xC0,0x7F,0x24,0xCF,0x7F,0xFC,0xC9,0x7F,0x3C,0xC4,0x7F,0x3C,0xC0,0x7F,0x3C,0x14,0x7F,0x24,0x7E,0x7F,0x3C,0x14,0x7F,0x00,0xD4,0x7F,0x00,0x14,0x7F,0x00,0x7E,0x7F,0x00,0x14,0x7F,0x00,0xC0,0x7F,
 
 	/* Index 34, character 66 "B" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xFE,0x7F,0x80,0x03,0x7F,0x40,0xF1,0x7F,0xC0,0xF0,0x6F,0x20,0x35,0x67,0xA0,0xFF,0x67,0xB0,0x01,0x64,0x70,0x01,0x6C,0x80,0xE0,0x5F,0x80,0xE0,0x5F,0x40,0x00,0x5C,0x40,0xE0,0x1C,0xE0,0xE0,0x1C,0x60,0xE0,0x1C,0xD0,0x05,0x1C,0x20,0xFA,0x1F,0x30,0xCC,0x3F,0x70,0xC0,0x3F,0x80,0xFF,0x7F,0x00,0xE1,0x7F,
+	0x00,0xE0,0x7F,0x00,0xFE,0x7F,0x80,0x03,0x7F,0x40,0xF1,0x7F,0xC0,0xF0,0x6F,0x20,0x35,0x67,0xA0,0xFF,0x67,0xB0,0x01,0x64,0x70,0x01,0x6C,0x80,0xE0,0x5F,0x80,0xE0,0x5F,0x40,0x00,0x5C,0x40,0xE0,0x1C,0xE0,0xE0,0x1C,0x60,0xE0,0x1C,0xD0,0x05,0x1C,0x20,0xFA,0x1F,0x30,0xCC,0x3F,0x70,0xC0,0x3F,0x80,0xFF,0x7F,0x00,0xE1,0x7F,
 
 	/* Index 35, character 67 "C" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0x5C,0x7F,0x00,0xF0,0x7F,0x80,0xDF,0x7F,0x80,0xFB,0x7F,0xF0,0xFF,0x7F,0xF0,0xAD,0x7F,0xD0,0xFF,0x7F,0xF0,0xEF,0x7F,0x00,0xFC,0x7F,0x00,0xFC,0x7D,0x80,0xFF,0x7F,0xC0,0xFD,0x7F,0xC0,0xFF,0x7D,0x00,0x78,0x7F,0x00,0xDC,0x7F,0x00,0xF4,0x7F,0x00,0xFC,0x7F,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0x00,0xFC,0x7F,0x00,0xFC,0x7F,0x00,0x5C,0x7F,0x00,0xF0,0x7F,0x80,0xDF,0x7F,0x80,0xFB,0x7F,0xF0,0xFF,0x7F,0xF0,0xAD,0x7F,0xD0,0xFF,0x7F,0xF0,0xEF,0x7F,0x00,0xFC,0x7F,0x00,0xFC,0x7D,0x80,0xFF,0x7F,0xC0,0xFD,0x7F,0xC0,0xFF,0x7D,0x00,0x78,0x7F,0x00,0xDC,0x7F,0x00,0xF4,0x7F,0x00,0xFC,0x7F,0x00,0xE0,0x7F,
 
 	/* Index 36, character 68 "D" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE4,0x7F,0x00,0xEA,0x7B,0x00,0xF9,0x71,0x00,0x81,0x72,0x80,0x44,0x75,0x40,0xCA,0x66,0x60,0xFC,0x67,0x20,0xF8,0x67,0x10,0xF8,0x6F,0x20,0x78,0x4E,0x20,0x7C,0x0E,0x70,0xFC,0x0E,0x10,0x7A,0x0F,0xF0,0x84,0x1E,0x00,0xF9,0x1F,0x00,0xEA,0x1F,0x00,0xE4,0x3F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE4,0x7F,0x00,0xEA,0x7B,0x00,0xF9,0x71,0x00,0x81,0x72,0x80,0x44,0x75,0x40,0xCA,0x66,0x60,0xFC,0x67,0x20,0xF8,0x67,0x10,0xF8,0x6F,0x20,0x78,0x4E,0x20,0x7C,0x0E,0x70,0xFC,0x0E,0x10,0x7A,0x0F,0xF0,0x84,0x1E,0x00,0xF9,0x1F,0x00,0xEA,0x1F,0x00,0xE4,0x3F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
 
 	/* Index 37, character 69 "E" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xE0,0x7F,0xF0,0xF0,0x7F,0xF8,0xF1,0x7F,0xF8,0xC9,0x7F,0xF8,0xF9,0x7F,0xF8,0xF1,0x7F,0xF0,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xF0,0x7F,0x00,0xB0,0x7F,0x00,0xC8,0x7F,0xC0,0xFB,0x7F,0x00,0xF4,0x7F,0x00,0xF4,0x7F,0xF0,0xFF,0x7F,0x00,0xE8,0x7F,0x00,0xEF,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0x00,0xE0,0x7F,0xF0,0xF0,0x7F,0xF8,0xF1,0x7F,0xF8,0xC9,0x7F,0xF8,0xF9,0x7F,0xF8,0xF1,0x7F,0xF0,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xF0,0x7F,0x00,0xB0,0x7F,0x00,0xC8,0x7F,0xC0,0xFB,0x7F,0x00,0xF4,0x7F,0x00,0xF4,0x7F,0xF0,0xFF,0x7F,0x00,0xE8,0x7F,0x00,0xEF,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
 
 	/* Index 38, character 70 "F" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xE0,0x7F,0xE0,0xFF,0x7F,0x40,0x00,0x7E,0x40,0x3C,0x7E,0x80,0x3C,0x7E,0xE0,0x3C,0x7E,0x40,0x3C,0x7E,0x40,0x00,0x7E,0x80,0x3C,0x7E,0xE0,0x3C,0x7E,0x40,0x3C,0x7E,0x80,0x3C,0x7E,0xC0,0x00,0x7E,0x70,0x3C,0x7E,0x08,0x3C,0x7E,0x08,0x3C,0x7E,0x08,0x3C,0x7E,0xF8,0xFF,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0x00,0xE0,0x7F,0xE0,0xFF,0x7F,0x40,0x00,0x7E,0x40,0x3C,0x7E,0x80,0x3C,0x7E,0xE0,0x3C,0x7E,0x40,0x3C,0x7E,0x40,0x00,0x7E,0x80,0x3C,0x7E,0xE0,0x3C,0x7E,0x40,0x3C,0x7E,0x80,0x3C,0x7E,0xC0,0x00,0x7E,0x70,0x3C,0x7E,0x08,0x3C,0x7E,0x08,0x3C,0x7E,0x08,0x3C,0x7E,0xF8,0xFF,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
 
 	/* Index 39, character 71 "G" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x6F,0xC0,0xE1,0x63,0xA0,0xFF,0x63,0xA0,0x01,0x62,0xB0,0xFF,0x63,0xB0,0xFF,0x63,0xB0,0x01,0x62,0xA8,0xFF,0x63,0xA8,0xFF,0x63,0xA8,0xFF,0x63,0xB0,0x01,0x62,0xB0,0xFF,0x63,0xB0,0xFF,0x63,0xA0,0x01,0x62,0xA0,0xFF,0x63,0xC0,0xE1,0x63,0x00,0xE0,0x6F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x6F,0xC0,0xE1,0x63,0xA0,0xFF,0x63,0xA0,0x01,0x62,0xB0,0xFF,0x63,0xB0,0xFF,0x63,0xB0,0x01,0x62,0xA8,0xFF,0x63,0xA8,0xFF,0x63,0xA8,0xFF,0x63,0xB0,0x01,0x62,0xB0,0xFF,0x63,0xB0,0xFF,0x63,0xA0,0x01,0x62,0xA0,0xFF,0x63,0xC0,0xE1,0x63,0x00,0xE0,0x6F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
 
 	/* Index 40, character 72 "H" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE4,0x7F,0x00,0xEA,0x7B,0x00,0xF9,0x71,0x00,0x01,0x72,0x80,0x00,0x76,0x40,0xF0,0x67,0x40,0xF0,0x67,0x20,0xF0,0x67,0x10,0x00,0x6E,0x20,0x70,0x4E,0x30,0x70,0x0E,0x10,0x70,0x0E,0x10,0x70,0x0E,0xF0,0x00,0x0E,0x00,0xF9,0x1F,0x00,0xEA,0x1F,0x00,0xE4,0x3F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE4,0x7F,0x00,0xEA,0x7B,0x00,0xF9,0x71,0x00,0x01,0x72,0x80,0x00,0x76,0x40,0xF0,0x67,0x40,0xF0,0x67,0x20,0xF0,0x67,0x10,0x00,0x6E,0x20,0x70,0x4E,0x30,0x70,0x0E,0x10,0x70,0x0E,0x10,0x70,0x0E,0xF0,0x00,0x0E,0x00,0xF9,0x1F,0x00,0xEA,0x1F,0x00,0xE4,0x3F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
 
 	/* Index 41, character 73 "I" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xE0,0x77,0x00,0xF0,0x63,0x00,0xF0,0x6B,0x00,0xF0,0x5B,0x00,0x70,0x5B,0x20,0xF0,0x6B,0xE0,0xF0,0x6A,0xE0,0x7C,0x4B,0xE0,0xF3,0x0B,0xE0,0xF1,0x0B,0xE0,0xF1,0x0B,0xE0,0xF3,0x3A,0xC0,0xF3,0x48,0x80,0xF3,0x4A,0x00,0xF2,0x76,0x00,0xF0,0x76,0x00,0xF0,0x7E,0x00,0xF0,0x7A,0x00,0xE0,0x7D,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0x00,0xE0,0x77,0x00,0xF0,0x63,0x00,0xF0,0x6B,0x00,0xF0,0x5B,0x00,0x70,0x5B,0x20,0xF0,0x6B,0xE0,0xF0,0x6A,0xE0,0x7C,0x4B,0xE0,0xF3,0x0B,0xE0,0xF1,0x0B,0xE0,0xF1,0x0B,0xE0,0xF3,0x3A,0xC0,0xF3,0x48,0x80,0xF3,0x4A,0x00,0xF2,0x76,0x00,0xF0,0x76,0x00,0xF0,0x7E,0x00,0xF0,0x7A,0x00,0xE0,0x7D,0x00,0xE0,0x7F,
 
 	/* Index 42, character 74 "J" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7E,0x00,0x60,0x7C,0x00,0x60,0x7C,0x00,0x20,0x78,0x00,0x22,0x78,0xA0,0x21,0x78,0xA0,0x20,0x78,0x78,0x20,0x78,0xE8,0x20,0x78,0x70,0x67,0x78,0xD0,0x7C,0x78,0x90,0x63,0x78,0x20,0xA0,0x78,0x00,0x60,0x78,0x00,0x60,0x7C,0x00,0x60,0x7C,0x00,0xE0,0x7E,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7E,0x00,0x60,0x7C,0x00,0x60,0x7C,0x00,0x20,0x78,0x00,0x22,0x78,0xA0,0x21,0x78,0xA0,0x20,0x78,0x78,0x20,0x78,0xE8,0x20,0x78,0x70,0x67,0x78,0xD0,0x7C,0x78,0x90,0x63,0x78,0x20,0xA0,0x78,0x00,0x60,0x78,0x00,0x60,0x7C,0x00,0x60,0x7C,0x00,0xE0,0x7E,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
 
 	/* Index 43, character 75 "K" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x5F,0x00,0xE0,0x4F,0x00,0xE0,0x47,0x00,0xE0,0x43,0x00,0xE0,0x41,0x00,0xE0,0x40,0x00,0xE0,0x50,0x80,0x6F,0x58,0x80,0x68,0x5B,0x80,0x8B,0x5B,0xC0,0x7B,0x41,0x80,0x0B,0x41,0x80,0xEB,0x41,0x80,0xEB,0x43,0x80,0x0B,0x47,0xC0,0x7B,0x4F,0x80,0x0B,0x5F,0x80,0xE8,0x7F,0x80,0xEF,0x7F,
+	0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x5F,0x00,0xE0,0x4F,0x00,0xE0,0x47,0x00,0xE0,0x43,0x00,0xE0,0x41,0x00,0xE0,0x40,0x00,0xE0,0x50,0x80,0x6F,0x58,0x80,0x68,0x5B,0x80,0x8B,0x5B,0xC0,0x7B,0x41,0x80,0x0B,0x41,0x80,0xEB,0x41,0x80,0xEB,0x43,0x80,0x0B,0x47,0xC0,0x7B,0x4F,0x80,0x0B,0x5F,0x80,0xE8,0x7F,0x80,0xEF,0x7F,
 
 	/* Index 44, character 76 "L" (width: 9 pixels) */
-	0x9, 0x80,0x0F,0x00,0xE0,0x1B,0x00,0x20,0x3C,0x00,0xD0,0x7B,0x00,0xD0,0xF1,0x1F,0x50,0x14,0x1E,0xB0,0x13,0x00,0x60,0x08,0x00,0x80,0x07,0x00,
+	0x80,0x0F,0x00,0xE0,0x1B,0x00,0x20,0x3C,0x00,0xD0,0x7B,0x00,0xD0,0xF1,0x1F,0x50,0x14,0x1E,0xB0,0x13,0x00,0x60,0x08,0x00,0x80,0x07,0x00,
 
 	/* Index 45, character 77 "M" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xF8,0x7F,0x00,0xE8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xFC,0x7F,0x00,0xFE,0x7F,0x80,0xF9,0x7F,0xC0,0xF0,0x7F,0x40,0xE1,0x7F,0x80,0xF9,0x7F,0x80,0xF9,0x7F,0x80,0xFB,0x7F,0x80,0xF3,0x7F,0x00,0xFF,0x7F,0x00,0xFE,0x7F,0x00,0xEC,0x7F,0x00,0xF8,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xF8,0x7F,0x00,0xE8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xFC,0x7F,0x00,0xFE,0x7F,0x80,0xF9,0x7F,0xC0,0xF0,0x7F,0x40,0xE1,0x7F,0x80,0xF9,0x7F,0x80,0xF9,0x7F,0x80,0xFB,0x7F,0x80,0xF3,0x7F,0x00,0xFF,0x7F,0x00,0xFE,0x7F,0x00,0xEC,0x7F,0x00,0xF8,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,
 
 	/* Index 46, character 78 "N" (width: 17 pixels) */
-	0x11, 0x00,0x08,0x00,0x00,0x3E,0x00,0x00,0x67,0x00,0x80,0xC1,0x00,0x80,0xBC,0x00,0xC0,0x60,0x01,0x40,0xD8,0x01,0xC0,0xB8,0x01,0xC0,0xB6,0x01,0xC0,0xBE,0x01,0xC0,0xDD,0x01,0x40,0x63,0x01,0x80,0xBE,0x00,0x80,0xC1,0x00,0x00,0x63,0x00,0x00,0x3E,0x00,0x00,0x08,0x00,
+	0x00,0x08,0x00,0x00,0x3E,0x00,0x00,0x67,0x00,0x80,0xC1,0x00,0x80,0xBC,0x00,0xC0,0x60,0x01,0x40,0xD8,0x01,0xC0,0xB8,0x01,0xC0,0xB6,0x01,0xC0,0xBE,0x01,0xC0,0xDD,0x01,0x40,0x63,0x01,0x80,0xBE,0x00,0x80,0xC1,0x00,0x00,0x63,0x00,0x00,0x3E,0x00,0x00,0x08,0x00,
 
 	/* Index 47, character 79 "O" (width: 12 pixels) */
-	0xC, 0x00,0x80,0x0F,0x80,0x07,0x18,0x60,0xC0,0x11,0xA0,0x33,0x11,0xD0,0xB6,0x10,0x50,0x44,0x0C,0x50,0x38,0x03,0x50,0x80,0x00,0x90,0x48,0x00,0x20,0x27,0x00,0x60,0x10,0x00,0x80,0x0F,0x00,
+	0x00,0x80,0x0F,0x80,0x07,0x18,0x60,0xC0,0x11,0xA0,0x33,0x11,0xD0,0xB6,0x10,0x50,0x44,0x0C,0x50,0x38,0x03,0x50,0x80,0x00,0x90,0x48,0x00,0x20,0x27,0x00,0x60,0x10,0x00,0x80,0x0F,0x00,
 
 	/* Index 48, character 80 "P" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xA0,0x7F,0x00,0x20,0x7F,0x00,0x20,0x7F,0x00,0x60,0x3F,0x00,0x60,0x3F,0x00,0x60,0x3F,0x00,0x60,0x1F,0x00,0x64,0x1E,0x80,0x66,0x0E,0xC0,0xE6,0x06,0xF0,0xE7,0x00,0xF8,0xFF,0x00,0xF8,0xFF,0x00,0xF0,0xE7,0x00,0xC0,0xE6,0x40,0x80,0xE6,0x61,0x00,0xE4,0x71,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xA0,0x7F,0x00,0x20,0x7F,0x00,0x20,0x7F,0x00,0x60,0x3F,0x00,0x60,0x3F,0x00,0x60,0x3F,0x00,0x60,0x1F,0x00,0x64,0x1E,0x80,0x66,0x0E,0xC0,0xE6,0x06,0xF0,0xE7,0x00,0xF8,0xFF,0x00,0xF8,0xFF,0x00,0xF0,0xE7,0x00,0xC0,0xE6,0x40,0x80,0xE6,0x61,0x00,0xE4,0x71,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
 
 	/* Index 49, character 81 "Q" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7B,0x00,0xE0,0x78,0x00,0x18,0x78,0x00,0xC6,0x7F,0x00,0xC3,0x7F,0x00,0xCC,0x7F,0x00,0x18,0x78,0x00,0xE4,0x78,0x80,0xE6,0x7B,0xC0,0xE6,0x7F,0xF0,0xE7,0x7F,0xF8,0xFF,0x7F,0xF8,0xFF,0x7F,0xF0,0xE7,0x7F,0xC0,0xE6,0x7F,0x80,0xE6,0x7F,0x00,0xE4,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7B,0x00,0xE0,0x78,0x00,0x18,0x78,0x00,0xC6,0x7F,0x00,0xC3,0x7F,0x00,0xCC,0x7F,0x00,0x18,0x78,0x00,0xE4,0x78,0x80,0xE6,0x7B,0xC0,0xE6,0x7F,0xF0,0xE7,0x7F,0xF8,0xFF,0x7F,0xF8,0xFF,0x7F,0xF0,0xE7,0x7F,0xC0,0xE6,0x7F,0x80,0xE6,0x7F,0x00,0xE4,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
 
 	/* Index 50, character 82 "R" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xF0,0x5F,0x00,0xF0,0x4F,0x00,0xF8,0x5F,0x00,0xF8,0x7B,0x00,0xF8,0x79,0x00,0xF0,0x56,0x00,0xF0,0x5D,0x00,0xE0,0x5A,0x00,0xE0,0x5A,0x00,0xA0,0x5B,0x00,0x60,0x5D,0x00,0xF0,0x7A,0x00,0xF0,0x79,0x00,0xF0,0x5B,0x00,0xF0,0x57,0x00,0xF0,0x4F,0x00,0xE0,0x5F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xF0,0x5F,0x00,0xF0,0x4F,0x00,0xF8,0x5F,0x00,0xF8,0x7B,0x00,0xF8,0x79,0x00,0xF0,0x56,0x00,0xF0,0x5D,0x00,0xE0,0x5A,0x00,0xE0,0x5A,0x00,0xA0,0x5B,0x00,0x60,0x5D,0x00,0xF0,0x7A,0x00,0xF0,0x79,0x00,0xF0,0x5B,0x00,0xF0,0x57,0x00,0xF0,0x4F,0x00,0xE0,0x5F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
 
 	/* Index 51, character 83 "S" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0xF0,0xA0,0x7F,0x60,0x7F,0x7F,0x20,0xD6,0x7F,0x60,0xFE,0x7E,0x98,0xB3,0x7E,0x18,0xE6,0x6F,0x10,0x15,0x7C,0xF0,0x15,0x7E,0x18,0x95,0x7F,0x14,0xB5,0x7F,0x90,0xB5,0x7F,0x70,0x95,0x7F,0x10,0x15,0x7C,0x50,0xB5,0x6C,0xA8,0x52,0x7F,0xE0,0xFE,0x7F,0x20,0xD7,0x7F,0x20,0xFF,0x7F,0xD0,0xE0,0x7F,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0xF0,0xA0,0x7F,0x60,0x7F,0x7F,0x20,0xD6,0x7F,0x60,0xFE,0x7E,0x98,0xB3,0x7E,0x18,0xE6,0x6F,0x10,0x15,0x7C,0xF0,0x15,0x7E,0x18,0x95,0x7F,0x14,0xB5,0x7F,0x90,0xB5,0x7F,0x70,0x95,0x7F,0x10,0x15,0x7C,0x50,0xB5,0x6C,0xA8,0x52,0x7F,0xE0,0xFE,0x7F,0x20,0xD7,0x7F,0x20,0xFF,0x7F,0xD0,0xE0,0x7F,0x00,0xE0,0x7F,
 
 	/* Index 52, character 84 "T" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xE0,0x7E,0x00,0xE0,0x7E,0xC0,0x61,0x7F,0x40,0x67,0x7F,0xC0,0xC1,0x7C,0xE0,0x7F,0x7E,0xA0,0x7F,0x7F,0xF0,0x7F,0x7F,0xD0,0x7F,0x7E,0xD8,0x7F,0x7C,0xDC,0x7E,0x7D,0xFC,0x7F,0x7D,0xDC,0x7F,0x7D,0xD0,0x7E,0x7D,0xD8,0xBB,0x7F,0xE0,0xBF,0x7F,0x00,0xB4,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0x00,0xE0,0x7E,0x00,0xE0,0x7E,0xC0,0x61,0x7F,0x40,0x67,0x7F,0xC0,0xC1,0x7C,0xE0,0x7F,0x7E,0xA0,0x7F,0x7F,0xF0,0x7F,0x7F,0xD0,0x7F,0x7E,0xD8,0x7F,0x7C,0xDC,0x7E,0x7D,0xFC,0x7F,0x7D,0xDC,0x7F,0x7D,0xD0,0x7E,0x7D,0xD8,0xBB,0x7F,0xE0,0xBF,0x7F,0x00,0xB4,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
 
 	/* Index 53, character 85 "U" (width: 20 pixels) */
-	0x14, 0x00,0xE0,0x00,0x00,0x80,0x00,0x00,0xE0,0x00,0x00,0xF0,0x00,0x00,0xFC,0x03,0x00,0xE4,0x1F,0x00,0x42,0x1C,0x00,0x41,0x00,0x00,0x41,0x00,0x80,0xC0,0x00,0xC0,0xFF,0x00,0xE0,0xC3,0x00,0xE0,0xFF,0x01,0x80,0xFF,0x03,0x40,0xFD,0x01,0x80,0x1E,0x00,0x90,0xC1,0x00,0x20,0x3E,0x00,0xC0,0xC0,0x00,0x00,0x3F,0x00,
+	0x00,0xE0,0x00,0x00,0x80,0x00,0x00,0xE0,0x00,0x00,0xF0,0x00,0x00,0xFC,0x03,0x00,0xE4,0x1F,0x00,0x42,0x1C,0x00,0x41,0x00,0x00,0x41,0x00,0x80,0xC0,0x00,0xC0,0xFF,0x00,0xE0,0xC3,0x00,0xE0,0xFF,0x01,0x80,0xFF,0x03,0x40,0xFD,0x01,0x80,0x1E,0x00,0x90,0xC1,0x00,0x20,0x3E,0x00,0xC0,0xC0,0x00,0x00,0x3F,0x00,
 
 	/* Index 54, character 86 "V" (width: 15 pixels) */
-	0xF, 0x00,0xC0,0x00,0x00,0x00,0x01,0x00,0xE0,0x00,0x00,0xF0,0x00,0x00,0xFC,0x03,0x00,0xE4,0x1F,0x00,0x42,0x1C,0x00,0x41,0x00,0x00,0x41,0x00,0x80,0x40,0x00,0xC0,0xDF,0x00,0xE0,0xA3,0x00,0xE0,0xFF,0x00,0x80,0xFF,0x01,0x00,0xFC,0x00,
+	0x00,0xC0,0x00,0x00,0x00,0x01,0x00,0xE0,0x00,0x00,0xF0,0x00,0x00,0xFC,0x03,0x00,0xE4,0x1F,0x00,0x42,0x1C,0x00,0x41,0x00,0x00,0x41,0x00,0x80,0x40,0x00,0xC0,0xDF,0x00,0xE0,0xA3,0x00,0xE0,0xFF,0x00,0x80,0xFF,0x01,0x00,0xFC,0x00,
 
 	/* Index 55, character 87 "W" (width: 8 pixels) */
-	0x8, 0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x80,0xFF,0x01,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,
+	0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x80,0xFF,0x01,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,
 
 	/* Index 56, character 88 "X" (width: 8 pixels) */
-	0x8, 0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xFF,0x01,0xC0,0xFF,0x03,0xE0,0xFF,0x07,
+	0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xFF,0x01,0xC0,0xFF,0x03,0xE0,0xFF,0x07,
 
 	/* Index 57, character 89 "Y" (width: 16 pixels) */
-	0x10, 0x00,0x0F,0x00,0x80,0x3F,0x00,0xC0,0x7F,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x01,0xC0,0xFF,0x1F,0xC0,0xFF,0x0F,0x80,0xFF,0x0F,0x80,0xFF,0x07,0x80,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x01,0xC0,0xFF,0x00,0xC0,0x7F,0x00,0x80,0x3F,0x00,0x00,0x0F,0x00,
+	0x00,0x0F,0x00,0x80,0x3F,0x00,0xC0,0x7F,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x01,0xC0,0xFF,0x1F,0xC0,0xFF,0x0F,0x80,0xFF,0x0F,0x80,0xFF,0x07,0x80,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x01,0xC0,0xFF,0x00,0xC0,0x7F,0x00,0x80,0x3F,0x00,0x00,0x0F,0x00,
 
 	/* Index 58, character 90 "Z" (width: 14 pixels) */
-	0xE, 0x00,0x00,0x0A,0x40,0x00,0x06,0xC0,0x00,0x1B,0xC0,0x81,0x07,0x40,0xC1,0x01,0x48,0xD9,0x00,0x38,0x33,0x00,0xD4,0x36,0x00,0xC4,0x1D,0x00,0xF0,0x2B,0x00,0xF0,0x5F,0x00,0x58,0x75,0x00,0x38,0x03,0x00,0x08,0x00,0x00,
+	0x00,0x00,0x0A,0x40,0x00,0x06,0xC0,0x00,0x1B,0xC0,0x81,0x07,0x40,0xC1,0x01,0x48,0xD9,0x00,0x38,0x33,0x00,0xD4,0x36,0x00,0xC4,0x1D,0x00,0xF0,0x2B,0x00,0xF0,0x5F,0x00,0x58,0x75,0x00,0x38,0x03,0x00,0x08,0x00,0x00,
 
 	/* Index 59, character 91 "[" (width: 19 pixels) */
-	0x13, 0x00,0x08,0x00,0x00,0x3F,0x00,0x80,0xFF,0x00,0x80,0x7F,0x00,0x80,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x01,0x80,0xFF,0x01,0xC0,0xFF,0x01,0x80,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0x80,0xFF,0x03,0x80,0xFF,0x03,0x00,0xFF,0x03,0x00,0xFF,0x0D,0x00,0x1E,0x0C,
+	0x00,0x08,0x00,0x00,0x3F,0x00,0x80,0xFF,0x00,0x80,0x7F,0x00,0x80,0xFF,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x01,0x80,0xFF,0x01,0xC0,0xFF,0x01,0x80,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0x80,0xFF,0x03,0x80,0xFF,0x03,0x00,0xFF,0x03,0x00,0xFF,0x0D,0x00,0x1E,0x0C,
 
 	/* Index 60, character 92 "\" (width: 21 pixels) */
-	0x15, 0x04,0x00,0x00,0x1C,0x00,0x00,0x7C,0x00,0x00,0xFC,0x01,0x00,0xFC,0x07,0x00,0xFC,0x3F,0x00,0xFC,0xFF,0x00,0xFC,0xFF,0x03,0xFC,0xFF,0x0F,0xFC,0xFF,0x3F,0xFC,0xFF,0x7F,0xF8,0xFF,0x7F,0xE0,0xFF,0x7F,0x80,0xFF,0x7F,0x00,0xFE,0x7F,0x00,0xF8,0x7F,0x00,0xC0,0x7F,0x00,0x00,0x7F,0x00,0x00,0x7C,0x00,0x00,0x70,0x00,0x00,0x40,
+	0x04,0x00,0x00,0x1C,0x00,0x00,0x7C,0x00,0x00,0xFC,0x01,0x00,0xFC,0x07,0x00,0xFC,0x3F,0x00,0xFC,0xFF,0x00,0xFC,0xFF,0x03,0xFC,0xFF,0x0F,0xFC,0xFF,0x3F,0xFC,0xFF,0x7F,0xF8,0xFF,0x7F,0xE0,0xFF,0x7F,0x80,0xFF,0x7F,0x00,0xFE,0x7F,0x00,0xF8,0x7F,0x00,0xC0,0x7F,0x00,0x00,0x7F,0x00,0x00,0x7C,0x00,0x00,0x70,0x00,0x00,0x40,
 
 	/* Index 61, character 93 "]" (width: 19 pixels) */
-	0x13, 0x00,0x00,0x0C,0x00,0x1E,0x0C,0x00,0xFF,0x0D,0x00,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x00,0xC0,0xFF,0x01,0xC0,0xFF,0x00,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x00,0x80,0xFF,0x00,0x80,0x7F,0x00,0x80,0xFF,0x00,0x00,0x3F,0x00,0x00,0x08,0x00,
+	0x00,0x00,0x0C,0x00,0x1E,0x0C,0x00,0xFF,0x0D,0x00,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x00,0xC0,0xFF,0x01,0xC0,0xFF,0x00,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x00,0x80,0xFF,0x00,0x80,0x7F,0x00,0x80,0xFF,0x00,0x00,0x3F,0x00,0x00,0x08,0x00,
 
 	/* Index 62, character 94 "^" (width: 20 pixels) */
-	0x14, 0x00,0x70,0x08,0x00,0xFC,0x0C,0x00,0xFC,0x0F,0x00,0xFE,0x07,0x00,0xFE,0x03,0x00,0xFE,0x03,0x00,0xFE,0x03,0x00,0xFE,0x03,0x80,0xFF,0x03,0xE0,0xFD,0x01,0xE0,0xFF,0x00,0xF0,0x77,0x00,0xF0,0x0F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x3F,0x00,0xE0,0x7F,0x00,0xE0,0x47,0x00,0x80,0x03,0x00,
+	0x00,0x70,0x08,0x00,0xFC,0x0C,0x00,0xFC,0x0F,0x00,0xFE,0x07,0x00,0xFE,0x03,0x00,0xFE,0x03,0x00,0xFE,0x03,0x00,0xFE,0x03,0x80,0xFF,0x03,0xE0,0xFD,0x01,0xE0,0xFF,0x00,0xF0,0x77,0x00,0xF0,0x0F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x3F,0x00,0xE0,0x7F,0x00,0xE0,0x47,0x00,0x80,0x03,0x00,
 
 	/* Index 63, character 95 "_" (width: 20 pixels) */
-	0x14, 0x00,0x1C,0x04,0x00,0x3F,0x06,0x00,0xFF,0x07,0x80,0xFF,0x03,0x80,0xFF,0x00,0x80,0xFF,0x02,0x80,0xFF,0x06,0x80,0xFF,0x06,0xE0,0xFF,0x0E,0x70,0x7F,0x0E,0xF0,0x7F,0x6F,0xF8,0x9D,0x3F,0xF8,0xC3,0x1F,0xF8,0xEF,0x0F,0xF8,0xEF,0x0F,0xF8,0xEF,0x07,0xF8,0xDF,0x07,0xF0,0xBF,0x03,0xF0,0x27,0x00,0xC0,0x01,0x00,
+	0x00,0x1C,0x04,0x00,0x3F,0x06,0x00,0xFF,0x07,0x80,0xFF,0x03,0x80,0xFF,0x00,0x80,0xFF,0x02,0x80,0xFF,0x06,0x80,0xFF,0x06,0xE0,0xFF,0x0E,0x70,0x7F,0x0E,0xF0,0x7F,0x6F,0xF8,0x9D,0x3F,0xF8,0xC3,0x1F,0xF8,0xEF,0x0F,0xF8,0xEF,0x0F,0xF8,0xEF,0x07,0xF8,0xDF,0x07,0xF0,0xBF,0x03,0xF0,0x27,0x00,0xC0,0x01,0x00,
 
 	/* Index 64, character 96 "`" (width: 17 pixels) */
-	0x11, 0x00,0x04,0x00,0xC0,0xEF,0x03,0x40,0x04,0x02,0x40,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x07,0x00,0x00,0x02,0x40,0x00,0x00,0xE0,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x02,0x40,0x10,0x02,0xC0,0xFB,0x01,0x00,0x10,0x00,
+	0x00,0x04,0x00,0xC0,0xEF,0x03,0x40,0x04,0x02,0x40,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x07,0x00,0x00,0x02,0x40,0x00,0x00,0xE0,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x02,0x40,0x10,0x02,0xC0,0xFB,0x01,0x00,0x10,0x00,
 
 	/* Index 65, character 97 "a" (width: 9 pixels) */
-	0x9, 0x00,0xF8,0x00,0x00,0xF0,0x01,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xF8,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x1F,0x00,
+	0x00,0xF8,0x00,0x00,0xF0,0x01,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xF8,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x1F,0x00,
 
 	/* Index 66, character 98 "b" (width: 16 pixels) */
-	0x10, 0x00,0xC0,0x01,0x00,0x20,0x02,0x00,0x10,0x04,0x00,0x50,0x04,0x00,0xB0,0x04,0x00,0xA9,0x02,0x00,0xE7,0x01,0x00,0xBC,0x00,0x00,0xC4,0x00,0x00,0xE4,0x03,0x00,0x57,0x02,0x00,0x79,0x04,0x00,0x91,0x04,0x00,0x10,0x04,0x00,0x30,0x02,0x00,0xC0,0x01,
+	0x00,0xC0,0x01,0x00,0x20,0x02,0x00,0x10,0x04,0x00,0x50,0x04,0x00,0xB0,0x04,0x00,0xA9,0x02,0x00,0xE7,0x01,0x00,0xBC,0x00,0x00,0xC4,0x00,0x00,0xE4,0x03,0x00,0x57,0x02,0x00,0x79,0x04,0x00,0x91,0x04,0x00,0x10,0x04,0x00,0x30,0x02,0x00,0xC0,0x01,
 
 	/* Index 67, character 99 "c" (width: 21 pixels) */
-	0x15, 0xFC,0xFF,0x7F,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0xFC,0xFF,0x7F,
+	0xFC,0xFF,0x7F,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0xFC,0xFF,0x7F,
 
 	/* Index 68, character 100 "d" (width: 15 pixels) */
-	0xF, 0x80,0x1F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x01,0xC0,0xFF,0x03,0xC0,0xFF,0x07,0xC0,0xFF,0x07,0xC0,0xFF,0x0F,0xE0,0xFF,0x0F,0xC0,0xFF,0x0F,0xC0,0xFF,0x07,0xC0,0xFF,0x07,0xC0,0xFF,0x03,0xE0,0xFF,0x01,0xE0,0xFF,0x00,0x80,0x1F,0x00,
+	0x80,0x1F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x01,0xC0,0xFF,0x03,0xC0,0xFF,0x07,0xC0,0xFF,0x07,0xC0,0xFF,0x0F,0xE0,0xFF,0x0F,0xC0,0xFF,0x0F,0xC0,0xFF,0x07,0xC0,0xFF,0x07,0xC0,0xFF,0x03,0xE0,0xFF,0x01,0xE0,0xFF,0x00,0x80,0x1F,0x00,
 
 	/* Index 69, character 101 "e" (width: 15 pixels) */
-	0xF, 0x80,0xFF,0x07,0x80,0xFF,0x07,0xF0,0xFF,0x07,0xE0,0xFF,0x07,0xB8,0xFF,0x07,0xC8,0xFF,0x07,0xB0,0xFF,0x07,0x90,0x00,0x00,0xC8,0xFF,0x07,0xB8,0xFF,0x07,0xE0,0xFF,0x07,0xD0,0xFF,0x07,0xC0,0xFF,0x07,0xC0,0xFF,0x07,0x80,0xFF,0x07,
+	0x80,0xFF,0x07,0x80,0xFF,0x07,0xF0,0xFF,0x07,0xE0,0xFF,0x07,0xB8,0xFF,0x07,0xC8,0xFF,0x07,0xB0,0xFF,0x07,0x90,0x00,0x00,0xC8,0xFF,0x07,0xB8,0xFF,0x07,0xE0,0xFF,0x07,0xD0,0xFF,0x07,0xC0,0xFF,0x07,0xC0,0xFF,0x07,0x80,0xFF,0x07,
 
 	/* Index 70, character 102 "f" (width: 14 pixels) */
-	0xE, 0x00,0x07,0x00,0x60,0x80,0x00,0xC8,0x7F,0x01,0x90,0xB8,0x07,0xC0,0xB8,0x06,0x88,0x78,0x03,0xE0,0x58,0x01,0xC0,0x5F,0x01,0xE0,0x78,0x03,0x88,0xB8,0x06,0xC0,0xB8,0x07,0x90,0x7F,0x01,0x68,0x80,0x00,0x40,0x07,0x00,
+	0x00,0x07,0x00,0x60,0x80,0x00,0xC8,0x7F,0x01,0x90,0xB8,0x07,0xC0,0xB8,0x06,0x88,0x78,0x03,0xE0,0x58,0x01,0xC0,0x5F,0x01,0xE0,0x78,0x03,0x88,0xB8,0x06,0xC0,0xB8,0x07,0x90,0x7F,0x01,0x68,0x80,0x00,0x40,0x07,0x00,
 
 	/* Index 71, character 103 "g" (width: 21 pixels) */
-	0x15, 0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,
+	0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,
 
 	/* Index 72, character 104 "h" (width: 17 pixels) */
-	0x11, 0x00,0xF8,0x03,0x00,0x7C,0x03,0x00,0xBB,0x07,0x00,0xB9,0x07,0x00,0x79,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xD0,0xFF,0x03,0xC0,0xF1,0x03,0xC0,0xF1,0x03,0x40,0xC0,0x03,0x40,0xC0,0x03,0x40,0x40,0x03,0xC0,0xB1,0x07,0xC0,0xB1,0x07,0xC0,0x7F,0x03,0xC0,0xFF,0x03,
+	0x00,0xF8,0x03,0x00,0x7C,0x03,0x00,0xBB,0x07,0x00,0xB9,0x07,0x00,0x79,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xD0,0xFF,0x03,0xC0,0xF1,0x03,0xC0,0xF1,0x03,0x40,0xC0,0x03,0x40,0xC0,0x03,0x40,0x40,0x03,0xC0,0xB1,0x07,0xC0,0xB1,0x07,0xC0,0x7F,0x03,0xC0,0xFF,0x03,
 
 	/* Index 73, character 105 "i" (width: 16 pixels) */
-	0x10, 0x00,0xFC,0x00,0x00,0x03,0x03,0x80,0x01,0x06,0xC0,0x00,0x0C,0x40,0x00,0x08,0x20,0x00,0x10,0x20,0x00,0x10,0xA0,0xFB,0x17,0xA0,0xFB,0x17,0xA0,0xFB,0x17,0x20,0x00,0x10,0x40,0x00,0x08,0xC0,0x00,0x0C,0x80,0x01,0x06,0x00,0x03,0x03,0x00,0xFC,0x00,
+	0x00,0xFC,0x00,0x00,0x03,0x03,0x80,0x01,0x06,0xC0,0x00,0x0C,0x40,0x00,0x08,0x20,0x00,0x10,0x20,0x00,0x10,0xA0,0xFB,0x17,0xA0,0xFB,0x17,0xA0,0xFB,0x17,0x20,0x00,0x10,0x40,0x00,0x08,0xC0,0x00,0x0C,0x80,0x01,0x06,0x00,0x03,0x03,0x00,0xFC,0x00,
 
 	/* Index 74, character 106 "j" (width: 19 pixels) */
-	0x13, 0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x28,0x00,0x00,0x38,0x00,0x00,0x34,0x00,0x00,0x3C,0x00,0x00,0x34,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x2E,0x00,0x00,0x27,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x20,0x00,0x00,0x20,0x00,
+	0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x28,0x00,0x00,0x38,0x00,0x00,0x34,0x00,0x00,0x3C,0x00,0x00,0x34,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x2E,0x00,0x00,0x27,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x20,0x00,0x00,0x20,0x00,
 
 	/* Index 75, character 107 "k" (width: 17 pixels) */
-	0x11, 0x00,0x20,0x00,0x00,0x20,0x02,0x00,0x10,0x03,0x00,0x08,0x03,0x00,0x88,0x03,0x00,0x90,0x01,0x80,0xD9,0x00,0x00,0xFA,0x01,0x00,0xFC,0x01,0x80,0xFE,0x06,0xC0,0xF6,0x07,0x40,0xE8,0x07,0x20,0x8C,0x03,0x00,0x0C,0x00,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x02,0x00,
+	0x00,0x20,0x00,0x00,0x20,0x02,0x00,0x10,0x03,0x00,0x08,0x03,0x00,0x88,0x03,0x00,0x90,0x01,0x80,0xD9,0x00,0x00,0xFA,0x01,0x00,0xFC,0x01,0x80,0xFE,0x06,0xC0,0xF6,0x07,0x40,0xE8,0x07,0x20,0x8C,0x03,0x00,0x0C,0x00,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x02,0x00,
 
 	/* Index 76, character 108 "l" (width: 16 pixels) */
-	0x10, 0x00,0x10,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x34,0x00,0x00,0x34,0x00,0x00,0xFF,0x01,0xF0,0x3F,0x0E,0xE0,0xF8,0x07,0x00,0xFF,0x00,0x00,0x2C,0x00,0x00,0x2C,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x10,0x00,
+	0x00,0x10,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x34,0x00,0x00,0x34,0x00,0x00,0xFF,0x01,0xF0,0x3F,0x0E,0xE0,0xF8,0x07,0x00,0xFF,0x00,0x00,0x2C,0x00,0x00,0x2C,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x10,0x00,
 
 	/* Index 77, character 109 "m" (width: 6 pixels) */
-	0x6, 0xC0,0x0F,0x60,0xD4,0xFF,0x61,0x96,0xFF,0x6D,0x16,0xFF,0x6D,0xD4,0xFF,0x61,0xC0,0x03,0x60,
+	0xC0,0x0F,0x60,0xD4,0xFF,0x61,0x96,0xFF,0x6D,0x16,0xFF,0x6D,0xD4,0xFF,0x61,0xC0,0x03,0x60,
 
 	/* Index 78, character 110 "n" (width: 21 pixels) */
-	0x15, 0x00,0xFE,0x00,0x80,0xFF,0x03,0xC0,0xFF,0x07,0xE0,0xFF,0x0F,0xF0,0xFF,0x1F,0xF8,0xFF,0x3F,0xF8,0xFF,0x3F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xF8,0xFF,0x3F,0xF8,0xFF,0x3F,0xF0,0xFF,0x1F,0xE0,0xFF,0x0F,0xC0,0xFF,0x07,0x80,0xFF,0x03,0x00,0xFE,0x00,
+	0x00,0xFE,0x00,0x80,0xFF,0x03,0xC0,0xFF,0x07,0xE0,0xFF,0x0F,0xF0,0xFF,0x1F,0xF8,0xFF,0x3F,0xF8,0xFF,0x3F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xF8,0xFF,0x3F,0xF8,0xFF,0x3F,0xF0,0xFF,0x1F,0xE0,0xFF,0x0F,0xC0,0xFF,0x07,0x80,0xFF,0x03,0x00,0xFE,0x00,
 
 	/* Index 79, character 111 "o" (width: 17 pixels) */
-	0x11, 0x00,0x00,0x04,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x07,0x00,0xC0,0x07,0x00,0xC0,0x07,0x00,0x50,0x07,0x00,0x60,0x07,0x00,0x40,0x07,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x02,
+	0x00,0x00,0x04,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x07,0x00,0xC0,0x07,0x00,0xC0,0x07,0x00,0x50,0x07,0x00,0x60,0x07,0x00,0x40,0x07,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x02,
 
 	/* Index 80, character 112 "p" (width: 18 pixels) */
-	0x12, 0x22,0x00,0x00,0x24,0x88,0x00,0x00,0x7C,0x01,0x23,0xB2,0x07,0x54,0xB1,0x07,0x50,0x71,0x02,0x50,0x71,0x01,0x73,0x71,0x01,0x70,0x71,0x01,0x70,0x71,0x01,0x73,0x71,0x01,0x50,0x71,0x03,0x50,0x71,0x02,0x72,0xB1,0x07,0x01,0xB6,0x07,0x04,0xF8,0x01,0x24,0x08,0x00,0x22,0x00,0x00,
+	0x22,0x00,0x00,0x24,0x88,0x00,0x00,0x7C,0x01,0x23,0xB2,0x07,0x54,0xB1,0x07,0x50,0x71,0x02,0x50,0x71,0x01,0x73,0x71,0x01,0x70,0x71,0x01,0x70,0x71,0x01,0x73,0x71,0x01,0x50,0x71,0x03,0x50,0x71,0x02,0x72,0xB1,0x07,0x01,0xB6,0x07,0x04,0xF8,0x01,0x24,0x08,0x00,0x22,0x00,0x00,
 
 	/* Index 81, character 113 "q" (width: 13 pixels) */
-	0xD, 0x00,0x7C,0x00,0x00,0xFF,0x01,0xC0,0xC1,0x03,0xE0,0x80,0x07,0xE0,0x01,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x80,0x07,0xE0,0x01,0x07,0xC0,0x83,0x03,0x80,0xFF,0x00,0x00,0x3E,0x00,
+	0x00,0x7C,0x00,0x00,0xFF,0x01,0xC0,0xC1,0x03,0xE0,0x80,0x07,0xE0,0x01,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x80,0x07,0xE0,0x01,0x07,0xC0,0x83,0x03,0x80,0xFF,0x00,0x00,0x3E,0x00,
 
 	/* Index 82, character 114 "r" (width: 13 pixels) */
-	0xD, 0xC0,0x01,0x0E,0xC0,0x03,0x0F,0x80,0x87,0x07,0x00,0xCF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xCF,0x03,0x80,0x87,0x07,0xC0,0x03,0x0F,0xC0,0x01,0x0E,
+	0xC0,0x01,0x0E,0xC0,0x03,0x0F,0x80,0x87,0x07,0x00,0xCF,0x03,0x00,0xFE,0x01,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xCF,0x03,0x80,0x87,0x07,0xC0,0x03,0x0F,0xC0,0x01,0x0E,
 
 	/* Index 83, character 115 "s" (width: 12 pixels) */
-	0xC, 0xC0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xF0,0x01,0x00,0x70,0xF0,0x18,0x30,0xF8,0x3C,0x30,0xFC,0x3C,0x70,0xFE,0x18,0xF0,0x0F,0x00,0xE0,0x0F,0x00,0xE0,0x07,0x00,0xC0,0x03,0x00,
+	0xC0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xF0,0x01,0x00,0x70,0xF0,0x18,0x30,0xF8,0x3C,0x30,0xFC,0x3C,0x70,0xFE,0x18,0xF0,0x0F,0x00,0xE0,0x0F,0x00,0xE0,0x07,0x00,0xC0,0x03,0x00,
 
 	/* Index 84, character 116 "t" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xE0,0x5B,0x00,0xE0,0x7F,0x00,0xFE,0x6F,0x80,0xDD,0x7C,0x80,0x80,0x74,0xC0,0x7F,0x7F,0xC0,0x7F,0x7D,0xC0,0x80,0x7C,0xC0,0x80,0x7C,0xC0,0xFF,0x7F,0x80,0xFB,0x7D,0x80,0x5B,0x7E,0x80,0x5F,0x7F,0x00,0xDD,0x7F,0x00,0xDE,0x7F,0x00,0xDC,0x7F,0x00,0xF8,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0x00,0xE0,0x5B,0x00,0xE0,0x7F,0x00,0xFE,0x6F,0x80,0xDD,0x7C,0x80,0x80,0x74,0xC0,0x7F,0x7F,0xC0,0x7F,0x7D,0xC0,0x80,0x7C,0xC0,0x80,0x7C,0xC0,0xFF,0x7F,0x80,0xFB,0x7D,0x80,0x5B,0x7E,0x80,0x5F,0x7F,0x00,0xDD,0x7F,0x00,0xDE,0x7F,0x00,0xDC,0x7F,0x00,0xF8,0x7F,0x00,0xF0,0x7F,0x00,0xF0,0x7F,0x00,0xE0,0x7F,
 
 	/* Index 85, character 117 "u" (width: 21 pixels) */
-	0x15, 0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xFC,0x7F,0x00,0x03,0x7F,0x80,0x81,0x7E,0xC0,0x80,0x7D,0x40,0x80,0x7B,0x20,0xBF,0x77,0xA0,0xE9,0x77,0xA0,0xB9,0x77,0xA0,0xBF,0x77,0xA0,0xB9,0x77,0xA0,0xE9,0x77,0x40,0xBF,0x7B,0xC0,0x80,0x7D,0x80,0x81,0x7E,0x00,0x03,0x7F,0x00,0xFC,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
+	0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xFC,0x7F,0x00,0x03,0x7F,0x80,0x81,0x7E,0xC0,0x80,0x7D,0x40,0x80,0x7B,0x20,0xBF,0x77,0xA0,0xE9,0x77,0xA0,0xB9,0x77,0xA0,0xBF,0x77,0xA0,0xB9,0x77,0xA0,0xE9,0x77,0x40,0xBF,0x7B,0xC0,0x80,0x7D,0x80,0x81,0x7E,0x00,0x03,0x7F,0x00,0xFC,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,
 
 	/* Index 86, character 118 "v" (width: 13 pixels) */
-	0xD, 0x80,0xFF,0x01,0x80,0x30,0x07,0xC0,0xB0,0x07,0xC0,0x50,0x01,0xC0,0x50,0x01,0xC0,0x50,0x01,0xC0,0x5F,0x01,0xC0,0x50,0x01,0xC0,0x50,0x01,0xC0,0xD0,0x01,0xC0,0x30,0x07,0x80,0x30,0x07,0x80,0xFF,0x01,
+	0x80,0xFF,0x01,0x80,0x30,0x07,0xC0,0xB0,0x07,0xC0,0x50,0x01,0xC0,0x50,0x01,0xC0,0x50,0x01,0xC0,0x5F,0x01,0xC0,0x50,0x01,0xC0,0x50,0x01,0xC0,0xD0,0x01,0xC0,0x30,0x07,0x80,0x30,0x07,0x80,0xFF,0x01,
 
 	/* Index 87, character 119 "w" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x0C,0xF0,0x03,0x0C,0x40,0xFC,0x08,0x40,0x02,0x0B,0x40,0x01,0x0C,0xC0,0x00,0x0C,0x40,0x00,0x00,
+	0x00,0x00,0x0C,0xF0,0x03,0x0C,0x40,0xFC,0x08,0x40,0x02,0x0B,0x40,0x01,0x0C,0xC0,0x00,0x0C,0x40,0x00,0x00,
 
 	/* Index 88, character 120 "x" (width: 16 pixels) */
-	0x10, 0x00,0x7E,0x00,0x80,0xC3,0x01,0xC0,0x00,0x03,0xE0,0x00,0x06,0x20,0x01,0x04,0x10,0x02,0x0C,0x10,0x04,0x08,0x10,0x08,0x08,0x10,0x10,0x08,0x10,0x20,0x08,0x10,0x40,0x08,0x20,0x80,0x04,0x60,0x00,0x05,0xC0,0x00,0x03,0x80,0x81,0x01,0x00,0x7E,0x00,
+	0x00,0x7E,0x00,0x80,0xC3,0x01,0xC0,0x00,0x03,0xE0,0x00,0x06,0x20,0x01,0x04,0x10,0x02,0x0C,0x10,0x04,0x08,0x10,0x08,0x08,0x10,0x10,0x08,0x10,0x20,0x08,0x10,0x40,0x08,0x20,0x80,0x04,0x60,0x00,0x05,0xC0,0x00,0x03,0x80,0x81,0x01,0x00,0x7E,0x00,
 
 	/* Index 89, character 121 "y" (width: 16 pixels) */
-	0x10, 0x00,0x7E,0x00,0x80,0x93,0x01,0xC0,0x10,0x03,0x60,0x10,0x06,0x20,0x10,0x04,0x10,0x10,0x08,0x10,0x10,0x08,0x10,0x10,0x08,0x10,0x10,0x08,0x10,0x10,0x08,0x10,0x10,0x08,0x20,0x10,0x04,0x60,0x10,0x06,0xC0,0x10,0x03,0x80,0x93,0x01,0x00,0x7E,0x00,
+	0x00,0x7E,0x00,0x80,0x93,0x01,0xC0,0x10,0x03,0x60,0x10,0x06,0x20,0x10,0x04,0x10,0x10,0x08,0x10,0x10,0x08,0x10,0x10,0x08,0x10,0x10,0x08,0x10,0x10,0x08,0x10,0x10,0x08,0x20,0x10,0x04,0x60,0x10,0x06,0xC0,0x10,0x03,0x80,0x93,0x01,0x00,0x7E,0x00,
 
 	/* Index 90, character 122 "z" (width: 16 pixels) */
-	0x10, 0x00,0x7E,0x00,0x80,0xC1,0x01,0x40,0x3C,0x03,0x60,0x32,0x06,0xA0,0x32,0x04,0x30,0x33,0x0C,0x10,0x32,0x08,0x10,0x36,0x08,0x10,0x3A,0x08,0x90,0x32,0x08,0x90,0x71,0x08,0x20,0xB0,0x04,0x20,0x30,0x07,0x40,0x30,0x03,0x80,0xC1,0x01,0x00,0x7E,0x00,
+	0x00,0x7E,0x00,0x80,0xC1,0x01,0x40,0x3C,0x03,0x60,0x32,0x06,0xA0,0x32,0x04,0x30,0x33,0x0C,0x10,0x32,0x08,0x10,0x36,0x08,0x10,0x3A,0x08,0x90,0x32,0x08,0x90,0x71,0x08,0x20,0xB0,0x04,0x20,0x30,0x07,0x40,0x30,0x03,0x80,0xC1,0x01,0x00,0x7E,0x00,
 
 	/* Index 91, character 123 "{" (width: 21 pixels) */
-	0x15, 0x00,0x08,0x00,0x80,0x78,0x00,0x80,0x7F,0x01,0x80,0xFF,0x01,0xF0,0xFF,0x01,0xE0,0xFF,0x01,0xE0,0xFF,0x03,0xC0,0xFF,0x03,0xE0,0xFF,0x01,0xE0,0xFF,0x07,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x07,0x00,0xFF,0x06,0x00,0xFD,0x04,0x00,0x08,0x08,
+	0x00,0x08,0x00,0x80,0x78,0x00,0x80,0x7F,0x01,0x80,0xFF,0x01,0xF0,0xFF,0x01,0xE0,0xFF,0x01,0xE0,0xFF,0x03,0xC0,0xFF,0x03,0xE0,0xFF,0x01,0xE0,0xFF,0x07,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x07,0x00,0xFF,0x06,0x00,0xFD,0x04,0x00,0x08,0x08,
 
 	/* Index 92, character 124 "|" (width: 1 pixels) */
-	0x1, 0xFC,0xFF,0x7F,
+	0xFC,0xFF,0x7F,
 
 	/* Index 93, character 125 "}" (width: 21 pixels) */
-	0x15, 0x00,0x08,0x08,0x00,0xFD,0x04,0x00,0xFF,0x06,0xC0,0xFF,0x07,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xF0,0xFF,0x07,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xF0,0xFF,0x07,0xE0,0xFF,0x01,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xE0,0xFF,0x01,0xF0,0xFF,0x01,0x80,0xFF,0x01,0x80,0x7F,0x01,0x80,0x78,0x00,0x00,0x08,0x00,
+	0x00,0x08,0x08,0x00,0xFD,0x04,0x00,0xFF,0x06,0xC0,0xFF,0x07,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xF0,0xFF,0x07,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xF0,0xFF,0x07,0xE0,0xFF,0x01,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xE0,0xFF,0x01,0xF0,0xFF,0x01,0x80,0xFF,0x01,0x80,0x7F,0x01,0x80,0x78,0x00,0x00,0x08,0x00,
 
 	/* Index 94, character 126 "~" (width: 17 pixels) */
-	0x11, 0x00,0x00,0x10,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x80,0x03,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x7C,0x00,0x00,0x3F,0x00,0x00,0xFE,0x00,0x00,0xF8,0x03,0x00,0xF8,0x00,0x00,0x3C,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x80,0x01,0x00,0x60,0x00,0x00,0x20,0x00,0x00,
+	0x00,0x00,0x10,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x80,0x03,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x7C,0x00,0x00,0x3F,0x00,0x00,0xFE,0x00,0x00,0xF8,0x03,0x00,0xF8,0x00,0x00,0x3C,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x80,0x01,0x00,0x60,0x00,0x00,0x20,0x00,0x00,
 
 	/* Index 95, character 127 "." (width: 9 pixels) */
-	0x9, 0xC0,0xFF,0x07,0xC0,0xFF,0x07,0xC0,0x00,0x06,0xC0,0x00,0x06,0xC0,0x00,0x06,0xC0,0x00,0x06,0xC0,0x00,0x06,0xC0,0xFF,0x07,0xC0,0xFF,0x07
+	0xC0,0xFF,0x07,0xC0,0xFF,0x07,0xC0,0x00,0x06,0xC0,0x00,0x06,0xC0,0x00,0x06,0xC0,0x00,0x06,0xC0,0x00,0x06,0xC0,0xFF,0x07,0xC0,0xFF,0x07
 };
+
+// Offset of each bitmap in Webdings16_bitmaps
+const unsigned short Webdings16_offsets[] = 
+{
+	0x0,	// Index 0
+	0x6,	// Index 1
+	0x2D,	// Index 2
+	0x6C,	// Index 3
+	0x9C,	// Index 4
+	0xC3,	// Index 5
+	0xF9,	// Index 6
+	0x114,	// Index 7
+	0x12F,	// Index 8
+	0x168,	// Index 9
+	0x1A1,	// Index 10
+	0x1DA,	// Index 11
+	0x216,	// Index 12
+	0x249,	// Index 13
+	0x26A,	// Index 14
+	0x2A9,	// Index 15
+	0x2E8,	// Index 16
+	0x309,	// Index 17
+	0x336,	// Index 18
+	0x363,	// Index 19
+	0x378,	// Index 20
+	0x38D,	// Index 21
+	0x3B7,	// Index 22
+	0x3E1,	// Index 23
+	0x40E,	// Index 24
+	0x43B,	// Index 25
+	0x46E,	// Index 26
+	0x4A1,	// Index 27
+	0x4BC,	// Index 28
+	0x4E0,	// Index 29
+	0x504,	// Index 30
+	0x534,	// Index 31
+	0x567,	// Index 32
+	0x59A,	// Index 33
+	0x5D9,	// Index 34
+	0x618,	// Index 35
+	0x657,	// Index 36
+	0x696,	// Index 37
+	0x6D5,	// Index 38
+	0x714,	// Index 39
+	0x753,	// Index 40
+	0x792,	// Index 41
+	0x7D1,	// Index 42
+	0x810,	// Index 43
+	0x84F,	// Index 44
+	0x86A,	// Index 45
+	0x8A9,	// Index 46
+	0x8DC,	// Index 47
+	0x900,	// Index 48
+	0x93F,	// Index 49
+	0x97E,	// Index 50
+	0x9BD,	// Index 51
+	0x9FC,	// Index 52
+	0xA3B,	// Index 53
+	0xA77,	// Index 54
+	0xAA4,	// Index 55
+	0xABC,	// Index 56
+	0xAD4,	// Index 57
+	0xB04,	// Index 58
+	0xB2E,	// Index 59
+	0xB67,	// Index 60
+	0xBA6,	// Index 61
+	0xBDF,	// Index 62
+	0xC1B,	// Index 63
+	0xC57,	// Index 64
+	0xC8A,	// Index 65
+	0xCA5,	// Index 66
+	0xCD5,	// Index 67
+	0xD14,	// Index 68
+	0xD41,	// Index 69
+	0xD6E,	// Index 70
+	0xD98,	// Index 71
+	0xDD7,	// Index 72
+	0xE0A,	// Index 73
+	0xE3A,	// Index 74
+	0xE73,	// Index 75
+	0xEA6,	// Index 76
+	0xED6,	// Index 77
+	0xEE8,	// Index 78
+	0xF27,	// Index 79
+	0xF5A,	// Index 80
+	0xF90,	// Index 81
+	0xFB7,	// Index 82
+	0xFDE,	// Index 83
+	0x1002,	// Index 84
+	0x1041,	// Index 85
+	0x1080,	// Index 86
+	0x10A7,	// Index 87
+	0x10BC,	// Index 88
+	0x10EC,	// Index 89
+	0x111C,	// Index 90
+	0x114C,	// Index 91
+	0x118B,	// Index 92
+	0x118E,	// Index 93
+	0x11CD,	// Index 94
+	0x1200,	// Index 95
+};
+
+// Width of each bitmap in pixels
+const unsigned char Webdings16_widths[] = 
+{
+	0x2,	// Index 0
+	0xD,	// Index 1
+	0x15,	// Index 2
+	0x10,	// Index 3
+	0xD,	// Index 4
+	0x12,	// Index 5
+	0x9,	// Index 6
+	0x9,	// Index 7
+	0x13,	// Index 8
+	0x13,	// Index 9
+	0x13,	// Index 10
+	0x14,	// Index 11
+	0x11,	// Index 12
+	0xB,	// Index 13
+	0x15,	// Index 14
+	0x15,	// Index 15
+	0xB,	// Index 16
+	0xF,	// Index 17
+	0xF,	// Index 18
+	0x7,	// Index 19
+	0x7,	// Index 20
+	0xE,	// Index 21
+	0xE,	// Index 22
+	0xF,	// Index 23
+	0xF,	// Index 24
+	0x11,	// Index 25
+	0x11,	// Index 26
+	0x9,	// Index 27
+	0xC,	// Index 28
+	0xC,	// Index 29
+	0x10,	// Index 30
+	0x11,	// Index 31
+	0x11,	// Index 32
+	0x15,	// Index 33
+	0x15,	// Index 34
+	0x15,	// Index 35
+	0x15,	// Index 36
+	0x15,	// Index 37
+	0x15,	// Index 38
+	0x15,	// Index 39
+	0x15,	// Index 40
+	0x15,	// Index 41
+	0x15,	// Index 42
+	0x15,	// Index 43
+	0x9,	// Index 44
+	0x15,	// Index 45
+	0x11,	// Index 46
+	0xC,	// Index 47
+	0x15,	// Index 48
+	0x15,	// Index 49
+	0x15,	// Index 50
+	0x15,	// Index 51
+	0x15,	// Index 52
+	0x14,	// Index 53
+	0xF,	// Index 54
+	0x8,	// Index 55
+	0x8,	// Index 56
+	0x10,	// Index 57
+	0xE,	// Index 58
+	0x13,	// Index 59
+	0x15,	// Index 60
+	0x13,	// Index 61
+	0x14,	// Index 62
+	0x14,	// Index 63
+	0x11,	// Index 64
+	0x9,	// Index 65
+	0x10,	// Index 66
+	0x15,	// Index 67
+	0xF,	// Index 68
+	0xF,	// Index 69
+	0xE,	// Index 70
+	0x15,	// Index 71
+	0x11,	// Index 72
+	0x10,	// Index 73
+	0x13,	// Index 74
+	0x11,	// Index 75
+	0x10,	// Index 76
+	0x6,	// Index 77
+	0x15,	// Index 78
+	0x11,	// Index 79
+	0x12,	// Index 80
+	0xD,	// Index 81
+	0xD,	// Index 82
+	0xC,	// Index 83
+	0x15,	// Index 84
+	0x15,	// Index 85
+	0xD,	// Index 86
+	0x7,	// Index 87
+	0x10,	// Index 88
+	0x10,	// Index 89
+	0x10,	// Index 90
+	0x15,	// Index 91
+	0x1,	// Index 92
+	0x15,	// Index 93
+	0x11,	// Index 94
+	0x9,	// Index 95
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Webdings16_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x13, 0x0,	// Index 1
+	0x14, 0x0,	// Index 2
+	0x12, 0x0,	// Index 3
+	0xE, 0x0,	// Index 4
+	0x13, 0x0,	// Index 5
+	0x14, 0x0,	// Index 6
+	0x13, 0x0,	// Index 7
+	0x10, 0x0,	// Index 8
+	0x10, 0x0,	// Index 9
+	0x12, 0x0,	// Index 10
+	0x14, 0x0,	// Index 11
+	0xE, 0x0,	// Index 12
+	0x13, 0x0,	// Index 13
+	0x15, 0x0,	// Index 14
+	0x15, 0x0,	// Index 15
+	0x5, 0x0,	// Index 16
+	0x10, 0x0,	// Index 17
+	0x10, 0x0,	// Index 18
+	0x12, 0x0,	// Index 19
+	0x12, 0x0,	// Index 20
+	0xE, 0x0,	// Index 21
+	0xD, 0x0,	// Index 22
+	0x11, 0x0,	// Index 23
+	0x11, 0x0,	// Index 24
+	0x11, 0x0,	// Index 25
+	0x11, 0x0,	// Index 26
+	0x10, 0x0,	// Index 27
+	0x10, 0x0,	// Index 28
+	0x10, 0x0,	// Index 29
+	0xF, 0x0,	// Index 30
+	0x14, 0x0,	// Index 31
+	0x13, 0x0,	// Index 32
+	0x15, 0x0,	// Index 33
+	0x13, 0x0,	// Index 34
+	0x13, 0x0,	// Index 35
+	0x13, 0x0,	// Index 36
+	0x14, 0x0,	// Index 37
+	0x14, 0x0,	// Index 38
+	0x14, 0x0,	// Index 39
+	0x13, 0x0,	// Index 40
+	0x12, 0x0,	// Index 41
+	0x14, 0x0,	// Index 42
+	0x11, 0x0,	// Index 43
+	0x13, 0x0,	// Index 44
+	0x11, 0x0,	// Index 45
+	0x11, 0x0,	// Index 46
+	0x13, 0x0,	// Index 47
+	0x14, 0x0,	// Index 48
+	0x14, 0x0,	// Index 49
+	0xC, 0x0,	// Index 50
+	0x15, 0x0,	// Index 51
+	0x15, 0x0,	// Index 52
+	0x13, 0x0,	// Index 53
+	0x12, 0x0,	// Index 54
+	0x12, 0x0,	// Index 55
+	0x12, 0x0,	// Index 56
+	0x11, 0x0,	// Index 57
+	0x15, 0x0,	// Index 58
+	0x11, 0x0,	// Index 59
+	0x15, 0x0,	// Index 60
+	0x11, 0x0,	// Index 61
+	0x13, 0x0,	// Index 62
+	0x14, 0x0,	// Index 63
+	0x12, 0x0,	// Index 64
+	0xF, 0x0,	// Index 65
+	0xF, 0x0,	// Index 66
+	0x15, 0x0,	// Index 67
+	0x12, 0x0,	// Index 68
+	0x14, 0x0,	// Index 69
+	0x14, 0x0,	// Index 70
+	0x15, 0x0,	// Index 71
+	0x13, 0x0,	// Index 72
+	0x12, 0x0,	// Index 73
+	0xF, 0x0,	// Index 74
+	0x12, 0x0,	// Index 75
+	0x13, 0x0,	// Index 76
+	0x16, 0x0,	// Index 77
+	0x15, 0x0,	// Index 78
+	0xB, 0x0,	// Index 79
+	0x17, 0x0,	// Index 80
+	0x12, 0x0,	// Index 81
+	0x11, 0x0,	// Index 82
+	0x13, 0x0,	// Index 83
+	0x11, 0x0,	// Index 84
+	0x12, 0x0,	// Index 85
+	0x11, 0x0,	// Index 86
+	0x13, 0x0,	// Index 87
+	0x13, 0x0,	// Index 88
+	0x13, 0x0,	// Index 89
+	0x13, 0x0,	// Index 90
+	0x13, 0x0,	// Index 91
+	0x15, 0x0,	// Index 92
+	0x13, 0x0,	// Index 93
+	0x12, 0x0,	// Index 94
+	0x11, 0x0,	// Index 95
+};
+
+const font_t Webdings16 = 
+{
+	Webdings16_bitmaps,
+	Webdings16_offsets,
+	Webdings16_widths,
+	0x20,	// Start character 
+	0x60,	// Number of bitmaps 
+	0x17,	// Height 
+	0,	// Flags 
+	Webdings16_extents,
+	0x17	// Ascent 
+};
+
 //---------------------------------------------------------------
 // Group Name: Webdings18
 // Designer: Imported System Font
@@ -838,399 +1262,609 @@ const unsigned char Webdings16[] =
 // Start Character: 32 " "
 // Stop Character: 127 "."
 //---------------------------------------------------------------
-const unsigned char Webdings18[] = 
+const unsigned char Webdings18_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x60,	// Number of Bitmaps 
-	0x19,	// Height 
-
-	// Bitmap Index (number of index entries 96)
- 	0x0, 0xC5, // Index 0 (offset: 197)
-	0x0, 0xD2, // Index 1 (offset: 210)
-	0x1, 0xF, // Index 2 (offset: 271)
-	0x1, 0x74, // Index 3 (offset: 372)
-	0x1, 0xC5, // Index 4 (offset: 453)
-	0x2, 0x2, // Index 5 (offset: 514)
-	0x2, 0x53, // Index 6 (offset: 595)
-	0x2, 0x7C, // Index 7 (offset: 636)
-	0x2, 0xA5, // Index 8 (offset: 677)
-	0x2, 0xFA, // Index 9 (offset: 762)
-	0x3, 0x4F, // Index 10 (offset: 847)
-	0x3, 0xA8, // Index 11 (offset: 936)
-	0x4, 0x1, // Index 12 (offset: 1025)
-	0x4, 0x52, // Index 13 (offset: 1106)
-	0x4, 0x83, // Index 14 (offset: 1155)
-	0x4, 0xE4, // Index 15 (offset: 1252)
-	0x5, 0x45, // Index 16 (offset: 1349)
-	0x5, 0x76, // Index 17 (offset: 1398)
-	0x5, 0xBF, // Index 18 (offset: 1471)
-	0x6, 0x8, // Index 19 (offset: 1544)
-	0x6, 0x29, // Index 20 (offset: 1577)
-	0x6, 0x4A, // Index 21 (offset: 1610)
-	0x6, 0x8B, // Index 22 (offset: 1675)
-	0x6, 0xCC, // Index 23 (offset: 1740)
-	0x7, 0x11, // Index 24 (offset: 1809)
-	0x7, 0x56, // Index 25 (offset: 1878)
-	0x7, 0x9F, // Index 26 (offset: 1951)
-	0x7, 0xE8, // Index 27 (offset: 2024)
-	0x8, 0xD, // Index 28 (offset: 2061)
-	0x8, 0x46, // Index 29 (offset: 2118)
-	0x8, 0x7F, // Index 30 (offset: 2175)
-	0x8, 0xCC, // Index 31 (offset: 2252)
-	0x9, 0x19, // Index 32 (offset: 2329)
-	0x9, 0x6A, // Index 33 (offset: 2410)
-	0x9, 0xCB, // Index 34 (offset: 2507)
-	0xA, 0x2C, // Index 35 (offset: 2604)
-	0xA, 0x8D, // Index 36 (offset: 2701)
-	0xA, 0xEE, // Index 37 (offset: 2798)
-	0xB, 0x4F, // Index 38 (offset: 2895)
-	0xB, 0xB0, // Index 39 (offset: 2992)
-	0xC, 0x11, // Index 40 (offset: 3089)
-	0xC, 0x72, // Index 41 (offset: 3186)
-	0xC, 0xD3, // Index 42 (offset: 3283)
-	0xD, 0x34, // Index 43 (offset: 3380)
-	0xD, 0x95, // Index 44 (offset: 3477)
-	0xD, 0xBE, // Index 45 (offset: 3518)
-	0xE, 0x1F, // Index 46 (offset: 3615)
-	0xE, 0x70, // Index 47 (offset: 3696)
-	0xE, 0xA5, // Index 48 (offset: 3749)
-	0xF, 0x6, // Index 49 (offset: 3846)
-	0xF, 0x67, // Index 50 (offset: 3943)
-	0xF, 0xC8, // Index 51 (offset: 4040)
-	0x10, 0x29, // Index 52 (offset: 4137)
-	0x10, 0x8A, // Index 53 (offset: 4234)
-	0x10, 0xE7, // Index 54 (offset: 4327)
-	0x11, 0x2C, // Index 55 (offset: 4396)
-	0x11, 0x51, // Index 56 (offset: 4433)
-	0x11, 0x76, // Index 57 (offset: 4470)
-	0x11, 0xBF, // Index 58 (offset: 4543)
-	0x11, 0xFC, // Index 59 (offset: 4604)
-	0x12, 0x55, // Index 60 (offset: 4693)
-	0x12, 0xB6, // Index 61 (offset: 4790)
-	0x13, 0xF, // Index 62 (offset: 4879)
-	0x13, 0x6C, // Index 63 (offset: 4972)
-	0x13, 0xC9, // Index 64 (offset: 5065)
-	0x14, 0x1A, // Index 65 (offset: 5146)
-	0x14, 0x47, // Index 66 (offset: 5191)
-	0x14, 0x90, // Index 67 (offset: 5264)
-	0x14, 0xF1, // Index 68 (offset: 5361)
-	0x15, 0x32, // Index 69 (offset: 5426)
-	0x15, 0x77, // Index 70 (offset: 5495)
-	0x15, 0xBC, // Index 71 (offset: 5564)
-	0x16, 0x1D, // Index 72 (offset: 5661)
-	0x16, 0x6E, // Index 73 (offset: 5742)
-	0x16, 0xBF, // Index 74 (offset: 5823)
-	0x17, 0x10, // Index 75 (offset: 5904)
-	0x17, 0x61, // Index 76 (offset: 5985)
-	0x17, 0xAA, // Index 77 (offset: 6058)
-	0x17, 0xC3, // Index 78 (offset: 6083)
-	0x18, 0x24, // Index 79 (offset: 6180)
-	0x18, 0x75, // Index 80 (offset: 6261)
-	0x18, 0xC2, // Index 81 (offset: 6338)
-	0x18, 0xFF, // Index 82 (offset: 6399)
-	0x19, 0x40, // Index 83 (offset: 6464)
-	0x19, 0x79, // Index 84 (offset: 6521)
-	0x19, 0xDA, // Index 85 (offset: 6618)
-	0x1A, 0x3B, // Index 86 (offset: 6715)
-	0x1A, 0x74, // Index 87 (offset: 6772)
-	0x1A, 0x91, // Index 88 (offset: 6801)
-	0x1A, 0xE2, // Index 89 (offset: 6882)
-	0x1B, 0x33, // Index 90 (offset: 6963)
-	0x1B, 0x84, // Index 91 (offset: 7044)
-	0x1B, 0xE5, // Index 92 (offset: 7141)
-	0x1B, 0xEE, // Index 93 (offset: 7150)
-	0x1C, 0x4F, // Index 94 (offset: 7247)
-	0x1C, 0xA0, // Index 95 (offset: 7328)
-
 	/* Index 0, character 32 " " (width: 3 pixels) */
-	0x3, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 15 pixels) */
-	0xF, 0x00,0x80,0x03,0x00,0xF0,0x5F,0x3C,0x00,0x00,0x50,0x40,0x00,0x00,0xD0,0x07,0x00,0xF0,0x3F,0x18,0x00,0x08,0xF8,0x07,0x00,0x00,0xFF,0x0F,0x00,0x80,0xFF,0x1F,0x00,0x00,0xFF,0x0F,0x00,0x38,0xF8,0x07,0x00,0xC0,0x3F,0x1C,0x00,0x00,0xD0,0x03,0x00,0x70,0x50,0x20,0x00,0x80,0x5F,0x1C,0x00,0x00,0x80,0x03,0x00,
+	0x00,0x80,0x03,0x00,0xF0,0x5F,0x3C,0x00,0x00,0x50,0x40,0x00,0x00,0xD0,0x07,0x00,0xF0,0x3F,0x18,0x00,0x08,0xF8,0x07,0x00,0x00,0xFF,0x0F,0x00,0x80,0xFF,0x1F,0x00,0x00,0xFF,0x0F,0x00,0x38,0xF8,0x07,0x00,0xC0,0x3F,0x1C,0x00,0x00,0xD0,0x03,0x00,0x70,0x50,0x20,0x00,0x80,0x5F,0x1C,0x00,0x00,0x80,0x03,0x00,
 
 	/* Index 2, character 34 """ (width: 25 pixels) */
-	0x19, 0x00,0x02,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0xC6,0x01,0x00,0x00,0x0E,0x0E,0x01,0x00,0x35,0xF0,0x00,0x80,0xCC,0xA3,0x00,0x40,0x1A,0x5C,0x00,0x40,0xEA,0x4C,0x00,0x20,0x09,0x4B,0x00,0xD0,0x94,0x4B,0x00,0x28,0xD3,0x49,0x00,0xFE,0x7F,0x49,0x00,0x90,0xD8,0x49,0x00,0x20,0xD9,0x4B,0x00,0x40,0x2A,0x4B,0x00,0x40,0x1C,0x4E,0x00,0x80,0xCC,0x99,0x00,0x00,0x3D,0xB8,0x00,0x00,0x06,0xC7,0x00,0x00,0xE6,0x80,0x01,0x00,0x1C,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,
+	0x00,0x02,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0xC6,0x01,0x00,0x00,0x0E,0x0E,0x01,0x00,0x35,0xF0,0x00,0x80,0xCC,0xA3,0x00,0x40,0x1A,0x5C,0x00,0x40,0xEA,0x4C,0x00,0x20,0x09,0x4B,0x00,0xD0,0x94,0x4B,0x00,0x28,0xD3,0x49,0x00,0xFE,0x7F,0x49,0x00,0x90,0xD8,0x49,0x00,0x20,0xD9,0x4B,0x00,0x40,0x2A,0x4B,0x00,0x40,0x1C,0x4E,0x00,0x80,0xCC,0x99,0x00,0x00,0x3D,0xB8,0x00,0x00,0x06,0xC7,0x00,0x00,0xE6,0x80,0x01,0x00,0x1C,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 20 pixels) */
-	0x14, 0x00,0x7E,0x00,0x00,0x80,0xFF,0x01,0x00,0xE0,0x81,0x07,0x00,0x70,0x00,0x0E,0x00,0xF0,0x00,0x0C,0x00,0x98,0x00,0x18,0x00,0x18,0x1C,0x18,0x00,0xCC,0xFF,0x31,0x00,0x4C,0x83,0x33,0x00,0x4C,0x9B,0x37,0x00,0x4C,0xBB,0x36,0x00,0x8C,0x8F,0x37,0x00,0x8C,0x8E,0x33,0x00,0x18,0xFF,0x19,0x00,0x18,0x00,0x1B,0x00,0x30,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0xE0,0x81,0x07,0x00,0x80,0xFF,0x01,0x00,0x00,0x7E,0x00,0x00,
+	0x00,0x7E,0x00,0x00,0x80,0xFF,0x01,0x00,0xE0,0x81,0x07,0x00,0x70,0x00,0x0E,0x00,0xF0,0x00,0x0C,0x00,0x98,0x00,0x18,0x00,0x18,0x1C,0x18,0x00,0xCC,0xFF,0x31,0x00,0x4C,0x83,0x33,0x00,0x4C,0x9B,0x37,0x00,0x4C,0xBB,0x36,0x00,0x8C,0x8F,0x37,0x00,0x8C,0x8E,0x33,0x00,0x18,0xFF,0x19,0x00,0x18,0x00,0x1B,0x00,0x30,0x00,0x0E,0x00,0x70,0x00,0x0E,0x00,0xE0,0x81,0x07,0x00,0x80,0xFF,0x01,0x00,0x00,0x7E,0x00,0x00,
 
 	/* Index 4, character 36 "$" (width: 15 pixels) */
-	0xF, 0x00,0x04,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x04,0x00,0x00,
+	0x00,0x04,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x04,0x00,0x00,
 
 	/* Index 5, character 37 "%" (width: 20 pixels) */
-	0x14, 0xF0,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xC8,0x01,0x00,0x00,0x84,0x01,0x00,0x00,0x08,0x13,0x00,0x00,0x1C,0x13,0x00,0x00,0xF4,0x1F,0x08,0x00,0x04,0x38,0x08,0x00,0xFC,0x77,0x19,0x00,0xFC,0xFF,0x17,0x00,0xFC,0xFF,0x17,0x00,0xFC,0x5F,0x19,0x00,0xFC,0x2F,0x08,0x00,0xEC,0x1F,0x00,0x00,0x1C,0x13,0x00,0x00,0x08,0x13,0x00,0x00,0x84,0x01,0x00,0x00,0xC8,0x01,0x00,0x00,0xF8,0x01,0x00,0x00,0xF0,0x00,0x00,0x00,
+	0xF0,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xC8,0x01,0x00,0x00,0x84,0x01,0x00,0x00,0x08,0x13,0x00,0x00,0x1C,0x13,0x00,0x00,0xF4,0x1F,0x08,0x00,0x04,0x38,0x08,0x00,0xFC,0x77,0x19,0x00,0xFC,0xFF,0x17,0x00,0xFC,0xFF,0x17,0x00,0xFC,0x5F,0x19,0x00,0xFC,0x2F,0x08,0x00,0xEC,0x1F,0x00,0x00,0x1C,0x13,0x00,0x00,0x08,0x13,0x00,0x00,0x84,0x01,0x00,0x00,0xC8,0x01,0x00,0x00,0xF8,0x01,0x00,0x00,0xF0,0x00,0x00,0x00,
 
 	/* Index 6, character 38 "&" (width: 10 pixels) */
-	0xA, 0xFC,0x81,0x07,0x00,0xFC,0x63,0x18,0x00,0xFC,0x2F,0x10,0x00,0xFC,0x17,0x20,0x00,0x04,0x14,0x20,0x00,0x04,0x34,0x20,0x00,0xFC,0x1F,0x20,0x00,0xFC,0x27,0x10,0x00,0xFC,0x63,0x18,0x00,0xFC,0x81,0x07,0x00,
+	0xFC,0x81,0x07,0x00,0xFC,0x63,0x18,0x00,0xFC,0x2F,0x10,0x00,0xFC,0x17,0x20,0x00,0x04,0x14,0x20,0x00,0x04,0x34,0x20,0x00,0xFC,0x1F,0x20,0x00,0xFC,0x27,0x10,0x00,0xFC,0x63,0x18,0x00,0xFC,0x81,0x07,0x00,
 
 	/* Index 7, character 39 "'" (width: 10 pixels) */
-	0xA, 0x80,0x03,0x38,0x00,0xC0,0x1F,0x44,0x00,0x40,0x25,0x46,0x00,0x20,0xC5,0x42,0x00,0x30,0x02,0x21,0x00,0x10,0x8E,0x12,0x00,0x08,0x99,0x1A,0x00,0x88,0x60,0x0A,0x00,0xC8,0x80,0x05,0x00,0x70,0x80,0x03,0x00,
+	0x80,0x03,0x38,0x00,0xC0,0x1F,0x44,0x00,0x40,0x25,0x46,0x00,0x20,0xC5,0x42,0x00,0x30,0x02,0x21,0x00,0x10,0x8E,0x12,0x00,0x08,0x99,0x1A,0x00,0x88,0x60,0x0A,0x00,0xC8,0x80,0x05,0x00,0x70,0x80,0x03,0x00,
 
 	/* Index 8, character 40 "(" (width: 21 pixels) */
-	0x15, 0x00,0x1C,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x7F,0x00,0x00,0x80,0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0x80,0xFF,0x07,0x00,0x80,0xFF,0x07,0x00,0x80,0xFF,0x0F,0x00,0x00,0x7F,0x0E,0x00,0x00,0x3E,0x0C,0x00,0x00,0x1C,0x00,0x00,
+	0x00,0x1C,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x7F,0x00,0x00,0x80,0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0x80,0xFF,0x07,0x00,0x80,0xFF,0x07,0x00,0x80,0xFF,0x0F,0x00,0x00,0x7F,0x0E,0x00,0x00,0x3E,0x0C,0x00,0x00,0x1C,0x00,0x00,
 
 	/* Index 9, character 41 ")" (width: 21 pixels) */
-	0x15, 0x00,0x1C,0x00,0x00,0x00,0x3E,0x0C,0x00,0x00,0x7F,0x0E,0x00,0x80,0xFF,0x0F,0x00,0x80,0xFF,0x07,0x00,0x80,0xFF,0x07,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0x80,0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x1C,0x00,0x00,
+	0x00,0x1C,0x00,0x00,0x00,0x3E,0x0C,0x00,0x00,0x7F,0x0E,0x00,0x80,0xFF,0x0F,0x00,0x80,0xFF,0x07,0x00,0x80,0xFF,0x07,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0x80,0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x1C,0x00,0x00,
 
 	/* Index 10, character 42 "*" (width: 22 pixels) */
-	0x16, 0x00,0x18,0x00,0x00,0x00,0xDB,0x00,0x00,0x60,0xFF,0x06,0x00,0xE0,0xFF,0x07,0x00,0xC0,0xFF,0x03,0x00,0xC0,0xFF,0x03,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x07,0x00,0xC0,0xFF,0x03,0x00,0xE0,0xFF,0x07,0x00,0xF0,0xFF,0x0F,0x00,0xF0,0xFF,0x0F,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x07,0x00,0xC0,0xFF,0x03,0x00,0xC0,0xFF,0x03,0x00,0xE0,0xFF,0x07,0x00,0x60,0xFF,0x06,0x00,0x00,0xDB,0x00,0x00,0x00,0x18,0x00,0x00,
+	0x00,0x18,0x00,0x00,0x00,0xDB,0x00,0x00,0x60,0xFF,0x06,0x00,0xE0,0xFF,0x07,0x00,0xC0,0xFF,0x03,0x00,0xC0,0xFF,0x03,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x07,0x00,0xC0,0xFF,0x03,0x00,0xE0,0xFF,0x07,0x00,0xF0,0xFF,0x0F,0x00,0xF0,0xFF,0x0F,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x07,0x00,0xC0,0xFF,0x03,0x00,0xC0,0xFF,0x03,0x00,0xE0,0xFF,0x07,0x00,0x60,0xFF,0x06,0x00,0x00,0xDB,0x00,0x00,0x00,0x18,0x00,0x00,
 
 	/* Index 11, character 43 "+" (width: 22 pixels) */
-	0x16, 0x00,0x18,0x00,0x00,0x00,0xDB,0x00,0x00,0x60,0xFF,0x06,0x00,0xE0,0xFF,0x07,0x00,0xC0,0xFF,0x02,0x00,0xC0,0x3F,0x03,0x00,0xF0,0x9F,0x07,0x00,0xE0,0xC7,0x07,0x00,0xC0,0xE1,0x03,0x00,0xE0,0xE0,0x07,0x00,0x30,0xF0,0x0F,0x00,0xF0,0x81,0x0F,0x00,0xE0,0xC0,0x07,0x00,0x60,0xF0,0x07,0x00,0x60,0xFC,0x07,0x00,0x20,0xFF,0x07,0x00,0x90,0xFF,0x03,0x00,0xF0,0xFF,0x03,0x00,0xE8,0xFF,0x07,0x00,0x64,0xFF,0x06,0x00,0x00,0xDB,0x00,0x00,0x00,0x18,0x00,0x00,
+	0x00,0x18,0x00,0x00,0x00,0xDB,0x00,0x00,0x60,0xFF,0x06,0x00,0xE0,0xFF,0x07,0x00,0xC0,0xFF,0x02,0x00,0xC0,0x3F,0x03,0x00,0xF0,0x9F,0x07,0x00,0xE0,0xC7,0x07,0x00,0xC0,0xE1,0x03,0x00,0xE0,0xE0,0x07,0x00,0x30,0xF0,0x0F,0x00,0xF0,0x81,0x0F,0x00,0xE0,0xC0,0x07,0x00,0x60,0xF0,0x07,0x00,0x60,0xFC,0x07,0x00,0x20,0xFF,0x07,0x00,0x90,0xFF,0x03,0x00,0xF0,0xFF,0x03,0x00,0xE8,0xFF,0x07,0x00,0x64,0xFF,0x06,0x00,0x00,0xDB,0x00,0x00,0x00,0x18,0x00,0x00,
 
 	/* Index 12, character 44 "," (width: 20 pixels) */
-	0x14, 0x00,0x00,0x08,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0F,0x00,0x00,0xC0,0x07,0x00,0x00,0xC0,0x07,0x00,0x00,0xF0,0x07,0x00,0x00,0xF8,0x03,0x00,0x00,0xEC,0x03,0x00,0x00,0xF6,0x03,0x00,0x00,0xFB,0x01,0x00,0x00,0xFB,0x01,0x00,0x00,0xFE,0x01,0x00,0x00,0xFB,0x00,0x00,0x00,0x76,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,
+	0x00,0x00,0x08,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0F,0x00,0x00,0xC0,0x07,0x00,0x00,0xC0,0x07,0x00,0x00,0xF0,0x07,0x00,0x00,0xF8,0x03,0x00,0x00,0xEC,0x03,0x00,0x00,0xF6,0x03,0x00,0x00,0xFB,0x01,0x00,0x00,0xFB,0x01,0x00,0x00,0xFE,0x01,0x00,0x00,0xFB,0x00,0x00,0x00,0x76,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x03,0x00,0x00,
 
 	/* Index 13, character 45 "-" (width: 12 pixels) */
-	0xC, 0x00,0x00,0x18,0x00,0x00,0x00,0x3C,0x00,0xC0,0x03,0x3F,0x00,0xE0,0xCF,0x0F,0x00,0x70,0xFE,0x03,0x00,0x38,0xFC,0x01,0x00,0x18,0xFE,0x01,0x00,0x18,0xFF,0x07,0x00,0xF8,0x87,0x0F,0x00,0xF0,0x01,0x3F,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x18,0x00,
+	0x00,0x00,0x18,0x00,0x00,0x00,0x3C,0x00,0xC0,0x03,0x3F,0x00,0xE0,0xCF,0x0F,0x00,0x70,0xFE,0x03,0x00,0x38,0xFC,0x01,0x00,0x18,0xFE,0x01,0x00,0x18,0xFF,0x07,0x00,0xF8,0x87,0x0F,0x00,0xF0,0x01,0x3F,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x18,0x00,
 
 	/* Index 14, character 46 "." (width: 24 pixels) */
-	0x18, 0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,
+	0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFE,0x1F,0x00,0x00,
 
 	/* Index 15, character 47 "/" (width: 24 pixels) */
-	0x18, 0x00,0x00,0x00,0x01,0x00,0x00,0xC0,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0xFC,0x01,0x00,0x00,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0x01,0xFC,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x00,0xFE,0xFF,0x3F,0x00,0xFE,0xFF,0x0F,0x00,0xFE,0xFF,0x03,0x00,0xFE,0xFF,0x00,0x00,0xFE,0x3F,0x00,0x00,0xFE,0x0F,0x00,0x00,0xFE,0x03,0x00,0x00,0xFE,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x01,0x00,0x00,0xC0,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0xFC,0x01,0x00,0x00,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0x01,0xFC,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x00,0xFE,0xFF,0x3F,0x00,0xFE,0xFF,0x0F,0x00,0xFE,0xFF,0x03,0x00,0xFE,0xFF,0x00,0x00,0xFE,0x3F,0x00,0x00,0xFE,0x0F,0x00,0x00,0xFE,0x03,0x00,0x00,0xFE,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
 
 	/* Index 16, character 48 "0" (width: 12 pixels) */
-	0xC, 0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,
+	0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x38,0x00,
 
 	/* Index 17, character 49 "1" (width: 18 pixels) */
-	0x12, 0xE0,0xFF,0x3F,0x00,0xE0,0xFF,0x3F,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0xFF,0x3F,0x00,0xE0,0xFF,0x3F,0x00,
+	0xE0,0xFF,0x3F,0x00,0xE0,0xFF,0x3F,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0x00,0x30,0x00,0xE0,0xFF,0x3F,0x00,0xE0,0xFF,0x3F,0x00,
 
 	/* Index 18, character 50 "2" (width: 18 pixels) */
-	0x12, 0x00,0xF8,0x3F,0x00,0x00,0xF8,0x3F,0x00,0x00,0x38,0x30,0x00,0x00,0x38,0x30,0x00,0x00,0x38,0x30,0x00,0xF0,0x3F,0x30,0x00,0xF0,0x3F,0x30,0x00,0x70,0x38,0x30,0x00,0x70,0x38,0x30,0x00,0x70,0x38,0x30,0x00,0x70,0x38,0x30,0x00,0x70,0xF8,0x3F,0x00,0x70,0xF8,0x3F,0x00,0x70,0x60,0x00,0x00,0x70,0x60,0x00,0x00,0x70,0x60,0x00,0x00,0xF0,0x7F,0x00,0x00,0xF0,0x7F,0x00,0x00,
+	0x00,0xF8,0x3F,0x00,0x00,0xF8,0x3F,0x00,0x00,0x38,0x30,0x00,0x00,0x38,0x30,0x00,0x00,0x38,0x30,0x00,0xF0,0x3F,0x30,0x00,0xF0,0x3F,0x30,0x00,0x70,0x38,0x30,0x00,0x70,0x38,0x30,0x00,0x70,0x38,0x30,0x00,0x70,0x38,0x30,0x00,0x70,0xF8,0x3F,0x00,0x70,0xF8,0x3F,0x00,0x70,0x60,0x00,0x00,0x70,0x60,0x00,0x00,0x70,0x60,0x00,0x00,0xF0,0x7F,0x00,0x00,0xF0,0x7F,0x00,0x00,
 
 	/* Index 19, character 51 "3" (width: 8 pixels) */
-	0x8, 0x00,0x18,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xFF,0x00,0x00,0x80,0xFF,0x01,0x00,0xC0,0xFF,0x03,0x00,0xE0,0xFF,0x07,0x00,0xF0,0xFF,0x0F,0x00,
+	0x00,0x18,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xFF,0x00,0x00,0x80,0xFF,0x01,0x00,0xC0,0xFF,0x03,0x00,0xE0,0xFF,0x07,0x00,0xF0,0xFF,0x0F,0x00,
 
 	/* Index 20, character 52 "4" (width: 8 pixels) */
-	0x8, 0xF0,0xFF,0x0F,0x00,0xE0,0xFF,0x07,0x00,0xC0,0xFF,0x03,0x00,0x80,0xFF,0x01,0x00,0x00,0xFF,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x18,0x00,0x00,
+	0xF0,0xFF,0x0F,0x00,0xE0,0xFF,0x07,0x00,0xC0,0xFF,0x03,0x00,0x80,0xFF,0x01,0x00,0x00,0xFF,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x18,0x00,0x00,
 
 	/* Index 21, character 53 "5" (width: 16 pixels) */
-	0x10, 0x00,0x80,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x80,0x00,0x00,
+	0x00,0x80,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x80,0x00,0x00,
 
 	/* Index 22, character 54 "6" (width: 16 pixels) */
-	0x10, 0x00,0x04,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0xFC,0x03,0x00,0x00,0xFC,0x03,0x00,0x00,0xFC,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x04,0x00,0x00,
+	0x00,0x04,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0xFC,0x03,0x00,0x00,0xFC,0x03,0x00,0x00,0xFC,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x04,0x00,0x00,
 
 	/* Index 23, character 55 "7" (width: 17 pixels) */
-	0x11, 0x00,0x30,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFF,0x03,0x00,0x80,0xFF,0x07,0x00,0xC0,0xFF,0x0F,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFF,0x03,0x00,0x80,0xFF,0x07,0x00,0xC0,0xFF,0x0F,0x00,0xE0,0xFF,0x1F,0x00,
+	0x00,0x30,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFF,0x03,0x00,0x80,0xFF,0x07,0x00,0xC0,0xFF,0x0F,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFF,0x03,0x00,0x80,0xFF,0x07,0x00,0xC0,0xFF,0x0F,0x00,0xE0,0xFF,0x1F,0x00,
 
 	/* Index 24, character 56 "8" (width: 17 pixels) */
-	0x11, 0xE0,0xFF,0x1F,0x00,0xC0,0xFF,0x0F,0x00,0x80,0xFF,0x07,0x00,0x00,0xFF,0x03,0x00,0x00,0xFE,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x1F,0x00,0xC0,0xFF,0x0F,0x00,0x80,0xFF,0x07,0x00,0x00,0xFF,0x03,0x00,0x00,0xFE,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x30,0x00,0x00,
+	0xE0,0xFF,0x1F,0x00,0xC0,0xFF,0x0F,0x00,0x80,0xFF,0x07,0x00,0x00,0xFF,0x03,0x00,0x00,0xFE,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x1F,0x00,0xC0,0xFF,0x0F,0x00,0x80,0xFF,0x07,0x00,0x00,0xFF,0x03,0x00,0x00,0xFE,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x30,0x00,0x00,
 
 	/* Index 25, character 57 "9" (width: 18 pixels) */
-	0x12, 0xE0,0xFF,0x1F,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x30,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFF,0x03,0x00,0x80,0xFF,0x07,0x00,0xC0,0xFF,0x0F,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x30,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFF,0x03,0x00,0x80,0xFF,0x07,0x00,0xC0,0xFF,0x0F,0x00,0xE0,0xFF,0x1F,0x00,
+	0xE0,0xFF,0x1F,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x30,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFF,0x03,0x00,0x80,0xFF,0x07,0x00,0xC0,0xFF,0x0F,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x30,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFF,0x03,0x00,0x80,0xFF,0x07,0x00,0xC0,0xFF,0x0F,0x00,0xE0,0xFF,0x1F,0x00,
 
 	/* Index 26, character 58 ":" (width: 18 pixels) */
-	0x12, 0xE0,0xFF,0x1F,0x00,0xC0,0xFF,0x0F,0x00,0x80,0xFF,0x07,0x00,0x00,0xFF,0x03,0x00,0x00,0xFE,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x30,0x00,0x00,0xE0,0xFF,0x1F,0x00,0xC0,0xFF,0x0F,0x00,0x80,0xFF,0x07,0x00,0x00,0xFF,0x03,0x00,0x00,0xFE,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x30,0x00,0x00,0xE0,0xFF,0x1F,0x00,0xE0,0xFF,0x1F,0x00,
+	0xE0,0xFF,0x1F,0x00,0xC0,0xFF,0x0F,0x00,0x80,0xFF,0x07,0x00,0x00,0xFF,0x03,0x00,0x00,0xFE,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x30,0x00,0x00,0xE0,0xFF,0x1F,0x00,0xC0,0xFF,0x0F,0x00,0x80,0xFF,0x07,0x00,0x00,0xFF,0x03,0x00,0x00,0xFE,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x30,0x00,0x00,0xE0,0xFF,0x1F,0x00,0xE0,0xFF,0x1F,0x00,
 
 	/* Index 27, character 59 ";" (width: 9 pixels) */
-	0x9, 0xC0,0xFF,0x1F,0x00,0xC0,0xFF,0x1F,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0xC0,0xFF,0x1F,0x00,0xC0,0xFF,0x1F,0x00,
+	0xC0,0xFF,0x1F,0x00,0xC0,0xFF,0x1F,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0xC0,0xFF,0x1F,0x00,0xC0,0xFF,0x1F,0x00,
 
 	/* Index 28, character 60 "<" (width: 14 pixels) */
-	0xE, 0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,
+	0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,
 
 	/* Index 29, character 61 "=" (width: 14 pixels) */
-	0xE, 0x00,0xFC,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFF,0x03,0x00,0x80,0xFF,0x07,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0x80,0xFF,0x07,0x00,0x00,0xFF,0x03,0x00,0x00,0xFE,0x01,0x00,0x00,0xFC,0x00,0x00,
+	0x00,0xFC,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFF,0x03,0x00,0x80,0xFF,0x07,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0x80,0xFF,0x07,0x00,0x00,0xFF,0x03,0x00,0x00,0xFE,0x01,0x00,0x00,0xFC,0x00,0x00,
 
 	/* Index 30, character 62 ">" (width: 19 pixels) */
-	0x13, 0x00,0x00,0x08,0x00,0x00,0x00,0x0E,0x00,0x00,0xC0,0x07,0x00,0x00,0xF0,0x03,0x00,0x00,0x38,0x02,0x00,0x00,0x78,0x02,0x00,0x00,0xF0,0x07,0x00,0x00,0x80,0x0B,0x00,0x00,0x00,0x0F,0x00,0x00,0xE0,0x07,0x00,0x00,0xF8,0x01,0x00,0x00,0x9F,0x01,0x00,0x80,0x83,0x01,0x00,0x80,0x83,0x01,0x00,0x00,0x9F,0x01,0x00,0x00,0xF8,0x01,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x08,0x00,
+	0x00,0x00,0x08,0x00,0x00,0x00,0x0E,0x00,0x00,0xC0,0x07,0x00,0x00,0xF0,0x03,0x00,0x00,0x38,0x02,0x00,0x00,0x78,0x02,0x00,0x00,0xF0,0x07,0x00,0x00,0x80,0x0B,0x00,0x00,0x00,0x0F,0x00,0x00,0xE0,0x07,0x00,0x00,0xF8,0x01,0x00,0x00,0x9F,0x01,0x00,0x80,0x83,0x01,0x00,0x80,0x83,0x01,0x00,0x00,0x9F,0x01,0x00,0x00,0xF8,0x01,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x08,0x00,
 
 	/* Index 31, character 63 "?" (width: 19 pixels) */
-	0x13, 0x00,0xF0,0x07,0x00,0x00,0xF0,0x0F,0x00,0x00,0xF8,0x0F,0x00,0x00,0xF8,0x0F,0x00,0x00,0xF8,0x1F,0x00,0x80,0xF8,0x1F,0x00,0x40,0xF5,0x3F,0x00,0x20,0xF7,0x3F,0x00,0x10,0xF5,0x3F,0x00,0x90,0xF9,0x7F,0x00,0x88,0xE0,0x7F,0x00,0xC8,0xEF,0x3F,0x00,0xBC,0xE0,0x3F,0x00,0x88,0xF8,0x1F,0x00,0x90,0xFC,0x1F,0x00,0xA0,0xFC,0x1F,0x00,0xC0,0xF2,0x0F,0x00,0x80,0xF2,0x0F,0x00,0x80,0xF1,0x07,0x00,
+	0x00,0xF0,0x07,0x00,0x00,0xF0,0x0F,0x00,0x00,0xF8,0x0F,0x00,0x00,0xF8,0x0F,0x00,0x00,0xF8,0x1F,0x00,0x80,0xF8,0x1F,0x00,0x40,0xF5,0x3F,0x00,0x20,0xF7,0x3F,0x00,0x10,0xF5,0x3F,0x00,0x90,0xF9,0x7F,0x00,0x88,0xE0,0x7F,0x00,0xC8,0xEF,0x3F,0x00,0xBC,0xE0,0x3F,0x00,0x88,0xF8,0x1F,0x00,0x90,0xFC,0x1F,0x00,0xA0,0xFC,0x1F,0x00,0xC0,0xF2,0x0F,0x00,0x80,0xF2,0x0F,0x00,0x80,0xF1,0x07,0x00,
 
 	/* Index 32, character 64 "@" (width: 20 pixels) */
-	0x14, 0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x0F,0x00,0x00,0xC0,0x07,0x06,0x00,0xE0,0x03,0x03,0x00,0xE0,0x01,0x21,0x00,0xF0,0x03,0x23,0x00,0xF8,0x87,0x37,0x00,0x38,0xCF,0x1F,0x00,0x18,0xFE,0x01,0x00,0x10,0xFC,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0xFF,0x03,0x00,0xE0,0xCF,0x07,0x00,0xF0,0x87,0x0F,0x00,0xB0,0x03,0x1F,0x00,0x10,0x03,0x3E,0x00,0x00,0x03,0x1C,0x00,0x80,0x01,0x08,0x00,
+	0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x0F,0x00,0x00,0xC0,0x07,0x06,0x00,0xE0,0x03,0x03,0x00,0xE0,0x01,0x21,0x00,0xF0,0x03,0x23,0x00,0xF8,0x87,0x37,0x00,0x38,0xCF,0x1F,0x00,0x18,0xFE,0x01,0x00,0x10,0xFC,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0xFF,0x03,0x00,0xE0,0xCF,0x07,0x00,0xF0,0x87,0x0F,0x00,0xB0,0x03,0x1F,0x00,0x10,0x03,0x3E,0x00,0x00,0x03,0x1C,0x00,0x80,0x01,0x08,0x00,
 
 	/* Index 33, character 65 "A" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x3C,0xC0,0xFF,0x01,0x24,0x00,0xC0,0x01,0xBC,0xFF,0xDF,0x01,0xBC,0xB6,0xD5,0x01,0xBC,0x88,0xD2,0x01,0xBC,0xFF,0xDF,0x01,0x24,0x00,0xC0,0x01,0x3C,0xC0,0xFF,0x01,0x24,0xC0,0xFF,0x01,0x3C,0xCE,0xFF,0x01,0x3C,0xD3,0xFF,0x01,0xFC,0xD1,0xFF,0x01,0x3C,0xCC,0xFF,0x01,0x3C,0xC0,0xFF,0x01,0x24,0x12,0xFE,0x01,0xBC,0xFF,0xFE,0x01,0x00,0x12,0xFE,0x01,0x00,0xD2,0xFF,0x01,0x00,0xD2,0xFF,0x01,0x00,0x12,0xFE,0x01,0x80,0xFF,0xFE,0x01,0x00,0x12,0xFE,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x3C,0xC0,0xFF,0x01,0x24,0x00,0xC0,0x01,0xBC,0xFF,0xDF,0x01,0xBC,0xB6,0xD5,0x01,0xBC,0x88,0xD2,0x01,0xBC,0xFF,0xDF,0x01,0x24,0x00,0xC0,0x01,0x3C,0xC0,0xFF,0x01,0x24,0xC0,0xFF,0x01,0x3C,0xCE,0xFF,0x01,0x3C,0xD3,0xFF,0x01,0xFC,0xD1,0xFF,0x01,0x3C,0xCC,0xFF,0x01,0x3C,0xC0,0xFF,0x01,0x24,0x12,0xFE,0x01,0xBC,0xFF,0xFE,0x01,0x00,0x12,0xFE,0x01,0x00,0xD2,0xFF,0x01,0x00,0xD2,0xFF,0x01,0x00,0x12,0xFE,0x01,0x80,0xFF,0xFE,0x01,0x00,0x12,0xFE,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 34, character 66 "B" (width: 24 pixels) */
-	0x18, 0x00,0xC8,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0x03,0xFC,0x01,0x80,0x01,0xFC,0x01,0x40,0xE1,0xFF,0x01,0xA0,0xE0,0xDF,0x01,0x10,0xE5,0xCC,0x01,0xA0,0xFB,0x8F,0x01,0xB0,0x01,0xA8,0x01,0x30,0x01,0xB8,0x01,0xC0,0xC0,0xBF,0x01,0x80,0xC0,0xBF,0x01,0x40,0xC0,0x3F,0x01,0xC0,0x00,0x38,0x01,0x60,0xC0,0x39,0x00,0x60,0xC0,0x39,0x00,0xD0,0xC3,0x39,0x00,0x20,0x4A,0x78,0x00,0x30,0xB4,0x7F,0x00,0xF0,0x9C,0x7F,0x00,0x80,0x80,0x7F,0x00,0x00,0xFF,0xFF,0x00,0x00,0xC2,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC8,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0x03,0xFC,0x01,0x80,0x01,0xFC,0x01,0x40,0xE1,0xFF,0x01,0xA0,0xE0,0xDF,0x01,0x10,0xE5,0xCC,0x01,0xA0,0xFB,0x8F,0x01,0xB0,0x01,0xA8,0x01,0x30,0x01,0xB8,0x01,0xC0,0xC0,0xBF,0x01,0x80,0xC0,0xBF,0x01,0x40,0xC0,0x3F,0x01,0xC0,0x00,0x38,0x01,0x60,0xC0,0x39,0x00,0x60,0xC0,0x39,0x00,0xD0,0xC3,0x39,0x00,0x20,0x4A,0x78,0x00,0x30,0xB4,0x7F,0x00,0xF0,0x9C,0x7F,0x00,0x80,0x80,0x7F,0x00,0x00,0xFF,0xFF,0x00,0x00,0xC2,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 35, character 67 "C" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0x3C,0xF9,0x01,0x00,0xE0,0xFF,0x01,0xC0,0x3F,0xFF,0x01,0xC0,0xF3,0xFF,0x01,0xF8,0xFF,0xFF,0x01,0xF8,0x93,0xFC,0x01,0xC8,0xFF,0xFF,0x01,0xF8,0x9F,0xD3,0x01,0xF8,0xFF,0xFF,0x01,0x00,0xFC,0xCF,0x01,0xC0,0xFF,0xFF,0x01,0xE0,0xF9,0xFF,0x01,0x20,0xFF,0xFF,0x01,0xE0,0xFF,0xCF,0x01,0x00,0xD8,0xF9,0x01,0x00,0x3C,0xFF,0x01,0x00,0xE4,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0x3C,0xF9,0x01,0x00,0xE0,0xFF,0x01,0xC0,0x3F,0xFF,0x01,0xC0,0xF3,0xFF,0x01,0xF8,0xFF,0xFF,0x01,0xF8,0x93,0xFC,0x01,0xC8,0xFF,0xFF,0x01,0xF8,0x9F,0xD3,0x01,0xF8,0xFF,0xFF,0x01,0x00,0xFC,0xCF,0x01,0xC0,0xFF,0xFF,0x01,0xE0,0xF9,0xFF,0x01,0x20,0xFF,0xFF,0x01,0xE0,0xFF,0xCF,0x01,0x00,0xD8,0xF9,0x01,0x00,0x3C,0xFF,0x01,0x00,0xE4,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 36, character 68 "D" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC2,0xFF,0x01,0x00,0xC5,0xE7,0x01,0x80,0xFE,0xE7,0x01,0x80,0x00,0xC5,0x01,0x40,0x81,0xCA,0x01,0xA0,0xC2,0xCD,0x01,0x10,0xDF,0xDF,0x01,0x10,0xEE,0x9F,0x01,0x08,0xF6,0x9F,0x01,0x04,0x3C,0x9C,0x01,0x04,0x38,0x9C,0x01,0x08,0x7C,0x1C,0x01,0x10,0xFE,0x3C,0x00,0x1C,0xEF,0x3C,0x00,0x04,0xDF,0x3D,0x00,0xFC,0xBA,0x3E,0x00,0x40,0x01,0x3D,0x00,0x80,0xFE,0x7F,0x00,0x00,0xC5,0x7F,0x00,0x00,0xC2,0xFF,0x00,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC2,0xFF,0x01,0x00,0xC5,0xE7,0x01,0x80,0xFE,0xE7,0x01,0x80,0x00,0xC5,0x01,0x40,0x81,0xCA,0x01,0xA0,0xC2,0xCD,0x01,0x10,0xDF,0xDF,0x01,0x10,0xEE,0x9F,0x01,0x08,0xF6,0x9F,0x01,0x04,0x3C,0x9C,0x01,0x04,0x38,0x9C,0x01,0x08,0x7C,0x1C,0x01,0x10,0xFE,0x3C,0x00,0x1C,0xEF,0x3C,0x00,0x04,0xDF,0x3D,0x00,0xFC,0xBA,0x3E,0x00,0x40,0x01,0x3D,0x00,0x80,0xFE,0x7F,0x00,0x00,0xC5,0x7F,0x00,0x00,0xC2,0xFF,0x00,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 37, character 69 "E" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0xE0,0xC0,0xFF,0x01,0xF0,0xE1,0xFF,0x01,0xF8,0xF3,0xFF,0x01,0xF8,0x93,0xFF,0x01,0xF8,0xF3,0xFF,0x01,0xF0,0xE1,0xFF,0x01,0xE0,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0x60,0xFF,0x01,0x00,0x90,0xFF,0x01,0xE0,0xF3,0xFF,0x01,0xE0,0xE7,0xFF,0x01,0x00,0xE4,0xFF,0x01,0x00,0xC4,0xFF,0x01,0xF8,0xFF,0xFF,0x01,0xF8,0xFF,0xFF,0x01,0x00,0xC8,0xFF,0x01,0x00,0xCF,0xFF,0x01,0x00,0xCF,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0xE0,0xC0,0xFF,0x01,0xF0,0xE1,0xFF,0x01,0xF8,0xF3,0xFF,0x01,0xF8,0x93,0xFF,0x01,0xF8,0xF3,0xFF,0x01,0xF0,0xE1,0xFF,0x01,0xE0,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0x60,0xFF,0x01,0x00,0x90,0xFF,0x01,0xE0,0xF3,0xFF,0x01,0xE0,0xE7,0xFF,0x01,0x00,0xE4,0xFF,0x01,0x00,0xC4,0xFF,0x01,0xF8,0xFF,0xFF,0x01,0xF8,0xFF,0xFF,0x01,0x00,0xC8,0xFF,0x01,0x00,0xCF,0xFF,0x01,0x00,0xCF,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 38, character 70 "F" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0xE0,0xFF,0xFF,0x01,0x40,0x00,0xFC,0x01,0x40,0x00,0xFC,0x01,0x80,0x78,0xFC,0x01,0x00,0x79,0xFC,0x01,0xE0,0x79,0xFC,0x01,0x40,0x78,0xFC,0x01,0x80,0x00,0xFC,0x01,0x00,0x79,0xFC,0x01,0xE0,0x79,0xFC,0x01,0x40,0x78,0xFC,0x01,0x40,0x78,0xFC,0x01,0x80,0x00,0xFC,0x01,0x00,0x79,0xFC,0x01,0xC0,0x79,0xFC,0x01,0x38,0x78,0xFC,0x01,0x08,0x78,0xFC,0x01,0x08,0x00,0xFC,0x01,0x08,0x00,0xFC,0x01,0xF8,0xFF,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0xE0,0xFF,0xFF,0x01,0x40,0x00,0xFC,0x01,0x40,0x00,0xFC,0x01,0x80,0x78,0xFC,0x01,0x00,0x79,0xFC,0x01,0xE0,0x79,0xFC,0x01,0x40,0x78,0xFC,0x01,0x80,0x00,0xFC,0x01,0x00,0x79,0xFC,0x01,0xE0,0x79,0xFC,0x01,0x40,0x78,0xFC,0x01,0x40,0x78,0xFC,0x01,0x80,0x00,0xFC,0x01,0x00,0x79,0xFC,0x01,0xC0,0x79,0xFC,0x01,0x38,0x78,0xFC,0x01,0x08,0x78,0xFC,0x01,0x08,0x00,0xFC,0x01,0x08,0x00,0xFC,0x01,0xF8,0xFF,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 39, character 71 "G" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xDF,0x01,0x00,0xC0,0xCF,0x01,0x80,0xC3,0xC7,0x01,0x40,0xFF,0xC7,0x01,0x40,0x03,0xC4,0x01,0x40,0xFF,0xC7,0x01,0x60,0xFF,0xC7,0x01,0x60,0x03,0xC4,0x01,0x60,0xFF,0xC7,0x01,0x50,0xFF,0xC7,0x01,0x50,0xFF,0xC7,0x01,0x60,0xFF,0xC7,0x01,0x60,0x03,0xC4,0x01,0x60,0xFF,0xC7,0x01,0x40,0xFF,0xC7,0x01,0x40,0x03,0xC4,0x01,0x40,0xFF,0xC7,0x01,0x80,0xC3,0xC7,0x01,0x00,0xC0,0xCF,0x01,0x00,0xC0,0xDF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xDF,0x01,0x00,0xC0,0xCF,0x01,0x80,0xC3,0xC7,0x01,0x40,0xFF,0xC7,0x01,0x40,0x03,0xC4,0x01,0x40,0xFF,0xC7,0x01,0x60,0xFF,0xC7,0x01,0x60,0x03,0xC4,0x01,0x60,0xFF,0xC7,0x01,0x50,0xFF,0xC7,0x01,0x50,0xFF,0xC7,0x01,0x60,0xFF,0xC7,0x01,0x60,0x03,0xC4,0x01,0x60,0xFF,0xC7,0x01,0x40,0xFF,0xC7,0x01,0x40,0x03,0xC4,0x01,0x40,0xFF,0xC7,0x01,0x80,0xC3,0xC7,0x01,0x00,0xC0,0xCF,0x01,0x00,0xC0,0xDF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 40, character 72 "H" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC2,0xFF,0x01,0x00,0xC5,0xE7,0x01,0x80,0xFE,0xE7,0x01,0x80,0x00,0xC4,0x01,0x40,0x00,0xCC,0x01,0x20,0x00,0xCC,0x01,0x10,0xF8,0xDF,0x01,0x10,0xF8,0x9F,0x01,0x08,0xF8,0x9F,0x01,0x04,0x00,0x9C,0x01,0x08,0x00,0x9C,0x01,0x1C,0x78,0x1C,0x01,0x04,0x78,0x3C,0x00,0x04,0x78,0x3C,0x00,0x7C,0x78,0x3C,0x00,0x40,0x00,0x3C,0x00,0x80,0xFE,0x3F,0x00,0x00,0xC5,0x7F,0x00,0x00,0xC2,0x7F,0x00,0x00,0xC0,0xFF,0x00,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC2,0xFF,0x01,0x00,0xC5,0xE7,0x01,0x80,0xFE,0xE7,0x01,0x80,0x00,0xC4,0x01,0x40,0x00,0xCC,0x01,0x20,0x00,0xCC,0x01,0x10,0xF8,0xDF,0x01,0x10,0xF8,0x9F,0x01,0x08,0xF8,0x9F,0x01,0x04,0x00,0x9C,0x01,0x08,0x00,0x9C,0x01,0x1C,0x78,0x1C,0x01,0x04,0x78,0x3C,0x00,0x04,0x78,0x3C,0x00,0x7C,0x78,0x3C,0x00,0x40,0x00,0x3C,0x00,0x80,0xFE,0x3F,0x00,0x00,0xC5,0x7F,0x00,0x00,0xC2,0x7F,0x00,0x00,0xC0,0xFF,0x00,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 41, character 73 "I" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xE0,0xDF,0x01,0x00,0xE0,0x8F,0x00,0x00,0xE0,0x2F,0x00,0x00,0xE0,0x6F,0x01,0x10,0xE0,0x6D,0x01,0x70,0xF0,0xA9,0x01,0x70,0xE8,0xAF,0x01,0xF0,0xE6,0x2F,0x01,0xF0,0xE1,0x2F,0x00,0xF0,0xE1,0x2F,0x00,0xF0,0xE1,0xEB,0x00,0xF0,0xE1,0xAB,0x00,0xE0,0xE3,0x2B,0x01,0xC0,0xE3,0x2B,0x01,0x80,0xE3,0xDB,0x01,0x00,0xE2,0xDB,0x01,0x00,0xE0,0xFB,0x01,0x00,0xE0,0xEB,0x01,0x00,0xE0,0xE3,0x01,0x00,0xE0,0xF7,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xE0,0xDF,0x01,0x00,0xE0,0x8F,0x00,0x00,0xE0,0x2F,0x00,0x00,0xE0,0x6F,0x01,0x10,0xE0,0x6D,0x01,0x70,0xF0,0xA9,0x01,0x70,0xE8,0xAF,0x01,0xF0,0xE6,0x2F,0x01,0xF0,0xE1,0x2F,0x00,0xF0,0xE1,0x2F,0x00,0xF0,0xE1,0xEB,0x00,0xF0,0xE1,0xAB,0x00,0xE0,0xE3,0x2B,0x01,0xC0,0xE3,0x2B,0x01,0x80,0xE3,0xDB,0x01,0x00,0xE2,0xDB,0x01,0x00,0xE0,0xFB,0x01,0x00,0xE0,0xEB,0x01,0x00,0xE0,0xE3,0x01,0x00,0xE0,0xF7,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 42, character 74 "J" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFC,0x01,0x00,0x40,0xF8,0x01,0x00,0x40,0xF8,0x01,0x00,0x40,0xF8,0x01,0x00,0x40,0xF0,0x01,0x00,0x20,0xF0,0x01,0x00,0x21,0xF0,0x01,0xD0,0x20,0xF0,0x01,0x50,0x20,0xF0,0x01,0x34,0x20,0xF0,0x01,0x7C,0x20,0xF0,0x01,0xBC,0xB7,0xF0,0x01,0x38,0xE8,0xF0,0x01,0x68,0xE0,0xF0,0x01,0xC8,0xE1,0xF0,0x01,0x10,0x60,0xF0,0x01,0x00,0x40,0xF8,0x01,0x00,0x40,0xF8,0x01,0x00,0xC0,0xF8,0x01,0x00,0xC0,0xFC,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFC,0x01,0x00,0x40,0xF8,0x01,0x00,0x40,0xF8,0x01,0x00,0x40,0xF8,0x01,0x00,0x40,0xF0,0x01,0x00,0x20,0xF0,0x01,0x00,0x21,0xF0,0x01,0xD0,0x20,0xF0,0x01,0x50,0x20,0xF0,0x01,0x34,0x20,0xF0,0x01,0x7C,0x20,0xF0,0x01,0xBC,0xB7,0xF0,0x01,0x38,0xE8,0xF0,0x01,0x68,0xE0,0xF0,0x01,0xC8,0xE1,0xF0,0x01,0x10,0x60,0xF0,0x01,0x00,0x40,0xF8,0x01,0x00,0x40,0xF8,0x01,0x00,0xC0,0xF8,0x01,0x00,0xC0,0xFC,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 43, character 75 "K" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0x7F,0x01,0x00,0xC0,0x3F,0x01,0x00,0xC0,0x1F,0x01,0x00,0xC0,0x0F,0x01,0x00,0xC0,0x07,0x01,0x00,0xC0,0x07,0x01,0x00,0xC0,0x03,0x01,0x00,0xC0,0x01,0x01,0x80,0xDF,0x60,0x01,0x80,0x50,0x76,0x01,0x80,0x96,0x77,0x01,0xC0,0xF6,0x71,0x01,0x80,0x16,0x62,0x01,0x80,0xD6,0x03,0x01,0x80,0xD6,0x07,0x01,0x80,0xD6,0x07,0x01,0x80,0xD6,0x0F,0x01,0x80,0x16,0x1E,0x01,0xC0,0xF6,0x3E,0x01,0x80,0x16,0x7E,0x01,0x80,0xD0,0xFF,0x01,0x80,0xDF,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0x7F,0x01,0x00,0xC0,0x3F,0x01,0x00,0xC0,0x1F,0x01,0x00,0xC0,0x0F,0x01,0x00,0xC0,0x07,0x01,0x00,0xC0,0x07,0x01,0x00,0xC0,0x03,0x01,0x00,0xC0,0x01,0x01,0x80,0xDF,0x60,0x01,0x80,0x50,0x76,0x01,0x80,0x96,0x77,0x01,0xC0,0xF6,0x71,0x01,0x80,0x16,0x62,0x01,0x80,0xD6,0x03,0x01,0x80,0xD6,0x07,0x01,0x80,0xD6,0x07,0x01,0x80,0xD6,0x0F,0x01,0x80,0x16,0x1E,0x01,0xC0,0xF6,0x3E,0x01,0x80,0x16,0x7E,0x01,0x80,0xD0,0xFF,0x01,0x80,0xDF,0xFF,0x01,
 
 	/* Index 44, character 76 "L" (width: 10 pixels) */
-	0xA, 0xC0,0x07,0x00,0x00,0xE0,0x1F,0x00,0x00,0x10,0x3C,0x00,0x00,0x28,0xAB,0x00,0x00,0xA8,0x70,0x03,0x00,0xA8,0xF1,0x7F,0x00,0x48,0x14,0x7C,0x00,0x90,0x13,0x00,0x00,0x20,0x0C,0x00,0x00,0xC0,0x07,0x00,0x00,
+	0xC0,0x07,0x00,0x00,0xE0,0x1F,0x00,0x00,0x10,0x3C,0x00,0x00,0x28,0xAB,0x00,0x00,0xA8,0x70,0x03,0x00,0xA8,0xF1,0x7F,0x00,0x48,0x14,0x7C,0x00,0x90,0x13,0x00,0x00,0x20,0x0C,0x00,0x00,0xC0,0x07,0x00,0x00,
 
 	/* Index 45, character 77 "M" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xD0,0xFF,0x01,0x00,0xD0,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xF8,0xFF,0x01,0x00,0xF6,0xFF,0x01,0x00,0xF3,0xFF,0x01,0x80,0xE0,0xFF,0x01,0xC0,0x81,0xFF,0x01,0x40,0x81,0xFF,0x01,0x80,0xF1,0xFF,0x01,0x80,0xF1,0xFF,0x01,0x80,0xF3,0xFF,0x01,0x80,0xE3,0xFF,0x01,0x00,0xEB,0xFF,0x01,0x00,0xF6,0xFF,0x01,0x00,0xEC,0xFF,0x01,0x00,0xD8,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xD0,0xFF,0x01,0x00,0xD0,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xF8,0xFF,0x01,0x00,0xF6,0xFF,0x01,0x00,0xF3,0xFF,0x01,0x80,0xE0,0xFF,0x01,0xC0,0x81,0xFF,0x01,0x40,0x81,0xFF,0x01,0x80,0xF1,0xFF,0x01,0x80,0xF1,0xFF,0x01,0x80,0xF3,0xFF,0x01,0x80,0xE3,0xFF,0x01,0x00,0xEB,0xFF,0x01,0x00,0xF6,0xFF,0x01,0x00,0xEC,0xFF,0x01,0x00,0xD8,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 46, character 78 "N" (width: 20 pixels) */
-	0x14, 0x00,0x08,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x77,0x00,0x00,0x80,0xC1,0x00,0x00,0xC0,0x81,0x01,0x00,0xC0,0x9C,0x01,0x00,0x40,0x60,0x01,0x00,0x60,0xD8,0x03,0x00,0xE0,0xB8,0x03,0x00,0xE0,0xB6,0x03,0x00,0xE0,0xBE,0x03,0x00,0xE0,0xBE,0x03,0x00,0xE0,0xDD,0x03,0x00,0x40,0x63,0x01,0x00,0xC0,0xBE,0x01,0x00,0xC0,0x80,0x01,0x00,0x80,0xC1,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x08,0x00,0x00,
+	0x00,0x08,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x77,0x00,0x00,0x80,0xC1,0x00,0x00,0xC0,0x81,0x01,0x00,0xC0,0x9C,0x01,0x00,0x40,0x60,0x01,0x00,0x60,0xD8,0x03,0x00,0xE0,0xB8,0x03,0x00,0xE0,0xB6,0x03,0x00,0xE0,0xBE,0x03,0x00,0xE0,0xBE,0x03,0x00,0xE0,0xDD,0x03,0x00,0x40,0x63,0x01,0x00,0xC0,0xBE,0x01,0x00,0xC0,0x80,0x01,0x00,0x80,0xC1,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x08,0x00,0x00,
 
 	/* Index 47, character 79 "O" (width: 13 pixels) */
-	0xD, 0x00,0x00,0x1F,0x00,0xC0,0x07,0x30,0x00,0x60,0xC0,0x23,0x00,0xD0,0x33,0x22,0x00,0x48,0x35,0x23,0x00,0x28,0x82,0x11,0x00,0x28,0x44,0x0C,0x00,0x28,0x38,0x03,0x00,0x28,0x80,0x00,0x00,0x48,0x48,0x00,0x00,0x90,0x27,0x00,0x00,0x30,0x18,0x00,0x00,0xC0,0x07,0x00,0x00,
+	0x00,0x00,0x1F,0x00,0xC0,0x07,0x30,0x00,0x60,0xC0,0x23,0x00,0xD0,0x33,0x22,0x00,0x48,0x35,0x23,0x00,0x28,0x82,0x11,0x00,0x28,0x44,0x0C,0x00,0x28,0x38,0x03,0x00,0x28,0x80,0x00,0x00,0x48,0x48,0x00,0x00,0x90,0x27,0x00,0x00,0x30,0x18,0x00,0x00,0xC0,0x07,0x00,0x00,
 
 	/* Index 48, character 80 "P" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0x40,0xFE,0x01,0x00,0x40,0xFE,0x01,0x00,0x40,0xFE,0x01,0x00,0xC0,0xFE,0x00,0x00,0xC0,0xFE,0x00,0x00,0xC0,0xFC,0x00,0x00,0xC0,0x7C,0x00,0x00,0xC0,0x7D,0x00,0x00,0xC0,0x7D,0x00,0x00,0xC8,0x3D,0x00,0x00,0xCD,0x3D,0x00,0x80,0xCD,0x19,0x00,0xE0,0xCF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xE0,0xCF,0x01,0x00,0x80,0xCD,0x01,0x00,0x00,0xCD,0x03,0x01,0x00,0xC8,0x83,0x01,0x00,0xC0,0xC7,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0x40,0xFE,0x01,0x00,0x40,0xFE,0x01,0x00,0x40,0xFE,0x01,0x00,0xC0,0xFE,0x00,0x00,0xC0,0xFE,0x00,0x00,0xC0,0xFC,0x00,0x00,0xC0,0x7C,0x00,0x00,0xC0,0x7D,0x00,0x00,0xC0,0x7D,0x00,0x00,0xC8,0x3D,0x00,0x00,0xCD,0x3D,0x00,0x80,0xCD,0x19,0x00,0xE0,0xCF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xE0,0xCF,0x01,0x00,0x80,0xCD,0x01,0x00,0x00,0xCD,0x03,0x01,0x00,0xC8,0x83,0x01,0x00,0xC0,0xC7,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 49, character 81 "Q" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xEF,0x01,0x00,0xC0,0xE3,0x01,0x00,0xC0,0xE0,0x01,0x00,0x30,0xE0,0x01,0x00,0x0C,0xFF,0x01,0x00,0x82,0xFF,0x01,0x00,0x8E,0xFF,0x01,0x00,0x30,0xFF,0x01,0x00,0x50,0xE0,0x01,0x00,0xC8,0xE1,0x01,0x00,0xCD,0xEF,0x01,0x80,0xCD,0xFF,0x01,0xE0,0xCF,0xFF,0x01,0xF0,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0x01,0xE0,0xCF,0xFF,0x01,0x80,0xCD,0xFF,0x01,0x00,0xCD,0xFF,0x01,0x00,0xC8,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xEF,0x01,0x00,0xC0,0xE3,0x01,0x00,0xC0,0xE0,0x01,0x00,0x30,0xE0,0x01,0x00,0x0C,0xFF,0x01,0x00,0x82,0xFF,0x01,0x00,0x8E,0xFF,0x01,0x00,0x30,0xFF,0x01,0x00,0x50,0xE0,0x01,0x00,0xC8,0xE1,0x01,0x00,0xCD,0xEF,0x01,0x80,0xCD,0xFF,0x01,0xE0,0xCF,0xFF,0x01,0xF0,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0x01,0xE0,0xCF,0xFF,0x01,0x80,0xCD,0xFF,0x01,0x00,0xCD,0xFF,0x01,0x00,0xC8,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 50, character 82 "R" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xE0,0x7F,0x01,0x00,0xF0,0x3F,0x01,0x00,0xF0,0x3F,0x01,0x00,0xF8,0x3F,0x01,0x00,0xF8,0xF7,0x01,0x00,0xF8,0xF3,0x01,0x00,0xF0,0x2D,0x01,0x00,0xE0,0x3A,0x01,0x00,0xC0,0x35,0x01,0x00,0x40,0x35,0x01,0x00,0xC0,0x35,0x01,0x00,0x40,0x37,0x01,0x00,0xC0,0x3C,0x01,0x00,0xE0,0x75,0x01,0x00,0xE0,0xF3,0x01,0x00,0xE0,0xB7,0x01,0x00,0xE0,0x3F,0x01,0x00,0xE0,0x3F,0x01,0x00,0xE0,0x3F,0x01,0x00,0xC0,0x7F,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xE0,0x7F,0x01,0x00,0xF0,0x3F,0x01,0x00,0xF0,0x3F,0x01,0x00,0xF8,0x3F,0x01,0x00,0xF8,0xF7,0x01,0x00,0xF8,0xF3,0x01,0x00,0xF0,0x2D,0x01,0x00,0xE0,0x3A,0x01,0x00,0xC0,0x35,0x01,0x00,0x40,0x35,0x01,0x00,0xC0,0x35,0x01,0x00,0x40,0x37,0x01,0x00,0xC0,0x3C,0x01,0x00,0xE0,0x75,0x01,0x00,0xE0,0xF3,0x01,0x00,0xE0,0xB7,0x01,0x00,0xE0,0x3F,0x01,0x00,0xE0,0x3F,0x01,0x00,0xE0,0x3F,0x01,0x00,0xC0,0x7F,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 51, character 83 "S" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0xC0,0x54,0xFF,0x01,0x38,0xFF,0xFE,0x01,0x30,0x52,0xFF,0x01,0x30,0xFE,0xFD,0x01,0xD0,0x52,0xFD,0x01,0x1C,0xF7,0x7F,0x01,0x1C,0x15,0xD8,0x01,0x18,0x15,0xE8,0x01,0xF8,0x95,0xFF,0x01,0x08,0xB5,0xFF,0x01,0x0C,0xB5,0xFF,0x01,0x2A,0xB5,0xFF,0x01,0xC8,0x95,0xFF,0x01,0x38,0x15,0xF8,0x01,0x08,0xF5,0xEF,0x01,0x08,0x05,0xD8,0x01,0x88,0x06,0x78,0x01,0x74,0x52,0xFA,0x00,0xB0,0xFE,0xFF,0x01,0x20,0x52,0xFD,0x01,0x20,0xFF,0xFF,0x01,0xD8,0xD4,0xFF,0x01,0x10,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0xC0,0x54,0xFF,0x01,0x38,0xFF,0xFE,0x01,0x30,0x52,0xFF,0x01,0x30,0xFE,0xFD,0x01,0xD0,0x52,0xFD,0x01,0x1C,0xF7,0x7F,0x01,0x1C,0x15,0xD8,0x01,0x18,0x15,0xE8,0x01,0xF8,0x95,0xFF,0x01,0x08,0xB5,0xFF,0x01,0x0C,0xB5,0xFF,0x01,0x2A,0xB5,0xFF,0x01,0xC8,0x95,0xFF,0x01,0x38,0x15,0xF8,0x01,0x08,0xF5,0xEF,0x01,0x08,0x05,0xD8,0x01,0x88,0x06,0x78,0x01,0x74,0x52,0xFA,0x00,0xB0,0xFE,0xFF,0x01,0x20,0x52,0xFD,0x01,0x20,0xFF,0xFF,0x01,0xD8,0xD4,0xFF,0x01,0x10,0xC0,0xFF,0x01,
 
 	/* Index 52, character 84 "T" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFB,0x01,0x00,0xC0,0xFB,0x01,0x00,0xC0,0xFD,0x01,0xC0,0xC1,0xFD,0x01,0x40,0xC7,0xFF,0x01,0xC0,0xC1,0xF1,0x01,0xE0,0xFF,0xFD,0x01,0xE0,0xFF,0xFC,0x01,0xE0,0xFF,0xFE,0x01,0xA0,0xFF,0xFE,0x01,0xB8,0xFF,0xFE,0x01,0xBC,0xFF,0xFA,0x01,0xFC,0xFE,0xFA,0x01,0xB8,0xFD,0xFA,0x01,0xA0,0xFF,0xFA,0x01,0xB0,0xFB,0xFA,0x01,0xF0,0xFD,0xFB,0x01,0xF0,0x7B,0xFF,0x01,0xC0,0x7F,0xFF,0x01,0x00,0xEC,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFB,0x01,0x00,0xC0,0xFB,0x01,0x00,0xC0,0xFD,0x01,0xC0,0xC1,0xFD,0x01,0x40,0xC7,0xFF,0x01,0xC0,0xC1,0xF1,0x01,0xE0,0xFF,0xFD,0x01,0xE0,0xFF,0xFC,0x01,0xE0,0xFF,0xFE,0x01,0xA0,0xFF,0xFE,0x01,0xB8,0xFF,0xFE,0x01,0xBC,0xFF,0xFA,0x01,0xFC,0xFE,0xFA,0x01,0xB8,0xFD,0xFA,0x01,0xA0,0xFF,0xFA,0x01,0xB0,0xFB,0xFA,0x01,0xF0,0xFD,0xFB,0x01,0xF0,0x7B,0xFF,0x01,0xC0,0x7F,0xFF,0x01,0x00,0xEC,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 53, character 85 "U" (width: 23 pixels) */
-	0x17, 0x00,0xC0,0x01,0x00,0x00,0x40,0x02,0x00,0x00,0xC0,0x01,0x00,0x00,0xE0,0x03,0x00,0x00,0xE0,0x03,0x00,0x00,0xF0,0x07,0x00,0x00,0x90,0x1F,0x00,0x00,0x08,0x71,0x00,0x00,0x08,0x61,0x00,0x00,0x04,0x01,0x00,0x00,0x02,0x01,0x00,0x00,0x02,0x01,0x00,0x80,0x7F,0x02,0x00,0xC0,0x8F,0x02,0x00,0x80,0xFF,0x03,0x00,0x00,0xFF,0x07,0x00,0x00,0xFA,0x03,0x00,0x80,0x84,0x00,0x00,0x20,0x79,0x00,0x00,0x40,0x82,0x01,0x00,0x40,0x7C,0x00,0x00,0x80,0x83,0x01,0x00,0x00,0x7E,0x00,0x00,
+	0x00,0xC0,0x01,0x00,0x00,0x40,0x02,0x00,0x00,0xC0,0x01,0x00,0x00,0xE0,0x03,0x00,0x00,0xE0,0x03,0x00,0x00,0xF0,0x07,0x00,0x00,0x90,0x1F,0x00,0x00,0x08,0x71,0x00,0x00,0x08,0x61,0x00,0x00,0x04,0x01,0x00,0x00,0x02,0x01,0x00,0x00,0x02,0x01,0x00,0x80,0x7F,0x02,0x00,0xC0,0x8F,0x02,0x00,0x80,0xFF,0x03,0x00,0x00,0xFF,0x07,0x00,0x00,0xFA,0x03,0x00,0x80,0x84,0x00,0x00,0x20,0x79,0x00,0x00,0x40,0x82,0x01,0x00,0x40,0x7C,0x00,0x00,0x80,0x83,0x01,0x00,0x00,0x7E,0x00,0x00,
 
 	/* Index 54, character 86 "V" (width: 17 pixels) */
-	0x11, 0x00,0xC0,0x03,0x00,0x00,0x40,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0xE0,0x03,0x00,0x00,0xE0,0x03,0x00,0x00,0xF0,0x07,0x00,0x00,0x90,0x1F,0x00,0x00,0x08,0x79,0x00,0x00,0x08,0x61,0x00,0x00,0x04,0x01,0x00,0x00,0x02,0x01,0x00,0x00,0x02,0x01,0x00,0x80,0x7F,0x02,0x00,0xC0,0x8F,0x02,0x00,0x80,0xFF,0x03,0x00,0x00,0xFF,0x07,0x00,0x00,0xF8,0x03,0x00,
+	0x00,0xC0,0x03,0x00,0x00,0x40,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0xE0,0x03,0x00,0x00,0xE0,0x03,0x00,0x00,0xF0,0x07,0x00,0x00,0x90,0x1F,0x00,0x00,0x08,0x79,0x00,0x00,0x08,0x61,0x00,0x00,0x04,0x01,0x00,0x00,0x02,0x01,0x00,0x00,0x02,0x01,0x00,0x80,0x7F,0x02,0x00,0xC0,0x8F,0x02,0x00,0x80,0xFF,0x03,0x00,0x00,0xFF,0x07,0x00,0x00,0xF8,0x03,0x00,
 
 	/* Index 55, character 87 "W" (width: 9 pixels) */
-	0x9, 0xF0,0xFF,0x1F,0x00,0xE0,0xFF,0x0F,0x00,0xC0,0xFF,0x07,0x00,0x80,0xFF,0x03,0x00,0x00,0xFF,0x01,0x00,0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0x00,
+	0xF0,0xFF,0x1F,0x00,0xE0,0xFF,0x0F,0x00,0xC0,0xFF,0x07,0x00,0x80,0xFF,0x03,0x00,0x00,0xFF,0x01,0x00,0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0x00,
 
 	/* Index 56, character 88 "X" (width: 9 pixels) */
-	0x9, 0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFF,0x01,0x00,0x80,0xFF,0x03,0x00,0xC0,0xFF,0x07,0x00,0xE0,0xFF,0x0F,0x00,0xF0,0xFF,0x1F,0x00,
+	0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFF,0x01,0x00,0x80,0xFF,0x03,0x00,0xC0,0xFF,0x07,0x00,0xE0,0xFF,0x0F,0x00,0xF0,0xFF,0x1F,0x00,
 
 	/* Index 57, character 89 "Y" (width: 18 pixels) */
-	0x12, 0x80,0x0F,0x00,0x00,0xC0,0x3F,0x00,0x00,0xC0,0x7F,0x00,0x00,0xE0,0xFF,0x00,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x3F,0x00,0xE0,0xFF,0x1F,0x00,0xC0,0xFF,0x1F,0x00,0x80,0xFF,0x0F,0x00,0x80,0xFF,0x0F,0x00,0xC0,0xFF,0x07,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x00,0x00,0xC0,0x7F,0x00,0x00,0xC0,0x3F,0x00,0x00,0x80,0x0F,0x00,0x00,
+	0x80,0x0F,0x00,0x00,0xC0,0x3F,0x00,0x00,0xC0,0x7F,0x00,0x00,0xE0,0xFF,0x00,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x3F,0x00,0xE0,0xFF,0x1F,0x00,0xC0,0xFF,0x1F,0x00,0x80,0xFF,0x0F,0x00,0x80,0xFF,0x0F,0x00,0xC0,0xFF,0x07,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x00,0x00,0xC0,0x7F,0x00,0x00,0xC0,0x3F,0x00,0x00,0x80,0x0F,0x00,0x00,
 
 	/* Index 58, character 90 "Z" (width: 15 pixels) */
-	0xF, 0x00,0x00,0x14,0x00,0x00,0x00,0x0C,0x00,0x80,0x00,0x36,0x00,0x80,0x01,0x0A,0x00,0x80,0x03,0x07,0x00,0x80,0x82,0x03,0x00,0x80,0xB3,0x01,0x00,0x70,0x66,0x00,0x00,0xA8,0x6B,0x00,0x00,0x88,0x3D,0x00,0x00,0xC0,0x57,0x00,0x00,0x20,0xBF,0x00,0x00,0xE0,0xAD,0x00,0x00,0xF0,0xC7,0x00,0x00,0x10,0x00,0x00,0x00,
+	0x00,0x00,0x14,0x00,0x00,0x00,0x0C,0x00,0x80,0x00,0x36,0x00,0x80,0x01,0x0A,0x00,0x80,0x03,0x07,0x00,0x80,0x82,0x03,0x00,0x80,0xB3,0x01,0x00,0x70,0x66,0x00,0x00,0xA8,0x6B,0x00,0x00,0x88,0x3D,0x00,0x00,0xC0,0x57,0x00,0x00,0x20,0xBF,0x00,0x00,0xE0,0xAD,0x00,0x00,0xF0,0xC7,0x00,0x00,0x10,0x00,0x00,0x00,
 
 	/* Index 59, character 91 "[" (width: 22 pixels) */
-	0x16, 0x00,0x18,0x00,0x00,0x00,0x7F,0x00,0x00,0x80,0xFF,0x00,0x00,0xC0,0xFF,0x00,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xC0,0xFF,0x07,0x00,0xC0,0xFF,0x07,0x00,0xC0,0xFF,0x07,0x00,0x80,0xFF,0x1F,0x00,0x80,0x7F,0x1B,0x00,0x00,0x1E,0x18,0x00,
+	0x00,0x18,0x00,0x00,0x00,0x7F,0x00,0x00,0x80,0xFF,0x00,0x00,0xC0,0xFF,0x00,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xC0,0xFF,0x07,0x00,0xC0,0xFF,0x07,0x00,0xC0,0xFF,0x07,0x00,0x80,0xFF,0x1F,0x00,0x80,0x7F,0x1B,0x00,0x00,0x1E,0x18,0x00,
 
 	/* Index 60, character 92 "\" (width: 24 pixels) */
-	0x18, 0x02,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0xFE,0x0F,0x00,0x00,0xFE,0x3F,0x00,0x00,0xFE,0xFF,0x00,0x00,0xFE,0xFF,0x03,0x00,0xFE,0xFF,0x0F,0x00,0xFE,0xFF,0x3F,0x00,0xFE,0xFF,0xFF,0x00,0xFC,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0x00,0xFF,0x01,0x00,0x00,0xFC,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x01,
+	0x02,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0xFE,0x0F,0x00,0x00,0xFE,0x3F,0x00,0x00,0xFE,0xFF,0x00,0x00,0xFE,0xFF,0x03,0x00,0xFE,0xFF,0x0F,0x00,0xFE,0xFF,0x3F,0x00,0xFE,0xFF,0xFF,0x00,0xFC,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0x00,0xFF,0x01,0x00,0x00,0xFC,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x01,
 
 	/* Index 61, character 93 "]" (width: 22 pixels) */
-	0x16, 0x00,0x1E,0x18,0x00,0x00,0x3F,0x18,0x00,0x80,0x7F,0x1B,0x00,0xC0,0xFF,0x1F,0x00,0xC0,0xFF,0x07,0x00,0xC0,0xFF,0x07,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xC0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xC0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x18,0x00,0x00,
+	0x00,0x1E,0x18,0x00,0x00,0x3F,0x18,0x00,0x80,0x7F,0x1B,0x00,0xC0,0xFF,0x1F,0x00,0xC0,0xFF,0x07,0x00,0xC0,0xFF,0x07,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xC0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xC0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x18,0x00,0x00,
 
 	/* Index 62, character 94 "^" (width: 23 pixels) */
-	0x17, 0x00,0xF0,0x10,0x00,0x00,0xF8,0x19,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFE,0x07,0x00,0x00,0xFE,0x07,0x00,0x00,0xFE,0x07,0x00,0x00,0xFE,0x07,0x00,0x00,0xFE,0x07,0x00,0xC0,0xFD,0x03,0x00,0xE0,0xFD,0x03,0x00,0xF0,0xFB,0x01,0x00,0xF0,0xF7,0x00,0x00,0xF8,0x0F,0x00,0x00,0xF8,0x1F,0x00,0x00,0xF8,0x1F,0x00,0x00,0xF8,0x1F,0x00,0x00,0xF8,0x1F,0x00,0x00,0xF8,0x3F,0x00,0x00,0xF0,0x7F,0x00,0x00,0xF0,0x4F,0x00,0x00,0xE0,0x07,0x00,0x00,0xC0,0x03,0x00,0x00,
+	0x00,0xF0,0x10,0x00,0x00,0xF8,0x19,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFC,0x0F,0x00,0x00,0xFE,0x07,0x00,0x00,0xFE,0x07,0x00,0x00,0xFE,0x07,0x00,0x00,0xFE,0x07,0x00,0x00,0xFE,0x07,0x00,0xC0,0xFD,0x03,0x00,0xE0,0xFD,0x03,0x00,0xF0,0xFB,0x01,0x00,0xF0,0xF7,0x00,0x00,0xF8,0x0F,0x00,0x00,0xF8,0x1F,0x00,0x00,0xF8,0x1F,0x00,0x00,0xF8,0x1F,0x00,0x00,0xF8,0x1F,0x00,0x00,0xF8,0x3F,0x00,0x00,0xF0,0x7F,0x00,0x00,0xF0,0x4F,0x00,0x00,0xE0,0x07,0x00,0x00,0xC0,0x03,0x00,0x00,
 
 	/* Index 63, character 95 "_" (width: 23 pixels) */
-	0x17, 0x00,0x3C,0x08,0x00,0x00,0x7E,0x0C,0x00,0x00,0xFF,0x0F,0x00,0x00,0xFF,0x07,0x00,0x80,0xFF,0x01,0x00,0x80,0xFF,0x05,0x00,0x80,0xFF,0x05,0x00,0x80,0xFF,0x0D,0x00,0x80,0xFF,0x0D,0x00,0x60,0xFF,0x1C,0x00,0x70,0xFF,0x1E,0x00,0xF8,0x7E,0x9E,0x00,0xF8,0x3D,0xFF,0x00,0xFC,0x83,0x7F,0x00,0xFC,0xE7,0x3F,0x00,0xFC,0xEF,0x1F,0x00,0xFC,0xEF,0x1F,0x00,0xFC,0xEF,0x0F,0x00,0xFC,0xDF,0x0F,0x00,0xF8,0xFF,0x07,0x00,0xF8,0xB7,0x03,0x00,0xF0,0x03,0x00,0x00,0xE0,0x01,0x00,0x00,
+	0x00,0x3C,0x08,0x00,0x00,0x7E,0x0C,0x00,0x00,0xFF,0x0F,0x00,0x00,0xFF,0x07,0x00,0x80,0xFF,0x01,0x00,0x80,0xFF,0x05,0x00,0x80,0xFF,0x05,0x00,0x80,0xFF,0x0D,0x00,0x80,0xFF,0x0D,0x00,0x60,0xFF,0x1C,0x00,0x70,0xFF,0x1E,0x00,0xF8,0x7E,0x9E,0x00,0xF8,0x3D,0xFF,0x00,0xFC,0x83,0x7F,0x00,0xFC,0xE7,0x3F,0x00,0xFC,0xEF,0x1F,0x00,0xFC,0xEF,0x1F,0x00,0xFC,0xEF,0x0F,0x00,0xFC,0xDF,0x0F,0x00,0xF8,0xFF,0x07,0x00,0xF8,0xB7,0x03,0x00,0xF0,0x03,0x00,0x00,0xE0,0x01,0x00,0x00,
 
 	/* Index 64, character 96 "`" (width: 20 pixels) */
-	0x14, 0x00,0x08,0x00,0x00,0x80,0xDF,0x03,0x00,0x40,0x08,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x00,0x00,0x0E,0x00,0x40,0x00,0x04,0x00,0xE0,0x00,0x00,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x10,0x04,0x00,0x80,0xFB,0x03,0x00,0x00,0x10,0x00,0x00,
+	0x00,0x08,0x00,0x00,0x80,0xDF,0x03,0x00,0x40,0x08,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x00,0x00,0x0E,0x00,0x40,0x00,0x04,0x00,0xE0,0x00,0x00,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x00,0x04,0x00,0x40,0x10,0x04,0x00,0x80,0xFB,0x03,0x00,0x00,0x10,0x00,0x00,
 
 	/* Index 65, character 97 "a" (width: 11 pixels) */
-	0xB, 0x00,0xFC,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xF0,0x03,0x00,0x00,0xE0,0x07,0x00,0x00,0xE0,0x07,0x00,0x00,0xF0,0x03,0x00,0x00,0xF8,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x3F,0x00,0x00,0x80,0x1F,0x00,0x00,
+	0x00,0xFC,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xF0,0x03,0x00,0x00,0xE0,0x07,0x00,0x00,0xE0,0x07,0x00,0x00,0xF0,0x03,0x00,0x00,0xF8,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x3F,0x00,0x00,0x80,0x1F,0x00,0x00,
 
 	/* Index 66, character 98 "b" (width: 18 pixels) */
-	0x12, 0x00,0xC0,0x03,0x00,0x00,0x20,0x04,0x00,0x00,0x10,0x08,0x00,0x00,0x10,0x08,0x00,0x00,0xF0,0x08,0x00,0x00,0x99,0x08,0x00,0x00,0x27,0x05,0x00,0x00,0xDC,0x03,0x00,0x00,0x64,0x01,0x00,0x00,0x84,0x01,0x00,0x00,0xC4,0x03,0x00,0x00,0x37,0x04,0x00,0x00,0x79,0x08,0x00,0x00,0x91,0x08,0x00,0x00,0x10,0x08,0x00,0x00,0x10,0x08,0x00,0x00,0x20,0x04,0x00,0x00,0xC0,0x03,0x00,
+	0x00,0xC0,0x03,0x00,0x00,0x20,0x04,0x00,0x00,0x10,0x08,0x00,0x00,0x10,0x08,0x00,0x00,0xF0,0x08,0x00,0x00,0x99,0x08,0x00,0x00,0x27,0x05,0x00,0x00,0xDC,0x03,0x00,0x00,0x64,0x01,0x00,0x00,0x84,0x01,0x00,0x00,0xC4,0x03,0x00,0x00,0x37,0x04,0x00,0x00,0x79,0x08,0x00,0x00,0x91,0x08,0x00,0x00,0x10,0x08,0x00,0x00,0x10,0x08,0x00,0x00,0x20,0x04,0x00,0x00,0xC0,0x03,0x00,
 
 	/* Index 67, character 99 "c" (width: 24 pixels) */
-	0x18, 0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,
+	0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0x06,0x00,0x80,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,
 
 	/* Index 68, character 100 "d" (width: 16 pixels) */
-	0x10, 0x80,0x3F,0x00,0x00,0xC0,0xFF,0x01,0x00,0xE0,0xFF,0x03,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x1F,0x00,0xC0,0xFF,0x3F,0x00,0xE0,0xFF,0x3F,0x00,0xE0,0xFF,0x3F,0x00,0xC0,0xFF,0x3F,0x00,0xC0,0xFF,0x1F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xE0,0xFF,0x03,0x00,0xC0,0xFF,0x01,0x00,0x80,0x3F,0x00,0x00,
+	0x80,0x3F,0x00,0x00,0xC0,0xFF,0x01,0x00,0xE0,0xFF,0x03,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x1F,0x00,0xC0,0xFF,0x3F,0x00,0xE0,0xFF,0x3F,0x00,0xE0,0xFF,0x3F,0x00,0xC0,0xFF,0x3F,0x00,0xC0,0xFF,0x1F,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0xE0,0xFF,0x03,0x00,0xC0,0xFF,0x01,0x00,0x80,0x3F,0x00,0x00,
 
 	/* Index 69, character 101 "e" (width: 17 pixels) */
-	0x11, 0x80,0xFF,0x0F,0x00,0x80,0xFF,0x0F,0x00,0xE0,0xFF,0x0F,0x00,0xE0,0xFF,0x0F,0x00,0xE0,0xFF,0x0F,0x00,0xF8,0xFF,0x0F,0x00,0xC8,0xFF,0x0F,0x00,0x98,0xFF,0x0F,0x00,0xA0,0x00,0x00,0x00,0xD8,0xFF,0x0F,0x00,0xE8,0xFF,0x0F,0x00,0xF8,0xFF,0x0F,0x00,0xF0,0xFF,0x0F,0x00,0xD0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0x80,0xFF,0x0F,0x00,0x80,0xFF,0x0F,0x00,
+	0x80,0xFF,0x0F,0x00,0x80,0xFF,0x0F,0x00,0xE0,0xFF,0x0F,0x00,0xE0,0xFF,0x0F,0x00,0xE0,0xFF,0x0F,0x00,0xF8,0xFF,0x0F,0x00,0xC8,0xFF,0x0F,0x00,0x98,0xFF,0x0F,0x00,0xA0,0x00,0x00,0x00,0xD8,0xFF,0x0F,0x00,0xE8,0xFF,0x0F,0x00,0xF8,0xFF,0x0F,0x00,0xF0,0xFF,0x0F,0x00,0xD0,0xFF,0x0F,0x00,0xC0,0xFF,0x0F,0x00,0x80,0xFF,0x0F,0x00,0x80,0xFF,0x0F,0x00,
 
 	/* Index 70, character 102 "f" (width: 17 pixels) */
-	0x11, 0x48,0x0F,0x00,0x00,0x50,0x00,0x01,0x00,0xC4,0xFF,0x02,0x00,0x88,0x70,0x0F,0x00,0xC0,0x70,0x0F,0x00,0x88,0xF0,0x0A,0x00,0xE0,0xB0,0x06,0x00,0xC0,0xB0,0x02,0x00,0xC0,0xBF,0x02,0x00,0xC0,0xB0,0x06,0x00,0xE0,0xF0,0x0A,0x00,0x88,0x70,0x0F,0x00,0xC0,0x70,0x0F,0x00,0x88,0xFF,0x02,0x00,0x54,0x00,0x01,0x00,0x50,0x0F,0x00,0x00,0x48,0x00,0x00,0x00,
+	0x48,0x0F,0x00,0x00,0x50,0x00,0x01,0x00,0xC4,0xFF,0x02,0x00,0x88,0x70,0x0F,0x00,0xC0,0x70,0x0F,0x00,0x88,0xF0,0x0A,0x00,0xE0,0xB0,0x06,0x00,0xC0,0xB0,0x02,0x00,0xC0,0xBF,0x02,0x00,0xC0,0xB0,0x06,0x00,0xE0,0xF0,0x0A,0x00,0x88,0x70,0x0F,0x00,0xC0,0x70,0x0F,0x00,0x88,0xFF,0x02,0x00,0x54,0x00,0x01,0x00,0x50,0x0F,0x00,0x00,0x48,0x00,0x00,0x00,
 
 	/* Index 71, character 103 "g" (width: 24 pixels) */
-	0x18, 0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,
+	0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,
 
 	/* Index 72, character 104 "h" (width: 20 pixels) */
-	0x14, 0x00,0xF8,0x07,0x00,0x00,0x7E,0x07,0x00,0x80,0xB9,0x0F,0x00,0x80,0xB8,0x0F,0x00,0x80,0x78,0x07,0x00,0xC0,0xFF,0x07,0x00,0xC0,0xFF,0x07,0x00,0xD0,0xFF,0x07,0x00,0xD0,0xFF,0x07,0x00,0xC0,0xF1,0x07,0x00,0xC0,0xF1,0x07,0x00,0x40,0xC0,0x07,0x00,0x40,0xC0,0x07,0x00,0x40,0xC0,0x07,0x00,0xC0,0x71,0x00,0x00,0xC0,0x31,0x07,0x00,0xC0,0xBF,0x0F,0x00,0xC0,0xBF,0x0F,0x00,0xC0,0x7F,0x07,0x00,0xC0,0xFF,0x07,0x00,
+	0x00,0xF8,0x07,0x00,0x00,0x7E,0x07,0x00,0x80,0xB9,0x0F,0x00,0x80,0xB8,0x0F,0x00,0x80,0x78,0x07,0x00,0xC0,0xFF,0x07,0x00,0xC0,0xFF,0x07,0x00,0xD0,0xFF,0x07,0x00,0xD0,0xFF,0x07,0x00,0xC0,0xF1,0x07,0x00,0xC0,0xF1,0x07,0x00,0x40,0xC0,0x07,0x00,0x40,0xC0,0x07,0x00,0x40,0xC0,0x07,0x00,0xC0,0x71,0x00,0x00,0xC0,0x31,0x07,0x00,0xC0,0xBF,0x0F,0x00,0xC0,0xBF,0x0F,0x00,0xC0,0x7F,0x07,0x00,0xC0,0xFF,0x07,0x00,
 
 	/* Index 73, character 105 "i" (width: 20 pixels) */
-	0x14, 0x00,0x7E,0x00,0x00,0x80,0xFF,0x01,0x00,0xE0,0x81,0x07,0x00,0x70,0x00,0x0E,0x00,0x30,0x00,0x0C,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x0C,0x00,0x30,0x00,0xEC,0xFC,0x37,0x00,0xEC,0xFD,0x37,0x00,0xCC,0xFC,0x37,0x00,0x0C,0x00,0x30,0x00,0x0C,0x00,0x30,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x30,0x00,0x0C,0x00,0x70,0x00,0x0E,0x00,0xE0,0x81,0x07,0x00,0x80,0xFF,0x01,0x00,0x00,0x7E,0x00,0x00,
+	0x00,0x7E,0x00,0x00,0x80,0xFF,0x01,0x00,0xE0,0x81,0x07,0x00,0x70,0x00,0x0E,0x00,0x30,0x00,0x0C,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x0C,0x00,0x30,0x00,0xEC,0xFC,0x37,0x00,0xEC,0xFD,0x37,0x00,0xCC,0xFC,0x37,0x00,0x0C,0x00,0x30,0x00,0x0C,0x00,0x30,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x30,0x00,0x0C,0x00,0x70,0x00,0x0E,0x00,0xE0,0x81,0x07,0x00,0x80,0xFF,0x01,0x00,0x00,0x7E,0x00,0x00,
 
 	/* Index 74, character 106 "j" (width: 20 pixels) */
-	0x14, 0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x5E,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x00,0x00,
+	0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x6C,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x5E,0x00,0x00,0x00,0x47,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x00,0x00,
 
 	/* Index 75, character 107 "k" (width: 20 pixels) */
-	0x14, 0x00,0x20,0x00,0x00,0x00,0x20,0x04,0x00,0x00,0x10,0x06,0x00,0x00,0x08,0x07,0x00,0x00,0x88,0x07,0x00,0x00,0x94,0x03,0x00,0x80,0xD9,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFC,0x03,0x00,0x80,0xFE,0x03,0x00,0x80,0xF6,0x0F,0x00,0x40,0xF8,0x0F,0x00,0x20,0xFC,0x0E,0x00,0x20,0x6C,0x07,0x00,0x00,0x1E,0x03,0x00,0x00,0x1E,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x01,0x00,0x00,
+	0x00,0x20,0x00,0x00,0x00,0x20,0x04,0x00,0x00,0x10,0x06,0x00,0x00,0x08,0x07,0x00,0x00,0x88,0x07,0x00,0x00,0x94,0x03,0x00,0x80,0xD9,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xFC,0x03,0x00,0x80,0xFE,0x03,0x00,0x80,0xF6,0x0F,0x00,0x40,0xF8,0x0F,0x00,0x20,0xFC,0x0E,0x00,0x20,0x6C,0x07,0x00,0x00,0x1E,0x03,0x00,0x00,0x1E,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x01,0x00,0x00,
 
 	/* Index 76, character 108 "l" (width: 18 pixels) */
-	0x12, 0x00,0x10,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0xFF,0x01,0x00,0xF8,0x3F,0x1E,0x00,0xF0,0xF8,0x0F,0x00,0x00,0xFF,0x00,0x00,0x00,0x2C,0x00,0x00,0x00,0x2C,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x10,0x00,0x00,
+	0x00,0x10,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0xFF,0x01,0x00,0xF8,0x3F,0x1E,0x00,0xF0,0xF8,0x0F,0x00,0x00,0xFF,0x00,0x00,0x00,0x2C,0x00,0x00,0x00,0x2C,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x10,0x00,0x00,
 
 	/* Index 77, character 109 "m" (width: 6 pixels) */
-	0x6, 0xC0,0x07,0xC0,0x00,0xEA,0x3F,0xC0,0x00,0x4B,0xFF,0xC9,0x00,0x8A,0xFF,0xC9,0x00,0xE0,0x1F,0xC0,0x00,0xC0,0x01,0xC0,0x00,
+	0xC0,0x07,0xC0,0x00,0xEA,0x3F,0xC0,0x00,0x4B,0xFF,0xC9,0x00,0x8A,0xFF,0xC9,0x00,0xE0,0x1F,0xC0,0x00,0xC0,0x01,0xC0,0x00,
 
 	/* Index 78, character 110 "n" (width: 24 pixels) */
-	0x18, 0x00,0xFE,0x01,0x00,0x80,0xFF,0x07,0x00,0xC0,0xFF,0x0F,0x00,0xE0,0xFF,0x1F,0x00,0xF0,0xFF,0x3F,0x00,0xF8,0xFF,0x7F,0x00,0xFC,0xFF,0xFF,0x00,0xFC,0xFF,0xFF,0x00,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFC,0xFF,0xFF,0x00,0xFC,0xFF,0xFF,0x00,0xF8,0xFF,0x7F,0x00,0xF0,0xFF,0x3F,0x00,0xE0,0xFF,0x1F,0x00,0xC0,0xFF,0x0F,0x00,0x80,0xFF,0x07,0x00,0x00,0xFE,0x01,0x00,
+	0x00,0xFE,0x01,0x00,0x80,0xFF,0x07,0x00,0xC0,0xFF,0x0F,0x00,0xE0,0xFF,0x1F,0x00,0xF0,0xFF,0x3F,0x00,0xF8,0xFF,0x7F,0x00,0xFC,0xFF,0xFF,0x00,0xFC,0xFF,0xFF,0x00,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,0xFC,0xFF,0xFF,0x00,0xFC,0xFF,0xFF,0x00,0xF8,0xFF,0x7F,0x00,0xF0,0xFF,0x3F,0x00,0xE0,0xFF,0x1F,0x00,0xC0,0xFF,0x0F,0x00,0x80,0xFF,0x07,0x00,0x00,0xFE,0x01,0x00,
 
 	/* Index 79, character 111 "o" (width: 20 pixels) */
-	0x14, 0x00,0x00,0x08,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x80,0x0F,0x00,0x00,0x80,0x0F,0x00,0x00,0xA0,0x0E,0x00,0x00,0xC0,0x0E,0x00,0x00,0x80,0x0E,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x04,0x00,
+	0x00,0x00,0x08,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x80,0x0F,0x00,0x00,0x80,0x0F,0x00,0x00,0xA0,0x0E,0x00,0x00,0xC0,0x0E,0x00,0x00,0x80,0x0E,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x04,0x00,
 
 	/* Index 80, character 112 "p" (width: 19 pixels) */
-	0x13, 0x22,0x00,0x00,0x00,0x24,0x08,0x01,0x00,0x00,0xFC,0x02,0x00,0x23,0x32,0x0F,0x00,0x54,0x31,0x0F,0x00,0x50,0xF1,0x04,0x00,0x50,0xB1,0x02,0x00,0x73,0xB1,0x02,0x00,0x70,0xB1,0x02,0x00,0x70,0xB1,0x02,0x00,0x70,0xB1,0x02,0x00,0x73,0xB1,0x02,0x00,0x50,0xB1,0x06,0x00,0x50,0xF1,0x04,0x00,0x72,0x31,0x0F,0x00,0x01,0x3E,0x0F,0x00,0x04,0xF0,0x03,0x00,0x24,0x08,0x00,0x00,0x22,0x00,0x00,0x00,
+	0x22,0x00,0x00,0x00,0x24,0x08,0x01,0x00,0x00,0xFC,0x02,0x00,0x23,0x32,0x0F,0x00,0x54,0x31,0x0F,0x00,0x50,0xF1,0x04,0x00,0x50,0xB1,0x02,0x00,0x73,0xB1,0x02,0x00,0x70,0xB1,0x02,0x00,0x70,0xB1,0x02,0x00,0x70,0xB1,0x02,0x00,0x73,0xB1,0x02,0x00,0x50,0xB1,0x06,0x00,0x50,0xF1,0x04,0x00,0x72,0x31,0x0F,0x00,0x01,0x3E,0x0F,0x00,0x04,0xF0,0x03,0x00,0x24,0x08,0x00,0x00,0x22,0x00,0x00,0x00,
 
 	/* Index 81, character 113 "q" (width: 15 pixels) */
-	0xF, 0x00,0x7E,0x00,0x00,0xA0,0xFF,0x01,0x00,0xE0,0xC1,0x03,0x00,0x70,0x80,0x07,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0xE0,0x01,0x0E,0x00,0xC0,0x83,0x07,0x00,0x80,0xFF,0x05,0x00,0x00,0x7E,0x00,0x00,
+	0x00,0x7E,0x00,0x00,0xA0,0xFF,0x01,0x00,0xE0,0xC1,0x03,0x00,0x70,0x80,0x07,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0xE0,0x01,0x0E,0x00,0xC0,0x83,0x07,0x00,0x80,0xFF,0x05,0x00,0x00,0x7E,0x00,0x00,
 
 	/* Index 82, character 114 "r" (width: 16 pixels) */
-	0x10, 0xE0,0x00,0x1C,0x00,0xE0,0x01,0x1E,0x00,0xC0,0x03,0x1F,0x00,0x80,0x87,0x0F,0x00,0x00,0xCF,0x07,0x00,0x00,0xFE,0x03,0x00,0x00,0xFC,0x01,0x00,0x00,0xF8,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xDF,0x03,0x00,0x80,0x8F,0x07,0x00,0xC0,0x07,0x0F,0x00,0xE0,0x03,0x1E,0x00,0xE0,0x01,0x1C,0x00,0xE0,0x00,0x18,0x00,
+	0xE0,0x00,0x1C,0x00,0xE0,0x01,0x1E,0x00,0xC0,0x03,0x1F,0x00,0x80,0x87,0x0F,0x00,0x00,0xCF,0x07,0x00,0x00,0xFE,0x03,0x00,0x00,0xFC,0x01,0x00,0x00,0xF8,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xDF,0x03,0x00,0x80,0x8F,0x07,0x00,0xC0,0x07,0x0F,0x00,0xE0,0x03,0x1E,0x00,0xE0,0x01,0x1C,0x00,0xE0,0x00,0x18,0x00,
 
 	/* Index 83, character 115 "s" (width: 14 pixels) */
-	0xE, 0xC0,0x01,0x00,0x00,0xE0,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0xF8,0xF1,0x38,0x00,0x38,0xF8,0x7C,0x00,0x18,0xFC,0x7C,0x00,0x18,0xFE,0x7C,0x00,0x38,0xFE,0x38,0x00,0xF8,0x0F,0x00,0x00,0xF0,0x07,0x00,0x00,0xF0,0x07,0x00,0x00,0xE0,0x03,0x00,0x00,0xC0,0x01,0x00,0x00,
+	0xC0,0x01,0x00,0x00,0xE0,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0xF8,0xF1,0x38,0x00,0x38,0xF8,0x7C,0x00,0x18,0xFC,0x7C,0x00,0x18,0xFE,0x7C,0x00,0x38,0xFE,0x38,0x00,0xF8,0x0F,0x00,0x00,0xF0,0x07,0x00,0x00,0xF0,0x07,0x00,0x00,0xE0,0x03,0x00,0x00,0xC0,0x01,0x00,0x00,
 
 	/* Index 84, character 116 "t" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xBF,0x01,0x00,0xFE,0xFF,0x01,0x00,0xB9,0xDB,0x01,0x80,0x18,0xF9,0x01,0x80,0xFE,0xFA,0x01,0xC0,0xFF,0xEE,0x01,0xC0,0x74,0xF9,0x01,0x80,0x00,0xF9,0x01,0x80,0xFF,0xF9,0x01,0x80,0xF7,0xFD,0x01,0x00,0x77,0xFB,0x01,0x00,0x7F,0xFD,0x01,0x00,0x7F,0xFF,0x01,0x00,0x7D,0xFF,0x01,0x00,0x7E,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0x78,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xBF,0x01,0x00,0xFE,0xFF,0x01,0x00,0xB9,0xDB,0x01,0x80,0x18,0xF9,0x01,0x80,0xFE,0xFA,0x01,0xC0,0xFF,0xEE,0x01,0xC0,0x74,0xF9,0x01,0x80,0x00,0xF9,0x01,0x80,0xFF,0xF9,0x01,0x80,0xF7,0xFD,0x01,0x00,0x77,0xFB,0x01,0x00,0x7F,0xFD,0x01,0x00,0x7F,0xFF,0x01,0x00,0x7D,0xFF,0x01,0x00,0x7E,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0x78,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xE0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 85, character 117 "u" (width: 24 pixels) */
-	0x18, 0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0xFF,0xFF,0x01,0xC0,0x03,0xFF,0x01,0xE0,0x40,0xFC,0x01,0x60,0xC0,0xF9,0x01,0x30,0xC0,0xF3,0x01,0xB0,0xDF,0xF7,0x01,0xD8,0xF4,0xE7,0x01,0xD8,0xDC,0xEF,0x01,0xD8,0xDC,0xEF,0x01,0xD8,0xDF,0xEF,0x01,0xD8,0xDC,0xEF,0x01,0xD8,0xF4,0xE7,0x01,0xB0,0xDF,0xF7,0x01,0x30,0xC0,0xF3,0x01,0x60,0xC0,0xF9,0x01,0xE0,0x40,0xFC,0x01,0xC0,0x03,0xFF,0x01,0x00,0xFF,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
+	0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0xFF,0xFF,0x01,0xC0,0x03,0xFF,0x01,0xE0,0x40,0xFC,0x01,0x60,0xC0,0xF9,0x01,0x30,0xC0,0xF3,0x01,0xB0,0xDF,0xF7,0x01,0xD8,0xF4,0xE7,0x01,0xD8,0xDC,0xEF,0x01,0xD8,0xDC,0xEF,0x01,0xD8,0xDF,0xEF,0x01,0xD8,0xDC,0xEF,0x01,0xD8,0xF4,0xE7,0x01,0xB0,0xDF,0xF7,0x01,0x30,0xC0,0xF3,0x01,0x60,0xC0,0xF9,0x01,0xE0,0x40,0xFC,0x01,0xC0,0x03,0xFF,0x01,0x00,0xFF,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0xC0,0xFF,0x01,0x00,0xC0,0xFF,0x01,
 
 	/* Index 86, character 118 "v" (width: 14 pixels) */
-	0xE, 0xC0,0xFF,0x03,0x00,0xC0,0x70,0x0E,0x00,0xE0,0x70,0x0F,0x00,0xE0,0xB0,0x02,0x00,0xE0,0xB0,0x02,0x00,0xE0,0xB0,0x02,0x00,0xE0,0xB0,0x02,0x00,0xE0,0xBF,0x02,0x00,0xE0,0xB0,0x02,0x00,0xE0,0xB0,0x02,0x00,0xE0,0xF0,0x0F,0x00,0xE0,0x70,0x0E,0x00,0xC0,0x70,0x0E,0x00,0xC0,0xFF,0x03,0x00,
+	0xC0,0xFF,0x03,0x00,0xC0,0x70,0x0E,0x00,0xE0,0x70,0x0F,0x00,0xE0,0xB0,0x02,0x00,0xE0,0xB0,0x02,0x00,0xE0,0xB0,0x02,0x00,0xE0,0xB0,0x02,0x00,0xE0,0xBF,0x02,0x00,0xE0,0xB0,0x02,0x00,0xE0,0xB0,0x02,0x00,0xE0,0xF0,0x0F,0x00,0xE0,0x70,0x0E,0x00,0xC0,0x70,0x0E,0x00,0xC0,0xFF,0x03,0x00,
 
 	/* Index 87, character 119 "w" (width: 7 pixels) */
-	0x7, 0x00,0x00,0x08,0x00,0xF8,0x01,0x1C,0x00,0x20,0xFE,0x18,0x00,0x20,0x01,0x17,0x00,0xA0,0x00,0x1C,0x00,0x60,0x00,0x1C,0x00,0x20,0x00,0x08,0x00,
+	0x00,0x00,0x08,0x00,0xF8,0x01,0x1C,0x00,0x20,0xFE,0x18,0x00,0x20,0x01,0x17,0x00,0xA0,0x00,0x1C,0x00,0x60,0x00,0x1C,0x00,0x20,0x00,0x08,0x00,
 
 	/* Index 88, character 120 "x" (width: 20 pixels) */
-	0x14, 0x00,0xFC,0x00,0x00,0x00,0xFF,0x03,0x00,0xC0,0x03,0x0F,0x00,0xE0,0x01,0x1C,0x00,0xE0,0x00,0x18,0x00,0xB0,0x01,0x38,0x00,0x30,0x03,0x30,0x00,0x18,0x06,0x60,0x00,0x18,0x0C,0x60,0x00,0x18,0x18,0x60,0x00,0x18,0x30,0x60,0x00,0x18,0x60,0x60,0x00,0x18,0xC0,0x60,0x00,0x30,0x80,0x31,0x00,0x30,0x00,0x33,0x00,0x60,0x00,0x1E,0x00,0xE0,0x00,0x1C,0x00,0xC0,0x03,0x0F,0x00,0x00,0xFF,0x03,0x00,0x00,0xFC,0x00,0x00,
+	0x00,0xFC,0x00,0x00,0x00,0xFF,0x03,0x00,0xC0,0x03,0x0F,0x00,0xE0,0x01,0x1C,0x00,0xE0,0x00,0x18,0x00,0xB0,0x01,0x38,0x00,0x30,0x03,0x30,0x00,0x18,0x06,0x60,0x00,0x18,0x0C,0x60,0x00,0x18,0x18,0x60,0x00,0x18,0x30,0x60,0x00,0x18,0x60,0x60,0x00,0x18,0xC0,0x60,0x00,0x30,0x80,0x31,0x00,0x30,0x00,0x33,0x00,0x60,0x00,0x1E,0x00,0xE0,0x00,0x1C,0x00,0xC0,0x03,0x0F,0x00,0x00,0xFF,0x03,0x00,0x00,0xFC,0x00,0x00,
 
 	/* Index 89, character 121 "y" (width: 20 pixels) */
-	0x14, 0x00,0xFC,0x00,0x00,0x00,0xFF,0x03,0x00,0xC0,0x33,0x0F,0x00,0xE0,0x30,0x1C,0x00,0x60,0x30,0x18,0x00,0x30,0x30,0x30,0x00,0x30,0x30,0x30,0x00,0x18,0x30,0x60,0x00,0x18,0x30,0x60,0x00,0x18,0x30,0x60,0x00,0x18,0x30,0x60,0x00,0x18,0x30,0x60,0x00,0x18,0x30,0x60,0x00,0x30,0x30,0x30,0x00,0x30,0x30,0x30,0x00,0x60,0x30,0x18,0x00,0xE0,0x30,0x1C,0x00,0xC0,0x33,0x0F,0x00,0x00,0xFF,0x03,0x00,0x00,0xFC,0x00,0x00,
+	0x00,0xFC,0x00,0x00,0x00,0xFF,0x03,0x00,0xC0,0x33,0x0F,0x00,0xE0,0x30,0x1C,0x00,0x60,0x30,0x18,0x00,0x30,0x30,0x30,0x00,0x30,0x30,0x30,0x00,0x18,0x30,0x60,0x00,0x18,0x30,0x60,0x00,0x18,0x30,0x60,0x00,0x18,0x30,0x60,0x00,0x18,0x30,0x60,0x00,0x18,0x30,0x60,0x00,0x30,0x30,0x30,0x00,0x30,0x30,0x30,0x00,0x60,0x30,0x18,0x00,0xE0,0x30,0x1C,0x00,0xC0,0x33,0x0F,0x00,0x00,0xFF,0x03,0x00,0x00,0xFC,0x00,0x00,
 
 	/* Index 90, character 122 "z" (width: 20 pixels) */
-	0x14, 0x00,0xFC,0x00,0x00,0x00,0xFF,0x03,0x00,0xC0,0x03,0x0F,0x00,0xE0,0x01,0x1E,0x00,0xE0,0xF8,0x1C,0x00,0xF0,0xC9,0x38,0x00,0x30,0xCB,0x30,0x00,0x38,0xCE,0x70,0x00,0x18,0xCC,0x60,0x00,0x18,0xD8,0x60,0x00,0x98,0xF8,0x60,0x00,0x98,0xE4,0x60,0x00,0x18,0xC7,0x60,0x00,0x30,0xC0,0x21,0x00,0x30,0xC0,0x33,0x00,0x60,0xC0,0x1E,0x00,0xE0,0x00,0x1C,0x00,0xC0,0x03,0x0F,0x00,0x00,0xFF,0x03,0x00,0x00,0xFC,0x00,0x00,
+	0x00,0xFC,0x00,0x00,0x00,0xFF,0x03,0x00,0xC0,0x03,0x0F,0x00,0xE0,0x01,0x1E,0x00,0xE0,0xF8,0x1C,0x00,0xF0,0xC9,0x38,0x00,0x30,0xCB,0x30,0x00,0x38,0xCE,0x70,0x00,0x18,0xCC,0x60,0x00,0x18,0xD8,0x60,0x00,0x98,0xF8,0x60,0x00,0x98,0xE4,0x60,0x00,0x18,0xC7,0x60,0x00,0x30,0xC0,0x21,0x00,0x30,0xC0,0x33,0x00,0x60,0xC0,0x1E,0x00,0xE0,0x00,0x1C,0x00,0xC0,0x03,0x0F,0x00,0x00,0xFF,0x03,0x00,0x00,0xFC,0x00,0x00,
 
 	/* Index 91, character 123 "{" (width: 24 pixels) */
-	0x18, 0x00,0x88,0x00,0x00,0xC0,0xD8,0x00,0x00,0xC0,0xFD,0x00,0x00,0x80,0xFF,0x03,0x00,0x80,0xFF,0x03,0x00,0xF8,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x03,0x00,0xF0,0xFF,0x03,0x00,0xF8,0xFF,0x0F,0x00,0xF0,0xFF,0x07,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x07,0x00,0xF8,0xFF,0x07,0x00,0xF0,0xFF,0x03,0x00,0xC0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x07,0x00,0x20,0xFF,0x0F,0x00,0x00,0xFF,0x0C,0x00,0x80,0xDC,0x08,0x00,0x00,0x88,0x10,0x00,
+	0x00,0x88,0x00,0x00,0xC0,0xD8,0x00,0x00,0xC0,0xFD,0x00,0x00,0x80,0xFF,0x03,0x00,0x80,0xFF,0x03,0x00,0xF8,0xFF,0x01,0x00,0xF0,0xFF,0x01,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x03,0x00,0xF0,0xFF,0x03,0x00,0xF8,0xFF,0x0F,0x00,0xF0,0xFF,0x07,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x07,0x00,0xF8,0xFF,0x07,0x00,0xF0,0xFF,0x03,0x00,0xC0,0xFF,0x03,0x00,0xE0,0xFF,0x03,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x07,0x00,0x20,0xFF,0x0F,0x00,0x00,0xFF,0x0C,0x00,0x80,0xDC,0x08,0x00,0x00,0x88,0x10,0x00,
 
 	/* Index 92, character 124 "|" (width: 2 pixels) */
-	0x2, 0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,
+	0xFE,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0x01,
 
 	/* Index 93, character 125 "}" (width: 24 pixels) */
-	0x18, 0x00,0x88,0x10,0x00,0x80,0xDC,0x08,0x00,0x00,0xFF,0x0C,0x00,0x20,0xFF,0x0F,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x03,0x00,0xC0,0xFF,0x03,0x00,0xF0,0xFF,0x03,0x00,0xF8,0xFF,0x07,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x03,0x00,0xF0,0xFF,0x07,0x00,0xF8,0xFF,0x0F,0x00,0xF0,0xFF,0x03,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x0F,0x00,0xF0,0xFF,0x01,0x00,0xF8,0xFF,0x01,0x00,0x80,0xFF,0x03,0x00,0x80,0xFF,0x03,0x00,0xC0,0xFD,0x00,0x00,0xC0,0xD8,0x00,0x00,0x00,0x88,0x00,0x00,
+	0x00,0x88,0x10,0x00,0x80,0xDC,0x08,0x00,0x00,0xFF,0x0C,0x00,0x20,0xFF,0x0F,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x03,0x00,0xC0,0xFF,0x03,0x00,0xF0,0xFF,0x03,0x00,0xF8,0xFF,0x07,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x03,0x00,0xF0,0xFF,0x07,0x00,0xF8,0xFF,0x0F,0x00,0xF0,0xFF,0x03,0x00,0xE0,0xFF,0x07,0x00,0xE0,0xFF,0x0F,0x00,0xF0,0xFF,0x01,0x00,0xF8,0xFF,0x01,0x00,0x80,0xFF,0x03,0x00,0x80,0xFF,0x03,0x00,0xC0,0xFD,0x00,0x00,0xC0,0xD8,0x00,0x00,0x00,0x88,0x00,0x00,
 
 	/* Index 94, character 126 "~" (width: 20 pixels) */
-	0x14, 0x00,0x00,0x40,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x0E,0x00,0x00,0x80,0x07,0x00,0x00,0xE0,0x03,0x00,0x00,0xF8,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0xF8,0x03,0x00,0x00,0xFC,0x01,0x00,0x00,0x7E,0x00,0x00,0x00,0x1F,0x00,0x00,0x80,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0xE0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
+	0x00,0x00,0x40,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x0E,0x00,0x00,0x80,0x07,0x00,0x00,0xE0,0x03,0x00,0x00,0xF8,0x01,0x00,0x00,0xFC,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0xF8,0x03,0x00,0x00,0xFC,0x01,0x00,0x00,0x7E,0x00,0x00,0x00,0x1F,0x00,0x00,0x80,0x07,0x00,0x00,0xC0,0x01,0x00,0x00,0xE0,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
 
 	/* Index 95, character 127 "." (width: 8 pixels) */
-	0x8, 0xE0,0xFF,0x0F,0x00,0xE0,0xFF,0x0F,0x00,0x60,0x00,0x0C,0x00,0x60,0x00,0x0C,0x00,0x60,0x00,0x0C,0x00,0x60,0x00,0x0C,0x00,0xE0,0xFF,0x0F,0x00,0xE0,0xFF,0x0F,0x00
+	0xE0,0xFF,0x0F,0x00,0xE0,0xFF,0x0F,0x00,0x60,0x00,0x0C,0x00,0x60,0x00,0x0C,0x00,0x60,0x00,0x0C,0x00,0x60,0x00,0x0C,0x00,0xE0,0xFF,0x0F,0x00,0xE0,0xFF,0x0F,0x00
+};
+
+// Offset of each bitmap in Webdings18_bitmaps
+const unsigned short Webdings18_offsets[] = 
+{
+	0x0,	// Index 0
+	0xC,	// Index 1
+	0x48,	// Index 2
+	0xAC,	// Index 3
+	0xFC,	// Index 4
+	0x138,	// Index 5
+	0x188,	// Index 6
+	0x1B0,	// Index 7
+	0x1D8,	// Index 8
+	0x22C,	// Index 9
+	0x280,	// Index 10
+	0x2D8,	// Index 11
+	0x330,	// Index 12
+	0x380,	// Index 13
+	0x3B0,	// Index 14
+	0x410,	// Index 15
+	0x470,	// Index 16
+	0x4A0,	// Index 17
+	0x4E8,	// Index 18
+	0x530,	// Index 19
+	0x550,	// Index 20
+	0x570,	// Index 21
+	0x5B0,	// Index 22
+	0x5F0,	// Index 23
+	0x634,	// Index 24
+	0x678,	// Index 25
+	0x6C0,	// Index 26
+	0x708,	// Index 27
+	0x72C,	// Index 28
+	0x764,	// Index 29
+	0x79C,	// Index 30
+	0x7E8,	// Index 31
+	0x834,	// Index 32
+	0x884,	// Index 33
+	0x8E4,	// Index 34
+	0x944,	// Index 35
+	0x9A4,	// Index 36
+	0xA04,	// Index 37
+	0xA64,	// Index 38
+	0xAC4,	// Index 39
+	0xB24,	// Index 40
+	0xB84,	// Index 41
+	0xBE4,	// Index 42
+	0xC44,	// Index 43
+	0xCA4,	// Index 44
+	0xCCC,	// Index 45
+	0xD2C,	// Index 46
+	0xD7C,	// Index 47
+	0xDB0,	// Index 48
+	0xE10,	// Index 49
+	0xE70,	// Index 50
+	0xED0,	// Index 51
+	0xF30,	// Index 52
+	0xF90,	// Index 53
+	0xFEC,	// Index 54
+	0x1030,	// Index 55
+	0x1054,	// Index 56
+	0x1078,	// Index 57
+	0x10C0,	// Index 58
+	0x10FC,	// Index 59
+	0x1154,	// Index 60
+	0x11B4,	// Index 61
+	0x120C,	// Index 62
+	0x1268,	// Index 63
+	0x12C4,	// Index 64
+	0x1314,	// Index 65
+	0x1340,	// Index 66
+	0x1388,	// Index 67
+	0x13E8,	// Index 68
+	0x1428,	// Index 69
+	0x146C,	// Index 70
+	0x14B0,	// Index 71
+	0x1510,	// Index 72
+	0x1560,	// Index 73
+	0x15B0,	// Index 74
+	0x1600,	// Index 75
+	0x1650,	// Index 76
+	0x1698,	// Index 77
+	0x16B0,	// Index 78
+	0x1710,	// Index 79
+	0x1760,	// Index 80
+	0x17AC,	// Index 81
+	0x17E8,	// Index 82
+	0x1828,	// Index 83
+	0x1860,	// Index 84
+	0x18C0,	// Index 85
+	0x1920,	// Index 86
+	0x1958,	// Index 87
+	0x1974,	// Index 88
+	0x19C4,	// Index 89
+	0x1A14,	// Index 90
+	0x1A64,	// Index 91
+	0x1AC4,	// Index 92
+	0x1ACC,	// Index 93
+	0x1B2C,	// Index 94
+	0x1B7C,	// Index 95
+};
+
+// Width of each bitmap in pixels
+const unsigned char Webdings18_widths[] = 
+{
+	0x3,	// Index 0
+	0xF,	// Index 1
+	0x19,	// Index 2
+	0x14,	// Index 3
+	0xF,	// Index 4
+	0x14,	// Index 5
+	0xA,	// Index 6
+	0xA,	// Index 7
+	0x15,	// Index 8
+	0x15,	// Index 9
+	0x16,	// Index 10
+	0x16,	// Index 11
+	0x14,	// Index 12
+	0xC,	// Index 13
+	0x18,	// Index 14
+	0x18,	// Index 15
+	0xC,	// Index 16
+	0x12,	// Index 17
+	0x12,	// Index 18
+	0x8,	// Index 19
+	0x8,	// Index 20
+	0x10,	// Index 21
+	0x10,	// Index 22
+	0x11,	// Index 23
+	0x11,	// Index 24
+	0x12,	// Index 25
+	0x12,	// Index 26
+	0x9,	// Index 27
+	0xE,	// Index 28
+	0xE,	// Index 29
+	0x13,	// Index 30
+	0x13,	// Index 31
+	0x14,	// Index 32
+	0x18,	// Index 33
+	0x18,	// Index 34
+	0x18,	// Index 35
+	0x18,	// Index 36
+	0x18,	// Index 37
+	0x18,	// Index 38
+	0x18,	// Index 39
+	0x18,	// Index 40
+	0x18,	// Index 41
+	0x18,	// Index 42
+	0x18,	// Index 43
+	0xA,	// Index 44
+	0x18,	// Index 45
+	0x14,	// Index 46
+	0xD,	// Index 47
+	0x18,	// Index 48
+	0x18,	// Index 49
+	0x18,	// Index 50
+	0x18,	// Index 51
+	0x18,	// Index 52
+	0x17,	// Index 53
+	0x11,	// Index 54
+	0x9,	// Index 55
+	0x9,	// Index 56
+	0x12,	// Index 57
+	0xF,	// Index 58
+	0x16,	// Index 59
+	0x18,	// Index 60
+	0x16,	// Index 61
+	0x17,	// Index 62
+	0x17,	// Index 63
+	0x14,	// Index 64
+	0xB,	// Index 65
+	0x12,	// Index 66
+	0x18,	// Index 67
+	0x10,	// Index 68
+	0x11,	// Index 69
+	0x11,	// Index 70
+	0x18,	// Index 71
+	0x14,	// Index 72
+	0x14,	// Index 73
+	0x14,	// Index 74
+	0x14,	// Index 75
+	0x12,	// Index 76
+	0x6,	// Index 77
+	0x18,	// Index 78
+	0x14,	// Index 79
+	0x13,	// Index 80
+	0xF,	// Index 81
+	0x10,	// Index 82
+	0xE,	// Index 83
+	0x18,	// Index 84
+	0x18,	// Index 85
+	0xE,	// Index 86
+	0x7,	// Index 87
+	0x14,	// Index 88
+	0x14,	// Index 89
+	0x14,	// Index 90
+	0x18,	// Index 91
+	0x2,	// Index 92
+	0x18,	// Index 93
+	0x14,	// Index 94
+	0x8,	// Index 95
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Webdings18_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x16, 0x0,	// Index 1
+	0x18, 0x0,	// Index 2
+	0x17, 0x0,	// Index 3
+	0x10, 0x0,	// Index 4
+	0x17, 0x0,	// Index 5
+	0x17, 0x0,	// Index 6
+	0x16, 0x0,	// Index 7
+	0x13, 0x0,	// Index 8
+	0x13, 0x0,	// Index 9
+	0x15, 0x0,	// Index 10
+	0x17, 0x0,	// Index 11
+	0x11, 0x0,	// Index 12
+	0x16, 0x0,	// Index 13
+	0x18, 0x0,	// Index 14
+	0x18, 0x0,	// Index 15
+	0x6, 0x0,	// Index 16
+	0x14, 0x0,	// Index 17
+	0x15, 0x0,	// Index 18
+	0x15, 0x0,	// Index 19
+	0x15, 0x0,	// Index 20
+	0x11, 0x0,	// Index 21
+	0xF, 0x0,	// Index 22
+	0x14, 0x0,	// Index 23
+	0x14, 0x0,	// Index 24
+	0x14, 0x0,	// Index 25
+	0x14, 0x0,	// Index 26
+	0x13, 0x0,	// Index 27
+	0x13, 0x0,	// Index 28
+	0x13, 0x0,	// Index 29
+	0x12, 0x0,	// Index 30
+	0x17, 0x0,	// Index 31
+	0x16, 0x0,	// Index 32
+	0x17, 0x0,	// Index 33
+	0x15, 0x0,	// Index 34
+	0x16, 0x0,	// Index 35
+	0x17, 0x0,	// Index 36
+	0x16, 0x0,	// Index 37
+	0x16, 0x0,	// Index 38
+	0x15, 0x0,	// Index 39
+	0x17, 0x0,	// Index 40
+	0x15, 0x0,	// Index 41
+	0x17, 0x0,	// Index 42
+	0x13, 0x0,	// Index 43
+	0x16, 0x0,	// Index 44
+	0x13, 0x0,	// Index 45
+	0x14, 0x0,	// Index 46
+	0x16, 0x0,	// Index 47
+	0x15, 0x0,	// Index 48
+	0x15, 0x0,	// Index 49
+	0xE, 0x0,	// Index 50
+	0x18, 0x0,	// Index 51
+	0x17, 0x0,	// Index 52
+	0x14, 0x0,	// Index 53
+	0x13, 0x0,	// Index 54
+	0x15, 0x0,	// Index 55
+	0x15, 0x0,	// Index 56
+	0x14, 0x0,	// Index 57
+	0x16, 0x0,	// Index 58
+	0x14, 0x0,	// Index 59
+	0x18, 0x0,	// Index 60
+	0x14, 0x0,	// Index 61
+	0x16, 0x0,	// Index 62
+	0x17, 0x0,	// Index 63
+	0x14, 0x0,	// Index 64
+	0x12, 0x0,	// Index 65
+	0x11, 0x0,	// Index 66
+	0x18, 0x0,	// Index 67
+	0x14, 0x0,	// Index 68
+	0x16, 0x0,	// Index 69
+	0x17, 0x0,	// Index 70
+	0x18, 0x0,	// Index 71
+	0x15, 0x0,	// Index 72
+	0x17, 0x0,	// Index 73
+	0x11, 0x0,	// Index 74
+	0x14, 0x0,	// Index 75
+	0x16, 0x0,	// Index 76
+	0x19, 0x0,	// Index 77
+	0x18, 0x0,	// Index 78
+	0xC, 0x0,	// Index 79
+	0x19, 0x0,	// Index 80
+	0x15, 0x0,	// Index 81
+	0x14, 0x0,	// Index 82
+	0x16, 0x0,	// Index 83
+	0x13, 0x0,	// Index 84
+	0x16, 0x0,	// Index 85
+	0x14, 0x0,	// Index 86
+	0x16, 0x0,	// Index 87
+	0x16, 0x0,	// Index 88
+	0x16, 0x0,	// Index 89
+	0x16, 0x0,	// Index 90
+	0x16, 0x0,	// Index 91
+	0x18, 0x0,	// Index 92
+	0x16, 0x0,	// Index 93
+	0x16, 0x0,	// Index 94
+	0x14, 0x0,	// Index 95
+};
+
+const font_t Webdings18 = 
+{
+	Webdings18_bitmaps,
+	Webdings18_offsets,
+	Webdings18_widths,
+	0x20,	// Start character 
+	0x60,	// Number of bitmaps 
+	0x19,	// Height 
+	0,	// Flags 
+	Webdings18_extents,
+	0x19	// Ascent 
 };
@@ -7,6 +7,8 @@
 // Project Name:  Wingdings
 //---------------------------------------------------------------
 
+#include "graphics.h"
+
 //---------------------------------------------------------------
 // Group Name: Wingdings
 // Designer: Imported System Font
@@ -20,395 +22,603 @@
 // Start Character: 32 " "
 // Stop Character: 126 "~"
 //---------------------------------------------------------------
-const unsigned char Wingdings[] = 
+const unsigned char Wingdings_bitmaps[] = 
 {
-	// Font Header 
-	0x01,	// 0x00: Monospace, 0x01: Proportional 
-	0x02,	// 0x00: horizontalLeft,  0x01: horizontalRight 
-			// 0x02: verticalCeiling, 0x03: verticalBottom 
-	0x20,	// Start character 
-	0x5F,	// Number of Bitmaps 
-	0x15,	// Height 
-
-	// Bitmap Index (number of index entries 95)
- 	0x0, 0xC3, // Index 0 (offset: 195)
-	0x0, 0xCA, // Index 1 (offset: 202)
-	0x1, 0x7, // Index 2 (offset: 263)
-	0x1, 0x47, // Index 3 (offset: 327)
-	0x1, 0x8D, // Index 4 (offset: 397)
-	0x1, 0xDF, // Index 5 (offset: 479)
-	0x2, 0x10, // Index 6 (offset: 528)
-	0x2, 0x56, // Index 7 (offset: 598)
-	0x2, 0x6C, // Index 8 (offset: 620)
-	0x2, 0xA6, // Index 9 (offset: 678)
-	0x2, 0xD4, // Index 10 (offset: 724)
-	0x3, 0x11, // Index 11 (offset: 785)
-	0x3, 0x4E, // Index 12 (offset: 846)
-	0x3, 0x8E, // Index 13 (offset: 910)
-	0x3, 0xCE, // Index 14 (offset: 974)
-	0x4, 0x20, // Index 15 (offset: 1056)
-	0x4, 0x72, // Index 16 (offset: 1138)
-	0x4, 0xAC, // Index 17 (offset: 1196)
-	0x4, 0xF8, // Index 18 (offset: 1272)
-	0x5, 0x1A, // Index 19 (offset: 1306)
-	0x5, 0x3C, // Index 20 (offset: 1340)
-	0x5, 0x6A, // Index 21 (offset: 1386)
-	0x5, 0x86, // Index 22 (offset: 1414)
-	0x5, 0xA2, // Index 23 (offset: 1442)
-	0x5, 0xDC, // Index 24 (offset: 1500)
-	0x6, 0x10, // Index 25 (offset: 1552)
-	0x6, 0x4D, // Index 26 (offset: 1613)
-	0x6, 0x81, // Index 27 (offset: 1665)
-	0x6, 0xAF, // Index 28 (offset: 1711)
-	0x6, 0xDD, // Index 29 (offset: 1757)
-	0x7, 0xB, // Index 30 (offset: 1803)
-	0x7, 0x3C, // Index 31 (offset: 1852)
-	0x7, 0x73, // Index 32 (offset: 1907)
-	0x7, 0xAA, // Index 33 (offset: 1962)
-	0x7, 0xC6, // Index 34 (offset: 1990)
-	0x7, 0xF1, // Index 35 (offset: 2033)
-	0x8, 0x13, // Index 36 (offset: 2067)
-	0x8, 0x35, // Index 37 (offset: 2101)
-	0x8, 0x69, // Index 38 (offset: 2153)
-	0x8, 0x9D, // Index 39 (offset: 2205)
-	0x8, 0xB6, // Index 40 (offset: 2230)
-	0x8, 0xCF, // Index 41 (offset: 2255)
-	0x8, 0xFD, // Index 42 (offset: 2301)
-	0x9, 0x2E, // Index 43 (offset: 2350)
-	0x9, 0x62, // Index 44 (offset: 2402)
-	0x9, 0x93, // Index 45 (offset: 2451)
-	0x9, 0xD3, // Index 46 (offset: 2515)
-	0x9, 0xF2, // Index 47 (offset: 2546)
-	0xA, 0x1D, // Index 48 (offset: 2589)
-	0xA, 0x5A, // Index 49 (offset: 2650)
-	0xA, 0x85, // Index 50 (offset: 2693)
-	0xA, 0xB3, // Index 51 (offset: 2739)
-	0xA, 0xD2, // Index 52 (offset: 2770)
-	0xB, 0x0, // Index 53 (offset: 2816)
-	0xB, 0x25, // Index 54 (offset: 2853)
-	0xB, 0x4D, // Index 55 (offset: 2893)
-	0xB, 0x72, // Index 56 (offset: 2930)
-	0xB, 0x97, // Index 57 (offset: 2967)
-	0xB, 0xBF, // Index 58 (offset: 3007)
-	0xB, 0xEA, // Index 59 (offset: 3050)
-	0xC, 0x18, // Index 60 (offset: 3096)
-	0xC, 0x46, // Index 61 (offset: 3142)
-	0xC, 0x77, // Index 62 (offset: 3191)
-	0xC, 0xBA, // Index 63 (offset: 3258)
-	0xC, 0xF4, // Index 64 (offset: 3316)
-	0xD, 0x28, // Index 65 (offset: 3368)
-	0xD, 0x62, // Index 66 (offset: 3426)
-	0xD, 0x93, // Index 67 (offset: 3475)
-	0xD, 0xC4, // Index 68 (offset: 3524)
-	0xD, 0xF5, // Index 69 (offset: 3573)
-	0xE, 0x2C, // Index 70 (offset: 3628)
-	0xE, 0x5D, // Index 71 (offset: 3677)
-	0xE, 0x97, // Index 72 (offset: 3735)
-	0xE, 0xD1, // Index 73 (offset: 3793)
-	0xE, 0xF6, // Index 74 (offset: 3830)
-	0xF, 0x36, // Index 75 (offset: 3894)
-	0xF, 0x82, // Index 76 (offset: 3970)
-	0xF, 0xA7, // Index 77 (offset: 4007)
-	0xF, 0xD8, // Index 78 (offset: 4056)
-	0xF, 0xFD, // Index 79 (offset: 4093)
-	0x10, 0x2B, // Index 80 (offset: 4139)
-	0x10, 0x59, // Index 81 (offset: 4185)
-	0x10, 0x87, // Index 82 (offset: 4231)
-	0x10, 0xB5, // Index 83 (offset: 4277)
-	0x10, 0xC8, // Index 84 (offset: 4296)
-	0x10, 0xED, // Index 85 (offset: 4333)
-	0x11, 0x21, // Index 86 (offset: 4385)
-	0x11, 0x4F, // Index 87 (offset: 4431)
-	0x11, 0x6B, // Index 88 (offset: 4459)
-	0x11, 0xA5, // Index 89 (offset: 4517)
-	0x11, 0xDF, // Index 90 (offset: 4575)
-	0x12, 0xA, // Index 91 (offset: 4618)
-	0x12, 0x38, // Index 92 (offset: 4664)
-	0x12, 0x66, // Index 93 (offset: 4710)
-	0x12, 0x85, // Index 94 (offset: 4741)
-
 	/* Index 0, character 32 " " (width: 2 pixels) */
-	0x2, 0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,
 
 	/* Index 1, character 33 "!" (width: 20 pixels) */
-	0x14, 0x00,0x00,0x01,0x00,0x80,0x01,0x00,0x60,0x01,0x00,0x20,0x01,0x00,0x98,0x00,0x00,0xB8,0x00,0x00,0x54,0x00,0x00,0x5A,0x00,0x00,0x2D,0x00,0x80,0x16,0x00,0x80,0x0D,0x00,0xC0,0x0A,0x00,0xA0,0x05,0x00,0xD0,0x02,0x00,0xB8,0x01,0x00,0xF4,0x00,0x00,0x64,0x00,0x00,0x42,0x00,0x00,0x24,0x00,0x00,0x18,0x00,0x00,
+	0x00,0x00,0x01,0x00,0x80,0x01,0x00,0x60,0x01,0x00,0x20,0x01,0x00,0x98,0x00,0x00,0xB8,0x00,0x00,0x54,0x00,0x00,0x5A,0x00,0x00,0x2D,0x00,0x80,0x16,0x00,0x80,0x0D,0x00,0xC0,0x0A,0x00,0xA0,0x05,0x00,0xD0,0x02,0x00,0xB8,0x01,0x00,0xF4,0x00,0x00,0x64,0x00,0x00,0x42,0x00,0x00,0x24,0x00,0x00,0x18,0x00,0x00,
 
 	/* Index 2, character 34 """ (width: 21 pixels) */
-	0x15, 0x18,0xC0,0x00,0x24,0x20,0x01,0x44,0x20,0x01,0x44,0x10,0x01,0x48,0x90,0x00,0xF8,0xC8,0x00,0x80,0x7D,0x00,0x00,0x07,0x00,0x00,0x06,0x00,0x00,0x07,0x00,0x80,0x07,0x00,0x80,0x0D,0x00,0xC0,0x18,0x00,0xC0,0x18,0x00,0x60,0x30,0x00,0x70,0x30,0x00,0x30,0x60,0x00,0x38,0xE0,0x00,0x18,0xC0,0x00,0x08,0xC0,0x00,0x08,0x00,0x00,
+	0x18,0xC0,0x00,0x24,0x20,0x01,0x44,0x20,0x01,0x44,0x10,0x01,0x48,0x90,0x00,0xF8,0xC8,0x00,0x80,0x7D,0x00,0x00,0x07,0x00,0x00,0x06,0x00,0x00,0x07,0x00,0x80,0x07,0x00,0x80,0x0D,0x00,0xC0,0x18,0x00,0xC0,0x18,0x00,0x60,0x30,0x00,0x70,0x30,0x00,0x30,0x60,0x00,0x38,0xE0,0x00,0x18,0xC0,0x00,0x08,0xC0,0x00,0x08,0x00,0x00,
 
 	/* Index 3, character 35 "#" (width: 23 pixels) */
-	0x17, 0x00,0x30,0x00,0x00,0x48,0x00,0x00,0x48,0x00,0x00,0x48,0x00,0x00,0x48,0x00,0x1C,0x48,0x00,0x22,0x28,0x00,0x42,0x1C,0x00,0xE6,0x0D,0x00,0x1C,0x0D,0x00,0x00,0x0C,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0xCE,0x01,0x00,0x86,0x01,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,
+	0x00,0x30,0x00,0x00,0x48,0x00,0x00,0x48,0x00,0x00,0x48,0x00,0x00,0x48,0x00,0x1C,0x48,0x00,0x22,0x28,0x00,0x42,0x1C,0x00,0xE6,0x0D,0x00,0x1C,0x0D,0x00,0x00,0x0C,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0xCE,0x01,0x00,0x86,0x01,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,
 
 	/* Index 4, character 36 "$" (width: 27 pixels) */
-	0x1B, 0x00,0x70,0x00,0x00,0xB8,0x00,0x00,0x24,0x01,0x00,0x22,0x01,0x00,0x21,0x01,0x80,0x20,0x01,0x80,0xA0,0x00,0x40,0x78,0x00,0x40,0x08,0x00,0x40,0x78,0x00,0x80,0xA3,0x00,0x00,0x20,0x01,0x00,0x20,0x01,0x00,0x20,0x01,0x00,0x20,0x01,0x00,0xA0,0x00,0x00,0x60,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x01,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x80,0x03,0x00,
+	0x00,0x70,0x00,0x00,0xB8,0x00,0x00,0x24,0x01,0x00,0x22,0x01,0x00,0x21,0x01,0x80,0x20,0x01,0x80,0xA0,0x00,0x40,0x78,0x00,0x40,0x08,0x00,0x40,0x78,0x00,0x80,0xA3,0x00,0x00,0x20,0x01,0x00,0x20,0x01,0x00,0x20,0x01,0x00,0x20,0x01,0x00,0xA0,0x00,0x00,0x60,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x01,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x80,0x03,0x00,
 
 	/* Index 5, character 37 "%" (width: 16 pixels) */
-	0x10, 0x00,0x60,0x00,0x00,0x90,0x00,0x00,0x1C,0x01,0xE0,0x33,0x01,0x18,0x38,0x01,0x04,0x38,0x01,0x04,0x08,0x01,0x02,0x08,0x01,0x02,0x08,0x01,0x04,0x08,0x01,0x04,0x08,0x01,0x18,0x08,0x01,0xE0,0x13,0x01,0x00,0x1C,0x01,0x00,0xB0,0x00,0x00,0x60,0x00,
+	0x00,0x60,0x00,0x00,0x90,0x00,0x00,0x1C,0x01,0xE0,0x33,0x01,0x18,0x38,0x01,0x04,0x38,0x01,0x04,0x08,0x01,0x02,0x08,0x01,0x02,0x08,0x01,0x04,0x08,0x01,0x04,0x08,0x01,0x18,0x08,0x01,0xE0,0x13,0x01,0x00,0x1C,0x01,0x00,0xB0,0x00,0x00,0x60,0x00,
 
 	/* Index 6, character 38 "&" (width: 23 pixels) */
-	0x17, 0xF8,0xFF,0x01,0xF8,0x7F,0x01,0x04,0x40,0x01,0xFE,0xBF,0x01,0x02,0xA0,0x01,0x01,0x90,0x00,0x01,0x90,0x00,0x01,0x90,0x00,0x01,0x90,0x00,0x01,0x50,0x01,0x06,0xA0,0x01,0xFC,0x7F,0x01,0x02,0x60,0x01,0x01,0x90,0x00,0x01,0x90,0x00,0x01,0x90,0x00,0x01,0x90,0x00,0x01,0x90,0x00,0x02,0xA0,0x01,0xFE,0xBF,0x01,0x0C,0x40,0x01,0xF8,0x7F,0x01,0xF8,0xFF,0x01,
+	0xF8,0xFF,0x01,0xF8,0x7F,0x01,0x04,0x40,0x01,0xFE,0xBF,0x01,0x02,0xA0,0x01,0x01,0x90,0x00,0x01,0x90,0x00,0x01,0x90,0x00,0x01,0x90,0x00,0x01,0x50,0x01,0x06,0xA0,0x01,0xFC,0x7F,0x01,0x02,0x60,0x01,0x01,0x90,0x00,0x01,0x90,0x00,0x01,0x90,0x00,0x01,0x90,0x00,0x01,0x90,0x00,0x02,0xA0,0x01,0xFE,0xBF,0x01,0x0C,0x40,0x01,0xF8,0x7F,0x01,0xF8,0xFF,0x01,
 
 	/* Index 7, character 39 "'" (width: 7 pixels) */
-	0x7, 0x00,0xFF,0x01,0xF0,0x02,0x01,0x8C,0x02,0x01,0x82,0x03,0x01,0x84,0x02,0x01,0xF8,0x02,0x01,0x00,0xFF,0x00,
+	0x00,0xFF,0x01,0xF0,0x02,0x01,0x8C,0x02,0x01,0x82,0x03,0x01,0x84,0x02,0x01,0xF8,0x02,0x01,0x00,0xFF,0x00,
 
 	/* Index 8, character 40 "(" (width: 19 pixels) */
-	0x13, 0xD8,0x01,0x00,0xBC,0x01,0x00,0xBC,0xE1,0x01,0xBC,0xF9,0x01,0xDE,0xFE,0x01,0x0E,0xFF,0x01,0xE6,0xFF,0x01,0xE6,0xF6,0x01,0xC6,0xFF,0x01,0xC6,0xF6,0x01,0xC6,0xFF,0x01,0xE6,0xF6,0x01,0xE6,0xFF,0x01,0x0E,0xFF,0x01,0x5E,0xFE,0x01,0xDC,0xF8,0x01,0xDC,0xF0,0x01,0xDC,0x00,0x00,0xD8,0x00,0x00,
+	0xD8,0x01,0x00,0xBC,0x01,0x00,0xBC,0xE1,0x01,0xBC,0xF9,0x01,0xDE,0xFE,0x01,0x0E,0xFF,0x01,0xE6,0xFF,0x01,0xE6,0xF6,0x01,0xC6,0xFF,0x01,0xC6,0xF6,0x01,0xC6,0xFF,0x01,0xE6,0xF6,0x01,0xE6,0xFF,0x01,0x0E,0xFF,0x01,0x5E,0xFE,0x01,0xDC,0xF8,0x01,0xDC,0xF0,0x01,0xDC,0x00,0x00,0xD8,0x00,0x00,
 
 	/* Index 9, character 41 ")" (width: 15 pixels) */
-	0xF, 0x80,0x0F,0x00,0x60,0x30,0x00,0x10,0x40,0x00,0x08,0x80,0x00,0x08,0x80,0x00,0x04,0x00,0x01,0x74,0x70,0x01,0x74,0x70,0x01,0xF4,0x3F,0x01,0xC4,0x1F,0x01,0x08,0x80,0x00,0x08,0x80,0x00,0x10,0x40,0x00,0x60,0x30,0x00,0x80,0x0F,0x00,
+	0x80,0x0F,0x00,0x60,0x30,0x00,0x10,0x40,0x00,0x08,0x80,0x00,0x08,0x80,0x00,0x04,0x00,0x01,0x74,0x70,0x01,0x74,0x70,0x01,0xF4,0x3F,0x01,0xC4,0x1F,0x01,0x08,0x80,0x00,0x08,0x80,0x00,0x10,0x40,0x00,0x60,0x30,0x00,0x80,0x0F,0x00,
 
 	/* Index 10, character 42 "*" (width: 20 pixels) */
-	0x14, 0xFC,0xFF,0x01,0x0C,0x80,0x01,0x14,0x40,0x01,0x24,0x20,0x01,0x44,0x10,0x01,0x84,0x08,0x01,0x04,0x05,0x01,0x04,0x02,0x01,0x04,0x04,0x01,0x04,0x08,0x01,0x04,0x08,0x01,0x04,0x04,0x01,0x04,0x02,0x01,0x04,0x05,0x01,0x84,0x08,0x01,0x44,0x10,0x01,0x24,0x20,0x01,0x14,0x40,0x01,0x0C,0x80,0x01,0xFC,0xFF,0x01,
+	0xFC,0xFF,0x01,0x0C,0x80,0x01,0x14,0x40,0x01,0x24,0x20,0x01,0x44,0x10,0x01,0x84,0x08,0x01,0x04,0x05,0x01,0x04,0x02,0x01,0x04,0x04,0x01,0x04,0x08,0x01,0x04,0x08,0x01,0x04,0x04,0x01,0x04,0x02,0x01,0x04,0x05,0x01,0x84,0x08,0x01,0x44,0x10,0x01,0x24,0x20,0x01,0x14,0x40,0x01,0x0C,0x80,0x01,0xFC,0xFF,0x01,
 
 	/* Index 11, character 43 "+" (width: 20 pixels) */
-	0x14, 0xFC,0xFF,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x01,0x01,0x04,0x05,0x01,0x04,0x05,0x01,0x04,0x15,0x01,0x04,0x15,0x01,0x04,0x15,0x01,0x04,0x15,0x01,0x04,0x14,0x01,0x04,0x10,0x01,0x04,0x10,0x01,0x74,0x00,0x01,0x74,0x00,0x01,0x04,0x00,0x01,0xFC,0xFF,0x01,
+	0xFC,0xFF,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x01,0x01,0x04,0x05,0x01,0x04,0x05,0x01,0x04,0x15,0x01,0x04,0x15,0x01,0x04,0x15,0x01,0x04,0x15,0x01,0x04,0x14,0x01,0x04,0x10,0x01,0x04,0x10,0x01,0x74,0x00,0x01,0x74,0x00,0x01,0x04,0x00,0x01,0xFC,0xFF,0x01,
 
 	/* Index 12, character 44 "," (width: 21 pixels) */
-	0x15, 0x80,0xFF,0x01,0xC0,0x00,0x01,0x60,0x00,0x01,0x20,0x04,0x01,0x20,0x04,0x01,0x20,0x04,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x90,0x00,0x01,0x10,0xFF,0x01,0x08,0x08,0x01,0x08,0x0C,0x01,0x08,0x8C,0x00,0x08,0x84,0x00,0x04,0x84,0x00,0x04,0xBC,0x00,0x04,0x5E,0x00,0x04,0x5E,0x00,0x0C,0x5E,0x00,0x18,0x40,0x00,0xF0,0x3F,0x00,
+	0x80,0xFF,0x01,0xC0,0x00,0x01,0x60,0x00,0x01,0x20,0x04,0x01,0x20,0x04,0x01,0x20,0x04,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x90,0x00,0x01,0x10,0xFF,0x01,0x08,0x08,0x01,0x08,0x0C,0x01,0x08,0x8C,0x00,0x08,0x84,0x00,0x04,0x84,0x00,0x04,0xBC,0x00,0x04,0x5E,0x00,0x04,0x5E,0x00,0x0C,0x5E,0x00,0x18,0x40,0x00,0xF0,0x3F,0x00,
 
 	/* Index 13, character 45 "-" (width: 21 pixels) */
-	0x15, 0x80,0xFF,0x01,0x40,0x00,0x01,0x20,0x00,0x01,0x20,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x30,0x00,0x01,0x50,0x00,0x01,0x48,0x00,0x01,0x88,0xFF,0x01,0xFE,0x0F,0x01,0xFE,0x0F,0x01,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x02,0x80,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x04,0x40,0x00,0x0C,0x40,0x00,0xF0,0x3F,0x00,
+	0x80,0xFF,0x01,0x40,0x00,0x01,0x20,0x00,0x01,0x20,0x04,0x01,0x10,0x04,0x01,0x10,0x04,0x01,0x30,0x00,0x01,0x50,0x00,0x01,0x48,0x00,0x01,0x88,0xFF,0x01,0xFE,0x0F,0x01,0xFE,0x0F,0x01,0x1F,0x80,0x00,0x1F,0x80,0x00,0x1F,0x80,0x00,0x02,0x80,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x04,0x40,0x00,0x0C,0x40,0x00,0xF0,0x3F,0x00,
 
 	/* Index 14, character 46 "." (width: 27 pixels) */
-	0x1B, 0x00,0x0E,0x00,0x00,0x11,0x00,0x00,0x21,0x00,0x00,0x41,0x00,0x00,0xD1,0x00,0x00,0x92,0x01,0x80,0x03,0x01,0x40,0x04,0x01,0x20,0x08,0x01,0x20,0x1E,0x01,0x10,0x21,0x01,0x90,0x5C,0x01,0xB0,0x84,0x01,0x48,0x42,0x01,0x88,0xFF,0x01,0x08,0x00,0x01,0xFE,0x0F,0x01,0xFE,0x87,0x00,0x1F,0x80,0x00,0x0F,0x80,0x00,0x0F,0x80,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x04,0x40,0x00,0x0C,0x20,0x00,0xF0,0x3F,0x00,
+	0x00,0x0E,0x00,0x00,0x11,0x00,0x00,0x21,0x00,0x00,0x41,0x00,0x00,0xD1,0x00,0x00,0x92,0x01,0x80,0x03,0x01,0x40,0x04,0x01,0x20,0x08,0x01,0x20,0x1E,0x01,0x10,0x21,0x01,0x90,0x5C,0x01,0xB0,0x84,0x01,0x48,0x42,0x01,0x88,0xFF,0x01,0x08,0x00,0x01,0xFE,0x0F,0x01,0xFE,0x87,0x00,0x1F,0x80,0x00,0x0F,0x80,0x00,0x0F,0x80,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x04,0x40,0x00,0x0C,0x20,0x00,0xF0,0x3F,0x00,
 
 	/* Index 15, character 47 "/" (width: 27 pixels) */
-	0x1B, 0x00,0x0C,0x00,0x00,0x32,0x00,0x00,0x22,0x00,0x00,0x42,0x00,0x00,0x92,0x00,0x00,0x94,0x01,0x00,0x07,0x01,0xC0,0x08,0x01,0x40,0x10,0x01,0x20,0x10,0x01,0x20,0x20,0x01,0x20,0x40,0x01,0x60,0x80,0x01,0xD0,0x00,0x01,0x10,0xFF,0x01,0x10,0x00,0x01,0x08,0x08,0x01,0x08,0x8C,0x00,0x08,0x84,0x00,0x08,0x84,0x00,0x04,0xA4,0x00,0x04,0x5E,0x00,0x04,0x5E,0x00,0x04,0x5E,0x00,0x0C,0x5F,0x00,0x18,0x20,0x00,0xF0,0x3F,0x00,
+	0x00,0x0C,0x00,0x00,0x32,0x00,0x00,0x22,0x00,0x00,0x42,0x00,0x00,0x92,0x00,0x00,0x94,0x01,0x00,0x07,0x01,0xC0,0x08,0x01,0x40,0x10,0x01,0x20,0x10,0x01,0x20,0x20,0x01,0x20,0x40,0x01,0x60,0x80,0x01,0xD0,0x00,0x01,0x10,0xFF,0x01,0x10,0x00,0x01,0x08,0x08,0x01,0x08,0x8C,0x00,0x08,0x84,0x00,0x08,0x84,0x00,0x04,0xA4,0x00,0x04,0x5E,0x00,0x04,0x5E,0x00,0x04,0x5E,0x00,0x0C,0x5F,0x00,0x18,0x20,0x00,0xF0,0x3F,0x00,
 
 	/* Index 16, character 48 "0" (width: 19 pixels) */
-	0x13, 0xF0,0xFF,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x1C,0x00,0x01,0x14,0x00,0x01,0x14,0x00,0x01,0x14,0x00,0x01,0x14,0x00,0x01,0x14,0x00,0x01,0x1C,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0xF0,0xFF,0x01,
+	0xF0,0xFF,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x1C,0x00,0x01,0x14,0x00,0x01,0x14,0x00,0x01,0x14,0x00,0x01,0x14,0x00,0x01,0x14,0x00,0x01,0x1C,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0xF0,0xFF,0x01,
 
 	/* Index 17, character 49 "1" (width: 25 pixels) */
-	0x19, 0xF0,0xFF,0x01,0x10,0xC0,0x01,0x10,0x30,0x01,0x1C,0x0C,0x01,0x04,0x03,0x01,0x84,0x00,0x01,0x44,0x00,0x01,0x44,0x00,0x01,0x44,0x00,0x01,0x4C,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x70,0x00,0x01,0x40,0xC0,0x00,0x40,0x30,0x00,0x40,0x0C,0x00,0x40,0x03,0x00,0xC0,0x00,0x00,
+	0xF0,0xFF,0x01,0x10,0xC0,0x01,0x10,0x30,0x01,0x1C,0x0C,0x01,0x04,0x03,0x01,0x84,0x00,0x01,0x44,0x00,0x01,0x44,0x00,0x01,0x44,0x00,0x01,0x4C,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x50,0x00,0x01,0x70,0x00,0x01,0x40,0xC0,0x00,0x40,0x30,0x00,0x40,0x0C,0x00,0x40,0x03,0x00,0xC0,0x00,0x00,
 
 	/* Index 18, character 50 "2" (width: 11 pixels) */
-	0xB, 0xFC,0xFF,0x01,0x04,0x00,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x04,0x2B,0x01,0x7C,0x2B,0x01,0x4C,0x2B,0x01,0x58,0x2B,0x01,0x70,0x00,0x01,0xE0,0xFF,0x01,
+	0xFC,0xFF,0x01,0x04,0x00,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x04,0x2B,0x01,0x7C,0x2B,0x01,0x4C,0x2B,0x01,0x58,0x2B,0x01,0x70,0x00,0x01,0xE0,0xFF,0x01,
 
 	/* Index 19, character 51 "3" (width: 11 pixels) */
-	0xB, 0xFC,0xFF,0x01,0x04,0x00,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x04,0x00,0x01,0xFC,0xFF,0x01,
+	0xFC,0xFF,0x01,0x04,0x00,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x54,0x2B,0x01,0x04,0x00,0x01,0xFC,0xFF,0x01,
 
 	/* Index 20, character 52 "4" (width: 15 pixels) */
-	0xF, 0xC0,0xFF,0x1F,0x40,0x00,0x10,0x70,0xAD,0x14,0x50,0xAD,0x14,0x5C,0xAD,0x14,0x54,0xAD,0x14,0x54,0xAD,0x14,0x54,0xAD,0x14,0x54,0xAD,0x14,0x54,0x00,0x10,0xD4,0xFF,0x1F,0x14,0x00,0x04,0xF4,0xFF,0x07,0x04,0x00,0x01,0xFC,0xFF,0x01,
+	0xC0,0xFF,0x1F,0x40,0x00,0x10,0x70,0xAD,0x14,0x50,0xAD,0x14,0x5C,0xAD,0x14,0x54,0xAD,0x14,0x54,0xAD,0x14,0x54,0xAD,0x14,0x54,0xAD,0x14,0x54,0x00,0x10,0xD4,0xFF,0x1F,0x14,0x00,0x04,0xF4,0xFF,0x07,0x04,0x00,0x01,0xFC,0xFF,0x01,
 
 	/* Index 21, character 53 "5" (width: 9 pixels) */
-	0x9, 0xFC,0xFF,0x01,0x04,0x02,0x01,0x04,0x02,0x01,0x34,0x1A,0x01,0xB4,0x5A,0x01,0x34,0x1A,0x01,0x04,0x02,0x01,0x04,0x02,0x01,0xFC,0xFF,0x01,
+	0xFC,0xFF,0x01,0x04,0x02,0x01,0x04,0x02,0x01,0x34,0x1A,0x01,0xB4,0x5A,0x01,0x34,0x1A,0x01,0x04,0x02,0x01,0x04,0x02,0x01,0xFC,0xFF,0x01,
 
 	/* Index 22, character 54 "6" (width: 9 pixels) */
-	0x9, 0x3C,0xF0,0x00,0x4A,0x98,0x01,0xCA,0xC4,0x01,0x4A,0xE3,0x01,0xCA,0xF3,0x01,0x4A,0xE3,0x01,0xCA,0xC4,0x01,0x4A,0x98,0x01,0x3C,0xF0,0x00,
+	0x3C,0xF0,0x00,0x4A,0x98,0x01,0xCA,0xC4,0x01,0x4A,0xE3,0x01,0xCA,0xF3,0x01,0x4A,0xE3,0x01,0xCA,0xC4,0x01,0x4A,0x98,0x01,0x3C,0xF0,0x00,
 
 	/* Index 23, character 55 "7" (width: 19 pixels) */
-	0x13, 0x80,0xFF,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0xF0,0x12,0x01,0x98,0x0C,0x01,0x8C,0x52,0x01,0x8C,0x4C,0x01,0x8C,0x4C,0x01,0x98,0x52,0x01,0x98,0x4C,0x01,0x98,0x52,0x01,0x8C,0x4C,0x01,0x86,0x4C,0x01,0x80,0x52,0x01,0x80,0x0C,0x01,0x80,0x12,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0xFF,0x01,
+	0x80,0xFF,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0xF0,0x12,0x01,0x98,0x0C,0x01,0x8C,0x52,0x01,0x8C,0x4C,0x01,0x8C,0x4C,0x01,0x98,0x52,0x01,0x98,0x4C,0x01,0x98,0x52,0x01,0x8C,0x4C,0x01,0x86,0x4C,0x01,0x80,0x52,0x01,0x80,0x0C,0x01,0x80,0x12,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0xFF,0x01,
 
 	/* Index 24, character 56 "8" (width: 17 pixels) */
-	0x11, 0xC0,0x00,0x00,0x80,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0xC0,0x00,0x00,0x30,0x00,0x00,0x0C,0x00,0x00,0x02,0x00,0x00,0xF1,0x7F,0x00,0x91,0x80,0x00,0x91,0x00,0x01,0x93,0x00,0x01,0xFE,0x00,0x01,0x90,0x00,0x01,0x90,0x80,0x00,0xF0,0x7F,0x00,
+	0xC0,0x00,0x00,0x80,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0xC0,0x00,0x00,0x30,0x00,0x00,0x0C,0x00,0x00,0x02,0x00,0x00,0xF1,0x7F,0x00,0x91,0x80,0x00,0x91,0x00,0x01,0x93,0x00,0x01,0xFE,0x00,0x01,0x90,0x00,0x01,0x90,0x80,0x00,0xF0,0x7F,0x00,
 
 	/* Index 25, character 57 "9" (width: 20 pixels) */
-	0x14, 0x20,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0xE0,0x3F,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x30,0x00,0x00,0xFF,0x01,0x80,0x07,0x01,0xC0,0x1E,0x01,0x20,0x33,0x01,0x20,0x3F,0x01,0x20,0x3F,0x01,0x20,0x33,0x01,0x60,0x1E,0x01,0xC0,0x03,0x01,0x80,0x05,0x01,0x00,0xFF,0x01,
+	0x20,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0xE0,0x3F,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x30,0x00,0x00,0xFF,0x01,0x80,0x07,0x01,0xC0,0x1E,0x01,0x20,0x33,0x01,0x20,0x3F,0x01,0x20,0x3F,0x01,0x20,0x33,0x01,0x60,0x1E,0x01,0xC0,0x03,0x01,0x80,0x05,0x01,0x00,0xFF,0x01,
 
 	/* Index 26, character 58 ":" (width: 17 pixels) */
-	0x11, 0x00,0xC0,0x01,0x00,0x20,0x01,0xFC,0x1F,0x01,0xFC,0x5F,0x01,0x0C,0x3C,0x01,0x0C,0x5C,0x01,0x0C,0x5C,0x01,0x0C,0x3C,0x01,0x0C,0x5C,0x01,0x0C,0x3C,0x01,0x0C,0x5C,0x01,0x0C,0x5C,0x01,0x0C,0x3C,0x01,0x0C,0x5C,0x01,0xFC,0x1F,0x01,0xFC,0x1F,0x01,0x00,0xE0,0x01,
+	0x00,0xC0,0x01,0x00,0x20,0x01,0xFC,0x1F,0x01,0xFC,0x5F,0x01,0x0C,0x3C,0x01,0x0C,0x5C,0x01,0x0C,0x5C,0x01,0x0C,0x3C,0x01,0x0C,0x5C,0x01,0x0C,0x3C,0x01,0x0C,0x5C,0x01,0x0C,0x5C,0x01,0x0C,0x3C,0x01,0x0C,0x5C,0x01,0xFC,0x1F,0x01,0xFC,0x1F,0x01,0x00,0xE0,0x01,
 
 	/* Index 27, character 59 ";" (width: 15 pixels) */
-	0xF, 0x00,0xFC,0x01,0x00,0x04,0x01,0x00,0x24,0x01,0x00,0xB4,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x04,0x01,0x00,0xFC,0x01,
+	0x00,0xFC,0x01,0x00,0x04,0x01,0x00,0x24,0x01,0x00,0xB4,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x34,0x01,0x00,0x04,0x01,0x00,0xFC,0x01,
 
 	/* Index 28, character 60 "<" (width: 15 pixels) */
-	0xF, 0xFC,0x7F,0x00,0x04,0x80,0x00,0x04,0x00,0x01,0xFC,0x03,0x01,0x04,0xFA,0x01,0x04,0x0A,0x01,0x04,0x0A,0x01,0x04,0xFA,0x01,0x04,0xFA,0x01,0x04,0xFA,0x01,0x04,0xFA,0x01,0x04,0x02,0x01,0xFC,0x03,0x01,0x04,0x00,0x01,0xFC,0xFF,0x01,
+	0xFC,0x7F,0x00,0x04,0x80,0x00,0x04,0x00,0x01,0xFC,0x03,0x01,0x04,0xFA,0x01,0x04,0x0A,0x01,0x04,0x0A,0x01,0x04,0xFA,0x01,0x04,0xFA,0x01,0x04,0xFA,0x01,0x04,0xFA,0x01,0x04,0x02,0x01,0xFC,0x03,0x01,0x04,0x00,0x01,0xFC,0xFF,0x01,
 
 	/* Index 29, character 61 "=" (width: 15 pixels) */
-	0xF, 0xFC,0xFF,0x01,0xC4,0xFF,0x01,0xC4,0xFF,0x01,0xC4,0xFF,0x01,0xC4,0xFF,0x01,0xC4,0xFC,0x01,0x44,0xF8,0x01,0x44,0x08,0x01,0xC4,0xFC,0x01,0xC4,0xFF,0x01,0xC4,0xFF,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0xDC,0xFF,0x01,
+	0xFC,0xFF,0x01,0xC4,0xFF,0x01,0xC4,0xFF,0x01,0xC4,0xFF,0x01,0xC4,0xFF,0x01,0xC4,0xFC,0x01,0x44,0xF8,0x01,0x44,0x08,0x01,0xC4,0xFC,0x01,0xC4,0xFF,0x01,0xC4,0xFF,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0xDC,0xFF,0x01,
 
 	/* Index 30, character 62 ">" (width: 16 pixels) */
-	0x10, 0x80,0x0F,0x00,0x60,0x30,0x00,0x10,0x40,0x00,0x18,0xD8,0x00,0x08,0x8C,0x00,0x04,0x08,0x01,0x04,0x07,0x01,0x74,0x07,0x01,0x74,0x07,0x01,0x04,0x08,0x01,0x04,0x0C,0x01,0x08,0x9C,0x00,0x18,0xC8,0x00,0x10,0x40,0x00,0x60,0x30,0x00,0x80,0x0F,0x00,
+	0x80,0x0F,0x00,0x60,0x30,0x00,0x10,0x40,0x00,0x18,0xD8,0x00,0x08,0x8C,0x00,0x04,0x08,0x01,0x04,0x07,0x01,0x74,0x07,0x01,0x74,0x07,0x01,0x04,0x08,0x01,0x04,0x0C,0x01,0x08,0x9C,0x00,0x18,0xC8,0x00,0x10,0x40,0x00,0x60,0x30,0x00,0x80,0x0F,0x00,
 
 	/* Index 31, character 63 "?" (width: 18 pixels) */
-	0x12, 0x00,0x00,0x01,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x50,0x00,0x00,0xAC,0x00,0x00,0xB2,0x01,0x00,0xD9,0x01,0x00,0xB5,0x01,0x00,0xA9,0x00,0x00,0x19,0x01,0x00,0x06,0x01,0x00,0x06,0x01,0x00,0x06,0x01,0x00,0x0B,0x01,0x00,0x11,0x01,0x80,0xE0,0x00,0x80,0x00,0x00,0x40,0x00,0x00,
+	0x00,0x00,0x01,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x50,0x00,0x00,0xAC,0x00,0x00,0xB2,0x01,0x00,0xD9,0x01,0x00,0xB5,0x01,0x00,0xA9,0x00,0x00,0x19,0x01,0x00,0x06,0x01,0x00,0x06,0x01,0x00,0x06,0x01,0x00,0x0B,0x01,0x00,0x11,0x01,0x80,0xE0,0x00,0x80,0x00,0x00,0x40,0x00,0x00,
 
 	/* Index 32, character 64 "@" (width: 18 pixels) */
-	0x12, 0x40,0x00,0x00,0x80,0x00,0x00,0x80,0xE0,0x00,0x00,0x11,0x01,0x00,0x0B,0x01,0x00,0x06,0x01,0x00,0x06,0x01,0x00,0x06,0x01,0x00,0x19,0x01,0x00,0xA9,0x00,0x00,0xB5,0x01,0x00,0xD9,0x01,0x00,0xB2,0x01,0x00,0xBC,0x00,0x00,0x40,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x00,0x01,
+	0x40,0x00,0x00,0x80,0x00,0x00,0x80,0xE0,0x00,0x00,0x11,0x01,0x00,0x0B,0x01,0x00,0x06,0x01,0x00,0x06,0x01,0x00,0x06,0x01,0x00,0x19,0x01,0x00,0xA9,0x00,0x00,0xB5,0x01,0x00,0xD9,0x01,0x00,0xB2,0x01,0x00,0xBC,0x00,0x00,0x40,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x00,0x01,
 
 	/* Index 33, character 65 "A" (width: 9 pixels) */
-	0x9, 0x00,0x3E,0x00,0x80,0x5B,0x00,0xFF,0x94,0x00,0x87,0x09,0x01,0xF8,0x0E,0x01,0x60,0xC7,0x00,0x1C,0x32,0x00,0xE2,0x0F,0x00,0x1E,0x00,0x00,
+	0x00,0x3E,0x00,0x80,0x5B,0x00,0xFF,0x94,0x00,0x87,0x09,0x01,0xF8,0x0E,0x01,0x60,0xC7,0x00,0x1C,0x32,0x00,0xE2,0x0F,0x00,0x1E,0x00,0x00,
 
 	/* Index 34, character 66 "B" (width: 14 pixels) */
-	0xE, 0x18,0x00,0x00,0x28,0x3E,0x00,0x50,0x5D,0x00,0x9C,0x54,0x00,0xB2,0xA2,0x00,0xCC,0x94,0x00,0xB8,0x98,0x00,0xC8,0x81,0x00,0xFC,0x01,0x01,0x00,0x06,0x01,0x00,0x08,0x02,0x00,0x30,0x02,0x00,0x40,0x01,0x00,0x80,0x00,
+	0x18,0x00,0x00,0x28,0x3E,0x00,0x50,0x5D,0x00,0x9C,0x54,0x00,0xB2,0xA2,0x00,0xCC,0x94,0x00,0xB8,0x98,0x00,0xC8,0x81,0x00,0xFC,0x01,0x01,0x00,0x06,0x01,0x00,0x08,0x02,0x00,0x30,0x02,0x00,0x40,0x01,0x00,0x80,0x00,
 
 	/* Index 35, character 67 "C" (width: 11 pixels) */
-	0xB, 0x00,0x0F,0x00,0x80,0x34,0x00,0x9C,0x76,0x00,0xE6,0x76,0x00,0x08,0x6E,0x00,0x30,0x70,0x00,0x40,0x40,0x00,0x80,0x20,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x0E,0x00,
+	0x00,0x0F,0x00,0x80,0x34,0x00,0x9C,0x76,0x00,0xE6,0x76,0x00,0x08,0x6E,0x00,0x30,0x70,0x00,0x40,0x40,0x00,0x80,0x20,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x0E,0x00,
 
 	/* Index 36, character 68 "D" (width: 11 pixels) */
-	0xB, 0x80,0x03,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x20,0x08,0x00,0x10,0x30,0x00,0x70,0x41,0x00,0xD0,0x82,0x01,0x70,0x3B,0x02,0x70,0xCB,0x01,0x60,0x09,0x00,0x80,0x07,0x00,
+	0x80,0x03,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x20,0x08,0x00,0x10,0x30,0x00,0x70,0x41,0x00,0xD0,0x82,0x01,0x70,0x3B,0x02,0x70,0xCB,0x01,0x60,0x09,0x00,0x80,0x07,0x00,
 
 	/* Index 37, character 69 "E" (width: 17 pixels) */
-	0x11, 0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x03,0x00,0x40,0x0F,0x00,0xC0,0x1B,0x00,0xE0,0x1B,0x00,0xA0,0x19,0x00,0x60,0x1E,0x00,0x40,0x10,0x00,0x40,0x08,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x80,0x03,0x00,
+	0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x03,0x00,0x40,0x0F,0x00,0xC0,0x1B,0x00,0xE0,0x1B,0x00,0xA0,0x19,0x00,0x60,0x1E,0x00,0x40,0x10,0x00,0x40,0x08,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x80,0x03,0x00,
 
 	/* Index 38, character 70 "F" (width: 17 pixels) */
-	0x11, 0x80,0x03,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x08,0x00,0x40,0x18,0x00,0xE0,0x16,0x00,0x20,0x19,0x00,0xE0,0x1B,0x00,0xC0,0x1B,0x00,0x40,0x0F,0x00,0x80,0x03,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,
+	0x80,0x03,0x00,0x40,0x04,0x00,0x40,0x04,0x00,0x40,0x08,0x00,0x40,0x18,0x00,0xE0,0x16,0x00,0x20,0x19,0x00,0xE0,0x1B,0x00,0xC0,0x1B,0x00,0x40,0x0F,0x00,0x80,0x03,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,0x80,0x01,0x00,
 
 	/* Index 39, character 71 "G" (width: 8 pixels) */
-	0x8, 0x00,0x3E,0x00,0x00,0x6F,0x00,0x00,0x91,0x01,0x80,0x17,0x02,0xFE,0x0F,0x02,0xFE,0x16,0x02,0x00,0xF7,0x01,0x00,0x1C,0x00,
+	0x00,0x3E,0x00,0x00,0x6F,0x00,0x00,0x91,0x01,0x80,0x17,0x02,0xFE,0x0F,0x02,0xFE,0x16,0x02,0x00,0xF7,0x01,0x00,0x1C,0x00,
 
 	/* Index 40, character 72 "H" (width: 8 pixels) */
-	0x8, 0xE0,0x00,0x00,0xBE,0x07,0x00,0xC1,0xF9,0x01,0xC1,0xFF,0x01,0xA1,0x07,0x00,0x26,0x02,0x00,0xE8,0x03,0x00,0xF0,0x01,0x00,
+	0xE0,0x00,0x00,0xBE,0x07,0x00,0xC1,0xF9,0x01,0xC1,0xFF,0x01,0xA1,0x07,0x00,0x26,0x02,0x00,0xE8,0x03,0x00,0xF0,0x01,0x00,
 
 	/* Index 41, character 73 "I" (width: 15 pixels) */
-	0xF, 0x38,0x00,0x00,0xD8,0x00,0x00,0x60,0x01,0x00,0xFE,0x3E,0x00,0x9E,0xC1,0x00,0xFE,0x00,0x01,0x01,0x00,0x01,0xFF,0x00,0x01,0xE0,0xC8,0x00,0x1C,0x4B,0x00,0xE2,0x24,0x00,0x1E,0x1A,0x00,0x00,0x09,0x00,0x00,0x05,0x00,0x00,0x02,0x00,
+	0x38,0x00,0x00,0xD8,0x00,0x00,0x60,0x01,0x00,0xFE,0x3E,0x00,0x9E,0xC1,0x00,0xFE,0x00,0x01,0x01,0x00,0x01,0xFF,0x00,0x01,0xE0,0xC8,0x00,0x1C,0x4B,0x00,0xE2,0x24,0x00,0x1E,0x1A,0x00,0x00,0x09,0x00,0x00,0x05,0x00,0x00,0x02,0x00,
 
 	/* Index 42, character 74 "J" (width: 16 pixels) */
-	0x10, 0xC0,0x0F,0x00,0x30,0x30,0x00,0x18,0x60,0x00,0x0C,0xC6,0x00,0x64,0x98,0x00,0x62,0x10,0x01,0x02,0x20,0x01,0x02,0x20,0x01,0x02,0x20,0x01,0x02,0x20,0x01,0x62,0x10,0x01,0x64,0x98,0x00,0x0C,0xC6,0x00,0x18,0x60,0x00,0x30,0x30,0x00,0xC0,0x0F,0x00,
+	0xC0,0x0F,0x00,0x30,0x30,0x00,0x18,0x60,0x00,0x0C,0xC6,0x00,0x64,0x98,0x00,0x62,0x10,0x01,0x02,0x20,0x01,0x02,0x20,0x01,0x02,0x20,0x01,0x02,0x20,0x01,0x62,0x10,0x01,0x64,0x98,0x00,0x0C,0xC6,0x00,0x18,0x60,0x00,0x30,0x30,0x00,0xC0,0x0F,0x00,
 
 	/* Index 43, character 75 "K" (width: 17 pixels) */
-	0x11, 0xC0,0x0F,0x00,0x30,0x30,0x00,0x18,0x60,0x00,0x08,0x40,0x00,0x04,0x88,0x00,0x66,0x88,0x01,0x62,0x08,0x01,0x02,0x08,0x01,0x02,0x08,0x01,0x02,0x08,0x01,0x62,0x08,0x01,0x66,0x88,0x01,0x04,0x88,0x00,0x08,0x40,0x00,0x18,0x60,0x00,0x30,0x30,0x00,0xC0,0x0F,0x00,
+	0xC0,0x0F,0x00,0x30,0x30,0x00,0x18,0x60,0x00,0x08,0x40,0x00,0x04,0x88,0x00,0x66,0x88,0x01,0x62,0x08,0x01,0x02,0x08,0x01,0x02,0x08,0x01,0x02,0x08,0x01,0x62,0x08,0x01,0x66,0x88,0x01,0x04,0x88,0x00,0x08,0x40,0x00,0x18,0x60,0x00,0x30,0x30,0x00,0xC0,0x0F,0x00,
 
 	/* Index 44, character 76 "L" (width: 16 pixels) */
-	0x10, 0xC0,0x0F,0x00,0x30,0x30,0x00,0x18,0x60,0x00,0x0C,0xD8,0x00,0x64,0x8C,0x00,0x62,0x06,0x01,0x02,0x02,0x01,0x02,0x02,0x01,0x02,0x02,0x01,0x02,0x02,0x01,0x62,0x06,0x01,0x64,0x8C,0x00,0x0C,0xD8,0x00,0x18,0x60,0x00,0x30,0x30,0x00,0xC0,0x0F,0x00,
+	0xC0,0x0F,0x00,0x30,0x30,0x00,0x18,0x60,0x00,0x0C,0xD8,0x00,0x64,0x8C,0x00,0x62,0x06,0x01,0x02,0x02,0x01,0x02,0x02,0x01,0x02,0x02,0x01,0x02,0x02,0x01,0x62,0x06,0x01,0x64,0x8C,0x00,0x0C,0xD8,0x00,0x18,0x60,0x00,0x30,0x30,0x00,0xC0,0x0F,0x00,
 
 	/* Index 45, character 77 "M" (width: 21 pixels) */
-	0x15, 0x00,0x3C,0x00,0x00,0x7F,0x00,0x80,0xFF,0x00,0x80,0xFF,0x01,0xE0,0xFF,0x01,0xF8,0xFF,0x01,0xE4,0xFF,0x01,0x84,0xFF,0x01,0x84,0xFF,0x00,0x08,0x7F,0x00,0x10,0x3E,0x00,0x20,0x00,0x00,0x66,0x00,0x00,0x48,0x07,0x00,0xC0,0x00,0x00,0x4E,0x00,0x00,0x90,0x01,0x00,0xA8,0x02,0x00,0xA4,0x00,0x00,0x02,0x01,0x00,0x00,0x01,0x00,
+	0x00,0x3C,0x00,0x00,0x7F,0x00,0x80,0xFF,0x00,0x80,0xFF,0x01,0xE0,0xFF,0x01,0xF8,0xFF,0x01,0xE4,0xFF,0x01,0x84,0xFF,0x01,0x84,0xFF,0x00,0x08,0x7F,0x00,0x10,0x3E,0x00,0x20,0x00,0x00,0x66,0x00,0x00,0x48,0x07,0x00,0xC0,0x00,0x00,0x4E,0x00,0x00,0x90,0x01,0x00,0xA8,0x02,0x00,0xA4,0x00,0x00,0x02,0x01,0x00,0x00,0x01,0x00,
 
 	/* Index 46, character 78 "N" (width: 10 pixels) */
-	0xA, 0x00,0x98,0x01,0x00,0x98,0x01,0x7C,0x90,0x01,0x9E,0x52,0x00,0x9E,0x65,0x00,0x7E,0x25,0x00,0x9E,0x67,0x00,0xDE,0x50,0x00,0x3C,0x90,0x01,0x00,0x98,0x00,
+	0x00,0x98,0x01,0x00,0x98,0x01,0x7C,0x90,0x01,0x9E,0x52,0x00,0x9E,0x65,0x00,0x7E,0x25,0x00,0x9E,0x67,0x00,0xDE,0x50,0x00,0x3C,0x90,0x01,0x00,0x98,0x00,
 
 	/* Index 47, character 79 "O" (width: 14 pixels) */
-	0xE, 0xFE,0xFF,0x07,0x10,0x08,0x00,0x08,0x08,0x00,0x04,0x04,0x00,0x04,0x04,0x00,0x04,0x04,0x00,0x0C,0x78,0x00,0xF8,0xDF,0x00,0x80,0x80,0x00,0x80,0x80,0x00,0x80,0x80,0x00,0x80,0x80,0x00,0x40,0x40,0x00,0xC0,0x7F,0x00,
+	0xFE,0xFF,0x07,0x10,0x08,0x00,0x08,0x08,0x00,0x04,0x04,0x00,0x04,0x04,0x00,0x04,0x04,0x00,0x0C,0x78,0x00,0xF8,0xDF,0x00,0x80,0x80,0x00,0x80,0x80,0x00,0x80,0x80,0x00,0x80,0x80,0x00,0x40,0x40,0x00,0xC0,0x7F,0x00,
 
 	/* Index 48, character 80 "P" (width: 20 pixels) */
-	0x14, 0x3E,0x00,0x00,0xE8,0x1F,0x00,0x08,0xE2,0x01,0x04,0x01,0x00,0x84,0x00,0x00,0x84,0x0F,0x00,0x84,0x14,0x00,0x4C,0x13,0x00,0xB8,0x10,0x00,0x80,0x11,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x12,0x00,0x00,0x0A,0x00,0x00,0x0A,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,0x01,0x00,0x00,0x01,0x00,
+	0x3E,0x00,0x00,0xE8,0x1F,0x00,0x08,0xE2,0x01,0x04,0x01,0x00,0x84,0x00,0x00,0x84,0x0F,0x00,0x84,0x14,0x00,0x4C,0x13,0x00,0xB8,0x10,0x00,0x80,0x11,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x12,0x00,0x00,0x0A,0x00,0x00,0x0A,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,0x01,0x00,0x00,0x01,0x00,
 
 	/* Index 49, character 81 "Q" (width: 14 pixels) */
-	0xE, 0x40,0x04,0x00,0x80,0x03,0x00,0x00,0x01,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x02,0x03,0x01,0x0E,0xC3,0x01,0x7C,0xFB,0x00,0xF0,0x3F,0x00,0xE0,0x0F,0x00,0x80,0x07,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
+	0x40,0x04,0x00,0x80,0x03,0x00,0x00,0x01,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x02,0x03,0x01,0x0E,0xC3,0x01,0x7C,0xFB,0x00,0xF0,0x3F,0x00,0xE0,0x0F,0x00,0x80,0x07,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
 
 	/* Index 50, character 82 "R" (width: 15 pixels) */
-	0xF, 0x00,0x01,0x00,0x00,0x11,0x00,0x80,0x1F,0x00,0x70,0x10,0x00,0x30,0x20,0x00,0x20,0xC0,0x00,0x10,0x40,0x00,0x1C,0x40,0x00,0x10,0x40,0x00,0x20,0xC0,0x00,0x30,0x20,0x00,0x70,0x14,0x00,0x80,0x1B,0x00,0x00,0x11,0x00,0x00,0x01,0x00,
+	0x00,0x01,0x00,0x00,0x11,0x00,0x80,0x1F,0x00,0x70,0x10,0x00,0x30,0x20,0x00,0x20,0xC0,0x00,0x10,0x40,0x00,0x1C,0x40,0x00,0x10,0x40,0x00,0x20,0xC0,0x00,0x30,0x20,0x00,0x70,0x14,0x00,0x80,0x1B,0x00,0x00,0x11,0x00,0x00,0x01,0x00,
 
 	/* Index 51, character 83 "S" (width: 10 pixels) */
-	0xA, 0x00,0x3C,0x00,0x00,0xFE,0x00,0x80,0xFF,0x00,0xC0,0xFF,0x01,0xF8,0xFF,0x01,0xF0,0xFF,0x01,0xC0,0xFF,0x01,0x80,0xFF,0x00,0x00,0xFE,0x00,0x00,0x3C,0x00,
+	0x00,0x3C,0x00,0x00,0xFE,0x00,0x80,0xFF,0x00,0xC0,0xFF,0x01,0xF8,0xFF,0x01,0xF0,0xFF,0x01,0xC0,0xFF,0x01,0x80,0xFF,0x00,0x00,0xFE,0x00,0x00,0x3C,0x00,
 
 	/* Index 52, character 84 "T" (width: 15 pixels) */
-	0xF, 0x20,0x25,0x00,0x40,0x15,0x00,0xC0,0x18,0x00,0xF0,0x78,0x00,0x80,0x08,0x00,0x08,0x85,0x00,0x10,0x42,0x00,0xFC,0xFF,0x01,0x10,0x42,0x00,0x08,0x85,0x00,0x80,0x08,0x00,0xF0,0x78,0x00,0xC0,0x18,0x00,0x40,0x15,0x00,0x20,0x25,0x00,
+	0x20,0x25,0x00,0x40,0x15,0x00,0xC0,0x18,0x00,0xF0,0x78,0x00,0x80,0x08,0x00,0x08,0x85,0x00,0x10,0x42,0x00,0xFC,0xFF,0x01,0x10,0x42,0x00,0x08,0x85,0x00,0x80,0x08,0x00,0xF0,0x78,0x00,0xC0,0x18,0x00,0x40,0x15,0x00,0x20,0x25,0x00,
 
 	/* Index 53, character 85 "U" (width: 12 pixels) */
-	0xC, 0xC0,0x03,0x00,0x40,0x02,0x00,0x40,0x02,0x00,0x40,0x02,0x00,0x7C,0xFE,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x7C,0xFE,0x01,0x40,0x02,0x00,0x40,0x02,0x00,0x40,0x02,0x00,0xC0,0x03,0x00,
+	0xC0,0x03,0x00,0x40,0x02,0x00,0x40,0x02,0x00,0x40,0x02,0x00,0x7C,0xFE,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x7C,0xFE,0x01,0x40,0x02,0x00,0x40,0x02,0x00,0x40,0x02,0x00,0xC0,0x03,0x00,
 
 	/* Index 54, character 86 "V" (width: 13 pixels) */
-	0xD, 0xE0,0x01,0x00,0x20,0x01,0x00,0x20,0x01,0x00,0x20,0x01,0x00,0x3E,0xFF,0x01,0x02,0x80,0x01,0x02,0x80,0x01,0x3E,0xFF,0x01,0x3E,0xFF,0x01,0x20,0x03,0x00,0x20,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,
+	0xE0,0x01,0x00,0x20,0x01,0x00,0x20,0x01,0x00,0x20,0x01,0x00,0x3E,0xFF,0x01,0x02,0x80,0x01,0x02,0x80,0x01,0x3E,0xFF,0x01,0x3E,0xFF,0x01,0x20,0x03,0x00,0x20,0x03,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,
 
 	/* Index 55, character 87 "W" (width: 12 pixels) */
-	0xC, 0x80,0x01,0x00,0x80,0x01,0x00,0xE0,0x07,0x00,0xB0,0x0D,0x00,0x90,0x09,0x00,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0x90,0x09,0x00,0xB0,0x0D,0x00,0xE0,0x07,0x00,0x80,0x01,0x00,0x80,0x01,0x00,
+	0x80,0x01,0x00,0x80,0x01,0x00,0xE0,0x07,0x00,0xB0,0x0D,0x00,0x90,0x09,0x00,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0x90,0x09,0x00,0xB0,0x0D,0x00,0xE0,0x07,0x00,0x80,0x01,0x00,0x80,0x01,0x00,
 
 	/* Index 56, character 88 "X" (width: 12 pixels) */
-	0xC, 0xE0,0x1F,0x00,0x80,0x07,0x00,0x08,0x43,0x00,0x08,0x43,0x00,0x18,0x63,0x00,0xF8,0x7F,0x00,0xF8,0x7E,0x00,0x18,0x63,0x00,0x08,0x43,0x00,0x08,0x43,0x00,0x80,0x07,0x00,0xE0,0x1F,0x00,
+	0xE0,0x1F,0x00,0x80,0x07,0x00,0x08,0x43,0x00,0x08,0x43,0x00,0x18,0x63,0x00,0xF8,0x7F,0x00,0xF8,0x7E,0x00,0x18,0x63,0x00,0x08,0x43,0x00,0x08,0x43,0x00,0x80,0x07,0x00,0xE0,0x1F,0x00,
 
 	/* Index 57, character 89 "Y" (width: 13 pixels) */
-	0xD, 0x20,0x10,0x00,0xE0,0x1C,0x00,0xA0,0x17,0x00,0xE0,0x1F,0x00,0x60,0x18,0x00,0x38,0x70,0x00,0x26,0x90,0x01,0x38,0x70,0x00,0x60,0x18,0x00,0xE0,0x1F,0x00,0xA0,0x17,0x00,0xE0,0x1C,0x00,0x20,0x10,0x00,
+	0x20,0x10,0x00,0xE0,0x1C,0x00,0xA0,0x17,0x00,0xE0,0x1F,0x00,0x60,0x18,0x00,0x38,0x70,0x00,0x26,0x90,0x01,0x38,0x70,0x00,0x60,0x18,0x00,0xE0,0x1F,0x00,0xA0,0x17,0x00,0xE0,0x1C,0x00,0x20,0x10,0x00,
 
 	/* Index 58, character 90 "Z" (width: 14 pixels) */
-	0xE, 0x80,0x0F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0x78,0xF0,0x00,0x18,0xC0,0x00,0x0C,0x80,0x01,0x0C,0x80,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x08,0x0A,0x01,0x08,0x06,0x01,0x00,0x07,0x00,0x00,0x0A,0x00,
+	0x80,0x0F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0x78,0xF0,0x00,0x18,0xC0,0x00,0x0C,0x80,0x01,0x0C,0x80,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x08,0x0A,0x01,0x08,0x06,0x01,0x00,0x07,0x00,0x00,0x0A,0x00,
 
 	/* Index 59, character 91 "[" (width: 15 pixels) */
-	0xF, 0xE0,0x0F,0x00,0xD0,0x3F,0x00,0xE8,0x7F,0x00,0x64,0xFC,0x00,0x64,0xFC,0x00,0xE2,0xFF,0x01,0xC2,0xFF,0x01,0x02,0xF8,0x01,0x02,0xF0,0x01,0x02,0xE0,0x01,0x04,0xE3,0x00,0x0C,0xE3,0x00,0x18,0x70,0x00,0x30,0x38,0x00,0xC0,0x0F,0x00,
+	0xE0,0x0F,0x00,0xD0,0x3F,0x00,0xE8,0x7F,0x00,0x64,0xFC,0x00,0x64,0xFC,0x00,0xE2,0xFF,0x01,0xC2,0xFF,0x01,0x02,0xF8,0x01,0x02,0xF0,0x01,0x02,0xE0,0x01,0x04,0xE3,0x00,0x0C,0xE3,0x00,0x18,0x70,0x00,0x30,0x38,0x00,0xC0,0x0F,0x00,
 
 	/* Index 60, character 92 "\" (width: 15 pixels) */
-	0xF, 0x00,0x0C,0x00,0x00,0x30,0x00,0xE0,0xC0,0x00,0x60,0xC0,0x00,0x60,0x84,0x01,0x68,0x86,0x01,0xD0,0x83,0x01,0x34,0xCE,0x01,0x34,0xF3,0x00,0x38,0x03,0x00,0x98,0x3F,0x00,0xC0,0x60,0x00,0xC0,0x60,0x00,0xC0,0x31,0x00,0x80,0x1F,0x00,
+	0x00,0x0C,0x00,0x00,0x30,0x00,0xE0,0xC0,0x00,0x60,0xC0,0x00,0x60,0x84,0x01,0x68,0x86,0x01,0xD0,0x83,0x01,0x34,0xCE,0x01,0x34,0xF3,0x00,0x38,0x03,0x00,0x98,0x3F,0x00,0xC0,0x60,0x00,0xC0,0x60,0x00,0xC0,0x31,0x00,0x80,0x1F,0x00,
 
 	/* Index 61, character 93 "]" (width: 16 pixels) */
-	0x10, 0x00,0x03,0x00,0x00,0x03,0x00,0xD8,0x6F,0x00,0xF8,0x7F,0x00,0x70,0x3B,0x00,0x78,0x7B,0x00,0x98,0x67,0x00,0xFE,0xFC,0x01,0xFE,0xFC,0x01,0x98,0x67,0x00,0x78,0x7B,0x00,0x70,0x3B,0x00,0xF8,0x7F,0x00,0xD8,0x6F,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
+	0x00,0x03,0x00,0x00,0x03,0x00,0xD8,0x6F,0x00,0xF8,0x7F,0x00,0x70,0x3B,0x00,0x78,0x7B,0x00,0x98,0x67,0x00,0xFE,0xFC,0x01,0xFE,0xFC,0x01,0x98,0x67,0x00,0x78,0x7B,0x00,0x70,0x3B,0x00,0xF8,0x7F,0x00,0xD8,0x6F,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
 
 	/* Index 62, character 94 "^" (width: 22 pixels) */
-	0x16, 0x78,0x00,0x00,0xFC,0x01,0x00,0x0E,0x01,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x78,0x00,0x00,0xE0,0x01,0x00,0x80,0x3F,0x00,0x00,0xF8,0x1F,0x00,0xF8,0x1F,0x80,0x3F,0x00,0xE0,0x01,0x00,0x38,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x06,0x01,0x00,0xFC,0x01,0x00,0x78,0x00,0x00,
+	0x78,0x00,0x00,0xFC,0x01,0x00,0x0E,0x01,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x78,0x00,0x00,0xE0,0x01,0x00,0x80,0x3F,0x00,0x00,0xF8,0x1F,0x00,0xF8,0x1F,0x80,0x3F,0x00,0xE0,0x01,0x00,0x38,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x06,0x01,0x00,0xFC,0x01,0x00,0x78,0x00,0x00,
 
 	/* Index 63, character 95 "_" (width: 19 pixels) */
-	0x13, 0x02,0x00,0x00,0x02,0x00,0x00,0x0C,0x00,0x00,0x1C,0xF0,0x01,0x70,0x0C,0x02,0xC0,0x06,0x0C,0x80,0x03,0x08,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x80,0x03,0x08,0xC0,0x06,0x0C,0x70,0x0C,0x06,0x1C,0xF0,0x01,0x0C,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,
+	0x02,0x00,0x00,0x02,0x00,0x00,0x0C,0x00,0x00,0x1C,0xF0,0x01,0x70,0x0C,0x02,0xC0,0x06,0x0C,0x80,0x03,0x08,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x00,0x01,0x10,0x80,0x03,0x08,0xC0,0x06,0x0C,0x70,0x0C,0x06,0x1C,0xF0,0x01,0x0C,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,
 
 	/* Index 64, character 96 "`" (width: 17 pixels) */
-	0x11, 0x02,0x00,0x02,0x02,0x00,0x02,0x04,0x00,0x01,0x04,0x00,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x02,0x00,0x02,0x02,0x00,0x02,
+	0x02,0x00,0x02,0x02,0x00,0x02,0x04,0x00,0x01,0x04,0x00,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0x04,0x00,0x01,0x04,0x00,0x01,0x02,0x00,0x02,0x02,0x00,0x02,
 
 	/* Index 65, character 97 "a" (width: 19 pixels) */
-	0x13, 0xC0,0x43,0x00,0x20,0x44,0x00,0x10,0xC8,0x00,0x18,0xC8,0x00,0x18,0x88,0x00,0x18,0x88,0x01,0x2C,0x84,0x01,0xCC,0x83,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x9E,0x01,0x0C,0xA1,0x01,0x8C,0xC0,0x00,0x88,0xC0,0x00,0x98,0xC0,0x00,0x98,0x40,0x00,0x10,0x21,0x00,0x10,0x1E,0x00,
+	0xC0,0x43,0x00,0x20,0x44,0x00,0x10,0xC8,0x00,0x18,0xC8,0x00,0x18,0x88,0x00,0x18,0x88,0x01,0x2C,0x84,0x01,0xCC,0x83,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x9E,0x01,0x0C,0xA1,0x01,0x8C,0xC0,0x00,0x88,0xC0,0x00,0x98,0xC0,0x00,0x98,0x40,0x00,0x10,0x21,0x00,0x10,0x1E,0x00,
 
 	/* Index 66, character 98 "b" (width: 16 pixels) */
-	0x10, 0x00,0x78,0x00,0x00,0x84,0x00,0x00,0x02,0x01,0x00,0x02,0x01,0x78,0x02,0x01,0xFC,0x03,0x01,0x06,0x87,0x00,0x03,0x78,0x00,0x01,0x00,0x00,0x01,0x80,0x07,0x01,0xF0,0x0F,0x03,0xFC,0x18,0x06,0x1F,0x10,0xFC,0x07,0x10,0xF8,0x01,0x18,0x00,0x00,0x08,
+	0x00,0x78,0x00,0x00,0x84,0x00,0x00,0x02,0x01,0x00,0x02,0x01,0x78,0x02,0x01,0xFC,0x03,0x01,0x06,0x87,0x00,0x03,0x78,0x00,0x01,0x00,0x00,0x01,0x80,0x07,0x01,0xF0,0x0F,0x03,0xFC,0x18,0x06,0x1F,0x10,0xFC,0x07,0x10,0xF8,0x01,0x18,0x00,0x00,0x08,
 
 	/* Index 67, character 99 "c" (width: 16 pixels) */
-	0x10, 0x02,0x00,0x00,0xFE,0xFF,0x01,0xF8,0xFF,0x01,0x38,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0xFE,0xFF,0x01,0xF8,0xFF,0x09,0x1C,0x00,0x08,0x06,0x00,0x0C,0xFE,0xFF,0x07,0xF8,0xFF,0x0F,0xC0,0x01,0x1B,0x60,0xC0,0x01,0xE0,0xFF,0x00,0x80,0x1F,0x00,
+	0x02,0x00,0x00,0xFE,0xFF,0x01,0xF8,0xFF,0x01,0x38,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0xFE,0xFF,0x01,0xF8,0xFF,0x09,0x1C,0x00,0x08,0x06,0x00,0x0C,0xFE,0xFF,0x07,0xF8,0xFF,0x0F,0xC0,0x01,0x1B,0x60,0xC0,0x01,0xE0,0xFF,0x00,0x80,0x1F,0x00,
 
 	/* Index 68, character 100 "d" (width: 16 pixels) */
-	0x10, 0x00,0x63,0x00,0x00,0x63,0x00,0x70,0x63,0x00,0xF8,0x63,0x00,0x8C,0x63,0x00,0x0E,0x63,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0E,0x63,0x00,0x8C,0x63,0x00,0xF8,0x63,0x00,0x70,0x63,0x00,0x00,0x63,0x00,0x00,0x63,0x00,
+	0x00,0x63,0x00,0x00,0x63,0x00,0x70,0x63,0x00,0xF8,0x63,0x00,0x8C,0x63,0x00,0x0E,0x63,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x0E,0x63,0x00,0x8C,0x63,0x00,0xF8,0x63,0x00,0x70,0x63,0x00,0x00,0x63,0x00,0x00,0x63,0x00,
 
 	/* Index 69, character 101 "e" (width: 18 pixels) */
-	0x12, 0x04,0x00,0x00,0xFC,0xFF,0x01,0xF0,0xFF,0x01,0x30,0x00,0x00,0x18,0x00,0x00,0x0C,0x00,0x00,0xFC,0xFF,0x01,0xF0,0xFF,0x01,0x30,0x00,0x00,0x0C,0x00,0x00,0xFC,0xFF,0x03,0xF0,0xFF,0x07,0x00,0x00,0x0C,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x1C,0x00,0x00,0x08,
+	0x04,0x00,0x00,0xFC,0xFF,0x01,0xF0,0xFF,0x01,0x30,0x00,0x00,0x18,0x00,0x00,0x0C,0x00,0x00,0xFC,0xFF,0x01,0xF0,0xFF,0x01,0x30,0x00,0x00,0x0C,0x00,0x00,0xFC,0xFF,0x03,0xF0,0xFF,0x07,0x00,0x00,0x0C,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x1C,0x00,0x00,0x08,
 
 	/* Index 70, character 102 "f" (width: 16 pixels) */
-	0x10, 0x00,0x80,0x00,0x00,0xC0,0x01,0x80,0xE1,0x00,0x00,0x73,0x00,0x00,0x3E,0x00,0x00,0x1C,0x00,0x00,0x1E,0x00,0x06,0x37,0x00,0x86,0x63,0x00,0xC6,0x41,0x00,0xE6,0x00,0x00,0x74,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0xFC,0x03,0x00,0xC0,0x03,0x00,
+	0x00,0x80,0x00,0x00,0xC0,0x01,0x80,0xE1,0x00,0x00,0x73,0x00,0x00,0x3E,0x00,0x00,0x1C,0x00,0x00,0x1E,0x00,0x06,0x37,0x00,0x86,0x63,0x00,0xC6,0x41,0x00,0xE6,0x00,0x00,0x74,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0xFC,0x03,0x00,0xC0,0x03,0x00,
 
 	/* Index 71, character 103 "g" (width: 19 pixels) */
-	0x13, 0x04,0x00,0x00,0x04,0x00,0x00,0x0C,0x00,0x00,0xF8,0x00,0x00,0xE0,0x1F,0x00,0x80,0x1F,0x00,0xE0,0x01,0x08,0x18,0x00,0x08,0x04,0x00,0x08,0x1C,0x00,0x0C,0xF0,0x1F,0x07,0x00,0xFC,0x01,0x00,0xF0,0x00,0x00,0x88,0x01,0x00,0x04,0x01,0x00,0x04,0x01,0x00,0x04,0x01,0x00,0x88,0x00,0x00,0x70,0x00,
+	0x04,0x00,0x00,0x04,0x00,0x00,0x0C,0x00,0x00,0xF8,0x00,0x00,0xE0,0x1F,0x00,0x80,0x1F,0x00,0xE0,0x01,0x08,0x18,0x00,0x08,0x04,0x00,0x08,0x1C,0x00,0x0C,0xF0,0x1F,0x07,0x00,0xFC,0x01,0x00,0xF0,0x00,0x00,0x88,0x01,0x00,0x04,0x01,0x00,0x04,0x01,0x00,0x04,0x01,0x00,0x88,0x00,0x00,0x70,0x00,
 
 	/* Index 72, character 104 "h" (width: 19 pixels) */
-	0x13, 0x80,0x80,0x00,0x40,0x40,0x00,0x60,0x60,0x00,0x20,0x20,0x00,0x10,0x10,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x40,0x40,0x00,0x60,0x60,0x00,0x30,0x30,0x00,0x10,0x10,0x00,0x78,0x78,0x00,0xE0,0xC0,0x00,0x60,0x40,0x00,0x20,0x20,0x00,0x30,0x30,0x00,0x18,0x18,0x00,0x70,0x70,0x00,0xC0,0xC0,0x00,
+	0x80,0x80,0x00,0x40,0x40,0x00,0x60,0x60,0x00,0x20,0x20,0x00,0x10,0x10,0x00,0x38,0x38,0x00,0xE0,0xE0,0x00,0x40,0x40,0x00,0x60,0x60,0x00,0x30,0x30,0x00,0x10,0x10,0x00,0x78,0x78,0x00,0xE0,0xC0,0x00,0x60,0x40,0x00,0x20,0x20,0x00,0x30,0x30,0x00,0x18,0x18,0x00,0x70,0x70,0x00,0xC0,0xC0,0x00,
 
 	/* Index 73, character 105 "i" (width: 12 pixels) */
-	0xC, 0x06,0x81,0x01,0x0E,0xC1,0x01,0x3C,0xF1,0x00,0xF0,0x3F,0x00,0xC0,0x0F,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0xC0,0x0F,0x00,0xF0,0x3F,0x00,0x1C,0xF1,0x00,0x06,0x81,0x01,0x02,0x01,0x01,
+	0x06,0x81,0x01,0x0E,0xC1,0x01,0x3C,0xF1,0x00,0xF0,0x3F,0x00,0xC0,0x0F,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0xC0,0x0F,0x00,0xF0,0x3F,0x00,0x1C,0xF1,0x00,0x06,0x81,0x01,0x02,0x01,0x01,
 
 	/* Index 74, character 106 "j" (width: 21 pixels) */
-	0x15, 0x00,0x78,0x00,0x00,0xFE,0x00,0x00,0x93,0x01,0x80,0x90,0x01,0x40,0x10,0x01,0x40,0x08,0x01,0x40,0x0C,0x01,0xC0,0x07,0x01,0x80,0x03,0x01,0x00,0x81,0x00,0x80,0x41,0x00,0x80,0x21,0x04,0x80,0xD1,0x07,0x80,0xFF,0x03,0x00,0x3F,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x40,0x01,0x00,0xE0,0x00,0x00,
+	0x00,0x78,0x00,0x00,0xFE,0x00,0x00,0x93,0x01,0x80,0x90,0x01,0x40,0x10,0x01,0x40,0x08,0x01,0x40,0x0C,0x01,0xC0,0x07,0x01,0x80,0x03,0x01,0x00,0x81,0x00,0x80,0x41,0x00,0x80,0x21,0x04,0x80,0xD1,0x07,0x80,0xFF,0x03,0x00,0x3F,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x40,0x01,0x00,0xE0,0x00,0x00,
 
 	/* Index 75, character 107 "k" (width: 25 pixels) */
-	0x19, 0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xC6,0x01,0x00,0x81,0x01,0xF0,0x01,0x01,0xFC,0x03,0x01,0x84,0x0F,0x01,0x82,0x3E,0x01,0x42,0xFC,0x00,0x62,0xE2,0x00,0x3E,0xC3,0x01,0x9C,0xC1,0x03,0x80,0x41,0x07,0x80,0x21,0x06,0x80,0x19,0x04,0x80,0x0F,0x0C,0x80,0x03,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x00,0x04,0x48,0x10,0x06,0x38,0xF0,0x03,0x00,0xF0,0x00,
+	0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xC6,0x01,0x00,0x81,0x01,0xF0,0x01,0x01,0xFC,0x03,0x01,0x84,0x0F,0x01,0x82,0x3E,0x01,0x42,0xFC,0x00,0x62,0xE2,0x00,0x3E,0xC3,0x01,0x9C,0xC1,0x03,0x80,0x41,0x07,0x80,0x21,0x06,0x80,0x19,0x04,0x80,0x0F,0x0C,0x80,0x03,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x01,0x08,0x80,0x00,0x04,0x48,0x10,0x06,0x38,0xF0,0x03,0x00,0xF0,0x00,
 
 	/* Index 76, character 108 "l" (width: 12 pixels) */
-	0xC, 0x80,0x07,0x00,0xE0,0x1F,0x00,0xF0,0x3F,0x00,0xF0,0x3F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF0,0x3F,0x00,0xF0,0x3F,0x00,0xE0,0x1F,0x00,0x80,0x07,0x00,
+	0x80,0x07,0x00,0xE0,0x1F,0x00,0xF0,0x3F,0x00,0xF0,0x3F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF0,0x3F,0x00,0xF0,0x3F,0x00,0xE0,0x1F,0x00,0x80,0x07,0x00,
 
 	/* Index 77, character 109 "m" (width: 16 pixels) */
-	0x10, 0xC0,0x0F,0x00,0x60,0x18,0x00,0x10,0x20,0x00,0x08,0x40,0x00,0x0C,0xC0,0x00,0x04,0x80,0x00,0x04,0x80,0x01,0x04,0x80,0x01,0x04,0x80,0x01,0x08,0xC0,0x01,0x08,0xC0,0x01,0x18,0xE0,0x01,0x70,0xF8,0x00,0xE0,0x7F,0x00,0xC0,0x3F,0x00,0x80,0x1F,0x00,
+	0xC0,0x0F,0x00,0x60,0x18,0x00,0x10,0x20,0x00,0x08,0x40,0x00,0x0C,0xC0,0x00,0x04,0x80,0x00,0x04,0x80,0x01,0x04,0x80,0x01,0x04,0x80,0x01,0x08,0xC0,0x01,0x08,0xC0,0x01,0x18,0xE0,0x01,0x70,0xF8,0x00,0xE0,0x7F,0x00,0xC0,0x3F,0x00,0x80,0x1F,0x00,
 
 	/* Index 78, character 110 "n" (width: 12 pixels) */
-	0xC, 0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,
+	0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,
 
 	/* Index 79, character 111 "o" (width: 15 pixels) */
-	0xF, 0xFC,0xFF,0x01,0xFC,0xFF,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,
+	0xFC,0xFF,0x01,0xFC,0xFF,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,
 
 	/* Index 80, character 112 "p" (width: 15 pixels) */
-	0xF, 0xFC,0xFF,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,
+	0xFC,0xFF,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,
 
 	/* Index 81, character 113 "q" (width: 15 pixels) */
-	0xF, 0xFC,0xFF,0x00,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0xF8,0xFF,0x01,
+	0xFC,0xFF,0x00,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0x04,0xC0,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0xF8,0xFF,0x01,
 
 	/* Index 82, character 114 "r" (width: 15 pixels) */
-	0xF, 0xF8,0xFF,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x00,
+	0xF8,0xFF,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0x1C,0x00,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x00,
 
 	/* Index 83, character 115 "s" (width: 6 pixels) */
-	0x6, 0x00,0x02,0x00,0x80,0x0F,0x00,0xC0,0x1F,0x00,0xC0,0x1F,0x00,0x80,0x0F,0x00,0x00,0x02,0x00,
+	0x00,0x02,0x00,0x80,0x0F,0x00,0xC0,0x1F,0x00,0xC0,0x1F,0x00,0x80,0x0F,0x00,0x00,0x02,0x00,
 
 	/* Index 84, character 116 "t" (width: 12 pixels) */
-	0xC, 0x00,0x02,0x00,0x80,0x0F,0x00,0xC0,0x1F,0x00,0xE0,0x3F,0x00,0xF8,0xFF,0x00,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0xF8,0xFF,0x00,0xE0,0x3F,0x00,0xC0,0x1F,0x00,0x80,0x0F,0x00,0x00,0x02,0x00,
+	0x00,0x02,0x00,0x80,0x0F,0x00,0xC0,0x1F,0x00,0xE0,0x3F,0x00,0xF8,0xFF,0x00,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0xF8,0xFF,0x00,0xE0,0x3F,0x00,0xC0,0x1F,0x00,0x80,0x0F,0x00,0x00,0x02,0x00,
 
 	/* Index 85, character 117 "u" (width: 17 pixels) */
-	0x11, 0x00,0x02,0x00,0x00,0x07,0x00,0x80,0x0F,0x00,0xC0,0x1F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0xF8,0xFF,0x00,0xFC,0xFF,0x01,0xFE,0xFF,0x03,0xFC,0xFF,0x01,0xF8,0xFF,0x00,0xF0,0x7F,0x00,0xE0,0x3F,0x00,0xC0,0x1F,0x00,0x80,0x0F,0x00,0x00,0x07,0x00,0x00,0x02,0x00,
+	0x00,0x02,0x00,0x00,0x07,0x00,0x80,0x0F,0x00,0xC0,0x1F,0x00,0xE0,0x3F,0x00,0xF0,0x7F,0x00,0xF8,0xFF,0x00,0xFC,0xFF,0x01,0xFE,0xFF,0x03,0xFC,0xFF,0x01,0xF8,0xFF,0x00,0xF0,0x7F,0x00,0xE0,0x3F,0x00,0xC0,0x1F,0x00,0x80,0x0F,0x00,0x00,0x07,0x00,0x00,0x02,0x00,
 
 	/* Index 86, character 118 "v" (width: 15 pixels) */
-	0xF, 0x00,0x02,0x00,0x00,0x07,0x00,0x80,0x0F,0x00,0x80,0x0F,0x00,0x00,0x07,0x00,0x30,0x62,0x00,0x78,0xF0,0x00,0xFC,0xF8,0x01,0x78,0xF0,0x00,0x30,0x62,0x00,0x00,0x07,0x00,0x80,0x0F,0x00,0x80,0x0F,0x00,0x00,0x07,0x00,0x00,0x02,0x00,
+	0x00,0x02,0x00,0x00,0x07,0x00,0x80,0x0F,0x00,0x80,0x0F,0x00,0x00,0x07,0x00,0x30,0x62,0x00,0x78,0xF0,0x00,0xFC,0xF8,0x01,0x78,0xF0,0x00,0x30,0x62,0x00,0x00,0x07,0x00,0x80,0x0F,0x00,0x80,0x0F,0x00,0x00,0x07,0x00,0x00,0x02,0x00,
 
 	/* Index 87, character 119 "w" (width: 9 pixels) */
-	0x9, 0x00,0x02,0x00,0x00,0x07,0x00,0x80,0x0F,0x00,0xC0,0x1F,0x00,0xE0,0x3F,0x00,0xC0,0x1F,0x00,0x80,0x0F,0x00,0x00,0x07,0x00,0x00,0x02,0x00,
+	0x00,0x02,0x00,0x00,0x07,0x00,0x80,0x0F,0x00,0xC0,0x1F,0x00,0xE0,0x3F,0x00,0xC0,0x1F,0x00,0x80,0x0F,0x00,0x00,0x07,0x00,0x00,0x02,0x00,
 
 	/* Index 88, character 120 "x" (width: 19 pixels) */
-	0x13, 0xFC,0xFF,0x01,0xFC,0xFF,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x4C,0xB0,0x01,0xCC,0xB8,0x01,0x8C,0x9D,0x01,0x0C,0x8F,0x01,0x0C,0x86,0x01,0x0C,0x8F,0x01,0x8C,0x9D,0x01,0xCC,0xB8,0x01,0x4C,0xB0,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,
+	0xFC,0xFF,0x01,0xFC,0xFF,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x4C,0xB0,0x01,0xCC,0xB8,0x01,0x8C,0x9D,0x01,0x0C,0x8F,0x01,0x0C,0x86,0x01,0x0C,0x8F,0x01,0x8C,0x9D,0x01,0xCC,0xB8,0x01,0x4C,0xB0,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0x0C,0x80,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,
 
 	/* Index 89, character 121 "y" (width: 19 pixels) */
-	0x13, 0xFC,0xFF,0x01,0xFC,0xFF,0x01,0x0C,0x80,0x01,0x0C,0x88,0x01,0x0C,0x9C,0x01,0x0C,0x8E,0x01,0x0C,0x87,0x01,0x8C,0x83,0x01,0xCC,0x81,0x01,0xEC,0x80,0x01,0xCC,0x81,0x01,0x8C,0x83,0x01,0x0C,0x87,0x01,0x0C,0x8E,0x01,0x0C,0x9C,0x01,0x0C,0x88,0x01,0x0C,0x80,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,
+	0xFC,0xFF,0x01,0xFC,0xFF,0x01,0x0C,0x80,0x01,0x0C,0x88,0x01,0x0C,0x9C,0x01,0x0C,0x8E,0x01,0x0C,0x87,0x01,0x8C,0x83,0x01,0xCC,0x81,0x01,0xEC,0x80,0x01,0xCC,0x81,0x01,0x8C,0x83,0x01,0x0C,0x87,0x01,0x0C,0x8E,0x01,0x0C,0x9C,0x01,0x0C,0x88,0x01,0x0C,0x80,0x01,0xFC,0xFF,0x01,0xFC,0xFF,0x01,
 
 	/* Index 90, character 122 "z" (width: 14 pixels) */
-	0xE, 0x78,0x78,0x00,0xFC,0xFC,0x01,0xCC,0x8C,0x01,0xCC,0x8C,0x01,0xFC,0xFF,0x01,0xF8,0x7F,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xF8,0xFF,0x00,0xFC,0xFF,0x01,0xCC,0x8C,0x01,0xCC,0x8C,0x01,0xFC,0xFC,0x01,0x78,0x78,0x00,
+	0x78,0x78,0x00,0xFC,0xFC,0x01,0xCC,0x8C,0x01,0xCC,0x8C,0x01,0xFC,0xFF,0x01,0xF8,0x7F,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xF8,0xFF,0x00,0xFC,0xFF,0x01,0xCC,0x8C,0x01,0xCC,0x8C,0x01,0xFC,0xFC,0x01,0x78,0x78,0x00,
 
 	/* Index 91, character 123 "{" (width: 15 pixels) */
-	0xF, 0x00,0x07,0x00,0xE0,0x34,0x00,0x10,0x48,0x00,0x10,0x48,0x00,0x38,0x84,0x00,0x44,0x07,0x01,0x04,0x09,0x01,0x84,0xEA,0x00,0x04,0x0F,0x01,0x64,0x00,0x01,0x18,0x84,0x01,0x10,0x48,0x00,0x10,0x48,0x00,0xE0,0x38,0x00,0x00,0x07,0x00,
+	0x00,0x07,0x00,0xE0,0x34,0x00,0x10,0x48,0x00,0x10,0x48,0x00,0x38,0x84,0x00,0x44,0x07,0x01,0x04,0x09,0x01,0x84,0xEA,0x00,0x04,0x0F,0x01,0x64,0x00,0x01,0x18,0x84,0x01,0x10,0x48,0x00,0x10,0x48,0x00,0xE0,0x38,0x00,0x00,0x07,0x00,
 
 	/* Index 92, character 124 "|" (width: 15 pixels) */
-	0xF, 0x80,0x01,0x00,0xF8,0x1B,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,0xFE,0xFF,0x00,0xFE,0xFE,0x00,0xFE,0xFB,0x00,0xBC,0x1E,0x00,0xFE,0xFF,0x00,0xFE,0xFE,0x00,0xFC,0xFF,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,0xF8,0x1B,0x00,0x80,0x01,0x00,
+	0x80,0x01,0x00,0xF8,0x1B,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,0xFE,0xFF,0x00,0xFE,0xFE,0x00,0xFE,0xFB,0x00,0xBC,0x1E,0x00,0xFE,0xFF,0x00,0xFE,0xFE,0x00,0xFC,0xFF,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,0xF8,0x1B,0x00,0x80,0x01,0x00,
 
 	/* Index 93, character 125 "}" (width: 10 pixels) */
-	0xA, 0xF8,0x00,0x00,0xFC,0x00,0x00,0xF6,0x00,0x00,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0xFC,0x00,0x00,0xF6,0x00,0x00,0xF2,0x00,0x00,
+	0xF8,0x00,0x00,0xFC,0x00,0x00,0xF6,0x00,0x00,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0xFC,0x00,0x00,0xF6,0x00,0x00,0xF2,0x00,0x00,
 
 	/* Index 94, character 126 "~" (width: 10 pixels) */
-	0xA, 0x9E,0x00,0x00,0xDE,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x00,0x00,0xDE,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00,0x00
+	0x9E,0x00,0x00,0xDE,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x00,0x00,0xDE,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00,0x00
+};
+
+// Offset of each bitmap in Wingdings_bitmaps
+const unsigned short Wingdings_offsets[] = 
+{
+	0x0,	// Index 0
+	0x6,	// Index 1
+	0x42,	// Index 2
+	0x81,	// Index 3
+	0xC6,	// Index 4
+	0x117,	// Index 5
+	0x147,	// Index 6
+	0x18C,	// Index 7
+	0x1A1,	// Index 8
+	0x1DA,	// Index 9
+	0x207,	// Index 10
+	0x243,	// Index 11
+	0x27F,	// Index 12
+	0x2BE,	// Index 13
+	0x2FD,	// Index 14
+	0x34E,	// Index 15
+	0x39F,	// Index 16
+	0x3D8,	// Index 17
+	0x423,	// Index 18
+	0x444,	// Index 19
+	0x465,	// Index 20
+	0x492,	// Index 21
+	0x4AD,	// Index 22
+	0x4C8,	// Index 23
+	0x501,	// Index 24
+	0x534,	// Index 25
+	0x570,	// Index 26
+	0x5A3,	// Index 27
+	0x5D0,	// Index 28
+	0x5FD,	// Index 29
+	0x62A,	// Index 30
+	0x65A,	// Index 31
+	0x690,	// Index 32
+	0x6C6,	// Index 33
+	0x6E1,	// Index 34
+	0x70B,	// Index 35
+	0x72C,	// Index 36
+	0x74D,	// Index 37
+	0x780,	// Index 38
+	0x7B3,	// Index 39
+	0x7CB,	// Index 40
+	0x7E3,	// Index 41
+	0x810,	// Index 42
+	0x840,	// Index 43
+	0x873,	// Index 44
+	0x8A3,	// Index 45
+	0x8E2,	// Index 46
+	0x900,	// Index 47
+	0x92A,	// Index 48
+	0x966,	// Index 49
+	0x990,	// Index 50
+	0x9BD,	// Index 51
+	0x9DB,	// Index 52
+	0xA08,	// Index 53
+	0xA2C,	// Index 54
+	0xA53,	// Index 55
+	0xA77,	// Index 56
+	0xA9B,	// Index 57
+	0xAC2,	// Index 58
+	0xAEC,	// Index 59
+	0xB19,	// Index 60
+	0xB46,	// Index 61
+	0xB76,	// Index 62
+	0xBB8,	// Index 63
+	0xBF1,	// Index 64
+	0xC24,	// Index 65
+	0xC5D,	// Index 66
+	0xC8D,	// Index 67
+	0xCBD,	// Index 68
+	0xCED,	// Index 69
+	0xD23,	// Index 70
+	0xD53,	// Index 71
+	0xD8C,	// Index 72
+	0xDC5,	// Index 73
+	0xDE9,	// Index 74
+	0xE28,	// Index 75
+	0xE73,	// Index 76
+	0xE97,	// Index 77
+	0xEC7,	// Index 78
+	0xEEB,	// Index 79
+	0xF18,	// Index 80
+	0xF45,	// Index 81
+	0xF72,	// Index 82
+	0xF9F,	// Index 83
+	0xFB1,	// Index 84
+	0xFD5,	// Index 85
+	0x1008,	// Index 86
+	0x1035,	// Index 87
+	0x1050,	// Index 88
+	0x1089,	// Index 89
+	0x10C2,	// Index 90
+	0x10EC,	// Index 91
+	0x1119,	// Index 92
+	0x1146,	// Index 93
+	0x1164,	// Index 94
+};
+
+// Width of each bitmap in pixels
+const unsigned char Wingdings_widths[] = 
+{
+	0x2,	// Index 0
+	0x14,	// Index 1
+	0x15,	// Index 2
+	0x17,	// Index 3
+	0x1B,	// Index 4
+	0x10,	// Index 5
+	0x17,	// Index 6
+	0x7,	// Index 7
+	0x13,	// Index 8
+	0xF,	// Index 9
+	0x14,	// Index 10
+	0x14,	// Index 11
+	0x15,	// Index 12
+	0x15,	// Index 13
+	0x1B,	// Index 14
+	0x1B,	// Index 15
+	0x13,	// Index 16
+	0x19,	// Index 17
+	0xB,	// Index 18
+	0xB,	// Index 19
+	0xF,	// Index 20
+	0x9,	// Index 21
+	0x9,	// Index 22
+	0x13,	// Index 23
+	0x11,	// Index 24
+	0x14,	// Index 25
+	0x11,	// Index 26
+	0xF,	// Index 27
+	0xF,	// Index 28
+	0xF,	// Index 29
+	0x10,	// Index 30
+	0x12,	// Index 31
+	0x12,	// Index 32
+	0x9,	// Index 33
+	0xE,	// Index 34
+	0xB,	// Index 35
+	0xB,	// Index 36
+	0x11,	// Index 37
+	0x11,	// Index 38
+	0x8,	// Index 39
+	0x8,	// Index 40
+	0xF,	// Index 41
+	0x10,	// Index 42
+	0x11,	// Index 43
+	0x10,	// Index 44
+	0x15,	// Index 45
+	0xA,	// Index 46
+	0xE,	// Index 47
+	0x14,	// Index 48
+	0xE,	// Index 49
+	0xF,	// Index 50
+	0xA,	// Index 51
+	0xF,	// Index 52
+	0xC,	// Index 53
+	0xD,	// Index 54
+	0xC,	// Index 55
+	0xC,	// Index 56
+	0xD,	// Index 57
+	0xE,	// Index 58
+	0xF,	// Index 59
+	0xF,	// Index 60
+	0x10,	// Index 61
+	0x16,	// Index 62
+	0x13,	// Index 63
+	0x11,	// Index 64
+	0x13,	// Index 65
+	0x10,	// Index 66
+	0x10,	// Index 67
+	0x10,	// Index 68
+	0x12,	// Index 69
+	0x10,	// Index 70
+	0x13,	// Index 71
+	0x13,	// Index 72
+	0xC,	// Index 73
+	0x15,	// Index 74
+	0x19,	// Index 75
+	0xC,	// Index 76
+	0x10,	// Index 77
+	0xC,	// Index 78
+	0xF,	// Index 79
+	0xF,	// Index 80
+	0xF,	// Index 81
+	0xF,	// Index 82
+	0x6,	// Index 83
+	0xC,	// Index 84
+	0x11,	// Index 85
+	0xF,	// Index 86
+	0x9,	// Index 87
+	0x13,	// Index 88
+	0x13,	// Index 89
+	0xE,	// Index 90
+	0xF,	// Index 91
+	0xF,	// Index 92
+	0xA,	// Index 93
+	0xA,	// Index 94
+};
+
+// Rows of each bitmap above and below the baseline
+const unsigned char Wingdings_extents[] = 
+{
+	0x0, 0x0,	// Index 0
+	0x10, 0x0,	// Index 1
+	0xF, 0x0,	// Index 2
+	0x10, 0x0,	// Index 3
+	0xB, 0x0,	// Index 4
+	0x10, 0x0,	// Index 5
+	0x11, 0x0,	// Index 6
+	0x10, 0x0,	// Index 7
+	0x10, 0x0,	// Index 8
+	0xF, 0x0,	// Index 9
+	0xF, 0x0,	// Index 10
+	0xF, 0x0,	// Index 11
+	0xF, 0x0,	// Index 12
+	0x11, 0x0,	// Index 13
+	0x11, 0x0,	// Index 14
+	0xF, 0x0,	// Index 15
+	0xF, 0x0,	// Index 16
+	0xF, 0x0,	// Index 17
+	0xF, 0x0,	// Index 18
+	0xF, 0x0,	// Index 19
+	0xF, 0x4,	// Index 20
+	0xF, 0x0,	// Index 21
+	0x10, 0x0,	// Index 22
+	0x10, 0x0,	// Index 23
+	0x11, 0x0,	// Index 24
+	0xD, 0x0,	// Index 25
+	0xF, 0x0,	// Index 26
+	0x7, 0x0,	// Index 27
+	0xF, 0x0,	// Index 28
+	0xF, 0x0,	// Index 29
+	0xF, 0x0,	// Index 30
+	0xB, 0x0,	// Index 31
+	0xB, 0x0,	// Index 32
+	0x11, 0x0,	// Index 33
+	0x10, 0x1,	// Index 34
+	0x10, 0x0,	// Index 35
+	0xD, 0x1,	// Index 36
+	0xC, 0x0,	// Index 37
+	0xC, 0x0,	// Index 38
+	0x10, 0x1,	// Index 39
+	0x11, 0x0,	// Index 40
+	0x11, 0x0,	// Index 41
+	0x10, 0x0,	// Index 42
+	0x10, 0x0,	// Index 43
+	0x10, 0x0,	// Index 44
+	0x10, 0x0,	// Index 45
+	0x10, 0x0,	// Index 46
+	0x10, 0x2,	// Index 47
+	0x10, 0x0,	// Index 48
+	0x10, 0x0,	// Index 49
+	0xF, 0x0,	// Index 50
+	0xE, 0x0,	// Index 51
+	0xF, 0x0,	// Index 52
+	0xF, 0x0,	// Index 53
+	0x10, 0x0,	// Index 54
+	0xF, 0x0,	// Index 55
+	0xE, 0x0,	// Index 56
+	0x10, 0x0,	// Index 57
+	0xF, 0x0,	// Index 58
+	0x10, 0x0,	// Index 59
+	0xF, 0x0,	// Index 60
+	0x10, 0x0,	// Index 61
+	0x10, 0x4,	// Index 62
+	0x10, 0x4,	// Index 63
+	0x10, 0x1,	// Index 64
+	0xF, 0x0,	// Index 65
+	0x11, 0x4,	// Index 66
+	0x10, 0x4,	// Index 67
+	0x10, 0x0,	// Index 68
+	0xF, 0x4,	// Index 69
+	0x10, 0x0,	// Index 70
+	0xF, 0x3,	// Index 71
+	0xE, 0x0,	// Index 72
+	0x10, 0x0,	// Index 73
+	0xC, 0x2,	// Index 74
+	0x10, 0x3,	// Index 75
+	0xE, 0x0,	// Index 76
+	0xF, 0x0,	// Index 77
+	0xE, 0x0,	// Index 78
+	0xF, 0x0,	// Index 79
+	0xF, 0x0,	// Index 80
+	0xF, 0x0,	// Index 81
+	0xF, 0x0,	// Index 82
+	0xB, 0x0,	// Index 83
+	0xF, 0x0,	// Index 84
+	0x10, 0x1,	// Index 85
+	0xF, 0x0,	// Index 86
+	0xC, 0x0,	// Index 87
+	0xF, 0x0,	// Index 88
+	0xF, 0x0,	// Index 89
+	0xF, 0x0,	// Index 90
+	0xF, 0x0,	// Index 91
+	0x10, 0x0,	// Index 92
+	0x10, 0x0,	// Index 93
+	0x10, 0x0,	// Index 94
+};
+
+const font_t Wingdings = 
+{
+	Wingdings_bitmaps,
+	Wingdings_offsets,
+	Wingdings_widths,
+	0x20,	// Start character 
+	0x5F,	// Number of bitmaps 
+	0x15,	// Height 
+	0,	// Flags 
+	Wingdings_extents,
+	0x11	// Ascent 
 };
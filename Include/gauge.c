@@ -0,0 +1,69 @@
+#include "gauge.h"
+#include "graphics.h"
+#include "main.h"
+
+void gauge_init(gauge_t *gauge, unsigned char x, unsigned char y, unsigned char width, unsigned char height,
+				unsigned char direction, unsigned int max) {
+	gauge->x = x;
+	gauge->y = y;
+	gauge->width = width;
+	gauge->height = height;
+	gauge->direction = direction;
+	gauge->length = 0;
+	gauge->value = 0;
+	gauge->max = max;
+}
+
+void gauge_set(gauge_t *gauge, unsigned int value) {
+	unsigned char length;
+
+	if (value > gauge->max) value = gauge->max;
+	gauge->value = value;
+
+	length = gauge->max ? (unsigned long) value * _gauge_size(gauge) / gauge->max : 0;
+
+	// Only the difference is drawn
+	if (length > gauge->length) {
+		_gauge_fill(gauge, gauge->length, length, 1);
+	} else if (length < gauge->length) {
+		_gauge_fill(gauge, length, gauge->length, 0);
+	}
+
+	gauge->length = length;
+}
+
+void gauge_redraw(gauge_t *gauge) {
+	unsigned char size = _gauge_size(gauge);
+
+	_gauge_fill(gauge, 0, gauge->length, 1);
+	_gauge_fill(gauge, gauge->length, size, 0);
+}
+
+// The length of a full gauge in pixels
+unsigned char _gauge_size(gauge_t *gauge) {
+	return gauge->direction == GAUGE_UP || gauge->direction == GAUGE_DOWN ? gauge->height : gauge->width;
+}
+
+// Fill or clear the pixels of a gauge from one length up to (but not
+// including) another, measured from the edge it fills from
+void _gauge_fill(gauge_t *gauge, unsigned char from, unsigned char to, unsigned char colour) {
+	unsigned char right = gauge->x + gauge->width - 1;
+	unsigned char bottom = gauge->y + gauge->height - 1;
+
+	if (from >= to) return;
+
+	switch (gauge->direction) {
+		case GAUGE_RIGHT:
+			draw_filled_rectangle(gauge->x + from, gauge->y, gauge->x + to - 1, bottom, colour);
+			break;
+		case GAUGE_LEFT:
+			draw_filled_rectangle(right + 1 - to, gauge->y, right - from, bottom, colour);
+			break;
+		case GAUGE_UP:
+			draw_filled_rectangle(gauge->x, bottom + 1 - to, right, bottom - from, colour);
+			break;
+		case GAUGE_DOWN:
+			draw_filled_rectangle(gauge->x, gauge->y + from, right, gauge->y + to - 1, colour);
+			break;
+	}
+}
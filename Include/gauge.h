@@ -0,0 +1,98 @@
+/**
+ * @file   gauge.h
+ * @date   October, 2026
+ * @brief  Header for bars and level gauges that only redraw the part that changes.
+ * @details
+ *
+ * A gauge is a bar that is filled in proportion to a value, for example a battery,
+ * signal or tank level.  Clearing and filling the whole bar for every new value sends
+ * the entire bar to the screen each time.  Instead the gauge remembers how much of it
+ * is filled, and a new value only fills or clears the pixels between the old length
+ * and the new one.  A horizontal bar that grows by one pixel only changes one column.
+ *
+ * A gauge fills from one edge, chosen by its direction.  It covers exactly the area it
+ * is given, so any outline around it is drawn by the caller.
+ *
+ * Example usage:
+ * @code
+ *    gauge_t battery, tank;
+ *
+ *    draw_rectangle(1, 1, 22, 8, 1);
+ *    gauge_init(&battery, 2, 2, 20, 6, GAUGE_RIGHT, 4200);
+ *    gauge_init(&tank, 100, 10, 12, 50, GAUGE_UP, 100);
+ *
+ *    for (;;) {
+ *        gauge_set(&battery, read_millivolts());
+ *        gauge_set(&tank, read_percent());
+ *        glcd_refresh();
+ *    }
+ * @endcode
+ */
+#ifndef _GAUGE_H_
+#define _GAUGE_H_
+
+/** Fill from the left edge towards the right */
+#define GAUGE_RIGHT		0
+/** Fill from the right edge towards the left */
+#define GAUGE_LEFT		1
+/** Fill from the bottom edge upwards */
+#define GAUGE_UP		2
+/** Fill from the top edge downwards */
+#define GAUGE_DOWN		3
+
+/**
+ * A bar or level gauge.  Use gauge_init() to set this up.
+ */
+typedef struct {
+	/** Left edge of the gauge, from 1 - SCREEN_WIDTH */
+	unsigned char x;
+	/** Top edge of the gauge, from 1 - SCREEN_HEIGHT */
+	unsigned char y;
+	/** Width of the gauge in pixels */
+	unsigned char width;
+	/** Height of the gauge in pixels */
+	unsigned char height;
+	/** GAUGE_RIGHT, GAUGE_LEFT, GAUGE_UP or GAUGE_DOWN */
+	unsigned char direction;
+	/** The number of pixels filled on the screen, from the starting edge */
+	unsigned char length;
+	/** The value shown, from 0 - max */
+	unsigned int value;
+	/** The value of a full gauge */
+	unsigned int max;
+} gauge_t;
+
+/**
+ * Set up a gauge.  Nothing is drawn, the area of the gauge should already be
+ * blank or be drawn with gauge_redraw().
+ *
+ * @param gauge		The gauge to set up
+ * @param x			The x position, from 1 - SCREEN_WIDTH
+ * @param y			The y position, from 1 - SCREEN_HEIGHT
+ * @param width		Width of the gauge in pixels
+ * @param height	Height of the gauge in pixels
+ * @param direction	GAUGE_RIGHT, GAUGE_LEFT, GAUGE_UP or GAUGE_DOWN
+ * @param max		The value of a full gauge
+ */
+void gauge_init(gauge_t *gauge, unsigned char x, unsigned char y, unsigned char width, unsigned char height,
+				unsigned char direction, unsigned int max);
+/**
+ * Change the value of a gauge.  Only the pixels between the old and new
+ * lengths are drawn, so a value that does not change the length draws nothing.
+ *
+ * @param gauge		The gauge
+ * @param value		The new value, from 0 - max
+ */
+void gauge_set(gauge_t *gauge, unsigned int value);
+/**
+ * Draw the whole gauge again, for example after the screen has been cleared.
+ *
+ * @param gauge		The gauge
+ */
+void gauge_redraw(gauge_t *gauge);
+
+/* Internal functions (do not call) */
+unsigned char _gauge_size(gauge_t *gauge);
+void _gauge_fill(gauge_t *gauge, unsigned char from, unsigned char to, unsigned char colour);
+
+#endif // _GAUGE_H_
@@ -3,19 +3,127 @@
 
 #include "graphics.h"
 #include "main.h"
+#include "graphics-config.h"
 
-bounding_box_t draw_text(char *string, unsigned char x, unsigned char y, unsigned char *font, unsigned char spacing) {
+// The display being drawn on, see graphics_set_driver()
+const glcd_driver_t *graphics_driver = 0;
+
+#ifdef GRAPHICS_DIRECT_BUFFER
+// The buffer being drawn into, see graphics_set_target().  This is 0 if
+// the driver has no buffer, and everything is drawn through its hooks.
+unsigned char *graphics_buffer = 0;
+unsigned char graphics_stride = SCREEN_WIDTH;
+unsigned char graphics_height = SCREEN_HEIGHT;
+unsigned char graphics_origin_x = 0;
+unsigned char graphics_origin_y = 0;
+
+// How the buffer is turned, see graphics_set_rotation()
+unsigned char graphics_rotation = GRAPHICS_ROTATE_0;
+#endif
+
+#ifdef GRAPHICS_COUNT_WRITES
+// The number of bytes written into the buffer, for benchmarks.  Without
+// GRAPHICS_DIRECT_BUFFER everything goes through the hooks and this stays 0.
+unsigned long graphics_bytes_written = 0;
+#endif
+
+/** The current clip rectangle, nothing is drawn outside of this. */
+bounding_box_t graphics_clip = { 1, 1, SCREEN_WIDTH, SCREEN_HEIGHT };
+
+// Clip rectangles saved by graphics_clip_push()
+bounding_box_t graphics_clip_stack[GRAPHICS_CLIP_DEPTH];
+unsigned char graphics_clip_depth = 0;
+
+unsigned char graphics_clip_push(int x1, int y1, int x2, int y2) {
+	if (graphics_clip_depth == GRAPHICS_CLIP_DEPTH) return 0;
+
+	graphics_clip_stack[graphics_clip_depth++] = graphics_clip;
+
+	// The new area can only ever be smaller than the current one.  If
+	// the two do not overlap then x1 > x2 and nothing will be drawn.
+	if (x1 > graphics_clip.x1) graphics_clip.x1 = x1 > graphics_clip.x2 ? graphics_clip.x2 + 1 : x1;
+	if (y1 > graphics_clip.y1) graphics_clip.y1 = y1 > graphics_clip.y2 ? graphics_clip.y2 + 1 : y1;
+	if (x2 < graphics_clip.x2) graphics_clip.x2 = x2 < graphics_clip.x1 ? graphics_clip.x1 - 1 : x2;
+	if (y2 < graphics_clip.y2) graphics_clip.y2 = y2 < graphics_clip.y1 ? graphics_clip.y1 - 1 : y2;
+
+	return 1;
+}
+
+void graphics_clip_pop(void) {
+	if (graphics_clip_depth) {
+		graphics_clip = graphics_clip_stack[--graphics_clip_depth];
+	}
+}
+
+void graphics_set_driver(const glcd_driver_t *driver) {
+	graphics_driver = driver;
+
+#ifdef GRAPHICS_DIRECT_BUFFER
+	graphics_set_target(0, 0, 0, 0, 0);
+#else
+	graphics_clip.x1 = 1;
+	graphics_clip.y1 = 1;
+	graphics_clip.x2 = driver->width;
+	graphics_clip.y2 = driver->height;
+	graphics_clip_depth = 0;
+#endif
+}
+
+void graphics_refresh(void) {
+	if (graphics_driver->refresh) {
+		graphics_driver->refresh();
+	}
+}
+
+#ifdef GRAPHICS_DIRECT_BUFFER
+void graphics_set_target(unsigned char *buffer, unsigned char width, unsigned char height, unsigned char x, unsigned char y) {
+	if (buffer) {
+		graphics_buffer = buffer;
+		graphics_stride = width;
+		graphics_height = height;
+		graphics_origin_x = x - 1;
+		graphics_origin_y = y - 1;
+	} else {
+		graphics_buffer = graphics_driver->buffer;
+		graphics_stride = graphics_driver->width;
+		graphics_height = graphics_driver->height;
+		graphics_origin_x = 0;
+		graphics_origin_y = 0;
+	}
+
+	// Start again with the whole of the new target
+	graphics_set_rotation(graphics_rotation);
+}
+
+void graphics_set_rotation(unsigned char rotation) {
+	// Rotating needs the buffer, the driver hooks cannot be turned
+	graphics_rotation = graphics_buffer ? rotation : GRAPHICS_ROTATE_0;
+
+	// Quarter turns swap the width and height
+	graphics_clip.x1 = 1;
+	graphics_clip.y1 = 1;
+	graphics_clip.x2 = graphics_rotation & 1 ? graphics_height : graphics_stride;
+	graphics_clip.y2 = graphics_rotation & 1 ? graphics_stride : graphics_height;
+	graphics_clip_depth = 0;
+}
+#endif
+
+bounding_box_t draw_text(char *string, unsigned char x, unsigned char y, const font_t *font, unsigned char spacing) {
 	bounding_box_t ret;
 	bounding_box_t tmp;
 
 	ret.x1 = x;
 	ret.y1 = y;
 
+	// An empty string has no size
+	tmp.x2 = x;
+	tmp.y2 = y;
+
 	spacing += 1;
 
 	// BUG: As we move right between chars we don't actually wipe the space
 	while (*string != 0) {
-		tmp = draw_char(*string++, x, y, font);
+		tmp = draw_char(_next_char((const char **) &string), x, y, font);
 
 		// Leave a single space between characters
 		x = tmp.x2 + spacing;
@@ -27,118 +135,347 @@ bounding_box_t draw_text(char *string, unsigned char x, unsigned char y, unsigne
 	return ret;
 }
 
-bounding_box_t draw_char(unsigned char c, unsigned char x, unsigned char y, unsigned char *font) {
-	unsigned short pos;
-	unsigned char width;
+bounding_box_t draw_text_box(char *string, bounding_box_t box, unsigned char align, const font_t *font, unsigned char spacing) {
 	bounding_box_t ret;
+	const char *end;
+	const char *next;
+	const char *space;
+	unsigned char box_width = box.x2 - box.x1 + 1;
+	unsigned char width, space_width, letter_width;
+	unsigned short code;
+	unsigned char c;
+	unsigned char x;
+	unsigned char y = box.y1;
+	unsigned char clipped;
 
-	ret.x1 = x;
-	ret.y1 = y;
-	ret.x2 = x;
-	ret.y2 = y;
+	// Nothing drawn yet
+	ret.x1 = box.x2;
+	ret.y1 = box.y1;
+	ret.x2 = box.x1;
+	ret.y2 = box.y1;
+
+	clipped = graphics_clip_push(box.x1, box.y1, box.x2, box.y2);
 
-	// Read first byte, should be 0x01 for proportional
-	if (font[FONT_HEADER_TYPE] != FONT_TYPE_PROPORTIONAL) return ret;
+	// Only draw lines that fit entirely inside the box
+	while (*string != 0 && y + font->height - 1 <= box.y2) {
+		space = 0;
+		space_width = 0;
+		width = 0;
 
-	// Check second byte, should be 0x02 for "vertical ceiling"
-	if (font[FONT_HEADER_ORIENTATION] != FONT_ORIENTATION_VERTICAL_CEILING) return ret;
+		// Measure as many letters as will fit on this line, remembering
+		// the last space seen so the line can be wrapped there.  A line
+		// always has at least one letter, even if it is too wide.
+		for (end = string; *end != 0 && *end != '\n'; end = next) {
+			next = end;
+			c = font_glyph(font, _next_char(&next));
+			letter_width = c != FONT_NO_GLYPH ? font->widths[c] : 0;
+			if (end != string) letter_width += spacing;
 
-	// Check that font start + number of bitmaps contains c
-	if (!(c >= font[FONT_HEADER_START] && c <= font[FONT_HEADER_START] + font[FONT_HEADER_LETTERS])) return ret;
+			if (*end == ' ') {
+				space = end;
+				space_width = width;
+			}
 
-	// Adjust for start position of font vs. the char passed
-	c -= font[FONT_HEADER_START];
+			if (end != string && width + letter_width > box_width) break;
+			width += letter_width;
+		}
 
-	// Work out where in the array the character is
-	pos = font[c * FONT_HEADER_START + 5];
-	pos <<= 8;
-	pos |= font[c * FONT_HEADER_START + 6];
+		// Wrap at the last space rather than in the middle of a word
+		if (*end != 0 && *end != '\n' && *end != ' ' && space) {
+			end = space;
+			width = space_width;
+		}
 
-	// Read first byte from this position, this gives letter width
-	width = font[pos];
+		if (width > box_width) {
+			// A single letter that is wider than the box
+			x = box.x1;
+		} else if (align == TEXT_ALIGN_CENTRE) {
+			x = box.x1 + (box_width - width) / 2;
+		} else if (align == TEXT_ALIGN_RIGHT) {
+			x = box.x1 + box_width - width;
+		} else {
+			x = box.x1;
+		}
 
-	// Draw left to right
-	unsigned char i;
-	for (i = 0; i < width; i++) {
+		if (width) {
+			if (x < ret.x1) ret.x1 = x;
+			if (x + width - 1 > ret.x2) ret.x2 = x + width - 1;
+			ret.y2 = y + font->height - 1;
+		}
 
-		// Draw top to bottom
-		for (unsigned char j = 0; j < font[FONT_HEADER_HEIGHT]; j++) {
-			// Increment one data byte every 8 bits, or
-			// at the start of a new column  HiTech optimizes
-			// the modulo, so no need to try and avoid it.
-			if (j % 8 == 0) pos++;
+		// Draw the line using the widths measured above
+		while (string != end) {
+			code = _next_char((const char **) &string);
+			c = font_glyph(font, code);
+			if (c == FONT_NO_GLYPH) continue;
 
-			if (font[pos] & 1 << (j % 8)) {
-				glcd_pixel(x + i, y + j, 1);
-			} else {
-				glcd_pixel(x + i, y + j, 0);
-			}
+			draw_char(code, x, y, font);
+			x += font->widths[c] + spacing;
 		}
+
+		// Skip the space or new line that ended this line
+		if (*string == ' ' || *string == '\n') string++;
+
+		y += font->height;
 	}
 
+	// Only undo our own clip rectangle, never the caller's
+	if (clipped) graphics_clip_pop();
+
+	return ret;
+}
+
+bounding_box_t draw_text_runs(const text_run_t *runs, unsigned char count, unsigned char x, unsigned char y, unsigned char spacing) {
+	bounding_box_t ret;
+	const char *p;
+	unsigned short code;
+	unsigned char ascent = 0;
+	unsigned char descent = 0;
+	unsigned char top;
+	unsigned char c;
+	unsigned char n;
+
+	// The baseline has to be low enough for the tallest font, and the line
+	// has to reach the lowest descender
+	for (n = 0; n < count; n++) {
+		c = _font_ascent(runs[n].font);
+		if (c > ascent) ascent = c;
+		c = runs[n].font->height - c;
+		if (c > descent) descent = c;
+	}
+
+	ret.x1 = x;
+	ret.y1 = y;
+	ret.x2 = x;
+	ret.y2 = y + ascent + descent - 1;
+
+	for (n = 0; n < count; n++) {
+		// Line the baseline of this font up with the others
+		top = y + ascent - _font_ascent(runs[n].font);
+
+		for (p = runs[n].text; *p != 0; ) {
+			code = _next_char(&p);
+			c = font_glyph(runs[n].font, code);
+			if (c == FONT_NO_GLYPH) continue;
+
+			draw_char(code, x, top, runs[n].font);
+			ret.x2 = x + runs[n].font->widths[c] - 1;
+			x = ret.x2 + 1 + spacing;
+		}
+	}
+
+	return ret;
+}
+
+bounding_box_t draw_char(unsigned short c, unsigned char x, unsigned char y, const font_t *font) {
+	const unsigned char *bitmap;
+	unsigned char index;
+	unsigned char width;
+	unsigned char height;
+	bounding_box_t ret;
+
+	ret.x1 = x;
+	ret.y1 = y;
+	ret.x2 = x;
+	ret.y2 = y;
+
+	index = font_glyph(font, c);
+	if (index == FONT_NO_GLYPH) return ret;
+
+	bitmap = &font->bitmaps[font->offsets[index]];
+	width = font->widths[index];
+	height = font->height;
+
 	ret.x2 = ret.x1 + width - 1;
 	// TODO: Return the actual height drawn, rather than the height of the
 	//		 font.
 	ret.y2 = ret.y1 + height;
-	ret.y2 = ret.y1 + font[FONT_HEADER_HEIGHT];
+
+	// Nothing to draw if the letter is entirely outside the clip area
+	if (ret.x2 < graphics_clip.x1 || ret.x1 > graphics_clip.x2 ||
+		ret.y2 <= graphics_clip.y1 || ret.y1 > graphics_clip.y2) return ret;
+
+	if (font->flags & BITMAP_RLE) {
+		_draw_rle_columns(bitmap, x, y, width, height, ROP_COPY);
+	} else {
+		_draw_columns(bitmap, x, y, width, height, ROP_COPY);
+	}
+
+	_mark_dirty(ret.x1, ret.y1, ret.x2, ret.y1 + height - 1);
 
 	return ret;
 }
 
-unsigned char text_height(unsigned char *string, unsigned char *font) {
-	// TODO: Possibly work out the actual pixel height.  Letters with
-	//       descenders (like 'g') are taller than letters without (like 'k')
+bounding_box_t draw_bitmap(const bitmap_t *bitmap, unsigned char x, unsigned char y, unsigned char rop) {
+	bounding_box_t ret;
 
-	// Height is stored in the header
-	return font[FONT_HEADER_HEIGHT];
+	ret.x1 = x;
+	ret.y1 = y;
+	ret.x2 = x + bitmap->width - 1;
+	ret.y2 = y + bitmap->height - 1;
+
+	// Nothing to draw if the bitmap is entirely outside the clip area
+	if (bitmap->width == 0 || bitmap->height == 0 ||
+		ret.x2 < graphics_clip.x1 || ret.x1 > graphics_clip.x2 ||
+		ret.y2 < graphics_clip.y1 || ret.y1 > graphics_clip.y2) return ret;
+
+	if (bitmap->flags & BITMAP_RLE) {
+		_draw_rle_columns(bitmap->data, x, y, bitmap->width, bitmap->height, rop);
+	} else if (bitmap->flags & BITMAP_XBM) {
+		_draw_xbm_rows(bitmap->data, x, y, bitmap->width, bitmap->height, rop);
+	} else {
+		_draw_columns(bitmap->data, x, y, bitmap->width, bitmap->height, rop);
+	}
+
+	_mark_dirty(ret.x1, ret.y1, ret.x2, ret.y2);
+
+	return ret;
 }
 
-unsigned char text_width(unsigned char *string, unsigned char *font, unsigned char spacing) {
+unsigned char font_glyph(const font_t *font, unsigned short c) {
+	const font_range_t *range;
+	unsigned char low = 0;
+	unsigned char high = font->range_count;
+	unsigned char middle;
+
+	// Most text is in the first range, which is looked up directly
+	if (c >= font->start && c - font->start < font->count) return c - font->start;
+
+	// The other ranges are sorted, so halve the list until c is found
+	while (low < high) {
+		middle = (low + high) / 2;
+		range = &font->ranges[middle];
+
+		if (c < range->first) {
+			high = middle;
+		} else if (c - range->first >= range->count) {
+			low = middle + 1;
+		} else {
+			return range->index + (c - range->first);
+		}
+	}
+
+	return FONT_NO_GLYPH;
+}
+
+// Rows from the top of a font down to its baseline
+unsigned char _font_ascent(const font_t *font)
+{
+	return font->ascent ? font->ascent : font->height;
+}
+
+// Read the next character of a string and move past it.  A byte that does
+// not start a valid UTF-8 sequence is returned as it is, so Latin-1 text
+// still works with fonts that have those characters.
+unsigned short _next_char(const char **string)
+{
+	const unsigned char *s = (const unsigned char *) *string;
+
+#ifdef GRAPHICS_UTF8
+	unsigned short c;
+
+	// Two bytes for U+0080 - U+07FF.  A zero byte is never a continuation
+	// byte, so nothing is read past the end of the string.
+	if (s[0] >= 0xC2 && s[0] <= 0xDF && (s[1] & 0xC0) == 0x80) {
+		*string += 2;
+		return ((s[0] & 0x1F) << 6) | (s[1] & 0x3F);
+	}
+
+	// Three bytes for U+0800 - U+FFFF
+	if ((s[0] & 0xF0) == 0xE0 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80) {
+		c = ((s[0] & 0x0F) << 12) | ((s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+		if (c >= 0x800) {
+			*string += 3;
+			return c;
+		}
+	}
+
+	// Four bytes are beyond what a font can hold, so become U+FFFD
+	if ((s[0] & 0xF8) == 0xF0 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80 && (s[3] & 0xC0) == 0x80) {
+		*string += 4;
+		return 0xFFFD;
+	}
+#endif
+
+	(*string)++;
+	return s[0];
+}
+
+unsigned char text_height(unsigned char *string, const font_t *font) {
+	const char *p = (const char *) string;
+	unsigned char ascent = 0;
+	unsigned char descent = 0;
+	const unsigned char *extents;
+	unsigned char c;
+
+	// Without extents the best we can do is the height of the font
+	if (!font->extents) return font->height;
+
+	// Find the tallest letter and the lowest descender
+	while (*p != 0) {
+		c = font_glyph(font, _next_char(&p));
+		if (c == FONT_NO_GLYPH) continue;
+
+		extents = &font->extents[c * 2];
+		if (extents[0] > ascent) ascent = extents[0];
+		if (extents[1] > descent) descent = extents[1];
+	}
+
+	return ascent + descent;
+}
+
+unsigned char text_runs_width(const text_run_t *runs, unsigned char count, unsigned char spacing) {
+	const char *p;
 	unsigned char width = 0;
-	unsigned short pos;
 	unsigned char c;
+	unsigned char n;
+
+	for (n = 0; n < count; n++) {
+		for (p = runs[n].text; *p != 0; ) {
+			c = font_glyph(runs[n].font, _next_char(&p));
+			if (c == FONT_NO_GLYPH) continue;
 
-	// TODO: Implement for fixed width fonts
+			width += runs[n].font->widths[c] + spacing;
+		}
+	}
 
-	// Check font type, should be 0x01 for proportional
-	if (font[FONT_HEADER_TYPE] != FONT_TYPE_PROPORTIONAL) return 0;
+	// The last letter wont have a space after it
+	if (!width) return 0;
+	return width - spacing;
+}
 
-	while (*string != 0) {
-		c = *string++;
+unsigned char text_width(unsigned char *string, const font_t *font, unsigned char spacing) {
+	const char *p = (const char *) string;
+	unsigned char width = 0;
+	unsigned char c;
+
+	while (*p != 0) {
+		c = font_glyph(font, _next_char(&p));
 	
-		// Check that font start + number of bitmaps contains c
+		// Check that the font contains c
 		// TODO: Should we continue here but add 0 to width?
-		if (!(c >= font[FONT_HEADER_START] && c <= font[FONT_HEADER_START] + font[FONT_HEADER_LETTERS])) return 0;
-	
-		// Adjust for start position of font vs. the char passed
-		c -= font[FONT_HEADER_START];
+		if (c == FONT_NO_GLYPH) return 0;
 	
-		// Work out where in the array the character is
-		pos = font[c * FONT_HEADER_START + 5];
-		pos <<= 8;
-		pos |= font[c * FONT_HEADER_START + 6];
-	
-		// Read first byte from this position, this gives letter width
-		width += font[pos];
-
-		// Allow for space between letters
-		width += spacing;
+		// Letter width is stored in the font, allow for the space
+		// between letters too
+		width += font->widths[c] + spacing;
 	}
 
 	// The last letter wont have a space after it
+	if (!width) return 0;
 	return width - spacing;
 }
 
 void draw_rectangle(int x1, int y1, int x2, int y2, char colour)
 {
 	// Top
-	draw_line(x1, y1, x2, y1, colour);
+	draw_hspan(x1, x2, y1, colour);
 	// Left
-	draw_line(x1, y1, x1, y2, colour);
+	draw_vspan(x1, y1, y2, colour);
 	// Bottom
-	draw_line(x1, y2, x2, y2, colour);
+	draw_hspan(x1, x2, y2, colour);
 	// Right
-	draw_line(x2, y1, x2, y2, colour);
+	draw_vspan(x2, y1, y2, colour);
 }
 
 
@@ -146,13 +483,165 @@ void draw_rectangle(int x1, int y1, int x2, int y2, char colour)
 void draw_box(int x1, int y1, int x2, int y2, char colour)
 {
 	// Top
-	draw_line(x1 + 1, y1, x2 - 1, y1, colour);
+	draw_hspan(x1 + 1, x2 - 1, y1, colour);
 	// Left
-	draw_line(x1, y1 + 1, x1, y2 - 1, colour);
+	draw_vspan(x1, y1 + 1, y2 - 1, colour);
 	// Bottom
-	draw_line(x1 + 1, y2, x2 - 1, y2, colour);
+	draw_hspan(x1 + 1, x2 - 1, y2, colour);
 	// Right
-	draw_line(x2, y1 + 1, x2, y2 - 1, colour);
+	draw_vspan(x2, y1 + 1, y2 - 1, colour);
+}
+
+// A rectangle with corners of any radius, drawn as spans.  Row d above
+// the centre of a corner is _corner_width() pixels wide, and the outline
+// joins each row to the one above so the arc has no gaps.
+void draw_rounded_rectangle(int x1, int y1, int x2, int y2, unsigned char radius, char colour)
+{
+	int left, right, w, last;
+	unsigned char d;
+
+	radius = _clamp_radius(&x1, &y1, &x2, &y2, radius);
+
+	// Without corners there are no rows to join, so draw the edges directly
+	if (!radius) {
+		draw_rectangle(x1, y1, x2, y2, colour);
+		return;
+	}
+
+	left = x1 + radius;
+	right = x2 - radius;
+	last = -1;
+	w = 0;
+
+	for (d = radius; d; d--) {
+		w = _corner_width(radius, d, w);
+		if (last < 0) {
+			// The top and bottom edges
+			draw_hspan(left - w, right + w, y1 + radius - d, colour);
+			draw_hspan(left - w, right + w, y2 - radius + d, colour);
+		} else {
+			if (last + 1 < w) last++;
+			draw_hspan(left - w, left - last, y1 + radius - d, colour);
+			draw_hspan(right + last, right + w, y1 + radius - d, colour);
+			draw_hspan(left - w, left - last, y2 - radius + d, colour);
+			draw_hspan(right + last, right + w, y2 - radius + d, colour);
+		}
+		last = w;
+	}
+
+	// The straight sides
+	draw_vspan(x1, y1 + radius, y2 - radius, colour);
+	draw_vspan(x2, y1 + radius, y2 - radius, colour);
+}
+
+void draw_filled_rounded_rectangle(int x1, int y1, int x2, int y2, unsigned char radius, char colour)
+{
+	int w = 0;
+	unsigned char d;
+
+	radius = _clamp_radius(&x1, &y1, &x2, &y2, radius);
+
+	for (d = radius; d; d--) {
+		w = _corner_width(radius, d, w);
+		draw_hspan(x1 + radius - w, x2 - radius + w, y1 + radius - d, colour);
+		draw_hspan(x1 + radius - w, x2 - radius + w, y2 - radius + d, colour);
+	}
+
+	// Everything between the corners is a single block
+	draw_filled_rectangle(x1, y1 + radius, x2, y2 - radius, colour);
+}
+
+void draw_hspan(int x1, int x2, int y, char colour)
+{
+	draw_filled_rectangle(x1, y, x2, y, colour);
+}
+
+void draw_vspan(int x, int y1, int y2, char colour)
+{
+	draw_filled_rectangle(x, y1, x, y2, colour);
+}
+
+void draw_filled_rectangle(int x1, int y1, int x2, int y2, char colour)
+{
+	int tmp;
+
+	if (x1 > x2) {
+		tmp = x1;
+		x1 = x2;
+		x2 = tmp;
+	}
+	if (y1 > y2) {
+		tmp = y1;
+		y1 = y2;
+		y2 = tmp;
+	}
+
+	// Clip to the current clip rectangle
+	if (x2 < graphics_clip.x1 || x1 > graphics_clip.x2 || y2 < graphics_clip.y1 || y1 > graphics_clip.y2) return;
+	if (x1 < graphics_clip.x1) x1 = graphics_clip.x1;
+	if (x2 > graphics_clip.x2) x2 = graphics_clip.x2;
+	if (y1 < graphics_clip.y1) y1 = graphics_clip.y1;
+	if (y2 > graphics_clip.y2) y2 = graphics_clip.y2;
+
+	// An empty clip rectangle
+	if (x1 > x2 || y1 > y2) return;
+
+#ifdef GRAPHICS_DIRECT_BUFFER
+	if (graphics_buffer) {
+		unsigned char *p;
+		unsigned char page, first_page, last_page;
+		unsigned char mask;
+		unsigned char n;
+
+		_mark_dirty(x1, y1, x2, y2);
+
+		// A rotated rectangle is still a rectangle
+		if (graphics_rotation) _rotate_rectangle(&x1, &y1, &x2, &y2);
+
+		first_page = (y1 - 1) / 8;
+		last_page = (y2 - 1) / 8;
+
+		// Work out which bits of each page are covered, then write that
+		// mask into every column.  A rectangle inside one page (such as a
+		// horizontal or short vertical line) only needs one pass.
+		for (page = first_page; page <= last_page; page++) {
+			mask = 0xFF;
+			if (page == first_page) mask <<= (y1 - 1) % 8;
+			if (page == last_page) mask &= 0xFF >> (7 - (y2 - 1) % 8);
+
+			p = &graphics_buffer[page * graphics_stride + x1 - 1];
+			n = x2 - x1 + 1;
+#ifdef GRAPHICS_COUNT_WRITES
+			graphics_bytes_written += n;
+#endif
+
+			if (colour) {
+				while (n--) *p++ |= mask;
+			} else {
+				mask = ~mask;
+				while (n--) *p++ &= mask;
+			}
+		}
+		return;
+	}
+#endif
+
+	// Otherwise use whichever driver hook needs the fewest calls
+	if (graphics_driver->hspan && (!graphics_driver->vspan || y2 - y1 <= x2 - x1)) {
+		for (; y1 <= y2; y1++) {
+			graphics_driver->hspan(x1, x2, y1, colour);
+		}
+	} else if (graphics_driver->vspan) {
+		for (; x1 <= x2; x1++) {
+			graphics_driver->vspan(x1, y1, y2, colour);
+		}
+	} else {
+		for (; y1 <= y2; y1++) {
+			for (tmp = x1; tmp <= x2; tmp++) {
+				graphics_driver->pixel(tmp, y1, colour);
+			}
+		}
+	}
 }
 
 // Implementation of Bresenham's line algorithm
@@ -162,11 +651,30 @@ void draw_box(int x1, int y1, int x2, int y2, char colour)
 void draw_line(int x1, int y1, int x2, int y2, char colour)
 {
 	int xinc1, yinc1, den, num, numadd, numpixels, curpixel, xinc2, yinc2;
+	int major, skip, last;
+	long skip_num;
+	unsigned char drawn = 0;
 
 	int deltax = abs(x2 - x1);    	// The difference between the x's
 	int deltay = abs(y2 - y1);    	// The difference between the y's
 	int x = x1;                   	// Start x off at the first pixel
 	int y = y1;                   	// Start y off at the first pixel
+
+	// Nothing to draw if both ends are off the same side of the clip area
+	if ((x1 < graphics_clip.x1 && x2 < graphics_clip.x1) ||
+		(x1 > graphics_clip.x2 && x2 > graphics_clip.x2) ||
+		(y1 < graphics_clip.y1 && y2 < graphics_clip.y1) ||
+		(y1 > graphics_clip.y2 && y2 > graphics_clip.y2)) return;
+
+	// Horizontal and vertical lines can be drawn much more quickly
+	if (deltay == 0) {
+		draw_hspan(x1, x2, y1, colour);
+		return;
+	}
+	if (deltax == 0) {
+		draw_vspan(x1, y1, y2, colour);
+		return;
+	}
 	
 	if (x2 >= x1) {             	// The x-values are increasing
 	  xinc1 = 1;
@@ -206,10 +714,41 @@ void draw_line(int x1, int y1, int x2, int y2, char colour)
 	  numadd = deltax;
 	  numpixels = deltay;     		// There are more y-values than x-values
 	}
-	
-	for (curpixel = 0; curpixel <= numpixels; curpixel++)
+
+	// Work out how many steps along the major axis are needed before the
+	// line enters the clip area, and after which it leaves.
+	if (deltax >= deltay) {
+		major = xinc2 > 0 ? x - graphics_clip.x1 : graphics_clip.x2 - x;
+		last = xinc2 > 0 ? graphics_clip.x2 - x : x - graphics_clip.x1;
+	} else {
+		major = yinc2 > 0 ? y - graphics_clip.y1 : graphics_clip.y2 - y;
+		last = yinc2 > 0 ? graphics_clip.y2 - y : y - graphics_clip.y1;
+	}
+	skip = major < 0 ? -major : 0;
+	if (last < numpixels) numpixels = last;
+	if (skip > numpixels) return;
+
+	// Jump straight to the first visible step.  The numerator wraps once
+	// for every minor axis step, so the result is exactly the same as
+	// walking the line from the start.
+	if (skip) {
+		skip_num = num + (long) skip * numadd;
+		num = skip_num % den;
+		skip_num /= den;
+		x += skip * xinc2 + (int) skip_num * xinc1;
+		y += skip * yinc2 + (int) skip_num * yinc1;
+	}
+
+	for (curpixel = skip; curpixel <= numpixels; curpixel++)
 	{
-	  glcd_pixel(x, y, colour);    	// Draw the current pixel
+	  // Draw the current pixel if it is inside the clip area.  Once the
+	  // line leaves again there is nothing more to draw.
+	  if (x >= graphics_clip.x1 && x <= graphics_clip.x2 && y >= graphics_clip.y1 && y <= graphics_clip.y2) {
+		_draw_pixel(x, y, colour);
+		drawn = 1;
+	  } else if (drawn) {
+		break;
+	  }
 	  num += numadd;          		// Increase the numerator by the top of the fraction
 	  if (num >= den)         		// Check if numerator >= denominator
 	  {
@@ -220,6 +759,10 @@ void draw_line(int x1, int y1, int x2, int y2, char colour)
 	  x += xinc2;             		// Change the x as appropriate
 	  y += yinc2;             		// Change the y as appropriate
 	}
+
+	if (drawn) {
+		_mark_dirty(x1 < x2 ? x1 : x2, y1 < y2 ? y1 : y2, x1 < x2 ? x2 : x1, y1 < y2 ? y2 : y1);
+	}
 }
 
 
@@ -231,6 +774,7 @@ void draw_circle(unsigned char centre_x, unsigned char centre_y, unsigned char r
 	signed char p = 1 - radius;
 
 	if (!radius) return;
+	if (_circle_outside_clip(centre_x, centre_y, radius)) return;
 
 	for (x = 0; x < y; x++) {
 		if (p < 0) {
@@ -240,18 +784,25 @@ void draw_circle(unsigned char centre_x, unsigned char centre_y, unsigned char r
 			y--;
 		}
 
-		glcd_pixel(centre_x - x, centre_y - y, colour);
-		glcd_pixel(centre_x - y, centre_y - x, colour);
-		glcd_pixel(centre_x + y, centre_y - x, colour);
-		glcd_pixel(centre_x + x, centre_y - y, colour);
-		glcd_pixel(centre_x - x, centre_y + y, colour);
-		glcd_pixel(centre_x - y, centre_y + x, colour);
-		glcd_pixel(centre_x + y, centre_y + x, colour);
-		glcd_pixel(centre_x + x, centre_y + y, colour);
+		_draw_clipped_pixel(centre_x - x, centre_y - y, colour);
+		_draw_clipped_pixel(centre_x - y, centre_y - x, colour);
+		_draw_clipped_pixel(centre_x + y, centre_y - x, colour);
+		_draw_clipped_pixel(centre_x + x, centre_y - y, colour);
+		_draw_clipped_pixel(centre_x - x, centre_y + y, colour);
+		_draw_clipped_pixel(centre_x - y, centre_y + x, colour);
+		_draw_clipped_pixel(centre_x + y, centre_y + x, colour);
+		_draw_clipped_pixel(centre_x + x, centre_y + y, colour);
 	}
+
+	_mark_dirty(centre_x - radius, centre_y - radius, centre_x + radius, centre_y + radius);
 }
 
 // Implementation of Bresenham's circle algorithm, filled.
+//
+// Rather than drawing horizontal lines for each octant (which overlap
+// heavily) every column of the circle is filled exactly once.  Columns
+// are the natural unit for the screen memory, so draw_vspan() can fill
+// up to 8 rows with a single write.
 void draw_filled_circle(unsigned char centre_x, unsigned char centre_y, unsigned char radius, unsigned char colour)
 {
 	signed char x = 0;
@@ -259,6 +810,7 @@ void draw_filled_circle(unsigned char centre_x, unsigned char centre_y, unsigned
 	signed char p = 1 - radius;
 
 	if (!radius) return;
+	if (_circle_outside_clip(centre_x, centre_y, radius)) return;
 
 	for (x = 0; x < y; x++) {
 		if (p < 0) {
@@ -268,9 +820,582 @@ void draw_filled_circle(unsigned char centre_x, unsigned char centre_y, unsigned
 			y--;
 		}
 
-		draw_line(centre_x - x, centre_y - y, centre_x + x, centre_y - y, colour);
-		draw_line(centre_x - y, centre_y - x, centre_x + y, centre_y - x, colour);
-		draw_line(centre_x + x, centre_y + y, centre_x - x, centre_y + y, colour);
-		draw_line(centre_x + y, centre_y + x, centre_x - y, centre_y + x, colour);
+		// Columns near the centre, at +/- x, are y pixels high
+		_draw_circle_columns(centre_x, centre_y, x, y, colour);
+
+		// The columns at +/- y are x pixels high.  Only draw these once
+		// y is about to change (or the loop is finishing) so that each
+		// column is drawn with its final height.
+		if (y != x && (p >= 0 || x + 1 >= y)) {
+			_draw_circle_columns(centre_x, centre_y, y, x, colour);
+		}
+	}
+}
+
+void draw_polygon(const point_t *points, unsigned char count, char colour)
+{
+	unsigned char i;
+
+	for (i = 0; i < count; i++) {
+		draw_line(points[i].x, points[i].y, points[i + 1 < count ? i + 1 : 0].x,
+			points[i + 1 < count ? i + 1 : 0].y, colour);
+	}
+}
+
+// Scanline polygon fill.  Every row is checked against each edge, and the
+// edges crossing the row are sorted and filled in pairs with draw_hspan().
+// Edges include their top row but not their bottom row, so a vertex shared
+// by two edges is only counted twice when it is a peak or a trough.  The
+// bottom row of the polygon is the exception, otherwise it would never be
+// drawn.
+//
+// Each span covers everything its edges pass through within half a row of
+// the centre, rather than just where they cross the centre.  Otherwise the
+// rows of a long, thin polygon would not join up.
+unsigned char draw_filled_polygon(const point_t *points, unsigned char count, char colour)
+{
+	int left[GRAPHICS_POLYGON_MAX];
+	int right[GRAPHICS_POLYGON_MAX];
+	const point_t *a, *b, *swap;
+	int y, top, bottom, last, x1, x2, tmp;
+	unsigned char i, j, n, prev;
+
+	if (count < 1 || count > GRAPHICS_POLYGON_MAX) return 0;
+
+	top = bottom = points[0].y;
+	for (i = 1; i < count; i++) {
+		if (points[i].y < top) top = points[i].y;
+		if (points[i].y > bottom) bottom = points[i].y;
+	}
+
+	// A polygon with no height has no edges to cross, draw it as a line
+	if (top == bottom) {
+		x1 = x2 = points[0].x;
+		for (i = 1; i < count; i++) {
+			if (points[i].x < x1) x1 = points[i].x;
+			if (points[i].x > x2) x2 = points[i].x;
+		}
+		draw_hspan(x1, x2, top, colour);
+		return 1;
+	}
+
+	// Skip rows outside of the clip area
+	last = bottom;
+	if (top < graphics_clip.y1) top = graphics_clip.y1;
+	if (bottom > graphics_clip.y2) bottom = graphics_clip.y2;
+
+	for (y = top; y <= bottom; y++) {
+		n = 0;
+
+		for (i = 0, prev = count - 1; i < count; prev = i++) {
+			a = &points[prev];
+			b = &points[i];
+			if (a->y == b->y) continue;
+
+			// Work from the top of the edge
+			if (a->y > b->y) {
+				swap = a;
+				a = b;
+				b = swap;
+			}
+			if (y < a->y || y > b->y || (y == b->y && y != last)) continue;
+
+			x1 = _edge_x(a, b, y * 2 - 1);
+			x2 = _edge_x(a, b, y * 2 + 1);
+			if (x1 > x2) {
+				tmp = x1;
+				x1 = x2;
+				x2 = tmp;
+			}
+
+			// Insertion sort, there are only ever a few edges
+			for (j = n++; j && left[j - 1] + right[j - 1] > x1 + x2; j--) {
+				left[j] = left[j - 1];
+				right[j] = right[j - 1];
+			}
+			left[j] = x1;
+			right[j] = x2;
+		}
+
+		for (j = 0; j + 1 < n; j += 2) {
+			draw_hspan(left[j], right[j + 1], y, colour);
+		}
+	}
+
+	return 1;
+}
+
+void draw_filled_triangle(int x1, int y1, int x2, int y2, int x3, int y3, char colour)
+{
+	point_t points[3];
+
+	points[0].x = x1;
+	points[0].y = y1;
+	points[1].x = x2;
+	points[1].y = y2;
+	points[2].x = x3;
+	points[2].y = y3;
+
+	draw_filled_polygon(points, 3, colour);
+}
+
+// Fill the pair of columns either side of a circle's centre
+void _draw_circle_columns(unsigned char centre_x, unsigned char centre_y, unsigned char offset, unsigned char height, unsigned char colour)
+{
+	draw_vspan(centre_x - offset, centre_y - height, centre_y + height, colour);
+	if (offset) {
+		draw_vspan(centre_x + offset, centre_y - height, centre_y + height, colour);
+	}
+}
+
+// Draw "vertical ceiling" data, one byte for every 8 rows of each column.
+// This is the same layout as the screen memory so each byte can be written
+// in one go.
+void _draw_columns(const unsigned char *data, unsigned char x, unsigned char y, unsigned char width, unsigned char height, unsigned char rop)
+{
+	unsigned char i, j;
+#ifdef GRAPHICS_DIRECT_BUFFER
+	unsigned char block[8];
+	unsigned char k, pages;
+
+	// When rotated, 8 columns are gathered and drawn together
+	if (graphics_rotation) {
+		pages = (height + 7) / 8;
+		for (j = 0; j < height; j += 8) {
+			for (i = 0; i < width; i += 8) {
+				for (k = 0; k < 8 && i + k < width; k++) {
+					block[k] = data[(i + k) * pages + j / 8];
+				}
+				_draw_block(block, x + i, y + j, k, height - j < 8 ? height - j : 8, rop);
+			}
+		}
+		return;
+	}
+#endif
+
+	for (i = 0; i < width; i++) {
+		for (j = 0; j < height; j += 8) {
+			_draw_column(x + i, y + j, *data++, height - j < 8 ? height - j : 8, rop);
+		}
+	}
+}
+
+// Draw run length encoded data (see BITMAP_RLE), decoding it a byte at a
+// time straight into the buffer.
+void _draw_rle_columns(const unsigned char *data, unsigned char x, unsigned char y, unsigned char width, unsigned char height, unsigned char rop)
+{
+	unsigned char i, j;
+	unsigned char code = 0;
+	unsigned char run = 0;
+	unsigned char value = 0;
+#ifdef GRAPHICS_DIRECT_BUFFER
+	unsigned char block[8];
+	unsigned char k = 0;
+#endif
+
+	for (j = 0; j < height; j += 8) {
+		for (i = 0; i < width; i++) {
+			// Start the next run
+			if (!run) {
+				code = *data++;
+				if (code < 0x80) {
+					run = code + 1;
+				} else if (code < 0xC0) {
+					run = code - 0x7E;
+					value = *data++;
+				} else {
+					run = code - 0xBF;
+					value = 0;
+				}
+			}
+
+			// Literal runs take a new byte every time
+			if (code < 0x80) value = *data++;
+			run--;
+
+#ifdef GRAPHICS_DIRECT_BUFFER
+			// When rotated, 8 columns are gathered and drawn together
+			if (graphics_rotation) {
+				block[k++] = value;
+				if (k == 8 || i + 1 == width) {
+					_draw_block(block, x + i + 1 - k, y + j, k, height - j < 8 ? height - j : 8, rop);
+					k = 0;
+				}
+				continue;
+			}
+#endif
+
+			_draw_column(x + i, y + j, value, height - j < 8 ? height - j : 8, rop);
+		}
+	}
+}
+
+// Draw an XBM bitmap, which is stored a row at a time with the leftmost
+// pixel in bit 0 of each byte.  Blocks of 8 rows are transposed into
+// columns and drawn like any other data.
+void _draw_xbm_rows(const unsigned char *data, unsigned char x, unsigned char y, unsigned char width, unsigned char height, unsigned char rop)
+{
+	unsigned char block[8];
+	unsigned char i, j, k;
+	unsigned char stride = (width + 7) / 8;
+
+	for (j = 0; j < height; j += 8) {
+		for (i = 0; i < width; i += 8) {
+			for (k = 0; k < 8; k++) {
+				block[k] = j + k < height ? data[(j + k) * stride + i / 8] : 0;
+			}
+			_transpose(block);
+			_draw_block(block, x + i, y + j, width - i < 8 ? width - i : 8, height - j < 8 ? height - j : 8, rop);
+		}
+	}
+}
+
+// Draw up to 8 columns of up to 8 rows, one byte for each column.  When
+// rotated the block is transposed so that it can still be written to the
+// buffer a byte at a time.  The contents of block are changed.
+void _draw_block(unsigned char *block, unsigned char x, unsigned char y, unsigned char width, unsigned char height, unsigned char rop)
+{
+	unsigned char i;
+#ifdef GRAPHICS_DIRECT_BUFFER
+	unsigned char rows = 0;
+	unsigned char columns = 0;
+
+	if (graphics_rotation) {
+		// Find the rows and columns inside the clip area
+		for (i = 0; i < height; i++) {
+			if (y + i >= graphics_clip.y1 && y + i <= graphics_clip.y2) rows |= 1 << i;
+		}
+		for (i = 0; i < width; i++) {
+			if (x + i >= graphics_clip.x1 && x + i <= graphics_clip.x2) columns |= 1 << i;
+		}
+		if (!rows || !columns) return;
+
+		// Upside down, each column is mirrored and moved
+		if (graphics_rotation == GRAPHICS_ROTATE_180) {
+			for (i = 0; i < width; i++) {
+				if (columns & (1 << i)) {
+					_write_column(graphics_stride - x - i, graphics_height - y - 7,
+						_reverse_bits(block[i]), _reverse_bits(rows), rop);
+				}
+			}
+			return;
+		}
+
+		// Otherwise each row of the block becomes a column of the buffer
+		_transpose(block);
+		for (i = 0; i < height; i++) {
+			if (!(rows & (1 << i))) continue;
+
+			if (graphics_rotation == GRAPHICS_ROTATE_90) {
+				_write_column(graphics_stride - y - i, x - 1, block[i], columns, rop);
+			} else {
+				_write_column(y + i - 1, graphics_height - x - 7,
+					_reverse_bits(block[i]), _reverse_bits(columns), rop);
+			}
+		}
+		return;
+	}
+#endif
+
+	for (i = 0; i < width; i++) {
+		_draw_column(x + i, y, block[i], height, rop);
+	}
+}
+
+// Transpose an 8x8 block of pixels, so that bit r of byte c becomes bit c
+// of byte r.  This swaps between columns and rows of pixels.
+//
+// The block is held in two 32 bit words and bits are swapped in parallel,
+// first single bits, then pairs and finally groups of 4.  See "Hacker's
+// Delight" by Henry S. Warren, section 7-3.
+void _transpose(unsigned char *block)
+{
+	unsigned long a, b, t;
+
+	a = ((unsigned long) block[7] << 24) | ((unsigned long) block[6] << 16) | ((unsigned short) block[5] << 8) | block[4];
+	b = ((unsigned long) block[3] << 24) | ((unsigned long) block[2] << 16) | ((unsigned short) block[1] << 8) | block[0];
+
+	t = (a ^ (a >> 7)) & 0x00AA00AA;
+	a = a ^ t ^ (t << 7);
+	t = (b ^ (b >> 7)) & 0x00AA00AA;
+	b = b ^ t ^ (t << 7);
+
+	t = (a ^ (a >> 14)) & 0x0000CCCC;
+	a = a ^ t ^ (t << 14);
+	t = (b ^ (b >> 14)) & 0x0000CCCC;
+	b = b ^ t ^ (t << 14);
+
+	t = (a & 0xF0F0F0F0) | ((b >> 4) & 0x0F0F0F0F);
+	b = ((a << 4) & 0xF0F0F0F0) | (b & 0x0F0F0F0F);
+	a = t;
+
+	block[7] = a >> 24;
+	block[6] = a >> 16;
+	block[5] = a >> 8;
+	block[4] = a;
+	block[3] = b >> 24;
+	block[2] = b >> 16;
+	block[1] = b >> 8;
+	block[0] = b;
+}
+
+unsigned char _reverse_bits(unsigned char b)
+{
+	b = (b >> 4) | (b << 4);
+	b = ((b >> 2) & 0x33) | ((b << 2) & 0xCC);
+	return ((b >> 1) & 0x55) | ((b << 1) & 0xAA);
+}
+
+// Write up to 8 pixels down a single column.  Bit 0 of data is drawn at
+// y, bit 1 at y + 1 and so on.  When y is not on a page boundary the bits
+// straddle two bytes of the buffer and are shifted & masked into both,
+// combined with the existing contents using the raster operation rop.
+void _draw_column(unsigned char x, unsigned char y, unsigned char data, unsigned char count, unsigned char rop)
+{
+	// Clip to the current clip rectangle, dropping bits from the top or
+	// bottom of the column as needed
+	if (x < graphics_clip.x1 || x > graphics_clip.x2) return;
+	if (y < graphics_clip.y1) {
+		if (graphics_clip.y1 - y >= count) return;
+		count -= graphics_clip.y1 - y;
+		data >>= graphics_clip.y1 - y;
+		y = graphics_clip.y1;
+	}
+	if (y > graphics_clip.y2) return;
+	if (y + count - 1 > graphics_clip.y2) count = graphics_clip.y2 - y + 1;
+
+#ifdef GRAPHICS_DIRECT_BUFFER
+	if (graphics_buffer) {
+		// A single column that is rotated becomes a single row
+		if (graphics_rotation) {
+			unsigned char block[8] = { 0 };
+
+			block[0] = data;
+			_draw_block(block, x, y, 1, count, rop);
+			return;
+		}
+
+		// Real screen coordinates are 0-63, not 1-64.
+		_write_column(x - 1, y - 1, data, (1 << count) - 1, rop);
+		return;
+	}
+#endif
+
+	if (graphics_driver->blit) {
+		graphics_driver->blit(x, y, data, count, rop);
+		return;
+	}
+
+	while (count--) {
+		if (rop == ROP_COPY) {
+			graphics_driver->pixel(x, y, data & 1);
+		} else if (data & 1) {
+			// Pixels cannot be read back, so XOR is treated as OR
+			graphics_driver->pixel(x, y, rop != ROP_AND_NOT);
+		}
+		y++;
+		data >>= 1;
+	}
+}
+
+#ifdef GRAPHICS_DIRECT_BUFFER
+// Merge the bits set in mask into the buffer at (x,y), which start from 0
+// and are not rotated.  The bits are shifted & masked into two bytes when y
+// is not on a page boundary.  y can be above the buffer if the bits that
+// would be outside are not in mask.
+void _write_column(int x, int y, unsigned char data, unsigned char pixels, unsigned char rop)
+{
+	unsigned char *p;
+	unsigned short mask;
+	unsigned short bits;
+
+	if (y < 0) {
+		data >>= -y;
+		pixels >>= -y;
+		y = 0;
+	}
+
+	mask = (unsigned short) pixels << (y % 8);
+	bits = ((unsigned short) data << (y % 8)) & mask;
+
+	p = &graphics_buffer[(y / 8) * graphics_stride + x];
+
+	// Merge into this page, then spill into the page below
+	for (;;) {
+		switch (rop) {
+			case ROP_OR:
+				*p |= (unsigned char) bits;
+				break;
+			case ROP_XOR:
+				*p ^= (unsigned char) bits;
+				break;
+			case ROP_AND_NOT:
+				*p &= ~(unsigned char) bits;
+				break;
+			default:
+				*p = (*p & ~(unsigned char) mask) | (unsigned char) bits;
+				break;
+		}
+#ifdef GRAPHICS_COUNT_WRITES
+		graphics_bytes_written++;
+#endif
+
+		mask >>= 8;
+		if (!mask) break;
+		bits >>= 8;
+		p += graphics_stride;
+	}
+}
+
+// Move a point from the rotated view to where it is in the buffer
+void _rotate_point(int *x, int *y)
+{
+	int tmp = *x;
+
+	switch (graphics_rotation) {
+		case GRAPHICS_ROTATE_90:
+			*x = graphics_stride + 1 - *y;
+			*y = tmp;
+			break;
+		case GRAPHICS_ROTATE_180:
+			*x = graphics_stride + 1 - *x;
+			*y = graphics_height + 1 - *y;
+			break;
+		case GRAPHICS_ROTATE_270:
+			*x = *y;
+			*y = graphics_height + 1 - tmp;
+			break;
+	}
+}
+
+void _rotate_rectangle(int *x1, int *y1, int *x2, int *y2)
+{
+	int tmp;
+
+	_rotate_point(x1, y1);
+	_rotate_point(x2, y2);
+
+	if (*x1 > *x2) {
+		tmp = *x1;
+		*x1 = *x2;
+		*x2 = tmp;
+	}
+	if (*y1 > *y2) {
+		tmp = *y1;
+		*y1 = *y2;
+		*y2 = tmp;
+	}
+}
+#endif
+
+// Set a single pixel that is known to be inside the clip area.  With
+// GRAPHICS_DIRECT_BUFFER the buffer is written directly, skipping the
+// bounds checks in the driver.
+void _draw_pixel(int x, int y, unsigned char colour)
+{
+#ifdef GRAPHICS_DIRECT_BUFFER
+	if (graphics_buffer) {
+		unsigned char *p;
+
+		if (graphics_rotation) _rotate_point(&x, &y);
+		p = &graphics_buffer[((y - 1) / 8) * graphics_stride + x - 1];
+#ifdef GRAPHICS_COUNT_WRITES
+		graphics_bytes_written++;
+#endif
+
+		if (colour) {
+			*p |= 1 << ((y - 1) % 8);
+		} else {
+			*p &= ~(1 << ((y - 1) % 8));
+		}
+		return;
 	}
-}
+#endif
+
+	graphics_driver->pixel(x, y, colour);
+}
+
+void _draw_clipped_pixel(int x, int y, unsigned char colour)
+{
+	if (x < graphics_clip.x1 || x > graphics_clip.x2 || y < graphics_clip.y1 || y > graphics_clip.y2) return;
+	_draw_pixel(x, y, colour);
+}
+
+// Where an edge is at a height of y / 2, rounded to the nearest pixel.  a
+// must be the top of the edge, and y is limited to the ends of the edge.
+int _edge_x(const point_t *a, const point_t *b, int y)
+{
+	long num;
+	int dy = (b->y - a->y) * 2;
+
+	y -= a->y * 2;
+	if (y < 0) y = 0;
+	if (y > dy) y = dy;
+
+	num = (long) y * (b->x - a->x) * 2;
+	if (num >= 0) {
+		return a->x + (int) ((num + dy) / (dy * 2));
+	} else {
+		return a->x - (int) ((dy - num) / (dy * 2));
+	}
+}
+
+// Sort the corners of a rounded rectangle and limit the radius so that
+// opposite corners do not overlap
+unsigned char _clamp_radius(int *x1, int *y1, int *x2, int *y2, unsigned char radius)
+{
+	int tmp;
+
+	if (*x1 > *x2) {
+		tmp = *x1;
+		*x1 = *x2;
+		*x2 = tmp;
+	}
+	if (*y1 > *y2) {
+		tmp = *y1;
+		*y1 = *y2;
+		*y2 = tmp;
+	}
+
+	if (radius > (*x2 - *x1) / 2) radius = (*x2 - *x1) / 2;
+	if (radius > (*y2 - *y1) / 2) radius = (*y2 - *y1) / 2;
+	return radius;
+}
+
+// Half the width of a corner, d rows above or below its centre.  Corners
+// are drawn from the top row down, so the search starts from the width of
+// the row above, w.  Using r * (r + 1) - 1 rather than r * r gives rounder
+// corners, and a radius of 1 just cuts off the corner pixels like draw_box().
+int _corner_width(unsigned char radius, unsigned char d, int w)
+{
+	int limit = radius * (radius + 1) - 1 - d * d;
+
+	while ((w + 1) * (w + 1) <= limit) w++;
+	return w;
+}
+
+unsigned char _circle_outside_clip(int centre_x, int centre_y, int radius)
+{
+	return centre_x + radius < graphics_clip.x1 || centre_x - radius > graphics_clip.x2 ||
+		centre_y + radius < graphics_clip.y1 || centre_y - radius > graphics_clip.y2;
+}
+
+// Tell the driver which part of the buffer has been written directly,
+// limited to the clip area and moved to where the target is on screen.
+void _mark_dirty(int x1, int y1, int x2, int y2)
+{
+#ifdef GRAPHICS_DIRECT_BUFFER
+	// Drivers track their own changes when drawn through the hooks
+	if (!graphics_buffer || !graphics_driver->mark_dirty) return;
+
+	if (x1 < graphics_clip.x1) x1 = graphics_clip.x1;
+	if (y1 < graphics_clip.y1) y1 = graphics_clip.y1;
+	if (x2 > graphics_clip.x2) x2 = graphics_clip.x2;
+	if (y2 > graphics_clip.y2) y2 = graphics_clip.y2;
+	if (x1 > x2 || y1 > y2) return;
+
+	if (graphics_rotation) _rotate_rectangle(&x1, &y1, &x2, &y2);
+	graphics_driver->mark_dirty(x1 + graphics_origin_x, y1 + graphics_origin_y,
+		x2 + graphics_origin_x, y2 + graphics_origin_y);
+#endif
+}
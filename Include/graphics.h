@@ -6,45 +6,73 @@
  * @sa     <a href="http://en.wikipedia.org/wiki/Bresenham's_line_algorithm">Bresenham's line algorithm on Wikipedia</a>
  * @details
  *
- * A graphics library for black and white graphic LCDs.  Supports lines, rectangles and text.
+ * A graphics library for black and white graphic LCDs.  Supports lines, rectangles, circles,
+ * polygons, text and bitmaps.
  *
- * Fonts are available separately in header files, see the fonts/ directory.
+ * Fonts are available separately in header files, see the fonts/ directory.  Each
+ * font is a font_t, which holds the start character, height and tables of the
+ * offset & width of every character so that text can be measured quickly.
  *
- * This requires a hardware driver for the GLCD that provides a glcd_pixel() routine.  See
- * my ST7565 library for an example.
+ * The screen is drawn on through a glcd_driver_t, which is a table of hooks provided by
+ * the display driver.  Only a pixel routine is required, so the library can be ported
+ * easily to any graphic LCD.  Drivers can also provide routines for horizontal and
+ * vertical lines and for columns of up to 8 pixels, which are used instead of setting
+ * each pixel in turn.  See the ST7565 and KS0108 libraries for examples.  Select the
+ * driver with graphics_set_driver() before drawing anything.
  *
- * The benefit of this approach is that it can be ported easily to any graphic LCD.  However,
- * speed benefits could be gained by writing routines that draw whole bytes at a time.
+ * Drivers that keep a page-oriented copy of the screen in RAM (like the ST7565 library)
+ * can also let this library write whole bytes at a time, which is much faster for text.
+ * See GRAPHICS_DIRECT_BUFFER in graphics-config.h.
  *
  * Fonts and graphics can be converted from Windows TTF fonts or images using the muGUI
  * "Font and Bitmap Generator", which is free.
  *
  * Example usage:
  * @code
+ *    glcd_init();
+ *    graphics_set_driver(&st7565_driver);
+ *
  *    // Draw some text with spacing 1, at location (10,10)
- *    draw_text("Example string", 10, 10, Tahoma10, 1);
+ *    draw_text("Example string", 10, 10, &Tahoma10, 1);
  *
  *    // Draw a rectangle from (1,1) to (50,50)
  *    draw_rectangle(1, 1, 50, 50, 1);
  *
  *    // Draw a circle, centred at (32,32) with radius 10
  *    draw_circle(32, 32, 10, 1);
+ *
+ *    // Draw a gauge needle from (32,32) to (50,12)
+ *    draw_filled_triangle(30, 32, 34, 32, 50, 12, 1);
+ *
+ *    // Draw a button with corners of radius 4
+ *    draw_rounded_rectangle(70, 40, 120, 60, 4, 1);
+ *
+ *    // Draw an icon at (100,2), then invert it with XOR
+ *    draw_bitmap(&icon, 100, 2, ROP_COPY);
+ *    draw_bitmap(&icon, 100, 2, ROP_XOR);
+ * @endcode
+ *
+ * Screens mounted in portrait can be drawn on with graphics_set_rotation().  All
+ * coordinates are then in the rotated view, for example 64 pixels wide and 128
+ * pixels high:
+ * @code
+ *    graphics_set_rotation(GRAPHICS_ROTATE_90);
+ *    draw_text("Portrait", 1, 1, &Tahoma10, 1);
+ * @endcode
+ *
+ * Drawing can be limited to part of the screen with a clip rectangle.  Anything
+ * outside of the clip rectangle is skipped as early as possible, so redrawing a
+ * small window of the screen is cheap:
+ * @code
+ *    // Only draw inside (10,10) to (60,30)
+ *    graphics_clip_push(10, 10, 60, 30);
+ *    draw_text("Clipped", 5, 15, &Tahoma10, 1);
+ *    graphics_clip_pop();
  * @endcode
  */
 #ifndef _GRAPHICS_H_
 #define _GRAPHICS_H_
 
-#define FONT_HEADER_TYPE		0
-#define FONT_HEADER_ORIENTATION	1
-#define FONT_HEADER_START		2
-#define FONT_HEADER_LETTERS		3
-#define FONT_HEADER_HEIGHT		4
-
-#define FONT_TYPE_FIXED			0
-#define FONT_TYPE_PROPORTIONAL	1
-
-#define FONT_ORIENTATION_VERTICAL_CEILING	2
-
 typedef struct {
 	unsigned char x1;
 	unsigned char y1; 
@@ -52,8 +80,177 @@ typedef struct {
 	unsigned char y2;
 } bounding_box_t;
 
+/**
+ * The hooks used to draw on a display, provided by its driver.
+ *
+ * Coordinates passed to the hooks are from 1 - width and 1 - height, and
+ * have already been clipped.  Any hook except pixel can be 0, in which case
+ * the library falls back to setting each pixel in turn.
+ */
+typedef struct {
+	/** Width of the screen in pixels */
+	unsigned char width;
+	/** Height of the screen in pixels */
+	unsigned char height;
+	/** A page-oriented copy of the screen that is written directly with
+	    GRAPHICS_DIRECT_BUFFER, or 0.  The hooks are not used if this is set. */
+	unsigned char *buffer;
+	/** Set or clear a single pixel */
+	void (*pixel)(unsigned char x, unsigned char y, unsigned char colour);
+	/** Set or clear a row of pixels from x1 to x2 */
+	void (*hspan)(unsigned char x1, unsigned char x2, unsigned char y, unsigned char colour);
+	/** Set or clear a column of pixels from y1 to y2 */
+	void (*vspan)(unsigned char x, unsigned char y1, unsigned char y2, unsigned char colour);
+	/** Draw count (1 - 8) pixels down a column with a raster operation (see
+	    ROP_COPY), bit 0 of data at y */
+	void (*blit)(unsigned char x, unsigned char y, unsigned char data, unsigned char count, unsigned char rop);
+	/** Called after part of buffer has been written directly */
+	void (*mark_dirty)(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2);
+	/** Send any changes to the screen */
+	void (*refresh)(void);
+} glcd_driver_t;
+
+/** A point on the screen, for example a vertex of a polygon */
+typedef struct {
+	int x;
+	int y;
+} point_t;
+
+#define TEXT_ALIGN_LEFT		0
+#define TEXT_ALIGN_CENTRE	1
+#define TEXT_ALIGN_RIGHT	2
+
+/**
+ * Flag for fonts and bitmaps whose data is run length encoded.
+ *
+ * Compressed data is stored a page (8 rows) at a time from left to right,
+ * rather than a column at a time, as runs are much longer that way.  It
+ * is a series of codes, each followed by its data:
+ *
+ *  - 0x00 - 0x7F: (code + 1) bytes are copied as they are
+ *  - 0x80 - 0xBF: the next byte is repeated (code - 0x7E) times
+ *  - 0xC0 - 0xFF: (code - 0xBF) zero bytes
+ *
+ * Support/GlcdFiles/fontpack.py compresses font headers.
+ */
+#define BITMAP_RLE			0x01
+/**
+ * Flag for bitmaps stored a row at a time in XBM format, with the leftmost
+ * pixel of each byte in bit 0 and each row padded to a whole byte.  XBM
+ * files from most image editors can be included directly:
+ * @code
+ *    #include "logo.xbm"
+ *    const bitmap_t logo = { logo_bits, logo_width, logo_height, BITMAP_XBM };
+ * @endcode
+ *
+ * Blocks of 8x8 pixels are transposed into columns as they are drawn.
+ */
+#define BITMAP_XBM			0x02
+
+/** No rotation, see graphics_set_rotation() */
+#define GRAPHICS_ROTATE_0	0
+/** Rotated 90 degrees clockwise, the top of the view is on the right of the screen */
+#define GRAPHICS_ROTATE_90	1
+/** Rotated 180 degrees */
+#define GRAPHICS_ROTATE_180	2
+/** Rotated 270 degrees clockwise, the top of the view is on the left of the screen */
+#define GRAPHICS_ROTATE_270	3
+
+/** Returned by font_glyph() for a character that is not in the font */
+#define FONT_NO_GLYPH		0xFF
+
+/**
+ * A run of characters with consecutive codes in a font, see font_t.
+ */
+typedef struct {
+	/** The first character, as a Unicode code point */
+	unsigned short first;
+	/** The number of characters */
+	unsigned char count;
+	/** The index of the first character in the tables of the font */
+	unsigned char index;
+} font_range_t;
+
+/**
+ * A font, as generated alongside the bitmaps in the fonts/ directory.
+ *
+ * Each bitmap is stored "vertical ceiling", one byte for every 8 rows of
+ * each column, unless the font is compressed (see BITMAP_RLE).  The offset
+ * and width of every character are held in tables so they can be looked
+ * up directly.
+ *
+ * The characters from start are looked up directly.  A font can also have
+ * other characters, such as a degree sign or a few accented letters, without
+ * any blank characters in between.  These are listed in ranges, sorted by
+ * code, which are searched by halving.  A font can have up to 255 characters
+ * in total.
+ */
+typedef struct {
+	/** Bitmap data for all characters */
+	const unsigned char *bitmaps;
+	/** Offset of each character in bitmaps */
+	const unsigned short *offsets;
+	/** Width of each character in pixels */
+	const unsigned char *widths;
+	/** The first character in the font */
+	unsigned char start;
+	/** The number of characters from start */
+	unsigned char count;
+	/** Height of the font in pixels */
+	unsigned char height;
+	/** 0, or BITMAP_RLE if the bitmaps are compressed */
+	unsigned char flags;
+	/** Rows of each character above and below the baseline (2 bytes per
+	    character), or 0 if not known */
+	const unsigned char *extents;
+	/** Rows from the top of the font down to the baseline, inclusive */
+	unsigned char ascent;
+	/** Characters after the first count, or 0 if there are none */
+	const font_range_t *ranges;
+	/** The number of ranges */
+	unsigned char range_count;
+} font_t;
+
+/**
+ * Part of a line of text that is drawn in one font, see draw_text_runs().
+ */
+typedef struct {
+	/** The text to render */
+	const char *text;
+	/** The font used to render the text */
+	const font_t *font;
+} text_run_t;
+
+/**
+ * A 1 bit per pixel bitmap, for example an icon from the muGUI generator.
+ *
+ * The data is stored "vertical ceiling" like the fonts, one byte for every 8
+ * rows of each column, with the least significant bit at the top.  It can
+ * also be compressed (see BITMAP_RLE) or stored a row at a time (see
+ * BITMAP_XBM).
+ */
+typedef struct {
+	/** Bitmap data, ((height + 7) / 8) bytes for each column */
+	const unsigned char *data;
+	/** Width of the bitmap in pixels */
+	unsigned char width;
+	/** Height of the bitmap in pixels */
+	unsigned char height;
+	/** 0, BITMAP_RLE if the data is compressed or BITMAP_XBM */
+	unsigned char flags;
+} bitmap_t;
+
+/** Raster operations used by draw_bitmap() */
+#define ROP_COPY	0	// Replace the screen with the bitmap
+#define ROP_OR		1	// Set pixels that are set in the bitmap
+#define ROP_XOR		2	// Invert pixels that are set in the bitmap
+#define ROP_AND_NOT	3	// Clear pixels that are set in the bitmap
+
 /**
  * Draw a string on the screen at a specific location.
+ *
+ * With GRAPHICS_UTF8 defined, strings are decoded as UTF-8.  This is the
+ * same as ASCII for characters below 128.
  * 
  * @param string	The text to render
  * @param x			The x position, from 1 - SCREEN_WIDTH
@@ -61,16 +258,85 @@ typedef struct {
  * @param font		The font used to render the text
  * @param spacing	The gap in pixels between letters
  */
-bounding_box_t draw_text(char *string, unsigned char x, unsigned char y, unsigned char *font, unsigned char spacing);
+bounding_box_t draw_text(char *string, unsigned char x, unsigned char y, const font_t *font, unsigned char spacing);
+/**
+ * Draw a string inside a box, wrapping it onto as many lines as needed.
+ *
+ * Lines are broken at spaces where possible, or at a new line character.  Each
+ * letter is only measured once, so this is cheaper than calling text_width()
+ * to position each line before drawing it.  Lines that do not fit entirely in
+ * the box are not drawn.
+ *
+ * @param string	The text to render
+ * @param box		The area to draw the text inside
+ * @param align		TEXT_ALIGN_LEFT, TEXT_ALIGN_CENTRE or TEXT_ALIGN_RIGHT
+ * @param font		The font used to render the text
+ * @param spacing	The gap in pixels between letters
+ * @return			The area actually covered by the text
+ */
+bounding_box_t draw_text_box(char *string, bounding_box_t box, unsigned char align, const font_t *font, unsigned char spacing);
+/**
+ * Draw a line of text that changes font part of the way along, for example a
+ * status line with icons from Webdings between words in Tahoma.  The runs are
+ * drawn one after the other with the same baseline, so smaller fonts are
+ * moved down to line up with the largest.  Fonts without an ascent are
+ * treated as having their baseline at the bottom.
+ *
+ * Example usage:
+ * @code
+ *    const text_run_t status[] = {
+ *        { "21.5", &Tahoma10 },
+ *        { " C ", &Tahoma7 },
+ *        { "~", &Webdings14 }
+ *    };
+ *
+ *    // Right align the line, measuring it only once
+ *    draw_text_runs(status, 3, SCREEN_WIDTH + 1 - text_runs_width(status, 3, 1), 1, 1);
+ * @endcode
+ *
+ * @param runs		The parts of the line, in order
+ * @param count		The number of runs
+ * @param x			The x position, from 1 - SCREEN_WIDTH
+ * @param y			The y position of the top of the line, from 1 - SCREEN_HEIGHT
+ * @param spacing	The gap in pixels between letters, including between runs
+ * @return			The area covered by the line
+ */
+bounding_box_t draw_text_runs(const text_run_t *runs, unsigned char count, unsigned char x, unsigned char y, unsigned char spacing);
 /**
  * Draw a single character on the screen at a specific location.
  * 
- * @param c			The character to render
+ * @param c			The character to render, as a Unicode code point
  * @param x			The x position, from 1 - SCREEN_WIDTH
  * @param y			The y position, from 1 - SCREEN_HEIGHT
  * @param font		The font used to render the text
  */
-bounding_box_t draw_char(unsigned char c, unsigned char x, unsigned char y, unsigned char *font);
+bounding_box_t draw_char(unsigned short c, unsigned char x, unsigned char y, const font_t *font);
+/**
+ * Find a character in a font.
+ *
+ * @param font		The font to look in
+ * @param c			The character, as a Unicode code point
+ * @return			The index of the character in the offsets, widths and
+ *					extents of the font, or FONT_NO_GLYPH if it is not there
+ */
+unsigned char font_glyph(const font_t *font, unsigned short c);
+/**
+ * Draw a bitmap on the screen at a specific location.
+ *
+ * The raster operation decides how the bitmap is combined with what is already
+ * on the screen.  ROP_XOR is useful for cursors, as drawing the same bitmap
+ * twice restores the screen.  ROP_AND_NOT erases the shape of the bitmap.
+ *
+ * ROP_XOR needs to read the screen, so without GRAPHICS_DIRECT_BUFFER it
+ * behaves like ROP_OR.
+ *
+ * @param bitmap	The bitmap to draw
+ * @param x			The x position, from 1 - SCREEN_WIDTH
+ * @param y			The y position, from 1 - SCREEN_HEIGHT
+ * @param rop		ROP_COPY, ROP_OR, ROP_XOR or ROP_AND_NOT
+ * @return			The area covered by the bitmap
+ */
+bounding_box_t draw_bitmap(const bitmap_t *bitmap, unsigned char x, unsigned char y, unsigned char rop);
 /**
  * Draw a simple rectangle.
  *
@@ -92,6 +358,62 @@ void draw_rectangle(int x1, int y1, int x2, int y2, char colour);
  * @param colour 	0 = OFF, any other value = ON
  */
 void draw_box(int x1, int y1, int x2, int y2, char colour);
+/**
+ * Draw a rectangle with rounded corners of any radius.  The radius is
+ * reduced if needed so that the corners fit.
+ *
+ * @param x1 		The x1 position, from 1 - SCREEN_WIDTH
+ * @param y1 		The y1 position, from 1 - SCREEN_HEIGHT
+ * @param x2 		The x2 position, from 1 - SCREEN_WIDTH
+ * @param y2 		The y2 position, from 1 - SCREEN_HEIGHT
+ * @param radius	The radius of the corners, in pixels
+ * @param colour 	0 = OFF, any other value = ON
+ */
+void draw_rounded_rectangle(int x1, int y1, int x2, int y2, unsigned char radius, char colour);
+/**
+ * Draw a filled rectangle with rounded corners of any radius.  Each row of
+ * the corners is a single horizontal span and the middle is filled with
+ * draw_filled_rectangle().
+ *
+ * @param x1 		The x1 position, from 1 - SCREEN_WIDTH
+ * @param y1 		The y1 position, from 1 - SCREEN_HEIGHT
+ * @param x2 		The x2 position, from 1 - SCREEN_WIDTH
+ * @param y2 		The y2 position, from 1 - SCREEN_HEIGHT
+ * @param radius	The radius of the corners, in pixels
+ * @param colour 	0 = OFF, any other value = ON
+ */
+void draw_filled_rounded_rectangle(int x1, int y1, int x2, int y2, unsigned char radius, char colour);
+/**
+ * Draw a horizontal line.  This is much faster than draw_line() because
+ * whole runs of pixels are set at once.
+ *
+ * @param x1 		The x1 position, from 1 - SCREEN_WIDTH
+ * @param x2 		The x2 position, from 1 - SCREEN_WIDTH
+ * @param y 		The y position, from 1 - SCREEN_HEIGHT
+ * @param colour 	0 = OFF, any other value = ON
+ */
+void draw_hspan(int x1, int x2, int y, char colour);
+/**
+ * Draw a vertical line.  This is much faster than draw_line() because up
+ * to 8 pixels are set with a single write.
+ *
+ * @param x 		The x position, from 1 - SCREEN_WIDTH
+ * @param y1 		The y1 position, from 1 - SCREEN_HEIGHT
+ * @param y2 		The y2 position, from 1 - SCREEN_HEIGHT
+ * @param colour 	0 = OFF, any other value = ON
+ */
+void draw_vspan(int x, int y1, int y2, char colour);
+/**
+ * Draw a filled rectangle.  Each 8 pixel high page of the rectangle is
+ * filled with a single write per column.
+ *
+ * @param x1 		The x1 position, from 1 - SCREEN_WIDTH
+ * @param y1 		The y1 position, from 1 - SCREEN_HEIGHT
+ * @param x2 		The x2 position, from 1 - SCREEN_WIDTH
+ * @param y2 		The y2 position, from 1 - SCREEN_HEIGHT
+ * @param colour 	0 = OFF, any other value = ON
+ */
+void draw_filled_rectangle(int x1, int y1, int x2, int y2, char colour);
 /**
  * Obtain the width of a string in pixels.
  *
@@ -99,21 +421,33 @@ void draw_box(int x1, int y1, int x2, int y2, char colour);
  * @param font		The font used to render the text
  * @param spacing	The gap between letters, in pixels
  */
-unsigned char text_width(unsigned char *string, unsigned char *font, unsigned char spacing);
+unsigned char text_width(unsigned char *string, const font_t *font, unsigned char spacing);
 /**
- * Obtain the height of a string in pixels.  
+ * Obtain the height of a string in pixels, from the top of the tallest letter
+ * to the bottom of the lowest descender.  For example "no" is not as tall as
+ * "Lo", which is not as tall as "Log".
  *
- * @note At present this will return the height of the font, rather than the
- * specific string.  For example the character 'o' is not as tall as 'L' and
- * does not have the descender of 'g'.
+ * @note Fonts without extents (such as those from mugui_edeca.xsl) always
+ * return the height of the font.  Use Support/GlcdFiles/fontpack.py to add them.
  *
  * @param string	The text to be measured
  * @param font		The font used to render the text
  */
-unsigned char text_height(unsigned char *string, unsigned char *font);
+unsigned char text_height(unsigned char *string, const font_t *font);
+/**
+ * Obtain the width of a line drawn by draw_text_runs() in pixels.  Unlike
+ * text_width(), characters that are not in their font are skipped.
+ *
+ * @param runs		The parts of the line, in order
+ * @param count		The number of runs
+ * @param spacing	The gap between letters, in pixels
+ */
+unsigned char text_runs_width(const text_run_t *runs, unsigned char count, unsigned char spacing);
 /**
  * Draw a line using Bresenham's algorithm.
  *
+ * Horizontal and vertical lines are passed to draw_hspan() and draw_vspan().
+ *
  * This code credit Tom Ootjers, originally from: http://tinyurl.com/czok7vx
  *
  * @param x1 		The x1 position, from 1 - SCREEN_WIDTH
@@ -135,8 +469,7 @@ void draw_circle(unsigned char centre_x, unsigned char centre_y, unsigned char r
 /**
  * Draw a filled circle using an efficient circle algorithm.
  *
- * This is separate from draw_circle as it will bring in the draw_line function,
- * which may not be desirable for small code footprint.
+ * Each column of the circle is filled exactly once using draw_vspan().
  *
  * @param centre_x	The x position of the circle centre, from 1 - SCREEN_WIDTH
  * @param centre_y	The y position of the circle centre, from 1 - SCREEN_HEIGHT
@@ -144,16 +477,129 @@ void draw_circle(unsigned char centre_x, unsigned char centre_y, unsigned char r
  * @param colour 	0 = OFF, any other value = ON
  */
 void draw_filled_circle(unsigned char centre_x, unsigned char centre_y, unsigned char radius, unsigned char colour);
-
 /**
- * This function must be provided by the underlying graphics driver.  It will
- * be called by the routines in this library to plot individual pixels.
+ * Draw the outline of a polygon, joining the last point back to the first.
  *
- * @param x			The x position, from 1 - SCREEN_WIDTH
- * @param y			The y position, from 1 - SCREEN_HEIGHT
+ * @param points	The vertices of the polygon
+ * @param count		The number of vertices
+ * @param colour 	0 = OFF, any other value = ON
+ */
+void draw_polygon(const point_t *points, unsigned char count, char colour);
+/**
+ * Draw a filled polygon.  The polygon is filled a row at a time with
+ * horizontal spans, so there are no gaps however thin it is.  Polygons
+ * may be concave or cross over themselves, in which case areas that are
+ * inside an even number of times are left empty.
+ *
+ * Points may be outside of the screen, only the part inside the clip
+ * rectangle is drawn.
+ *
+ * @param points	The vertices of the polygon
+ * @param count		The number of vertices, up to GRAPHICS_POLYGON_MAX
  * @param colour 	0 = OFF, any other value = ON
+ * @return			0 if there are too many vertices, 1 otherwise
+ */
+unsigned char draw_filled_polygon(const point_t *points, unsigned char count, char colour);
+/**
+ * Draw a filled triangle, for example an arrow head or the needle of a gauge.
+ *
+ * @param x1 		The x position of the first corner
+ * @param y1 		The y position of the first corner
+ * @param x2 		The x position of the second corner
+ * @param y2 		The y position of the second corner
+ * @param x3 		The x position of the third corner
+ * @param y3 		The y position of the third corner
+ * @param colour 	0 = OFF, any other value = ON
+ */
+void draw_filled_triangle(int x1, int y1, int x2, int y2, int x3, int y3, char colour);
+
+/**
+ * Select the display to draw on.  This must be called before anything is
+ * drawn, and resets the clip rectangle to cover the whole screen.  Firmware
+ * with more than one display can switch between them at any time.
+ *
+ * @param driver	The driver of the display, for example &st7565_driver
+ */
+void graphics_set_driver(const glcd_driver_t *driver);
+/**
+ * Send everything drawn since the last refresh to the screen, if the driver
+ * needs it.
  */
-extern void glcd_pixel(unsigned char x, unsigned char y, unsigned char colour);
+void graphics_refresh(void);
+/**
+ * Limit drawing to a rectangle on the screen.  The new clip rectangle is
+ * combined with the current one, so it can never be larger than the area
+ * set by an earlier call.  Each call must be matched with a call to
+ * graphics_clip_pop().
+ *
+ * @param x1 		The x1 position, from 1 - SCREEN_WIDTH
+ * @param y1 		The y1 position, from 1 - SCREEN_HEIGHT
+ * @param x2 		The x2 position, from 1 - SCREEN_WIDTH
+ * @param y2 		The y2 position, from 1 - SCREEN_HEIGHT
+ * @return			0 if GRAPHICS_CLIP_DEPTH has been reached, 1 otherwise
+ */
+unsigned char graphics_clip_push(int x1, int y1, int x2, int y2);
+/**
+ * Restore the clip rectangle that was in use before the last call to
+ * graphics_clip_push().
+ */
+void graphics_clip_pop(void);
+/**
+ * Draw into another page-oriented buffer instead of the screen, for example
+ * a compositor layer.  Coordinates are then relative to the top left of the
+ * buffer, and the clip rectangle is reset to cover all of it.
+ *
+ * Only available with GRAPHICS_DIRECT_BUFFER.
+ *
+ * @param buffer	The buffer, ((height + 7) / 8) * width bytes.  Pass 0 to
+ *					draw on the screen again.
+ * @param width		Width of the buffer in pixels
+ * @param height	Height of the buffer in pixels
+ * @param x			Where the buffer is on screen, from 1 - SCREEN_WIDTH
+ * @param y			Where the buffer is on screen, from 1 - SCREEN_HEIGHT
+ */
+void graphics_set_target(unsigned char *buffer, unsigned char width, unsigned char height, unsigned char x, unsigned char y);
+/**
+ * Rotate everything that is drawn, for screens that are mounted sideways or
+ * upside down.  Coordinates are then in the rotated view, so with
+ * GRAPHICS_ROTATE_90 or GRAPHICS_ROTATE_270 the screen is SCREEN_HEIGHT
+ * pixels wide and SCREEN_WIDTH pixels high.  The clip rectangle is reset to
+ * cover all of the view.
+ *
+ * Text and bitmaps are turned 8x8 pixels at a time with a bit transpose, so
+ * they are still written to the buffer a byte at a time.  The rotation also
+ * applies to a buffer set with graphics_set_target().
+ *
+ * Only available with GRAPHICS_DIRECT_BUFFER, and only when drawing into
+ * a buffer.  For 180 degrees on the ST7565, glcd_flip_screen() costs nothing
+ * while drawing.
+ *
+ * @param rotation	GRAPHICS_ROTATE_0, GRAPHICS_ROTATE_90, GRAPHICS_ROTATE_180
+ *					or GRAPHICS_ROTATE_270
+ */
+void graphics_set_rotation(unsigned char rotation);
+
+/* Internal functions (do not call) */
+void _draw_columns(const unsigned char *data, unsigned char x, unsigned char y, unsigned char width, unsigned char height, unsigned char rop);
+void _draw_rle_columns(const unsigned char *data, unsigned char x, unsigned char y, unsigned char width, unsigned char height, unsigned char rop);
+void _draw_xbm_rows(const unsigned char *data, unsigned char x, unsigned char y, unsigned char width, unsigned char height, unsigned char rop);
+void _draw_block(unsigned char *block, unsigned char x, unsigned char y, unsigned char width, unsigned char height, unsigned char rop);
+void _transpose(unsigned char *block);
+unsigned char _reverse_bits(unsigned char b);
+void _draw_column(unsigned char x, unsigned char y, unsigned char data, unsigned char count, unsigned char rop);
+void _write_column(int x, int y, unsigned char data, unsigned char pixels, unsigned char rop);
+void _rotate_point(int *x, int *y);
+void _rotate_rectangle(int *x1, int *y1, int *x2, int *y2);
+void _draw_circle_columns(unsigned char centre_x, unsigned char centre_y, unsigned char offset, unsigned char height, unsigned char colour);
+void _draw_pixel(int x, int y, unsigned char colour);
+void _draw_clipped_pixel(int x, int y, unsigned char colour);
+unsigned char _clamp_radius(int *x1, int *y1, int *x2, int *y2, unsigned char radius);
+int _corner_width(unsigned char radius, unsigned char d, int w);
+int _edge_x(const point_t *a, const point_t *b, int y);
+unsigned char _circle_outside_clip(int centre_x, int centre_y, int radius);
+void _mark_dirty(int x1, int y1, int x2, int y2);
+unsigned short _next_char(const char **string);
+unsigned char _font_ascent(const font_t *font);
 
 #endif // _GRAPHICS_H_
 
@@ -1,10 +1,18 @@
 #include <htc.h>
+#include "graphics.h"
 #include "ks0108.h"
 
 // Globals for the current row and column address
 unsigned char glcd_row;
 unsigned char glcd_col;
 
+// The hooks used by the graphics library.  The screen is read back, so
+// there is no buffer.
+const glcd_driver_t ks0108_driver = {
+	128, 64, 0,
+	glcd_pixel, 0, glcd_vspan, glcd_blit, 0, 0
+};
+
 void _glcd_wait(void)
 {
 	// Set the data port to input mode
@@ -71,6 +79,54 @@ unsigned char _glcd_read(void) {
 	return data;
 }
 
+unsigned char _glcd_read_data(void)
+{
+	unsigned char data;
+	
+	// The first read after moving only fetches the data, the second
+	// returns it
+	_glcd_wait();
+	GLCD_DATA_TRIS = 0xff;
+	GLCD_RS = 1;
+	GLCD_RW = 1;
+	_glcd_read();
+	
+	_glcd_wait();
+	GLCD_DATA_TRIS = 0xff;
+	GLCD_RS = 1;
+	GLCD_RW = 1;
+	data = _glcd_read();
+	
+	GLCD_DATA_TRIS = 0x00;
+	return data;
+}
+
+void _glcd_update(unsigned char x, unsigned char page, unsigned char bits, unsigned char mask, unsigned char rop)
+{
+	unsigned char data = 0;
+	
+	glcd_goto(page * 8, x);
+	
+	// Bytes that are replaced completely do not need to be read.  Reading
+	// moves to the next column, so the position is set again.
+	if (rop != ROP_COPY || mask != 0xFF) {
+		data = _glcd_read_data();
+		_glcd_set_position();
+	}
+	
+	if (rop == ROP_OR) {
+		data |= bits;
+	} else if (rop == ROP_XOR) {
+		data ^= bits;
+	} else if (rop == ROP_AND_NOT) {
+		data &= ~bits;
+	} else {
+		data = (data & ~mask) | (bits & mask);
+	}
+	
+	glcd_write_data(data);
+}
+
 void _glcd_set_position()
 {
 	if (glcd_col > 63) {
@@ -147,7 +203,17 @@ void glcd_move_right(void) {
 void glcd_char(unsigned char character, unsigned char inverted) {
 	unsigned char i, d;
 	
-	// TODO: Handle CR and LF
+	// A carriage return goes back to the start of the line, a line feed
+	// also moves down to the next line
+	if (character == '\r' || character == '\n') {
+		if (character == '\n') {
+			glcd_row += 8;
+			glcd_row &= 0x3F;
+		}
+		glcd_col = 0;
+		_glcd_set_position();
+		return;
+	}
 	
 	for (i = 0; i < 7; i++) {
 		d = Font[character - 32][i];
@@ -181,6 +247,47 @@ void glcd_string(const char *string, unsigned char inverted)
 	}
 }
 
+void glcd_pixel(unsigned char x, unsigned char y, unsigned char colour)
+{
+	unsigned char bit;
+	
+	if (x < 1 || x > 128 || y < 1 || y > 64) return;
+	
+	bit = 1 << ((y - 1) % 8);
+	_glcd_update(x - 1, (y - 1) / 8, colour ? bit : 0, bit, ROP_COPY);
+}
+
+void glcd_vspan(unsigned char x, unsigned char y1, unsigned char y2, unsigned char colour)
+{
+	unsigned char page, mask;
+	
+	// Screen coordinates are 0-63, not 1-64
+	y1 -= 1;
+	y2 -= 1;
+	
+	for (page = y1 / 8; page <= y2 / 8; page++) {
+		mask = 0xFF;
+		if (page == y1 / 8) mask <<= y1 % 8;
+		if (page == y2 / 8) mask &= 0xFF >> (7 - y2 % 8);
+		
+		_glcd_update(x - 1, page, colour ? mask : 0, mask, ROP_COPY);
+	}
+}
+
+void glcd_blit(unsigned char x, unsigned char y, unsigned char data, unsigned char count, unsigned char rop)
+{
+	// The pixels straddle two pages unless y is on a page boundary
+	unsigned short pixels = ((1 << count) - 1) << ((y - 1) % 8);
+	unsigned short bits = ((unsigned short) data << ((y - 1) % 8)) & pixels;
+	unsigned char page = (y - 1) / 8;
+	
+	for (; pixels; pixels >>= 8, bits >>= 8, page++) {
+		if (pixels & 0xFF) {
+			_glcd_update(x - 1, page, bits, pixels, rop);
+		}
+	}
+}
+
 void glcd_init(void)
 {
 	GLCD_RW_TRIS = 0; 
@@ -9,6 +9,11 @@
  * A library for displaying text on a GLCD using the KS0108 graphics
  * controller.
  *
+ * The screen can also be drawn on with the graphics library, by passing
+ * ks0108_driver to graphics_set_driver().  Pixels are read back from the
+ * screen and changed a byte at a time, so no RAM buffer is needed.  This
+ * moves the text position used by glcd_char().
+ *
  * Original code by Pommie, tidied and published by David.
  * 
  * Example Usage:
@@ -67,6 +72,9 @@ extern void glcd_move_right(void);
  * Write a single character to the screen.  If desired, the text can be 
  * printed white-on-black, in inverted mode.
  *
+ * A carriage return ('\\r') moves back to the start of the line and a line
+ * feed ('\\n') moves to the start of the next line.
+ *
  * @param character	The character to write to the screen
  * @param inverted	True if text should be written white-on-black
  */
@@ -79,6 +87,35 @@ extern void glcd_char(unsigned char character, unsigned char inverted);
  * @param inverted	True if text should be written white-on-black
  */
 extern void glcd_string(const char* string, unsigned char inverted);
+/**
+ * Set a single pixel.  Used by the graphics library.
+ *
+ * @param x			The x position, from 1 - 128
+ * @param y			The y position, from 1 - 64
+ * @param colour	0 = OFF, any other value = ON
+ */
+extern void glcd_pixel(unsigned char x, unsigned char y, unsigned char colour);
+/**
+ * Set a column of pixels, only reading the top and bottom pages.  Used by
+ * the graphics library.
+ *
+ * @param x			The x position, from 1 - 128
+ * @param y1		The y1 position, from 1 - 64
+ * @param y2		The y2 position, from y1 - 64
+ * @param colour	0 = OFF, any other value = ON
+ */
+extern void glcd_vspan(unsigned char x, unsigned char y1, unsigned char y2, unsigned char colour);
+/**
+ * Draw up to 8 pixels down a column, combined with the screen using a raster
+ * operation.  Used by the graphics library for text and bitmaps.
+ *
+ * @param x			The x position, from 1 - 128
+ * @param y			The y position of bit 0 of data, from 1 - 64
+ * @param data		The pixels, bit 0 at the top
+ * @param count		The number of pixels, from 1 - 8
+ * @param rop		ROP_COPY, ROP_OR, ROP_XOR or ROP_AND_NOT
+ */
+extern void glcd_blit(unsigned char x, unsigned char y, unsigned char data, unsigned char count, unsigned char rop);
 /**
  * Initialise the screen and move to the top left.  Call this first
  * before sending any other commands, or after a power/reset event.
@@ -97,9 +134,14 @@ extern void glcd_command(unsigned char cmd);
  */
 extern void glcd_write_data(unsigned char data);
 
+/** The driver for the graphics library, see graphics_set_driver(). */
+extern const glcd_driver_t ks0108_driver;
+
 /* Internal functions (do not call) */
 void _glcd_wait(void);
 unsigned char _glcd_read(void);
+unsigned char _glcd_read_data(void);
+void _glcd_update(unsigned char x, unsigned char page, unsigned char bits, unsigned char mask, unsigned char rop);
 void _glcd_set_position(void);
 
 #define GLCD_DISPLAY_ON 0x3f
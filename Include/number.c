@@ -0,0 +1,139 @@
+#include "graphics.h"
+#include "number.h"
+#include "main.h"
+
+bounding_box_t number_init(number_t *number, char *text, unsigned char x, unsigned char y, unsigned char width,
+						   unsigned char decimals, unsigned char align, const font_t *font, unsigned char spacing) {
+	bounding_box_t ret;
+	unsigned char widest;
+	unsigned char i;
+	char c;
+
+	// Leave room for a minus sign, a zero and the point
+	if (width > NUMBER_MAX_WIDTH) width = NUMBER_MAX_WIDTH;
+	if (decimals > NUMBER_MAX_WIDTH - 3) decimals = NUMBER_MAX_WIDTH - 3;
+
+	number->font = font;
+	number->text = text;
+	number->x = x;
+	number->y = y;
+	number->width = width;
+	number->decimals = decimals;
+	number->align = align;
+
+	// Every cell is as wide as the widest digit or the minus sign
+	widest = _number_glyph_width('-', font);
+	for (c = '0'; c <= '9'; c++) {
+		i = _number_glyph_width(c, font);
+		if (i > widest) widest = i;
+	}
+	number->pitch = widest + spacing;
+	number->point = _number_glyph_width('.', font) + spacing;
+
+	// Nothing has been drawn, so every cell will differ from the first value
+	for (i = 0; i < width; i++) {
+		text[i] = 0;
+	}
+
+	ret.x1 = x;
+	ret.y1 = y;
+	ret.x2 = x + width * number->pitch - spacing - 1;
+	if (decimals) ret.x2 -= number->pitch - number->point;
+	ret.y2 = y + font->height - 1;
+
+	return ret;
+}
+
+void number_set(number_t *number, long value) {
+	char text[NUMBER_MAX_WIDTH];
+	unsigned long magnitude;
+	unsigned char length = 0;
+	unsigned char digits = 0;
+	unsigned char i;
+
+	magnitude = value < 0 ? 0UL - (unsigned long) value : (unsigned long) value;
+
+	// Digits are produced from the right, at least one before the point
+	do {
+		if (digits == number->decimals && digits) {
+			text[NUMBER_MAX_WIDTH - 1 - length++] = '.';
+		}
+		text[NUMBER_MAX_WIDTH - 1 - length++] = '0' + magnitude % 10;
+		magnitude /= 10;
+		digits++;
+	} while (magnitude || digits <= number->decimals);
+
+	if (value < 0) {
+		text[NUMBER_MAX_WIDTH - 1 - length++] = '-';
+	}
+
+	if (length > number->width) {
+		// Too big, but the point stays in place so the field does not move
+		for (i = 0; i < number->width; i++) {
+			text[i] = '-';
+		}
+		if (number->decimals && number->decimals < number->width) {
+			text[number->width - 1 - number->decimals] = '.';
+		}
+	} else if (number->align == TEXT_ALIGN_RIGHT) {
+		for (i = 0; i < number->width; i++) {
+			text[i] = i < number->width - length ? ' ' : text[NUMBER_MAX_WIDTH - number->width + i];
+		}
+	} else {
+		for (i = 0; i < number->width; i++) {
+			text[i] = i < length ? text[NUMBER_MAX_WIDTH - length + i] : ' ';
+		}
+	}
+
+	_number_draw(number, text, 0);
+}
+
+void number_redraw(number_t *number) {
+	_number_draw(number, number->text, 1);
+}
+
+// Width of a character, or 0 if it is not in the font
+unsigned char _number_glyph_width(char c, const font_t *font) {
+	unsigned char index = font_glyph(font, (unsigned char) c);
+
+	if (index == FONT_NO_GLYPH) return 0;
+	return font->widths[index];
+}
+
+// Draw the cells that differ from those on the screen.  A cell also has to
+// be drawn if it has moved because the decimal point before it has moved,
+// which happens when the field is aligned to the left.
+void _number_draw(number_t *number, const char *text, unsigned char force) {
+	unsigned char old_x = number->x;
+	unsigned char new_x = number->x;
+	unsigned char y2 = number->y + number->font->height - 1;
+	unsigned char cell, glyph, left;
+	unsigned char i;
+	char old;
+
+	for (i = 0; i < number->width; i++) {
+		old = number->text[i];
+		cell = text[i] == '.' ? number->point : number->pitch;
+
+		if (force || old != text[i] || old_x != new_x) {
+			// Centre the glyph in the cell and clear either side of it
+			glyph = _number_glyph_width(text[i], number->font);
+			left = text[i] == '.' ? 0 : (cell - glyph) / 2;
+
+			if (left) {
+				draw_filled_rectangle(new_x, number->y, new_x + left - 1, y2, 0);
+			}
+			if (glyph) {
+				draw_char(text[i], new_x + left, number->y, number->font);
+			}
+			if (left + glyph < cell) {
+				draw_filled_rectangle(new_x + left + glyph, number->y, new_x + cell - 1, y2, 0);
+			}
+
+			number->text[i] = text[i];
+		}
+
+		old_x += old == '.' ? number->point : number->pitch;
+		new_x += cell;
+	}
+}
@@ -0,0 +1,106 @@
+/**
+ * @file   number.h
+ * @date   October, 2026
+ * @brief  Header for numeric fields that only redraw the digits that change.
+ * @details
+ *
+ * A number field shows an integer or a fixed-point value at a fixed place on the
+ * screen, for example a temperature or a voltage that is updated many times a second.
+ * Values are converted without printf, which is large on a PIC.
+ *
+ * The field is a row of character cells.  Every digit and the minus sign gets a cell as
+ * wide as the widest digit in the font, so proportional fonts still line up, while the
+ * decimal point only takes its own width.  The field remembers the character in each
+ * cell and only cells that change are drawn, so going from 20.47 to 20.48 only draws
+ * one digit and only sends those columns to the screen.
+ *
+ * Values are aligned to the left or right of the field and the rest of the field is
+ * blank.  A value that does not fit is shown as a row of minus signs.
+ *
+ * The caller supplies width bytes of RAM to hold the characters being shown.
+ *
+ * Example usage:
+ * @code
+ *    char text[6];
+ *    number_t volts;
+ *
+ *    // Up to "-99.99", in millivolts shown as volts to 2 decimal places
+ *    number_init(&volts, text, 10, 20, 6, 2, TEXT_ALIGN_RIGHT, &Tahoma10, 1);
+ *
+ *    for (;;) {
+ *        number_set(&volts, read_millivolts() / 10);
+ *        glcd_refresh();
+ *    }
+ * @endcode
+ */
+#ifndef _NUMBER_H_
+#define _NUMBER_H_
+
+/** The most characters in a field, enough for any long with a minus sign and
+    a decimal point */
+#define NUMBER_MAX_WIDTH	12
+
+/**
+ * A numeric field.  Use number_init() to set this up.
+ */
+typedef struct {
+	/** The font used for the digits */
+	const font_t *font;
+	/** The character shown in each cell, width bytes */
+	char *text;
+	/** Left edge of the field, from 1 - SCREEN_WIDTH */
+	unsigned char x;
+	/** Top edge of the field, from 1 - SCREEN_HEIGHT */
+	unsigned char y;
+	/** The number of characters, including any minus sign and decimal point */
+	unsigned char width;
+	/** The number of digits after the decimal point, 0 for integers */
+	unsigned char decimals;
+	/** TEXT_ALIGN_LEFT or TEXT_ALIGN_RIGHT */
+	unsigned char align;
+	/** Width of each cell in pixels, including the gap after it */
+	unsigned char pitch;
+	/** Width of the decimal point in pixels, including the gap after it */
+	unsigned char point;
+} number_t;
+
+/**
+ * Set up a numeric field.  Nothing is drawn until number_set() is called.
+ *
+ * @param number	The field to set up
+ * @param text		width bytes of RAM for the characters shown
+ * @param x			The x position, from 1 - SCREEN_WIDTH
+ * @param y			The y position, from 1 - SCREEN_HEIGHT
+ * @param width		The number of characters, including any minus sign and
+ *					decimal point, up to NUMBER_MAX_WIDTH
+ * @param decimals	The number of digits after the decimal point, 0 for integers
+ * @param align		TEXT_ALIGN_LEFT or TEXT_ALIGN_RIGHT
+ * @param font		The font used for the digits
+ * @param spacing	The gap in pixels between characters
+ * @return			The area covered by the field
+ */
+bounding_box_t number_init(number_t *number, char *text, unsigned char x, unsigned char y, unsigned char width,
+						   unsigned char decimals, unsigned char align, const font_t *font, unsigned char spacing);
+/**
+ * Show a new value, drawing only the cells that have changed.
+ *
+ * Fixed-point values are scaled by 10 to the power of decimals, so with 2
+ * decimals a value of 2048 is shown as "20.48" and 5 as "0.05".
+ *
+ * @param number	The field
+ * @param value		The value to show
+ */
+void number_set(number_t *number, long value);
+/**
+ * Draw every cell of the field again, for example after the screen has been
+ * cleared.
+ *
+ * @param number	The field
+ */
+void number_redraw(number_t *number);
+
+/* Internal functions (do not call) */
+unsigned char _number_glyph_width(char c, const font_t *font);
+void _number_draw(number_t *number, const char *text, unsigned char force);
+
+#endif // _NUMBER_H_
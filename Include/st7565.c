@@ -1,15 +1,39 @@
 #include <htc.h>
 #include "st7565-config.h"
+#include "graphics.h"
 #include "st7565.h"
 #include "delay.h"
 
+#ifdef ST7565_COMPOSITOR
+#include "compositor.h"
+#endif
+
 /** Global buffer to hold the current screen contents. */
 // This has to be kept here because the width & height are set in
 // st7565-config.h
 unsigned char glcd_buffer[SCREEN_WIDTH * SCREEN_HEIGHT / 8];
 
+/** Whether the screen is the "normal" way up, see glcd_flip_screen(). */
+unsigned char glcd_flipped = 0;
+
 #ifdef ST7565_DIRTY_PAGES
-unsigned char glcd_dirty_pages;
+/** The first and last changed column (0 based) of each page.  A page is
+    unchanged when the first column is after the last. */
+unsigned char glcd_dirty_x1[SCREEN_HEIGHT / 8];
+unsigned char glcd_dirty_x2[SCREEN_HEIGHT / 8];
+#endif
+
+/** The hooks used by the graphics library, see graphics_set_driver(). */
+const glcd_driver_t st7565_driver = {
+    SCREEN_WIDTH, SCREEN_HEIGHT, glcd_buffer,
+    glcd_pixel, glcd_hspan, glcd_vspan, glcd_blit, glcd_mark_dirty, glcd_refresh
+};
+
+#ifdef ST7565_SHADOW_BUFFER
+/** A copy of what has actually been sent to the screen. */
+unsigned char glcd_shadow[SCREEN_WIDTH * SCREEN_HEIGHT / 8];
+/** Whether the screen is known to match glcd_shadow. */
+unsigned char glcd_shadow_valid = 0;
 #endif
 
 void glcd_pixel(unsigned char x, unsigned char y, unsigned char colour) {
@@ -23,8 +47,9 @@ void glcd_pixel(unsigned char x, unsigned char y, unsigned char colour) {
     unsigned short array_pos = x + ((y / 8) * 128);
 
 #ifdef ST7565_DIRTY_PAGES
-#warning ** ST7565_DIRTY_PAGES enabled, only changed pages will be written to the GLCD **
-    glcd_dirty_pages |= 1 << (array_pos / 128);
+    // Widen the changed column range of this page
+    if (x < glcd_dirty_x1[y / 8]) glcd_dirty_x1[y / 8] = x;
+    if (x > glcd_dirty_x2[y / 8]) glcd_dirty_x2[y / 8] = x;
 #endif
 
     if (colour) {
@@ -34,11 +59,104 @@ void glcd_pixel(unsigned char x, unsigned char y, unsigned char colour) {
     }
 }
 
+void glcd_hspan(unsigned char x1, unsigned char x2, unsigned char y, unsigned char colour) {
+    unsigned char *p = &glcd_buffer[((y - 1) / 8) * SCREEN_WIDTH + x1 - 1];
+    unsigned char bit = 1 << ((y - 1) % 8);
+
+    glcd_mark_dirty(x1, y, x2, y);
+
+    for (; x1 <= x2; x1++) {
+        if (colour) {
+            *p++ |= bit;
+        } else {
+            *p++ &= ~bit;
+        }
+    }
+}
+
+void glcd_vspan(unsigned char x, unsigned char y1, unsigned char y2, unsigned char colour) {
+    unsigned char mask;
+
+    glcd_mark_dirty(x, y1, x, y2);
+
+    // Real screen coordinates are 0-63, not 1-64.
+    y1 -= 1;
+    y2 -= 1;
+
+    // One write for each page, masked at the top and bottom
+    for (unsigned char page = y1 / 8; page <= y2 / 8; page++) {
+        mask = 0xFF;
+        if (page == y1 / 8) mask <<= y1 % 8;
+        if (page == y2 / 8) mask &= 0xFF >> (7 - y2 % 8);
+
+        if (colour) {
+            glcd_buffer[page * SCREEN_WIDTH + x - 1] |= mask;
+        } else {
+            glcd_buffer[page * SCREEN_WIDTH + x - 1] &= ~mask;
+        }
+    }
+}
+
+void glcd_blit(unsigned char x, unsigned char y, unsigned char data, unsigned char count, unsigned char rop) {
+    unsigned char *p = &glcd_buffer[((y - 1) / 8) * SCREEN_WIDTH + x - 1];
+
+    // The pixels straddle two pages unless y is on a page boundary
+    unsigned short pixels = ((1 << count) - 1) << ((y - 1) % 8);
+    unsigned short bits = ((unsigned short) data << ((y - 1) % 8)) & pixels;
+
+    glcd_mark_dirty(x, y, x, y + count - 1);
+
+    for (; pixels; pixels >>= 8, bits >>= 8, p += SCREEN_WIDTH) {
+        if (rop == ROP_OR) {
+            *p |= bits;
+        } else if (rop == ROP_XOR) {
+            *p ^= bits;
+        } else if (rop == ROP_AND_NOT) {
+            *p &= ~bits;
+        } else {
+            *p = (*p & ~pixels) | bits;
+        }
+    }
+}
+
+void glcd_mark_dirty(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2) {
+#ifdef ST7565_DIRTY_PAGES
+    if (x2 > SCREEN_WIDTH) x2 = SCREEN_WIDTH;
+    if (y2 > SCREEN_HEIGHT) y2 = SCREEN_HEIGHT;
+    if (x1 < 1 || x1 > x2 || y1 < 1 || y1 > y2) return;
+
+    // Real screen coordinates are 0-127, not 1-128.
+    x1 -= 1;
+    x2 -= 1;
+
+    // Widen the changed column range of every page from y1 to y2
+    for (y1 = (y1 - 1) / 8; y1 <= (y2 - 1) / 8; y1++) {
+        if (x1 < glcd_dirty_x1[y1]) glcd_dirty_x1[y1] = x1;
+        if (x2 > glcd_dirty_x2[y1]) glcd_dirty_x2[y1] = x2;
+    }
+#endif
+}
+
 void glcd_blank() {
     // Reset the internal buffer
-    for (int n = 1; n <= (SCREEN_WIDTH * SCREEN_HEIGHT / 8) - 1; n++) {
+    for (int n = 0; n < (SCREEN_WIDTH * SCREEN_HEIGHT / 8); n++) {
         glcd_buffer[n] = 0;
+#ifdef ST7565_SHADOW_BUFFER
+        glcd_shadow[n] = 0;
+#endif
+    }
+
+#ifdef ST7565_SHADOW_BUFFER
+    glcd_shadow_valid = 1;
+#endif
+
+#ifdef ST7565_DIRTY_PAGES
+    // The buffer and the screen now match
+    for (int y = 0; y < SCREEN_HEIGHT / 8; y++) {
+        glcd_dirty_x1[y] = 0xFF;
+        glcd_dirty_x2[y] = 0;
     }
+#endif
 
     // Clear the actual screen
     for (int y = 0; y < 8; y++) {
@@ -57,42 +175,112 @@ void glcd_blank() {
 }
 
 void glcd_refresh() {
+    unsigned char *data;
+    unsigned char x1 = 0;
+    unsigned char x2 = SCREEN_WIDTH - 1;
+
     for (int y = 0; y < 8; y++) {
 
 #ifdef ST7565_DIRTY_PAGES
-        // Only copy this page if it is marked as "dirty"
-        if (!(glcd_dirty_pages & (1 << y))) continue;
+        // Only copy the columns of this page that are marked as "dirty"
+        x1 = glcd_dirty_x1[y];
+        x2 = glcd_dirty_x2[y];
+        if (x1 > x2) continue;
+
+        // This page is now up to date
+        glcd_dirty_x1[y] = 0xFF;
+        glcd_dirty_x2[y] = 0;
+#endif
+
+#ifdef ST7565_COMPOSITOR
+        // Combine any layers above the buffer
+        data = compositor_page(y, x1, x2);
+#else
+        data = &glcd_buffer[y * SCREEN_WIDTH];
+#endif
+
+#ifdef ST7565_SHADOW_BUFFER
+        if (glcd_shadow_valid) {
+            _glcd_refresh_changed(y, x1, x2, data);
+            continue;
+        }
 #endif
 
         glcd_command(GLCD_CMD_SET_PAGE | y);
+        glcd_set_column(x1);
 
-        // Reset column to the left side.  The internal memory of the
-        // screen is 132*64, we need to account for this if the display
-        // is flipped.
-        //
-        // Some screens seem to map the internal memory to the screen
-        // pixels differently, the ST7565_REVERSE define allows this to
-        // be controlled if necessary.
-#ifdef ST7565_REVERSE
-        if (!glcd_flipped) {
-#else
-        if (glcd_flipped) {
+        for (int x = x1; x <= x2; x++) {
+#ifdef ST7565_SHADOW_BUFFER
+            glcd_shadow[y * SCREEN_WIDTH + x] = data[x];
 #endif
-            glcd_command(GLCD_CMD_COLUMN_LOWER | 4);
-        } else {
-            glcd_command(GLCD_CMD_COLUMN_LOWER);
+            glcd_data(data[x]);
         }
-        glcd_command(GLCD_CMD_COLUMN_UPPER);
+    }
+
+#ifdef ST7565_SHADOW_BUFFER
+    glcd_shadow_valid = 1;
+#endif
+}
 
-        for (int x = 0; x < 128; x++) {
-            glcd_data(glcd_buffer[y * 128 + x]);
+#ifdef ST7565_SHADOW_BUFFER
+void _glcd_refresh_changed(unsigned char page, unsigned char x1, unsigned char x2, unsigned char *buffer) {
+    unsigned char *shadow = &glcd_shadow[page * SCREEN_WIDTH];
+    unsigned char page_set = 0;
+    unsigned char end, gap, n;
+
+    while (x1 <= x2) {
+        // Skip columns that already match the screen
+        if (buffer[x1] == shadow[x1]) {
+            x1++;
+            continue;
+        }
+
+        // Find the end of this run of changed columns.  Setting the column
+        // address costs two command bytes, so gaps of up to two unchanged
+        // columns cost no more to send than to skip.  Looking ends at the
+        // third unchanged column in a row.
+        end = x1;
+        gap = 0;
+        for (n = x1 + 1; n <= x2 && gap <= 2; n++) {
+            if (buffer[n] != shadow[n]) {
+                end = n;
+                gap = 0;
+            } else {
+                gap++;
+            }
+        }
+
+        if (!page_set) {
+            glcd_command(GLCD_CMD_SET_PAGE | page);
+            page_set = 1;
+        }
+        glcd_set_column(x1);
+
+        for (; x1 <= end; x1++) {
+            shadow[x1] = buffer[x1];
+            glcd_data(buffer[x1]);
         }
     }
+}
+#endif
 
-#ifdef ST7565_DIRTY_PAGES
-    // All pages have now been updated, reset the indicator.
-    glcd_dirty_pages = 0;
+void glcd_set_column(unsigned char x) {
+    // The internal memory of the screen is 132*64, we need to account
+    // for this if the display is flipped.
+    //
+    // Some screens seem to map the internal memory to the screen
+    // pixels differently, the ST7565_REVERSE define allows this to
+    // be controlled if necessary.
+#ifdef ST7565_REVERSE
+    if (!glcd_flipped) {
+#else
+    if (glcd_flipped) {
 #endif
+        x += 4;
+    }
+
+    glcd_command(GLCD_CMD_COLUMN_LOWER | (x & 0x0F));
+    glcd_command(GLCD_CMD_COLUMN_UPPER | (x >> 4));
 }
 
 void glcd_init() {
@@ -149,6 +337,12 @@ void glcd_init() {
 
     // Unselect the chip
     GLCD_CS1 = 1;
+
+    // The screen memory is unknown, so the whole buffer must be sent
+    glcd_mark_dirty(1, 1, SCREEN_WIDTH, SCREEN_HEIGHT);
+#ifdef ST7565_SHADOW_BUFFER
+    glcd_shadow_valid = 0;
+#endif
 }
 
 void glcd_data(unsigned char data) {
@@ -216,6 +410,12 @@ void glcd_flip_screen(unsigned char flip) {
         glcd_command(GLCD_CMD_VERTICAL_NORMAL);
         glcd_flipped = 1;
     }
+
+    // The columns have moved, so the whole buffer must be sent again
+    glcd_mark_dirty(1, 1, SCREEN_WIDTH, SCREEN_HEIGHT);
+#ifdef ST7565_SHADOW_BUFFER
+    glcd_shadow_valid = 0;
+#endif
 }
 
 void glcd_inverse_screen(unsigned char inverse) {
@@ -226,6 +426,10 @@ void glcd_inverse_screen(unsigned char inverse) {
     }
 }
 
+void glcd_scroll(unsigned char line) {
+    glcd_command(GLCD_CMD_DISPLAY_START | (line % SCREEN_HEIGHT));
+}
+
 void glcd_test_card() {
     unsigned char p = 0xF0;
 
@@ -239,6 +443,7 @@ void glcd_test_card() {
         }
     }
 
+    glcd_mark_dirty(1, 1, SCREEN_WIDTH, SCREEN_HEIGHT);
     glcd_refresh();
 }
 
@@ -21,6 +21,10 @@
  * need an array to hold the current data.  For a 128*64 screen, this will require
  * 1KiB of RAM.  We need to know what data is currently on the screen so that we can overlay
  * new pixels onto it, so must keep a copy in local memory.
+ *
+ * Optionally a second 1KiB copy of what has actually been sent to the screen can be kept,
+ * see ST7565_SHADOW_BUFFER.  Redrawing a value that has not changed then costs no SPI
+ * traffic at all.
  * 
  * SPI timings have been checked using the MPLAB Simulator, with Vcc of 3.3v it is impossible 
  * to violate the datasheet guidelines even up to 64Mhz.
@@ -34,6 +38,9 @@
  *    // Initialise the screen, turning it on
  *    glcd_init();
  *
+ *    // Draw on this screen with the graphics library
+ *    graphics_set_driver(&st7565_driver);
+ *
  *    // Clear the screen's internal memory 
  *    glcd_blank();
  *
@@ -140,13 +147,27 @@ void glcd_command(char);
 /** 
  * Send a data byte to the screen. 
  */
-void glcd_data(char);
+void glcd_data(unsigned char);
 /**
  * Update the screen with the contents of the RAM buffer.
+ *
+ * With ST7565_DIRTY_PAGES defined only the changed columns of each page are
+ * sent, as one run starting from the first changed column.  With
+ * ST7565_SHADOW_BUFFER defined those columns are also compared against what
+ * was last sent, and only the bytes that differ are sent.  With
+ * ST7565_COMPOSITOR defined the layers of the compositor library are
+ * combined with the buffer as each page is sent.
  */
 void glcd_refresh();
 /**
- * Clear the screen, without affecting the buffer in RAM.
+ * Set the column address for the next data byte, allowing for the 4 unused
+ * columns of the screen's memory when it is flipped.
+ *
+ * @param x 		The column, from 0 - (SCREEN_WIDTH - 1)
+ */
+void glcd_set_column(unsigned char x);
+/**
+ * Clear the screen and the buffer in RAM.
  * 
  * Useful at startup as the memory inside the screen may
  * contain "random" data.
@@ -160,6 +181,49 @@ void glcd_blank();
  * @param colour 	0 = OFF, any other value = ON
  */
 void glcd_pixel(unsigned char x, unsigned char y, unsigned char colour);
+/**
+ * Set a row of pixels.  Used by the graphics library when
+ * GRAPHICS_DIRECT_BUFFER is not defined.
+ *
+ * @param x1 		The x1 position, from 1 - SCREEN_WIDTH
+ * @param x2 		The x2 position, from x1 - SCREEN_WIDTH
+ * @param y 		The y position, from 1 - SCREEN_HEIGHT
+ * @param colour 	0 = OFF, any other value = ON
+ */
+void glcd_hspan(unsigned char x1, unsigned char x2, unsigned char y, unsigned char colour);
+/**
+ * Set a column of pixels, with one write for each page.  Used by the
+ * graphics library when GRAPHICS_DIRECT_BUFFER is not defined.
+ *
+ * @param x 		The x position, from 1 - SCREEN_WIDTH
+ * @param y1 		The y1 position, from 1 - SCREEN_HEIGHT
+ * @param y2 		The y2 position, from y1 - SCREEN_HEIGHT
+ * @param colour 	0 = OFF, any other value = ON
+ */
+void glcd_vspan(unsigned char x, unsigned char y1, unsigned char y2, unsigned char colour);
+/**
+ * Draw up to 8 pixels down a column, combined with the buffer using a
+ * raster operation.  Used by the graphics library for text and bitmaps when
+ * GRAPHICS_DIRECT_BUFFER is not defined.
+ *
+ * @param x 		The x position, from 1 - SCREEN_WIDTH
+ * @param y 		The y position of bit 0 of data, from 1 - SCREEN_HEIGHT
+ * @param data		The pixels, bit 0 at the top
+ * @param count		The number of pixels, from 1 - 8
+ * @param rop		ROP_COPY, ROP_OR, ROP_XOR or ROP_AND_NOT
+ */
+void glcd_blit(unsigned char x, unsigned char y, unsigned char data, unsigned char count, unsigned char rop);
+/**
+ * Mark an area of the screen as changed, after writing to glcd_buffer
+ * directly.  Used by the graphics library.  The next glcd_refresh() will
+ * send these columns of every page the area touches.
+ *
+ * @param x1 		The x1 position, from 1 - SCREEN_WIDTH
+ * @param y1 		The y1 position, from 1 - SCREEN_HEIGHT
+ * @param x2 		The x2 position, from 1 - SCREEN_WIDTH
+ * @param y2 		The y2 position, from 1 - SCREEN_HEIGHT
+ */
+void glcd_mark_dirty(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2);
 /** 
  * Flip the screen in the alternate direction vertically.
  *
@@ -174,6 +238,17 @@ void glcd_flip_screen(unsigned char flip);
  * is capable of reversing pixels with a single command.
  */
 void glcd_inverse_screen(unsigned char inverse);
+/**
+ * Scroll the screen vertically, without changing its memory or the buffer.
+ *
+ * The screen shows its memory starting from this line, wrapping around from
+ * the bottom back to the top.  Each line scrolls the picture up by one pixel.
+ * The buffer is not moved, so row y of the buffer is still drawn at y and
+ * glcd_refresh() sends exactly the same data.  Used by the chart library.
+ *
+ * @param line		The line of memory shown at the top, from 0 - (SCREEN_HEIGHT - 1)
+ */
+void glcd_scroll(unsigned char line);
 /** 
  * Fill the local RAM buffer with a test pattern and send it to the screen.
  *
@@ -193,7 +268,13 @@ void glcd_test_card();
  */
 void glcd_contrast(char resistor_ratio, char contrast);
 
+/** The driver for the graphics library, see graphics_set_driver(). */
+extern const glcd_driver_t st7565_driver;
+
+/* Internal functions (do not call) */
+void _glcd_refresh_changed(unsigned char page, unsigned char x1, unsigned char x2, unsigned char *buffer);
+
 /** Global variable that tracks whether the screen is the "normal" way up. */
-unsigned char glcd_flipped = 0;
+extern unsigned char glcd_flipped;
 
 #endif // _ST7565_H_
@@ -0,0 +1,279 @@
+#include "graphics.h"
+#include "number.h"
+#include "gauge.h"
+#include "widget.h"
+#include "main.h"
+
+void widget_panel_init(panel_t *panel, bounding_box_t box, unsigned char border) {
+	_widget_init(&panel->widget, box, WIDGET_PANEL);
+	panel->children = 0;
+	panel->border = border;
+}
+
+void widget_add(panel_t *panel, widget_t *widget) {
+	widget_t **last = &panel->children;
+
+	while (*last) {
+		last = &(*last)->next;
+	}
+
+	*last = widget;
+	widget->parent = &panel->widget;
+	widget->next = 0;
+}
+
+void widget_label_init(label_t *label, bounding_box_t box, const char *text, unsigned char align, const font_t *font) {
+	_widget_init(&label->widget, box, WIDGET_LABEL);
+	label->text = text;
+	label->font = font;
+	label->align = align;
+}
+
+void widget_label_set(label_t *label, const char *text) {
+	// The text may have been changed in place, so it is always drawn
+	label->text = text;
+	label->widget.flags |= WIDGET_INVALID;
+}
+
+void widget_value_init(value_t *value, char *text, unsigned char x, unsigned char y, unsigned char width,
+					   unsigned char decimals, unsigned char align, const font_t *font, unsigned char spacing) {
+	bounding_box_t box = number_init(&value->number, text, x, y, width, decimals, align, font, spacing);
+
+	_widget_init(&value->widget, box, WIDGET_VALUE);
+	value->value = 0;
+}
+
+void widget_value_set(value_t *value, long number) {
+	if (number == value->value) return;
+
+	value->value = number;
+	value->widget.flags |= WIDGET_CHANGED;
+}
+
+void widget_bar_init(bar_t *bar, bounding_box_t box, unsigned int max) {
+	_widget_init(&bar->widget, box, WIDGET_BAR);
+	gauge_init(&bar->gauge, box.x1 + 1, box.y1 + 1, box.x2 - box.x1 - 1, box.y2 - box.y1 - 1, GAUGE_RIGHT, max);
+	bar->value = 0;
+}
+
+void widget_bar_set(bar_t *bar, unsigned int value) {
+	if (value > bar->gauge.max) value = bar->gauge.max;
+	if (value == bar->value) return;
+
+	bar->value = value;
+	bar->widget.flags |= WIDGET_CHANGED;
+}
+
+void widget_icon_init(icon_t *icon, unsigned char x, unsigned char y, const bitmap_t *bitmap) {
+	bounding_box_t box;
+
+	box.x1 = x;
+	box.y1 = y;
+	box.x2 = x + bitmap->width - 1;
+	box.y2 = y + bitmap->height - 1;
+
+	_widget_init(&icon->widget, box, WIDGET_ICON);
+	icon->bitmap = bitmap;
+}
+
+void widget_icon_set(icon_t *icon, const bitmap_t *bitmap) {
+	if (bitmap == icon->bitmap) return;
+
+	icon->bitmap = bitmap;
+	icon->widget.flags |= WIDGET_INVALID;
+}
+
+void widget_list_init(list_t *list, bounding_box_t box, const char * const *items, unsigned char count, const font_t *font) {
+	_widget_init(&list->widget, box, WIDGET_LIST);
+	list->items = items;
+	list->font = font;
+	list->count = count;
+	list->selected = 0;
+	list->top = 0;
+	list->drawn = 0;
+}
+
+void widget_list_select(list_t *list, unsigned char index) {
+	unsigned char rows = _widget_list_rows(list);
+
+	if (index >= list->count) index = list->count - 1;
+	if (index == list->selected) return;
+
+	list->selected = index;
+
+	// Scrolling moves every row, otherwise only two rows change
+	if (index < list->top) {
+		list->top = index;
+		list->widget.flags |= WIDGET_INVALID;
+	} else if (rows && index >= list->top + rows) {
+		list->top = index - rows + 1;
+		list->widget.flags |= WIDGET_INVALID;
+	} else {
+		list->widget.flags |= WIDGET_CHANGED;
+	}
+}
+
+void widget_invalidate(widget_t *widget) {
+	widget->flags |= WIDGET_INVALID;
+}
+
+void widget_show(widget_t *widget, unsigned char visible) {
+	if (!(widget->flags & WIDGET_HIDDEN) == !!visible) return;
+
+	if (visible) {
+		widget->flags &= ~WIDGET_HIDDEN;
+	} else {
+		widget->flags |= WIDGET_HIDDEN;
+	}
+	widget->flags |= WIDGET_INVALID;
+}
+
+unsigned char widget_frame(panel_t *root) {
+	widget_t *widget = &root->widget;
+	widget_t *child;
+	unsigned char drawn = 0;
+
+	while (widget) {
+		if (widget->flags & (WIDGET_INVALID | WIDGET_CHANGED)) {
+			// A panel is cleared when it is drawn, so everything in it has
+			// to be drawn again
+			if (widget->type == WIDGET_PANEL && (widget->flags & WIDGET_INVALID)) {
+				for (child = ((panel_t *) widget)->children; child; child = child->next) {
+					child->flags |= WIDGET_INVALID;
+				}
+			}
+
+			_widget_draw(widget);
+			widget->flags &= ~(WIDGET_INVALID | WIDGET_CHANGED);
+			drawn++;
+		}
+
+		// Walk the tree without recursion, which would soon use up the stack
+		// of a PIC.  Go into panels that are shown, otherwise move on to the
+		// next widget, climbing out of any panels that are finished.
+		if (widget->type == WIDGET_PANEL && !(widget->flags & WIDGET_HIDDEN) && ((panel_t *) widget)->children) {
+			widget = ((panel_t *) widget)->children;
+			continue;
+		}
+		while (widget != &root->widget && !widget->next) {
+			widget = widget->parent;
+		}
+		widget = widget == &root->widget ? 0 : widget->next;
+	}
+
+	// Only the columns drawn above are sent
+	if (drawn) graphics_refresh();
+
+	return drawn;
+}
+
+void _widget_init(widget_t *widget, bounding_box_t box, unsigned char type) {
+	widget->box = box;
+	widget->type = type;
+	widget->flags = WIDGET_INVALID;
+	widget->parent = 0;
+	widget->next = 0;
+}
+
+void _widget_draw(widget_t *widget) {
+	bounding_box_t *box = &widget->box;
+	value_t *value = (value_t *) widget;
+	bar_t *bar = (bar_t *) widget;
+	list_t *list = (list_t *) widget;
+	unsigned char clipped;
+	unsigned char i;
+
+	if (widget->flags & WIDGET_HIDDEN) {
+		if (widget->flags & WIDGET_INVALID) {
+			draw_filled_rectangle(box->x1, box->y1, box->x2, box->y2, 0);
+		}
+		return;
+	}
+
+	clipped = graphics_clip_push(box->x1, box->y1, box->x2, box->y2);
+
+	if (!(widget->flags & WIDGET_INVALID)) {
+		// Only part of the widget has changed
+		if (widget->type == WIDGET_VALUE) {
+			number_set(&value->number, value->value);
+		} else if (widget->type == WIDGET_BAR) {
+			gauge_set(&bar->gauge, bar->value);
+		} else if (widget->type == WIDGET_LIST) {
+			_widget_draw_list_row(list, list->drawn);
+			list->drawn = list->selected;
+			_widget_draw_list_row(list, list->selected);
+		}
+
+		if (clipped) graphics_clip_pop();
+		return;
+	}
+
+	draw_filled_rectangle(box->x1, box->y1, box->x2, box->y2, 0);
+
+	switch (widget->type) {
+		case WIDGET_PANEL:
+			if (((panel_t *) widget)->border) {
+				draw_rectangle(box->x1, box->y1, box->x2, box->y2, 1);
+			}
+			break;
+
+		case WIDGET_LABEL:
+			draw_text_box((char *) ((label_t *) widget)->text, *box, ((label_t *) widget)->align,
+						  ((label_t *) widget)->font, 1);
+			break;
+
+		case WIDGET_VALUE:
+			// The field is blank, so every cell differs from the value
+			for (i = 0; i < value->number.width; i++) {
+				value->number.text[i] = 0;
+			}
+			number_set(&value->number, value->value);
+			break;
+
+		case WIDGET_BAR:
+			// The inside is blank, so the gauge starts empty
+			draw_rectangle(box->x1, box->y1, box->x2, box->y2, 1);
+			bar->gauge.length = 0;
+			gauge_set(&bar->gauge, bar->value);
+			break;
+
+		case WIDGET_ICON:
+			if (((icon_t *) widget)->bitmap) {
+				draw_bitmap(((icon_t *) widget)->bitmap, box->x1, box->y1, ROP_COPY);
+			}
+			break;
+
+		case WIDGET_LIST:
+			list->drawn = list->selected;
+			for (i = list->top; i < list->count && i - list->top < _widget_list_rows(list); i++) {
+				_widget_draw_list_row(list, i);
+			}
+			break;
+	}
+
+	// Only undo our own clip rectangle, never the caller's
+	if (clipped) graphics_clip_pop();
+}
+
+// Draw one item of a list, if it is in view, with a rectangle around it if
+// it is selected
+void _widget_draw_list_row(list_t *list, unsigned char index) {
+	bounding_box_t *box = &list->widget.box;
+	unsigned char pitch = list->font->height + 2;
+	unsigned char y;
+
+	if (index < list->top || index - list->top >= _widget_list_rows(list) || index >= list->count) return;
+
+	y = box->y1 + (index - list->top) * pitch;
+
+	draw_filled_rectangle(box->x1, y, box->x2, y + pitch - 1, 0);
+	draw_text((char *) list->items[index], box->x1 + 2, y + 1, list->font, 1);
+	if (index == list->selected) {
+		draw_rectangle(box->x1, y, box->x2, y + pitch - 1, 1);
+	}
+}
+
+// The number of items that fit in a list, each with a row above and below
+unsigned char _widget_list_rows(list_t *list) {
+	return (list->widget.box.y2 - list->widget.box.y1 + 1) / (list->font->height + 2);
+}
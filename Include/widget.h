@@ -0,0 +1,294 @@
+/**
+ * @file   widget.h
+ * @date   October, 2026
+ * @brief  Header for a tree of widgets that are only redrawn when they change.
+ * @details
+ *
+ * Rather than drawing a whole screen every time something on it changes, the screen
+ * is described once as a tree of widgets: labels, numeric values, bars, icons and
+ * lists, held in panels.  Changing a widget only marks it as needing to be drawn, and
+ * widget_frame() then draws the widgets that have changed and sends their columns to
+ * the screen.  A screen that shows the time and a few readings once a second then only
+ * draws and sends the digits that changed.
+ *
+ * Widgets are structures owned by the caller, so no memory is allocated.  Each type of
+ * widget starts with a widget_t, which is what is passed to widget_add() and the other
+ * functions that work on any widget.  The widgets in a panel must not overlap, as each
+ * one is cleared before it is drawn.
+ *
+ * Some widgets can update part of themselves: a value only draws the digits that have
+ * changed (see number.h), a bar only draws the columns between its old and new lengths
+ * (see gauge.h) and a list only draws the rows whose selection has changed.  number.h
+ * and gauge.h have to be included before this header.
+ *
+ * Example usage:
+ * @code
+ *    const bounding_box_t screen = { 1, 1, SCREEN_WIDTH, SCREEN_HEIGHT };
+ *    const bounding_box_t title_box = { 1, 1, SCREEN_WIDTH, 12 };
+ *    panel_t root;
+ *    label_t title;
+ *    value_t temperature;
+ *    char temperature_text[5];
+ *
+ *    widget_panel_init(&root, screen, 0);
+ *    widget_label_init(&title, title_box, "Temperature", TEXT_ALIGN_CENTRE, &Tahoma8);
+ *    widget_value_init(&temperature, temperature_text, 40, 20, 5, 1, TEXT_ALIGN_RIGHT, &Tahoma16, 1);
+ *    widget_add(&root, &title.widget);
+ *    widget_add(&root, &temperature.widget);
+ *
+ *    for (;;) {
+ *        // In tenths of a degree
+ *        widget_value_set(&temperature, read_temperature());
+ *        widget_frame(&root);
+ *    }
+ * @endcode
+ */
+#ifndef _WIDGET_H_
+#define _WIDGET_H_
+
+/** A widget that holds other widgets, see panel_t */
+#define WIDGET_PANEL		0
+/** A line of text, see label_t */
+#define WIDGET_LABEL		1
+/** A number, see value_t */
+#define WIDGET_VALUE		2
+/** A horizontal bar, see bar_t */
+#define WIDGET_BAR			3
+/** A bitmap, see icon_t */
+#define WIDGET_ICON			4
+/** A list of items with one selected, see list_t */
+#define WIDGET_LIST			5
+
+/** Flag: the whole widget needs to be drawn */
+#define WIDGET_INVALID		0x01
+/** Flag: part of the widget has changed, and it knows which part */
+#define WIDGET_CHANGED		0x02
+/** Flag: the widget is hidden, see widget_show() */
+#define WIDGET_HIDDEN		0x04
+
+/**
+ * The part that every widget starts with.
+ */
+typedef struct widget {
+	/** The area the widget covers, which is cleared before it is drawn */
+	bounding_box_t box;
+	/** WIDGET_PANEL, WIDGET_LABEL and so on */
+	unsigned char type;
+	/** WIDGET_INVALID, WIDGET_CHANGED and WIDGET_HIDDEN */
+	unsigned char flags;
+	/** The panel holding this widget, or 0 */
+	struct widget *parent;
+	/** The next widget in the same panel, or 0 */
+	struct widget *next;
+} widget_t;
+
+/**
+ * A widget that holds other widgets.  The root of the tree is a panel.
+ */
+typedef struct {
+	widget_t widget;
+	/** The first widget in the panel, or 0 */
+	widget_t *children;
+	/** 1 to draw a rectangle around the edge of the panel */
+	unsigned char border;
+} panel_t;
+
+/**
+ * A line of text, which is wrapped if it does not fit (see draw_text_box()).
+ */
+typedef struct {
+	widget_t widget;
+	/** The text shown */
+	const char *text;
+	/** The font used to render the text */
+	const font_t *font;
+	/** TEXT_ALIGN_LEFT, TEXT_ALIGN_CENTRE or TEXT_ALIGN_RIGHT */
+	unsigned char align;
+} label_t;
+
+/**
+ * A numeric field, see number.h.
+ */
+typedef struct {
+	widget_t widget;
+	/** The field the value is drawn in */
+	number_t number;
+	/** The value shown */
+	long value;
+} value_t;
+
+/**
+ * A horizontal bar with a border, filled from the left in proportion to its value.
+ */
+typedef struct {
+	widget_t widget;
+	/** The inside of the bar, see gauge.h */
+	gauge_t gauge;
+	/** The value to show, from 0 - gauge.max */
+	unsigned int value;
+} bar_t;
+
+/**
+ * A bitmap, for example a battery or signal icon.
+ */
+typedef struct {
+	widget_t widget;
+	/** The bitmap shown, or 0 for none */
+	const bitmap_t *bitmap;
+} icon_t;
+
+/**
+ * A list of items, one line each, with a rectangle around the selected item.  The
+ * list scrolls to keep the selected item in view.
+ */
+typedef struct {
+	widget_t widget;
+	/** The text of each item */
+	const char * const *items;
+	/** The font used to render the items */
+	const font_t *font;
+	/** The number of items */
+	unsigned char count;
+	/** The selected item */
+	unsigned char selected;
+	/** The first item shown */
+	unsigned char top;
+	/** The item that is shown as selected on the screen */
+	unsigned char drawn;
+} list_t;
+
+/**
+ * Set up a panel.  A panel covering the screen is used as the root of the tree.
+ *
+ * @param panel		The panel to set up
+ * @param box		The area covered by the panel
+ * @param border	1 to draw a rectangle around the edge of the panel
+ */
+void widget_panel_init(panel_t *panel, bounding_box_t box, unsigned char border);
+/**
+ * Add a widget to the end of a panel.
+ *
+ * @param panel		The panel
+ * @param widget	The widget, for example &label.widget
+ */
+void widget_add(panel_t *panel, widget_t *widget);
+/**
+ * Set up a label.
+ *
+ * @param label		The label to set up
+ * @param box		The area covered by the label
+ * @param text		The text to show, which must stay in memory
+ * @param align		TEXT_ALIGN_LEFT, TEXT_ALIGN_CENTRE or TEXT_ALIGN_RIGHT
+ * @param font		The font used to render the text
+ */
+void widget_label_init(label_t *label, bounding_box_t box, const char *text, unsigned char align, const font_t *font);
+/**
+ * Change the text of a label.  Call this again if the text is changed in place.
+ *
+ * @param label		The label
+ * @param text		The text to show, which must stay in memory
+ */
+void widget_label_set(label_t *label, const char *text);
+/**
+ * Set up a numeric value.  The parameters are the same as number_init().
+ *
+ * @param value		The value to set up
+ * @param text		width bytes of RAM for the characters shown
+ * @param x			The x position, from 1 - SCREEN_WIDTH
+ * @param y			The y position, from 1 - SCREEN_HEIGHT
+ * @param width		The number of characters, including any minus sign and
+ *					decimal point, up to NUMBER_MAX_WIDTH
+ * @param decimals	The number of digits after the decimal point, 0 for integers
+ * @param align		TEXT_ALIGN_LEFT or TEXT_ALIGN_RIGHT
+ * @param font		The font used for the digits
+ * @param spacing	The gap in pixels between characters
+ */
+void widget_value_init(value_t *value, char *text, unsigned char x, unsigned char y, unsigned char width,
+					   unsigned char decimals, unsigned char align, const font_t *font, unsigned char spacing);
+/**
+ * Change a numeric value.  Only the digits that change are drawn.
+ *
+ * @param value		The value widget
+ * @param number	The new value, see number_set()
+ */
+void widget_value_set(value_t *value, long number);
+/**
+ * Set up a bar.
+ *
+ * @param bar		The bar to set up
+ * @param box		The area covered by the bar, including its border
+ * @param max		The value of a full bar
+ */
+void widget_bar_init(bar_t *bar, bounding_box_t box, unsigned int max);
+/**
+ * Change the value of a bar.  Only the part of the bar that changes is drawn.
+ *
+ * @param bar		The bar
+ * @param value		The new value, from 0 - max
+ */
+void widget_bar_set(bar_t *bar, unsigned int value);
+/**
+ * Set up an icon.  The icon covers the size of the bitmap.
+ *
+ * @param icon		The icon to set up
+ * @param x			The x position, from 1 - SCREEN_WIDTH
+ * @param y			The y position, from 1 - SCREEN_HEIGHT
+ * @param bitmap	The bitmap to show
+ */
+void widget_icon_init(icon_t *icon, unsigned char x, unsigned char y, const bitmap_t *bitmap);
+/**
+ * Change the bitmap of an icon, which should be the same size as the first.
+ *
+ * @param icon		The icon
+ * @param bitmap	The bitmap to show, or 0 for none
+ */
+void widget_icon_set(icon_t *icon, const bitmap_t *bitmap);
+/**
+ * Set up a list.  The first item is selected.
+ *
+ * @param list		The list to set up
+ * @param box		The area covered by the list
+ * @param items		The text of each item, which must stay in memory
+ * @param count		The number of items
+ * @param font		The font used to render the items
+ */
+void widget_list_init(list_t *list, bounding_box_t box, const char * const *items, unsigned char count, const font_t *font);
+/**
+ * Select an item in a list.  Unless the list has to scroll, only the rows of the
+ * old and new items are drawn.
+ *
+ * @param list		The list
+ * @param index		The item to select, from 0 - count - 1
+ */
+void widget_list_select(list_t *list, unsigned char index);
+/**
+ * Mark a widget as needing to be drawn in full, for example after something
+ * else has been drawn over it.  Invalidating the root panel redraws everything.
+ *
+ * @param widget	The widget
+ */
+void widget_invalidate(widget_t *widget);
+/**
+ * Show or hide a widget.  A hidden widget is cleared from the screen.
+ *
+ * @param widget	The widget
+ * @param visible	1 to show the widget, 0 to hide it
+ */
+void widget_show(widget_t *widget, unsigned char visible);
+/**
+ * Draw every widget in the tree that has changed since the last frame, then call
+ * graphics_refresh().  Widgets that have not changed are not touched, so only the
+ * columns that changed are sent to the screen.
+ *
+ * @param root		The panel at the root of the tree
+ * @return			The number of widgets drawn
+ */
+unsigned char widget_frame(panel_t *root);
+
+/* Internal functions (do not call) */
+void _widget_init(widget_t *widget, bounding_box_t box, unsigned char type);
+void _widget_draw(widget_t *widget);
+void _widget_draw_list_row(list_t *list, unsigned char index);
+unsigned char _widget_list_rows(list_t *list);
+
+#endif // _WIDGET_H_
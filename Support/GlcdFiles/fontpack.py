@@ -0,0 +1,564 @@
+from __future__ import print_function
+import argparse
+import os
+import re
+import struct
+import sys
+
+import ugf
+
+########
+#   Date: 17th October 2026
+#    URL: http://edeca.net
+# Source: https://github.com/edeca/Electronics
+#
+# This script compiles bitmap fonts into C headers for the graphics
+# library.  Each font gets tables of the offset, width, ascent and descent
+# of every character, so text can be measured without looking at the
+# bitmaps.  The bitmaps can optionally be compressed, in which case
+# draw_char() decodes them as they are drawn (see BITMAP_RLE in graphics.h).
+#
+# Fonts can be read from:
+#
+#  - BDF fonts (.bdf), as used by X11
+#  - PC Screen Fonts (.psf), versions 1 and 2, as used by the Linux console
+#  - muGUI Font and Bitmap Generator projects (.ugf), every group is used
+#  - headers created with mugui_edeca.xsl or this script (.h)
+#  - the default font table of the KS0108 library (ks0108.h)
+#
+# Examples:
+#
+#   python fontpack.py --rle font_tahoma.h > font_tahoma_rle.h
+#   python fontpack.py --name Terminus12 --range 32-126 ter-u12n.bdf > font_terminus.h
+#   python fontpack.py --subset "0123456789.-" Tahoma.ugf > font_tahoma_digits.h
+#   python fontpack.py --range 32-126,0xB0,0xB5 ter-u12n.bdf > font_terminus.h
+#   python fontpack.py --name System5x7 ../../Include/ks0108.h > font_system.h
+#
+# --range can list several ranges, separated by commas.  Characters missing
+# from the font inside a range are left with a width of zero and no bitmap.
+# --subset only includes the characters asked for.  Either way the longest
+# run of characters becomes the first range of the font, which is looked up
+# directly, and the others are listed in a table of font_range_t, so no
+# space is used for characters in between.
+#
+# The baseline is taken from the font where possible (BDF fonts and
+# generated headers).  Otherwise it is the bottom of the letter "H", or
+# can be given with --baseline.
+#
+# A summary of the space used by each font is written to stderr.
+########
+
+def doExit(message):
+    sys.stderr.write(message + "\n")
+    sys.exit(1)
+
+class Glyph:
+    def __init__(self, width, data, comment=None):
+        # data is "vertical ceiling", one byte for every 8 rows of each column
+        self.width = width
+        self.data = data
+        self.comment = comment
+
+    def rows(self, pages):
+        # The first and last rows with any pixels set, or None if empty
+        mask = [0] * pages
+        for x in range(self.width):
+            for page in range(pages):
+                mask[page] |= self.data[x * pages + page]
+        rows = [page * 8 + bit for page in range(pages) for bit in range(8) if mask[page] & (1 << bit)]
+        if not rows:
+            return None
+        return rows[0], rows[-1]
+
+class Font:
+    def __init__(self, name, start, height, glyphs, ascent=None, comment=None):
+        self.name = name
+        self.height = height
+        self.glyphs = glyphs
+        self.ascent = ascent
+        self.comment = comment
+        # The character of each glyph, when glyphs is a list
+        if isinstance(glyphs, list):
+            self.codes = list(range(start, start + len(glyphs)))
+
+    def pages(self):
+        return (self.height + 7) // 8
+
+    def glyph(self, character):
+        if character in self.codes:
+            return self.glyphs[self.codes.index(character)]
+        return None
+
+    def ranges(self):
+        # Runs of consecutive characters as (first, count, index), in the
+        # order of the glyphs.  The first is the one looked up directly.
+        runs = []
+        for i, code in enumerate(self.codes):
+            if runs and code == runs[-1][0] + runs[-1][1]:
+                runs[-1][1] += 1
+            else:
+                runs.append([code, 1, i])
+        return [tuple(r) for r in runs]
+
+def packGlyph(width, height, pixel):
+    # Convert a function returning whether pixel (x, y) is set to vertical
+    # ceiling bytes
+    data = []
+    for x in range(width):
+        for page in range((height + 7) // 8):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height and pixel(x, y):
+                    byte |= 1 << bit
+            data.append(byte)
+    return Glyph(width, data)
+
+def fontName(filename):
+    name = re.sub(r'\W', '_', os.path.splitext(os.path.basename(filename))[0])
+    return name if not name[0].isdigit() else '_' + name
+
+def readHeader(filename):
+    text = open(filename).read().replace('\r\n', '\n')
+
+    # Everything before the first font is kept as it is
+    first = text.find('//---------------------------------------------------------------\n// Group Name')
+    if first < 0:
+        doExit("No fonts found in %s" % filename)
+    preamble = text[:first].replace('#include "graphics.h"\n', '').rstrip('\n')
+
+    fonts = []
+    pattern = re.compile(r'(//-+\n// Group Name:.*?//-+\n)'
+                         r'const unsigned char (\w+)_bitmaps\[\] = \n\{\n(.*?)\n\};.*?'
+                         r'const unsigned char \2_widths\[\] = \n\{\n(.*?)\n\};.*?'
+                         r'const font_t \2 = \s*\{(.*?)\};', re.S)
+    for match in pattern.finditer(text):
+        comment, name, bitmaps, widths, descriptor = match.groups()
+
+        if re.search(r'BITMAP_RLE', descriptor):
+            doExit("%s is compressed, use the original header" % name)
+
+        # Start, count, height and (if present) the ascent
+        values = [int(v, 16) for v in re.findall(r'\b0x([0-9A-Fa-f]+)', descriptor)]
+        start, count, height = values[0:3]
+        ascent = values[3] if len(values) > 3 else None
+        widths = [int(v, 16) for v in re.findall(r'0x([0-9A-Fa-f]+)', widths)]
+
+        # Characters after the first range, see font_range_t
+        codes = list(range(start, start + count))
+        ranges = re.search(r'const font_range_t %s_ranges\[\] = \n\{\n(.*?)\n\};' % name, text, re.S)
+        if ranges:
+            for first, rangeCount, index in re.findall(r'\{ 0x([0-9A-Fa-f]+), 0x([0-9A-Fa-f]+), 0x([0-9A-Fa-f]+) \}', ranges.group(1)):
+                first, rangeCount, index = int(first, 16), int(rangeCount, 16), int(index, 16)
+                if index != len(codes):
+                    doExit("%s: the ranges are not in the order of the bitmaps" % name)
+                codes += range(first, first + rangeCount)
+
+        glyphs = []
+        for i, (glyphComment, data) in enumerate(re.findall(r'^\t(/\* Index \d+, .*?\*/)\n\t(.*?)$', bitmaps, re.M)):
+            data = [int(v, 16) for v in re.findall(r'0x([0-9A-Fa-f]+)', data)]
+            if len(data) != widths[i] * ((height + 7) // 8):
+                doExit("%s: bitmap %d has the wrong number of bytes" % (name, i))
+            glyphs.append(Glyph(widths[i], data, glyphComment))
+
+        if len(glyphs) != len(codes):
+            doExit("%s: expected %d bitmaps, found %d" % (name, len(codes), len(glyphs)))
+
+        font = Font(name, start, height, glyphs, ascent, comment)
+        font.codes = codes
+        fonts.append(font)
+
+    return preamble, fonts
+
+def readUgf(filename):
+    fonts = []
+    for group in ugf.readProject(filename):
+        glyphs = [packGlyph(width, group['height'], pixel) for width, pixel in group['bitmaps']]
+        font = Font(group['name'], group['start'], group['height'], glyphs,
+                    group['ascent'] or None)
+        font.details = [ ('Designer', group['designer']), ('Date', group['date']),
+                         ('Description', group['description']) ]
+        fonts.append(font)
+    return fonts
+
+def readBdf(filename, name):
+    properties = {}
+    glyphs = {}
+    lines = iter(open(filename).read().splitlines())
+
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] != 'STARTCHAR':
+            if len(words) > 1:
+                properties[words[0]] = words[1:]
+            continue
+
+        # A single character
+        char = {}
+        for line in lines:
+            words = line.split()
+            if words[0] == 'BITMAP':
+                char['rows'] = []
+                for line in lines:
+                    if line.strip() == 'ENDCHAR':
+                        break
+                    char['rows'].append(int(line.strip(), 16))
+                break
+            char[words[0]] = [int(w) for w in words[1:]]
+
+        if 'ENCODING' in char and char['ENCODING'][0] >= 0:
+            glyphs[char['ENCODING'][0]] = char
+
+    if 'FONT_ASCENT' not in properties or 'FONT_DESCENT' not in properties:
+        doExit("%s does not have FONT_ASCENT and FONT_DESCENT" % filename)
+    ascent = int(properties['FONT_ASCENT'][0])
+    height = ascent + int(properties['FONT_DESCENT'][0])
+
+    font = {}
+    for code, char in glyphs.items():
+        w, h, xoff, yoff = char['BBX']
+        width = max(char['DWIDTH'][0], xoff + w)
+        rowBytes = (w + 7) // 8
+
+        # BDF rows are left aligned, padded to a whole number of bytes.  The
+        # bounding box is relative to the baseline.
+        def pixel(x, y, char=char, w=w, h=h, xoff=xoff, yoff=yoff, rowBytes=rowBytes):
+            bx = x - xoff
+            by = y - (ascent - yoff - h)
+            if bx < 0 or bx >= w or by < 0 or by >= h:
+                return False
+            return (char['rows'][by] >> (rowBytes * 8 - 1 - bx)) & 1
+
+        font[code] = packGlyph(width, height, pixel)
+
+    return Font(name, 0, height, font, ascent)
+
+def readPsf(filename, name):
+    data = open(filename, 'rb').read()
+
+    if data[0:2] == b'\x36\x04':
+        mode = struct.unpack_from('B', data, 2)[0]
+        height = struct.unpack_from('B', data, 3)[0]
+        width = 8
+        count = 512 if mode & 1 else 256
+        offset = 4
+        rowBytes = 1
+    elif data[0:4] == b'\x72\xb5\x4a\x86':
+        offset, flags, count, charSize, height, width = struct.unpack_from('<IIIIII', data, 8)
+        rowBytes = (width + 7) // 8
+    else:
+        doExit("%s is not a PSF font" % filename)
+
+    glyphs = {}
+    for code in range(min(count, 256)):
+        start = offset + code * rowBytes * height
+        rows = bytearray(data[start:start + rowBytes * height])
+
+        def pixel(x, y, rows=rows):
+            return (rows[y * rowBytes + x // 8] >> (7 - x % 8)) & 1
+
+        glyphs[code] = packGlyph(width, height, pixel)
+
+    return Font(name, 0, height, glyphs)
+
+def readKs0108(filename, name):
+    # Seven columns for each character from 32, inverted because the KS0108
+    # library writes them with XOR.  0x55 pads narrower characters.  All 8
+    # rows are used, as descenders reach the bottom bit.
+    table = re.search(r'Font\[\]\[7\]\s*=\s*\{(.*?)\};', open(filename).read(), re.S)
+    if not table:
+        doExit("%s does not have a KS0108 font table" % filename)
+
+    glyphs = {}
+    for line in table.group(1).splitlines():
+        values = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]{2}', line.split('//')[0])]
+        if values:
+            columns = [v ^ 0xFF for v in values if v != 0x55]
+            glyphs[32 + len(glyphs)] = Glyph(len(columns), columns)
+
+    return Font(name, 0, 8, glyphs)
+
+def selectCharacters(font, ranges, subset):
+    # font.glyphs is a dictionary of every character in the font, make it a
+    # list of the characters in ranges, or only those in subset
+    if subset is not None:
+        codes = [c for c in subset if c in font.glyphs]
+        if not codes:
+            doExit("%s has none of the characters asked for" % font.name)
+    else:
+        codes = [c for first, last in ranges for c in range(first, last + 1)]
+
+    codes = sorted(set(codes))
+    if len(codes) > 255:
+        doExit("A font can have at most 255 characters")
+
+    # Split into runs of consecutive characters
+    runs = []
+    for code in codes:
+        if runs and code == runs[-1][-1] + 1:
+            runs[-1].append(code)
+        else:
+            runs.append([code])
+
+    # The longest run that can start the font is looked up directly, so it
+    # goes first.  The start of a font has to fit in a byte.
+    direct = max([r for r in runs if r[0] <= 255] or [runs[0]], key=len)
+    if direct[0] > 255:
+        doExit("%s needs a character below 256" % font.name)
+    runs.remove(direct)
+
+    empty = Glyph(0, [])
+    font.codes = direct + [c for r in runs for c in r]
+    font.glyphs = [font.glyphs.get(code, empty) for code in font.codes]
+
+def subsetFont(font, subset):
+    # The same as selectCharacters() for a font that is already a list
+    font.glyphs = dict(zip(font.codes, font.glyphs))
+    selectCharacters(font, [], subset)
+
+def findBaseline(font, baseline):
+    if baseline is not None:
+        font.ascent = baseline
+    if font.ascent:
+        return
+
+    # Use the bottom of "H", or failing that assume nothing descends
+    glyph = font.glyph(ord('H'))
+    rows = glyph.rows(font.pages()) if glyph else None
+    font.ascent = rows[1] + 1 if rows else font.height
+
+def extents(font):
+    # The rows above and including the baseline, then the rows below it
+    baseline = font.ascent - 1
+    result = []
+    for glyph in font.glyphs:
+        rows = glyph.rows(font.pages())
+        if not rows:
+            result.append((0, 0))
+            continue
+        top, bottom = rows
+        result.append((max(0, baseline - top + 1), max(0, bottom - baseline)))
+    return result
+
+def compress(data, width, pages):
+    # Reorder to a page at a time, then run length encode (see BITMAP_RLE)
+    data = [data[x * pages + page] for page in range(pages) for x in range(width)]
+    out = []
+    i = 0
+
+    while i < len(data):
+        # Measure the run of identical bytes starting here
+        limit = 64 if data[i] == 0 else 65
+        j = i
+        while j < len(data) and data[j] == data[i] and j - i < limit:
+            j += 1
+
+        if data[i] == 0:
+            out.append(0xBF + j - i)
+        elif j - i >= 3:
+            out += [0x7E + j - i, data[i]]
+        else:
+            # Copy bytes until a zero or a run of three is found
+            j = i
+            while (j < len(data) and j - i < 128 and data[j] != 0 and
+                   not (j + 2 < len(data) and data[j] == data[j + 1] == data[j + 2])):
+                j += 1
+            out += [j - i - 1] + data[i:j]
+
+        i = j
+
+    return out
+
+def describe(code):
+    if 32 <= code < 127:
+        return '%d "%s"' % (code, chr(code))
+    return '%d' % code
+
+def otherCharacters(font):
+    # The characters after the first range, for example "176, 196-214"
+    return ', '.join([('%d' % first) if count == 1 else ('%d-%d' % (first, first + count - 1))
+                      for first, count, index in font.ranges()[1:]])
+
+def groupComment(font, source):
+    proportional = len(set([g.width for g in font.glyphs if g.width])) > 1
+    first, count, index = font.ranges()[0]
+    lines = [ 'Group Name: %s' % font.name, 'Source: %s' % os.path.basename(source) ]
+    lines += ['%s: %s' % d for d in getattr(font, 'details', [])]
+    lines += [ 'Byte Orientation: verticalCeiling',
+               'Font Height: %d pixel(s)' % font.height,
+               'Font Type: %s' % ('Proportional' if proportional else 'Monospace'),
+               'Number of Bitmaps: %d' % len(font.glyphs),
+               'Start Character: %s' % describe(first),
+               'Stop Character: %s' % describe(first + count - 1) ]
+    if len(font.ranges()) > 1:
+        lines.append('Other Characters: %s' % otherCharacters(font))
+    rule = '//' + '-' * 63 + '\n'
+    return rule + ''.join(['// %s\n' % l for l in lines]) + rule
+
+def updateComment(font):
+    # Keep a comment from a header, but correct the characters it lists
+    first, count, index = font.ranges()[0]
+    comment = font.comment
+    comment = re.sub(r'(// Number of Bitmaps: ).*', r'\g<1>%d' % len(font.glyphs), comment)
+    comment = re.sub(r'(// Start Character: ).*', r'\g<1>%s' % describe(first), comment)
+    comment = re.sub(r'(// Stop Character: ).*', r'\g<1>%s' % describe(first + count - 1), comment)
+    comment = re.sub(r'// Other Characters: .*\n', '', comment)
+    if len(font.ranges()) > 1:
+        comment = re.sub(r'(// Stop Character: .*\n)', r'\g<1>// Other Characters: %s\n' % otherCharacters(font), comment)
+    return comment
+
+def hexBytes(data):
+    return ','.join(['0x%02X' % b for b in data])
+
+def writeHeader(preamble, fonts, rle):
+    print(preamble)
+    print()
+    print('#include "graphics.h"')
+
+    for font in fonts:
+        name = font.name
+        bitmaps = []
+        for glyph in font.glyphs:
+            data = glyph.data
+            if rle and data:
+                data = compress(data, glyph.width, font.pages())
+            bitmaps.append(data)
+
+        sys.stderr.write("%s: %d bytes of bitmaps (%d uncompressed)\n" %
+                         (name, sum([len(b) for b in bitmaps]), sum([len(g.data) for g in font.glyphs])))
+
+        print()
+        print(font.comment, end='')
+        print("const unsigned char %s_bitmaps[] = " % name)
+        print("{")
+        # Characters left out by --subset have a comment but no data
+        last = max([i for i, data in enumerate(bitmaps) if data])
+        parts = []
+        for i, (glyph, data) in enumerate(zip(font.glyphs, bitmaps)):
+            text = "\t" + (glyph.comment or "/* Index %d, character %s (width: %d pixels) */" % (i, describe(font.codes[i]), glyph.width))
+            if data:
+                text += "\n\t" + hexBytes(data) + ("," if i < last else "")
+            parts.append(text)
+        print("\n\n".join(parts))
+        print("};")
+        print()
+
+        print("// Offset of each bitmap in %s_bitmaps" % name)
+        print("const unsigned short %s_offsets[] = " % name)
+        print("{")
+        offset = 0
+        lines = []
+        for i, b in enumerate(bitmaps):
+            lines.append("\t0x%X,\t// Index %d" % (offset, i))
+            offset += len(b)
+        print("\n".join(lines))
+        print("};")
+        print()
+
+        print("// Width of each bitmap in pixels")
+        print("const unsigned char %s_widths[] = " % name)
+        print("{")
+        print("\n".join(["\t0x%X,\t// Index %d" % (g.width, i) for i, g in enumerate(font.glyphs)]))
+        print("};")
+        print()
+
+        print("// Rows of each bitmap above and below the baseline")
+        print("const unsigned char %s_extents[] = " % name)
+        print("{")
+        print("\n".join(["\t0x%X, 0x%X,\t// Index %d" % (a, d, i) for i, (a, d) in enumerate(extents(font))]))
+        print("};")
+        print()
+
+        ranges = font.ranges()
+        if len(ranges) > 1:
+            print("// Characters after the first range")
+            print("const font_range_t %s_ranges[] = " % name)
+            print("{")
+            print("\n".join(["\t{ 0x%X, 0x%X, 0x%X },\t// %s" % (first, count, index,
+                              describe(first) if count == 1 else '%d to %d' % (first, first + count - 1))
+                              for first, count, index in ranges[1:]]))
+            print("};")
+            print()
+
+        print("const font_t %s = " % name)
+        print("{")
+        print("\t%s_bitmaps," % name)
+        print("\t%s_offsets," % name)
+        print("\t%s_widths," % name)
+        print("\t0x%X,\t// Start character " % ranges[0][0])
+        print("\t0x%X,\t// Number of bitmaps " % ranges[0][1])
+        print("\t0x%X,\t// Height " % font.height)
+        print("\t%s,\t// Flags " % ("BITMAP_RLE" if rle else "0"))
+        print("\t%s_extents," % name)
+        if len(ranges) > 1:
+            print("\t0x%X,\t// Ascent " % font.ascent)
+            print("\t%s_ranges," % name)
+            print("\t0x%X\t// Number of ranges " % (len(ranges) - 1))
+        else:
+            print("\t0x%X\t// Ascent " % font.ascent)
+        print("};")
+
+def parseRanges(text):
+    # For example "32-126,0xB0,0xB5"
+    ranges = []
+    for part in text.split(','):
+        first, last = part.split('-') if '-' in part else (part, part)
+        ranges.append((int(first, 0), int(last, 0)))
+    return ranges
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile bitmap fonts into headers for the graphics library")
+    parser.add_argument('font', help="a .bdf, .psf, .ugf or .h font, or ks0108.h")
+    parser.add_argument('--name', help="name of the font_t for BDF, PSF and KS0108 fonts (default: from the file name)")
+    parser.add_argument('--range', default='32-126', help="characters to include from BDF, PSF and KS0108 fonts, for example 32-126,0xB0 (default: 32-126)")
+    parser.add_argument('--subset', help="only include these characters")
+    parser.add_argument('--baseline', type=int, help="rows from the top of the font to the baseline, inclusive")
+    parser.add_argument('--rle', action='store_true', help="compress the bitmaps")
+    args = parser.parse_args()
+
+    extension = os.path.splitext(args.font)[1].lower()
+    name = args.name or fontName(args.font)
+    ranges = parseRanges(args.range)
+    subset = None
+    if args.subset is not None:
+        subset = set([ord(c) for c in args.subset])
+
+    preamble = ('//' + '-' * 63 + '\n'
+                '// Font created by fontpack.py from %s\n' % os.path.basename(args.font) +
+                '//' + '-' * 63)
+
+    if extension == '.h' and 'Font[][7]' in open(args.font).read():
+        fonts = [readKs0108(args.font, name)]
+    elif extension == '.h':
+        preamble, fonts = readHeader(args.font)
+    elif extension == '.ugf':
+        fonts = readUgf(args.font)
+    elif extension == '.bdf':
+        fonts = [readBdf(args.font, name)]
+    elif extension == '.psf':
+        fonts = [readPsf(args.font, name)]
+    else:
+        doExit("Unknown font type %s" % extension)
+
+    for font in fonts:
+        if isinstance(font.glyphs, dict):
+            selectCharacters(font, ranges, subset)
+        elif subset is not None:
+            subsetFont(font, subset)
+
+        findBaseline(font, args.baseline)
+
+        if not font.comment:
+            font.comment = groupComment(font, args.font)
+        elif subset is not None:
+            # Bitmap comments from a header would have the wrong index
+            for glyph in font.glyphs:
+                glyph.comment = None
+            font.comment = updateComment(font)
+
+    writeHeader(preamble, fonts, args.rle)
+
+if __name__ == '__main__':
+    main()
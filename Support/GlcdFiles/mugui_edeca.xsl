@@ -3,6 +3,7 @@
 <!-- History: -->
 <!-- 12.02.2011 Changes [DC]: Add characters to output (equivalent of chr()), tidy up for use in blog post -->
 <!-- 12.11.2011 Changes [DC]: Fixed up spelling & comments, changed variable types for HiTech C -->
+<!-- 17.10.2026 Changes: Output bitmaps, offset & width tables and a font_t descriptor for the graphics library -->
 <!-- 03.04.2010 Bug Fix [FB]: Changed absolut to relativ path in template recursivLength to get bytesperbitmap -->
 
 <xsl:stylesheet
@@ -29,6 +30,7 @@
 		<xsl:value-of select="projectname"/> 
 		<xsl:text>&#xa;</xsl:text>	
 		<xsl:text>//---------------------------------------------------------------&#xa;&#xa;</xsl:text>
+		<xsl:text>#include "graphics.h"&#xa;&#xa;</xsl:text>
 	</xsl:template> 
 
 
@@ -98,120 +100,101 @@
 		
 		<!-- TODO: Size of this font in bytes -->
 		
-		<!-- Make Header -->
+		<!-- The graphics library only understands vertical ceiling fonts -->
+		<xsl:if test="not(contains(byteorientation,'verticalCeiling'))">
+			<xsl:text>#error Byte orientation must be verticalCeiling&#xa;</xsl:text>
+		</xsl:if>
+
+		<!-- Make Bitmaps -->
 		<xsl:text>const unsigned char </xsl:text>
 		<xsl:value-of select="groupname"/>
-		<xsl:text>[] = &#xa;{&#xa;</xsl:text>
-		<xsl:text>&#9;// Font Header &#xa;</xsl:text>
-		
-		<xsl:if test="contains(proportional,'True')">
-			<xsl:text>&#9;0x01,</xsl:text>
-		</xsl:if>
-		<xsl:if test="contains(proportional,'False')">
-			<xsl:text>&#9;0x00,</xsl:text>
-		</xsl:if>
-		<xsl:text>&#9;// 0x00: Monospace, 0x01: Proportional &#xa;</xsl:text>
-		
-		<xsl:if test="contains(byteorientation,'horizontalLeft')">
-			<xsl:text>&#9;0x00,</xsl:text>
-		</xsl:if>
-		<xsl:if test="contains(byteorientation,'horizontalRight')">
-			<xsl:text>&#9;0x01,</xsl:text>
-		</xsl:if>
-		<xsl:if test="contains(byteorientation,'verticalCeiling')">
-			<xsl:text>&#9;0x02,</xsl:text>
-		</xsl:if>
-		<xsl:if test="contains(byteorientation,'verticalBottom')">
-			<xsl:text>&#9;0x03,</xsl:text>
-		</xsl:if>
-		<xsl:text>&#9;// 0x00: horizontalLeft,  0x01: horizontalRight &#xa;</xsl:text>
-		<xsl:text>&#9;&#9;&#9;// 0x02: verticalCeiling, 0x03: verticalBottom &#xa;</xsl:text>
-		
+		<xsl:text>_bitmaps[] = &#xa;{&#xa;</xsl:text>
+		<xsl:for-each select="bitmap">
+			<xsl:text>&#9;/* Index </xsl:text>
+			<xsl:value-of select="position()-1"/>
+			<xsl:text>, character </xsl:text>
+			<xsl:value-of select="position() + $StartCharacter - 1"/>
+			<xsl:text> "</xsl:text>
+			<xsl:value-of select="substring($asciiChars, position() + $StartCharacter - 1, 1)"/>
+			<xsl:text>" (width: </xsl:text>
+			<xsl:if test="contains(../proportional,'True')">
+				<xsl:value-of select="bitmapwidth"/>
+			</xsl:if>
+			<xsl:if test="contains(../proportional,'False')">
+				<xsl:value-of select="$Width"/>
+			</xsl:if>
+			<xsl:text> pixels) */&#xa;</xsl:text>
+			<xsl:text>&#9;</xsl:text>
+			<xsl:for-each select="byte">
+				<xsl:value-of select="."/>
+				<xsl:if test="position()!=last()">
+					<xsl:text>,</xsl:text>
+				</xsl:if>
+			</xsl:for-each>
+			<xsl:if test="position()!=last()">
+				<xsl:text>,&#xa;&#xa;</xsl:text>
+			</xsl:if>
+		</xsl:for-each>
+		<xsl:text>&#xa;};&#xa;&#xa;</xsl:text>
+
+		<!-- Make Offsets -->
+		<xsl:call-template name="makeOffsets"/>
+
+		<!-- Make Widths -->
+		<xsl:text>// Width of each bitmap in pixels&#xa;</xsl:text>
+		<xsl:text>const unsigned char </xsl:text>
+		<xsl:value-of select="groupname"/>
+		<xsl:text>_widths[] = &#xa;{&#xa;</xsl:text>
+		<xsl:for-each select="bitmap">
+			<xsl:text>&#9;0x</xsl:text>
+			<xsl:if test="contains(../proportional,'True')">
+				<xsl:call-template name="toHex">
+					<xsl:with-param name="decimalNumber" select="bitmapwidth" />
+				</xsl:call-template>
+			</xsl:if>
+			<xsl:if test="contains(../proportional,'False')">
+				<xsl:call-template name="toHex">
+					<xsl:with-param name="decimalNumber" select="$Width" />
+				</xsl:call-template>
+			</xsl:if>
+			<xsl:text>,&#9;// Index </xsl:text>
+			<xsl:value-of select="position()-1"/>
+			<xsl:text>&#xa;</xsl:text>
+		</xsl:for-each>
+		<xsl:text>};&#xa;&#xa;</xsl:text>
+
+		<!-- Make Font Descriptor -->
+		<xsl:text>const font_t </xsl:text>
+		<xsl:value-of select="groupname"/>
+		<xsl:text> = &#xa;{&#xa;</xsl:text>
+		<xsl:text>&#9;</xsl:text>
+		<xsl:value-of select="groupname"/>
+		<xsl:text>_bitmaps,&#xa;</xsl:text>
+		<xsl:text>&#9;</xsl:text>
+		<xsl:value-of select="groupname"/>
+		<xsl:text>_offsets,&#xa;</xsl:text>
+		<xsl:text>&#9;</xsl:text>
+		<xsl:value-of select="groupname"/>
+		<xsl:text>_widths,&#xa;</xsl:text>
+
 		<xsl:text>&#9;0x</xsl:text>
 		<xsl:call-template name="toHex">
 			<xsl:with-param name="decimalNumber" select="startcharacter" />
 		</xsl:call-template>
 		<xsl:text>,&#9;// Start character &#xa;</xsl:text>
-		
+
 		<xsl:text>&#9;0x</xsl:text>
 		<xsl:call-template name="toHex">
 			<xsl:with-param name="decimalNumber" select="numberofbitmaps" />
 		</xsl:call-template>
-		<xsl:text>,&#9;// Number of Bitmaps &#xa;</xsl:text>
-		
+		<xsl:text>,&#9;// Number of bitmaps &#xa;</xsl:text>
+
 		<xsl:text>&#9;0x</xsl:text>
 		<xsl:call-template name="toHex">
 			<xsl:with-param name="decimalNumber" select="height" />
 		</xsl:call-template>
-		<xsl:text>,&#9;// Height &#xa;</xsl:text>
-		
-		<xsl:if test="contains(proportional,'False')">
-			<xsl:text>&#9;0x</xsl:text>
-			<xsl:call-template name="toHex">
-				<xsl:with-param name="decimalNumber" select="width" />
-			</xsl:call-template>
-		<xsl:text>,&#9;// Width &#xa;</xsl:text>
-		</xsl:if>
-		
-		<xsl:text>&#xa;</xsl:text>
-		
-		<xsl:if test="contains(proportional,'True')">
-			<!-- Make Index -->
-			<xsl:call-template name="makeIndex"/>
-
-			<!-- Make Bitmaps -->
-			<xsl:for-each select="bitmap">
-			  <xsl:text>&#9;/* Index </xsl:text>
-			  <xsl:value-of select="position()-1"/>
-				<xsl:text>, character </xsl:text>
-				<xsl:value-of select="position() + $StartCharacter - 1"/>		
-				<xsl:text> "</xsl:text>
-				<xsl:value-of select="substring($asciiChars, position() + $StartCharacter - 1, 1)"/>
-				<xsl:text>" (width: </xsl:text>
-					<xsl:value-of select="bitmapwidth"/>
-				<xsl:text> pixels)</xsl:text>
-				
-				<xsl:text> */&#xa;</xsl:text>
-				<xsl:text>&#9;0x</xsl:text>
-
-				<xsl:call-template name="toHex">
-					<xsl:with-param name="decimalNumber" select="bitmapwidth" />
-				</xsl:call-template>
-				<xsl:text>, </xsl:text>
-				<xsl:for-each select="byte">
-					<xsl:value-of select="."/>
-					<xsl:if test="position()!=last()">
-						<xsl:text>,</xsl:text>
-					</xsl:if>
-				</xsl:for-each>
-				<xsl:if test="position()!=last()">
-					<xsl:text>,&#xa;&#xa;</xsl:text>
-				</xsl:if>
-			</xsl:for-each>
-		</xsl:if>
-		<xsl:if test="contains(proportional,'False')">
-			<!-- Make Bitmaps -->
-			<xsl:for-each select="bitmap">
-				<xsl:text>&#9;/* Character "</xsl:text>
-				<xsl:value-of select="substring($asciiChars, position() + $StartCharacter - 1, 1)"/>
-				<xsl:text>" - Index: </xsl:text>
-				<xsl:value-of select="position()-1"/>
-				<xsl:text> */&#xa;</xsl:text>
-				<xsl:text>&#9;</xsl:text>
-
-				<xsl:for-each select="byte">
-					<xsl:value-of select="."/>
-					<xsl:if test="position()!=last()">
-						<xsl:text>,</xsl:text>
-					</xsl:if>
-				</xsl:for-each>
-				<xsl:if test="position()!=last()">
-					<xsl:text>,&#xa;&#xa;</xsl:text>
-				</xsl:if>
-			</xsl:for-each>
-		</xsl:if>
-		
-		<xsl:text>&#xa;};&#xa;</xsl:text>
+		<xsl:text>&#9;// Height &#xa;</xsl:text>
+		<xsl:text>};&#xa;</xsl:text>
 	</xsl:template>
 
 	
@@ -246,54 +229,44 @@
 	</xsl:template>
 
 
-	<!-- Make the index with start address of the bitmaps -->
-	<xsl:template name="makeIndex">
-		<xsl:text>&#9;// Bitmap Index (number of index entries </xsl:text>
-			<xsl:value-of  select="count(bitmap)"/>
-		<xsl:text>)&#xa; </xsl:text>
-		
-		<xsl:variable name="mcount" select="count(bitmap)*2"/>
+	<!-- Make the table of offsets of each bitmap, this is used by the
+	     graphics library to find a character without searching -->
+	<xsl:template name="makeOffsets">
+		<xsl:text>// Offset of each bitmap in </xsl:text>
+		<xsl:value-of select="groupname"/>
+		<xsl:text>_bitmaps&#xa;</xsl:text>
+		<xsl:text>const unsigned short </xsl:text>
+		<xsl:value-of select="groupname"/>
+		<xsl:text>_offsets[] = &#xa;{&#xa;</xsl:text>
 
 		<xsl:for-each select="bitmap">
 			<xsl:variable name="laenge">
-				<xsl:call-template name="recursivLength">
-					<xsl:with-param name="n">
-						<xsl:value-of select="position()"/>
-					</xsl:with-param>
-				</xsl:call-template>
+				<xsl:if test="contains(../proportional,'True')">
+					<xsl:call-template name="recursivLength">
+						<xsl:with-param name="n">
+							<xsl:value-of select="position()"/>
+						</xsl:with-param>
+					</xsl:call-template>
+				</xsl:if>
+				<!-- Monospace bitmaps are all the same size -->
+				<xsl:if test="contains(../proportional,'False')">
+					<xsl:value-of select="(position() - 1) * ../bytesperbitmap"/>
+				</xsl:if>
 			</xsl:variable>
 
-			<!-- length of data bytes, Index length, Header (5 Bytes but starting with 0 ->2)  -->
-			<xsl:variable name="Highbyte">
-					<xsl:value-of select="floor(($laenge + $mcount + 5) div 256)"/>
-			</xsl:variable>
-			
-					
-			<xsl:variable name="Lowbyte">
-					<xsl:value-of select="($laenge + $mcount + 5) mod 256"/>
-			</xsl:variable>
 			<xsl:text>&#9;0x</xsl:text>
-			
-			<xsl:call-template name="toHex">
-				<xsl:with-param name="decimalNumber" select="$Highbyte" />
-			</xsl:call-template>
-
-			<xsl:text>, 0x</xsl:text>
-			
 			<xsl:call-template name="toHex">
-				<xsl:with-param name="decimalNumber" select="$Lowbyte" />
+				<xsl:with-param name="decimalNumber" select="$laenge" />
 			</xsl:call-template>
-
-			<xsl:text>, // Index </xsl:text>
-				<xsl:value-of select="position()-1"/>
-      <xsl:text> (offset: </xsl:text>
-				<xsl:value-of select="($laenge + $mcount + 5)"/>
-			<xsl:text>)&#xa;</xsl:text>
+			<xsl:text>,&#9;// Index </xsl:text>
+			<xsl:value-of select="position()-1"/>
+			<xsl:text>&#xa;</xsl:text>
 		</xsl:for-each>
-		<xsl:text>&#xa;</xsl:text>
+		<xsl:text>};&#xa;&#xa;</xsl:text>
 	</xsl:template>
 
-	<!-- Calculate the bitmap bytes from bitmap 1 to bitmap n -->
+	<!-- Calculate the bitmap bytes from bitmap 1 to bitmap n - 1, which is
+	     the offset of bitmap n -->
 	<!-- Remember: XSLT starts indexing with 1 and not with 0 -->
 	<xsl:template name="recursivLength">
 	   <xsl:param name="n"/>
@@ -304,9 +277,9 @@
 					</xsl:call-template>
 				</xsl:variable> 
 				<xsl:variable name="BytesPerBitmap">
-					<xsl:value-of select="../bitmap[$n]/bytesperbitmap" />
+					<xsl:value-of select="../bitmap[$n - 1]/bytesperbitmap" />
 				</xsl:variable>
-				<xsl:value-of select="$Width + $BytesPerBitmap + 1" />
+				<xsl:value-of select="$Width + $BytesPerBitmap" />
 	   </xsl:if>
 	   <xsl:if test="$n = 1"> 
 			<xsl:variable name="Width" >0</xsl:variable> 
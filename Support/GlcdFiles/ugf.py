@@ -0,0 +1,224 @@
+import struct
+
+########
+#   Date: 17th October 2026
+#    URL: http://edeca.net
+# Source: https://github.com/edeca/Electronics
+#
+# Reads muGUI "Font and Bitmap Generator" project files (.ugf), which are
+# .NET BinaryFormatter streams.  Only the parts of the format used by
+# muGUI are supported.  Used by fontpack.py.
+#
+# See [MS-NRBF] ".NET Remoting: Binary Format Data Structure" for details
+# of the record types.
+########
+
+class Reference:
+    def __init__(self, objectId):
+        self.objectId = objectId
+
+class Object:
+    def __init__(self, name, members):
+        self.name = name
+        self.members = members
+
+class Nulls:
+    def __init__(self, count):
+        self.count = count
+
+# Formats of the primitive types that have a fixed size
+primitiveFormats = { 1: '?', 2: 'B', 6: 'd', 7: 'h', 8: 'i', 9: 'q', 10: 'b',
+                     11: 'f', 12: 'q', 13: 'q', 14: 'H', 15: 'I', 16: 'Q' }
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+        self.objects = {}
+        self.classes = {}
+
+    def unpack(self, fmt):
+        value = struct.unpack_from('<' + fmt, self.data, self.pos)[0]
+        self.pos += struct.calcsize('<' + fmt)
+        return value
+
+    def byte(self):
+        return self.unpack('B')
+
+    def int32(self):
+        return self.unpack('i')
+
+    def string(self):
+        # The length is stored 7 bits at a time
+        length = 0
+        shift = 0
+        while True:
+            b = self.byte()
+            length |= (b & 0x7F) << shift
+            shift += 7
+            if not b & 0x80:
+                break
+        value = self.data[self.pos:self.pos + length].decode('utf-8')
+        self.pos += length
+        return value
+
+    def primitive(self, primitiveType):
+        if primitiveType in primitiveFormats:
+            return self.unpack(primitiveFormats[primitiveType])
+        if primitiveType in (5, 18):
+            return self.string()
+        if primitiveType == 3:
+            # A single UTF-8 character
+            b = self.byte()
+            length = 1 if b < 0x80 else 2 if b < 0xE0 else 3 if b < 0xF0 else 4
+            self.pos += length - 1
+            return self.data[self.pos - length:self.pos].decode('utf-8')
+        raise ValueError("Unsupported primitive type %d" % primitiveType)
+
+    def additionalInfo(self, binaryType):
+        if binaryType in (0, 7):
+            return self.byte()
+        if binaryType == 3:
+            return self.string()
+        if binaryType == 4:
+            return (self.string(), self.int32())
+        return None
+
+    def classInfo(self):
+        objectId = self.int32()
+        name = self.string()
+        names = [self.string() for i in range(self.int32())]
+        return objectId, name, names
+
+    def memberValues(self, objectId, name, names, types):
+        members = {}
+        for member, (binaryType, info) in zip(names, types):
+            if binaryType == 0:
+                members[member] = self.primitive(info)
+            else:
+                members[member] = self.record()
+        obj = Object(name, members)
+        self.objects[objectId] = obj
+        return obj
+
+    def elements(self, count, binaryType=None, info=None):
+        values = []
+        while len(values) < count:
+            if binaryType == 0:
+                values.append(self.primitive(info))
+                continue
+            value = self.record()
+            if isinstance(value, Nulls):
+                values += [None] * value.count
+            else:
+                values.append(value)
+        return values
+
+    def record(self):
+        recordType = self.byte()
+
+        if recordType == 0:
+            # Stream header
+            self.pos += 16
+            return self.record()
+        if recordType == 12:
+            # Library
+            self.int32()
+            self.string()
+            return self.record()
+        if recordType in (2, 3, 4, 5):
+            objectId, name, names = self.classInfo()
+            if recordType in (4, 5):
+                types = [self.byte() for n in names]
+                types = [(t, self.additionalInfo(t)) for t in types]
+            else:
+                types = [(2, None)] * len(names)
+            if recordType in (3, 5):
+                self.int32()
+            self.classes[objectId] = (name, names, types)
+            return self.memberValues(objectId, name, names, types)
+        if recordType == 1:
+            # An object of a class that has already been described
+            objectId = self.int32()
+            name, names, types = self.classes[self.int32()]
+            return self.memberValues(objectId, name, names, types)
+        if recordType == 6:
+            objectId = self.int32()
+            self.objects[objectId] = self.string()
+            return self.objects[objectId]
+        if recordType == 7:
+            objectId = self.int32()
+            arrayType = self.byte()
+            lengths = [self.int32() for i in range(self.int32())]
+            if arrayType in (3, 4, 5):
+                [self.int32() for l in lengths]
+            binaryType = self.byte()
+            info = self.additionalInfo(binaryType)
+            count = 1
+            for l in lengths:
+                count *= l
+            self.objects[objectId] = (lengths, self.elements(count, binaryType if binaryType == 0 else None, info))
+            return self.objects[objectId]
+        if recordType == 8:
+            return self.primitive(self.byte())
+        if recordType == 9:
+            return Reference(self.int32())
+        if recordType == 10:
+            return None
+        if recordType == 11:
+            return 'end'
+        if recordType == 13:
+            return Nulls(self.byte())
+        if recordType == 14:
+            return Nulls(self.int32())
+        if recordType == 15:
+            objectId = self.int32()
+            length = self.int32()
+            primitiveType = self.byte()
+            self.objects[objectId] = ([length], [self.primitive(primitiveType) for i in range(length)])
+            return self.objects[objectId]
+        if recordType in (16, 17):
+            objectId = self.int32()
+            length = self.int32()
+            self.objects[objectId] = ([length], self.elements(length))
+            return self.objects[objectId]
+
+        raise ValueError("Unsupported record type %d at offset %d" % (recordType, self.pos - 1))
+
+    def resolve(self, value):
+        if isinstance(value, Reference):
+            return self.objects[value.objectId]
+        return value
+
+    def listItems(self, value):
+        # A System.Collections.Generic.List, only _size items are used
+        value = self.resolve(value)
+        items = self.resolve(value.members['_items'])[1]
+        return [self.resolve(item) for item in items[:value.members['_size']]]
+
+def readProject(filename):
+    """Returns a list of groups, each a dictionary with the name, height,
+    start character, orientation and bitmaps.  Each bitmap is a tuple of
+    the width and a function returning whether pixel (x, y) is set."""
+    reader = Reader(open(filename, 'rb').read())
+    project = reader.record()
+    while reader.record() != 'end':
+        pass
+
+    groups = []
+    for group in reader.listItems(project.members['groupList']):
+        m = group.members
+        bitmaps = []
+        for bitmap in reader.listItems(m['bitmapList']):
+            # The pixels are an Int32[width, height] array
+            height = bitmap.members['yres']
+            pixels = reader.resolve(bitmap.members['pixel'])[1]
+            bitmaps.append((bitmap.members['xres'],
+                            lambda x, y, pixels=pixels, height=height: pixels[x * height + y] != 0))
+
+        groups.append({ 'name': m['groupname'], 'designer': m['designer'], 'date': m['date'],
+                        'description': m['description'], 'height': m['yres'],
+                        'start': m['startcharacter'], 'ascent': m['ascenderheight'],
+                        'proportional': m['proportionalschrift'], 'bitmaps': bitmaps })
+
+    return groups
@@ -0,0 +1,467 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "htc.h"
+#include "graphics.h"
+#include "number.h"
+#include "gauge.h"
+#include "widget.h"
+#include "st7565.h"
+#include "graphics-config.h"
+
+#include "fonts/font_arialblack.h"
+#include "fonts/font_lucidaconsole.h"
+#include "fonts/font_system.h"
+#include "fonts/font_tahoma.h"
+#include "fonts/font_verdana.h"
+#include "fonts/font_webdings.h"
+#include "fonts/font_wingdings.h"
+
+/********
+ * Draws a fixed set of workloads with the ST7565 library built for a PC, and
+ * reports what each one costs.  The numbers are for a single run, so they can
+ * be compared between versions of the library to find regressions.
+ *
+ * Usage:
+ *
+ *   benchmark [ITERATIONS [WORKLOAD]]
+ *
+ * Each workload is drawn ITERATIONS times (200 by default) on a blank screen
+ * and then sent with graphics_refresh().  WORKLOAD only runs the workloads
+ * whose names start with it.  The columns are:
+ *
+ *   pixel, hspan,   Calls to each driver hook.  With GRAPHICS_DIRECT_BUFFER the
+ *   vspan, blit     library writes the buffer of the "buffer" driver itself.
+ *   written         Bytes of glcd_buffer written, by the library (counted with
+ *                   GRAPHICS_COUNT_WRITES) or by the driver hooks
+ *   spi data, cmd   Bytes that glcd_refresh() sent to the screen, counted from
+ *                   the clock pin (see htc.h)
+ *   us              Wall time on this PC for drawing and refreshing, which is
+ *                   only useful for comparing runs on the same machine
+ *
+ * The gauges_ and widgets_ workloads start from a screen that is already
+ * drawn, and show the cost of redrawing it in full against only updating what
+ * changed.
+ *
+ * The settings in st7565-config.h are used, so the refresh can be compared
+ * with and without ST7565_SHADOW_BUFFER, for example.
+ ********/
+
+// The ST7565 library without its buffer, so the graphics library has to use
+// the hooks.  glcd_buffer is still sent by glcd_refresh().
+const glcd_driver_t st7565_hook_driver = {
+	SCREEN_WIDTH, SCREEN_HEIGHT, 0,
+	glcd_pixel, glcd_hspan, glcd_vspan, glcd_blit, glcd_mark_dirty, glcd_refresh
+};
+
+// The ST7565 library as if it could only set one pixel at a time
+const glcd_driver_t st7565_pixel_driver = {
+	SCREEN_WIDTH, SCREEN_HEIGHT, 0,
+	glcd_pixel, 0, 0, 0, glcd_mark_dirty, glcd_refresh
+};
+
+typedef struct {
+	const char *name;
+	const glcd_driver_t *driver;
+} driver_t;
+
+const driver_t drivers[] = {
+	{ "buffer", &st7565_driver },
+	{ "hooks", &st7565_hook_driver },
+	{ "pixel", &st7565_pixel_driver }
+};
+
+typedef struct {
+	unsigned long pixel;
+	unsigned long hspan;
+	unsigned long vspan;
+	unsigned long blit;
+	unsigned long written;
+	unsigned long spi_data;
+	unsigned long spi_command;
+} counts_t;
+
+#ifdef GRAPHICS_COUNT_WRITES
+extern unsigned long graphics_bytes_written;
+#endif
+
+// The driver being measured, and a copy whose hooks count each call first
+const glcd_driver_t *target;
+glcd_driver_t counting_driver;
+counts_t counts;
+
+void count_pixel(unsigned char x, unsigned char y, unsigned char colour) {
+	counts.pixel++;
+	counts.written++;
+	target->pixel(x, y, colour);
+}
+
+void count_hspan(unsigned char x1, unsigned char x2, unsigned char y, unsigned char colour) {
+	counts.hspan++;
+	if (x2 >= x1) counts.written += x2 - x1 + 1;
+	target->hspan(x1, x2, y, colour);
+}
+
+void count_vspan(unsigned char x, unsigned char y1, unsigned char y2, unsigned char colour) {
+	counts.vspan++;
+	if (y2 >= y1) counts.written += (y2 - 1) / 8 - (y1 - 1) / 8 + 1;
+	target->vspan(x, y1, y2, colour);
+}
+
+void count_blit(unsigned char x, unsigned char y, unsigned char data, unsigned char count, unsigned char rop) {
+	counts.blit++;
+	if (count) counts.written += (y + count - 2) / 8 - (y - 1) / 8 + 1;
+	target->blit(x, y, data, count, rop);
+}
+
+void set_driver(const glcd_driver_t *driver) {
+	target = driver;
+	counting_driver = *driver;
+	if (driver->pixel) counting_driver.pixel = count_pixel;
+	if (driver->hspan) counting_driver.hspan = count_hspan;
+	if (driver->vspan) counting_driver.vspan = count_vspan;
+	if (driver->blit) counting_driver.blit = count_blit;
+
+	graphics_set_driver(&counting_driver);
+}
+
+const char pangram[] = "The quick brown fox jumps over the lazy dog";
+
+void draw_pangram(const font_t *font) {
+	unsigned char y;
+
+	// Fill the screen, the last line is clipped
+	for (y = 1; y <= SCREEN_HEIGHT; y += font->height) {
+		draw_text((char *) pangram + y % 7, 1, y, font, 1);
+	}
+}
+
+#define FONT_WORKLOAD(font) \
+	void text_##font(void) { draw_pangram(&font); }
+
+FONT_WORKLOAD(ArialBlack10)
+FONT_WORKLOAD(ArialBlack12)
+FONT_WORKLOAD(ArialBlack14)
+FONT_WORKLOAD(ArialBlack16)
+FONT_WORKLOAD(LucidaConsole7)
+FONT_WORKLOAD(LucidaConsole8)
+FONT_WORKLOAD(LucidaConsole10)
+FONT_WORKLOAD(LucidaConsole10_Bold)
+FONT_WORKLOAD(System5x7)
+FONT_WORKLOAD(Tahoma7)
+FONT_WORKLOAD(Tahoma8)
+FONT_WORKLOAD(Tahoma10)
+FONT_WORKLOAD(Tahoma12)
+FONT_WORKLOAD(Tahoma14)
+FONT_WORKLOAD(Tahoma16)
+FONT_WORKLOAD(Tahoma22)
+FONT_WORKLOAD(Tahoma26)
+FONT_WORKLOAD(Tahoma32)
+FONT_WORKLOAD(Verdana8)
+FONT_WORKLOAD(Verdana10)
+FONT_WORKLOAD(Verdana12)
+FONT_WORKLOAD(Verdana14)
+FONT_WORKLOAD(Verdana16)
+FONT_WORKLOAD(Verdana22)
+FONT_WORKLOAD(Verdana26)
+FONT_WORKLOAD(Verdana32)
+FONT_WORKLOAD(Webdings14)
+FONT_WORKLOAD(Webdings16)
+FONT_WORKLOAD(Webdings18)
+FONT_WORKLOAD(Wingdings)
+
+void lines(void) {
+	int n;
+
+	// From the centre to the edge in every octant, steep and shallow
+	for (n = 0; n <= 128; n += 8) {
+		draw_line(64, 32, n, 1, 1);
+		draw_line(64, 32, n, 64, 1);
+	}
+	for (n = 0; n <= 64; n += 8) {
+		draw_line(64, 32, 1, n, 1);
+		draw_line(64, 32, 128, n, 1);
+	}
+}
+
+void lines_straight(void) {
+	int n;
+
+	for (n = 1; n <= 64; n += 3) {
+		draw_line(1, n, 128, n, 1);
+	}
+	for (n = 1; n <= 128; n += 3) {
+		draw_line(n, 1, n, 64, 1);
+	}
+}
+
+void circles(void) {
+	unsigned char r;
+
+	for (r = 2; r <= 31; r += 3) {
+		draw_circle(64, 32, r, 1);
+	}
+}
+
+void circles_filled(void) {
+	unsigned char r;
+
+	for (r = 3; r <= 30; r += 9) {
+		draw_filled_circle(16 + r * 3, 32, r, 1);
+	}
+}
+
+void rectangles(void) {
+	int n;
+
+	for (n = 0; n < 30; n += 3) {
+		draw_rectangle(1 + n, 1 + n / 2, 128 - n, 64 - n / 2, 1);
+	}
+}
+
+void rectangles_filled(void) {
+	int n;
+
+	// Sizes and positions that do not line up with the pages
+	for (n = 0; n < 8; n++) {
+		draw_filled_rectangle(1 + n * 16, 1 + n * 3, 12 + n * 16, 20 + n * 5, 1);
+	}
+}
+
+void rectangles_rounded(void) {
+	draw_rounded_rectangle(1, 1, 60, 30, 6, 1);
+	draw_filled_rounded_rectangle(68, 1, 128, 30, 8, 1);
+	draw_rounded_rectangle(1, 34, 60, 64, 12, 1);
+	draw_filled_rounded_rectangle(68, 34, 128, 64, 3, 1);
+}
+
+void full_fill(void) {
+	draw_filled_rectangle(1, 1, SCREEN_WIDTH, SCREEN_HEIGHT, 1);
+}
+
+void full_redraw(void) {
+	// A typical screen: a title bar, a frame and some text
+	draw_filled_rectangle(1, 1, SCREEN_WIDTH, 12, 1);
+	draw_text("Temperature", 3, 3, &Tahoma8, 1);
+	draw_rectangle(1, 14, SCREEN_WIDTH, SCREEN_HEIGHT, 1);
+	draw_text("21.5", 10, 22, &Tahoma26, 1);
+	draw_text("Min 18.2 Max 24.9", 4, 54, &System5x7, 1);
+}
+
+void text_runs(void) {
+	const text_run_t status[] = {
+		{ "12:45 ", &Tahoma10 },
+		{ "~", &Webdings14 },
+		{ " 21.5", &Tahoma16 },
+		{ "C", &Tahoma8 }
+	};
+
+	// A status line, right aligned
+	draw_text_runs(status, 4, SCREEN_WIDTH + 1 - text_runs_width(status, 4, 1), 1, 1);
+}
+
+// Bars for battery, signal and two tank levels
+gauge_t gauges[4];
+
+void gauges_setup(void) {
+	unsigned char n;
+
+	gauge_init(&gauges[0], 1, 1, 40, 8, GAUGE_RIGHT, 100);
+	gauge_init(&gauges[1], 50, 1, 40, 8, GAUGE_LEFT, 100);
+	gauge_init(&gauges[2], 100, 1, 12, 64, GAUGE_UP, 100);
+	gauge_init(&gauges[3], 116, 1, 12, 64, GAUGE_UP, 100);
+
+	for (n = 0; n < 4; n++) {
+		gauge_set(&gauges[n], 50);
+	}
+}
+
+void gauges_full(void) {
+	unsigned char n;
+
+	for (n = 0; n < 4; n++) {
+		draw_filled_rectangle(gauges[n].x, gauges[n].y, gauges[n].x + gauges[n].width - 1,
+			gauges[n].y + gauges[n].height - 1, 0);
+		draw_filled_rectangle(gauges[n].x, gauges[n].y, gauges[n].x + gauges[n].width / 2,
+			gauges[n].y + gauges[n].height - 1, 1);
+	}
+}
+
+void gauges_update(void) {
+	unsigned char n;
+
+	// A sample that moves each gauge a little
+	for (n = 0; n < 4; n++) {
+		gauge_set(&gauges[n], n & 1 ? 45 : 55);
+	}
+}
+
+// A screen of widgets that is updated once a second
+panel_t screen;
+label_t title;
+value_t reading;
+bar_t level;
+char reading_text[5];
+
+void widgets_setup(void) {
+	const bounding_box_t screen_box = { 1, 1, SCREEN_WIDTH, SCREEN_HEIGHT };
+	const bounding_box_t title_box = { 1, 1, SCREEN_WIDTH, 12 };
+	const bounding_box_t level_box = { 1, 50, SCREEN_WIDTH, 60 };
+	static unsigned char ready = 0;
+
+	if (!ready) {
+		widget_panel_init(&screen, screen_box, 0);
+		widget_label_init(&title, title_box, "Temperature", TEXT_ALIGN_CENTRE, &Tahoma8);
+		widget_value_init(&reading, reading_text, 20, 18, 5, 1, TEXT_ALIGN_RIGHT, &Tahoma26, 1);
+		widget_bar_init(&level, level_box, 1000);
+		widget_add(&screen, &title.widget);
+		widget_add(&screen, &reading.widget);
+		widget_add(&screen, &level.widget);
+		ready = 1;
+	}
+
+	widget_value_set(&reading, 215);
+	widget_bar_set(&level, 860);
+	widget_invalidate(&screen.widget);
+	widget_frame(&screen);
+}
+
+void widgets_full(void) {
+	widget_invalidate(&screen.widget);
+	widget_frame(&screen);
+}
+
+void widgets_update(void) {
+	// The last digit and the end of the bar change
+	widget_value_set(&reading, 216);
+	widget_bar_set(&level, 864);
+	widget_frame(&screen);
+}
+
+typedef struct {
+	const char *name;
+	void (*draw)(void);
+	// Draws the screen the workload starts from, or 0 for a blank screen
+	void (*setup)(void);
+} workload_t;
+
+#define FONT(font) { "text_" #font, text_##font }
+
+const workload_t workloads[] = {
+	FONT(ArialBlack10), FONT(ArialBlack12), FONT(ArialBlack14), FONT(ArialBlack16),
+	FONT(LucidaConsole7), FONT(LucidaConsole8), FONT(LucidaConsole10), FONT(LucidaConsole10_Bold),
+	FONT(System5x7),
+	FONT(Tahoma7), FONT(Tahoma8), FONT(Tahoma10), FONT(Tahoma12), FONT(Tahoma14),
+	FONT(Tahoma16), FONT(Tahoma22), FONT(Tahoma26), FONT(Tahoma32),
+	FONT(Verdana8), FONT(Verdana10), FONT(Verdana12), FONT(Verdana14),
+	FONT(Verdana16), FONT(Verdana22), FONT(Verdana26), FONT(Verdana32),
+	FONT(Webdings14), FONT(Webdings16), FONT(Webdings18), FONT(Wingdings),
+	{ "text_runs", text_runs },
+	{ "lines", lines },
+	{ "lines_straight", lines_straight },
+	{ "circles", circles },
+	{ "circles_filled", circles_filled },
+	{ "rectangles", rectangles },
+	{ "rectangles_filled", rectangles_filled },
+	{ "rectangles_rounded", rectangles_rounded },
+	{ "full_fill", full_fill },
+	{ "full_redraw", full_redraw },
+	{ "gauges_full", gauges_full, gauges_setup },
+	{ "gauges_update", gauges_update, gauges_setup },
+	{ "widgets_full", widgets_full, widgets_setup },
+	{ "widgets_update", widgets_update, widgets_setup }
+};
+
+double seconds(void) {
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+// Draw a workload on a blank screen and send it, adding the time taken to
+// *elapsed.  Blanking the screen and the setup of the workload are neither
+// timed nor counted.
+void run(const workload_t *workload, double *elapsed) {
+	unsigned long data = pic_spi_data_bits;
+	unsigned long command = pic_spi_command_bits;
+	counts_t before = counts;
+#ifdef GRAPHICS_COUNT_WRITES
+	unsigned long written = graphics_bytes_written;
+#endif
+	double start;
+
+	glcd_blank();
+	if (workload->setup) {
+		workload->setup();
+		graphics_refresh();
+	}
+	pic_spi_data_bits = data;
+	pic_spi_command_bits = command;
+	counts = before;
+#ifdef GRAPHICS_COUNT_WRITES
+	graphics_bytes_written = written;
+#endif
+
+	start = seconds();
+	workload->draw();
+	graphics_refresh();
+	*elapsed += seconds() - start;
+}
+
+int main(int argc, char **argv) {
+	const char *only = 0;
+	unsigned long iterations = 200;
+	unsigned long n;
+	unsigned int w, d;
+	double elapsed;
+
+	if (argc > 3 || (argc > 1 && !(iterations = strtoul(argv[1], 0, 10)))) {
+		fprintf(stderr, "Usage: %s [ITERATIONS [WORKLOAD]]\n", argv[0]);
+		return 2;
+	}
+	if (argc == 3) only = argv[2];
+
+	for (d = 0; d < sizeof(drivers) / sizeof(drivers[0]); d++) {
+		set_driver(drivers[d].driver);
+
+		printf("%s driver\n", drivers[d].name);
+		printf("%-25s %7s %7s %7s %7s %8s %8s %6s %9s\n", "workload",
+			"pixel", "hspan", "vspan", "blit", "written", "spi data", "cmd", "us");
+
+		for (w = 0; w < sizeof(workloads) / sizeof(workloads[0]); w++) {
+			if (only && strncmp(workloads[w].name, only, strlen(only))) continue;
+
+			memset(&counts, 0, sizeof(counts));
+#ifdef GRAPHICS_COUNT_WRITES
+			graphics_bytes_written = 0;
+#endif
+			pic_spi_data_bits = 0;
+			pic_spi_command_bits = 0;
+			elapsed = 0;
+
+			for (n = 0; n < iterations; n++) {
+				run(&workloads[w], &elapsed);
+			}
+
+#ifdef GRAPHICS_COUNT_WRITES
+			counts.written += graphics_bytes_written;
+#endif
+			counts.spi_data = pic_spi_data_bits / 8;
+			counts.spi_command = pic_spi_command_bits / 8;
+
+			// Every run does exactly the same work, so the counts divide evenly
+			printf("%-25s %7lu %7lu %7lu %7lu %8lu %8lu %6lu %9.2f\n", workloads[w].name,
+				counts.pixel / iterations, counts.hspan / iterations,
+				counts.vspan / iterations, counts.blit / iterations,
+				counts.written / iterations, counts.spi_data / iterations,
+				counts.spi_command / iterations, elapsed * 1e6 / iterations);
+		}
+
+		printf("\n");
+	}
+
+	return 0;
+}
@@ -0,0 +1,662 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "graphics.h"
+#include "number.h"
+#include "gauge.h"
+#include "widget.h"
+#include "dither.h"
+#include "chart.h"
+#include "console.h"
+#include "st7565.h"
+#include "sim.h"
+#include "htc.h"
+#include "graphics-config.h"
+#include "st7565-config.h"
+
+#ifdef ST7565_COMPOSITOR
+#include "compositor.h"
+#endif
+
+#include "fonts/font_arialblack.h"
+#include "fonts/font_lucidaconsole.h"
+#include "fonts/font_system.h"
+#include "fonts/font_tahoma.h"
+#include "fonts/font_verdana.h"
+#include "fonts/font_webdings.h"
+
+/********
+ * Draws a set of test scenes and compares each one against a saved PBM image
+ * (a "golden" image) in the given directory.  Every scene is drawn with each of
+ * the drivers in sim.h, which must all give the same picture.
+ *
+ * Scenes are also drawn with the ST7565 library, which sends them to the
+ * emulated screen in pic.c.  The picture on its glass is compared instead, so
+ * this checks what is actually sent by glcd_refresh() with the settings in
+ * st7565-config.h.  The screen keeps its picture between scenes, so each
+ * refresh only sends what differs from the last one.
+ *
+ * Usage:
+ *
+ *   golden_test DIRECTORY          Compare, returns 1 if any scene differs
+ *   golden_test --update DIRECTORY Save the images from the first driver that
+ *                                  draws each scene
+ *
+ * A scene that differs is saved as <scene>-<driver>.pbm in the current
+ * directory, so that it can be compared with the golden image.
+ ********/
+
+// Scenes that need something only some drivers have
+#define SCENE_BUFFER	0x01	// Draws directly into the buffer
+#define SCENE_READ		0x02	// Reads back the screen, for ROP_XOR
+#define SCENE_SCROLL	0x04	// Moves the display start line, see glcd_scroll()
+#define SCENE_LAYERS	0x08	// Shows layers of the compositor
+
+typedef struct {
+	const char *name;
+	void (*draw)(void);
+	unsigned char needs;
+} scene_t;
+
+typedef struct {
+	const char *name;
+	const glcd_driver_t *driver;
+	unsigned char has;
+	void (*clear)(void);
+	void (*show)(void);		// Puts the picture in sim_buffer, or 0 if it is already there
+} driver_t;
+
+void st7565_clear(void);
+void st7565_show(void);
+
+const driver_t drivers[] = {
+	{ "buffer", &sim_driver, SCENE_BUFFER | SCENE_READ, sim_clear, 0 },
+	{ "hooks", &sim_hook_driver, SCENE_READ, sim_clear, 0 },
+	{ "pixel", &sim_pixel_driver, 0, sim_clear, 0 },
+#ifdef ST7565_COMPOSITOR
+	{ "st7565", &st7565_driver, SCENE_BUFFER | SCENE_READ | SCENE_SCROLL | SCENE_LAYERS, st7565_clear, st7565_show }
+#else
+	{ "st7565", &st7565_driver, SCENE_BUFFER | SCENE_READ | SCENE_SCROLL, st7565_clear, st7565_show }
+#endif
+};
+
+// A 16x16 diamond with a hollow centre, one byte for every 8 rows of each column
+unsigned char diamond_data[32];
+const bitmap_t diamond = { diamond_data, 16, 16, 0 };
+
+// A 16x24 box, compressed (see BITMAP_RLE).  The bottom page is empty.
+const unsigned char box_rle_data[] = {
+	0x00, 0xFF,			// Page 0, left edge
+	0x8C, 0x01,			// Top edge, 14 columns
+	0x01, 0xFF, 0xFF,	// Page 0 right edge, page 1 left edge
+	0x8C, 0x80,			// Bottom edge
+	0x00, 0xFF,			// Page 1, right edge
+	0xCF				// Page 2, 16 empty columns
+};
+const bitmap_t box_rle = { box_rle_data, 16, 24, BITMAP_RLE };
+
+// A 10x10 XBM checker board of 2x2 squares, 2 bytes for each row
+const unsigned char checker_xbm_data[] = {
+	0x33, 0x03, 0x33, 0x03, 0xCC, 0x00, 0xCC, 0x00, 0x33, 0x03,
+	0x33, 0x03, 0xCC, 0x00, 0xCC, 0x00, 0x33, 0x03, 0x33, 0x03
+};
+const bitmap_t checker_xbm = { checker_xbm_data, 10, 10, BITMAP_XBM };
+
+// A 7 pixel font with "1" and "2" in its first range and four other
+// characters, which are found through font_range_t
+const unsigned char units_bitmaps[] = {
+	0x00, 0x42, 0x7F, 0x40, 0x00,	// 1
+	0x42, 0x61, 0x51, 0x49, 0x46,	// 2
+	0x06, 0x09, 0x09, 0x06,			// Degree sign
+	0x7E, 0x10, 0x10, 0x0E, 0x10,	// Micro sign
+	0x5E, 0x61, 0x01, 0x61, 0x5E,	// Omega
+	0x14, 0x3E, 0x55, 0x55, 0x41	// Euro sign
+};
+const unsigned short units_offsets[] = { 0, 5, 10, 14, 19, 24 };
+const unsigned char units_widths[] = { 5, 5, 4, 5, 5, 5 };
+const font_range_t units_ranges[] = {
+	{ 0xB0, 1, 2 },
+	{ 0xB5, 1, 3 },
+	{ 0x3A9, 1, 4 },
+	{ 0x20AC, 1, 5 }
+};
+const font_t units = { units_bitmaps, units_offsets, units_widths, '1', 2, 7, 0, 0, 7, units_ranges, 4 };
+
+#ifdef ST7565_COMPOSITOR
+// A 48x24 popup, and a round cursor that only covers the pixels in its mask
+unsigned char popup_data[48 * 3];
+layer_t popup = { popup_data, 0, 41, 2, 48, 3, 1 };
+unsigned char cursor_data[9];
+unsigned char cursor_mask[9];
+layer_t cursor = { cursor_data, cursor_mask, 5, 6, 9, 1, 1 };
+#endif
+
+// Start each scene on the ST7565 from a blank buffer.  The screen is not
+// cleared, so the first refresh has to replace the last scene.
+void st7565_clear(void) {
+#ifdef ST7565_COMPOSITOR
+	compositor_remove(&popup);
+	compositor_remove(&cursor);
+#endif
+	glcd_scroll(0);
+	draw_filled_rectangle(1, 1, SCREEN_WIDTH, SCREEN_HEIGHT, 0);
+}
+
+void st7565_show(void) {
+	graphics_refresh();
+	pic_st7565_glass(sim_buffer);
+}
+
+void make_diamond(void) {
+	int x, y, d;
+
+	memset(diamond_data, 0, sizeof(diamond_data));
+	for (x = 0; x < 16; x++) {
+		for (y = 0; y < 16; y++) {
+			d = (x < 8 ? 7 - x : x - 8) + (y < 8 ? 7 - y : y - 8);
+			if (d <= 7 && d >= 3) diamond_data[x * 2 + y / 8] |= 1 << (y % 8);
+		}
+	}
+}
+
+void scene_text(void) {
+	draw_text("Tahoma 7 AaBbGg 0123", 1, 1, &Tahoma7, 1);
+	draw_text("Tahoma 10 Quick", 1, 9, &Tahoma10, 1);
+	draw_text("Verdana 8 jumps", 1, 21, &Verdana8, 1);
+	draw_text("Lucida 8 {[()]}", 1, 31, &LucidaConsole8, 1);
+	draw_text("Arial Black", 1, 41, &ArialBlack10, 1);
+	draw_text("System 5x7 ~!@#$%", 1, 56, &System5x7, 1);
+	draw_text("Offscreen", 100, 1, &Tahoma10, 1);
+}
+
+void scene_large_text(void) {
+	draw_text("Ag8", 1, 1, &Tahoma22, 1);
+	draw_text("Wy", 50, 20, &Verdana32, 2);
+	draw_text("Low", 100, 50, &Tahoma16, 0);
+}
+
+void scene_text_box(void) {
+	bounding_box_t box = { 3, 3, 62, 62 };
+	bounding_box_t right = { 66, 3, 125, 62 };
+
+	draw_rectangle(2, 2, 63, 63, 1);
+	draw_text_box("Centred text that wraps onto several lines", box, TEXT_ALIGN_CENTRE, &Tahoma7, 1);
+	draw_rectangle(65, 2, 126, 63, 1);
+	draw_text_box("Right\naligned with a verylongwordthatdoesnotfit", right, TEXT_ALIGN_RIGHT, &Verdana8, 1);
+}
+
+void scene_lines(void) {
+	int i;
+
+	// Every octant from the centre, and lines running off the screen
+	for (i = 0; i < 16; i++) {
+		draw_line(64, 32, 64 + (i % 4 - 2) * 20 + i, 32 + (i / 4 - 2) * 14 + i % 3, 1);
+	}
+	draw_line(-20, 5, 150, 60, 1);
+	draw_line(120, -10, 90, 80, 1);
+	draw_line(1, 64, 128, 64, 1);
+	draw_line(1, 1, 1, 64, 1);
+	draw_line(60, 30, 68, 34, 0);
+}
+
+void scene_circles(void) {
+	draw_circle(20, 20, 15, 1);
+	draw_filled_circle(60, 30, 12, 1);
+	draw_filled_circle(60, 30, 5, 0);
+	draw_circle(120, 60, 20, 1);
+	draw_filled_circle(5, 60, 10, 1);
+	draw_circle(100, 15, 1, 1);
+	draw_filled_circle(100, 30, 0, 1);
+}
+
+void scene_rectangles(void) {
+	draw_rectangle(1, 1, 30, 20, 1);
+	draw_box(35, 1, 64, 20, 1);
+	draw_filled_rectangle(70, 1, 100, 20, 1);
+	draw_filled_rectangle(75, 5, 95, 15, 0);
+	draw_rounded_rectangle(1, 25, 40, 60, 6, 1);
+	draw_filled_rounded_rectangle(45, 25, 84, 60, 10, 1);
+	draw_rounded_rectangle(90, 25, 127, 45, 1, 1);
+	draw_filled_rectangle(110, 50, 140, 70, 1);
+	draw_hspan(88, 105, 55, 1);
+	draw_vspan(86, 48, 63, 1);
+}
+
+void scene_polygons(void) {
+	const point_t arrow[] = { { 5, 10 }, { 30, 10 }, { 30, 3 }, { 45, 18 }, { 30, 33 }, { 30, 26 }, { 5, 26 } };
+	const point_t star[] = { { 80, 2 }, { 90, 30 }, { 62, 12 }, { 98, 12 }, { 70, 30 } };
+	const point_t sliver[] = { { 100, 40 }, { 127, 42 }, { 101, 41 } };
+
+	draw_filled_polygon(arrow, 7, 1);
+	draw_filled_polygon(star, 5, 1);
+	draw_polygon(star, 5, 1);
+	draw_filled_triangle(10, 60, 40, 35, 60, 63, 1);
+	draw_filled_polygon(sliver, 3, 1);
+	draw_polygon(arrow, 3, 1);
+
+	// No radius, and boxes too thin for any corners
+	draw_rounded_rectangle(70, 48, 90, 58, 0, 1);
+	draw_rounded_rectangle(96, 52, 118, 52, 4, 1);
+	draw_rounded_rectangle(124, 46, 124, 60, 3, 1);
+}
+
+void scene_bitmaps(void) {
+	draw_filled_rectangle(1, 33, 128, 64, 1);
+
+	draw_bitmap(&diamond, 1, 1, ROP_COPY);
+	draw_bitmap(&diamond, 20, 3, ROP_OR);
+	draw_bitmap(&diamond, 40, 36, ROP_COPY);
+	draw_bitmap(&diamond, 60, 37, ROP_AND_NOT);
+	draw_bitmap(&box_rle, 80, 5, ROP_COPY);
+	draw_bitmap(&box_rle, 100, 40, ROP_AND_NOT);
+	draw_bitmap(&checker_xbm, 40, 10, ROP_COPY);
+	draw_bitmap(&checker_xbm, 55, 45, ROP_OR);
+	draw_bitmap(&diamond, 120, 60, ROP_COPY);
+}
+
+void scene_xor(void) {
+	draw_filled_rectangle(1, 1, 64, 64, 1);
+	draw_bitmap(&diamond, 56, 10, ROP_XOR);
+	draw_bitmap(&checker_xbm, 60, 40, ROP_XOR);
+	draw_bitmap(&box_rle, 20, 20, ROP_XOR);
+	draw_bitmap(&diamond, 90, 10, ROP_XOR);
+	draw_bitmap(&diamond, 94, 14, ROP_XOR);
+}
+
+void scene_clipping(void) {
+	bounding_box_t full = { 108, 4, 124, 24 };
+	bounding_box_t narrow = { 110, 40, 113, 52 };
+	int n;
+
+	draw_rectangle(20, 10, 100, 50, 1);
+	graphics_clip_push(21, 11, 99, 49);
+	draw_text("Clipped text runs off", 10, 20, &Tahoma10, 1);
+	draw_filled_circle(100, 50, 15, 1);
+	graphics_clip_push(30, 30, 60, 60);
+	draw_line(1, 1, 128, 64, 1);
+	draw_bitmap(&diamond, 50, 40, ROP_COPY);
+	graphics_clip_pop();
+	draw_filled_polygon((const point_t[]) { { 10, 40 }, { 50, 60 }, { 10, 60 } }, 3, 1);
+	graphics_clip_pop();
+	draw_text("Outside", 1, 55, &Tahoma7, 1);
+
+	// A text box with no clip rectangles left keeps the caller's one
+	for (n = 1; n < GRAPHICS_CLIP_DEPTH; n++) {
+		graphics_clip_push(104, 1, SCREEN_WIDTH, SCREEN_HEIGHT);
+	}
+	graphics_clip_push(full.x1, full.y1, full.x2, full.y2);
+	draw_text_box("Full", full, TEXT_ALIGN_LEFT, &Tahoma7, 1);
+	draw_line(104, 1, SCREEN_WIDTH, 30, 1);
+	for (n = 0; n < GRAPHICS_CLIP_DEPTH; n++) {
+		graphics_clip_pop();
+	}
+
+	// A letter wider than its box starts at the left edge
+	draw_text_box("W", narrow, TEXT_ALIGN_RIGHT, &Tahoma10, 1);
+}
+
+void scene_numbers(void) {
+	char a[6], b[8], c[4];
+	number_t left, right, small;
+
+	number_init(&right, a, 1, 1, 6, 2, TEXT_ALIGN_RIGHT, &Tahoma10, 1);
+	number_init(&left, b, 1, 20, 8, 0, TEXT_ALIGN_LEFT, &Verdana12, 1);
+	number_init(&small, c, 80, 40, 4, 1, TEXT_ALIGN_RIGHT, &System5x7, 1);
+
+	number_set(&right, 12345);
+	number_set(&right, 2048);
+	number_set(&left, -1234567);
+	number_set(&left, 42);
+	number_set(&small, -5);
+	number_set(&small, 99999);
+}
+
+void scene_unicode(void) {
+	bounding_box_t box = { 1, 20, 40, 40 };
+
+	draw_text("21\xC2\xB0", 1, 1, &units, 1);
+	draw_text("1\xC2\xB5" "2", 30, 1, &units, 1);
+	draw_text("\xCE\xA9\xE2\x82\xAC", 60, 1, &units, 1);
+
+	// Characters that are not in the font, one of them outside 16 bits,
+	// and a Latin-1 degree sign that is not valid UTF-8
+	draw_text("1\xC3\xA4" "2\xF0\x9F\x98\x80" "1", 1, 10, &units, 1);
+	draw_text("2\xB0" "1", 40, 10, &units, 1);
+
+	draw_text_box("12\xC2\xB0 21\xE2\x82\xAC 1\xCE\xA9", box, TEXT_ALIGN_CENTRE, &units, 1);
+	draw_text("Caf\xC3\xA9 21", 50, 45, &Tahoma10, 1);
+}
+
+void scene_runs(void) {
+	const text_run_t status[] = {
+		{ "21.5", &Tahoma16 },
+		{ "\xC2\xB0", &units },
+		{ "C ", &Tahoma8 },
+		{ "~a", &Webdings14 },
+		{ " Ag", &System5x7 }
+	};
+	const text_run_t missing[] = {
+		{ "", &Tahoma10 },
+		{ "1\xC3\xA4" "2", &units }
+	};
+	bounding_box_t box;
+	unsigned char width;
+
+	box = draw_text_runs(status, 5, 1, 1, 1);
+	draw_rectangle(box.x1, box.y1, box.x2, box.y2, 1);
+
+	// Right aligned from a single measurement
+	width = text_runs_width(status, 3, 0);
+	draw_text_runs(status, 3, SCREEN_WIDTH + 1 - width, 30, 0);
+	draw_vspan(SCREEN_WIDTH - width, 30, 50, 1);
+
+	draw_text_runs(missing, 2, 1, 55, 1);
+}
+
+void scene_gauges(void) {
+	gauge_t right, left, up, down, empty;
+
+	draw_rectangle(1, 1, 62, 10, 1);
+	gauge_init(&right, 2, 2, 60, 8, GAUGE_RIGHT, 100);
+	gauge_init(&left, 2, 14, 60, 8, GAUGE_LEFT, 100);
+	gauge_init(&up, 80, 1, 10, 60, GAUGE_UP, 1000);
+	gauge_init(&down, 100, 3, 13, 50, GAUGE_DOWN, 50);
+	gauge_init(&empty, 2, 30, 60, 4, GAUGE_RIGHT, 0);
+
+	// Growing, shrinking and past the end
+	gauge_set(&right, 80);
+	gauge_set(&right, 30);
+	gauge_set(&right, 55);
+	gauge_set(&left, 200);
+	gauge_set(&left, 25);
+	gauge_set(&up, 900);
+	gauge_set(&up, 333);
+	gauge_set(&down, 10);
+	gauge_set(&down, 37);
+	gauge_set(&empty, 5);
+
+	// Drawn over, then put back
+	draw_filled_rectangle(1, 40, 128, 50, 1);
+	gauge_redraw(&up);
+	gauge_redraw(&down);
+}
+
+void scene_widgets(void) {
+	const bounding_box_t screen = { 1, 1, SCREEN_WIDTH, SCREEN_HEIGHT };
+	const bounding_box_t title_box = { 1, 1, 60, 11 };
+	bounding_box_t bar_box = { 1, 0, 60, 0 };
+	const bounding_box_t menu_box = { 70, 12, SCREEN_WIDTH, SCREEN_HEIGHT };
+	const bounding_box_t list_box = { 72, 14, SCREEN_WIDTH - 2, SCREEN_HEIGHT - 2 };
+	const char * const items[] = { "Start", "Stop", "Setup", "Alarms", "About" };
+	panel_t root, menu;
+	label_t title;
+	value_t reading;
+	bar_t level;
+	icon_t alarm;
+	list_t list;
+	char text[5];
+
+	widget_panel_init(&root, screen, 0);
+	widget_label_init(&title, title_box, "Tank", TEXT_ALIGN_LEFT, &Tahoma8);
+	widget_value_init(&reading, text, 1, 13, 5, 1, TEXT_ALIGN_RIGHT, &Tahoma16, 1);
+
+	// Widgets must not overlap, so the bar goes below the whole value field
+	bar_box.y1 = reading.widget.box.y2 + 3;
+	bar_box.y2 = bar_box.y1 + 7;
+	widget_bar_init(&level, bar_box, 100);
+	widget_icon_init(&alarm, 40, 45, &diamond);
+	widget_panel_init(&menu, menu_box, 1);
+	widget_list_init(&list, list_box, items, 5, &Tahoma8);
+
+	widget_add(&root, &title.widget);
+	widget_add(&root, &reading.widget);
+	widget_add(&root, &level.widget);
+	widget_add(&root, &alarm.widget);
+	widget_add(&root, &menu.widget);
+	widget_add(&menu, &list.widget);
+
+	widget_value_set(&reading, 1234);
+	widget_bar_set(&level, 40);
+	widget_frame(&root);
+
+	// Only these widgets are drawn again, the list scrolls by one item
+	widget_label_set(&title, "Tank 2");
+	widget_value_set(&reading, 1250);
+	widget_bar_set(&level, 75);
+	widget_show(&alarm.widget, 0);
+	widget_list_select(&list, 2);
+	widget_list_select(&list, 4);
+	widget_frame(&root);
+
+	// Nothing has changed, so nothing should be drawn
+	if (widget_frame(&root)) draw_text("Redrawn", 1, 55, &Tahoma7, 1);
+}
+
+// Several refreshes, each changing part of the last picture.  The ST7565 only
+// sends the columns that are marked as changed, or with ST7565_SHADOW_BUFFER
+// the bytes that really differ, with gaps between the runs.
+void scene_refresh(void) {
+	const unsigned char columns[] = { 10, 12, 15, 19, 24 };
+	unsigned char n;
+
+	draw_text("Refresh", 1, 1, &Tahoma10, 1);
+	draw_filled_rectangle(1, 20, SCREEN_WIDTH, 27, 1);
+	draw_hspan(SCREEN_WIDTH, SCREEN_WIDTH, SCREEN_HEIGHT, 1);
+	graphics_refresh();
+
+	// Gaps of 1, 2, 3 and 4 unchanged columns between the changes
+	for (n = 0; n < sizeof(columns); n++) {
+		draw_vspan(columns[n], 20, 27, 0);
+	}
+	draw_hspan(1, 1, SCREEN_HEIGHT, 1);
+	draw_hspan(SCREEN_WIDTH, SCREEN_WIDTH, SCREEN_HEIGHT, 0);
+	graphics_refresh();
+
+	// Drawn again without any change, and changed then put back
+	draw_text("Refresh", 1, 1, &Tahoma10, 1);
+	draw_hspan(60, 60, 40, 1);
+	draw_hspan(60, 60, 40, 0);
+	draw_hspan(100, 110, 40, 1);
+	graphics_refresh();
+
+	draw_text("Done", 40, 45, &Tahoma10, 1);
+}
+
+void scene_chart(void) {
+	unsigned char samples[100];
+	chart_t chart;
+	unsigned char n;
+
+	draw_rectangle(14, 9, 115, 50, 1);
+	chart_init(&chart, samples, 15, 10, 100, 40, CHART_SWEEP);
+
+	// More samples than fit, so the sweep wraps around
+	for (n = 0; n < 130; n++) {
+		chart_add(&chart, (n * 3) % 40);
+		if (n % 16 == 0) graphics_refresh();
+	}
+}
+
+void scene_console(void) {
+	char line[16];
+	unsigned char n;
+
+	console_init(&System5x7, 1);
+	console_puts("A long line that wraps onto the next one\n");
+
+	// The last few lines scroll the first ones off the top
+	for (n = 1; n <= 10; n++) {
+		snprintf(line, sizeof(line), "Line %d\n", n);
+		console_puts(line);
+		if (n % 3 == 0) graphics_refresh();
+	}
+	console_puts("Typed over\rDone");
+}
+
+#ifdef ST7565_COMPOSITOR
+void scene_layers(void) {
+	draw_text("Under the popup", 1, 1, &Tahoma10, 1);
+	draw_filled_rectangle(1, 30, SCREEN_WIDTH, 35, 1);
+	draw_filled_rectangle(1, 52, 30, 53, 1);
+	graphics_refresh();
+
+	compositor_add(&popup);
+	compositor_draw(&popup);
+	draw_filled_rectangle(1, 1, 48, 24, 0);
+	draw_rectangle(1, 1, 48, 24, 1);
+	draw_text("ALARM", 6, 7, &Tahoma10, 1);
+	compositor_draw(0);
+	graphics_refresh();
+
+	// Blinked off and on again
+	compositor_show(&popup, 0);
+	graphics_refresh();
+	compositor_show(&popup, 1);
+
+	// Only the pixels inside the circle hide the line underneath
+	compositor_add(&cursor);
+	compositor_draw_mask(&cursor);
+	draw_filled_circle(5, 5, 3, 1);
+	compositor_draw(&cursor);
+	draw_circle(5, 5, 3, 1);
+	compositor_draw(0);
+	graphics_refresh();
+
+	// The background changes under the popup, which stays on top
+	draw_line(1, 17, SCREEN_WIDTH, 48, 1);
+}
+#endif
+
+#ifdef GRAPHICS_DIRECT_BUFFER
+void scene_chart_scroll(void) {
+	unsigned char samples[SCREEN_HEIGHT];
+	chart_t chart;
+	unsigned char n;
+
+	// The rotated screen is SCREEN_HEIGHT wide
+	graphics_set_rotation(GRAPHICS_ROTATE_90);
+	chart_init(&chart, samples, 1, 20, SCREEN_HEIGHT, 80, CHART_SCROLL);
+
+	for (n = 0; n < 100; n++) {
+		chart_add(&chart, (n * 5) % 80);
+		if (n % 16 == 0) graphics_refresh();
+	}
+	graphics_set_rotation(GRAPHICS_ROTATE_0);
+}
+
+void scene_rotation(void) {
+	graphics_set_rotation(GRAPHICS_ROTATE_90);
+	draw_text("Rotated 90", 1, 1, &Tahoma7, 1);
+	draw_rectangle(1, 20, 30, 40, 1);
+	graphics_set_rotation(GRAPHICS_ROTATE_180);
+	draw_text("Upside down", 1, 1, &Tahoma10, 1);
+	draw_bitmap(&checker_xbm, 5, 20, ROP_COPY);
+	graphics_set_rotation(GRAPHICS_ROTATE_270);
+	draw_text("270", 1, 1, &Verdana8, 1);
+	draw_filled_circle(20, 100, 8, 1);
+	graphics_set_rotation(GRAPHICS_ROTATE_0);
+}
+
+void scene_dither(void) {
+	unsigned char row[64];
+	int x, y;
+
+	for (y = 0; y < 2; y++) {
+		dither_start(1 + y * 64, 1, 64, y ? DITHER_DIFFUSION : DITHER_ORDERED);
+		for (x = 0; x < 64 * 64; x++) {
+			row[x % 64] = (x % 64) * 4 + (x / 64) % 4;
+			if (x % 64 == 63) dither_row(row);
+		}
+	}
+}
+#endif
+
+const scene_t scenes[] = {
+	{ "text", scene_text, 0 },
+	{ "large_text", scene_large_text, 0 },
+	{ "text_box", scene_text_box, 0 },
+	{ "lines", scene_lines, 0 },
+	{ "circles", scene_circles, 0 },
+	{ "rectangles", scene_rectangles, 0 },
+	{ "polygons", scene_polygons, 0 },
+	{ "bitmaps", scene_bitmaps, 0 },
+	{ "xor", scene_xor, SCENE_READ },
+	{ "clipping", scene_clipping, 0 },
+	{ "numbers", scene_numbers, 0 },
+	{ "unicode", scene_unicode, 0 },
+	{ "runs", scene_runs, 0 },
+	{ "gauges", scene_gauges, 0 },
+	{ "widgets", scene_widgets, 0 },
+	{ "refresh", scene_refresh, 0 },
+	{ "chart", scene_chart, 0 },
+	{ "console", scene_console, SCENE_SCROLL },
+#ifdef ST7565_COMPOSITOR
+	{ "layers", scene_layers, SCENE_LAYERS },
+#endif
+#ifdef GRAPHICS_DIRECT_BUFFER
+	{ "chart_scroll", scene_chart_scroll, SCENE_BUFFER | SCENE_SCROLL },
+	{ "rotation", scene_rotation, SCENE_BUFFER },
+	{ "dither", scene_dither, SCENE_BUFFER }
+#endif
+};
+
+int main(int argc, char **argv) {
+	char filename[256];
+	const char *directory;
+	unsigned char update = 0;
+	unsigned int s, d;
+	int differ, failed = 0;
+
+	if (argc == 3 && !strcmp(argv[1], "--update")) {
+		update = 1;
+		directory = argv[2];
+	} else if (argc == 2) {
+		directory = argv[1];
+	} else {
+		fprintf(stderr, "Usage: %s [--update] DIRECTORY\n", argv[0]);
+		return 2;
+	}
+
+	make_diamond();
+
+	// The screen is switched on once, and keeps its picture between scenes
+	pic_st7565_power_on();
+	glcd_init();
+
+	for (s = 0; s < sizeof(scenes) / sizeof(scenes[0]); s++) {
+		snprintf(filename, sizeof(filename), "%s/%s.pbm", directory, scenes[s].name);
+
+		for (d = 0; d < sizeof(drivers) / sizeof(drivers[0]); d++) {
+			if ((scenes[s].needs & drivers[d].has) != scenes[s].needs) continue;
+
+			graphics_set_driver(drivers[d].driver);
+			drivers[d].clear();
+			scenes[s].draw();
+			if (drivers[d].show) drivers[d].show();
+
+			if (update) {
+				if (!sim_write_pbm(filename)) {
+					fprintf(stderr, "Could not write %s\n", filename);
+					return 2;
+				}
+				printf("%-12s saved\n", scenes[s].name);
+				break;
+			}
+
+			differ = sim_compare_pbm(filename);
+			if (differ) {
+				printf("%-12s %-8s FAIL (%d pixels differ)\n", scenes[s].name, drivers[d].name, differ);
+				snprintf(filename, sizeof(filename), "%s-%s.pbm", scenes[s].name, drivers[d].name);
+				sim_write_pbm(filename);
+				snprintf(filename, sizeof(filename), "%s/%s.pbm", directory, scenes[s].name);
+				failed++;
+			} else {
+				printf("%-12s %-8s ok\n", scenes[s].name, drivers[d].name);
+			}
+		}
+	}
+
+	if (!update) printf("%d failed\n", failed);
+
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,39 @@
+// The libraries include htc.h for the registers of the PIC.  On a PC the port
+// pins used by the ST7565 library (see st7565-config.h) are plain variables,
+// apart from the clock pin LATB3, which counts the bits sent to the screen and
+// passes them to an emulated ST7565 in pic.c.
+#ifndef _HTC_H_
+#define _HTC_H_
+
+// delay.h only builds with the PIC compiler, so it is replaced by pic.c
+#define _DELAY_H_
+void DelayMs(unsigned char count);
+
+extern unsigned char LATB0, LATB1, LATB2, LATB4;
+#define LATB3 (*_pic_spi_clock())
+
+/** The number of bits clocked out to the screen as data (A0 high) */
+extern unsigned long pic_spi_data_bits;
+/** The number of bits clocked out to the screen as commands (A0 low) */
+extern unsigned long pic_spi_command_bits;
+
+/**
+ * Switch on the emulated ST7565.  Like a real screen its memory is filled
+ * with noise, so anything the library fails to send shows up on the glass.
+ */
+void pic_st7565_power_on(void);
+/**
+ * Read what the emulated ST7565 shows, using its display start line and
+ * scan directions.  The columns of memory beyond the edge of the screen are
+ * not shown.
+ *
+ * @param buffer	SCREEN_WIDTH * SCREEN_HEIGHT / 8 bytes, stored like
+ *					glcd_buffer
+ */
+void pic_st7565_glass(unsigned char *buffer);
+
+/* Internal functions (do not call) */
+unsigned char *_pic_spi_clock(void);
+void _pic_st7565_byte(unsigned char byte, unsigned char data);
+
+#endif // _HTC_H_
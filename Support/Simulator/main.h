@@ -0,0 +1,2 @@
+// The libraries include main.h for the clock speed and other settings of the
+// PIC.  Nothing is needed when they are built for a PC.
@@ -0,0 +1,151 @@
+#include "htc.h"
+#include "graphics.h"
+#include "st7565-config.h"
+#include "st7565.h"
+
+// The pins of the ST7565, see st7565-config.h
+unsigned char LATB0, LATB1, LATB2, LATB4;
+unsigned char pic_spi_clock = 0;
+
+unsigned long pic_spi_data_bits = 0;
+unsigned long pic_spi_command_bits = 0;
+
+// The byte being shifted in, and how many of its bits have arrived
+unsigned char pic_spi_byte = 0;
+unsigned char pic_spi_count = 0;
+
+// The memory of the ST7565 is 132 columns of 65 rows (8 pages and one row of
+// icons), which is larger than the screen
+unsigned char pic_st7565_ram[9][132];
+unsigned char pic_st7565_page = 0;
+unsigned char pic_st7565_column = 0;
+// The row of the memory shown at the top of the screen
+unsigned char pic_st7565_start = 0;
+// Whether the columns (ADC) and rows (COM) are scanned in reverse
+unsigned char pic_st7565_adc_reverse = 0;
+unsigned char pic_st7565_com_reverse = 0;
+unsigned char pic_st7565_on = 0;
+unsigned char pic_st7565_inverse = 0;
+unsigned char pic_st7565_all_on = 0;
+// Set when the next command byte is the value of the last one
+unsigned char pic_st7565_value = 0;
+
+// Called for every write to the clock pin.  The ST7565 reads each bit as the
+// clock rises and the library always sets it back low, so a bit has been sent
+// whenever the pin is written while it is high.
+unsigned char *_pic_spi_clock(void) {
+	if (pic_spi_clock) {
+		if (GLCD_A0) {
+			pic_spi_data_bits++;
+		} else {
+			pic_spi_command_bits++;
+		}
+
+		// The most significant bit comes first, and A0 is read with the last
+		pic_spi_byte = (pic_spi_byte << 1) | (GLCD_SDA ? 1 : 0);
+		if (++pic_spi_count == 8) {
+			_pic_st7565_byte(pic_spi_byte, GLCD_A0);
+			pic_spi_count = 0;
+		}
+	}
+
+	return &pic_spi_clock;
+}
+
+void pic_st7565_power_on(void) {
+	unsigned long random = 1;
+	unsigned char page, column;
+
+	// Nothing is known about the memory until it has been written
+	for (page = 0; page < 9; page++) {
+		for (column = 0; column < 132; column++) {
+			random = random * 1103515245 + 12345;
+			pic_st7565_ram[page][column] = random >> 16;
+		}
+	}
+
+	pic_spi_count = 0;
+	pic_st7565_page = 0;
+	pic_st7565_column = 0;
+	pic_st7565_start = 0;
+	pic_st7565_adc_reverse = 0;
+	pic_st7565_com_reverse = 0;
+	pic_st7565_on = 0;
+	pic_st7565_inverse = 0;
+	pic_st7565_all_on = 0;
+	pic_st7565_value = 0;
+}
+
+void pic_st7565_glass(unsigned char *buffer) {
+	unsigned char x, y, row, column, pixel;
+
+	for (y = 0; y < SCREEN_HEIGHT; y++) {
+		// The rows are wired from COM63 at the top, so the memory is only
+		// shown the right way up when the rows are scanned in reverse
+		row = pic_st7565_com_reverse ? y : SCREEN_HEIGHT - 1 - y;
+		row = (row + pic_st7565_start) % 64;
+
+		for (x = 0; x < SCREEN_WIDTH; x++) {
+			// The columns are wired to the last SCREEN_WIDTH segments
+			column = x + 132 - SCREEN_WIDTH;
+			if (pic_st7565_adc_reverse) column = 131 - column;
+
+			pixel = (pic_st7565_ram[row / 8][column] >> (row % 8)) & 1;
+			if (pic_st7565_inverse) pixel ^= 1;
+			if (pic_st7565_all_on) pixel = 1;
+			if (!pic_st7565_on) pixel = 0;
+
+			if (pixel) {
+				buffer[(y / 8) * SCREEN_WIDTH + x] |= 1 << (y % 8);
+			} else {
+				buffer[(y / 8) * SCREEN_WIDTH + x] &= ~(1 << (y % 8));
+			}
+		}
+	}
+}
+
+// Act on a byte sent to the ST7565, either display data or a command
+void _pic_st7565_byte(unsigned char byte, unsigned char data) {
+	if (data) {
+		if (pic_st7565_page < 9) pic_st7565_ram[pic_st7565_page][pic_st7565_column] = byte;
+
+		// The column moves on after each byte, but stops at the last one
+		if (pic_st7565_column < 131) pic_st7565_column++;
+		return;
+	}
+
+	if (pic_st7565_value) {
+		// The value of the volume or booster ratio, which do not change
+		// what is shown
+		pic_st7565_value = 0;
+	} else if ((byte & 0xF0) == GLCD_CMD_SET_PAGE) {
+		pic_st7565_page = byte & 0x0F;
+	} else if ((byte & 0xF0) == GLCD_CMD_COLUMN_UPPER) {
+		pic_st7565_column = (pic_st7565_column & 0x0F) | ((byte & 0x0F) << 4);
+	} else if ((byte & 0xF0) == GLCD_CMD_COLUMN_LOWER) {
+		pic_st7565_column = (pic_st7565_column & 0xF0) | (byte & 0x0F);
+	} else if ((byte & 0xC0) == GLCD_CMD_DISPLAY_START) {
+		pic_st7565_start = byte & 0x3F;
+	} else if ((byte & 0xF0) == GLCD_CMD_VERTICAL_NORMAL) {
+		pic_st7565_com_reverse = (byte & 0x08) ? 1 : 0;
+	} else if ((byte & 0xFE) == GLCD_CMD_HORIZONTAL_NORMAL) {
+		pic_st7565_adc_reverse = byte & 1;
+	} else if ((byte & 0xFE) == GLCD_CMD_DISPLAY_NORMAL) {
+		pic_st7565_inverse = byte & 1;
+	} else if ((byte & 0xFE) == GLCD_CMD_ALL_NORMAL) {
+		pic_st7565_all_on = byte & 1;
+	} else if ((byte & 0xFE) == GLCD_CMD_DISPLAY_OFF) {
+		pic_st7565_on = byte & 1;
+	} else if (byte == GLCD_CMD_VOLUME_MODE || byte == 0xF8) {
+		// Followed by a value, 0xF8 sets the booster ratio
+		pic_st7565_value = 1;
+	} else if (byte == GLCD_CMD_RESET) {
+		pic_st7565_page = 0;
+		pic_st7565_column = 0;
+		pic_st7565_start = 0;
+	}
+}
+
+// Nothing needs to wait on a PC, see delay.h
+void DelayMs(unsigned char count) {
+}
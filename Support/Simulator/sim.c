@@ -0,0 +1,178 @@
+#include <stdio.h>
+
+#include "graphics.h"
+#include "sim.h"
+#include "graphics-config.h"
+
+unsigned char sim_buffer[SCREEN_WIDTH * SCREEN_HEIGHT / 8];
+
+const glcd_driver_t sim_driver = {
+	SCREEN_WIDTH, SCREEN_HEIGHT, sim_buffer,
+	sim_pixel, sim_hspan, sim_vspan, sim_blit, 0, sim_refresh
+};
+
+const glcd_driver_t sim_hook_driver = {
+	SCREEN_WIDTH, SCREEN_HEIGHT, 0,
+	sim_pixel, sim_hspan, sim_vspan, sim_blit, 0, sim_refresh
+};
+
+const glcd_driver_t sim_pixel_driver = {
+	SCREEN_WIDTH, SCREEN_HEIGHT, 0,
+	sim_pixel, 0, 0, 0, 0, sim_refresh
+};
+
+// Frames saved by sim_refresh(), see sim_dump_frames()
+const char *sim_frame_prefix = 0;
+unsigned int sim_frame = 0;
+
+void sim_clear(void) {
+	unsigned int n;
+
+	for (n = 0; n < sizeof(sim_buffer); n++) {
+		sim_buffer[n] = 0;
+	}
+}
+
+unsigned char sim_get_pixel(unsigned char x, unsigned char y) {
+	return (sim_buffer[((y - 1) / 8) * SCREEN_WIDTH + x - 1] >> ((y - 1) % 8)) & 1;
+}
+
+unsigned char sim_write_pbm(const char *filename) {
+	FILE *f = fopen(filename, "w");
+	unsigned char x, y;
+
+	if (!f) return 0;
+
+	// Plain PBM, so that differences can be seen in a text editor
+	fprintf(f, "P1\n# Written by sim.c\n%d %d\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+	for (y = 1; y <= SCREEN_HEIGHT; y++) {
+		for (x = 1; x <= SCREEN_WIDTH; x++) {
+			fputc(sim_get_pixel(x, y) ? '1' : '0', f);
+		}
+		fputc('\n', f);
+	}
+
+	return fclose(f) == 0;
+}
+
+// Read the next number in the header of a PBM file, skipping comments
+int _sim_read_number(FILE *f) {
+	int c, value = 0;
+
+	do {
+		c = fgetc(f);
+		if (c == '#') {
+			while (c != '\n' && c != EOF) c = fgetc(f);
+		}
+	} while (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+
+	if (c < '0' || c > '9') return -1;
+
+	while (c >= '0' && c <= '9') {
+		value = value * 10 + c - '0';
+		c = fgetc(f);
+	}
+
+	return value;
+}
+
+int sim_compare_pbm(const char *filename) {
+	FILE *f = fopen(filename, "rb");
+	int differ = 0;
+	int c;
+	unsigned char raw, bits = 0;
+	unsigned char x, y;
+
+	if (!f) return -1;
+
+	// Only black and white images, plain (P1) or raw (P4)
+	c = fgetc(f) == 'P' ? fgetc(f) : EOF;
+	if (c != '1' && c != '4') {
+		fclose(f);
+		return -1;
+	}
+	raw = c == '4';
+
+	if (_sim_read_number(f) != SCREEN_WIDTH || _sim_read_number(f) != SCREEN_HEIGHT) {
+		fclose(f);
+		return -1;
+	}
+
+	for (y = 1; y <= SCREEN_HEIGHT; y++) {
+		for (x = 1; x <= SCREEN_WIDTH; x++) {
+			if (raw) {
+				// 8 pixels to a byte with the leftmost in the top bit, and
+				// each row starts a new byte
+				if ((x - 1) % 8 == 0) bits = fgetc(f);
+				c = (bits >> (7 - (x - 1) % 8)) & 1;
+			} else {
+				do {
+					c = fgetc(f);
+				} while (c != '0' && c != '1' && c != EOF);
+				c -= '0';
+			}
+
+			if (c != sim_get_pixel(x, y)) differ++;
+		}
+	}
+
+	if (feof(f)) differ = -1;
+	fclose(f);
+
+	return differ;
+}
+
+void sim_dump_frames(const char *prefix) {
+	sim_frame_prefix = prefix;
+	sim_frame = 0;
+}
+
+void sim_pixel(unsigned char x, unsigned char y, unsigned char colour) {
+	unsigned char *p;
+
+	if (x < 1 || x > SCREEN_WIDTH || y < 1 || y > SCREEN_HEIGHT) return;
+
+	p = &sim_buffer[((y - 1) / 8) * SCREEN_WIDTH + x - 1];
+	if (colour) {
+		*p |= 1 << ((y - 1) % 8);
+	} else {
+		*p &= ~(1 << ((y - 1) % 8));
+	}
+}
+
+void sim_hspan(unsigned char x1, unsigned char x2, unsigned char y, unsigned char colour) {
+	for (; x1 <= x2; x1++) {
+		sim_pixel(x1, y, colour);
+	}
+}
+
+void sim_vspan(unsigned char x, unsigned char y1, unsigned char y2, unsigned char colour) {
+	for (; y1 <= y2; y1++) {
+		sim_pixel(x, y1, colour);
+	}
+}
+
+void sim_blit(unsigned char x, unsigned char y, unsigned char data, unsigned char count, unsigned char rop) {
+	for (; count; count--, y++, data >>= 1) {
+		if (rop == ROP_COPY) {
+			sim_pixel(x, y, data & 1);
+		} else if (data & 1) {
+			if (rop == ROP_OR) {
+				sim_pixel(x, y, 1);
+			} else if (rop == ROP_XOR) {
+				sim_pixel(x, y, !sim_get_pixel(x, y));
+			} else {
+				sim_pixel(x, y, 0);
+			}
+		}
+	}
+}
+
+void sim_refresh(void) {
+	char filename[256];
+
+	if (!sim_frame_prefix) return;
+
+	snprintf(filename, sizeof(filename), "%s%04u.pbm", sim_frame_prefix, ++sim_frame);
+	sim_write_pbm(filename);
+}
@@ -0,0 +1,93 @@
+/**
+ * @file   sim.h
+ * @date   October, 2026
+ * @brief  Header for a display driver that runs on a PC.
+ * @details
+ *
+ * A display driver for the graphics library that keeps the screen in memory, so that
+ * drawing can be tested and measured on a PC without any hardware.  Frames can be saved
+ * as PBM images, which most image viewers can open, and compared against saved images.
+ *
+ * Three drivers are provided, which should all draw exactly the same picture:
+ *
+ *  - sim_driver has a buffer, which the graphics library writes directly with
+ *    GRAPHICS_DIRECT_BUFFER (like the ST7565 library).
+ *  - sim_hook_driver has no buffer, so everything is drawn through the pixel,
+ *    span and blit hooks (like the KS0108 library).
+ *  - sim_pixel_driver only has a pixel hook, so the graphics library falls back
+ *    to setting one pixel at a time.  Pixels cannot be read back, so ROP_XOR is
+ *    drawn like ROP_OR.
+ *
+ * See golden_test.c and the Makefile in this directory.
+ *
+ * Example usage:
+ * @code
+ *    graphics_set_driver(&sim_driver);
+ *    sim_clear();
+ *
+ *    draw_text("Hello", 1, 1, &Tahoma10, 1);
+ *    sim_write_pbm("hello.pbm");
+ * @endcode
+ */
+#ifndef _SIM_H_
+#define _SIM_H_
+
+#include <stdio.h>
+
+/** The screen, stored like glcd_buffer with one byte for every 8 rows of each column */
+extern unsigned char sim_buffer[];
+
+/** A driver that is drawn on through sim_buffer */
+extern const glcd_driver_t sim_driver;
+/** A driver that is drawn on through the pixel, span and blit hooks */
+extern const glcd_driver_t sim_hook_driver;
+/** A driver that is drawn on a pixel at a time */
+extern const glcd_driver_t sim_pixel_driver;
+
+/**
+ * Clear the screen.
+ */
+void sim_clear(void);
+/**
+ * Read a single pixel.
+ *
+ * @param x			The x position, from 1 - SCREEN_WIDTH
+ * @param y			The y position, from 1 - SCREEN_HEIGHT
+ * @return			1 if the pixel is on, 0 otherwise
+ */
+unsigned char sim_get_pixel(unsigned char x, unsigned char y);
+/**
+ * Save the screen as a PBM image, with pixels that are on in black.
+ *
+ * @param filename	The file to write
+ * @return			0 if the file could not be written, 1 otherwise
+ */
+unsigned char sim_write_pbm(const char *filename);
+/**
+ * Compare the screen with a PBM image, which can be plain (P1) or raw (P4).
+ *
+ * @param filename	The file to compare with
+ * @return			The number of pixels that differ, or -1 if the file could
+ *					not be read or is not the size of the screen
+ */
+int sim_compare_pbm(const char *filename);
+/**
+ * Save a PBM image every time the screen is refreshed, for example to see an
+ * animation one frame at a time.  Frames are named prefix0001.pbm,
+ * prefix0002.pbm and so on.
+ *
+ * @param prefix	The start of each file name, or 0 to stop saving frames
+ */
+void sim_dump_frames(const char *prefix);
+
+/* Driver hooks, see glcd_driver_t */
+void sim_pixel(unsigned char x, unsigned char y, unsigned char colour);
+void sim_hspan(unsigned char x1, unsigned char x2, unsigned char y, unsigned char colour);
+void sim_vspan(unsigned char x, unsigned char y1, unsigned char y2, unsigned char colour);
+void sim_blit(unsigned char x, unsigned char y, unsigned char data, unsigned char count, unsigned char rop);
+void sim_refresh(void);
+
+/* Internal functions (do not call) */
+int _sim_read_number(FILE *f);
+
+#endif // _SIM_H_
@@ -0,0 +1,223 @@
+from __future__ import print_function
+import argparse
+import os
+import re
+import sys
+
+# Share the compression used for fonts
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), 'GlcdFiles'))
+import fontpack
+
+########
+#   Date: 17th October 2026
+#    URL: http://edeca.net
+# Source: https://github.com/edeca/Electronics
+#
+# This script converts a greyscale image to a black and white bitmap for
+# the graphics library, using the same dithering as Include/dither.c.  The
+# output is a C header containing a bitmap_t that can be drawn with
+# draw_bitmap().
+#
+# Images are read as PBM, PGM or PPM (P1 - P6), which most image editors
+# can save.  Black and white PBM images are passed through unchanged.  If
+# the Python Imaging Library is installed then any format it understands
+# can be used instead.
+#
+# Example:
+#
+#   python dither.py --method diffusion --name logo logo.pgm > logo.h
+#
+# Use --preview to also write a PBM file showing the result, and --rle to
+# compress the bitmap (see BITMAP_RLE in graphics.h).
+#
+# The ordered pattern in dither.c is aligned to the screen rather than the
+# image, so the two only match exactly when the bitmap is drawn at an x
+# and y of 1, 5, 9 and so on.
+########
+
+# 4x4 Bayer matrix thresholds, these must match dither_bayer in dither.c
+bayer = [   8, 136,  40, 168,
+          200,  72, 232, 104,
+           56, 184,  24, 152,
+          248, 120, 216,  88 ]
+
+def doExit(message):
+    sys.stderr.write(message + "\n")
+    sys.exit(1)
+
+def divide(value, divisor):
+    # Divide rounding towards zero, like C
+    if value < 0:
+        return -(-value // divisor)
+    return value // divisor
+
+def readNetpbm(filename):
+    data = open(filename, 'rb').read()
+
+    # Header fields are separated by whitespace and may contain comments.
+    # PBM files have no maximum value.
+    fields = []
+    pos = 0
+    while len(fields) < (3 if data[:2] in (b'P1', b'P4') else 4):
+        match = re.compile(br'\s*(#[^\n]*\n\s*)*(\S+)').match(data, pos)
+        if not match:
+            doExit("Could not read the header of %s" % filename)
+        fields.append(match.group(2))
+        pos = match.end()
+
+    magic = fields[0].decode('ascii')
+    width, height = [int(f) for f in fields[1:3]]
+    channels = 3 if magic in ('P3', 'P6') else 1
+
+    if magic in ('P1', 'P4'):
+        # 1 is black, which becomes 0
+        if magic == 'P4':
+            stride = (width + 7) // 8
+            packed = bytearray(data[pos + 1:pos + 1 + stride * height])
+            if len(packed) < stride * height:
+                doExit("%s is truncated" % filename)
+            bits = [(packed[y * stride + x // 8] >> (7 - x % 8)) & 1 for y in range(height) for x in range(width)]
+        else:
+            bits = [int(b) for b in re.sub(br'#[^\n]*|\s', b'', data[pos:]).decode('ascii')]
+            if len(bits) < width * height:
+                doExit("%s is truncated" % filename)
+        return width, height, [[0 if b else 255 for b in bits[y * width:(y + 1) * width]] for y in range(height)]
+
+    maxval = int(fields[3])
+    if magic in ('P5', 'P6'):
+        if maxval > 255:
+            doExit("Only 8 bit images are supported")
+        raw = bytearray(data[pos + 1:pos + 1 + width * height * channels])
+    elif magic in ('P2', 'P3'):
+        raw = [int(v) for v in data[pos:].split()]
+    else:
+        doExit("%s is not a PGM or PPM file" % filename)
+
+    if len(raw) < width * height * channels:
+        doExit("%s is truncated" % filename)
+
+    rows = []
+    for y in range(height):
+        row = []
+        for x in range(width):
+            n = (y * width + x) * channels
+            if channels == 3:
+                # ITU-R 601 luma, as used by most image editors
+                grey = (raw[n] * 299 + raw[n + 1] * 587 + raw[n + 2] * 114) // 1000
+            else:
+                grey = raw[n]
+            row.append(grey * 255 // maxval)
+        rows.append(row)
+
+    return width, height, rows
+
+def readImage(filename):
+    if filename.lower().endswith(('.pbm', '.pgm', '.ppm', '.pnm')):
+        return readNetpbm(filename)
+
+    try:
+        from PIL import Image
+    except ImportError:
+        doExit("Install the Python Imaging Library to read %s, or save it as PGM" % filename)
+
+    image = Image.open(filename).convert('L')
+    width, height = image.size
+    pixels = list(image.getdata())
+    return width, height, [pixels[y * width:(y + 1) * width] for y in range(height)]
+
+def dither(width, height, rows, method):
+    # Returns rows of booleans, True for black (on) pixels
+    result = []
+    errors = [0] * width
+
+    for y in range(height):
+        out = []
+        right = below_left = below = 0
+
+        for x in range(width):
+            if method == 'diffusion':
+                value = rows[y][x] + errors[x] + right
+                black = value < 128
+                error = value if black else value - 255
+
+                right = divide(error * 7, 16)
+                if x:
+                    errors[x - 1] = below_left + divide(error * 3, 16)
+                below_left = below + divide(error * 5, 16)
+                below = divide(error, 16)
+            else:
+                black = rows[y][x] < bayer[(y % 4) * 4 + x % 4]
+
+            out.append(black)
+
+        if method == 'diffusion' and width:
+            errors[width - 1] = below_left
+
+        result.append(out)
+
+    return result
+
+def writeHeader(name, width, height, pixels, source, rle):
+    # Vertical ceiling, one byte for every 8 rows of each column
+    pages = (height + 7) // 8
+    data = []
+    for x in range(width):
+        for page in range(pages):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height and pixels[y][x]:
+                    byte |= 1 << bit
+            data.append(byte)
+
+    print("// Created by dither.py from %s" % os.path.basename(source))
+    print("#include \"graphics.h\"")
+    print()
+    print("const unsigned char %s_data[] = " % name)
+    print("{")
+    if rle:
+        data = fontpack.compress(data, width, pages)
+        for n in range(0, len(data), 16):
+            print("\t%s," % ", ".join(["0x%02X" % b for b in data[n:n + 16]]))
+    else:
+        for x in range(width):
+            column = data[x * pages:(x + 1) * pages]
+            print("\t%s,\t// Column %d" % (", ".join(["0x%02X" % b for b in column]), x + 1))
+    print("};")
+    print()
+    print("const bitmap_t %s = { %s_data, %d, %d, %s };" % (name, name, width, height, "BITMAP_RLE" if rle else "0"))
+
+def writePreview(filename, width, height, pixels):
+    out = open(filename, 'w')
+    out.write("P1\n%d %d\n" % (width, height))
+    for row in pixels:
+        out.write(" ".join(["1" if p else "0" for p in row]) + "\n")
+    out.close()
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a greyscale image to a dithered bitmap_t")
+    parser.add_argument('image', help="PBM, PGM or PPM image (other formats need PIL)")
+    parser.add_argument('--method', choices=['ordered', 'diffusion'], default='diffusion',
+                        help="4x4 Bayer matrix or Floyd-Steinberg error diffusion")
+    parser.add_argument('--name', help="name of the bitmap_t (default: from the file name)")
+    parser.add_argument('--invert', action='store_true', help="swap black and white")
+    parser.add_argument('--preview', metavar='PBM', help="also write the result as a PBM image")
+    parser.add_argument('--rle', action='store_true', help="compress the bitmap")
+    args = parser.parse_args()
+
+    width, height, rows = readImage(args.image)
+    if width > 255 or height > 255:
+        doExit("Images must be smaller than 256x256 pixels")
+
+    if args.invert:
+        rows = [[255 - p for p in row] for row in rows]
+
+    name = args.name or re.sub(r'\W', '_', os.path.splitext(os.path.basename(args.image))[0])
+    pixels = dither(width, height, rows, args.method)
+
+    writeHeader(name, width, height, pixels, args.image, args.rle)
+    if args.preview:
+        writePreview(args.preview, width, height, pixels)
+
+if __name__ == '__main__':
+    main()